@@ -0,0 +1,218 @@
+/*
+    UL calls benchmarked:             ulAIGetInfo(), ulAOGetInfo(), ulAIn(), ulAOut(),
+                                      ulDIn(), ulDOut(), ulCIn()
+
+    Purpose:                          Measures the time the library spends in each call
+                                      looking up the capabilities of the device and
+                                      validating the arguments
+
+    Demonstration:                    Displays the average time per call of the info
+                                      and single point I/O functions of a simulated device
+
+    Usage:                            ApiBenchmark [iterations]
+
+                                      The calls run against a simulated USB-1608GX-2AO,
+                                      whose commands complete without a USB transfer, so
+                                      the time measured is the overhead of the library.
+                                      The ranges passed are the last ones reported for the
+                                      device, the slowest to find in a list of ranges
+
+    Steps:
+    1. Call ulSetConfig() with UL_CFG_USB_SIM_DEVICE to add a simulated USB-1608GX-2AO
+    2. Call ulGetDaqDeviceInventory() to get the descriptor of the simulated device
+    3. Call ulCreateDaqDevice() and ulConnectDaqDevice() to connect to the device
+    4. Call each function the specified number of times and display the average time per call
+    5. Call ulDisconnectDaqDevice() and ulReleaseDaqDevice() before exiting the process.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "uldaq.h"
+#include "utility.h"
+
+#define MAX_DEV_COUNT  100
+
+#define SIM_PRODUCT_ID 0x112	// USB-1608GX-2AO
+
+typedef UlError (*CallFn)(DaqDeviceHandle);
+
+static long long iterations = 1000000;
+
+static int aiRangeIndex = 0;
+static Range aiRange = BIP10VOLTS;
+static Range aoRange = BIP10VOLTS;
+
+static unsigned long long nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static UlError aiGetNumChans(DaqDeviceHandle daqDeviceHandle)
+{
+	long long numChans;
+	return ulAIGetInfo(daqDeviceHandle, AI_INFO_NUM_CHANS, 0, &numChans);
+}
+
+static UlError aiGetSeRange(DaqDeviceHandle daqDeviceHandle)
+{
+	long long range;
+	return ulAIGetInfo(daqDeviceHandle, AI_INFO_SE_RANGE, aiRangeIndex, &range);
+}
+
+static UlError aoGetRange(DaqDeviceHandle daqDeviceHandle)
+{
+	long long range;
+	return ulAOGetInfo(daqDeviceHandle, AO_INFO_RANGE, 0, &range);
+}
+
+static UlError aIn(DaqDeviceHandle daqDeviceHandle)
+{
+	double data;
+	return ulAIn(daqDeviceHandle, 0, AI_SINGLE_ENDED, aiRange, AIN_FF_DEFAULT, &data);
+}
+
+static UlError aOut(DaqDeviceHandle daqDeviceHandle)
+{
+	return ulAOut(daqDeviceHandle, 0, aoRange, AOUT_FF_DEFAULT, 0.0);
+}
+
+static UlError dIn(DaqDeviceHandle daqDeviceHandle)
+{
+	unsigned long long data;
+	return ulDIn(daqDeviceHandle, AUXPORT, &data);
+}
+
+static UlError dOut(DaqDeviceHandle daqDeviceHandle)
+{
+	return ulDOut(daqDeviceHandle, AUXPORT, 0);
+}
+
+static UlError cIn(DaqDeviceHandle daqDeviceHandle)
+{
+	unsigned long long data;
+	return ulCIn(daqDeviceHandle, 0, &data);
+}
+
+static const struct
+{
+	const char* name;
+	CallFn call;
+} calls[] =
+{
+	{"ulAIGetInfo(AI_INFO_NUM_CHANS)", aiGetNumChans},
+	{"ulAIGetInfo(AI_INFO_SE_RANGE)", aiGetSeRange},
+	{"ulAOGetInfo(AO_INFO_RANGE)", aoGetRange},
+	{"ulAIn()", aIn},
+	{"ulAOut()", aOut},
+	{"ulDIn()", dIn},
+	{"ulDOut()", dOut},
+	{"ulCIn()", cIn},
+};
+
+// the last range of each subsystem is used by the calls, the search for it goes through every range
+static void selectRanges(DaqDeviceHandle daqDeviceHandle)
+{
+	long long numRanges = 0;
+	long long range;
+
+	if (ulAIGetInfo(daqDeviceHandle, AI_INFO_NUM_SE_RANGES, 0, &numRanges) == ERR_NO_ERROR && numRanges > 0)
+	{
+		aiRangeIndex = (int) numRanges - 1;
+
+		if (ulAIGetInfo(daqDeviceHandle, AI_INFO_SE_RANGE, aiRangeIndex, &range) == ERR_NO_ERROR)
+			aiRange = (Range) range;
+	}
+
+	if (ulAOGetInfo(daqDeviceHandle, AO_INFO_NUM_RANGES, 0, &numRanges) == ERR_NO_ERROR && numRanges > 0)
+	{
+		if (ulAOGetInfo(daqDeviceHandle, AO_INFO_RANGE, (unsigned int) numRanges - 1, &range) == ERR_NO_ERROR)
+			aoRange = (Range) range;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	DaqDeviceDescriptor devDescriptors[MAX_DEV_COUNT];
+	DaqDeviceDescriptor* devDescriptor = NULL;
+	DaqDeviceHandle daqDeviceHandle = 0;
+	unsigned int numDevs = MAX_DEV_COUNT;
+	unsigned int i;
+	long long n;
+	UlError err = ERR_NO_ERROR;
+
+	if (argc > 1)
+		iterations = atoll(argv[1]);
+
+	err = ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, SIM_PRODUCT_ID);
+
+	if (err == ERR_NO_ERROR)
+		err = ulGetDaqDeviceInventory(USB_IFC, devDescriptors, &numDevs);
+
+	if (err != ERR_NO_ERROR)
+		goto end;
+
+	for (i = 0; i < numDevs; i++)
+	{
+		if (devDescriptors[i].productId == SIM_PRODUCT_ID && strncmp(devDescriptors[i].uniqueId, "SIM", 3) == 0)
+			devDescriptor = &devDescriptors[i];
+	}
+
+	if (devDescriptor == NULL)
+	{
+		err = ERR_DEV_NOT_FOUND;
+		goto end;
+	}
+
+	daqDeviceHandle = ulCreateDaqDevice(*devDescriptor);
+
+	if (daqDeviceHandle == 0)
+	{
+		printf ("\nUnable to create a handle to the specified DAQ device\n");
+		goto end;
+	}
+
+	printf("%s (%s), %lld calls each\n\n", devDescriptor->devString, devDescriptor->uniqueId, iterations);
+
+	err = ulConnectDaqDevice(daqDeviceHandle);
+
+	if (err == ERR_NO_ERROR)
+	{
+		selectRanges(daqDeviceHandle);
+
+		for (i = 0; i < sizeof(calls) / sizeof(calls[0]) && err == ERR_NO_ERROR; i++)
+		{
+			unsigned long long startNs = nowNs();
+
+			for (n = 0; n < iterations && err == ERR_NO_ERROR; n++)
+				err = calls[i].call(daqDeviceHandle);
+
+			if (err == ERR_NO_ERROR)
+				printf("  %-32s %8.1f ns per call\n", calls[i].name, (nowNs() - startNs) / (double) iterations);
+		}
+
+		// disconnect from the DAQ device
+		ulDisconnectDaqDevice(daqDeviceHandle);
+	}
+
+	// release the handle to the DAQ device
+	ulReleaseDaqDevice(daqDeviceHandle);
+
+end:
+	ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, 0);
+
+	if(err != ERR_NO_ERROR)
+	{
+		char errMsg[ERR_MSG_LEN];
+		ulGetErrMsg(err, errMsg);
+		printf("Error Code: %d \n", err);
+		printf("Error Message: %s \n", errMsg);
+		return 1;
+	}
+
+	return 0;
+}
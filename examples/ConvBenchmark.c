@@ -0,0 +1,234 @@
+/*
+    UL calls benchmarked:             ulAInScan()
+
+    Purpose:                          Measures the rate at which each conversion
+                                      kernel of the library converts the samples
+                                      of an analog input scan without hardware
+
+    Demonstration:                    Displays the samples converted per second and
+                                      the processing time per sample of a continuous
+                                      scan for each kernel and each data type
+
+    Usage:                            ConvBenchmark [seconds] [product ID ...]
+
+                                      The processing time is the time the library
+                                      spends in the stages of the scan, measured by
+                                      ulDevGetScanStats(). It is mostly the conversion
+                                      of the samples but also includes the bookkeeping
+                                      of each stage. The default products are the
+                                      USB-1608GX-2AO (0x112), with 16-bit samples, and
+                                      the USB-1808X (0x13e), with 32-bit samples. Kernels
+                                      the CPU does not support are skipped
+
+    Steps:
+    1. Call ulSetConfig() with UL_CFG_USB_SIM_DEVICE to add a simulated device of each product
+    2. Call ulGetDaqDeviceInventory() to get the descriptor of the simulated device
+    3. Call ulCreateDaqDevice() and ulConnectDaqDevice() to connect to the device
+    4. For each kernel, call ulSetConfig() with UL_CFG_SCAN_CONVERTER_ISA to select it
+    5. Start a continuous scan for each data type, let it run for the specified time and stop it
+    6. Call ulDevGetScanStats() to display the conversion rate of the scan
+    7. Call ulDisconnectDaqDevice() and ulReleaseDaqDevice() before exiting the process.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "uldaq.h"
+#include "utility.h"
+
+#define MAX_DEV_COUNT  100
+#define MAX_STR_LENGTH 64
+#define SCAN_CHAN_COUNT 8
+
+static const unsigned int defaultProductIds[] = {0x112, 0x13e};
+
+static const char* isaNames[] = {"auto", "scalar", "sse2", "avx2", "neon"};
+
+static double seconds = 2;
+
+// runs a continuous scan with the kernel selected by UL_CFG_SCAN_CONVERTER_ISA and displays its conversion rate
+static UlError benchConversion(DaqDeviceHandle daqDeviceHandle, const char* isaName, AInScanFlag flags,
+							   const char* typeName, int sampleSize)
+{
+	AiInputMode inputMode;
+	Range range;
+	int numberOfChannels = 0;
+	int chanCount;
+	int samplesPerChannel;
+	double rate = 0;
+	void* buffer;
+	char inputModeStr[MAX_STR_LENGTH];
+	char rangeStr[MAX_STR_LENGTH];
+	ScanStatus status = SS_RUNNING;
+	TransferStatus transferStatus;
+	ScanStats stats;
+	struct timespec runTime;
+	UlError err;
+
+	getAiInfoFirstSupportedInputMode(daqDeviceHandle, &numberOfChannels, &inputMode, inputModeStr);
+	getAiInfoFirstSupportedRange(daqDeviceHandle, inputMode, &range, rangeStr);
+
+	chanCount = numberOfChannels < SCAN_CHAN_COUNT ? numberOfChannels : SCAN_CHAN_COUNT;
+
+	ulAIGetInfoDbl(daqDeviceHandle, AI_INFO_MAX_SCAN_RATE, 0, &rate);
+	rate /= chanCount;
+
+	// the simulated device is not paced by the rate, the buffer only has to be large enough for the stages
+	samplesPerChannel = 100000;
+
+	buffer = malloc(chanCount * samplesPerChannel * sampleSize);
+
+	if (buffer == NULL)
+		return ERR_BAD_BUFFER;
+
+	memset(&transferStatus, 0, sizeof(transferStatus));
+
+	err = ulAInScan(daqDeviceHandle, 0, chanCount - 1, inputMode, range, samplesPerChannel, &rate,
+					(ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), flags, (double*) buffer);
+
+	if (err == ERR_NO_ERROR)
+	{
+		runTime.tv_sec = (time_t) seconds;
+		runTime.tv_nsec = (long) ((seconds - runTime.tv_sec) * 1e9);
+		nanosleep(&runTime, NULL);
+
+		err = ulAInScanStatus(daqDeviceHandle, &status, &transferStatus);
+
+		ulAInScanStop(daqDeviceHandle);
+	}
+
+	if (err == ERR_NO_ERROR)
+		err = ulDevGetScanStats(daqDeviceHandle, 0, &stats);
+
+	if (err == ERR_BAD_FLAG)
+	{
+		printf("    %-8s %-8s not supported by the device\n", isaName, typeName);
+		err = ERR_NO_ERROR;
+	}
+	else if (err == ERR_NO_ERROR && stats.processNs > 0)
+	{
+		double sampleCount = (double) transferStatus.currentTotalCount;
+
+		printf("    %-8s %-8s %8.1f MS/s  %6.2f ns per sample  (%.0f samples)\n", isaName, typeName,
+				sampleCount * 1e3 / stats.processNs, stats.processNs / sampleCount, sampleCount);
+	}
+
+	free(buffer);
+
+	return err;
+}
+
+static UlError benchDevice(DaqDeviceHandle daqDeviceHandle)
+{
+	long long sampleSize = 2;
+	long long defaultIsa = 0;
+	long long isa;
+	UlError err;
+
+	ulAIGetInfo(daqDeviceHandle, AI_INFO_SAMPLE_SIZE, 0, &sampleSize);
+
+	err = ulGetConfig(UL_CFG_SCAN_CONVERTER_ISA, 0, &defaultIsa);
+
+	if (err == ERR_NO_ERROR)
+		printf("  %lld-bit samples, the library selects the %s kernel by default\n\n", sampleSize * 8, isaNames[defaultIsa]);
+
+	for (isa = 1; isa < (long long) (sizeof(isaNames) / sizeof(isaNames[0])) && err == ERR_NO_ERROR; isa++)
+	{
+		if (ulSetConfig(UL_CFG_SCAN_CONVERTER_ISA, 0, isa) != ERR_NO_ERROR)
+			continue;
+
+		err = benchConversion(daqDeviceHandle, isaNames[isa], AINSCAN_FF_DEFAULT, "double", sizeof(double));
+
+		if (err == ERR_NO_ERROR)
+			err = benchConversion(daqDeviceHandle, isaNames[isa], AINSCAN_FF_FLOAT32DATA, "float", sizeof(float));
+
+		// integer buffers hold calibrated counts, which are not scaled
+		if (err == ERR_NO_ERROR && sampleSize == 2)
+			err = benchConversion(daqDeviceHandle, isaNames[isa], (AInScanFlag) (AINSCAN_FF_UINT16DATA | AINSCAN_FF_NOSCALEDATA), "uint16", sizeof(unsigned short));
+
+		if (err == ERR_NO_ERROR && sampleSize == 4)
+			err = benchConversion(daqDeviceHandle, isaNames[isa], (AInScanFlag) (AINSCAN_FF_UINT32DATA | AINSCAN_FF_NOSCALEDATA), "uint32", sizeof(unsigned int));
+	}
+
+	ulSetConfig(UL_CFG_SCAN_CONVERTER_ISA, 0, 0);
+
+	return err;
+}
+
+int main(int argc, char* argv[])
+{
+	DaqDeviceDescriptor devDescriptors[MAX_DEV_COUNT];
+	unsigned int productIds[MAX_DEV_COUNT];
+	unsigned int productCount = 0;
+	unsigned int numDevs = MAX_DEV_COUNT;
+	unsigned int i;
+	UlError err = ERR_NO_ERROR;
+
+	if (argc > 1)
+		seconds = atof(argv[1]);
+
+	for (i = 2; i < (unsigned int) argc && productCount < MAX_DEV_COUNT; i++)
+		productIds[productCount++] = (unsigned int) strtoul(argv[i], NULL, 0);
+
+	if (productCount == 0)
+	{
+		for (i = 0; i < sizeof(defaultProductIds) / sizeof(defaultProductIds[0]); i++)
+			productIds[productCount++] = defaultProductIds[i];
+	}
+
+	for (i = 0; i < productCount && err == ERR_NO_ERROR; i++)
+		err = ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, productIds[i]);
+
+	if (err == ERR_NO_ERROR)
+		err = ulGetDaqDeviceInventory(USB_IFC, devDescriptors, &numDevs);
+
+	if (err != ERR_NO_ERROR)
+		goto end;
+
+	for (i = 0; i < numDevs && err == ERR_NO_ERROR; i++)
+	{
+		DaqDeviceHandle daqDeviceHandle;
+
+		// only the simulated devices, their scans run without hardware
+		if (strncmp(devDescriptors[i].uniqueId, "SIM", 3) != 0)
+			continue;
+
+		daqDeviceHandle = ulCreateDaqDevice(devDescriptors[i]);
+
+		if (daqDeviceHandle == 0)
+		{
+			printf ("\nUnable to create a handle to the specified DAQ device\n");
+			continue;
+		}
+
+		printf("\n%s (%s)\n", devDescriptors[i].devString, devDescriptors[i].uniqueId);
+
+		err = ulConnectDaqDevice(daqDeviceHandle);
+
+		if (err == ERR_NO_ERROR)
+		{
+			err = benchDevice(daqDeviceHandle);
+
+			// disconnect from the DAQ device
+			ulDisconnectDaqDevice(daqDeviceHandle);
+		}
+
+		// release the handle to the DAQ device
+		ulReleaseDaqDevice(daqDeviceHandle);
+	}
+
+end:
+	ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, 0);
+
+	if(err != ERR_NO_ERROR)
+	{
+		char errMsg[ERR_MSG_LEN];
+		ulGetErrMsg(err, errMsg);
+		printf("Error Code: %d \n", err);
+		printf("Error Message: %s \n", errMsg);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,363 @@
+/*
+    UL calls benchmarked:             ulAIn(), ulAInSnapshot(), ulDIn(), ulCIn(),
+                                      ulAInScan() with ulAInScanRead()
+
+    Purpose:                          Measures the command latency and the scan
+                                      throughput of a network DAQ device
+
+    Demonstration:                    Displays the latency distribution of each
+                                      command, the rate and CPU cost of a
+                                      continuous analog input scan and the transfer
+                                      counters of the scan
+
+    Usage:                            NetBenchmark <host> [port] [seconds] [rate]
+
+                                      The device can be simulated with
+                                      src/net/netdevsim.py, e.g.
+                                        python3 netdevsim.py --port 54300
+                                        NetBenchmark 192.168.1.10 54300
+                                      where the host is the address of a network
+                                      interface of the machine other than loopback
+
+    Steps:
+    1. Call ulGetNetDaqDeviceDescriptor() to get the descriptor of the device
+    2. Call ulCreateDaqDevice() and ulConnectDaqDevice() to connect to the device
+    3. Call each command CMD_ITERATIONS times and display the distribution of its latency
+    4. Call ulAInScan() to start a continuous scan at the maximum rate or the specified rate
+    5. Call ulAInScanRead() until the specified time elapses and display the rate and CPU time
+    6. Call ulAInScanStop() and ulDevGetScanStats() to display the transfer counters of the scan
+    7. Call ulDisconnectDaqDevice() and ulReleaseDaqDevice() before exiting the process.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "uldaq.h"
+#include "utility.h"
+
+#define MAX_STR_LENGTH 64
+#define CMD_ITERATIONS 1000
+#define SNAPSHOT_CHAN_COUNT 8
+#define SCAN_CHAN_COUNT 4
+
+static DaqDeviceHandle daqDeviceHandle = 0;
+static AiInputMode inputMode;
+static Range range;
+static int snapshotChanCount = 1;
+static DigitalPortType portType;
+
+static unsigned long long nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static unsigned long long cpuNs(void)
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	return ((unsigned long long) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)) * 1000000000ULL +
+		   ((unsigned long long) (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)) * 1000ULL;
+}
+
+static int compareNs(const void* a, const void* b)
+{
+	unsigned long long x = *(const unsigned long long*) a;
+	unsigned long long y = *(const unsigned long long*) b;
+
+	return (x > y) - (x < y);
+}
+
+static UlError aInOp(void)
+{
+	double data;
+	return ulAIn(daqDeviceHandle, 0, inputMode, range, AIN_FF_DEFAULT, &data);
+}
+
+static UlError aInLoopOp(void)
+{
+	UlError err = ERR_NO_ERROR;
+	double data;
+	int chan;
+
+	for (chan = 0; chan < snapshotChanCount && err == ERR_NO_ERROR; chan++)
+		err = ulAIn(daqDeviceHandle, chan, inputMode, range, AIN_FF_DEFAULT, &data);
+
+	return err;
+}
+
+static UlError aInSnapshotOp(void)
+{
+	double data[SNAPSHOT_CHAN_COUNT];
+	return ulAInSnapshot(daqDeviceHandle, 0, snapshotChanCount - 1, inputMode, range, AIN_FF_DEFAULT, data);
+}
+
+static UlError dInOp(void)
+{
+	unsigned long long data;
+	return ulDIn(daqDeviceHandle, portType, &data);
+}
+
+static UlError cInOp(void)
+{
+	unsigned long long data;
+	return ulCIn(daqDeviceHandle, 0, &data);
+}
+
+// calls the command CMD_ITERATIONS times and displays the latency percentiles in microseconds
+static UlError benchCmd(const char* name, UlError (*op)(void))
+{
+	static unsigned long long latencyNs[CMD_ITERATIONS];
+	unsigned long long totalNs = 0;
+	UlError err = ERR_NO_ERROR;
+	int i;
+
+	for (i = 0; i < CMD_ITERATIONS && err == ERR_NO_ERROR; i++)
+	{
+		unsigned long long start = nowNs();
+
+		err = op();
+
+		latencyNs[i] = nowNs() - start;
+		totalNs += latencyNs[i];
+	}
+
+	if (err != ERR_NO_ERROR)
+	{
+		printf("  %-28s failed, error %d\n", name, err);
+		return err;
+	}
+
+	qsort(latencyNs, CMD_ITERATIONS, sizeof(latencyNs[0]), compareNs);
+
+	printf("  %-28s avg %8.1f  min %8.1f  p50 %8.1f  p99 %8.1f  max %8.1f\n", name,
+			totalNs / 1000.0 / CMD_ITERATIONS,
+			latencyNs[0] / 1000.0,
+			latencyNs[CMD_ITERATIONS / 2] / 1000.0,
+			latencyNs[CMD_ITERATIONS * 99 / 100] / 1000.0,
+			latencyNs[CMD_ITERATIONS - 1] / 1000.0);
+
+	return err;
+}
+
+static void printHistogram(const char* name, const unsigned long long histogram[32])
+{
+	int bucket;
+
+	printf("  %s:", name);
+
+	for (bucket = 0; bucket < 32; bucket++)
+	{
+		if (histogram[bucket])
+			printf(" [%.1f us]=%llu", (1ULL << bucket) / 1000.0, histogram[bucket]);
+	}
+
+	printf("\n");
+}
+
+int main(int argc, char* argv[])
+{
+	DaqDeviceDescriptor devDescriptor;
+	const char* host;
+	unsigned short port = 54211;
+	double seconds = 5;
+	double rate = 0;
+
+	int numberOfChannels = 0;
+	int hasDio = 0;
+	int hasCtr = 0;
+	int chanCount = 0;
+	int samplesPerChannel = 0;
+	int readScanCount = 0;
+	double maxRate = 0;
+
+	char inputModeStr[MAX_STR_LENGTH];
+	char rangeStr[MAX_STR_LENGTH];
+	char portTypeStr[MAX_STR_LENGTH];
+
+	double* buffer = NULL;
+	double* readBuffer = NULL;
+	UlError err = ERR_NO_ERROR;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <host> [port] [seconds] [rate]\n", argv[0]);
+		return 1;
+	}
+
+	host = argv[1];
+
+	if (argc > 2)
+		port = (unsigned short) atoi(argv[2]);
+
+	if (argc > 3)
+		seconds = atof(argv[3]);
+
+	if (argc > 4)
+		rate = atof(argv[4]);
+
+	// get the descriptor of the network device
+	err = ulGetNetDaqDeviceDescriptor(host, port, NULL, &devDescriptor, 5.0);
+
+	if (err != ERR_NO_ERROR)
+		goto end;
+
+	daqDeviceHandle = ulCreateDaqDevice(devDescriptor);
+
+	if (daqDeviceHandle == 0)
+	{
+		printf ("\nUnable to create a handle to the specified DAQ device\n");
+		goto end;
+	}
+
+	printf("Connecting to device %s at %s:%d - please wait ...\n", devDescriptor.devString, host, port);
+
+	err = ulConnectDaqDevice(daqDeviceHandle);
+
+	if (err != ERR_NO_ERROR)
+		goto end;
+
+	err = getAiInfoFirstSupportedInputMode(daqDeviceHandle, &numberOfChannels, &inputMode, inputModeStr);
+	err = getAiInfoFirstSupportedRange(daqDeviceHandle, inputMode, &range, rangeStr);
+
+	snapshotChanCount = numberOfChannels < SNAPSHOT_CHAN_COUNT ? numberOfChannels : SNAPSHOT_CHAN_COUNT;
+
+	printf("\nCommand latency in us, %d calls each (%s, %s)\n", CMD_ITERATIONS, inputModeStr, rangeStr);
+
+	err = benchCmd("ulAIn()", aInOp);
+
+	if (err == ERR_NO_ERROR)
+	{
+		char name[MAX_STR_LENGTH];
+
+		sprintf(name, "%d x ulAIn()", snapshotChanCount);
+		benchCmd(name, aInLoopOp);
+
+		sprintf(name, "ulAInSnapshot() %d chans", snapshotChanCount);
+		benchCmd(name, aInSnapshotOp);
+	}
+
+	getDevInfoHasDio(daqDeviceHandle, &hasDio);
+
+	if (hasDio)
+	{
+		getDioInfoFirstSupportedPortType(daqDeviceHandle, &portType, portTypeStr);
+		benchCmd("ulDIn()", dInOp);
+	}
+
+	getDevInfoHasCtr(daqDeviceHandle, &hasCtr);
+
+	if (hasCtr)
+		benchCmd("ulCIn()", cInOp);
+
+	// the scan runs at the maximum rate of the device unless a rate is specified
+	chanCount = numberOfChannels < SCAN_CHAN_COUNT ? numberOfChannels : SCAN_CHAN_COUNT;
+
+	ulAIGetInfoDbl(daqDeviceHandle, AI_INFO_MAX_SCAN_RATE, 0, &maxRate);
+
+	if (rate <= 0)
+		rate = maxRate / chanCount;
+
+	// the scan buffer holds about 2 s of data, the data is read in blocks of about 10 ms
+	samplesPerChannel = (int) (rate * 2) < 10000 ? 10000 : (int) (rate * 2);
+	readScanCount = (int) (rate / 100) < 1 ? 1 : (int) (rate / 100);
+
+	buffer = (double*) malloc(chanCount * samplesPerChannel * sizeof(double));
+	readBuffer = (double*) malloc(chanCount * readScanCount * sizeof(double));
+
+	if (buffer == NULL || readBuffer == NULL)
+	{
+		printf("\nOut of memory, unable to create scan buffer\n");
+		goto disconnect;
+	}
+
+	err = ulAInScan(daqDeviceHandle, 0, chanCount - 1, inputMode, range, samplesPerChannel, &rate,
+					(ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), AINSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR)
+	{
+		unsigned long long scanCount = 0;
+		unsigned long long overrunCount = 0;
+		unsigned long long startNs = nowNs();
+		unsigned long long startCpuNs = cpuNs();
+		unsigned long long elapsedNs = 0;
+		unsigned long long elapsedCpuNs = 0;
+		double sampleCount;
+		ScanStats stats;
+
+		printf("\nContinuous ulAInScan() of %d channels at %.0f S/s per channel for %.1f s\n", chanCount, rate, seconds);
+
+		while (elapsedNs < seconds * 1e9)
+		{
+			long long scansRead = 0;
+
+			err = ulAInScanRead(daqDeviceHandle, readScanCount, 1.0, readBuffer, &scansRead);
+
+			scanCount += scansRead;
+			elapsedNs = nowNs() - startNs;
+
+			// the read resumes at the most recent scan after an overrun
+			if (err == ERR_SCAN_BUFFER_OVERRUN)
+				overrunCount++;
+			else if (err != ERR_NO_ERROR && err != ERR_TIMEDOUT)
+				break;
+
+			err = ERR_NO_ERROR;
+		}
+
+		elapsedCpuNs = cpuNs() - startCpuNs;
+		sampleCount = (double) scanCount * chanCount;
+
+		ulAInScanStop(daqDeviceHandle);
+
+		printf("  samples read:       %.0f (%.0f S/s, %.1f%% of the requested rate)\n", sampleCount,
+				sampleCount * 1e9 / elapsedNs, scanCount * 1e9 / elapsedNs * 100.0 / rate);
+		printf("  read overruns:      %llu\n", overrunCount);
+
+		if (sampleCount > 0)
+			printf("  CPU time:           %.1f%% of one core, %.1f ns per sample\n",
+					elapsedCpuNs * 100.0 / elapsedNs, elapsedCpuNs / sampleCount);
+
+		if (ulDevGetScanStats(daqDeviceHandle, 0, &stats) == ERR_NO_ERROR)
+		{
+			printf("  stages:             %llu, late %llu\n", stats.stageCount, stats.lateStageCount);
+			printf("  max interval:       %.1f us\n", stats.maxIntervalNs / 1000.0);
+			printf("  max backlog:        %llu of %llu bytes\n", stats.maxBacklog, stats.backlogCapacity);
+
+			printHistogram("stage intervals", stats.intervalHistogram);
+			printHistogram("stage processing", stats.processHistogram);
+		}
+	}
+
+disconnect:
+
+	// disconnect from the DAQ device
+	ulDisconnectDaqDevice(daqDeviceHandle);
+
+end:
+
+	// release the handle to the DAQ device
+	if(daqDeviceHandle)
+		ulReleaseDaqDevice(daqDeviceHandle);
+
+	// release the scan buffers
+	if(buffer)
+		free(buffer);
+
+	if(readBuffer)
+		free(readBuffer);
+
+	if(err != ERR_NO_ERROR)
+	{
+		char errMsg[ERR_MSG_LEN];
+		ulGetErrMsg(err, errMsg);
+		printf("Error Code: %d \n", err);
+		printf("Error Message: %s \n", errMsg);
+	}
+
+	return 0;
+}
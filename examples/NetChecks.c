@@ -0,0 +1,248 @@
+/*
+    UL calls checked:                 ulGetNetDaqDeviceDescriptor(), ulAIn(),
+                                      ulAInSnapshot()
+
+    Purpose:                          Checks the behavior of the network code
+                                      of the library against a simulated device
+
+    Demonstration:                    Runs each check against a device simulated
+                                      by src/net/netdevsim.py and displays whether
+                                      it passed
+
+    Usage:                            NetChecks <host> [port]
+
+                                      The simulator must be started with the
+                                      options the checks rely on, e.g.
+                                        python3 netdevsim.py --port 54300 --discovery-latency 200 --latency 20 --oversized-ain 2
+                                        NetChecks 192.168.1.10 54300
+                                      where the host is the address of a network
+                                      interface of the machine other than loopback.
+                                      The process exits with a non-zero status if
+                                      a check fails
+
+    Steps:
+    1. Call ulGetNetDaqDeviceDescriptor() to get the descriptor of the device
+    2. Call ulCreateDaqDevice() and ulConnectDaqDevice() to connect to the device
+    3. Run each check and display its result
+    4. Call ulDisconnectDaqDevice() and ulReleaseDaqDevice() before exiting the process.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "uldaq.h"
+#include "utility.h"
+
+#define DISCOVERY_TIMEOUT 2.0
+#define MAX_STR_LENGTH 64
+#define SNAPSHOT_CHAN_COUNT 8
+
+// the --discovery-latency and --latency of the simulator, in ms
+#define SIM_DISCOVERY_LATENCY 200
+#define SIM_CMD_LATENCY 20
+
+// the --oversized-ain of the simulator, the channel code of a single ended channel is its number
+#define SIM_OVERSIZED_CHAN 2
+
+typedef int (*CheckFn)(DaqDeviceHandle, char* detail);
+
+static const char* host = NULL;
+static int port = 54211;
+
+static unsigned long long nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static UlError timeLookup(DaqDeviceDescriptor* devDescriptor, double* ms)
+{
+	unsigned long long startNs = nowNs();
+	UlError err;
+
+	err = ulGetNetDaqDeviceDescriptor(host, port, NULL, devDescriptor, DISCOVERY_TIMEOUT);
+
+	*ms = (nowNs() - startNs) / 1e6;
+
+	return err;
+}
+
+// a lookup of the same host and port reuses the discovery info while it is younger than UL_CFG_NET_DISCOVERY_CACHE_TTL,
+// the simulator delays its discovery replies so a lookup that goes to the network is the slow one
+static int checkDiscoveryCache(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	DaqDeviceDescriptor devDescriptor;
+	long long ttl = 0;
+	double discoveryMs = 0;
+	double cachedMs = 0;
+	UlError err;
+
+	err = ulGetConfig(UL_CFG_NET_DISCOVERY_CACHE_TTL, 0, &ttl);
+
+	// the lookup of main() is in the cache, with no reuse the device is discovered again
+	if (err == ERR_NO_ERROR)
+		err = ulSetConfig(UL_CFG_NET_DISCOVERY_CACHE_TTL, 0, 0);
+
+	if (err == ERR_NO_ERROR)
+		err = timeLookup(&devDescriptor, &discoveryMs);
+
+	if (err == ERR_NO_ERROR)
+		err = ulSetConfig(UL_CFG_NET_DISCOVERY_CACHE_TTL, 0, ttl);
+
+	if (err == ERR_NO_ERROR)
+		err = timeLookup(&devDescriptor, &cachedMs);
+
+	ulSetConfig(UL_CFG_NET_DISCOVERY_CACHE_TTL, 0, ttl);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+	else if (discoveryMs < SIM_DISCOVERY_LATENCY)
+		sprintf(detail, "the lookup without reuse took %.1f ms, the simulator delays its reply by %d ms", discoveryMs,
+				SIM_DISCOVERY_LATENCY);
+	else if (cachedMs >= SIM_DISCOVERY_LATENCY / 2)
+		sprintf(detail, "the cached lookup took %.1f ms", cachedMs);
+
+	return detail[0] == 0;
+}
+
+// the snapshot pipelines a command per channel, the reply of the oversized channel fails the snapshot while the
+// replies of the following channels are still in flight. They must be discarded by the library, otherwise the next
+// commands would be matched to them and fail, or take a resend each to get back in step with the device
+static int checkBatchResync(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	Range range = BIP10VOLTS;
+	char rangeStr[MAX_STR_LENGTH];
+	double reference[SNAPSHOT_CHAN_COUNT];
+	double snapshot[SNAPSHOT_CHAN_COUNT];
+	double value;
+	double ms;
+	unsigned long long startNs;
+	int chan;
+	UlError err = ERR_NO_ERROR;
+
+	getAiInfoFirstSupportedRange(daqDeviceHandle, AI_SINGLE_ENDED, &range, rangeStr);
+
+	for (chan = 0; chan < SNAPSHOT_CHAN_COUNT && err == ERR_NO_ERROR; chan++)
+	{
+		if (chan != SIM_OVERSIZED_CHAN)
+			err = ulAIn(daqDeviceHandle, chan, AI_SINGLE_ENDED, range, AIN_FF_DEFAULT, &reference[chan]);
+	}
+
+	if (err != ERR_NO_ERROR)
+	{
+		sprintf(detail, "error %d reading the reference values", err);
+		return 0;
+	}
+
+	err = ulAInSnapshot(daqDeviceHandle, 0, SNAPSHOT_CHAN_COUNT - 1, AI_SINGLE_ENDED, range, AIN_FF_DEFAULT, snapshot);
+
+	if (err != ERR_BAD_BUFFER_SIZE)
+	{
+		sprintf(detail, "the snapshot returned error %d instead of %d", err, ERR_BAD_BUFFER_SIZE);
+		return 0;
+	}
+
+	for (chan = 0; chan < SNAPSHOT_CHAN_COUNT && detail[0] == 0; chan++)
+	{
+		if (chan == SIM_OVERSIZED_CHAN)
+			continue;
+
+		startNs = nowNs();
+
+		err = ulAIn(daqDeviceHandle, chan, AI_SINGLE_ENDED, range, AIN_FF_DEFAULT, &value);
+
+		ms = (nowNs() - startNs) / 1e6;
+
+		if (err != ERR_NO_ERROR)
+			sprintf(detail, "error %d reading channel %d after the snapshot", err, chan);
+		else if (value != reference[chan])
+			sprintf(detail, "channel %d read %f after the snapshot instead of %f", chan, value, reference[chan]);
+		else if (ms >= 2 * SIM_CMD_LATENCY)
+			sprintf(detail, "reading channel %d after the snapshot took %.1f ms", chan, ms);
+	}
+
+	return detail[0] == 0;
+}
+
+static const struct
+{
+	const char* name;
+	CheckFn check;
+} checks[] =
+{
+	{"discovery info is reused within its TTL", checkDiscoveryCache},
+	{"a failed batch of commands leaves no reply behind", checkBatchResync},
+};
+
+int main(int argc, char* argv[])
+{
+	DaqDeviceDescriptor devDescriptor;
+	DaqDeviceHandle daqDeviceHandle = 0;
+	unsigned int i;
+	int failed = 0;
+	UlError err = ERR_NO_ERROR;
+
+	if (argc < 2)
+	{
+		printf("Usage: NetChecks <host> [port]\n");
+		return 1;
+	}
+
+	host = argv[1];
+
+	if (argc > 2)
+		port = atoi(argv[2]);
+
+	// get the descriptor of the network device
+	err = ulGetNetDaqDeviceDescriptor(host, port, NULL, &devDescriptor, DISCOVERY_TIMEOUT);
+
+	if (err != ERR_NO_ERROR)
+		goto end;
+
+	daqDeviceHandle = ulCreateDaqDevice(devDescriptor);
+
+	if (daqDeviceHandle == 0)
+	{
+		printf ("\nUnable to create a handle to the specified DAQ device\n");
+		goto end;
+	}
+
+	printf("%s (%s)\n\n", devDescriptor.devString, devDescriptor.uniqueId);
+
+	err = ulConnectDaqDevice(daqDeviceHandle);
+
+	if (err == ERR_NO_ERROR)
+	{
+		for (i = 0; i < sizeof(checks) / sizeof(checks[0]); i++)
+		{
+			char detail[256] = "";
+			int passed = checks[i].check(daqDeviceHandle, detail);
+
+			printf("%s %s%s%s\n", passed ? "PASS" : "FAIL", checks[i].name, detail[0] ? ": " : "", detail);
+
+			if (!passed)
+				failed++;
+		}
+
+		// disconnect from the DAQ device
+		ulDisconnectDaqDevice(daqDeviceHandle);
+	}
+
+	// release the handle to the DAQ device
+	ulReleaseDaqDevice(daqDeviceHandle);
+
+end:
+	if(err != ERR_NO_ERROR)
+	{
+		char errMsg[ERR_MSG_LEN];
+		ulGetErrMsg(err, errMsg);
+		printf("Error Code: %d \n", err);
+		printf("Error Message: %s \n", errMsg);
+		return 1;
+	}
+
+	return failed ? 1 : 0;
+}
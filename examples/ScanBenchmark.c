@@ -0,0 +1,469 @@
+/*
+    UL calls benchmarked:             ulAInScan(), ulDaqInScan(), ulAOutScan(),
+                                      ulDInScan(), ulDOutScan()
+
+    Purpose:                          Measures the throughput and CPU cost of the
+                                      USB scan transfer path without hardware
+
+    Demonstration:                    Displays the rate, CPU cost and transfer
+                                      counters of a continuous scan of each
+                                      scan type supported by simulated USB devices
+
+    Usage:                            ScanBenchmark [seconds] [bytes/s] [product ID ...]
+
+                                      The scans of a simulated device are not paced
+                                      by the requested rate: each bulk endpoint moves
+                                      the specified number of bytes per second, or as
+                                      many as the library takes when it is 0 (default).
+                                      The default products are the USB-1608GX-2AO
+                                      (0x112), USB-1808X (0x13e) and USB-DIO32HS (0x133).
+                                      The CPU time includes the thread simulating the
+                                      device
+
+                                      The analog input scan runs a second time with
+                                      DEV_CFG_SCAN_PIPELINE set, unpaced it shows how
+                                      far the conversion thread falls behind
+
+    Steps:
+    1. Call ulSetConfig() with UL_CFG_USB_SIM_RATE to set the rate of the simulated endpoints
+    2. Call ulSetConfig() with UL_CFG_USB_SIM_DEVICE to add a simulated device of each product
+    3. Call ulGetDaqDeviceInventory() to get the descriptor of the simulated device
+    4. Call ulCreateDaqDevice() and ulConnectDaqDevice() to connect to the device
+    5. Start a continuous scan of each supported scan type at its maximum rate
+    6. Call the scan status function until the specified time elapses and display the rate and CPU time
+    7. Stop the scan and call ulDevGetScanStats() to display the transfer counters of the scan
+    8. Call ulDisconnectDaqDevice() and ulReleaseDaqDevice() before exiting the process.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "uldaq.h"
+#include "utility.h"
+
+#define MAX_DEV_COUNT  100
+#define MAX_STR_LENGTH 64
+#define SCAN_CHAN_COUNT 8
+
+typedef UlError (*ScanStatusFn)(DaqDeviceHandle, ScanStatus*, TransferStatus*);
+typedef UlError (*ScanStopFn)(DaqDeviceHandle);
+
+static const unsigned int defaultProductIds[] = {0x112, 0x13e, 0x133};
+
+static double seconds = 5;
+
+static unsigned long long nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static unsigned long long cpuNs(void)
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	return ((unsigned long long) (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)) * 1000000000ULL +
+		   ((unsigned long long) (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)) * 1000ULL;
+}
+
+static void printHistogram(const char* name, const unsigned long long histogram[32])
+{
+	int bucket;
+
+	printf("    %s:", name);
+
+	for (bucket = 0; bucket < 32; bucket++)
+	{
+		if (histogram[bucket])
+			printf(" [%.1f us]=%llu", (1ULL << bucket) / 1000.0, histogram[bucket]);
+	}
+
+	printf("\n");
+}
+
+// lets the scan that was just started run for the specified time, then stops it and displays its counters
+static UlError measureScan(DaqDeviceHandle daqDeviceHandle, const char* name, int chanCount, double rate,
+						   ScanStatusFn scanStatus, ScanStopFn scanStop, unsigned int statsIndex)
+{
+	ScanStatus status = SS_RUNNING;
+	TransferStatus transferStatus;
+	ScanStats stats;
+	struct timespec pollInterval = {0, 100000000};
+	unsigned long long startNs = nowNs();
+	unsigned long long startCpuNs = cpuNs();
+	unsigned long long elapsedNs = 0;
+	unsigned long long elapsedCpuNs = 0;
+	double sampleCount;
+	UlError err = ERR_NO_ERROR;
+
+	memset(&transferStatus, 0, sizeof(transferStatus));
+
+	printf("\n  Continuous %s of %d channels, %.0f S/s per channel requested\n", name, chanCount, rate);
+
+	while (elapsedNs < seconds * 1e9 && status == SS_RUNNING && err == ERR_NO_ERROR)
+	{
+		nanosleep(&pollInterval, NULL);
+
+		err = scanStatus(daqDeviceHandle, &status, &transferStatus);
+		elapsedNs = nowNs() - startNs;
+	}
+
+	elapsedCpuNs = cpuNs() - startCpuNs;
+	sampleCount = (double) transferStatus.currentTotalCount;
+
+	scanStop(daqDeviceHandle);
+
+	if (err == ERR_NO_ERROR && status != SS_RUNNING)
+		printf("    the scan stopped before the end of the measurement\n");
+
+	// the counters below show how far behind the conversion of a pipelined scan fell
+	if (err == ERR_SCAN_BUFFER_OVERRUN)
+	{
+		printf("    the scan stopped because its conversion fell behind the transfers\n");
+		err = ERR_NO_ERROR;
+	}
+
+	printf("    samples:            %.0f (%.0f S/s)\n", sampleCount, sampleCount * 1e9 / elapsedNs);
+
+	if (sampleCount > 0)
+		printf("    CPU time:           %.1f%% of one core, %.1f ns per sample\n",
+				elapsedCpuNs * 100.0 / elapsedNs, elapsedCpuNs / sampleCount);
+
+	if (ulDevGetScanStats(daqDeviceHandle, statsIndex, &stats) == ERR_NO_ERROR)
+	{
+		printf("    stages:             %llu, late %llu\n", stats.stageCount, stats.lateStageCount);
+		printf("    processing:         %.1f us per stage, max %.1f us\n",
+				stats.stageCount ? stats.processNs / 1000.0 / stats.stageCount : 0, stats.maxProcessNs / 1000.0);
+		printf("    resubmit:           %.1f us per stage, max %.1f us\n",
+				stats.stageCount ? stats.resubmitNs / 1000.0 / stats.stageCount : 0, stats.maxResubmitNs / 1000.0);
+		printf("    transfers:          %u queued, at least %u still queued\n", stats.xferCount, stats.minXferPending);
+
+		if (stats.backlogCapacity)
+			printf("    max backlog:        %llu of %llu stages, %llu dropped\n", stats.maxBacklog, stats.backlogCapacity,
+					stats.droppedStageCount);
+
+		printHistogram("stage intervals", stats.intervalHistogram);
+		printHistogram("stage processing", stats.processHistogram);
+	}
+
+	return err;
+}
+
+// a pipelined scan converts the samples on a separate thread, it stops with ERR_SCAN_BUFFER_OVERRUN if the
+// conversion falls a full transfer count behind the simulated device
+static UlError benchAInScan(DaqDeviceHandle daqDeviceHandle, int pipelined)
+{
+	AiInputMode inputMode;
+	Range range;
+	int numberOfChannels = 0;
+	int chanCount;
+	int samplesPerChannel;
+	double rate = 0;
+	double* buffer;
+	char inputModeStr[MAX_STR_LENGTH];
+	char rangeStr[MAX_STR_LENGTH];
+	UlError err;
+
+	getAiInfoFirstSupportedInputMode(daqDeviceHandle, &numberOfChannels, &inputMode, inputModeStr);
+	getAiInfoFirstSupportedRange(daqDeviceHandle, inputMode, &range, rangeStr);
+
+	chanCount = numberOfChannels < SCAN_CHAN_COUNT ? numberOfChannels : SCAN_CHAN_COUNT;
+
+	ulAIGetInfoDbl(daqDeviceHandle, AI_INFO_MAX_SCAN_RATE, 0, &rate);
+	rate /= chanCount;
+
+	// the scan buffer holds about 1 s of data at the requested rate
+	samplesPerChannel = (int) rate < 10000 ? 10000 : (int) rate;
+
+	buffer = (double*) malloc(chanCount * samplesPerChannel * sizeof(double));
+
+	if (buffer == NULL)
+		return ERR_BAD_BUFFER;
+
+	ulDevSetConfig(daqDeviceHandle, DEV_CFG_SCAN_PIPELINE, 0, pipelined);
+
+	err = ulAInScan(daqDeviceHandle, 0, chanCount - 1, inputMode, range, samplesPerChannel, &rate,
+					(ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), AINSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR)
+		err = measureScan(daqDeviceHandle, pipelined ? "pipelined ulAInScan()" : "ulAInScan()", chanCount, rate,
+						  ulAInScanStatus, ulAInScanStop, 0);
+
+	ulDevSetConfig(daqDeviceHandle, DEV_CFG_SCAN_PIPELINE, 0, 0);
+
+	free(buffer);
+
+	return err;
+}
+
+static UlError benchDaqInScan(DaqDeviceHandle daqDeviceHandle)
+{
+	DaqInChanDescriptor chanDescriptors[SCAN_CHAN_COUNT];
+	AiInputMode inputMode;
+	Range range;
+	int numberOfChannels = 0;
+	int chanCount;
+	int samplesPerChannel;
+	int i;
+	double rate = 0;
+	double* buffer;
+	char inputModeStr[MAX_STR_LENGTH];
+	char rangeStr[MAX_STR_LENGTH];
+	UlError err;
+
+	getAiInfoFirstSupportedInputMode(daqDeviceHandle, &numberOfChannels, &inputMode, inputModeStr);
+	getAiInfoFirstSupportedRange(daqDeviceHandle, inputMode, &range, rangeStr);
+
+	chanCount = numberOfChannels < SCAN_CHAN_COUNT ? numberOfChannels : SCAN_CHAN_COUNT;
+
+	memset(chanDescriptors, 0, sizeof(chanDescriptors));
+
+	for (i = 0; i < chanCount; i++)
+	{
+		chanDescriptors[i].channel = i;
+		chanDescriptors[i].type = inputMode == AI_DIFFERENTIAL ? DAQI_ANALOG_DIFF : DAQI_ANALOG_SE;
+		chanDescriptors[i].range = range;
+	}
+
+	ulDaqIGetInfoDbl(daqDeviceHandle, DAQI_INFO_MAX_SCAN_RATE, 0, &rate);
+	rate /= chanCount;
+
+	samplesPerChannel = (int) rate < 10000 ? 10000 : (int) rate;
+
+	buffer = (double*) malloc(chanCount * samplesPerChannel * sizeof(double));
+
+	if (buffer == NULL)
+		return ERR_BAD_BUFFER;
+
+	err = ulDaqInScan(daqDeviceHandle, chanDescriptors, chanCount, samplesPerChannel, &rate,
+					  (ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), DAQINSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR)
+		err = measureScan(daqDeviceHandle, "ulDaqInScan()", chanCount, rate, ulDaqInScanStatus, ulDaqInScanStop, 0);
+
+	free(buffer);
+
+	return err;
+}
+
+static UlError benchAOutScan(DaqDeviceHandle daqDeviceHandle)
+{
+	Range range;
+	long long numberOfChannels = 0;
+	int chanCount;
+	int samplesPerChannel;
+	double rate = 0;
+	double* buffer;
+	char rangeStr[MAX_STR_LENGTH];
+	UlError err;
+
+	getAoInfoFirstSupportedRange(daqDeviceHandle, &range, rangeStr);
+
+	ulAOGetInfo(daqDeviceHandle, AO_INFO_NUM_CHANS, 0, &numberOfChannels);
+
+	chanCount = (int) numberOfChannels;
+
+	ulAOGetInfoDbl(daqDeviceHandle, AO_INFO_MAX_SCAN_RATE, 0, &rate);
+	rate /= chanCount;
+
+	samplesPerChannel = (int) rate < 10000 ? 10000 : (int) rate;
+
+	// the output is held at 0 V
+	buffer = (double*) calloc(chanCount * samplesPerChannel, sizeof(double));
+
+	if (buffer == NULL)
+		return ERR_BAD_BUFFER;
+
+	err = ulAOutScan(daqDeviceHandle, 0, chanCount - 1, range, samplesPerChannel, &rate,
+					 (ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), AOUTSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR)
+		err = measureScan(daqDeviceHandle, "ulAOutScan()", chanCount, rate, ulAOutScanStatus, ulAOutScanStop, 1);
+
+	free(buffer);
+
+	return err;
+}
+
+static UlError benchDioScan(DaqDeviceHandle daqDeviceHandle, DigitalDirection direction)
+{
+	DigitalPortType portType;
+	int samplesPerPort;
+	double rate = 0;
+	unsigned long long* buffer;
+	char portTypeStr[MAX_STR_LENGTH];
+	UlError err;
+
+	getDioInfoFirstSupportedPortType(daqDeviceHandle, &portType, portTypeStr);
+
+	err = ulDConfigPort(daqDeviceHandle, portType, direction);
+
+	if (err != ERR_NO_ERROR)
+		return err;
+
+	ulDIOGetInfoDbl(daqDeviceHandle, DIO_INFO_MAX_SCAN_RATE, direction, &rate);
+
+	samplesPerPort = (int) rate < 10000 ? 10000 : (int) rate;
+
+	buffer = (unsigned long long*) calloc(samplesPerPort, sizeof(unsigned long long));
+
+	if (buffer == NULL)
+		return ERR_BAD_BUFFER;
+
+	if (direction == DD_INPUT)
+	{
+		err = ulDInScan(daqDeviceHandle, portType, portType, samplesPerPort, &rate,
+						(ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), DINSCAN_FF_DEFAULT, buffer);
+
+		if (err == ERR_NO_ERROR)
+			err = measureScan(daqDeviceHandle, "ulDInScan()", 1, rate, ulDInScanStatus, ulDInScanStop, 0);
+	}
+	else
+	{
+		err = ulDOutScan(daqDeviceHandle, portType, portType, samplesPerPort, &rate,
+						 (ScanOption) (SO_DEFAULTIO | SO_CONTINUOUS), DOUTSCAN_FF_DEFAULT, buffer);
+
+		if (err == ERR_NO_ERROR)
+			err = measureScan(daqDeviceHandle, "ulDOutScan()", 1, rate, ulDOutScanStatus, ulDOutScanStop, 1);
+	}
+
+	free(buffer);
+
+	return err;
+}
+
+// adds a simulated device of the product and runs each scan type it supports
+static UlError benchDevice(unsigned int productId)
+{
+	DaqDeviceDescriptor devDescriptors[MAX_DEV_COUNT];
+	DaqDeviceDescriptor* devDescriptor = NULL;
+	DaqDeviceHandle daqDeviceHandle = 0;
+	unsigned int numDevs = MAX_DEV_COUNT;
+	unsigned int i;
+
+	int hasAi = 0;
+	int hasAo = 0;
+	int hasDio = 0;
+	int hasDaqi = 0;
+	int hasPacer = 0;
+	UlError err = ERR_NO_ERROR;
+
+	err = ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, productId);
+
+	if (err != ERR_NO_ERROR)
+		return err;
+
+	err = ulGetDaqDeviceInventory(USB_IFC, devDescriptors, &numDevs);
+
+	if (err != ERR_NO_ERROR)
+		return err;
+
+	// the simulated devices are listed last, the device just added is the last one of the product
+	for (i = 0; i < numDevs; i++)
+	{
+		if (devDescriptors[i].productId == productId && strncmp(devDescriptors[i].uniqueId, "SIM", 3) == 0)
+			devDescriptor = &devDescriptors[i];
+	}
+
+	if (devDescriptor == NULL)
+		return ERR_DEV_NOT_FOUND;
+
+	daqDeviceHandle = ulCreateDaqDevice(*devDescriptor);
+
+	if (daqDeviceHandle == 0)
+	{
+		printf ("\nUnable to create a handle to the specified DAQ device\n");
+		return ERR_DEV_NOT_FOUND;
+	}
+
+	printf("\n%s (%s)\n", devDescriptor->devString, devDescriptor->uniqueId);
+
+	err = ulConnectDaqDevice(daqDeviceHandle);
+
+	if (err == ERR_NO_ERROR)
+	{
+		getDevInfoHasAi(daqDeviceHandle, &hasAi);
+		getDevInfoHasDaqi(daqDeviceHandle, &hasDaqi);
+		getDevInfoHasAo(daqDeviceHandle, &hasAo);
+		getDevInfoHasDio(daqDeviceHandle, &hasDio);
+
+		if (hasAi && getAiInfoHasPacer(daqDeviceHandle, &hasPacer) == ERR_NO_ERROR && hasPacer && err == ERR_NO_ERROR)
+		{
+			err = benchAInScan(daqDeviceHandle, 0);
+
+			if (err == ERR_NO_ERROR)
+				err = benchAInScan(daqDeviceHandle, 1);
+		}
+
+		if (hasDaqi && err == ERR_NO_ERROR)
+			err = benchDaqInScan(daqDeviceHandle);
+
+		if (hasAo && getAoInfoHasPacer(daqDeviceHandle, &hasPacer) == ERR_NO_ERROR && hasPacer && err == ERR_NO_ERROR)
+			err = benchAOutScan(daqDeviceHandle);
+
+		if (hasDio && getDioInfoHasPacer(daqDeviceHandle, DD_INPUT, &hasPacer) == ERR_NO_ERROR && hasPacer && err == ERR_NO_ERROR)
+			err = benchDioScan(daqDeviceHandle, DD_INPUT);
+
+		if (hasDio && getDioInfoHasPacer(daqDeviceHandle, DD_OUTPUT, &hasPacer) == ERR_NO_ERROR && hasPacer && err == ERR_NO_ERROR)
+			err = benchDioScan(daqDeviceHandle, DD_OUTPUT);
+
+		// disconnect from the DAQ device
+		ulDisconnectDaqDevice(daqDeviceHandle);
+	}
+
+	// release the handle to the DAQ device
+	ulReleaseDaqDevice(daqDeviceHandle);
+
+	return err;
+}
+
+int main(int argc, char* argv[])
+{
+	long long bytesPerSec = 0;
+	int i;
+	UlError err = ERR_NO_ERROR;
+
+	if (argc > 1)
+		seconds = atof(argv[1]);
+
+	if (argc > 2)
+		bytesPerSec = atoll(argv[2]);
+
+	err = ulSetConfig(UL_CFG_USB_SIM_RATE, 0, bytesPerSec);
+
+	if (err == ERR_NO_ERROR)
+	{
+		if (bytesPerSec)
+			printf("Simulated endpoints move %lld bytes/s\n", bytesPerSec);
+		else
+			printf("Simulated endpoints move data as fast as the library takes it\n");
+	}
+
+	if (argc > 3)
+	{
+		for (i = 3; i < argc && err == ERR_NO_ERROR; i++)
+			err = benchDevice((unsigned int) strtoul(argv[i], NULL, 0));
+	}
+	else
+	{
+		for (i = 0; i < (int) (sizeof(defaultProductIds) / sizeof(defaultProductIds[0])) && err == ERR_NO_ERROR; i++)
+			err = benchDevice(defaultProductIds[i]);
+	}
+
+	ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, 0);
+
+	if(err != ERR_NO_ERROR)
+	{
+		char errMsg[ERR_MSG_LEN];
+		ulGetErrMsg(err, errMsg);
+		printf("Error Code: %d \n", err);
+		printf("Error Message: %s \n", errMsg);
+	}
+
+	return 0;
+}
@@ -0,0 +1,868 @@
+/*
+    UL calls checked:                 ulScanRecorderEnable(), ulAInScan(), ulAInSnapshot(),
+                                      ulAInScanCoefs(), ulEnableEvent(), ulScanGroupBegin(),
+                                      ulConnectDaqDevices(), ulScanGroupStart(),
+                                      ulDevGetScanStats(), ulAIn(), ulGetTraceStats()
+
+    Purpose:                          Checks the behavior of library features
+                                      that can be exercised without hardware
+
+    Demonstration:                    Runs each check against simulated USB
+                                      devices and displays whether it passed
+
+    Usage:                            SimChecks [directory]
+
+                                      The segment files of the scan recorder check
+                                      are written to the directory, /tmp by default.
+                                      The process exits with a non-zero status if
+                                      a check fails
+
+    Steps:
+    1. Call ulSetConfig() with UL_CFG_USB_SIM_DEVICE to add a simulated USB-1608GX-2AO, the checks that need
+       paced transfers set UL_CFG_USB_SIM_RATE while they run and the checks of several devices add their own
+    2. Call ulGetDaqDeviceInventory() to get the descriptor of the simulated device
+    3. Call ulCreateDaqDevice() and ulConnectDaqDevice() to connect to the device
+    4. Run each check and display its result
+    5. Call ulDisconnectDaqDevice() and ulReleaseDaqDevice() before exiting the process.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include "uldaq.h"
+#include "utility.h"
+
+#define MAX_DEV_COUNT  100
+#define MAX_STR_LENGTH 64
+#define SCAN_CHAN_COUNT 8
+#define SNAPSHOT_CHAN_COUNT 4
+#define FPGA_DEV_COUNT 4
+#define GROUP_DEV_COUNT 2
+
+// bytes per second moved by the control endpoint of each simulated device while the FPGA check runs
+#define FPGA_SIM_RATE 1000000
+
+#define SIM_PRODUCT_ID 0x112	// USB-1608GX-2AO
+
+typedef int (*CheckFn)(DaqDeviceHandle, char* detail);
+
+static const char* directory = "/tmp";
+
+// the first fields of the header of a scan recorder segment file
+typedef struct
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t headerSize;
+	uint32_t functionType;
+	uint32_t chanCount;
+	uint32_t sampleSize;
+	uint32_t dataType;
+	uint64_t flags;
+	double rate;
+	uint64_t startTime;
+	uint64_t segmentNumber;
+	uint64_t firstScan;
+	uint64_t scanCapacity;
+	uint64_t scanCount;
+} SegmentHeader;
+
+static UlError runFiniteAInScan(DaqDeviceHandle daqDeviceHandle, int samplesPerChannel, double* buffer)
+{
+	ScanStatus status = SS_RUNNING;
+	TransferStatus transferStatus;
+	double rate = 1000;
+	UlError err;
+
+	err = ulAInScan(daqDeviceHandle, 0, SCAN_CHAN_COUNT - 1, AI_SINGLE_ENDED, BIP10VOLTS, samplesPerChannel, &rate,
+					SO_DEFAULTIO, AINSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR)
+		err = ulAInScanWait(daqDeviceHandle, WAIT_UNTIL_DONE, 0, 10);
+
+	if (err == ERR_NO_ERROR)
+		err = ulAInScanStatus(daqDeviceHandle, &status, &transferStatus);
+
+	ulAInScanStop(daqDeviceHandle);
+
+	return err;
+}
+
+static int isSimDevice(const DaqDeviceDescriptor* descriptor)
+{
+	return descriptor->productId == SIM_PRODUCT_ID && strncmp(descriptor->uniqueId, "SIM", 3) == 0;
+}
+
+// adds count simulated devices and creates a handle to each of them, the devices are not connected
+static UlError createSimDevices(DaqDeviceHandle* daqDeviceHandles, unsigned int count)
+{
+	DaqDeviceDescriptor devDescriptors[MAX_DEV_COUNT];
+	unsigned int numDevs = MAX_DEV_COUNT;
+	unsigned int simCount = 0;
+	unsigned int created = 0;
+	unsigned int i;
+	UlError err;
+
+	memset(daqDeviceHandles, 0, count * sizeof(DaqDeviceHandle));
+
+	err = ulGetDaqDeviceInventory(USB_IFC, devDescriptors, &numDevs);
+
+	for (i = 0; i < numDevs; i++)
+	{
+		if (isSimDevice(&devDescriptors[i]))
+			simCount++;
+	}
+
+	for (i = 0; i < count && err == ERR_NO_ERROR; i++)
+		err = ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, SIM_PRODUCT_ID);
+
+	numDevs = MAX_DEV_COUNT;
+
+	if (err == ERR_NO_ERROR)
+		err = ulGetDaqDeviceInventory(USB_IFC, devDescriptors, &numDevs);
+
+	// the simulated devices are listed in the order they were added
+	for (i = 0; i < numDevs && err == ERR_NO_ERROR; i++)
+	{
+		if (!isSimDevice(&devDescriptors[i]))
+			continue;
+
+		if (simCount > 0)
+			simCount--;
+		else if (created < count)
+		{
+			daqDeviceHandles[created] = ulCreateDaqDevice(devDescriptors[i]);
+
+			if (daqDeviceHandles[created++] == 0)
+				err = ERR_BAD_DEV_HANDLE;
+		}
+	}
+
+	if (err == ERR_NO_ERROR && created < count)
+		err = ERR_DEV_NOT_FOUND;
+
+	return err;
+}
+
+static void releaseSimDevices(DaqDeviceHandle* daqDeviceHandles, unsigned int count)
+{
+	unsigned int i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (daqDeviceHandles[i])
+		{
+			ulDisconnectDaqDevice(daqDeviceHandles[i]);
+			ulReleaseDaqDevice(daqDeviceHandles[i]);
+		}
+	}
+}
+
+static unsigned long long nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static UlError takeSnapshot(DaqDeviceHandle daqDeviceHandle, double* data)
+{
+	return ulAInSnapshot(daqDeviceHandle, 0, SNAPSHOT_CHAN_COUNT - 1, AI_SINGLE_ENDED, BIP10VOLTS,
+						 (AInFlag) (AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA), data);
+}
+
+// the simulator fills IN transfers with a ramp, so the channels of a snapshot read in scan order hold consecutive values
+static int snapshotInOrder(const double* data)
+{
+	int i;
+
+	for (i = 1; i < SNAPSHOT_CHAN_COUNT; i++)
+	{
+		if ((((unsigned int) data[i - 1] + 1) & 0xffff) != (unsigned int) data[i])
+			return 0;
+	}
+
+	return 1;
+}
+
+static int readSegmentHeader(const char* pathPrefix, int segment, SegmentHeader* header)
+{
+	char fileName[512];
+	FILE* file;
+	size_t count;
+
+	snprintf(fileName, sizeof(fileName), "%s.%04d", pathPrefix, segment);
+
+	file = fopen(fileName, "rb");
+
+	if (file == NULL)
+		return 0;
+
+	count = fread(header, sizeof(SegmentHeader), 1, file);
+	fclose(file);
+
+	return count == 1 && memcmp(header->magic, "ULDAQREC", 8) == 0;
+}
+
+// two scans recorded with the same recorder share its ring, the second one must not overwrite the segments of the first
+static int checkRecorderKeepsPreviousScan(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel = 1000;
+	const int scansPerSegment = 400;
+	const int segmentCount = 8;
+	char pathPrefix[256];
+	SegmentHeader header;
+	uint64_t startTime[2] = {0, 0};
+	double* buffer;
+	int passed = 1;
+	int scan, segment;
+	UlError err;
+
+	snprintf(pathPrefix, sizeof(pathPrefix), "%s/simchecks_rec_%d", directory, (int) getpid());
+
+	buffer = (double*) malloc(SCAN_CHAN_COUNT * samplesPerChannel * sizeof(double));
+
+	if (buffer == NULL)
+		return 0;
+
+	err = ulScanRecorderEnable(daqDeviceHandle, SRS_AI, pathPrefix, segmentCount, scansPerSegment * SCAN_CHAN_COUNT * sizeof(double));
+
+	for (scan = 0; scan < 2 && err == ERR_NO_ERROR; scan++)
+		err = runFiniteAInScan(daqDeviceHandle, samplesPerChannel, buffer);
+
+	ulScanRecorderDisable(daqDeviceHandle, SRS_AI);
+
+	if (err != ERR_NO_ERROR)
+	{
+		sprintf(detail, "error %d", err);
+		passed = 0;
+	}
+
+	// 1000 scans fill three segments, the first scan is in segments 0 to 2 and the second one in 3 to 5
+	for (segment = 0; segment < 6 && passed; segment++)
+	{
+		scan = segment / 3;
+
+		if (!readSegmentHeader(pathPrefix, segment, &header) || header.segmentNumber != (uint64_t) segment)
+		{
+			sprintf(detail, "segment %d is missing or out of order", segment);
+			passed = 0;
+		}
+		else if (startTime[scan] == 0)
+			startTime[scan] = header.startTime;
+		else if (header.startTime != startTime[scan])
+		{
+			sprintf(detail, "segment %d holds data of another scan", segment);
+			passed = 0;
+		}
+	}
+
+	if (passed && startTime[0] == startTime[1])
+	{
+		sprintf(detail, "the second scan overwrote the segments of the first one");
+		passed = 0;
+	}
+
+	for (segment = 0; segment < segmentCount; segment++)
+	{
+		char fileName[512];
+		snprintf(fileName, sizeof(fileName), "%s.%04d", pathPrefix, segment);
+		remove(fileName);
+	}
+
+	free(buffer);
+
+	return passed;
+}
+
+// the snapshot is read with a scan, the status and coefficients of the previous scan of the application are kept
+static int checkSnapshotKeepsScanState(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel = 1000;
+	double slopes[SCAN_CHAN_COUNT];
+	double offsets[SCAN_CHAN_COUNT];
+	double data[SNAPSHOT_CHAN_COUNT];
+	unsigned int numChans = SCAN_CHAN_COUNT;
+	ScanStatus status;
+	TransferStatus transferStatus;
+	double* buffer;
+	UlError err;
+
+	buffer = (double*) malloc(SCAN_CHAN_COUNT * samplesPerChannel * sizeof(double));
+
+	if (buffer == NULL)
+		return 0;
+
+	err = runFiniteAInScan(daqDeviceHandle, samplesPerChannel, buffer);
+
+	if (err == ERR_NO_ERROR)
+		err = takeSnapshot(daqDeviceHandle, data);
+
+	if (err == ERR_NO_ERROR)
+		err = ulAInScanStatus(daqDeviceHandle, &status, &transferStatus);
+
+	if (err == ERR_NO_ERROR)
+		err = ulAInScanCoefs(daqDeviceHandle, slopes, offsets, &numChans);
+
+	free(buffer);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+	else if (!snapshotInOrder(data))
+		sprintf(detail, "the snapshot values %.0f, %.0f, %.0f, %.0f are not in channel order", data[0], data[1], data[2], data[3]);
+	else if (transferStatus.currentTotalCount != (unsigned long long) SCAN_CHAN_COUNT * samplesPerChannel)
+		sprintf(detail, "the scan status reports %llu samples instead of %d", transferStatus.currentTotalCount, SCAN_CHAN_COUNT * samplesPerChannel);
+	else if (numChans != SCAN_CHAN_COUNT)
+		sprintf(detail, "ulAInScanCoefs() reports %u channels instead of %d", numChans, SCAN_CHAN_COUNT);
+
+	return detail[0] == 0;
+}
+
+static void countEvent(DaqDeviceHandle daqDeviceHandle, DaqEventType eventType, unsigned long long eventData, void* userData)
+{
+	__atomic_add_fetch((int*) userData, 1, __ATOMIC_RELAXED);
+}
+
+// the events enabled by the application belong to its scans, the scan of a snapshot fires none of them
+static int checkSnapshotFiresNoEvents(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel = 100;
+	double data[SNAPSHOT_CHAN_COUNT];
+	double buffer[SCAN_CHAN_COUNT * 100];
+	int snapshotEventCount;
+	int eventCount = 0;
+	UlError err;
+
+	err = ulEnableEvent(daqDeviceHandle, (DaqEventType) (DE_ON_DATA_AVAILABLE | DE_ON_END_OF_INPUT_SCAN), 1, countEvent, &eventCount);
+
+	if (err == ERR_NO_ERROR)
+		err = takeSnapshot(daqDeviceHandle, data);
+
+	// the events are delivered on the event thread of the device
+	usleep(100000);
+	snapshotEventCount = __atomic_load_n(&eventCount, __ATOMIC_RELAXED);
+
+	if (err == ERR_NO_ERROR)
+		err = runFiniteAInScan(daqDeviceHandle, samplesPerChannel, buffer);
+
+	usleep(100000);
+	ulDisableEvent(daqDeviceHandle, (DaqEventType) (DE_ON_DATA_AVAILABLE | DE_ON_END_OF_INPUT_SCAN));
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+	else if (snapshotEventCount != 0)
+		sprintf(detail, "the snapshot fired %d events", snapshotEventCount);
+	else if (__atomic_load_n(&eventCount, __ATOMIC_RELAXED) == 0)
+		sprintf(detail, "the scan fired no events");
+
+	return detail[0] == 0;
+}
+
+// the scan of a snapshot is not held by ulScanGroupBegin(), the next scan of the application still is
+static int checkSnapshotNotHeldByGroup(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel = 100;
+	double data[SNAPSHOT_CHAN_COUNT];
+	double buffer[SCAN_CHAN_COUNT * 100];
+	double rate = 1000;
+	ScanStatus status = SS_IDLE;
+	TransferStatus transferStatus;
+	UlError err;
+
+	err = ulScanGroupBegin(&daqDeviceHandle, 1);
+
+	if (err == ERR_NO_ERROR)
+		err = takeSnapshot(daqDeviceHandle, data);
+
+	if (err != ERR_NO_ERROR)
+	{
+		sprintf(detail, "the snapshot failed with error %d", err);
+		ulScanGroupStop(&daqDeviceHandle, 1);
+		return 0;
+	}
+
+	err = ulAInScan(daqDeviceHandle, 0, SCAN_CHAN_COUNT - 1, AI_SINGLE_ENDED, BIP10VOLTS, samplesPerChannel, &rate,
+					SO_DEFAULTIO, AINSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR)
+	{
+		usleep(100000);
+		err = ulAInScanStatus(daqDeviceHandle, &status, &transferStatus);
+	}
+
+	if (err == ERR_NO_ERROR && (status != SS_RUNNING || transferStatus.currentTotalCount != 0))
+		sprintf(detail, "the scan after the snapshot was not held");
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+		err = ulScanGroupStart(&daqDeviceHandle, 1, NULL);
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+		err = ulAInScanWait(daqDeviceHandle, WAIT_UNTIL_DONE, 0, 10);
+
+	ulScanGroupStop(&daqDeviceHandle, 1);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+
+	return detail[0] == 0;
+}
+
+// the scan recorder records the scans of the application, a snapshot does not start a recording
+static int checkSnapshotNotRecorded(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	char pathPrefix[256];
+	char fileName[512];
+	double data[SNAPSHOT_CHAN_COUNT];
+	FILE* file;
+	UlError err;
+
+	snprintf(pathPrefix, sizeof(pathPrefix), "%s/simchecks_snap_%d", directory, (int) getpid());
+	snprintf(fileName, sizeof(fileName), "%s.%04d", pathPrefix, 0);
+
+	// paced so the scan is still running when the library marks it as started, which is when the recorder starts
+	err = ulSetConfig(UL_CFG_USB_SIM_RATE, 0, 1000000);
+
+	if (err == ERR_NO_ERROR)
+		err = ulScanRecorderEnable(daqDeviceHandle, SRS_AI, pathPrefix, 2, 4096);
+
+	if (err == ERR_NO_ERROR)
+		err = takeSnapshot(daqDeviceHandle, data);
+
+	ulScanRecorderDisable(daqDeviceHandle, SRS_AI);
+	ulSetConfig(UL_CFG_USB_SIM_RATE, 0, 0);
+
+	file = fopen(fileName, "rb");
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+	else if (file != NULL)
+		sprintf(detail, "the snapshot was recorded to %s", fileName);
+
+	if (file != NULL)
+	{
+		fclose(file);
+		remove(fileName);
+	}
+
+	return detail[0] == 0;
+}
+
+// ulConnectDaqDevices() loads the FPGA images of the devices in parallel, each simulated device moves its image at
+// FPGA_SIM_RATE, so loading several takes about as long as loading one
+static int checkFpgaLoadsInParallel(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	DaqDeviceHandle handles[FPGA_DEV_COUNT];
+	UlError errors[FPGA_DEV_COUNT];
+	unsigned long long oneNs = 0;
+	unsigned long long allNs = 0;
+	unsigned long long startNs;
+	long long progress;
+	unsigned int i;
+	UlError err;
+
+	err = createSimDevices(handles, FPGA_DEV_COUNT);
+
+	if (err == ERR_NO_ERROR)
+		err = ulSetConfig(UL_CFG_USB_SIM_RATE, 0, FPGA_SIM_RATE);
+
+	if (err == ERR_NO_ERROR)
+	{
+		startNs = nowNs();
+		err = ulConnectDaqDevice(handles[0]);
+		oneNs = nowNs() - startNs;
+	}
+
+	if (err == ERR_NO_ERROR)
+	{
+		startNs = nowNs();
+		err = ulConnectDaqDevices(&handles[1], FPGA_DEV_COUNT - 1, errors);
+		allNs = nowNs() - startNs;
+	}
+
+	ulSetConfig(UL_CFG_USB_SIM_RATE, 0, 0);
+
+	for (i = 0; i < FPGA_DEV_COUNT && err == ERR_NO_ERROR && detail[0] == 0; i++)
+	{
+		err = ulDevGetConfig(handles[i], DEV_CFG_HW_INIT_PROGRESS, 0, &progress);
+
+		if (err == ERR_NO_ERROR && progress != 100)
+			sprintf(detail, "the initialization of device %u stopped at %lld%%", i, progress);
+	}
+
+	releaseSimDevices(handles, FPGA_DEV_COUNT);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+	else if (detail[0] == 0 && allNs > 2 * oneNs)
+		sprintf(detail, "loading %d images took %.0f ms, one took %.0f ms", FPGA_DEV_COUNT - 1, allNs / 1e6, oneNs / 1e6);
+
+	return detail[0] == 0;
+}
+
+static UlError startHeldScans(DaqDeviceHandle* daqDeviceHandles, int samplesPerChannel, double* buffer)
+{
+	double rate = 1000;
+	int i;
+	UlError err;
+
+	err = ulScanGroupBegin(daqDeviceHandles, GROUP_DEV_COUNT);
+
+	for (i = 0; i < GROUP_DEV_COUNT && err == ERR_NO_ERROR; i++)
+		err = ulAInScan(daqDeviceHandles[i], 0, SCAN_CHAN_COUNT - 1, AI_SINGLE_ENDED, BIP10VOLTS, samplesPerChannel, &rate,
+						SO_DEFAULTIO, AINSCAN_FF_DEFAULT, buffer + i * SCAN_CHAN_COUNT * samplesPerChannel);
+
+	return err;
+}
+
+// the scans prepared after ulScanGroupBegin() wait for ulScanGroupStart(), which starts all of them
+static int checkScanGroupStartsHeldScans(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel = 100;
+	DaqDeviceHandle handles[GROUP_DEV_COUNT];
+	double buffer[GROUP_DEV_COUNT * SCAN_CHAN_COUNT * 100];
+	TransferStatus transferStatus[GROUP_DEV_COUNT];
+	ScanStatus status = SS_IDLE;
+	double startSkew = -1;
+	int i;
+	UlError err;
+
+	err = createSimDevices(handles, GROUP_DEV_COUNT);
+
+	if (err == ERR_NO_ERROR)
+		err = ulConnectDaqDevices(handles, GROUP_DEV_COUNT, NULL);
+
+	if (err == ERR_NO_ERROR)
+		err = startHeldScans(handles, samplesPerChannel, buffer);
+
+	if (err == ERR_NO_ERROR)
+	{
+		usleep(100000);
+		err = ulScanGroupStatus(handles, GROUP_DEV_COUNT, &status, transferStatus);
+	}
+
+	for (i = 0; i < GROUP_DEV_COUNT && err == ERR_NO_ERROR && detail[0] == 0; i++)
+	{
+		if (status != SS_RUNNING || transferStatus[i].currentTotalCount != 0)
+			sprintf(detail, "the scan of device %d was not held", i);
+	}
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+		err = ulScanGroupStart(handles, GROUP_DEV_COUNT, &startSkew);
+
+	for (i = 0; i < GROUP_DEV_COUNT && err == ERR_NO_ERROR && detail[0] == 0; i++)
+		err = ulAInScanWait(handles[i], WAIT_UNTIL_DONE, 0, 10);
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+		err = ulScanGroupStatus(handles, GROUP_DEV_COUNT, &status, transferStatus);
+
+	for (i = 0; i < GROUP_DEV_COUNT && err == ERR_NO_ERROR && detail[0] == 0; i++)
+	{
+		if (transferStatus[i].currentTotalCount != (unsigned long long) SCAN_CHAN_COUNT * samplesPerChannel)
+			sprintf(detail, "device %d transferred %llu of %d samples", i, transferStatus[i].currentTotalCount,
+					SCAN_CHAN_COUNT * samplesPerChannel);
+	}
+
+	if (err == ERR_NO_ERROR && detail[0] == 0 && (startSkew < 0 || startSkew > 0.1))
+		sprintf(detail, "start skew of %g s", startSkew);
+
+	ulScanGroupStop(handles, GROUP_DEV_COUNT);
+	releaseSimDevices(handles, GROUP_DEV_COUNT);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+
+	return detail[0] == 0;
+}
+
+// a held scan stopped with its own stop function makes ulScanGroupStart() fail without starting the other scans
+static int checkScanGroupRejectsStoppedScan(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel = 100;
+	DaqDeviceHandle handles[GROUP_DEV_COUNT];
+	double buffer[GROUP_DEV_COUNT * SCAN_CHAN_COUNT * 100];
+	ScanStatus status = SS_IDLE;
+	TransferStatus transferStatus;
+	UlError err;
+
+	err = createSimDevices(handles, GROUP_DEV_COUNT);
+
+	if (err == ERR_NO_ERROR)
+		err = ulConnectDaqDevices(handles, GROUP_DEV_COUNT, NULL);
+
+	if (err == ERR_NO_ERROR)
+		err = startHeldScans(handles, samplesPerChannel, buffer);
+
+	if (err == ERR_NO_ERROR)
+		err = ulAInScanStop(handles[1]);
+
+	if (err == ERR_NO_ERROR)
+	{
+		err = ulScanGroupStart(handles, GROUP_DEV_COUNT, NULL);
+
+		if (err == ERR_NO_ERROR)
+			sprintf(detail, "the group started with a stopped scan");
+		else if (err == ERR_BAD_ARG)
+			err = ERR_NO_ERROR;
+	}
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+	{
+		usleep(100000);
+		err = ulAInScanStatus(handles[0], &status, &transferStatus);
+	}
+
+	if (err == ERR_NO_ERROR && detail[0] == 0 && transferStatus.currentTotalCount != 0)
+		sprintf(detail, "the scan of the other device was started");
+
+	ulScanGroupStop(handles, GROUP_DEV_COUNT);
+	releaseSimDevices(handles, GROUP_DEV_COUNT);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+
+	return detail[0] == 0;
+}
+
+static unsigned long long histogramCount(const unsigned long long* histogram)
+{
+	unsigned long long count = 0;
+	int i;
+
+	for (i = 0; i < 32; i++)
+		count += histogram[i];
+
+	return count;
+}
+
+// the counters of ulDevGetScanStats() cover the stages of the last scan, each stage is counted once in each histogram
+static int checkScanStatsCountStages(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int samplesPerChannel[2] = {1000, 100};
+	const int stageSize = 1024;
+	const int xferCount = 4;
+	double buffer[SCAN_CHAN_COUNT * 1000];
+	unsigned long long stageCount[2] = {0, 0};
+	unsigned long long minStageCount;
+	ScanStats stats;
+	int scan;
+	UlError err;
+
+	err = ulDevSetConfig(daqDeviceHandle, DEV_CFG_SCAN_STAGE_SIZE, 0, stageSize);
+
+	if (err == ERR_NO_ERROR)
+		err = ulDevSetConfig(daqDeviceHandle, DEV_CFG_SCAN_XFER_COUNT, 0, xferCount);
+
+	for (scan = 0; scan < 2 && err == ERR_NO_ERROR && detail[0] == 0; scan++)
+	{
+		err = runFiniteAInScan(daqDeviceHandle, samplesPerChannel[scan], buffer);
+
+		if (err == ERR_NO_ERROR)
+			err = ulDevGetScanStats(daqDeviceHandle, 0, &stats);
+
+		if (err != ERR_NO_ERROR)
+			break;
+
+		stageCount[scan] = stats.stageCount;
+		minStageCount = (SCAN_CHAN_COUNT * samplesPerChannel[scan] * sizeof(unsigned short) + stageSize - 1) / stageSize;
+
+		if (stats.stageCount < minStageCount)
+			sprintf(detail, "scan %d counted %llu stages, at least %llu expected", scan, stats.stageCount, minStageCount);
+		else if (histogramCount(stats.processHistogram) != stats.stageCount)
+			sprintf(detail, "scan %d has %llu stages in the processing histogram", scan, histogramCount(stats.processHistogram));
+		else if (histogramCount(stats.intervalHistogram) != stats.stageCount - 1)
+			sprintf(detail, "scan %d has %llu stages in the interval histogram", scan, histogramCount(stats.intervalHistogram));
+		else if (stats.xferCount != (unsigned int) xferCount || stats.minXferPending > stats.xferCount)
+			sprintf(detail, "scan %d reports %u of %u transfers pending", scan, stats.minXferPending, stats.xferCount);
+	}
+
+	if (err == ERR_NO_ERROR && detail[0] == 0 && stageCount[1] >= stageCount[0])
+		sprintf(detail, "the counters were not reset, %llu stages after %llu", stageCount[1], stageCount[0]);
+
+	ulDevSetConfig(daqDeviceHandle, DEV_CFG_SCAN_STAGE_SIZE, 0, 0);
+	ulDevSetConfig(daqDeviceHandle, DEV_CFG_SCAN_XFER_COUNT, 0, 0);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+
+	return detail[0] == 0;
+}
+
+// the number of USB commands sent since the tracepoints were reset, tracing must be enabled. The tracepoints are read
+// until the index runs out, a tracepoint registered while they are read would be missed by a count taken up front
+static unsigned long long usbCommandCount(void)
+{
+	unsigned long long count = 0;
+	TraceStats stats;
+	unsigned int i;
+
+	for (i = 0; ulGetTraceStats(i, &stats) == ERR_NO_ERROR; i++)
+	{
+		if (strncmp(stats.name, "usb cmd", 7) == 0)
+			count += stats.count;
+	}
+
+	return count;
+}
+
+static UlError readChannel(DaqDeviceHandle daqDeviceHandle, int count, unsigned long long* cmdCount)
+{
+	double data;
+	int i;
+	UlError err = ERR_NO_ERROR;
+
+	ulSetConfig(UL_CFG_TRACE_RESET, 0, 0);
+
+	for (i = 0; i < count && err == ERR_NO_ERROR; i++)
+		err = ulAIn(daqDeviceHandle, 0, AI_SINGLE_ENDED, BIP10VOLTS, AIN_FF_DEFAULT, &data);
+
+	*cmdCount = usbCommandCount();
+
+	return err;
+}
+
+// the AIN configuration of an unchanged channel is written once. A scan of the same channel writes the same
+// configuration, but the device state is not trusted once a scan ran, so the next ulAIn() writes it again
+static int checkConfigShadowSkipsWrites(DaqDeviceHandle daqDeviceHandle, char* detail)
+{
+	const int readCount = 10;
+	const int samplesPerChannel = 100;
+	double buffer[100];
+	double rate = 1000;
+	unsigned long long cmdCount = 0;
+	UlError err;
+
+	err = ulSetConfig(UL_CFG_TRACE, 0, 1);
+
+	if (err == ERR_NO_ERROR)
+		err = readChannel(daqDeviceHandle, readCount, &cmdCount);
+
+	// one query per read and at most one configuration write
+	if (err == ERR_NO_ERROR && cmdCount > (unsigned long long) readCount + 1)
+		sprintf(detail, "%d reads of the same channel sent %llu commands", readCount, cmdCount);
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+		err = ulAInScan(daqDeviceHandle, 0, 0, AI_SINGLE_ENDED, BIP10VOLTS, samplesPerChannel, &rate, SO_DEFAULTIO,
+						AINSCAN_FF_DEFAULT, buffer);
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+	{
+		err = ulAInScanWait(daqDeviceHandle, WAIT_UNTIL_DONE, 0, 10);
+		ulAInScanStop(daqDeviceHandle);
+	}
+
+	if (err == ERR_NO_ERROR && detail[0] == 0)
+		err = readChannel(daqDeviceHandle, 1, &cmdCount);
+
+	if (err == ERR_NO_ERROR && detail[0] == 0 && cmdCount != 2)
+		sprintf(detail, "the read after a scan sent %llu commands instead of 2", cmdCount);
+
+	ulSetConfig(UL_CFG_TRACE, 0, 0);
+	ulSetConfig(UL_CFG_TRACE_RESET, 0, 0);
+
+	if (err != ERR_NO_ERROR)
+		sprintf(detail, "error %d", err);
+
+	return detail[0] == 0;
+}
+
+static const struct
+{
+	const char* name;
+	CheckFn check;
+} checks[] =
+{
+	{"scan recorder keeps the segments of the previous scan", checkRecorderKeepsPreviousScan},
+	{"snapshot keeps the status and coefficients of the previous scan", checkSnapshotKeepsScanState},
+	{"snapshot fires no scan events", checkSnapshotFiresNoEvents},
+	{"snapshot is not held by a scan group", checkSnapshotNotHeldByGroup},
+	{"snapshot is not recorded", checkSnapshotNotRecorded},
+	{"scan stats count the stages of the last scan", checkScanStatsCountStages},
+	{"config shadow skips unchanged configuration writes", checkConfigShadowSkipsWrites},
+	{"FPGA images of several devices load in parallel", checkFpgaLoadsInParallel},
+	{"scan group starts the held scans of its devices", checkScanGroupStartsHeldScans},
+	{"scan group does not start with a stopped scan", checkScanGroupRejectsStoppedScan},
+};
+
+int main(int argc, char* argv[])
+{
+	DaqDeviceDescriptor devDescriptors[MAX_DEV_COUNT];
+	DaqDeviceDescriptor* devDescriptor = NULL;
+	DaqDeviceHandle daqDeviceHandle = 0;
+	unsigned int numDevs = MAX_DEV_COUNT;
+	unsigned int i;
+	int failed = 0;
+	UlError err = ERR_NO_ERROR;
+
+	if (argc > 1)
+		directory = argv[1];
+
+	err = ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, SIM_PRODUCT_ID);
+
+	if (err == ERR_NO_ERROR)
+		err = ulGetDaqDeviceInventory(USB_IFC, devDescriptors, &numDevs);
+
+	if (err != ERR_NO_ERROR)
+		goto end;
+
+	for (i = 0; i < numDevs; i++)
+	{
+		if (isSimDevice(&devDescriptors[i]))
+			devDescriptor = &devDescriptors[i];
+	}
+
+	if (devDescriptor == NULL)
+	{
+		err = ERR_DEV_NOT_FOUND;
+		goto end;
+	}
+
+	daqDeviceHandle = ulCreateDaqDevice(*devDescriptor);
+
+	if (daqDeviceHandle == 0)
+	{
+		printf ("\nUnable to create a handle to the specified DAQ device\n");
+		goto end;
+	}
+
+	printf("%s (%s)\n\n", devDescriptor->devString, devDescriptor->uniqueId);
+
+	err = ulConnectDaqDevice(daqDeviceHandle);
+
+	if (err == ERR_NO_ERROR)
+	{
+		for (i = 0; i < sizeof(checks) / sizeof(checks[0]); i++)
+		{
+			char detail[256] = "";
+			int passed = checks[i].check(daqDeviceHandle, detail);
+
+			printf("%s %s%s%s\n", passed ? "PASS" : "FAIL", checks[i].name, detail[0] ? ": " : "", detail);
+
+			if (!passed)
+				failed++;
+		}
+
+		// disconnect from the DAQ device
+		ulDisconnectDaqDevice(daqDeviceHandle);
+	}
+
+	// release the handle to the DAQ device
+	ulReleaseDaqDevice(daqDeviceHandle);
+
+end:
+	ulSetConfig(UL_CFG_USB_SIM_DEVICE, 0, 0);
+
+	if(err != ERR_NO_ERROR)
+	{
+		char errMsg[ERR_MSG_LEN];
+		ulGetErrMsg(err, errMsg);
+		printf("Error Code: %d \n", err);
+		printf("Error Message: %s \n", errMsg);
+		return 1;
+	}
+
+	return failed ? 1 : 0;
+}
@@ -12,6 +12,7 @@ AiChanInfo::AiChanInfo(int chan)
 {
 	mChanNum = chan;
 	mTypes = (AiChanType) 0;
+	mModeMask = 0;
 }
 
 AiChanInfo::~AiChanInfo()
@@ -21,6 +22,9 @@ AiChanInfo::~AiChanInfo()
 void AiChanInfo::addChanMode(AiInputMode mode)
 {
 	mMode.push_back(mode);
+
+	if(mode >= 0 && mode < 32)
+		mModeMask |= 1U << mode;
 }
 
 void AiChanInfo::setChanTypes(long long type)
@@ -43,6 +47,11 @@ std::vector<AiInputMode> AiChanInfo::getChanModes() const
 	return mMode;
 }
 
+bool AiChanInfo::isChanModeSupported(AiInputMode mode) const
+{
+	return mode >= 0 && mode < 32 && (mModeMask & (1U << mode));
+}
+
 /*
 public TcInfo getTcInfo()
 {
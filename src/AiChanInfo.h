@@ -24,12 +24,14 @@ public:
 	void setChanTypes(long long types);
 	int getChanNum() const;
 	std::vector<AiInputMode> getChanModes() const;
+	bool isChanModeSupported(AiInputMode mode) const;
 	AiChanType getChanTypes() const;
 
 private:
 	int mChanNum;
 	AiChanType mTypes;
 	std::vector<AiInputMode> mMode;
+	unsigned int mModeMask;
 
 	//TcInfo mTcInfo;
 };
@@ -23,6 +23,7 @@ AiDevice::AiDevice(const DaqDevice& daqDevice) : IoDevice(daqDevice), UlAiDevice
 	mCalModeEnabled = false;
 	mScanTempChanSupported = false;
 	mScanTempUnit = TU_CELSIUS;
+	mRawScanDataSupported = false;
 }
 
 AiDevice::~AiDevice()
@@ -39,11 +40,116 @@ double AiDevice::aIn(int channel, AiInputMode inputMode, Range range, AInFlag fl
 	throw UlException(ERR_BAD_DEV_TYPE);
 }
 
+void AiDevice::aInSnapshot(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[])
+{
+	check_AInSnapshot_Args(lowChan, highChan, inputMode, range, flags, data);
+
+	int chanCount = highChan - lowChan + 1;
+
+	// aInScan() reads the queue instead of the channel range when the queue is loaded
+	if(mAiInfo.hasPacer() && !queueEnabled() && chanCount >= SNAPSHOT_SCAN_MIN_CHAN_COUNT)
+		aInSnapshotScan(lowChan, highChan, inputMode, range, flags, data);
+	else
+	{
+		for(int i = 0; i < chanCount; i++)
+			data[i] = aIn(lowChan + i, inputMode, range, flags);
+	}
+}
+
+void AiDevice::aInSnapshotScan(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[])
+{
+	int chanCount = highChan - lowChan + 1;
+	double rate = std::min(mAiInfo.getMaxScanRate(), mAiInfo.getMaxThroughput() / chanCount);
+	AInScanFlag scanFlags = (AInScanFlag) (flags & (NOSCALEDATA | NOCALIBRATEDATA));
+
+	beginInternalScan();
+
+	UlError err = ERR_NO_ERROR;
+
+	try
+	{
+		rate = aInScan(lowChan, highChan, inputMode, range, 1, rate, SO_DEFAULTIO, scanFlags, data);
+
+		err = waitUntilDone(SNAPSHOT_TIMEOUT + 1.0 / rate);
+	}
+	catch(...)
+	{
+		endInternalScan();
+		throw;
+	}
+
+	if(err == ERR_NO_ERROR)
+	{
+		ScanStatus status;
+		TransferStatus xferStatus;
+
+		err = getStatus(&status, &xferStatus);
+
+		if(err == ERR_NO_ERROR && xferStatus.currentTotalCount < (unsigned long long) chanCount)
+			err = ERR_DEAD_DEV;
+	}
+
+	// a scan that completes before aInScan() marks it running is left running, stop it the way an application does
+	if(getScanState() == SS_RUNNING)
+		stopBackground();
+
+	endInternalScan();
+
+	if(err != ERR_NO_ERROR)
+		throw UlException(err);
+}
+
 double AiDevice::aInScan(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[])
 {
 	throw UlException(ERR_BAD_DEV_TYPE);
 }
 
+double AiDevice::aInScanRaw(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, void* data)
+{
+	if(!mRawScanDataSupported)
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	double actualRate;
+
+	mRawScanRequested = true;
+
+	try
+	{
+		actualRate = aInScan(lowChan, highChan, inputMode, range, samplesPerChan, rate, options, flags, (double*) data);
+	}
+	catch(...)
+	{
+		mRawScanRequested = false;
+		throw;
+	}
+
+	mRawScanRequested = false;
+
+	return actualRate;
+}
+
+void AiDevice::getScanCoefs(double slopes[], double offsets[], unsigned int* numChans) const
+{
+	if(numChans == NULL || slopes == NULL || offsets == NULL)
+		throw UlException(ERR_BAD_ARG);
+
+	unsigned int chanCount = mScanInfo.chanCount ? mScanDataConverter.chanCount() : 0;  // zero if a scan never ran
+
+	if(*numChans < chanCount)
+	{
+		*numChans = chanCount;
+		throw UlException(ERR_BAD_BUFFER_SIZE);
+	}
+
+	for(unsigned int i = 0; i < chanCount; i++)
+	{
+		slopes[i] = mScanDataConverter.slope(i);
+		offsets[i] = mScanDataConverter.offset(i);
+	}
+
+	*numChans = chanCount;
+}
+
 void AiDevice::aInLoadQueue(AiQueueElement queue[], unsigned int numElements)
 {
 	check_AInLoadQueue_Args(queue, numElements);
@@ -111,6 +217,33 @@ void AiDevice::check_AIn_Args(int channel, AiInputMode inputMode, Range range, A
 		throw UlException(ERR_INTERNAL);
 }
 
+void AiDevice::check_AInSnapshot_Args(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]) const
+{
+	if(!mAiInfo.isInputModeSupported(inputMode))
+		throw UlException(ERR_BAD_INPUT_MODE);
+
+	if(lowChan < 0 || highChan < 0 || lowChan >= mAiInfo.getNumChansByMode(inputMode) || highChan >= mAiInfo.getNumChansByMode(inputMode) || lowChan > highChan)
+		throw UlException(ERR_BAD_AI_CHAN);
+
+	if(!mAiInfo.isRangeSupported(inputMode, range))
+		throw UlException(ERR_BAD_RANGE);
+
+	if(~mAiInfo.getAInFlags() & flags)
+		throw UlException(ERR_BAD_FLAG);
+
+	if(data == NULL)
+		throw UlException(ERR_BAD_BUFFER);
+
+	if(getScanState() == SS_RUNNING)
+		throw UlException(ERR_ALREADY_ACTIVE);
+
+	if(!mDaqDevice.isConnected())
+		throw UlException(ERR_NO_CONNECTION_ESTABLISHED);
+
+	if((int) mCustomScales.size() < mAiInfo.getNumChans())
+		throw UlException(ERR_INTERNAL);
+}
+
 void AiDevice::check_AInScan_Args(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[]) const
 {
 	int numOfScanChan = 0;
@@ -149,6 +282,12 @@ void AiDevice::check_AInScan_Args(int lowChan, int highChan, AiInputMode inputMo
 	if(~mAiInfo.getAInScanFlags() & flags)
 		throw UlException(ERR_BAD_FLAG);
 
+	long long dataTypeFlags = flags & (FLOAT32DATA | UINT16DATA | UINT32DATA);
+
+	// only one buffer type can be selected and integer buffers hold calibrated counts, so scaling must be off
+	if(dataTypeFlags && ((dataTypeFlags & (dataTypeFlags - 1)) || mRawScanRequested || (!(flags & NOSCALEDATA) && !(flags & FLOAT32DATA))))
+		throw UlException(ERR_BAD_FLAG);
+
 	double throughput = rate * numOfScanChan;
 
 	if(!(options & SO_EXTCLOCK))
@@ -408,6 +547,8 @@ std::vector<CalCoef> AiDevice::getScanCalCoefs(int lowChan, int highChan, AiInpu
 
 	CalCoef calCoef;
 
+	calCoefs.reserve(queueEnabled() ? mAQueue.size() : highChan - lowChan + 1);
+
 	if (!queueEnabled())
 	{
 		for (chan = lowChan; chan <= highChan; chan++)
@@ -434,6 +575,8 @@ std::vector<CustomScale> AiDevice::getCustomScales(int lowChan, int highChan) co
 
 	int chan;
 
+	customScales.reserve(queueEnabled() ? mAQueue.size() : highChan - lowChan + 1);
+
 	if (!queueEnabled())
 	{
 		for (chan = lowChan; chan <= highChan; chan++)
@@ -457,6 +600,38 @@ int AiDevice::queueLength() const
 	return mAQueue.size();
 }
 
+std::vector<DaqInChanDescriptor> AiDevice::getScanChanDescriptors(int lowChan, int highChan, AiInputMode inputMode, Range range) const
+{
+	std::vector<DaqInChanDescriptor> chanDescriptors;
+	DaqInChanDescriptor chanDescriptor;
+	memset(&chanDescriptor, 0, sizeof(chanDescriptor));
+
+	if(queueEnabled())
+	{
+		for(unsigned int i = 0; i < mAQueue.size(); i++)
+		{
+			chanDescriptor.channel = mAQueue[i].channel;
+			chanDescriptor.type = (mAQueue[i].inputMode == AI_DIFFERENTIAL) ? DAQI_ANALOG_DIFF : DAQI_ANALOG_SE;
+			chanDescriptor.range = mAQueue[i].range;
+
+			chanDescriptors.push_back(chanDescriptor);
+		}
+	}
+	else
+	{
+		for(int chan = lowChan; chan <= highChan; chan++)
+		{
+			chanDescriptor.channel = chan;
+			chanDescriptor.type = (inputMode == AI_DIFFERENTIAL) ? DAQI_ANALOG_DIFF : DAQI_ANALOG_SE;
+			chanDescriptor.range = range;
+
+			chanDescriptors.push_back(chanDescriptor);
+		}
+	}
+
+	return chanDescriptors;
+}
+
 double AiDevice::convertTempUnit(double tempC, TempUnit unit)
 {
 	double temp = tempC;
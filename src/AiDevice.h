@@ -25,8 +25,12 @@ public:
 	virtual UlAiConfig& getAiConfig() { return *mAiConfig;}
 
 	virtual double aIn(int channel, AiInputMode inputMode, Range range, AInFlag flags);
+	virtual void aInSnapshot(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]);
 	virtual double aInScan(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[]);
+	virtual double aInScanRaw(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, void* data);
+	virtual void getScanCoefs(double slopes[], double offsets[], unsigned int* numChans) const;
 	virtual void aInLoadQueue(AiQueueElement queue[], unsigned int numElements);
+	std::vector<DaqInChanDescriptor> getScanChanDescriptors(int lowChan, int highChan, AiInputMode inputMode, Range range) const;
 	virtual void setTrigger(TriggerType type, int trigChan, double level, double variance, unsigned int retriggerCount);
 
 	virtual UlError getStatus(ScanStatus* status, TransferStatus* xferStatus);
@@ -105,6 +109,7 @@ protected:
 	int queueLength() const;
 
 	virtual void check_AIn_Args(int channel, AiInputMode inputMode, Range range, AInFlag flags) const;
+	virtual void check_AInSnapshot_Args(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]) const;
 	virtual void check_AInScan_Args(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[]) const;
 	virtual void check_AInLoadQueue_Args(const AiQueueElement queue[], unsigned int numElements) const;
 	virtual void check_AInSetTrigger_Args(TriggerType trigtype, int trigChan,  double level, double variance, unsigned int retriggerCount) const;
@@ -125,7 +130,14 @@ protected:
 
 	virtual void readCalDate() {};
 
+private:
+	void aInSnapshotScan(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]);
+
 protected:
+	// a one-scan acquisition costs a fixed number of transfers, snapshots of fewer channels are read with aIn().
+	// SNAPSHOT_TIMEOUT is in seconds
+	enum { SNAPSHOT_SCAN_MIN_CHAN_COUNT = 4, SNAPSHOT_TIMEOUT = 1 };
+
 	AiInfo mAiInfo;
 	AiConfig* mAiConfig;
 	std::vector<CalCoef> mCalCoefs;
@@ -139,6 +151,8 @@ protected:
 	unsigned long long mCalDate; // cal date in sec
 	unsigned long long mFieldCalDate; // cal date in sec
 
+	bool mRawScanDataSupported; // set by devices whose scan data is a linear function of the device-native samples
+
 private:
 	bool mCalModeEnabled;
 
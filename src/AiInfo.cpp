@@ -42,6 +42,11 @@ AiInfo::AiInfo()
 	mNumCjcChans = 0;
 
 	mSupportsIepe = false;
+
+	mInputModeMask = 0;
+
+	for(int mode = 0; mode < INPUT_MODE_COUNT; mode++)
+		mNumChansByMode[mode] = 0;
 }
 
 AiInfo::~AiInfo()
@@ -54,6 +59,9 @@ void AiInfo::setNumChans(int numChans)
 	if(mAiChanInfo.size())
 		mAiChanInfo.clear();
 
+	for(int mode = 0; mode < INPUT_MODE_COUNT; mode++)
+		mNumChansByMode[mode] = 0;
+
 	for(int ch = 0; ch < numChans; ch++)
 		mAiChanInfo.push_back(AiChanInfo(ch));
 }
@@ -66,20 +74,20 @@ int AiInfo::getNumChans() const
 void AiInfo::setNumChansByMode(AiInputMode mode, int numChans)
 {
 	for(int ch = 0; ch < numChans; ch++)
+	{
+		if(!mAiChanInfo[ch].isChanModeSupported(mode) && mode >= 0 && mode < INPUT_MODE_COUNT)
+			mNumChansByMode[mode]++;
+
 		mAiChanInfo[ch].addChanMode(mode);
+	}
 }
 
 int AiInfo::getNumChansByMode(AiInputMode mode) const
 {
 	int numChans = 0;
 
-	for(unsigned int ch = 0; ch < mAiChanInfo.size(); ch++)
-	{
-		std::vector<AiInputMode> inputModes = mAiChanInfo[ch].getChanModes();
-
-		if(std::find(inputModes.begin(), inputModes.end(), mode) != inputModes.end())
-			numChans++;
-	}
+	if(mode >= 0 && mode < INPUT_MODE_COUNT)
+		numChans = mNumChansByMode[mode];
 
 	return numChans;
 }
@@ -259,32 +267,26 @@ void AiInfo::addRange(AiInputMode mode, Range range)
 	{
 		mPseudoDiffRanges.push_back(range);
 	}
+
+	if(mode >= 0 && mode < INPUT_MODE_COUNT)
+		mRangeSets[mode].add(range);
 }
 
-std::vector<Range> AiInfo::getRanges(AiInputMode mode) const
+const std::vector<Range>& AiInfo::getRanges(AiInputMode mode) const
 {
-	std::vector<Range> modeRanges;
-
 	if(mode == AI_SINGLE_ENDED)
-		modeRanges = mSERanges;
+		return mSERanges;
 	else if (mode == AI_DIFFERENTIAL )
-		modeRanges = mDiffRanges;
+		return mDiffRanges;
 	else if (mode == AI_PSEUDO_DIFFERENTIAL)
-		modeRanges = mPseudoDiffRanges;
+		return mPseudoDiffRanges;
 
-	return modeRanges;
+	return mNoRanges;
 }
 
 void AiInfo::getRanges(AiInputMode mode, Range ranges[], int* count) const
 {
-	std::vector<Range> modeRanges;
-
-	if(mode == AI_SINGLE_ENDED)
-		modeRanges = mSERanges;
-	else if (mode == AI_DIFFERENTIAL )
-		modeRanges = mDiffRanges;
-	else if (mode == AI_PSEUDO_DIFFERENTIAL)
-		modeRanges = mPseudoDiffRanges;
+	const std::vector<Range>& modeRanges = getRanges(mode);
 
 	if(modeRanges.size() <= (unsigned int)*count )
 		std::copy(modeRanges.begin(), modeRanges.end(), ranges);
@@ -300,10 +302,11 @@ int AiInfo::getRangeCountByMode(AiInputMode mode) const
 Range AiInfo::getRangeByMode(AiInputMode mode, unsigned int index) const
 {
 	Range range = (Range) 0;
+	const std::vector<Range>& modeRanges = getRanges(mode);
 
-	if(index < getRanges(mode).size())
+	if(index < modeRanges.size())
 	{
-		range = getRanges(mode).at(index);
+		range = modeRanges[index];
 	}
 
 	return range;
@@ -312,6 +315,9 @@ Range AiInfo::getRangeByMode(AiInputMode mode, unsigned int index) const
 void AiInfo::addInputMode(AiInputMode mode)
 {
 	mInputModes.push_back(mode);
+
+	if(mode >= 0 && mode < 32)
+		mInputModeMask |= 1U << mode;
 }
 
 
@@ -462,29 +468,15 @@ int AiInfo::getSampleSize() const
 
 bool AiInfo::isInputModeSupported(AiInputMode inputMode) const
 {
-	bool supported = false;
-
-	std::vector<AiInputMode>::const_iterator itr = std::find(mInputModes.begin(), mInputModes.end(), inputMode);
-
-	if(itr != mInputModes.end())
-		supported = true;
-
-	return supported;
+	return inputMode >= 0 && inputMode < 32 && (mInputModeMask & (1U << inputMode));
 }
 
 bool AiInfo::isRangeSupported(AiInputMode inputMode, Range range) const
 {
 	bool supported = false;
 
-	std::vector<Range> ranges = getRanges(inputMode);
-
-	if(!ranges.empty())
-	{
-		std::vector<Range>::const_iterator itr = std::find(ranges.begin(), ranges.end(), range);
-
-		if(itr != ranges.end())
-			supported = true;
-	}
+	if(inputMode >= 0 && inputMode < INPUT_MODE_COUNT)
+		supported = mRangeSets[inputMode].contains(range);
 
 	return supported;
 }
@@ -11,6 +11,7 @@
 #include "AiChanInfo.h"
 #include <vector>
 #include "interfaces/UlAiInfo.h"
+#include "utility/RangeSet.h"
 
 namespace ul
 {
@@ -22,7 +23,7 @@ public:
 	virtual ~AiInfo();
 
 	void addRange(AiInputMode mode, Range range);
-	std::vector<Range> getRanges(AiInputMode mode) const;
+	const std::vector<Range>& getRanges(AiInputMode mode) const;
 
 	void setNumChans(int numChans);
 	int getNumChans() const;
@@ -108,6 +109,13 @@ private:
 	std::vector<Range> mDiffRanges;
 	std::vector<Range> mPseudoDiffRanges;
 	std::vector<AiInputMode> mInputModes;
+
+	// the capabilities checked by every call, kept in a form that is tested without a search or a copy
+	static const int INPUT_MODE_COUNT = AI_PSEUDO_DIFFERENTIAL + 1;
+	unsigned int mInputModeMask;
+	int mNumChansByMode[INPUT_MODE_COUNT];
+	RangeSet mRangeSets[INPUT_MODE_COUNT];
+	std::vector<Range> mNoRanges;
 	AiChanType mTypes;
 	TriggerType mTriggerTypes;
 	AiQueueType mQueueTypes;
@@ -138,9 +138,10 @@ long long AoInfo::getAOutScanFlags() const
 void AoInfo::addRange(Range range)
 {
 	mRanges.push_back(range);
+	mRangeSet.add(range);
 }
 
-std::vector<Range> AoInfo::getRanges() const
+const std::vector<Range>& AoInfo::getRanges() const
 {
 	return mRanges;
 }
@@ -156,16 +157,16 @@ void AoInfo::getRanges(Range ranges[], int* count) const
 
 int AoInfo::getRangeCount() const
 {
-	return getRanges().size();
+	return mRanges.size();
 }
 
 Range AoInfo::getRange(unsigned int index) const
 {
 	Range range = (Range) 0;
 
-	if(index < getRanges().size())
+	if(index < mRanges.size())
 	{
-		range = getRanges().at(index);
+		range = mRanges[index];
 	}
 
 	return range;
@@ -243,18 +244,6 @@ int AoInfo::getSampleSize() const
 
 bool AoInfo::isRangeSupported(Range range) const
 {
-	bool supported = false;
-
-	std::vector<Range> ranges = getRanges();
-
-	if(!ranges.empty())
-	{
-		std::vector<Range>::const_iterator itr = std::find(ranges.begin(), ranges.end(), range);
-
-		if(itr != ranges.end())
-			supported = true;
-	}
-
-	return supported;
+	return mRangeSet.contains(range);
 }
 } /* namespace ul */
@@ -10,6 +10,7 @@
 #include "ul_internal.h"
 #include <vector>
 #include "interfaces/UlAoInfo.h"
+#include "utility/RangeSet.h"
 
 namespace ul
 {
@@ -21,7 +22,7 @@ public:
 	virtual ~AoInfo();
 
 	void addRange(Range range);
-	std::vector<Range> getRanges() const;
+	const std::vector<Range>& getRanges() const;
 
 	void setNumChans(int numChans);
 	int getNumChans() const;
@@ -72,6 +73,7 @@ public:
 
 private:
 	std::vector<Range> mRanges;
+	RangeSet mRangeSet;
 	TriggerType mTriggerTypes;
 	int mNumChans;
 	int mResolution;
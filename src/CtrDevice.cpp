@@ -7,6 +7,7 @@
 #include "CtrDevice.h"
 #include <algorithm>
 #include <bitset>
+#include <string.h>
 
 #include "UlException.h"
 
@@ -52,6 +53,30 @@ double CtrDevice::cInScan(int lowCtrNum, int highCtrNum, int samplesPerCounter,
 	throw UlException(ERR_BAD_DEV_TYPE);
 }
 
+std::vector<DaqInChanDescriptor> CtrDevice::getScanChanDescriptors(int lowCtrNum, int highCtrNum, CInScanFlag flags) const
+{
+	std::vector<DaqInChanDescriptor> chanDescriptors;
+	DaqInChanDescriptor chanDescriptor;
+	memset(&chanDescriptor, 0, sizeof(chanDescriptor));
+
+	DaqInChanType chanType = DAQI_CTR32;
+
+	if(flags & CINSCAN_FF_CTR16_BIT)
+		chanType = DAQI_CTR16;
+	else if(flags & (CINSCAN_FF_CTR48_BIT | CINSCAN_FF_CTR64_BIT))
+		chanType = DAQI_CTR48;
+
+	for(int ctrNum = lowCtrNum; ctrNum <= highCtrNum; ctrNum++)
+	{
+		chanDescriptor.channel = ctrNum;
+		chanDescriptor.type = chanType;
+
+		chanDescriptors.push_back(chanDescriptor);
+	}
+
+	return chanDescriptors;
+}
+
 void CtrDevice::cConfigScan(int ctrNum, CounterMeasurementType measureType,  CounterMeasurementMode measureMode,
 							CounterEdgeDetection edgeDetection, CounterTickSize tickSize,
 							CounterDebounceMode debounceMode, CounterDebounceTime debounceTime, CConfigScanFlag flag)
@@ -276,20 +301,14 @@ void CtrDevice::check_CConfigScan_Args(int ctrNum, CounterMeasurementType measur
 		if (debounceTime == CDT_DEBOUNCE_0ns)
 			throw UlException(ERR_BAD_DEBOUNCE_TIME);
 
-		std::vector<CounterDebounceTime> debounceTimes = mCtrInfo.getDebounceTimes();
-
-		if(std::find(debounceTimes.begin(), debounceTimes.end(), debounceTime) == debounceTimes.end())
+		if(!mCtrInfo.isDebounceTimeSupported(debounceTime))
 			throw UlException(ERR_BAD_DEBOUNCE_TIME);
 	}
 
 	if(measureType == CMT_PERIOD || measureType == CMT_PULSE_WIDTH || measureType == CMT_TIMING)
 	{
-		std::vector<CounterTickSize> tickSizes = mCtrInfo.getTickSizes();
-
-		if(std::find(tickSizes.begin(), tickSizes.end(), tickSize) == tickSizes.end())
-		{
+		if(!mCtrInfo.isTickSizeSupported(tickSize))
 			throw UlException(ERR_BAD_TICK_SIZE);
-		}
 	}
 
 	if(!mDaqDevice.isConnected())
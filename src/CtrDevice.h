@@ -29,6 +29,7 @@ public:
 	virtual void cClear(int ctrNum);
 	virtual unsigned long long cRead(int ctrNum, CounterRegisterType regType);
 	virtual double cInScan(int lowCtrNum, int highCtrNum, int samplesPerCounter, double rate, ScanOption options, CInScanFlag flags, unsigned long long data[]);
+	std::vector<DaqInChanDescriptor> getScanChanDescriptors(int lowCtrNum, int highCtrNum, CInScanFlag flags) const;
 
 	virtual void cConfigScan(int ctrNum, CounterMeasurementType measureType,  CounterMeasurementMode measureMode,
 								CounterEdgeDetection edgeDetection, CounterTickSize tickSize,
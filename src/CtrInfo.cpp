@@ -25,6 +25,8 @@ CtrInfo::CtrInfo()
 	mHasPacer = 0;
 	mTriggerTypes = TRIG_NONE;
 	mCtrRegTypes = CRT_COUNT;
+	mCtrDebounceTimeMask = 0;
+	mCtrTickSizeMask = 0;
 }
 
 CtrInfo::~CtrInfo()
@@ -61,10 +63,10 @@ CounterMeasurementMode CtrInfo::getCtrMeasurementModes(CounterMeasurementType ty
 {
 	CounterMeasurementMode mode = (CounterMeasurementMode) 0;
 
-	std::map<CounterMeasurementType,CounterMeasurementMode>::iterator itr = mCtrMeasureModes.find(type);
+	std::map<CounterMeasurementType,CounterMeasurementMode>::const_iterator itr = mCtrMeasureModes.find(type);
 
 	if(itr != mCtrMeasureModes.end())
-		mode = mCtrMeasureModes[type];
+		mode = itr->second;
 
 	return mode;
 }
@@ -199,6 +201,9 @@ CounterRegisterType CtrInfo::getRegisterTypes() const
 void CtrInfo::addDebounceTime(CounterDebounceTime debounceTime)
 {
 	mCtrDebounceTimes.push_back(debounceTime);
+
+	if(debounceTime >= 0 && debounceTime < 64)
+		mCtrDebounceTimeMask |= 1ULL << debounceTime;
 }
 
 
@@ -210,6 +215,9 @@ std::vector<CounterDebounceTime> CtrInfo::getDebounceTimes() const
 void CtrInfo::addTickSize(CounterTickSize tickSize)
 {
 	mCtrTickSizes.push_back(tickSize);
+
+	if(tickSize >= 0 && tickSize < 64)
+		mCtrTickSizeMask |= 1ULL << tickSize;
 }
 
 
@@ -218,6 +226,16 @@ std::vector<CounterTickSize> CtrInfo::getTickSizes() const
 	return mCtrTickSizes;
 }
 
+bool CtrInfo::isDebounceTimeSupported(CounterDebounceTime debounceTime) const
+{
+	return debounceTime >= 0 && debounceTime < 64 && (mCtrDebounceTimeMask & (1ULL << debounceTime));
+}
+
+bool CtrInfo::isTickSizeSupported(CounterTickSize tickSize) const
+{
+	return tickSize >= 0 && tickSize < 64 && (mCtrTickSizeMask & (1ULL << tickSize));
+}
+
 
 bool CtrInfo::hasPacer() const
 {
@@ -53,6 +53,8 @@ public:
 
 	void addTickSize(CounterTickSize tickSize);
 	std::vector<CounterTickSize> getTickSizes() const;
+	bool isDebounceTimeSupported(CounterDebounceTime debounceTime) const;
+	bool isTickSizeSupported(CounterTickSize tickSize) const;
 
 	bool hasPacer() const;
 	void hasPacer(bool hasPacer);
@@ -68,6 +70,8 @@ private:
 	TriggerType mTriggerTypes;
 	std::vector<CounterDebounceTime> mCtrDebounceTimes;
 	std::vector<CounterTickSize> mCtrTickSizes;
+	unsigned long long mCtrDebounceTimeMask;
+	unsigned long long mCtrTickSizeMask;
 	int mNumCtrs;
 	int mResolution;
 	double mMinScanRate;
@@ -4,11 +4,15 @@
  *     Author: Measurement Computing Corporation
  */
 #include <sstream>
+#include <limits.h>
 
 #include "DaqDevice.h"
 #include "DaqDeviceManager.h"
 #include "utility/EuScale.h"
 #include "utility/UlLock.h"
+#include "utility/WorkerPool.h"
+#include "utility/ConfigShadow.h"
+#include "ScanRecorder.h"
 
 
 #include "AiDevice.h"
@@ -30,6 +34,8 @@ DaqDevice::DaqDevice(const DaqDeviceDescriptor& daqDeviceDescriptor): mDaqDevice
 		mAiDevice(NULL), mAoDevice(NULL), mDioDevice(NULL), mCtrDevice(NULL), mTmrDevice(NULL), mDaqIDevice(NULL), mDaqODevice(NULL)
 {
 	mEventHandler = new DaqEventHandler(*this);
+	mScanConversionPool = new WorkerPool();
+	mConfigShadow = new ConfigShadow();
 	mDaqDeviceConfig = new DaqDeviceConfig(*this);
 	mDaqDeviceInfo.setProductId(daqDeviceDescriptor.productId);
 
@@ -48,16 +54,32 @@ DaqDevice::DaqDevice(const DaqDeviceDescriptor& daqDeviceDescriptor): mDaqDevice
 
 	mHasExp = false;
 
+	mHwInitProgress = 100;
+
+	for(int i = 0; i < SCAN_RECORDER_COUNT; i++)
+		mScanRecorders[i] = NULL;
+
 	pthread_mutex_lock(&mDeviceNumberMutex);
 	mDeviceNumber = mNextAvailableDeviceNumber;
 	mNextAvailableDeviceNumber++;
 	pthread_mutex_unlock(&mDeviceNumberMutex);
 
 	UlLock::initMutex(mDeviceMutex, PTHREAD_MUTEX_RECURSIVE);
+	UlLock::initMutex(mScanRecorderMutex, PTHREAD_MUTEX_RECURSIVE);
 }
 
 DaqDevice::~DaqDevice()
 {
+	// the recorder threads read the scan buffers of the I/O devices
+	for(int i = 0; i < SCAN_RECORDER_COUNT; i++)
+	{
+		if(mScanRecorders[i] != NULL)
+		{
+			delete mScanRecorders[i];
+			mScanRecorders[i] = NULL;
+		}
+	}
+
 	if(mAiDevice != NULL)
 	{
 		delete mAiDevice;
@@ -112,9 +134,22 @@ DaqDevice::~DaqDevice()
 		mEventHandler = NULL;
 	}
 
+	if(mScanConversionPool != NULL)
+	{
+		delete mScanConversionPool;
+		mScanConversionPool = NULL;
+	}
+
+	if(mConfigShadow != NULL)
+	{
+		delete mConfigShadow;
+		mConfigShadow = NULL;
+	}
+
 	DaqDeviceManager::removeFromCreatedList(mDeviceNumber);
 
 	UlLock::destroyMutex(mDeviceMutex);
+	UlLock::destroyMutex(mScanRecorderMutex);
 }
 
 DaqDeviceDescriptor DaqDevice::getDescriptor() const
@@ -662,6 +697,288 @@ void DaqDevice::setCfg_Reset()
 	throw UlException(ERR_BAD_DEV_TYPE);
 }
 
+long long DaqDevice::getCfg_ScanXferCount(ScanDirection direction) const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::getScanStats(ScanDirection direction, ScanStats* stats) const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_ScanXferCount(ScanDirection direction, long long count)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_ScanStageSize(ScanDirection direction) const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_ScanStageSize(ScanDirection direction, long long size)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_ScanStageLatency(ScanDirection direction) const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_ScanStageLatency(ScanDirection direction, long long latency)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_ScanPipeline() const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_ScanPipeline(long long pipeline)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_UsbXferPriority() const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_UsbXferPriority(long long niceValue)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_UsbXferRtPriority() const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_UsbXferRtPriority(long long priority)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_UsbXferCpu() const
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+void DaqDevice::setCfg_UsbXferCpu(long long cpu)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+long long DaqDevice::getCfg_ScanConversionThreads() const
+{
+	return mScanConversionPool->getThreadCount();
+}
+
+void DaqDevice::setCfg_ScanConversionThreads(long long threadCount)
+{
+	if(threadCount < 0 || threadCount > WorkerPool::MAX_THREAD_COUNT)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	if(isScanRunning())
+		throw UlException(ERR_ALREADY_ACTIVE);
+
+	mScanConversionPool->setThreadCount(threadCount);
+}
+
+long long DaqDevice::getCfg_EventDelivery() const
+{
+	if(!mDaqDeviceInfo.getEventTypes())
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	return mEventHandler->getEventDelivery();
+}
+
+void DaqDevice::setCfg_EventDelivery(long long delivery)
+{
+	if(!mDaqDeviceInfo.getEventTypes())
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	mEventHandler->setEventDelivery((DaqEventDelivery) delivery);
+}
+
+long long DaqDevice::getCfg_EventThreadCpu() const
+{
+	if(!mDaqDeviceInfo.getEventTypes())
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	return mEventHandler->getEventThreadCpu();
+}
+
+void DaqDevice::setCfg_EventThreadCpu(long long cpu)
+{
+	if(!mDaqDeviceInfo.getEventTypes())
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	if(cpu < -1 || cpu > INT_MAX)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mEventHandler->setEventThreadCpu((int) cpu);
+}
+
+long long DaqDevice::getCfg_EventStat(unsigned int index) const
+{
+	if(!mDaqDeviceInfo.getEventTypes())
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	return mEventHandler->getEventStat((DaqEventStat) index);
+}
+
+void DaqDevice::setCfg_ResetEventStats()
+{
+	if(!mDaqDeviceInfo.getEventTypes())
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	mEventHandler->resetEventStats();
+}
+
+long long DaqDevice::getCfg_HwInitProgress() const
+{
+	return __atomic_load_n(&mHwInitProgress, __ATOMIC_RELAXED);
+}
+
+int DaqDevice::scanRecorderIndex(FunctionType functionType)
+{
+	int index = -1;
+
+	switch(functionType)
+	{
+	case FT_AI:
+		index = SRS_AI - 1;
+		break;
+	case FT_DAQI:
+		index = SRS_DAQI - 1;
+		break;
+	case FT_DI:
+		index = SRS_DIN - 1;
+		break;
+	case FT_CTR:
+		index = SRS_CIN - 1;
+		break;
+
+	default:
+		break;
+	}
+
+	return index;
+}
+
+void DaqDevice::enableScanRecorder(ScanRecorderSource source, const char* pathPrefix, int segmentCount, long long segmentSize)
+{
+	if(source < SRS_AI || source > SRS_CIN || pathPrefix == NULL || pathPrefix[0] == '\0' || segmentCount < 1 || segmentSize < 1)
+		throw UlException(ERR_BAD_ARG);
+
+	if((source == SRS_AI && mAiDevice == NULL) || (source == SRS_DAQI && mDaqIDevice == NULL) ||
+	   (source == SRS_DIN && mDioDevice == NULL) || (source == SRS_CIN && mCtrDevice == NULL))
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	UlLock lock(mScanRecorderMutex);
+
+	int index = source - 1;
+
+	if(mScanRecorders[index] != NULL)
+	{
+		if(mScanRecorders[index]->isRecording())
+			throw UlException(ERR_ALREADY_ACTIVE);
+
+		delete mScanRecorders[index];
+	}
+
+	mScanRecorders[index] = new ScanRecorder(pathPrefix, segmentCount, segmentSize);
+}
+
+void DaqDevice::disableScanRecorder(ScanRecorderSource source)
+{
+	if(source < SRS_AI || source > SRS_CIN)
+		throw UlException(ERR_BAD_ARG);
+
+	UlLock lock(mScanRecorderMutex);
+
+	int index = source - 1;
+
+	if(mScanRecorders[index] != NULL)
+	{
+		if(mScanRecorders[index]->isRecording())
+			throw UlException(ERR_ALREADY_ACTIVE);
+
+		delete mScanRecorders[index];
+		mScanRecorders[index] = NULL;
+	}
+}
+
+void DaqDevice::getScanRecorderStatus(ScanRecorderSource source, ScanRecorderStatus* status) const
+{
+	if(source < SRS_AI || source > SRS_CIN || status == NULL)
+		throw UlException(ERR_BAD_ARG);
+
+	UlLock lock(mScanRecorderMutex);
+
+	int index = source - 1;
+
+	if(mScanRecorders[index] == NULL)
+		throw UlException(ERR_BAD_ARG);
+
+	mScanRecorders[index]->getStatus(status);
+}
+
+bool DaqDevice::scanRecorderEnabled(FunctionType functionType) const
+{
+	int index = scanRecorderIndex(functionType);
+
+	UlLock lock(mScanRecorderMutex);
+
+	return index != -1 && mScanRecorders[index] != NULL;
+}
+
+void DaqDevice::setScanRecorderChannels(FunctionType functionType, const std::vector<DaqInChanDescriptor>& chanDescriptors) const
+{
+	int index = scanRecorderIndex(functionType);
+
+	UlLock lock(mScanRecorderMutex);
+
+	if(index != -1 && mScanRecorders[index] != NULL && !mScanRecorders[index]->isRecording())
+		mScanRecorders[index]->setChanDescriptors(chanDescriptors);
+}
+
+void DaqDevice::startScanRecorder(FunctionType functionType, IoDevice* ioDevice) const
+{
+	int index = scanRecorderIndex(functionType);
+
+	UlLock lock(mScanRecorderMutex);
+
+	if(index != -1 && mScanRecorders[index] != NULL)
+		mScanRecorders[index]->start(ioDevice);
+}
+
+void DaqDevice::scanRecorderDone(const IoDevice* ioDevice) const
+{
+	UlLock lock(mScanRecorderMutex);
+
+	for(int i = 0; i < SCAN_RECORDER_COUNT; i++)
+	{
+		if(mScanRecorders[i] != NULL)
+			mScanRecorders[i]->requestStop(ioDevice);
+	}
+}
+
+void DaqDevice::waitForScanRecorder(const IoDevice* ioDevice) const
+{
+	UlLock lock(mScanRecorderMutex);
+
+	for(int i = 0; i < SCAN_RECORDER_COUNT; i++)
+	{
+		if(mScanRecorders[i] != NULL && mScanRecorders[i]->ioDevice() == ioDevice)
+			mScanRecorders[i]->stop();
+	}
+}
+
 void DaqDevice::getCfg_IpAddress(char* address, unsigned int* maxStrLen) const
 {
 	throw UlException(ERR_BAD_DEV_TYPE);
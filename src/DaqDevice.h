@@ -7,6 +7,8 @@
 #ifndef DAQDEVICE_H_
 #define DAQDEVICE_H_
 
+#include <vector>
+
 #include "DaqDeviceId.h"
 #include "DaqDeviceInfo.h"
 #include "DaqDeviceConfig.h"
@@ -26,6 +28,9 @@ class TmrDevice;
 class DaqIDevice;
 class DaqODevice;
 class DaqEventHandler;
+class WorkerPool;
+class ConfigShadow;
+class ScanRecorder;
 
 class UL_LOCAL DaqDevice: public UlDaqDevice
 {
@@ -65,6 +70,8 @@ public:
 	void setDaqODevice(DaqODevice* daqODevice);
 
 	DaqEventHandler* eventHandler() const;
+	WorkerPool* scanConversionPool() const { return mScanConversionPool; }
+	ConfigShadow& configShadow() const { return *mConfigShadow; }
 
 	bool isConnected() const { return mConnected;}
 
@@ -132,8 +139,49 @@ public:
 	virtual void setCfg_MemUnlockCode(long long code);
 	virtual void setCfg_Reset();
 
+	virtual long long getCfg_ScanXferCount(ScanDirection direction) const;
+	virtual void setCfg_ScanXferCount(ScanDirection direction, long long count);
+	virtual long long getCfg_ScanStageSize(ScanDirection direction) const;
+	virtual void setCfg_ScanStageSize(ScanDirection direction, long long size);
+	virtual long long getCfg_ScanStageLatency(ScanDirection direction) const;
+	virtual void setCfg_ScanStageLatency(ScanDirection direction, long long latency);
+	virtual long long getCfg_ScanPipeline() const;
+	virtual void setCfg_ScanPipeline(long long pipeline);
+
+	virtual void getScanStats(ScanDirection direction, ScanStats* stats) const;
+
+	virtual long long getCfg_UsbXferPriority() const;
+	virtual void setCfg_UsbXferPriority(long long niceValue);
+	virtual long long getCfg_UsbXferRtPriority() const;
+	virtual void setCfg_UsbXferRtPriority(long long priority);
+	virtual long long getCfg_UsbXferCpu() const;
+	virtual void setCfg_UsbXferCpu(long long cpu);
+
+	long long getCfg_ScanConversionThreads() const;
+	long long getCfg_HwInitProgress() const;
+	void setCfg_ScanConversionThreads(long long threadCount);
+
+	long long getCfg_EventDelivery() const;
+	void setCfg_EventDelivery(long long delivery);
+	long long getCfg_EventThreadCpu() const;
+	void setCfg_EventThreadCpu(long long cpu);
+	long long getCfg_EventStat(unsigned int index) const;
+	void setCfg_ResetEventStats();
+
+	void enableScanRecorder(ScanRecorderSource source, const char* pathPrefix, int segmentCount, long long segmentSize);
+	void disableScanRecorder(ScanRecorderSource source);
+	void getScanRecorderStatus(ScanRecorderSource source, ScanRecorderStatus* status) const;
+
+	// recorders are configured per input scan type, the IoDevice that runs a scan of that type drives them
+	bool scanRecorderEnabled(FunctionType functionType) const;
+	void setScanRecorderChannels(FunctionType functionType, const std::vector<DaqInChanDescriptor>& chanDescriptors) const;
+	void startScanRecorder(FunctionType functionType, IoDevice* ioDevice) const;
+	void scanRecorderDone(const IoDevice* ioDevice) const;
+	void waitForScanRecorder(const IoDevice* ioDevice) const;
+
 protected:
 	void setMinRawFwVersion(unsigned short ver) { mMinRawFwVersion = ver;}
+	void setHwInitProgress(int percent) const { __atomic_store_n(&mHwInitProgress, percent, __ATOMIC_RELAXED);}
 	void check_MemRW_Args(MemRegion memRegionType, MemAccessType accessType, unsigned int address, unsigned char* buffer, unsigned int count, bool checkAccess = true) const;
 
 protected:
@@ -150,6 +198,8 @@ protected:
 	DaqIDevice* mDaqIDevice;
 	DaqODevice* mDaqODevice;
 	DaqEventHandler* mEventHandler;
+	WorkerPool* mScanConversionPool;
+	ConfigShadow* mConfigShadow;
 
 	unsigned short mMinRawFwVersion;
 
@@ -163,6 +213,11 @@ protected:
 
 	mutable bool mHasExp;
 
+	mutable int mHwInitProgress;
+
+private:
+	static int scanRecorderIndex(FunctionType functionType);
+
 private:
 	static unsigned long long mNextAvailableDeviceNumber;
 	static pthread_mutex_t mDeviceNumberMutex;
@@ -170,6 +225,10 @@ private:
 	long long mDeviceNumber;
 	int mMemUnlockAddr;
 	unsigned int mMemUnlockCode;
+
+	enum {SCAN_RECORDER_COUNT = 4};
+	ScanRecorder* mScanRecorders[SCAN_RECORDER_COUNT];
+	mutable pthread_mutex_t mScanRecorderMutex;
 };
 
 } /* namespace ul */
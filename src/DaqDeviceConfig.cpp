@@ -6,6 +6,7 @@
 
 #include "DaqDevice.h"
 #include "DaqDeviceConfig.h"
+#include "UlException.h"
 
 namespace ul
 {
@@ -45,6 +46,129 @@ void DaqDeviceConfig::reset()
 	mDaqDevice.setCfg_Reset();
 }
 
+void DaqDeviceConfig::setScanXferCount(unsigned int index, long long count)
+{
+	mDaqDevice.setCfg_ScanXferCount(scanDirection(index), count);
+}
+
+long long DaqDeviceConfig::getScanXferCount(unsigned int index)
+{
+	return mDaqDevice.getCfg_ScanXferCount(scanDirection(index));
+}
+
+void DaqDeviceConfig::setScanStageSize(unsigned int index, long long size)
+{
+	mDaqDevice.setCfg_ScanStageSize(scanDirection(index), size);
+}
+
+long long DaqDeviceConfig::getScanStageSize(unsigned int index)
+{
+	return mDaqDevice.getCfg_ScanStageSize(scanDirection(index));
+}
+
+void DaqDeviceConfig::setScanStageLatency(unsigned int index, long long latency)
+{
+	mDaqDevice.setCfg_ScanStageLatency(scanDirection(index), latency);
+}
+
+long long DaqDeviceConfig::getScanStageLatency(unsigned int index)
+{
+	return mDaqDevice.getCfg_ScanStageLatency(scanDirection(index));
+}
+
+void DaqDeviceConfig::setScanPipeline(long long pipeline)
+{
+	mDaqDevice.setCfg_ScanPipeline(pipeline);
+}
+
+long long DaqDeviceConfig::getScanPipeline()
+{
+	return mDaqDevice.getCfg_ScanPipeline();
+}
+
+void DaqDeviceConfig::setScanConversionThreads(long long threadCount)
+{
+	mDaqDevice.setCfg_ScanConversionThreads(threadCount);
+}
+
+long long DaqDeviceConfig::getScanConversionThreads()
+{
+	return mDaqDevice.getCfg_ScanConversionThreads();
+}
+
+long long DaqDeviceConfig::getHwInitProgress()
+{
+	return mDaqDevice.getCfg_HwInitProgress();
+}
+
+void DaqDeviceConfig::setEventDelivery(long long delivery)
+{
+	mDaqDevice.setCfg_EventDelivery(delivery);
+}
+
+long long DaqDeviceConfig::getEventDelivery()
+{
+	return mDaqDevice.getCfg_EventDelivery();
+}
+
+void DaqDeviceConfig::setEventThreadCpu(long long cpu)
+{
+	mDaqDevice.setCfg_EventThreadCpu(cpu);
+}
+
+long long DaqDeviceConfig::getEventThreadCpu()
+{
+	return mDaqDevice.getCfg_EventThreadCpu();
+}
+
+void DaqDeviceConfig::resetEventStats()
+{
+	mDaqDevice.setCfg_ResetEventStats();
+}
+
+long long DaqDeviceConfig::getEventStat(unsigned int index)
+{
+	return mDaqDevice.getCfg_EventStat(index);
+}
+
+void DaqDeviceConfig::setUsbXferPriority(long long niceValue)
+{
+	mDaqDevice.setCfg_UsbXferPriority(niceValue);
+}
+
+long long DaqDeviceConfig::getUsbXferPriority()
+{
+	return mDaqDevice.getCfg_UsbXferPriority();
+}
+
+void DaqDeviceConfig::setUsbXferRtPriority(long long priority)
+{
+	mDaqDevice.setCfg_UsbXferRtPriority(priority);
+}
+
+long long DaqDeviceConfig::getUsbXferRtPriority()
+{
+	return mDaqDevice.getCfg_UsbXferRtPriority();
+}
+
+void DaqDeviceConfig::setUsbXferCpu(long long cpu)
+{
+	mDaqDevice.setCfg_UsbXferCpu(cpu);
+}
+
+long long DaqDeviceConfig::getUsbXferCpu()
+{
+	return mDaqDevice.getCfg_UsbXferCpu();
+}
+
+ScanDirection DaqDeviceConfig::scanDirection(unsigned int index)
+{
+	if(index > 1)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	return index == 0 ? SD_INPUT : SD_OUTPUT;
+}
+
 
 void DaqDeviceConfig::getVersionStr(DevVersionType verType, char* verStr, unsigned int* maxStrLen)
 {
@@ -25,11 +25,40 @@ public:
 	virtual long long getMemUnlockCode();
 	virtual void reset();
 
+	virtual void setScanXferCount(unsigned int index, long long count);
+	virtual long long getScanXferCount(unsigned int index);
+	virtual void setScanStageSize(unsigned int index, long long size);
+	virtual long long getScanStageSize(unsigned int index);
+	virtual void setScanStageLatency(unsigned int index, long long latency);
+	virtual long long getScanStageLatency(unsigned int index);
+	virtual void setScanPipeline(long long pipeline);
+	virtual long long getScanPipeline();
+	virtual void setScanConversionThreads(long long threadCount);
+	virtual long long getScanConversionThreads();
+	virtual long long getHwInitProgress();
+
+	virtual void setEventDelivery(long long delivery);
+	virtual long long getEventDelivery();
+	virtual void setEventThreadCpu(long long cpu);
+	virtual long long getEventThreadCpu();
+	virtual void resetEventStats();
+	virtual long long getEventStat(unsigned int index);
+
+	virtual void setUsbXferPriority(long long niceValue);
+	virtual long long getUsbXferPriority();
+	virtual void setUsbXferRtPriority(long long priority);
+	virtual long long getUsbXferRtPriority();
+	virtual void setUsbXferCpu(long long cpu);
+	virtual long long getUsbXferCpu();
+
 	virtual void getVersionStr(DevVersionType verType, char* verStr, unsigned int* maxStrLen);
 	virtual bool hasExp();
 	virtual void getIpAddressStr(char* address, unsigned int* maxStrLen);
 	virtual void getNetIfcNameStr(char* ifcName, unsigned int* maxStrLen);
 
+private:
+	static ScanDirection scanDirection(unsigned int index);
+
 private:
 	DaqDevice& mDaqDevice;
 };
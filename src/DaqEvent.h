@@ -14,6 +14,8 @@ struct DaqEvent
 	DaqEventCallback callbackFunction;
 	void* userData;
 	unsigned long long eventData;
+	unsigned int seqNum;
+	unsigned long long timestamp;
 	bool eventOccured;
 
 	DaqEvent()
@@ -23,6 +25,8 @@ struct DaqEvent
 		callbackFunction = NULL;
 		userData = NULL;
 		eventData = 0;
+		seqNum = 0;
+		timestamp = 0;
 		eventOccured = false;
 	}
 };
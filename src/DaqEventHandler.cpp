@@ -6,6 +6,8 @@
 
 #include "DaqEventHandler.h"
 #include <sys/resource.h>
+#include <sched.h>
+#include <limits.h>
 
 #include "./utility/UlLock.h"
 
@@ -15,12 +17,24 @@ DaqEventHandler::DaqEventHandler(const DaqDevice& daqDevice) : mDaqDevice(daqDev
 {
 	mEnabledEventsTypes = (DaqEventType) 0;
 	UlLock::initMutex(mEventHandlerMutex, PTHREAD_MUTEX_RECURSIVE);
-	UlLock::initMutex(mEventMutex, PTHREAD_MUTEX_RECURSIVE);
 
 	mEventThreadHandle = 0;
 	mTerminateEventThread = false;
-	mDaqEventOccured = false;
-	mLastEventIndex = 0;
+	mEventThreadWaiting = false;
+
+	mEventSeqNum = 0;
+	memset(mResetSeqNum, 0, sizeof(mResetSeqNum));
+
+	UlLock::initMutex(mParkedEventMutex, PTHREAD_MUTEX_NORMAL);
+	mParkedEventCount = 0;
+
+	mEventDelivery = DED_EVENT_THREAD;
+	mEventThreadCpu = -1;
+
+	mLastDeliveredSeqNum = 0;
+	mDroppedEventCount = 0;
+	mLastLatency = 0;
+	mMaxLatency = 0;
 }
 
 DaqEventHandler::~DaqEventHandler()
@@ -28,8 +42,8 @@ DaqEventHandler::~DaqEventHandler()
 	if(mDaqDevice.getDevInfo().getEventTypes())
 		disableEvent(mDaqDevice.getDevInfo().getEventTypes());
 
-	UlLock::destroyMutex(mEventMutex);
 	UlLock::destroyMutex(mEventHandlerMutex);
+	UlLock::destroyMutex(mParkedEventMutex);
 }
 
 void DaqEventHandler::start()
@@ -86,7 +100,6 @@ void DaqEventHandler::addEnabledEvents(DaqEventType eventTypes, unsigned long lo
 			eventIndex = getEventIndex(eventType);
 
 			mDaqEvents[eventIndex].type = eventType;
-			mDaqEvents[eventIndex].eventOccured = false;
 			mDaqEvents[eventIndex].callbackFunction = eventCalbackFunc;
 			mDaqEvents[eventIndex].userData = userData;
 
@@ -95,37 +108,35 @@ void DaqEventHandler::addEnabledEvents(DaqEventType eventTypes, unsigned long lo
 		}
 	}
 
+	// an event parked or queued while the type was disabled belongs to an earlier scan
+	resetEvents(eventTypes);
+
 	mEnabledEventsTypes = (DaqEventType)(mEnabledEventsTypes | eventTypes);
 }
 
 void DaqEventHandler::resetInputEvents(DaqEventType eventTypes)
 {
-	DaqEventType inputEventTypes = (DaqEventType) (eventTypes & (DE_ON_DATA_AVAILABLE | DE_ON_INPUT_SCAN_ERROR | DE_ON_END_OF_INPUT_SCAN));
-	std::bitset<MAX_EVENT_TYPE_COUNT> events(inputEventTypes);
-
-	DaqEventType eventType;
-	int eventIndex;
-
-	for(unsigned int i = 0; i < events.size(); i++)
-	{
-		if(events[i])
-		{
-			eventType = (DaqEventType) (1 << i);
-			eventIndex = getEventIndex(eventType);
-
-			mDaqEvents[eventIndex].eventOccured = false;
-		}
-	}
+	resetEvents((DaqEventType) (eventTypes & (DE_ON_DATA_AVAILABLE | DE_ON_INPUT_SCAN_ERROR | DE_ON_END_OF_INPUT_SCAN)));
 }
 
 void DaqEventHandler::resetOutputEvents(DaqEventType eventTypes)
 {
-	DaqEventType inputEventTypes = (DaqEventType) (eventTypes & (DE_ON_OUTPUT_SCAN_ERROR | DE_ON_END_OF_OUTPUT_SCAN ));
-	std::bitset<MAX_EVENT_TYPE_COUNT> events(inputEventTypes);
+	resetEvents((DaqEventType) (eventTypes & (DE_ON_OUTPUT_SCAN_ERROR | DE_ON_END_OF_OUTPUT_SCAN )));
+}
+
+void DaqEventHandler::resetEvents(DaqEventType eventTypes)
+{
+	std::bitset<MAX_EVENT_TYPE_COUNT> events(eventTypes);
+
+	// events of these types still in the queue belong to the previous scan, the event thread discards
+	// queued events with a sequence number not greater than the one recorded here
+	unsigned int seqNum = __atomic_load_n(&mEventSeqNum, __ATOMIC_RELAXED);
 
 	DaqEventType eventType;
 	int eventIndex;
 
+	UlLock lock(mParkedEventMutex);
+
 	for(unsigned int i = 0; i < events.size(); i++)
 	{
 		if(events[i])
@@ -133,7 +144,13 @@ void DaqEventHandler::resetOutputEvents(DaqEventType eventTypes)
 			eventType = (DaqEventType) (1 << i);
 			eventIndex = getEventIndex(eventType);
 
-			mDaqEvents[eventIndex].eventOccured = false;
+			__atomic_store_n(&mResetSeqNum[eventIndex], seqNum, __ATOMIC_RELEASE);
+
+			if(mDaqEvents[eventIndex].eventOccured)
+			{
+				mDaqEvents[eventIndex].eventOccured = false;
+				__atomic_sub_fetch(&mParkedEventCount, 1, __ATOMIC_RELEASE);
+			}
 		}
 	}
 }
@@ -147,39 +164,216 @@ unsigned long long DaqEventHandler::getEventParameter(DaqEventType eventType)
 
 void DaqEventHandler::setCurrentEventAndData(DaqEventType eventType, unsigned long long eventData)
 {
-	UlLock lock(mEventMutex);
+	if(!(mEnabledEventsTypes & eventType)) // check if this event type is disabled after scan started
+		return;
+
+	unsigned int seqNum = __atomic_add_fetch(&mEventSeqNum, 1, __ATOMIC_RELAXED);
+	unsigned long long timestamp = ul_clock_monotonic_ns();
 
-	if(mEnabledEventsTypes & eventType) // check if this event type is disabled after scan started
+	if(mEventDelivery == DED_TRANSFER_THREAD)
 	{
-		int eventIndex = getEventIndex(eventType);
+		deliverEvent(eventType, eventData, seqNum, timestamp);
+		return;
+	}
 
-		mDaqEvents[eventIndex].eventData = eventData;
-		mDaqEvents[eventIndex].eventOccured = true;
+	QueuedEvent event;
+	event.type = eventType;
+	event.seqNum = seqNum;
+	event.eventData = eventData;
+	event.timestamp = timestamp;
 
-		mDaqEventOccured = true;
-		mNotifier.signal();
+	if(!mEventQueue.push(event))
+	{
+		if(eventType == DE_ON_DATA_AVAILABLE)
+			__atomic_add_fetch(&mDroppedEventCount, 1, __ATOMIC_RELAXED);
+		else
+		{
+			DaqEvent& parkedEvent = mDaqEvents[getEventIndex(eventType)];
+
+			UlLock lock(mParkedEventMutex);
+
+			parkedEvent.eventData = eventData;
+			parkedEvent.seqNum = seqNum;
+			parkedEvent.timestamp = timestamp;
+
+			if(!parkedEvent.eventOccured)
+			{
+				parkedEvent.eventOccured = true;
+				__atomic_add_fetch(&mParkedEventCount, 1, __ATOMIC_RELEASE);
+			}
+		}
 	}
+
+	// pairs with the fence in waitForEvent(), only wake the event thread if it is about to sleep
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	if(__atomic_load_n(&mEventThreadWaiting, __ATOMIC_RELAXED))
+		mNotifier.signal();
 }
 
-void DaqEventHandler::getCurrentEventsAndData(DaqEvent* daqEvents, int& eventCount)
+void DaqEventHandler::dispatchEvents()
 {
-	//std::vector<DaqEvent> currentEvents;
+	QueuedEvent event;
+	int eventIndex;
 
-	UlLock lock(mEventMutex);
+	while(mEventQueue.pop(event))
+	{
+		// an event parked while the queue was full was posted before the queued events that follow it
+		deliverParkedEvents(false, event.seqNum);
+
+		eventIndex = getEventIndex(event.type);
 
-	eventCount = 0;
+		if((int) (event.seqNum - __atomic_load_n(&mResetSeqNum[eventIndex], __ATOMIC_ACQUIRE)) > 0)
+			deliverEvent(event.type, event.eventData, event.seqNum, event.timestamp);
+	}
 
-	for(int eventIndex = 0; eventIndex < MAX_EVENT_TYPE_COUNT; eventIndex++ )
+	deliverParkedEvents(true, 0);
+}
+
+// delivers the parked events, oldest first, that were posted before beforeSeqNum or all of them
+void DaqEventHandler::deliverParkedEvents(bool all, unsigned int beforeSeqNum)
+{
+	while(__atomic_load_n(&mParkedEventCount, __ATOMIC_ACQUIRE))
 	{
-		if(mDaqEvents[eventIndex].eventOccured)
+		DaqEvent parkedEvent;
+		int oldestIndex = -1;
+
+		pthread_mutex_lock(&mParkedEventMutex);
+
+		for(int eventIndex = 0; eventIndex < MAX_EVENT_TYPE_COUNT; eventIndex++)
 		{
-			daqEvents[eventCount] = mDaqEvents[eventIndex];
-			mDaqEvents[eventIndex].eventOccured = false;
-			eventCount++;
+			const DaqEvent& daqEvent = mDaqEvents[eventIndex];
+
+			if(daqEvent.eventOccured && (all || (int) (daqEvent.seqNum - beforeSeqNum) < 0)
+				&& (oldestIndex < 0 || (int) (daqEvent.seqNum - mDaqEvents[oldestIndex].seqNum) < 0))
+				oldestIndex = eventIndex;
 		}
+
+		if(oldestIndex >= 0)
+		{
+			parkedEvent = mDaqEvents[oldestIndex];
+
+			mDaqEvents[oldestIndex].eventOccured = false;
+			__atomic_sub_fetch(&mParkedEventCount, 1, __ATOMIC_RELEASE);
+		}
+
+		pthread_mutex_unlock(&mParkedEventMutex);
+
+		if(oldestIndex < 0)
+			break;
+
+		deliverEvent(parkedEvent.type, parkedEvent.eventData, parkedEvent.seqNum, parkedEvent.timestamp);
+	}
+}
+
+void DaqEventHandler::deliverEvent(DaqEventType eventType, unsigned long long eventData, unsigned int seqNum, unsigned long long timestamp)
+{
+	if(!(mEnabledEventsTypes & eventType))
+		return;
+
+	const DaqEvent& daqEvent = mDaqEvents[getEventIndex(eventType)];
+
+	unsigned long long elapsed = ul_clock_monotonic_ns() - timestamp;
+	unsigned int latency = elapsed > UINT_MAX ? UINT_MAX : (unsigned int) elapsed;
+	unsigned int maxLatency = __atomic_load_n(&mMaxLatency, __ATOMIC_RELAXED);
+
+	while(latency > maxLatency && !__atomic_compare_exchange_n(&mMaxLatency, &maxLatency, latency, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	__atomic_store_n(&mLastLatency, latency, __ATOMIC_RELAXED);
+	__atomic_store_n(&mLastDeliveredSeqNum, seqNum, __ATOMIC_RELAXED);
+
+	daqEvent.callbackFunction(mDaqDevice.getDeviceNumber(), eventType, eventData, daqEvent.userData);
+}
+
+void DaqEventHandler::setEventDelivery(DaqEventDelivery delivery)
+{
+	if(delivery != DED_EVENT_THREAD && delivery != DED_TRANSFER_THREAD)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	if(mDaqDevice.isScanRunning())
+		throw UlException(ERR_ALREADY_ACTIVE);
+
+	UlLock lock(mEventHandlerMutex);
+
+	mEventDelivery = delivery;
+}
+
+void DaqEventHandler::setEventThreadCpu(int cpu)
+{
+#ifdef __APPLE__
+	throw UlException(ERR_CONFIG_NOT_SUPPORTED);
+#else
+	if(cpu < -1 || cpu >= CPU_SETSIZE)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	UlLock lock(mEventHandlerMutex);
+
+	int prevCpu = mEventThreadCpu;
+	mEventThreadCpu = cpu;
+
+	if(mEventThreadHandle && applyEventThreadCpu(mEventThreadHandle))
+	{
+		mEventThreadCpu = prevCpu;
+		throw UlException(ERR_BAD_CONFIG_VAL);
+	}
+#endif
+}
+
+int DaqEventHandler::applyEventThreadCpu(pthread_t thread)
+{
+	int status = 0;
+
+#ifndef __APPLE__
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+
+	if(mEventThreadCpu >= 0)
+		CPU_SET(mEventThreadCpu, &cpuSet);
+	else
+	{
+		for(int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+			CPU_SET(cpu, &cpuSet);
 	}
 
-	mDaqEventOccured = false;
+	status = pthread_setaffinity_np(thread, sizeof(cpuSet), &cpuSet);
+
+	if(status)
+		UL_LOG("#### Unable to set the affinity of the daq event handler thread");
+#endif
+
+	return status;
+}
+
+unsigned long long DaqEventHandler::getEventStat(DaqEventStat stat) const
+{
+	unsigned long long value = 0;
+
+	switch(stat)
+	{
+	case DES_LAST_SEQUENCE:
+		value = __atomic_load_n(&mLastDeliveredSeqNum, __ATOMIC_RELAXED);
+		break;
+	case DES_DROP_COUNT:
+		value = __atomic_load_n(&mDroppedEventCount, __ATOMIC_RELAXED);
+		break;
+	case DES_LAST_LATENCY:
+		value = __atomic_load_n(&mLastLatency, __ATOMIC_RELAXED);
+		break;
+	case DES_MAX_LATENCY:
+		value = __atomic_load_n(&mMaxLatency, __ATOMIC_RELAXED);
+		break;
+	default:
+		throw UlException(ERR_BAD_CONFIG_VAL);
+	}
+
+	return value;
+}
+
+void DaqEventHandler::resetEventStats()
+{
+	__atomic_store_n(&mDroppedEventCount, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&mLastLatency, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&mMaxLatency, 0, __ATOMIC_RELAXED);
 }
 
 void DaqEventHandler::startEventThread()
@@ -230,24 +424,16 @@ void* DaqEventHandler::eventThread(void *arg)
 	int niceVal = 0;  // make sure this thread does not get a high priority if the parent thread is running with high priority
 	setpriority(PRIO_PROCESS, 0, niceVal);
 
-	This->mEventThreadInitEvent.signal();
+	if(This->mEventThreadCpu >= 0)
+		This->applyEventThreadCpu(pthread_self());
 
-	DaqEvent currentEvents[MAX_EVENT_TYPE_COUNT];
-	int eventCount = 0;
+	This->mEventThreadInitEvent.signal();
 
 	while (!This->mTerminateEventThread)
 	{
 		This->waitForEvent();
 
-		if(This->mDaqEventOccured)
-		{
-			This->getCurrentEventsAndData(currentEvents, eventCount);
-
-			for(int i = 0; i < eventCount; i++)
-			{
-				currentEvents[i].callbackFunction(This->mDaqDevice.getDeviceNumber(), currentEvents[i].type, currentEvents[i].eventData, currentEvents[i].userData);
-			}
-		}
+		This->dispatchEvents();
 	}
 
 	return NULL;
@@ -255,10 +441,20 @@ void* DaqEventHandler::eventThread(void *arg)
 
 void DaqEventHandler::waitForEvent()
 {
-	if(!mDaqEventOccured && !mTerminateEventThread)
+	__atomic_store_n(&mEventThreadWaiting, true, __ATOMIC_RELAXED);
+
+	// pairs with the fence in setCurrentEventAndData(), either the producer sees the waiting flag
+	// or this thread sees the posted event
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	bool eventPending = !mEventQueue.empty() || __atomic_load_n(&mParkedEventCount, __ATOMIC_ACQUIRE);
+
+	if(!eventPending && !mTerminateEventThread)
 	{
 		mNotifier.wait_for_signal();
 	}
+
+	__atomic_store_n(&mEventThreadWaiting, false, __ATOMIC_RELAXED);
 }
 
 
@@ -13,6 +13,7 @@
 #include "DaqDevice.h"
 #include "DaqEvent.h"
 #include "./utility/ThreadEvent.h"
+#include "./utility/EventQueue.h"
 #include "UlException.h"
 
 namespace ul
@@ -38,36 +39,72 @@ public:
 	void start();
 	void stop();
 
+	DaqEventDelivery getEventDelivery() const { return mEventDelivery; }
+	void setEventDelivery(DaqEventDelivery delivery);
+	int getEventThreadCpu() const { return mEventThreadCpu; }
+	void setEventThreadCpu(int cpu);
+	unsigned long long getEventStat(DaqEventStat stat) const;
+	void resetEventStats();
+
 private:
+	struct QueuedEvent
+	{
+		DaqEventType type;
+		unsigned int seqNum;
+		unsigned long long eventData;
+		unsigned long long timestamp;
+	};
+
 	void startEventThread();
 	void terminateEventThread();
 	static void* eventThread(void* arg);
 	void waitForEvent();
+	int applyEventThreadCpu(pthread_t thread);
 
 	unsigned int getEventIndex(DaqEventType eventType);
 
 	void addEnabledEvents(DaqEventType eventTypes, unsigned long long eventParameter, DaqEventCallback eventCalbackFunc, void* userData);
-	void getCurrentEventsAndData(DaqEvent* daqEvents, int& eventCount);
+	void resetEvents(DaqEventType eventTypes);
+	void dispatchEvents();
+	void deliverParkedEvents(bool all, unsigned int beforeSeqNum);
+	void deliverEvent(DaqEventType eventType, unsigned long long eventData, unsigned int seqNum, unsigned long long timestamp);
 
 	void check_EnableEvent_Args(DaqEventType eventTypes, unsigned long long eventParameter, DaqEventCallback eventCalbackFunc);
 	void check_DisableEvent_Args(DaqEventType eventTypes);
 
 private:
 	enum {MAX_EVENT_TYPE_COUNT = 5};
+	enum {EVENT_QUEUE_SIZE = 256};
 
 	const DaqDevice& mDaqDevice;
 	DaqEventType  mEnabledEventsTypes;
 	DaqEvent mDaqEvents[MAX_EVENT_TYPE_COUNT];
 
 	pthread_mutex_t mEventHandlerMutex;
-	pthread_mutex_t mEventMutex;
 
 	pthread_t mEventThreadHandle;
 	bool mTerminateEventThread;
 	ThreadEvent mEventThreadInitEvent;
 	ThreadEvent mNotifier;
-	bool mDaqEventOccured;
-	int mLastEventIndex;
+	bool mEventThreadWaiting;
+
+	// events are posted lock-free by the transfer threads. Error and end of scan events that find the queue
+	// full are parked in the eventOccured/eventData fields of mDaqEvents so they are never lost. The parked
+	// fields are guarded by mParkedEventMutex, not mEventHandlerMutex, which is held while the event thread
+	// is joined. mParkedEventCount lets the event thread skip the mutex when nothing is parked
+	EventQueue<QueuedEvent, EVENT_QUEUE_SIZE> mEventQueue;
+	pthread_mutex_t mParkedEventMutex;
+	unsigned int mParkedEventCount;
+	unsigned int mEventSeqNum;
+	unsigned int mResetSeqNum[MAX_EVENT_TYPE_COUNT];
+
+	DaqEventDelivery mEventDelivery;
+	int mEventThreadCpu;
+
+	unsigned int mLastDeliveredSeqNum;
+	unsigned int mDroppedEventCount;
+	unsigned int mLastLatency;
+	unsigned int mMaxLatency;
 };
 
 } /* namespace ul */
@@ -78,6 +78,32 @@ UlError DaqIDevice::waitUntilDone(FunctionType functionType, double timeout)
 	return err;
 }
 
+UlError DaqIDevice::waitForScanData(FunctionType functionType, long long scanCount, double timeout)
+{
+	UlError err = ERR_NO_ERROR;
+
+	if(mScanInfo.functionType == functionType)
+	{
+		err =  IoDevice::waitForScanData(scanCount, timeout);
+	}
+
+	return err;
+}
+
+UlError DaqIDevice::readScanData(FunctionType functionType, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	UlError err = ERR_NO_ERROR;
+
+	if(mScanInfo.functionType == functionType)
+	{
+		err =  IoDevice::readScanData(scanCount, timeout, data, scansRead);
+	}
+	else if(scansRead)
+		*scansRead = 0;
+
+	return err;
+}
+
 void DaqIDevice::stopBackground(FunctionType functionType)
 {
 	if(mScanInfo.functionType == functionType || mScanInfo.functionType == 0)
@@ -248,6 +274,12 @@ void DaqIDevice::check_DaqInScan_Args(DaqInChanDescriptor chanDescriptors[], int
 		if(~mDaqIInfo.getDaqInScanFlags() & flags)
 			throw UlException(ERR_BAD_FLAG);
 
+		long long dataTypeFlags = flags & (FLOAT32DATA | UINT16DATA | UINT32DATA);
+
+		// only one buffer type can be selected and integer buffers hold calibrated counts, so scaling must be off
+		if(dataTypeFlags && ((dataTypeFlags & (dataTypeFlags - 1)) || (!(flags & NOSCALEDATA) && !(flags & FLOAT32DATA))))
+			throw UlException(ERR_BAD_FLAG);
+
 		if((!(options & SO_EXTCLOCK) && invalidRate) || (rate <= 0.0))
 			throw UlException(ERR_BAD_RATE);
 
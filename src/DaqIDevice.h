@@ -31,6 +31,10 @@ public:
 	virtual void stopBackground(FunctionType functionType);
 	UlError waitUntilDone(FunctionType functionType, double timeout);
 	virtual UlError waitUntilDone(double timeout) { return IoDevice::waitUntilDone(timeout); }
+	UlError waitForScanData(FunctionType functionType, long long scanCount, double timeout);
+	virtual UlError waitForScanData(long long scanCount, double timeout) { return IoDevice::waitForScanData(scanCount, timeout); }
+	UlError readScanData(FunctionType functionType, long long scanCount, double timeout, void* data, long long* scansRead);
+	virtual UlError readScanData(long long scanCount, double timeout, void* data, long long* scansRead) { return IoDevice::readScanData(scanCount, timeout, data, scansRead); }
 
 	virtual double daqInScan(FunctionType functionType, DaqInChanDescriptor chanDescriptors[], int numChans, int samplesPerChan, double rate, ScanOption options, DaqInScanFlag flags, void* data);
 
@@ -107,6 +107,26 @@ double DioDevice::dOutScan(DigitalPortType lowPort, DigitalPortType highPort, in
 	throw UlException(ERR_BAD_DEV_TYPE);
 }
 
+std::vector<DaqInChanDescriptor> DioDevice::getScanChanDescriptors(DigitalPortType lowPort, DigitalPortType highPort) const
+{
+	std::vector<DaqInChanDescriptor> chanDescriptors;
+	DaqInChanDescriptor chanDescriptor;
+	memset(&chanDescriptor, 0, sizeof(chanDescriptor));
+
+	unsigned int lowPortNum = mDioInfo.getPortNum(lowPort);
+	unsigned int highPortNum = mDioInfo.getPortNum(highPort);
+
+	for(unsigned int portNum = lowPortNum; portNum <= highPortNum && portNum < mDioInfo.getNumPorts(); portNum++)
+	{
+		chanDescriptor.channel = mDioInfo.getPortType(portNum);
+		chanDescriptor.type = DAQI_DIGITAL;
+
+		chanDescriptors.push_back(chanDescriptor);
+	}
+
+	return chanDescriptors;
+}
+
 UlError DioDevice::getStatus(ScanDirection direction, ScanStatus* status, TransferStatus* xferStatus)
 {
 	throw UlException(ERR_BAD_DEV_TYPE);
@@ -593,6 +613,10 @@ UlError DioDevice::wait(ScanDirection direction, WaitType waitType, long long wa
 	{
 		err = waitUntilDone(direction, timeout);
 	}
+	else if(waitType == WAIT_UNTIL_SAMPLES_AVAILABLE)
+	{
+		err = waitForScanData(direction, waitParam, timeout);
+	}
 
 	return err;
 }
@@ -602,6 +626,16 @@ UlError DioDevice::waitUntilDone(ScanDirection direction, double timeout)
 	throw UlException(ERR_BAD_DEV_TYPE);
 }
 
+UlError DioDevice::waitForScanData(ScanDirection direction, long long scanCount, double timeout)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
+UlError DioDevice::readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	throw UlException(ERR_BAD_DEV_TYPE);
+}
+
 //////////////////////          Configuration functions          /////////////////////////////////
 
 unsigned long long DioDevice::getCfg_PortDirectionMask(unsigned int portNum) const
@@ -38,6 +38,7 @@ public:
 
 	virtual double dInScan(DigitalPortType lowPort, DigitalPortType highPort, int samplesPerPort, double rate, ScanOption options, DInScanFlag flags, unsigned long long data[]);
 	virtual double dOutScan(DigitalPortType lowPort, DigitalPortType highPort, int samplesPerPort, double rate, ScanOption options, DOutScanFlag flags, unsigned long long data[]);
+	std::vector<DaqInChanDescriptor> getScanChanDescriptors(DigitalPortType lowPort, DigitalPortType highPort) const;
 
 	void setScanState(ScanDirection direction, ScanStatus state);
 	virtual ScanStatus getScanState(ScanDirection direction) const;
@@ -51,6 +52,10 @@ public:
 	virtual UlError wait(WaitType waitType, long long waitParam, double timeout) { return IoDevice::wait(waitType, waitParam, timeout); }
 	virtual UlError waitUntilDone(ScanDirection direction, double timeout);
 	virtual UlError waitUntilDone(double timeout) { return IoDevice::waitUntilDone(timeout); }
+	virtual UlError waitForScanData(ScanDirection direction, long long scanCount, double timeout);
+	virtual UlError waitForScanData(long long scanCount, double timeout) { return IoDevice::waitForScanData(scanCount, timeout); }
+	virtual UlError readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead);
+	virtual UlError readScanData(long long scanCount, double timeout, void* data, long long* scansRead) { return IoDevice::readScanData(scanCount, timeout, data, scansRead); }
 
 	void setTrigger(ScanDirection direction, TriggerType type, int trigChan, double level, double variance, unsigned int retriggerCount);
 
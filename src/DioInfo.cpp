@@ -30,6 +30,9 @@ DioInfo::DioInfo()
 	mDoScanFlags = 0;
 	mDoTriggerTypes = (TriggerType) 0;
 	mDoFifoSize = 0;
+
+	for(int type = 0; type < PORT_TYPE_COUNT; type++)
+		mPortNums[type] = -1;
 }
 
 DioInfo::~DioInfo()
@@ -39,6 +42,9 @@ DioInfo::~DioInfo()
 
 void DioInfo::addPort(unsigned int portNum, DigitalPortType type, unsigned int numBits, DigitalPortIoType ioType)
 {
+	if(type >= 0 && type < PORT_TYPE_COUNT && mPortNums[type] == -1)
+		mPortNums[type] = mPortInfo.size();
+
 	mPortInfo.push_back(DioPortInfo(portNum, type, numBits, ioType));
 }
 
@@ -299,39 +305,15 @@ bool DioInfo::supportsTrigger(DigitalDirection direction) const
 
 bool DioInfo::isPortSupported(DigitalPortType portType) const
 {
-	bool supported = false;
-
-	DigitalPortType type;
-
-	for(unsigned int i = 0; i < getNumPorts(); i++)
-	{
-		type = getPortType(i);
-
-		if(type == portType)
-		{
-			supported = true;
-			break;
-		}
-	}
-
-	return supported;
+	return portType >= 0 && portType < PORT_TYPE_COUNT && mPortNums[portType] != -1;
 }
 
 unsigned int DioInfo::getPortNum(DigitalPortType portType) const
 {
 	unsigned int portIndex = 0;
-	DigitalPortType type;
 
-	for(unsigned int i = 0; i < getNumPorts(); i++)
-	{
-		type = getPortType(i);
-
-		if(type == portType)
-		{
-			portIndex = i;
-			break;
-		}
-	}
+	if(isPortSupported(portType))
+		portIndex = mPortNums[portType];
 
 	return portIndex;
 }
@@ -59,6 +59,10 @@ public:
 
 private:
 	std::vector<DioPortInfo> mPortInfo;
+
+	// index in mPortInfo of each port type, -1 if the port type is not supported
+	static const int PORT_TYPE_COUNT = EIGHTHPORTCH + 1;
+	int mPortNums[PORT_TYPE_COUNT];
 	TriggerType mDiTriggerTypes;
 	TriggerType mDoTriggerTypes;
 	long long mDiScanFlags;
@@ -4,9 +4,11 @@
  *     Author: Measurement Computing Corporation
  */
 #include <limits.h>
+#include <algorithm>
 
 #include "IoDevice.h"
 #include "UlException.h"
+#include "utility/ConfigShadow.h"
 
 namespace ul
 {
@@ -19,16 +21,29 @@ IoDevice::IoDevice(const DaqDevice& daqDevice): mDaqDevice(daqDevice), mMinScanS
 	mTrigCfg.type = TRIG_POS_EDGE;
 
 	mScanErrorFlag = false; //only used by DT devices
+	mRawScanRequested = false;
+	mInternalScan = false;
 
 	UlLock::initMutex(mIoDeviceMutex, PTHREAD_MUTEX_RECURSIVE);
 
 	UlLock::initMutex(mProcessScanDataMutex, PTHREAD_MUTEX_RECURSIVE);
+
+	mScanReadCount = 0;
+	mPublishedSampleCount = 0;
+	mMaxStageSampleCount = 0;
+	mScanWriteAheadCount = 0;
+	mScanDataWaiters = 0;
+
+	UlLock::initMutex(mScanDataMutex, PTHREAD_MUTEX_NORMAL);
+	pthread_cond_init(&mScanDataCond, NULL);
 }
 
 IoDevice::~IoDevice()
 {
 	UlLock::destroyMutex(mIoDeviceMutex);
 	UlLock::destroyMutex(mProcessScanDataMutex);
+	UlLock::destroyMutex(mScanDataMutex);
+	pthread_cond_destroy(&mScanDataCond);
 }
 
 void IoDevice::disconnect()
@@ -46,7 +61,18 @@ void IoDevice::disconnect()
 
 void IoDevice::setScanState(ScanStatus state)
 {
+	bool started = (state == SS_RUNNING && mScanState != SS_RUNNING);
+
 	mScanState = state;
+
+	if(started)
+	{
+		// the device may change its configuration while it scans
+		mDaqDevice.configShadow().invalidate();
+
+		if(!mInternalScan)
+			mDaqDevice.startScanRecorder(mScanInfo.functionType, this);
+	}
 }
 
 ScanStatus IoDevice::getScanState() const
@@ -64,16 +90,76 @@ double IoDevice::actualScanRate() const
 	return mActualScanRate;
 }
 
-void IoDevice::setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, std::vector<CalCoef> calCoefs, std::vector<CustomScale> customScales, void* dataBuffer)
+void IoDevice::beginInternalScan()
+{
+	// a recorder still writing the last user scan reads the state saved below
+	mDaqDevice.waitForScanRecorder(this);
+
+	mUserScan.scanInfo = mScanInfo;
+	mUserScan.scanProgress = mScanProgress.load();
+	mUserScan.scanReadCount = mScanReadCount;
+	mUserScan.publishedSampleCount = mPublishedSampleCount;
+	mUserScan.maxStageSampleCount = mMaxStageSampleCount;
+	mUserScan.scanWriteAheadCount = mScanWriteAheadCount;
+	mUserScan.actualScanRate = mActualScanRate;
+
+	mInternalScan = true;
+}
+
+void IoDevice::endInternalScan()
+{
+	if(!mInternalScan)
+		return;
+
+	mScanInfo = mUserScan.scanInfo;
+	mScanReadCount = mUserScan.scanReadCount;
+	mPublishedSampleCount = mUserScan.publishedSampleCount;
+	mMaxStageSampleCount = mUserScan.maxStageSampleCount;
+	mScanWriteAheadCount = mUserScan.scanWriteAheadCount;
+	mActualScanRate = mUserScan.actualScanRate;
+
+	bool calibrate = !((mScanInfo.flags & NOCALIBRATEDATA) && (mScanInfo.flags & NOSCALEDATA));
+	mScanDataConverter.setCoefs(mScanInfo.chanCount, mScanInfo.calCoefs, mScanInfo.customScales, calibrate);
+
+	mScanProgress.store(mUserScan.scanProgress);
+
+	mInternalScan = false;
+}
+
+double IoDevice::scanByteRate() const
+{
+	return mActualScanRate * mScanInfo.chanCount * mScanInfo.sampleSize;
+}
+
+void IoDevice::setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, const std::vector<CalCoef>& calCoefs, const std::vector<CustomScale>& customScales, void* dataBuffer)
 {
 	if(mScanState == SS_RUNNING)
 		throw UlException(ERR_ALREADY_ACTIVE);
 
+	// a recorder still writing the previous scan reads the scan info and progress that are reset below
+	mDaqDevice.waitForScanRecorder(this);
+
+	if(chanCount > MAX_CHAN_COUNT)
+		throw UlException(ERR_BAD_NUM_CHANS);
+
 	ScanDataBufferType dataBufferType = DATA_DBL;
 
 	if(functionType == FT_DI || functionType == FT_DO || functionType == FT_CTR)
 		dataBufferType = DATA_UINT64;
 
+	if(functionType == FT_AI || functionType == FT_DAQI)
+	{
+		if(flags & FLOAT32DATA)
+			dataBufferType = DATA_FLOAT;
+		else if(flags & UINT16DATA)
+			dataBufferType = DATA_UINT16;
+		else if(flags & UINT32DATA)
+			dataBufferType = DATA_UINT32;
+	}
+
+	if(mRawScanRequested)
+		dataBufferType = DATA_RAW;
+
 	mScanInfo.functionType = functionType;
 	mScanInfo.chanCount = chanCount;
 	mScanInfo.samplesPerChanCount = samplesPerChanCount;
@@ -89,15 +175,24 @@ void IoDevice::setScanInfo(FunctionType functionType, int chanCount, int samples
 	mScanInfo.dataBufferSize = mScanInfo.chanCount * mScanInfo.samplesPerChanCount;
 	mScanInfo.stoppingScan = false;
 
+	bool calibrate = !((flags & NOCALIBRATEDATA) && (flags & NOSCALEDATA));
+	mScanDataConverter.setCoefs(mScanInfo.chanCount, mScanInfo.calCoefs, mScanInfo.customScales, calibrate);
+
 	mScanDoneWaitEvent.reset();
 
-	UlLock lock(mProcessScanDataMutex);
 	mScanInfo.currentCalCoefIdx = 0;
 	mScanInfo.currentDataBufferIdx = 0;
 	mScanInfo.totalSampleTransferred = 0;
 	mScanInfo.allSamplesTransferred = false;
+
+	mScanReadCount = 0;
+	mPublishedSampleCount = 0;
+	mMaxStageSampleCount = 0;
+	mScanWriteAheadCount = 0;
+
+	publishScanProgress();
 }
-void IoDevice::setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, std::vector<CalCoef> calCoefs, void* dataBuffer)
+void IoDevice::setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, const std::vector<CalCoef>& calCoefs, void* dataBuffer)
 {
 	std::vector<CustomScale> customScales;
 
@@ -106,9 +201,11 @@ void IoDevice::setScanInfo(FunctionType functionType, int chanCount, int samples
 
 void IoDevice::getXferStatus(TransferStatus* xferStatus) const
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransfered is not updated atomically
+	// lock-free, the transfer thread publishes the sample count after each transfer and the
+	// channel count and buffer size do not change while the scan is running
+	unsigned long long totalSampleTransferred = mScanProgress.load();
 
-	if(mScanInfo.totalSampleTransferred == 0)  // if scan never ran since ul is loaded
+	if(totalSampleTransferred == 0)  // if scan never ran since ul is loaded
 	{
 		xferStatus->currentIndex = -1;
 		xferStatus->currentTotalCount = 0;
@@ -116,24 +213,21 @@ void IoDevice::getXferStatus(TransferStatus* xferStatus) const
 	}
 	else
 	{
-		//unsigned long long count = mScanInfo.totalSampleTransferred; // return current sample count
-		//unsigned long long idx = -1;
-
-		if(mScanInfo.chanCount > 0 && mScanInfo.totalSampleTransferred >= mScanInfo.chanCount)
+		if(mScanInfo.chanCount > 0 && totalSampleTransferred >= mScanInfo.chanCount)
 		{
-			unsigned long long idx = mScanInfo.totalSampleTransferred;
+			unsigned long long idx = totalSampleTransferred;
 			idx -= (idx % mScanInfo.chanCount);
 			idx -= mScanInfo.chanCount;
 			idx = idx % mScanInfo.dataBufferSize;
 
 			xferStatus->currentIndex = idx;
-			xferStatus->currentTotalCount = mScanInfo.totalSampleTransferred;
-			xferStatus->currentScanCount = mScanInfo.totalSampleTransferred / mScanInfo.chanCount;
+			xferStatus->currentTotalCount = totalSampleTransferred;
+			xferStatus->currentScanCount = totalSampleTransferred / mScanInfo.chanCount;
 		}
 		else
 		{
 			xferStatus->currentIndex = -1;
-			xferStatus->currentTotalCount = mScanInfo.totalSampleTransferred;
+			xferStatus->currentTotalCount = totalSampleTransferred;
 			xferStatus->currentScanCount = 0;
 		}
 	}
@@ -200,6 +294,260 @@ unsigned int IoDevice::calcPacerPeriod(double rate, ScanOption options)
 	return period;
 }
 
+void IoDevice::convertScanSamples(const unsigned char* xferBuf, unsigned int sampleCount)
+{
+	// the buffer type is resolved once per transfer so the conversion loop is specialized for each output type
+	if(mScanInfo.sampleSize == 2)
+	{
+		const unsigned short* samples = (const unsigned short*) xferBuf;
+
+		switch(mScanInfo.dataBufferType)
+		{
+		case DATA_FLOAT:
+			convertScanSamples(samples, sampleCount, (float*) mScanInfo.dataBuffer);
+			break;
+		case DATA_UINT16:
+			convertScanSamples(samples, sampleCount, (unsigned short*) mScanInfo.dataBuffer);
+			break;
+		case DATA_UINT32:
+			convertScanSamples(samples, sampleCount, (unsigned int*) mScanInfo.dataBuffer);
+			break;
+		default:
+			convertScanSamples(samples, sampleCount, (double*) mScanInfo.dataBuffer);
+			break;
+		}
+	}
+	else
+	{
+		const unsigned int* samples = (const unsigned int*) xferBuf;
+
+		switch(mScanInfo.dataBufferType)
+		{
+		case DATA_FLOAT:
+			convertScanSamples(samples, sampleCount, (float*) mScanInfo.dataBuffer);
+			break;
+		case DATA_UINT16:
+			convertScanSamples(samples, sampleCount, (unsigned short*) mScanInfo.dataBuffer);
+			break;
+		case DATA_UINT32:
+			convertScanSamples(samples, sampleCount, (unsigned int*) mScanInfo.dataBuffer);
+			break;
+		default:
+			convertScanSamples(samples, sampleCount, (double*) mScanInfo.dataBuffer);
+			break;
+		}
+	}
+}
+
+namespace
+{
+// converts channel-aligned chunks of one transfer on the scan conversion pool, each chunk writes a disjoint region of the data buffer
+template <typename S, typename D>
+class ConvertTask : public WorkerPool::Task
+{
+public:
+	struct Chunk
+	{
+		unsigned int srcIdx;
+		unsigned long long dstIdx;
+		unsigned int chanIdx;
+		unsigned int count;
+	};
+
+	enum { MAX_CHUNK_COUNT = 64 };
+
+	ConvertTask(const ScanDataConverter& converter, const S* src, D* dst) : mConverter(converter), mSrc(src), mDst(dst), mChunkCount(0) {}
+
+	virtual void runChunk(unsigned int chunkIdx)
+	{
+		const Chunk& chunk = mChunks[chunkIdx];
+		mConverter.convert(&mSrc[chunk.srcIdx], &mDst[chunk.dstIdx], chunk.count, chunk.chanIdx);
+	}
+
+	const ScanDataConverter& mConverter;
+	const S* mSrc;
+	D* mDst;
+	Chunk mChunks[MAX_CHUNK_COUNT];
+	unsigned int mChunkCount;
+};
+}
+
+template <typename S, typename D>
+void IoDevice::convertScanSamples(const S* xferBuf, unsigned int sampleCount, D* dataBuffer)
+{
+	WorkerPool* pool = mDaqDevice.scanConversionPool();
+	unsigned int threadCount = pool ? pool->getThreadCount() : 1;
+
+	if(threadCount > 1 && sampleCount >= PARALLEL_CONVERSION_MIN_SAMPLES)
+	{
+		convertScanSamplesParallel(*pool, xferBuf, sampleCount, dataBuffer);
+		return;
+	}
+
+	while(sampleCount)
+	{
+		// convert up to the end of the user buffer in one block
+		unsigned int blockSize = sampleCount;
+		unsigned long long samplesToBufferEnd = mScanInfo.dataBufferSize - mScanInfo.currentDataBufferIdx;
+
+		if(blockSize > samplesToBufferEnd)
+			blockSize = samplesToBufferEnd;
+
+		mScanDataConverter.convert(xferBuf, &dataBuffer[mScanInfo.currentDataBufferIdx], blockSize, mScanInfo.currentCalCoefIdx);
+
+		xferBuf += blockSize;
+		sampleCount -= blockSize;
+
+		mScanInfo.currentDataBufferIdx += blockSize;
+		mScanInfo.currentCalCoefIdx = (mScanInfo.currentCalCoefIdx + blockSize) % mScanInfo.chanCount;
+		mScanInfo.totalSampleTransferred += blockSize;
+
+		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
+		{
+			mScanInfo.currentDataBufferIdx = 0;
+			if(!mScanInfo.recycle)
+			{
+				mScanInfo.allSamplesTransferred = true;
+				break;
+			}
+		}
+	}
+}
+
+template <typename S, typename D>
+void IoDevice::convertScanSamplesParallel(WorkerPool& pool, const S* xferBuf, unsigned int sampleCount, D* dataBuffer)
+{
+	ConvertTask<S, D> task(mScanDataConverter, xferBuf, dataBuffer);
+
+	// about two chunks per thread, rounded up to whole scans so every chunk starts on the same channel
+	unsigned int chunkSize = sampleCount / (pool.getThreadCount() * 2);
+
+	if(chunkSize < PARALLEL_CONVERSION_MIN_CHUNK)
+		chunkSize = PARALLEL_CONVERSION_MIN_CHUNK;
+
+	chunkSize = ((chunkSize + mScanInfo.chanCount - 1) / mScanInfo.chanCount) * mScanInfo.chanCount;
+
+	// the chunk layout and the scan state are computed here, in the same order as the serial conversion,
+	// so the buffer index and sample count are exact no matter in which order the chunks complete
+	unsigned int srcIdx = 0;
+
+	while(sampleCount)
+	{
+		unsigned int blockSize = sampleCount;
+		unsigned long long samplesToBufferEnd = mScanInfo.dataBufferSize - mScanInfo.currentDataBufferIdx;
+
+		if(blockSize > samplesToBufferEnd)
+			blockSize = samplesToBufferEnd;
+
+		unsigned int remaining = blockSize;
+
+		while(remaining)
+		{
+			unsigned int count = remaining;
+
+			if(count > chunkSize && task.mChunkCount < ConvertTask<S, D>::MAX_CHUNK_COUNT - 1)
+				count = chunkSize;
+
+			typename ConvertTask<S, D>::Chunk& chunk = task.mChunks[task.mChunkCount++];
+			chunk.srcIdx = srcIdx;
+			chunk.dstIdx = mScanInfo.currentDataBufferIdx;
+			chunk.chanIdx = mScanInfo.currentCalCoefIdx;
+			chunk.count = count;
+
+			srcIdx += count;
+			remaining -= count;
+
+			mScanInfo.currentDataBufferIdx += count;
+			mScanInfo.currentCalCoefIdx = (mScanInfo.currentCalCoefIdx + count) % mScanInfo.chanCount;
+		}
+
+		sampleCount -= blockSize;
+		mScanInfo.totalSampleTransferred += blockSize;
+
+		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
+		{
+			mScanInfo.currentDataBufferIdx = 0;
+			if(!mScanInfo.recycle)
+			{
+				mScanInfo.allSamplesTransferred = true;
+				break;
+			}
+		}
+	}
+
+	pool.run(&task, task.mChunkCount);
+}
+
+void IoDevice::storeRawScanSamples(const unsigned char* xferBuf, unsigned int sampleCount)
+{
+	unsigned char* dataBuffer = (unsigned char*) mScanInfo.dataBuffer;
+
+	while(sampleCount)
+	{
+		unsigned int blockSize = sampleCount;
+		unsigned long long samplesToBufferEnd = mScanInfo.dataBufferSize - mScanInfo.currentDataBufferIdx;
+
+		if(blockSize > samplesToBufferEnd)
+			blockSize = samplesToBufferEnd;
+
+		unsigned char* dest = &dataBuffer[mScanInfo.currentDataBufferIdx * mScanInfo.sampleSize];
+
+		// transfers that were submitted directly into the data buffer need no copy, memmove handles the
+		// case where a short transfer left a gap and later samples have to be moved down
+		if(dest != xferBuf)
+			memmove(dest, xferBuf, blockSize * mScanInfo.sampleSize);
+
+		xferBuf += blockSize * mScanInfo.sampleSize;
+		sampleCount -= blockSize;
+
+		mScanInfo.currentDataBufferIdx += blockSize;
+		mScanInfo.currentCalCoefIdx = (mScanInfo.currentCalCoefIdx + blockSize) % mScanInfo.chanCount;
+		mScanInfo.totalSampleTransferred += blockSize;
+
+		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
+		{
+			mScanInfo.currentDataBufferIdx = 0;
+			if(!mScanInfo.recycle)
+			{
+				mScanInfo.allSamplesTransferred = true;
+				break;
+			}
+		}
+	}
+}
+
+void IoDevice::publishScanProgress()
+{
+	unsigned long long stageSampleCount = mScanInfo.totalSampleTransferred - mPublishedSampleCount;
+
+	if(stageSampleCount > mMaxStageSampleCount)
+		__atomic_store_n(&mMaxStageSampleCount, (unsigned int) stageSampleCount, __ATOMIC_RELAXED);
+
+	mPublishedSampleCount = mScanInfo.totalSampleTransferred;
+
+	mScanProgress.store(mScanInfo.totalSampleTransferred);
+
+	// pairs with the increment in waitForUnreadScans(), the mutex is only taken when a reader is waiting
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	if(__atomic_load_n(&mScanDataWaiters, __ATOMIC_RELAXED))
+	{
+		UlLock lock(mScanDataMutex);
+		pthread_cond_broadcast(&mScanDataCond);
+	}
+}
+
+void IoDevice::signalScanDoneWaitEvent()
+{
+	mDaqDevice.scanRecorderDone(this);
+
+	mScanDoneWaitEvent.signal();
+
+	// readers waiting for more data than the scan delivered return once the scan is no longer running
+	UlLock lock(mScanDataMutex);
+	pthread_cond_broadcast(&mScanDataCond);
+}
+
 UlError IoDevice::wait(WaitType waitType, long long waitParam, double timeout)
 {
 	UlError err = ERR_NO_ERROR;
@@ -208,6 +556,10 @@ UlError IoDevice::wait(WaitType waitType, long long waitParam, double timeout)
 	{
 		err = waitUntilDone( timeout);
 	}
+	else if(waitType == WAIT_UNTIL_SAMPLES_AVAILABLE)
+	{
+		err = waitForScanData(waitParam, timeout);
+	}
 
 	return err;
 }
@@ -237,6 +589,178 @@ UlError IoDevice::waitUntilDone(double timeout)
 	return err;
 }
 
+UlError IoDevice::waitForScanData(long long scanCount, double timeout)
+{
+	UlError err = ERR_NO_ERROR;
+
+	if(scanCount < 0)
+		throw UlException(ERR_BAD_SAMPLE_COUNT);
+
+	if(mScanInfo.functionType == FT_AO || mScanInfo.functionType == FT_DO || mScanInfo.functionType == FT_DAQO)
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	int ret = waitForUnreadScans(mScanReadCount, scanCount, timeout);
+
+	if(ret == ETIMEDOUT)
+		err = ERR_TIMEDOUT;
+
+	return err;
+}
+
+UlError IoDevice::readScanData(long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	UlError err = ERR_NO_ERROR;
+
+	if(scansRead == NULL || data == NULL)
+		throw UlException(ERR_BAD_BUFFER);
+
+	*scansRead = 0;
+
+	if(scanCount <= 0)
+		throw UlException(ERR_BAD_SAMPLE_COUNT);
+
+	if(mScanInfo.functionType == FT_AO || mScanInfo.functionType == FT_DO || mScanInfo.functionType == FT_DAQO)
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	if(mScanInfo.chanCount == 0) // if scan never ran since ul is loaded
+		return err;
+
+	if((unsigned long long) scanCount > mScanInfo.samplesPerChanCount)
+		throw UlException(ERR_BAD_BUFFER_SIZE);
+
+	int ret = waitForUnreadScans(mScanReadCount, scanCount, timeout);
+
+	unsigned long long readCount = unreadScanCount(mScanReadCount);
+
+	if(readCount > (unsigned long long) scanCount)
+		readCount = scanCount;
+
+	if(readCount)
+	{
+		if(!copyScanData(mScanReadCount, readCount, data))
+		{
+			// skip to the newest data so the next read does not fail again
+			mScanReadCount = mScanProgress.load() / mScanInfo.chanCount;
+
+			return ERR_SCAN_BUFFER_OVERRUN;
+		}
+
+		mScanReadCount += readCount;
+		*scansRead = readCount;
+	}
+
+	if(readCount < (unsigned long long) scanCount && ret == ETIMEDOUT)
+		err = ERR_TIMEDOUT;
+
+	return err;
+}
+
+unsigned int IoDevice::scanDataBufferSampleSize() const
+{
+	unsigned int sampleSize;
+
+	switch(mScanInfo.dataBufferType)
+	{
+	case DATA_FLOAT:
+	case DATA_UINT32:
+		sampleSize = 4;
+		break;
+	case DATA_UINT16:
+		sampleSize = 2;
+		break;
+	case DATA_RAW:
+		sampleSize = mScanInfo.sampleSize;
+		break;
+	default:
+		sampleSize = 8;
+		break;
+	}
+
+	return sampleSize;
+}
+
+unsigned long long IoDevice::unreadScanCount(unsigned long long scanReadCount) const
+{
+	unsigned long long scanCount = 0;
+
+	if(mScanInfo.chanCount)
+		scanCount = mScanProgress.load() / mScanInfo.chanCount - scanReadCount;
+
+	return scanCount;
+}
+
+bool IoDevice::copyScanData(unsigned long long scanReadCount, unsigned long long scanCount, void* data) const
+{
+	unsigned long long bufferSize = mScanInfo.dataBufferSize;
+	unsigned long long startSample = scanReadCount * mScanInfo.chanCount;
+	unsigned long long sampleCount = scanCount * mScanInfo.chanCount;
+	unsigned int sampleSize = scanDataBufferSampleSize();
+
+	// in continuous mode the samples of the transfer being processed may already overwrite the oldest
+	// unread ones, check before and after copying because the transfer thread does not wait for the reader
+	if(mScanInfo.recycle && scanDataOverwritten(startSample))
+		return false;
+
+	unsigned long long bufferIdx = startSample % bufferSize;
+	unsigned long long firstBlock = std::min(sampleCount, bufferSize - bufferIdx);
+
+	memcpy(data, scanDataBuffer() + bufferIdx * sampleSize, firstBlock * sampleSize);
+
+	if(firstBlock < sampleCount)
+		memcpy((unsigned char*) data + firstBlock * sampleSize, scanDataBuffer(), (sampleCount - firstBlock) * sampleSize);
+
+	return !(mScanInfo.recycle && scanDataOverwritten(startSample));
+}
+
+void IoDevice::setScanWriteAhead(unsigned long long sampleCount)
+{
+	__atomic_store_n(&mScanWriteAheadCount, sampleCount, __ATOMIC_RELAXED);
+}
+
+bool IoDevice::scanDataOverwritten(unsigned long long sampleIdx) const
+{
+	unsigned long long writeAhead = std::max((unsigned long long) __atomic_load_n(&mMaxStageSampleCount, __ATOMIC_RELAXED),
+											 __atomic_load_n(&mScanWriteAheadCount, __ATOMIC_RELAXED));
+
+	return mScanProgress.load() + writeAhead > sampleIdx + mScanInfo.dataBufferSize;
+}
+
+int IoDevice::waitForUnreadScans(unsigned long long scanReadCount, unsigned long long scanCount, double timeout)
+{
+	int ret = 0;
+
+	UlLock lock(mScanDataMutex);
+
+	// pairs with the fence in publishScanProgress()
+	__atomic_add_fetch(&mScanDataWaiters, 1, __ATOMIC_SEQ_CST);
+
+	struct timespec now, waitUntil;
+
+	ul_clock_realtime(&now);
+
+	unsigned long long nanoseconds = ((unsigned long long) now.tv_sec) * 1000000000ULL + now.tv_nsec;
+
+	if(timeout > 0)
+		nanoseconds += (unsigned long long) (timeout * 1000000000);
+
+	waitUntil.tv_sec = nanoseconds / 1000000000ULL;
+	waitUntil.tv_nsec = nanoseconds % 1000000000ULL;
+
+	while(ret == 0 && unreadScanCount(scanReadCount) < scanCount && IoDevice::getScanState() == SS_RUNNING)
+	{
+		if(timeout == -1)
+			pthread_cond_wait(&mScanDataCond, &mScanDataMutex);
+		else if(timeout > 0)
+			ret = pthread_cond_timedwait(&mScanDataCond, &mScanDataMutex, &waitUntil);
+		else
+			ret = ETIMEDOUT;
+	}
+
+	__atomic_sub_fetch(&mScanDataWaiters, 1, __ATOMIC_SEQ_CST);
+
+	return ret;
+}
+
 /*unsigned int IoDevice::readScanDataDbl(double* readArray, unsigned int samplesPerChanCount, int fillMode, double timeout)
 {
 	unsigned int samplesPerChanRead = 0;
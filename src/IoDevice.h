@@ -13,12 +13,17 @@
 #include "./utility/Endian.h"
 #include "./utility/UlLock.h"
 #include "./utility/ThreadEvent.h"
+#include "./utility/ScanDataConverter.h"
+#include "./utility/SeqCounter.h"
+#include "./utility/WorkerPool.h"
 
 namespace ul
 {
 
 class UL_LOCAL IoDevice
 {
+	friend class ScanRecorder;
+
 public:
 	IoDevice(const DaqDevice& daqDevice);
 	virtual ~IoDevice();
@@ -33,6 +38,16 @@ public:
 	void setActualScanRate(double rate);
 	double actualScanRate() const;
 
+	// a scan run by the library on behalf of another function, such as the scan of ulAInSnapshot(). It is not
+	// recorded, fires no events, is not held by a scan group and leaves the data, status and scan coefficients
+	// of the last user scan in place once endInternalScan() is called
+	void beginInternalScan();
+	void endInternalScan();
+	bool internalScan() const { return mInternalScan; }
+
+	// rate, in bytes per second, at which the device produces or consumes the data of the current scan
+	double scanByteRate() const;
+
 	virtual void stopBackground() {};
 	virtual UlError terminateScan() {return ERR_BAD_DEV_TYPE;}
 	virtual UlError checkScanState(bool* scanDone = NULL) const { return ERR_BAD_DEV_TYPE;}
@@ -46,23 +61,56 @@ public:
 	inline bool allScanSamplesTransferred() const { return mScanInfo.allSamplesTransferred; }
 	inline bool recycleMode() const { return mScanInfo.recycle; }
 	inline unsigned int scanChanCount() const { return mScanInfo.chanCount; }
-	inline unsigned long long totalScanSamplesTransferred() const { return mScanInfo.totalSampleTransferred; }
+	inline unsigned long long totalScanSamplesTransferred() const { return mScanProgress.load(); }
+	// makes the sample count of the last processed transfer visible to the status functions and wakes threads
+	// blocked in waitForScanData() or readScanData(), called by the transfer thread
+	void publishScanProgress();
+	// number of samples past the published ones the transfers may already be writing into the data buffer, set by
+	// transfers that write into it directly. Reset when a scan starts
+	void setScanWriteAhead(unsigned long long sampleCount);
+
+	inline bool rawScanData() const { return mScanInfo.dataBufferType == DATA_RAW; }
+	inline unsigned char* scanDataBuffer() const { return (unsigned char*) mScanInfo.dataBuffer; }
+	inline unsigned long long scanDataBufferBytes() const { return mScanInfo.dataBufferSize * mScanInfo.sampleSize; }
 
 	TriggerConfig getTrigConfig() const { return mTrigCfg;}
 
 	virtual UlError wait(WaitType waitType, long long waitParam, double timeout);
 	virtual UlError waitUntilDone(double timeout);
-	void signalScanDoneWaitEvent() { mScanDoneWaitEvent.signal();}
+	void signalScanDoneWaitEvent();
+
+	// scanCount is the number of scans not yet returned by readScanData()
+	virtual UlError waitForScanData(long long scanCount, double timeout);
+	virtual UlError readScanData(long long scanCount, double timeout, void* data, long long* scansRead);
+
+	// building blocks of readScanData() for readers that keep their own read position, such as the scan recorder
+	unsigned long long unreadScanCount(unsigned long long scanReadCount) const;
+	int waitForUnreadScans(unsigned long long scanReadCount, unsigned long long scanCount, double timeout);
+	// returns false if the scans were overwritten before or while they were copied
+	bool copyScanData(unsigned long long scanReadCount, unsigned long long scanCount, void* data) const;
+	unsigned int scanDataBufferSampleSize() const;
 
 	bool scanErrorOccurred() { return mScanErrorFlag; }
 	void setscanErrorFlag() { mScanErrorFlag = true;}
 	void resetScanErrorFlag() { mScanErrorFlag = false; }
 
 protected:
-	void setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, std::vector<CalCoef> calCoefs, std::vector<CustomScale> customScales, void* dataBuffer);
-	void setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, std::vector<CalCoef> calCoefs, void* dataBuffer);
+	void setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, const std::vector<CalCoef>& calCoefs, const std::vector<CustomScale>& customScales, void* dataBuffer);
+	void setScanInfo(FunctionType functionType, int chanCount, int samplesPerChanCount, int sampleSize, unsigned int analogResolution, ScanOption options, long long flags, const std::vector<CalCoef>& calCoefs, void* dataBuffer);
 	unsigned int calcPacerPeriod(double rate, ScanOption options);
 
+	template <typename S, typename D>
+	void convertScanSamples(const S* xferBuf, unsigned int sampleCount, D* dataBuffer);
+	template <typename S, typename D>
+	void convertScanSamplesParallel(WorkerPool& pool, const S* xferBuf, unsigned int sampleCount, D* dataBuffer);
+
+	// converts raw 16 or 32-bit samples into the data buffer according to its type
+	void convertScanSamples(const unsigned char* xferBuf, unsigned int sampleCount);
+	// stores device-native samples in the data buffer, samples already received in place are not copied
+	void storeRawScanSamples(const unsigned char* xferBuf, unsigned int sampleCount);
+
+	bool scanDataOverwritten(unsigned long long sampleIdx) const;
+
 protected:
 	const DaqDevice& mDaqDevice;
 	pthread_mutex_t mIoDeviceMutex;
@@ -71,6 +119,8 @@ protected:
 	mutable pthread_mutex_t mProcessScanDataMutex;
 
 	enum {MAX_CHAN_COUNT = 128};
+	// transfers smaller than this are not worth waking the conversion pool for
+	enum {PARALLEL_CONVERSION_MIN_SAMPLES = 16384, PARALLEL_CONVERSION_MIN_CHUNK = 4096};
 
 	struct
 	{
@@ -95,6 +145,39 @@ protected:
 
 	TriggerConfig mTrigCfg;
 
+	// set by ulAInScanRaw() while the scan is set up, the device-native samples are stored without conversion.
+	// It is not a scan flag so the callers of the public scan functions can not select raw data
+	bool mRawScanRequested;
+
+	bool mInternalScan;
+
+	ScanDataConverter mScanDataConverter;
+	SeqCounter mScanProgress;
+
+	// read position of readScanData() in scans, only touched by the reading thread
+	unsigned long long mScanReadCount;
+	// largest number of samples a single transfer added to the data buffer, a reader must stay
+	// this far ahead of the transfer thread because those samples are written before they are published
+	unsigned long long mPublishedSampleCount;
+	unsigned int mMaxStageSampleCount;
+	unsigned long long mScanWriteAheadCount;
+
+	pthread_mutex_t mScanDataMutex;
+	pthread_cond_t mScanDataCond;
+	int mScanDataWaiters;
+
+	// state of the last user scan saved by beginInternalScan()
+	struct
+	{
+		decltype(mScanInfo) scanInfo;
+		unsigned long long scanProgress;
+		unsigned long long scanReadCount;
+		unsigned long long publishedSampleCount;
+		unsigned int maxStageSampleCount;
+		unsigned long long scanWriteAheadCount;
+		double actualScanRate;
+	} mUserScan;
+
 public:
 	Endian& mEndian;
 
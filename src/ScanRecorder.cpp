@@ -0,0 +1,342 @@
+/*
+ * ScanRecorder.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "ScanRecorder.h"
+#include "IoDevice.h"
+
+namespace ul
+{
+
+ScanRecorder::ScanRecorder(const std::string& pathPrefix, unsigned int segmentCount, unsigned long long segmentSize)
+{
+	mPathPrefix = pathPrefix;
+	mSegmentCount = segmentCount;
+	mSegmentSize = segmentSize;
+
+	mIoDevice = NULL;
+	mRecorderThreadHandle = 0;
+	mStopRequested = false;
+
+	mStartTime = 0;
+	mScanReadCount = 0;
+	mScanSize = 0;
+	mScansPerSegment = 0;
+
+	mSegmentNumber = 0;
+	mSegmentFileSize = 0;
+	mSegment = NULL;
+	mSegmentData = NULL;
+	mSegmentScanCount = 0;
+
+	memset(&mStatus, 0, sizeof(mStatus));
+
+	UlLock::initMutex(mStatusMutex, PTHREAD_MUTEX_RECURSIVE);
+}
+
+ScanRecorder::~ScanRecorder()
+{
+	stop();
+
+	UlLock::destroyMutex(mStatusMutex);
+}
+
+void ScanRecorder::setChanDescriptors(const std::vector<DaqInChanDescriptor>& chanDescriptors)
+{
+	mChanDescriptors = chanDescriptors;
+}
+
+void ScanRecorder::start(IoDevice* ioDevice)
+{
+	FnLog log("ScanRecorder::start");
+
+	stop();
+
+	mIoDevice = ioDevice;
+	mStopRequested = false;
+	mScanReadCount = 0;
+	mStartTime = 0;
+
+	// mSegmentNumber is not reset, the scans recorded while the recorder is enabled share one ring of segment files
+	// so a scan overwrites the segments of the previous one only when the ring wraps around
+
+	{
+		UlLock lock(mStatusMutex);
+		memset(&mStatus, 0, sizeof(mStatus));
+	}
+
+	mScanSize = ioDevice->mScanInfo.chanCount * ioDevice->scanDataBufferSampleSize();
+	mScansPerSegment = mScanSize ? mSegmentSize / mScanSize : 0;
+
+	if(mScansPerSegment == 0)
+	{
+		setError(ERR_BAD_BUFFER_SIZE);
+		return;
+	}
+
+	struct timespec now;
+	ul_clock_realtime(&now);
+	mStartTime = ((unsigned long long) now.tv_sec) * 1000000000ULL + now.tv_nsec;
+
+	pthread_attr_t attr;
+	int status = pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+	if(!status)
+	{
+		status = pthread_create(&mRecorderThreadHandle, &attr, &recorderThread, this);
+
+		if(status)
+		{
+			mRecorderThreadHandle = 0;
+			UL_LOG("#### Unable to start the scan recorder thread");
+		}
+#ifndef __APPLE__
+		else
+			pthread_setname_np(mRecorderThreadHandle, "scan_rec_td");
+#endif
+
+		status = pthread_attr_destroy(&attr);
+	}
+	else
+		UL_LOG("#### Unable to initialize attributes for the scan recorder thread");
+}
+
+void ScanRecorder::requestStop(const IoDevice* ioDevice)
+{
+	if(ioDevice == mIoDevice)
+		__atomic_store_n(&mStopRequested, true, __ATOMIC_RELEASE);
+}
+
+void ScanRecorder::stop()
+{
+	FnLog log("ScanRecorder::stop");
+
+	if(mRecorderThreadHandle)
+	{
+		__atomic_store_n(&mStopRequested, true, __ATOMIC_RELEASE);
+
+		pthread_join(mRecorderThreadHandle, NULL);
+
+		mRecorderThreadHandle = 0;
+	}
+}
+
+bool ScanRecorder::isRecording() const
+{
+	return mRecorderThreadHandle != 0 && !__atomic_load_n(&mStopRequested, __ATOMIC_ACQUIRE);
+}
+
+void ScanRecorder::getStatus(ScanRecorderStatus* status) const
+{
+	UlLock lock(mStatusMutex);
+
+	*status = mStatus;
+}
+
+void ScanRecorder::setError(UlError err)
+{
+	UlLock lock(mStatusMutex);
+
+	mStatus.error = err;
+}
+
+void* ScanRecorder::recorderThread(void* arg)
+{
+	ScanRecorder* This = (ScanRecorder*) arg;
+
+	This->record();
+
+	return NULL;
+}
+
+void ScanRecorder::record()
+{
+	// write in chunks of at most an eighth of the scan buffer, the writes stay large while
+	// the recorder still notices back-pressure well before the scan laps it
+	unsigned long long bufferScans = mIoDevice->mScanInfo.samplesPerChanCount;
+	unsigned long long chunkScans = std::max(1ULL, std::min(bufferScans / 8, mScansPerSegment));
+
+	bool error = false;
+
+	while(!error)
+	{
+		mIoDevice->waitForUnreadScans(mScanReadCount, chunkScans, 0.1);
+
+		// check for the end of the scan before reading the backlog, the last scans are published before the scan stops
+		bool scanDone = __atomic_load_n(&mStopRequested, __ATOMIC_ACQUIRE) || mIoDevice->IoDevice::getScanState() != SS_RUNNING;
+
+		unsigned long long backlog = mIoDevice->unreadScanCount(mScanReadCount);
+
+		if(backlog == 0)
+		{
+			if(scanDone)
+				break;
+
+			continue;
+		}
+
+		{
+			UlLock lock(mStatusMutex);
+
+			if(backlog > mStatus.maxBacklog)
+				mStatus.maxBacklog = backlog;
+
+			if(mIoDevice->mScanInfo.recycle && backlog > bufferScans / 2)
+				mStatus.backPressureCount++;
+		}
+
+		while(backlog)
+		{
+			if(mSegment == NULL && !openSegment())
+			{
+				error = true;
+				break;
+			}
+
+			unsigned long long scanCount = std::min(backlog, mScansPerSegment - mSegmentScanCount);
+
+			if(!mIoDevice->copyScanData(mScanReadCount, scanCount, mSegmentData + mSegmentScanCount * mScanSize))
+			{
+				// the scan overwrote data that was not written yet, continue with the newest data
+				unsigned long long newestScan = mIoDevice->totalScanSamplesTransferred() / mIoDevice->scanChanCount();
+
+				{
+					UlLock lock(mStatusMutex);
+					mStatus.overrunCount++;
+					mStatus.scansLost += newestScan - mScanReadCount;
+				}
+
+				mScanReadCount = newestScan;
+
+				// scans in the segment are contiguous, start a new one after the gap
+				closeSegment();
+				break;
+			}
+
+			mScanReadCount += scanCount;
+			mSegmentScanCount += scanCount;
+			backlog -= scanCount;
+
+			// readers of a segment that is being written trust scanCount, the data must be in place first
+			__atomic_thread_fence(__ATOMIC_RELEASE);
+			mSegment->scanCount = mSegmentScanCount;
+
+			{
+				UlLock lock(mStatusMutex);
+				mStatus.scansWritten += scanCount;
+			}
+
+			if(mSegmentScanCount == mScansPerSegment)
+				closeSegment();
+		}
+	}
+
+	closeSegment();
+}
+
+bool ScanRecorder::openSegment()
+{
+	char fileName[1024];
+	snprintf(fileName, sizeof(fileName), "%s.%04u", mPathPrefix.c_str(), (unsigned int) (mSegmentNumber % mSegmentCount));
+
+	mSegmentFileSize = SEGMENT_HEADER_SIZE + mScansPerSegment * mScanSize;
+
+	int fd = open(fileName, O_RDWR | O_CREAT, 0644);
+
+	if(fd == -1)
+	{
+		setError(ERR_SCAN_RECORDER_IO);
+		return false;
+	}
+
+	// the segments of a previous recording are reused in place, allocating the blocks up front keeps
+	// the page faults of the mapping from waiting on the file system while data is streaming
+	int status = ftruncate(fd, mSegmentFileSize);
+
+#ifndef __APPLE__
+	if(!status)
+		status = posix_fallocate(fd, 0, mSegmentFileSize);
+#endif
+
+	void* segment = MAP_FAILED;
+
+	if(!status)
+		segment = mmap(NULL, mSegmentFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	close(fd);
+
+	if(segment == MAP_FAILED)
+	{
+		setError(ERR_SCAN_RECORDER_IO);
+		return false;
+	}
+
+	madvise(segment, mSegmentFileSize, MADV_SEQUENTIAL);
+
+	mSegment = (SegmentHeader*) segment;
+	mSegmentData = (unsigned char*) segment + SEGMENT_HEADER_SIZE;
+	mSegmentScanCount = 0;
+
+	memset(mSegment, 0, SEGMENT_HEADER_SIZE);
+
+	memcpy(mSegment->magic, "ULDAQREC", sizeof(mSegment->magic));
+	mSegment->version = SEGMENT_VERSION;
+	mSegment->headerSize = SEGMENT_HEADER_SIZE;
+	mSegment->functionType = mIoDevice->mScanInfo.functionType;
+	mSegment->chanCount = mIoDevice->mScanInfo.chanCount;
+	mSegment->sampleSize = mIoDevice->scanDataBufferSampleSize();
+	mSegment->dataType = mIoDevice->mScanInfo.dataBufferType;
+	mSegment->flags = mIoDevice->mScanInfo.flags;
+	mSegment->rate = mIoDevice->actualScanRate();
+	mSegment->startTime = mStartTime;
+	mSegment->segmentNumber = mSegmentNumber;
+	mSegment->firstScan = mScanReadCount;
+	mSegment->scanCapacity = mScansPerSegment;
+
+	for(unsigned int i = 0; i < mIoDevice->mScanInfo.chanCount && i < MAX_CHAN_COUNT; i++)
+	{
+		if(i < mChanDescriptors.size())
+		{
+			mSegment->chans[i].channel = mChanDescriptors[i].channel;
+			mSegment->chans[i].type = mChanDescriptors[i].type;
+			mSegment->chans[i].range = mChanDescriptors[i].range;
+		}
+
+		mSegment->chans[i].slope = mIoDevice->mScanInfo.calCoefs[i].slope;
+		mSegment->chans[i].offset = mIoDevice->mScanInfo.calCoefs[i].offset;
+		mSegment->chans[i].customSlope = mIoDevice->mScanInfo.customScales[i].slope;
+		mSegment->chans[i].customOffset = mIoDevice->mScanInfo.customScales[i].offset;
+	}
+
+	mSegmentNumber++;
+
+	return true;
+}
+
+void ScanRecorder::closeSegment()
+{
+	if(mSegment)
+	{
+		// start the write-back of the completed segment, the next one is filled meanwhile
+		msync(mSegment, mSegmentFileSize, MS_ASYNC);
+		munmap(mSegment, mSegmentFileSize);
+
+		mSegment = NULL;
+		mSegmentData = NULL;
+
+		UlLock lock(mStatusMutex);
+		mStatus.segmentsWritten++;
+	}
+}
+
+} /* namespace ul */
@@ -0,0 +1,114 @@
+/*
+ * ScanRecorder.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef SCANRECORDER_H_
+#define SCANRECORDER_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "ul_internal.h"
+#include "./utility/UlLock.h"
+
+namespace ul
+{
+
+class IoDevice;
+
+// streams the scan buffer of an input scan to a ring of preallocated, memory-mapped segment files.
+// The recorder keeps its own read position in the scan buffer, so it does not slow down the transfer
+// thread and does not interfere with the ScanRead functions
+class UL_LOCAL ScanRecorder
+{
+public:
+	ScanRecorder(const std::string& pathPrefix, unsigned int segmentCount, unsigned long long segmentSize);
+	virtual ~ScanRecorder();
+
+	void setChanDescriptors(const std::vector<DaqInChanDescriptor>& chanDescriptors);
+
+	// called when the scan starts running, the previous recording must have finished
+	void start(IoDevice* ioDevice);
+	// called by the transfer thread once the scan is done, the recorder writes the remaining scans and exits
+	void requestStop(const IoDevice* ioDevice);
+	void stop();
+	bool isRecording() const;
+	const IoDevice* ioDevice() const { return mIoDevice;}
+
+	void getStatus(ScanRecorderStatus* status) const;
+
+private:
+	static void* recorderThread(void* arg);
+	void record();
+
+	bool openSegment();
+	void closeSegment();
+
+	void setError(UlError err);
+
+private:
+	// bump the version when the layout of SegmentHeader changes
+	enum {SEGMENT_VERSION = 1, SEGMENT_HEADER_SIZE = 8192, MAX_CHAN_COUNT = 128};
+
+	struct SegmentChan
+	{
+		int32_t channel;
+		int32_t type;			// DaqInChanType
+		int32_t range;
+		int32_t reserved;
+		double slope;
+		double offset;
+		double customSlope;
+		double customOffset;
+	};
+
+	// the data of the segment starts at SEGMENT_HEADER_SIZE, scanCount is updated as scans are written
+	struct SegmentHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t headerSize;
+		uint32_t functionType;
+		uint32_t chanCount;
+		uint32_t sampleSize;
+		uint32_t dataType;		// ScanDataBufferType
+		uint64_t flags;
+		double rate;
+		uint64_t startTime;		// ns since the epoch
+		uint64_t segmentNumber;	// counts on across the scans recorded since the recorder was enabled
+		uint64_t firstScan;
+		uint64_t scanCapacity;
+		uint64_t scanCount;
+		SegmentChan chans[MAX_CHAN_COUNT];
+	};
+
+	std::string mPathPrefix;
+	unsigned int mSegmentCount;
+	unsigned long long mSegmentSize;
+	std::vector<DaqInChanDescriptor> mChanDescriptors;
+
+	IoDevice* mIoDevice;
+	pthread_t mRecorderThreadHandle;
+	bool mStopRequested;
+
+	unsigned long long mStartTime;
+	unsigned long long mScanReadCount;
+	unsigned int mScanSize;
+	unsigned long long mScansPerSegment;
+
+	unsigned long long mSegmentNumber;
+	unsigned long long mSegmentFileSize;
+	SegmentHeader* mSegment;
+	unsigned char* mSegmentData;
+	unsigned long long mSegmentScanCount;
+
+	mutable pthread_mutex_t mStatusMutex;
+	ScanRecorderStatus mStatus;
+};
+
+} /* namespace ul */
+
+#endif /* SCANRECORDER_H_ */
@@ -9,6 +9,8 @@
 #include "DaqDeviceId.h"
 #include "DaqDeviceManager.h"
 #include "./usb/UsbDaqDevice.h"
+#include "./usb/UsbDeviceInventory.h"
+#include "./usb/UsbSimDevice.h"
 #include "./hid/HidDaqDevice.h"
 #include "./usb/Usb1208fsPlus.h"
 #include "./usb/Usb1608fsPlus.h"
@@ -100,7 +102,11 @@ std::vector<DaqDeviceDescriptor> UlDaqDeviceManager::getDaqDeviceInventory(DaqDe
 
 	std::vector<DaqDeviceDescriptor> daqDeviceList;
 
-	if(InterfaceType & USB_IFC)
+	if((InterfaceType & USB_IFC) && UsbDeviceInventory::isEnabled())
+	{
+		daqDeviceList = UsbDeviceInventory::getDaqDevices();
+	}
+	else if(InterfaceType & USB_IFC)
 	{
 		Fx2FwLoader::prepareHardware();
 		DtFx2FwLoader::prepareHardware();
@@ -116,6 +122,14 @@ std::vector<DaqDeviceDescriptor> UlDaqDeviceManager::getDaqDeviceInventory(DaqDe
 			daqDeviceList.push_back(hidDaqDeviceList[i]);
 	}
 
+	if(InterfaceType & USB_IFC)
+	{
+		std::vector<DaqDeviceDescriptor> simDaqDeviceList = UsbSimDevice::getDaqDevices();
+
+		for(unsigned int i = 0; i < simDaqDeviceList.size(); i++)
+			daqDeviceList.push_back(simDaqDeviceList[i]);
+	}
+
 	if(InterfaceType & ETHERNET_IFC)
 	{
 		std::vector<DaqDeviceDescriptor> netDaqDeviceList = NetDiscovery::findDaqDevices();
@@ -7,6 +7,7 @@
 #include "HidDaqDevice.h"
 #include "../DaqDeviceManager.h"
 #include "../utility/Endian.h"
+#include "../utility/ConfigShadow.h"
 
 #include <stdlib.h>
 
@@ -147,6 +148,8 @@ void HidDaqDevice::connect()
 
 	mConnected = true;
 
+	configShadow().invalidate();
+
 	//mCurrentSuspendCount = SuspendMonitor::getCurrentSystemSuspendCount();
 
 	initilizeHardware();
@@ -466,6 +469,41 @@ void HidDaqDevice::queryCmd(unsigned char cmd, unsigned char param1, unsigned ch
 	*data = inData.data;
 }
 
+void HidDaqDevice::sendConfigCmd(unsigned char getCmd, unsigned char setCmd, unsigned char param1, unsigned char param2, unsigned char value) const
+{
+	unsigned long long key = ConfigShadow::key(getCmd, param1, param2);
+
+	if(configShadow().matches(key, &value, sizeof(value)))
+		return;
+
+	try
+	{
+		sendCmd(setCmd, param1, param2, value);
+	}
+	catch(UlException& e)
+	{
+		configShadow().remove(key);
+		throw e;
+	}
+
+	configShadow().update(key, &value, sizeof(value));
+}
+
+unsigned char HidDaqDevice::queryConfigCmd(unsigned char getCmd, unsigned char param1, unsigned char param2) const
+{
+	unsigned long long key = ConfigShadow::key(getCmd, param1, param2);
+	unsigned char value = 0;
+
+	if(!configShadow().read(key, &value, sizeof(value)))
+	{
+		queryCmd(getCmd, param1, param2, &value);
+
+		configShadow().update(key, &value, sizeof(value));
+	}
+
+	return value;
+}
+
 void HidDaqDevice::queryCmd(unsigned char cmd, unsigned short* data, unsigned int timeout) const
 {
 	size_t outLength = 1;
@@ -626,6 +664,8 @@ void HidDaqDevice::sendRawCmd(const unsigned char *data, size_t* length) const
 
 UlError HidDaqDevice::send(const unsigned char *data, size_t* length) const
 {
+	TraceCmd trace(Trace::CMD_HID, data[0]);
+
 	UlError err = ERR_NO_ERROR;
 	int sent = 0;
 
@@ -665,6 +705,8 @@ void HidDaqDevice::queryRawCmd(const unsigned char *outdata, size_t outLength, u
 
 UlError HidDaqDevice::query(const unsigned char *outdata, size_t outLength, unsigned char *indata, size_t* inLength, unsigned int timeout) const
 {
+	TraceCmd trace(Trace::CMD_HID, outdata[0]);
+
 	UlError err = ERR_NO_ERROR;
 	int sent = 0;
 
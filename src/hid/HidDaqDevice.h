@@ -50,6 +50,11 @@ public:
 	unsigned int queryCmd(unsigned char cmd, unsigned char param1, unsigned char param2, unsigned char param3, unsigned char* dataBuffer, unsigned int dataBufferSize, unsigned int timeout = 2000) const;
 	unsigned int queryCmd(unsigned char cmd, unsigned short param1, unsigned char param2, unsigned char param3, unsigned char* dataBuffer, unsigned int dataBufferSize, unsigned int timeout = 2000) const;
 	void queryCmd(unsigned char cmd, unsigned char param1, unsigned char param2, float* data, unsigned int timeout = 2000) const;
+
+	// for one byte items read by getCmd and written by setCmd with the same parameters. The item is kept in the config
+	// shadow of the device, unchanged items are not sent and known items are not queried
+	void sendConfigCmd(unsigned char getCmd, unsigned char setCmd, unsigned char param1, unsigned char param2, unsigned char value) const;
+	unsigned char queryConfigCmd(unsigned char getCmd, unsigned char param1, unsigned char param2) const;
 	void sendRawCmd(const unsigned char *data, size_t* length) const;
 	void queryRawCmd(const unsigned char *outdata, size_t outLength, unsigned char *indata, size_t* inLength, unsigned int timeout = 2000) const;
 
@@ -233,7 +233,7 @@ AiChanType AiUsbTemp::getCfg_ChanType(int channel) const
 
 	unsigned char buf[4];
 
-	daqDev().queryCmd(CMD_GETITEM, adc, subItem, buf);
+	buf[0] = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 	unsigned char sensorType = buf[0];
 
@@ -278,7 +278,7 @@ SensorConnectionType AiUsbTemp::getCfg_SensorConnectionType(int channel) const
 
 		unsigned char buf[4];
 
-		daqDev().queryCmd(CMD_GETITEM, adc, subItem, buf);
+		buf[0] = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 		unsigned char sensorType = buf[0];
 
@@ -372,7 +372,7 @@ void AiUsbTemp::setCfg_ChanTcType(int channel, TcType tcType)
 	unsigned char subItem = SUBITEM_TC_TYPE + adcChan;
 	unsigned char tcCodeVal = tcCode(tcType);
 
-	daqDev().sendCmd(CMD_SETITEM, adc, subItem, tcCodeVal);
+	daqDev().sendConfigCmd(CMD_GETITEM, CMD_SETITEM, adc, subItem, tcCodeVal);
 }
 
 TcType AiUsbTemp::getCfg_ChanTcType(int channel) const
@@ -387,7 +387,7 @@ TcType AiUsbTemp::getCfg_ChanTcType(int channel) const
 
 	unsigned char buf[4];
 
-	daqDev().queryCmd(CMD_GETITEM, adc, subItem, buf);
+	buf[0] = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 	unsigned char tcCodeVal = buf[0];
 
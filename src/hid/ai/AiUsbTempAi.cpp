@@ -71,7 +71,7 @@ void AiUsbTempAi::initialize()
 			adcChan = chan % 2;
 			subItem = SUBITEM_CHAN_MODE + adcChan;
 
-			daqDev().queryCmd(CMD_GETITEM, adc, subItem, &modeCode);
+			modeCode = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 			mCurrentChanCfg[chan].inputMode = (AiInputMode) 0;
 
@@ -83,7 +83,7 @@ void AiUsbTempAi::initialize()
 
 			subItem = SUBITEM_CHAN_RANGE + adcChan;
 
-			daqDev().queryCmd(CMD_GETITEM, adc, subItem, &rangeCode);
+			rangeCode = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 			mCurrentChanCfg[chan].range = (Range) 0;
 
@@ -153,6 +153,56 @@ double AiUsbTempAi::aIn(int channel, AiInputMode inputMode, Range range, AInFlag
 	return data;
 }
 
+// the voltage channels are read with one CMD_AINSCAN command
+void AiUsbTempAi::aInSnapshot(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[])
+{
+	check_AInSnapshot_Args(lowChan, highChan, inputMode, range, flags, data);
+
+	if(lowChan < 4) // voltage channels
+		throw UlException(ERR_BAD_AI_CHAN);
+
+	bool chanCfgChanged = false;
+
+	for(int channel = lowChan; channel <= highChan; channel++)
+	{
+		if(mCurrentChanCfg[channel].inputMode != inputMode)
+		{
+			setInputMode(channel, inputMode);
+			chanCfgChanged = true;
+		}
+
+		if(mCurrentChanCfg[channel].range != range)
+		{
+			setRange(channel, range);
+			chanCfgChanged = true;
+		}
+	}
+
+	if(chanCfgChanged)
+		usleep(1000000);
+
+	int chanCount = highChan - lowChan + 1;
+	unsigned char startChan = lowChan;
+	unsigned char endChan = highChan;
+	unsigned char units = 0;
+
+	if(flags & AIN_FF_NOSCALEDATA)
+		units = 1;
+
+	float fData[8];
+	memset(fData, 0 , 8 * sizeof(float));
+
+	daqDev().queryCmd(CMD_AINSCAN, startChan, endChan, units, (unsigned char*) fData, chanCount * sizeof(float));
+
+	for(int i = 0; i < chanCount; i++)
+	{
+		int channel = lowChan + i;
+
+		data[i] = mEndian.le_ptr_to_cpu_f32((unsigned char*) &fData[i]);
+		data[i] = mCustomScales[channel].slope * data[i] + mCustomScales[channel].offset;
+	}
+}
+
 void AiUsbTempAi::tIn(int channel, TempScale scale, TInFlag flags, double* data)
 {
 	check_TIn_Args(channel, scale, flags);
@@ -257,7 +307,7 @@ void AiUsbTempAi::setInputMode(int channel, AiInputMode mode)
 	unsigned char subItem = SUBITEM_CHAN_MODE + adcChan;
 	unsigned char modeCode = (mode == AI_SINGLE_ENDED) ? 1 : 0;
 
-	daqDev().sendCmd(CMD_SETITEM, adc, subItem, modeCode);
+	daqDev().sendConfigCmd(CMD_GETITEM, CMD_SETITEM, adc, subItem, modeCode);
 
 	mCurrentChanCfg[channel].inputMode = mode;
 }
@@ -268,7 +318,7 @@ void AiUsbTempAi::setRange(int channel, Range range)
 	unsigned char subItem = SUBITEM_CHAN_RANGE + adcChan;
 	unsigned char rangeCode = getRangeCode(range);
 
-	daqDev().sendCmd(CMD_SETITEM, adc, subItem, rangeCode);
+	daqDev().sendConfigCmd(CMD_GETITEM, CMD_SETITEM, adc, subItem, rangeCode);
 
 	mCurrentChanCfg[channel].range = range;
 }
@@ -388,7 +438,7 @@ AiChanType AiUsbTempAi::getCfg_ChanType(int channel) const
 
 		unsigned char buf[4];
 
-		daqDev().queryCmd(CMD_GETITEM, adc, subItem, buf);
+		buf[0] = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 		unsigned char sensorType = buf[0];
 
@@ -418,7 +468,7 @@ AiChanType AiUsbTempAi::getCfg_ChanType(int channel) const
 		unsigned char subItem = SUBITEM_CHAN_MODE + adcChan;
 		unsigned char modeCode = 0;
 
-		daqDev().queryCmd(CMD_GETITEM, adc, subItem, &modeCode);
+		modeCode = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 		if(modeCode == 0x02)
 			chanType = AI_DISABLED;
@@ -448,7 +498,7 @@ SensorConnectionType AiUsbTempAi::getCfg_SensorConnectionType(int channel) const
 
 		unsigned char buf[4];
 
-		daqDev().queryCmd(CMD_GETITEM, adc, subItem, buf);
+		buf[0] = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 		unsigned char sensorType = buf[0];
 
@@ -543,7 +593,7 @@ void AiUsbTempAi::setCfg_ChanTcType(int channel, TcType tcType)
 	unsigned char subItem = SUBITEM_TC_TYPE + adcChan;
 	unsigned char tcCodeVal = tcCode(tcType);
 
-	daqDev().sendCmd(CMD_SETITEM, adc, subItem, tcCodeVal);
+	daqDev().sendConfigCmd(CMD_GETITEM, CMD_SETITEM, adc, subItem, tcCodeVal);
 }
 
 TcType AiUsbTempAi::getCfg_ChanTcType(int channel) const
@@ -558,7 +608,7 @@ TcType AiUsbTempAi::getCfg_ChanTcType(int channel) const
 
 	unsigned char buf[4];
 
-	daqDev().queryCmd(CMD_GETITEM, adc, subItem, buf);
+	buf[0] = daqDev().queryConfigCmd(CMD_GETITEM, adc, subItem);
 
 	unsigned char tcCodeVal = buf[0];
 
@@ -21,6 +21,7 @@ public:
 	virtual void initialize();
 
 	virtual double aIn(int channel, AiInputMode inputMode, Range range, AInFlag flags);
+	virtual void aInSnapshot(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]);
 	virtual void tIn(int channel, TempScale scale, TInFlag flags, double* data);
 	virtual void tInArray(int lowChan, int highChan, TempScale scale, TInArrayFlag flags, double data[]);
 
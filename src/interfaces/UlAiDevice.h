@@ -23,7 +23,10 @@ public:
 	virtual UlAiConfig& getAiConfig() = 0;
 
 	virtual double aIn(int channel, AiInputMode mode, Range range, AInFlag flags) = 0;
+	virtual void aInSnapshot(int lowChan, int highChan, AiInputMode mode, Range range, AInFlag flags, double data[]) = 0;
 	virtual double aInScan(int lowChan, int highChan, AiInputMode mode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[]) = 0;
+	virtual double aInScanRaw(int lowChan, int highChan, AiInputMode mode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, void* data) = 0;
+	virtual void getScanCoefs(double slopes[], double offsets[], unsigned int* numChans) const = 0;
 	virtual void aInLoadQueue(AiQueueElement queue[], unsigned int numElements) = 0;
 	virtual void setTrigger(TriggerType type, int trigChan, double level, double variance, unsigned int retriggerCount) = 0;
 
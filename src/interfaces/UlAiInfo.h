@@ -27,6 +27,7 @@ public:
 	virtual double getMaxBurstThroughput() const = 0;
 	virtual double getMaxBurstRate()const = 0;
 	virtual int getFifoSize() const = 0;
+	virtual int getSampleSize() const = 0;
 	virtual ScanOption getScanOptions() const = 0;
 	virtual bool hasPacer() const = 0;
 	virtual AiChanType getChanTypes() const = 0;
@@ -23,6 +23,31 @@ public:
 	virtual long long getMemUnlockCode() = 0;
 	virtual void reset() = 0;
 
+	virtual void setScanXferCount(unsigned int index, long long count) = 0;
+	virtual long long getScanXferCount(unsigned int index) = 0;
+	virtual void setScanStageSize(unsigned int index, long long size) = 0;
+	virtual long long getScanStageSize(unsigned int index) = 0;
+	virtual void setScanStageLatency(unsigned int index, long long latency) = 0;
+	virtual long long getScanStageLatency(unsigned int index) = 0;
+	virtual void setScanPipeline(long long pipeline) = 0;
+	virtual long long getScanPipeline() = 0;
+	virtual void setScanConversionThreads(long long threadCount) = 0;
+	virtual long long getScanConversionThreads() = 0;
+	virtual long long getHwInitProgress() = 0;
+
+	virtual void setEventDelivery(long long delivery) = 0;
+	virtual long long getEventDelivery() = 0;
+	virtual void setEventThreadCpu(long long cpu) = 0;
+	virtual long long getEventThreadCpu() = 0;
+	virtual void resetEventStats() = 0;
+	virtual long long getEventStat(unsigned int index) = 0;
+
+	virtual void setUsbXferPriority(long long niceValue) = 0;
+	virtual long long getUsbXferPriority() = 0;
+	virtual void setUsbXferRtPriority(long long priority) = 0;
+	virtual long long getUsbXferRtPriority() = 0;
+	virtual void setUsbXferCpu(long long cpu) = 0;
+	virtual long long getUsbXferCpu() = 0;
 
 	virtual void getVersionStr(DevVersionType verType, char* verStr, unsigned int* maxStrLen) = 0;
 	virtual bool hasExp() = 0;
@@ -7,19 +7,26 @@
 #include "../DaqDeviceManager.h"
 #include "../DaqEventHandler.h"
 #include "../utility/UlLock.h"
+#include "../utility/ConfigShadow.h"
 #include "NetScanTransferIn.h"
 
 #include <numeric>
+#include <limits.h>
 
 namespace ul
 {
 
+int NetDaqDevice::mScanBusyPoll = 0;
+
 NetDaqDevice::NetDaqDevice(const DaqDeviceDescriptor& daqDeviceDescriptor) : DaqDevice(daqDeviceDescriptor)
 {
 	mConnectionCode = 0;
 	mConnectionTimeout = DEFAULT_CONNECTION_TO;
 	mIoTimeout = DEFAULT_IO_TO;
 
+	mCmdFrameId = 0;
+	mCmdRxCount = 0;
+
 	UlLock::initMutex(mConnectionMutex, PTHREAD_MUTEX_RECURSIVE);
 	UlLock::initMutex(mUdpMutex, PTHREAD_MUTEX_RECURSIVE);
 	UlLock::initMutex(mTcpCmdMutex, PTHREAD_MUTEX_RECURSIVE);
@@ -59,6 +66,8 @@ void NetDaqDevice::connect()
 
 	mConnected = true;
 
+	configShadow().invalidate();
+
 	initilizeHardware();
 
 	initializeIoDevices();
@@ -104,6 +113,8 @@ void NetDaqDevice::closeSockets()
 		mSockets.tcpCmd = -1;
 	}
 
+	mCmdRxCount = 0;
+
 	if(mSockets.tcpData != -1)
 	{
 		shutdown(mSockets.tcpData, SHUT_RDWR);
@@ -123,44 +134,66 @@ void NetDaqDevice::establishConnection()
 
 	if(discoveryInfo.valid)
 	{
-		if(NetDiscovery::isNetIfcAvaiable(discoveryInfo.ifcName))
-		{
-			NetDiscovery::NetIfcDesc ifcDesc = NetDiscovery::getNetIfcDescs(discoveryInfo.ifcName)[0];
+		UlError err = initConnection(discoveryInfo);
 
-			UlError err = initUdpSocket(ifcDesc, discoveryInfo);
+		// the cached discovery info is used without a new discovery, the DHCP server may have assigned
+		// a new address to the device since it was discovered, look for the device by its mac address
+		if(err && err != ERR_NET_IFC_UNAVAILABLE)
+		{
+			NetDiscovery::NetDiscoveryInfo info = NetDiscovery::rediscover(discoveryInfo);
 
-			if(!err)
+			if(info.valid && (info.ipAddr.s_addr != discoveryInfo.ipAddr.s_addr || info.ifcName != discoveryInfo.ifcName))
 			{
-				// make sure the mac address of the connected device match what we are looking for. This check is performed
-				// to make sure that the DHCP server has not assigned the ip address of the target device to another device since
-				// user has called getDeviceInventory
-				if(isValidDevice(discoveryInfo.macAddr))
-				{
-					err = initTcpCmdSocket(ifcDesc, discoveryInfo);
+				UL_LOG("device " << info.macAddr << " found at " << inet_ntoa(info.ipAddr));
 
-					if(!err)
-					{
-						mNetDiscoveryInfo = discoveryInfo;
-						mNetIfcDesc = ifcDesc;
-						mRawFwVersion = discoveryInfo.fwVer;
-					}
-				}
-				else
-					err = ERR_NET_CONNECTION_FAILED;
+				err = initConnection(info);
 			}
+		}
 
-			if(err)
+		if(err)
+			throw UlException(err);
+	}
+	else
+		throw UlException(ERR_DEV_NOT_FOUND);
+}
+
+UlError NetDaqDevice::initConnection(const NetDiscovery::NetDiscoveryInfo& discoveryInfo)
+{
+	UlError err = ERR_NO_ERROR;
+
+	if(NetDiscovery::isNetIfcAvaiable(discoveryInfo.ifcName))
+	{
+		NetDiscovery::NetIfcDesc ifcDesc = NetDiscovery::getNetIfcDescs(discoveryInfo.ifcName)[0];
+
+		err = initUdpSocket(ifcDesc, discoveryInfo);
+
+		if(!err)
+		{
+			// make sure the mac address of the connected device match what we are looking for. This check is performed
+			// to make sure that the DHCP server has not assigned the ip address of the target device to another device since
+			// user has called getDeviceInventory
+			if(isValidDevice(discoveryInfo.macAddr))
 			{
-				closeSockets();
-				throw UlException(err);
+				err = initTcpCmdSocket(ifcDesc, discoveryInfo);
+
+				if(!err)
+				{
+					mNetDiscoveryInfo = discoveryInfo;
+					mNetIfcDesc = ifcDesc;
+					mRawFwVersion = discoveryInfo.fwVer;
+				}
 			}
+			else
+				err = ERR_NET_CONNECTION_FAILED;
 		}
-		else
-			throw UlException(ERR_NET_IFC_UNAVAILABLE);
 
+		if(err)
+			closeSockets();
 	}
 	else
-		throw UlException(ERR_DEV_NOT_FOUND);
+		err = ERR_NET_IFC_UNAVAILABLE;
+
+	return err;
 }
 
 UlError NetDaqDevice::initUdpSocket(const NetDiscovery::NetIfcDesc& ifcDesc, const NetDiscovery::NetDiscoveryInfo& discoveryInfo) const
@@ -304,6 +337,18 @@ UlError NetDaqDevice::initTcpDataSocket(int timeout /* ms */) const
 		 if(setsockopt(mSockets.tcpData, SOL_SOCKET, SO_SNDTIMEO, &to, sizeof(to)) == -1)
 			 print_setsockopt_error(errno, __FILE__, __LINE__);
 
+		 // the receive buffer must be set before connect() so the TCP window scale is negotiated for it, the kernel
+		 // limits it to net.core.rmem_max
+		 int rcvBufSize = DATA_SOCKET_RCVBUF_SIZE;
+		 if(setsockopt(mSockets.tcpData, SOL_SOCKET, SO_RCVBUF, &rcvBufSize, sizeof(rcvBufSize)) == -1)
+			 print_setsockopt_error(errno, __FILE__, __LINE__);
+
+#ifdef SO_BUSY_POLL
+		 int busyPoll = mScanBusyPoll;
+		 if(busyPoll > 0 && setsockopt(mSockets.tcpData, SOL_SOCKET, SO_BUSY_POLL, &busyPoll, sizeof(busyPoll)) == -1)
+			 print_setsockopt_error(errno, __FILE__, __LINE__);
+#endif
+
 		if(bind(mSockets.tcpData, (sockaddr*) &mNetIfcDesc.addr, sizeof(sockaddr)) == 0)
 		{
 			sockaddr_in targetAddr = {0};
@@ -478,33 +523,152 @@ unsigned int NetDaqDevice::queryCmd(unsigned char cmd, unsigned char* sendBuf, u
 	return bytesReceived;
 }
 
+void NetDaqDevice::sendConfigCmd(unsigned char readCmd, unsigned char writeCmd, unsigned char* config, unsigned short configLen) const
+{
+	unsigned long long key = ConfigShadow::key(readCmd);
+
+	if(configShadow().matches(key, config, configLen))
+		return;
+
+	try
+	{
+		queryCmd(writeCmd, config, configLen);
+	}
+	catch(UlException& e)
+	{
+		configShadow().remove(key);
+		throw e;
+	}
+
+	configShadow().update(key, config, configLen);
+}
+
+void NetDaqDevice::queryConfigCmd(unsigned char readCmd, unsigned char* config, unsigned short configLen) const
+{
+	unsigned long long key = ConfigShadow::key(readCmd);
+
+	if(configShadow().read(key, config, configLen))
+		return;
+
+	unsigned int bytesReceived = queryCmd(readCmd, NULL, 0, config, configLen);
+
+	// short replies are not shadowed, the caller handles them as before
+	if(bytesReceived == configLen)
+		configShadow().update(key, config, configLen);
+}
+
+void NetDaqDevice::queryCmds(NetCmd cmds[], unsigned int count) const
+{
+	UlError err = queryTcpBatch(cmds, count, mIoTimeout);
+
+	if(err)
+		throw UlException(err);
+}
+
 UlError NetDaqDevice::queryTcp(unsigned char cmd, unsigned char* sendBuf, unsigned short sendBufLen, unsigned char* receiveBuf, unsigned short receiveBufLen, unsigned short* bytesReceived, unsigned char* status, int timeout) const
 {
 	FnLog log("NetDaqDevice::query");
+	TraceCmd trace(Trace::CMD_NET, cmd);
+
+	NetCmd netCmd;
+	netCmd.cmd = cmd;
+	netCmd.sendBuf = sendBuf;
+	netCmd.sendBufLen = sendBufLen;
+	netCmd.receiveBuf = receiveBuf;
+	netCmd.receiveBufLen = receiveBufLen;
+
+	UlError err = queryTcpBatch(&netCmd, 1, timeout);
+
+	if(bytesReceived)
+		*bytesReceived = netCmd.bytesReceived;
+
+	if(status)
+		*status = netCmd.status;
+
+	return err;
+}
+
+// the commands are sent without waiting for the replies of the previous ones, up to MAX_CMDS_IN_FLIGHT at a time.
+// The device processes the commands in order, so the replies are matched to the frame ids in the order they were sent
+UlError NetDaqDevice::queryTcpBatch(NetCmd cmds[], unsigned int count, int timeout) const
+{
+	FnLog log("NetDaqDevice::queryTcpBatch");
 
 	UlError err = ERR_NO_ERROR;
 
 	UlLock lock(mTcpCmdMutex);
 
-	static unsigned char frameId = 0;
+	for(unsigned int i = 0; i < count; i++)
+	{
+		cmds[i].bytesReceived = 0;
+		cmds[i].status = 0;
+	}
 
 	int retry = 2;
+	unsigned int received = 0;
 
 	do
 	{
-		frameId += 1;
+		err = ERR_NO_ERROR;
 
-		err = sendFrame(cmd, frameId, sendBuf, sendBufLen, timeout);
+		// frame id of cmds[received], the ids of the following commands are consecutive
+		unsigned char firstFrameId = mCmdFrameId + 1;
+		unsigned int firstCmd = received;
+		unsigned int sent = received;
 
-		if(!err)
+		// index of the first command whose reply is still expected
+		unsigned int unread = received;
+
+		while(received < count && !err)
 		{
-			err = receiveFrame(cmd, frameId, receiveBuf, receiveBufLen, bytesReceived, status, timeout);
+			while(sent < count && sent - received < MAX_CMDS_IN_FLIGHT && !err)
+			{
+				err = sendFrame(cmds[sent].cmd, ++mCmdFrameId, cmds[sent].sendBuf, cmds[sent].sendBufLen, timeout);
 
-			if(err == ERR_BAD_NET_FRAME)
+				if(!err)
+					sent++;
+			}
+
+			if(!err)
 			{
-				clearSocketInputQueue();
-				retry--;
+				NetCmd& netCmd = cmds[received];
+				unsigned char frameId = firstFrameId + (received - firstCmd);
+
+				err = receiveFrame(netCmd.cmd, frameId, netCmd.receiveBuf, netCmd.receiveBufLen, &netCmd.bytesReceived, &netCmd.status, timeout);
+
+				if(!err)
+					received++;
+
+				// the reply was read but did not fit in the buffer
+				unread = (err == ERR_BAD_BUFFER_SIZE) ? received + 1 : received;
+			}
+		}
+
+		// the replies to the commands still in flight would be taken for the replies to the next commands. While the
+		// connection works they are read and discarded, after a timeout or a connection failure the socket is cleared
+		if(err && err != ERR_BAD_NET_FRAME && unread < sent)
+		{
+			UlError drainErr = ERR_BAD_NET_FRAME;
+
+			if(err == ERR_BAD_BUFFER_SIZE)
+			{
+				for(drainErr = ERR_NO_ERROR; unread < sent && !drainErr; unread++)
+				{
+					unsigned char frameId = firstFrameId + (unread - firstCmd);
+
+					drainErr = receiveFrame(cmds[unread].cmd, frameId, NULL, USHRT_MAX, NULL, NULL, timeout);
+				}
 			}
+
+			if(drainErr)
+				clearSocketInputQueue();
+		}
+
+		// the commands without a reply are sent again
+		if(err == ERR_BAD_NET_FRAME)
+		{
+			clearSocketInputQueue();
+			retry--;
 		}
 	}
 	while(err == ERR_BAD_NET_FRAME && retry > 0);
@@ -519,15 +683,6 @@ UlError NetDaqDevice::sendFrame(unsigned char cmd, unsigned char frameId, unsign
 
 	if(mConnected)
 	{
-		/*if(mSockets.tcpCmd == -1)
-		{
-			NetDiscovery::NetIfcDesc ifcDesc = NetDiscovery::getNetIfcDescs(mNetDiscoveryInfo.ifcName)[0];
-			err = initTcpCmdSocket(ifcDesc, mNetDiscoveryInfo);
-
-			if(err)
-				return err;
-		}*/
-
 		int frameSize = sizeof(NetFrame) + bufLen; // no need to subtract one (checksum is not member of the NET_FRAME structure)
 		int chksumIndex = frameSize - 1;
 
@@ -549,10 +704,6 @@ UlError NetDaqDevice::sendFrame(unsigned char cmd, unsigned char frameId, unsign
 
 		frameBuf[chksumIndex] = chksum;
 
-		timeval to = NetDiscovery::convertTimeout(timeout);
-		if(setsockopt(mSockets.tcpCmd, SOL_SOCKET, SO_SNDTIMEO, &to, sizeof(to)) == -1)
-			 print_setsockopt_error(errno, __FILE__, __LINE__);
-
 		int flag = 0;
 
 #ifndef __APPLE__
@@ -560,7 +711,10 @@ UlError NetDaqDevice::sendFrame(unsigned char cmd, unsigned char frameId, unsign
 		flag = MSG_NOSIGNAL;
 #endif
 
-		int sent = send(mSockets.tcpCmd, frameBuf, frameSize, flag);
+		int sent = -1;
+
+		if(waitForSocket(mSockets.tcpCmd, POLLOUT, getDeadline(timeout)) > 0)
+			sent = send(mSockets.tcpCmd, frameBuf, frameSize, flag);
 
 		if(sent != frameSize)
 		{
@@ -583,35 +737,37 @@ UlError NetDaqDevice::receiveFrame(unsigned char cmd, unsigned char frameId, uns
 
 	if(mConnected)
 	{
-		unsigned char frameBuf[MAX_SEND_FRAME_SIZE];
-		NetFrame* frame = (NetFrame*) frameBuf;
-		//unsigned int frameBufLen = sizeof(frameBuf);
-		int frameSize = 0;
-
 		if(bytesReceived)
 			*bytesReceived = 0;
 
 		if(status)
 			*status = 0;
 
-		timeval to = NetDiscovery::convertTimeout(timeout);
-		if(setsockopt(mSockets.tcpCmd, SOL_SOCKET, SO_RCVTIMEO, &to, sizeof(to)) == -1)
-			 print_setsockopt_error(errno, __FILE__, __LINE__);
-
-		NetFrame frameHeader;
+		unsigned long long deadline = getDeadline(timeout);
 
-		// peek at the frame header to obtain the actual frame size
-		int received = recv(mSockets.tcpCmd, (char*)&frameHeader, sizeof(NetFrame), MSG_PEEK | MSG_WAITALL);
+		// the frame header is followed by the data and the checksum
+		err = fillCmdRxBuffer(sizeof(NetFrame), deadline);
 
-		if(received == sizeof(frameHeader))
+		if(!err)
 		{
-			frameSize = frameHeader.count + sizeof(NetFrame);
+			NetFrame frameHeader;
+			memcpy(&frameHeader, mCmdRxBuffer, sizeof(NetFrame));
 
-			received = recv(mSockets.tcpCmd, frameBuf, frameSize, MSG_WAITALL);
+			unsigned int frameSize = Endian::le_ui16_to_cpu(frameHeader.count) + sizeof(NetFrame);
 
-			if(received == frameSize)
+			if(frameSize > sizeof(mCmdRxBuffer))
 			{
-				unsigned char chksum = std::accumulate(&frameBuf[0], &frameBuf[received], 0);
+				UL_LOG("Invalid frame size!!!!");
+				return ERR_BAD_NET_FRAME;
+			}
+
+			err = fillCmdRxBuffer(frameSize, deadline);
+
+			if(!err)
+			{
+				NetFrame* frame = (NetFrame*) mCmdRxBuffer;
+				unsigned short dataCount = Endian::le_ui16_to_cpu(frame->count);
+				unsigned char chksum = std::accumulate(&mCmdRxBuffer[0], &mCmdRxBuffer[frameSize], 0);
 
 				if(chksum != 0xff)
 				{
@@ -628,7 +784,7 @@ UlError NetDaqDevice::receiveFrame(unsigned char cmd, unsigned char frameId, uns
 					UL_LOG("Invalid frame ID!!!!");
 					err = ERR_BAD_NET_FRAME;
 				}
-				else if (frame->count > dataBufLen)
+				else if (dataCount > dataBufLen)
 				{
 					UL_LOG("Invalid buffer size!!!!");
 					err = ERR_BAD_BUFFER_SIZE;
@@ -637,10 +793,10 @@ UlError NetDaqDevice::receiveFrame(unsigned char cmd, unsigned char frameId, uns
 				{
 					if(dataBuf)
 					{
-						memcpy(dataBuf, frame->data, frame->count);
+						memcpy(dataBuf, frame->data, dataCount);
 
 						if(bytesReceived) // if the pointer is not null set its value
-							*bytesReceived = frame->count;
+							*bytesReceived = dataCount;
 					}
 
 					if(status)
@@ -649,31 +805,16 @@ UlError NetDaqDevice::receiveFrame(unsigned char cmd, unsigned char frameId, uns
 					if(frame->status)
 						UL_LOG("receiveFrame failed, frame status: " << frame->status);
 				}
-			}
-			else
-			{
-				err = ERR_DEAD_DEV;
 
-				if(received == -1)
-					UL_LOG("receiveFrame failed, recv() error: " << strerror(errno));
-			}
-		}
-		else
-		{
-			if(received == -1)
-			{
-				UL_LOG("receiveFrame failed, recv() error: " << strerror(errno));
-
-				if(isDevSocketConnected())
-				{
-					err = ERR_NET_TIMEOUT;
-				}
-				else
-				{
-					err = ERR_DEV_NOT_CONNECTED;
-				}
+				// the replies to the commands that follow may already be in the buffer
+				mCmdRxCount -= frameSize;
+				memmove(mCmdRxBuffer, &mCmdRxBuffer[frameSize], mCmdRxCount);
 			}
+			else if(err == ERR_NET_TIMEOUT)
+				err = ERR_DEAD_DEV;
 		}
+		else if(err == ERR_NET_TIMEOUT && !isDevSocketConnected())
+			err = ERR_DEV_NOT_CONNECTED;
 	}
 	else
 		err = ERR_DEV_NOT_CONNECTED;
@@ -681,6 +822,74 @@ UlError NetDaqDevice::receiveFrame(unsigned char cmd, unsigned char frameId, uns
 	return err;
 }
 
+// reads from the command socket until the receive buffer holds at least size bytes
+UlError NetDaqDevice::fillCmdRxBuffer(unsigned int size, unsigned long long deadline) const
+{
+	while(mCmdRxCount < size)
+	{
+		int ret = waitForSocket(mSockets.tcpCmd, POLLIN, deadline);
+
+		if(ret == 0)
+			return ERR_NET_TIMEOUT;
+
+		if(ret < 0)
+			return ERR_DEV_NOT_CONNECTED;
+
+		int received = recv(mSockets.tcpCmd, &mCmdRxBuffer[mCmdRxCount], sizeof(mCmdRxBuffer) - mCmdRxCount, MSG_DONTWAIT);
+
+		if(received > 0)
+			mCmdRxCount += received;
+		else if(received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+		{
+			UL_LOG("receiveFrame failed, recv() error: " << strerror(errno));
+			return ERR_DEV_NOT_CONNECTED;
+		}
+	}
+
+	return ERR_NO_ERROR;
+}
+
+// returns 1 if the socket is ready, 0 if the deadline has passed and -1 on error
+int NetDaqDevice::waitForSocket(int sock, short events, unsigned long long deadline)
+{
+	pollfd pfd;
+	pfd.fd = sock;
+	pfd.events = events;
+
+	while(true)
+	{
+		pfd.revents = 0;
+
+		int timeout = -1;
+
+		if(deadline)
+		{
+			unsigned long long now = ul_clock_monotonic_ns() / 1000000;
+			timeout = now < deadline ? (int)(deadline - now) : 0;
+		}
+
+		int ret = poll(&pfd, 1, timeout);
+
+		if(ret > 0)
+			return (pfd.revents & events) ? 1 : -1;
+
+		if(ret == 0)
+			return 0;
+
+		if(errno != EINTR)
+			return -1;
+	}
+}
+
+// 0 if there is no timeout
+unsigned long long NetDaqDevice::getDeadline(int timeout)
+{
+	if(timeout < 0)
+		return 0;
+
+	return ul_clock_monotonic_ns() / 1000000 + timeout;
+}
+
 void NetDaqDevice::queryCmdVir(unsigned short cmd, unsigned char* sendBuf, unsigned short sendBufLen, unsigned char* status) const
 {
 	UlError err = queryTcpVir(cmd, sendBuf, sendBufLen, NULL, 0, NULL, status, mIoTimeout);
@@ -894,12 +1103,12 @@ UlError NetDaqDevice::receiveFrameVir(unsigned short cmd, unsigned char frameId,
 	return err;
 }
 
-UlError NetDaqDevice::readScanData(unsigned char* buf, unsigned int bufSize, unsigned int* bytesRead) const
+UlError NetDaqDevice::readScanData(const iovec* iov, int iovCount, unsigned int* bytesRead) const
 {
 	UlError err = ERR_NO_ERROR;
 	int received = 0;
 
-	received = recv(mSockets.tcpData, buf, bufSize, 0);
+	received = readv(mSockets.tcpData, iov, iovCount);
 
 	if(received != -1)
 	{
@@ -917,7 +1126,7 @@ UlError NetDaqDevice::readScanData(unsigned char* buf, unsigned int bufSize, uns
 		{
 			err = ERR_DATA_SOCKET_CONNECTION_FAILED;
 
-			UL_LOG("readScanData failed, recv() error: " << strerror(errno));
+			UL_LOG("readScanData failed, readv() error: " << strerror(errno));
 		}
 	}
 
@@ -945,15 +1154,18 @@ void NetDaqDevice::clearSocketInputQueue() const
 	unsigned char frameBuf[MAX_SEND_FRAME_SIZE];
 	unsigned int frameBufLen = sizeof(frameBuf);
 
-	timeval to = NetDiscovery::convertTimeout(100); // 100 ms
-	if(setsockopt(mSockets.tcpCmd, SOL_SOCKET, SO_RCVTIMEO, &to, sizeof(to)) == -1)
-		 print_setsockopt_error(errno, __FILE__, __LINE__);
+	mCmdRxCount = 0;
+
+	unsigned long long deadline = getDeadline(100); // 100 ms
 
 	int received = 0;
 
 	do
 	{
-		received = recv(mSockets.tcpCmd, frameBuf, frameBufLen, 0);
+		received = 0;
+
+		if(waitForSocket(mSockets.tcpCmd, POLLIN, deadline) > 0)
+			received = recv(mSockets.tcpCmd, frameBuf, frameBufLen, MSG_DONTWAIT);
 	}
 	while(received > 0);
 }
@@ -1134,31 +1346,59 @@ int NetDaqDevice::memRead(MemoryType memType, MemRegion memRegionType, unsigned
 
 	cmd = getMemCmd(memRegionType, false);
 
-#pragma pack(1)
-	struct
-	{
-		unsigned short 	address;
-		unsigned short  bytesToRead;
-	}params;
-#pragma pack()
-
 	unsigned char* readBuff = buffer;
 
 	addr = address;
 
+	// the reads of all the blocks are issued at once, a block that is read partially is continued by the next batch
+	unsigned int blockCount = (remaining + maxTransfer - 1) / maxTransfer;
+	// address and byte count of each block
+	std::vector<unsigned short> params(blockCount * 2);
+	std::vector<NetCmd> cmds(blockCount);
+
 	do
 	{
-		bytesToRead = remaining > maxTransfer ? maxTransfer : remaining;
+		unsigned int cmdCount = 0;
+		int blockAddr = addr;
+		int blockRemaining = remaining;
+		unsigned char* blockBuff = readBuff;
 
-		params.address = Endian::cpu_to_le_ui16(addr);
-		params.bytesToRead = Endian::cpu_to_le_ui16(bytesToRead);
+		while(blockRemaining > 0)
+		{
+			bytesToRead = blockRemaining > maxTransfer ? maxTransfer : blockRemaining;
+
+			params[cmdCount * 2] = Endian::cpu_to_le_ui16(blockAddr);
+			params[cmdCount * 2 + 1] = Endian::cpu_to_le_ui16(bytesToRead);
+
+			cmds[cmdCount].cmd = cmd;
+			cmds[cmdCount].sendBuf = (unsigned char*) &params[cmdCount * 2];
+			cmds[cmdCount].sendBufLen = 2 * sizeof(unsigned short);
+			cmds[cmdCount].receiveBuf = blockBuff;
+			cmds[cmdCount].receiveBufLen = bytesToRead;
 
-		bytesRead  = queryCmd(cmd, (unsigned char*)&params, sizeof(params), readBuff, bytesToRead);
+			cmdCount++;
+			blockAddr += bytesToRead;
+			blockRemaining -= bytesToRead;
+			blockBuff += bytesToRead;
+		}
+
+		queryCmds(&cmds[0], cmdCount);
+
+		for(unsigned int i = 0; i < cmdCount; i++)
+		{
+			bytesRead = cmds[i].bytesReceived;
 
-		remaining-= bytesRead;
-		totalBytesRead += bytesRead;
-		addr += bytesRead;
-		readBuff += bytesRead;
+			remaining-= bytesRead;
+			totalBytesRead += bytesRead;
+			addr += bytesRead;
+			readBuff += bytesRead;
+
+			if(bytesRead < cmds[i].receiveBufLen)
+				break;
+		}
+
+		if(bytesRead == 0)
+			break;
 	}
 	while(remaining > 0);
 
@@ -1256,6 +1496,15 @@ unsigned char NetDaqDevice::getMemCmd(MemRegion memRegionType, bool writeAccess)
 	return cmd;
 }
 
+// output scans are not supported by the network devices
+void NetDaqDevice::getScanStats(ScanDirection direction, ScanStats* stats) const
+{
+	if(direction != SD_INPUT)
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	mScanTransferIn->getScanStats(stats);
+}
+
 NetScanTransferIn* NetDaqDevice::scanTranserIn() const
 {
 	if(mScanTransferIn == NULL)
@@ -13,6 +13,7 @@
 #include "NetDiscovery.h"
 
 #include <vector>
+#include <sys/uio.h>
 #include "../virnet.h"
 
 namespace ul
@@ -46,11 +47,36 @@ public:
 	unsigned int queryCmd(unsigned char cmd, unsigned char* sendBuf, unsigned short sendBufLen , unsigned char* receiveDataBuf, unsigned short receiveDataBufLen) const;
 	unsigned int queryCmd(unsigned char cmd, unsigned char* sendBuf, unsigned short sendBufLen , unsigned char* receiveDataBuf, unsigned short receiveDataBufLen, unsigned char* status) const;
 
+	// for configurations read by readCmd and written by writeCmd. The configuration is kept in the config shadow of
+	// the device, unchanged configurations are not sent and known configurations are not queried
+	void sendConfigCmd(unsigned char readCmd, unsigned char writeCmd, unsigned char* config, unsigned short configLen) const;
+	void queryConfigCmd(unsigned char readCmd, unsigned char* config, unsigned short configLen) const;
+
+	// a command of a batch issued by queryCmds(), bytesReceived and status are set from the reply. The batches are
+	// sent by ulAInSnapshot() of the E-1608, ulDInArray() of the E-TC32 and the memory reads
+	typedef struct
+	{
+		unsigned char cmd;
+		unsigned char* sendBuf;
+		unsigned short sendBufLen;
+		unsigned char* receiveBuf;
+		unsigned short receiveBufLen;
+		unsigned short bytesReceived;
+		unsigned char status;
+	} NetCmd;
+
+	void queryCmds(NetCmd cmds[], unsigned int count) const;
+
 	void queryCmdVir(unsigned short cmd, unsigned char* sendBuf, unsigned short sendBufLen, unsigned char* status) const;
 	unsigned int queryCmdVir(unsigned short cmd, unsigned char* sendBuf, unsigned short sendBufLen , unsigned char* receiveDataBuf, unsigned short receiveDataBufLen, unsigned char* status) const;
 
 
-	UlError readScanData(unsigned char* buf, unsigned int bufSize, unsigned int* bytesRead) const;
+	// scatter read of the data socket, fills the buffers in order with a single readv()
+	UlError readScanData(const iovec* iov, int iovCount, unsigned int* bytesRead) const;
+
+	// time in us the data socket busy polls for scan data before it sleeps, 0 (default) to not busy poll
+	static int getScanBusyPoll() { return mScanBusyPoll;}
+	static void setScanBusyPoll(int busyPoll) { mScanBusyPoll = busyPoll;}
 
 	virtual int memRead(MemoryType memType, MemRegion memRegionType, unsigned int address, unsigned char* buffer, unsigned int count) const;
 	virtual int memWrite(MemoryType memType, MemRegion memRegionType, unsigned int address, unsigned char* buffer, unsigned int count) const;
@@ -65,6 +91,8 @@ public:
 	virtual void getCfg_IpAddress(char* address, unsigned int* maxStrLen) const;
 	virtual void getCfg_NetIfcName(char* ifcName, unsigned int* maxStrLen) const;
 
+	virtual void getScanStats(ScanDirection direction, ScanStats* stats) const;
+
 protected:
 	UlError initTcpDataSocket(int timeout /* ms */) const;
 
@@ -78,6 +106,7 @@ private:
 	virtual void initilizeHardware() const {};
 	void releaseNetResources();
 
+	UlError initConnection(const NetDiscovery::NetDiscoveryInfo& discoveryInfo);
 	UlError initUdpSocket(const NetDiscovery::NetIfcDesc& ifcDesc, const NetDiscovery::NetDiscoveryInfo& discoveryInfo) const;
 	UlError initTcpCmdSocket(const NetDiscovery::NetIfcDesc& ifcDesc, const NetDiscovery::NetDiscoveryInfo& discoveryInfo) const;
 
@@ -87,8 +116,12 @@ private:
 	UlError queryUdp(char* sendBuf, unsigned int sendBufLen, char* receiveBuf, unsigned int* receiveBufLen, int timeout) const;
 
 	UlError queryTcp(unsigned char cmd, unsigned char* sendBuf, unsigned short sendBufLen, unsigned char* receiveBuf, unsigned short receiveBufLen, unsigned short* bytesReceived, unsigned char* status, int timeout) const;
+	UlError queryTcpBatch(NetCmd cmds[], unsigned int count, int timeout) const;
 	UlError sendFrame(unsigned char cmd, unsigned char frameId, unsigned char* buf, unsigned short bufLen, int timeout) const;
 	UlError receiveFrame(unsigned char cmd, unsigned char frameId, unsigned char* dataBuf, unsigned short dataBufLen, unsigned short* bytesReceived, unsigned char* status, int timeout) const;
+	UlError fillCmdRxBuffer(unsigned int size, unsigned long long deadline) const;
+	static int waitForSocket(int sock, short events, unsigned long long deadline);
+	static unsigned long long getDeadline(int timeout /* ms */);
 
 	UlError queryTcpVir(unsigned short cmd, unsigned char* sendBuf, unsigned short sendBufLen, unsigned char* receiveBuf, unsigned short receiveBufLen, unsigned short* bytesReceived, unsigned char* status, int timeout) const;
 	UlError sendFrameVir(unsigned short cmd, unsigned char frameId, unsigned char* buf, unsigned short bufLen, int timeout) const;
@@ -109,6 +142,8 @@ private:
 	enum { /*DISCOVERY_CMD = 0x44,*/ CONNECTION_CMD = 0x43};
 	enum { /*DEFAULT_DISCOVERY_TO = 250,*/ DEFAULT_CONNECTION_TO = 3000, DEFAULT_IO_TO = 3000};
 	enum { MAX_SEND_FRAME_SIZE	= 1024, FRAME_START	= 0xDB };
+	enum { MAX_CMDS_IN_FLIGHT = 8, CMD_RX_BUFFER_SIZE = 4096 };
+	enum { DATA_SOCKET_RCVBUF_SIZE = 4 * 1024 * 1024 };
 	enum { CMD_BLINKLED = 0x50, CMD_RESET = 0x51, CMD_STATUS = 0x52, CMD_NETCONFIG = 0x54};
 	enum { CMD_CAL_MEM_R = 0x40, CMD_USER_MEM_R = 0x42, CMD_USER_MEM_W = 0x43, CMD_SETTINGS_MEM_R = 0x44, CMD_SETTINGS_MEM_W = 0x45};
 	enum { MEM_UNLOCK_CODE = 0xAA55 };
@@ -127,6 +162,11 @@ private:
 
 	NetScanTransferIn* mScanTransferIn;
 
+	// id of the last command frame sent and the replies read from the command socket but not consumed yet
+	mutable unsigned char mCmdFrameId;
+	mutable unsigned char mCmdRxBuffer[CMD_RX_BUFFER_SIZE];
+	mutable unsigned int mCmdRxCount;
+
 	mutable struct NetSockets
 	{
 		int udp;
@@ -136,6 +176,7 @@ private:
 		NetSockets(){udp = -1; tcpCmd = -1;  tcpData = -1;}
 	}mSockets;
 
+	static int mScanBusyPoll;
 
 #pragma pack(1)
 	typedef struct
@@ -13,6 +13,7 @@ namespace ul
 pthread_mutex_t NetDiscovery::mDiscoveryMutex = PTHREAD_MUTEX_INITIALIZER;
 std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::mAutoDiscoveryList;
 std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::mManualDiscoveryList;
+int NetDiscovery::mCacheTtl = NetDiscovery::DISCOVERY_CACHE_TTL;
 
 std::vector<DaqDeviceDescriptor> NetDiscovery::findDaqDevices()
 {
@@ -83,7 +84,16 @@ DaqDeviceDescriptor NetDiscovery::findDaqDevice(std::string host, unsigned short
 
 	int devIndex = -1;
 
-	std::vector<NetDiscoveryInfo> netDiscoveryInfo = discoverDevices(host, port, ifcName, timeout);
+	std::vector<NetDiscoveryInfo> netDiscoveryInfo;
+	NetDiscoveryInfo cachedInfo;
+
+	if(findCachedDevice(host, port, ifcName, cachedInfo))
+	{
+		UL_LOG("using the cached discovery info of " << host);
+		netDiscoveryInfo.push_back(cachedInfo);
+	}
+	else
+		netDiscoveryInfo = discoverDevices(host, port, ifcName, timeout);
 
 	for(unsigned int i = 0; i < netDiscoveryInfo.size(); i++)
 	{
@@ -137,11 +147,11 @@ DaqDeviceDescriptor NetDiscovery::findDaqDevice(std::string host, unsigned short
 	return daqDevDescriptor;
 }
 
-std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::discoverDevices(std::string host, unsigned short port, std::string ifcName, int timeout)
+// the discovery is broadcast on all the interfaces at once and the replies are collected as they arrive, so
+// the time it takes does not depend on the number of interfaces
+std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::discoverDevices(std::string host, unsigned short port, std::string ifcName, int timeout, std::string expectedMac)
 {
-	int sockfd;
 	std::vector<NetDiscoveryInfo> discoveryInfo;
-	timeval recvTimeout = convertTimeout(timeout);
 	int broadCast = 1;
 	unsigned int targetAddr = htonl(INADDR_BROADCAST);
 
@@ -155,9 +165,12 @@ std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::discoverDevices(std::s
 	//find network interfaces
 	std::vector<NetIfcDesc> netIfcDescs = getNetIfcDescs(ifcName);
 
+	std::vector<pollfd> pollFds;
+	std::vector<unsigned int> pollIfcs;
+
 	for(unsigned int i = 0; i < netIfcDescs.size(); i++)
 	{
-		sockfd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		int sockfd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
 
 		if(sockfd != -1)
 		{
@@ -166,7 +179,9 @@ std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::discoverDevices(std::s
 			if(setsockopt(sockfd, SOL_SOCKET, SO_BROADCAST, &broadCast, sizeof(broadCast)) == -1)
 				setOptErr = true;
 
-			if(setsockopt (sockfd, SOL_SOCKET, SO_RCVTIMEO, (char*) &recvTimeout, sizeof(recvTimeout)) == -1)
+			// the replies are read until the socket is drained
+			int flags = fcntl(sockfd, F_GETFL, 0);
+			if(flags == -1 || fcntl(sockfd, F_SETFL, flags | O_NONBLOCK) == -1)
 				setOptErr = true;
 
 			if(setOptErr)
@@ -174,31 +189,17 @@ std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::discoverDevices(std::s
 
 			if(bind(sockfd, (sockaddr*) &netIfcDescs[i].addr, sizeof(sockaddr)) != -1)
 			{
-				bool success = sendDiscovery(sockfd, targetAddr, port);
-
-				if(success)
+				if(sendDiscovery(sockfd, targetAddr, port))
 				{
-					NetDiscoveryInfo netDiscoveryInfo;
-
-					while(detectNetDevice(sockfd, netDiscoveryInfo))
-					{
-						netDiscoveryInfo.ifcName = netIfcDescs[i].name;
-						netDiscoveryInfo.discoveryPort = port;
-						netDiscoveryInfo.valid = true;
+					pollfd pfd;
+					pfd.fd = sockfd;
+					pfd.events = POLLIN;
+					pfd.revents = 0;
 
-						discoveryInfo.push_back(netDiscoveryInfo);
-
-						/*std::cout << "Interface name: " << netDiscoveryInfo.ifcName << std::endl;
-						std::cout << "Interface IP: " << inet_ntoa(netIfcDescs[i].addr.sin_addr) << std::endl;
-						std::cout << "===============================" << std::endl;*/
-
-						netDiscoveryInfo.clear();
-
-						 // if daq device host address or name specified then desired device is detected, exit the loop
-						if(!host.empty())
-							break;
-					}
+					pollFds.push_back(pfd);
+					pollIfcs.push_back(i);
 
+					continue;
 				}
 			}
 			else
@@ -210,6 +211,86 @@ std::vector<NetDiscovery::NetDiscoveryInfo> NetDiscovery::discoverDevices(std::s
 		}
 	}
 
+	unsigned long long deadline = getTimestamp() + (timeout > 0 ? timeout : 0);
+	unsigned int activeCount = pollFds.size();
+	bool done = (activeCount == 0);
+
+	while(!done)
+	{
+		int waitTime = -1;
+
+		if(timeout >= 0)
+		{
+			unsigned long long now = getTimestamp();
+			waitTime = now < deadline ? (int) (deadline - now) : 0;
+		}
+
+		int ret = poll(&pollFds[0], pollFds.size(), waitTime);
+
+		if(ret < 0)
+		{
+			if(errno == EINTR)
+				continue;
+
+			UL_LOG("poll() error: " << strerror(errno));
+			break;
+		}
+
+		if(ret == 0) // timed out
+			break;
+
+		for(unsigned int i = 0; i < pollFds.size() && !done; i++)
+		{
+			if(pollFds[i].fd < 0 || !(pollFds[i].revents & POLLIN))
+				continue;
+
+			const NetIfcDesc& ifcDesc = netIfcDescs[pollIfcs[i]];
+			NetDiscoveryInfo netDiscoveryInfo;
+			netDiscoveryInfo.clear();
+
+			while(detectNetDevice(pollFds[i].fd, netDiscoveryInfo))
+			{
+				netDiscoveryInfo.ifcName = ifcDesc.name;
+				netDiscoveryInfo.discoveryPort = port;
+				netDiscoveryInfo.host = host;
+				netDiscoveryInfo.timestamp = getTimestamp();
+				netDiscoveryInfo.valid = true;
+
+				discoveryInfo.push_back(netDiscoveryInfo);
+
+				if(!expectedMac.empty() && netDiscoveryInfo.macAddr == expectedMac)
+					done = true;
+
+				// if daq device host address or name specified then desired device is detected on this interface,
+				// there is no better interface than the one specified or the one in the same subnet as the device
+				if(!host.empty())
+				{
+					if(!ifcName.empty() || inSameSubnet(ifcDesc, netDiscoveryInfo.ipAddr))
+						done = true;
+
+					close(pollFds[i].fd);
+					pollFds[i].fd = -1;
+
+					if(--activeCount == 0)
+						done = true;
+
+					break;
+				}
+
+				netDiscoveryInfo.clear();
+
+				if(done)
+					break;
+			}
+		}
+	}
+
+	for(unsigned int i = 0; i < pollFds.size(); i++)
+	{
+		if(pollFds[i].fd >= 0)
+			close(pollFds[i].fd);
+	}
+
 	return discoveryInfo;
 }
 
@@ -318,6 +399,103 @@ NetDiscovery::NetDiscoveryInfo NetDiscovery::getDiscoveryInfo(std::string macAdd
 	return discoveryInfo;
 }
 
+// finds the device again by its MAC address, the address of the device may have changed since it was discovered
+NetDiscovery::NetDiscoveryInfo NetDiscovery::rediscover(const NetDiscoveryInfo& discoveryInfo)
+{
+	UlLock lock(mDiscoveryMutex);
+
+	FnLog log("NetDiscovery::rediscover");
+
+	NetDiscoveryInfo info;
+	info.clear();
+
+	try
+	{
+		std::vector<NetDiscoveryInfo> netDiscoveryInfo = discoverDevices(discoveryInfo.host, discoveryInfo.discoveryPort, "", DISCOVERY_TO, discoveryInfo.macAddr);
+
+		for(unsigned int i = 0; i < netDiscoveryInfo.size(); i++)
+		{
+			if(netDiscoveryInfo[i].macAddr == discoveryInfo.macAddr)
+			{
+				info = netDiscoveryInfo[i];
+				break;
+			}
+		}
+	}
+	catch(UlException& e)
+	{
+		UL_LOG("rediscovery failed, error: " << e.getError());
+	}
+
+	if(info.valid)
+	{
+		updateDiscoveryList(mAutoDiscoveryList, info);
+		updateDiscoveryList(mManualDiscoveryList, info);
+	}
+
+	return info;
+}
+
+bool NetDiscovery::findCachedDevice(const std::string& host, unsigned short port, const std::string& ifcName, NetDiscoveryInfo& discoveryInfo)
+{
+	if(mCacheTtl <= 0 || host.empty())
+		return false;
+
+	sockaddr_in hostAddr = getHostAddress(host);
+	unsigned long long now = getTimestamp();
+
+	const std::vector<NetDiscoveryInfo>* lists[] = { &mManualDiscoveryList, &mAutoDiscoveryList };
+
+	for(unsigned int list = 0; list < 2; list++)
+	{
+		for(unsigned int i = 0; i < lists[list]->size(); i++)
+		{
+			const NetDiscoveryInfo& info = (*lists[list])[i];
+
+			if(info.valid && info.ipAddr.s_addr == hostAddr.sin_addr.s_addr && info.discoveryPort == port &&
+			   (ifcName.empty() || info.ifcName == ifcName) && now - info.timestamp < (unsigned long long) mCacheTtl)
+			{
+				try
+				{
+					if(isNetIfcAvaiable(info.ifcName))
+					{
+						discoveryInfo = info;
+						return true;
+					}
+				}
+				catch(UlException& e)
+				{
+					// the interface is gone
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+void NetDiscovery::updateDiscoveryList(std::vector<NetDiscoveryInfo>& discoveryList, const NetDiscoveryInfo& discoveryInfo)
+{
+	for(unsigned int i = 0; i < discoveryList.size(); i++)
+	{
+		if(discoveryList[i].macAddr == discoveryInfo.macAddr)
+		{
+			// keep how the device was found
+			std::string host = discoveryList[i].host;
+
+			discoveryList[i] = discoveryInfo;
+			discoveryList[i].host = host;
+		}
+	}
+}
+
+void NetDiscovery::setCacheTtl(int ttl)
+{
+	UlLock lock(mDiscoveryMutex);
+
+	mCacheTtl = ttl;
+}
+
 std::vector<NetDiscovery::NetIfcDesc> NetDiscovery::getNetIfcDescs(std::string ifcName)
 {
 	std::vector<NetIfcDesc> netIfcDescs;
@@ -422,18 +600,20 @@ bool NetDiscovery::hostAndDevInSameSubnet(NetDiscoveryInfo discoveryInfo )
 	std::vector<NetIfcDesc> IfcDescs = getNetIfcDescs(discoveryInfo.ifcName);
 
 	if(IfcDescs.size() > 0)
-	{
-		in_addr ifc, dev;
-		ifc.s_addr= IfcDescs[0].netmask.sin_addr.s_addr & IfcDescs[0].addr.sin_addr.s_addr;
-		dev.s_addr= IfcDescs[0].netmask.sin_addr.s_addr & discoveryInfo.ipAddr.s_addr;
-
-		if(ifc.s_addr == dev.s_addr)
-			sameSubnet = true;
-	}
+		sameSubnet = inSameSubnet(IfcDescs[0], discoveryInfo.ipAddr);
 
 	return sameSubnet;
 }
 
+bool NetDiscovery::inSameSubnet(const NetIfcDesc& ifcDesc, in_addr addr)
+{
+	in_addr ifc, dev;
+	ifc.s_addr= ifcDesc.netmask.sin_addr.s_addr & ifcDesc.addr.sin_addr.s_addr;
+	dev.s_addr= ifcDesc.netmask.sin_addr.s_addr & addr.s_addr;
+
+	return ifc.s_addr == dev.s_addr;
+}
+
 bool NetDiscovery::isNetIfcAvaiable(std::string ifcName)
 {
 	bool available = false;
@@ -456,4 +636,9 @@ timeval NetDiscovery::convertTimeout(int timeout /* in ms*/)
 
 	return to;
 }
+
+unsigned long long NetDiscovery::getTimestamp()
+{
+	return ul_clock_monotonic_ns() / 1000000;
+}
 } /* namespace ul */
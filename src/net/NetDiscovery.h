@@ -22,6 +22,8 @@
 #include <netdb.h>
 #include <unistd.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
 
 namespace ul
 {
@@ -50,6 +52,8 @@ public:
 		bool wifi; // this is only valid for virnet devices
 
 		int discoveryPort;
+		std::string host; // host name or address the device was discovered by, empty if broadcast
+		unsigned long long timestamp; // time of the reply in ms, monotonic clock
 		bool valid;
 
 		void clear()
@@ -62,6 +66,8 @@ public:
 			ifcName.clear();
 			wifi = false;
 			discoveryPort = 0;
+			host.clear();
+			timestamp = 0;
 			valid = false;
 		};
 	}NetDiscoveryInfo;
@@ -71,17 +77,25 @@ public:
 	static DaqDeviceDescriptor findDaqDevice(std::string host, unsigned short port, std::string ifcName, int timeout);
 
 	static NetDiscoveryInfo getDiscoveryInfo(std::string mac);
+	static NetDiscoveryInfo rediscover(const NetDiscoveryInfo& discoveryInfo);
 	static bool isNetIfcAvaiable(std::string ifcName);
 	static std::vector<NetIfcDesc> getNetIfcDescs(std::string ifcName = "");
 
 	static timeval convertTimeout(int timeout /* in ms*/);
 
+	static int getCacheTtl() { return mCacheTtl;}
+	static void setCacheTtl(int ttl);
+
 private:
 
-	static std::vector<NetDiscoveryInfo> discoverDevices(std::string host = "", unsigned short port = DISCOVERY_PORT, std::string ifcName = "", int timeout = DISCOVERY_TO);
+	static std::vector<NetDiscoveryInfo> discoverDevices(std::string host = "", unsigned short port = DISCOVERY_PORT, std::string ifcName = "", int timeout = DISCOVERY_TO, std::string expectedMac = "");
+	static bool findCachedDevice(const std::string& host, unsigned short port, const std::string& ifcName, NetDiscoveryInfo& discoveryInfo);
+	static void updateDiscoveryList(std::vector<NetDiscoveryInfo>& discoveryList, const NetDiscoveryInfo& discoveryInfo);
 	static void removeFromAutoDiscoveryList(const std::string& macAddr);
 	static void removeFromManualDiscoveryList(const std::string& macAddr);
 	static bool hostAndDevInSameSubnet(NetDiscoveryInfo discoveryInfo);
+	static bool inSameSubnet(const NetIfcDesc& ifcDesc, in_addr addr);
+	static unsigned long long getTimestamp();
 
 
 	static bool sendDiscovery(int sockfd, unsigned int addr, unsigned short port);
@@ -90,6 +104,8 @@ private:
 
 public:
 	enum { DISCOVERY_TO = 250, DISCOVERY_PORT = 54211, DISCOVERY_CMD = 0x44, UDP_MSG_MAX_LEN =  512};
+	// ms the discovery info of a device found by host is reused by findDaqDevice() without a new discovery
+	enum { DISCOVERY_CACHE_TTL = 60000 };
 
 #pragma pack(1)
 
@@ -115,6 +131,7 @@ private:
 	static pthread_mutex_t mDiscoveryMutex;
 	static std::vector<NetDiscoveryInfo> mAutoDiscoveryList;
 	static std::vector<NetDiscoveryInfo> mManualDiscoveryList;
+	static int mCacheTtl;
 
 };
 
@@ -6,6 +6,8 @@
 
 #include "NetScanTransferIn.h"
 
+#include <algorithm>
+
 namespace ul
 {
 
@@ -27,10 +29,17 @@ NetScanTransferIn::NetScanTransferIn(const NetDaqDevice& daqDevice) : mNetDevice
 	mNextEventCount = 0;
 
 	mSampleSize = 0;
+
+	mRing = new unsigned char[RING_SIZE];
+	mRingSize = RING_SIZE;
+	mRingReadPos = 0;
+	mRingCount = 0;
 }
 
 NetScanTransferIn::~NetScanTransferIn()
 {
+	delete [] mRing;
+
 	UlLock::destroyMutex(mXferThreadHandleMutex);
 }
 
@@ -41,15 +50,23 @@ void NetScanTransferIn::initilizeTransfer(IoDevice* ioDevice, int sampleSize, in
 	mIoDevice = ioDevice;
 	mSampleSize = sampleSize;
 
+	mRingSize = (RING_SIZE / mSampleSize) * mSampleSize;
+	mRingReadPos = 0;
+	mRingCount = 0;
+
 	mXferError = ERR_NO_ERROR;
 	mXferState = TS_RUNNING;
 
 	// Just in case thread is not terminated
 	terminate();
 
+	mXferTiming.reset();
+	mXferTiming.setBacklogCapacity(mRingSize);
+
 	mXferEvent.reset();
 
-	mEnabledDaqEvents = mDaqEventHandler->getEnabledEventTypes();
+	// the events of the user's scans are left alone by an internal scan, such as the scan of ulAInSnapshot()
+	mEnabledDaqEvents = mIoDevice->internalScan() ? (DaqEventType) 0 : mDaqEventHandler->getEnabledEventTypes();
 	mDaqEventHandler->resetInputEvents(mEnabledDaqEvents);
 
 	if(mEnabledDaqEvents & DE_ON_DATA_AVAILABLE)
@@ -111,14 +128,8 @@ void* NetScanTransferIn::xferThread(void *arg)
 	This->mXferError = ERR_NO_ERROR;
 
 	UlError err = ERR_NO_ERROR;
-	const int MAX_STAGE_SIZE = 16384; // changed from 10240 to 16384 to match max stage size of USB devices for virnet devices
-	unsigned char data[MAX_STAGE_SIZE];
-	unsigned char partialSampleBuf[8] = {0};
-	int partialSampleSize = 0;
-	int partialSampleIndex = 0;
-	int bytesToProcess;
-	int bytesFromLastXfer = 0;
 	unsigned int bytesRead = 0;
+	unsigned int bytesToProcess;
 	bool scanDone = false;
 
 	This->mXferThreadInitEvent.signal();
@@ -127,33 +138,25 @@ void* NetScanTransferIn::xferThread(void *arg)
 
 	while (!This->mTerminateXferThread && !scanDone)
 	{
-		if(bytesFromLastXfer) // There was a partial sample from the previous transfer copy it to the beginning of the buffer
-			memcpy(data, partialSampleBuf, bytesFromLastXfer);
-
-		err = This->daqDev().readScanData(&data[bytesFromLastXfer], sizeof(data) - bytesFromLastXfer, &bytesRead);
+		err = This->readRing(&bytesRead);
 
 		if(err == ERR_NO_ERROR)
 		{
 			if(bytesRead > 0)
 			{
-				bytesToProcess = bytesRead + bytesFromLastXfer;
-				bytesFromLastXfer = 0;
-
-				partialSampleSize = bytesToProcess % This->mSampleSize;
+				// a partial sample at the end stays in the ring until the rest of it is received
+				bytesToProcess = This->mRingCount - (This->mRingCount % This->mSampleSize);
 
-				if(partialSampleSize)
-				{
+				if(bytesToProcess != This->mRingCount)
 					UL_LOG("a packet containing partial sample received");
 
-					bytesToProcess -= partialSampleSize;
+				This->mXferTiming.recordBacklog(This->mRingCount);
 
-					partialSampleIndex = bytesToProcess;
-					memcpy(partialSampleBuf, &data[partialSampleIndex], partialSampleSize);
+				unsigned long long startNs = This->mXferTiming.begin();
 
-					bytesFromLastXfer = partialSampleSize;
-				}
+				This->processRing(bytesToProcess);
 
-				This->mIoDevice->processScanData(data, bytesToProcess);
+				This->mXferTiming.record(startNs, bytesToProcess, This->mIoDevice->scanByteRate());
 
 				unsigned long long samplesTransfered = This->mIoDevice->totalScanSamplesTransferred();
 
@@ -249,6 +252,64 @@ void NetScanTransferIn::terminate()
 	}
 }
 
+UlError NetScanTransferIn::readRing(unsigned int* bytesRead)
+{
+	unsigned int writePos = mRingReadPos + mRingCount;
+	unsigned int freeSize = mRingSize - mRingCount;
+
+	if(writePos >= mRingSize)
+		writePos -= mRingSize;
+
+	// the free space of the ring wraps around its end when the write position is past the read position
+	iovec iov[2];
+	int iovCount = 1;
+
+	iov[0].iov_base = mRing + writePos;
+	iov[0].iov_len = std::min(freeSize, mRingSize - writePos);
+
+	if(iov[0].iov_len < freeSize)
+	{
+		iov[1].iov_base = mRing;
+		iov[1].iov_len = freeSize - iov[0].iov_len;
+		iovCount = 2;
+	}
+
+	UlError err = daqDev().readScanData(iov, iovCount, bytesRead);
+
+	mRingCount += *bytesRead;
+
+	return err;
+}
+
+void NetScanTransferIn::processRing(unsigned int count)
+{
+	unsigned int maxStageSize = (MAX_STAGE_SIZE / mSampleSize) * mSampleSize;
+	unsigned int stageSize;
+
+	mRingCount -= count;
+
+	while(count > 0)
+	{
+		stageSize = std::min(count, std::min(maxStageSize, mRingSize - mRingReadPos));
+
+		mIoDevice->processScanData(mRing + mRingReadPos, stageSize);
+
+		// a single read can fill most of the ring, publishing each stage keeps the progress readers see
+		// as fine grained as the stages and the write ahead used by ulAInScanRead() as small as a stage
+		mIoDevice->publishScanProgress();
+
+		mRingReadPos += stageSize;
+		if(mRingReadPos == mRingSize)
+			mRingReadPos = 0;
+
+		count -= stageSize;
+	}
+
+	// start the next read at the beginning of the ring so it is filled with a single buffer
+	if(mRingCount == 0)
+		mRingReadPos = 0;
+}
+
 bool NetScanTransferIn::isDataAvailable(unsigned long long count, unsigned long long current, unsigned long long next)
 {
 	bool available = false;
@@ -11,6 +11,7 @@
 #include "../IoDevice.h"
 #include "../DaqEventHandler.h"
 #include "../utility/ThreadEvent.h"
+#include "../utility/XferTiming.h"
 
 namespace ul
 {
@@ -30,12 +31,24 @@ public:
 
 	inline UlError getXferError() const { return mXferError;}
 
+	void getScanStats(ScanStats* stats) const { mXferTiming.getStats(stats);}
+
 private:
 	void startXferThread();
 	static void* xferThread(void* arg);
 
 	static bool isDataAvailable(unsigned long long count, unsigned long long current, unsigned long long next);
 
+	UlError readRing(unsigned int* bytesRead);
+	void processRing(unsigned int count);
+
+private:
+	// the data socket is read into a ring buffer, its size is a multiple of the sample size so samples
+	// never wrap around the end of the ring and are processed in place
+	enum { RING_SIZE = 1024 * 1024 };
+	// processScanData() is never passed more than this, the virnet devices process the data as USB stages
+	enum { MAX_STAGE_SIZE = 16384 };
+
 private:
 	const NetDaqDevice&  mNetDevice;
 	IoDevice* mIoDevice;
@@ -58,6 +71,14 @@ private:
 	unsigned long long mNextEventCount;
 
 	int mSampleSize;
+
+	unsigned char* mRing;
+	unsigned int mRingSize;
+	unsigned int mRingReadPos;
+	unsigned int mRingCount;
+
+	// a stage is a read of the data socket, the backlog is the data in the ring
+	XferTiming mXferTiming;
 };
 
 } /* namespace ul */
@@ -14,7 +14,7 @@ AiE1608::AiE1608(const NetDaqDevice& daqDevice) : AiNetBase(daqDevice)
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
-	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
+	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA | AINSCAN_FF_FLOAT32DATA | AINSCAN_FF_UINT16DATA | AINSCAN_FF_UINT32DATA);
 
 	mAiInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_BLOCKIO );
 	mAiInfo.setTriggerTypes(TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE);
@@ -93,6 +93,49 @@ double AiE1608::aIn(int channel, AiInputMode inputMode, Range range, AInFlag fla
 	return data;
 }
 
+// the CMD_AIN commands of all the channels are pipelined, so a snapshot takes about one network round trip
+void AiE1608::aInSnapshot(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[])
+{
+	UlLock lock(mIoDeviceMutex);
+
+	check_AInSnapshot_Args(lowChan, highChan, inputMode, range, flags, data);
+
+	int chanCount = highChan - lowChan + 1;
+	unsigned char rangeCode = mapRangeCode(range);
+
+	std::vector<unsigned char> params(chanCount * 2);
+	std::vector<unsigned short> rawVals(chanCount, 0);
+	std::vector<NetDaqDevice::NetCmd> cmds(chanCount);
+
+	for(int i = 0; i < chanCount; i++)
+	{
+		params[i * 2] = getChanCode(lowChan + i, inputMode);
+		params[i * 2 + 1] = rangeCode;
+
+		cmds[i].cmd = CMD_AIN;
+		cmds[i].sendBuf = &params[i * 2];
+		cmds[i].sendBufLen = 2;
+		cmds[i].receiveBuf = (unsigned char*) &rawVals[i];
+		cmds[i].receiveBufLen = sizeof(unsigned short);
+	}
+
+	daqDev().queryCmds(&cmds[0], chanCount);
+
+	for(int i = 0; i < chanCount; i++)
+	{
+		int channel = lowChan + i;
+
+		if(cmds[i].bytesReceived != sizeof(unsigned short))
+			throw UlException(ERR_DEAD_DEV);
+
+		unsigned short rawVal = Endian::le_ui16_to_cpu(rawVals[i]);
+
+		data[i] = calibrateData(channel, inputMode, range, rawVal, flags);
+
+		data[i] = mCustomScales[channel].slope * data[i] + mCustomScales[channel].offset;
+	}
+}
+
 double AiE1608::aInScan(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[])
 {
 	UlLock lock(mIoDeviceMutex);
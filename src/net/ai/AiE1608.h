@@ -21,6 +21,7 @@ public:
 	virtual void initialize();
 
 	virtual double aIn(int channel, AiInputMode inputMode, Range range, AInFlag flags);
+	virtual void aInSnapshot(int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]);
 	virtual double aInScan(int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double rate, ScanOption options, AInScanFlag flags, double data[]);
 
 	virtual UlError getStatus(ScanStatus* status, TransferStatus* xferStatus);
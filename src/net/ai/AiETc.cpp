@@ -134,7 +134,7 @@ void AiETc::enableAllChannels()
 	bool chanEnabled = false;
 	unsigned char chanTcTypes[8];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_R, NULL, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG_R, chanTcTypes, sizeof(chanTcTypes));
 
 	for(int ch = 0; ch < mAiInfo.getNumChans(); ch++)
 	{
@@ -147,7 +147,7 @@ void AiETc::enableAllChannels()
 
 	if(chanEnabled)
 	{
-		daqDev().queryCmd(CMD_TIN_CONFIG_W, chanTcTypes, sizeof(chanTcTypes));
+		daqDev().sendConfigCmd(CMD_TIN_CONFIG_R, CMD_TIN_CONFIG_W, chanTcTypes, sizeof(chanTcTypes));
 	}
 
 }
@@ -249,7 +249,7 @@ void AiETc::setCfg_ChanType(int channel, AiChanType chanType)
 
 	unsigned char chanTcTypes[8];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_R, NULL, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG_R, chanTcTypes, sizeof(chanTcTypes));
 
 	if(chanType == AI_DISABLED && chanTcTypes[channel] != 0)
 	{
@@ -262,7 +262,7 @@ void AiETc::setCfg_ChanType(int channel, AiChanType chanType)
 	else
 		return;
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_W, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().sendConfigCmd(CMD_TIN_CONFIG_R, CMD_TIN_CONFIG_W, chanTcTypes, sizeof(chanTcTypes));
 }
 
 AiChanType AiETc::getCfg_ChanType(int channel) const
@@ -272,7 +272,7 @@ AiChanType AiETc::getCfg_ChanType(int channel) const
 
 	unsigned char chanTcTypes[8];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_R, NULL, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG_R, chanTcTypes, sizeof(chanTcTypes));
 
 	AiChanType chanType = chanTcTypes[channel] == 0 ? AI_DISABLED : AI_TC;
 
@@ -289,11 +289,11 @@ void AiETc::setCfg_ChanTcType(int channel, TcType tcType)
 
 	unsigned char chanTcTypes[8];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_R, NULL, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG_R, chanTcTypes, sizeof(chanTcTypes));
 
 	chanTcTypes[channel] = tcType;
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_W, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().sendConfigCmd(CMD_TIN_CONFIG_R, CMD_TIN_CONFIG_W, chanTcTypes, sizeof(chanTcTypes));
 }
 
 TcType AiETc::getCfg_ChanTcType(int channel) const
@@ -305,7 +305,7 @@ TcType AiETc::getCfg_ChanTcType(int channel) const
 
 	unsigned char chanTcTypes[8];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG_R, NULL, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG_R, chanTcTypes, sizeof(chanTcTypes));
 
 	// if channel is disabled return J type as current TC type
 	tcTypeVal = chanTcTypes[channel] == 0 ? TC_J : (TcType) chanTcTypes[channel];
@@ -317,14 +317,14 @@ void  AiETc::setCfg_OpenTcDetectionMode(int dev, OtdMode mode)
 {
 	TMEASURE_CFG config;
 
-	daqDev().queryCmd(CMD_MEASURE_CONFIG_R, NULL, 0, (unsigned char*)&config, sizeof(config));
+	daqDev().queryConfigCmd(CMD_MEASURE_CONFIG_R, (unsigned char*)&config, sizeof(config));
 
 	if(mode == OTD_DISABLED)
 		config.otd = 1;
 	else
 		config.otd = 0;
 
-	daqDev().queryCmd(CMD_MEASURE_CONFIG_W, (unsigned char*)&config, sizeof(config));
+	daqDev().sendConfigCmd(CMD_MEASURE_CONFIG_R, CMD_MEASURE_CONFIG_W, (unsigned char*)&config, sizeof(config));
 }
 OtdMode  AiETc::getCfg_OpenTcDetectionMode(int dev) const
 {
@@ -332,7 +332,7 @@ OtdMode  AiETc::getCfg_OpenTcDetectionMode(int dev) const
 
 	TMEASURE_CFG config;
 
-	daqDev().queryCmd(CMD_MEASURE_CONFIG_R, NULL, 0, (unsigned char*)&config, sizeof(config));
+	daqDev().queryConfigCmd(CMD_MEASURE_CONFIG_R, (unsigned char*)&config, sizeof(config));
 
 	if(config.otd == 1)
 		mode = OTD_DISABLED;
@@ -344,14 +344,14 @@ void AiETc::setCfg_CalTableType(int dev, AiCalTableType calTableType)
 {
 	TMEASURE_CFG config;
 
-	daqDev().queryCmd(CMD_MEASURE_CONFIG_R, NULL, 0, (unsigned char*)&config, sizeof(config));
+	daqDev().queryConfigCmd(CMD_MEASURE_CONFIG_R, (unsigned char*)&config, sizeof(config));
 
 	if(calTableType == AI_CTT_FIELD)
 		config.cal = 1;
 	else
 		config.otd = 0;
 
-	daqDev().queryCmd(CMD_MEASURE_CONFIG_W, (unsigned char*)&config, sizeof(config));
+	daqDev().sendConfigCmd(CMD_MEASURE_CONFIG_R, CMD_MEASURE_CONFIG_W, (unsigned char*)&config, sizeof(config));
 }
 
 AiCalTableType AiETc::getCfg_CalTableType(int dev) const
@@ -359,7 +359,7 @@ AiCalTableType AiETc::getCfg_CalTableType(int dev) const
 	AiCalTableType type = AI_CTT_FACTORY;
 	TMEASURE_CFG config;
 
-	daqDev().queryCmd(CMD_MEASURE_CONFIG_R, NULL, 0, (unsigned char*)&config, sizeof(config));
+	daqDev().queryConfigCmd(CMD_MEASURE_CONFIG_R, (unsigned char*)&config, sizeof(config));
 
 	if(config.cal == 1)
 		type = AI_CTT_FIELD;
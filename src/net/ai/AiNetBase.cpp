@@ -10,7 +10,7 @@ namespace ul
 {
 AiNetBase::AiNetBase(const NetDaqDevice& daqDevice) : AiDevice(daqDevice), mNetDevice(daqDevice)
 {
-
+	mRawScanDataSupported = true;
 }
 
 AiNetBase::~AiNetBase()
@@ -86,6 +86,13 @@ void AiNetBase::loadAdcCoefficients()
 }
 unsigned int AiNetBase::processScanData(void* transfer, unsigned int stageSize)
 {
+	if(mScanInfo.dataBufferType == DATA_RAW)
+	{
+		storeRawScanSamples((unsigned char*) transfer, stageSize / mScanInfo.sampleSize);
+
+		return 0;
+	}
+
 	switch(mScanInfo.sampleSize)
 	{
 	case 2:  // 2 bytes
@@ -107,50 +114,9 @@ unsigned int AiNetBase::processScanData(void* transfer, unsigned int stageSize)
 
 void AiNetBase::processScanData16(unsigned char* xferBuf, unsigned int xferLength)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
-	int numOfSampleCopied = 0;
-	int requestSampleCount = xferLength / mScanInfo.sampleSize;  // last packet in the finite mode might be less
-	unsigned short* buffer = (unsigned short*)xferBuf;
-
-	double data;
-	long rawVal;
-
-	double* dataBuffer = (double*) mScanInfo.dataBuffer;
-
-	while(numOfSampleCopied < requestSampleCount)
-	{
-		rawVal = Endian::le_ui16_to_cpu(buffer[numOfSampleCopied]);
-
-		if((mScanInfo.flags & NOCALIBRATEDATA) && (mScanInfo.flags & NOSCALEDATA))
-			data = rawVal;
-		else
-		{
-			data = (mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].slope * rawVal) + mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].offset;
-		}
-
-		dataBuffer[mScanInfo.currentDataBufferIdx] = mScanInfo.customScales[mScanInfo.currentCalCoefIdx].slope * data + mScanInfo.customScales[mScanInfo.currentCalCoefIdx].offset;
-
-		mScanInfo.currentDataBufferIdx++;
-		mScanInfo.currentCalCoefIdx++;
-		numOfSampleCopied++;
-
-		mScanInfo.totalSampleTransferred++;
-
-		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
-		{
-			mScanInfo.currentDataBufferIdx = 0;
-			if(!mScanInfo.recycle)
-			{
-				mScanInfo.allSamplesTransferred = true;
-				break;
-			}
-		}
-
-		if(mScanInfo.currentCalCoefIdx == mScanInfo.chanCount)
-			mScanInfo.currentCalCoefIdx = 0;
-	}
+	unsigned int requestSampleCount = xferLength / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 
+	convertScanSamples(xferBuf, requestSampleCount);
 }
 
 void AiNetBase::readCalDate()
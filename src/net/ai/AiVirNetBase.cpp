@@ -12,8 +12,7 @@ namespace ul
 
 AiVirNetBase::AiVirNetBase(const NetDaqDevice& daqDevice) : AiNetBase(daqDevice)
 {
-	// TODO Auto-generated constructor stub
-
+	mRawScanDataSupported = false;
 }
 
 AiVirNetBase::~AiVirNetBase()
@@ -203,8 +202,6 @@ UlError AiVirNetBase::checkScanState(bool* scanDone) const
 
 void AiVirNetBase::processScanData64(unsigned char* xferBuf, unsigned int xferLength)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	//int sampeSize = sizeof(double); // sample size for virtual net devies is always size of double since data is coming from the UL buffer
 	int requestSampleCount = xferLength / mScanInfo.sampleSize;  // last packet in the finite mode might be less
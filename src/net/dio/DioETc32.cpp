@@ -70,6 +70,51 @@ unsigned long long DioETc32::dIn(DigitalPortType portType)
 	return portVal;
 }
 
+// the input ports and the output ports are read with one command each, both commands are pipelined so the ports
+// are read in about one network round trip
+void DioETc32::dInArray(DigitalPortType lowPort, DigitalPortType highPort, unsigned long long data[])
+{
+	if(!daqDev().hasExp() && (highPort == SECONDPORTA || highPort == SECONDPORTB))
+		throw UlException(ERR_BAD_PORT_TYPE);
+
+	check_DInArray_Args(lowPort, highPort, data);
+
+	unsigned char inValues[2] = {0, 0};
+	unsigned int outValues[2] = {0, 0};
+
+	NetDaqDevice::NetCmd cmds[2];
+
+	cmds[0].cmd = CMD_DIN;
+	cmds[0].sendBuf = NULL;
+	cmds[0].sendBufLen = 0;
+	cmds[0].receiveBuf = inValues;
+	cmds[0].receiveBufLen = sizeof(inValues);
+
+	cmds[1].cmd = CMD_DOUT_R;
+	cmds[1].sendBuf = NULL;
+	cmds[1].sendBufLen = 0;
+	cmds[1].receiveBuf = (unsigned char*) outValues;
+	cmds[1].receiveBufLen = sizeof(outValues);
+
+	daqDev().queryCmds(cmds, 2);
+
+	unsigned int lowPortNum = mDioInfo.getPortNum(lowPort);
+	unsigned int highPortNum = mDioInfo.getPortNum(highPort);
+
+	int i = 0;
+	for(unsigned int portNum = lowPortNum; portNum <= highPortNum; portNum++)
+	{
+		DigitalPortType portType = mDioInfo.getPortType(portNum);
+
+		if(portType == FIRSTPORTA || portType == SECONDPORTA)
+			data[i] = inValues[portType == SECONDPORTA ? 1 : 0];
+		else
+			data[i] = outValues[portType == SECONDPORTB ? 1 : 0];
+
+		i++;
+	}
+}
+
 void DioETc32::dOut(DigitalPortType portType, unsigned long long data)
 {
 	DigitalPortType portTypeCheck = portType;
@@ -0,0 +1,577 @@
+#!/usr/bin/env python3
+#
+# netdevsim.py
+#
+#     Author: Measurement Computing Corporation
+#
+# Simulates an Ethernet DAQ device on the local machine so the network code of the library (discovery, command
+# frames and the scan data socket) can be exercised without the hardware.
+#
+#   python3 netdevsim.py [--device e1608|e1808] [--port <port>] [options]
+#
+# The device answers the discovery and connection code requests on the UDP port, accepts the command connection on
+# the TCP port and the scan data connection on the TCP port + 1, as the hardware does.
+#
+# E-1608     commands are sent in NetFrame frames. Analog input scans stream 16-bit samples, a ramp per channel,
+#            at the rate set by the pacer period of the scan. DIO, AO, counter and memory commands are supported.
+# E-1808     commands are sent in TNetFrameVir frames (virnet.h). Analog input scans stream 8-byte samples at the
+#            rate requested by the scan.
+#
+# The library does not use the loopback interface, use the address of another interface of the machine as the host
+# of ulGetNetDaqDeviceDescriptor(), e.g. the RemoteNetDiscovery example followed by a scan. The NetBenchmark example
+# measures the command latency and the scan throughput of the library against the simulated device:
+#
+#   python3 netdevsim.py --port 54300 &
+#   examples/NetBenchmark <address> 54300 [seconds] [rate]
+#
+# The NetChecks example checks the behavior of the network code that needs a simulated device with the options below:
+#
+#   python3 netdevsim.py --port 54300 --discovery-latency 200 --latency 20 --oversized-ain 2 &
+#   examples/NetChecks <address> 54300
+#
+#   --rate <samples/s>     streams scans at this sample rate instead of the rate of the scan, 0 for as fast as the
+#                          host reads the data
+#   --packet-size <bytes>  size of the data sent on the data socket at a time (default 1024)
+#   --fragment <bytes>     splits the command replies and the data packets into segments of at most this size, use
+#                          a size that is not a multiple of the sample size to exercise the partial sample handling
+#   --latency <ms>         delay before each command reply
+#   --discovery-latency <ms>
+#                          delay before each discovery reply, makes a discovery distinguishable from a cached lookup
+#   --oversized-ain <chan code>
+#                          the CMD_AIN replies for this channel code carry extra bytes, the host has to discard the
+#                          replies of the commands it sent after it to stay in step with the device
+#   --connection-code <n>  connection code of the device (default 0)
+
+import argparse
+import datetime
+import select
+import socket
+import struct
+import sys
+import threading
+import time
+
+FRAME_START = 0xDB
+DISCOVERY_CMD = 0x44
+CONNECTION_CMD = 0x43
+DISCOVERY_PORT = 54211
+
+STATUS_DATA_SOCKET_CONNECTED = 1
+
+# connection code replies
+CONNECTION_OK = 0
+CONNECTION_BAD_CODE = 1
+CONNECTION_IN_USE = 3
+
+# E-1608 commands
+CMD_DIN_R = 0x00
+CMD_DOUT_R = 0x02
+CMD_DOUT_W = 0x03
+CMD_DCONFIG_R = 0x04
+CMD_DCONFIG_W = 0x05
+CMD_AIN = 0x10
+CMD_AINSCAN_START = 0x11
+CMD_AINSTOP = 0x13
+CMD_AIQUEUE_R = 0x14
+CMD_AIQUEUE_W = 0x15
+CMD_AOUT = 0x21
+CMD_CTR_R = 0x30
+CMD_CTR_W = 0x31
+CMD_CAL_MEM_R = 0x40
+CMD_USER_MEM_R = 0x42
+CMD_USER_MEM_W = 0x43
+CMD_SETTINGS_MEM_R = 0x44
+CMD_SETTINGS_MEM_W = 0x45
+CMD_BLINKLED = 0x50
+CMD_RESET = 0x51
+CMD_STATUS = 0x52
+
+# virnet commands, virnet.h
+VNC_TEST = 0x101
+VNC_XFER_IN_STATE = 0x102
+VNC_XFER_OUT_STATE = 0x103
+VNC_FLASH_LED = 0x104
+VNC_AIN = 0x201
+VNC_AINSCAN = 0x202
+VNC_AINSCAN_STOP = 0x203
+VNC_AIN_LOAD_QUEUE = 0x204
+
+SO_CONTINUOUS = 1 << 3
+
+DEVICES = {
+	'e1608': {'pid': 0x12f, 'name': 'E-1608', 'virnet': False, 'sample_size': 2, 'clock': 80000000},
+	'e1808': {'pid': 0x203, 'name': 'E-1808', 'virnet': True, 'sample_size': 8, 'clock': 100000000},
+}
+
+MEM_SIZE = 4096
+
+
+def checksum(data):
+	return (0xff - sum(data)) & 0xff
+
+
+class Device(object):
+	def __init__(self, args):
+		self.args = args
+		self.model = DEVICES[args.device]
+		self.mac = bytes(int(b, 16) for b in args.mac.split(':'))
+		self.lock = threading.Lock()
+
+		self.cmd_conn = None
+		self.host_addr = '0.0.0.0'
+		self.data_conn = None
+		self.data_ready = threading.Condition(self.lock)
+
+		self.scan_thread = None
+		self.scan_stop = threading.Event()
+		self.scan_error = 0
+
+		self.dout = 0
+		self.dconfig = 0xff
+		self.ctr = 0
+		self.queue = bytes(17)
+		self.queue_len = 1
+
+		self.cal_mem = bytearray(b'\xff' * MEM_SIZE)
+		self.user_mem = bytearray(b'\xff' * MEM_SIZE)
+		self.settings_mem = bytearray(b'\xff' * MEM_SIZE)
+
+		# unity slope and zero offset for the 8 AI and 2 AO coefficients of the E-1608, then the calibration date
+		coefs = struct.pack('<ff', 1.0, 0.0)
+		self.cal_mem[0x00:0x40] = coefs * 8
+		self.cal_mem[0x40:0x50] = coefs * 2
+		now = datetime.datetime.now()
+		self.cal_mem[0x50:0x56] = bytes([now.year - 2000, now.month, now.day, now.hour, now.minute, now.second])
+
+	def log(self, msg):
+		if self.args.verbose:
+			sys.stderr.write('%.3f %s\n' % (time.time(), msg))
+
+	# replies are split into segments to exercise the reassembly code of the host
+	def send(self, conn, data):
+		fragment = self.args.fragment
+
+		if not fragment:
+			conn.sendall(data)
+			return
+
+		for start in range(0, len(data), fragment):
+			conn.sendall(data[start:start + fragment])
+
+	# unlike send() it gives up when the scan is stopped while the host is not reading the data
+	def send_data(self, conn, data):
+		fragment = self.args.fragment or len(data)
+		pos = 0
+
+		while pos < len(data):
+			if self.scan_stop.is_set():
+				return False
+
+			_, writable, _ = select.select([], [conn], [], 0.1)
+
+			if writable:
+				pos += conn.send(data[pos:pos + fragment])
+
+		return True
+
+	############################################ UDP ############################################
+
+	def discovery_reply(self):
+		port = self.args.port
+		netbios = (self.model['name'] + '-' + self.mac[3:].hex().upper()).encode()[:15]
+		host = socket.inet_aton(self.host_addr)
+		desc = struct.pack('<6sHH16sHHHH4sHB22s', self.mac, self.model['pid'], 0x0100, netbios, port, port + 1, 0, 0,
+						   host, 0x0100, 0, b'')
+		return bytes([DISCOVERY_CMD]) + desc
+
+	def udp_loop(self, sock):
+		while True:
+			data, addr = sock.recvfrom(512)
+
+			if not data:
+				continue
+
+			if data[0] == DISCOVERY_CMD:
+				self.log('discovery from %s:%d' % addr)
+
+				if self.args.discovery_latency:
+					time.sleep(self.args.discovery_latency / 1000.0)
+
+				sock.sendto(self.discovery_reply(), addr)
+
+			elif data[0] == CONNECTION_CMD and len(data) >= 5:
+				code = struct.unpack('<I', data[1:5])[0]
+
+				with self.lock:
+					if self.cmd_conn is not None:
+						result = CONNECTION_IN_USE
+					elif code != self.args.connection_code:
+						result = CONNECTION_BAD_CODE
+					else:
+						result = CONNECTION_OK
+
+				self.log('connection code %d from %s:%d, result %d' % (code, addr[0], addr[1], result))
+				sock.sendto(bytes([CONNECTION_CMD, result]), addr)
+
+	######################################## command socket ########################################
+
+	def cmd_loop(self, listener):
+		while True:
+			conn, addr = listener.accept()
+			conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+			with self.lock:
+				if self.cmd_conn is not None:
+					conn.close()
+					continue
+
+				self.cmd_conn = conn
+				self.host_addr = addr[0]
+
+			self.log('command connection from %s:%d' % addr)
+
+			try:
+				self.serve_commands(conn)
+			except (OSError, ValueError) as e:
+				self.log('command connection error: %s' % e)
+
+			self.stop_scan(True)
+
+			with self.lock:
+				self.cmd_conn = None
+
+			conn.close()
+			self.log('command connection closed')
+
+	def serve_commands(self, conn):
+		virnet = self.model['virnet']
+		# delimiter, command, frame id, status and count, the checksum follows the data
+		header = struct.Struct('<BHBBH' if virnet else '<BBBBH')
+		buf = b''
+
+		while True:
+			data = conn.recv(65536)
+
+			if not data:
+				return
+
+			buf += data
+
+			while buf:
+				# the host sends a single byte to force the ACK of the last reply, skip everything up to a frame
+				start = buf.find(bytes([FRAME_START]))
+
+				if start < 0:
+					buf = b''
+					break
+
+				buf = buf[start:]
+
+				if len(buf) < header.size:
+					break
+
+				_, cmd, frame_id, _, count = header.unpack_from(buf)
+				size = header.size + count + 1
+
+				if len(buf) < size:
+					break
+
+				frame = buf[:size]
+
+				if sum(frame) & 0xff != 0xff:
+					self.log('bad frame checksum')
+					buf = buf[1:]
+					continue
+
+				buf = buf[size:]
+				params = frame[header.size:size - 1]
+
+				if virnet:
+					status, reply = self.virnet_command(cmd, params)
+					reply_cmd = cmd | 0x8000
+				else:
+					status, reply = self.command(cmd, params)
+					reply_cmd = cmd | 0x80
+
+				if self.args.latency:
+					time.sleep(self.args.latency / 1000.0)
+
+				out = header.pack(FRAME_START, reply_cmd, frame_id, status, len(reply)) + reply
+				self.send(conn, out + bytes([checksum(out)]))
+
+	def mem_region(self, cmd):
+		if cmd == CMD_CAL_MEM_R:
+			return self.cal_mem
+		if cmd in (CMD_USER_MEM_R, CMD_USER_MEM_W):
+			return self.user_mem
+		return self.settings_mem
+
+	def command(self, cmd, params):
+		self.log('command 0x%02x %s' % (cmd, params.hex()))
+
+		if cmd == CMD_STATUS:
+			with self.lock:
+				status = STATUS_DATA_SOCKET_CONNECTED if self.data_conn is not None else 0
+				status |= self.scan_error
+			return 0, struct.pack('<H', status)
+
+		if cmd == CMD_DIN_R:
+			return 0, bytes([self.dout & ~self.dconfig & 0xff])
+		if cmd == CMD_DOUT_R:
+			return 0, bytes([self.dout])
+		if cmd == CMD_DOUT_W:
+			self.dout = params[0]
+			return 0, b''
+		if cmd == CMD_DCONFIG_R:
+			return 0, bytes([self.dconfig])
+		if cmd == CMD_DCONFIG_W:
+			self.dconfig = params[0]
+			return 0, b''
+
+		# the value of each channel differs, a reply matched to the wrong command is detected by the host
+		if cmd == CMD_AIN:
+			value = struct.pack('<H', 0x8000 + params[0] * 0x100)
+			if params[0] == self.args.oversized_ain:
+				value += b'\0\0'
+			return 0, value
+		if cmd == CMD_AIQUEUE_R:
+			return 0, self.queue
+		if cmd == CMD_AIQUEUE_W:
+			self.queue = params.ljust(17, b'\0')
+			self.queue_len = max(params[0], 1)
+			return 0, b''
+		if cmd == CMD_AINSCAN_START:
+			scan_count, pacer_period, _ = struct.unpack('<IIB', params[:9])
+			sample_rate = self.model['clock'] / (pacer_period + 1.0) if pacer_period else 0
+			self.start_scan(self.queue_len, scan_count, sample_rate)
+			return 0, b''
+		if cmd == CMD_AINSTOP:
+			self.stop_scan(len(params) > 0 and params[0] != 0)
+			return 0, b''
+
+		if cmd == CMD_CTR_R:
+			return 0, struct.pack('<I', self.ctr)
+		if cmd == CMD_CTR_W:
+			self.ctr = 0
+			return 0, b''
+
+		if cmd in (CMD_CAL_MEM_R, CMD_USER_MEM_R, CMD_SETTINGS_MEM_R):
+			address, count = struct.unpack('<HH', params[:4])
+			return 0, bytes(self.mem_region(cmd)[address:address + count])
+		if cmd in (CMD_USER_MEM_W, CMD_SETTINGS_MEM_W):
+			address = struct.unpack('<H', params[:2])[0]
+			data = params[2:]
+			self.mem_region(cmd)[address:address + len(data)] = data
+			return 0, b''
+
+		# CMD_AOUT, CMD_BLINKLED, CMD_RESET and the commands that are not simulated
+		return 0, b''
+
+	def virnet_command(self, cmd, params):
+		self.log('virnet command 0x%03x %s' % (cmd, params.hex()))
+
+		if cmd == VNC_XFER_IN_STATE:
+			with self.lock:
+				ready = self.data_conn is not None
+				active = self.scan_thread is not None and self.scan_thread.is_alive()
+			return 0, struct.pack('<BBB', ready, active, 0)
+		if cmd == VNC_AIN:
+			return 0, struct.pack('<d', 0.0)
+		if cmd == VNC_AINSCAN:
+			low_chan, high_chan, _, _, samples_per_chan, rate, options, _ = struct.unpack('<BBBBidIB', params[:21])
+			chan_count = high_chan - low_chan + 1
+			scan_count = 0 if options & SO_CONTINUOUS else samples_per_chan
+			self.start_scan(chan_count, scan_count, rate * chan_count)
+			return 0, struct.pack('<d', rate)
+		if cmd == VNC_AINSCAN_STOP:
+			self.stop_scan(True)
+			return 0, b''
+
+		# VNC_TEST, VNC_FLASH_LED and VNC_AIN_LOAD_QUEUE
+		return 0, b''
+
+	########################################## data socket ##########################################
+
+	def data_loop(self, listener):
+		while True:
+			with self.lock:
+				conn = self.data_conn
+
+			try:
+				readable, _, _ = select.select([listener] + ([conn] if conn else []), [], [])
+			except (OSError, ValueError):
+				# the connection was closed by the command thread
+				continue
+
+			# the host closes the data socket at the end of each scan
+			if conn in readable:
+				try:
+					closed = not conn.recv(4096)
+				except OSError:
+					closed = True
+
+				if closed:
+					self.close_data_conn(conn)
+
+			if listener in readable:
+				new_conn, addr = listener.accept()
+				new_conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+				with self.lock:
+					old_conn = self.data_conn
+					self.data_conn = new_conn
+					self.data_ready.notify_all()
+
+				if old_conn:
+					old_conn.close()
+
+				self.log('data connection from %s:%d' % addr)
+
+	def close_data_conn(self, conn):
+		with self.lock:
+			if self.data_conn is not conn:
+				return
+			self.data_conn = None
+
+		try:
+			conn.shutdown(socket.SHUT_RDWR)
+		except OSError:
+			pass
+
+		conn.close()
+		self.log('data connection closed')
+
+	def start_scan(self, chan_count, scan_count, sample_rate):
+		self.stop_scan(False)
+
+		if self.args.rate is not None:
+			sample_rate = self.args.rate
+
+		# the start command is sent right after the data socket is connected, wait for it to be accepted
+		with self.lock:
+			if self.data_conn is None:
+				self.data_ready.wait(1.0)
+			conn = self.data_conn
+
+		if conn is None:
+			self.log('scan started without a data connection')
+			return
+
+		self.log('scan of %d channels, %d scans at %.0f samples/s' % (chan_count, scan_count, sample_rate))
+
+		self.scan_stop.clear()
+		self.scan_thread = threading.Thread(target=self.scan_loop, args=(conn, chan_count, scan_count, sample_rate))
+		self.scan_thread.daemon = True
+		self.scan_thread.start()
+
+	def stop_scan(self, close_socket):
+		self.scan_stop.set()
+
+		if self.scan_thread is not None:
+			self.scan_thread.join()
+			self.scan_thread = None
+
+		if close_socket:
+			with self.lock:
+				conn = self.data_conn
+
+			if conn:
+				self.close_data_conn(conn)
+
+	def scan_pattern(self, chan_count, scans):
+		if self.model['sample_size'] == 2:
+			samples = [(scan + chan * 0x1000) & 0xffff for scan in range(scans) for chan in range(chan_count)]
+			return struct.pack('<%dH' % len(samples), *samples)
+
+		samples = [scan * 0.001 + chan for scan in range(scans) for chan in range(chan_count)]
+		return struct.pack('<%dd' % len(samples), *samples)
+
+	def scan_loop(self, conn, chan_count, scan_count, sample_rate):
+		sample_size = self.model['sample_size']
+		packet_size = self.args.packet_size
+		total = scan_count * chan_count * sample_size
+
+		# a block of whole scans that is sent over and over, doubled so a packet can be sliced from any offset. The
+		# 16-bit ramps wrap around at the end of the block so they continue seamlessly
+		pattern_scans = max(0x10000, packet_size // (chan_count * sample_size) + 1)
+		pattern = self.scan_pattern(chan_count, pattern_scans)
+		pattern_len = len(pattern)
+		pattern = memoryview(pattern + pattern)
+
+		byte_rate = sample_rate * sample_size
+		start = time.monotonic()
+		sent = 0
+
+		try:
+			while not self.scan_stop.is_set() and (total == 0 or sent < total):
+				size = packet_size if total == 0 else min(packet_size, total - sent)
+
+				if byte_rate > 0:
+					due = (time.monotonic() - start) * byte_rate
+
+					if due < sent + size:
+						time.sleep(min((sent + size - due) / byte_rate, 0.01))
+						continue
+
+				offset = sent % pattern_len
+
+				if not self.send_data(conn, pattern[offset:offset + size]):
+					break
+
+				sent += size
+
+		except (OSError, ValueError) as e:
+			self.log('data connection error: %s' % e)
+
+		elapsed = time.monotonic() - start
+		self.log('scan done, %d bytes in %.3f s (%.1f MB/s)' % (sent, elapsed, sent / elapsed / 1e6 if elapsed else 0))
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Simulates an Ethernet DAQ device on the local machine')
+	parser.add_argument('--device', choices=sorted(DEVICES.keys()), default='e1608')
+	parser.add_argument('--port', type=int, default=DISCOVERY_PORT)
+	parser.add_argument('--mac', default='00:80:2F:00:00:01')
+	parser.add_argument('--connection-code', type=int, default=0)
+	parser.add_argument('--rate', type=float, default=None)
+	parser.add_argument('--packet-size', type=int, default=1024)
+	parser.add_argument('--fragment', type=int, default=0)
+	parser.add_argument('--latency', type=float, default=0)
+	parser.add_argument('--discovery-latency', type=float, default=0)
+	parser.add_argument('--oversized-ain', type=int, default=-1)
+	parser.add_argument('--verbose', action='store_true')
+	args = parser.parse_args()
+
+	device = Device(args)
+
+	udp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+	udp.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+	udp.bind(('', args.port))
+
+	listeners = []
+
+	for port in (args.port, args.port + 1):
+		listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+		listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+		listener.bind(('', port))
+		listener.listen(1)
+		listeners.append(listener)
+
+	for target, sock in ((device.udp_loop, udp), (device.cmd_loop, listeners[0]), (device.data_loop, listeners[1])):
+		thread = threading.Thread(target=target, args=(sock,))
+		thread.daemon = True
+		thread.start()
+
+	sys.stderr.write('%s %s listening on port %d\n' % (device.model['name'], args.mac, args.port))
+
+	try:
+		while True:
+			time.sleep(1)
+	except KeyboardInterrupt:
+		pass
+
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
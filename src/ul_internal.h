@@ -81,6 +81,24 @@ static inline void ul_clock_realtime (struct timespec* ts)
 #endif
 }
 
+static inline unsigned long long ul_clock_monotonic_ns()
+{
+#ifdef __APPLE__
+	clock_serv_t cclock;
+	mach_timespec_t mts;
+	host_get_clock_service(mach_host_self(), SYSTEM_CLOCK, &cclock);
+	clock_get_time(cclock, &mts);
+	mach_port_deallocate(mach_task_self(), cclock);
+
+	return ((unsigned long long) mts.tv_sec) * 1000000000ULL + mts.tv_nsec;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((unsigned long long) ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
 
 	typedef struct
 	{
@@ -138,7 +156,11 @@ static inline void ul_clock_realtime (struct timespec* ts)
 	typedef enum
 	{
 		DATA_UINT64 = 1,
-		DATA_DBL	= 2
+		DATA_DBL	= 2,
+		DATA_RAW	= 3,
+		DATA_FLOAT	= 4,
+		DATA_UINT16	= 5,
+		DATA_UINT32	= 6
 	}ScanDataBufferType;
 
 	typedef enum
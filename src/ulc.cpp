@@ -5,6 +5,7 @@
  */
 
 #include <libusb-1.0/libusb.h>
+#include <limits.h>
 #include "./ul_internal.h"
 #include "./DaqDeviceManager.h"
 #include "./DaqDevice.h"
@@ -17,8 +18,16 @@
 #include "./DaqODevice.h"
 #include "./DaqEventHandler.h"
 #include "./utility/ErrorMap.h"
+#include "./utility/Trace.h"
+#include "./utility/ScanDataConverter.h"
 #include "./usb/UsbDaqDevice.h"
+#include "./usb/UsbFpgaDevice.h"
+#include "./usb/UsbDeviceInventory.h"
+#include "./usb/UsbScanGroup.h"
+#include "./usb/UsbSimDevice.h"
 #include "./hid/HidDaqDevice.h"
+#include "./net/NetDiscovery.h"
+#include "./net/NetDaqDevice.h"
 #include "uldaq.h"
 #include "UlDaqDeviceManager.h"
 #include "UlException.h"
@@ -188,6 +197,216 @@ UlError ulConnectDaqDevice(DaqDeviceHandle daqDeviceHandle)
 }
 
 
+typedef struct
+{
+	DaqDevice* daqDevice;
+	UlError error;
+} ConnectRequest;
+
+static void* connectDaqDeviceThread(void* arg)
+{
+	ConnectRequest* request = (ConnectRequest*) arg;
+
+	try
+	{
+		request->daqDevice->connect();
+	}
+	catch(UlException& e)
+	{
+		request->error = e.getError();
+	}
+	catch(...)
+	{
+		request->error = ERR_UNHANDLED_EXCEPTION;
+	}
+
+	return NULL;
+}
+
+UlError ulConnectDaqDevices(DaqDeviceHandle daqDeviceHandles[], unsigned int count, UlError errors[])
+{
+	UL_LOG("ulConnectDaqDevices() <----");
+
+	if(daqDeviceHandles == NULL || count == 0)
+		return ERR_BAD_ARG;
+
+	UlError error = ERR_NO_ERROR;
+
+	std::vector<ConnectRequest> requests(count);
+	std::vector<pthread_t> threads(count);
+	std::vector<bool> started(count, false);
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		requests[i].daqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandles[i]);
+		requests[i].error = requests[i].daqDevice ? ERR_NO_ERROR : ERR_BAD_DEV_HANDLE;
+	}
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		if(requests[i].daqDevice)
+		{
+			if(pthread_create(&threads[i], NULL, &connectDaqDeviceThread, &requests[i]) == 0)
+				started[i] = true;
+			else
+				connectDaqDeviceThread(&requests[i]);
+		}
+	}
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		if(started[i])
+			pthread_join(threads[i], NULL);
+
+		if(errors)
+			errors[i] = requests[i].error;
+
+		if(error == ERR_NO_ERROR)
+			error = requests[i].error;
+	}
+
+	UL_LOG("ulConnectDaqDevices() ---->");
+
+	return error;
+}
+
+static UlError getGroupDevices(DaqDeviceHandle daqDeviceHandles[], unsigned int count, std::vector<DaqDevice*>& daqDevices)
+{
+	if(daqDeviceHandles == NULL || count == 0)
+		return ERR_BAD_ARG;
+
+	for(unsigned int i = 0; i < count; i++)
+	{
+		DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandles[i]);
+
+		if(pDaqDevice == NULL)
+			return ERR_BAD_DEV_HANDLE;
+
+		daqDevices.push_back(pDaqDevice);
+	}
+
+	return ERR_NO_ERROR;
+}
+
+UlError ulScanGroupBegin(DaqDeviceHandle daqDeviceHandles[], unsigned int count)
+{
+	UL_LOG("ulScanGroupBegin() <----");
+
+	std::vector<DaqDevice*> daqDevices;
+
+	UlError error = getGroupDevices(daqDeviceHandles, count, daqDevices);
+
+	if(error == ERR_NO_ERROR)
+	{
+		try
+		{
+			UsbScanGroup::begin(daqDevices);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+
+	UL_LOG("ulScanGroupBegin() ---->");
+
+	return error;
+}
+
+UlError ulScanGroupStart(DaqDeviceHandle daqDeviceHandles[], unsigned int count, double* startSkew)
+{
+	UL_LOG("ulScanGroupStart() <----");
+
+	std::vector<DaqDevice*> daqDevices;
+
+	UlError error = getGroupDevices(daqDeviceHandles, count, daqDevices);
+
+	if(error == ERR_NO_ERROR)
+	{
+		try
+		{
+			double skew = UsbScanGroup::start(daqDevices);
+
+			if(startSkew)
+				*startSkew = skew;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+
+	UL_LOG("ulScanGroupStart() ---->");
+
+	return error;
+}
+
+UlError ulScanGroupStatus(DaqDeviceHandle daqDeviceHandles[], unsigned int count, ScanStatus* status, TransferStatus xferStatus[])
+{
+	std::vector<DaqDevice*> daqDevices;
+
+	UlError error = getGroupDevices(daqDeviceHandles, count, daqDevices);
+
+	if(error == ERR_NO_ERROR)
+	{
+		if(status == NULL)
+			return ERR_BAD_ARG;
+
+		try
+		{
+			error = UsbScanGroup::getStatus(daqDevices, status, xferStatus);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+
+	return error;
+}
+
+UlError ulScanGroupStop(DaqDeviceHandle daqDeviceHandles[], unsigned int count)
+{
+	UL_LOG("ulScanGroupStop() <----");
+
+	std::vector<DaqDevice*> daqDevices;
+
+	UlError error = getGroupDevices(daqDeviceHandles, count, daqDevices);
+
+	if(error == ERR_NO_ERROR)
+	{
+		try
+		{
+			error = UsbScanGroup::stop(daqDevices);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+
+	UL_LOG("ulScanGroupStop() ---->");
+
+	return error;
+}
+
+
 UlError ulDisconnectDaqDevice(DaqDeviceHandle daqDeviceHandle)
 {
 	UL_LOG("ulDisconnectDaqDevice() <----");
@@ -367,6 +586,40 @@ UlError ulAIn(DaqDeviceHandle daqDeviceHandle, int channel, AiInputMode mode, Ra
 	return error;
 }
 
+UlError ulAInSnapshot(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[])
+{
+	FnLog log("ulAInSnapshot()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			AiDevice* aiDev = pDaqDevice->aiDevice();
+
+			if(aiDev)
+				aiDev->aInSnapshot(lowChan, highChan, inputMode, range, flags, data);
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
 UlError ulAInScan(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double* rate, ScanOption options, AInScanFlag flags, double data[])
 {
 	FnLog log("ulAInScan()");
@@ -384,7 +637,12 @@ UlError ulAInScan(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, Ai
 			if(aiDev)
 			{
 				if(rate)
+				{
+					if(pDaqDevice->scanRecorderEnabled(FT_AI))
+						pDaqDevice->setScanRecorderChannels(FT_AI, aiDev->getScanChanDescriptors(lowChan, highChan, inputMode, range));
+
 					*rate = aiDev->aInScan(lowChan, highChan, inputMode, range, samplesPerChan, *rate, options, flags, data);
+				}
 				else
 					error = ERR_BAD_ARG;
 			}
@@ -406,6 +664,79 @@ UlError ulAInScan(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, Ai
 	return error;
 }
 
+UlError ulAInScanRaw(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double* rate, ScanOption options, AInScanFlag flags, void* data)
+{
+	FnLog log("ulAInScanRaw()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			AiDevice* aiDev = pDaqDevice->aiDevice();
+
+			if(aiDev)
+			{
+				if(rate)
+					*rate = aiDev->aInScanRaw(lowChan, highChan, inputMode, range, samplesPerChan, *rate, options, flags, data);
+				else
+					error = ERR_BAD_ARG;
+			}
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
+UlError ulAInScanCoefs(DaqDeviceHandle daqDeviceHandle, double slopes[], double offsets[], unsigned int* numChans)
+{
+	FnLog log("ulAInScanCoefs()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			AiDevice* aiDev = pDaqDevice->aiDevice();
+
+			if(aiDev)
+				aiDev->getScanCoefs(slopes, offsets, numChans);
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
 UlError ulAInScanStatus(DaqDeviceHandle daqDeviceHandle, ScanStatus* status, TransferStatus* xferStatus)
 {
 	//FnLog log("UlGetAInScanStatus()");
@@ -474,6 +805,40 @@ UlError ulAInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long l
 	return error;
 }
 
+UlError ulAInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	FnLog log("ulAInScanRead()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			AiDevice* aiDev = pDaqDevice->aiDevice();
+
+			if(aiDev)
+				error = aiDev->readScanData(scanCount, timeout, data, scansRead);
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
 UlError ulAInScanStop(DaqDeviceHandle daqDeviceHandle)
 {
 	FnLog log("ulAInScanStop()");
@@ -1204,7 +1569,12 @@ UlError ulDInScan(DaqDeviceHandle daqDeviceHandle, DigitalPortType lowPort, Digi
 			if(dioDev)
 			{
 				if(rate)
+				{
+					if(pDaqDevice->scanRecorderEnabled(FT_DI))
+						pDaqDevice->setScanRecorderChannels(FT_DI, dioDev->getScanChanDescriptors(lowPort, highPort));
+
 					*rate = dioDev->dInScan(lowPort, highPort, samplesPerPort, *rate, options, flags, data);
+				}
 				else
 					error = ERR_BAD_ARG;
 			}
@@ -1366,9 +1736,43 @@ UlError ulDInScanStop(DaqDeviceHandle daqDeviceHandle)
 	return error;
 }
 
-UlError ulDOutScanStop(DaqDeviceHandle daqDeviceHandle)
+UlError ulDOutScanStop(DaqDeviceHandle daqDeviceHandle)
+{
+	FnLog log("ulDOutScanStop()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			DioDevice* dioDev = pDaqDevice->dioDevice();
+
+			if(dioDev)
+				dioDev->stopBackground(SD_OUTPUT);
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
+UlError ulDInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long long waitParam, double timeout)
 {
-	FnLog log("ulDOutScanStop()");
+	FnLog log("ulDInScanWait()");
 
 	UlError error = ERR_NO_ERROR;
 
@@ -1381,7 +1785,7 @@ UlError ulDOutScanStop(DaqDeviceHandle daqDeviceHandle)
 			DioDevice* dioDev = pDaqDevice->dioDevice();
 
 			if(dioDev)
-				dioDev->stopBackground(SD_OUTPUT);
+				error = dioDev->wait(SD_INPUT, waitType, waitParam, timeout);
 			else
 				error = ERR_BAD_DEV_TYPE;
 		}
@@ -1400,9 +1804,9 @@ UlError ulDOutScanStop(DaqDeviceHandle daqDeviceHandle)
 	return error;
 }
 
-UlError ulDInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long long waitParam, double timeout)
+UlError ulDInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, unsigned long long data[], long long* scansRead)
 {
-	FnLog log("ulDInScanWait()");
+	FnLog log("ulDInScanRead()");
 
 	UlError error = ERR_NO_ERROR;
 
@@ -1415,7 +1819,7 @@ UlError ulDInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long l
 			DioDevice* dioDev = pDaqDevice->dioDevice();
 
 			if(dioDev)
-				error = dioDev->wait(SD_INPUT, waitType, waitParam, timeout);
+				error = dioDev->readScanData(SD_INPUT, scanCount, timeout, data, scansRead);
 			else
 				error = ERR_BAD_DEV_TYPE;
 		}
@@ -1776,7 +2180,12 @@ UlError ulCInScan(DaqDeviceHandle daqDeviceHandle, int lowCounterNum, int highCo
 			if(ctrDev)
 			{
 				if(rate)
+				{
+					if(pDaqDevice->scanRecorderEnabled(FT_CTR))
+						pDaqDevice->setScanRecorderChannels(FT_CTR, ctrDev->getScanChanDescriptors(lowCounterNum, highCounterNum, flags));
+
 					*rate = ctrDev->cInScan(lowCounterNum, highCounterNum, samplesPerCounter, *rate, options, flags, data);
+				}
 				else
 					error = ERR_BAD_ARG;
 			}
@@ -1866,6 +2275,40 @@ UlError ulCInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long l
 	return error;
 }
 
+UlError ulCInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, unsigned long long data[], long long* scansRead)
+{
+	FnLog log("ulCInScanRead()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			CtrDevice* ctrDev = pDaqDevice->ctrDevice();
+
+			if(ctrDev)
+				error = ctrDev->readScanData(scanCount, timeout, data, scansRead);
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
 UlError ulCInScanStop(DaqDeviceHandle daqDeviceHandle)
 {
 	FnLog log("ulCInScanStop()");
@@ -2093,7 +2536,12 @@ UlError ulDaqInScan(DaqDeviceHandle daqDeviceHandle, DaqInChanDescriptor chanDes
 			if(daqIDev)
 			{
 				if(rate)
+				{
+					if(pDaqDevice->scanRecorderEnabled(FT_DAQI) && chanDescriptors != NULL && numChans > 0)
+						pDaqDevice->setScanRecorderChannels(FT_DAQI, std::vector<DaqInChanDescriptor>(chanDescriptors, chanDescriptors + numChans));
+
 					*rate = daqIDev->daqInScan(chanDescriptors, numChans, samplesPerChan, *rate, options, flags, data);
+				}
 				else
 					error = ERR_BAD_ARG;
 			}
@@ -2183,6 +2631,40 @@ UlError ulDaqInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long
 	return error;
 }
 
+UlError ulDaqInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	FnLog log("ulDaqInScanRead()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			DaqIDevice* daqIDev = pDaqDevice->daqIDevice();
+
+			if(daqIDev)
+				error = daqIDev->readScanData(FT_DAQI, scanCount, timeout, data, scansRead);
+			else
+				error = ERR_BAD_DEV_TYPE;
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
 UlError ulDaqInScanStop(DaqDeviceHandle daqDeviceHandle)
 {
 	FnLog log("ulAInScanStop()");
@@ -2488,6 +2970,128 @@ UlError ulDisableEvent(DaqDeviceHandle daqDeviceHandle, DaqEventType eventTypes)
 	return error;
 }
 
+UlError ulScanRecorderEnable(DaqDeviceHandle daqDeviceHandle, ScanRecorderSource source, const char* pathPrefix, int segmentCount, long long segmentSize)
+{
+	FnLog log("ulScanRecorderEnable()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			pDaqDevice->enableScanRecorder(source, pathPrefix, segmentCount, segmentSize);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
+UlError ulScanRecorderDisable(DaqDeviceHandle daqDeviceHandle, ScanRecorderSource source)
+{
+	FnLog log("ulScanRecorderDisable()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			pDaqDevice->disableScanRecorder(source);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
+UlError ulScanRecorderGetStatus(DaqDeviceHandle daqDeviceHandle, ScanRecorderSource source, ScanRecorderStatus* status)
+{
+	FnLog log("ulScanRecorderGetStatus()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			pDaqDevice->getScanRecorderStatus(source, status);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
+UlError ulDevGetScanStats(DaqDeviceHandle daqDeviceHandle, unsigned int index, ScanStats* stats)
+{
+	FnLog log("ulDevGetScanStats()");
+
+	UlError error = ERR_NO_ERROR;
+
+	DaqDevice* pDaqDevice = DaqDeviceManager::getActualDeviceHandle(daqDeviceHandle);
+
+	if(pDaqDevice)
+	{
+		try
+		{
+			if(index > 1)
+				throw UlException(ERR_BAD_ARG);
+
+			if(stats == NULL)
+				throw UlException(ERR_BAD_BUFFER);
+
+			pDaqDevice->getScanStats(index == 0 ? SD_INPUT : SD_OUTPUT, stats);
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
+	}
+	else
+		error = ERR_BAD_DEV_HANDLE;
+
+	return error;
+}
+
 UlError ulMemRead(DaqDeviceHandle daqDeviceHandle, MemRegion memRegion, unsigned int address, unsigned char* buffer, unsigned int count)
 {
 	FnLog log("ulMemRead()");
@@ -2631,6 +3235,65 @@ UlError ulSetConfig(UlConfigItem configItem, unsigned int index, long long confi
 		case UL_CFG_USB_XFER_PRIORITY:
 			UsbDaqDevice::setUsbEventHandlerThreadPriority(configValue);
 			break;
+		case UL_CFG_USB_EVENT_CONTEXT:
+			UsbDaqDevice::setUsbEventContextMode(configValue);
+			break;
+		case UL_CFG_USB_INVENTORY_CACHE:
+			UsbDeviceInventory::setEnabled(configValue != 0);
+			break;
+		case UL_CFG_USB_INVENTORY_RESCAN:
+			if(UsbDeviceInventory::isEnabled())
+				UsbDeviceInventory::rescan();
+			break;
+		case UL_CFG_NET_DISCOVERY_CACHE_TTL:
+			if(configValue >= 0 && configValue <= INT_MAX)
+				NetDiscovery::setCacheTtl((int) configValue);
+			else
+				error = ERR_BAD_CONFIG_VAL;
+			break;
+
+		case UL_CFG_NET_SCAN_BUSY_POLL:
+			if(configValue >= 0 && configValue <= INT_MAX)
+				NetDaqDevice::setScanBusyPoll((int) configValue);
+			else
+				error = ERR_BAD_CONFIG_VAL;
+			break;
+
+		case UL_CFG_TRACE:
+			Trace::setEnabled(configValue != 0);
+			break;
+
+		case UL_CFG_TRACE_DUMP:
+			Trace::dump(configValue != 0);
+			break;
+
+		case UL_CFG_TRACE_RESET:
+			Trace::reset();
+			break;
+
+		case UL_CFG_USB_FPGA_FILE_OVERRIDE:
+			UsbFpgaDevice::setFpgaFileOverride(configValue != 0);
+			break;
+
+		case UL_CFG_USB_SIM_DEVICE:
+			if(configValue == 0)
+				UsbSimDevice::removeDevices();
+			else if(configValue > 0 && configValue <= USHRT_MAX)
+				UsbSimDevice::addDevice((unsigned int) configValue);
+			else
+				error = ERR_BAD_CONFIG_VAL;
+			break;
+
+		case UL_CFG_USB_SIM_RATE:
+			UsbSimDevice::setRate(configValue);
+			break;
+
+		case UL_CFG_SCAN_CONVERTER_ISA:
+			if(configValue >= 0 && configValue <= ScanDataConverter::ISA_NEON + 1)
+				ScanDataConverter::setIsa((int) configValue - 1);
+			else
+				error = ERR_BAD_CONFIG_VAL;
+			break;
 
 		default:
 			error = ERR_BAD_CONFIG_ITEM;
@@ -2663,6 +3326,43 @@ UlError ulGetConfig(UlConfigItem configItem, unsigned int index, long long* conf
 		case UL_CFG_USB_XFER_PRIORITY:
 			*configValue = UsbDaqDevice::getUsbEventHandlerThreadPriority();
 			break;
+		case UL_CFG_USB_EVENT_CONTEXT:
+			*configValue = UsbDaqDevice::getUsbEventContextMode();
+			break;
+		case UL_CFG_USB_INVENTORY_CACHE:
+			*configValue = UsbDeviceInventory::getEnabled();
+			break;
+		case UL_CFG_NET_DISCOVERY_CACHE_TTL:
+			*configValue = NetDiscovery::getCacheTtl();
+			break;
+
+		case UL_CFG_NET_SCAN_BUSY_POLL:
+			*configValue = NetDaqDevice::getScanBusyPoll();
+			break;
+
+		case UL_CFG_TRACE:
+			*configValue = Trace::isEnabled();
+			break;
+
+		case UL_CFG_TRACE_STATS_COUNT:
+			*configValue = Trace::getPointCount();
+			break;
+
+		case UL_CFG_USB_FPGA_FILE_OVERRIDE:
+			*configValue = UsbFpgaDevice::getFpgaFileOverride();
+			break;
+
+		case UL_CFG_USB_SIM_DEVICE:
+			*configValue = UsbSimDevice::getDeviceCount();
+			break;
+
+		case UL_CFG_USB_SIM_RATE:
+			*configValue = UsbSimDevice::getRate();
+			break;
+
+		case UL_CFG_SCAN_CONVERTER_ISA:
+			*configValue = ScanDataConverter::getIsa() + 1;
+			break;
 
 		default:
 			error = ERR_BAD_CONFIG_ITEM;
@@ -2680,6 +3380,18 @@ UlError ulGetConfig(UlConfigItem configItem, unsigned int index, long long* conf
 	return error;
 }
 
+UlError ulGetTraceStats(unsigned int index, TraceStats* stats)
+{
+	UlError error = ERR_NO_ERROR;
+
+	if(stats == NULL)
+		error = ERR_BAD_BUFFER;
+	else if(!Trace::getStats(index, stats))
+		error = ERR_BAD_ARG;
+
+	return error;
+}
+
 UlError ulDevGetInfo(DaqDeviceHandle daqDeviceHandle, DevInfoItem infoItem, unsigned int index, long long* infoValue)
 {
 	FnLog log("ulDevGetInfo()");
@@ -2773,6 +3485,39 @@ UlError ulDevSetConfig(DaqDeviceHandle daqDeviceHandle, DevConfigItem configItem
 			case DEV_CFG_RESET:
 				devConfig.reset();
 				break;
+			case DEV_CFG_SCAN_XFER_COUNT:
+				devConfig.setScanXferCount(index, configValue);
+				break;
+			case DEV_CFG_SCAN_STAGE_SIZE:
+				devConfig.setScanStageSize(index, configValue);
+				break;
+			case DEV_CFG_SCAN_STAGE_LATENCY:
+				devConfig.setScanStageLatency(index, configValue);
+				break;
+			case DEV_CFG_EVENT_DELIVERY:
+				devConfig.setEventDelivery(configValue);
+				break;
+			case DEV_CFG_EVENT_THREAD_CPU:
+				devConfig.setEventThreadCpu(configValue);
+				break;
+			case DEV_CFG_EVENT_STATS:
+				devConfig.resetEventStats();
+				break;
+			case DEV_CFG_USB_XFER_PRIORITY:
+				devConfig.setUsbXferPriority(configValue);
+				break;
+			case DEV_CFG_USB_XFER_RT_PRIORITY:
+				devConfig.setUsbXferRtPriority(configValue);
+				break;
+			case DEV_CFG_USB_XFER_CPU:
+				devConfig.setUsbXferCpu(configValue);
+				break;
+			case DEV_CFG_SCAN_PIPELINE:
+				devConfig.setScanPipeline(configValue);
+				break;
+			case DEV_CFG_SCAN_CONVERSION_THREADS:
+				devConfig.setScanConversionThreads(configValue);
+				break;
 
 			default:
 				error = ERR_BAD_CONFIG_ITEM;
@@ -2818,6 +3563,42 @@ UlError ulDevGetConfig(DaqDeviceHandle daqDeviceHandle, DevConfigItem configItem
 			case DEV_CFG_MEM_UNLOCK_CODE:
 				*configValue = devConfig.getMemUnlockCode();
 				break;
+			case DEV_CFG_SCAN_XFER_COUNT:
+				*configValue = devConfig.getScanXferCount(index);
+				break;
+			case DEV_CFG_SCAN_STAGE_SIZE:
+				*configValue = devConfig.getScanStageSize(index);
+				break;
+			case DEV_CFG_SCAN_STAGE_LATENCY:
+				*configValue = devConfig.getScanStageLatency(index);
+				break;
+			case DEV_CFG_EVENT_DELIVERY:
+				*configValue = devConfig.getEventDelivery();
+				break;
+			case DEV_CFG_EVENT_THREAD_CPU:
+				*configValue = devConfig.getEventThreadCpu();
+				break;
+			case DEV_CFG_EVENT_STATS:
+				*configValue = devConfig.getEventStat(index);
+				break;
+			case DEV_CFG_USB_XFER_PRIORITY:
+				*configValue = devConfig.getUsbXferPriority();
+				break;
+			case DEV_CFG_USB_XFER_RT_PRIORITY:
+				*configValue = devConfig.getUsbXferRtPriority();
+				break;
+			case DEV_CFG_USB_XFER_CPU:
+				*configValue = devConfig.getUsbXferCpu();
+				break;
+			case DEV_CFG_SCAN_PIPELINE:
+				*configValue = devConfig.getScanPipeline();
+				break;
+			case DEV_CFG_SCAN_CONVERSION_THREADS:
+				*configValue = devConfig.getScanConversionThreads();
+				break;
+			case DEV_CFG_HW_INIT_PROGRESS:
+				*configValue = devConfig.getHwInitProgress();
+				break;
 
 			default:
 				error = ERR_BAD_CONFIG_ITEM;
@@ -3295,6 +4076,9 @@ UlError ulAIGetInfo(DaqDeviceHandle daqDeviceHandle, AiInfoItem infoItem, unsign
 					case AI_INFO_FIFO_SIZE:
 						*infoValue = aiInfo.getFifoSize();
 						break;
+					case AI_INFO_SAMPLE_SIZE:
+						*infoValue = aiInfo.getSampleSize();
+						break;
 					case AI_INFO_IEPE_SUPPORTED:
 						*infoValue = aiInfo.supportsIepe();
 						break;
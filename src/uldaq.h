@@ -422,7 +422,13 @@ typedef enum
 	ERR_NET_BUFFER_OVERRUN 			= 108,
 
 	/** Invalid network buffer */
-	ERR_BAD_NET_BUFFER 				= 109
+	ERR_BAD_NET_BUFFER 				= 109,
+
+	/** Scan buffer overrun, data was overwritten before it was read */
+	ERR_SCAN_BUFFER_OVERRUN 		= 110,
+
+	/** Scan recorder file could not be created or written */
+	ERR_SCAN_RECORDER_IO 			= 111
 } UlError;
 
 /** A/D channel input modes */
@@ -1102,6 +1108,9 @@ typedef enum
 #define NOCALIBRATEDATA 	1 << 1
 #define SIMULTANEOUS		1 << 2
 #define NOCLEAR				1 << 3
+#define FLOAT32DATA			1 << 4
+#define UINT16DATA			1 << 5
+#define UINT32DATA			1 << 6
 #endif /*doxy_skip */
 
 /** Used with many analog input and output functions, as well as a return value for the \p infoValue argument
@@ -1158,7 +1167,18 @@ typedef enum
 	AINSCAN_FF_NOSCALEDATA 			= NOSCALEDATA, 		
 
 	/** Data is returned without calibration factors applied. */
-	AINSCAN_FF_NOCALIBRATEDATA 		= NOCALIBRATEDATA 	
+	AINSCAN_FF_NOCALIBRATEDATA 		= NOCALIBRATEDATA,
+
+	/** Data is returned as 32-bit floats. The \p data argument of ulAInScan() must point to a float array cast to double*. */
+	AINSCAN_FF_FLOAT32DATA			= FLOAT32DATA,
+
+	/** Data is returned as calibrated 16-bit counts, rounded and clamped to the range 0 to 65535. Requires ::AINSCAN_FF_NOSCALEDATA.
+	 * The \p data argument of ulAInScan() must point to an unsigned short array cast to double*. */
+	AINSCAN_FF_UINT16DATA			= UINT16DATA,
+
+	/** Data is returned as calibrated 32-bit counts, rounded and clamped to the range 0 to 4294967295. Requires ::AINSCAN_FF_NOSCALEDATA.
+	 * The \p data argument of ulAInScan() must point to an unsigned int array cast to double*. */
+	AINSCAN_FF_UINT32DATA			= UINT32DATA
 }AInScanFlag;
 
 /** Use as the \p flags argument value for ulAIn() to set the properties of data returned. */
@@ -1307,7 +1327,16 @@ typedef enum
 	DAQINSCAN_FF_NOCALIBRATEDATA 	= NOCALIBRATEDATA, 	
 
 	/** Counters are not cleared (set to 0) when a scan starts. */
-	DAQINSCAN_FF_NOCLEAR			= NOCLEAR			
+	DAQINSCAN_FF_NOCLEAR			= NOCLEAR,
+
+	/** Data is returned as 32-bit floats. The \p data argument of ulDaqInScan() must point to a float array cast to double*.
+	 * Counter values above 16777216 lose precision. */
+	DAQINSCAN_FF_FLOAT32DATA		= FLOAT32DATA,
+
+	/** Data is returned as 32-bit unsigned integers; analog channels return calibrated counts rounded and clamped to the range
+	 * 0 to 4294967295. Requires ::DAQINSCAN_FF_NOSCALEDATA. The \p data argument of ulDaqInScan() must point to an unsigned int
+	 * array cast to double*. */
+	DAQINSCAN_FF_UINT32DATA			= UINT32DATA
 }DaqInScanFlag;
 
 /** Use as the \p flags argument value for ulDaqOutScan() to set the properties of data sent. */
@@ -1751,6 +1780,35 @@ typedef enum
 
 }DaqEventType;
 
+/** Used with ulDevSetConfig() and ulDevGetConfig() as the value of the #DEV_CFG_EVENT_DELIVERY config item. */
+typedef enum
+{
+	/** Event callbacks are invoked on a dedicated event thread, the default. Events are queued by the
+	 * transfer thread and delivered in order; the thread can be pinned to a CPU with #DEV_CFG_EVENT_THREAD_CPU. */
+	DED_EVENT_THREAD =			0,
+
+	/** Event callbacks are invoked directly on the thread that detects the event condition, which removes the
+	 * thread wake up latency. The callback blocks data transfers while it runs, so it must return quickly
+	 * and must not invoke any scan start, stop or wait function. */
+	DED_TRANSFER_THREAD =		1
+}DaqEventDelivery;
+
+/** Used with ulDevGetConfig() as the \p index argument value of the #DEV_CFG_EVENT_STATS config item. */
+typedef enum
+{
+	/** The sequence number of the last delivered event. Sequence numbers are assigned to events in the order they occur */
+	DES_LAST_SEQUENCE =			0,
+
+	/** The number of #DE_ON_DATA_AVAILABLE events dropped because the event queue was full */
+	DES_DROP_COUNT =			1,
+
+	/** The time in nanoseconds between the last event condition and the invocation of its callback */
+	DES_LAST_LATENCY =			2,
+
+	/** The maximum time in nanoseconds between an event condition and the invocation of its callback */
+	DES_MAX_LATENCY =			3
+}DaqEventStat;
+
 /** Used with ulMemGetInfo() as the \p memRegion argument value to specify the memory location on the specified device. */
 typedef enum
 {
@@ -1785,9 +1843,161 @@ typedef void (*DaqEventCallback)(DaqDeviceHandle, DaqEventType, unsigned long lo
 typedef enum
 {
 	/** Function returns when the scan operation completes or the time specified by the \p timeout argument value elapses. */
-	WAIT_UNTIL_DONE = 1 << 0
+	WAIT_UNTIL_DONE = 1 << 0,
+
+	/** Function returns when the number of scans specified by the \p waitParam argument value is available in the buffer and
+	 * has not been read by the ScanRead function of the subsystem yet, when the scan operation stops,
+	 * or when the time specified by the \p timeout argument value elapses. Input scans only. */
+	WAIT_UNTIL_SAMPLES_AVAILABLE = 1 << 1
 }WaitType;
 
+/** Used with ulScanRecorderEnable(), ulScanRecorderDisable() and ulScanRecorderGetStatus() as the \p source argument value
+ * to select the input scan that is recorded. */
+typedef enum
+{
+	/** Scans started with ulAInScan() */
+	SRS_AI = 1,
+
+	/** Scans started with ulDaqInScan() */
+	SRS_DAQI = 2,
+
+	/** Scans started with ulDInScan() */
+	SRS_DIN = 3,
+
+	/** Scans started with ulCInScan() */
+	SRS_CIN = 4
+}ScanRecorderSource;
+
+/** \brief A structure containing the progress and health of a scan recorder.
+ *
+ * The counts are reset each time a recorded scan starts.
+ */
+struct ScanRecorderStatus
+{
+	/** The number of scans written to the segment files. */
+	unsigned long long scansWritten;
+
+	/** The number of segment files completed. */
+	unsigned long long segmentsWritten;
+
+	/** The largest number of scans that were waiting in the scan buffer to be written. */
+	unsigned long long maxBacklog;
+
+	/** The number of times more than half of the scan buffer was waiting to be written. */
+	unsigned long long backPressureCount;
+
+	/** The number of times the scan overwrote data in the scan buffer before it was written. */
+	unsigned long long overrunCount;
+
+	/** The number of scans lost to overruns. */
+	unsigned long long scansLost;
+
+	/** ::ERR_SCAN_RECORDER_IO if a segment file could not be created or written, or ::ERR_BAD_BUFFER_SIZE if a segment
+	 * can not hold a single scan; recording stops when an error occurs. */
+	UlError error;
+
+	/** Reserved for future use */
+	char reserved[64];
+};
+
+/** \brief A structure containing the progress and health of a scan recorder. */
+typedef struct 	ScanRecorderStatus ScanRecorderStatus;
+
+/** \brief A structure containing the latency statistics of a tracepoint, obtained using ulGetTraceStats().
+ *
+ * The statistics are collected while tracing is enabled with #UL_CFG_TRACE.
+ */
+struct TraceStats
+{
+	/** The name of the tracepoint, the name of a function or the transport and code of a device command. */
+	char name[64];
+
+	/** The number of passes through the tracepoint. */
+	unsigned long long count;
+
+	/** The sum of the latencies of the passes, in ns. */
+	unsigned long long totalNs;
+
+	/** The largest latency, in ns. */
+	unsigned long long maxNs;
+
+	/** Latency histogram, element n is the number of passes with a latency from 2^n to 2^(n+1) ns. */
+	unsigned long long histogram[32];
+
+	/** Reserved for future use */
+	char reserved[64];
+};
+
+/** \brief A structure containing the latency statistics of a tracepoint. */
+typedef struct 	TraceStats TraceStats;
+
+/** \brief A structure containing the transfer performance counters of the input or output scans of a device,
+ * obtained using ulDevGetScanStats().
+ *
+ * A stage is a completed USB bulk transfer, or a read of the data socket of a network device. The counters are reset
+ * each time a scan starts.
+ */
+struct ScanStats
+{
+	/** The number of stages completed. */
+	unsigned long long stageCount;
+
+	/** The time, in ns, from the completion of the first stage to the completion of the last one. */
+	unsigned long long elapsedNs;
+
+	/** The time, in ns, spent processing the data of the stages. */
+	unsigned long long processNs;
+
+	/** The longest time, in ns, spent processing the data of a stage. */
+	unsigned long long maxProcessNs;
+
+	/** Processing time histogram, element n is the number of stages processed in 2^n to 2^(n+1) ns. */
+	unsigned long long processHistogram[32];
+
+	/** The longest time, in ns, between the completion of two stages. */
+	unsigned long long maxIntervalNs;
+
+	/** Completion interval histogram, element n is the number of stages completed 2^n to 2^(n+1) ns after the
+	 * previous one. Intervals much longer than the stage latency indicate the stages were not serviced in time. */
+	unsigned long long intervalHistogram[32];
+
+	/** The number of stages that took longer to process than the device takes to acquire or generate the data of the
+	 * stage at the actual scan rate. A late stage is absorbed by the transfers still queued and the device FIFO,
+	 * a count that keeps growing means the scan rate is more than the host can sustain. It is not a count of lost
+	 * data, a scan that falls too far behind stops with ERR_OVERRUN or ERR_UNDERRUN. */
+	unsigned long long lateStageCount;
+
+	/** The time, in ns, spent resubmitting the transfers of completed stages. USB devices only. */
+	unsigned long long resubmitNs;
+
+	/** The longest time, in ns, spent resubmitting the transfer of a completed stage. USB devices only. */
+	unsigned long long maxResubmitNs;
+
+	/** The number of transfers queued when the scan started. USB devices only. */
+	unsigned int xferCount;
+
+	/** The smallest number of transfers still queued at the device when a stage completed, 0 if the device was left
+	 * without a transfer to fill. USB devices only. */
+	unsigned int minXferPending;
+
+	/** The largest amount of received data that was waiting to be processed: the number of bytes in the receive ring of
+	 * a network device, or the number of stages waiting to be converted in a pipelined USB input scan. */
+	unsigned long long maxBacklog;
+
+	/** The capacity of the backlog, data is lost when \p maxBacklog reaches it. */
+	unsigned long long backlogCapacity;
+
+	/** The number of stages of a pipelined USB input scan that were dropped because the conversion fell \p backlogCapacity
+	 * stages behind. The scan stops with ERR_SCAN_BUFFER_OVERRUN when the first stage is dropped. */
+	unsigned long long droppedStageCount;
+
+	/** Reserved for future use */
+	char reserved[64];
+};
+
+/** \brief A structure containing the transfer performance counters of the scans of a device. */
+typedef struct 	ScanStats ScanStats;
+
 #ifndef doxy_skip
 /** Library version */
 typedef enum
@@ -1797,8 +2007,58 @@ typedef enum
 
 typedef enum
 {	
-	UL_CFG_USB_XFER_PRIORITY = 1
+	UL_CFG_USB_XFER_PRIORITY = 1,
+	/* UsbEventContextMode value, applies to USB devices connected after the change */
+	UL_CFG_USB_EVENT_CONTEXT = 2,
+	/* 1 (default) to keep the USB device inventory cached and maintained from the hotplug events, 0 to scan the bus
+	 * on every ulGetDaqDeviceInventory() call. The cache requires hotplug support from libusb */
+	UL_CFG_USB_INVENTORY_CACHE = 3,
+	/* setting this item rebuilds the cached USB device inventory with a full scan of the bus, the value is ignored */
+	UL_CFG_USB_INVENTORY_RESCAN = 4,
+	/* time in ms (default 60000) the discovery info of a network device is reused by ulGetNetDaqDeviceDescriptor()
+	 * for the same host and port without a new discovery, 0 to always discover the device */
+	UL_CFG_NET_DISCOVERY_CACHE_TTL = 5,
+	/* time in us (default 0, disabled) the data socket of a network device busy polls for scan data, applies to scans
+	 * started after the change. Requires SO_BUSY_POLL support, values above net.core.busy_read require CAP_NET_ADMIN */
+	UL_CFG_NET_SCAN_BUSY_POLL = 6,
+	/* 1 to enable tracing, 0 (default) to disable it. While tracing is enabled the latency of the traced library
+	 * functions and device commands is collected, see ulGetTraceStats() */
+	UL_CFG_TRACE = 7,
+	/* number of tracepoints that can be read with ulGetTraceStats(), read only */
+	UL_CFG_TRACE_STATS_COUNT = 8,
+	/* setting this item writes the statistics of the tracepoints to stderr, followed by the events recorded by each
+	 * thread if the value is not 0 */
+	UL_CFG_TRACE_DUMP = 9,
+	/* setting this item clears the statistics of the tracepoints and the recorded events, the value is ignored */
+	UL_CFG_TRACE_RESET = 10,
+	/* 1 to load the FPGA image of a USB device from a file in /etc/uldaq/fpga/ when the file exists, in place of the
+	 * image built into the library, 0 (default) to always load the built-in image. Applies to FPGA loads after the
+	 * change */
+	UL_CFG_USB_FPGA_FILE_OVERRIDE = 11,
+	/* setting this item adds a simulated USB device of the product ID in the value to the device inventory, 0 removes
+	 * the simulated devices from the inventory. Getting it returns the number of simulated devices in the inventory.
+	 * A simulated device needs no hardware, its scans run the library transfer path against transfers completed by
+	 * the library itself, for benchmarking. Only USB products with FPGA-based bulk scans can be simulated, other
+	 * product IDs return ERR_BAD_CONFIG_VAL */
+	UL_CFG_USB_SIM_DEVICE = 12,
+	/* bytes per second moved by each bulk endpoint of a simulated device, 0 (default) completes the transfers of a
+	 * simulated device as soon as they are submitted. Applies to the scans of all simulated devices */
+	UL_CFG_USB_SIM_RATE = 13,
+	/* kernel that converts the samples of the analog input scans started after the change: 0 (default) the fastest
+	 * one the CPU supports, 1 scalar, 2 SSE2, 3 AVX2, 4 NEON. A kernel the CPU or the build does not support returns
+	 * ERR_CONFIG_NOT_SUPPORTED. Getting it returns the kernel the next scan uses, for benchmarking the kernels */
+	UL_CFG_SCAN_CONVERTER_ISA = 14
 }UlConfigItem;
+
+typedef enum
+{
+	/* all USB devices share one libusb context and one transfer thread (default) */
+	UEC_SHARED = 0,
+	/* devices on the same USB bus share a private libusb context and transfer thread */
+	UEC_PER_BUS = 1,
+	/* each USB device has its own libusb context and transfer thread */
+	UEC_PER_DEVICE = 2
+}UsbEventContextMode;
 #endif /* doxy_skip */
 
 /** Use with ulDevGetInfo() as an \p infoItem argument value to obtain information for the specified device. */
@@ -1849,7 +2109,61 @@ typedef enum
 	DEV_CFG_MEM_UNLOCK_CODE = 3,
 
 	/** Resets the DAQ device, this causes the DAQ device to disconnect from the host, ulConnectDaqDevice() must be invoked to re-establish the connection*/
-	DEV_CFG_RESET = 4
+	DEV_CFG_RESET = 4,
+
+	/** The number of bulk transfers kept in flight during a scan on a USB DAQ device. Set index to 0 for input scans or 1 for output scans.
+	 * Valid values are 1 to 256; 0 restores the default of 32. The change takes effect when the next scan starts.
+	 */
+	DEV_CFG_SCAN_XFER_COUNT = 5,
+
+	/** The maximum size in bytes of each bulk transfer during a scan on a USB DAQ device. Set index to 0 for input scans or 1 for output scans.
+	 * Valid values are multiples of 1024 from 1024 to 4194304; 0 restores the default of 16384. The change takes effect when the next scan starts.
+	 */
+	DEV_CFG_SCAN_STAGE_SIZE = 6,
+
+	/** The time in microseconds of data each bulk transfer targets during a scan on a USB DAQ device, before the limit set by
+	 * #DEV_CFG_SCAN_STAGE_SIZE is applied. Set index to 0 for input scans or 1 for output scans. Lower values reduce latency, higher values
+	 * reduce the host load at high rates. Valid values are 100 to 1000000; 0 restores the default of 10000. The change takes effect when the next scan starts.
+	 */
+	DEV_CFG_SCAN_STAGE_LATENCY = 7,
+
+	/** The thread on which event callbacks are invoked, set to one of the #DaqEventDelivery values. Index is ignored.
+	 * The delivery mode can not be changed while a scan is running. */
+	DEV_CFG_EVENT_DELIVERY = 8,
+
+	/** The CPU the event thread is pinned to, or -1 if the thread can run on any CPU (default). Index is ignored. */
+	DEV_CFG_EVENT_THREAD_CPU = 9,
+
+	/** Event delivery statistics selected by the #DaqEventStat value of the \p index argument. Setting this item to any value
+	 * resets the drop count and latency statistics. */
+	DEV_CFG_EVENT_STATS = 10,
+
+	/** The nice value (-20 to 0) of the thread that handles the USB transfers of the device. Index is ignored.
+	 * Unless the device is opened in a private libusb context, the thread is shared by all USB devices. */
+	DEV_CFG_USB_XFER_PRIORITY = 11,
+
+	/** The SCHED_FIFO priority (1 to 99) of the thread that handles the USB transfers of the device, or 0 for the default
+	 * scheduling policy. Index is ignored. Real-time priorities require the CAP_SYS_NICE capability or an RLIMIT_RTPRIO limit. */
+	DEV_CFG_USB_XFER_RT_PRIORITY = 12,
+
+	/** The CPU the thread that handles the USB transfers of the device is pinned to, or -1 if the thread can run on any CPU (default).
+	 * Index is ignored. */
+	DEV_CFG_USB_XFER_CPU = 13,
+
+	/** Set to 1 to convert the data of input scans on a USB DAQ device on a separate thread, so completed transfers are
+	 * resubmitted before their samples are converted. Set to 0 to convert on the transfer thread (default). Index is ignored.
+	 * The change takes effect when the next scan starts. A scan whose conversion falls a full transfer count behind the
+	 * transfers stops with ERR_SCAN_BUFFER_OVERRUN. */
+	DEV_CFG_SCAN_PIPELINE = 14,
+
+	/** The number of threads, 1 to 16, that convert the samples of each large input scan transfer in parallel. 0 or 1 converts
+	 * on a single thread (default). Index is ignored. The value can not be changed while a scan is running. */
+	DEV_CFG_SCAN_CONVERSION_THREADS = 15,
+
+	/** The percentage, 0 to 100, of the FPGA image loaded while the device connects. Can be read from another thread while
+	 * ulConnectDaqDevice() or ulConnectDaqDevices() is in progress; 100 once the device is initialized or if no image has to be loaded.
+	 * Index is ignored. */
+	DEV_CFG_HW_INIT_PROGRESS = 16
 
 }DevConfigItem;
 
@@ -1945,7 +2259,10 @@ typedef enum
 	AI_INFO_FIFO_SIZE = 16,
 
 	/** Returns a zero or non-zero value to the \p infoValue argument. If non-zero, IEPE mode is supported. Index is ignored. */
-	AI_INFO_IEPE_SUPPORTED = 17
+	AI_INFO_IEPE_SUPPORTED = 17,
+
+	/** Returns the size in bytes of a device-native sample stored by ulAInScanRaw() to the \p infoValue argument. Index is ignored. */
+	AI_INFO_SAMPLE_SIZE = 18
 
 }AiInfoItem;
 
@@ -2432,6 +2749,61 @@ UlError ulGetDaqDeviceDescriptor(DaqDeviceHandle daqDeviceHandle, DaqDeviceDescr
  */
 UlError ulConnectDaqDevice(DaqDeviceHandle daqDeviceHandle);
 
+/**
+ * Establish the connections to several physical DAQ devices at once. The devices are connected concurrently, so the
+ * firmware and FPGA images of devices that require them are loaded in parallel.
+ * @param daqDeviceHandles an array of handles to the DAQ devices
+ * @param count the number of handles in \p daqDeviceHandles
+ * @param errors an optional array of \p count elements that receives the UL error code of each device, may be NULL
+ * @return The UL error code of the first device that failed to connect, or #ERR_NO_ERROR.
+ */
+UlError ulConnectDaqDevices(DaqDeviceHandle daqDeviceHandles[], unsigned int count, UlError errors[]);
+
+/**
+ * Prepare the input scans of several USB DAQ devices to start together. After this function returns, the next
+ * ulAInScan(), ulDInScan(), ulCInScan() or ulDaqInScan() called on each device configures the device and allocates
+ * the transfers as usual, but does not start the scan. The scans are started by #ulScanGroupStart(). Until then the
+ * status of a held scan is #SS_RUNNING with no samples transferred, as for a scan waiting for an external trigger; a
+ * held scan stopped with its stop function is not started by #ulScanGroupStart().
+ * @param daqDeviceHandles an array of handles to the DAQ devices
+ * @param count the number of handles in \p daqDeviceHandles
+ * @return The UL error code.
+ */
+UlError ulScanGroupBegin(DaqDeviceHandle daqDeviceHandles[], unsigned int count);
+
+/**
+ * Start the scans prepared on the devices of a group. The start commands are sent back to back; the devices scanning
+ * with the #SO_EXTTRIGGER, #SO_EXTCLOCK or #SO_RETRIGGER option are started first so they are armed before the
+ * devices that drive their trigger or clock start. If a device fails to start, the scans of all devices are stopped.
+ * Returns #ERR_BAD_ARG without starting any scan if the scan of a device is not held, including a held scan that was
+ * stopped after it was prepared.
+ * @param daqDeviceHandles an array of handles to the DAQ devices
+ * @param count the number of handles in \p daqDeviceHandles
+ * @param startSkew receives the time, in seconds, between the completion of the first and the last start command of
+ * the devices that do not wait for an external trigger or clock, may be NULL
+ * @return The UL error code.
+ */
+UlError ulScanGroupStart(DaqDeviceHandle daqDeviceHandles[], unsigned int count, double* startSkew);
+
+/**
+ * Get the status of the scans of a group.
+ * @param daqDeviceHandles an array of handles to the DAQ devices
+ * @param count the number of handles in \p daqDeviceHandles
+ * @param status #SS_RUNNING if the scan of any device of the group is running, otherwise #SS_IDLE
+ * @param xferStatus an optional array of \p count elements that receives the TransferStatus of each device, may be NULL
+ * @return The UL error code of the first device whose scan failed, or #ERR_NO_ERROR.
+ */
+UlError ulScanGroupStatus(DaqDeviceHandle daqDeviceHandles[], unsigned int count, ScanStatus* status, TransferStatus xferStatus[]);
+
+/**
+ * Stop the scans of a group, including scans prepared by #ulScanGroupBegin() that were not started. Every device is
+ * stopped even if stopping one of them fails.
+ * @param daqDeviceHandles an array of handles to the DAQ devices
+ * @param count the number of handles in \p daqDeviceHandles
+ * @return The UL error code of the first device that failed to stop, or #ERR_NO_ERROR.
+ */
+UlError ulScanGroupStop(DaqDeviceHandle daqDeviceHandles[], unsigned int count);
+
 /**
  * Disconnect from a device.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -2492,6 +2864,22 @@ UlError ulFlashLed(DaqDeviceHandle daqDeviceHandle, int flashCount);
  */
 UlError ulAIn(DaqDeviceHandle daqDeviceHandle, int channel, AiInputMode inputMode, Range range, AInFlag flags, double* data);
 
+/**
+ * Returns the values read from a range of A/D channels in one operation. Devices with a pacer read four or more channels
+ * with a one-scan finite acquisition, the network devices pipeline the reads of the channels, and the USB-TEMP-AI reads its
+ * voltage channels with one command. Fewer channels, or all channels of devices without a faster method, are read one after
+ * the other as by ulAIn(). The channel queue loaded by ulAInLoadQueue() is not used.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param lowChan first A/D channel
+ * @param highChan last A/D channel
+ * @param inputMode A/D channel mode
+ * @param range A/D range
+ * @param flags bit mask that specifies whether to scale and/or calibrate the data
+ * @param data array of highChan - lowChan + 1 elements that receives the A/D data values
+ * @return The UL error code.
+ */
+UlError ulAInSnapshot(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, AiInputMode inputMode, Range range, AInFlag flags, double data[]);
+
 /**
  * Scans a range of A/D channels, and stores the samples in an array.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -2508,6 +2896,36 @@ UlError ulAIn(DaqDeviceHandle daqDeviceHandle, int channel, AiInputMode inputMod
  */
 UlError ulAInScan(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double* rate, ScanOption options, AInScanFlag flags, double data[]);
 
+/**
+ * Scans a range of A/D channels, and stores the device-native samples in an array without conversion.
+ * Each sample is an unsigned little-endian integer of ::AI_INFO_SAMPLE_SIZE bytes. When possible, USB devices
+ * transfer the samples directly into \p data, so in continuous mode the part of the buffer ahead of the current index
+ * may already hold new samples. Use ulAInScanCoefs() to convert the samples to calibrated and scaled values.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param lowChan first A/D channel in the scan
+ * @param highChan last A/D channel in the scan
+ * @param inputMode A/D channel mode
+ * @param range A/D range
+ * @param samplesPerChan the number of A/D samples to collect from each channel in the scan
+ * @param rate A/D sample rate in samples per channel per second. Upon return, this value is set to the actual sample rate.
+ * @param options bit mask that specifies A/D scan options
+ * @param flags bit mask that specifies whether the coefficients returned by ulAInScanCoefs() scale and/or calibrate the data
+ * @param data pointer to the buffer to receive the samples; must hold samplesPerChan * number of channels * ::AI_INFO_SAMPLE_SIZE bytes
+ * @return The UL error code.
+ */
+UlError ulAInScanRaw(DaqDeviceHandle daqDeviceHandle, int lowChan, int highChan, AiInputMode inputMode, Range range, int samplesPerChan, double* rate, ScanOption options, AInScanFlag flags, void* data);
+
+/**
+ * Returns the coefficients of the current or last A/D scan, one pair per channel in scan order.
+ * A sample stored by ulAInScanRaw() is converted with: value = slope * sample + offset.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param slopes[] pointer to the buffer to receive the slope of each channel
+ * @param offsets[] pointer to the buffer to receive the offset of each channel
+ * @param numChans the number of elements in \p slopes and \p offsets; upon return, this value is set to the number of channels in the scan
+ * @return The UL error code.
+ */
+UlError ulAInScanCoefs(DaqDeviceHandle daqDeviceHandle, double slopes[], double offsets[], unsigned int* numChans);
+
 /**
  * Returns the status, count, and index of an A/D scan operation.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -2529,12 +2947,28 @@ UlError ulAInScanStop(DaqDeviceHandle daqDeviceHandle);
  * Returns when the scan operation completes on the specified device, or the time specified by the \p timeout argument elapses.
  * @param daqDeviceHandle the handle to the DAQ device
  * @param waitType the wait type
- * @param waitParam Reserved for future use
+ * @param waitParam the number of unread scans to wait for when \p waitType is ::WAIT_UNTIL_SAMPLES_AVAILABLE; otherwise reserved for future use
  * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely for the scan operation to end.
  * @return The UL error code.
  */
 UlError ulAInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long long waitParam, double timeout);
 
+/**
+ * Copies scans that have not been read yet from the buffer of the analog input scan operation into \p data, starting after the last scan
+ * returned by the previous call. Waits until \p scanCount scans are available, the scan operation stops, or the time specified
+ * by the \p timeout argument elapses.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param scanCount the number of scans to read
+ * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely, or 0 to return the scans that are already available.
+ * @param data a pointer to the array that receives the data; the array must hold \p scanCount scans with elements of the type of
+ * the scan buffer: double, or float with ::AINSCAN_FF_FLOAT32DATA, uint16_t with ::AINSCAN_FF_UINT16DATA, uint32_t with
+ * ::AINSCAN_FF_UINT32DATA, and samples of ::AI_INFO_SAMPLE_SIZE bytes for a scan started with ulAInScanRaw()
+ * @param scansRead the number of scans copied into \p data
+ * @return The UL error code. ::ERR_TIMEDOUT if fewer than \p scanCount scans were read while the scan is running,
+ * ::ERR_SCAN_BUFFER_OVERRUN if the unread scans were overwritten; the next read then starts at the most recent scan.
+ */
+UlError ulAInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, void* data, long long* scansRead);
+
 /**
  * Loads the A/D queue of a specified device.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -2793,12 +3227,26 @@ UlError ulDInScanStop(DaqDeviceHandle daqDeviceHandle);
  * Returns when the scan operation completes on the specified device, or the time specified by the \p timeout argument elapses.
  * @param daqDeviceHandle the handle to the DAQ device
  * @param waitType the wait type
- * @param waitParam Reserved for future use
+ * @param waitParam the number of unread scans to wait for when \p waitType is ::WAIT_UNTIL_SAMPLES_AVAILABLE; otherwise reserved for future use
  * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely for the scan operation to end.
  * @return The UL error code.
  */
 UlError ulDInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long long waitParam, double timeout);
 
+/**
+ * Copies scans that have not been read yet from the buffer of the digital input scan operation into \p data, starting after the last scan
+ * returned by the previous call. Waits until \p scanCount scans are available, the scan operation stops, or the time specified
+ * by the \p timeout argument elapses.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param scanCount the number of scans to read
+ * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely, or 0 to return the scans that are already available.
+ * @param data[] a pointer to an array that stores the data; the array must hold \p scanCount scans in the format of the scan buffer
+ * @param scansRead the number of scans copied into \p data
+ * @return The UL error code. ::ERR_TIMEDOUT if fewer than \p scanCount scans were read while the scan is running,
+ * ::ERR_SCAN_BUFFER_OVERRUN if the unread scans were overwritten; the next read then starts at the most recent scan.
+ */
+UlError ulDInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, unsigned long long data[], long long* scansRead);
+
 /**
  * Configures the trigger parameters that will be used when #ulDInScan() is called with the ::SO_RETRIGGER or ::SO_EXTTRIGGER ScanOption.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -2992,12 +3440,26 @@ UlError ulCInScanStop(DaqDeviceHandle daqDeviceHandle);
  * Returns when the scan operation completes on the specified device, or the time specified by the \p timeout argument elapses.
  * @param daqDeviceHandle the handle to the DAQ device
  * @param waitType the wait type
- * @param waitParam Reserved for future use
+ * @param waitParam the number of unread scans to wait for when \p waitType is ::WAIT_UNTIL_SAMPLES_AVAILABLE; otherwise reserved for future use
  * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely for the scan operation to end.
  * @return The UL error code.
  */
 UlError ulCInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long long waitParam, double timeout);
 
+/**
+ * Copies scans that have not been read yet from the buffer of the counter input scan operation into \p data, starting after the last scan
+ * returned by the previous call. Waits until \p scanCount scans are available, the scan operation stops, or the time specified
+ * by the \p timeout argument elapses.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param scanCount the number of scans to read
+ * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely, or 0 to return the scans that are already available.
+ * @param data[] a pointer to an array that stores the data; the array must hold \p scanCount scans in the format of the scan buffer
+ * @param scansRead the number of scans copied into \p data
+ * @return The UL error code. ::ERR_TIMEDOUT if fewer than \p scanCount scans were read while the scan is running,
+ * ::ERR_SCAN_BUFFER_OVERRUN if the unread scans were overwritten; the next read then starts at the most recent scan.
+ */
+UlError ulCInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, unsigned long long data[], long long* scansRead);
+
 /** @}*/ 
 
 /** 
@@ -3094,12 +3556,27 @@ UlError ulDaqInScanStop(DaqDeviceHandle daqDeviceHandle);
  * Returns when the scan operation completes on the specified device, or the time specified by the \p timeout argument elapses.
  * @param daqDeviceHandle the handle to the DAQ device
  * @param waitType the wait type
- * @param waitParam reserved for future use
+ * @param waitParam the number of unread scans to wait for when \p waitType is ::WAIT_UNTIL_SAMPLES_AVAILABLE; otherwise reserved for future use
  * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely for the scan operation to end.
  * @return The UL error code.
  */
 UlError ulDaqInScanWait(DaqDeviceHandle daqDeviceHandle, WaitType waitType, long long waitParam, double timeout);
 
+/**
+ * Copies scans that have not been read yet from the buffer of the DAQ input scan operation into \p data, starting after the last scan
+ * returned by the previous call. Waits until \p scanCount scans are available, the scan operation stops, or the time specified
+ * by the \p timeout argument elapses.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param scanCount the number of scans to read
+ * @param timeout the timeout value in seconds (s); set to -1 to wait indefinitely, or 0 to return the scans that are already available.
+ * @param data a pointer to the array that receives the data; the array must hold \p scanCount scans with elements of the type of
+ * the scan buffer: double, or float with ::DAQINSCAN_FF_FLOAT32DATA and unsigned int with ::DAQINSCAN_FF_UINT32DATA
+ * @param scansRead the number of scans copied into \p data
+ * @return The UL error code. ::ERR_TIMEDOUT if fewer than \p scanCount scans were read while the scan is running,
+ * ::ERR_SCAN_BUFFER_OVERRUN if the unread scans were overwritten; the next read then starts at the most recent scan.
+ */
+UlError ulDaqInScanRead(DaqDeviceHandle daqDeviceHandle, long long scanCount, double timeout, void* data, long long* scansRead);
+
 /**
  * Configures the trigger parameters that will be used when ulDaqInScan() is called with the ::SO_RETRIGGER or ::SO_EXTTRIGGER ScanOption.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -3201,6 +3678,51 @@ UlError ulEnableEvent(DaqDeviceHandle daqDeviceHandle, DaqEventType eventTypes,
  */
 UlError ulDisableEvent(DaqDeviceHandle daqDeviceHandle, DaqEventType eventTypes);
 
+/**
+ * Records the scans of the specified input scan type to a ring of preallocated, memory-mapped segment files named
+ * <i>pathPrefix</i>.0000, <i>pathPrefix</i>.0001 and so on. Each file starts with an 8 KB header holding the channel list,
+ * ranges, calibration coefficients, scan rate and start time, followed by the scan data in the format of the scan buffer.
+ * When the last segment is full the recorder continues with the first one. Each recorded scan starts a new segment
+ * after the last one written by the previous scan, so consecutive scans share the ring and the segments of a scan are
+ * identified by the start time in their header. Enabling the recorder again starts over at <i>pathPrefix</i>.0000, use
+ * a different \p pathPrefix to keep the files of an earlier recording. The recorder runs on its own thread while
+ * a scan of the specified type is running and keeps its own read position, so it does not slow down the scan.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param source the input scan type to record
+ * @param pathPrefix the path and file name prefix of the segment files
+ * @param segmentCount the number of segment files in the ring
+ * @param segmentSize the size of the data section of a segment file in bytes, rounded down to whole scans
+ * @return The UL error code.
+ */
+UlError ulScanRecorderEnable(DaqDeviceHandle daqDeviceHandle, ScanRecorderSource source, const char* pathPrefix, int segmentCount, long long segmentSize);
+
+/**
+ * Stops recording the scans of the specified input scan type. The recorder can not be disabled while a recorded scan is running.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param source the input scan type
+ * @return The UL error code.
+ */
+UlError ulScanRecorderDisable(DaqDeviceHandle daqDeviceHandle, ScanRecorderSource source);
+
+/**
+ * Returns the progress and the back-pressure and overrun statistics of the recorder of the specified input scan type.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param source the input scan type
+ * @param status the ScanRecorderStatus struct that receives the statistics
+ * @return The UL error code.
+ */
+UlError ulScanRecorderGetStatus(DaqDeviceHandle daqDeviceHandle, ScanRecorderSource source, ScanRecorderStatus* status);
+
+/**
+ * Returns the transfer performance counters of the input or output scans of a DAQ device. The counters are reset
+ * when a scan starts, and can be read while the scan runs.
+ * @param daqDeviceHandle the handle to the DAQ device
+ * @param index 0 for input scans or 1 for output scans
+ * @param stats the ScanStats struct that receives the counters
+ * @return The UL error code.
+ */
+UlError ulDevGetScanStats(DaqDeviceHandle daqDeviceHandle, unsigned int index, ScanStats* stats);
+
 /**
  * Reads a value read from a specified region in memory; use with ulMemGetInfo() to retrieve information about the memory region on a DAQ device.
  * @param daqDeviceHandle the handle to the DAQ device
@@ -3271,6 +3793,15 @@ UlError ulSetConfig(UlConfigItem configItem, unsigned int index, long long confi
  * @return The UL error code. 
  */
 UlError ulGetConfig(UlConfigItem configItem, unsigned int index, long long* configValue);
+
+/**
+ * Returns the latency statistics of a tracepoint.<br>Use ulGetConfig() with #UL_CFG_TRACE_STATS_COUNT to get the
+ * number of tracepoints.
+ * @param index the index of the tracepoint, from 0 to the number of tracepoints - 1
+ * @param stats the TraceStats struct that receives the statistics
+ * @return The UL error code.
+ */
+UlError ulGetTraceStats(unsigned int index, TraceStats* stats);
 #endif /* doxy_skip */
 
 /**
@@ -4,16 +4,24 @@
  *     Author: Measurement Computing Corporation
  */
 
-#include <sys/resource.h>
-#include <sys/syscall.h>
+#include <algorithm>
+#include <limits.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <sstream>
 #include <unistd.h>
 
 #include "UsbDaqDevice.h"
 #include "../DaqDeviceManager.h"
+#include "../AiDevice.h"
 #include "../utility/UlLock.h"
+#include "../utility/ConfigShadow.h"
 #include "UsbScanTransferIn.h"
 #include "UsbScanTransferOut.h"
 #include "UsbDtDevice.h"
+#include "UsbDeviceInventory.h"
+#include "UsbSimDevice.h"
 
 #if LIBUSBX_API_VERSION < 0x01000102
 #error libusb version 1.0.16 or later is required to compile this package.
@@ -24,14 +32,13 @@ namespace ul
 
 libusb_context* UsbDaqDevice::mLibUsbContext = NULL;
 libusb_hotplug_callback_handle UsbDaqDevice::mHotplugHandle;
-pthread_t UsbDaqDevice::mUsbEventHandlerThread;
-
-
-bool UsbDaqDevice::mUsbEventThreadStarted = false;
-bool UsbDaqDevice::mTerminateUsbEventThread = false;
-
-pid_t UsbDaqDevice::mUsbEventHandlerThreadId = 0;
-int UsbDaqDevice::mUsbEventHandlerThreadNiceValue = 0;
+bool UsbDaqDevice::mHotplugRegistered = false;
+pthread_mutex_t UsbDaqDevice::mHotplugMutex = PTHREAD_MUTEX_INITIALIZER;
+unsigned int UsbDaqDevice::mArrivalCount = 0;
+pthread_mutex_t UsbDaqDevice::mArrivalMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t UsbDaqDevice::mArrivalCond = PTHREAD_COND_INITIALIZER;
+UsbEventThread UsbDaqDevice::mSharedEventThread("usb_xfer_td");
+int UsbDaqDevice::mUsbEventContextMode = UEC_SHARED;
 
 UsbDaqDevice::UsbDaqDevice(const DaqDeviceDescriptor& daqDeviceDescriptor) : DaqDevice(daqDeviceDescriptor)
 {
@@ -40,6 +47,13 @@ UsbDaqDevice::UsbDaqDevice(const DaqDeviceDescriptor& daqDeviceDescriptor) : Daq
 	mDevHandle = NULL;
 	mConnected = false;
 
+	mSimDevice = UsbSimDevice::isSimDevice(daqDeviceDescriptor) ? new UsbSimDevice() : NULL;
+
+	mEventThread = NULL;
+	mXferThreadNiceValue = XFER_THREAD_CFG_UNSET;
+	mXferThreadRtPriority = XFER_THREAD_CFG_UNSET;
+	mXferThreadCpu = XFER_THREAD_CFG_UNSET;
+
 	mScanDoneMask = 0;
 	mOverrunBitMask = 0;
 	mUnderrunBitMask = 0;
@@ -54,6 +68,13 @@ UsbDaqDevice::UsbDaqDevice(const DaqDeviceDescriptor& daqDeviceDescriptor) : Daq
 
 	mMultiCmdMem = false;
 
+	mGroupScan.holdStart = false;
+	mGroupScan.startHeld = false;
+	mGroupScan.functionType = (FunctionType) 0;
+	mGroupScan.options = SO_DEFAULTIO;
+	mGroupScan.request = 0;
+	mGroupScan.timeout = 0;
+
 	setCmdValue(CMD_FLASH_LED_KEY, 0x40);
 	setCmdValue(CMD_RESET_KEY, 0x41);
 	setCmdValue(CMD_STATUS_KEY, 0x44);
@@ -80,6 +101,9 @@ UsbDaqDevice::~UsbDaqDevice()
 	delete mScanTransferOut;
 	mScanTransferOut = NULL;
 
+	delete mSimDevice;
+	mSimDevice = NULL;
+
 	UlLock::destroyMutex(mIoMutex);
 	UlLock::destroyMutex(mConnectionMutex);
 	UlLock::destroyMutex(mTriggerCmdMutex);
@@ -100,6 +124,8 @@ void UsbDaqDevice::usb_exit()
 {
 	if(mLibUsbContext)
 	{
+		UsbDeviceInventory::terminate();
+
 		terminateEventThread();
 
 		libusb_exit(mLibUsbContext);
@@ -135,33 +161,13 @@ std::vector<DaqDeviceDescriptor> UsbDaqDevice::findDaqDevices()
 				UL_LOG("failed to get device descriptor");
 			}
 
-			if((desc.idVendor == MCC_USB_VID || desc.idVendor == DT_USB_VID) &&
-			   DaqDeviceManager::isDaqDeviceSupported(desc.idProduct, desc.idVendor))
-			{
-				if(!isHidDevice(dev))
-				{
-					DaqDeviceDescriptor daqDevDescriptor;
-					memset(&daqDevDescriptor, 0,sizeof(DaqDeviceDescriptor));
-
-					daqDevDescriptor.productId = getVirtualProductId(dev, desc);
-					daqDevDescriptor.devInterface = USB_IFC;
-					std::string productName = DaqDeviceManager::getDeviceName(daqDevDescriptor.productId, desc.idVendor);
+			DaqDeviceDescriptor daqDevDescriptor;
 
-					strncpy(daqDevDescriptor.productName, productName.c_str(), sizeof(daqDevDescriptor.productName) - 1);
-					strncpy(daqDevDescriptor.devString, productName.c_str(), sizeof(daqDevDescriptor.devString) - 1);
-
-					readSerialNumber(dev, desc, daqDevDescriptor.uniqueId);
-
-					UL_LOG("-----------------------");
-					UL_LOG("Product ID : 0x" << std::hex << daqDevDescriptor.productId << std::dec);
-					UL_LOG("Product Name: "<< daqDevDescriptor.productName);
-					UL_LOG("Serial Number : "<< daqDevDescriptor.uniqueId);
-					UL_LOG("-----------------------");
-
-					descriptorList.push_back(daqDevDescriptor);
+			if(getDaqDeviceDescriptor(dev, desc, &daqDevDescriptor))
+			{
+				descriptorList.push_back(daqDevDescriptor);
 
-					mccDaqDevNum++;
-				}
+				mccDaqDevNum++;
 			}
 		}
 	}
@@ -173,6 +179,38 @@ std::vector<DaqDeviceDescriptor> UsbDaqDevice::findDaqDevices()
 	return descriptorList;
 }
 
+// returns false for unsupported devices and for HID devices, which are enumerated through hidapi
+bool UsbDaqDevice::getDaqDeviceDescriptor(libusb_device* dev, const libusb_device_descriptor& desc, DaqDeviceDescriptor* daqDevDescriptor)
+{
+	if((desc.idVendor == MCC_USB_VID || desc.idVendor == DT_USB_VID) &&
+	   DaqDeviceManager::isDaqDeviceSupported(desc.idProduct, desc.idVendor))
+	{
+		if(!isHidDevice(dev))
+		{
+			memset(daqDevDescriptor, 0,sizeof(DaqDeviceDescriptor));
+
+			daqDevDescriptor->productId = getVirtualProductId(dev, desc);
+			daqDevDescriptor->devInterface = USB_IFC;
+			std::string productName = DaqDeviceManager::getDeviceName(daqDevDescriptor->productId, desc.idVendor);
+
+			strncpy(daqDevDescriptor->productName, productName.c_str(), sizeof(daqDevDescriptor->productName) - 1);
+			strncpy(daqDevDescriptor->devString, productName.c_str(), sizeof(daqDevDescriptor->devString) - 1);
+
+			readSerialNumber(dev, desc, daqDevDescriptor->uniqueId);
+
+			UL_LOG("-----------------------");
+			UL_LOG("Product ID : 0x" << std::hex << daqDevDescriptor->productId << std::dec);
+			UL_LOG("Product Name: "<< daqDevDescriptor->productName);
+			UL_LOG("Serial Number : "<< daqDevDescriptor->uniqueId);
+			UL_LOG("-----------------------");
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void UsbDaqDevice::connect()
 {
 	FnLog log("UsbDaqDevice::connect");
@@ -190,6 +228,8 @@ void UsbDaqDevice::connect()
 
 	mConnected = true;
 
+	configShadow().invalidate();
+
 	mCurrentSuspendCount = SuspendMonitor::instance().getCurrentSystemSuspendCount();
 
 	initilizeHardware();
@@ -226,6 +266,90 @@ void UsbDaqDevice::releaseUsbResources()
 
 		mDevHandle = NULL;
 	}
+
+	if(mSimDevice)
+		mSimDevice->stop();
+
+	if(mEventThread && mEventThread != &mSharedEventThread)
+		UsbEventThread::release(mEventThread);
+
+	mEventThread = NULL;
+}
+
+int UsbDaqDevice::openDevice(libusb_device* dev)
+{
+	FnLog log("UsbDaqDevice::openDevice");
+
+	int status;
+
+	if(mUsbEventContextMode == UEC_SHARED)
+	{
+		status = libusb_open(dev, &mDevHandle);
+
+		if(status == LIBUSB_SUCCESS)
+			mEventThread = &mSharedEventThread;
+	}
+	else
+	{
+		// open the same device in a private libusb context so its transfers are handled by a dedicated thread
+		uint8_t busNum = libusb_get_bus_number(dev);
+		uint8_t address = libusb_get_device_address(dev);
+
+		std::ostringstream key;
+
+		if(mUsbEventContextMode == UEC_PER_BUS)
+			key << "bus" << (int) busNum;
+		else
+			key << "dev" << (int) busNum << "." << (int) address;
+
+		UsbEventThread* eventThread = UsbEventThread::acquire(key.str());
+
+		libusb_device** devs;
+		int numDevs = libusb_get_device_list(eventThread->context(), &devs);
+
+		status = LIBUSB_ERROR_NO_DEVICE;
+
+		for(int i = 0; i < numDevs; i++)
+		{
+			if(libusb_get_bus_number(devs[i]) == busNum && libusb_get_device_address(devs[i]) == address)
+			{
+				status = libusb_open(devs[i], &mDevHandle);
+				break;
+			}
+		}
+
+		if(numDevs >= 0)
+			libusb_free_device_list(devs, 1);
+
+		if(status == LIBUSB_SUCCESS)
+			mEventThread = eventThread;
+		else
+			UsbEventThread::release(eventThread);
+	}
+
+	if(status == LIBUSB_SUCCESS)
+		applyXferThreadCfg();
+
+	return status;
+}
+
+void UsbDaqDevice::applyXferThreadCfg()
+{
+	try
+	{
+		if(mXferThreadNiceValue != XFER_THREAD_CFG_UNSET)
+			mEventThread->setNiceValue(mXferThreadNiceValue);
+
+		if(mXferThreadRtPriority != XFER_THREAD_CFG_UNSET)
+			mEventThread->setRtPriority(mXferThreadRtPriority);
+
+		if(mXferThreadCpu != XFER_THREAD_CFG_UNSET)
+			mEventThread->setCpu(mXferThreadCpu);
+	}
+	catch(UlException& e)
+	{
+		UL_LOG("#### Unable to apply the transfer thread settings, error: " << e.getError());
+	}
 }
 
 void UsbDaqDevice::establishConnection()
@@ -240,6 +364,12 @@ void UsbDaqDevice::establishConnection()
 	if(std::strcmp(mDaqDeviceDescriptor.uniqueId, NO_PERMISSION_STR) == 0)
 		throw UlException(ERR_USB_DEV_NO_PERMISSION);
 
+	if(mSimDevice)
+	{
+		establishSimConnection();
+		return;
+	}
+
 	int numDevs = libusb_get_device_list (mLibUsbContext, &devs);
 
 	if(numDevs > 0)
@@ -284,7 +414,7 @@ void UsbDaqDevice::establishConnection()
 						throw UlException(ERR_INCOMPATIBLE_FIRMWARE);
 					}
 
-					int status = libusb_open(dev, &mDevHandle);
+					int status = openDevice(dev);
 
 					if (status == LIBUSB_SUCCESS)
 					{
@@ -327,12 +457,7 @@ void UsbDaqDevice::establishConnection()
 
 								libusb_free_config_descriptor(config);
 
-								if(!mUsbEventThreadStarted)
-								{
-									// register Hotplug callback and start the event handler thread only once for all usb devices
-									registerHotplugCallBack();
-									startEventHandlerThread();
-								}
+								startHotplugMonitor();
 							}
 							else
 								UL_LOG("libusb_get_config_descriptor() failed: " << libusb_error_name(status));
@@ -342,6 +467,8 @@ void UsbDaqDevice::establishConnection()
 							UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
 							libusb_free_device_list(devs, 1);
 
+							releaseUsbResources();
+
 							throw UlException(ERR_USB_INTERFACE_CLAIMED);
 						}
 					}
@@ -369,6 +496,36 @@ void UsbDaqDevice::establishConnection()
 #endif
 }
 
+// a simulated device has a high speed bulk endpoint at every address, the IO devices pick the ones they use
+void UsbDaqDevice::establishSimConnection()
+{
+	FnLog log("UsbDaqDevice::establishSimConnection");
+
+	mRawFwVersion = mMinRawFwVersion;
+
+	mBulkInEndpointDescs.clear();
+	mBulkOutEndpointDescs.clear();
+
+	for(int epNum = 1; epNum < 16; epNum++)
+	{
+		libusb_endpoint_descriptor endpointDesc;
+		memset(&endpointDesc, 0, sizeof(endpointDesc));
+
+		endpointDesc.bLength = LIBUSB_DT_ENDPOINT_SIZE;
+		endpointDesc.bDescriptorType = LIBUSB_DT_ENDPOINT;
+		endpointDesc.bmAttributes = LIBUSB_TRANSFER_TYPE_BULK;
+		endpointDesc.wMaxPacketSize = UsbSimDevice::MAX_PACKET_SIZE;
+
+		endpointDesc.bEndpointAddress = LIBUSB_ENDPOINT_IN | epNum;
+		mBulkInEndpointDescs.push_back(endpointDesc);
+
+		endpointDesc.bEndpointAddress = LIBUSB_ENDPOINT_OUT | epNum;
+		mBulkOutEndpointDescs.push_back(endpointDesc);
+	}
+
+	mSimDevice->start(getCmdValue(CMD_STATUS_KEY), getScanRunningBitMask(SD_INPUT), getScanRunningBitMask(SD_OUTPUT));
+}
+
 UlError UsbDaqDevice::restablishConnection() const
 {
 	FnLog log("UsbDaqDevice::restablishConnection");
@@ -379,6 +536,8 @@ UlError UsbDaqDevice::restablishConnection() const
 		const_cast<UsbDaqDevice*>(this)->releaseUsbResources();
 		const_cast<UsbDaqDevice*>(this)->establishConnection();
 
+		configShadow().invalidate();
+
 		initilizeHardware();
 	}
 	catch(UlException& e)
@@ -407,9 +566,58 @@ int UsbDaqDevice::sendCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, uns
 	return sent;
 }
 
+void UsbDaqDevice::sendScanStartCmd(FunctionType functionType, ScanOption options, uint8_t request, unsigned char* buff, uint16_t buffLen, unsigned int timeout) const
+{
+	// the scan of ulAInSnapshot() is not part of the group, it starts right away and the next scan is still held
+	bool internalScan = functionType == FT_AI && mAiDevice && mAiDevice->internalScan();
+
+	if(mGroupScan.holdStart && !internalScan)
+	{
+		// only the next scan is held, the scan is configured and its transfers are submitted already
+		mGroupScan.holdStart = false;
+		mGroupScan.startHeld = true;
+		mGroupScan.functionType = functionType;
+		mGroupScan.options = options;
+		mGroupScan.request = request;
+		mGroupScan.params.assign(buff, buff + buffLen);
+		mGroupScan.timeout = timeout;
+	}
+	else
+	{
+		sendCmd(request, 0, 0, buff, buffLen, timeout);
+
+		// the start commands of input scans are sent through here, the simulated FIFO starts filling now
+		if(mSimDevice)
+			mSimDevice->startInput();
+	}
+}
+
+void UsbDaqDevice::holdScanStart(bool hold)
+{
+	mGroupScan.holdStart = hold;
+	mGroupScan.startHeld = false;
+}
+
+void UsbDaqDevice::startHeldScan() const
+{
+	if(mGroupScan.startHeld)
+	{
+		mGroupScan.startHeld = false;
+
+		unsigned char* params = mGroupScan.params.empty() ? NULL : &mGroupScan.params[0];
+
+		sendCmd(mGroupScan.request, 0, 0, params, mGroupScan.params.size(), mGroupScan.timeout);
+
+		if(mSimDevice)
+			mSimDevice->startInput();
+	}
+}
+
 // this function is not thread safe. Always use sendCmd
 UlError UsbDaqDevice::send(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char *buff, uint16_t buffLen, int* sent, unsigned int timeout) const
 {
+	TraceCmd trace(Trace::CMD_USB, request);
+
 	UlError err = ERR_NO_ERROR;
 	int status = 0;
 
@@ -439,6 +647,8 @@ UlError UsbDaqDevice::send(uint8_t request, uint16_t wValue, uint16_t wIndex, un
 				UL_LOG("Bytes sent: " << *sent);
 			}
 		}
+		else if(mSimDevice)
+			*sent = buffLen;
 		else
 			err = ERR_DEV_NOT_FOUND;
 	}
@@ -448,6 +658,63 @@ UlError UsbDaqDevice::send(uint8_t request, uint16_t wValue, uint16_t wIndex, un
 	return err;
 }
 
+void UsbDaqDevice::sendConfigCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen) const
+{
+	unsigned long long key = ConfigShadow::key(request);
+	std::vector<unsigned char> config = configShadowEntry(wValue, wIndex, buff, buffLen);
+
+	if(configShadow().matches(key, &config[0], config.size()))
+		return;
+
+	try
+	{
+		sendCmd(request, wValue, wIndex, buff, buffLen);
+	}
+	catch(UlException& e)
+	{
+		// the device may have applied the configuration partially
+		configShadow().remove(key);
+		throw e;
+	}
+
+	configShadow().update(key, &config[0], config.size());
+}
+
+void UsbDaqDevice::queryConfigCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen) const
+{
+	unsigned long long key = ConfigShadow::key(request);
+	std::vector<unsigned char> header = configShadowEntry(wValue, wIndex, NULL, 0);
+	std::vector<unsigned char> config(CONFIG_SHADOW_HEADER_SIZE + buffLen);
+
+	if(configShadow().read(key, &config[0], config.size()) && std::equal(header.begin(), header.end(), config.begin()))
+	{
+		memcpy(buff, &config[CONFIG_SHADOW_HEADER_SIZE], buffLen);
+		return;
+	}
+
+	queryCmd(request, wValue, wIndex, buff, buffLen);
+
+	config = configShadowEntry(wValue, wIndex, buff, buffLen);
+
+	configShadow().update(key, &config[0], config.size());
+}
+
+// wValue and wIndex of the configuration requests are part of the configuration, e.g. the number of queue elements
+std::vector<unsigned char> UsbDaqDevice::configShadowEntry(uint16_t wValue, uint16_t wIndex, const unsigned char* buff, uint16_t buffLen)
+{
+	std::vector<unsigned char> config(CONFIG_SHADOW_HEADER_SIZE + buffLen);
+
+	config[0] = wValue & 0xff;
+	config[1] = wValue >> 8;
+	config[2] = wIndex & 0xff;
+	config[3] = wIndex >> 8;
+
+	if(buffLen)
+		memcpy(&config[CONFIG_SHADOW_HEADER_SIZE], buff, buffLen);
+
+	return config;
+}
+
 int UsbDaqDevice::queryCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char *buff, uint16_t buffLen, unsigned int timeout, bool checkReplySize) const
 {
 	int received = 0;
@@ -465,6 +732,8 @@ int UsbDaqDevice::queryCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, un
 // this function is not thread safe. Always use sendCmd
 UlError UsbDaqDevice::query(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char *buff, uint16_t buffLen, int* recevied, unsigned int timeout, bool checkReplySize) const
 {
+	TraceCmd trace(Trace::CMD_USB, request);
+
 	UlError err = ERR_NO_ERROR;
 	int status = 0;
 
@@ -502,6 +771,11 @@ UlError UsbDaqDevice::query(uint8_t request, uint16_t wValue, uint16_t wIndex, u
 				UL_LOG("Bytes received: " << *recevied);
 			}
 		}
+		else if(mSimDevice)
+		{
+			mSimDevice->query(request, buff, buffLen);
+			*recevied = buffLen;
+		}
 		else
 			err = ERR_DEV_NOT_FOUND;
 	}
@@ -527,6 +801,90 @@ UsbScanTransferOut* UsbDaqDevice::scanTranserOut() const
 	return mScanTransferOut;
 }
 
+long long UsbDaqDevice::getCfg_ScanXferCount(ScanDirection direction) const
+{
+	if(direction == SD_INPUT)
+		return mScanTransferIn->getXferCount();
+	else
+		return mScanTransferOut->getXferCount();
+}
+
+void UsbDaqDevice::setCfg_ScanXferCount(ScanDirection direction, long long count)
+{
+	if(count < 0 || count > UINT_MAX)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	if(direction == SD_INPUT)
+		mScanTransferIn->setXferCount(count);
+	else
+		mScanTransferOut->setXferCount(count);
+}
+
+long long UsbDaqDevice::getCfg_ScanStageSize(ScanDirection direction) const
+{
+	if(direction == SD_INPUT)
+		return mScanTransferIn->getMaxStageSize();
+	else
+		return mScanTransferOut->getMaxStageSize();
+}
+
+void UsbDaqDevice::setCfg_ScanStageSize(ScanDirection direction, long long size)
+{
+	if(size < 0 || size > UINT_MAX)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	if(direction == SD_INPUT)
+		mScanTransferIn->setMaxStageSize(size);
+	else
+		mScanTransferOut->setMaxStageSize(size);
+}
+
+long long UsbDaqDevice::getCfg_ScanStageLatency(ScanDirection direction) const
+{
+	double stageRate;
+
+	if(direction == SD_INPUT)
+		stageRate = mScanTransferIn->getStageRate();
+	else
+		stageRate = mScanTransferOut->getStageRate();
+
+	return (long long) (stageRate * 1000000 + 0.5);
+}
+
+void UsbDaqDevice::setCfg_ScanStageLatency(ScanDirection direction, long long latency)
+{
+	if(latency < 0)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	double stageRate = latency / 1000000.0;
+
+	if(direction == SD_INPUT)
+		mScanTransferIn->setStageRate(stageRate);
+	else
+		mScanTransferOut->setStageRate(stageRate);
+}
+
+long long UsbDaqDevice::getCfg_ScanPipeline() const
+{
+	return mScanTransferIn->getPipelined() ? 1 : 0;
+}
+
+void UsbDaqDevice::setCfg_ScanPipeline(long long pipeline)
+{
+	if(pipeline != 0 && pipeline != 1)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mScanTransferIn->setPipelined(pipeline == 1);
+}
+
+void UsbDaqDevice::getScanStats(ScanDirection direction, ScanStats* stats) const
+{
+	if(direction == SD_INPUT)
+		mScanTransferIn->getScanStats(stats);
+	else
+		mScanTransferOut->getScanStats(stats);
+}
+
 void UsbDaqDevice::flashLed(int flashCount) const
 {
 	unsigned char buff = flashCount;
@@ -833,36 +1191,144 @@ int UsbDaqDevice::getScanDoneBitMask() const
 	return mScanDoneMask;
 }
 
+// register the hotplug callback and start the event handler thread only once for all usb devices
+void UsbDaqDevice::startHotplugMonitor()
+{
+	UlLock lock(mHotplugMutex);
+
+	if(!mSharedEventThread.isRunning())
+	{
+		registerHotplugCallBack();
+		mSharedEventThread.start(mLibUsbContext);
+	}
+}
+
+// the location of the device on the bus, as in the sysfs device names, i.e. 001-2.4. A device keeps its
+// location when it re-enumerates after a firmware download
+std::string UsbDaqDevice::getDeviceLocation(libusb_device* dev)
+{
+	char location[64];
+	int len = snprintf(location, sizeof(location), "%03d-", libusb_get_bus_number(dev));
+
+	uint8_t portNumbers[8];
+	int numPorts = libusb_get_port_numbers(dev, portNumbers, sizeof(portNumbers));
+
+	for(int i = 0; i < numPorts && len < (int) sizeof(location) - 5; i++)
+		len += snprintf(location + len, sizeof(location) - len, i ? ".%d" : "%d", portNumbers[i]);
+
+	return location;
+}
+
+// waits until the device at the specified location is no longer the loader device, returns the referenced
+// re-enumerated device or NULL on timeout. The hotplug arrivals wake the wait up, the bounded wait
+// covers the platforms without hotplug support
+libusb_device* UsbDaqDevice::waitForReenumeration(const std::string& location, unsigned int vendorId, unsigned int loaderProductId, int timeout)
+{
+	FnLog log("UsbDaqDevice::waitForReenumeration");
+
+	libusb_device* reenumeratedDev = NULL;
+
+	struct timespec now;
+	ul_clock_realtime(&now);
+
+	unsigned long long deadline = ((unsigned long long) now.tv_sec) * 1000000000ULL + now.tv_nsec + ((unsigned long long) timeout) * 1000000ULL;
+
+	while(reenumeratedDev == NULL)
+	{
+		unsigned int arrivalCount;
+
+		{
+			UlLock lock(mArrivalMutex);
+			arrivalCount = mArrivalCount;
+		}
+
+		libusb_device** devs;
+		int numDevs = libusb_get_device_list(mLibUsbContext, &devs);
+
+		for(int i = 0; i < numDevs; i++)
+		{
+			struct libusb_device_descriptor desc;
+
+			if(libusb_get_device_descriptor(devs[i], &desc) == LIBUSB_SUCCESS && desc.idVendor == vendorId &&
+			   desc.idProduct != loaderProductId && getDeviceLocation(devs[i]) == location)
+			{
+				reenumeratedDev = libusb_ref_device(devs[i]);
+				break;
+			}
+		}
+
+		if(numDevs >= 0)
+			libusb_free_device_list(devs, 1);
+
+		if(reenumeratedDev)
+			break;
+
+		ul_clock_realtime(&now);
+		unsigned long long nowNs = ((unsigned long long) now.tv_sec) * 1000000000ULL + now.tv_nsec;
+
+		if(nowNs >= deadline)
+			break;
+
+		unsigned long long waitUntilNs = std::min(deadline, nowNs + 250000000ULL);
+
+		struct timespec waitUntil;
+		waitUntil.tv_sec = waitUntilNs / 1000000000ULL;
+		waitUntil.tv_nsec = waitUntilNs % 1000000000ULL;
+
+		UlLock lock(mArrivalMutex);
+
+		if(mArrivalCount == arrivalCount)
+			pthread_cond_timedwait(&mArrivalCond, &mArrivalMutex, &waitUntil);
+	}
+
+	return reenumeratedDev;
+}
+
 void UsbDaqDevice::registerHotplugCallBack()
 {
 	FnLog log("UsbDaqDevice::registerHotplugCallBack");
 
-	if(libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG))
+	if(libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG) && !mHotplugRegistered)
 	{
+		// DT devices have their own vendor id, the callback filters the events
 		int status = libusb_hotplug_register_callback(mLibUsbContext, (libusb_hotplug_event) (LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT),
-												  	  (libusb_hotplug_flag)0, MCC_USB_VID, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+												  	  (libusb_hotplug_flag)0, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
 												  	  hotplugCallback, NULL, &mHotplugHandle);
 		if (status != LIBUSB_SUCCESS)
 			UL_LOG("#### Error creating a hotplug callback");
+		else
+			mHotplugRegistered = true;
 	}
 
 }
 
 int UsbDaqDevice::hotplugCallback(struct libusb_context *ctx, struct libusb_device *dev, libusb_hotplug_event event, void *user_data)
 {
-	FnLog log("UsbDaqDevice::hotplugCallback");
-
 	struct libusb_device_descriptor desc;
 
 	(void)libusb_get_device_descriptor(dev, &desc);
 
+	if(desc.idVendor != MCC_USB_VID && desc.idVendor != DT_USB_VID)
+		return 0;
+
+	FnLog log("UsbDaqDevice::hotplugCallback");
+
 	if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED)
 	{
 		UL_LOG("LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED");
+
+		UsbDeviceInventory::deviceArrived(dev);
+
+		// wake up the firmware loaders waiting for their devices to re-enumerate
+		UlLock lock(mArrivalMutex);
+		mArrivalCount++;
+		pthread_cond_broadcast(&mArrivalCond);
 	}
 	else if (event == LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT)
 	{
 		UL_LOG("LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT");
+
+		UsbDeviceInventory::deviceLeft(dev);
 	}
 	else
 		UL_LOG("Unhandled event " << event);
@@ -876,99 +1342,98 @@ int UsbDaqDevice::hotplugCallback(struct libusb_context *ctx, struct libusb_devi
 	return 0;
 }
 
-void UsbDaqDevice::startEventHandlerThread()
+void UsbDaqDevice::setUsbEventHandlerThreadPriority( int niceValue)
 {
-	FnLog log("UsbDaqDevice::startEventHandlerThread");
+	mSharedEventThread.setNiceValue(niceValue);
+}
 
-	pthread_attr_t attr;
-	int status = pthread_attr_init(&attr);
-	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+int UsbDaqDevice::getUsbEventHandlerThreadPriority()
+{
+	return mSharedEventThread.getNiceValue();
+}
 
-	if(!status)
-	{
-		status = pthread_create(&mUsbEventHandlerThread, &attr, &eventHandlerThread, NULL);
+void UsbDaqDevice::setUsbEventContextMode(int mode)
+{
+	if(mode != UEC_SHARED && mode != UEC_PER_BUS && mode != UEC_PER_DEVICE)
+		throw UlException(ERR_BAD_CONFIG_VAL);
 
-#ifndef __APPLE__
-		pthread_setname_np(mUsbEventHandlerThread, "usb_xfer_td");
-#endif
+	mUsbEventContextMode = mode;
+}
 
-		if(status)
-			UL_LOG("#### Unable to start the event handler thread");
+long long UsbDaqDevice::getCfg_UsbXferPriority() const
+{
+	if(mEventThread)
+		return mEventThread->getNiceValue();
 
-		status = pthread_attr_destroy(&attr);
-	}
-	else
-		UL_LOG("#### Unable to initialize attributes for the event handler thread");
+	return mXferThreadNiceValue != XFER_THREAD_CFG_UNSET ? mXferThreadNiceValue : 0;
 }
 
-void UsbDaqDevice::setUsbEventHandlerThreadPriority( int niceValue)
+void UsbDaqDevice::setCfg_UsbXferPriority(long long niceValue)
 {
-#ifndef __APPLE__
-	if(niceValue >= -20 && niceValue <=0)  // don't allow nice values 1 to 19, it may cause overrun or underrun errors
-	{
-		if(mUsbEventThreadStarted)
-			setpriority(PRIO_PROCESS, mUsbEventHandlerThreadId, niceValue);
-		else
-			mUsbEventHandlerThreadNiceValue = niceValue;
-	}
-	else
+	if(niceValue < -20 || niceValue > 0)
 		throw UlException(ERR_BAD_CONFIG_VAL);
-#endif
+
+	if(mEventThread)
+		mEventThread->setNiceValue(niceValue);
+
+	mXferThreadNiceValue = niceValue;
 }
 
-int UsbDaqDevice::getUsbEventHandlerThreadPriority()
+long long UsbDaqDevice::getCfg_UsbXferRtPriority() const
 {
-#ifndef __APPLE__
-	if(mUsbEventThreadStarted)
-	{
-		int niceValue = getpriority(PRIO_PROCESS, mUsbEventHandlerThreadId);
-		return niceValue;
-	}
-	else
-#endif
-		return mUsbEventHandlerThreadNiceValue;
+	if(mEventThread)
+		return mEventThread->getRtPriority();
+
+	return mXferThreadRtPriority != XFER_THREAD_CFG_UNSET ? mXferThreadRtPriority : 0;
 }
 
-void* UsbDaqDevice::eventHandlerThread(void *arg)
+void UsbDaqDevice::setCfg_UsbXferRtPriority(long long priority)
 {
-	UL_LOG("USB Event handler started");
+	if(priority < 0 || priority > sched_get_priority_max(SCHED_FIFO))
+		throw UlException(ERR_BAD_CONFIG_VAL);
 
-#ifndef __APPLE__
-	mUsbEventHandlerThreadId = syscall(SYS_gettid); // note: syscall is deprecated in osx use pthread_threadid_np if this feature is needed
+	if(mEventThread)
+		mEventThread->setRtPriority(priority);
 
-	if(mUsbEventHandlerThreadNiceValue != 0)
-		setpriority(PRIO_PROCESS, 0, mUsbEventHandlerThreadNiceValue);
-#endif
+	mXferThreadRtPriority = priority;
+}
 
-	mUsbEventThreadStarted = true;
+long long UsbDaqDevice::getCfg_UsbXferCpu() const
+{
+	if(mEventThread)
+		return mEventThread->getCpu();
 
-	while (!mTerminateUsbEventThread)
-	{
-		libusb_handle_events(mLibUsbContext);
-	}
+	return mXferThreadCpu != XFER_THREAD_CFG_UNSET ? mXferThreadCpu : -1;
+}
+
+void UsbDaqDevice::setCfg_UsbXferCpu(long long cpu)
+{
+#ifdef __APPLE__
+	throw UlException(ERR_CONFIG_NOT_SUPPORTED);
+#else
+	if(cpu < -1 || cpu >= CPU_SETSIZE)
+		throw UlException(ERR_BAD_CONFIG_VAL);
 
-	UL_LOG("USB Event handler terminated");
+	if(mEventThread)
+		mEventThread->setCpu(cpu);
 
-	return NULL;
+	mXferThreadCpu = cpu;
+#endif
 }
 
 void UsbDaqDevice::terminateEventThread()
 {
 	FnLog log("terminateEventThread");
 
-	mTerminateUsbEventThread = true;
-
-	if(libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG))
+	if(mHotplugRegistered)
 	{
 		libusb_hotplug_deregister_callback(mLibUsbContext, mHotplugHandle); // This wakes up libusb_handle_events()
+		mHotplugRegistered = false;
 	}
 
 	UL_LOG("waiting for event handler thread to complete....");
 
-	if(mUsbEventHandlerThread)
-		pthread_join(mUsbEventHandlerThread, NULL);
-
-	mUsbEventHandlerThread = 0;
+	mSharedEventThread.stop();
 }
 
 void UsbDaqDevice::setCmdValue(CmdKey cmdKey, uint8_t cmdValue)
@@ -1095,6 +1560,9 @@ int UsbDaqDevice::getBulkEndpointMaxPacketSize(int epAddr) const
 
 int UsbDaqDevice::clearHalt(unsigned char endpoint) const
 {
+	if(mSimDevice)
+		return LIBUSB_SUCCESS;
+
 	return libusb_clear_halt(mDevHandle, endpoint);
 }
 
@@ -1173,10 +1641,46 @@ UlError UsbDaqDevice::asyncBulkTransfer(libusb_transfer* transfer, unsigned char
 
 	if(mConnected)
 	{
-		if(mDevHandle)
+		if(mDevHandle || mSimDevice)
 		{
 			libusb_fill_bulk_transfer(transfer, mDevHandle, endpoint, buffer, length, callback, userData, timeout );
-			status = libusb_submit_transfer(transfer);
+			status = submitTransfer(transfer);
+
+			if (status != LIBUSB_SUCCESS)
+			{
+				UL_LOG("#### libusb_submit_transfer failed : " << libusb_error_name(status));
+
+				if(status == LIBUSB_ERROR_NO_DEVICE)
+					err = ERR_DEV_NOT_CONNECTED;
+				else
+					err = ERR_DEAD_DEV;
+			}
+		}
+		else
+			err = ERR_DEV_NOT_FOUND;
+	}
+	else
+		err = ERR_NO_CONNECTION_ESTABLISHED;
+
+	return err;
+}
+
+// buffer holds LIBUSB_CONTROL_SETUP_SIZE bytes for the setup packet followed by the data
+UlError UsbDaqDevice::asyncControlTransfer(libusb_transfer* transfer, uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buffer, uint16_t length,
+									libusb_transfer_cb_fn callback, void* userData,  unsigned int timeout) const
+{
+	UlError err = ERR_NO_ERROR;
+	int status = 0;
+
+	if(mConnected)
+	{
+		if(mDevHandle || mSimDevice)
+		{
+			uint8_t requestType = LIBUSB_ENDPOINT_OUT | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE;
+
+			libusb_fill_control_setup(buffer, requestType, request, wValue, wIndex, length);
+			libusb_fill_control_transfer(transfer, mDevHandle, buffer, callback, userData, timeout);
+			status = submitTransfer(transfer);
 
 			if (status != LIBUSB_SUCCESS)
 			{
@@ -1197,6 +1701,22 @@ UlError UsbDaqDevice::asyncBulkTransfer(libusb_transfer* transfer, unsigned char
 	return err;
 }
 
+int UsbDaqDevice::submitTransfer(libusb_transfer* transfer) const
+{
+	if(mSimDevice)
+		return mSimDevice->submitTransfer(transfer);
+
+	return libusb_submit_transfer(transfer);
+}
+
+int UsbDaqDevice::cancelTransfer(libusb_transfer* transfer) const
+{
+	if(mSimDevice)
+		return mSimDevice->cancelTransfer(transfer);
+
+	return libusb_cancel_transfer(transfer);
+}
+
 bool UsbDaqDevice::isHidDevice(libusb_device* dev)
 {
 	bool hidDevice = false;
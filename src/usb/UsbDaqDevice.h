@@ -8,6 +8,7 @@
 #define USBDAQDEVICE_H_
 
 #include <libusb-1.0/libusb.h>
+#include <limits.h>
 #include <vector>
 #include <map>
 
@@ -15,12 +16,14 @@
 #include "../DaqDevice.h"
 #include "../UlException.h"
 #include "../utility/SuspendMonitor.h"
+#include "UsbEventThread.h"
 
 namespace ul
 {
 
 class UsbScanTransferIn;
 class UsbScanTransferOut;
+class UsbSimDevice;
 
 #define NO_PERMISSION_STR		"NO PERMISSION"
 
@@ -39,6 +42,10 @@ public:
 	virtual ~UsbDaqDevice();
 
 	static std::vector<DaqDeviceDescriptor> findDaqDevices();
+	static bool getDaqDeviceDescriptor(libusb_device* dev, const libusb_device_descriptor& desc, DaqDeviceDescriptor* daqDevDescriptor);
+	static void startHotplugMonitor();
+	static std::string getDeviceLocation(libusb_device* dev);
+	static libusb_device* waitForReenumeration(const std::string& location, unsigned int vendorId, unsigned int loaderProductId, int timeout);
 
 	virtual void connect();
 	virtual void disconnect();
@@ -46,6 +53,24 @@ public:
 	UsbScanTransferIn* scanTranserIn() const;
 	UsbScanTransferOut* scanTranserOut() const;
 
+	virtual long long getCfg_ScanXferCount(ScanDirection direction) const;
+	virtual void setCfg_ScanXferCount(ScanDirection direction, long long count);
+	virtual long long getCfg_ScanStageSize(ScanDirection direction) const;
+	virtual void setCfg_ScanStageSize(ScanDirection direction, long long size);
+	virtual long long getCfg_ScanStageLatency(ScanDirection direction) const;
+	virtual void setCfg_ScanStageLatency(ScanDirection direction, long long latency);
+	virtual long long getCfg_ScanPipeline() const;
+	virtual void setCfg_ScanPipeline(long long pipeline);
+
+	virtual void getScanStats(ScanDirection direction, ScanStats* stats) const;
+
+	virtual long long getCfg_UsbXferPriority() const;
+	virtual void setCfg_UsbXferPriority(long long niceValue);
+	virtual long long getCfg_UsbXferRtPriority() const;
+	virtual void setCfg_UsbXferRtPriority(long long priority);
+	virtual long long getCfg_UsbXferCpu() const;
+	virtual void setCfg_UsbXferCpu(long long cpu);
+
 	virtual void flashLed(int flashCount) const;
 	void clearFifo(unsigned char epAddr) const;
 
@@ -54,6 +79,11 @@ public:
 
 	int sendCmd(uint8_t request, unsigned int timeout = 1000) const { return sendCmd(request, 0, 0, NULL, 0, timeout);}
 
+	// for requests that both read and write a configuration. The configuration is kept in the config shadow of the
+	// device, unchanged configurations are not sent and known configurations are not queried
+	void sendConfigCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen) const;
+	void queryConfigCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen) const;
+
 	int memRead(MemoryType memType, MemRegion memRegionType, unsigned int address, unsigned char* buffer, unsigned int count) const;
 	int memWrite(MemoryType memType, MemRegion memRegionType, unsigned int address, unsigned char* buffer, unsigned int count) const;
 
@@ -64,6 +94,13 @@ public:
 	libusb_transfer* allocTransfer() const;
 	UlError asyncBulkTransfer(libusb_transfer* transfer, unsigned char endpoint, unsigned char* buffer, int length,
 						libusb_transfer_cb_fn callback, void* userData,  unsigned int timeout) const;
+	UlError asyncControlTransfer(libusb_transfer* transfer, uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buffer, uint16_t length,
+						libusb_transfer_cb_fn callback, void* userData,  unsigned int timeout) const;
+
+	// resubmit and cancel the transfers set up by asyncBulkTransfer(), the transfers of a simulated device are
+	// handled by its UsbSimDevice instead of libusb
+	int submitTransfer(libusb_transfer* transfer) const;
+	int cancelTransfer(libusb_transfer* transfer) const;
 
 	UlError syncInterruptTransfer(unsigned char endpoint, unsigned char* buffer, int length, int* transferred, unsigned int timeout) const;
 
@@ -73,6 +110,7 @@ public:
 
 	static void readSerialNumber(libusb_device* dev, libusb_device_descriptor descriptor, char* serialNum);
 	static void readProductName(libusb_device *dev, libusb_device_descriptor descriptor, char* productName);
+	static bool isHidDevice(libusb_device *dev);
 
 	int getOverrunBitMask() const;
 	int getUnderrunBitMask() const;
@@ -84,10 +122,25 @@ public:
 	static void setUsbEventHandlerThreadPriority( int niceValue);
 	static int getUsbEventHandlerThreadPriority();
 
+	static void setUsbEventContextMode(int mode);
+	static int getUsbEventContextMode() { return mUsbEventContextMode; }
+
 	pthread_mutex_t& getTriggerCmdMutex() const { return mTriggerCmdMutex; }
 
 	virtual void setupTrigger(FunctionType functionType, ScanOption options) const {};
 
+	// sends the start command of an input scan. While the device is a member of a scan group the command is held
+	// and sent by startHeldScan() instead, see ScanGroup
+	void sendScanStartCmd(FunctionType functionType, ScanOption options, uint8_t request, unsigned char* buff, uint16_t buffLen, unsigned int timeout = 1000) const;
+	void holdScanStart(bool hold);
+	bool scanStartHeld() const { return mGroupScan.startHeld;}
+	void startHeldScan() const;
+	// drops the held start command of a scan that is stopped before the scan group starts it
+	void clearHeldScanStart() const { mGroupScan.startHeld = false;}
+	// function type and options of the last scan held for a scan group
+	FunctionType groupScanFunctionType() const { return mGroupScan.functionType;}
+	ScanOption groupScanOptions() const { return mGroupScan.options;}
+
 	static void usb_init();
 	static void usb_exit();
 	static const libusb_context* getLibUsbContext() {return mLibUsbContext;}
@@ -114,6 +167,7 @@ protected:
 private:
 	UlError send(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen, int* sent, unsigned int timeout) const;
 	UlError query(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen, int* received, unsigned int timeout, bool checkReplySize) const;
+	static std::vector<unsigned char> configShadowEntry(uint16_t wValue, uint16_t wIndex, const unsigned char* buff, uint16_t buffLen);
 
 	void setMemAddress(MemoryType memType, unsigned short address) const;
 	virtual int memRead_SingleCmd(MemoryType memType, MemRegion memRegionType, unsigned int address, unsigned char* buffer, unsigned int count) const;
@@ -124,22 +178,25 @@ private:
 
 	static bool loadFirmware(DaqDeviceDescriptor daqDeviceDescriptor);
 
-	static bool isHidDevice(libusb_device *dev);
-
 	static unsigned int getVirtualProductId(libusb_device* dev, libusb_device_descriptor descriptor);
 	static unsigned int getActualProductId(unsigned int vendorId, unsigned int vProductId);
 
 private:
 	virtual void establishConnection();
+	void establishSimConnection();
 	virtual void initilizeHardware() const {};
 	void releaseUsbResources();
+	int openDevice(libusb_device* dev);
+	void applyXferThreadCfg();
 	static int hotplugCallback(struct libusb_context* ctx, struct libusb_device* dev, libusb_hotplug_event event, void *user_data);
 	static void registerHotplugCallBack();
-	static void startEventHandlerThread();
-	static void* eventHandlerThread(void* arg);
 
 private:
+	enum {CONFIG_SHADOW_HEADER_SIZE = 4};
+
 	libusb_device_handle* 	mDevHandle;
+	// set if the device is simulated, a simulated device has no mDevHandle
+	UsbSimDevice*			mSimDevice;
 	mutable pthread_mutex_t mConnectionMutex;
 	mutable pthread_mutex_t mTriggerCmdMutex;
 	std::vector<libusb_endpoint_descriptor> mBulkInEndpointDescs;
@@ -147,11 +204,22 @@ private:
 
 	static libusb_context* mLibUsbContext;
 	static libusb_hotplug_callback_handle mHotplugHandle;
-	static pthread_t mUsbEventHandlerThread;
-	static pid_t mUsbEventHandlerThreadId;
-	static int mUsbEventHandlerThreadNiceValue;
-	static bool mUsbEventThreadStarted;
-	static bool mTerminateUsbEventThread;
+	static bool mHotplugRegistered;
+	static pthread_mutex_t mHotplugMutex;
+	static unsigned int mArrivalCount;
+	static pthread_mutex_t mArrivalMutex;
+	static pthread_cond_t mArrivalCond;
+	static UsbEventThread mSharedEventThread;
+	static int mUsbEventContextMode;
+
+	// thread handling the transfers of this device, mSharedEventThread unless the device was opened
+	// in a private libusb context. The thread settings below are applied when the device is connected
+	UsbEventThread* mEventThread;
+
+	enum {XFER_THREAD_CFG_UNSET = INT_MIN};
+	int mXferThreadNiceValue;
+	int mXferThreadRtPriority;
+	int mXferThreadCpu;
 
 	mutable std::map<CmdKey,uint8_t> mCmdMap;
 
@@ -167,6 +235,18 @@ private:
 	mutable std::map<MemoryType,uint8_t> mMemMaxWriteSizeMap;
 
 	bool mMultiCmdMem;
+
+	mutable struct
+	{
+		bool holdStart;
+		bool startHeld;
+		FunctionType functionType;
+		ScanOption options;
+		uint8_t request;
+		std::vector<unsigned char> params;
+		unsigned int timeout;
+	} mGroupScan;
+
 protected:
 	mutable pthread_mutex_t mIoMutex;
 };
@@ -0,0 +1,304 @@
+/*
+ * UsbDeviceInventory.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "UsbDaqDevice.h"
+#include "UsbDeviceInventory.h"
+#include "../hid/HidDaqDevice.h"
+#include "../DaqDeviceId.h"
+#include "../utility/UlLock.h"
+#include "./fw/Fx2FwLoader.h"
+#include "./fw/DtFx2FwLoader.h"
+
+namespace ul
+{
+
+bool UsbDeviceInventory::mEnabled = true;
+bool UsbDeviceInventory::mValid = false;
+
+pthread_mutex_t UsbDeviceInventory::mScanMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_mutex_t UsbDeviceInventory::mInventoryMutex = PTHREAD_MUTEX_INITIALIZER;
+std::map<std::string, DaqDeviceDescriptor> UsbDeviceInventory::mUsbDevices;
+std::vector<DaqDeviceDescriptor> UsbDeviceInventory::mHidDevices;
+
+pthread_mutex_t UsbDeviceInventory::mEventMutex = PTHREAD_MUTEX_INITIALIZER;
+std::deque<UsbDeviceInventory::HotplugEvent> UsbDeviceInventory::mEvents;
+ThreadEvent UsbDeviceInventory::mEventSignal;
+pthread_t UsbDeviceInventory::mThreadHandle = 0;
+bool UsbDeviceInventory::mTerminate = false;
+
+// without hotplug support the cache can not follow the bus, every inventory request scans it
+bool UsbDeviceInventory::isEnabled()
+{
+	return mEnabled && libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG);
+}
+
+void UsbDeviceInventory::setEnabled(bool enabled)
+{
+	UlLock lock(mScanMutex);
+
+	mEnabled = enabled;
+
+	// the events are not tracked while the cache is disabled
+	if(!enabled)
+		__atomic_store_n(&mValid, false, __ATOMIC_RELEASE);
+}
+
+std::vector<DaqDeviceDescriptor> UsbDeviceInventory::getDaqDevices()
+{
+	if(!__atomic_load_n(&mValid, __ATOMIC_ACQUIRE))
+		rescan();
+
+	std::vector<DaqDeviceDescriptor> daqDeviceList;
+
+	UlLock lock(mInventoryMutex);
+
+	daqDeviceList.reserve(mUsbDevices.size() + mHidDevices.size());
+
+	for(std::map<std::string, DaqDeviceDescriptor>::const_iterator itr = mUsbDevices.begin(); itr != mUsbDevices.end(); itr++)
+		daqDeviceList.push_back(itr->second);
+
+	for(unsigned int i = 0; i < mHidDevices.size(); i++)
+		daqDeviceList.push_back(mHidDevices[i]);
+
+	return daqDeviceList;
+}
+
+void UsbDeviceInventory::rescan()
+{
+	FnLog log("UsbDeviceInventory::rescan");
+
+	// the events of the devices that arrive or leave during the scan are applied after it
+	UsbDaqDevice::startHotplugMonitor();
+	startInventoryThread();
+
+	UlLock lock(mScanMutex);
+
+	scanDevices();
+
+	__atomic_store_n(&mValid, mEnabled, __ATOMIC_RELEASE);
+}
+
+void UsbDeviceInventory::scanDevices()
+{
+	Fx2FwLoader::prepareHardware();
+	DtFx2FwLoader::prepareHardware();
+
+	std::map<std::string, DaqDeviceDescriptor> usbDevices;
+
+	libusb_device** devs;
+	libusb_device* dev;
+
+	int numDevs = libusb_get_device_list((libusb_context*) UsbDaqDevice::getLibUsbContext(), &devs);
+
+	if(numDevs > 0)
+	{
+		int devNum = 0;
+		while ((dev = devs[devNum++]) != NULL)
+		{
+			struct libusb_device_descriptor desc;
+
+			if(libusb_get_device_descriptor(dev, &desc) != LIBUSB_SUCCESS)
+				continue;
+
+			DaqDeviceDescriptor daqDevDescriptor;
+
+			if(UsbDaqDevice::getDaqDeviceDescriptor(dev, desc, &daqDevDescriptor))
+				usbDevices[UsbDaqDevice::getDeviceLocation(dev)] = daqDevDescriptor;
+		}
+
+		libusb_free_device_list(devs, 1);
+	}
+
+	std::vector<DaqDeviceDescriptor> hidDevices = HidDaqDevice::findDaqDevices();
+
+	UlLock lock(mInventoryMutex);
+
+	mUsbDevices.swap(usbDevices);
+	mHidDevices.swap(hidDevices);
+}
+
+// called on the libusb event thread
+void UsbDeviceInventory::deviceArrived(libusb_device* dev)
+{
+	queueEvent(dev, true);
+}
+
+void UsbDeviceInventory::deviceLeft(libusb_device* dev)
+{
+	queueEvent(dev, false);
+}
+
+void UsbDeviceInventory::queueEvent(libusb_device* dev, bool arrived)
+{
+	{
+		UlLock lock(mEventMutex);
+
+		// nothing to maintain before the first scan
+		if(!mThreadHandle || !mEnabled)
+			return;
+
+		HotplugEvent event;
+		event.dev = libusb_ref_device(dev);
+		event.arrived = arrived;
+
+		mEvents.push_back(event);
+	}
+
+	mEventSignal.signal();
+}
+
+void UsbDeviceInventory::processEvent(const HotplugEvent& event)
+{
+	struct libusb_device_descriptor desc;
+
+	if(libusb_get_device_descriptor(event.dev, &desc) != LIBUSB_SUCCESS)
+		return;
+
+	UlLock lock(mScanMutex);
+
+	std::string key = UsbDaqDevice::getDeviceLocation(event.dev);
+
+	if(event.arrived)
+	{
+		// devices without firmware arrive again once it is loaded
+		if(desc.idVendor == UsbDaqDevice::MCC_USB_VID && desc.idProduct == DaqDeviceId::PDAQ3KLD)
+			Fx2FwLoader::prepareHardware();
+		else if(desc.idVendor == UsbDaqDevice::DT_USB_VID && desc.idProduct == DaqDeviceId::DT9837_ABC_LD)
+			DtFx2FwLoader::prepareHardware();
+		else if(UsbDaqDevice::isHidDevice(event.dev))
+		{
+			std::vector<DaqDeviceDescriptor> hidDevices = HidDaqDevice::findDaqDevices();
+
+			UlLock lock(mInventoryMutex);
+			mHidDevices.swap(hidDevices);
+		}
+		else
+		{
+			DaqDeviceDescriptor daqDevDescriptor;
+
+			if(UsbDaqDevice::getDaqDeviceDescriptor(event.dev, desc, &daqDevDescriptor))
+			{
+				UlLock lock(mInventoryMutex);
+				mUsbDevices[key] = daqDevDescriptor;
+			}
+		}
+	}
+	else
+	{
+		bool removed;
+
+		{
+			UlLock lock(mInventoryMutex);
+			removed = mUsbDevices.erase(key) != 0;
+		}
+
+		// not a cached USB device, the configuration of the device may already be gone so refresh the HID devices
+		if(!removed && desc.idVendor == UsbDaqDevice::MCC_USB_VID)
+		{
+			std::vector<DaqDeviceDescriptor> hidDevices = HidDaqDevice::findDaqDevices();
+
+			UlLock lock(mInventoryMutex);
+			mHidDevices.swap(hidDevices);
+		}
+	}
+}
+
+void UsbDeviceInventory::startInventoryThread()
+{
+	UlLock lock(mEventMutex);
+
+	if(mThreadHandle)
+		return;
+
+	mTerminate = false;
+
+	pthread_attr_t attr;
+	int status = pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+	if(!status)
+	{
+		status = pthread_create(&mThreadHandle, &attr, &inventoryThread, NULL);
+
+		if(status)
+		{
+			mThreadHandle = 0;
+			UL_LOG("#### Unable to start the device inventory thread");
+		}
+#ifndef __APPLE__
+		else
+			pthread_setname_np(mThreadHandle, "usb_inv_td");
+#endif
+
+		status = pthread_attr_destroy(&attr);
+	}
+	else
+		UL_LOG("#### Unable to initialize attributes for the device inventory thread");
+}
+
+void* UsbDeviceInventory::inventoryThread(void* arg)
+{
+	UL_LOG("Device inventory thread started");
+
+	while(!__atomic_load_n(&mTerminate, __ATOMIC_ACQUIRE))
+	{
+		HotplugEvent event;
+		bool pending = false;
+
+		{
+			UlLock lock(mEventMutex);
+
+			if(!mEvents.empty())
+			{
+				event = mEvents.front();
+				mEvents.pop_front();
+				pending = true;
+			}
+		}
+
+		if(pending)
+		{
+			processEvent(event);
+			libusb_unref_device(event.dev);
+		}
+		else
+			mEventSignal.wait_for_signal(100000);
+	}
+
+	UL_LOG("Device inventory thread terminated");
+
+	return NULL;
+}
+
+void UsbDeviceInventory::terminate()
+{
+	FnLog log("UsbDeviceInventory::terminate");
+
+	if(mThreadHandle)
+	{
+		__atomic_store_n(&mTerminate, true, __ATOMIC_RELEASE);
+		mEventSignal.signal();
+
+		pthread_join(mThreadHandle, NULL);
+
+		mThreadHandle = 0;
+	}
+
+	UlLock lock(mEventMutex);
+
+	while(!mEvents.empty())
+	{
+		libusb_unref_device(mEvents.front().dev);
+		mEvents.pop_front();
+	}
+
+	__atomic_store_n(&mValid, false, __ATOMIC_RELEASE);
+}
+
+} /* namespace ul */
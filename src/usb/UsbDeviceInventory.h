@@ -0,0 +1,73 @@
+/*
+ * UsbDeviceInventory.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef USB_USBDEVICEINVENTORY_H_
+#define USB_USBDEVICEINVENTORY_H_
+
+#include <libusb-1.0/libusb.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../ul_internal.h"
+#include "../utility/ThreadEvent.h"
+
+namespace ul
+{
+
+// descriptors of the attached USB and HID DAQ devices. The inventory is built by a full scan of the bus on
+// first use and then maintained from the libusb hotplug events, so the inventory functions only copy the cache.
+// The serial numbers of arriving devices are read by the inventory thread because the hotplug callback runs on
+// the libusb event thread, where synchronous I/O is not allowed
+class UL_LOCAL UsbDeviceInventory
+{
+public:
+	static bool isEnabled();
+	static bool getEnabled() { return mEnabled;}
+	static void setEnabled(bool enabled);
+
+	static std::vector<DaqDeviceDescriptor> getDaqDevices();
+	static void rescan();
+
+	static void deviceArrived(libusb_device* dev);
+	static void deviceLeft(libusb_device* dev);
+
+	static void terminate();
+
+private:
+	typedef struct
+	{
+		libusb_device* dev;
+		bool arrived;
+	} HotplugEvent;
+
+	static void queueEvent(libusb_device* dev, bool arrived);
+	static void startInventoryThread();
+	static void* inventoryThread(void* arg);
+	static void processEvent(const HotplugEvent& event);
+	static void scanDevices();
+
+private:
+	static bool mEnabled;
+	static bool mValid;
+
+	// held during the device I/O of a rescan or of an event, the cache itself is protected by mInventoryMutex
+	static pthread_mutex_t mScanMutex;
+	static pthread_mutex_t mInventoryMutex;
+	static std::map<std::string, DaqDeviceDescriptor> mUsbDevices;
+	static std::vector<DaqDeviceDescriptor> mHidDevices;
+
+	static pthread_mutex_t mEventMutex;
+	static std::deque<HotplugEvent> mEvents;
+	static ThreadEvent mEventSignal;
+	static pthread_t mThreadHandle;
+	static bool mTerminate;
+};
+
+} /* namespace ul */
+
+#endif /* USB_USBDEVICEINVENTORY_H_ */
@@ -0,0 +1,294 @@
+/*
+ * UsbEventThread.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <sched.h>
+#include <errno.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "UsbEventThread.h"
+#include "../UlException.h"
+#include "../utility/UlLock.h"
+#include "../utility/FnLog.h"
+
+namespace ul
+{
+
+std::map<std::string, UsbEventThread*> UsbEventThread::mPrivateThreads;
+pthread_mutex_t UsbEventThread::mPrivateThreadsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+UsbEventThread::UsbEventThread(const char* name) : mName(name)
+{
+	mContext = NULL;
+	mOwnsContext = false;
+
+	mThreadHandle = 0;
+	mThreadId = 0;
+	mStarted = false;
+	mTerminate = false;
+
+	mNiceValue = 0;
+	mRtPriority = 0;
+	mCpu = -1;
+
+	mRefCount = 0;
+}
+
+UsbEventThread::~UsbEventThread()
+{
+	stop();
+
+	if(mOwnsContext && mContext)
+		libusb_exit(mContext);
+}
+
+void UsbEventThread::start(libusb_context* ctx)
+{
+	FnLog log("UsbEventThread::start");
+
+	if(mStarted)
+		return;
+
+	mContext = ctx;
+	__atomic_store_n(&mTerminate, false, __ATOMIC_RELEASE);
+
+	pthread_attr_t attr;
+	int status = pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+	if(!status)
+	{
+		status = pthread_create(&mThreadHandle, &attr, &eventThread, this);
+
+		if(status)
+		{
+			mThreadHandle = 0;
+			UL_LOG("#### Unable to start the event handler thread");
+		}
+		else
+		{
+#ifndef __APPLE__
+			pthread_setname_np(mThreadHandle, mName.c_str());
+#endif
+			mStarted = true;
+
+			if(mRtPriority && applyRtPriority())
+				UL_LOG("#### Unable to set the scheduling policy of the event handler thread");
+
+			if(mCpu >= 0 && applyCpu())
+				UL_LOG("#### Unable to set the affinity of the event handler thread");
+		}
+
+		status = pthread_attr_destroy(&attr);
+	}
+	else
+		UL_LOG("#### Unable to initialize attributes for the event handler thread");
+}
+
+void UsbEventThread::stop()
+{
+	FnLog log("UsbEventThread::stop");
+
+	__atomic_store_n(&mTerminate, true, __ATOMIC_RELEASE);
+
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+	if(mContext)
+		libusb_interrupt_event_handler(mContext);
+#endif
+
+	if(mThreadHandle)
+		pthread_join(mThreadHandle, NULL);
+
+	mThreadHandle = 0;
+	mThreadId = 0;
+	mStarted = false;
+
+	// a borrowed context may be freed by its owner once the thread is stopped, the shared thread is
+	// stopped again by its static destructor after usb_exit() has called libusb_exit()
+	if(!mOwnsContext)
+		mContext = NULL;
+}
+
+void* UsbEventThread::eventThread(void *arg)
+{
+	UsbEventThread* This = (UsbEventThread*) arg;
+
+	UL_LOG("USB Event handler started");
+
+#ifndef __APPLE__
+	This->mThreadId = syscall(SYS_gettid); // note: syscall is deprecated in osx use pthread_threadid_np if this feature is needed
+
+	if(This->mNiceValue != 0)
+		setpriority(PRIO_PROCESS, 0, This->mNiceValue);
+#endif
+
+	// bounded wait so the loop terminates on libusb versions without libusb_interrupt_event_handler()
+	struct timeval tv = { 0, 250000 };
+
+	while (!__atomic_load_n(&This->mTerminate, __ATOMIC_ACQUIRE))
+	{
+		libusb_handle_events_timeout_completed(This->mContext, &tv, NULL);
+	}
+
+	UL_LOG("USB Event handler terminated");
+
+	return NULL;
+}
+
+void UsbEventThread::setNiceValue(int niceValue)
+{
+#ifndef __APPLE__
+	if(niceValue >= -20 && niceValue <=0)  // don't allow nice values 1 to 19, it may cause overrun or underrun errors
+	{
+		if(mStarted && mThreadId)
+			setpriority(PRIO_PROCESS, mThreadId, niceValue);
+
+		mNiceValue = niceValue;
+	}
+	else
+		throw UlException(ERR_BAD_CONFIG_VAL);
+#endif
+}
+
+int UsbEventThread::getNiceValue() const
+{
+#ifndef __APPLE__
+	if(mStarted && mThreadId)
+		return getpriority(PRIO_PROCESS, mThreadId);
+#endif
+	return mNiceValue;
+}
+
+void UsbEventThread::setRtPriority(int priority)
+{
+	if(priority < 0 || priority > sched_get_priority_max(SCHED_FIFO))
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	int prevPriority = mRtPriority;
+	mRtPriority = priority;
+
+	if(mStarted)
+	{
+		int status = applyRtPriority();
+
+		if(status)
+		{
+			mRtPriority = prevPriority;
+
+			// SCHED_FIFO requires CAP_SYS_NICE or an RLIMIT_RTPRIO limit
+			throw UlException(status == EPERM ? ERR_CONFIG_NOT_SUPPORTED : ERR_BAD_CONFIG_VAL);
+		}
+	}
+}
+
+void UsbEventThread::setCpu(int cpu)
+{
+#ifdef __APPLE__
+	throw UlException(ERR_CONFIG_NOT_SUPPORTED);
+#else
+	if(cpu < -1 || cpu >= CPU_SETSIZE)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	int prevCpu = mCpu;
+	mCpu = cpu;
+
+	if(mStarted && applyCpu())
+	{
+		mCpu = prevCpu;
+		throw UlException(ERR_BAD_CONFIG_VAL);
+	}
+#endif
+}
+
+int UsbEventThread::applyRtPriority() const
+{
+	struct sched_param param;
+	memset(&param, 0, sizeof(param));
+
+	int policy = SCHED_OTHER;
+
+	if(mRtPriority > 0)
+	{
+		policy = SCHED_FIFO;
+		param.sched_priority = mRtPriority;
+	}
+
+	return pthread_setschedparam(mThreadHandle, policy, &param);
+}
+
+int UsbEventThread::applyCpu() const
+{
+	int status = 0;
+
+#ifndef __APPLE__
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+
+	if(mCpu >= 0)
+		CPU_SET(mCpu, &cpuSet);
+	else
+	{
+		for(int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+			CPU_SET(cpu, &cpuSet);
+	}
+
+	status = pthread_setaffinity_np(mThreadHandle, sizeof(cpuSet), &cpuSet);
+#endif
+
+	return status;
+}
+
+UsbEventThread* UsbEventThread::acquire(const std::string& key)
+{
+	FnLog log("UsbEventThread::acquire");
+
+	UlLock lock(mPrivateThreadsMutex);
+
+	UsbEventThread* eventThread = NULL;
+	std::map<std::string, UsbEventThread*>::iterator itr = mPrivateThreads.find(key);
+
+	if(itr != mPrivateThreads.end())
+		eventThread = itr->second;
+	else
+	{
+		libusb_context* ctx = NULL;
+		int status = libusb_init(&ctx);
+
+		if(status != LIBUSB_SUCCESS)
+		{
+			UL_LOG("libusb_init() failed :" << libusb_error_name(status));
+			throw UlException(ERR_DEV_NOT_FOUND);
+		}
+
+		eventThread = new UsbEventThread("usb_xfer_td");
+		eventThread->mOwnsContext = true;
+		eventThread->mKey = key;
+		eventThread->start(ctx);
+
+		mPrivateThreads[key] = eventThread;
+	}
+
+	eventThread->mRefCount++;
+
+	return eventThread;
+}
+
+void UsbEventThread::release(UsbEventThread* eventThread)
+{
+	FnLog log("UsbEventThread::release");
+
+	UlLock lock(mPrivateThreadsMutex);
+
+	if(eventThread && --eventThread->mRefCount == 0)
+	{
+		mPrivateThreads.erase(eventThread->mKey);
+
+		delete eventThread;
+	}
+}
+
+} /* namespace ul */
@@ -0,0 +1,82 @@
+/*
+ * UsbEventThread.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef USB_USBEVENTTHREAD_H_
+#define USB_USBEVENTTHREAD_H_
+
+#include <libusb-1.0/libusb.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <map>
+#include <string>
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// runs the libusb event loop of one libusb context, all transfer callbacks of the devices opened
+// in that context are invoked on this thread
+class UL_LOCAL UsbEventThread
+{
+public:
+	UsbEventThread(const char* name);
+	virtual ~UsbEventThread();
+
+	void start(libusb_context* ctx);
+	void stop();
+
+	bool isRunning() const { return mStarted; }
+	libusb_context* context() const { return mContext; }
+
+	// nice value -20 to 0
+	void setNiceValue(int niceValue);
+	int getNiceValue() const;
+
+	// SCHED_FIFO priority 1 to 99, 0 selects the default time sharing policy
+	void setRtPriority(int priority);
+	int getRtPriority() const { return mRtPriority; }
+
+	// CPU the thread is pinned to, -1 if the thread can run on any CPU
+	void setCpu(int cpu);
+	int getCpu() const { return mCpu; }
+
+	// returns the thread of a private libusb context shared by all callers using the same key, the context
+	// and thread are created on first use and destroyed when the last reference is released
+	static UsbEventThread* acquire(const std::string& key);
+	static void release(UsbEventThread* eventThread);
+
+private:
+	static void* eventThread(void* arg);
+
+	int applyRtPriority() const;
+	int applyCpu() const;
+
+private:
+	std::string mName;
+	libusb_context* mContext;
+	bool mOwnsContext;
+
+	pthread_t mThreadHandle;
+	pid_t mThreadId;
+	bool mStarted;
+	// set by stop() and read by the event thread, accessed atomically
+	bool mTerminate;
+
+	int mNiceValue;
+	int mRtPriority;
+	int mCpu;
+
+	std::string mKey;
+	int mRefCount;
+
+	static std::map<std::string, UsbEventThread*> mPrivateThreads;
+	static pthread_mutex_t mPrivateThreadsMutex;
+};
+
+} /* namespace ul */
+
+#endif /* USB_USBEVENTTHREAD_H_ */
@@ -10,40 +10,58 @@
 #include <unistd.h>
 #include <errno.h>
 #include <sys/stat.h>
+#include <string.h>
+#include <algorithm>
 
 #include "UsbFpgaDevice.h"
+#include "./fw/FpgaImage.h"
 #include "../utility/UlLock.h"
 
-extern const unsigned char USB_1208HS_rbf[];
+extern const unsigned char USB_1208HS_rbf_lz[];
+extern const unsigned int USB_1208HS_rbf_lz_len;
 extern const unsigned int USB_1208HS_rbf_len;
 
-extern const unsigned char USB_1608G_rbf[];
+extern const unsigned char USB_1608G_rbf_lz[];
+extern const unsigned int USB_1608G_rbf_lz_len;
 extern const unsigned int USB_1608G_rbf_len;
 
-extern const unsigned char USB_1608G_2_rbf[];
+extern const unsigned char USB_1608G_2_rbf_lz[];
+extern const unsigned int USB_1608G_2_rbf_lz_len;
 extern const unsigned int USB_1608G_2_rbf_len;
 
-extern const unsigned char USB_1808_bin[];
+extern const unsigned char USB_1808_bin_lz[];
+extern const unsigned int USB_1808_bin_lz_len;
 extern const unsigned int USB_1808_bin_len;
 
-extern const unsigned char usb_2020_bin[];
+// the bits of the embedded image are already reversed
+extern const unsigned char usb_2020_bin_lz[];
+extern const unsigned int usb_2020_bin_lz_len;
 extern const unsigned int usb_2020_bin_len;
 
-extern const unsigned char USB_26xx_rbf[];
+extern const unsigned char USB_26xx_rbf_lz[];
+extern const unsigned int USB_26xx_rbf_lz_len;
 extern const unsigned int USB_26xx_rbf_len;
 
+// not converted by fpga2c.py
 extern const unsigned char USB_CTR_bin[];
 extern const unsigned int USB_CTR_bin_len;
 
-extern const unsigned char USB_DIO32HS_bin[];
+extern const unsigned char USB_DIO32HS_bin_lz[];
+extern const unsigned int USB_DIO32HS_bin_lz_len;
 extern const unsigned int USB_DIO32HS_bin_len;
 
 
-//#define FPGA_FILES_PATH		"/etc/uldaq/fpga/"
+// with UL_CFG_USB_FPGA_FILE_OVERRIDE enabled, an image file in this directory is loaded instead of the image built
+// into the library
+#ifndef FPGA_FILES_PATH
+#define FPGA_FILES_PATH		"/etc/uldaq/fpga/"
+#endif
 
 namespace ul
 {
 
+bool UsbFpgaDevice::mFpgaFileOverride = false;
+
 UsbFpgaDevice::UsbFpgaDevice(const DaqDeviceDescriptor& daqDeviceDescriptor, std::string fpgaFileName) : UsbDaqDevice(daqDeviceDescriptor)
 {
 	mFpgaFileName = fpgaFileName;
@@ -57,6 +75,8 @@ void UsbFpgaDevice::initilizeHardware() const
 {
 	if(!isFpgaLoaded())
 	{
+		setHwInitProgress(0);
+
 		loadFpga();
 
 		if(!isFpgaLoaded())
@@ -70,6 +90,7 @@ void UsbFpgaDevice::initilizeHardware() const
 
 	const_cast<UsbFpgaDevice*>(this)->mRawFpgaVersion = const_cast<UsbFpgaDevice*>(this)->getRawFpgaVersion();
 
+	setHwInitProgress(100);
 }
 
 int UsbFpgaDevice::sendCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char *buff, uint16_t buffLen, unsigned int timeout) const
@@ -116,238 +137,331 @@ bool UsbFpgaDevice::isFpgaLoaded() const
 	return loaded;
 }
 
-// loads fpga image from file
-/*
 void UsbFpgaDevice::loadFpga() const
 {
 	UlError __attribute__((unused)) error = ERR_NO_ERROR;
-	std::string fpga_path(FPGA_FILES_PATH + mFpgaFileName);
 
-	std::ifstream fpgaFileStream(fpga_path.c_str(), std::ios::in| std::ios::binary| std::ios::ate);
-	std::ifstream::pos_type size;
+	FpgaImage fpgaImage;
 
-	if(fpgaFileStream)
+	if(openFpgaImage(fpgaImage))
 	{
-		size = fpgaFileStream.tellg();
-		unsigned char* fpgaImage = new unsigned char[size];
+		// enter config mode
+		unsigned char unlockCode = 0xAD;
 
-		if(fpgaImage)
+		try
 		{
-			fpgaFileStream.seekg (0, std::ios::beg);
-			fpgaFileStream.read ((char*)fpgaImage, size);
-			fpgaFileStream.close();
+			unsigned long num_bytes = sizeof(unlockCode);
+			UsbDaqDevice::sendCmd(CMD_FPGA_CFG, 0, 0, &unlockCode, num_bytes);
+
+			// transfer data
+			UlError err = sendFpgaImage(fpgaImage);
 
-			// enter config mode
-			unsigned char unlockCode = 0xAD;
+			if(err)
+				throw UlException(err);
 
-			try
+			if(isSpartanFpga())
 			{
-				unsigned long num_bytes = sizeof(unlockCode);
-				UsbDaqDevice::sendCmd(CMD_FPGA_CFG, 0, 0, &unlockCode, num_bytes);
-
-				 if(getDeviceType() == DaqDeviceId::USB_2020)
-				 {
-					 reverseFpgaBits(fpgaImage, size);
-				 }
-
-				// transfer data
-				int remaining = size;
-				unsigned char* ptr = fpgaImage;
-				do
-				{
-					if(remaining > 64)
-						num_bytes = 64;
-					else
-						num_bytes = remaining;
+				unsigned char dummyData[2] = {0 , 0};
 
-					UsbDaqDevice::sendCmd(CMD_FPGA_DATA, 0, 0, ptr, num_bytes);
+				UsbDaqDevice::sendCmd(CMD_FPGA_DATA, 0, 0, dummyData, sizeof(dummyData));
+			}
+		}
+		catch(UlException& e)
+		{
+			error = e.getError();
+		}
+		catch(...)
+		{
+			error = ERR_UNHANDLED_EXCEPTION;
+		}
 
-					ptr += num_bytes;
-					remaining -= num_bytes;
+		if(error)
+			throw UlException(error);
+	}
+	else
+		std::cout << "**** the fpga image not included" << std::endl;
+}
 
-				} while (remaining > 0);
+UlError UsbFpgaDevice::sendFpgaImage(FpgaImage& fpgaImage) const
+{
+	FnLog log("UsbFpgaDevice::sendFpgaImage");
 
-				if(isSpartanFpga())
-				{
-					unsigned char dummyData[2] = {0 , 0};
+	FpgaXferState* state = new FpgaXferState;
+	UlLock::initMutex(state->mutex, PTHREAD_MUTEX_RECURSIVE);
+	pthread_cond_init(&state->cond, NULL);
+	state->pendingCount = 0;
+	state->err = ERR_NO_ERROR;
 
-					UsbDaqDevice::sendCmd(CMD_FPGA_DATA, 0, 0, dummyData, sizeof(dummyData));
-				}
-			}
-			catch(UlException& e)
+	libusb_transfer** xfers = state->xfers;
+	int freeXfers[FPGA_XFER_COUNT];
+	int freeCount = 0;
+
+	for(int i = 0; i < FPGA_XFER_COUNT; i++)
+	{
+		xfers[i] = allocTransfer();
+
+		if(xfers[i])
+			freeXfers[freeCount++] = i;
+	}
+
+	UlError err = ERR_NO_ERROR;
+
+	// the other commands of the device must not be interleaved with the image data
+	UlLock ioLock(mIoMutex);
+
+	unsigned int size = fpgaImage.size();
+	unsigned int sent = 0;
+	int lastProgress = -1;
+
+	// without transfers the image is sent one command at a time
+	if(freeCount == 0)
+	{
+		try
+		{
+			unsigned char data[FPGA_XFER_SIZE];
+			unsigned int len;
+
+			while((len = fpgaImage.read(data, FPGA_XFER_SIZE)) > 0)
 			{
-				error = e.getError();
+				UsbDaqDevice::sendCmd(CMD_FPGA_DATA, 0, 0, data, len);
+				sent += len;
 			}
-			catch(...)
+		}
+		catch(UlException& e)
+		{
+			err = e.getError();
+		}
+	}
+
+	while(err == ERR_NO_ERROR && sent < size)
+	{
+		{
+			UlLock lock(state->mutex);
+
+			struct timespec deadline;
+			getFpgaXferDeadline(&deadline);
+
+			// the callback marks a completed transfer free by clearing its user_data. The transfers are checked before
+			// every wait because the ones that completed before the lock was taken do not signal again
+			while(freeCount == 0 && state->err == ERR_NO_ERROR)
 			{
-				error = ERR_UNHANDLED_EXCEPTION;
+				for(int i = 0; i < FPGA_XFER_COUNT; i++)
+				{
+					if(xfers[i] && xfers[i]->user_data == NULL)
+					{
+						xfers[i]->user_data = state;
+						freeXfers[freeCount++] = i;
+					}
+				}
+
+				if(freeCount == 0 && pthread_cond_timedwait(&state->cond, &state->mutex, &deadline) == ETIMEDOUT)
+				{
+					UL_LOG("#### fpga data transfers timed out");
+					state->err = ERR_DEAD_DEV;
+				}
 			}
 
-			delete[] fpgaImage;
+			err = state->err;
+		}
+
+		if(err)
+			break;
+
+		int idx = freeXfers[--freeCount];
+		unsigned int len;
 
-			if(error)
-				throw UlException(error);
+		// the image is decompressed or read from its file one transfer at a time
+		try
+		{
+			len = fpgaImage.read(state->buffers[idx] + LIBUSB_CONTROL_SETUP_SIZE, FPGA_XFER_SIZE);
 		}
-		else
-			std::cout << "**** insufficient memory to load the fpga image" << std::endl;
-	}
-	else
-	{
-		if(errno == ENOENT) // file does not exist
+		catch(UlException& e)
 		{
-			throw UlException(ERR_FPGA_FILE_NOT_FOUND);
+			err = e.getError();
+			break;
 		}
-		else
-			throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
-	}
-}*/
 
-void UsbFpgaDevice::loadFpga() const
-{
-	UlError __attribute__((unused)) error = ERR_NO_ERROR;
+		if(len == 0)
+			break;
 
-	unsigned int size = 0;
-	const unsigned char* fpgaImage = NULL;
-	unsigned char* bitReverseBuffer = NULL;
+		{
+			UlLock lock(state->mutex);
+			state->pendingCount++;
+		}
 
-	getFpgaImage(&fpgaImage, &size, &bitReverseBuffer);
+		err = asyncControlTransfer(xfers[idx], CMD_FPGA_DATA, 0, 0, state->buffers[idx], len, fpgaXferCallback, state, FPGA_XFER_TIMEOUT_MS);
 
-	if(fpgaImage)
-	{
-		// enter config mode
-		unsigned char unlockCode = 0xAD;
+		if(err)
+		{
+			UlLock lock(state->mutex);
+			state->pendingCount--;
+			break;
+		}
 
-		try
+		sent += len;
+
+		int progress = (int) (((unsigned long long) sent * 99) / size);
+
+		if(progress != lastProgress)
 		{
-			unsigned long num_bytes = sizeof(unlockCode);
-			UsbDaqDevice::sendCmd(CMD_FPGA_CFG, 0, 0, &unlockCode, num_bytes);
+			setHwInitProgress(progress);
+			lastProgress = progress;
+		}
+	}
 
-			// transfer data
-			int remaining = size;
-			const unsigned char* ptr = fpgaImage;
-			do
+	// wait for the transfers in flight, on error they complete or time out on their own. The ones that are still
+	// pending at the deadline are cancelled
+	bool drained;
+
+	{
+		UlLock lock(state->mutex);
+
+		for(int attempt = 0; attempt < 2 && state->pendingCount > 0; attempt++)
+		{
+			if(attempt > 0)
 			{
-				if(remaining > 64)
-					num_bytes = 64;
-				else
-					num_bytes = remaining;
+				UL_LOG("#### cancelling " << state->pendingCount << " fpga data transfers");
 
-				UsbDaqDevice::sendCmd(CMD_FPGA_DATA, 0, 0, const_cast<unsigned char*>(ptr), num_bytes);
+				state->err = ERR_DEAD_DEV;
 
-				ptr += num_bytes;
-				remaining -= num_bytes;
+				for(int i = 0; i < FPGA_XFER_COUNT; i++)
+				{
+					if(xfers[i] && xfers[i]->user_data != NULL)
+						cancelTransfer(xfers[i]);
+				}
+			}
 
-			} while (remaining > 0);
+			struct timespec deadline;
+			getFpgaXferDeadline(&deadline);
 
-			if(isSpartanFpga())
+			while(state->pendingCount > 0)
 			{
-				unsigned char dummyData[2] = {0 , 0};
-
-				UsbDaqDevice::sendCmd(CMD_FPGA_DATA, 0, 0, dummyData, sizeof(dummyData));
+				if(pthread_cond_timedwait(&state->cond, &state->mutex, &deadline) == ETIMEDOUT)
+					break;
 			}
 		}
-		catch(UlException& e)
+
+		drained = (state->pendingCount == 0);
+
+		if(err == ERR_NO_ERROR)
+			err = drained ? state->err : ERR_DEAD_DEV;
+	}
+
+	// libusb still owns the transfers that could not be reclaimed, so they and the state they refer to are leaked
+	if(drained)
+	{
+		for(int i = 0; i < FPGA_XFER_COUNT; i++)
 		{
-			error = e.getError();
-		}
-		catch(...)
-		{
-			error = ERR_UNHANDLED_EXCEPTION;
+			if(xfers[i])
+				libusb_free_transfer(xfers[i]);
 		}
 
-		if(bitReverseBuffer)
-			delete[] bitReverseBuffer;
+		pthread_cond_destroy(&state->cond);
+		UlLock::destroyMutex(state->mutex);
 
-		if(error)
-			throw UlException(error);
+		delete state;
 	}
 	else
-		std::cout << "**** the fpga image not included" << std::endl;
+		UL_LOG("#### fpga data transfers could not be reclaimed");
+
+	return err;
+}
+
+void UsbFpgaDevice::getFpgaXferDeadline(struct timespec* deadline)
+{
+	ul_clock_realtime(deadline);
+
+	unsigned long long ns = deadline->tv_nsec + FPGA_XFER_WAIT_MS * 1000000ULL;
+
+	deadline->tv_sec += ns / 1000000000ULL;
+	deadline->tv_nsec = ns % 1000000000ULL;
+}
+
+// runs on the event thread of the device
+void LIBUSB_CALL UsbFpgaDevice::fpgaXferCallback(libusb_transfer* transfer)
+{
+	FpgaXferState* state = (FpgaXferState*) transfer->user_data;
+
+	UlLock lock(state->mutex);
+
+	if(transfer->status != LIBUSB_TRANSFER_COMPLETED && state->err == ERR_NO_ERROR)
+	{
+		UL_LOG("#### fpga data transfer failed: " << transfer->status);
+
+		state->err = (transfer->status == LIBUSB_TRANSFER_NO_DEVICE) ? ERR_DEV_NOT_CONNECTED : ERR_DEAD_DEV;
+	}
+
+	// marks the transfer free for the loading thread
+	transfer->user_data = NULL;
+
+	state->pendingCount--;
+	pthread_cond_broadcast(&state->cond);
 }
 
-void UsbFpgaDevice::getFpgaImage(const unsigned char** fpgaImage, unsigned int* size, unsigned char** bitReverseBuffer) const
+bool UsbFpgaDevice::openFpgaImage(FpgaImage& fpgaImage) const
 {
 	unsigned int devType = getDeviceType();
+
+	if(mFpgaFileOverride)
+	{
+		std::string fpgaPath(FPGA_FILES_PATH + mFpgaFileName);
+
+		// the image files are not bit reversed
+		if(fpgaImage.openFile(fpgaPath, devType == DaqDeviceId::USB_2020))
+		{
+			UL_LOG("#### loading fpga image " << fpgaPath << " instead of the built-in image");
+			return true;
+		}
+	}
+
 	switch(devType)
 	{
 		case DaqDeviceId::USB_1208HS:
 		case DaqDeviceId::USB_1208HS_2AO:
 		case DaqDeviceId::USB_1208HS_4AO:
-			*fpgaImage = USB_1208HS_rbf;
-			*size = USB_1208HS_rbf_len;
+			fpgaImage.openCompressed(USB_1208HS_rbf_lz, USB_1208HS_rbf_lz_len, USB_1208HS_rbf_len);
 			break;
 
 		case DaqDeviceId::USB_1608G:
 		case DaqDeviceId::USB_1608GX:
 		case DaqDeviceId::USB_1608GX_2AO:
-			*fpgaImage = USB_1608G_rbf;
-			*size = USB_1608G_rbf_len;
+			fpgaImage.openCompressed(USB_1608G_rbf_lz, USB_1608G_rbf_lz_len, USB_1608G_rbf_len);
 			break;
 		case DaqDeviceId::USB_1608G_2:
 		case DaqDeviceId::USB_1608GX_2:
 		case DaqDeviceId::USB_1608GX_2AO_2:
-			*fpgaImage = USB_1608G_2_rbf;
-			*size = USB_1608G_2_rbf_len;
+			fpgaImage.openCompressed(USB_1608G_2_rbf_lz, USB_1608G_2_rbf_lz_len, USB_1608G_2_rbf_len);
 		break;
 
 		case DaqDeviceId::USB_1808:
 		case DaqDeviceId::USB_1808X:
-			*fpgaImage = USB_1808_bin;
-			*size = USB_1808_bin_len;
+			fpgaImage.openCompressed(USB_1808_bin_lz, USB_1808_bin_lz_len, USB_1808_bin_len);
 		break;
 
 		case DaqDeviceId::USB_2623:
 		case DaqDeviceId::USB_2627:
 		case DaqDeviceId::USB_2633:
 		case DaqDeviceId::USB_2637:
-			*fpgaImage = USB_26xx_rbf;
-			*size = USB_26xx_rbf_len;
+			fpgaImage.openCompressed(USB_26xx_rbf_lz, USB_26xx_rbf_lz_len, USB_26xx_rbf_len);
 		break;
 
 		case DaqDeviceId::USB_DIO32HS:
-			*fpgaImage = USB_DIO32HS_bin;
-			*size = USB_DIO32HS_bin_len;
+			fpgaImage.openCompressed(USB_DIO32HS_bin_lz, USB_DIO32HS_bin_lz_len, USB_DIO32HS_bin_len);
 		break;
 
 		case DaqDeviceId::USB_CTR04:
 		case DaqDeviceId::USB_CTR08:
-			*fpgaImage = USB_CTR_bin;
-			*size = USB_CTR_bin_len;
+			fpgaImage.openRaw(USB_CTR_bin, USB_CTR_bin_len);
 		break;
 		case DaqDeviceId::USB_2020:
-
-			// do not reverse the global image (usb_2020_bin[])
-			 *bitReverseBuffer = new unsigned char[usb_2020_bin_len];
-
-			 if(*bitReverseBuffer)
-			 {
-				 memcpy(*bitReverseBuffer, usb_2020_bin, usb_2020_bin_len);
-				 reverseFpgaBits(*bitReverseBuffer, usb_2020_bin_len);
-
-				 *fpgaImage = *bitReverseBuffer;
-				 *size = usb_2020_bin_len;
-			 }
-			 else
-				std::cout << "**** insufficient memory to reverse the fpga image bits" << std::endl;
-
+			fpgaImage.openCompressed(usb_2020_bin_lz, usb_2020_bin_lz_len, usb_2020_bin_len);
 		break;
 		default:
 			std::cout << "undefined FPGA device" << std::endl;
-
+			return false;
 	}
-}
 
-void UsbFpgaDevice::reverseFpgaBits(unsigned char* fpgaImage, unsigned long size) const
-{
-	for(unsigned int index = 0; index < size; index++)
-	{
-		if(fpgaImage[index] != 0)
-		{
-			fpgaImage[index] = (fpgaImage[index] & 0x0f) <<  4  |  (fpgaImage[index] & 0xf0) >>  4;
-			fpgaImage[index] = (fpgaImage[index] & 0x33) <<  2  |  (fpgaImage[index] & 0xcc) >>  2;
-			fpgaImage[index] = (fpgaImage[index] & 0x55) <<  1  |  (fpgaImage[index] & 0xaa) >>  1;
-		}
-	}
+	return true;
 }
 
 bool UsbFpgaDevice::isSpartanFpga() const
@@ -12,6 +12,8 @@
 namespace ul
 {
 
+class FpgaImage;
+
 class UL_LOCAL UsbFpgaDevice: public UsbDaqDevice
 {
 public:
@@ -21,21 +23,49 @@ public:
 	virtual int sendCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char *buff, uint16_t buffLen, unsigned int timeout = 1000) const;
 	virtual int queryCmd(uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char *buff, uint16_t buffLen, unsigned int timeout = 1000, bool checkReplySize = true) const;
 
+	static void setFpgaFileOverride(bool enabled) { mFpgaFileOverride = enabled; }
+	static bool getFpgaFileOverride() { return mFpgaFileOverride; }
+
 private:
 	virtual void initilizeHardware() const;
 	bool isFpgaLoaded() const;
 	void loadFpga() const;
+	UlError sendFpgaImage(FpgaImage& fpgaImage) const;
+	static void LIBUSB_CALL fpgaXferCallback(libusb_transfer* transfer);
 	bool isSpartanFpga() const;
-	void reverseFpgaBits(unsigned char* fpgaImage, unsigned long size) const;
-	void getFpgaImage(const unsigned char** fpgaImage, unsigned int* size, unsigned char** bitReverseBuffer) const;
+	bool openFpgaImage(FpgaImage& fpgaImage) const;
 
 	unsigned short getRawFpgaVersion();
 
 public:
 	enum { CMD_FPGA_CFG = 0x50, CMD_FPGA_DATA = 0x51,CMD_FPGA_VER = 0x52};
 
+private:
+	// the image is sent in FPGA_XFER_SIZE byte control transfers, FPGA_XFER_COUNT of them are in flight at a time.
+	// Transfers to the control endpoint complete in the order they were submitted
+	enum { FPGA_XFER_SIZE = 64, FPGA_XFER_COUNT = 32 };
+
+	// the load fails if no transfer completes within FPGA_XFER_WAIT_MS, longer than the timeout of a transfer so a
+	// transfer normally reports its own failure first
+	enum { FPGA_XFER_TIMEOUT_MS = 1000, FPGA_XFER_WAIT_MS = 5000 };
+
+	// allocated on the heap, it is not released if the transfers in flight cannot be reclaimed
+	typedef struct
+	{
+		pthread_mutex_t mutex;
+		pthread_cond_t cond;
+		int pendingCount;
+		UlError err;
+		libusb_transfer* xfers[FPGA_XFER_COUNT];
+		unsigned char buffers[FPGA_XFER_COUNT][LIBUSB_CONTROL_SETUP_SIZE + FPGA_XFER_SIZE];
+	} FpgaXferState;
+
+	static void getFpgaXferDeadline(struct timespec* deadline);
+
 private:
 	std::string mFpgaFileName;
+
+	static bool mFpgaFileOverride;
 };
 
 } /* namespace ul */
@@ -0,0 +1,222 @@
+/*
+ * UsbScanGroup.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include "UsbScanGroup.h"
+#include "UsbDaqDevice.h"
+#include "../AiDevice.h"
+#include "../CtrDevice.h"
+#include "../DaqIDevice.h"
+#include "../DioDevice.h"
+#include "../UlException.h"
+
+namespace ul
+{
+
+void UsbScanGroup::begin(const std::vector<DaqDevice*>& daqDevices)
+{
+	FnLog log("UsbScanGroup::begin");
+
+	std::vector<UsbDaqDevice*> usbDevices;
+
+	for(unsigned int i = 0; i < daqDevices.size(); i++)
+	{
+		UsbDaqDevice* usbDevice = getUsbDevice(daqDevices[i]);
+
+		usbDevice->checkConnection();
+
+		if(usbDevice->isScanRunning())
+			throw UlException(ERR_ALREADY_ACTIVE);
+
+		usbDevices.push_back(usbDevice);
+	}
+
+	for(unsigned int i = 0; i < usbDevices.size(); i++)
+		usbDevices[i]->holdScanStart(true);
+}
+
+double UsbScanGroup::start(const std::vector<DaqDevice*>& daqDevices)
+{
+	FnLog log("UsbScanGroup::start");
+
+	std::vector<const UsbDaqDevice*> slaves;
+	std::vector<const UsbDaqDevice*> masters;
+
+	for(unsigned int i = 0; i < daqDevices.size(); i++)
+	{
+		UsbDaqDevice* usbDevice = getUsbDevice(daqDevices[i]);
+		ScanStatus status = SS_IDLE;
+		TransferStatus xferStatus;
+
+		// no scan was started on the device since begin(), the scans of the device can not be held, or the held scan
+		// was stopped. A held scan reports SS_RUNNING while it waits, as a scan that waits for an external trigger does
+		if(!usbDevice->scanStartHeld())
+			throw UlException(ERR_BAD_ARG);
+
+		if(getScanStatus(usbDevice, &status, &xferStatus) != ERR_NO_ERROR || status != SS_RUNNING)
+		{
+			usbDevice->clearHeldScanStart();
+			throw UlException(ERR_BAD_ARG);
+		}
+
+		if(waitsForExternalStart(usbDevice))
+			slaves.push_back(usbDevice);
+		else
+			masters.push_back(usbDevice);
+	}
+
+	// the skew is measured between the devices that start on their own, the others start on the signal of a master
+	bool timeSlaves = masters.empty();
+	unsigned long long firstStart = 0;
+	unsigned long long lastStart = 0;
+
+	try
+	{
+		for(unsigned int i = 0; i < slaves.size(); i++)
+		{
+			slaves[i]->startHeldScan();
+
+			if(timeSlaves)
+			{
+				lastStart = ul_clock_monotonic_ns();
+
+				if(i == 0)
+					firstStart = lastStart;
+			}
+		}
+
+		for(unsigned int i = 0; i < masters.size(); i++)
+		{
+			masters[i]->startHeldScan();
+
+			lastStart = ul_clock_monotonic_ns();
+
+			if(i == 0)
+				firstStart = lastStart;
+		}
+	}
+	catch(UlException& e)
+	{
+		stop(daqDevices);
+		throw e;
+	}
+
+	return (lastStart - firstStart) / 1000000000.0;
+}
+
+UlError UsbScanGroup::getStatus(const std::vector<DaqDevice*>& daqDevices, ScanStatus* status, TransferStatus xferStatus[])
+{
+	UlError err = ERR_NO_ERROR;
+
+	*status = SS_IDLE;
+
+	for(unsigned int i = 0; i < daqDevices.size(); i++)
+	{
+		ScanStatus devStatus = SS_IDLE;
+		TransferStatus devXferStatus;
+
+		UlError devErr = getScanStatus(getUsbDevice(daqDevices[i]), &devStatus, &devXferStatus);
+
+		if(devStatus == SS_RUNNING)
+			*status = SS_RUNNING;
+
+		if(xferStatus)
+			xferStatus[i] = devXferStatus;
+
+		if(err == ERR_NO_ERROR)
+			err = devErr;
+	}
+
+	return err;
+}
+
+UlError UsbScanGroup::stop(const std::vector<DaqDevice*>& daqDevices)
+{
+	FnLog log("UsbScanGroup::stop");
+
+	UlError err = ERR_NO_ERROR;
+
+	// every device is stopped even if stopping one of them fails
+	for(unsigned int i = 0; i < daqDevices.size(); i++)
+	{
+		try
+		{
+			UsbDaqDevice* usbDevice = getUsbDevice(daqDevices[i]);
+			bool started = usbDevice->scanStartHeld() || usbDevice->isScanRunning();
+
+			usbDevice->holdScanStart(false);
+
+			if(started)
+			{
+				switch(usbDevice->groupScanFunctionType())
+				{
+				case FT_DI:
+					usbDevice->dioDevice()->stopBackground(SD_INPUT);
+					break;
+				case FT_AI:
+				case FT_CTR:
+				case FT_DAQI:
+					usbDevice->stopBackground(usbDevice->groupScanFunctionType());
+					break;
+				default:
+					break;
+				}
+			}
+		}
+		catch(UlException& e)
+		{
+			if(err == ERR_NO_ERROR)
+				err = e.getError();
+		}
+	}
+
+	return err;
+}
+
+UsbDaqDevice* UsbScanGroup::getUsbDevice(DaqDevice* daqDevice)
+{
+	UsbDaqDevice* usbDevice = dynamic_cast<UsbDaqDevice*>(daqDevice);
+
+	if(usbDevice == NULL)
+		throw UlException(ERR_BAD_DEV_TYPE);
+
+	return usbDevice;
+}
+
+bool UsbScanGroup::waitsForExternalStart(const UsbDaqDevice* usbDevice)
+{
+	return (usbDevice->groupScanOptions() & (SO_EXTTRIGGER | SO_EXTCLOCK | SO_RETRIGGER)) != 0;
+}
+
+UlError UsbScanGroup::getScanStatus(const UsbDaqDevice* usbDevice, ScanStatus* status, TransferStatus* xferStatus)
+{
+	UlError err = ERR_BAD_ARG;
+
+	switch(usbDevice->groupScanFunctionType())
+	{
+	case FT_AI:
+		if(usbDevice->aiDevice())
+			err = usbDevice->aiDevice()->getStatus(status, xferStatus);
+		break;
+	case FT_DI:
+		if(usbDevice->dioDevice())
+			err = usbDevice->dioDevice()->getStatus(SD_INPUT, status, xferStatus);
+		break;
+	case FT_CTR:
+		if(usbDevice->ctrDevice())
+			err = usbDevice->ctrDevice()->getStatus(status, xferStatus);
+		break;
+	case FT_DAQI:
+		if(usbDevice->daqIDevice())
+			err = usbDevice->daqIDevice()->getStatus(status, xferStatus);
+		break;
+	default:
+		break;
+	}
+
+	return err;
+}
+
+} /* namespace ul */
@@ -0,0 +1,42 @@
+/*
+ * UsbScanGroup.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef USB_USBSCANGROUP_H_
+#define USB_USBSCANGROUP_H_
+
+#include <vector>
+
+#include "../ul_internal.h"
+#include "../uldaq.h"
+
+namespace ul
+{
+
+class DaqDevice;
+class UsbDaqDevice;
+
+// input scans of several USB devices started together. After begin() the next input scan of each device is
+// configured and its transfers are submitted as usual, but its start command is held. start() then sends the held
+// commands back to back, the devices that wait for an external trigger or clock first so they are armed before
+// the devices that drive them start
+class UL_LOCAL UsbScanGroup
+{
+public:
+	static void begin(const std::vector<DaqDevice*>& daqDevices);
+	// returns the time in seconds between the first and the last start command of the devices that start on their own
+	static double start(const std::vector<DaqDevice*>& daqDevices);
+	static UlError getStatus(const std::vector<DaqDevice*>& daqDevices, ScanStatus* status, TransferStatus xferStatus[]);
+	static UlError stop(const std::vector<DaqDevice*>& daqDevices);
+
+private:
+	static UsbDaqDevice* getUsbDevice(DaqDevice* daqDevice);
+	static bool waitsForExternalStart(const UsbDaqDevice* usbDevice);
+	static UlError getScanStatus(const UsbDaqDevice* usbDevice, ScanStatus* status, TransferStatus* xferStatus);
+};
+
+} /* namespace ul */
+
+#endif /* USB_USBSCANGROUP_H_ */
@@ -4,6 +4,8 @@
  *      Author: Measurement Computing Corporation
  */
 #include <cstring>
+#include <cstdlib>
+#include <new>
 #include <unistd.h>
 #include <sys/resource.h>
 #include <sys/syscall.h>
@@ -13,6 +15,8 @@
 #include "../utility/UlLock.h"
 
 #define STAGE_RATE 		0.010
+#define MIN_STAGE_RATE 	0.0001
+#define MAX_STAGE_RATE 	1.0
 
 namespace ul
 {
@@ -23,6 +27,11 @@ UsbScanTransferIn::UsbScanTransferIn(const UsbDaqDevice& daqDevice) : mUsbDevice
 	mDaqEventHandler = daqDev().eventHandler();
 
 	mStageRate = STAGE_RATE;
+	mXferCount = DEFAULT_XFER_COUNT;
+	mMaxStageSize = DEFAULT_STAGE_SIZE;
+	mXferBuffers = NULL;
+	mXferBuffersSize = 0;
+	mXferBufferStride = 0;
 
 	mXferStateThreadHandle = 0;
 	mTerminateXferStateThread = false;
@@ -44,6 +53,17 @@ UsbScanTransferIn::UsbScanTransferIn(const UsbDaqDevice& daqDevice) : mUsbDevice
 	mAvailableCount = 0;
 	mCurrentEventCount = 0;
 	mNextEventCount = 0;
+
+	mZeroCopy = false;
+	mRingSegmentCount = 0;
+	mRingSegmentsSubmitted = 0;
+
+	mPipelined = false;
+	mPipelineActive = false;
+	mConversionThreadHandle = 0;
+	mTerminateConversionThread = false;
+	mConversionThreadWaiting = false;
+	mDroppedStageCount = 0;
 }
 
 UsbScanTransferIn::~UsbScanTransferIn()
@@ -51,6 +71,43 @@ UsbScanTransferIn::~UsbScanTransferIn()
 	//UlLock::destroyMutex(mXferMutex);
 	UlLock::destroyMutex(mXferStateThreadHandleMutex);
 	UlLock::destroyMutex(mStopXferMutex);
+
+	terminateConversionThread();
+	freeXferBuffers();
+}
+
+void UsbScanTransferIn::setStageRate(double stageRate)
+{
+	if(stageRate == 0)
+		stageRate = STAGE_RATE;
+
+	if(stageRate < MIN_STAGE_RATE || stageRate > MAX_STAGE_RATE)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mStageRate = stageRate;
+}
+
+void UsbScanTransferIn::setXferCount(unsigned int xferCount)
+{
+	if(xferCount == 0)
+		xferCount = DEFAULT_XFER_COUNT;
+
+	if(xferCount > MAX_XFER_COUNT)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mXferCount = xferCount;
+}
+
+void UsbScanTransferIn::setMaxStageSize(unsigned int maxStageSize)
+{
+	if(maxStageSize == 0)
+		maxStageSize = DEFAULT_STAGE_SIZE;
+
+	// the stage size must stay a multiple of the bulk endpoint packet size of all devices
+	if(maxStageSize < MIN_STAGE_SIZE || maxStageSize > MAX_STAGE_SIZE || maxStageSize % MIN_STAGE_SIZE != 0)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mMaxStageSize = maxStageSize;
 }
 
 void UsbScanTransferIn::initilizeTransfers(IoDevice* ioDevice, int endpointAddress, int stageSize)
@@ -66,19 +123,66 @@ void UsbScanTransferIn::initilizeTransfers(IoDevice* ioDevice, int endpointAddre
 	mNewSamplesReceived = false;
 	memset(&mXfer, 0, sizeof(mXfer));
 
-	if(mStageSize > MAX_STAGE_SIZE)
-		mStageSize = MAX_STAGE_SIZE;
+	if(mStageSize > mMaxStageSize)
+		mStageSize = mMaxStageSize;
 
 	// Just in case thread is not terminated
 	terminateXferStateThread();
 
 	int numOfXfers;
-	numOfXfers = MAX_XFER_COUNT;
+	numOfXfers = mXferCount;
+
+	mXferTiming.reset();
+	mConversionTiming.reset();
+	__atomic_store_n(&mDroppedStageCount, 0, __ATOMIC_RELAXED);
+
+	mZeroCopy = mIoDevice->rawScanData() && initZeroCopyRing(endpointAddress);
+
+	// raw scans transferred into the user buffer need no conversion, so there is nothing to pipeline
+	mPipelineActive = mPipelined && !mZeroCopy;
+
+	if(mZeroCopy)
+	{
+		// a continuous scan keeps at least half of the user buffer out of the transfers so a reader has data to copy
+		unsigned long long maxXfers = mIoDevice->recycleMode() ? mRingSegmentCount / 2 : mRingSegmentCount;
+
+		if(maxXfers < (unsigned long long) numOfXfers)
+			numOfXfers = maxXfers;
+
+		// every queued transfer owns a segment of the user buffer past the published samples and the device may
+		// be filling any of them, a reader must stay that far ahead of the transfers
+		mIoDevice->setScanWriteAhead((unsigned long long) numOfXfers * mStageSize / mIoDevice->scanDataBufferSampleSize());
+	}
+	else if(mPipelineActive)
+	{
+		// one spare buffer per transfer lets the conversion fall a full transfer depth behind before stages are dropped
+		allocXferBuffers(2 * numOfXfers, mStageSize);
+
+		unsigned char* buffer;
+		PipelineStage stage;
+
+		while(mFreeBuffers.pop(buffer)) {}
+		while(mFilledStages.pop(stage)) {}
+
+		for(int i = numOfXfers; i < 2 * numOfXfers; i++)
+			mFreeBuffers.push(mXferBuffers + (unsigned long long) i * mXferBufferStride);
+
+		startConversionThread();
+	}
+	else
+		allocXferBuffers(numOfXfers, mStageSize);
+
+	mXferTiming.setXferCount(numOfXfers);
+
+	// the callback drops the stages once the conversion falls a full transfer depth behind
+	if(mPipelineActive)
+		mXferTiming.setBacklogCapacity(numOfXfers);
 
 	mXferEvent.reset();
 	mXferDoneEvent.reset();
 
-	mEnabledDaqEvents = mDaqEventHandler->getEnabledEventTypes();
+	// the events of the user's scans are left alone by an internal scan, such as the scan of ulAInSnapshot()
+	mEnabledDaqEvents = mIoDevice->internalScan() ? (DaqEventType) 0 : mDaqEventHandler->getEnabledEventTypes();
 	mDaqEventHandler->resetInputEvents(mEnabledDaqEvents);
 
 	if(mEnabledDaqEvents & DE_ON_DATA_AVAILABLE)
@@ -90,13 +194,20 @@ void UsbScanTransferIn::initilizeTransfers(IoDevice* ioDevice, int endpointAddre
 
 	for(int i = 0; i < numOfXfers; i++)
 	{
+		unsigned char* buffer = mXfer[i].buffer;
+
+		if(mZeroCopy)
+			buffer = mIoDevice->scanDataBuffer() + (mRingSegmentsSubmitted++) * mStageSize;
+
 		mXfer[i].transfer = mUsbDevice.allocTransfer();
-		err = mUsbDevice.asyncBulkTransfer(mXfer[i].transfer, endpointAddress, mXfer[i].buffer, mStageSize, tarnsferCallback, this,  0);
+		err = mUsbDevice.asyncBulkTransfer(mXfer[i].transfer, endpointAddress, buffer, mStageSize, tarnsferCallback, this,  0);
 
 		if(err)
 		{
 			if(mNumXferPending)
 				stopTransfers();
+			else
+				terminateConversionThread();
 
 			throw(UlException(err));
 		}
@@ -119,10 +230,17 @@ void UsbScanTransferIn::initilizeOnDemandTransfer(IoDevice* ioDevice, int endpoi
 	mXferState = TS_RUNNING;
 	mResubmit = true;
 	mNewSamplesReceived = false;
+	mZeroCopy = false;
+	mPipelineActive = false;
 	memset(&mXfer, 0, sizeof(mXfer));
 
-	if(mStageSize > MAX_STAGE_SIZE)
-		mStageSize = MAX_STAGE_SIZE;
+	mXferTiming.reset();
+	mXferTiming.setXferCount(1);
+	mConversionTiming.reset();
+	__atomic_store_n(&mDroppedStageCount, 0, __ATOMIC_RELAXED);
+
+	if(mStageSize > mMaxStageSize)
+		mStageSize = mMaxStageSize;
 
 	// Just in case thread is not terminated
 	terminateXferStateThread();
@@ -130,6 +248,8 @@ void UsbScanTransferIn::initilizeOnDemandTransfer(IoDevice* ioDevice, int endpoi
 	mXferEvent.reset();
 	mXferDoneEvent.reset();
 
+	allocXferBuffers(1, mStageSize);
+
 	mXfer[0].transfer = mUsbDevice.allocTransfer();
 	err =  mUsbDevice.asyncBulkTransfer(mXfer[0].transfer, endpointAddress, mXfer[0].buffer, mStageSize, tarnsferCallback, this,  0);
 
@@ -153,27 +273,33 @@ void LIBUSB_CALL UsbScanTransferIn::tarnsferCallback(libusb_transfer* transfer)
 		{
 			if(!This->mIoDevice->allScanSamplesTransferred() && This->mResubmit)
 			{
-				This->mIoDevice->processScanData(transfer);
+				unsigned long long startNs = This->mXferTiming.begin();
 
-				unsigned long long samplesTransfered = This->mIoDevice->totalScanSamplesTransferred();
+				if(This->mPipelineActive)
+					This->queueStageData(transfer);
+				else
+					This->processStageData(transfer);
 
-				if(This->mEnabledDaqEvents & DE_ON_DATA_AVAILABLE)
-				{
-					if(isDataAvailable(samplesTransfered, This->mCurrentEventCount, This->mNextEventCount))
-					{
-						This->mCurrentEventCount = samplesTransfered;
-						This->mNextEventCount = This->mCurrentEventCount + This->mAvailableCount;
-						This->mDaqEventHandler->setCurrentEventAndData(DE_ON_DATA_AVAILABLE, This->mCurrentEventCount / This->mIoDevice->scanChanCount());
-					}
-				}
+				This->mXferTiming.record(startNs, transfer->actual_length, This->mIoDevice->scanByteRate());
+
+				// the completed transfer is still counted in mNumXferPending
+				This->mXferTiming.recordPending(This->mNumXferPending - 1);
+
+				// dropped stages are never queued for conversion
+				if(This->mPipelineActive)
+					This->mXferTiming.recordBacklog(This->mXferTiming.stageCount() - This->mConversionTiming.stageCount() - This->mDroppedStageCount);
 			}
 		}
 
 		//check if processScanData() has set allScanSamplesTransferred to true, if that's the case then no need to resubmit
 		//the request. Also we should not set mNewSamplesReceived to true to prevent sending the tmr command
-		if(!This->mIoDevice->allScanSamplesTransferred() && This->mResubmit)
+		if(!This->mIoDevice->allScanSamplesTransferred() && This->mResubmit && (!This->mZeroCopy || This->setNextRingSegment(transfer)))
 		{
-			libusb_submit_transfer(transfer);
+			unsigned long long resubmitNs = This->mXferTiming.begin();
+
+			This->mUsbDevice.submitTransfer(transfer);
+
+			This->mXferTiming.recordResubmit(resubmitNs);
 
 			This->mNewSamplesReceived = true;
 		}
@@ -216,6 +342,168 @@ void LIBUSB_CALL UsbScanTransferIn::tarnsferCallback(libusb_transfer* transfer)
 		This->mXferEvent.signal();
 }
 
+void UsbScanTransferIn::getScanStats(ScanStats* stats) const
+{
+	mXferTiming.getStats(stats);
+
+	// the callback only queues the stages of a pipelined scan, they are processed by the conversion thread
+	if(mPipelineActive)
+		mConversionTiming.getProcessStats(stats);
+
+	stats->droppedStageCount = __atomic_load_n(&mDroppedStageCount, __ATOMIC_RELAXED);
+}
+
+void UsbScanTransferIn::processStageData(libusb_transfer* transfer)
+{
+	mIoDevice->processScanData(transfer);
+	mIoDevice->publishScanProgress();
+
+	unsigned long long samplesTransfered = mIoDevice->totalScanSamplesTransferred();
+
+	if(mEnabledDaqEvents & DE_ON_DATA_AVAILABLE)
+	{
+		if(isDataAvailable(samplesTransfered, mCurrentEventCount, mNextEventCount))
+		{
+			mCurrentEventCount = samplesTransfered;
+			mNextEventCount = mCurrentEventCount + mAvailableCount;
+			mDaqEventHandler->setCurrentEventAndData(DE_ON_DATA_AVAILABLE, mCurrentEventCount / mIoDevice->scanChanCount());
+		}
+	}
+}
+
+void UsbScanTransferIn::queueStageData(libusb_transfer* transfer)
+{
+	unsigned char* buffer;
+
+	// all spare buffers are waiting for conversion. The callback runs on the event thread shared by other devices so
+	// it can not wait for the conversion thread, and converting here would deliver this stage ahead of the queued ones.
+	// The stage is dropped, the transfer is resubmitted with its own buffer and the state thread fails the scan.
+	// Once a stage is dropped the following ones are dropped too so the user never gets data with a gap in it
+	if(__atomic_load_n(&mDroppedStageCount, __ATOMIC_RELAXED) || !mFreeBuffers.pop(buffer))
+	{
+		__atomic_store_n(&mDroppedStageCount, mDroppedStageCount + 1, __ATOMIC_RELAXED);
+		mXferEvent.signal();
+		return;
+	}
+
+	PipelineStage stage;
+	stage.buffer = transfer->buffer;
+	stage.length = transfer->actual_length;
+
+	// can not fail, the queue holds more entries than there are spare buffers
+	mFilledStages.push(stage);
+
+	transfer->buffer = buffer;
+
+	// pairs with the fence in conversionThread(), only wake the thread if it is about to sleep
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	if(__atomic_load_n(&mConversionThreadWaiting, __ATOMIC_RELAXED))
+		mConversionEvent.signal();
+}
+
+void UsbScanTransferIn::startConversionThread()
+{
+	FnLog log("UsbScanTransferIn::startConversionThread");
+
+	pthread_attr_t attr;
+	int status = pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+	if(!status)
+	{
+		mTerminateConversionThread = false;
+		mConversionThreadWaiting = false;
+		mConversionEvent.reset();
+
+		status = pthread_create(&mConversionThreadHandle, &attr, &conversionThread, this);
+
+		if(status)
+		{
+			mConversionThreadHandle = 0;
+			mPipelineActive = false;
+			UL_LOG("#### Unable to start the conversion thread");
+		}
+#ifndef __APPLE__
+		else
+			pthread_setname_np(mConversionThreadHandle, "xfer_in_conv_td");
+#endif
+
+		status = pthread_attr_destroy(&attr);
+	}
+	else
+	{
+		mPipelineActive = false;
+		UL_LOG("#### Unable to initialize attributes for the conversion thread");
+	}
+}
+
+void* UsbScanTransferIn::conversionThread(void *arg)
+{
+	UsbScanTransferIn* This = (UsbScanTransferIn*) arg;
+
+	PipelineStage stage;
+	libusb_transfer transfer;
+	bool terminate = false;
+
+	memset(&transfer, 0, sizeof(transfer));
+
+	while(!terminate)
+	{
+		// stages queued before the terminate request are still converted so no completed transfer is lost
+		terminate = __atomic_load_n(&This->mTerminateConversionThread, __ATOMIC_ACQUIRE);
+
+		while(This->mFilledStages.pop(stage))
+		{
+			if(!This->mIoDevice->allScanSamplesTransferred())
+			{
+				transfer.buffer = stage.buffer;
+				transfer.actual_length = stage.length;
+
+				unsigned long long startNs = This->mConversionTiming.begin();
+
+				This->processStageData(&transfer);
+
+				This->mConversionTiming.record(startNs, stage.length, This->mIoDevice->scanByteRate());
+
+				// let the state thread finish a finite scan without waiting for its timeout
+				if(This->mIoDevice->allScanSamplesTransferred())
+					This->mXferEvent.signal();
+			}
+
+			This->mFreeBuffers.push(stage.buffer);
+		}
+
+		if(!terminate)
+		{
+			__atomic_store_n(&This->mConversionThreadWaiting, true, __ATOMIC_RELAXED);
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+			if(This->mFilledStages.empty() && !__atomic_load_n(&This->mTerminateConversionThread, __ATOMIC_ACQUIRE))
+				This->mConversionEvent.wait_for_signal();
+
+			__atomic_store_n(&This->mConversionThreadWaiting, false, __ATOMIC_RELAXED);
+		}
+	}
+
+	return NULL;
+}
+
+void UsbScanTransferIn::terminateConversionThread()
+{
+	FnLog log("UsbScanTransferIn::terminateConversionThread");
+
+	if(mConversionThreadHandle)
+	{
+		__atomic_store_n(&mTerminateConversionThread, true, __ATOMIC_RELEASE);
+		mConversionEvent.signal();
+
+		pthread_join(mConversionThreadHandle, NULL);
+
+		mConversionThreadHandle = 0;
+	}
+}
+
 void UsbScanTransferIn::stopTransfers()
 {
 	FnLog log("UsbScanTransferIn::stopTransfers");
@@ -223,12 +511,16 @@ void UsbScanTransferIn::stopTransfers()
 	mResubmit = false;
 	usleep(1000);
 
+	// a held scan that is stopped must not be started by the scan group. The device stays armed for the next scan
+	// if the stopped scan did not get as far as its start command
+	mUsbDevice.clearHeldScanStart();
+
 	UlLock lock(mStopXferMutex);
 
 	for(int i = 0; i < MAX_XFER_COUNT; i++)
 	{
 		if(mXfer[i].transfer)
-			libusb_cancel_transfer(mXfer[i].transfer);
+			mUsbDevice.cancelTransfer(mXfer[i].transfer);
 	}
 
 	if(mXferState == TS_RUNNING)
@@ -249,6 +541,12 @@ void UsbScanTransferIn::stopTransfers()
 			mXfer[i].transfer = NULL;
 		}
 	}
+
+	// converts the stages still queued, the user buffer must not be written after the scan is stopped
+	terminateConversionThread();
+
+	mXferTiming.log("UsbScanTransferIn", mIoDevice ? mIoDevice->totalScanSamplesTransferred() : 0);
+	mConversionTiming.log("UsbScanTransferIn conversion", mIoDevice ? mIoDevice->totalScanSamplesTransferred() : 0);
 }
 
 void UsbScanTransferIn::startXferStateThread()
@@ -300,6 +598,10 @@ void* UsbScanTransferIn::xferStateThread(void *arg)
 		{
 			timeout = 100000;
 
+			// handled below like an error reported by the device
+			if(This->stagesDropped())
+				break;
+
 			if(!This->mTerminateXferStateThread)
 			{
 				if(!This->mIoDevice->recycleMode() && This->mIoDevice->allScanSamplesTransferred())
@@ -333,7 +635,7 @@ void* UsbScanTransferIn::xferStateThread(void *arg)
 		{
 			UL_LOG("#### retrieving status");
 
-			This->mXferError = This->mIoDevice->checkScanState();
+			This->mXferError = This->stagesDropped() ? ERR_SCAN_BUFFER_OVERRUN : This->mIoDevice->checkScanState();
 
 			if(This->mXferError)
 			{
@@ -422,6 +724,51 @@ void UsbScanTransferIn::waitForXferStateThread()
 	}
 }
 
+bool UsbScanTransferIn::initZeroCopyRing(int endpointAddress)
+{
+	unsigned long long bufferBytes = mIoDevice->scanDataBufferBytes();
+	unsigned int packetSize = mUsbDevice.getBulkEndpointMaxPacketSize(endpointAddress);
+
+	// every transfer must be a whole number of packets, otherwise the device would overflow the last segment
+	if(packetSize == 0 || bufferBytes % packetSize != 0)
+		return false;
+
+	unsigned long long packetCount = bufferBytes / packetSize;
+	unsigned int stagePackets = mStageSize / packetSize;
+
+	// use the largest stage, not exceeding the calculated one, that divides the user buffer evenly
+	while(stagePackets > 1 && packetCount % stagePackets != 0)
+		stagePackets--;
+
+	// fall back to the stage buffers if the stage would become too small to keep up with the device
+	if(stagePackets == 0 || stagePackets * packetSize * 4 < mStageSize)
+		return false;
+
+	// a continuous scan needs a segment the device is not writing to, see initilizeTransfers()
+	if(mIoDevice->recycleMode() && packetCount / stagePackets < 2)
+		return false;
+
+	mStageSize = stagePackets * packetSize;
+	mRingSegmentCount = packetCount / stagePackets;
+	mRingSegmentsSubmitted = 0;
+
+	return true;
+}
+
+bool UsbScanTransferIn::setNextRingSegment(libusb_transfer* transfer)
+{
+	// in finite mode each segment of the user buffer is transferred once
+	if(!mIoDevice->recycleMode() && mRingSegmentsSubmitted == mRingSegmentCount)
+		return false;
+
+	transfer->buffer = mIoDevice->scanDataBuffer() + (mRingSegmentsSubmitted % mRingSegmentCount) * mStageSize;
+	transfer->length = mStageSize;
+
+	mRingSegmentsSubmitted++;
+
+	return true;
+}
+
 bool UsbScanTransferIn::isDataAvailable(unsigned long long count, unsigned long long current, unsigned long long next)
 {
 	bool available = false;
@@ -443,6 +790,45 @@ bool UsbScanTransferIn::isDataAvailable(unsigned long long count, unsigned long
 }
 
 
+void UsbScanTransferIn::allocXferBuffers(int xferCount, unsigned int stageSize)
+{
+	long pageSize = sysconf(_SC_PAGESIZE);
+
+	if(pageSize <= 0)
+		pageSize = 4096;
+
+	unsigned int bufferStride = ((stageSize + pageSize - 1) / pageSize) * pageSize;
+	mXferBufferStride = bufferStride;
+	unsigned long long size = (unsigned long long) xferCount * bufferStride;
+
+	// the buffers are kept between scans and only reallocated when the transfer layout changes
+	if(mXferBuffers == NULL || size != mXferBuffersSize)
+	{
+		freeXferBuffers();
+
+		void* buffers = NULL;
+
+		if(posix_memalign(&buffers, pageSize, size) != 0)
+			throw std::bad_alloc();
+
+		mXferBuffers = (unsigned char*) buffers;
+		mXferBuffersSize = size;
+	}
+
+	for(int i = 0; i < xferCount && i < MAX_XFER_COUNT; i++)
+		mXfer[i].buffer = mXferBuffers + (unsigned long long) i * bufferStride;
+}
+
+void UsbScanTransferIn::freeXferBuffers()
+{
+	if(mXferBuffers)
+	{
+		free(mXferBuffers);
+		mXferBuffers = NULL;
+		mXferBuffersSize = 0;
+	}
+}
+
 void UsbScanTransferIn::printTransferIndex(libusb_transfer* transfer)
 {
 	for(int i = 0; i < MAX_XFER_COUNT; i++)
@@ -11,6 +11,8 @@
 #include "../IoDevice.h"
 #include "../DaqEventHandler.h"
 #include "../utility/ThreadEvent.h"
+#include "../utility/EventQueue.h"
+#include "../utility/XferTiming.h"
 
 namespace ul
 {
@@ -33,6 +35,21 @@ public:
 	void waitForXferStateThread();
 
 	double getStageRate() const { return mStageRate;}
+	void setStageRate(double stageRate);
+
+	unsigned int getXferCount() const { return mXferCount;}
+	void setXferCount(unsigned int xferCount);
+
+	unsigned int getMaxStageSize() const { return mMaxStageSize;}
+	void setMaxStageSize(unsigned int maxStageSize);
+
+	bool getPipelined() const { return mPipelined;}
+	void setPipelined(bool pipelined) { mPipelined = pipelined;}
+
+	// stage timing of the last scan, conversion timing is only collected in pipelined mode
+	const XferTiming& xferTiming() const { return mXferTiming;}
+	const XferTiming& conversionTiming() const { return mConversionTiming;}
+	void getScanStats(ScanStats* stats) const;
 
 private:
 	static void LIBUSB_CALL tarnsferCallback(libusb_transfer* transfer);
@@ -43,12 +60,32 @@ private:
 
 	static bool isDataAvailable(unsigned long long count, unsigned long long current, unsigned long long next);
 
+	bool initZeroCopyRing(int endpointAddress);
+	bool setNextRingSegment(libusb_transfer* transfer);
+
+	void processStageData(libusb_transfer* transfer);
+	void queueStageData(libusb_transfer* transfer);
+
+	void startConversionThread();
+	static void* conversionThread(void* arg);
+	void terminateConversionThread();
+
+	void allocXferBuffers(int xferCount, unsigned int stageSize);
+	void freeXferBuffers();
+
 	void printTransferIndex(libusb_transfer* transfer);
 
 private:
 	const UsbDaqDevice&  mUsbDevice;
 	IoDevice* mIoDevice;
 	double mStageRate;
+	unsigned int mXferCount;
+	unsigned int mMaxStageSize;
+
+	// page-aligned stage buffers, sized for the transfer count and stage size of the current scan
+	unsigned char* mXferBuffers;
+	unsigned long long mXferBuffersSize;
+	unsigned int mXferBufferStride;
 
 	pthread_t mXferStateThreadHandle;
 	bool mTerminateXferStateThread;
@@ -75,18 +112,50 @@ private:
 	unsigned long long mCurrentEventCount;
 	unsigned long long mNextEventCount;
 
+	// raw scans transfer directly into the user buffer, which is split into mRingSegmentCount stage-sized segments
+	bool mZeroCopy;
+	unsigned long long mRingSegmentCount;
+	unsigned long long mRingSegmentsSubmitted;
+
+	XferTiming mXferTiming;
+	XferTiming mConversionTiming;
+
 public:
 	//static const float STAGE_RATE = 0.010;
 
 	enum {SCAN_PARAM_TCR = 1, SCAN_PARAM_TMR = 2};
-	enum {MAX_XFER_COUNT = 32, MAX_STAGE_SIZE = 16384};
+	enum {DEFAULT_XFER_COUNT = 32, MAX_XFER_COUNT = 256};
+	enum {DEFAULT_STAGE_SIZE = 16384, MIN_STAGE_SIZE = 1024, MAX_STAGE_SIZE = 4194304};
 
 	struct
 	{
 		libusb_transfer* transfer;
-		unsigned char buffer[MAX_STAGE_SIZE];
+		unsigned char* buffer;
 	} mXfer[MAX_XFER_COUNT];
 
+private:
+	// in pipelined mode the callback swaps a free buffer into each completed transfer and resubmits it
+	// right away, the filled buffer is converted in order by the conversion thread and then returned
+	struct PipelineStage
+	{
+		unsigned char* buffer;
+		int length;
+	};
+
+	bool mPipelined;
+	bool mPipelineActive;
+	EventQueue<PipelineStage, MAX_XFER_COUNT> mFilledStages;
+	EventQueue<unsigned char*, MAX_XFER_COUNT> mFreeBuffers;
+
+	pthread_t mConversionThreadHandle;
+	bool mTerminateConversionThread;
+	bool mConversionThreadWaiting;
+	ThreadEvent mConversionEvent;
+
+	// stages of a pipelined scan dropped because no spare buffer was free, written by the transfer callback only
+	unsigned long long mDroppedStageCount;
+	bool stagesDropped() const { return __atomic_load_n(&mDroppedStageCount, __ATOMIC_RELAXED) != 0;}
+
 };
 
 } /* namespace ul */
@@ -4,6 +4,8 @@
  *     Author: Measurement Computing Corporation
  */
 
+#include <cstdlib>
+#include <new>
 #include <unistd.h>
 #include <sys/resource.h>
 #include <sys/syscall.h>
@@ -11,6 +13,8 @@
 #include "UsbScanTransferOut.h"
 
 #define STAGE_RATE 		0.010
+#define MIN_STAGE_RATE 	0.0001
+#define MAX_STAGE_RATE 	1.0
 
 namespace ul
 {
@@ -21,6 +25,10 @@ UsbScanTransferOut::UsbScanTransferOut(const UsbDaqDevice& daqDevice) : mUsbDevi
 	mDaqEventHandler = daqDev().eventHandler();
 
 	mStageRate = STAGE_RATE;
+	mXferCount = DEFAULT_XFER_COUNT;
+	mMaxStageSize = DEFAULT_STAGE_SIZE;
+	mXferBuffers = NULL;
+	mXferBuffersSize = 0;
 
 	mXferStateThreadHandle = 0;
 	mTerminateXferStateThread = false;
@@ -46,6 +54,42 @@ UsbScanTransferOut::~UsbScanTransferOut()
 	UlLock::destroyMutex(mXferMutex);
 	UlLock::destroyMutex(mXferStateThreadHandleMutex);
 	UlLock::destroyMutex(mStopXferMutex);
+
+	freeXferBuffers();
+}
+
+void UsbScanTransferOut::setStageRate(double stageRate)
+{
+	if(stageRate == 0)
+		stageRate = STAGE_RATE;
+
+	if(stageRate < MIN_STAGE_RATE || stageRate > MAX_STAGE_RATE)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mStageRate = stageRate;
+}
+
+void UsbScanTransferOut::setXferCount(unsigned int xferCount)
+{
+	if(xferCount == 0)
+		xferCount = DEFAULT_XFER_COUNT;
+
+	if(xferCount > MAX_XFER_COUNT)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mXferCount = xferCount;
+}
+
+void UsbScanTransferOut::setMaxStageSize(unsigned int maxStageSize)
+{
+	if(maxStageSize == 0)
+		maxStageSize = DEFAULT_STAGE_SIZE;
+
+	// the stage size must stay a multiple of the bulk endpoint packet size of all devices
+	if(maxStageSize < MIN_STAGE_SIZE || maxStageSize > MAX_STAGE_SIZE || maxStageSize % MIN_STAGE_SIZE != 0)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	mMaxStageSize = maxStageSize;
 }
 
 void UsbScanTransferOut::initilizeTransfers(IoDevice* ioDevice, int endpointAddress, int stageSize)
@@ -61,8 +105,10 @@ void UsbScanTransferOut::initilizeTransfers(IoDevice* ioDevice, int endpointAddr
 	mNewSamplesSent = false;
 	memset(&mXfer, 0, sizeof(mXfer));
 
-	if(mStageSize > MAX_STAGE_SIZE)
-		mStageSize = MAX_STAGE_SIZE;
+	mXferTiming.reset();
+
+	if(mStageSize > mMaxStageSize)
+		mStageSize = mMaxStageSize;
 
 	unsigned int actualStageSize = 0;
 
@@ -70,7 +116,9 @@ void UsbScanTransferOut::initilizeTransfers(IoDevice* ioDevice, int endpointAddr
 	terminateXferStateThread();
 
 	int numOfXfers;
-	numOfXfers = MAX_XFER_COUNT;
+	numOfXfers = mXferCount;
+
+	allocXferBuffers(numOfXfers, mStageSize);
 
 	mXferEvent.reset();
 	mXferDoneEvent.reset();
@@ -86,6 +134,7 @@ void UsbScanTransferOut::initilizeTransfers(IoDevice* ioDevice, int endpointAddr
 		mXfer[i].transfer->buffer = mXfer[i].buffer;
 
 		actualStageSize = mIoDevice->processScanData(mXfer[i].transfer, mStageSize);
+		mIoDevice->publishScanProgress();
 
 		err = mUsbDevice.asyncBulkTransfer(mXfer[i].transfer, endpointAddress, mXfer[i].buffer, actualStageSize, tarnsferCallback, this,  0);
 
@@ -103,6 +152,9 @@ void UsbScanTransferOut::initilizeTransfers(IoDevice* ioDevice, int endpointAddr
 			break;
 	}
 
+	// finite scans shorter than the transfer depth submit fewer transfers, mXferMutex holds off the callbacks
+	mXferTiming.setXferCount(mNumXferPending);
+
 	startXferStateThread();
 }
 
@@ -124,11 +176,23 @@ void LIBUSB_CALL UsbScanTransferOut::tarnsferCallback(libusb_transfer* transfer)
 			//the request. Also we should not set mNewSamplesSent to true to prevent sending the tmr command
 			if(!This->mIoDevice->allScanSamplesTransferred() && This->mResubmit)
 			{
+				unsigned long long startNs = This->mXferTiming.begin();
+
 				actualStageSize = This->mIoDevice->processScanData(transfer, This->mStageSize);
+				This->mIoDevice->publishScanProgress();
+
+				This->mXferTiming.record(startNs, actualStageSize, This->mIoDevice->scanByteRate());
+
+				// the completed transfer is still counted in mNumXferPending
+				This->mXferTiming.recordPending(This->mNumXferPending - 1);
 
 				transfer->length = actualStageSize;
 
-				libusb_submit_transfer(transfer);
+				unsigned long long resubmitNs = This->mXferTiming.begin();
+
+				This->mUsbDevice.submitTransfer(transfer);
+
+				This->mXferTiming.recordResubmit(resubmitNs);
 
 				This->mNewSamplesSent = true;
 			}
@@ -183,7 +247,7 @@ void UsbScanTransferOut::stopTransfers(bool delay)
 	for(int i = 0; i < MAX_XFER_COUNT; i++)
 	{
 		if(mXfer[i].transfer)
-			libusb_cancel_transfer(mXfer[i].transfer);
+			mUsbDevice.cancelTransfer(mXfer[i].transfer);
 	}
 
 	if(mXferState == TS_RUNNING)
@@ -204,6 +268,8 @@ void UsbScanTransferOut::stopTransfers(bool delay)
 			mXfer[i].transfer = NULL;
 		}
 	}
+
+	mXferTiming.log("UsbScanTransferOut", mIoDevice ? mIoDevice->totalScanSamplesTransferred() : 0);
 }
 
 void UsbScanTransferOut::startXferStateThread()
@@ -338,6 +404,44 @@ void UsbScanTransferOut::waitForXferStateThread()
 }
 
 
+void UsbScanTransferOut::allocXferBuffers(int xferCount, unsigned int stageSize)
+{
+	long pageSize = sysconf(_SC_PAGESIZE);
+
+	if(pageSize <= 0)
+		pageSize = 4096;
+
+	unsigned int bufferStride = ((stageSize + pageSize - 1) / pageSize) * pageSize;
+	unsigned long long size = (unsigned long long) xferCount * bufferStride;
+
+	// the buffers are kept between scans and only reallocated when the transfer layout changes
+	if(mXferBuffers == NULL || size != mXferBuffersSize)
+	{
+		freeXferBuffers();
+
+		void* buffers = NULL;
+
+		if(posix_memalign(&buffers, pageSize, size) != 0)
+			throw std::bad_alloc();
+
+		mXferBuffers = (unsigned char*) buffers;
+		mXferBuffersSize = size;
+	}
+
+	for(int i = 0; i < xferCount; i++)
+		mXfer[i].buffer = mXferBuffers + (unsigned long long) i * bufferStride;
+}
+
+void UsbScanTransferOut::freeXferBuffers()
+{
+	if(mXferBuffers)
+	{
+		free(mXferBuffers);
+		mXferBuffers = NULL;
+		mXferBuffersSize = 0;
+	}
+}
+
 void UsbScanTransferOut::printTransferIndex(libusb_transfer* transfer)
 {
 	for(int i = 0; i < MAX_XFER_COUNT; i++)
@@ -11,6 +11,7 @@
 #include "../IoDevice.h"
 #include "../DaqEventHandler.h"
 #include "../utility/ThreadEvent.h"
+#include "../utility/XferTiming.h"
 
 namespace ul
 {
@@ -33,6 +34,17 @@ public:
 	void waitForXferStateThread();
 
 	double getStageRate() const { return mStageRate;}
+	void setStageRate(double stageRate);
+
+	unsigned int getXferCount() const { return mXferCount;}
+	void setXferCount(unsigned int xferCount);
+
+	unsigned int getMaxStageSize() const { return mMaxStageSize;}
+	void setMaxStageSize(unsigned int maxStageSize);
+
+	// stage timing of the last scan, the initial fill of the transfers is not included
+	const XferTiming& xferTiming() const { return mXferTiming;}
+	void getScanStats(ScanStats* stats) const { mXferTiming.getStats(stats);}
 
 private:
 	static void LIBUSB_CALL tarnsferCallback(libusb_transfer* transfer);
@@ -41,12 +53,21 @@ private:
 	static void* xferStateThread(void* arg);
 	void terminateXferStateThread();
 
+	void allocXferBuffers(int xferCount, unsigned int stageSize);
+	void freeXferBuffers();
+
 	void printTransferIndex(libusb_transfer* transfer);
 
 private:
 	const UsbDaqDevice&  mUsbDevice;
 	IoDevice* mIoDevice;
 	double mStageRate;
+	unsigned int mXferCount;
+	unsigned int mMaxStageSize;
+
+	// page-aligned stage buffers, sized for the transfer count and stage size of the current scan
+	unsigned char* mXferBuffers;
+	unsigned long long mXferBuffersSize;
 
 	pthread_t mXferStateThreadHandle;
 	bool mTerminateXferStateThread;
@@ -69,15 +90,18 @@ private:
 	DaqEventHandler* mDaqEventHandler;
 	DaqEventType mEnabledDaqEvents;
 
+	XferTiming mXferTiming;
+
 public:
 
 	enum {SCAN_PARAM_TCR = 1, SCAN_PARAM_TMR = 2};
-	enum {MAX_XFER_COUNT = 32, MAX_STAGE_SIZE = 16384};
+	enum {DEFAULT_XFER_COUNT = 32, MAX_XFER_COUNT = 256};
+	enum {DEFAULT_STAGE_SIZE = 16384, MIN_STAGE_SIZE = 1024, MAX_STAGE_SIZE = 4194304};
 
 	struct
 	{
 		libusb_transfer* transfer;
-		unsigned char buffer[MAX_STAGE_SIZE];
+		unsigned char* buffer;
 	} mXfer[MAX_XFER_COUNT];
 };
 
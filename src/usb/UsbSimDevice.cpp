@@ -0,0 +1,496 @@
+/*
+ * UsbSimDevice.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "UsbSimDevice.h"
+#include "UsbDaqDevice.h"
+#include "../DaqDeviceId.h"
+#include "../DaqDeviceManager.h"
+#include "../UlException.h"
+#include "../utility/UlLock.h"
+
+namespace ul
+{
+
+std::vector<DaqDeviceDescriptor> UsbSimDevice::mSimDevices;
+unsigned int UsbSimDevice::mSimDeviceNum = 0;
+pthread_mutex_t UsbSimDevice::mSimDevicesMutex = PTHREAD_MUTEX_INITIALIZER;
+long long UsbSimDevice::mRate = 0;
+
+UsbSimDevice::UsbSimDevice()
+{
+	mThreadHandle = 0;
+	mStarted = false;
+	mTerminate = false;
+
+	memset(mActiveXfers, 0, sizeof(mActiveXfers));
+	mInputStarted = false;
+	mFpgaImageSize = 0;
+	mRampValue = 0;
+
+	mStatusCmd = 0;
+	memset(mRunningMask, 0, sizeof(mRunningMask));
+
+	UlLock::initMutex(mMutex, PTHREAD_MUTEX_NORMAL);
+	pthread_cond_init(&mCond, NULL);
+}
+
+UsbSimDevice::~UsbSimDevice()
+{
+	stop();
+
+	pthread_cond_destroy(&mCond);
+	UlLock::destroyMutex(mMutex);
+}
+
+// the status, command and scan transfer handling of these products is what the simulator models. Products whose
+// scans use synchronous transfers or the HID interface are not supported
+bool UsbSimDevice::isSimProductSupported(unsigned int productId)
+{
+	bool supported = false;
+
+	switch(productId)
+	{
+	case DaqDeviceId::USB_1208HS:
+	case DaqDeviceId::USB_1208HS_2AO:
+	case DaqDeviceId::USB_1208HS_4AO:
+	case DaqDeviceId::USB_1608G:
+	case DaqDeviceId::USB_1608GX:
+	case DaqDeviceId::USB_1608GX_2AO:
+	case DaqDeviceId::USB_1608G_2:
+	case DaqDeviceId::USB_1608GX_2:
+	case DaqDeviceId::USB_1608GX_2AO_2:
+	case DaqDeviceId::USB_1808:
+	case DaqDeviceId::USB_1808X:
+	case DaqDeviceId::USB_2623:
+	case DaqDeviceId::USB_2627:
+	case DaqDeviceId::USB_2633:
+	case DaqDeviceId::USB_2637:
+	case DaqDeviceId::USB_DIO32HS:
+	case DaqDeviceId::USB_CTR04:
+	case DaqDeviceId::USB_CTR08:
+		supported = true;
+		break;
+	}
+
+	return supported;
+}
+
+int UsbSimDevice::xferDir(const libusb_transfer* transfer)
+{
+	if(transfer->type == LIBUSB_TRANSFER_TYPE_CONTROL)
+		return DIR_CONTROL;
+
+	return (transfer->endpoint & LIBUSB_ENDPOINT_IN) ? DIR_IN : DIR_OUT;
+}
+
+void UsbSimDevice::addDevice(unsigned int productId)
+{
+	// isDaqDeviceSupported() also loads the product names
+	if(!isSimProductSupported(productId) || !DaqDeviceManager::isDaqDeviceSupported(productId, UsbDaqDevice::MCC_USB_VID))
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	DaqDeviceDescriptor descriptor;
+	memset(&descriptor, 0, sizeof(DaqDeviceDescriptor));
+
+	descriptor.productId = productId;
+	descriptor.devInterface = USB_IFC;
+
+	std::string productName = DaqDeviceManager::getDeviceName(productId, UsbDaqDevice::MCC_USB_VID);
+
+	strncpy(descriptor.productName, productName.c_str(), sizeof(descriptor.productName) - 1);
+	strncpy(descriptor.devString, productName.c_str(), sizeof(descriptor.devString) - 1);
+
+	UlLock lock(mSimDevicesMutex);
+
+	// numbers are not reused, a device created before the list was cleared keeps its identity
+	snprintf(descriptor.uniqueId, sizeof(descriptor.uniqueId), "SIM%u", mSimDeviceNum++);
+
+	mSimDevices.push_back(descriptor);
+}
+
+void UsbSimDevice::removeDevices()
+{
+	UlLock lock(mSimDevicesMutex);
+
+	mSimDevices.clear();
+}
+
+unsigned int UsbSimDevice::getDeviceCount()
+{
+	UlLock lock(mSimDevicesMutex);
+
+	return mSimDevices.size();
+}
+
+std::vector<DaqDeviceDescriptor> UsbSimDevice::getDaqDevices()
+{
+	UlLock lock(mSimDevicesMutex);
+
+	return mSimDevices;
+}
+
+bool UsbSimDevice::isSimDevice(const DaqDeviceDescriptor& daqDeviceDescriptor)
+{
+	UlLock lock(mSimDevicesMutex);
+
+	for(unsigned int i = 0; i < mSimDevices.size(); i++)
+	{
+		if(mSimDevices[i].productId == daqDeviceDescriptor.productId &&
+		   strncmp(mSimDevices[i].uniqueId, daqDeviceDescriptor.uniqueId, sizeof(daqDeviceDescriptor.uniqueId)) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+void UsbSimDevice::setRate(long long bytesPerSec)
+{
+	if(bytesPerSec < 0)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	__atomic_store_n(&mRate, bytesPerSec, __ATOMIC_RELAXED);
+}
+
+void UsbSimDevice::start(unsigned char statusCmd, unsigned short inRunningMask, unsigned short outRunningMask)
+{
+	UlLock lock(mMutex);
+
+	mStatusCmd = statusCmd;
+	mRunningMask[0] = inRunningMask;
+	mRunningMask[1] = outRunningMask;
+
+	if(mStarted)
+		return;
+
+	mTerminate = false;
+
+	pthread_attr_t attr;
+	int status = pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+	if(!status)
+	{
+		status = pthread_create(&mThreadHandle, &attr, &simThread, this);
+
+		if(status)
+		{
+			mThreadHandle = 0;
+			UL_LOG("#### Unable to start the simulator thread");
+		}
+		else
+		{
+#ifndef __APPLE__
+			pthread_setname_np(mThreadHandle, "usb_sim_td");
+#endif
+			mStarted = true;
+		}
+
+		pthread_attr_destroy(&attr);
+	}
+	else
+		UL_LOG("#### Unable to initialize attributes for the simulator thread");
+
+	if(!mStarted)
+		throw UlException(ERR_DEV_NOT_FOUND);
+}
+
+void UsbSimDevice::stop()
+{
+	pthread_mutex_lock(&mMutex);
+
+	bool started = mStarted;
+
+	mStarted = false;
+	mTerminate = true;
+
+	pthread_cond_signal(&mCond);
+
+	pthread_mutex_unlock(&mMutex);
+
+	if(started)
+	{
+		pthread_join(mThreadHandle, NULL);
+		mThreadHandle = 0;
+	}
+}
+
+void UsbSimDevice::query(unsigned char request, unsigned char* buff, unsigned short buffLen) const
+{
+	if(buff == NULL)
+		return;
+
+	memset(buff, 0, buffLen);
+
+	if(request == mStatusCmd && buffLen >= sizeof(unsigned short))
+	{
+		unsigned short status = 0;
+
+		UlLock lock(mMutex);
+
+		if(mFpgaImageSize > 0 && mActiveXfers[DIR_CONTROL] == 0)
+			status |= STATUS_FPGA_CONFIGURED;
+
+		for(int dir = DIR_IN; dir <= DIR_OUT; dir++)
+		{
+			if(mActiveXfers[dir])
+				status |= mRunningMask[dir];
+		}
+
+		buff[0] = status & 0xff;
+		buff[1] = status >> 8;
+	}
+}
+
+int UsbSimDevice::submitTransfer(libusb_transfer* transfer)
+{
+	UlLock lock(mMutex);
+
+	if(!mStarted)
+		return LIBUSB_ERROR_NO_DEVICE;
+
+	std::map<unsigned char, Endpoint>::iterator itr = mEndpoints.find(transfer->endpoint);
+
+	// the endpoint starts moving data when the first transfer of a scan is submitted
+	if(itr == mEndpoints.end())
+	{
+		Endpoint endpoint;
+		endpoint.readyNs = ul_clock_monotonic_ns();
+
+		itr = mEndpoints.insert(std::make_pair(transfer->endpoint, endpoint)).first;
+	}
+
+	itr->second.xfers.push_back(transfer);
+
+	mActiveXfers[xferDir(transfer)]++;
+
+	pthread_cond_signal(&mCond);
+
+	return LIBUSB_SUCCESS;
+}
+
+int UsbSimDevice::cancelTransfer(libusb_transfer* transfer)
+{
+	int status = LIBUSB_ERROR_NOT_FOUND;
+
+	UlLock lock(mMutex);
+
+	std::map<unsigned char, Endpoint>::iterator itr = mEndpoints.find(transfer->endpoint);
+
+	if(itr != mEndpoints.end())
+	{
+		std::deque<libusb_transfer*>& xfers = itr->second.xfers;
+
+		for(std::deque<libusb_transfer*>::iterator xferItr = xfers.begin(); xferItr != xfers.end(); xferItr++)
+		{
+			if(*xferItr == transfer)
+			{
+				xfers.erase(xferItr);
+				mCancelledXfers.push_back(transfer);
+
+				pthread_cond_signal(&mCond);
+
+				status = LIBUSB_SUCCESS;
+				break;
+			}
+		}
+
+		// stopping a scan cancels all of its transfers, the next scan starts with an idle endpoint
+		if(xfers.empty())
+			mEndpoints.erase(itr);
+	}
+
+	return status;
+}
+
+void UsbSimDevice::startInput()
+{
+	UlLock lock(mMutex);
+
+	mInputStarted = true;
+
+	// the data of the scan is acquired from the start command on, not from the time the transfers were submitted
+	unsigned long long nowNs = ul_clock_monotonic_ns();
+
+	for(std::map<unsigned char, Endpoint>::iterator itr = mEndpoints.begin(); itr != mEndpoints.end(); itr++)
+	{
+		if(itr->first & LIBUSB_ENDPOINT_IN)
+			itr->second.readyNs = nowNs;
+	}
+
+	pthread_cond_signal(&mCond);
+}
+
+libusb_transfer* UsbSimDevice::nextTransfer(libusb_transfer_status* status, unsigned long long* waitNs)
+{
+	libusb_transfer* transfer = NULL;
+
+	*waitNs = 0;
+
+	if(!mCancelledXfers.empty())
+	{
+		transfer = mCancelledXfers.front();
+		mCancelledXfers.pop_front();
+
+		*status = LIBUSB_TRANSFER_CANCELLED;
+
+		return transfer;
+	}
+
+	long long rate = __atomic_load_n(&mRate, __ATOMIC_RELAXED);
+	unsigned long long nowNs = ul_clock_monotonic_ns();
+
+	Endpoint* nextEndpoint = NULL;
+	unsigned long long nextReadyNs = 0;
+
+	for(std::map<unsigned char, Endpoint>::iterator itr = mEndpoints.begin(); itr != mEndpoints.end(); itr++)
+	{
+		Endpoint& endpoint = itr->second;
+
+		// the FIFO of an input scan stays empty until the scan is started
+		if((itr->first & LIBUSB_ENDPOINT_IN) && !mInputStarted)
+			continue;
+
+		if(!endpoint.xfers.empty())
+		{
+			unsigned long long readyNs = endpoint.readyNs;
+
+			if(rate > 0)
+				readyNs += endpoint.xfers.front()->length * 1000000000ULL / rate;
+
+			if(nextEndpoint == NULL || readyNs < nextReadyNs)
+			{
+				nextEndpoint = &endpoint;
+				nextReadyNs = readyNs;
+			}
+		}
+	}
+
+	if(nextEndpoint)
+	{
+		if(rate == 0 || nextReadyNs <= nowNs)
+		{
+			transfer = nextEndpoint->xfers.front();
+			nextEndpoint->xfers.pop_front();
+
+			// with no rate the data is there whenever a transfer is submitted
+			nextEndpoint->readyNs = (rate > 0) ? nextReadyNs : nowNs;
+
+			*status = LIBUSB_TRANSFER_COMPLETED;
+		}
+		else
+			*waitNs = nextReadyNs - nowNs;
+	}
+
+	return transfer;
+}
+
+void UsbSimDevice::fillRamp(unsigned char* buffer, int length)
+{
+	for(int i = 0; i + 1 < length; i += 2)
+	{
+		buffer[i] = mRampValue & 0xff;
+		buffer[i + 1] = mRampValue >> 8;
+
+		mRampValue++;
+	}
+}
+
+void UsbSimDevice::waitForTransfer(unsigned long long waitNs)
+{
+	if(waitNs == 0)
+		pthread_cond_wait(&mCond, &mMutex);
+	else
+	{
+		struct timespec deadline;
+		ul_clock_realtime(&deadline);
+
+		unsigned long long ns = deadline.tv_nsec + waitNs;
+
+		deadline.tv_sec += ns / 1000000000ULL;
+		deadline.tv_nsec = ns % 1000000000ULL;
+
+		pthread_cond_timedwait(&mCond, &mMutex, &deadline);
+	}
+}
+
+void* UsbSimDevice::simThread(void* arg)
+{
+	UsbSimDevice* This = (UsbSimDevice*) arg;
+
+	pthread_mutex_lock(&This->mMutex);
+
+	while(!This->mTerminate)
+	{
+		libusb_transfer_status status = LIBUSB_TRANSFER_COMPLETED;
+		unsigned long long waitNs = 0;
+
+		libusb_transfer* transfer = This->nextTransfer(&status, &waitNs);
+
+		if(transfer)
+		{
+			int dir = xferDir(transfer);
+
+			// the setup packet of a control transfer is not part of its data
+			int length = (dir == DIR_CONTROL) ? transfer->length - LIBUSB_CONTROL_SETUP_SIZE : transfer->length;
+
+			transfer->status = status;
+			transfer->actual_length = (status == LIBUSB_TRANSFER_COMPLETED) ? length : 0;
+
+			// the FPGA reports the image as loaded as soon as the loader sees its last transfer complete
+			if(dir == DIR_CONTROL)
+			{
+				This->mFpgaImageSize += transfer->actual_length;
+				This->mActiveXfers[dir]--;
+			}
+
+			// the callback resubmits the transfer, so it must run without the lock held
+			pthread_mutex_unlock(&This->mMutex);
+
+			if(status == LIBUSB_TRANSFER_COMPLETED && dir == DIR_IN)
+				This->fillRamp(transfer->buffer, transfer->length);
+
+			transfer->callback(transfer);
+
+			pthread_mutex_lock(&This->mMutex);
+
+			if(dir != DIR_CONTROL)
+				This->mActiveXfers[dir]--;
+
+			// the input scan is over once all of its transfers are back, the next one waits for its own start
+			if(dir == DIR_IN && This->mActiveXfers[DIR_IN] == 0)
+				This->mInputStarted = false;
+		}
+		else
+			This->waitForTransfer(waitNs);
+	}
+
+	// the device is gone, the transfers still held are returned the way libusb returns them when a device is unplugged
+	std::deque<libusb_transfer*> xfers;
+	xfers.swap(This->mCancelledXfers);
+
+	for(std::map<unsigned char, Endpoint>::iterator itr = This->mEndpoints.begin(); itr != This->mEndpoints.end(); itr++)
+		xfers.insert(xfers.end(), itr->second.xfers.begin(), itr->second.xfers.end());
+
+	This->mEndpoints.clear();
+	memset(This->mActiveXfers, 0, sizeof(This->mActiveXfers));
+
+	pthread_mutex_unlock(&This->mMutex);
+
+	for(std::deque<libusb_transfer*>::iterator itr = xfers.begin(); itr != xfers.end(); itr++)
+	{
+		(*itr)->status = LIBUSB_TRANSFER_NO_DEVICE;
+		(*itr)->actual_length = 0;
+		(*itr)->callback(*itr);
+	}
+
+	return NULL;
+}
+
+} /* namespace ul */
@@ -0,0 +1,111 @@
+/*
+ * UsbSimDevice.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef USB_USBSIMDEVICE_H_
+#define USB_USBSIMDEVICE_H_
+
+#include <libusb-1.0/libusb.h>
+#include <pthread.h>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// stands in for the USB hardware of a UsbDaqDevice so the scan transfer path can be measured without a device.
+// Simulated devices are added with UL_CFG_USB_SIM_DEVICE and listed in the USB inventory with a "SIM<n>" serial
+// number. Commands always succeed, queries return zeros except the status, which reports the FPGA as configured once
+// an image was uploaded with async control transfers and none of them is pending, and a scan as running while the
+// simulator holds transfers of its direction. The bulk transfers of a scan are completed
+// on the simulator thread in the order they were submitted to an endpoint, IN transfers are filled with a 16-bit
+// ramp and the data of OUT transfers is discarded. IN transfers are not completed before the start command of the
+// input scan is sent, see startInput(). Each endpoint moves UL_CFG_USB_SIM_RATE bytes per second, a
+// transfer is not completed before it is submitted, so the completions of a host that falls behind arrive back to
+// back the way they do from the FIFO of a real device. Overruns and underruns are not simulated
+class UL_LOCAL UsbSimDevice
+{
+public:
+	UsbSimDevice();
+	virtual ~UsbSimDevice();
+
+	// productId must be a product whose scans run over bulk transfers, see isSimProductSupported()
+	static void addDevice(unsigned int productId);
+	static void removeDevices();
+	static unsigned int getDeviceCount();
+	static std::vector<DaqDeviceDescriptor> getDaqDevices();
+	static bool isSimDevice(const DaqDeviceDescriptor& daqDeviceDescriptor);
+
+	// bytes per second moved by each endpoint, 0 completes the transfers as soon as they are submitted
+	static void setRate(long long bytesPerSec);
+	static long long getRate() { return mRate; }
+
+	void start(unsigned char statusCmd, unsigned short inRunningMask, unsigned short outRunningMask);
+	void stop();
+
+	// called when the start command of an input scan is sent, the IN endpoints complete transfers until all of
+	// them are back from the simulator
+	void startInput();
+
+	void query(unsigned char request, unsigned char* buff, unsigned short buffLen) const;
+
+	// same contract as libusb_submit_transfer() and libusb_cancel_transfer(), the callbacks of submitted and
+	// cancelled transfers are invoked on the simulator thread
+	int submitTransfer(libusb_transfer* transfer);
+	int cancelTransfer(libusb_transfer* transfer);
+
+	enum {MAX_PACKET_SIZE = 512, STATUS_FPGA_CONFIGURED = 0x100};
+
+private:
+	static bool isSimProductSupported(unsigned int productId);
+	static int xferDir(const libusb_transfer* transfer);
+	static void* simThread(void* arg);
+
+	// returns the transfer to complete next and its completion status, or NULL and the time, in ns, until the next
+	// transfer is due. Called with mMutex held
+	libusb_transfer* nextTransfer(libusb_transfer_status* status, unsigned long long* waitNs);
+	void fillRamp(unsigned char* buffer, int length);
+	void waitForTransfer(unsigned long long waitNs);
+
+private:
+	typedef struct
+	{
+		std::deque<libusb_transfer*> xfers;
+		// time the endpoint finished moving the data of its last completed transfer
+		unsigned long long readyNs;
+	} Endpoint;
+
+	mutable pthread_mutex_t mMutex;
+	pthread_cond_t mCond;
+	pthread_t mThreadHandle;
+	bool mStarted;
+	bool mTerminate;
+
+	std::map<unsigned char, Endpoint> mEndpoints;
+	std::deque<libusb_transfer*> mCancelledXfers;
+
+	// transfers held by the simulator per direction, including the one whose callback is running. The control
+	// transfers of an FPGA image are counted apart from the scan transfers
+	enum {DIR_IN, DIR_OUT, DIR_CONTROL};
+	unsigned int mActiveXfers[3];
+	unsigned long long mFpgaImageSize;
+	bool mInputStarted;
+	unsigned short mRampValue;
+
+	unsigned char mStatusCmd;
+	unsigned short mRunningMask[2];
+
+	static std::vector<DaqDeviceDescriptor> mSimDevices;
+	static unsigned int mSimDeviceNum;
+	static pthread_mutex_t mSimDevicesMutex;
+	static long long mRate;
+};
+
+} /* namespace ul */
+
+#endif /* USB_USBSIMDEVICE_H_ */
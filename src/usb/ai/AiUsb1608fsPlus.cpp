@@ -13,7 +13,7 @@ AiUsb1608fs_Plus::AiUsb1608fs_Plus(const UsbDaqDevice& daqDevice) : AiUsbBase(da
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
-	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
+	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA | AINSCAN_FF_FLOAT32DATA | AINSCAN_FF_UINT16DATA | AINSCAN_FF_UINT32DATA);
 
 	mAiInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_SINGLEIO | SO_BLOCKIO | SO_BURSTIO | SO_PACEROUT);
 	mAiInfo.setTriggerTypes(TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE);
@@ -131,7 +131,7 @@ double AiUsb1608fs_Plus::aInScan(int lowChan, int highChan, AiInputMode inputMod
 
 	try
 	{
-		daqDev().sendCmd(CMD_AINSCAN_START, 0, 0, (unsigned char*) &scanCfg, sizeof(scanCfg), 1000);
+		daqDev().sendScanStartCmd(FT_AI, options, CMD_AINSCAN_START, (unsigned char*) &scanCfg, sizeof(scanCfg), 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -21,7 +21,7 @@ AiUsb1608g::AiUsb1608g(const UsbDaqDevice& daqDevice) : AiUsbBase(daqDevice)
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
-	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
+	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA | AINSCAN_FF_FLOAT32DATA | AINSCAN_FF_UINT16DATA | AINSCAN_FF_UINT32DATA);
 
 	mAiInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_SINGLEIO | SO_BLOCKIO | SO_BURSTMODE | SO_RETRIGGER);
 	mAiInfo.setTriggerTypes(TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE);
@@ -149,7 +149,7 @@ double AiUsb1608g::aInScan(int lowChan, int highChan, AiInputMode inputMode, Ran
 
 	try
 	{
-		daqDev().sendCmd(CMD_AINSCAN_START, 0, 0, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
+		daqDev().sendScanStartCmd(FT_AI, options, CMD_AINSCAN_START, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -291,7 +291,7 @@ void AiUsb1608g::loadAInConfigs(AiInputMode inputMode, Range range, int lowChan,
 		}
 	}
 
-	daqDev().sendCmd(CMD_AIN_CONFIG, 0, 0, (unsigned char*)&aiCfg, sizeof(aiCfg));
+	daqDev().sendConfigCmd(CMD_AIN_CONFIG, 0, 0, (unsigned char*)&aiCfg, sizeof(aiCfg));
 }
 
 int AiUsb1608g::mapRangeCode(Range range) const
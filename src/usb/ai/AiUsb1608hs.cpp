@@ -14,7 +14,7 @@ AiUsb1608hs::AiUsb1608hs(const UsbDaqDevice& daqDevice) : AiUsbBase(daqDevice)
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
-	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
+	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA | AINSCAN_FF_FLOAT32DATA | AINSCAN_FF_UINT16DATA | AINSCAN_FF_UINT32DATA);
 
 	mAiInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_SINGLEIO | SO_BLOCKIO | SO_RETRIGGER);
 	mAiInfo.setTriggerTypes(TRIG_ABOVE | TRIG_BELOW | TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE);
@@ -182,7 +182,7 @@ double AiUsb1608hs::aInScan(int lowChan, int highChan, AiInputMode inputMode, Ra
 
 	try
 	{
-		daqDev().sendCmd(CMD_AINSCAN_START, 0, 0, NULL, 0, 1000);
+		daqDev().sendScanStartCmd(FT_AI, options, CMD_AINSCAN_START, NULL, 0, 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -197,7 +197,7 @@ double AiUsb1608hs::aInScan(int lowChan, int highChan, AiInputMode inputMode, Ra
 
 void AiUsb1608hs::writeAInConfigs() const
 {
-	daqDev().sendCmd(CMD_AIN_CONFIG, 0, 0, (unsigned char*)&mAInConfig, sizeof(mAInConfig));
+	daqDev().sendConfigCmd(CMD_AIN_CONFIG, 0, 0, (unsigned char*)&mAInConfig, sizeof(mAInConfig));
 }
 
 void AiUsb1608hs::resetAInConfigs() const
@@ -14,8 +14,10 @@ AiUsb1808::AiUsb1808(const UsbDaqDevice& daqDevice) : AiUsbBase(daqDevice)
 {
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
+	mRawScanDataSupported = false;  // scans are performed by the DAQI subsystem
+
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
-	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
+	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA | AINSCAN_FF_FLOAT32DATA | AINSCAN_FF_UINT32DATA);
 
 	mAiInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_SINGLEIO | SO_BLOCKIO | SO_RETRIGGER);
 	mAiInfo.setTriggerTypes(TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE | TRIG_PATTERN_EQ | TRIG_PATTERN_NE | TRIG_PATTERN_ABOVE | TRIG_PATTERN_BELOW);
@@ -283,6 +285,16 @@ UlError AiUsb1808::waitUntilDone(double timeout)
 	return mDaqDevice.daqIDevice()->waitUntilDone(FT_AI, timeout);
 }
 
+UlError AiUsb1808::waitForScanData(long long scanCount, double timeout)
+{
+	return mDaqDevice.daqIDevice()->waitForScanData(FT_AI, scanCount, timeout);
+}
+
+UlError AiUsb1808::readScanData(long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	return mDaqDevice.daqIDevice()->readScanData(FT_AI, scanCount, timeout, data, scansRead);
+}
+
 
 void AiUsb1808::stopBackground()
 {
@@ -33,6 +33,8 @@ public:
 
 	virtual ScanStatus getScanState() const;
 	virtual UlError waitUntilDone(double timeout);
+	virtual UlError waitForScanData(long long scanCount, double timeout);
+	virtual UlError readScanData(long long scanCount, double timeout, void* data, long long* scansRead);
 
 protected:
 	void loadAInConfig(int chan, AiInputMode mode, Range range) const;
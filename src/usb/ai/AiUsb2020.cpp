@@ -13,7 +13,7 @@ AiUsb2020::AiUsb2020(const UsbDaqDevice& daqDevice) : AiUsbBase(daqDevice)
 	double minRate = 1000;
 
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
-	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
+	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA | AINSCAN_FF_FLOAT32DATA | AINSCAN_FF_UINT16DATA | AINSCAN_FF_UINT32DATA);
 
 	mAiInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_SINGLEIO | SO_BLOCKIO | SO_BURSTIO | SO_RETRIGGER | SO_PACEROUT);
 	mAiInfo.setTriggerTypes(TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE | GATE_HIGH | GATE_LOW |
@@ -130,7 +130,7 @@ double AiUsb2020::aInScan(int lowChan, int highChan, AiInputMode inputMode, Rang
 
 	try
 	{
-		daqDev().sendCmd(CMD_AINSCAN_START, 0, 0, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
+		daqDev().sendScanStartCmd(FT_AI, options, CMD_AINSCAN_START, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -575,7 +575,7 @@ void AiUsb2020::loadAInConfigs(Range range, int lowChan, int highChan, bool queu
 		}
 	}
 
-	daqDev().sendCmd(CMD_AIN_CONFIG, 0, 0, (unsigned char*)&aiCfg, sizeof(aiCfg));
+	daqDev().sendConfigCmd(CMD_AIN_CONFIG, 0, 0, (unsigned char*)&aiCfg, sizeof(aiCfg));
 }
 
 int AiUsb2020::mapRangeCode(Range range) const
@@ -21,6 +21,8 @@ AiUsb24xx::AiUsb24xx(const UsbDaqDevice& daqDevice) : AiUsbBase(daqDevice)
 {
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
+	mRawScanDataSupported = false;  // samples carry open TC and sign bits that need per-sample processing
+
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA | AIN_FF_NOCALIBRATEDATA);
 	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA | AINSCAN_FF_NOCALIBRATEDATA);
 
@@ -330,7 +332,7 @@ start:
 
 	try
 	{
-		daqDev().sendCmd(CMD_AINSCAN_START, 0, 0, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
+		daqDev().sendScanStartCmd(FT_AI, options, CMD_AINSCAN_START, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -1140,8 +1142,6 @@ void AiUsb24xx::readCalDate()
 
 void AiUsb24xx::processScanData32(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned int* buffer = (unsigned int*)transfer->buffer;
@@ -15,6 +15,8 @@ AiUsb9837x::AiUsb9837x(const Usb9837x& daqDevice) : AiUsbBase(daqDevice)
 {
 	double minRate = 195.313;
 
+	mRawScanDataSupported = false;  // scans are performed by the DAQI subsystem
+
 	mAiInfo.setAInFlags(AIN_FF_NOSCALEDATA);
 	mAiInfo.setAInScanFlags(AINSCAN_FF_NOSCALEDATA);
 
@@ -383,6 +385,16 @@ UlError AiUsb9837x::waitUntilDone(double timeout)
 	return mDaqDevice.daqIDevice()->waitUntilDone(FT_AI, timeout);
 }
 
+UlError AiUsb9837x::waitForScanData(long long scanCount, double timeout)
+{
+	return mDaqDevice.daqIDevice()->waitForScanData(FT_AI, scanCount, timeout);
+}
+
+UlError AiUsb9837x::readScanData(long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	return mDaqDevice.daqIDevice()->readScanData(FT_AI, scanCount, timeout, data, scansRead);
+}
+
 
 void AiUsb9837x::stopBackground()
 {
@@ -37,6 +37,8 @@ public:
 
 	virtual ScanStatus getScanState() const;
 	virtual UlError waitUntilDone(double timeout);
+	virtual UlError waitForScanData(long long scanCount, double timeout);
+	virtual UlError readScanData(long long scanCount, double timeout, void* data, long long* scansRead);
 
 	void setCurrentChanRange(int channel, Range range) const;
 	Range getCurrentChanRange(int channel) const;
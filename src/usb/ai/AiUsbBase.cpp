@@ -15,6 +15,8 @@ AiUsbBase::AiUsbBase(const UsbDaqDevice& daqDevice) : AiDevice(daqDevice), mUsbD
 	mScanStopCmd = 0;
 
 	mTransferMode = SO_BLOCKIO;
+
+	mRawScanDataSupported = true;
 }
 
 AiUsbBase::~AiUsbBase()
@@ -179,8 +181,10 @@ int AiUsbBase::calcStageSize(int epAddr, double rate, int chanCount, int sampleC
 		if (stageSize < minStageSize)
 			stageSize = minStageSize;
 
-		if(stageSize > UsbScanTransferIn::MAX_STAGE_SIZE)
-			stageSize = UsbScanTransferIn::MAX_STAGE_SIZE;
+		int maxStageSize = daqDev().scanTranserIn()->getMaxStageSize();
+
+		if(stageSize > maxStageSize)
+			stageSize = maxStageSize;
 	}
 
 	return stageSize;
@@ -216,6 +220,12 @@ void AiUsbBase::processScanData(void* transfer)
 {
 	libusb_transfer* usbTransfer = (libusb_transfer*)transfer;
 
+	if(mScanInfo.dataBufferType == DATA_RAW)
+	{
+		storeRawScanSamples(usbTransfer->buffer, usbTransfer->actual_length / mScanInfo.sampleSize);
+		return;
+	}
+
 	switch(mScanInfo.sampleSize)
 	{
 	case 2:  // 2 bytes
@@ -232,117 +242,16 @@ void AiUsbBase::processScanData(void* transfer)
 
 void AiUsbBase::processScanData16(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
-	int numOfSampleCopied = 0;
-	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
-	unsigned short* buffer = (unsigned short*)transfer->buffer;
-
-	double data;
-	long rawVal;
-
-	double* dataBuffer = (double*) mScanInfo.dataBuffer;
-
-	while(numOfSampleCopied < requestSampleCount)
-	{
-		rawVal = Endian::le_ui16_to_cpu(buffer[numOfSampleCopied]);
-
-		if((mScanInfo.flags & NOCALIBRATEDATA) && (mScanInfo.flags & NOSCALEDATA))
-			data = rawVal;
-		else
-		{
-			data = (mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].slope * rawVal) + mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].offset;
-
-			/* commented out. According to CH calibrated count should not be clipped if it is out of range
-			if(mScanInfo.flags & NOSCALEDATA)
-			{
-				//data += 0.5;
-
-				if(data > mScanInfo.fullScale)
-					data = mScanInfo.fullScale;
-				else if(data < 0)
-					data = 0;
-			}*/
-		}
-
-		dataBuffer[mScanInfo.currentDataBufferIdx] = mScanInfo.customScales[mScanInfo.currentCalCoefIdx].slope * data + mScanInfo.customScales[mScanInfo.currentCalCoefIdx].offset;
-
-		mScanInfo.currentDataBufferIdx++;
-		mScanInfo.currentCalCoefIdx++;
-		numOfSampleCopied++;
-
-		mScanInfo.totalSampleTransferred++;
-
-		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
-		{
-			mScanInfo.currentDataBufferIdx = 0;
-			if(!mScanInfo.recycle)
-			{
-				mScanInfo.allSamplesTransferred = true;
-				break;
-			}
-		}
-
-		if(mScanInfo.currentCalCoefIdx == mScanInfo.chanCount)
-			mScanInfo.currentCalCoefIdx = 0;
-	}
+	unsigned int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 
+	convertScanSamples(transfer->buffer, requestSampleCount);
 }
 
 void AiUsbBase::processScanData32(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
-	int numOfSampleCopied = 0;
-	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
-	unsigned int* buffer = (unsigned int*)transfer->buffer;
-
-	double data;
-	unsigned int rawVal;
-
-	double* dataBuffer = (double*) mScanInfo.dataBuffer;
-
-	while(numOfSampleCopied < requestSampleCount)
-	{
-		rawVal = Endian::le_ui32_to_cpu(buffer[numOfSampleCopied]);
-
-		if((mScanInfo.flags & NOCALIBRATEDATA) && (mScanInfo.flags & NOSCALEDATA))
-			data = rawVal;
-		else
-		{
-			data = (mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].slope * rawVal) + mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].offset;
-
-			/* commented out. According to CH calibrated count should not be clipped if it is out of range
-			if(mScanInfo.flags & NOSCALEDATA)
-			{
-				if(data > mScanInfo.fullScale)
-					data = mScanInfo.fullScale;
-				else if(data < 0)
-					data = 0;
-			}*/
-		}
-
-		dataBuffer[mScanInfo.currentDataBufferIdx] = mScanInfo.customScales[mScanInfo.currentCalCoefIdx].slope * data + mScanInfo.customScales[mScanInfo.currentCalCoefIdx].offset;
+	unsigned int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 
-		mScanInfo.currentDataBufferIdx++;
-		mScanInfo.currentCalCoefIdx++;
-		numOfSampleCopied++;
-
-		mScanInfo.totalSampleTransferred++;
-
-		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
-		{
-			mScanInfo.currentDataBufferIdx = 0;
-			if(!mScanInfo.recycle)
-			{
-				mScanInfo.allSamplesTransferred = true;
-				break;
-			}
-		}
-
-		if(mScanInfo.currentCalCoefIdx == mScanInfo.chanCount)
-			mScanInfo.currentCalCoefIdx = 0;
-	}
+	convertScanSamples(transfer->buffer, requestSampleCount);
 }
 
 void AiUsbBase::readCalDate()
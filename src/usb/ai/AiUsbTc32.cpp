@@ -187,7 +187,7 @@ void AiUsbTc32::enableAllChannels()
 	bool chanEnabled = false;
 	unsigned char chanTcTypes[64];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 
 	for(int ch = 0; ch < mActualChanCount; ch++)
 	{
@@ -200,7 +200,7 @@ void AiUsbTc32::enableAllChannels()
 
 	if(chanEnabled)
 	{
-		daqDev().sendCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+		daqDev().sendConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 	}
 }
 
@@ -327,7 +327,7 @@ void AiUsbTc32::setCfg_ChanType(int channel, AiChanType chanType)
 
 	unsigned char chanTcTypes[64];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 
 	if(chanType == AI_DISABLED && chanTcTypes[channel] != 0)
 	{
@@ -340,7 +340,7 @@ void AiUsbTc32::setCfg_ChanType(int channel, AiChanType chanType)
 	else
 		return;
 
-	daqDev().sendCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().sendConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 }
 
 AiChanType AiUsbTc32::getCfg_ChanType(int channel) const
@@ -350,7 +350,7 @@ AiChanType AiUsbTc32::getCfg_ChanType(int channel) const
 
 	unsigned char chanTcTypes[64];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 
 	AiChanType chanType = chanTcTypes[channel] == 0 ? AI_DISABLED : AI_TC;
 
@@ -367,11 +367,11 @@ void AiUsbTc32::setCfg_ChanTcType(int channel, TcType tcType)
 
 	unsigned char chanTcTypes[64];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 
 	chanTcTypes[channel] = tcType;
 
-	daqDev().sendCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().sendConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 }
 
 TcType AiUsbTc32::getCfg_ChanTcType(int channel) const
@@ -383,7 +383,7 @@ TcType AiUsbTc32::getCfg_ChanTcType(int channel) const
 
 	unsigned char chanTcTypes[64];
 
-	daqDev().queryCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
+	daqDev().queryConfigCmd(CMD_TIN_CONFIG, 0, 0, chanTcTypes, sizeof(chanTcTypes));
 
 	// if channel is disabled return J type as current TC type
 	tcTypeVal = chanTcTypes[channel] == 0 ? TC_J : (TcType) chanTcTypes[channel];
@@ -397,14 +397,14 @@ void  AiUsbTc32::setCfg_OpenTcDetectionMode(int dev, OtdMode mode)
 	{
 		TMEASURE_CFG config[2];
 
-		daqDev().queryCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().queryConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 
 		if(mode == OTD_DISABLED)
 			config[dev].otd = 1;
 		else
 			config[dev].otd = 0;
 
-		daqDev().sendCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().sendConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 	}
 }
 OtdMode  AiUsbTc32::getCfg_OpenTcDetectionMode(int dev) const
@@ -415,7 +415,7 @@ OtdMode  AiUsbTc32::getCfg_OpenTcDetectionMode(int dev) const
 	{
 		TMEASURE_CFG config[2];
 
-		daqDev().queryCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().queryConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 
 		if(config[dev].otd == 1)
 			mode = OTD_DISABLED;
@@ -430,14 +430,14 @@ void AiUsbTc32::setCfg_CalTableType(int dev, AiCalTableType calTableType)
 	{
 		TMEASURE_CFG config[2];
 
-		daqDev().queryCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().queryConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 
 		if(calTableType == AI_CTT_FIELD)
 			config[dev].cal = 1;
 		else
 			config[dev].cal = 0;
 
-		daqDev().sendCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().sendConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 	}
 }
 
@@ -449,7 +449,7 @@ AiCalTableType AiUsbTc32::getCfg_CalTableType(int dev) const
 	{
 		TMEASURE_CFG config[2];
 
-		daqDev().queryCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().queryConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 
 		if(config[dev].cal == 1)
 			type = AI_CTT_FIELD;
@@ -464,14 +464,14 @@ void AiUsbTc32::setCfg_RejectFreqType(int dev, AiRejectFreqType rejectFreqType)
 	{
 		TMEASURE_CFG config[2];
 
-		daqDev().queryCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().queryConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 
 		if(rejectFreqType == AI_RFT_50HZ)
 			config[dev].filter = 1;
 		else
 			config[dev].filter = 0;
 
-		daqDev().sendCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().sendConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 	}
 }
 AiRejectFreqType AiUsbTc32::getCfg_RejectFreqType(int dev) const
@@ -482,7 +482,7 @@ AiRejectFreqType AiUsbTc32::getCfg_RejectFreqType(int dev) const
 	{
 		TMEASURE_CFG config[2];
 
-		daqDev().queryCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
+		daqDev().queryConfigCmd(CMD_MEASURE_CONFIG, 0, 0, (unsigned char*)&config, sizeof(config));
 
 		if(config[dev].filter == 1)
 			type = AI_RFT_50HZ;
@@ -425,8 +425,6 @@ unsigned int AoUsb24xx::processScanData(void* transfer, unsigned int stageSize)
 
 unsigned int AoUsb24xx::processScanData16_2416(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
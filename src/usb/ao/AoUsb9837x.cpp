@@ -481,8 +481,6 @@ void AoUsb9837x::check_AOutSetTrigger_Args(TriggerType trigType, int trigChan, d
 
 unsigned int AoUsb9837x::processScanData32(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	// each USB write must start with 512 bytes, the first four of which are the transfer size.
 	// The actual data starts at offset 512
 	/************************/
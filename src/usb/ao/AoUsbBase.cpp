@@ -205,8 +205,10 @@ int AoUsbBase::calcStageSize(int epAddr, double rate, int chanCount, int sampleC
 		if (stageSize < minStageSize)
 			stageSize = minStageSize;
 
-		if(stageSize > UsbScanTransferOut::MAX_STAGE_SIZE)
-			stageSize = UsbScanTransferOut::MAX_STAGE_SIZE;
+		int maxStageSize = daqDev().scanTranserOut()->getMaxStageSize();
+
+		if(stageSize > maxStageSize)
+			stageSize = maxStageSize;
 	}
 
 	return stageSize;
@@ -235,8 +237,6 @@ unsigned int AoUsbBase::processScanData(void* transfer, unsigned int stageSize)
 
 unsigned int AoUsbBase::processScanData16(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -295,8 +295,6 @@ unsigned int AoUsbBase::processScanData16(libusb_transfer* transfer, unsigned in
 
 unsigned int AoUsbBase::processScanData32(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -285,6 +285,16 @@ UlError CtrUsb1808::waitUntilDone(double timeout)
 	return mDaqDevice.daqIDevice()->waitUntilDone(FT_CTR, timeout);
 }
 
+UlError CtrUsb1808::waitForScanData(long long scanCount, double timeout)
+{
+	return mDaqDevice.daqIDevice()->waitForScanData(FT_CTR, scanCount, timeout);
+}
+
+UlError CtrUsb1808::readScanData(long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	return mDaqDevice.daqIDevice()->readScanData(FT_CTR, scanCount, timeout, data, scansRead);
+}
+
 
 void CtrUsb1808::stopBackground()
 {
@@ -135,6 +135,16 @@ UlError CtrUsb9837x::waitUntilDone(double timeout)
 	return mDaqDevice.daqIDevice()->waitUntilDone(FT_CTR, timeout);
 }
 
+UlError CtrUsb9837x::waitForScanData(long long scanCount, double timeout)
+{
+	return mDaqDevice.daqIDevice()->waitForScanData(FT_CTR, scanCount, timeout);
+}
+
+UlError CtrUsb9837x::readScanData(long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	return mDaqDevice.daqIDevice()->readScanData(FT_CTR, scanCount, timeout, data, scansRead);
+}
+
 
 void CtrUsb9837x::stopBackground()
 {
@@ -28,6 +28,8 @@ public:
 	virtual UlError getStatus(ScanStatus* status, TransferStatus* xferStatus);
 	virtual void stopBackground();
 	UlError waitUntilDone(double timeout);
+	UlError waitForScanData(long long scanCount, double timeout);
+	UlError readScanData(long long scanCount, double timeout, void* data, long long* scansRead);
 
 	virtual ScanStatus getScanState() const;
 
@@ -386,6 +386,16 @@ UlError CtrUsbCtrx::waitUntilDone(double timeout)
 	return mDaqDevice.daqIDevice()->waitUntilDone(FT_CTR, timeout);
 }
 
+UlError CtrUsbCtrx::waitForScanData(long long scanCount, double timeout)
+{
+	return mDaqDevice.daqIDevice()->waitForScanData(FT_CTR, scanCount, timeout);
+}
+
+UlError CtrUsbCtrx::readScanData(long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	return mDaqDevice.daqIDevice()->readScanData(FT_CTR, scanCount, timeout, data, scansRead);
+}
+
 
 void CtrUsbCtrx::stopBackground()
 {
@@ -911,8 +911,10 @@ int CtrUsbQuad08::calcStageSize(int epAddr, double rate, int ctrCount, int sampl
 	if (stageSize < minStageSize)
 		stageSize = minStageSize;
 
-	if(stageSize > UsbScanTransferIn::MAX_STAGE_SIZE)
-		stageSize = UsbScanTransferIn::MAX_STAGE_SIZE;
+	int maxStageSize = daqDev().scanTranserIn()->getMaxStageSize();
+
+	if(stageSize > maxStageSize)
+		stageSize = maxStageSize;
 
 
 	return stageSize;
@@ -1088,8 +1090,6 @@ void CtrUsbQuad08::processScanData(void* transfer)
 
 void CtrUsbQuad08::processScanData16(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned short* buffer = (unsigned short*)transfer->buffer;
@@ -1127,8 +1127,6 @@ void CtrUsbQuad08::processScanData16(libusb_transfer* transfer)
 
 void CtrUsbQuad08::processScanData32(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned int* buffer = (unsigned int*)transfer->buffer;
@@ -1165,8 +1163,6 @@ void CtrUsbQuad08::processScanData32(libusb_transfer* transfer)
 
 void CtrUsbQuad08::processScanData64(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned long long* buffer = (unsigned long long*)transfer->buffer;
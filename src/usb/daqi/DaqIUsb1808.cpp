@@ -16,7 +16,7 @@ DaqIUsb1808::DaqIUsb1808(const UsbDaqDevice& daqDevice) : DaqIUsbBase(daqDevice)
 {
 	double minRate = daqDev().getClockFreq() / UINT_MAX;
 
-	mDaqIInfo.setDaqInScanFlags(DAQINSCAN_FF_NOSCALEDATA | DAQINSCAN_FF_NOCALIBRATEDATA | DAQINSCAN_FF_NOCLEAR);
+	mDaqIInfo.setDaqInScanFlags(DAQINSCAN_FF_NOSCALEDATA | DAQINSCAN_FF_NOCALIBRATEDATA | DAQINSCAN_FF_NOCLEAR | DAQINSCAN_FF_FLOAT32DATA | DAQINSCAN_FF_UINT32DATA);
 	mDaqIInfo.setScanOptions(SO_DEFAULTIO | SO_CONTINUOUS | SO_EXTTRIGGER | SO_EXTCLOCK | SO_SINGLEIO | SO_BLOCKIO | SO_RETRIGGER);
 	mDaqIInfo.setTriggerTypes(TRIG_HIGH | TRIG_LOW | TRIG_POS_EDGE | TRIG_NEG_EDGE | TRIG_PATTERN_EQ | TRIG_PATTERN_NE | TRIG_PATTERN_ABOVE | TRIG_PATTERN_BELOW);
 
@@ -93,7 +93,7 @@ double DaqIUsb1808::daqInScan(FunctionType functionType, DaqInChanDescriptor cha
 
 		try
 		{
-			daqDev().sendCmd(CMD_IN_SCAN_START, 0, 0, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
+			daqDev().sendScanStartCmd(functionType, options, CMD_IN_SCAN_START, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
 
 			setScanState(SS_RUNNING);
 		}
@@ -859,8 +859,6 @@ void DaqIUsb9837x::check_DaqInSetTrigger_Args(TriggerType trigType, DaqInChanDes
 
 void DaqIUsb9837x::processScanData32_dbl(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned int* buffer = (unsigned int*)transfer->buffer;
@@ -144,8 +144,10 @@ int DaqIUsbBase::calcStageSize(int epAddr, double rate, int chanCount, int sampl
 		if (stageSize < minStageSize)
 			stageSize = minStageSize;
 
-		if(stageSize > UsbScanTransferIn::MAX_STAGE_SIZE)
-			stageSize = UsbScanTransferIn::MAX_STAGE_SIZE;
+		int maxStageSize = daqDev().scanTranserIn()->getMaxStageSize();
+
+		if(stageSize > maxStageSize)
+			stageSize = maxStageSize;
 	}
 
 	return stageSize;
@@ -206,55 +208,13 @@ void DaqIUsbBase::processScanData(void* transfer)
 
 void DaqIUsbBase::processScanData16_dbl(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
-	int numOfSampleCopied = 0;
-	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
-	unsigned short* buffer = (unsigned short*)transfer->buffer;
-
-	double data;
-	unsigned int rawVal;
-	double* dataBuf = (double*) mScanInfo.dataBuffer;
-
-	while(numOfSampleCopied < requestSampleCount)
-	{
-		rawVal = Endian::le_ui16_to_cpu(buffer[numOfSampleCopied]);
-
-		if((mScanInfo.flags & NOCALIBRATEDATA) && (mScanInfo.flags & NOSCALEDATA))
-			data = rawVal;
-		else
-		{
-			data = (mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].slope * rawVal) + mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].offset;
-		}
-
-		dataBuf[mScanInfo.currentDataBufferIdx] = mScanInfo.customScales[mScanInfo.currentCalCoefIdx].slope * data + mScanInfo.customScales[mScanInfo.currentCalCoefIdx].offset;
-
-		mScanInfo.currentDataBufferIdx++;
-		mScanInfo.currentCalCoefIdx++;
-		numOfSampleCopied++;
-
-		mScanInfo.totalSampleTransferred++;
-
-		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
-		{
-			mScanInfo.currentDataBufferIdx = 0;
-			if(!mScanInfo.recycle)
-			{
-				mScanInfo.allSamplesTransferred = true;
-				break;
-			}
-		}
-
-		if(mScanInfo.currentCalCoefIdx == mScanInfo.chanCount)
-			mScanInfo.currentCalCoefIdx = 0;
-	}
+	unsigned int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 
+	convertScanSamples(transfer->buffer, requestSampleCount);
 }
 
 void DaqIUsbBase::processScanData16_uint64(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned short* buffer = (unsigned short*)transfer->buffer;
@@ -291,54 +251,13 @@ void DaqIUsbBase::processScanData16_uint64(libusb_transfer* transfer)
 
 void DaqIUsbBase::processScanData32_dbl(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
+	unsigned int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 
-	int numOfSampleCopied = 0;
-	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
-	unsigned int* buffer = (unsigned int*)transfer->buffer;
-
-	double data;
-	unsigned int rawVal;
-	double* dataBuf = (double*) mScanInfo.dataBuffer;
-
-	while(numOfSampleCopied < requestSampleCount)
-	{
-		rawVal = Endian::le_ui32_to_cpu(buffer[numOfSampleCopied]);
-
-		if((mScanInfo.flags & NOCALIBRATEDATA) && (mScanInfo.flags & NOSCALEDATA))
-			data = rawVal;
-		else
-		{
-			data = (mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].slope * rawVal) + mScanInfo.calCoefs[mScanInfo.currentCalCoefIdx].offset;
-		}
-
-		dataBuf[mScanInfo.currentDataBufferIdx] = mScanInfo.customScales[mScanInfo.currentCalCoefIdx].slope * data + mScanInfo.customScales[mScanInfo.currentCalCoefIdx].offset;
-
-		mScanInfo.currentDataBufferIdx++;
-		mScanInfo.currentCalCoefIdx++;
-		numOfSampleCopied++;
-
-		mScanInfo.totalSampleTransferred++;
-
-		if(mScanInfo.currentDataBufferIdx == mScanInfo.dataBufferSize)
-		{
-			mScanInfo.currentDataBufferIdx = 0;
-			if(!mScanInfo.recycle)
-			{
-				mScanInfo.allSamplesTransferred = true;
-				break;
-			}
-		}
-
-		if(mScanInfo.currentCalCoefIdx == mScanInfo.chanCount)
-			mScanInfo.currentCalCoefIdx = 0;
-	}
+	convertScanSamples(transfer->buffer, requestSampleCount);
 }
 
 void DaqIUsbBase::processScanData32_uint64(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned int* buffer = (unsigned int*)transfer->buffer;
@@ -375,8 +294,6 @@ void DaqIUsbBase::processScanData32_uint64(libusb_transfer* transfer)
 
 void DaqIUsbBase::processScanData64_uint64(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned long long* buffer = (unsigned long long*)transfer->buffer;
@@ -101,7 +101,7 @@ double DaqIUsbCtrx::daqInScan(FunctionType functionType, DaqInChanDescriptor cha
 
 	try
 	{
-		daqDev().sendCmd(CMD_SCAN_START, 0, 0, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
+		daqDev().sendScanStartCmd(functionType, options, CMD_SCAN_START, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -143,8 +143,10 @@ int DaqOUsbBase::calcStageSize(int epAddr, double rate, int chanCount, int sampl
 		if (stageSize < minStageSize)
 			stageSize = minStageSize;
 
-		if(stageSize > UsbScanTransferOut::MAX_STAGE_SIZE)
-			stageSize = UsbScanTransferOut::MAX_STAGE_SIZE;
+		int maxStageSize = daqDev().scanTranserOut()->getMaxStageSize();
+
+		if(stageSize > maxStageSize)
+			stageSize = maxStageSize;
 	}
 
 	return stageSize;
@@ -216,8 +218,6 @@ unsigned int DaqOUsbBase::processScanData(void* transfer, unsigned int stageSize
 
 unsigned int DaqOUsbBase::processScanData16_dbl(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -292,8 +292,6 @@ unsigned int DaqOUsbBase::processScanData16_dbl(libusb_transfer* transfer, unsig
 
 unsigned int DaqOUsbBase::processScanData16_uint64(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -343,8 +341,6 @@ unsigned int DaqOUsbBase::processScanData16_uint64(libusb_transfer* transfer, un
 
 unsigned int DaqOUsbBase::processScanData32_dbl(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -419,8 +415,6 @@ unsigned int DaqOUsbBase::processScanData32_dbl(libusb_transfer* transfer, unsig
 
 unsigned int DaqOUsbBase::processScanData32_uint64(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -471,8 +465,6 @@ unsigned int DaqOUsbBase::processScanData32_uint64(libusb_transfer* transfer, un
 
 unsigned int DaqOUsbBase::processScanData64_uint64(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
@@ -222,6 +222,22 @@ UlError DioUsb1808::waitUntilDone(ScanDirection direction, double timeout)
 		return mDaqDevice.daqODevice()->waitUntilDone(FT_DO, timeout);
 }
 
+UlError DioUsb1808::waitForScanData(ScanDirection direction, long long scanCount, double timeout)
+{
+	if(direction == SD_INPUT)
+		return mDaqDevice.daqIDevice()->waitForScanData(FT_DI, scanCount, timeout);
+	else
+		return ERR_BAD_DEV_TYPE;
+}
+
+UlError DioUsb1808::readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	if(direction == SD_INPUT)
+		return mDaqDevice.daqIDevice()->readScanData(FT_DI, scanCount, timeout, data, scansRead);
+	else
+		return ERR_BAD_DEV_TYPE;
+}
+
 
 void DioUsb1808::stopBackground(ScanDirection direction)
 {
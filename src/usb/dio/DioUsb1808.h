@@ -36,6 +36,8 @@ public:
 	virtual void stopBackground(ScanDirection direction);
 
 	virtual UlError waitUntilDone(ScanDirection direction, double timeout);
+	virtual UlError waitForScanData(ScanDirection direction, long long scanCount, double timeout);
+	virtual UlError readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead);
 
 	virtual ScanStatus getScanState(ScanDirection direction) const;
 
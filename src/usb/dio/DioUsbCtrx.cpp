@@ -72,6 +72,22 @@ UlError DioUsbCtrx::waitUntilDone(ScanDirection direction, double timeout)
 		return ERR_BAD_DEV_TYPE;
 }
 
+UlError DioUsbCtrx::waitForScanData(ScanDirection direction, long long scanCount, double timeout)
+{
+	if(direction == SD_INPUT)
+		return mDaqDevice.daqIDevice()->waitForScanData(FT_DI, scanCount, timeout);
+	else
+		return ERR_BAD_DEV_TYPE;
+}
+
+UlError DioUsbCtrx::readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	if(direction == SD_INPUT)
+		return mDaqDevice.daqIDevice()->readScanData(FT_DI, scanCount, timeout, data, scansRead);
+	else
+		return ERR_BAD_DEV_TYPE;
+}
+
 
 void DioUsbCtrx::stopBackground(ScanDirection direction)
 {
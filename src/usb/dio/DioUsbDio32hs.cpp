@@ -264,6 +264,22 @@ UlError DioUsbDio32hs::waitUntilDone(ScanDirection direction, double timeout)
 		return mDOutScanDev->waitUntilDone(timeout);
 }
 
+UlError DioUsbDio32hs::waitForScanData(ScanDirection direction, long long scanCount, double timeout)
+{
+	if(direction == SD_INPUT)
+		return mDInScanDev->waitForScanData(scanCount, timeout);
+	else
+		return ERR_BAD_DEV_TYPE;
+}
+
+UlError DioUsbDio32hs::readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead)
+{
+	if(direction == SD_INPUT)
+		return mDInScanDev->readScanData(scanCount, timeout, data, scansRead);
+	else
+		return ERR_BAD_DEV_TYPE;
+}
+
 
 void DioUsbDio32hs::stopBackground(ScanDirection direction)
 {
@@ -41,6 +41,8 @@ public:
 	virtual void stopBackground(ScanDirection direction);
 
 	virtual UlError waitUntilDone(ScanDirection direction, double timeout);
+	virtual UlError waitForScanData(ScanDirection direction, long long scanCount, double timeout);
+	virtual UlError readScanData(ScanDirection direction, long long scanCount, double timeout, void* data, long long* scansRead);
 
 protected:
 	virtual unsigned long readPortDirMask(unsigned int portNum) const;
@@ -61,7 +61,7 @@ double UsbDInScan::dInScan(DigitalPortType lowPort, DigitalPortType highPort, in
 
 	try
 	{
-		daqDev().sendCmd(CMD_DIN_SCAN_START, 0, 0, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
+		daqDev().sendScanStartCmd(FT_DI, options, CMD_DIN_SCAN_START, (unsigned char*) &mScanConfig, sizeof(mScanConfig), 1000);
 
 		setScanState(SS_RUNNING);
 	}
@@ -277,8 +277,10 @@ int UsbDInScan::calcStageSize(int epAddr, double rate, int chanCount, int sample
 		if (stageSize < minStageSize)
 			stageSize = minStageSize;
 
-		if(stageSize > UsbScanTransferIn::MAX_STAGE_SIZE)
-			stageSize = UsbScanTransferIn::MAX_STAGE_SIZE;
+		int maxStageSize = daqDev().scanTranserIn()->getMaxStageSize();
+
+		if(stageSize > maxStageSize)
+			stageSize = maxStageSize;
 	}
 
 	return stageSize;
@@ -327,8 +329,6 @@ void UsbDInScan::processScanData(void* transfer)
 
 void UsbDInScan::processScanData16(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned short* buffer = (unsigned short*)transfer->buffer;
@@ -362,8 +362,6 @@ void UsbDInScan::processScanData16(libusb_transfer* transfer)
 /*
 void UsbDInScan::processScanData32(libusb_transfer* transfer)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	int requestSampleCount = transfer->actual_length / mScanInfo.sampleSize;  // last packet in the finite mode might be less
 	unsigned int* buffer = (unsigned int*)transfer->buffer;
@@ -293,8 +293,10 @@ int UsbDOutScan::calcStageSize(int epAddr, double rate, int chanCount, int sampl
 		if (stageSize < minStageSize)
 			stageSize = minStageSize;
 
-		if(stageSize > UsbScanTransferOut::MAX_STAGE_SIZE)
-			stageSize = UsbScanTransferOut::MAX_STAGE_SIZE;
+		int maxStageSize = daqDev().scanTranserOut()->getMaxStageSize();
+
+		if(stageSize > maxStageSize)
+			stageSize = maxStageSize;
 	}
 
 	return stageSize;
@@ -323,8 +325,6 @@ unsigned int UsbDOutScan::processScanData(void* transfer, unsigned int stageSize
 
 unsigned int UsbDOutScan::processScanData16(libusb_transfer* transfer, unsigned int stageSize)
 {
-	UlLock lock(mProcessScanDataMutex);  // added the lock since mScanInfo.totalSampleTransferred is not updated atomically and is accessed from different thread when user invokes the getStatus function
-
 	int numOfSampleCopied = 0;
 	unsigned int actualStageSize = 0;
 	int requestSampleCount = stageSize / mScanInfo.sampleSize;
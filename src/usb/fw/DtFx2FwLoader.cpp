@@ -8,6 +8,7 @@
 #include <cstring>
 #include <stdlib.h>
 #include <algorithm>
+#include <vector>
 #include <unistd.h>
 
 
@@ -48,16 +49,19 @@ void DtFx2FwLoader::prepareHardware()
 
 	libusb_device** devs;
 	libusb_device* dev;
-	libusb_device_handle* 	devHandle;
 	int ret = 0;
-	bool fwloaded = false;
 
 	const libusb_context* ctx = UsbDaqDevice::getLibUsbContext();
 
 	if(ctx == NULL)
 		std::cout << "libusb_context is not initialized" << std::endl;
 
-	int numDevs = libusb_get_device_list ((libusb_context*) ctx, &devs);
+	// the re-enumeration of the devices is reported by the hotplug events
+	UsbDaqDevice::startHotplugMonitor();
+
+	std::vector<pthread_t> loaderThreads;
+
+	int numDevs = libusb_get_device_list ((libusb_context*)ctx, &devs);
 
 	if(numDevs > 0)
 	{
@@ -74,102 +78,82 @@ void DtFx2FwLoader::prepareHardware()
 				UL_LOG("failed to get device descriptor");
 			}
 
-			if(desc.idVendor == UsbDaqDevice::DT_USB_VID)
+			if(desc.idVendor == UsbDaqDevice::DT_USB_VID && desc.idProduct == DaqDeviceId::DT9837_ABC_LD)
 			{
-				if(desc.idProduct == DaqDeviceId::DT9837_ABC_LD)
-				{
-					int status = libusb_open(dev, &devHandle);
-
-					if (status == LIBUSB_SUCCESS)
-					{
-						status = libusb_claim_interface(devHandle, 0);
-
-						if (status == LIBUSB_SUCCESS)
-						{
-							DtFx2FwLoader::downloadFirmware(devHandle, desc.idProduct);
-
-							fwloaded = true;
-
-							libusb_release_interface(devHandle, 0);
-						}
-						else
-						{
-							UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
-						}
-
-
-						libusb_close(devHandle);
-					}
-				}
+				// each device is brought up by its own thread so the devices re-enumerate concurrently
+				libusb_device* loaderDev = libusb_ref_device(dev);
+				pthread_t thread;
+
+				if(pthread_create(&thread, NULL, &loaderThread, loaderDev) == 0)
+					loaderThreads.push_back(thread);
+				else
+					loaderThread(loaderDev);
 			}
 		}
 
+		libusb_free_device_list(devs, 1);
 	}
 
-	libusb_free_device_list(devs, 1);
-
-
-	if(fwloaded) // if fw is loaded to at least one device we need wait for the dev(s) to enumerate and load FPGA
-	{
-		sleep(5);
-
-		/*numDevs = libusb_get_device_list ((libusb_context*) ctx, &devs);
-
-		if(numDevs > 0)
-		{
-			int devNum = 0;
-			while ((dev = devs[devNum++]) != NULL)
-			{
-				struct libusb_device_descriptor desc;
-				memset(&desc, 0,sizeof(libusb_device_descriptor));
+	for(unsigned int i = 0; i < loaderThreads.size(); i++)
+		pthread_join(loaderThreads[i], NULL);
+}
 
-				ret = libusb_get_device_descriptor(dev, &desc);
+void* DtFx2FwLoader::loaderThread(void* arg)
+{
+	libusb_device* dev = (libusb_device*) arg;
 
-				if (ret < 0)
-				{
-					UL_LOG("failed to get device descriptor");
-				}
+	prepareDevice(dev);
 
-				if(desc.idVendor == UsbDaqDevice::DT_USB_VID)
-				{
-					if(desc.idProduct == DaqDeviceId::USB_QUAD08)
-					{
-						int status = libusb_open(dev, &devHandle);
+	libusb_unref_device(dev);
 
-						if (status == LIBUSB_SUCCESS)
-						{
-							status = libusb_claim_interface(devHandle, 0);
+	return NULL;
+}
 
+void DtFx2FwLoader::prepareDevice(libusb_device* dev)
+{
+	libusb_device_handle* devHandle;
+	bool fwloaded = false;
 
+	// the device comes back at the same port with a different product id once the firmware is loaded
+	std::string location = UsbDaqDevice::getDeviceLocation(dev);
 
-							if (status == LIBUSB_SUCCESS)
-							{
-								if(!isFpgaLoaded(devHandle))
-								{
-									downloadFpga(devHandle, desc.idProduct);
-								}
+	struct libusb_device_descriptor desc;
+	memset(&desc, 0,sizeof(libusb_device_descriptor));
+	libusb_get_device_descriptor(dev, &desc);
 
+	int status = libusb_open(dev, &devHandle);
 
+	if (status == LIBUSB_SUCCESS)
+	{
+		status = libusb_claim_interface(devHandle, 0);
 
-								libusb_release_interface(devHandle, 0);
-							}
-							else
-							{
-								UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
-							}
+		if (status == LIBUSB_SUCCESS)
+		{
+			UL_LOG("loading firmware of device at " << location);
 
+			DtFx2FwLoader::downloadFirmware(devHandle, desc.idProduct);
 
-							libusb_close(devHandle);
-						}
-					}
-				}
-			}
+			fwloaded = true;
 
+			libusb_release_interface(devHandle, 0);
+		}
+		else
+		{
+			UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
 		}
 
-		libusb_free_device_list(devs, 1);*/
+		libusb_close(devHandle);
 	}
 
+	if(fwloaded)
+	{
+		libusb_device* reenumDev = UsbDaqDevice::waitForReenumeration(location, UsbDaqDevice::DT_USB_VID, DaqDeviceId::DT9837_ABC_LD, REENUMERATION_TIMEOUT);
+
+		if(reenumDev)
+			libusb_unref_device(reenumDev);
+		else
+			UL_LOG("device at " << location << " did not re-enumerate");
+	}
 }
 
 int DtFx2FwLoader::downloadFirmware(libusb_device_handle* devHandle, unsigned int productId)
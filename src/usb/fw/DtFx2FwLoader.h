@@ -22,6 +22,8 @@ public:
 	static bool writeImage(libusb_device_handle* devHandle, int productId, bool firstTry);
 
 private:
+	static void* loaderThread(void* arg);
+	static void prepareDevice(libusb_device* dev);
 	static int downloadFirmware(libusb_device_handle* devHandle, unsigned int productId);
 	static int downloadIntelHex(libusb_device_handle* devHandle, PINTEL_HEX_RECORD hexRecord, unsigned short maxIntRam);
 	static int reset8051(libusb_device_handle* devHandle, unsigned char reset);
@@ -36,6 +38,10 @@ private:
 	//static bool isFpgaLoaded(libusb_device_handle* devHandle);
 	//static void readSerialNumber(libusb_device_handle* devHandle, libusb_device_descriptor descriptor, char* serialNum);
 	//static int test(libusb_device_handle* devHandle);
+
+private:
+	// ms to wait for a device to re-enumerate after its firmware is loaded
+	enum { REENUMERATION_TIMEOUT = 5000 };
 };
 
 } /* namespace ul */
@@ -0,0 +1,248 @@
+/*
+ * FpgaImage.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <string.h>
+#include <algorithm>
+
+#include "FpgaImage.h"
+#include "../../UlException.h"
+
+namespace ul
+{
+
+FpgaImage::FpgaImage()
+{
+	mSource = SOURCE_NONE;
+	mSize = 0;
+	mPos = 0;
+
+	mData = NULL;
+	mDataSize = 0;
+	mDataPos = 0;
+
+	mLiteralCount = 0;
+	mMatchCount = 0;
+	mMatchOffset = 0;
+	mMatchNibble = 0;
+	mMatchPending = false;
+	mWindow = NULL;
+
+	mReverseBits = false;
+}
+
+FpgaImage::~FpgaImage()
+{
+	close();
+}
+
+void FpgaImage::close()
+{
+	if(mWindow)
+	{
+		delete[] mWindow;
+		mWindow = NULL;
+	}
+
+	if(mFile.is_open())
+		mFile.close();
+
+	mSource = SOURCE_NONE;
+	mSize = 0;
+	mPos = 0;
+}
+
+void FpgaImage::openCompressed(const unsigned char* data, unsigned int dataSize, unsigned int size)
+{
+	close();
+
+	mSource = SOURCE_COMPRESSED;
+	mData = data;
+	mDataSize = dataSize;
+	mDataPos = 0;
+	mSize = size;
+
+	mLiteralCount = 0;
+	mMatchCount = 0;
+	mMatchPending = false;
+	mWindow = new unsigned char[WINDOW_SIZE];
+}
+
+void FpgaImage::openRaw(const unsigned char* data, unsigned int size)
+{
+	close();
+
+	mSource = SOURCE_RAW;
+	mData = data;
+	mSize = size;
+}
+
+bool FpgaImage::openFile(const std::string& path, bool reverseBits)
+{
+	close();
+
+	mFile.open(path.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+
+	if(!mFile)
+		return false;
+
+	std::ifstream::pos_type size = mFile.tellg();
+	mFile.seekg(0, std::ios::beg);
+
+	mSource = SOURCE_FILE;
+	mSize = size;
+	mReverseBits = reverseBits;
+
+	return true;
+}
+
+unsigned int FpgaImage::read(unsigned char* buffer, unsigned int count)
+{
+	count = std::min(count, remaining());
+
+	if(count == 0)
+		return 0;
+
+	switch(mSource)
+	{
+	case SOURCE_RAW:
+		memcpy(buffer, mData + mPos, count);
+		break;
+
+	case SOURCE_COMPRESSED:
+		count = decompress(buffer, count);
+		break;
+
+	case SOURCE_FILE:
+		mFile.read((char*) buffer, count);
+
+		if(!mFile)
+			throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
+
+		if(mReverseBits)
+			reverseBits(buffer, count);
+		break;
+
+	default:
+		return 0;
+	}
+
+	mPos += count;
+
+	return count;
+}
+
+void FpgaImage::skip(unsigned int count)
+{
+	unsigned char buffer[256];
+
+	while(count > 0)
+	{
+		unsigned int len = read(buffer, std::min(count, (unsigned int) sizeof(buffer)));
+
+		if(len == 0)
+			break;
+
+		count -= len;
+	}
+}
+
+unsigned int FpgaImage::readLength(unsigned int nibble)
+{
+	unsigned int length = nibble;
+
+	if(nibble == 15)
+	{
+		unsigned char byte;
+
+		do
+		{
+			if(mDataPos >= mDataSize)
+				throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
+
+			byte = mData[mDataPos++];
+			length += byte;
+		}
+		while(byte == 255);
+	}
+
+	return length;
+}
+
+unsigned int FpgaImage::decompress(unsigned char* buffer, unsigned int count)
+{
+	unsigned int outPos = mPos;
+	unsigned int copied = 0;
+
+	while(copied < count)
+	{
+		unsigned char byte;
+
+		if(mLiteralCount)
+		{
+			if(mDataPos >= mDataSize)
+				throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
+
+			byte = mData[mDataPos++];
+			mLiteralCount--;
+		}
+		else if(mMatchCount)
+		{
+			byte = mWindow[(outPos - mMatchOffset) & (WINDOW_SIZE - 1)];
+			mMatchCount--;
+		}
+		else if(mMatchPending)
+		{
+			mMatchPending = false;
+
+			if(mDataPos + 2 > mDataSize)
+				throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
+
+			mMatchOffset = mData[mDataPos] | (mData[mDataPos + 1] << 8);
+			mDataPos += 2;
+
+			if(mMatchOffset == 0 || mMatchOffset >= WINDOW_SIZE || mMatchOffset > outPos)
+				throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
+
+			mMatchCount = readLength(mMatchNibble) + 4;
+			continue;
+		}
+		else
+		{
+			if(mDataPos >= mDataSize)
+				throw UlException(ERR_UNABLE_TO_READ_FPGA_FILE);
+
+			unsigned char token = mData[mDataPos++];
+
+			mLiteralCount = readLength(token >> 4);
+			mMatchNibble = token & 0x0f;
+
+			// the last sequence has no match, it is never read past because the size of the image is known
+			mMatchPending = true;
+			continue;
+		}
+
+		mWindow[outPos & (WINDOW_SIZE - 1)] = byte;
+		buffer[copied++] = byte;
+		outPos++;
+	}
+
+	return copied;
+}
+
+void FpgaImage::reverseBits(unsigned char* buffer, unsigned int count)
+{
+	for(unsigned int index = 0; index < count; index++)
+	{
+		if(buffer[index] != 0)
+		{
+			buffer[index] = (buffer[index] & 0x0f) <<  4  |  (buffer[index] & 0xf0) >>  4;
+			buffer[index] = (buffer[index] & 0x33) <<  2  |  (buffer[index] & 0xcc) >>  2;
+			buffer[index] = (buffer[index] & 0x55) <<  1  |  (buffer[index] & 0xaa) >>  1;
+		}
+	}
+}
+
+} /* namespace ul */
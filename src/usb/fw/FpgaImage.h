@@ -0,0 +1,82 @@
+/*
+ * FpgaImage.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef USB_FW_FPGAIMAGE_H_
+#define USB_FW_FPGAIMAGE_H_
+
+#include <fstream>
+#include <string>
+
+#include "../../ul_internal.h"
+
+namespace ul
+{
+
+// sequential reader of an FPGA image. The images built into the library are compressed by fpga2c.py and are
+// decompressed while they are read, so an image is never held in memory in full. Images that are loaded from a
+// file are read in the same chunks the device is sent.
+//
+// Compressed images are a series of sequences, each sequence is:
+//   token       high nibble is the literal count, low nibble is the match length - 4
+//   [count]     if a nibble is 15, bytes added to it until a byte other than 255
+//   literals
+//   offset      2 bytes, little endian, distance of the match (1 to WINDOW_SIZE - 1) back in the output
+//   [length]    extension of the match length as for the literal count
+// the last sequence of an image ends after its literals
+class UL_LOCAL FpgaImage
+{
+public:
+	FpgaImage();
+	~FpgaImage();
+
+	// embedded image compressed by fpga2c.py, size is the decompressed size
+	void openCompressed(const unsigned char* data, unsigned int dataSize, unsigned int size);
+	// embedded image stored as is
+	void openRaw(const unsigned char* data, unsigned int size);
+	// image file, the bits of every byte are reversed while it is read if reverseBits is set
+	bool openFile(const std::string& path, bool reverseBits);
+
+	unsigned int size() const { return mSize;}
+	unsigned int remaining() const { return mSize - mPos;}
+
+	// returns the number of bytes copied to buffer, 0 at the end of the image
+	unsigned int read(unsigned char* buffer, unsigned int count);
+	void skip(unsigned int count);
+
+	static void reverseBits(unsigned char* buffer, unsigned int count);
+
+private:
+	unsigned int decompress(unsigned char* buffer, unsigned int count);
+	unsigned int readLength(unsigned int nibble);
+	void close();
+
+private:
+	enum { SOURCE_NONE, SOURCE_RAW, SOURCE_COMPRESSED, SOURCE_FILE };
+	enum { WINDOW_SIZE = 4096 };
+
+	int mSource;
+	unsigned int mSize;
+	unsigned int mPos;
+
+	const unsigned char* mData;
+	unsigned int mDataSize;
+	unsigned int mDataPos;
+
+	// state of the sequence being decompressed
+	unsigned int mLiteralCount;
+	unsigned int mMatchCount;
+	unsigned int mMatchOffset;
+	unsigned int mMatchNibble;
+	bool mMatchPending;
+	unsigned char* mWindow;
+
+	std::ifstream mFile;
+	bool mReverseBits;
+};
+
+} /* namespace ul */
+
+#endif /* USB_FW_FPGAIMAGE_H_ */
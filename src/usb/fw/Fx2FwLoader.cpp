@@ -7,6 +7,7 @@
 #include <cstring>
 #include <stdlib.h>
 #include <algorithm>
+#include <vector>
 #include <unistd.h>
 
 
@@ -16,6 +17,7 @@
 #include "../../utility/FnLog.h"
 #include "../../utility/UlLock.h"
 #include "../../utility/Endian.h"
+#include "../../UlException.h"
 
 #include "Fx2FwLoader.h"
 
@@ -45,15 +47,18 @@ void Fx2FwLoader::prepareHardware()
 
 	libusb_device** devs;
 	libusb_device* dev;
-	libusb_device_handle* 	devHandle;
 	int ret = 0;
-	bool fwloaded = false;
 
 	const libusb_context* ctx = UsbDaqDevice::getLibUsbContext();
 
 	if(ctx == NULL)
 		std::cout << "libusb_context is not initialized" << std::endl;
 
+	// the re-enumeration of the devices is reported by the hotplug events
+	UsbDaqDevice::startHotplugMonitor();
+
+	std::vector<pthread_t> loaderThreads;
+
 	int numDevs = libusb_get_device_list ((libusb_context*)ctx, &devs);
 
 	if(numDevs > 0)
@@ -71,106 +76,111 @@ void Fx2FwLoader::prepareHardware()
 				UL_LOG("failed to get device descriptor");
 			}
 
-			if(desc.idVendor == UsbDaqDevice::MCC_USB_VID)
+			if(desc.idVendor == UsbDaqDevice::MCC_USB_VID && desc.idProduct == DaqDeviceId::PDAQ3KLD)
 			{
-				if(desc.idProduct == DaqDeviceId::PDAQ3KLD)
-				{
-					int status = libusb_open(dev, &devHandle);
+				// each device is brought up by its own thread so the devices re-enumerate concurrently
+				libusb_device* loaderDev = libusb_ref_device(dev);
+				pthread_t thread;
+
+				if(pthread_create(&thread, NULL, &loaderThread, loaderDev) == 0)
+					loaderThreads.push_back(thread);
+				else
+					loaderThread(loaderDev);
+			}
+		}
 
-					if (status == LIBUSB_SUCCESS)
-					{
-						status = libusb_claim_interface(devHandle, 0);
+		libusb_free_device_list(devs, 1);
+	}
 
-						if (status == LIBUSB_SUCCESS)
-						{
-							Fx2FwLoader::downloadFirmware(devHandle);
+	for(unsigned int i = 0; i < loaderThreads.size(); i++)
+		pthread_join(loaderThreads[i], NULL);
+}
 
-							fwloaded = true;
+void* Fx2FwLoader::loaderThread(void* arg)
+{
+	libusb_device* dev = (libusb_device*) arg;
 
-							libusb_release_interface(devHandle, 0);
-						}
-						else
-						{
-							UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
-						}
+	prepareDevice(dev);
 
+	libusb_unref_device(dev);
 
-						libusb_close(devHandle);
-					}
-				}
-			}
-		}
+	return NULL;
+}
 
-	}
+void Fx2FwLoader::prepareDevice(libusb_device* dev)
+{
+	libusb_device_handle* devHandle;
+	bool fwloaded = false;
 
-	libusb_free_device_list(devs, 1);
+	// the device comes back at the same port with a different product id once the firmware is loaded
+	std::string location = UsbDaqDevice::getDeviceLocation(dev);
 
+	int status = libusb_open(dev, &devHandle);
 
-	if(fwloaded) // if fw is loaded to at least one device we need wait for the dev(s) to enumerate and load FPGA
+	if (status == LIBUSB_SUCCESS)
 	{
-		sleep(5);
-
-		numDevs = libusb_get_device_list ((libusb_context*)ctx, &devs);
+		status = libusb_claim_interface(devHandle, 0);
 
-		if(numDevs > 0)
+		if (status == LIBUSB_SUCCESS)
 		{
-			int devNum = 0;
-			while ((dev = devs[devNum++]) != NULL)
-			{
-				struct libusb_device_descriptor desc;
-				memset(&desc, 0,sizeof(libusb_device_descriptor));
+			UL_LOG("loading firmware of device at " << location);
 
-				ret = libusb_get_device_descriptor(dev, &desc);
+			Fx2FwLoader::downloadFirmware(devHandle);
 
-				if (ret < 0)
-				{
-					UL_LOG("failed to get device descriptor");
-				}
+			fwloaded = true;
 
-				if(desc.idVendor == UsbDaqDevice::MCC_USB_VID)
-				{
-					if(desc.idProduct == DaqDeviceId::USB_QUAD08)
-					{
-						int status = libusb_open(dev, &devHandle);
+			libusb_release_interface(devHandle, 0);
+		}
+		else
+		{
+			UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
+		}
 
-						if (status == LIBUSB_SUCCESS)
-						{
-							status = libusb_claim_interface(devHandle, 0);
+		libusb_close(devHandle);
+	}
 
-							/*unsigned char buff[2];
-							int recevied = 0;
-							query(devHandle, VR_FPGA_REGIO, 0, 0x5f, buff, sizeof(buff), &recevied, 1000);*/
+	if(fwloaded)
+	{
+		libusb_device* reenumDev = UsbDaqDevice::waitForReenumeration(location, UsbDaqDevice::MCC_USB_VID, DaqDeviceId::PDAQ3KLD, REENUMERATION_TIMEOUT);
 
-							if (status == LIBUSB_SUCCESS)
-							{
-								if(!isFpgaLoaded(devHandle))
-								{
-									downloadFpga(devHandle, desc.idProduct);
-								}
+		if(reenumDev)
+		{
+			struct libusb_device_descriptor desc;
+			memset(&desc, 0,sizeof(libusb_device_descriptor));
 
-								/*unsigned char buff[2];
-								int recevied = 0;
-								query(devHandle, VR_FPGA_REGIO, 0, 0x5f, buff, sizeof(buff), &recevied, 1000);*/
+			if(libusb_get_device_descriptor(reenumDev, &desc) == LIBUSB_SUCCESS && desc.idProduct == DaqDeviceId::USB_QUAD08)
+			{
+				status = libusb_open(reenumDev, &devHandle);
 
-								libusb_release_interface(devHandle, 0);
-							}
-							else
-							{
-								UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
-							}
+				if (status == LIBUSB_SUCCESS)
+				{
+					status = libusb_claim_interface(devHandle, 0);
 
+					if (status == LIBUSB_SUCCESS)
+					{
+						if(!isFpgaLoaded(devHandle))
+						{
+							UL_LOG("loading FPGA of device at " << location);
 
-							libusb_close(devHandle);
+							downloadFpga(devHandle, desc.idProduct);
 						}
+
+						libusb_release_interface(devHandle, 0);
+					}
+					else
+					{
+						UL_LOG("libusb_claim_interface() failed: " << libusb_error_name(status));
 					}
+
+					libusb_close(devHandle);
 				}
 			}
 
+			libusb_unref_device(reenumDev);
 		}
-
-		libusb_free_device_list(devs, 1);
+		else
+			UL_LOG("device at " << location << " did not re-enumerate");
 	}
-
 }
 
 int Fx2FwLoader::downloadFirmware(libusb_device_handle* devHandle)
@@ -255,15 +265,13 @@ int Fx2FwLoader::downloadFpga(libusb_device_handle* devHandle, unsigned short pr
 {
 	int status = 0;
 
-	unsigned char* image;
-	unsigned int imageSize;
+	FpgaImage fpgaImage;
 	unsigned int imageStart;
 	unsigned short imageIndex;
 
 	if(productId == DaqDeviceId::USB_QUAD08)
 	{
-		image = (unsigned char*) USBQuad06Fpga;
-		imageSize = sizeof(USBQuad06Fpga);
+		fpgaImage.openCompressed(USBQuad06Fpga_lz, USBQuad06Fpga_lz_len, USBQuad06Fpga_len);
 		imageStart = 0x4E;
 		imageIndex = 0;
 	}
@@ -273,29 +281,33 @@ int Fx2FwLoader::downloadFpga(libusb_device_handle* devHandle, unsigned short pr
 		return status;
 	}
 
-	downloadFpgaImage(devHandle, imageIndex, &image[imageStart], imageSize - imageStart);
+	try
+	{
+		fpgaImage.skip(imageStart);
+
+		downloadFpgaImage(devHandle, imageIndex, fpgaImage);
+	}
+	catch(UlException& e)
+	{
+		UL_LOG("#### reading the fpga image failed: " << e.getError());
+	}
 
 	return status;
 }
 
-int Fx2FwLoader::downloadFpgaImage(libusb_device_handle* devHandle, unsigned short nImage, unsigned char* pFpga, unsigned int FpgaLen)
+int Fx2FwLoader::downloadFpgaImage(libusb_device_handle* devHandle, unsigned short nImage, FpgaImage& fpgaImage)
 {
 	int status = 0;
-	unsigned char* ptr = pFpga;
+	unsigned char buffer[2048];
 
 	int sent = 0;
 
 	status = send(devHandle, VR_FPGA_INIT, 0, nImage, NULL, 0, &sent, 2000);
 
 	unsigned int writeSize;
-	while( status >= 0 && FpgaLen )
+	while( status >= 0 && (writeSize = fpgaImage.read(buffer, sizeof(buffer))) > 0 )
 	{
-		writeSize = ((FpgaLen > 2048) ? 2048 : FpgaLen);
-
-		status = send(devHandle, VR_FPGA_DOWNLOAD, 0, nImage, ptr, writeSize, &sent, 2000);
-
-		ptr += writeSize;
-		FpgaLen -= writeSize;
+		status = send(devHandle, VR_FPGA_DOWNLOAD, 0, nImage, buffer, writeSize, &sent, 2000);
 	}
 
 	if(!isFpgaLoaded(devHandle))
@@ -8,10 +8,13 @@
 #define USB_FW_FX2FWLOADER_H_
 
 #include "IntelHexRec.h"
+#include "FpgaImage.h"
 
 extern INTEL_HEX_RECORD FX2LDR_FW_Image[];
 extern INTEL_HEX_RECORD PDAQ3K_FW_Image[];
-extern char USBQuad06Fpga[212488];
+extern const unsigned char USBQuad06Fpga_lz[];
+extern const unsigned int USBQuad06Fpga_lz_len;
+extern const unsigned int USBQuad06Fpga_len;
 
 namespace ul
 {
@@ -23,12 +26,14 @@ public:
 	static bool writeImage(libusb_device_handle* devHandle, int productId, bool firstTry);
 
 private:
+	static void* loaderThread(void* arg);
+	static void prepareDevice(libusb_device* dev);
 	static int downloadFirmware(libusb_device_handle* devHandle);
 	static int downloadIntelHex(libusb_device_handle* devHandle, PINTEL_HEX_RECORD hexRecord, unsigned short maxIntRam);
 	static int reset8051(libusb_device_handle* devHandle, unsigned char reset);
 
 	static int downloadFpga(libusb_device_handle* devHandle, unsigned short productId);
-	static int downloadFpgaImage(libusb_device_handle* devHandle, unsigned short nImage, unsigned char* pFpga, unsigned int FpgaLen);
+	static int downloadFpgaImage(libusb_device_handle* devHandle, unsigned short nImage, FpgaImage& fpgaImage);
 
 	static int send(libusb_device_handle* devHandle, uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen, int* sent, unsigned int timeout);
 	static int query(libusb_device_handle* devHandle, uint8_t request, uint16_t wValue, uint16_t wIndex, unsigned char* buff, uint16_t buffLen, int* received, unsigned int timeout);
@@ -37,6 +42,10 @@ private:
 	static bool isFpgaLoaded(libusb_device_handle* devHandle);
 	//static void readSerialNumber(libusb_device_handle* devHandle, libusb_device_descriptor descriptor, char* serialNum);
 	//static int test(libusb_device_handle* devHandle);
+
+private:
+	// ms to wait for a device to re-enumerate after its firmware is loaded
+	enum { REENUMERATION_TIMEOUT = 5000 };
 };
 
 } /* namespace ul */
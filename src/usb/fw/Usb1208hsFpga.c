@@ -1,1595 +1,1284 @@
 ///////////////////////////////////////////////////////////////////
 //
-// Usb1208hsFpga.h
-// - created using the xxd command of Debian based systems
+// Usb1208hsFpga.c
+// - created using fpga2c.py
 // - created from 'USB_1208HS.rbf'
-// - xxd -i USB_1208HS.rbf > Usb1208hsFpga.c
+// - python3 fpga2c.py USB_1208HS_rbf USB_1208HS.rbf
 //
 ///////////////////////////////////////////////////////////////////
 
-const unsigned char USB_1208HS_rbf[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x6a, 0xde, 0xff, 0x7f, 0x00, 0xe8, 0xd5, 0x08,
-  0x00, 0x6a, 0xde, 0xff, 0x7f, 0x00, 0xe8, 0xd5, 0x08, 0x00, 0x6a, 0xde,
-  0xff, 0x7f, 0x00, 0xe8, 0xd5, 0x08, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x44, 0x55, 0x54, 0x44, 0x55, 0x55, 0x74, 0x75, 0x57, 0x77, 0x75, 0x57,
-  0x77, 0x75, 0x57, 0x77, 0x75, 0x57, 0x77, 0x65, 0x56, 0x66, 0x65, 0x56,
-  0x36, 0x25, 0x52, 0x32, 0x35, 0xd2, 0xa3, 0x79, 0xd2, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22,
-  0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x11, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x00, 0x1a, 0xa1, 0x11, 0x2f,
-  0x21, 0xf1, 0x12, 0x12, 0x25, 0x52, 0x22, 0x00, 0x00, 0x25, 0x52, 0x22,
-  0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25,
-  0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25,
-  0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x2f, 0x21, 0xf1, 0x12, 0x12, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x25, 0x52,
-  0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x2f, 0x21,
-  0xf1, 0x12, 0x12, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x25, 0x52, 0x22, 0x25,
-  0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x25,
-  0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x1a, 0xa1, 0x11, 0x00, 0x00, 0x25,
-  0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x25,
-  0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25,
-  0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x2f, 0x21, 0xf1, 0x12, 0x12, 0xef, 0xed, 0xfd, 0xde, 0xde, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52,
-  0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22,
-  0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22,
-  0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x25, 0x52,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x4f,
-  0x44, 0xf4, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x45, 0x54, 0x44, 0x45,
-  0x54, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44,
-  0x44, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x6f, 0x64, 0xf4, 0x46, 0x46,
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84, 0x6f, 0x69, 0xf9,
-  0x96, 0x96, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x00, 0x8a, 0xa8, 0x88,
-  0x4f, 0x44, 0xf4, 0x44, 0x44, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x00, 0x00,
-  0x00, 0x00, 0x4a, 0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x4f, 0x48, 0xf8, 0x84,
-  0x84, 0x25, 0x52, 0x22, 0x00, 0x4a, 0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x6f,
-  0x6c, 0xfc, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0x88, 0x2f,
-  0x29, 0xf9, 0x92, 0x92, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x25, 0x52, 0x22,
-  0x00, 0x8a, 0xa8, 0x88, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x6f, 0x65, 0xf5,
-  0x56, 0x56, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x00, 0x00, 0x4f, 0x44,
-  0xf4, 0x44, 0x44, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x8a, 0xa8, 0x88, 0x2f,
-  0x21, 0xf1, 0x12, 0x12, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0xcf, 0xcf,
-  0xff, 0xfc, 0xfc, 0xdf, 0xd8, 0xf8, 0x8d, 0x8d, 0x00, 0x4f, 0x44, 0xf4,
-  0x44, 0x44, 0x6f, 0x6d, 0xfd, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x8f,
-  0x8c, 0xfc, 0xc8, 0xc8, 0xaf, 0xac, 0xfc, 0xca, 0xca, 0x25, 0x52, 0x22,
-  0x00, 0x00, 0x8a, 0xa8, 0x88, 0xc5, 0x5c, 0xcc, 0xc5, 0x5c, 0xcc, 0x00,
-  0x00, 0x00, 0x00, 0x45, 0x54, 0x44, 0x45, 0x54, 0x44, 0x8f, 0x8c, 0xfc,
-  0xc8, 0xc8, 0x25, 0x52, 0x22, 0x00, 0x45, 0x54, 0x44, 0x45, 0x54, 0x44,
-  0xef, 0xec, 0xfc, 0xce, 0xce, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcc, 0xfc,
-  0xcc, 0xcc, 0xcf, 0xcc, 0xfc, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xc5,
-  0x5c, 0xcc, 0xe5, 0x5e, 0xee, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x52, 0x22, 0xef, 0xec, 0xfc, 0xce, 0xce, 0x00, 0x00, 0x25, 0x52,
-  0x22, 0x25, 0x52, 0x22, 0xef, 0xec, 0xfc, 0xce, 0xce, 0x00, 0x00, 0x00,
-  0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0x00,
-  0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xef, 0xe4, 0xf4, 0x4e,
-  0x4e, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44, 0x2f, 0x24,
-  0xf4, 0x42, 0x42, 0xef, 0xe8, 0xf8, 0x8e, 0x8e, 0x00, 0x00, 0x2f, 0x24,
-  0xf4, 0x42, 0x42, 0x2f, 0x24, 0xf4, 0x42, 0x42, 0xef, 0xec, 0xfc, 0xce,
-  0xce, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xcf, 0xc8,
-  0xf8, 0x8c, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44, 0x2f, 0x24,
-  0xf4, 0x42, 0x42, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44,
-  0x2f, 0x24, 0xf4, 0x42, 0x42, 0x6f, 0x68, 0xf8, 0x86, 0x86, 0x00, 0x00,
-  0x2f, 0x24, 0xf4, 0x42, 0x42, 0x2f, 0x24, 0xf4, 0x42, 0x42, 0x6f, 0x6c,
-  0xfc, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c,
-  0xcf, 0xcb, 0xfb, 0xbc, 0xbc, 0x3a, 0xa3, 0x33, 0x00, 0x00, 0x00, 0x8f,
-  0x84, 0xf4, 0x48, 0x48, 0xaf, 0xa5, 0xf5, 0x5a, 0x5a, 0x2f, 0x21, 0xf1,
-  0x12, 0x12, 0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44, 0x2f, 0x24, 0xf4, 0x42,
-  0x42, 0xef, 0xe8, 0xf8, 0x8e, 0x8e, 0x3a, 0xa3, 0x33, 0x00, 0x2f, 0x25,
-  0xf5, 0x52, 0x52, 0x9f, 0x9c, 0xfc, 0xc9, 0xc9, 0x00, 0x2f, 0x24, 0xf4,
-  0x42, 0x42, 0x2f, 0x24, 0xf4, 0x42, 0x42, 0xef, 0xef, 0xff, 0xfe, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0x88, 0xba, 0xab, 0xbb, 0x3a, 0xa3,
-  0x33, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xef, 0xe5, 0xf5,
-  0x5e, 0x5e, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x00, 0x00, 0xcf, 0xc4,
-  0xf4, 0x4c, 0x4c, 0xef, 0xe4, 0xf4, 0x4e, 0x4e, 0x2f, 0x28, 0xf8, 0x82,
-  0x82, 0x1a, 0xa1, 0x11, 0x00, 0xef, 0xe4, 0xf4, 0x4e, 0x4e, 0xef, 0xe4,
-  0xf4, 0x4e, 0x4e, 0xef, 0xed, 0xfd, 0xde, 0xde, 0x00, 0x00, 0x00, 0x00,
-  0x4a, 0xa4, 0x44, 0x1f, 0x14, 0xf4, 0x41, 0x41, 0x15, 0x51, 0x11, 0x00,
-  0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xef, 0xeb, 0xfb, 0xbe, 0xbe,
-  0x2f, 0x23, 0xf3, 0x32, 0x32, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c,
-  0x8c, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0x2f, 0x27, 0xf7, 0x72, 0x72, 0x00,
-  0x00, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0xef,
-  0xef, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x84, 0xf4, 0x48,
-  0x48, 0x9f, 0x94, 0xf4, 0x49, 0x49, 0x15, 0x51, 0x11, 0x00, 0x00, 0x00,
-  0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xff, 0xfa, 0xfa, 0xaf, 0xaf, 0x3f, 0x32,
-  0xf2, 0x23, 0x23, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84, 0x6f,
-  0x6a, 0xfa, 0xa6, 0xa6, 0xaf, 0xa6, 0xf6, 0x6a, 0x6a, 0x15, 0x51, 0x11,
-  0x00, 0x6f, 0x6a, 0xfa, 0xa6, 0xa6, 0x6f, 0x6a, 0xfa, 0xa6, 0xa6, 0xff,
-  0xfe, 0xfe, 0xef, 0xef, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c,
-  0x4c, 0xff, 0xf4, 0xf4, 0x4f, 0x4f, 0x35, 0x53, 0x33, 0x00, 0x00, 0x00,
-  0x8a, 0xa8, 0x88, 0x1f, 0x1b, 0xfb, 0xb1, 0xb1, 0x1f, 0x13, 0xf3, 0x31,
-  0x31, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0x88, 0xba, 0xab, 0xbb, 0x4f, 0x47,
-  0xf7, 0x74, 0x74, 0x35, 0x53, 0x33, 0x00, 0xba, 0xab, 0xbb, 0xba, 0xab,
-  0xbb, 0x7f, 0x7f, 0xff, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x45, 0x54,
-  0x44, 0x4f, 0x42, 0xf2, 0x24, 0x24, 0x2a, 0xa2, 0x22, 0x00, 0x00, 0x00,
-  0x8f, 0x8c, 0xfc, 0xc8, 0xc8, 0xbf, 0xbd, 0xfd, 0xdb, 0xdb, 0x3f, 0x31,
-  0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0x8f, 0x8c, 0xfc, 0xc8, 0xc8, 0xbf,
-  0xbd, 0xfd, 0xdb, 0xdb, 0x7f, 0x71, 0xf1, 0x17, 0x17, 0x00, 0x9a, 0xa9,
-  0x99, 0x3f, 0x3d, 0xfd, 0xd3, 0xd3, 0x00, 0x00, 0xbf, 0xbd, 0xfd, 0xdb,
-  0xdb, 0xbf, 0xbd, 0xfd, 0xdb, 0xdb, 0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x00,
-  0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44, 0x6a, 0xa6, 0x66, 0x2a, 0xa2, 0x22,
-  0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xff, 0xf9, 0xf9, 0x9f,
-  0x9f, 0x3f, 0x31, 0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8,
-  0x8c, 0x8c, 0xff, 0xf9, 0xf9, 0x9f, 0x9f, 0x3f, 0x35, 0xf5, 0x53, 0x53,
-  0x00, 0x00, 0xff, 0xf9, 0xf9, 0x9f, 0x9f, 0xff, 0xf9, 0xf9, 0x9f, 0x9f,
-  0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4,
-  0x4c, 0x4c, 0xcf, 0xc6, 0xf6, 0x6c, 0x6c, 0x2a, 0xa2, 0x22, 0x00, 0x00,
-  0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0xbf, 0xb9, 0xf9, 0x9b, 0x9b, 0x3f,
-  0x31, 0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0x88, 0x3f, 0x39,
-  0xf9, 0x93, 0x93, 0xff, 0xf5, 0xf5, 0x5f, 0x5f, 0x00, 0x00, 0x3f, 0x39,
-  0xf9, 0x93, 0x93, 0x3f, 0x39, 0xf9, 0x93, 0x93, 0xff, 0xfd, 0xfd, 0xdf,
-  0xdf, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84, 0x6f, 0x68,
-  0xf8, 0x86, 0x86, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x8f, 0x84, 0xf4,
-  0x48, 0x48, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0x1f, 0x13, 0xf3, 0x31, 0x31,
-  0x00, 0x00, 0x00, 0x8f, 0x84, 0xf4, 0x48, 0x48, 0x9f, 0x97, 0xf7, 0x79,
-  0x79, 0x5f, 0x5b, 0xfb, 0xb5, 0xb5, 0x25, 0x52, 0x22, 0x00, 0x9f, 0x97,
-  0xf7, 0x79, 0x79, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84, 0x4f, 0x48,
-  0xf8, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x84, 0xf4, 0x48, 0x48,
-  0x9f, 0x97, 0xf7, 0x79, 0x79, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00,
-  0x00, 0x8f, 0x84, 0xf4, 0x48, 0x48, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0x5f,
-  0x5b, 0xfb, 0xb5, 0xb5, 0x00, 0x00, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0x9f,
-  0x97, 0xf7, 0x79, 0x79, 0xdf, 0xdf, 0xff, 0xfd, 0xfd, 0x00, 0x00, 0x00,
-  0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84, 0x6f, 0x68, 0xf8, 0x86, 0x86, 0x25,
-  0x52, 0x22, 0x00, 0x00, 0x00, 0x8f, 0x84, 0xf4, 0x48, 0x48, 0x9f, 0x97,
-  0xf7, 0x79, 0x79, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x8f,
-  0x84, 0xf4, 0x48, 0x48, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0x5f, 0x5b, 0xfb,
-  0xb5, 0xb5, 0xef, 0xea, 0xfa, 0xae, 0xae, 0x9a, 0xa9, 0x99, 0x00, 0x00,
-  0x00, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0x9f, 0x97, 0xf7, 0x79, 0x79, 0xdf,
-  0xdf, 0xff, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44,
-  0x44, 0x5f, 0x55, 0xf5, 0x55, 0x55, 0x1f, 0x11, 0xf1, 0x11, 0x11, 0x00,
-  0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x9f, 0x9b, 0xfb, 0xb9, 0xb9,
-  0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88,
-  0x88, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x4f, 0x46, 0xf6, 0x64, 0x64, 0x1f,
-  0x11, 0xf1, 0x11, 0x11, 0x00, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x8f, 0x8a,
-  0xfa, 0xa8, 0xa8, 0xdf, 0xdf, 0xff, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00,
-  0x4f, 0x44, 0xf4, 0x44, 0x44, 0x5f, 0x55, 0xf5, 0x55, 0x55, 0x1f, 0x11,
-  0xf1, 0x11, 0x11, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x9f,
-  0x9b, 0xfb, 0xb9, 0xb9, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00,
-  0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x4f, 0x46,
-  0xf6, 0x64, 0x64, 0x1f, 0x11, 0xf1, 0x11, 0x11, 0x00, 0x8f, 0x8a, 0xfa,
-  0xa8, 0xa8, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0xdf, 0xdf, 0xff, 0xfd, 0xfd,
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x5f, 0x57, 0xf7,
-  0x75, 0x75, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x8f, 0x88,
-  0xf8, 0x88, 0x88, 0x9f, 0x99, 0xf9, 0x99, 0x99, 0x1f, 0x11, 0xf1, 0x11,
-  0x11, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x88, 0xf8,
-  0x88, 0x88, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x1f, 0x11, 0xf1, 0x11, 0x11,
-  0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0xdf,
-  0xdd, 0xfd, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44,
-  0x44, 0x5f, 0x57, 0xf7, 0x75, 0x75, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00,
-  0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x9f, 0x99, 0xf9, 0x99, 0x99,
-  0x1f, 0x11, 0xf1, 0x11, 0x11, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88,
-  0x88, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x1f,
-  0x11, 0xf1, 0x11, 0x11, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x88,
-  0xf8, 0x88, 0x88, 0xdf, 0xdd, 0xfd, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xf9, 0xf9, 0x9f, 0x9f, 0xbf, 0xb6, 0xf6, 0x6b, 0x6b,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x4b, 0x80, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x80, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x4f, 0xee, 0x03, 0x48, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0xb3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x28, 0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x40, 0x01, 0x28, 0x00, 0x48,
-  0x40, 0x01, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x48, 0x00, 0x00, 0x10,
-  0x82, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x21, 0x48, 0x00, 0x00,
-  0x10, 0xf2, 0xba, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x80, 0x84, 0x01,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x40,
-  0x01, 0x40, 0x11, 0x02, 0x50, 0x12, 0x00, 0x14, 0x00, 0x40, 0x01, 0x28,
-  0x14, 0x00, 0x40, 0x81, 0x88, 0x42, 0x01, 0x00, 0x80, 0x88, 0x02, 0x00,
-  0x00, 0x6f, 0xf7, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x29, 0x21, 0x01, 0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00,
-  0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x80, 0x02, 0xf0, 0xd3, 0x3b, 0x80, 0x84, 0x41, 0x01, 0x28, 0x00, 0x48,
-  0x40, 0x81, 0xa1, 0x21, 0x10, 0x82, 0x04, 0x16, 0x21, 0x81, 0x02, 0x21,
+const unsigned char USB_1208HS_rbf_lz[] = {
+  0x1b, 0xff, 0x01, 0x00, 0x9e, 0x6a, 0xde, 0xff, 0x7f, 0x00, 0xe8, 0xd5,
+  0x08, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0x05,
+  0xa5, 0x44, 0x55, 0x54, 0x44, 0x55, 0x55, 0x74, 0x75, 0x57, 0x77, 0x03,
+  0x00, 0xff, 0x02, 0x65, 0x56, 0x66, 0x65, 0x56, 0x36, 0x25, 0x52, 0x32,
+  0x35, 0xd2, 0xa3, 0x79, 0xd2, 0x51, 0x11, 0x15, 0x03, 0x00, 0x25, 0x1e,
+  0x00, 0x01, 0x00, 0x32, 0x25, 0x52, 0x22, 0x03, 0x00, 0x03, 0x0a, 0x00,
+  0x01, 0x15, 0x00, 0x60, 0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x11, 0x12, 0x00,
+  0x0d, 0x30, 0x00, 0x01, 0x15, 0x00, 0x81, 0x1a, 0xa1, 0x11, 0x2f, 0x21,
+  0xf1, 0x12, 0x12, 0x21, 0x00, 0x02, 0x26, 0x00, 0x04, 0x0b, 0x00, 0x0f,
+  0x03, 0x00, 0x02, 0x00, 0x38, 0x00, 0x01, 0x31, 0x00, 0x04, 0x36, 0x00,
+  0x05, 0x03, 0x00, 0x0c, 0x16, 0x00, 0x05, 0x2a, 0x00, 0x03, 0x0f, 0x00,
+  0x00, 0x87, 0x00, 0x07, 0xa4, 0x00, 0x04, 0x0c, 0x00, 0x08, 0x09, 0x00,
+  0x03, 0x7c, 0x00, 0x01, 0x36, 0x00, 0x5b, 0xef, 0xed, 0xfd, 0xde, 0xde,
+  0xb1, 0x00, 0x0a, 0x01, 0x00, 0x03, 0x34, 0x00, 0x04, 0x3e, 0x00, 0x0f,
+  0xaf, 0x00, 0x02, 0x03, 0x1d, 0x00, 0x04, 0x5f, 0x00, 0x51, 0x4f, 0x44,
+  0xf4, 0x44, 0x44, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x45, 0x54, 0x44,
+  0x45, 0x54, 0x0a, 0x00, 0x03, 0x1a, 0x00, 0x02, 0x4e, 0x00, 0x51, 0x6f,
+  0x64, 0xf4, 0x46, 0x46, 0x14, 0x00, 0x91, 0x48, 0xf8, 0x84, 0x84, 0x6f,
+  0x69, 0xf9, 0x96, 0x96, 0x92, 0x00, 0x5a, 0x00, 0x00, 0x8a, 0xa8, 0x88,
+  0x42, 0x00, 0x61, 0x4a, 0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x28, 0x00, 0x00,
+  0x63, 0x00, 0x02, 0x0f, 0x00, 0x50, 0x6f, 0x6c, 0xfc, 0xc6, 0xc6, 0x1e,
+  0x00, 0x85, 0x8a, 0xa8, 0x88, 0x2f, 0x29, 0xf9, 0x92, 0x92, 0x61, 0x01,
+  0x04, 0x40, 0x00, 0x53, 0x6f, 0x65, 0xf5, 0x56, 0x56, 0x54, 0x00, 0x07,
+  0x94, 0x00, 0x00, 0x30, 0x00, 0x01, 0x15, 0x00, 0x01, 0x0e, 0x00, 0xa2,
+  0xcf, 0xcf, 0xff, 0xfc, 0xfc, 0xdf, 0xd8, 0xf8, 0x8d, 0x8d, 0x10, 0x00,
+  0x50, 0x6f, 0x6d, 0xfd, 0xd6, 0xd6, 0x57, 0x00, 0xa1, 0x8f, 0x8c, 0xfc,
+  0xc8, 0xc8, 0xaf, 0xac, 0xfc, 0xca, 0xca, 0xd7, 0x00, 0x96, 0x8a, 0xa8,
+  0x88, 0xc5, 0x5c, 0xcc, 0xc5, 0x5c, 0xcc, 0xd3, 0x00, 0x01, 0x22, 0x00,
+  0x00, 0x1d, 0x00, 0x02, 0x0f, 0x00, 0x50, 0xef, 0xec, 0xfc, 0xce, 0xce,
+  0x1e, 0x00, 0x51, 0xcf, 0xcc, 0xfc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x0e,
+  0x00, 0x66, 0xc5, 0x5c, 0xcc, 0xe5, 0x5e, 0xee, 0x46, 0x01, 0x03, 0x27,
+  0x00, 0x02, 0x33, 0x01, 0x06, 0x34, 0x00, 0x41, 0xc8, 0xf8, 0x8c, 0x8c,
+  0x05, 0x00, 0x01, 0x0e, 0x00, 0x92, 0xc4, 0xf4, 0x4c, 0x4c, 0xef, 0xe4,
+  0xf4, 0x4e, 0x4e, 0x38, 0x00, 0xf1, 0x00, 0x4a, 0xa4, 0x44, 0x2f, 0x24,
+  0xf4, 0x42, 0x42, 0xef, 0xe8, 0xf8, 0x8e, 0x8e, 0x00, 0x00, 0x0c, 0x00,
+  0x02, 0x11, 0x00, 0x0f, 0x40, 0x00, 0x03, 0x04, 0x30, 0x00, 0x0a, 0x3e,
+  0x00, 0x58, 0x6f, 0x68, 0xf8, 0x86, 0x86, 0x3e, 0x00, 0x05, 0x43, 0x01,
+  0x02, 0x3e, 0x00, 0x70, 0xcb, 0xfb, 0xbc, 0xbc, 0x3a, 0xa3, 0x33, 0xfc,
+  0x00, 0x94, 0x84, 0xf4, 0x48, 0x48, 0xaf, 0xa5, 0xf5, 0x5a, 0x5a, 0x3f,
+  0x01, 0x09, 0x82, 0x00, 0x00, 0x25, 0x00, 0xa8, 0x2f, 0x25, 0xf5, 0x52,
+  0x52, 0x9f, 0x9c, 0xfc, 0xc9, 0xc9, 0x8f, 0x00, 0x43, 0xef, 0xff, 0xfe,
+  0xfe, 0x94, 0x01, 0x32, 0xba, 0xab, 0xbb, 0x4d, 0x00, 0x02, 0xcd, 0x00,
+  0x44, 0xe5, 0xf5, 0x5e, 0x5e, 0x4d, 0x00, 0x06, 0xdf, 0x00, 0x50, 0x2f,
+  0x28, 0xf8, 0x82, 0x82, 0xb3, 0x02, 0x01, 0x0e, 0x00, 0x02, 0x05, 0x00,
+  0x04, 0x92, 0x02, 0x82, 0x4a, 0xa4, 0x44, 0x1f, 0x14, 0xf4, 0x41, 0x41,
+  0x87, 0x03, 0x01, 0xa3, 0x00, 0xaa, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0x2f,
+  0x23, 0xf3, 0x32, 0x32, 0x12, 0x00, 0x61, 0x27, 0xf7, 0x72, 0x72, 0x00,
+  0x00, 0x0c, 0x00, 0x02, 0x05, 0x00, 0x04, 0x88, 0x00, 0x01, 0xc9, 0x00,
+  0x57, 0x9f, 0x94, 0xf4, 0x49, 0x49, 0x46, 0x00, 0xa5, 0xff, 0xfa, 0xfa,
+  0xaf, 0xaf, 0x3f, 0x32, 0xf2, 0x23, 0x23, 0x7e, 0x02, 0x90, 0x6a, 0xfa,
+  0xa6, 0xa6, 0xaf, 0xa6, 0xf6, 0x6a, 0x6a, 0x27, 0x00, 0x01, 0x0e, 0x00,
+  0x01, 0x05, 0x00, 0x55, 0xff, 0xfe, 0xfe, 0xef, 0xef, 0x91, 0x01, 0x70,
+  0xff, 0xf4, 0xf4, 0x4f, 0x4f, 0x35, 0x53, 0xd4, 0x00, 0xd5, 0x8a, 0xa8,
+  0x88, 0x1f, 0x1b, 0xfb, 0xb1, 0xb1, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0xf0,
+  0x00, 0x50, 0x4f, 0x47, 0xf7, 0x74, 0x74, 0x21, 0x00, 0xb3, 0xba, 0xab,
+  0xbb, 0xba, 0xab, 0xbb, 0x7f, 0x7f, 0xff, 0xf7, 0xf7, 0x2f, 0x02, 0x70,
+  0x4f, 0x42, 0xf2, 0x24, 0x24, 0x2a, 0xa2, 0x8f, 0x01, 0x01, 0x37, 0x02,
+  0xa9, 0xbf, 0xbd, 0xfd, 0xdb, 0xdb, 0x3f, 0x31, 0xf1, 0x13, 0x13, 0x12,
+  0x00, 0xf1, 0x01, 0x7f, 0x71, 0xf1, 0x17, 0x17, 0x00, 0x9a, 0xa9, 0x99,
+  0x3f, 0x3d, 0xfd, 0xd3, 0xd3, 0x00, 0x00, 0x15, 0x00, 0x01, 0x05, 0x00,
+  0x53, 0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x17, 0x01, 0x32, 0x6a, 0xa6, 0x66,
+  0x4b, 0x00, 0x02, 0xcf, 0x00, 0x44, 0xf9, 0xf9, 0x9f, 0x9f, 0x4b, 0x00,
+  0x07, 0x12, 0x00, 0x61, 0x35, 0xf5, 0x53, 0x53, 0x00, 0x00, 0x0c, 0x00,
+  0x02, 0x05, 0x00, 0x04, 0x42, 0x00, 0x01, 0xcd, 0x00, 0x53, 0xcf, 0xc6,
+  0xf6, 0x6c, 0x6c, 0x91, 0x00, 0x94, 0x88, 0xf8, 0x88, 0x88, 0xbf, 0xb9,
+  0xf9, 0x9b, 0x9b, 0x46, 0x00, 0xf1, 0x00, 0x8a, 0xa8, 0x88, 0x3f, 0x39,
+  0xf9, 0x93, 0x93, 0xff, 0xf5, 0xf5, 0x5f, 0x5f, 0x00, 0x00, 0x0c, 0x00,
+  0x02, 0x11, 0x00, 0x04, 0x44, 0x00, 0x02, 0x37, 0x01, 0x00, 0x51, 0x02,
+  0x02, 0x64, 0x02, 0x02, 0x69, 0x01, 0x44, 0x97, 0xf7, 0x79, 0x79, 0x13,
+  0x01, 0x06, 0x12, 0x00, 0x50, 0x5f, 0x5b, 0xfb, 0xb5, 0xb5, 0x27, 0x00,
+  0x01, 0x0e, 0x00, 0x01, 0x05, 0x00, 0x01, 0xb9, 0x05, 0x05, 0x48, 0x00,
+  0x01, 0x05, 0x00, 0x06, 0xaf, 0x01, 0x0f, 0x46, 0x00, 0x08, 0x17, 0x00,
+  0x44, 0x00, 0x5f, 0xdf, 0xdf, 0xff, 0xfd, 0xfd, 0x8c, 0x00, 0x22, 0x9f,
+  0xef, 0xea, 0xfa, 0xae, 0xae, 0x9a, 0xa9, 0x99, 0x00, 0x4f, 0x00, 0x03,
+  0x00, 0x07, 0x04, 0x90, 0x5f, 0x55, 0xf5, 0x55, 0x55, 0x1f, 0x11, 0xf1,
+  0x11, 0x36, 0x02, 0x01, 0x21, 0x01, 0x55, 0x9f, 0x9b, 0xfb, 0xb9, 0xb9,
+  0x51, 0x00, 0x00, 0x12, 0x00, 0xa2, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x4f,
+  0x46, 0xf6, 0x64, 0x64, 0x29, 0x00, 0x01, 0x10, 0x00, 0x01, 0x05, 0x00,
+  0x0f, 0x4c, 0x00, 0x48, 0x49, 0x57, 0xf7, 0x75, 0x75, 0x3a, 0x00, 0x59,
+  0x9f, 0x99, 0xf9, 0x99, 0x99, 0x5e, 0x00, 0x01, 0x05, 0x00, 0x01, 0x2e,
+  0x00, 0x03, 0x4c, 0x00, 0x05, 0x15, 0x00, 0x5f, 0xdf, 0xdd, 0xfd, 0xdd,
+  0xdd, 0x4c, 0x00, 0x3d, 0x0a, 0x01, 0x00, 0x01, 0x6b, 0x02, 0x50, 0xbf,
+  0xb6, 0xf6, 0x6b, 0x6b, 0x0e, 0x00, 0x1e, 0x28, 0x21, 0x00, 0x03, 0x01,
+  0x00, 0x53, 0xf0, 0x83, 0x4b, 0x80, 0x04, 0x0c, 0x00, 0x17, 0x21, 0x18,
+  0x00, 0x52, 0x28, 0x00, 0x00, 0x80, 0x08, 0x0b, 0x00, 0x37, 0xff, 0xf8,
+  0x02, 0x19, 0x00, 0x0b, 0x01, 0x00, 0x8f, 0x80, 0x02, 0x00, 0x00, 0x4f,
+  0xee, 0x03, 0x48, 0x65, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x12, 0x88, 0x0b,
+  0x00, 0x3b, 0xf0, 0xb3, 0x45, 0x1d, 0x00, 0x0b, 0x01, 0x00, 0xd2, 0xff,
+  0xe4, 0x0f, 0x28, 0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x40, 0x01, 0x28,
+  0x05, 0x00, 0x00, 0x51, 0x00, 0x80, 0x48, 0x00, 0x00, 0x10, 0x82, 0x04,
+  0x00, 0x00, 0xa3, 0x00, 0x10, 0x21, 0x0d, 0x00, 0x3f, 0xf2, 0xba, 0x5e,
+  0x3e, 0x00, 0x00, 0x07, 0x01, 0x00, 0x3f, 0xff, 0xe4, 0x0f, 0x16, 0x00,
+  0x00, 0x06, 0x01, 0x00, 0x60, 0xf0, 0x4f, 0xfe, 0x80, 0x84, 0x01, 0x9b,
+  0x00, 0x30, 0x00, 0x10, 0x02, 0x04, 0x00, 0xf1, 0x12, 0x40, 0x01, 0x40,
+  0x11, 0x02, 0x50, 0x12, 0x00, 0x14, 0x00, 0x40, 0x01, 0x28, 0x14, 0x00,
+  0x40, 0x81, 0x88, 0x42, 0x01, 0x00, 0x80, 0x88, 0x02, 0x00, 0x00, 0x6f,
+  0xf7, 0x08, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x51, 0x29, 0x21, 0x01,
+  0x00, 0x20, 0x03, 0x00, 0x20, 0x00, 0x00, 0x3b, 0x05, 0x03, 0xdf, 0x00,
+  0x81, 0x80, 0x02, 0xf0, 0xd3, 0x3b, 0x80, 0x84, 0x41, 0xb4, 0x00, 0xf3,
+  0x08, 0x81, 0xa1, 0x21, 0x10, 0x82, 0x04, 0x16, 0x21, 0x81, 0x02, 0x21,
   0x1a, 0x01, 0x14, 0x80, 0x02, 0x21, 0x1a, 0x04, 0x14, 0x00, 0x30, 0x12,
-  0x48, 0x40, 0x01, 0x28, 0x00, 0x48, 0x40, 0x81, 0x88, 0x02, 0x21, 0x48,
-  0x00, 0x88, 0x28, 0x10, 0x82, 0x04, 0xf0, 0xab, 0x14, 0x80, 0x84, 0x01,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x40,
-  0x01, 0x00, 0x21, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x80, 0x02, 0x00,
-  0x40, 0x81, 0x88, 0x02, 0x00, 0x00, 0x88, 0x28, 0x00, 0x00, 0xf0, 0x4c,
-  0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x40, 0x81,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x7e, 0x0f, 0x42, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x00, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00,
-  0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x5d, 0xc7, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xbf, 0x24, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x7c,
-  0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x02,
-  0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x18, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xb8, 0x03, 0x00, 0x00, 0x22,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2b, 0x80, 0x24, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0xa5, 0x8c, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4b, 0x3d, 0x00, 0x20, 0x01, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01,
-  0x00, 0x00, 0x11, 0x00, 0x88, 0x00, 0x82, 0x00, 0x00, 0x20, 0x02, 0x00,
-  0xf0, 0x27, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x22, 0x00, 0x00, 0x29,
-  0x08, 0x00, 0x12, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x10,
-  0x01, 0x14, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x9c,
-  0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x97, 0x66,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x70, 0x5a, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x88,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x23, 0xa2, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x82, 0x00, 0x12, 0x88, 0x90, 0x81, 0x28, 0x42, 0x80, 0x08,
-  0x82, 0x80, 0x08, 0x00, 0x14, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x12, 0x02, 0x40, 0x81, 0x08, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00,
-  0xbf, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x81, 0x48,
-  0x01, 0x22, 0x00, 0x00, 0x88, 0x30, 0x81, 0x88, 0x00, 0x14, 0x40, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x21, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x58, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x13, 0x08, 0x48, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x88,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x8a, 0x04, 0x00,
-  0x80, 0x08, 0x00, 0x00, 0x00, 0x5f, 0x19, 0x0d, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x02, 0x00, 0x00, 0xf0, 0x46, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x14, 0x00, 0x42, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x01, 0xf0, 0xc2, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x10, 0x01, 0x80, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x28, 0x00,
-  0x40, 0x01, 0xf0, 0xd6, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xaf, 0xeb, 0x06, 0x00, 0x00, 0x20, 0x04, 0x00, 0x48, 0x00, 0x20, 0x18,
-  0x01, 0x00, 0x24, 0x20, 0x04, 0x40, 0x01, 0x00, 0x00, 0x20, 0x12, 0x81,
-  0x01, 0x12, 0x00, 0x00, 0x10, 0x41, 0x41, 0x01, 0x80, 0x92, 0x41, 0x20,
-  0x18, 0x22, 0x04, 0x00, 0x00, 0x00, 0xd0, 0xf9, 0x0f, 0x20, 0x01, 0x00,
-  0x24, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x1a,
-  0x08, 0x11, 0x00, 0x00, 0x82, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x08, 0x00, 0xf0, 0xca, 0x9a, 0x00,
-  0x00, 0x00, 0x22, 0x00, 0x00, 0x88, 0x00, 0x00, 0x13, 0x08, 0x60, 0x18,
-  0x00, 0x88, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x28, 0x80, 0x08, 0x40,
-  0x01, 0x28, 0x00, 0x20, 0x0a, 0x82, 0x48, 0x00, 0x00, 0x00, 0x20, 0x02,
-  0x00, 0xaf, 0x53, 0x02, 0x80, 0x01, 0x00, 0x28, 0x80, 0x01, 0x48, 0x88,
-  0x00, 0x88, 0x14, 0x88, 0x00, 0x19, 0x08, 0x48, 0x8a, 0x04, 0x82, 0x10,
-  0x01, 0x40, 0x01, 0x8a, 0x02, 0x20, 0x82, 0x01, 0x00, 0x00, 0x1c, 0x12,
-  0x41, 0x01, 0xa8, 0x20, 0x88, 0x24, 0x08, 0x42, 0x00, 0x00, 0x22, 0x00,
-  0x70, 0x7a, 0x03, 0x00, 0x00, 0x80, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x24, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
-  0x88, 0x00, 0x11, 0x00, 0x00, 0x00, 0x22, 0x19, 0x04, 0x10, 0x02, 0x00,
-  0x24, 0x82, 0x00, 0x00, 0x3f, 0x68, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x14, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x93, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x11,
-  0x40, 0x01, 0x40, 0x01, 0x00, 0x14, 0x10, 0x01, 0x14, 0x40, 0x41, 0x01,
-  0x00, 0x40, 0x01, 0x40, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xd5,
-  0x31, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x18, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x11, 0x10, 0x01, 0x11,
-  0x00, 0x00, 0x18, 0x10, 0x01, 0x11, 0x00, 0x40, 0x01, 0x14, 0x00, 0x00,
-  0x00, 0x40, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xcd,
-  0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x10, 0x01, 0x00,
-  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x11, 0x40, 0x01, 0x00, 0x14, 0x40,
-  0x01, 0x40, 0x01, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-  0xf0, 0x25, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x11, 0x00, 0x14,
-  0x40, 0x11, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x14, 0x8f, 0x2c, 0x05, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-  0x10, 0x01, 0x00, 0x00, 0x10, 0x12, 0x91, 0x11, 0x80, 0x08, 0x10, 0x01,
-  0x40, 0x01, 0x00, 0x80, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x28, 0x14,
-  0x00, 0x00, 0x00, 0x10, 0x02, 0x1f, 0x68, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x01, 0x10,
-  0x01, 0x00, 0x40, 0x41, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x00, 0x11,
-  0x11, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x01, 0x1f, 0x59, 0x0a, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x15, 0x01, 0x14, 0x00, 0x00,
-  0x00, 0x10, 0x01, 0x40, 0x01, 0x14, 0x00, 0x11, 0x11, 0x40, 0x01, 0x10,
-  0x01, 0x40, 0x41, 0x51, 0x11, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0xf0, 0x4f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x50, 0x11, 0x11, 0x14, 0x40, 0x01, 0x50, 0x11, 0x40, 0x41, 0x41, 0x01,
-  0x15, 0x01, 0x00, 0x00, 0x11, 0x40, 0x41, 0x41, 0x11, 0x01, 0x10, 0x01,
-  0x00, 0x14, 0x14, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x35, 0x09,
-  0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x11, 0x00,
-  0x00, 0x10, 0x01, 0x11, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x8f, 0xef,
-  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x1a, 0x01, 0x1a, 0x01, 0x00, 0x10,
-  0x11, 0x51, 0x11, 0x00, 0x50, 0x11, 0x00, 0x50, 0x11, 0x15, 0x51, 0x11,
-  0x00, 0x00, 0x15, 0x51, 0x11, 0x00, 0x15, 0x51, 0x11, 0x15, 0x01, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x11, 0x11, 0x15, 0x51, 0x11, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x9f, 0xe5, 0x0d, 0xa0, 0x4c, 0x80, 0x24, 0x28, 0x08,
-  0x00, 0xa0, 0x11, 0xa0, 0x33, 0x80, 0x52, 0x11, 0x15, 0x11, 0x11, 0x51,
-  0x11, 0x24, 0x21, 0xf0, 0x13, 0x11, 0xa0, 0x98, 0x14, 0x88, 0x15, 0x51,
-  0x11, 0x40, 0x01, 0x14, 0x50, 0x11, 0x4a, 0x04, 0x19, 0x54, 0x11, 0x15,
-  0x01, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0xa1, 0x22, 0x15, 0xd1,
-  0x11, 0x02, 0x00, 0x00, 0x24, 0x21, 0x10, 0xd2, 0xba, 0x0c, 0x80, 0x04,
-  0x00, 0x00, 0x00, 0xa0, 0x11, 0xa0, 0x31, 0x00, 0x00, 0x15, 0x51, 0x11,
-  0x15, 0x01, 0x21, 0xd0, 0x11, 0x11, 0x81, 0x58, 0x11, 0x15, 0x51, 0x11,
-  0x15, 0x51, 0x11, 0x14, 0x00, 0x15, 0x51, 0x11, 0x1c, 0x04, 0x15, 0x51,
-  0x11, 0x00, 0x14, 0x14, 0x15, 0x01, 0x15, 0xd1, 0x11, 0x42, 0x51, 0x11,
-  0x00, 0x00, 0x00, 0x21, 0x00, 0x1f, 0x42, 0x0d, 0xa0, 0x48, 0x20, 0x04,
-  0x00, 0x00, 0xa0, 0x11, 0xa0, 0x31, 0x20, 0x12, 0x51, 0x11, 0x11, 0x15,
-  0x51, 0x11, 0x10, 0x42, 0xd2, 0x11, 0x51, 0x11, 0x1a, 0x58, 0x11, 0x17,
-  0x18, 0x15, 0x51, 0x11, 0x11, 0x00, 0x11, 0x00, 0x1c, 0x04, 0x17, 0x14,
-  0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11,
-  0x28, 0x70, 0x21, 0x01, 0x00, 0x40, 0x01, 0x21, 0x24, 0xf0, 0x4f, 0x56,
-  0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x40, 0x01, 0x14, 0x00, 0x00,
-  0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf6, 0x0b,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xe4, 0x0a, 0x48, 0x1b, 0x21,
-  0xb0, 0x11, 0x22, 0xb4, 0x11, 0x32, 0x42, 0x19, 0xb2, 0x42, 0x91, 0x21,
-  0x2b, 0x94, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0x42, 0x39, 0x21, 0x2f, 0x14,
-  0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x2a, 0xc4, 0x91, 0x2e, 0x42,
-  0x1c, 0xe8, 0x22, 0x64, 0x11, 0x2e, 0x42, 0x96, 0xe1, 0x22, 0x64, 0x19,
-  0x2c, 0xa4, 0x29, 0x2c, 0xb4, 0x91, 0xc2, 0x42, 0x1b, 0x29, 0x24, 0x1b,
-  0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x32, 0x42, 0x19, 0xb2, 0x42,
-  0x98, 0x21, 0x2b, 0x84, 0x11, 0x2b, 0x84, 0x22, 0x2b, 0x84, 0x22, 0x2b,
-  0x84, 0x22, 0x29, 0xa8, 0x42, 0x88, 0x2e, 0x42, 0xff, 0xc2, 0x0f, 0x48,
-  0x1b, 0x61, 0x48, 0x1b, 0x21, 0x42, 0x1b, 0x21, 0x23, 0x94, 0x21, 0x2b,
-  0x14, 0x19, 0xb2, 0x42, 0x98, 0x21, 0x2b, 0xa4, 0x19, 0xb2, 0x42, 0x29,
-  0xb2, 0x42, 0x29, 0xb2, 0x42, 0x29, 0xd2, 0x12, 0xb9, 0x22, 0xd4, 0x12,
-  0xe9, 0x22, 0x85, 0xe8, 0x22, 0xad, 0x81, 0x2e, 0x42, 0x92, 0x2e, 0x42,
-  0x92, 0x3c, 0xa4, 0x29, 0x3c, 0xb4, 0x91, 0xc2, 0x42, 0x1b, 0x69, 0x2c,
-  0xa4, 0x29, 0x42, 0x9a, 0x32, 0x42, 0x1b, 0x28, 0x23, 0x94, 0x21, 0x2b,
-  0x84, 0x28, 0x2b, 0xa4, 0x28, 0x2b, 0x84, 0x22, 0x2b, 0x84, 0x22, 0x2b,
-  0x84, 0x22, 0x29, 0xb8, 0x22, 0x94, 0x82, 0x2e, 0x42, 0x5f, 0x75, 0x08,
-  0x20, 0x88, 0x04, 0x00, 0x80, 0x44, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44,
-  0x02, 0x00, 0x00, 0x00, 0x80, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x50, 0x12,
-  0x14, 0x3f, 0xad, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x88, 0x00,
-  0x00, 0x82, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x20, 0x04,
-  0x00, 0xf0, 0xcb, 0x1c, 0x00, 0x82, 0x28, 0x88, 0x20, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x82, 0x08, 0x20, 0x02, 0x62, 0xa0, 0x24, 0x80,
-  0x02, 0x14, 0x28, 0x20, 0x02, 0x22, 0x00, 0x00, 0x42, 0x00, 0x10, 0x01,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x22, 0x40, 0x01, 0x6f, 0x7d, 0x0d, 0x20,
-  0x8c, 0x82, 0x08, 0x00, 0x00, 0x88, 0x00, 0x22, 0x00, 0x20, 0x08, 0x00,
-  0x24, 0x20, 0x22, 0x21, 0x24, 0x08, 0x00, 0x00, 0x19, 0x02, 0x00, 0x20,
-  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x22, 0x40, 0x01, 0x00, 0x80, 0x64,
-  0x22, 0x40, 0x01, 0x7f, 0xb9, 0x06, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00,
-  0x82, 0x00, 0x00, 0x10, 0x81, 0x22, 0x08, 0x00, 0x80, 0x02, 0x4e, 0x21,
-  0x80, 0x02, 0x14, 0x00, 0x22, 0x20, 0x02, 0x00, 0x80, 0x04, 0x11, 0x00,
-  0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x3c, 0x0f, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x88,
-  0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0xf0, 0x42, 0x2b, 0x00, 0x28, 0x88,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x88, 0x20, 0x08, 0x80, 0x22, 0x08,
-  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0xaf, 0xcb, 0x0d, 0x00,
-  0x00, 0x20, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x28, 0x82,
-  0x00, 0x22, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xf0, 0xc8, 0x9e, 0x00,
-  0x28, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x82, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x7f, 0x6e, 0x09,
-  0x00, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x42, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x20, 0x02, 0x42, 0x20, 0x02, 0x42, 0x00, 0x8f, 0x81,
-  0x06, 0x00, 0x18, 0x12, 0x20, 0x04, 0x00, 0x00, 0x20, 0x22, 0x08, 0x00,
-  0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x48, 0x00, 0x48, 0x88,
-  0x42, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0xaf, 0x88, 0x0e, 0x28, 0x00, 0x28, 0x20, 0x02, 0x00, 0x80, 0x08,
-  0x00, 0x20, 0x08, 0x14, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x20, 0x08, 0x14, 0x48, 0x00,
-  0x00, 0x20, 0x04, 0x28, 0xf0, 0x5c, 0x44, 0x00, 0x80, 0xa3, 0x12, 0x80,
-  0x86, 0x02, 0x00, 0x88, 0x20, 0x04, 0x80, 0x0c, 0x14, 0x00, 0x42, 0x00,
-  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x42, 0x82, 0x00, 0x00, 0x80, 0x04,
-  0x00, 0xa0, 0x2c, 0x40, 0x81, 0x24, 0x02, 0x00, 0x22, 0x42, 0x42, 0x62,
-  0xd0, 0xe1, 0x05, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00,
-  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0xf0,
-  0x55, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x22, 0x20,
-  0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x42,
-  0x00, 0x20, 0x04, 0x00, 0x42, 0x00, 0x28, 0x20, 0x02, 0x20, 0x06, 0x80,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0xb0, 0xd7,
-  0x0a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x22, 0x00, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xba, 0xbc, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x28,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x28, 0x68, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0xf0, 0xd9, 0x73, 0x00,
-  0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x20, 0x02, 0x28, 0x00, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x77, 0x73, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x80, 0x02, 0x00, 0x00, 0x48, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x7f, 0xb2, 0x07, 0x00, 0x28,
-  0x00, 0x20, 0x02, 0x22, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x80, 0x04, 0x22, 0x20, 0x04, 0x42, 0x22, 0x20, 0x06, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x48, 0xf0, 0xbc,
-  0xd7, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0xe1, 0xab, 0x06,
-  0x00, 0x48, 0x20, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02,
-  0x28, 0x10, 0x02, 0x38, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x28, 0x80,
-  0x04, 0x00, 0x80, 0x04, 0x48, 0x00, 0x80, 0x06, 0x00, 0x00, 0x14, 0x00,
-  0x21, 0xf0, 0xe4, 0x4d, 0x00, 0x82, 0x00, 0x88, 0x82, 0x28, 0x00, 0x00,
-  0x20, 0x02, 0x28, 0x00, 0x00, 0x20, 0x04, 0x00, 0x28, 0x20, 0x02, 0x22,
-  0x80, 0x84, 0x22, 0x22, 0xa2, 0x22, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0xec, 0x81, 0x88, 0x02, 0x21, 0x48, 0x00, 0x88, 0x28, 0x10,
+  0x82, 0x04, 0xf0, 0xab, 0x14, 0x84, 0x00, 0x20, 0x00, 0x21, 0xfd, 0x00,
+  0x40, 0x00, 0x14, 0x80, 0x02, 0x82, 0x00, 0x00, 0x39, 0x01, 0x6c, 0x28,
+  0x00, 0x00, 0xf0, 0x4c, 0xbe, 0xbf, 0x00, 0x0a, 0x01, 0x00, 0x01, 0xed,
+  0x00, 0x19, 0x28, 0x78, 0x01, 0x00, 0xb5, 0x01, 0x63, 0x14, 0x00, 0x28,
+  0x00, 0x40, 0x81, 0xbe, 0x01, 0x50, 0x8f, 0x7e, 0x0f, 0x42, 0x42, 0x09,
+  0x00, 0x01, 0xbc, 0x00, 0x00, 0x1d, 0x00, 0x10, 0x24, 0xd4, 0x00, 0x72,
+  0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x25, 0x00, 0x35, 0xf0, 0x5d,
+  0xc7, 0x41, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x0c, 0x56, 0x01, 0x03, 0x4c,
+  0x00, 0x06, 0x01, 0x00, 0x2a, 0xbf, 0x24, 0x21, 0x00, 0x15, 0x24, 0xfb,
+  0x01, 0x03, 0x01, 0x00, 0x32, 0xf0, 0x7c, 0xcb, 0x09, 0x00, 0x02, 0x7d,
+  0x00, 0x03, 0x01, 0x00, 0x10, 0x10, 0x06, 0x01, 0x04, 0x68, 0x02, 0x28,
+  0x2f, 0x18, 0x56, 0x00, 0x14, 0x40, 0x0d, 0x00, 0x06, 0xdf, 0x00, 0x6f,
+  0x70, 0xb8, 0x03, 0x00, 0x00, 0x22, 0xcc, 0x02, 0x01, 0x00, 0x3c, 0x01,
+  0x00, 0x01, 0x00, 0x44, 0x7b, 0x2b, 0x80, 0x24, 0xce, 0x02, 0x0a, 0x01,
+  0x00, 0x04, 0xea, 0x00, 0x22, 0xa5, 0x8c, 0xfa, 0x00, 0x09, 0x01, 0x00,
+  0x35, 0x10, 0x02, 0x10, 0x7b, 0x00, 0x31, 0xf0, 0x4b, 0x3d, 0xea, 0x01,
+  0x00, 0x24, 0x00, 0x01, 0x38, 0x01, 0x11, 0x00, 0x7e, 0x0a, 0x00, 0xf2,
+  0x00, 0x51, 0x11, 0x00, 0x88, 0x00, 0x82, 0x3f, 0x00, 0x21, 0xf0, 0x27,
+  0xe0, 0x07, 0x0b, 0x8b, 0x00, 0x02, 0x19, 0x02, 0x00, 0x6a, 0x00, 0x72,
+  0x22, 0x00, 0x00, 0x29, 0x08, 0x00, 0x12, 0x69, 0x00, 0x02, 0x60, 0x03,
+  0x02, 0x62, 0x00, 0x00, 0x6a, 0x00, 0x10, 0x14, 0x45, 0x00, 0x00, 0x01,
+  0x00, 0x35, 0xf0, 0x9c, 0x59, 0x3b, 0x00, 0x01, 0x0e, 0x02, 0x04, 0x1d,
+  0x01, 0x23, 0x80, 0x02, 0x3e, 0x01, 0x44, 0x20, 0x08, 0x97, 0x66, 0x23,
+  0x00, 0x33, 0x00, 0x00, 0x11, 0xc5, 0x00, 0x04, 0x01, 0x00, 0x01, 0x5f,
+  0x00, 0x33, 0x70, 0x5a, 0x0e, 0x0f, 0x00, 0x01, 0x05, 0x01, 0x11, 0x14,
+  0x39, 0x00, 0x01, 0x8a, 0x00, 0x32, 0x20, 0x02, 0x20, 0x0c, 0x01, 0x31,
+  0xf0, 0x23, 0xa2, 0x08, 0x00, 0xf2, 0x01, 0x82, 0x00, 0x12, 0x88, 0x90,
+  0x81, 0x28, 0x42, 0x80, 0x08, 0x82, 0x80, 0x08, 0x00, 0x14, 0x60, 0x6e,
+  0x00, 0x30, 0x80, 0x12, 0x02, 0x2d, 0x02, 0x01, 0x86, 0x01, 0x31, 0xbf,
+  0x32, 0x03, 0x3a, 0x00, 0xe3, 0x08, 0x20, 0x81, 0x48, 0x01, 0x22, 0x00,
+  0x00, 0x88, 0x30, 0x81, 0x88, 0x00, 0x14, 0x8b, 0x01, 0x22, 0x28, 0x21,
+  0x57, 0x0a, 0x43, 0x00, 0x00, 0xf0, 0x58, 0xcd, 0x01, 0x52, 0x00, 0x00,
+  0x13, 0x08, 0x48, 0x96, 0x00, 0x33, 0x88, 0x00, 0x80, 0x61, 0x02, 0x22,
+  0x8a, 0x04, 0x4d, 0x00, 0x31, 0x5f, 0x19, 0x0d, 0x4d, 0x00, 0x02, 0x17,
+  0x00, 0x05, 0xc4, 0x0b, 0x03, 0x4e, 0x00, 0x00, 0xbd, 0x00, 0x34, 0xf0,
+  0x46, 0x85, 0x16, 0x00, 0x33, 0x14, 0x00, 0x42, 0x58, 0x03, 0x02, 0x01,
+  0x00, 0x02, 0x15, 0x02, 0x42, 0x10, 0x01, 0xf0, 0xc2, 0x17, 0x0b, 0x11,
+  0x18, 0x2d, 0x02, 0x19, 0x84, 0x78, 0x02, 0x00, 0x47, 0x01, 0x77, 0x28,
+  0x00, 0x40, 0x01, 0xf0, 0xd6, 0x71, 0x16, 0x00, 0x04, 0x0c, 0x02, 0x06,
+  0x42, 0x02, 0xf0, 0x04, 0x00, 0x00, 0xaf, 0xeb, 0x06, 0x00, 0x00, 0x20,
+  0x04, 0x00, 0x48, 0x00, 0x20, 0x18, 0x01, 0x00, 0x24, 0x20, 0x04, 0x1c,
+  0x00, 0xf0, 0x02, 0x20, 0x12, 0x81, 0x01, 0x12, 0x00, 0x00, 0x10, 0x41,
+  0x41, 0x01, 0x80, 0x92, 0x41, 0x20, 0x18, 0x22, 0x2e, 0x01, 0x83, 0xd0,
+  0xf9, 0x0f, 0x20, 0x01, 0x00, 0x24, 0x22, 0x8d, 0x00, 0x88, 0x20, 0x04,
+  0x1a, 0x08, 0x11, 0x00, 0x00, 0x82, 0x82, 0x0c, 0x71, 0x23, 0x08, 0x00,
+  0xf0, 0xca, 0x9a, 0x00, 0xe6, 0x01, 0x10, 0x88, 0x02, 0x01, 0x21, 0x60,
+  0x18, 0xaf, 0x01, 0x60, 0x11, 0x00, 0x00, 0x28, 0x80, 0x08, 0xee, 0x03,
+  0x30, 0x20, 0x0a, 0x82, 0x11, 0x05, 0xf0, 0x1f, 0x20, 0x02, 0x00, 0xaf,
+  0x53, 0x02, 0x80, 0x01, 0x00, 0x28, 0x80, 0x01, 0x48, 0x88, 0x00, 0x88,
+  0x14, 0x88, 0x00, 0x19, 0x08, 0x48, 0x8a, 0x04, 0x82, 0x10, 0x01, 0x40,
+  0x01, 0x8a, 0x02, 0x20, 0x82, 0x01, 0x00, 0x00, 0x1c, 0x12, 0x41, 0x01,
+  0xa8, 0x20, 0x88, 0x24, 0x08, 0x42, 0x50, 0x00, 0x71, 0x70, 0x7a, 0x03,
+  0x00, 0x00, 0x80, 0x34, 0x68, 0x01, 0x10, 0x11, 0x45, 0x03, 0x01, 0x78,
+  0x00, 0x31, 0x12, 0x00, 0x88, 0x09, 0x00, 0xc5, 0x22, 0x19, 0x04, 0x10,
+  0x02, 0x00, 0x24, 0x82, 0x00, 0x00, 0x3f, 0x68, 0x6f, 0x03, 0x01, 0x58,
+  0x02, 0x05, 0xf4, 0x00, 0x14, 0x11, 0xf7, 0x00, 0x34, 0xf0, 0x14, 0xeb,
+  0x14, 0x00, 0x05, 0x01, 0x00, 0x05, 0x26, 0x00, 0x00, 0x01, 0x00, 0x38,
+  0xf0, 0x93, 0x73, 0x0f, 0x00, 0x0e, 0x01, 0x00, 0x07, 0xf4, 0x03, 0x00,
+  0x39, 0x00, 0xe0, 0x11, 0x40, 0x01, 0x40, 0x01, 0x00, 0x14, 0x10, 0x01,
+  0x14, 0x40, 0x41, 0x01, 0x00, 0x0d, 0x00, 0x01, 0x4f, 0x00, 0x20, 0xf0,
+  0xd5, 0xb6, 0x06, 0x02, 0x03, 0x02, 0x01, 0x8b, 0x00, 0x06, 0x4a, 0x03,
+  0x04, 0x71, 0x00, 0x13, 0xfb, 0x68, 0x02, 0x00, 0x42, 0x03, 0x60, 0x10,
+  0x01, 0x11, 0x00, 0x00, 0x18, 0x06, 0x00, 0x02, 0x40, 0x00, 0x00, 0x4c,
+  0x00, 0x01, 0x01, 0x00, 0x32, 0xf0, 0xcd, 0xee, 0x09, 0x00, 0x21, 0x80,
+  0x01, 0x42, 0x00, 0x01, 0x2e, 0x00, 0x00, 0x71, 0x00, 0x02, 0x77, 0x00,
+  0x01, 0x2c, 0x00, 0x55, 0x01, 0x00, 0xf0, 0x25, 0x36, 0x5d, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0xed, 0x00, 0x64, 0x11, 0x00, 0x14, 0x40, 0x11, 0x01,
+  0x7a, 0x00, 0x50, 0x14, 0x14, 0x8f, 0x2c, 0x05, 0x39, 0x06, 0x00, 0x1d,
+  0x02, 0x00, 0x13, 0x00, 0x60, 0x10, 0x12, 0x91, 0x11, 0x80, 0x08, 0x73,
+  0x01, 0x01, 0x8a, 0x03, 0x40, 0x14, 0x00, 0x00, 0x28, 0x4e, 0x00, 0x42,
+  0x10, 0x02, 0x1f, 0x68, 0x1f, 0x03, 0x03, 0x75, 0x03, 0x20, 0x40, 0x21,
+  0x7a, 0x00, 0x50, 0x40, 0x41, 0x01, 0x11, 0x10, 0x09, 0x00, 0x01, 0x7c,
+  0x07, 0x00, 0x36, 0x00, 0x32, 0x1f, 0x59, 0x0a, 0x21, 0x00, 0x31, 0x18,
+  0x00, 0x15, 0xb4, 0x00, 0x00, 0x15, 0x00, 0xc2, 0x14, 0x00, 0x11, 0x11,
+  0x40, 0x01, 0x10, 0x01, 0x40, 0x41, 0x51, 0x11, 0x2b, 0x00, 0x41, 0x00,
+  0x14, 0xf0, 0x4f, 0x93, 0x09, 0x00, 0x01, 0x00, 0xd1, 0x50, 0x11, 0x11,
+  0x14, 0x40, 0x01, 0x50, 0x11, 0x40, 0x41, 0x41, 0x01, 0x15, 0xca, 0x00,
+  0x30, 0x41, 0x41, 0x11, 0x56, 0x00, 0x20, 0x14, 0x14, 0x0f, 0x00, 0x52,
+  0x00, 0x00, 0x9f, 0x35, 0x09, 0xc0, 0x02, 0x00, 0x4f, 0x00, 0x12, 0x11,
+  0x05, 0x00, 0x03, 0xc0, 0x00, 0x05, 0xb9, 0x02, 0x20, 0xf0, 0x8f, 0xf4,
+  0x0a, 0xe0, 0x88, 0x00, 0x00, 0x1a, 0x01, 0x1a, 0x01, 0x00, 0x10, 0x11,
+  0x51, 0x11, 0x00, 0x50, 0x03, 0x00, 0x01, 0x43, 0x0b, 0x00, 0x05, 0x00,
+  0x00, 0x1c, 0x0f, 0x12, 0x01, 0x21, 0x0f, 0x12, 0x11, 0x16, 0x00, 0xf5,
+  0x1f, 0x11, 0x00, 0x00, 0x9f, 0xe5, 0x0d, 0xa0, 0x4c, 0x80, 0x24, 0x28,
+  0x08, 0x00, 0xa0, 0x11, 0xa0, 0x33, 0x80, 0x52, 0x11, 0x15, 0x11, 0x11,
+  0x51, 0x11, 0x24, 0x21, 0xf0, 0x13, 0x11, 0xa0, 0x98, 0x14, 0x88, 0x15,
+  0x51, 0x11, 0x40, 0x01, 0x14, 0x50, 0x11, 0x4a, 0x04, 0x19, 0x54, 0x3e,
+  0x00, 0xf1, 0x00, 0x15, 0xa1, 0x22, 0x15, 0xd1, 0x11, 0x02, 0x00, 0x00,
+  0x24, 0x21, 0x10, 0xd2, 0xba, 0x0c, 0xb1, 0x04, 0x41, 0xa0, 0x11, 0xa0,
+  0x31, 0x67, 0x00, 0x83, 0x15, 0x01, 0x21, 0xd0, 0x11, 0x11, 0x81, 0x58,
+  0x8b, 0x0f, 0x10, 0x14, 0x14, 0x00, 0x20, 0x1c, 0x04, 0x6f, 0x00, 0x00,
+  0xcd, 0x00, 0x41, 0x15, 0xd1, 0x11, 0x42, 0xd3, 0x0b, 0x70, 0x21, 0x00,
+  0x1f, 0x42, 0x0d, 0xa0, 0x48, 0x73, 0x04, 0x00, 0x3b, 0x00, 0x31, 0x20,
+  0x12, 0x51, 0x94, 0x00, 0xb0, 0x10, 0x42, 0xd2, 0x11, 0x51, 0x11, 0x1a,
+  0x58, 0x11, 0x17, 0x18, 0xa7, 0x00, 0x78, 0x00, 0x11, 0x00, 0x1c, 0x04,
+  0x17, 0x14, 0xdc, 0x0f, 0x30, 0x28, 0x70, 0x21, 0x50, 0x02, 0x53, 0x21,
+  0x24, 0xf0, 0x4f, 0x56, 0xd5, 0x03, 0x04, 0x45, 0x02, 0x00, 0x58, 0x00,
+  0x01, 0x28, 0x02, 0x05, 0xcb, 0x03, 0x33, 0xbf, 0xf6, 0x0b, 0x0a, 0x00,
+  0x0b, 0x01, 0x00, 0x04, 0xa1, 0x03, 0xf1, 0x3a, 0xef, 0xe4, 0x0a, 0x48,
+  0x1b, 0x21, 0xb0, 0x11, 0x22, 0xb4, 0x11, 0x32, 0x42, 0x19, 0xb2, 0x42,
+  0x91, 0x21, 0x2b, 0x94, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0x42, 0x39, 0x21,
+  0x2f, 0x14, 0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x2a, 0xc4, 0x91,
+  0x2e, 0x42, 0x1c, 0xe8, 0x22, 0x64, 0x11, 0x2e, 0x42, 0x96, 0xe1, 0x22,
+  0x64, 0x19, 0x2c, 0xa4, 0x29, 0x2c, 0xb4, 0x91, 0xc2, 0x42, 0x1b, 0x29,
+  0x24, 0x1b, 0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x3e, 0x00, 0x82,
+  0x98, 0x21, 0x2b, 0x84, 0x11, 0x2b, 0x84, 0x22, 0x03, 0x00, 0xf2, 0x08,
+  0x29, 0xa8, 0x42, 0x88, 0x2e, 0x42, 0xff, 0xc2, 0x0f, 0x48, 0x1b, 0x61,
+  0x48, 0x1b, 0x21, 0x42, 0x1b, 0x21, 0x23, 0x94, 0x21, 0x2b, 0x14, 0x28,
+  0x00, 0x52, 0xa4, 0x19, 0xb2, 0x42, 0x29, 0x03, 0x00, 0xf1, 0x08, 0xd2,
+  0x12, 0xb9, 0x22, 0xd4, 0x12, 0xe9, 0x22, 0x85, 0xe8, 0x22, 0xad, 0x81,
+  0x2e, 0x42, 0x92, 0x2e, 0x42, 0x92, 0x3c, 0xa4, 0x29, 0x3c, 0x61, 0x00,
+  0xa0, 0x69, 0x2c, 0xa4, 0x29, 0x42, 0x9a, 0x32, 0x42, 0x1b, 0x28, 0x3c,
+  0x00, 0x56, 0x84, 0x28, 0x2b, 0xa4, 0x28, 0x60, 0x00, 0xf1, 0x01, 0xb8,
+  0x22, 0x94, 0x82, 0x2e, 0x42, 0x5f, 0x75, 0x08, 0x20, 0x88, 0x04, 0x00,
+  0x80, 0x44, 0x02, 0x64, 0x08, 0x42, 0x00, 0x10, 0x02, 0x18, 0x0e, 0x05,
+  0x00, 0x12, 0x00, 0x40, 0x00, 0x00, 0x80, 0x8c, 0x06, 0x00, 0x61, 0x50,
+  0x12, 0x14, 0x3f, 0xad, 0x07, 0x16, 0x00, 0x24, 0x08, 0x88, 0xa1, 0x04,
+  0x04, 0x05, 0x01, 0x01, 0xf7, 0x02, 0x10, 0x01, 0xf1, 0x04, 0x73, 0xf0,
+  0xcb, 0x1c, 0x00, 0x82, 0x28, 0x88, 0x39, 0x06, 0xf0, 0x00, 0x80, 0x82,
+  0x08, 0x20, 0x02, 0x62, 0xa0, 0x24, 0x80, 0x02, 0x14, 0x28, 0x20, 0x02,
+  0x22, 0xe1, 0x06, 0x21, 0x10, 0x01, 0x2c, 0x03, 0xa0, 0x22, 0x40, 0x01,
+  0x6f, 0x7d, 0x0d, 0x20, 0x8c, 0x82, 0x08, 0x72, 0x02, 0x10, 0x22, 0xd1,
+  0x03, 0xa0, 0x24, 0x20, 0x22, 0x21, 0x24, 0x08, 0x00, 0x00, 0x19, 0x02,
+  0x49, 0x00, 0x00, 0x99, 0x02, 0x10, 0x22, 0x43, 0x03, 0x72, 0x64, 0x22,
+  0x40, 0x01, 0x7f, 0xb9, 0x06, 0xa2, 0x05, 0xf4, 0x08, 0x82, 0x00, 0x00,
+  0x10, 0x81, 0x22, 0x08, 0x00, 0x80, 0x02, 0x4e, 0x21, 0x80, 0x02, 0x14,
+  0x00, 0x22, 0x20, 0x02, 0x00, 0x80, 0x04, 0x11, 0xf4, 0x06, 0x32, 0xb0,
+  0x3c, 0x0f, 0x28, 0x09, 0x02, 0x01, 0x00, 0x23, 0x22, 0x88, 0x91, 0x06,
+  0x04, 0x81, 0x07, 0x83, 0x88, 0x00, 0x00, 0xf0, 0x42, 0x2b, 0x00, 0x28,
+  0x3c, 0x06, 0x50, 0x88, 0x20, 0x08, 0x80, 0x22, 0xaa, 0x00, 0x05, 0x6e,
+  0x05, 0x02, 0x81, 0x07, 0x71, 0x20, 0x04, 0xaf, 0xcb, 0x0d, 0x00, 0x00,
+  0x30, 0x05, 0x00, 0x35, 0x00, 0x20, 0x28, 0x82, 0x7b, 0x05, 0x09, 0xce,
+  0x04, 0x60, 0x00, 0x00, 0x48, 0xf0, 0xc8, 0x9e, 0x1a, 0x00, 0x01, 0x31,
+  0x00, 0x01, 0xef, 0x00, 0x13, 0x82, 0xd9, 0x0a, 0x00, 0x81, 0x00, 0x01,
+  0x8f, 0x05, 0x81, 0x08, 0x00, 0x00, 0x7f, 0x6e, 0x09, 0x00, 0x28, 0x12,
+  0x00, 0x13, 0x42, 0x24, 0x04, 0x06, 0x01, 0x00, 0xf0, 0x00, 0x28, 0x00,
+  0x20, 0x02, 0x42, 0x20, 0x02, 0x42, 0x00, 0x8f, 0x81, 0x06, 0x00, 0x18,
+  0x12, 0xac, 0x00, 0x10, 0x20, 0xdc, 0x00, 0x01, 0x4d, 0x00, 0x61, 0x11,
+  0x00, 0x48, 0x00, 0x48, 0x88, 0x90, 0x00, 0x02, 0x57, 0x00, 0x80, 0x80,
+  0x04, 0xaf, 0x88, 0x0e, 0x28, 0x00, 0x28, 0xf2, 0x00, 0x53, 0x08, 0x00,
+  0x20, 0x08, 0x14, 0xad, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x23, 0x00, 0x40,
+  0x20, 0x08, 0x14, 0x48, 0xbb, 0x00, 0xf2, 0x02, 0x28, 0xf0, 0x5c, 0x44,
+  0x00, 0x80, 0xa3, 0x12, 0x80, 0x86, 0x02, 0x00, 0x88, 0x20, 0x04, 0x80,
+  0x0c, 0x29, 0x00, 0x00, 0xa3, 0x01, 0x21, 0x42, 0x82, 0x2a, 0x00, 0xe2,
+  0xa0, 0x2c, 0x40, 0x81, 0x24, 0x02, 0x00, 0x22, 0x42, 0x42, 0x62, 0xd0,
+  0xe1, 0x05, 0xab, 0x07, 0x00, 0x5a, 0x01, 0x03, 0x41, 0x09, 0x16, 0x48,
+  0xaf, 0x08, 0x00, 0x7a, 0x00, 0x34, 0xf0, 0x55, 0x86, 0x0f, 0x00, 0x08,
+  0x01, 0x00, 0x00, 0x48, 0x09, 0x03, 0x28, 0x00, 0x10, 0x9d, 0x86, 0x01,
+  0x01, 0x43, 0x06, 0x00, 0x3a, 0x00, 0x10, 0x42, 0xbe, 0x01, 0x10, 0x42,
+  0xa8, 0x00, 0x25, 0x20, 0x06, 0x8b, 0x01, 0x53, 0x42, 0x00, 0xb0, 0xd7,
+  0x0a, 0x86, 0x08, 0x05, 0x01, 0x00, 0x10, 0x80, 0x12, 0x02, 0x06, 0xaf,
+  0x01, 0x36, 0xf0, 0xba, 0xbc, 0x1a, 0x00, 0x00, 0x1e, 0x01, 0x04, 0x1a,
+  0x00, 0x52, 0x48, 0x00, 0x00, 0x28, 0x68, 0x06, 0x01, 0x36, 0xf0, 0xd9,
+  0x73, 0x28, 0x0c, 0x04, 0x2c, 0x00, 0x20, 0x20, 0x02, 0x3d, 0x0c, 0x05,
+  0x47, 0x00, 0x13, 0x77, 0x68, 0x06, 0x06, 0xc7, 0x00, 0x11, 0x28, 0x92,
+  0x01, 0x04, 0x3d, 0x09, 0x61, 0x48, 0x00, 0x00, 0x7f, 0xb2, 0x07, 0x7e,
+  0x01, 0x00, 0xb9, 0x00, 0x02, 0x13, 0x00, 0x94, 0x80, 0x04, 0x22, 0x20,
+  0x04, 0x42, 0x22, 0x20, 0x06, 0xa5, 0x01, 0x10, 0x42, 0xe2, 0x01, 0x24,
+  0xbc, 0xd7, 0x3b, 0x09, 0x09, 0x01, 0x00, 0x05, 0x6f, 0x00, 0x93, 0x40,
+  0x41, 0xe1, 0xab, 0x06, 0x00, 0x48, 0x20, 0x28, 0xef, 0x02, 0x53, 0x02,
+  0x28, 0x10, 0x02, 0x38, 0x12, 0x0b, 0x90, 0x80, 0x04, 0x00, 0x80, 0x04,
+  0x48, 0x00, 0x80, 0x06, 0x0e, 0x00, 0xa0, 0x21, 0xf0, 0xe4, 0x4d, 0x00,
+  0x82, 0x00, 0x88, 0x82, 0x28, 0x98, 0x00, 0x00, 0x05, 0x00, 0x10, 0x04,
+  0x22, 0x01, 0x63, 0x22, 0x80, 0x84, 0x22, 0x22, 0xa2, 0x62, 0x0a, 0xc0,
   0x22, 0x80, 0x04, 0x42, 0x20, 0x04, 0x20, 0x04, 0x14, 0xf0, 0x72, 0xc7,
-  0x20, 0x22, 0x08, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0xa0, 0x42, 0x20, 0x04, 0x00, 0x00, 0x00, 0x68, 0x00, 0x80, 0x06,
-  0x42, 0x28, 0x00, 0x00, 0x48, 0x20, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00,
-  0x1c, 0x04, 0xff, 0x45, 0x04, 0x00, 0x28, 0x20, 0x02, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x20, 0x02, 0x28, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42, 0x20,
-  0x22, 0x02, 0x28, 0xa0, 0x42, 0x22, 0x00, 0x22, 0x6a, 0x02, 0x2a, 0x06,
-  0xa0, 0x22, 0x28, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0xf0, 0xc6, 0x6c,
-  0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x00, 0x00, 0x20,
-  0x02, 0x22, 0xa0, 0x42, 0xa0, 0x42, 0xa0, 0x42, 0xa0, 0x42, 0xa0, 0x42,
-  0x80, 0x04, 0x48, 0x80, 0x04, 0x00, 0x00, 0x42, 0x20, 0x04, 0x42, 0x20,
-  0x04, 0x42, 0x20, 0x04, 0x42, 0x11, 0x42, 0x48, 0x80, 0x04, 0x8f, 0x94,
-  0x0c, 0x28, 0x2a, 0xa2, 0x22, 0x2a, 0x82, 0xaa, 0x2a, 0x2a, 0xa2, 0x22,
-  0xa0, 0x22, 0x2a, 0xa2, 0x22, 0x00, 0xa0, 0x22, 0x2a, 0xa2, 0x22, 0x22,
-  0x28, 0x68, 0x6a, 0xa6, 0x44, 0x4a, 0x86, 0xa6, 0x66, 0x4a, 0xa4, 0x66,
-  0x2a, 0xa6, 0x44, 0x6a, 0xa6, 0x46, 0xa0, 0x44, 0x4a, 0x04, 0x00, 0xa0,
-  0x44, 0x4a, 0xa4, 0x44, 0x42, 0x48, 0x48, 0x6a, 0x04, 0x48, 0x48, 0x4a,
-  0x04, 0x4a, 0xa4, 0x44, 0x4a, 0x44, 0x81, 0xa4, 0x44, 0x4a, 0xa4, 0x44,
-  0x97, 0x91, 0x80, 0xa2, 0x6e, 0x80, 0x84, 0xa2, 0x2a, 0x00, 0x2a, 0xa2,
-  0x22, 0x00, 0x22, 0xa0, 0x22, 0x00, 0x2a, 0x22, 0x82, 0xc2, 0x62, 0x2b,
-  0x66, 0x2a, 0xb2, 0x12, 0x83, 0xa6, 0xfe, 0x2a, 0x82, 0x88, 0xa4, 0x66,
-  0xd0, 0x11, 0xa2, 0x44, 0x4e, 0x41, 0x4a, 0x04, 0x42, 0xa0, 0x44, 0x00,
-  0x4a, 0x24, 0x84, 0x84, 0xa4, 0x64, 0x4a, 0xa4, 0x62, 0x48, 0x4a, 0xa6,
-  0x44, 0x00, 0x1b, 0x44, 0x4e, 0x41, 0x2c, 0xb4, 0x42, 0x04, 0x21, 0x5f,
-  0x56, 0x04, 0x22, 0x68, 0x00, 0x22, 0x28, 0x00, 0x2a, 0x02, 0x00, 0x28,
-  0x00, 0x00, 0x22, 0x28, 0x20, 0x96, 0x42, 0x2a, 0x82, 0x21, 0x86, 0xac,
+  0x08, 0x02, 0x04, 0xd3, 0x00, 0x31, 0x28, 0xa0, 0x42, 0xc7, 0x02, 0x60,
+  0x68, 0x00, 0x80, 0x06, 0x42, 0x28, 0xa0, 0x01, 0x02, 0x1e, 0x03, 0x41,
+  0x1c, 0x04, 0xff, 0x45, 0x46, 0x00, 0x01, 0x91, 0x00, 0x01, 0x56, 0x00,
+  0x10, 0x00, 0x43, 0x00, 0xd1, 0x22, 0x02, 0x28, 0xa0, 0x42, 0x22, 0x00,
+  0x22, 0x6a, 0x02, 0x2a, 0x06, 0xa0, 0x5c, 0x00, 0x00, 0x98, 0x03, 0x52,
+  0xc6, 0x6c, 0x80, 0x02, 0x28, 0x03, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x22,
+  0xa0, 0x42, 0x02, 0x00, 0x30, 0x80, 0x04, 0x48, 0x5c, 0x01, 0x20, 0x42,
+  0x20, 0x7f, 0x00, 0x00, 0x03, 0x00, 0xf1, 0x0a, 0x11, 0x42, 0x48, 0x80,
+  0x04, 0x8f, 0x94, 0x0c, 0x28, 0x2a, 0xa2, 0x22, 0x2a, 0x82, 0xaa, 0x2a,
+  0x2a, 0xa2, 0x22, 0xa0, 0x22, 0x2a, 0xa2, 0x22, 0x00, 0x06, 0x00, 0xf0,
+  0x1e, 0x22, 0x28, 0x68, 0x6a, 0xa6, 0x44, 0x4a, 0x86, 0xa6, 0x66, 0x4a,
+  0xa4, 0x66, 0x2a, 0xa6, 0x44, 0x6a, 0xa6, 0x46, 0xa0, 0x44, 0x4a, 0x04,
+  0x00, 0xa0, 0x44, 0x4a, 0xa4, 0x44, 0x42, 0x48, 0x48, 0x6a, 0x04, 0x48,
+  0x48, 0x4a, 0x04, 0x4a, 0xa4, 0x44, 0x4a, 0x44, 0x81, 0xa4, 0x14, 0x00,
+  0xa0, 0x97, 0x91, 0x80, 0xa2, 0x6e, 0x80, 0x84, 0xa2, 0x2a, 0x00, 0x44,
+  0x00, 0xf0, 0x2f, 0x22, 0xa0, 0x22, 0x00, 0x2a, 0x22, 0x82, 0xc2, 0x62,
+  0x2b, 0x66, 0x2a, 0xb2, 0x12, 0x83, 0xa6, 0xfe, 0x2a, 0x82, 0x88, 0xa4,
+  0x66, 0xd0, 0x11, 0xa2, 0x44, 0x4e, 0x41, 0x4a, 0x04, 0x42, 0xa0, 0x44,
+  0x00, 0x4a, 0x24, 0x84, 0x84, 0xa4, 0x64, 0x4a, 0xa4, 0x62, 0x48, 0x4a,
+  0xa6, 0x44, 0x00, 0x1b, 0x44, 0x4e, 0x41, 0x2c, 0xb4, 0x42, 0x04, 0x21,
+  0x5f, 0x56, 0x04, 0x22, 0x68, 0x8e, 0x0b, 0x20, 0x2a, 0x02, 0xf0, 0x00,
+  0xf0, 0x0f, 0x22, 0x28, 0x20, 0x96, 0x42, 0x2a, 0x82, 0x21, 0x86, 0xac,
   0x22, 0x20, 0x84, 0xa4, 0x22, 0x14, 0x6a, 0x04, 0xa0, 0x44, 0x48, 0x00,
-  0x00, 0x42, 0x2a, 0x06, 0x42, 0xa0, 0x46, 0x28, 0x42, 0xa0, 0x44, 0x00,
+  0x00, 0x42, 0x2a, 0x06, 0x42, 0xa0, 0x46, 0x28, 0x48, 0x00, 0xf0, 0x02,
   0xa0, 0x44, 0x42, 0x29, 0x04, 0xf0, 0xa5, 0x6d, 0x20, 0xa2, 0x68, 0x2a,
-  0x22, 0x24, 0x8a, 0xa2, 0x22, 0x00, 0x2a, 0xa2, 0x22, 0x80, 0x02, 0x22,
+  0x22, 0x24, 0x8a, 0xa2, 0x22, 0x80, 0x00, 0xf0, 0x13, 0x80, 0x02, 0x22,
   0xa0, 0x22, 0x22, 0x28, 0x20, 0xb6, 0x22, 0xe6, 0x24, 0x84, 0x21, 0xa6,
   0xe3, 0x4a, 0x24, 0xa8, 0x26, 0x2a, 0xa6, 0x44, 0x14, 0x28, 0x1b, 0x44,
-  0x28, 0x4a, 0x84, 0x06, 0x42, 0xa0, 0x64, 0x42, 0x2a, 0x06, 0x42, 0x4a,
+  0x28, 0x4a, 0x84, 0x06, 0x42, 0xa0, 0x64, 0x42, 0x00, 0xf8, 0x03, 0x4a,
   0x84, 0x82, 0x22, 0xa4, 0x46, 0x00, 0x4a, 0xa4, 0x44, 0x20, 0x94, 0x42,
-  0x4e, 0x42, 0xf0, 0x77, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
-  0x00, 0x20, 0x02, 0x22, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xee, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x9d,
-  0x08, 0x2a, 0xb4, 0x11, 0x22, 0xb2, 0x11, 0x22, 0xb6, 0x11, 0x32, 0x62,
-  0x19, 0xb2, 0x62, 0x91, 0x21, 0x2b, 0x96, 0x19, 0xb2, 0x42, 0x19, 0xb1,
-  0x42, 0x29, 0xf2, 0x42, 0xb1, 0x22, 0x2f, 0x14, 0x2b, 0xf2, 0x42, 0xb1,
-  0x2a, 0xe4, 0x14, 0xeb, 0x22, 0xe4, 0x14, 0xea, 0x22, 0xe4, 0x15, 0xe2,
-  0x22, 0xe4, 0x1d, 0xe2, 0x22, 0xe4, 0x1d, 0xc2, 0x42, 0xda, 0xc2, 0x42,
-  0x1b, 0x2d, 0x2c, 0xb4, 0x91, 0x42, 0xb2, 0x91, 0x22, 0xb4, 0x91, 0x36,
-  0x42, 0x1b, 0x68, 0x23, 0x94, 0x61, 0x2b, 0x84, 0x19, 0xb6, 0x42, 0x98,
-  0x41, 0x2b, 0x84, 0x2a, 0xb4, 0x42, 0xa8, 0x42, 0x2b, 0x84, 0x2a, 0xb4,
-  0x42, 0xa8, 0x42, 0x4a, 0xe8, 0x22, 0xf4, 0xde, 0x39, 0x80, 0xb4, 0x11,
-  0x84, 0x34, 0x11, 0x42, 0x13, 0x31, 0x42, 0x11, 0x2b, 0x14, 0x11, 0x2b,
-  0x94, 0x11, 0x2b, 0xb4, 0x11, 0x2b, 0xb4, 0xf0, 0x42, 0x91, 0xf0, 0x42,
-  0x91, 0xd0, 0x12, 0x19, 0xd2, 0x12, 0xc9, 0x12, 0x1c, 0xc9, 0x82, 0x1e,
-  0x81, 0x24, 0x96, 0x41, 0x62, 0x19, 0x34, 0x9e, 0x21, 0x24, 0x1b, 0x29,
-  0x24, 0x1b, 0x69, 0x24, 0x1b, 0x69, 0xb0, 0x91, 0x12, 0xb2, 0x81, 0x12,
-  0x92, 0x21, 0x29, 0x98, 0x21, 0x29, 0x9a, 0x21, 0x29, 0x28, 0x92, 0x82,
-  0x22, 0x29, 0x28, 0x92, 0x82, 0x23, 0x92, 0x82, 0x26, 0xf2, 0xbe, 0x84,
-  0x00, 0x82, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0xc0, 0x81, 0x40, 0x01, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x50, 0x12,
-  0xf0, 0x84, 0xa1, 0x00, 0x00, 0x00, 0x18, 0x00, 0x22, 0x80, 0x82, 0x08,
-  0x00, 0x20, 0x88, 0x08, 0x80, 0x02, 0x00, 0x00, 0x28, 0x00, 0x20, 0x04,
-  0x00, 0x22, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x88,
-  0x00, 0x22, 0x00, 0x80, 0xf8, 0xef, 0xfc, 0x20, 0x21, 0x88, 0x01, 0x2a,
-  0x08, 0x38, 0x88, 0x20, 0x04, 0x00, 0x00, 0x80, 0x02, 0x28, 0x88, 0x00,
-  0x22, 0x20, 0x02, 0x42, 0x00, 0x20, 0x22, 0x02, 0x22, 0x00, 0x28, 0x00,
-  0x20, 0x02, 0x48, 0x00, 0x00, 0x24, 0x00, 0x80, 0x82, 0x02, 0x60, 0x14,
-  0x11, 0x46, 0x21, 0xf2, 0x68, 0x29, 0x00, 0xc2, 0x12, 0x00, 0x00, 0x88,
-  0x28, 0x48, 0x22, 0x20, 0x02, 0x00, 0x82, 0x00, 0x60, 0x22, 0x20, 0x22,
-  0x21, 0x22, 0x08, 0x00, 0xa0, 0x42, 0x19, 0x02, 0x22, 0x22, 0xa0, 0x24,
-  0x00, 0x22, 0x22, 0x20, 0x04, 0x00, 0x60, 0x22, 0x00, 0x00, 0x22, 0x20,
-  0xc2, 0x42, 0x14, 0x14, 0x82, 0x5f, 0x88, 0x0d, 0x18, 0x00, 0xa0, 0x82,
-  0x12, 0x2a, 0x01, 0x00, 0x20, 0x08, 0x00, 0x80, 0x22, 0x88, 0x22, 0x08,
-  0x00, 0x00, 0xa0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x14, 0x20, 0x24, 0xf2, 0x8d,
-  0xea, 0x20, 0x02, 0x80, 0xa2, 0x12, 0x80, 0x81, 0x22, 0x02, 0x00, 0x00,
-  0x00, 0x28, 0x80, 0x0a, 0x00, 0x42, 0x00, 0x20, 0x04, 0x28, 0x00, 0x22,
-  0x42, 0x20, 0x24, 0x02, 0x00, 0x22, 0x48, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x02, 0x28, 0xf0, 0xdd, 0x6c, 0x00, 0x28, 0x2a, 0x01,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x80, 0x08, 0x00, 0x2a, 0x04, 0x22,
-  0x80, 0x0c, 0xa0, 0x24, 0x8a, 0x04, 0x4a, 0x02, 0x88, 0x22, 0x80, 0x81,
-  0x02, 0x00, 0x20, 0x82, 0x84, 0x02, 0x28, 0x13, 0x04, 0x80, 0x08, 0x00,
-  0x80, 0x84, 0x24, 0x82, 0x24, 0xf2, 0xa4, 0x13, 0x00, 0x00, 0x80, 0x02,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x2a, 0x04, 0x2a, 0x04,
-  0xc8, 0x80, 0x84, 0x84, 0x04, 0x28, 0x80, 0x04, 0x48, 0x18, 0x22, 0x00,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x80, 0x08, 0x00, 0x20, 0x84, 0x02, 0x28,
-  0xf0, 0x8e, 0x1b, 0x80, 0x82, 0x22, 0x83, 0x22, 0x01, 0x80, 0x82, 0x02,
-  0x22, 0x00, 0x00, 0x20, 0x08, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x20, 0x22,
-  0x0a, 0x42, 0x22, 0x88, 0x22, 0x80, 0x02, 0x00, 0x28, 0x42, 0x22, 0x42,
-  0x42, 0x20, 0x62, 0x14, 0x00, 0x00, 0x00, 0x00, 0x48, 0x28, 0x42, 0x22,
-  0xff, 0x97, 0x0b, 0x12, 0x00, 0x82, 0x28, 0x42, 0x20, 0x0a, 0x80, 0x82,
-  0x22, 0x22, 0x08, 0x80, 0xa2, 0x21, 0x42, 0x00, 0x00, 0x82, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x80, 0x02, 0x42, 0x80, 0x02, 0x24, 0x00, 0x48, 0x22,
-  0x48, 0x82, 0x22, 0x80, 0x24, 0x02, 0x40, 0x21, 0x04, 0x42, 0x00, 0xef,
-  0xda, 0x0c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4a, 0x08, 0x22, 0x00,
-  0x00, 0x00, 0x22, 0x80, 0x04, 0x48, 0x00, 0x20, 0x82, 0x02, 0x20, 0x04,
-  0x00, 0x48, 0x42, 0x00, 0x00, 0x14, 0x42, 0x20, 0x04, 0x42, 0x13, 0x02,
-  0x00, 0x00, 0x80, 0x02, 0x80, 0x24, 0xf4, 0x34, 0x3e, 0x00, 0x00, 0xa2,
-  0x00, 0x28, 0xc8, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x08, 0x00, 0x00,
-  0x28, 0x80, 0x82, 0x84, 0x04, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x48,
-  0x00, 0x22, 0x00, 0x20, 0x02, 0x42, 0x00, 0x48, 0x42, 0x14, 0x00, 0x00,
-  0xe0, 0x7c, 0x04, 0x38, 0x00, 0x80, 0x02, 0x28, 0x68, 0x20, 0xa2, 0xc2,
-  0x00, 0x00, 0x1a, 0x22, 0x22, 0x83, 0x88, 0x02, 0x00, 0x88, 0x28, 0x80,
-  0x02, 0x62, 0x12, 0x28, 0x48, 0x80, 0x22, 0x22, 0x24, 0x02, 0x22, 0x42,
-  0x10, 0x83, 0x22, 0x24, 0x22, 0xa4, 0x82, 0x11, 0x42, 0x48, 0x28, 0x42,
-  0x00, 0x22, 0x20, 0x24, 0x84, 0xf4, 0x37, 0x9d, 0x00, 0x00, 0x28, 0x80,
-  0x04, 0x00, 0x00, 0x28, 0x20, 0x08, 0x00, 0x20, 0x04, 0x80, 0x04, 0x48,
-  0x00, 0xa0, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80,
-  0x04, 0x48, 0x00, 0x00, 0x80, 0x04, 0x48, 0x00, 0x00, 0x4f, 0x9b, 0x0c,
-  0x00, 0x12, 0x80, 0x81, 0x21, 0x82, 0x02, 0x00, 0x00, 0x00, 0x28, 0x20,
-  0x22, 0x02, 0x00, 0x42, 0x00, 0x00, 0x28, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x20, 0x84, 0x24, 0x02, 0x42, 0x48, 0x00, 0x00, 0x00, 0x28, 0x22, 0x00,
-  0x42, 0x00, 0x80, 0xf6, 0xc1, 0x3f, 0x00, 0x28, 0x22, 0x18, 0x00, 0x18,
-  0x00, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x28, 0x00, 0x28, 0x22, 0x00,
-  0x22, 0x80, 0x24, 0x04, 0x00, 0x42, 0x80, 0x04, 0x00, 0x22, 0x42, 0x42,
-  0x20, 0x02, 0x80, 0x04, 0x80, 0x04, 0x20, 0x82, 0x02, 0x20, 0x62, 0x16,
-  0xf0, 0x16, 0x9e, 0x00, 0x20, 0x01, 0x38, 0x28, 0x00, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x24, 0x02, 0x00, 0x48, 0x00, 0x00, 0x80, 0x04,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x28, 0x80, 0x02, 0x80, 0x02, 0x42,
-  0x48, 0x42, 0x68, 0x80, 0x04, 0xf0, 0x42, 0x57, 0x00, 0x12, 0x22, 0x28,
-  0x20, 0x08, 0x20, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x48, 0x20,
-  0x04, 0x22, 0x42, 0x48, 0x80, 0x22, 0x22, 0x22, 0x06, 0x28, 0x20, 0x84,
-  0x24, 0x02, 0x00, 0x28, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04,
-  0x48, 0xf0, 0xd7, 0x4d, 0x20, 0x02, 0x00, 0x00, 0x32, 0x00, 0x80, 0x02,
-  0x00, 0x22, 0x00, 0x00, 0x00, 0x42, 0x28, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x42, 0x48, 0x42, 0x00, 0x28, 0x48, 0x22, 0x00, 0x00,
-  0x42, 0x22, 0x11, 0x00, 0x22, 0x80, 0x02, 0x9f, 0xba, 0x0c, 0x20, 0x02,
-  0x00, 0x18, 0x20, 0x02, 0x00, 0x20, 0x82, 0x02, 0x00, 0x28, 0x22, 0x00,
-  0x28, 0x42, 0x00, 0x68, 0x80, 0x86, 0x04, 0x42, 0x48, 0x00, 0x2a, 0x04,
-  0x00, 0x22, 0x00, 0x48, 0x20, 0x24, 0x02, 0x20, 0x82, 0x82, 0x24, 0x02,
-  0x00, 0x22, 0x00, 0x00, 0x4f, 0xcb, 0x0e, 0x00, 0x20, 0x02, 0x28, 0x00,
-  0x20, 0x02, 0x00, 0x28, 0x00, 0x22, 0x00, 0x20, 0x02, 0x20, 0x84, 0x04,
-  0x22, 0x00, 0x42, 0x00, 0x28, 0x2a, 0x04, 0x00, 0x68, 0x20, 0x02, 0x20,
-  0x04, 0x80, 0x84, 0x06, 0x00, 0x00, 0xa0, 0x24, 0x00, 0x48, 0x00, 0x2d,
-  0x4d, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
-  0x28, 0x28, 0x00, 0x00, 0x00, 0x20, 0x02, 0x28, 0x00, 0x00, 0x00, 0x22,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x82, 0x04, 0x22, 0x10, 0x81, 0x82,
-  0x42, 0x01, 0x7f, 0x22, 0x01, 0x22, 0x12, 0x48, 0x18, 0x00, 0x00, 0x28,
-  0x20, 0x22, 0x02, 0x28, 0x20, 0x02, 0x00, 0x80, 0x04, 0x21, 0x80, 0x05,
-  0xc8, 0x00, 0x28, 0x48, 0x22, 0x46, 0x01, 0x48, 0x42, 0x80, 0x04, 0x20,
-  0x02, 0x00, 0x42, 0x22, 0x00, 0x28, 0x00, 0x48, 0x42, 0x11, 0x20, 0x04,
-  0x21, 0x48, 0xff, 0xa9, 0x08, 0x22, 0x28, 0x12, 0x3a, 0xa2, 0x11, 0x1a,
-  0x22, 0x83, 0x02, 0x28, 0x00, 0x00, 0x2a, 0x22, 0xa2, 0x22, 0xa0, 0x22,
-  0x22, 0xa0, 0x26, 0x68, 0x48, 0x4a, 0xa4, 0x26, 0x42, 0x22, 0xa0, 0x22,
-  0x42, 0x28, 0x80, 0xa2, 0x24, 0x00, 0x22, 0x42, 0x68, 0x68, 0xa0, 0x44,
-  0x4a, 0x82, 0x02, 0x4a, 0x22, 0x02, 0x48, 0xa0, 0x62, 0x62, 0x13, 0x02,
-  0x4a, 0x24, 0xe4, 0x14, 0x02, 0x6f, 0xeb, 0x0a, 0x20, 0xa2, 0x22, 0x18,
-  0x22, 0x2a, 0x01, 0x80, 0x22, 0x22, 0x02, 0x22, 0x00, 0x00, 0x2a, 0x02,
-  0x28, 0x80, 0x24, 0xa4, 0x24, 0x00, 0x48, 0x4a, 0xa2, 0x42, 0x42, 0x28,
-  0x62, 0x62, 0x2a, 0x24, 0x22, 0x24, 0x82, 0x82, 0x24, 0x26, 0x86, 0x24,
-  0x22, 0x22, 0x82, 0x84, 0x04, 0xa0, 0x26, 0x48, 0x80, 0x84, 0x64, 0x16,
-  0x2a, 0x82, 0xe6, 0x12, 0x84, 0xf4, 0xf9, 0x57, 0x80, 0xa2, 0x11, 0x18,
-  0x80, 0x02, 0x38, 0x22, 0x22, 0x80, 0xa2, 0x22, 0x00, 0x80, 0x02, 0x00,
-  0xa0, 0x66, 0x20, 0x02, 0x80, 0xa4, 0x22, 0x48, 0x4a, 0x82, 0xa4, 0x42,
-  0x48, 0x68, 0x42, 0x48, 0x48, 0x48, 0xa0, 0x22, 0x00, 0x42, 0x80, 0xa4,
-  0x44, 0x6a, 0x22, 0x02, 0x00, 0x6a, 0x22, 0x84, 0xa2, 0x24, 0x68, 0x20,
-  0x02, 0x4a, 0xf2, 0xa8, 0x34, 0x00, 0x22, 0x20, 0x02, 0x2a, 0x01, 0x22,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x28, 0x00, 0xa0, 0x24, 0x00, 0xa0, 0x24,
-  0xa0, 0x24, 0x00, 0x20, 0x04, 0x20, 0x22, 0x04, 0x00, 0x20, 0x82, 0x04,
-  0x48, 0x22, 0x48, 0x00, 0x00, 0x28, 0x48, 0x80, 0x04, 0x20, 0x04, 0x42,
-  0x97, 0x21, 0xa0, 0x19, 0x3a, 0xa3, 0x11, 0xa0, 0x82, 0xa8, 0xa0, 0x22,
-  0x22, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0x80, 0xa2, 0x22, 0x42, 0x2a,
-  0xa2, 0x22, 0x4a, 0x02, 0x42, 0x62, 0x28, 0xa0, 0x24, 0x2a, 0x82, 0x82,
-  0xa2, 0x22, 0x2a, 0xa2, 0x22, 0x2a, 0x02, 0x48, 0x2a, 0xa2, 0x22, 0x80,
-  0x04, 0x00, 0x00, 0x20, 0x82, 0x36, 0x41, 0x2e, 0x61, 0x2a, 0xa2, 0x22,
-  0x6a, 0xe2, 0x12, 0xf6, 0xb7, 0xb4, 0xa0, 0x11, 0x7a, 0xa5, 0x11, 0x58,
-  0x12, 0x12, 0x1a, 0x81, 0x02, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x28,
-  0x24, 0x23, 0x02, 0x2b, 0x37, 0x2a, 0xa2, 0xfc, 0x2a, 0xa4, 0xa6, 0x20,
-  0x84, 0xf2, 0x61, 0x61, 0x2a, 0xc2, 0x21, 0x42, 0x6a, 0xa6, 0x62, 0x2a,
-  0xa2, 0x22, 0x20, 0xa4, 0x22, 0x2a, 0xa2, 0x22, 0x62, 0x00, 0x28, 0x00,
-  0x2a, 0x82, 0x04, 0x19, 0xa2, 0x22, 0x2e, 0x22, 0x2b, 0x22, 0x2a, 0xb2,
-  0x22, 0xf2, 0x96, 0x93, 0x00, 0x3a, 0xa7, 0x11, 0x18, 0x92, 0x1a, 0x01,
-  0x2a, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00, 0x22, 0x20, 0xb2, 0x22, 0x82,
-  0x84, 0x81, 0xa4, 0xa6, 0xa0, 0x44, 0x2a, 0x24, 0x82, 0xe4, 0x16, 0xa2,
-  0x22, 0x28, 0x2a, 0x86, 0x84, 0xa4, 0x22, 0x2a, 0xa2, 0x42, 0x00, 0x80,
-  0xa4, 0x22, 0x00, 0x28, 0x00, 0x2a, 0x22, 0x22, 0x06, 0x2e, 0x21, 0x2a,
-  0xb2, 0x22, 0xa2, 0x22, 0xf0, 0x47, 0xa5, 0xa0, 0x2a, 0x2a, 0xa5, 0x11,
-  0x4a, 0x22, 0xa2, 0xa1, 0x3a, 0x83, 0x22, 0x82, 0x02, 0x28, 0x00, 0x20,
-  0x02, 0x22, 0x20, 0x02, 0x2b, 0x42, 0x2e, 0x22, 0x58, 0x48, 0x7a, 0xae,
-  0x42, 0xea, 0xa6, 0x22, 0x48, 0x2a, 0xe4, 0x16, 0xa6, 0x22, 0x19, 0x26,
-  0xa6, 0x44, 0xa0, 0x22, 0x22, 0x42, 0x20, 0x04, 0x6a, 0x22, 0x22, 0x84,
-  0x02, 0x20, 0xa4, 0x22, 0x42, 0x20, 0x86, 0xa6, 0x22, 0x2b, 0x24, 0x6e,
-  0x22, 0x48, 0xbf, 0xbf, 0x04, 0x00, 0x18, 0xa0, 0x12, 0x88, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xa0, 0x24, 0x20, 0x04, 0x00, 0x00, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x48, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x28, 0x80, 0x02, 0x5f, 0xd8, 0x07, 0x22, 0x00, 0x28,
-  0x00, 0x2a, 0x01, 0x80, 0x22, 0x02, 0x00, 0x00, 0x28, 0x00, 0x00, 0x80,
-  0x02, 0x42, 0x80, 0xa2, 0x42, 0x20, 0x22, 0x24, 0x22, 0x24, 0x22, 0x04,
-  0x00, 0x00, 0x28, 0x42, 0x20, 0x02, 0x62, 0x00, 0x20, 0x04, 0x4a, 0x02,
-  0x42, 0x00, 0x48, 0x42, 0xf0, 0xff, 0xea, 0xa0, 0x42, 0x1b, 0x21, 0x22,
-  0x1b, 0x29, 0x62, 0x1b, 0x21, 0x2b, 0x16, 0x19, 0xb2, 0x42, 0x91, 0x21,
-  0x2b, 0x94, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0x42, 0x29, 0xf2, 0x42, 0xb1,
-  0x22, 0x2f, 0x14, 0x2b, 0xf2, 0x42, 0x91, 0x2a, 0xc4, 0xb1, 0x2e, 0x42,
-  0x4e, 0x81, 0x2e, 0x42, 0x5e, 0x21, 0x2e, 0x42, 0x9e, 0x21, 0x2e, 0x42,
-  0xd6, 0xc1, 0x42, 0x9a, 0xe2, 0x22, 0xb4, 0xd1, 0xc2, 0x42, 0x1b, 0x29,
-  0x24, 0x1b, 0x29, 0x62, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x36, 0x62, 0x19,
-  0xb6, 0x42, 0x98, 0x61, 0x2b, 0x84, 0x11, 0x2b, 0x84, 0x22, 0x2b, 0xa4,
-  0x2a, 0xb4, 0x42, 0xa8, 0x42, 0x2b, 0x84, 0x2a, 0xa4, 0x84, 0x2e, 0x42,
-  0x3f, 0x11, 0x04, 0x48, 0x1b, 0x41, 0x48, 0x13, 0x21, 0x34, 0x11, 0x23,
-  0x14, 0xb1, 0x42, 0x91, 0x21, 0x2b, 0x94, 0x19, 0xb2, 0x42, 0x1b, 0xb1,
-  0x42, 0x0b, 0x2f, 0x14, 0x09, 0x2f, 0x14, 0x29, 0xd2, 0x12, 0x19, 0xd2,
-  0x12, 0xe9, 0x22, 0xc5, 0x91, 0x2e, 0x82, 0x1e, 0x81, 0x2c, 0x64, 0x19,
-  0x2e, 0x42, 0x96, 0x41, 0xe3, 0x19, 0xc2, 0x42, 0x1b, 0x29, 0x24, 0x1b,
-  0x49, 0x24, 0x1b, 0x69, 0x42, 0x13, 0x39, 0x42, 0x13, 0x18, 0x92, 0x21,
-  0x29, 0x98, 0x21, 0x2b, 0xa4, 0x11, 0x2b, 0xa4, 0x22, 0x2b, 0x84, 0x22,
-  0x2b, 0x84, 0x22, 0x29, 0xb8, 0x22, 0x94, 0x82, 0x2c, 0xf4, 0xf1, 0xfd,
-  0x00, 0x82, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x02, 0x4a, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x12, 0xf0, 0x15,
-  0x11, 0x00, 0x80, 0x01, 0x22, 0x28, 0x00, 0x80, 0x08, 0x32, 0x00, 0x80,
-  0x02, 0x00, 0xa0, 0x24, 0x46, 0x81, 0x22, 0x22, 0x02, 0x28, 0x42, 0x90,
-  0x21, 0x4a, 0x02, 0x62, 0x00, 0x80, 0x02, 0x24, 0x42, 0x60, 0x22, 0x28,
-  0x00, 0x22, 0x28, 0x00, 0xa0, 0x82, 0x82, 0x28, 0x68, 0x00, 0x68, 0x62,
-  0xf0, 0x88, 0xf9, 0x20, 0x21, 0x09, 0x12, 0x20, 0x01, 0x22, 0x00, 0x22,
-  0x48, 0x00, 0x11, 0x00, 0x12, 0x20, 0x02, 0x22, 0x42, 0x48, 0xa0, 0x24,
-  0x20, 0x82, 0x22, 0x04, 0x48, 0x80, 0x82, 0x22, 0x04, 0x00, 0x00, 0x42,
-  0x42, 0x42, 0x82, 0x13, 0x04, 0x00, 0x11, 0x14, 0x00, 0x20, 0x26, 0x44,
-  0x41, 0x81, 0xb4, 0x52, 0x0a, 0x18, 0xca, 0x01, 0x12, 0x00, 0x80, 0x02,
-  0x00, 0x3a, 0x24, 0x02, 0x14, 0x28, 0x80, 0x01, 0xc0, 0x42, 0x4a, 0x22,
-  0xa6, 0x21, 0xa0, 0x4a, 0x22, 0x4a, 0x02, 0x11, 0x22, 0x11, 0x22, 0x00,
-  0x20, 0x06, 0x80, 0x04, 0x46, 0xa2, 0x24, 0x48, 0x82, 0x1c, 0x86, 0x22,
-  0x02, 0x11, 0x28, 0x88, 0x80, 0x24, 0x64, 0x24, 0x2a, 0x64, 0x12, 0xf0,
-  0x57, 0x92, 0x00, 0x80, 0x01, 0x22, 0x1a, 0x02, 0x00, 0x82, 0x22, 0x00,
-  0x00, 0x00, 0x00, 0x22, 0x28, 0x11, 0x80, 0x84, 0x02, 0x00, 0x28, 0x2a,
-  0x24, 0x84, 0x24, 0x24, 0x82, 0x82, 0x04, 0x00, 0x21, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x60, 0x18, 0x20, 0x82, 0x22, 0x02, 0x14, 0x42, 0x48, 0xcf,
-  0xb7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x4f, 0x1a,
-  0x08, 0x18, 0x00, 0x12, 0x80, 0x02, 0x00, 0x20, 0x04, 0x82, 0x80, 0x08,
-  0x00, 0x00, 0x20, 0x34, 0x81, 0x22, 0x00, 0x80, 0x02, 0x40, 0x01, 0x00,
-  0x20, 0x04, 0x00, 0x10, 0x01, 0x80, 0x04, 0x42, 0x20, 0x04, 0x42, 0x00,
-  0x00, 0x00, 0x00, 0xd0, 0xee, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x82, 0x20, 0x08, 0x00, 0x00, 0x80, 0x64, 0x18, 0x00, 0x48, 0x80,
-  0x02, 0x40, 0x01, 0x00, 0x00, 0x22, 0x00, 0x10, 0x01, 0x20, 0x04, 0x10,
-  0x01, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfb, 0x02, 0x00, 0x80,
-  0x01, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x22,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x42,
-  0x20, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00, 0x70, 0x68, 0x07, 0x28, 0x00,
-  0x80, 0x02, 0xa0, 0x81, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x28, 0x18, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x14, 0x82, 0x00, 0x00, 0x2c, 0x02, 0x42, 0x28, 0x80, 0xf2,
-  0x59, 0xf3, 0x80, 0x01, 0x20, 0x08, 0x18, 0x22, 0x20, 0x22, 0x82, 0x08,
-  0x28, 0x00, 0x00, 0x12, 0xa2, 0x20, 0x02, 0x00, 0x48, 0x22, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x22, 0x80,
-  0x04, 0x00, 0x00, 0x80, 0x04, 0x2f, 0x4d, 0x09, 0x00, 0x20, 0x08, 0x00,
-  0x88, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x20, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04,
-  0x00, 0x00, 0x00, 0x20, 0x04, 0x88, 0x6f, 0x8e, 0x02, 0x38, 0x00, 0x80,
-  0x82, 0x81, 0x22, 0x01, 0x22, 0x82, 0x42, 0x00, 0x00, 0x20, 0x81, 0x08,
-  0x22, 0x00, 0x80, 0x84, 0x02, 0x20, 0x22, 0x25, 0x04, 0x80, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x82, 0x80, 0x04, 0xc0, 0x22, 0x80,
-  0x24, 0x26, 0xa4, 0x28, 0xcf, 0x38, 0x0d, 0x82, 0x00, 0x00, 0x00, 0x20,
-  0x02, 0x22, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x11, 0x00, 0x00,
-  0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x20, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0xf1, 0x33, 0x3a, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x22, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00,
-  0x22, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20,
-  0x04, 0x00, 0x17, 0x3a, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0xbf,
-  0x3a, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x28, 0x00, 0x00, 0x80, 0x02, 0xbf,
-  0xf5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x27, 0x04, 0x00, 0x28, 0x20, 0x01,
-  0x22, 0x20, 0x02, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x02, 0x00, 0x80, 0x02, 0x00, 0x28, 0x00, 0x20, 0x02, 0x22, 0x20,
-  0x02, 0x80, 0x02, 0x00, 0x00, 0x00, 0x80, 0x04, 0x9f, 0xc1, 0x0f, 0x20,
-  0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf0, 0xb8, 0xd2, 0x80, 0x01, 0x48,
-  0x00, 0x82, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x28, 0x10,
-  0x02, 0x38, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x19, 0x12, 0x81, 0x02, 0x21, 0xf0,
-  0xd6, 0x34, 0x80, 0x21, 0x28, 0x01, 0x1a, 0x28, 0x88, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x02, 0x22, 0x00, 0x22,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x11, 0x42, 0x40, 0x01, 0x2d, 0xfb, 0x20, 0x22, 0x08, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x22, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x22,
-  0x00, 0x00, 0x80, 0x02, 0x2e, 0x41, 0xf0, 0x7f, 0xa6, 0x00, 0x80, 0x02,
-  0x22, 0x20, 0x01, 0x00, 0x80, 0x02, 0x80, 0x02, 0x22, 0x80, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x28, 0x20, 0x02, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x20, 0x02, 0x28, 0x00, 0x00, 0xf0, 0x35, 0x38,
-  0xa0, 0x21, 0xa0, 0x21, 0xa0, 0x21, 0x80, 0x02, 0x28, 0x80, 0x02, 0x00,
-  0x00, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22, 0x20,
-  0x82, 0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28,
-  0x00, 0x00, 0x20, 0x02, 0x22, 0x14, 0x2a, 0x04, 0x2a, 0x04, 0x8f, 0x17,
-  0x0e, 0x8a, 0xa3, 0x33, 0x2a, 0xa2, 0x33, 0x9a, 0xa3, 0x2a, 0x3a, 0xa3,
-  0x22, 0xa0, 0x22, 0x2a, 0x02, 0x00, 0x28, 0x2a, 0xa2, 0x22, 0x2a, 0x22,
-  0x82, 0x82, 0xa2, 0x22, 0x80, 0x82, 0xa2, 0x22, 0xa0, 0x22, 0x2a, 0xa2,
-  0x22, 0x80, 0xa2, 0x22, 0x2a, 0xa2, 0x22, 0x28, 0x2a, 0xa2, 0x22, 0x2a,
-  0x82, 0xa2, 0x22, 0x2a, 0xa2, 0x22, 0xa0, 0x22, 0x2a, 0xa2, 0x22, 0x00,
-  0x28, 0x2a, 0xa2, 0x22, 0x2a, 0x32, 0x21, 0x28, 0x68, 0x6a, 0xa6, 0x44,
-  0x4e, 0x61, 0x2f, 0x84, 0x0a, 0x38, 0x7a, 0xa7, 0x11, 0x48, 0x28, 0xba,
-  0x03, 0xa0, 0x22, 0x2a, 0xa2, 0x22, 0xa0, 0x22, 0x80, 0x02, 0xa0, 0x22,
-  0x22, 0x28, 0x2c, 0xb2, 0x22, 0xa2, 0x22, 0x2b, 0x31, 0x28, 0xaa, 0xab,
-  0x22, 0x88, 0xa0, 0x22, 0x2a, 0xd2, 0x11, 0xa2, 0x22, 0x14, 0x80, 0xa2,
-  0x66, 0x80, 0x84, 0xa2, 0x22, 0x00, 0x2a, 0xa2, 0x22, 0x00, 0x2a, 0x02,
-  0x28, 0x00, 0x2a, 0x32, 0x21, 0x1c, 0xc2, 0x62, 0x2b, 0x66, 0x2a, 0x92,
-  0x22, 0x37, 0x77, 0x20, 0x83, 0xa6, 0x11, 0x20, 0x82, 0xa2, 0x11, 0xa0,
-  0x22, 0x00, 0x2a, 0x82, 0x02, 0x00, 0x20, 0x82, 0x02, 0x22, 0x21, 0x2a,
-  0x82, 0x21, 0x82, 0xa8, 0x22, 0x00, 0xa0, 0x22, 0x26, 0x81, 0x02, 0x20,
-  0x82, 0x06, 0x20, 0x82, 0x02, 0xa0, 0x22, 0x00, 0x80, 0x02, 0x00, 0x20,
-  0x82, 0x02, 0x62, 0x29, 0xa4, 0x22, 0xf0, 0xa2, 0xed, 0x20, 0xab, 0x71,
-  0x2a, 0x22, 0xa4, 0x1b, 0x1a, 0xa3, 0x22, 0x00, 0x2a, 0x02, 0x2a, 0x82,
-  0x02, 0x22, 0xa0, 0x22, 0x22, 0x28, 0x20, 0xb2, 0x22, 0x42, 0x82, 0x21,
-  0xa2, 0xa3, 0x20, 0xa8, 0x22, 0x2a, 0x02, 0x26, 0x81, 0xb2, 0x21, 0x02,
-  0x22, 0x68, 0x2a, 0x22, 0x24, 0x82, 0xa2, 0x22, 0x00, 0x2a, 0xa2, 0x22,
-  0x80, 0x02, 0x22, 0xa0, 0x22, 0x22, 0x28, 0x20, 0xb6, 0x22, 0xe6, 0x24,
-  0x04, 0xbf, 0xd6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0xa0, 0x12, 0x80, 0x81, 0xa2, 0x12, 0xa0, 0x12, 0x20, 0x02, 0x80, 0x02,
-  0x00, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x22, 0x00,
-  0x28, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22, 0x20,
-  0x02, 0x00, 0x00, 0x28, 0x80, 0x02, 0x4a, 0x02, 0x4a, 0x02, 0xdf, 0xff,
-  0x04, 0x48, 0x1b, 0x21, 0xb0, 0x11, 0x22, 0xb4, 0x11, 0x32, 0x42, 0x19,
-  0xb2, 0x42, 0x91, 0x21, 0x2b, 0x94, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0x42,
-  0x29, 0xf2, 0x42, 0x91, 0x22, 0x2f, 0x14, 0x29, 0xd2, 0x12, 0xa9, 0x42,
-  0x1c, 0xe9, 0x22, 0xc4, 0x81, 0x2e, 0x42, 0x16, 0xe1, 0x22, 0x64, 0x19,
-  0x2e, 0x42, 0x96, 0xc1, 0x42, 0x9a, 0xc2, 0x42, 0x1b, 0x29, 0x2c, 0xb4,
-  0x91, 0x42, 0xb2, 0x91, 0x22, 0xb4, 0x91, 0x32, 0x42, 0x1b, 0x28, 0x23,
-  0x94, 0x21, 0x2b, 0x84, 0x19, 0xb2, 0x42, 0x18, 0xb1, 0x42, 0x28, 0xb2,
-  0x42, 0x28, 0xb2, 0x42, 0x28, 0x92, 0x82, 0x2a, 0x84, 0xe8, 0x22, 0xb4,
-  0x2c, 0x01, 0x48, 0x19, 0x84, 0x14, 0x21, 0x14, 0x31, 0x42, 0x11, 0x2b,
+  0x4e, 0x42, 0xf0, 0x77, 0x92, 0xff, 0x01, 0x01, 0xad, 0x01, 0x01, 0x61,
+  0x02, 0x15, 0x22, 0x65, 0x02, 0x2c, 0xee, 0x2c, 0x22, 0x00, 0x00, 0x0e,
+  0x02, 0x07, 0x0e, 0x00, 0xf2, 0x06, 0xaf, 0x9d, 0x08, 0x2a, 0xb4, 0x11,
+  0x22, 0xb2, 0x11, 0x22, 0xb6, 0x11, 0x32, 0x62, 0x19, 0xb2, 0x62, 0x91,
+  0x21, 0x2b, 0x96, 0x29, 0x06, 0xf0, 0x0b, 0x29, 0xf2, 0x42, 0xb1, 0x22,
+  0x2f, 0x14, 0x2b, 0xf2, 0x42, 0xb1, 0x2a, 0xe4, 0x14, 0xeb, 0x22, 0xe4,
+  0x14, 0xea, 0x22, 0xe4, 0x15, 0xe2, 0x22, 0xe4, 0x1d, 0x04, 0x00, 0xf3,
+  0x16, 0xc2, 0x42, 0xda, 0xc2, 0x42, 0x1b, 0x2d, 0x2c, 0xb4, 0x91, 0x42,
+  0xb2, 0x91, 0x22, 0xb4, 0x91, 0x36, 0x42, 0x1b, 0x68, 0x23, 0x94, 0x61,
+  0x2b, 0x84, 0x19, 0xb6, 0x42, 0x98, 0x41, 0x2b, 0x84, 0x2a, 0xb4, 0x42,
+  0xa8, 0x42, 0x07, 0x00, 0xf0, 0x28, 0x4a, 0xe8, 0x22, 0xf4, 0xde, 0x39,
+  0x80, 0xb4, 0x11, 0x84, 0x34, 0x11, 0x42, 0x13, 0x31, 0x42, 0x11, 0x2b,
   0x14, 0x11, 0x2b, 0x94, 0x11, 0x2b, 0xb4, 0x11, 0x2b, 0xb4, 0xf0, 0x42,
-  0x91, 0xf0, 0x42, 0x91, 0xd0, 0x12, 0x99, 0x42, 0x2d, 0x91, 0x2c, 0xc5,
-  0x91, 0x2c, 0xec, 0x11, 0xc8, 0x42, 0x96, 0xc1, 0x42, 0x96, 0xc1, 0x43,
-  0x96, 0xc1, 0x42, 0x13, 0xc9, 0x42, 0x1b, 0x49, 0x2c, 0x34, 0x91, 0x42,
-  0x13, 0x39, 0x42, 0x13, 0x38, 0x42, 0x11, 0x2b, 0x84, 0x11, 0x2b, 0xa4,
-  0x11, 0x2b, 0xa4, 0xb0, 0x42, 0x08, 0x2b, 0x84, 0x90, 0x83, 0x21, 0x29,
-  0x48, 0xf2, 0xbe, 0x57, 0x00, 0x82, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40,
-  0x01, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x50, 0x12, 0x30, 0x6e, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x22, 0x80, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x20, 0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x42, 0xf0, 0x38, 0xa9, 0x20, 0x22, 0x08, 0x22, 0x00, 0x28,
-  0x82, 0x80, 0x08, 0x00, 0x00, 0x1c, 0x24, 0x82, 0x04, 0x48, 0x42, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x12, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x11, 0x14, 0x14, 0xf0, 0xe7,
-  0x76, 0x00, 0xc2, 0x00, 0x00, 0x80, 0x08, 0x00, 0x20, 0x02, 0x00, 0x00,
-  0x00, 0x66, 0x02, 0x2a, 0x24, 0x01, 0x82, 0x00, 0x00, 0x22, 0x11, 0x00,
-  0x80, 0x22, 0x24, 0x01, 0x00, 0x00, 0x28, 0x00, 0x20, 0x02, 0x00, 0x80,
-  0x04, 0x40, 0x02, 0x14, 0xf0, 0x4e, 0xea, 0x20, 0x02, 0x80, 0x22, 0x02,
-  0x22, 0x00, 0x82, 0x00, 0x00, 0x90, 0x41, 0x28, 0x48, 0x28, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x22, 0x40,
-  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x41, 0x21, 0x04, 0x9f, 0x4c,
-  0x04, 0x00, 0x22, 0x80, 0x21, 0x21, 0x04, 0x62, 0x00, 0x80, 0x08, 0x42,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x22, 0x00,
-  0x00, 0x00, 0x20, 0x02, 0x00, 0x88, 0x8a, 0x02, 0x82, 0x20, 0x02, 0x82,
-  0x28, 0x80, 0x02, 0x42, 0x48, 0x4d, 0x1c, 0xa0, 0x16, 0x20, 0x81, 0x82,
-  0x02, 0x32, 0x12, 0x00, 0x20, 0x05, 0x00, 0x48, 0x22, 0x12, 0x80, 0x24,
-  0x02, 0x22, 0x22, 0x00, 0x22, 0x30, 0x21, 0x12, 0x80, 0x02, 0x00, 0x28,
-  0x80, 0x02, 0x28, 0x00, 0x11, 0x28, 0x82, 0x28, 0x00, 0xa0, 0x48, 0x10,
-  0x02, 0x00, 0x48, 0x20, 0x02, 0x7f, 0x15, 0x02, 0x1a, 0x02, 0x1a, 0x82,
-  0xa2, 0x21, 0x12, 0x32, 0x12, 0x28, 0x00, 0x80, 0x08, 0x20, 0x84, 0x22,
-  0x21, 0x82, 0x84, 0x02, 0x22, 0x00, 0x20, 0x02, 0x22, 0x00, 0x38, 0x80,
-  0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x12, 0x21, 0x22, 0x08, 0x82, 0x00,
-  0x48, 0x00, 0x88, 0x22, 0xa0, 0x42, 0xa0, 0x42, 0xf0, 0x66, 0x69, 0x80,
-  0x04, 0x00, 0x00, 0x42, 0x20, 0x04, 0xa0, 0x14, 0x00, 0x42, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xa0, 0x82, 0x22, 0x20, 0x88, 0xc8, 0x22, 0x00, 0x00, 0x00,
-  0x20, 0xf4, 0xaf, 0xd6, 0x00, 0x42, 0x20, 0x02, 0x00, 0x28, 0x00, 0x38,
-  0x22, 0x00, 0x00, 0x00, 0x20, 0x02, 0x82, 0x20, 0x21, 0x02, 0x00, 0x28,
-  0x00, 0x22, 0x00, 0x22, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x60, 0x18,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf6, 0x2c, 0x6a, 0x20, 0x23, 0x06,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x22, 0x82, 0x20, 0x82, 0x84, 0x02, 0x00,
-  0x20, 0xa4, 0x21, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x41, 0x80, 0x02, 0x00, 0x22, 0x82, 0x80, 0x82, 0x02, 0x00,
-  0xe0, 0x35, 0x07, 0x00, 0x00, 0x00, 0x48, 0x20, 0x82, 0x01, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x20, 0x04, 0x80, 0x04, 0x20, 0x82, 0x04, 0x00, 0x20,
-  0x02, 0x88, 0x80, 0x02, 0x28, 0x00, 0x22, 0x22, 0x00, 0x00, 0x82, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xcf, 0xa6, 0x01, 0x22, 0x28, 0x20, 0x01, 0x80,
-  0x84, 0x22, 0x02, 0x38, 0x00, 0x00, 0xa2, 0x42, 0x22, 0x80, 0x02, 0xc8,
-  0x42, 0x28, 0x4a, 0x02, 0x00, 0x2a, 0x24, 0x04, 0x00, 0x28, 0x20, 0x08,
-  0x00, 0x28, 0x00, 0x22, 0x28, 0x13, 0x04, 0x28, 0x88, 0x82, 0x21, 0x22,
-  0x82, 0x00, 0x22, 0x00, 0xa0, 0x24, 0x3f, 0xe6, 0x01, 0x18, 0x00, 0x28,
-  0x00, 0x00, 0x20, 0x01, 0x28, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x22, 0x00, 0x20, 0x02, 0x80, 0x02, 0x20, 0x82, 0x02, 0x00, 0x00,
-  0x00, 0x40, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0xf0, 0xd2, 0xd8, 0x20,
+  0x91, 0xf0, 0x42, 0x91, 0xd0, 0x12, 0x19, 0xd2, 0x12, 0xc9, 0x12, 0x1c,
+  0xc9, 0x82, 0x1e, 0x81, 0x24, 0x96, 0x41, 0x62, 0x19, 0x34, 0x9e, 0x21,
+  0x24, 0x86, 0x06, 0xf0, 0x08, 0x69, 0x24, 0x1b, 0x69, 0xb0, 0x91, 0x12,
+  0xb2, 0x81, 0x12, 0x92, 0x21, 0x29, 0x98, 0x21, 0x29, 0x9a, 0x21, 0x29,
+  0x28, 0x92, 0x82, 0x22, 0x05, 0x00, 0x81, 0x23, 0x92, 0x82, 0x26, 0xf2,
+  0xbe, 0x84, 0x00, 0x64, 0x0a, 0x03, 0x85, 0x0c, 0xa3, 0x21, 0x80, 0x01,
+  0x88, 0x00, 0x00, 0xc0, 0x81, 0x40, 0x01, 0x9e, 0x04, 0x02, 0x24, 0x06,
+  0x31, 0xf0, 0x84, 0xa1, 0xb9, 0x08, 0x82, 0x22, 0x80, 0x82, 0x08, 0x00,
+  0x20, 0x88, 0x08, 0xc9, 0x03, 0x20, 0x20, 0x04, 0x30, 0x01, 0x12, 0x28,
+  0x3b, 0x00, 0x00, 0xee, 0x05, 0xb1, 0x80, 0xf8, 0xef, 0xfc, 0x20, 0x21,
+  0x88, 0x01, 0x2a, 0x08, 0x38, 0xa3, 0x05, 0x40, 0x80, 0x02, 0x28, 0x88,
+  0xcc, 0x05, 0x61, 0x42, 0x00, 0x20, 0x22, 0x02, 0x22, 0x9b, 0x03, 0x10,
+  0x48, 0xd4, 0x0d, 0xe0, 0x80, 0x82, 0x02, 0x60, 0x14, 0x11, 0x46, 0x21,
+  0xf2, 0x68, 0x29, 0x00, 0xc2, 0x12, 0xa5, 0x0e, 0x10, 0x48, 0xb3, 0x03,
+  0xf0, 0x1e, 0x82, 0x00, 0x60, 0x22, 0x20, 0x22, 0x21, 0x22, 0x08, 0x00,
+  0xa0, 0x42, 0x19, 0x02, 0x22, 0x22, 0xa0, 0x24, 0x00, 0x22, 0x22, 0x20,
+  0x04, 0x00, 0x60, 0x22, 0x00, 0x00, 0x22, 0x20, 0xc2, 0x42, 0x14, 0x14,
+  0x82, 0x5f, 0x88, 0x0d, 0x18, 0x00, 0xa0, 0x82, 0x12, 0x2a, 0x01, 0x87,
+  0x05, 0x30, 0x80, 0x22, 0x88, 0x51, 0x03, 0x24, 0xa0, 0x24, 0x8e, 0x01,
+  0x00, 0x98, 0x00, 0xf0, 0x02, 0x80, 0x0a, 0x00, 0x14, 0x20, 0x24, 0xf2,
+  0x8d, 0xea, 0x20, 0x02, 0x80, 0xa2, 0x12, 0x80, 0x81, 0x22, 0xc3, 0x00,
+  0x31, 0x28, 0x80, 0x0a, 0xc2, 0x04, 0x50, 0x28, 0x00, 0x22, 0x42, 0x20,
+  0x25, 0x05, 0x13, 0x48, 0x67, 0x05, 0x90, 0x80, 0x02, 0x28, 0xf0, 0xdd,
+  0x6c, 0x00, 0x28, 0x2a, 0x14, 0x06, 0x00, 0x01, 0x04, 0xf0, 0x16, 0x08,
+  0x00, 0x2a, 0x04, 0x22, 0x80, 0x0c, 0xa0, 0x24, 0x8a, 0x04, 0x4a, 0x02,
+  0x88, 0x22, 0x80, 0x81, 0x02, 0x00, 0x20, 0x82, 0x84, 0x02, 0x28, 0x13,
+  0x04, 0x80, 0x08, 0x00, 0x80, 0x84, 0x24, 0x82, 0x24, 0xf2, 0xa4, 0x13,
+  0x38, 0x00, 0x01, 0xef, 0x09, 0xf0, 0x02, 0x20, 0x02, 0x00, 0x2a, 0x04,
+  0x2a, 0x04, 0xc8, 0x80, 0x84, 0x84, 0x04, 0x28, 0x80, 0x04, 0x48, 0x18,
+  0x41, 0x02, 0x02, 0x47, 0x00, 0xf0, 0x00, 0x20, 0x84, 0x02, 0x28, 0xf0,
+  0x8e, 0x1b, 0x80, 0x82, 0x22, 0x83, 0x22, 0x01, 0x80, 0x82, 0x15, 0x05,
+  0x30, 0x20, 0x08, 0x8a, 0x8d, 0x00, 0xf1, 0x02, 0x20, 0x22, 0x0a, 0x42,
+  0x22, 0x88, 0x22, 0x80, 0x02, 0x00, 0x28, 0x42, 0x22, 0x42, 0x42, 0x20,
+  0x62, 0x83, 0x06, 0xf1, 0x08, 0x48, 0x28, 0x42, 0x22, 0xff, 0x97, 0x0b,
+  0x12, 0x00, 0x82, 0x28, 0x42, 0x20, 0x0a, 0x80, 0x82, 0x22, 0x22, 0x08,
+  0x80, 0xa2, 0x21, 0x42, 0xc3, 0x05, 0xf1, 0x0b, 0x80, 0x01, 0x00, 0x80,
+  0x02, 0x42, 0x80, 0x02, 0x24, 0x00, 0x48, 0x22, 0x48, 0x82, 0x22, 0x80,
+  0x24, 0x02, 0x40, 0x21, 0x04, 0x42, 0x00, 0xef, 0xda, 0x0c, 0xb6, 0x01,
+  0x30, 0x22, 0x4a, 0x08, 0x78, 0x00, 0x10, 0x22, 0x99, 0x04, 0x20, 0x20,
+  0x82, 0xaf, 0x0d, 0x50, 0x48, 0x42, 0x00, 0x00, 0x14, 0xf5, 0x03, 0x10,
+  0x13, 0x12, 0x01, 0xc0, 0x02, 0x80, 0x24, 0xf4, 0x34, 0x3e, 0x00, 0x00,
+  0xa2, 0x00, 0x28, 0xc8, 0xf4, 0x00, 0x10, 0x03, 0xcc, 0x04, 0x70, 0x28,
+  0x80, 0x82, 0x84, 0x04, 0x22, 0x00, 0x02, 0x00, 0x10, 0x48, 0xaa, 0x07,
+  0xc0, 0x02, 0x42, 0x00, 0x48, 0x42, 0x14, 0x00, 0x00, 0xe0, 0x7c, 0x04,
+  0x38, 0x17, 0x01, 0xf0, 0x21, 0x68, 0x20, 0xa2, 0xc2, 0x00, 0x00, 0x1a,
+  0x22, 0x22, 0x83, 0x88, 0x02, 0x00, 0x88, 0x28, 0x80, 0x02, 0x62, 0x12,
+  0x28, 0x48, 0x80, 0x22, 0x22, 0x24, 0x02, 0x22, 0x42, 0x10, 0x83, 0x22,
+  0x24, 0x22, 0xa4, 0x82, 0x11, 0x42, 0x48, 0x28, 0x42, 0x00, 0x22, 0x20,
+  0x24, 0x84, 0xf4, 0x37, 0x9d, 0x52, 0x00, 0x90, 0x04, 0x00, 0x00, 0x28,
+  0x20, 0x08, 0x00, 0x20, 0x04, 0x8a, 0x00, 0x13, 0xa0, 0xc9, 0x06, 0x20,
+  0x00, 0x48, 0x0e, 0x00, 0x01, 0x36, 0x05, 0xa1, 0x00, 0x4f, 0x9b, 0x0c,
+  0x00, 0x12, 0x80, 0x81, 0x21, 0x82, 0x95, 0x01, 0x30, 0x20, 0x22, 0x02,
+  0x87, 0x01, 0x02, 0x78, 0x05, 0x50, 0x20, 0x84, 0x24, 0x02, 0x42, 0x8b,
+  0x02, 0xd0, 0x28, 0x22, 0x00, 0x42, 0x00, 0x80, 0xf6, 0xc1, 0x3f, 0x00,
+  0x28, 0x22, 0x18, 0x56, 0x0b, 0x00, 0xff, 0x01, 0x20, 0x00, 0x28, 0x18,
+  0x00, 0x10, 0x22, 0x97, 0x0f, 0x30, 0x42, 0x80, 0x04, 0xe5, 0x06, 0x60,
+  0x20, 0x02, 0x80, 0x04, 0x80, 0x04, 0xef, 0x00, 0x90, 0x62, 0x16, 0xf0,
+  0x16, 0x9e, 0x00, 0x20, 0x01, 0x38, 0x61, 0x02, 0x01, 0xd5, 0x01, 0x20,
+  0x24, 0x02, 0x0f, 0x06, 0x00, 0xab, 0x05, 0x02, 0xfd, 0x01, 0xf0, 0x03,
+  0x02, 0x80, 0x02, 0x42, 0x48, 0x42, 0x68, 0x80, 0x04, 0xf0, 0x42, 0x57,
+  0x00, 0x12, 0x22, 0x28, 0x20, 0x08, 0x6f, 0x07, 0x00, 0x1c, 0x00, 0x50,
+  0x48, 0x20, 0x04, 0x22, 0x42, 0xd7, 0x00, 0x30, 0x22, 0x06, 0x28, 0x82,
+  0x00, 0x22, 0x00, 0x28, 0x19, 0x02, 0x60, 0x20, 0x04, 0x48, 0xf0, 0xd7,
+  0x4d, 0x4f, 0x00, 0x10, 0x32, 0x29, 0x00, 0x00, 0x5f, 0x01, 0x00, 0xa5,
+  0x05, 0x02, 0xbc, 0x05, 0x60, 0x42, 0x48, 0x42, 0x00, 0x28, 0x48, 0xf8,
+  0x08, 0xe0, 0x22, 0x11, 0x00, 0x22, 0x80, 0x02, 0x9f, 0xba, 0x0c, 0x20,
+  0x02, 0x00, 0x18, 0x20, 0x2b, 0x02, 0x10, 0x02, 0xa8, 0x00, 0xb0, 0x28,
+  0x42, 0x00, 0x68, 0x80, 0x86, 0x04, 0x42, 0x48, 0x00, 0x2a, 0x24, 0x03,
+  0x70, 0x48, 0x20, 0x24, 0x02, 0x20, 0x82, 0x82, 0x78, 0x02, 0x51, 0x00,
+  0x00, 0x4f, 0xcb, 0x0e, 0xd6, 0x05, 0x10, 0x20, 0x6c, 0x00, 0x00, 0x78,
+  0x01, 0x10, 0x20, 0x87, 0x01, 0x70, 0x42, 0x00, 0x28, 0x2a, 0x04, 0x00,
+  0x68, 0x6c, 0x0f, 0x31, 0x80, 0x84, 0x06, 0xd4, 0x02, 0x44, 0x48, 0x00,
+  0x2d, 0x4d, 0x72, 0x00, 0x00, 0x68, 0x03, 0x01, 0xf3, 0x05, 0x01, 0x7d,
+  0x04, 0x02, 0x40, 0x0f, 0xf2, 0x01, 0x20, 0x82, 0x04, 0x22, 0x10, 0x81,
+  0x82, 0x42, 0x01, 0x7f, 0x22, 0x01, 0x22, 0x12, 0x48, 0x18, 0x51, 0x01,
+  0x01, 0x49, 0x08, 0x50, 0x04, 0x21, 0x80, 0x05, 0xc8, 0xa3, 0x00, 0xa0,
+  0x46, 0x01, 0x48, 0x42, 0x80, 0x04, 0x20, 0x02, 0x00, 0x42, 0x42, 0x01,
+  0xf0, 0x04, 0x48, 0x42, 0x11, 0x20, 0x04, 0x21, 0x48, 0xff, 0xa9, 0x08,
+  0x22, 0x28, 0x12, 0x3a, 0xa2, 0x11, 0x1a, 0x22, 0x83, 0x50, 0x00, 0x20,
+  0x2a, 0x22, 0x0a, 0x06, 0xf0, 0x26, 0x22, 0xa0, 0x26, 0x68, 0x48, 0x4a,
+  0xa4, 0x26, 0x42, 0x22, 0xa0, 0x22, 0x42, 0x28, 0x80, 0xa2, 0x24, 0x00,
+  0x22, 0x42, 0x68, 0x68, 0xa0, 0x44, 0x4a, 0x82, 0x02, 0x4a, 0x22, 0x02,
+  0x48, 0xa0, 0x62, 0x62, 0x13, 0x02, 0x4a, 0x24, 0xe4, 0x14, 0x02, 0x6f,
+  0xeb, 0x0a, 0x20, 0xa2, 0x22, 0x18, 0x22, 0x2a, 0x01, 0x80, 0x22, 0xd7,
+  0x03, 0xf0, 0x2c, 0x00, 0x2a, 0x02, 0x28, 0x80, 0x24, 0xa4, 0x24, 0x00,
+  0x48, 0x4a, 0xa2, 0x42, 0x42, 0x28, 0x62, 0x62, 0x2a, 0x24, 0x22, 0x24,
+  0x82, 0x82, 0x24, 0x26, 0x86, 0x24, 0x22, 0x22, 0x82, 0x84, 0x04, 0xa0,
+  0x26, 0x48, 0x80, 0x84, 0x64, 0x16, 0x2a, 0x82, 0xe6, 0x12, 0x84, 0xf4,
+  0xf9, 0x57, 0x80, 0xa2, 0x11, 0x18, 0x80, 0x02, 0x38, 0x22, 0x22, 0x80,
+  0xa2, 0x22, 0xde, 0x00, 0xf0, 0x1a, 0xa0, 0x66, 0x20, 0x02, 0x80, 0xa4,
+  0x22, 0x48, 0x4a, 0x82, 0xa4, 0x42, 0x48, 0x68, 0x42, 0x48, 0x48, 0x48,
+  0xa0, 0x22, 0x00, 0x42, 0x80, 0xa4, 0x44, 0x6a, 0x22, 0x02, 0x00, 0x6a,
+  0x22, 0x84, 0xa2, 0x24, 0x68, 0x20, 0x02, 0x4a, 0xf2, 0xa8, 0x34, 0x4a,
+  0x04, 0x22, 0x2a, 0x01, 0x5c, 0x08, 0x10, 0x28, 0x21, 0x01, 0xa0, 0xa0,
+  0x24, 0xa0, 0x24, 0x00, 0x20, 0x04, 0x20, 0x22, 0x04, 0x0c, 0x01, 0x20,
+  0x48, 0x22, 0x51, 0x08, 0xf0, 0x01, 0x48, 0x80, 0x04, 0x20, 0x04, 0x42,
+  0x97, 0x21, 0xa0, 0x19, 0x3a, 0xa3, 0x11, 0xa0, 0x82, 0xa8, 0x16, 0x06,
+  0x00, 0x2d, 0x01, 0xf0, 0x04, 0x28, 0x80, 0xa2, 0x22, 0x42, 0x2a, 0xa2,
+  0x22, 0x4a, 0x02, 0x42, 0x62, 0x28, 0xa0, 0x24, 0x2a, 0x82, 0x82, 0xa2,
+  0xf6, 0x06, 0x30, 0x2a, 0x02, 0x48, 0x3e, 0x06, 0x00, 0xa3, 0x09, 0xf1,
+  0x09, 0x82, 0x36, 0x41, 0x2e, 0x61, 0x2a, 0xa2, 0x22, 0x6a, 0xe2, 0x12,
+  0xf6, 0xb7, 0xb4, 0xa0, 0x11, 0x7a, 0xa5, 0x11, 0x58, 0x12, 0x12, 0x1a,
+  0x81, 0x29, 0x02, 0xf0, 0x10, 0x80, 0x02, 0x28, 0x24, 0x23, 0x02, 0x2b,
+  0x37, 0x2a, 0xa2, 0xfc, 0x2a, 0xa4, 0xa6, 0x20, 0x84, 0xf2, 0x61, 0x61,
+  0x2a, 0xc2, 0x21, 0x42, 0x6a, 0xa6, 0x62, 0x2a, 0xa2, 0x22, 0x20, 0xa4,
+  0x4b, 0x00, 0xf2, 0x0e, 0x62, 0x00, 0x28, 0x00, 0x2a, 0x82, 0x04, 0x19,
+  0xa2, 0x22, 0x2e, 0x22, 0x2b, 0x22, 0x2a, 0xb2, 0x22, 0xf2, 0x96, 0x93,
+  0x00, 0x3a, 0xa7, 0x11, 0x18, 0x92, 0x1a, 0x01, 0x2a, 0x6e, 0x02, 0xf0,
+  0x07, 0x22, 0x20, 0xb2, 0x22, 0x82, 0x84, 0x81, 0xa4, 0xa6, 0xa0, 0x44,
+  0x2a, 0x24, 0x82, 0xe4, 0x16, 0xa2, 0x22, 0x28, 0x2a, 0x86, 0x84, 0x3e,
+  0x00, 0x40, 0x42, 0x00, 0x80, 0xa4, 0xa2, 0x01, 0xf1, 0x0c, 0x2a, 0x22,
+  0x22, 0x06, 0x2e, 0x21, 0x2a, 0xb2, 0x22, 0xa2, 0x22, 0xf0, 0x47, 0xa5,
+  0xa0, 0x2a, 0x2a, 0xa5, 0x11, 0x4a, 0x22, 0xa2, 0xa1, 0x3a, 0x83, 0x22,
+  0x82, 0x33, 0x02, 0xf3, 0x29, 0x22, 0x20, 0x02, 0x2b, 0x42, 0x2e, 0x22,
+  0x58, 0x48, 0x7a, 0xae, 0x42, 0xea, 0xa6, 0x22, 0x48, 0x2a, 0xe4, 0x16,
+  0xa6, 0x22, 0x19, 0x26, 0xa6, 0x44, 0xa0, 0x22, 0x22, 0x42, 0x20, 0x04,
+  0x6a, 0x22, 0x22, 0x84, 0x02, 0x20, 0xa4, 0x22, 0x42, 0x20, 0x86, 0xa6,
+  0x22, 0x2b, 0x24, 0x6e, 0x22, 0x48, 0xbf, 0xbf, 0x04, 0x00, 0x18, 0xa0,
+  0x12, 0x04, 0x0a, 0x30, 0x28, 0xa0, 0x24, 0x98, 0x05, 0x01, 0xe2, 0x02,
+  0x00, 0xf7, 0x03, 0x01, 0xe5, 0x05, 0x01, 0x3e, 0x08, 0x31, 0x5f, 0xd8,
+  0x07, 0x80, 0x00, 0x20, 0x01, 0x80, 0x30, 0x05, 0x01, 0xea, 0x02, 0xa0,
+  0x42, 0x80, 0xa2, 0x42, 0x20, 0x22, 0x24, 0x22, 0x24, 0x22, 0xd7, 0x03,
+  0x81, 0x42, 0x20, 0x02, 0x62, 0x00, 0x20, 0x04, 0x4a, 0x27, 0x04, 0xf9,
+  0x00, 0xf0, 0xff, 0xea, 0xa0, 0x42, 0x1b, 0x21, 0x22, 0x1b, 0x29, 0x62,
+  0x1b, 0x21, 0x2b, 0x16, 0x20, 0x0d, 0x06, 0xf7, 0x06, 0xf3, 0x0b, 0x91,
+  0x2a, 0xc4, 0xb1, 0x2e, 0x42, 0x4e, 0x81, 0x2e, 0x42, 0x5e, 0x21, 0x2e,
+  0x42, 0x9e, 0x21, 0x2e, 0x42, 0xd6, 0xc1, 0x42, 0x9a, 0xe2, 0x22, 0xb4,
+  0xd1, 0x22, 0x0d, 0x11, 0x62, 0x22, 0x0d, 0x20, 0x36, 0x62, 0xf3, 0x06,
+  0x13, 0x61, 0x22, 0x0d, 0x14, 0xa4, 0xf9, 0x06, 0xf4, 0x03, 0xa4, 0x84,
+  0x2e, 0x42, 0x3f, 0x11, 0x04, 0x48, 0x1b, 0x41, 0x48, 0x13, 0x21, 0x34,
+  0x11, 0x23, 0x14, 0xb1, 0x65, 0x00, 0xb0, 0x1b, 0xb1, 0x42, 0x0b, 0x2f,
+  0x14, 0x09, 0x2f, 0x14, 0x29, 0xd2, 0xf7, 0x06, 0xf2, 0x02, 0xe9, 0x22,
+  0xc5, 0x91, 0x2e, 0x82, 0x1e, 0x81, 0x2c, 0x64, 0x19, 0x2e, 0x42, 0x96,
+  0x41, 0xe3, 0x19, 0x5e, 0x00, 0xa1, 0x49, 0x24, 0x1b, 0x69, 0x42, 0x13,
+  0x39, 0x42, 0x13, 0x18, 0xfa, 0x06, 0x58, 0x2b, 0xa4, 0x11, 0x2b, 0xa4,
+  0x21, 0x0d, 0x44, 0x2c, 0xf4, 0xf1, 0xfd, 0xfc, 0x06, 0x00, 0x01, 0x00,
+  0x30, 0x10, 0x02, 0x4a, 0xfc, 0x06, 0x05, 0x23, 0x0e, 0x00, 0x01, 0x00,
+  0xd1, 0x50, 0x12, 0xf0, 0x15, 0x11, 0x00, 0x80, 0x01, 0x22, 0x28, 0x00,
+  0x80, 0x08, 0x09, 0x04, 0xf0, 0x07, 0xa0, 0x24, 0x46, 0x81, 0x22, 0x22,
+  0x02, 0x28, 0x42, 0x90, 0x21, 0x4a, 0x02, 0x62, 0x00, 0x80, 0x02, 0x24,
+  0x42, 0x60, 0x22, 0x28, 0xc0, 0x08, 0xf0, 0x03, 0xa0, 0x82, 0x82, 0x28,
+  0x68, 0x00, 0x68, 0x62, 0xf0, 0x88, 0xf9, 0x20, 0x21, 0x09, 0x12, 0x20,
+  0x01, 0x22, 0x66, 0x06, 0xf0, 0x02, 0x11, 0x00, 0x12, 0x20, 0x02, 0x22,
+  0x42, 0x48, 0xa0, 0x24, 0x20, 0x82, 0x22, 0x04, 0x48, 0x80, 0x82, 0x4d,
+  0x01, 0xf0, 0x07, 0x42, 0x42, 0x42, 0x82, 0x13, 0x04, 0x00, 0x11, 0x14,
+  0x00, 0x20, 0x26, 0x44, 0x41, 0x81, 0xb4, 0x52, 0x0a, 0x18, 0xca, 0x01,
+  0x12, 0x5f, 0x00, 0xf0, 0x22, 0x3a, 0x24, 0x02, 0x14, 0x28, 0x80, 0x01,
+  0xc0, 0x42, 0x4a, 0x22, 0xa6, 0x21, 0xa0, 0x4a, 0x22, 0x4a, 0x02, 0x11,
+  0x22, 0x11, 0x22, 0x00, 0x20, 0x06, 0x80, 0x04, 0x46, 0xa2, 0x24, 0x48,
+  0x82, 0x1c, 0x86, 0x22, 0x02, 0x11, 0x28, 0x88, 0x80, 0x24, 0x64, 0x24,
+  0x2a, 0x64, 0x12, 0xf0, 0x57, 0x92, 0x9d, 0x00, 0x41, 0x1a, 0x02, 0x00,
+  0x82, 0x13, 0x04, 0xf1, 0x03, 0x22, 0x28, 0x11, 0x80, 0x84, 0x02, 0x00,
+  0x28, 0x2a, 0x24, 0x84, 0x24, 0x24, 0x82, 0x82, 0x04, 0x00, 0x21, 0x10,
+  0x05, 0xc6, 0x60, 0x18, 0x20, 0x82, 0x22, 0x02, 0x14, 0x42, 0x48, 0xcf,
+  0xb7, 0x09, 0xdc, 0x00, 0x00, 0x73, 0x0a, 0x04, 0x09, 0x00, 0x02, 0x48,
+  0x0c, 0x00, 0x1b, 0x02, 0x60, 0x4f, 0x1a, 0x08, 0x18, 0x00, 0x12, 0x8f,
+  0x05, 0x20, 0x04, 0x82, 0x26, 0x06, 0x30, 0x20, 0x34, 0x81, 0xa6, 0x03,
+  0x11, 0x40, 0x06, 0x0e, 0x21, 0x10, 0x01, 0xcc, 0x0a, 0x01, 0x3f, 0x02,
+  0x31, 0xd0, 0xee, 0x03, 0x02, 0x07, 0x30, 0x80, 0x04, 0x82, 0x11, 0x0d,
+  0x51, 0x80, 0x64, 0x18, 0x00, 0x48, 0x28, 0x00, 0x70, 0x00, 0x22, 0x00,
+  0x10, 0x01, 0x20, 0x04, 0x04, 0x00, 0x00, 0x20, 0x00, 0x30, 0x1f, 0xfb,
+  0x02, 0xa4, 0x00, 0x05, 0x75, 0x00, 0x03, 0xbc, 0x04, 0x01, 0x1c, 0x00,
+  0x01, 0x01, 0x0b, 0x60, 0x48, 0x00, 0x00, 0x70, 0x68, 0x07, 0x17, 0x0c,
+  0x23, 0xa0, 0x81, 0x1e, 0x00, 0x00, 0xb9, 0x0d, 0x24, 0x28, 0x18, 0x09,
+  0x0d, 0xf0, 0x10, 0x00, 0x14, 0x82, 0x00, 0x00, 0x2c, 0x02, 0x42, 0x28,
+  0x80, 0xf2, 0x59, 0xf3, 0x80, 0x01, 0x20, 0x08, 0x18, 0x22, 0x20, 0x22,
+  0x82, 0x08, 0x28, 0x00, 0x00, 0x12, 0xa2, 0x20, 0x02, 0x00, 0x88, 0x05,
+  0x04, 0xc6, 0x01, 0x10, 0x88, 0x04, 0x07, 0x00, 0x94, 0x00, 0x30, 0x2f,
+  0x4d, 0x09, 0x21, 0x08, 0x13, 0x88, 0x65, 0x0d, 0x01, 0xb7, 0x0d, 0x12,
+  0x04, 0xea, 0x00, 0x03, 0x7d, 0x00, 0xf4, 0x0f, 0x20, 0x04, 0x88, 0x6f,
+  0x8e, 0x02, 0x38, 0x00, 0x80, 0x82, 0x81, 0x22, 0x01, 0x22, 0x82, 0x42,
+  0x00, 0x00, 0x20, 0x81, 0x08, 0x22, 0x00, 0x80, 0x84, 0x02, 0x20, 0x22,
+  0x25, 0x04, 0x77, 0x0c, 0xe0, 0x14, 0x82, 0x80, 0x04, 0xc0, 0x22, 0x80,
+  0x24, 0x26, 0xa4, 0x28, 0xcf, 0x38, 0x0d, 0x35, 0x0c, 0x01, 0xf0, 0x0e,
+  0x00, 0x53, 0x07, 0x00, 0x9f, 0x0e, 0x04, 0x5a, 0x0e, 0x00, 0x92, 0x0d,
+  0x00, 0x07, 0x00, 0x43, 0x40, 0xf1, 0x33, 0x3a, 0x8b, 0x00, 0x0f, 0x01,
+  0x00, 0x04, 0x36, 0xff, 0xe4, 0x0f, 0x5e, 0x0a, 0x02, 0x01, 0x00, 0x01,
+  0x66, 0x0d, 0x04, 0x13, 0x00, 0x63, 0x11, 0x20, 0x04, 0x00, 0x17, 0x3a,
+  0x68, 0x0f, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x62, 0x01, 0x30, 0xbf, 0x3a,
+  0x08, 0x18, 0x07, 0x00, 0x01, 0x00, 0x0a, 0x53, 0x0d, 0x00, 0x01, 0x00,
+  0x03, 0x37, 0x0d, 0x27, 0xbf, 0xf5, 0xec, 0x01, 0x0f, 0x01, 0x00, 0x00,
+  0x30, 0xf0, 0x4f, 0xfe, 0x3f, 0x00, 0x08, 0xee, 0x02, 0x08, 0xd8, 0x0a,
+  0x50, 0x00, 0x00, 0x00, 0xbf, 0x27, 0x87, 0x0c, 0x45, 0x01, 0x22, 0x20,
+  0x02, 0xb0, 0x00, 0x02, 0x36, 0x07, 0x03, 0x89, 0x04, 0x01, 0x75, 0x00,
+  0x72, 0x80, 0x04, 0x9f, 0xc1, 0x0f, 0x20, 0x08, 0xb1, 0x00, 0x0b, 0x41,
+  0x00, 0x03, 0x01, 0x00, 0x71, 0x14, 0xf0, 0xb8, 0xd2, 0x80, 0x01, 0x48,
+  0x73, 0x0d, 0x02, 0x4b, 0x05, 0x05, 0x4e, 0x0d, 0x06, 0x82, 0x02, 0xf5,
+  0x00, 0x19, 0x12, 0x81, 0x02, 0x21, 0xf0, 0xd6, 0x34, 0x80, 0x21, 0x28,
+  0x01, 0x1a, 0x28, 0x88, 0xd0, 0x00, 0x00, 0x4e, 0x0d, 0x02, 0x16, 0x02,
+  0x03, 0xe4, 0x00, 0x79, 0x11, 0x11, 0x42, 0x40, 0x01, 0x2d, 0xfb, 0x4a,
+  0x0d, 0x03, 0xf6, 0x07, 0x05, 0x78, 0x0e, 0x10, 0x22, 0x07, 0x00, 0x50,
+  0x2e, 0x41, 0xf0, 0x7f, 0xa6, 0x15, 0x00, 0x10, 0x20, 0x3d, 0x09, 0x20,
+  0x80, 0x02, 0x70, 0x09, 0x00, 0x01, 0x00, 0x01, 0xa2, 0x09, 0x08, 0x5e,
+  0x0d, 0x50, 0xf0, 0x35, 0x38, 0xa0, 0x21, 0x02, 0x00, 0x01, 0x09, 0x05,
+  0x00, 0xa6, 0x05, 0x00, 0xde, 0x00, 0x01, 0x03, 0x00, 0x14, 0x82, 0x5c,
+  0x0d, 0x04, 0x5f, 0x0d, 0x10, 0x14, 0xee, 0x09, 0xe0, 0x8f, 0x17, 0x0e,
+  0x8a, 0xa3, 0x33, 0x2a, 0xa2, 0x33, 0x9a, 0xa3, 0x2a, 0x3a, 0xa3, 0x45,
+  0x0d, 0x00, 0x74, 0x03, 0x40, 0xa2, 0x22, 0x2a, 0x22, 0x56, 0x06, 0x23,
+  0x80, 0x82, 0x58, 0x0d, 0x11, 0x80, 0x62, 0x06, 0x02, 0x6e, 0x0d, 0x01,
+  0x0b, 0x00, 0x02, 0x6e, 0x0d, 0x01, 0x11, 0x00, 0x21, 0x32, 0x21, 0x6f,
+  0x0d, 0xd1, 0x4e, 0x61, 0x2f, 0x84, 0x0a, 0x38, 0x7a, 0xa7, 0x11, 0x48,
+  0x28, 0xba, 0x03, 0x1f, 0x00, 0x40, 0xa0, 0x22, 0x80, 0x02, 0xb4, 0x06,
+  0x10, 0x2c, 0x03, 0x06, 0xf2, 0x05, 0x2b, 0x31, 0x28, 0xaa, 0xab, 0x22,
+  0x88, 0xa0, 0x22, 0x2a, 0xd2, 0x11, 0xa2, 0x22, 0x14, 0x80, 0xa2, 0x66,
+  0x80, 0x84, 0xf0, 0x0c, 0x00, 0x74, 0x07, 0x51, 0x00, 0x2a, 0x32, 0x21,
+  0x1c, 0x71, 0x0d, 0xc0, 0x92, 0x22, 0x37, 0x77, 0x20, 0x83, 0xa6, 0x11,
+  0x20, 0x82, 0xa2, 0x11, 0x88, 0x0d, 0x11, 0x82, 0x89, 0x08, 0x70, 0x22,
+  0x21, 0x2a, 0x82, 0x21, 0x82, 0xa8, 0xe0, 0x0d, 0xa1, 0x26, 0x81, 0x02,
+  0x20, 0x82, 0x06, 0x20, 0x82, 0x02, 0xa0, 0x73, 0x07, 0xf0, 0x04, 0x20,
+  0x82, 0x02, 0x62, 0x29, 0xa4, 0x22, 0xf0, 0xa2, 0xed, 0x20, 0xab, 0x71,
+  0x2a, 0x22, 0xa4, 0x1b, 0x1a, 0xa3, 0x52, 0x00, 0x23, 0x2a, 0x82, 0x46,
+  0x0d, 0xf0, 0x03, 0xb2, 0x22, 0x42, 0x82, 0x21, 0xa2, 0xa3, 0x20, 0xa8,
+  0x22, 0x2a, 0x02, 0x26, 0x81, 0xb2, 0x21, 0x02, 0x22, 0x6b, 0x0d, 0x1e,
+  0x82, 0x6b, 0x0d, 0x44, 0x04, 0xbf, 0xd6, 0x0a, 0xaa, 0x01, 0x0f, 0x01,
+  0x00, 0x02, 0xb1, 0xf0, 0x4f, 0xfe, 0xa0, 0x12, 0x80, 0x81, 0xa2, 0x12,
+  0xa0, 0x12, 0x31, 0x02, 0x05, 0x4e, 0x01, 0x37, 0x22, 0x00, 0x28, 0x68,
+  0x01, 0x00, 0x8e, 0x01, 0xfc, 0x04, 0x80, 0x02, 0x4a, 0x02, 0x4a, 0x02,
+  0xdf, 0xff, 0x04, 0x48, 0x1b, 0x21, 0xb0, 0x11, 0x22, 0xb4, 0x11, 0x32,
+  0x42, 0x58, 0x06, 0x21, 0x91, 0x22, 0xf4, 0x05, 0xc1, 0xa9, 0x42, 0x1c,
+  0xe9, 0x22, 0xc4, 0x81, 0x2e, 0x42, 0x16, 0xe1, 0x22, 0xf4, 0x05, 0x30,
+  0xc1, 0x42, 0x9a, 0xf4, 0x05, 0x05, 0x4c, 0x0d, 0xf1, 0x02, 0x32, 0x42,
+  0x1b, 0x28, 0x23, 0x94, 0x21, 0x2b, 0x84, 0x19, 0xb2, 0x42, 0x18, 0xb1,
+  0x42, 0x28, 0xb2, 0x03, 0x00, 0xff, 0x00, 0x92, 0x82, 0x2a, 0x84, 0xe8,
+  0x22, 0xb4, 0x2c, 0x01, 0x48, 0x19, 0x84, 0x14, 0x21, 0x14, 0x47, 0x0d,
+  0x03, 0xb0, 0x99, 0x42, 0x2d, 0x91, 0x2c, 0xc5, 0x91, 0x2c, 0xec, 0x11,
+  0xc8, 0x58, 0x00, 0xe1, 0x96, 0xc1, 0x43, 0x96, 0xc1, 0x42, 0x13, 0xc9,
+  0x42, 0x1b, 0x49, 0x2c, 0x34, 0x91, 0x4f, 0x06, 0x30, 0x38, 0x42, 0x11,
+  0xab, 0x06, 0x00, 0x4f, 0x06, 0xdf, 0xb0, 0x42, 0x08, 0x2b, 0x84, 0x90,
+  0x83, 0x21, 0x29, 0x48, 0xf2, 0xbe, 0x57, 0x48, 0x0d, 0x00, 0x23, 0x40,
+  0x01, 0x80, 0x04, 0x01, 0x7b, 0x02, 0x41, 0x50, 0x12, 0x30, 0x6e, 0x43,
+  0x03, 0x01, 0x01, 0x00, 0x00, 0x48, 0x01, 0x02, 0x0a, 0x00, 0x01, 0x5a,
+  0x02, 0x01, 0x4d, 0x04, 0x00, 0xe9, 0x0e, 0x91, 0xf0, 0x38, 0xa9, 0x20,
+  0x22, 0x08, 0x22, 0x00, 0x28, 0x7f, 0x05, 0x40, 0x1c, 0x24, 0x82, 0x04,
+  0xc2, 0x09, 0x01, 0x27, 0x00, 0x11, 0x12, 0xaf, 0x03, 0x00, 0x60, 0x00,
+  0xb2, 0x40, 0x01, 0x00, 0x11, 0x14, 0x14, 0xf0, 0xe7, 0x76, 0x00, 0xc2,
+  0x6c, 0x0c, 0x00, 0x55, 0x00, 0xe1, 0x66, 0x02, 0x2a, 0x24, 0x01, 0x82,
+  0x00, 0x00, 0x22, 0x11, 0x00, 0x80, 0x22, 0x24, 0x2a, 0x00, 0x01, 0x0c,
+  0x0a, 0x50, 0x40, 0x02, 0x14, 0xf0, 0x4e, 0x0e, 0x0d, 0x00, 0xad, 0x09,
+  0x83, 0x82, 0x00, 0x00, 0x90, 0x41, 0x28, 0x48, 0x28, 0x32, 0x05, 0x01,
+  0x00, 0x04, 0x11, 0x22, 0xf4, 0x06, 0xf4, 0x05, 0x11, 0x00, 0x10, 0x41,
+  0x21, 0x04, 0x9f, 0x4c, 0x04, 0x00, 0x22, 0x80, 0x21, 0x21, 0x04, 0x62,
+  0x00, 0x80, 0x08, 0x42, 0x62, 0x03, 0x02, 0xc1, 0x05, 0xb0, 0x20, 0x02,
+  0x00, 0x88, 0x8a, 0x02, 0x82, 0x20, 0x02, 0x82, 0x28, 0x50, 0x0b, 0xf0,
+  0x0b, 0x4d, 0x1c, 0xa0, 0x16, 0x20, 0x81, 0x82, 0x02, 0x32, 0x12, 0x00,
+  0x20, 0x05, 0x00, 0x48, 0x22, 0x12, 0x80, 0x24, 0x02, 0x22, 0x22, 0x00,
+  0x22, 0x30, 0x21, 0x40, 0x06, 0x01, 0x33, 0x03, 0xf0, 0x0a, 0x11, 0x28,
+  0x82, 0x28, 0x00, 0xa0, 0x48, 0x10, 0x02, 0x00, 0x48, 0x20, 0x02, 0x7f,
+  0x15, 0x02, 0x1a, 0x02, 0x1a, 0x82, 0xa2, 0x21, 0x12, 0x32, 0x12, 0x50,
+  0x07, 0x61, 0x20, 0x84, 0x22, 0x21, 0x82, 0x84, 0x6d, 0x0f, 0x33, 0x22,
+  0x00, 0x38, 0x1a, 0x02, 0xf0, 0x02, 0x12, 0x21, 0x22, 0x08, 0x82, 0x00,
+  0x48, 0x00, 0x88, 0x22, 0xa0, 0x42, 0xa0, 0x42, 0xf0, 0x66, 0x69, 0xfc,
+  0x00, 0x52, 0x42, 0x20, 0x04, 0xa0, 0x14, 0x6b, 0x05, 0x52, 0x28, 0x00,
+  0x00, 0x11, 0x12, 0xbc, 0x00, 0x71, 0x00, 0xa0, 0x82, 0x22, 0x20, 0x88,
+  0xc8, 0x9a, 0x00, 0x51, 0xf4, 0xaf, 0xd6, 0x00, 0x42, 0x52, 0x0b, 0x12,
+  0x38, 0xaa, 0x00, 0x32, 0x82, 0x20, 0x21, 0x60, 0x0b, 0x01, 0xf1, 0x02,
+  0x00, 0x04, 0x07, 0x01, 0x25, 0x0e, 0x71, 0x80, 0xf6, 0x2c, 0x6a, 0x20,
+  0x23, 0x06, 0x3d, 0x05, 0x20, 0x22, 0x82, 0xd9, 0x0d, 0x41, 0x00, 0x20,
+  0xa4, 0x21, 0x2b, 0x0c, 0x01, 0x01, 0x00, 0x20, 0x90, 0x41, 0xed, 0x0b,
+  0x81, 0x82, 0x80, 0x82, 0x02, 0x00, 0xe0, 0x35, 0x07, 0x20, 0x0c, 0x20,
+  0x82, 0x01, 0x58, 0x06, 0x01, 0xd4, 0x0c, 0x70, 0x20, 0x82, 0x04, 0x00,
+  0x20, 0x02, 0x88, 0xda, 0x00, 0x21, 0x22, 0x22, 0x99, 0x0d, 0xf0, 0x0f,
+  0x00, 0x00, 0x00, 0xcf, 0xa6, 0x01, 0x22, 0x28, 0x20, 0x01, 0x80, 0x84,
+  0x22, 0x02, 0x38, 0x00, 0x00, 0xa2, 0x42, 0x22, 0x80, 0x02, 0xc8, 0x42,
+  0x28, 0x4a, 0x02, 0x00, 0x2a, 0x24, 0x40, 0x05, 0x10, 0x08, 0x86, 0x00,
+  0xf1, 0x03, 0x28, 0x13, 0x04, 0x28, 0x88, 0x82, 0x21, 0x22, 0x82, 0x00,
+  0x22, 0x00, 0xa0, 0x24, 0x3f, 0xe6, 0x01, 0x18, 0xf6, 0x01, 0x10, 0x01,
+  0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x05, 0x01, 0x20, 0x80, 0x02, 0x3e,
+  0x0c, 0x02, 0xe2, 0x05, 0x00, 0x97, 0x04, 0xf2, 0x00, 0xd2, 0xd8, 0x20,
   0x04, 0x18, 0x80, 0x04, 0x12, 0xa0, 0x21, 0x22, 0x12, 0x20, 0x04, 0x48,
-  0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x20,
-  0x02, 0x00, 0x00, 0x28, 0x20, 0x02, 0x88, 0x80, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x8a, 0x04, 0xee, 0x91, 0x20, 0x02, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x20, 0x02, 0x20, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x02, 0x28, 0x00, 0x00, 0x80, 0x22, 0x08, 0x00, 0x00,
+  0x62, 0x06, 0x00, 0x1a, 0x00, 0x02, 0xbe, 0x04, 0x00, 0x89, 0x00, 0x01,
+  0x3e, 0x00, 0x45, 0x8a, 0x04, 0xee, 0x91, 0xd0, 0x04, 0x10, 0x20, 0x66,
+  0x0d, 0x03, 0x01, 0x00, 0x01, 0xb5, 0x04, 0x10, 0x80, 0x29, 0x05, 0xe1,
   0x00, 0x20, 0x84, 0x0c, 0x60, 0xcc, 0x20, 0x02, 0x18, 0x48, 0x00, 0x28,
-  0x20, 0x24, 0x21, 0x82, 0x02, 0x00, 0x00, 0x20, 0x04, 0x22, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x22,
-  0x00, 0x00, 0xa0, 0x82, 0x80, 0x08, 0x00, 0x22, 0xf0, 0xc9, 0xbc, 0x20,
-  0x81, 0x02, 0x20, 0x81, 0x24, 0x04, 0x00, 0x00, 0x00, 0x80, 0x24, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x20, 0x02, 0x00, 0x4f, 0x44,
-  0x07, 0x80, 0x84, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x28, 0x18, 0x00, 0x00, 0x00, 0x28, 0x22, 0x00, 0x20, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x04, 0x40,
-  0xf1, 0xad, 0x9e, 0x80, 0x04, 0x48, 0xa0, 0x24, 0xa0, 0x14, 0x20, 0x86,
-  0x24, 0x04, 0x42, 0x00, 0x20, 0x04, 0x28, 0x00, 0x00, 0xa0, 0x12, 0x12,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x22, 0x80, 0x02, 0x28, 0x00, 0x00,
-  0x80, 0x08, 0x88, 0x00, 0x00, 0x80, 0x08, 0x48, 0x90, 0xc3, 0x00, 0x00,
-  0x00, 0x00, 0x48, 0x00, 0x20, 0x02, 0x4a, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x82, 0x20, 0xd8, 0x5f, 0x0b, 0x12, 0x00,
-  0x42, 0x2a, 0x01, 0x80, 0x04, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x22,
-  0x80, 0x02, 0x22, 0x18, 0x22, 0x00, 0x80, 0x82, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x80, 0x0a, 0xee,
-  0xb3, 0x00, 0x80, 0x06, 0x00, 0x00, 0x80, 0x01, 0x00, 0x28, 0x00, 0x22,
-  0x20, 0x02, 0x00, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x28, 0x00, 0x22, 0x20, 0x02,
-  0x00, 0x21, 0xb0, 0x31, 0x02, 0x20, 0x02, 0xa0, 0x51, 0x42, 0x3a, 0x24,
-  0xa4, 0x21, 0x3a, 0xa1, 0x34, 0x22, 0x00, 0x6a, 0x84, 0x04, 0x48, 0x28,
-  0x80, 0x02, 0x22, 0x00, 0x00, 0x00, 0x80, 0x22, 0x02, 0x2a, 0x02, 0x22,
-  0x20, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x08, 0xa2, 0xa0, 0x28,
-  0xa0, 0x84, 0x82, 0x4e, 0xc1, 0xf0, 0x76, 0xd2, 0xa0, 0x73, 0x20, 0x02,
-  0x4a, 0x02, 0x42, 0x48, 0x6a, 0x04, 0x00, 0x4a, 0x26, 0x04, 0x20, 0x06,
-  0x2a, 0x04, 0x22, 0x80, 0x02, 0x28, 0x00, 0x00, 0x20, 0x02, 0x00, 0x80,
-  0x02, 0x28, 0xa0, 0x22, 0x20, 0x02, 0x2a, 0x02, 0x00, 0x8a, 0x08, 0x88,
-  0x00, 0x00, 0x00, 0x80, 0x82, 0xf8, 0xf5, 0x32, 0x20, 0x24, 0xa4, 0x31,
-  0x4a, 0x24, 0x02, 0x38, 0x00, 0x42, 0x12, 0x28, 0x00, 0x20, 0x84, 0x06,
-  0x00, 0x00, 0x20, 0x21, 0xa2, 0x11, 0x2a, 0x02, 0x2a, 0x02, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0xaa, 0x88, 0x20, 0x08, 0x80,
-  0x02, 0x22, 0xa0, 0x62, 0x4a, 0x28, 0x0a, 0xdf, 0xfc, 0x0d, 0x5a, 0x02,
-  0x1a, 0x02, 0x1a, 0x06, 0x28, 0x80, 0x06, 0x1a, 0x02, 0x48, 0x80, 0x04,
-  0x2a, 0x04, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22,
-  0x28, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x02, 0x28, 0x80, 0x02,
-  0x00, 0x82, 0x20, 0x02, 0x22, 0xa0, 0x42, 0xa0, 0x4a, 0xf0, 0xa7, 0x83,
-  0xa0, 0x33, 0x3a, 0xa3, 0x33, 0x3a, 0xa3, 0x33, 0x2a, 0xa3, 0x33, 0x6a,
-  0xa2, 0x22, 0x2a, 0xa2, 0x54, 0x2a, 0x02, 0x80, 0xa4, 0x22, 0x2a, 0xa2,
-  0x24, 0x2a, 0x82, 0xa2, 0x22, 0x28, 0x2a, 0x82, 0xa2, 0x22, 0x2a, 0xa2,
-  0x22, 0x28, 0x2a, 0x82, 0xa2, 0x22, 0x2a, 0xa2, 0x22, 0x2a, 0x22, 0xa2,
-  0x22, 0x22, 0x2a, 0x22, 0xa2, 0x22, 0x2a, 0xa2, 0x22, 0x22, 0x2a, 0x22,
-  0xa2, 0x22, 0x2a, 0x82, 0x88, 0x08, 0x2a, 0xa2, 0x22, 0x28, 0x2a, 0xa2,
-  0x22, 0xea, 0xae, 0x64, 0xea, 0xa6, 0x24, 0xdf, 0x15, 0x07, 0x3a, 0xa3,
-  0x61, 0x3a, 0xa3, 0x21, 0x3a, 0xa3, 0x75, 0x7a, 0xa7, 0x24, 0x2a, 0xa2,
-  0x64, 0x5a, 0x05, 0x2a, 0xa2, 0x44, 0x48, 0x62, 0x2a, 0xa2, 0x26, 0x2a,
-  0xa2, 0x22, 0x2e, 0x22, 0x2b, 0x22, 0x2a, 0xb2, 0x22, 0xa3, 0x22, 0xaa,
-  0xa8, 0x22, 0x2a, 0xaa, 0x22, 0x2a, 0xa2, 0x22, 0x1f, 0x12, 0x82, 0xe2,
-  0x12, 0xa2, 0x22, 0x2a, 0xa2, 0x66, 0x2a, 0xa2, 0x62, 0x2a, 0x82, 0xa2,
-  0x22, 0x2a, 0xa2, 0x22, 0x2a, 0xa2, 0x22, 0x8a, 0xaa, 0xa2, 0x88, 0x28,
-  0x22, 0x2a, 0xa2, 0x22, 0x2a, 0x22, 0xe2, 0x2e, 0xbe, 0x22, 0xae, 0x6e,
-  0x2b, 0xee, 0xaf, 0xd7, 0x02, 0x7a, 0xa7, 0x61, 0x3a, 0xa3, 0x21, 0x7a,
-  0x87, 0xa3, 0x33, 0x4a, 0xa2, 0x66, 0x1a, 0xa2, 0x76, 0x2a, 0xa2, 0x64,
-  0xa0, 0x44, 0x22, 0x6a, 0x26, 0xa4, 0x22, 0xa0, 0x22, 0x21, 0x2a, 0x82,
-  0xa1, 0x22, 0x2a, 0xa8, 0x22, 0xa0, 0x22, 0xa0, 0x22, 0x2e, 0x21, 0x28,
-  0x2a, 0x02, 0x2a, 0x82, 0xa4, 0x22, 0xa0, 0x22, 0x28, 0x2a, 0x02, 0x2a,
-  0x02, 0x2a, 0x82, 0x82, 0x8a, 0xa8, 0x88, 0x22, 0x2a, 0x02, 0x2a, 0x22,
-  0xa2, 0xee, 0x29, 0xa4, 0xee, 0xa0, 0xb6, 0xa0, 0x77, 0xa0, 0x33, 0xa0,
-  0x77, 0x5a, 0xa5, 0x77, 0x42, 0x6a, 0xa6, 0x45, 0x5a, 0xa5, 0x22, 0x4a,
-  0xa6, 0x44, 0x4a, 0x24, 0xa4, 0x66, 0x4a, 0xa2, 0x22, 0x28, 0x2a, 0x92,
-  0x22, 0x2e, 0x22, 0x28, 0x2a, 0x82, 0xa8, 0x22, 0x8a, 0xa2, 0x22, 0x28,
-  0x2a, 0xe2, 0x12, 0x02, 0x1b, 0x22, 0x22, 0x2a, 0xa2, 0x42, 0x2a, 0x22,
-  0xa6, 0x22, 0xa0, 0x22, 0x22, 0x2a, 0x22, 0xa2, 0x22, 0x8a, 0x88, 0x8a,
-  0xa8, 0x8a, 0xa0, 0x22, 0x28, 0x2a, 0x02, 0xea, 0x9e, 0xa2, 0xee, 0xe2,
-  0xca, 0xfa, 0x2e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x48, 0x00, 0x20, 0x04, 0x42, 0x00, 0x48, 0x2a, 0x01, 0x42, 0x20,
-  0x04, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x80, 0x08, 0x00, 0x00, 0x20, 0x08,
-  0x14, 0xef, 0xd1, 0x09, 0x2a, 0xb4, 0x11, 0x02, 0x1b, 0x21, 0x42, 0x1b,
-  0x69, 0x23, 0xb4, 0x11, 0xb6, 0x62, 0xb1, 0x11, 0xb6, 0x62, 0x99, 0x21,
-  0x2b, 0x94, 0x19, 0xb4, 0x42, 0xa9, 0x42, 0x2f, 0x14, 0xa9, 0x42, 0x2f,
-  0x14, 0xa9, 0x42, 0x2d, 0x91, 0x2a, 0xc4, 0x91, 0x2e, 0x42, 0x1c, 0xe8,
-  0x22, 0x64, 0x11, 0x2e, 0x42, 0x96, 0xe1, 0x22, 0x64, 0x19, 0x2c, 0xa4,
-  0x29, 0x2c, 0xb4, 0x91, 0xc2, 0x42, 0x1b, 0x29, 0x24, 0x1b, 0x29, 0x42,
-  0x1b, 0x29, 0x23, 0xb4, 0x81, 0x32, 0x42, 0x1b, 0x28, 0x2b, 0x84, 0x1b,
-  0x28, 0x2b, 0x84, 0x13, 0xb8, 0x42, 0x28, 0xba, 0x42, 0x28, 0xba, 0x42,
-  0x28, 0xb2, 0x42, 0xa8, 0x4a, 0x88, 0xae, 0x42, 0xce, 0xa1, 0x80, 0xb4,
-  0x11, 0x04, 0x1b, 0x61, 0x42, 0x1b, 0x21, 0x21, 0x19, 0x32, 0x42, 0x11,
-  0x29, 0x19, 0xb1, 0x42, 0x1b, 0x91, 0xb2, 0x22, 0x2f, 0x14, 0x29, 0xd2,
-  0x12, 0x29, 0xd2, 0x12, 0xb9, 0x22, 0xd4, 0x12, 0xe9, 0x22, 0xc5, 0x81,
-  0x2e, 0xd2, 0x1e, 0x81, 0x2e, 0x42, 0x96, 0xe1, 0x22, 0x64, 0x19, 0x3c,
-  0xe4, 0x19, 0xc2, 0x42, 0x1b, 0x29, 0x2c, 0xb4, 0x91, 0xc6, 0x42, 0x1b,
-  0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x32, 0x42, 0x19, 0x32, 0x42,
-  0x19, 0xb2, 0x42, 0x92, 0x21, 0x2b, 0x84, 0x22, 0x23, 0x24, 0xb2, 0x42,
-  0x28, 0x92, 0x82, 0x23, 0x12, 0xe2, 0x22, 0xf4, 0x26, 0xee, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x21, 0x00,
-  0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x21, 0xf0, 0xdc, 0xf3, 0x20, 0x01,
-  0x00, 0x00, 0x20, 0x83, 0x22, 0x22, 0x86, 0x82, 0x04, 0x20, 0xa4, 0x24,
-  0x22, 0x20, 0x82, 0x05, 0x20, 0x02, 0x28, 0x00, 0x18, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x20, 0x04, 0x00, 0x82, 0x00,
-  0x88, 0x42, 0x80, 0xf4, 0x79, 0x1f, 0x00, 0x18, 0x22, 0x18, 0x20, 0x23,
-  0x01, 0x00, 0x80, 0x08, 0x12, 0x80, 0x02, 0x20, 0x44, 0x01, 0x28, 0x42,
-  0x00, 0x80, 0xa4, 0x42, 0x00, 0x80, 0x23, 0x82, 0x22, 0x84, 0x02, 0x00,
-  0x18, 0x22, 0x80, 0x02, 0x00, 0x22, 0x00, 0x80, 0x02, 0x68, 0x20, 0x02,
-  0x40, 0x01, 0x9f, 0x7b, 0x01, 0x20, 0x25, 0x82, 0x01, 0x28, 0x18, 0x18,
-  0x22, 0x28, 0x2a, 0x84, 0x28, 0x06, 0x20, 0xa6, 0x24, 0x28, 0x80, 0xc2,
-  0x12, 0x22, 0x20, 0x03, 0xa2, 0x48, 0x4a, 0x02, 0x00, 0x11, 0x22, 0x00,
-  0x20, 0x04, 0x00, 0x28, 0x18, 0x22, 0x00, 0x20, 0x22, 0x02, 0x80, 0x02,
-  0x28, 0x00, 0x2c, 0x28, 0x04, 0xf0, 0x82, 0xdc, 0x80, 0x01, 0x00, 0x20,
-  0x01, 0x28, 0x00, 0x80, 0x02, 0x12, 0x00, 0x00, 0x42, 0x11, 0x42, 0x20,
-  0x04, 0x00, 0x00, 0x12, 0x22, 0xa0, 0x12, 0x20, 0x22, 0x24, 0x02, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0xa0, 0x48, 0x20, 0x02, 0x00,
-  0x48, 0x4f, 0x76, 0x0f, 0x20, 0x01, 0x00, 0x12, 0x80, 0x04, 0x20, 0x22,
-  0x01, 0x00, 0x00, 0x12, 0x00, 0x80, 0x84, 0x02, 0x4a, 0x02, 0x4a, 0x02,
-  0x4a, 0x02, 0x80, 0x05, 0x22, 0x80, 0x04, 0x80, 0x02, 0x28, 0x00, 0x80,
-  0x02, 0x82, 0x00, 0x00, 0x80, 0x04, 0x22, 0x20, 0x88, 0x22, 0xf2, 0x7c,
-  0x3a, 0x20, 0x22, 0x82, 0xa3, 0x21, 0x32, 0x80, 0x01, 0x48, 0x38, 0x20,
-  0x06, 0x00, 0x52, 0x2a, 0x84, 0xa4, 0x28, 0x80, 0x04, 0x42, 0x00, 0x42,
-  0x00, 0x20, 0x82, 0x02, 0xe2, 0x48, 0x48, 0x00, 0x28, 0x80, 0x26, 0x04,
-  0x22, 0x80, 0x8c, 0x22, 0x02, 0x13, 0x04, 0xe8, 0x20, 0x02, 0x48, 0x2a,
-  0x04, 0x00, 0x3f, 0xd9, 0x0c, 0x28, 0x22, 0xa0, 0x21, 0x28, 0x20, 0x21,
-  0x24, 0x24, 0x83, 0x22, 0x05, 0x00, 0x20, 0x86, 0x24, 0x08, 0x42, 0x80,
-  0x04, 0x00, 0x00, 0x4a, 0x82, 0x02, 0x20, 0x86, 0x04, 0x48, 0x20, 0x02,
-  0x20, 0x04, 0x00, 0x6a, 0x08, 0x88, 0x40, 0x01, 0x4a, 0x08, 0x22, 0x80,
-  0x84, 0x84, 0x08, 0xf0, 0xf2, 0x3f, 0x00, 0x12, 0x2a, 0x01, 0x18, 0x12,
-  0x00, 0x00, 0x20, 0x02, 0x00, 0x4a, 0x01, 0x12, 0x22, 0x00, 0x42, 0x22,
-  0xa0, 0x42, 0x48, 0x68, 0x00, 0x80, 0x82, 0x25, 0x28, 0x82, 0x04, 0x00,
-  0x28, 0x2a, 0x84, 0x02, 0x28, 0x00, 0x28, 0x28, 0x80, 0x04, 0x22, 0x20,
-  0x04, 0x22, 0x22, 0x80, 0x22, 0xf2, 0x58, 0xb7, 0x00, 0x18, 0x18, 0x12,
-  0x00, 0x00, 0x20, 0x04, 0x80, 0x02, 0x00, 0x00, 0xa0, 0x24, 0x18, 0x00,
-  0x52, 0x00, 0xa0, 0x24, 0x80, 0x22, 0x02, 0x00, 0x00, 0x42, 0x00, 0x00,
-  0x42, 0x80, 0x04, 0xc8, 0x20, 0x0a, 0x00, 0x4a, 0x08, 0x80, 0x02, 0x00,
-  0x48, 0xdf, 0x1c, 0x02, 0x4a, 0x22, 0x04, 0x22, 0x88, 0x18, 0x12, 0xa0,
-  0x24, 0x80, 0x01, 0x22, 0x8a, 0x04, 0x42, 0x48, 0x00, 0x00, 0x00, 0x12,
-  0x00, 0x42, 0x00, 0x48, 0x00, 0x00, 0x00, 0x42, 0x00, 0x20, 0x81, 0x28,
-  0x02, 0x48, 0x00, 0x22, 0x88, 0x80, 0x08, 0x00, 0x00, 0x42, 0x80, 0xf2,
-  0xee, 0xbb, 0x20, 0x01, 0x00, 0x88, 0x80, 0x86, 0x01, 0x18, 0x20, 0x02,
-  0x80, 0x85, 0x01, 0x00, 0x20, 0x84, 0x04, 0xa0, 0x42, 0x00, 0x00, 0x12,
-  0x20, 0x04, 0xa8, 0x28, 0x00, 0x80, 0x21, 0x04, 0x00, 0x00, 0x00, 0x20,
-  0x04, 0x00, 0x20, 0x86, 0x04, 0x00, 0x70, 0x39, 0x04, 0x3a, 0x84, 0x81,
-  0x81, 0x02, 0x12, 0x48, 0xa0, 0x24, 0x18, 0x12, 0x22, 0x00, 0x1a, 0x24,
-  0x21, 0x04, 0x80, 0x02, 0x42, 0x00, 0x62, 0x00, 0x68, 0xa0, 0x61, 0x22,
-  0x00, 0x88, 0x22, 0x00, 0x20, 0x81, 0x84, 0x81, 0x04, 0x48, 0x80, 0x04,
-  0x80, 0x0c, 0x00, 0xa0, 0x42, 0x22, 0x80, 0x04, 0x62, 0x5f, 0xe6, 0x09,
-  0x82, 0x00, 0x12, 0x00, 0x2a, 0x21, 0x01, 0x48, 0x00, 0xa0, 0x48, 0x80,
-  0x04, 0x00, 0x48, 0x4a, 0x01, 0x80, 0x04, 0x20, 0x04, 0x00, 0x80, 0x04,
-  0x22, 0x00, 0x00, 0x00, 0x80, 0x88, 0x02, 0x48, 0x88, 0x80, 0x08, 0x20,
-  0xa8, 0x84, 0x00, 0x48, 0x00, 0x00, 0xcd, 0xbf, 0x20, 0x01, 0x80, 0x01,
-  0xa0, 0x41, 0xa0, 0x24, 0x22, 0x20, 0x02, 0x80, 0x02, 0x00, 0x00, 0x12,
-  0x42, 0x00, 0x48, 0x00, 0x80, 0x05, 0x4a, 0x02, 0x80, 0x82, 0x04, 0x00,
-  0x00, 0x48, 0x28, 0x42, 0x28, 0x00, 0x00, 0x00, 0xa0, 0x42, 0x4a, 0x02,
-  0x00, 0x00, 0x68, 0xcf, 0xe9, 0x08, 0x20, 0x84, 0x01, 0x28, 0x48, 0x80,
-  0x06, 0x48, 0x00, 0x00, 0x00, 0x80, 0x06, 0x48, 0x28, 0x00, 0x48, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x12, 0x48, 0x00, 0x80, 0x24,
-  0x88, 0x08, 0x42, 0x20, 0x22, 0x08, 0x00, 0x00, 0x82, 0x28, 0xf0, 0x34,
-  0x51, 0x20, 0x08, 0x80, 0x82, 0x84, 0x04, 0x48, 0x80, 0x04, 0x20, 0x02,
-  0x18, 0x20, 0x84, 0x04, 0x2a, 0x84, 0x02, 0x00, 0x80, 0x21, 0x84, 0x04,
-  0x68, 0x48, 0x00, 0x00, 0x20, 0x06, 0x28, 0x00, 0x28, 0x22, 0x00, 0x00,
-  0x00, 0x20, 0x0a, 0x00, 0x22, 0x80, 0x8e, 0x08, 0xaf, 0xa5, 0x0b, 0x20,
-  0x81, 0x22, 0x8c, 0xa2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
-  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x80, 0x84, 0x02, 0x28, 0x48, 0x80,
-  0x04, 0x00, 0x42, 0x00, 0x28, 0x48, 0x28, 0x00, 0x42, 0x42, 0x88, 0x00,
-  0x00, 0x00, 0xf0, 0x97, 0x55, 0x00, 0x20, 0x01, 0x48, 0x28, 0x32, 0x22,
-  0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x48, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x80, 0x02, 0x82, 0x00,
-  0x00, 0x80, 0x24, 0x88, 0x08, 0x00, 0x2a, 0x6c, 0x16, 0xff, 0xc3, 0x0d,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x28, 0x80, 0x02, 0x00, 0xa0, 0x14,
-  0x20, 0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x20, 0x21, 0x04, 0x00, 0x20,
-  0x84, 0xa4, 0x21, 0x00, 0xa0, 0x48, 0x48, 0x00, 0x68, 0x42, 0x20, 0x02,
-  0x28, 0xa0, 0x24, 0x00, 0xd0, 0x4c, 0x0a, 0x12, 0x80, 0x24, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0x00, 0x00, 0x00, 0x48, 0x00,
-  0x00, 0x18, 0x80, 0x24, 0x02, 0x00, 0x2a, 0x04, 0x00, 0x48, 0x20, 0x04,
-  0x80, 0x04, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa4, 0x03, 0x20,
-  0x89, 0x02, 0x80, 0x21, 0x02, 0x48, 0x00, 0x00, 0x00, 0x80, 0x04, 0x28,
-  0x00, 0x42, 0x42, 0x42, 0x80, 0xa1, 0x41, 0x42, 0x00, 0x20, 0x04, 0x00,
-  0x48, 0x80, 0x82, 0x02, 0x00, 0x22, 0x20, 0x02, 0x00, 0x00, 0x2a, 0x04,
-  0x22, 0x28, 0x22, 0x2a, 0xa4, 0x42, 0x48, 0xf0, 0x4b, 0x26, 0x00, 0x80,
-  0x04, 0x82, 0x82, 0x00, 0x20, 0x82, 0x02, 0x22, 0x28, 0x00, 0x12, 0x00,
-  0x80, 0x04, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x00, 0x80,
-  0x24, 0x04, 0x00, 0x00, 0x00, 0x80, 0x82, 0x06, 0x80, 0x08, 0x00, 0x00,
-  0x21, 0xf0, 0xf9, 0x18, 0xa0, 0x11, 0x8a, 0x85, 0x81, 0xa2, 0x42, 0xa2,
-  0x2a, 0x81, 0x22, 0x04, 0x22, 0x00, 0x80, 0x02, 0x00, 0x4a, 0xa4, 0x22,
-  0x1a, 0x06, 0x42, 0x4a, 0x01, 0x42, 0x12, 0x00, 0x20, 0x02, 0x3a, 0x24,
-  0x06, 0x48, 0x48, 0x22, 0x4a, 0x01, 0x48, 0x6a, 0x02, 0x22, 0x88, 0xc8,
-  0x00, 0x00, 0x42, 0x2a, 0x08, 0xa8, 0x80, 0x82, 0x4c, 0x21, 0xf4, 0x9a,
-  0x21, 0x00, 0x82, 0x32, 0x62, 0x8a, 0x22, 0x21, 0x05, 0x48, 0x22, 0x80,
-  0x22, 0x02, 0x12, 0xa0, 0x44, 0xa0, 0x22, 0x20, 0x06, 0x00, 0xa0, 0x41,
-  0x00, 0xa0, 0x42, 0x5a, 0x24, 0x04, 0x48, 0x2a, 0x02, 0x22, 0x28, 0x28,
-  0x4a, 0xa4, 0x21, 0x48, 0x80, 0xa2, 0x24, 0x42, 0x22, 0x2a, 0x24, 0xa4,
-  0x24, 0x28, 0x80, 0x2a, 0x22, 0x22, 0xa4, 0x24, 0x2a, 0xa6, 0x42, 0x7f,
-  0xab, 0x08, 0x20, 0x81, 0x82, 0x21, 0xa4, 0x74, 0x68, 0x6a, 0x24, 0xa2,
-  0x64, 0x28, 0x22, 0x28, 0x00, 0x80, 0xa1, 0x66, 0x18, 0x4a, 0x04, 0x4a,
-  0x84, 0x84, 0x24, 0x84, 0xa1, 0x44, 0x4a, 0xa4, 0x14, 0x4a, 0x82, 0x82,
-  0x04, 0x28, 0x42, 0x42, 0x00, 0x2a, 0x04, 0x00, 0x2a, 0xa6, 0x44, 0xa2,
-  0x82, 0x42, 0x80, 0xa4, 0x42, 0xaa, 0xac, 0x6c, 0x2a, 0x04, 0x28, 0x2a,
-  0x24, 0xaa, 0x8c, 0x28, 0xff, 0x9e, 0x07, 0x80, 0x01, 0x80, 0x04, 0x48,
-  0x22, 0x48, 0x00, 0x00, 0x00, 0x80, 0x04, 0x48, 0x00, 0x42, 0x20, 0x04,
-  0x42, 0x20, 0x04, 0x4a, 0x02, 0x42, 0x00, 0x22, 0x42, 0x00, 0x00, 0x80,
-  0x24, 0x02, 0x20, 0x08, 0x00, 0x48, 0x28, 0x8a, 0x84, 0x02, 0x00, 0x28,
-  0x82, 0x28, 0x5d, 0xea, 0x20, 0xa9, 0x11, 0x22, 0x22, 0xea, 0xa2, 0x3f,
-  0x5a, 0xa1, 0x24, 0x6a, 0xa2, 0x26, 0x2a, 0xa2, 0x22, 0x22, 0x00, 0xa0,
-  0x15, 0x6a, 0xa2, 0x17, 0x6a, 0x22, 0x82, 0x04, 0x48, 0x80, 0xa4, 0x11,
-  0x48, 0x80, 0xa4, 0x13, 0x48, 0x1a, 0x81, 0x02, 0x48, 0x80, 0xa2, 0x22,
-  0xa0, 0x37, 0x42, 0x28, 0x6a, 0xa6, 0x22, 0x82, 0x00, 0x20, 0xa4, 0x82,
-  0x4a, 0xa8, 0x8a, 0x8a, 0xa8, 0x22, 0x62, 0x6a, 0xa2, 0x4c, 0x4a, 0xf4,
-  0x9f, 0xe2, 0x20, 0xa1, 0x44, 0x32, 0x22, 0x6a, 0xa2, 0x3b, 0x7a, 0x81,
-  0xa2, 0x26, 0x2a, 0xa2, 0x22, 0x2a, 0xa2, 0x22, 0x00, 0xa0, 0x15, 0x2a,
-  0xa2, 0x37, 0x28, 0x2c, 0x94, 0x42, 0x48, 0x29, 0x05, 0x8a, 0xac, 0x51,
-  0xc8, 0xa0, 0x62, 0x1a, 0xd5, 0x11, 0xa4, 0x11, 0x4e, 0x61, 0x22, 0x48,
-  0x48, 0x2a, 0xa2, 0x22, 0xa0, 0x37, 0x62, 0x28, 0x2a, 0xa2, 0xa2, 0x4a,
-  0x0c, 0x4a, 0x22, 0xa4, 0x44, 0x22, 0x4a, 0x2a, 0xa2, 0xa8, 0x2a, 0xe2,
-  0x26, 0xb2, 0x42, 0xa8, 0xc6, 0x2b, 0x64, 0xff, 0x13, 0x03, 0x12, 0x1a,
-  0x05, 0x22, 0x6a, 0xaa, 0x37, 0x5a, 0xa3, 0x24, 0x62, 0x42, 0x2a, 0xa2,
-  0x22, 0x28, 0x00, 0xa0, 0x15, 0x6a, 0xa2, 0x37, 0x62, 0x62, 0x29, 0x24,
-  0x84, 0x25, 0xa4, 0xc4, 0x5a, 0x81, 0x24, 0xa4, 0x66, 0x7a, 0xc1, 0x41,
-  0x5a, 0x85, 0xa2, 0x24, 0x4a, 0x84, 0xa4, 0x22, 0x2a, 0xa2, 0x44, 0x7a,
-  0xa3, 0x44, 0x2a, 0xa6, 0x66, 0x2a, 0x22, 0xa8, 0x44, 0x4a, 0xa6, 0x44,
-  0x42, 0x2a, 0xac, 0xc6, 0xaa, 0xac, 0x8a, 0x2a, 0xa2, 0x22, 0x2b, 0x62,
-  0xca, 0xa4, 0x46, 0x2f, 0x62, 0x0c, 0x92, 0x1a, 0xa5, 0x21, 0x2a, 0xa2,
-  0x66, 0x3a, 0xa5, 0x76, 0x68, 0x6a, 0x84, 0xa4, 0x22, 0x22, 0x28, 0x00,
-  0xa0, 0x55, 0x2a, 0xa6, 0x77, 0x2a, 0xa4, 0x46, 0x29, 0xe4, 0x24, 0x84,
-  0x24, 0xa4, 0xc4, 0x5a, 0xa5, 0x48, 0x42, 0x6a, 0xa6, 0x55, 0x1c, 0xa4,
-  0x55, 0x1b, 0x64, 0x6a, 0xa2, 0x44, 0xa0, 0x22, 0x2a, 0xa2, 0x44, 0x7a,
-  0xa3, 0x46, 0x2a, 0xa6, 0x64, 0xea, 0xae, 0xcc, 0x4a, 0x24, 0x24, 0xa4,
-  0x44, 0xaa, 0xa4, 0xee, 0x2a, 0xa4, 0xaa, 0x2a, 0xa2, 0x26, 0x2b, 0xee,
-  0xee, 0xc2, 0x6a, 0xf2, 0xba, 0xb5, 0x00, 0x00, 0x20, 0x02, 0x2a, 0x01,
-  0x00, 0x22, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0xa0, 0x24, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00,
-  0x00, 0x20, 0x08, 0xa0, 0x24, 0x20, 0x04, 0x5f, 0xff, 0x03, 0x18, 0x12,
-  0x22, 0x00, 0x48, 0x4a, 0x01, 0x42, 0x00, 0x00, 0x00, 0x20, 0x04, 0x42,
-  0x80, 0x82, 0x04, 0x00, 0x48, 0x42, 0x20, 0x04, 0x00, 0x80, 0x84, 0x82,
-  0x04, 0x00, 0x80, 0x24, 0x82, 0x24, 0xa2, 0x48, 0x42, 0x20, 0x04, 0xa0,
-  0x48, 0x4a, 0x22, 0x88, 0x02, 0x28, 0x82, 0x28, 0x14, 0x8f, 0xec, 0x0b,
-  0x58, 0x1b, 0x21, 0x18, 0x1b, 0x21, 0x4a, 0xb1, 0x11, 0x36, 0x62, 0x19,
-  0xb6, 0x42, 0x91, 0x61, 0x2b, 0x94, 0x19, 0xb2, 0x42, 0x39, 0x11, 0x2b,
-  0x94, 0x22, 0x2f, 0x14, 0xa9, 0x42, 0x2f, 0x14, 0xa9, 0x43, 0x2f, 0x14,
-  0xa9, 0x42, 0x4e, 0x91, 0x2e, 0x42, 0x4e, 0x81, 0x2e, 0x42, 0x56, 0xe1,
-  0x22, 0x64, 0x1d, 0x2e, 0x52, 0xde, 0x21, 0x2e, 0x42, 0x9a, 0xe2, 0x22,
-  0xb4, 0xd1, 0xe2, 0x22, 0xb4, 0x91, 0x42, 0xb2, 0x91, 0xa2, 0x14, 0x1b,
-  0x29, 0x23, 0xb6, 0x81, 0x36, 0x42, 0x1b, 0x28, 0x2b, 0x86, 0x19, 0xb2,
-  0x42, 0x18, 0xb1, 0x42, 0xa8, 0x4a, 0x2b, 0xa4, 0x2a, 0xb4, 0x42, 0x2a,
+  0x20, 0x24, 0x7e, 0x0d, 0x21, 0x20, 0x04, 0x26, 0x05, 0x03, 0x2b, 0x00,
+  0x01, 0xd6, 0x06, 0x10, 0xa0, 0x73, 0x02, 0xa1, 0x22, 0xf0, 0xc9, 0xbc,
+  0x20, 0x81, 0x02, 0x20, 0x81, 0x24, 0x1c, 0x0a, 0x16, 0x24, 0x35, 0x05,
+  0x03, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x50, 0x02, 0x00, 0x4f, 0x44, 0x07,
+  0x6b, 0x08, 0x32, 0x00, 0x00, 0x12, 0x7d, 0x02, 0x10, 0x28, 0x53, 0x01,
+  0x18, 0x28, 0xdb, 0x06, 0xf2, 0x03, 0x22, 0x20, 0x04, 0x40, 0xf1, 0xad,
+  0x9e, 0x80, 0x04, 0x48, 0xa0, 0x24, 0xa0, 0x14, 0x20, 0x86, 0x24, 0x04,
+  0x81, 0x0f, 0x30, 0x00, 0xa0, 0x12, 0xc1, 0x01, 0x00, 0x68, 0x01, 0x02,
+  0xa1, 0x00, 0x20, 0x08, 0x88, 0x05, 0x00, 0x30, 0x48, 0x90, 0xc3, 0x36,
+  0x00, 0x55, 0x48, 0x00, 0x20, 0x02, 0x4a, 0x44, 0x00, 0x03, 0x01, 0x00,
+  0x02, 0xe8, 0x00, 0xa1, 0x82, 0x20, 0xd8, 0x5f, 0x0b, 0x12, 0x00, 0x42,
+  0x2a, 0x01, 0xb0, 0x0b, 0x12, 0x04, 0x44, 0x03, 0x30, 0x18, 0x22, 0x00,
+  0xae, 0x01, 0x06, 0x01, 0x00, 0x81, 0x28, 0x80, 0x0a, 0xee, 0xb3, 0x00,
+  0x80, 0x06, 0xdd, 0x02, 0x10, 0x28, 0xce, 0x05, 0x0c, 0x8e, 0x03, 0x13,
+  0xa0, 0x16, 0x00, 0xf3, 0x07, 0xb0, 0x31, 0x02, 0x20, 0x02, 0xa0, 0x51,
+  0x42, 0x3a, 0x24, 0xa4, 0x21, 0x3a, 0xa1, 0x34, 0x22, 0x00, 0x6a, 0x84,
+  0x04, 0x48, 0x28, 0x47, 0x06, 0x32, 0x22, 0x02, 0x2a, 0x99, 0x04, 0x00,
+  0x47, 0x03, 0xe0, 0x08, 0xa2, 0xa0, 0x28, 0xa0, 0x84, 0x82, 0x4e, 0xc1,
+  0xf0, 0x76, 0xd2, 0xa0, 0x73, 0xa2, 0x00, 0xc2, 0x42, 0x48, 0x6a, 0x04,
+  0x00, 0x4a, 0x26, 0x04, 0x20, 0x06, 0x2a, 0x04, 0xc8, 0x00, 0x01, 0x1c,
+  0x07, 0x20, 0x28, 0xa0, 0xa5, 0x0c, 0x30, 0x02, 0x00, 0x8a, 0xd5, 0x00,
+  0xf0, 0x05, 0x00, 0x80, 0x82, 0xf8, 0xf5, 0x32, 0x20, 0x24, 0xa4, 0x31,
+  0x4a, 0x24, 0x02, 0x38, 0x00, 0x42, 0x12, 0x28, 0x00, 0x20, 0xdc, 0x0d,
+  0x72, 0x20, 0x21, 0xa2, 0x11, 0x2a, 0x02, 0x2a, 0x41, 0x07, 0x00, 0x5f,
+  0x00, 0x40, 0xaa, 0x88, 0x20, 0x08, 0x57, 0x05, 0x80, 0x62, 0x4a, 0x28,
+  0x0a, 0xdf, 0xfc, 0x0d, 0x5a, 0x28, 0x03, 0xb6, 0x06, 0x28, 0x80, 0x06,
+  0x1a, 0x02, 0x48, 0x80, 0x04, 0x2a, 0x04, 0x29, 0x05, 0x06, 0x8e, 0x06,
+  0x60, 0x80, 0x02, 0x00, 0x82, 0x20, 0x02, 0x25, 0x03, 0x80, 0x4a, 0xf0,
+  0xa7, 0x83, 0xa0, 0x33, 0x3a, 0xa3, 0x03, 0x00, 0x40, 0x2a, 0xa3, 0x33,
+  0x6a, 0x6b, 0x06, 0x20, 0x54, 0x2a, 0x53, 0x0d, 0x30, 0x2a, 0xa2, 0x24,
+  0x7a, 0x06, 0x13, 0x28, 0x7f, 0x06, 0x04, 0x08, 0x00, 0x00, 0xef, 0x0d,
+  0x01, 0x05, 0x00, 0x14, 0x2a, 0x08, 0x00, 0x33, 0x82, 0x88, 0x08, 0xaa,
+  0x06, 0xf5, 0x14, 0xea, 0xae, 0x64, 0xea, 0xa6, 0x24, 0xdf, 0x15, 0x07,
+  0x3a, 0xa3, 0x61, 0x3a, 0xa3, 0x21, 0x3a, 0xa3, 0x75, 0x7a, 0xa7, 0x24,
+  0x2a, 0xa2, 0x64, 0x5a, 0x05, 0x2a, 0xa2, 0x44, 0x48, 0x62, 0x2a, 0xa2,
+  0x26, 0x2a, 0xe0, 0x0c, 0x70, 0xa3, 0x22, 0xaa, 0xa8, 0x22, 0x2a, 0xaa,
+  0x47, 0x00, 0x50, 0x1f, 0x12, 0x82, 0xe2, 0x12, 0x51, 0x00, 0x44, 0x66,
+  0x2a, 0xa2, 0x62, 0x67, 0x00, 0x72, 0xa2, 0x22, 0x8a, 0xaa, 0xa2, 0x88,
+  0x28, 0x73, 0x00, 0xd0, 0xe2, 0x2e, 0xbe, 0x22, 0xae, 0x6e, 0x2b, 0xee,
+  0xaf, 0xd7, 0x02, 0x7a, 0xa7, 0x5b, 0x00, 0xf0, 0x06, 0x7a, 0x87, 0xa3,
+  0x33, 0x4a, 0xa2, 0x66, 0x1a, 0xa2, 0x76, 0x2a, 0xa2, 0x64, 0xa0, 0x44,
+  0x22, 0x6a, 0x26, 0xa4, 0x22, 0xa0, 0xb3, 0x06, 0xc0, 0xa1, 0x22, 0x2a,
+  0xa8, 0x22, 0xa0, 0x22, 0xa0, 0x22, 0x2e, 0x21, 0x28, 0x94, 0x06, 0x00,
+  0x17, 0x00, 0x00, 0x09, 0x00, 0xf0, 0x1c, 0x02, 0x2a, 0x82, 0x82, 0x8a,
+  0xa8, 0x88, 0x22, 0x2a, 0x02, 0x2a, 0x22, 0xa2, 0xee, 0x29, 0xa4, 0xee,
+  0xa0, 0xb6, 0xa0, 0x77, 0xa0, 0x33, 0xa0, 0x77, 0x5a, 0xa5, 0x77, 0x42,
+  0x6a, 0xa6, 0x45, 0x5a, 0xa5, 0x22, 0x4a, 0xa6, 0x44, 0x4a, 0x24, 0xa4,
+  0x66, 0x4a, 0xcc, 0x00, 0x30, 0x92, 0x22, 0x2e, 0xf2, 0x00, 0x30, 0xa8,
+  0x22, 0x8a, 0x0e, 0x00, 0x50, 0xe2, 0x12, 0x02, 0x1b, 0x22, 0x68, 0x0d,
+  0x30, 0x2a, 0x22, 0xa6, 0xbf, 0x06, 0x00, 0xf7, 0x00, 0x51, 0x8a, 0x88,
+  0x8a, 0xa8, 0x8a, 0x5c, 0x00, 0x97, 0xea, 0x9e, 0xa2, 0xee, 0xe2, 0xca,
+  0xfa, 0x2e, 0x3e, 0x47, 0x02, 0x0f, 0x01, 0x00, 0x00, 0x50, 0xff, 0xe4,
+  0x0f, 0x48, 0x00, 0xff, 0x0a, 0x40, 0x48, 0x2a, 0x01, 0x42, 0x10, 0x04,
+  0x0a, 0x1f, 0x00, 0x01, 0x8f, 0x03, 0xf0, 0x0a, 0x20, 0x08, 0x14, 0xef,
+  0xd1, 0x09, 0x2a, 0xb4, 0x11, 0x02, 0x1b, 0x21, 0x42, 0x1b, 0x69, 0x23,
+  0xb4, 0x11, 0xb6, 0x62, 0xb1, 0x11, 0xb6, 0x62, 0x99, 0xc8, 0x06, 0x62,
+  0xb4, 0x42, 0xa9, 0x42, 0x2f, 0x14, 0x04, 0x00, 0xf0, 0x00, 0x2d, 0x91,
+  0x2a, 0xc4, 0x91, 0x2e, 0x42, 0x1c, 0xe8, 0x22, 0x64, 0x11, 0x2e, 0x42,
+  0x96, 0xca, 0x06, 0x20, 0x2c, 0xa4, 0xc3, 0x06, 0x03, 0x1c, 0x0d, 0x11,
+  0x42, 0x1c, 0x0d, 0x00, 0xca, 0x06, 0x20, 0x2b, 0x84, 0x04, 0x00, 0x51,
+  0x13, 0xb8, 0x42, 0x28, 0xba, 0x03, 0x00, 0xf2, 0x0f, 0xb2, 0x42, 0xa8,
+  0x4a, 0x88, 0xae, 0x42, 0xce, 0xa1, 0x80, 0xb4, 0x11, 0x04, 0x1b, 0x61,
+  0x42, 0x1b, 0x21, 0x21, 0x19, 0x32, 0x42, 0x11, 0x29, 0x19, 0xb1, 0x42,
+  0x1b, 0x91, 0xb2, 0x23, 0x07, 0x60, 0x29, 0xd2, 0x12, 0xb9, 0x22, 0xd4,
+  0x1b, 0x0d, 0x53, 0x81, 0x2e, 0xd2, 0x1e, 0x81, 0x61, 0x00, 0x21, 0x3c,
+  0xe4, 0x1c, 0x0d, 0x56, 0x2c, 0xb4, 0x91, 0xc6, 0x42, 0x62, 0x00, 0x11,
+  0x19, 0x69, 0x07, 0x71, 0x92, 0x21, 0x2b, 0x84, 0x22, 0x23, 0x24, 0x28,
+  0x07, 0x76, 0x23, 0x12, 0xe2, 0x22, 0xf4, 0x26, 0xee, 0xdb, 0x00, 0x31,
+  0x20, 0x04, 0x21, 0x85, 0x03, 0x08, 0xb2, 0x09, 0x70, 0x00, 0x00, 0x21,
+  0xf0, 0xdc, 0xf3, 0x20, 0x38, 0x0c, 0xd0, 0x83, 0x22, 0x22, 0x86, 0x82,
+  0x04, 0x20, 0xa4, 0x24, 0x22, 0x20, 0x82, 0x05, 0x54, 0x09, 0x12, 0x18,
+  0x0a, 0x0a, 0x01, 0x1d, 0x00, 0xf0, 0x0c, 0x04, 0x00, 0x82, 0x00, 0x88,
+  0x42, 0x80, 0xf4, 0x79, 0x1f, 0x00, 0x18, 0x22, 0x18, 0x20, 0x23, 0x01,
+  0x00, 0x80, 0x08, 0x12, 0x80, 0x02, 0x20, 0x44, 0x01, 0x28, 0xf6, 0x0e,
+  0xa0, 0x42, 0x00, 0x80, 0x23, 0x82, 0x22, 0x84, 0x02, 0x00, 0x18, 0xa1,
+  0x09, 0x00, 0xae, 0x05, 0xf0, 0x15, 0x68, 0x20, 0x02, 0x40, 0x01, 0x9f,
+  0x7b, 0x01, 0x20, 0x25, 0x82, 0x01, 0x28, 0x18, 0x18, 0x22, 0x28, 0x2a,
+  0x84, 0x28, 0x06, 0x20, 0xa6, 0x24, 0x28, 0x80, 0xc2, 0x12, 0x22, 0x20,
+  0x03, 0xa2, 0x48, 0x4a, 0x02, 0x00, 0x14, 0x0d, 0x90, 0x04, 0x00, 0x28,
+  0x18, 0x22, 0x00, 0x20, 0x22, 0x02, 0x7f, 0x03, 0x80, 0x2c, 0x28, 0x04,
+  0xf0, 0x82, 0xdc, 0x80, 0x01, 0x55, 0x05, 0x81, 0x00, 0x80, 0x02, 0x12,
+  0x00, 0x00, 0x42, 0x11, 0x5f, 0x0c, 0x82, 0x12, 0x22, 0xa0, 0x12, 0x20,
+  0x22, 0x24, 0x02, 0x31, 0x0b, 0x40, 0x48, 0x00, 0xa0, 0x48, 0x34, 0x0c,
+  0xc0, 0x4f, 0x76, 0x0f, 0x20, 0x01, 0x00, 0x12, 0x80, 0x04, 0x20, 0x22,
+  0x01, 0xc4, 0x04, 0x21, 0x80, 0x84, 0x7e, 0x08, 0x70, 0x4a, 0x02, 0x80,
+  0x05, 0x22, 0x80, 0x04, 0x51, 0x00, 0x30, 0x80, 0x02, 0x82, 0x17, 0x06,
+  0xf0, 0x0f, 0x22, 0x20, 0x88, 0x22, 0xf2, 0x7c, 0x3a, 0x20, 0x22, 0x82,
+  0xa3, 0x21, 0x32, 0x80, 0x01, 0x48, 0x38, 0x20, 0x06, 0x00, 0x52, 0x2a,
+  0x84, 0xa4, 0x28, 0x80, 0x04, 0x42, 0x00, 0x42, 0x4a, 0x09, 0xf1, 0x1b,
+  0xe2, 0x48, 0x48, 0x00, 0x28, 0x80, 0x26, 0x04, 0x22, 0x80, 0x8c, 0x22,
+  0x02, 0x13, 0x04, 0xe8, 0x20, 0x02, 0x48, 0x2a, 0x04, 0x00, 0x3f, 0xd9,
+  0x0c, 0x28, 0x22, 0xa0, 0x21, 0x28, 0x20, 0x21, 0x24, 0x24, 0x83, 0x22,
+  0x05, 0x00, 0x20, 0x86, 0x24, 0x08, 0xc8, 0x07, 0x70, 0x4a, 0x82, 0x02,
+  0x20, 0x86, 0x04, 0x48, 0xaa, 0x05, 0xf1, 0x07, 0x00, 0x6a, 0x08, 0x88,
+  0x40, 0x01, 0x4a, 0x08, 0x22, 0x80, 0x84, 0x84, 0x08, 0xf0, 0xf2, 0x3f,
+  0x00, 0x12, 0x2a, 0x01, 0x18, 0x12, 0x4a, 0x04, 0xf0, 0x0c, 0x4a, 0x01,
+  0x12, 0x22, 0x00, 0x42, 0x22, 0xa0, 0x42, 0x48, 0x68, 0x00, 0x80, 0x82,
+  0x25, 0x28, 0x82, 0x04, 0x00, 0x28, 0x2a, 0x84, 0x02, 0x28, 0x00, 0x28,
+  0x28, 0x94, 0x00, 0xa1, 0x04, 0x22, 0x22, 0x80, 0x22, 0xf2, 0x58, 0xb7,
+  0x00, 0x18, 0x30, 0x00, 0x01, 0xaf, 0x0c, 0x81, 0xa0, 0x24, 0x18, 0x00,
+  0x52, 0x00, 0xa0, 0x24, 0xc1, 0x0f, 0xf0, 0x13, 0x42, 0x00, 0x00, 0x42,
+  0x80, 0x04, 0xc8, 0x20, 0x0a, 0x00, 0x4a, 0x08, 0x80, 0x02, 0x00, 0x48,
+  0xdf, 0x1c, 0x02, 0x4a, 0x22, 0x04, 0x22, 0x88, 0x18, 0x12, 0xa0, 0x24,
+  0x80, 0x01, 0x22, 0x8a, 0x04, 0x42, 0xc8, 0x01, 0x31, 0x12, 0x00, 0x42,
+  0xd0, 0x01, 0x91, 0x42, 0x00, 0x20, 0x81, 0x28, 0x02, 0x48, 0x00, 0x22,
+  0xc3, 0x02, 0xf2, 0x13, 0x42, 0x80, 0xf2, 0xee, 0xbb, 0x20, 0x01, 0x00,
+  0x88, 0x80, 0x86, 0x01, 0x18, 0x20, 0x02, 0x80, 0x85, 0x01, 0x00, 0x20,
+  0x84, 0x04, 0xa0, 0x42, 0x00, 0x00, 0x12, 0x20, 0x04, 0xa8, 0x28, 0x00,
+  0x80, 0x21, 0x40, 0x0d, 0xf0, 0x33, 0x00, 0x20, 0x86, 0x04, 0x00, 0x70,
+  0x39, 0x04, 0x3a, 0x84, 0x81, 0x81, 0x02, 0x12, 0x48, 0xa0, 0x24, 0x18,
+  0x12, 0x22, 0x00, 0x1a, 0x24, 0x21, 0x04, 0x80, 0x02, 0x42, 0x00, 0x62,
+  0x00, 0x68, 0xa0, 0x61, 0x22, 0x00, 0x88, 0x22, 0x00, 0x20, 0x81, 0x84,
+  0x81, 0x04, 0x48, 0x80, 0x04, 0x80, 0x0c, 0x00, 0xa0, 0x42, 0x22, 0x80,
+  0x04, 0x62, 0x5f, 0xe6, 0x09, 0x82, 0x00, 0x12, 0x00, 0x2a, 0x21, 0x01,
+  0x8e, 0x01, 0xa0, 0x80, 0x04, 0x00, 0x48, 0x4a, 0x01, 0x80, 0x04, 0x20,
+  0x04, 0x6e, 0x01, 0x00, 0x35, 0x05, 0x90, 0x88, 0x02, 0x48, 0x88, 0x80,
+  0x08, 0x20, 0xa8, 0x84, 0x9c, 0x00, 0xa3, 0xcd, 0xbf, 0x20, 0x01, 0x80,
+  0x01, 0xa0, 0x41, 0xa0, 0x24, 0x72, 0x0c, 0x10, 0x12, 0xb3, 0x00, 0x60,
+  0x80, 0x05, 0x4a, 0x02, 0x80, 0x82, 0x3d, 0x0e, 0x20, 0x28, 0x42, 0x6b,
+  0x02, 0x20, 0xa0, 0x42, 0x34, 0x06, 0xb0, 0x68, 0xcf, 0xe9, 0x08, 0x20,
+  0x84, 0x01, 0x28, 0x48, 0x80, 0x06, 0xd6, 0x00, 0x50, 0x80, 0x06, 0x48,
+  0x28, 0x00, 0x60, 0x00, 0x01, 0x0f, 0x01, 0x81, 0x12, 0x48, 0x00, 0x80,
+  0x24, 0x88, 0x08, 0x42, 0x39, 0x0c, 0xa0, 0x82, 0x28, 0xf0, 0x34, 0x51,
+  0x20, 0x08, 0x80, 0x82, 0x84, 0x9a, 0x00, 0xf0, 0x06, 0x20, 0x02, 0x18,
+  0x20, 0x84, 0x04, 0x2a, 0x84, 0x02, 0x00, 0x80, 0x21, 0x84, 0x04, 0x68,
+  0x48, 0x00, 0x00, 0x20, 0x06, 0x28, 0xcd, 0x06, 0xf2, 0x03, 0x00, 0x00,
+  0x20, 0x0a, 0x00, 0x22, 0x80, 0x8e, 0x08, 0xaf, 0xa5, 0x0b, 0x20, 0x81,
+  0x22, 0x8c, 0xa2, 0x21, 0x0f, 0x03, 0x00, 0x4f, 0x00, 0x00, 0x61, 0x00,
+  0x30, 0x84, 0x02, 0x28, 0x60, 0x00, 0x80, 0x42, 0x00, 0x28, 0x48, 0x28,
+  0x00, 0x42, 0x42, 0xf3, 0x05, 0x93, 0xf0, 0x97, 0x55, 0x00, 0x20, 0x01,
+  0x48, 0x28, 0x32, 0xb6, 0x0c, 0x11, 0x22, 0x61, 0x01, 0x13, 0x48, 0xa3,
+  0x0d, 0x02, 0x55, 0x02, 0xa2, 0x24, 0x88, 0x08, 0x00, 0x2a, 0x6c, 0x16,
+  0xff, 0xc3, 0x0d, 0xf4, 0x09, 0x00, 0xcd, 0x05, 0x21, 0xa0, 0x14, 0xe0,
+  0x07, 0xf0, 0x0b, 0x80, 0x02, 0x20, 0x21, 0x04, 0x00, 0x20, 0x84, 0xa4,
+  0x21, 0x00, 0xa0, 0x48, 0x48, 0x00, 0x68, 0x42, 0x20, 0x02, 0x28, 0xa0,
+  0x24, 0x00, 0xd0, 0x4c, 0x0a, 0x5e, 0x09, 0x02, 0x7e, 0x00, 0x01, 0x99,
+  0x00, 0x40, 0x48, 0x00, 0x00, 0x18, 0x12, 0x00, 0x41, 0x2a, 0x04, 0x00,
+  0x48, 0x9b, 0x08, 0x01, 0x1d, 0x00, 0x91, 0xcf, 0xa4, 0x03, 0x20, 0x89,
+  0x02, 0x80, 0x21, 0x02, 0x00, 0x01, 0x10, 0x04, 0x95, 0x00, 0x40, 0x42,
+  0x80, 0xa1, 0x41, 0x79, 0x07, 0x20, 0x00, 0x48, 0x27, 0x07, 0x01, 0xd2,
+  0x06, 0xc0, 0x2a, 0x04, 0x22, 0x28, 0x22, 0x2a, 0xa4, 0x42, 0x48, 0xf0,
+  0x4b, 0x26, 0xc0, 0x0f, 0x11, 0x82, 0x2e, 0x0c, 0x01, 0x60, 0x0a, 0x16,
+  0x04, 0x2b, 0x07, 0x02, 0x00, 0x08, 0x20, 0x82, 0x06, 0x13, 0x02, 0xf1,
+  0x01, 0x21, 0xf0, 0xf9, 0x18, 0xa0, 0x11, 0x8a, 0x85, 0x81, 0xa2, 0x42,
+  0xa2, 0x2a, 0x81, 0x22, 0x04, 0x55, 0x09, 0x90, 0x4a, 0xa4, 0x22, 0x1a,
+  0x06, 0x42, 0x4a, 0x01, 0x42, 0x03, 0x08, 0xf0, 0x6f, 0x3a, 0x24, 0x06,
+  0x48, 0x48, 0x22, 0x4a, 0x01, 0x48, 0x6a, 0x02, 0x22, 0x88, 0xc8, 0x00,
+  0x00, 0x42, 0x2a, 0x08, 0xa8, 0x80, 0x82, 0x4c, 0x21, 0xf4, 0x9a, 0x21,
+  0x00, 0x82, 0x32, 0x62, 0x8a, 0x22, 0x21, 0x05, 0x48, 0x22, 0x80, 0x22,
+  0x02, 0x12, 0xa0, 0x44, 0xa0, 0x22, 0x20, 0x06, 0x00, 0xa0, 0x41, 0x00,
+  0xa0, 0x42, 0x5a, 0x24, 0x04, 0x48, 0x2a, 0x02, 0x22, 0x28, 0x28, 0x4a,
+  0xa4, 0x21, 0x48, 0x80, 0xa2, 0x24, 0x42, 0x22, 0x2a, 0x24, 0xa4, 0x24,
+  0x28, 0x80, 0x2a, 0x22, 0x22, 0xa4, 0x24, 0x2a, 0xa6, 0x42, 0x7f, 0xab,
+  0x08, 0x20, 0x81, 0x82, 0x21, 0xa4, 0x74, 0x68, 0x6a, 0x24, 0xa2, 0x64,
+  0x28, 0x22, 0x28, 0x00, 0x80, 0xa1, 0x66, 0x18, 0x4a, 0x04, 0x4a, 0x84,
+  0x84, 0x24, 0x84, 0xa1, 0x44, 0x4a, 0xa4, 0x14, 0x4a, 0x82, 0x82, 0x04,
+  0x28, 0x42, 0x42, 0x07, 0x01, 0xf2, 0x0e, 0x2a, 0xa6, 0x44, 0xa2, 0x82,
+  0x42, 0x80, 0xa4, 0x42, 0xaa, 0xac, 0x6c, 0x2a, 0x04, 0x28, 0x2a, 0x24,
+  0xaa, 0x8c, 0x28, 0xff, 0x9e, 0x07, 0x80, 0x01, 0x80, 0x04, 0x48, 0x22,
+  0x10, 0x01, 0x10, 0x48, 0x4a, 0x0a, 0x91, 0x42, 0x20, 0x04, 0x4a, 0x02,
+  0x42, 0x00, 0x22, 0x42, 0xde, 0x08, 0xf1, 0x0b, 0x20, 0x08, 0x00, 0x48,
+  0x28, 0x8a, 0x84, 0x02, 0x00, 0x28, 0x82, 0x28, 0x5d, 0xea, 0x20, 0xa9,
+  0x11, 0x22, 0x22, 0xea, 0xa2, 0x3f, 0x5a, 0xa1, 0x24, 0x6a, 0xeb, 0x06,
+  0xf1, 0x30, 0x22, 0x00, 0xa0, 0x15, 0x6a, 0xa2, 0x17, 0x6a, 0x22, 0x82,
+  0x04, 0x48, 0x80, 0xa4, 0x11, 0x48, 0x80, 0xa4, 0x13, 0x48, 0x1a, 0x81,
+  0x02, 0x48, 0x80, 0xa2, 0x22, 0xa0, 0x37, 0x42, 0x28, 0x6a, 0xa6, 0x22,
+  0x82, 0x00, 0x20, 0xa4, 0x82, 0x4a, 0xa8, 0x8a, 0x8a, 0xa8, 0x22, 0x62,
+  0x6a, 0xa2, 0x4c, 0x4a, 0xf4, 0x9f, 0xe2, 0x20, 0xa1, 0x44, 0x32, 0x22,
+  0x6a, 0xa2, 0x3b, 0x7a, 0x81, 0x44, 0x00, 0x00, 0xaf, 0x0d, 0xf0, 0x0d,
+  0xa0, 0x15, 0x2a, 0xa2, 0x37, 0x28, 0x2c, 0x94, 0x42, 0x48, 0x29, 0x05,
+  0x8a, 0xac, 0x51, 0xc8, 0xa0, 0x62, 0x1a, 0xd5, 0x11, 0xa4, 0x11, 0x4e,
+  0x61, 0x22, 0x48, 0x48, 0xf6, 0x0d, 0xf0, 0x1a, 0x37, 0x62, 0x28, 0x2a,
+  0xa2, 0xa2, 0x4a, 0x0c, 0x4a, 0x22, 0xa4, 0x44, 0x22, 0x4a, 0x2a, 0xa2,
+  0xa8, 0x2a, 0xe2, 0x26, 0xb2, 0x42, 0xa8, 0xc6, 0x2b, 0x64, 0xff, 0x13,
+  0x03, 0x12, 0x1a, 0x05, 0x22, 0x6a, 0xaa, 0x37, 0x5a, 0xa3, 0x24, 0x62,
+  0x42, 0xa8, 0x07, 0x01, 0x94, 0x00, 0xf0, 0x08, 0x37, 0x62, 0x62, 0x29,
+  0x24, 0x84, 0x25, 0xa4, 0xc4, 0x5a, 0x81, 0x24, 0xa4, 0x66, 0x7a, 0xc1,
+  0x41, 0x5a, 0x85, 0xa2, 0x24, 0x4a, 0x84, 0xf6, 0x07, 0xf0, 0x20, 0x44,
+  0x7a, 0xa3, 0x44, 0x2a, 0xa6, 0x66, 0x2a, 0x22, 0xa8, 0x44, 0x4a, 0xa6,
+  0x44, 0x42, 0x2a, 0xac, 0xc6, 0xaa, 0xac, 0x8a, 0x2a, 0xa2, 0x22, 0x2b,
+  0x62, 0xca, 0xa4, 0x46, 0x2f, 0x62, 0x0c, 0x92, 0x1a, 0xa5, 0x21, 0x2a,
+  0xa2, 0x66, 0x3a, 0xa5, 0x76, 0x68, 0x6a, 0x84, 0xa4, 0x22, 0x51, 0x00,
+  0xf0, 0x0e, 0x55, 0x2a, 0xa6, 0x77, 0x2a, 0xa4, 0x46, 0x29, 0xe4, 0x24,
+  0x84, 0x24, 0xa4, 0xc4, 0x5a, 0xa5, 0x48, 0x42, 0x6a, 0xa6, 0x55, 0x1c,
+  0xa4, 0x55, 0x1b, 0x64, 0x6a, 0xa2, 0x44, 0x99, 0x0e, 0xf0, 0x11, 0x44,
+  0x7a, 0xa3, 0x46, 0x2a, 0xa6, 0x64, 0xea, 0xae, 0xcc, 0x4a, 0x24, 0x24,
+  0xa4, 0x44, 0xaa, 0xa4, 0xee, 0x2a, 0xa4, 0xaa, 0x2a, 0xa2, 0x26, 0x2b,
+  0xee, 0xee, 0xc2, 0x6a, 0xf2, 0xba, 0xb5, 0xb6, 0x04, 0x21, 0x2a, 0x01,
+  0xf4, 0x02, 0x21, 0x80, 0x02, 0xab, 0x0b, 0x10, 0xa0, 0x71, 0x0b, 0x13,
+  0x22, 0xf1, 0x0c, 0x90, 0x20, 0x08, 0xa0, 0x24, 0x20, 0x04, 0x5f, 0xff,
+  0x03, 0x24, 0x04, 0x30, 0x48, 0x4a, 0x01, 0x21, 0x00, 0x30, 0x20, 0x04,
+  0x42, 0xc4, 0x03, 0x10, 0x48, 0xa7, 0x05, 0xa0, 0x80, 0x84, 0x82, 0x04,
+  0x00, 0x80, 0x24, 0x82, 0x24, 0xa2, 0x0f, 0x00, 0xf1, 0x0e, 0xa0, 0x48,
+  0x4a, 0x22, 0x88, 0x02, 0x28, 0x82, 0x28, 0x14, 0x8f, 0xec, 0x0b, 0x58,
+  0x1b, 0x21, 0x18, 0x1b, 0x21, 0x4a, 0xb1, 0x11, 0x36, 0x62, 0x19, 0xb6,
+  0x42, 0x91, 0x61, 0x10, 0x0e, 0x53, 0x39, 0x11, 0x2b, 0x94, 0x22, 0x4b,
+  0x07, 0x10, 0x43, 0x08, 0x00, 0xf1, 0x0b, 0x4e, 0x91, 0x2e, 0x42, 0x4e,
+  0x81, 0x2e, 0x42, 0x56, 0xe1, 0x22, 0x64, 0x1d, 0x2e, 0x52, 0xde, 0x21,
+  0x2e, 0x42, 0x9a, 0xe2, 0x22, 0xb4, 0xd1, 0xe2, 0x22, 0x15, 0x0e, 0x80,
+  0xa2, 0x14, 0x1b, 0x29, 0x23, 0xb6, 0x81, 0x36, 0x4f, 0x07, 0x12, 0x86,
+  0x16, 0x0e, 0xf1, 0x27, 0xa8, 0x4a, 0x2b, 0xa4, 0x2a, 0xb4, 0x42, 0x2a,
   0x92, 0x82, 0xaa, 0x84, 0xea, 0x22, 0xf4, 0x61, 0xee, 0x80, 0x94, 0x61,
   0xb0, 0x11, 0x06, 0x1b, 0x21, 0x21, 0x11, 0x2b, 0x12, 0x19, 0xb2, 0x42,
   0x99, 0x21, 0x2b, 0x96, 0x11, 0x2b, 0xb4, 0x22, 0x2d, 0x81, 0x22, 0x2d,
-  0x91, 0x22, 0x2d, 0x91, 0x23, 0xd2, 0x12, 0xe9, 0x22, 0xc1, 0x81, 0x2e,
-  0xd2, 0x1e, 0x81, 0x26, 0x62, 0x19, 0x2c, 0x64, 0x18, 0x34, 0x9e, 0x21,
-  0x2c, 0x34, 0x91, 0x2c, 0xb4, 0x91, 0x46, 0xb2, 0x91, 0x26, 0xb4, 0x91,
-  0x32, 0x42, 0x1b, 0x28, 0x23, 0x94, 0x21, 0x23, 0x94, 0x21, 0x2b, 0xa4,
-  0x11, 0x29, 0x2a, 0x32, 0x42, 0x22, 0x29, 0x28, 0x92, 0x82, 0x29, 0x14,
-  0xc2, 0x42, 0x5f, 0x7d, 0x0d, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x44, 0x80, 0x28, 0x02, 0x00, 0x40,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08,
-  0x00, 0x21, 0xb0, 0x76, 0x04, 0x80, 0x01, 0x18, 0x12, 0x48, 0x49, 0x14,
-  0x28, 0x24, 0x04, 0x88, 0x00, 0x30, 0x18, 0x28, 0x00, 0x2a, 0x08, 0x28,
-  0x48, 0x00, 0x42, 0x32, 0x2a, 0x84, 0xa4, 0x24, 0x00, 0x32, 0x00, 0x18,
-  0x00, 0x00, 0x80, 0x02, 0x42, 0x48, 0x20, 0x08, 0x00, 0x80, 0x2c, 0x84,
-  0x22, 0x02, 0x00, 0x28, 0x4b, 0x73, 0x20, 0x24, 0x0a, 0x88, 0x22, 0x38,
-  0x20, 0x09, 0x8a, 0x82, 0xa6, 0x61, 0x10, 0x08, 0x28, 0x82, 0x1a, 0x88,
-  0x24, 0x01, 0x10, 0x24, 0xc2, 0x28, 0x28, 0x00, 0x22, 0x00, 0x88, 0x42,
-  0x12, 0x20, 0x82, 0x22, 0xa2, 0x12, 0x18, 0x46, 0x88, 0x01, 0x00, 0x62,
-  0x1a, 0x84, 0x0c, 0x20, 0x82, 0x02, 0x8b, 0x48, 0x48, 0x4a, 0xa8, 0x42,
-  0x8e, 0x61, 0x42, 0x4e, 0x3e, 0x80, 0xa4, 0x1e, 0x20, 0x81, 0xa3, 0x16,
-  0x43, 0x04, 0x48, 0x62, 0x62, 0x20, 0x02, 0xe0, 0x82, 0x81, 0x82, 0x28,
-  0x24, 0x42, 0x22, 0x02, 0x12, 0x84, 0x82, 0x18, 0x62, 0x68, 0x62, 0x30,
-  0x81, 0x28, 0x12, 0x00, 0x62, 0x22, 0x12, 0x80, 0xa4, 0x21, 0x80, 0x04,
-  0x20, 0xa8, 0x82, 0x00, 0xa0, 0x48, 0x48, 0xaa, 0x24, 0xe6, 0x24, 0xa8,
-  0x42, 0xc2, 0x68, 0xbf, 0xca, 0x04, 0x00, 0x80, 0x08, 0x00, 0x96, 0x08,
-  0x82, 0xa0, 0x69, 0x40, 0x08, 0x80, 0x28, 0x01, 0x92, 0x00, 0x46, 0x24,
-  0x82, 0xa2, 0x42, 0x28, 0x00, 0x00, 0x20, 0x05, 0xa0, 0x12, 0x00, 0x28,
-  0x18, 0x84, 0x00, 0x80, 0x24, 0xa6, 0x41, 0x42, 0x00, 0x22, 0x28, 0x10,
-  0x08, 0x00, 0x28, 0xf0, 0x2f, 0x52, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x12, 0x20, 0x01, 0xa2, 0x00, 0x42, 0x11, 0x81, 0x00,
-  0x20, 0x04, 0x12, 0x22, 0x00, 0x00, 0xa0, 0x12, 0x00, 0x12, 0x10, 0x21,
-  0x06, 0x22, 0x48, 0x20, 0x49, 0x01, 0x00, 0x00, 0x4a, 0xa2, 0x4a, 0x20,
-  0xf2, 0x51, 0xd7, 0x00, 0x2e, 0x14, 0x1a, 0x02, 0x22, 0x84, 0x12, 0x32,
-  0xa0, 0x21, 0x20, 0x81, 0x01, 0x49, 0x01, 0x12, 0x8c, 0x82, 0x82, 0x21,
-  0xa6, 0x24, 0x26, 0x28, 0xa2, 0x42, 0x13, 0x44, 0x84, 0x22, 0xa2, 0x25,
-  0x28, 0x58, 0x6a, 0x21, 0x25, 0x22, 0x22, 0x02, 0x98, 0x28, 0x22, 0x48,
-  0x28, 0xe0, 0x22, 0x08, 0x88, 0x11, 0x80, 0x08, 0x10, 0xa8, 0x28, 0x22,
-  0x00, 0x8b, 0x42, 0xd0, 0x2e, 0x03, 0x20, 0x81, 0x01, 0x10, 0x28, 0x21,
-  0x01, 0x22, 0x20, 0x21, 0x01, 0x49, 0x01, 0x80, 0x01, 0x20, 0x26, 0x84,
-  0x32, 0x21, 0x30, 0x41, 0x41, 0x00, 0x4a, 0x82, 0x22, 0x24, 0x02, 0x28,
-  0x22, 0x28, 0x00, 0x28, 0x22, 0x00, 0x80, 0x08, 0x42, 0x80, 0x98, 0x81,
+  0x91, 0x22, 0x2d, 0x91, 0x23, 0xd2, 0x12, 0xe9, 0x22, 0xc1, 0x4f, 0x07,
+  0xf5, 0x04, 0x26, 0x62, 0x19, 0x2c, 0x64, 0x18, 0x34, 0x9e, 0x21, 0x2c,
+  0x34, 0x91, 0x2c, 0xb4, 0x91, 0x46, 0xb2, 0x91, 0x26, 0x75, 0x0e, 0x00,
+  0x78, 0x0e, 0xf4, 0x03, 0xa4, 0x11, 0x29, 0x2a, 0x32, 0x42, 0x22, 0x29,
+  0x28, 0x92, 0x82, 0x29, 0x14, 0xc2, 0x42, 0x5f, 0x7d, 0x0d, 0xe8, 0x0b,
+  0x91, 0x00, 0x00, 0x00, 0x10, 0x02, 0x44, 0x80, 0x28, 0x02, 0xe6, 0x0b,
+  0x03, 0x01, 0x00, 0xf0, 0x15, 0x40, 0x08, 0x00, 0x21, 0xb0, 0x76, 0x04,
+  0x80, 0x01, 0x18, 0x12, 0x48, 0x49, 0x14, 0x28, 0x24, 0x04, 0x88, 0x00,
+  0x30, 0x18, 0x28, 0x00, 0x2a, 0x08, 0x28, 0x48, 0x00, 0x42, 0x32, 0x2a,
+  0x84, 0xa4, 0x24, 0x00, 0x32, 0xbf, 0x06, 0x00, 0x75, 0x0d, 0xf0, 0x15,
+  0x20, 0x08, 0x00, 0x80, 0x2c, 0x84, 0x22, 0x02, 0x00, 0x28, 0x4b, 0x73,
+  0x20, 0x24, 0x0a, 0x88, 0x22, 0x38, 0x20, 0x09, 0x8a, 0x82, 0xa6, 0x61,
+  0x10, 0x08, 0x28, 0x82, 0x1a, 0x88, 0x24, 0x01, 0x10, 0x24, 0xc2, 0x28,
+  0xf7, 0x0c, 0xf0, 0x3e, 0x88, 0x42, 0x12, 0x20, 0x82, 0x22, 0xa2, 0x12,
+  0x18, 0x46, 0x88, 0x01, 0x00, 0x62, 0x1a, 0x84, 0x0c, 0x20, 0x82, 0x02,
+  0x8b, 0x48, 0x48, 0x4a, 0xa8, 0x42, 0x8e, 0x61, 0x42, 0x4e, 0x3e, 0x80,
+  0xa4, 0x1e, 0x20, 0x81, 0xa3, 0x16, 0x43, 0x04, 0x48, 0x62, 0x62, 0x20,
+  0x02, 0xe0, 0x82, 0x81, 0x82, 0x28, 0x24, 0x42, 0x22, 0x02, 0x12, 0x84,
+  0x82, 0x18, 0x62, 0x68, 0x62, 0x30, 0x81, 0x28, 0x12, 0x00, 0x62, 0x22,
+  0x12, 0x80, 0xa4, 0x21, 0x80, 0x04, 0x20, 0xa8, 0x82, 0x8c, 0x04, 0xb0,
+  0xaa, 0x24, 0xe6, 0x24, 0xa8, 0x42, 0xc2, 0x68, 0xbf, 0xca, 0x04, 0x0b,
+  0x08, 0xf0, 0x01, 0x96, 0x08, 0x82, 0xa0, 0x69, 0x40, 0x08, 0x80, 0x28,
+  0x01, 0x92, 0x00, 0x46, 0x24, 0x82, 0xa2, 0x87, 0x05, 0xf2, 0x09, 0x20,
+  0x05, 0xa0, 0x12, 0x00, 0x28, 0x18, 0x84, 0x00, 0x80, 0x24, 0xa6, 0x41,
+  0x42, 0x00, 0x22, 0x28, 0x10, 0x08, 0x00, 0x28, 0xf0, 0x2f, 0x52, 0x30,
+  0x08, 0x10, 0x22, 0x40, 0x06, 0xa0, 0x01, 0xa2, 0x00, 0x42, 0x11, 0x81,
+  0x00, 0x20, 0x04, 0x12, 0x70, 0x0c, 0xf0, 0x61, 0x12, 0x00, 0x12, 0x10,
+  0x21, 0x06, 0x22, 0x48, 0x20, 0x49, 0x01, 0x00, 0x00, 0x4a, 0xa2, 0x4a,
+  0x20, 0xf2, 0x51, 0xd7, 0x00, 0x2e, 0x14, 0x1a, 0x02, 0x22, 0x84, 0x12,
+  0x32, 0xa0, 0x21, 0x20, 0x81, 0x01, 0x49, 0x01, 0x12, 0x8c, 0x82, 0x82,
+  0x21, 0xa6, 0x24, 0x26, 0x28, 0xa2, 0x42, 0x13, 0x44, 0x84, 0x22, 0xa2,
+  0x25, 0x28, 0x58, 0x6a, 0x21, 0x25, 0x22, 0x22, 0x02, 0x98, 0x28, 0x22,
+  0x48, 0x28, 0xe0, 0x22, 0x08, 0x88, 0x11, 0x80, 0x08, 0x10, 0xa8, 0x28,
+  0x22, 0x00, 0x8b, 0x42, 0xd0, 0x2e, 0x03, 0x20, 0x81, 0x01, 0x10, 0x28,
+  0x21, 0x01, 0x22, 0x20, 0x21, 0x01, 0x49, 0x01, 0x80, 0x01, 0x20, 0x26,
+  0x84, 0x32, 0x21, 0x30, 0x41, 0x41, 0x00, 0x4a, 0x82, 0x22, 0x24, 0x02,
+  0x42, 0x04, 0x20, 0x28, 0x22, 0xd9, 0x0e, 0xf0, 0x01, 0x80, 0x98, 0x81,
   0x00, 0x84, 0x88, 0x80, 0xa6, 0x82, 0x8b, 0x42, 0xf0, 0x22, 0x5f, 0x00,
-  0x4c, 0x82, 0x02, 0x22, 0x28, 0x80, 0x02, 0x12, 0x22, 0x00, 0x00, 0x18,
-  0x18, 0x83, 0x82, 0xa2, 0xa1, 0x20, 0x62, 0x84, 0xb0, 0x48, 0x02, 0x20,
-  0x82, 0x86, 0x81, 0xa1, 0x12, 0x1a, 0xa4, 0x41, 0x00, 0x80, 0xa3, 0x81,
-  0x20, 0x21, 0xc4, 0x21, 0x2a, 0xc4, 0x22, 0x22, 0x88, 0x14, 0x12, 0x00,
-  0x00, 0x22, 0x28, 0x80, 0x04, 0x28, 0x6d, 0x86, 0x20, 0x24, 0x94, 0x28,
-  0x81, 0x48, 0x18, 0xa0, 0x82, 0x28, 0x20, 0x89, 0x62, 0x82, 0x40, 0x88,
-  0x81, 0x02, 0x89, 0x32, 0x44, 0x83, 0x21, 0x04, 0x83, 0xa3, 0x28, 0x80,
-  0x24, 0xa3, 0x42, 0x12, 0x1a, 0x14, 0x05, 0xb0, 0x18, 0xa2, 0x21, 0x62,
-  0x80, 0x01, 0x18, 0x20, 0x04, 0x00, 0x26, 0x28, 0x02, 0x20, 0x22, 0xa9,
-  0x24, 0x1a, 0x04, 0x00, 0x30, 0x18, 0x8f, 0x11, 0x07, 0x28, 0x42, 0x12,
-  0x00, 0x22, 0x8c, 0x0a, 0x00, 0x44, 0x20, 0x02, 0x12, 0x00, 0x00, 0x00,
-  0x49, 0x28, 0x21, 0x01, 0x83, 0x6c, 0x11, 0x48, 0x10, 0x08, 0x11, 0x28,
-  0x22, 0x81, 0x20, 0x04, 0x28, 0x20, 0x04, 0x80, 0x02, 0x8c, 0x01, 0x22,
-  0x82, 0x84, 0x88, 0x26, 0x04, 0x88, 0x80, 0x08, 0x48, 0x12, 0xdf, 0x9d,
-  0x07, 0x80, 0x01, 0x2a, 0x01, 0x81, 0xc8, 0x82, 0x80, 0x01, 0x48, 0x52,
-  0x00, 0x10, 0x84, 0xa1, 0x41, 0x60, 0x42, 0x81, 0x46, 0x08, 0x00, 0x84,
-  0x00, 0x00, 0x80, 0x04, 0x42, 0x88, 0x00, 0x00, 0x83, 0x12, 0x08, 0x00,
-  0x68, 0x00, 0x00, 0x00, 0x80, 0x22, 0x02, 0x20, 0x02, 0xcf, 0xbf, 0x08,
-  0x80, 0x81, 0x92, 0x18, 0x48, 0x18, 0x8b, 0x42, 0x20, 0x02, 0x8a, 0x81,
-  0xa6, 0x14, 0xc0, 0x18, 0x18, 0x49, 0x02, 0x16, 0xc8, 0x44, 0xc3, 0x73,
-  0x88, 0x64, 0x85, 0x22, 0x22, 0x84, 0x56, 0x28, 0x81, 0x14, 0x88, 0x01,
-  0x2a, 0x84, 0xa2, 0x12, 0x92, 0x22, 0xa0, 0x12, 0xa0, 0x16, 0x84, 0x80,
-  0x02, 0x8b, 0x61, 0x89, 0x02, 0x10, 0xa8, 0x82, 0x43, 0x8a, 0xa6, 0x42,
-  0x28, 0x88, 0xa0, 0x24, 0x84, 0xdb, 0x74, 0xa0, 0x42, 0x90, 0x18, 0x28,
-  0xc0, 0x28, 0x80, 0x02, 0x12, 0x00, 0x81, 0x00, 0x00, 0x12, 0x4a, 0x02,
-  0x80, 0x04, 0x84, 0x88, 0x48, 0x14, 0x2a, 0x84, 0x82, 0x21, 0x14, 0x04,
-  0x20, 0x24, 0x02, 0x00, 0x40, 0x08, 0x48, 0x00, 0x00, 0x20, 0x08, 0x80,
-  0x01, 0x98, 0x00, 0x00, 0x70, 0x53, 0x09, 0x22, 0x00, 0x28, 0x00, 0x80,
-  0x23, 0x04, 0x83, 0x91, 0x28, 0x12, 0x18, 0x22, 0x00, 0x84, 0x20, 0x04,
-  0x42, 0x00, 0x00, 0x20, 0x05, 0x84, 0x81, 0x11, 0x20, 0x42, 0x28, 0x22,
-  0x01, 0x20, 0x02, 0x22, 0x48, 0x48, 0x00, 0x00, 0x20, 0x82, 0xaa, 0x28,
-  0x80, 0x94, 0x18, 0x28, 0x22, 0x80, 0xf4, 0x84, 0xc1, 0x00, 0x42, 0xa0,
-  0x14, 0x22, 0x88, 0x1e, 0x28, 0x48, 0x80, 0x29, 0x04, 0x22, 0x80, 0x81,
-  0x01, 0x00, 0x20, 0x24, 0x82, 0x02, 0x84, 0x80, 0x04, 0x42, 0x00, 0x84,
-  0x30, 0x51, 0x28, 0x42, 0x00, 0x22, 0x80, 0x02, 0x28, 0xa0, 0x42, 0x20,
-  0x01, 0x00, 0x18, 0x80, 0x04, 0x42, 0x80, 0x04, 0xf0, 0x28, 0x91, 0x20,
-  0x22, 0x03, 0x20, 0xa5, 0x41, 0x00, 0x00, 0x88, 0x84, 0x44, 0x00, 0x00,
-  0x83, 0x22, 0x04, 0x48, 0x18, 0x32, 0x00, 0x2a, 0x89, 0x64, 0x88, 0x12,
-  0x22, 0x12, 0x48, 0x12, 0x00, 0x10, 0x08, 0x18, 0x42, 0x00, 0x42, 0x00,
-  0x42, 0x28, 0x12, 0xa0, 0x12, 0x00, 0x10, 0xa8, 0x24, 0x38, 0x20, 0x02,
-  0xef, 0x3f, 0x0c, 0x84, 0x80, 0x04, 0xa0, 0x28, 0x40, 0x88, 0x01, 0x00,
-  0x80, 0x12, 0x08, 0x58, 0x00, 0x26, 0x28, 0x02, 0x00, 0x40, 0x28, 0x01,
-  0x84, 0x00, 0x80, 0x02, 0x00, 0x80, 0x04, 0x81, 0x00, 0xa0, 0x21, 0x48,
-  0x28, 0x00, 0x28, 0x00, 0x18, 0x2a, 0x04, 0x12, 0x00, 0x00, 0x27, 0x19,
-  0x20, 0x18, 0x08, 0x42, 0x00, 0x52, 0x28, 0x80, 0xac, 0x14, 0x00, 0x18,
-  0x22, 0x20, 0x04, 0x81, 0x84, 0x18, 0x00, 0x00, 0x81, 0x28, 0x12, 0x40,
-  0xa8, 0x14, 0x80, 0x91, 0x21, 0x42, 0x28, 0x22, 0x22, 0x4a, 0x93, 0x28,
-  0x8c, 0xc4, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x88, 0x84, 0x88,
-  0x00, 0x14, 0x1f, 0x7d, 0x0f, 0x00, 0x80, 0x22, 0x02, 0x00, 0x80, 0x81,
-  0x48, 0x04, 0x00, 0x10, 0x81, 0x84, 0x01, 0x20, 0x02, 0x80, 0x24, 0x02,
-  0x40, 0x21, 0x34, 0x28, 0x52, 0x00, 0x20, 0x04, 0x00, 0x1a, 0x84, 0x01,
-  0x00, 0x20, 0x04, 0x90, 0x21, 0x20, 0x8b, 0x02, 0x28, 0x00, 0x80, 0x08,
-  0x5f, 0xe8, 0x0c, 0x84, 0xa0, 0x43, 0x10, 0x08, 0x28, 0x1a, 0x24, 0x04,
-  0x84, 0x4c, 0x04, 0x28, 0x20, 0x01, 0x00, 0x28, 0x00, 0x11, 0x10, 0x08,
-  0x88, 0x42, 0x42, 0x00, 0x28, 0x80, 0x05, 0x84, 0x14, 0x48, 0x00, 0x80,
-  0x44, 0x08, 0x00, 0x12, 0x80, 0x03, 0x20, 0x08, 0x58, 0x80, 0x01, 0x00,
-  0xae, 0x57, 0x00, 0x22, 0x83, 0x02, 0x42, 0x62, 0x81, 0x80, 0x01, 0x00,
-  0x00, 0x00, 0x18, 0x40, 0x08, 0x28, 0x42, 0x12, 0x20, 0x84, 0x25, 0x21,
-  0x02, 0x28, 0x13, 0xe2, 0x81, 0x02, 0x20, 0x02, 0x00, 0x11, 0x20, 0x02,
-  0x22, 0x78, 0x80, 0x03, 0x18, 0x00, 0x00, 0x30, 0x28, 0x28, 0x00, 0x00,
-  0xbf, 0x2d, 0x0c, 0x84, 0x83, 0x81, 0x24, 0x01, 0x12, 0x00, 0x84, 0x10,
-  0x44, 0x04, 0x28, 0x12, 0x00, 0x20, 0x04, 0x80, 0x11, 0x22, 0x82, 0x01,
-  0x19, 0x0a, 0x81, 0x00, 0xc0, 0x21, 0x20, 0x41, 0x08, 0x2a, 0x84, 0x24,
-  0x01, 0x00, 0x80, 0x02, 0x44, 0x28, 0x28, 0x00, 0x58, 0x32, 0x00, 0x20,
-  0x12, 0x02, 0xbe, 0x46, 0x00, 0xb6, 0x38, 0x28, 0x32, 0x4a, 0x84, 0xa1,
-  0x16, 0x4a, 0x81, 0xa4, 0x91, 0x8f, 0x8d, 0x24, 0x12, 0x84, 0xa1, 0x12,
-  0x12, 0x42, 0x28, 0x48, 0x2a, 0x24, 0x22, 0x85, 0x22, 0x92, 0x48, 0xa8,
-  0x5a, 0x31, 0x78, 0x8c, 0x04, 0x87, 0x12, 0x2e, 0x48, 0x2a, 0xa3, 0x62,
-  0x80, 0x86, 0x01, 0x19, 0xa3, 0x36, 0x12, 0x8b, 0x22, 0x89, 0xa4, 0x62,
-  0x28, 0xa0, 0x13, 0x80, 0x01, 0x8a, 0xa8, 0x8b, 0x2a, 0x92, 0x68, 0x89,
-  0x84, 0x23, 0xc2, 0x81, 0xe0, 0xc2, 0x0c, 0x2a, 0x82, 0x26, 0x81, 0xb2,
-  0x28, 0xa2, 0x46, 0x8b, 0x21, 0x83, 0x31, 0x18, 0x90, 0x14, 0x87, 0x84,
-  0x20, 0x81, 0x82, 0x01, 0x81, 0x85, 0x88, 0x22, 0xa4, 0x62, 0x3a, 0x01,
-  0x46, 0x78, 0x28, 0x48, 0xa1, 0x18, 0x8f, 0x14, 0x21, 0xc2, 0x28, 0x8b,
-  0x31, 0xd0, 0x11, 0x01, 0x62, 0x99, 0x22, 0xa2, 0x42, 0x12, 0x81, 0x00,
-  0x5a, 0xa1, 0x44, 0x62, 0xa0, 0x11, 0xa0, 0x23, 0x3a, 0x81, 0x82, 0xe4,
-  0x82, 0xe9, 0x82, 0xa2, 0x81, 0x42, 0x00, 0x9f, 0x15, 0x06, 0x90, 0x18,
-  0x28, 0x4a, 0x25, 0xa1, 0x21, 0x84, 0x2a, 0xa6, 0x14, 0xc2, 0x88, 0xa0,
-  0x21, 0x60, 0x81, 0xe0, 0x11, 0x65, 0x84, 0x4a, 0x51, 0x88, 0x78, 0x18,
-  0x14, 0x00, 0x1a, 0xa5, 0x62, 0x48, 0xd0, 0x88, 0xa6, 0x51, 0x46, 0x21,
-  0x21, 0xe5, 0x83, 0x06, 0x80, 0x22, 0xd5, 0x88, 0xa4, 0x26, 0x42, 0x6a,
-  0x02, 0x22, 0x78, 0x28, 0x22, 0x11, 0x80, 0xa2, 0x14, 0x52, 0x42, 0x5a,
-  0x21, 0x82, 0x22, 0x22, 0xf4, 0x8c, 0xf7, 0x00, 0x22, 0x20, 0x82, 0x84,
-  0x01, 0x22, 0x12, 0x60, 0x89, 0x00, 0x20, 0x01, 0x16, 0x08, 0x48, 0x00,
-  0x28, 0x00, 0xa0, 0x24, 0x18, 0x00, 0x4a, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x28, 0x48, 0x00, 0x89, 0x02, 0x00,
-  0xf0, 0x2c, 0xcd, 0x20, 0xa8, 0x31, 0xf0, 0x18, 0x38, 0x8f, 0x82, 0xaa,
-  0x91, 0x1a, 0xf1, 0x48, 0x28, 0x5a, 0xd5, 0x88, 0x11, 0x18, 0x08, 0xd0,
-  0x88, 0x51, 0x88, 0x1f, 0x11, 0x01, 0x8f, 0x85, 0xd1, 0x88, 0xa2, 0x75,
-  0x4a, 0xf4, 0x11, 0x11, 0x2a, 0x62, 0x84, 0x46, 0xf8, 0x41, 0x41, 0x6a,
-  0x56, 0x19, 0x83, 0xf2, 0x59, 0x41, 0x5a, 0xa7, 0x33, 0x2a, 0xa2, 0x77,
-  0x4a, 0xd6, 0x11, 0xa2, 0x22, 0x1d, 0x21, 0x8f, 0x86, 0xa6, 0x33, 0x8f,
-  0x86, 0xf6, 0x78, 0x78, 0x5a, 0xa7, 0x26, 0x5a, 0xa5, 0x32, 0x1a, 0x51,
-  0x11, 0x00, 0x82, 0x3a, 0xa2, 0xdf, 0x3e, 0x58, 0x8a, 0xa8, 0x22, 0x8a,
-  0x08, 0x77, 0xdf, 0x80, 0xe2, 0x81, 0xa7, 0x13, 0x8f, 0x81, 0xf3, 0x78,
-  0x78, 0x7a, 0xa3, 0x55, 0x8f, 0x86, 0xa3, 0x55, 0x8f, 0x88, 0xf1, 0x9c,
-  0x84, 0x8b, 0x44, 0x28, 0x12, 0x87, 0x81, 0x85, 0xf8, 0x51, 0x49, 0x84,
-  0x5e, 0x18, 0x8f, 0x82, 0xe2, 0x27, 0xb7, 0x72, 0xf7, 0x31, 0x11, 0x2b,
-  0x32, 0x42, 0x8f, 0x8e, 0xfb, 0x71, 0x51, 0x6a, 0x57, 0x19, 0x87, 0x86,
-  0x9f, 0x17, 0xe4, 0x97, 0xa6, 0x33, 0x2a, 0xf3, 0x78, 0x78, 0x4a, 0xf4,
-  0x21, 0x61, 0x2a, 0xd2, 0x11, 0xf6, 0x48, 0x78, 0x8f, 0x87, 0xa7, 0x66,
-  0x8f, 0x87, 0xa3, 0x73, 0x6a, 0xf2, 0x54, 0x74, 0x2a, 0xe3, 0x41, 0xf3,
-  0x11, 0x11, 0x1a, 0xa1, 0xa2, 0xaa, 0xac, 0x23, 0x8b, 0xff, 0x7e, 0x78,
-  0x9e, 0x82, 0x2b, 0x22, 0xaa, 0x9a, 0x12, 0xde, 0x82, 0x20, 0xa2, 0x71,
-  0x1a, 0xf3, 0x18, 0x38, 0x8f, 0x81, 0xa9, 0x75, 0x3a, 0xa1, 0x24, 0x12,
-  0x8d, 0x98, 0x4e, 0xd4, 0x80, 0x02, 0x18, 0x18, 0x9f, 0x11, 0xb1, 0x48,
-  0xe4, 0x85, 0xf5, 0x28, 0x48, 0x5a, 0xb5, 0x42, 0xf5, 0x31, 0x31, 0x2a,
-  0xa3, 0x44, 0x4a, 0xf8, 0x71, 0x21, 0x7a, 0x56, 0x11, 0x6a, 0xf4, 0x19,
-  0x21, 0x8f, 0x17, 0xa6, 0x33, 0x6a, 0xe6, 0x83, 0xa3, 0x64, 0x1d, 0x61,
-  0xf0, 0x11, 0x11, 0x8f, 0x87, 0xf7, 0x78, 0x78, 0x8f, 0x86, 0xf4, 0x68,
-  0x68, 0x7a, 0xa7, 0x26, 0x5e, 0x74, 0x6a, 0xa6, 0x31, 0x1f, 0x11, 0xa1,
-  0x11, 0x28, 0xca, 0xa6, 0x23, 0xfe, 0xf8, 0x6e, 0x48, 0x9a, 0xbb, 0x22,
-  0xa2, 0xaa, 0x18, 0x9f, 0x8f, 0x02, 0xaa, 0xb2, 0x18, 0xa3, 0x33, 0x8f,
-  0x81, 0xf3, 0x58, 0x58, 0x4a, 0xab, 0x57, 0x8f, 0x86, 0xa3, 0x45, 0x8f,
-  0x8c, 0xe5, 0x4d, 0xfd, 0x48, 0x48, 0xa0, 0x11, 0x1a, 0x81, 0xf1, 0x59,
-  0x49, 0x8f, 0x84, 0xe4, 0x85, 0xf5, 0x28, 0x48, 0x5a, 0xb5, 0x62, 0xf3,
-  0x31, 0x13, 0x2a, 0xf2, 0x48, 0x48, 0x8f, 0x87, 0xfe, 0x71, 0x51, 0x6a,
-  0x57, 0x11, 0x6a, 0xf4, 0x79, 0x61, 0x8f, 0x87, 0xa6, 0x33, 0x6a, 0xe6,
-  0x87, 0xa5, 0x44, 0x1f, 0x12, 0x02, 0x1f, 0x17, 0xf3, 0x78, 0x78, 0x8f,
-  0x87, 0xa7, 0x66, 0x8f, 0x86, 0xa2, 0x77, 0x6a, 0xe2, 0x45, 0xa7, 0x77,
-  0x4b, 0x11, 0x15, 0x01, 0x2a, 0xaa, 0xde, 0x3a, 0xf2, 0xf8, 0xf8, 0x6e,
-  0x78, 0x9a, 0xbb, 0x22, 0xe2, 0x2a, 0x0a, 0xef, 0x49, 0x0f, 0x22, 0x00,
-  0x00, 0x20, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
-  0x00, 0x00, 0x81, 0x10, 0x08, 0x20, 0x22, 0x24, 0x02, 0x00, 0x22, 0x00,
-  0x48, 0x80, 0x04, 0x48, 0x00, 0x20, 0x01, 0x80, 0x82, 0x84, 0x02, 0x00,
-  0x6f, 0x33, 0x08, 0x00, 0x18, 0x1a, 0x22, 0x06, 0x89, 0x81, 0xa4, 0x14,
-  0x92, 0x42, 0x84, 0x00, 0x18, 0x12, 0x80, 0x14, 0x88, 0x84, 0x82, 0x84,
-  0x02, 0x60, 0x82, 0x12, 0x48, 0x20, 0x02, 0x18, 0x28, 0x48, 0x00, 0x28,
-  0x22, 0x12, 0x89, 0x01, 0x62, 0x20, 0x82, 0x22, 0x84, 0x86, 0x21, 0x01,
-  0xa2, 0x20, 0x32, 0x48, 0x12, 0x20, 0x02, 0x14, 0xd5, 0x0e, 0x2e, 0x42,
-  0x1f, 0x41, 0x72, 0x28, 0xf2, 0x11, 0x24, 0x83, 0xf4, 0x11, 0x64, 0xab,
-  0x16, 0x1f, 0x41, 0xb2, 0x4a, 0xf1, 0x91, 0x24, 0xab, 0x96, 0x1f, 0x81,
-  0xb2, 0x4a, 0x39, 0x15, 0xab, 0x94, 0x43, 0xf3, 0x4a, 0x91, 0x43, 0xf2,
-  0x42, 0xb1, 0x4f, 0x82, 0xd4, 0x12, 0xf9, 0x24, 0x48, 0x1c, 0xfb, 0x24,
-  0x4a, 0x1c, 0xf8, 0x24, 0x4a, 0x8f, 0x11, 0xf2, 0x24, 0x5a, 0x96, 0xe1,
-  0xa2, 0xe5, 0x59, 0xc2, 0x4a, 0x9e, 0x24, 0xac, 0xf4, 0x91, 0x24, 0x2c,
-  0xf4, 0x91, 0x24, 0x8d, 0x12, 0x1f, 0x49, 0x32, 0x48, 0x1f, 0x49, 0x32,
-  0x4a, 0x1f, 0x48, 0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x6a, 0x99, 0x21, 0xab,
-  0x94, 0x51, 0xab, 0x94, 0x43, 0xba, 0x4a, 0x3b, 0x24, 0xab, 0x94, 0x47,
-  0x82, 0x2f, 0x14, 0xfb, 0x24, 0x48, 0x4a, 0xf9, 0x24, 0x4a, 0x2f, 0x82,
-  0x0b, 0x2c, 0xf4, 0x11, 0x4c, 0x85, 0xf2, 0x11, 0x64, 0xf0, 0x11, 0x24,
-  0xa3, 0x54, 0x41, 0x2b, 0x14, 0x1d, 0x24, 0xaf, 0x44, 0x11, 0xf1, 0x4a,
-  0xb4, 0x51, 0xab, 0xb4, 0x53, 0xb2, 0x42, 0x79, 0x24, 0xf8, 0x42, 0x91,
-  0x47, 0x82, 0x2d, 0x91, 0x7d, 0x48, 0x29, 0xd9, 0xa4, 0xc5, 0x81, 0x5d,
-  0x9a, 0x12, 0x4d, 0xc2, 0x96, 0x41, 0x6a, 0x59, 0xbc, 0xe4, 0x48, 0xc2,
-  0x4b, 0x1f, 0xc9, 0xc2, 0x42, 0x9e, 0x6c, 0x85, 0xf3, 0x91, 0x64, 0x83,
-  0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x81, 0x24, 0xa3, 0xd4, 0x41, 0xf2, 0x4a,
-  0x84, 0x15, 0xb4, 0x4a, 0x1b, 0xb5, 0x4a, 0x3b, 0x24, 0xa9, 0x39, 0x24,
-  0x23, 0x34, 0x24, 0x29, 0xf9, 0x26, 0x48, 0x29, 0xf1, 0x24, 0x5a, 0x15,
-  0x01, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x20, 0x08, 0x00, 0x10, 0x02, 0xeb,
-  0xfc, 0x00, 0x40, 0x8c, 0x83, 0xa2, 0x21, 0x14, 0x32, 0x8c, 0x01, 0x81,
-  0x20, 0x79, 0x12, 0x24, 0x84, 0x21, 0xa1, 0x42, 0x22, 0x00, 0x22, 0x19,
-  0x02, 0x81, 0x28, 0xe0, 0x12, 0x84, 0xa1, 0x14, 0xac, 0x28, 0x03, 0x81,
-  0x12, 0x38, 0x26, 0xa2, 0x12, 0x18, 0x18, 0x00, 0x2a, 0x84, 0x51, 0x82,
-  0x90, 0x81, 0xc8, 0x88, 0x83, 0xa8, 0x28, 0x83, 0xc1, 0x88, 0x1a, 0x28,
-  0x02, 0x48, 0x80, 0xf4, 0x9e, 0xf3, 0x80, 0x21, 0xa9, 0x21, 0x20, 0x05,
-  0x1a, 0x02, 0x22, 0x8a, 0x84, 0xa3, 0x48, 0x81, 0x8a, 0x54, 0x81, 0x2e,
-  0x44, 0x4a, 0x28, 0xa1, 0x41, 0x2a, 0x34, 0x41, 0x00, 0x80, 0x04, 0x52,
-  0x81, 0x80, 0xa2, 0x41, 0x85, 0x84, 0xa1, 0x82, 0x8a, 0x82, 0x28, 0x01,
-  0x20, 0xb8, 0x22, 0x81, 0x83, 0xf8, 0x41, 0x88, 0x80, 0x2a, 0x16, 0xa8,
-  0x14, 0x11, 0x1a, 0x94, 0x84, 0x58, 0xc1, 0x80, 0xa6, 0x82, 0x46, 0x41,
-  0xf8, 0x29, 0xc9, 0x00, 0xca, 0xf1, 0x14, 0x28, 0x32, 0x4a, 0x03, 0x14,
-  0x2a, 0x91, 0x28, 0x30, 0x34, 0xb0, 0xa8, 0x11, 0x04, 0x22, 0x4a, 0x28,
-  0x27, 0x02, 0x3c, 0x84, 0x32, 0x21, 0x12, 0xa0, 0x28, 0x30, 0x69, 0x12,
-  0xe0, 0x21, 0xbc, 0x29, 0x01, 0x83, 0xb8, 0xa8, 0x21, 0x62, 0x27, 0x28,
-  0x18, 0x82, 0x38, 0x28, 0x48, 0x1d, 0x18, 0x25, 0x18, 0xb4, 0xc1, 0x62,
-  0x82, 0xca, 0x81, 0xa8, 0x83, 0x41, 0x8b, 0x14, 0x8d, 0x84, 0x22, 0x2e,
-  0x42, 0x2a, 0x88, 0xb4, 0x18, 0xf4, 0x34, 0xe9, 0x80, 0x01, 0x00, 0xa0,
-  0x21, 0x2a, 0x01, 0x18, 0x8a, 0x14, 0xa8, 0x48, 0x24, 0x9a, 0x74, 0x48,
-  0xb1, 0x14, 0x84, 0x01, 0x4a, 0xa1, 0x42, 0x00, 0x00, 0x83, 0x04, 0x52,
-  0x00, 0x2a, 0x15, 0x18, 0x24, 0x21, 0x02, 0x98, 0x80, 0x01, 0x2c, 0x01,
-  0x18, 0x8a, 0xa2, 0x84, 0xa0, 0x82, 0xa0, 0x84, 0x50, 0x18, 0x48, 0x89,
-  0x29, 0x88, 0x01, 0x80, 0x04, 0xf0, 0x34, 0x8a, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x80, 0x82, 0x01, 0x00, 0x18, 0x00, 0x84, 0x00, 0x00, 0x81, 0x80,
-  0x02, 0x20, 0x22, 0x01, 0x14, 0x21, 0x92, 0x00, 0x00, 0x20, 0x01, 0x28,
-  0x10, 0x01, 0x00, 0x80, 0x18, 0x01, 0x00, 0x22, 0x00, 0x42, 0x22, 0x40,
-  0xe2, 0xe6, 0x02, 0x20, 0x01, 0x00, 0x22, 0x82, 0x00, 0x80, 0x28, 0x02,
-  0x81, 0x20, 0x11, 0x08, 0x8e, 0x18, 0x48, 0x62, 0x10, 0x01, 0x91, 0x28,
-  0x22, 0x21, 0x20, 0x44, 0x08, 0x80, 0x24, 0x01, 0xa8, 0x00, 0x40, 0x04,
-  0x48, 0x20, 0x02, 0x40, 0x08, 0xc8, 0x68, 0x48, 0x48, 0xa0, 0x28, 0x20,
-  0x04, 0xf0, 0x8e, 0x1f, 0x00, 0x00, 0x28, 0x00, 0x88, 0x00, 0x28, 0x82,
-  0x28, 0x40, 0x28, 0x01, 0x84, 0xc0, 0x18, 0x80, 0x02, 0x85, 0x01, 0x91,
-  0x22, 0x24, 0x28, 0x18, 0x48, 0x14, 0x20, 0x81, 0x24, 0x01, 0x00, 0x12,
-  0x80, 0x02, 0x11, 0x20, 0x02, 0x80, 0x18, 0x81, 0x28, 0x04, 0x22, 0x20,
-  0x02, 0x68, 0x40, 0xf2, 0xb9, 0x71, 0x00, 0x12, 0x00, 0x80, 0x02, 0x00,
-  0x20, 0x01, 0x00, 0x20, 0x01, 0x81, 0x88, 0x42, 0x48, 0x00, 0x20, 0x02,
-  0x28, 0x00, 0x40, 0x18, 0x82, 0x08, 0x00, 0xa8, 0x00, 0x40, 0x04, 0x42,
-  0x00, 0x00, 0x81, 0x80, 0x84, 0x22, 0x24, 0x04, 0x88, 0x42, 0x00, 0xd0,
-  0x46, 0x01, 0x20, 0x02, 0x83, 0x09, 0x21, 0xa0, 0x12, 0x89, 0x01, 0x44,
-  0x12, 0x22, 0x00, 0x40, 0x24, 0x21, 0x42, 0x14, 0x12, 0x02, 0x12, 0x00,
-  0x2e, 0x18, 0x48, 0x81, 0x84, 0x80, 0xa4, 0x28, 0x83, 0xa2, 0x41, 0x22,
-  0x42, 0x84, 0x00, 0x80, 0x14, 0x48, 0x18, 0x08, 0x42, 0xb0, 0x48, 0x28,
-  0x04, 0x00, 0x18, 0x20, 0x01, 0x84, 0xf0, 0x73, 0x8e, 0x00, 0x42, 0x00,
-  0x32, 0x18, 0x00, 0x21, 0xb0, 0x84, 0x44, 0x62, 0x83, 0x00, 0x16, 0x21,
-  0x04, 0x80, 0x11, 0x11, 0x02, 0x80, 0xa1, 0x48, 0x00, 0x29, 0xc4, 0x24,
-  0x00, 0x30, 0x84, 0x81, 0x20, 0x14, 0x04, 0x40, 0x21, 0x08, 0x2c, 0x02,
-  0x28, 0x18, 0x28, 0x00, 0x12, 0x14, 0x20, 0x02, 0x11, 0x00, 0x16, 0xf8,
-  0x3c, 0xf2, 0x00, 0x00, 0x82, 0x10, 0x38, 0x21, 0x00, 0x58, 0x00, 0x10,
-  0x08, 0x22, 0x90, 0x28, 0x00, 0x90, 0x68, 0x22, 0x8d, 0x41, 0x00, 0x48,
-  0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x21, 0x01, 0x00, 0x88,
-  0x00, 0x00, 0x84, 0x14, 0x82, 0x89, 0x04, 0x9c, 0x82, 0x02, 0x44, 0x55,
-  0x0d, 0x00, 0xc0, 0x18, 0x22, 0x18, 0x26, 0x81, 0x81, 0xa1, 0x14, 0x82,
-  0x24, 0x00, 0x60, 0x11, 0x44, 0x2a, 0x81, 0x62, 0x41, 0x21, 0x46, 0x08,
-  0x83, 0x04, 0xa0, 0x25, 0x46, 0x12, 0x98, 0x28, 0x20, 0xa4, 0x81, 0x4c,
-  0x28, 0x85, 0x02, 0x44, 0x00, 0x2a, 0x81, 0x1c, 0x48, 0x08, 0xa8, 0x42,
-  0x90, 0xc8, 0xc0, 0x18, 0x20, 0xe8, 0x81, 0x04, 0x12, 0x10, 0x48, 0xf8,
-  0xea, 0x24, 0x20, 0x88, 0x02, 0xc0, 0x12, 0x84, 0x80, 0x12, 0x0a, 0x42,
-  0x12, 0x89, 0x41, 0x08, 0x22, 0x42, 0x84, 0x00, 0x14, 0x22, 0x28, 0x11,
-  0x80, 0x14, 0x08, 0x42, 0x41, 0x00, 0x28, 0x26, 0x08, 0x00, 0x81, 0x00,
-  0x11, 0x18, 0x60, 0x22, 0x84, 0x20, 0x01, 0x20, 0x04, 0x00, 0x28, 0x90,
-  0x28, 0x22, 0x10, 0xd4, 0xb9, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00,
-  0x20, 0x02, 0x00, 0x00, 0x20, 0x14, 0x18, 0x1a, 0x08, 0x81, 0x52, 0x81,
+  0x4c, 0x00, 0x05, 0x20, 0x80, 0x02, 0x95, 0x00, 0xf0, 0x65, 0x18, 0x18,
+  0x83, 0x82, 0xa2, 0xa1, 0x20, 0x62, 0x84, 0xb0, 0x48, 0x02, 0x20, 0x82,
+  0x86, 0x81, 0xa1, 0x12, 0x1a, 0xa4, 0x41, 0x00, 0x80, 0xa3, 0x81, 0x20,
+  0x21, 0xc4, 0x21, 0x2a, 0xc4, 0x22, 0x22, 0x88, 0x14, 0x12, 0x00, 0x00,
+  0x22, 0x28, 0x80, 0x04, 0x28, 0x6d, 0x86, 0x20, 0x24, 0x94, 0x28, 0x81,
+  0x48, 0x18, 0xa0, 0x82, 0x28, 0x20, 0x89, 0x62, 0x82, 0x40, 0x88, 0x81,
+  0x02, 0x89, 0x32, 0x44, 0x83, 0x21, 0x04, 0x83, 0xa3, 0x28, 0x80, 0x24,
+  0xa3, 0x42, 0x12, 0x1a, 0x14, 0x05, 0xb0, 0x18, 0xa2, 0x21, 0x62, 0x80,
+  0x01, 0x18, 0x20, 0x04, 0x00, 0x26, 0x28, 0x02, 0x20, 0x22, 0xa9, 0x24,
+  0x1a, 0x04, 0x00, 0x30, 0x18, 0x8f, 0x11, 0x07, 0x28, 0x42, 0x12, 0x00,
+  0x22, 0x8c, 0x0a, 0x00, 0x44, 0x20, 0xaf, 0x08, 0xf0, 0x03, 0x00, 0x49,
+  0x28, 0x21, 0x01, 0x83, 0x6c, 0x11, 0x48, 0x10, 0x08, 0x11, 0x28, 0x22,
+  0x81, 0x20, 0x04, 0x28, 0xd7, 0x07, 0xf0, 0x18, 0x8c, 0x01, 0x22, 0x82,
+  0x84, 0x88, 0x26, 0x04, 0x88, 0x80, 0x08, 0x48, 0x12, 0xdf, 0x9d, 0x07,
+  0x80, 0x01, 0x2a, 0x01, 0x81, 0xc8, 0x82, 0x80, 0x01, 0x48, 0x52, 0x00,
+  0x10, 0x84, 0xa1, 0x41, 0x60, 0x42, 0x81, 0x46, 0x08, 0x00, 0x84, 0xdd,
+  0x04, 0x00, 0x7f, 0x06, 0x52, 0x83, 0x12, 0x08, 0x00, 0x68, 0xbe, 0x0c,
+  0xf0, 0x3f, 0x20, 0x02, 0xcf, 0xbf, 0x08, 0x80, 0x81, 0x92, 0x18, 0x48,
+  0x18, 0x8b, 0x42, 0x20, 0x02, 0x8a, 0x81, 0xa6, 0x14, 0xc0, 0x18, 0x18,
+  0x49, 0x02, 0x16, 0xc8, 0x44, 0xc3, 0x73, 0x88, 0x64, 0x85, 0x22, 0x22,
+  0x84, 0x56, 0x28, 0x81, 0x14, 0x88, 0x01, 0x2a, 0x84, 0xa2, 0x12, 0x92,
+  0x22, 0xa0, 0x12, 0xa0, 0x16, 0x84, 0x80, 0x02, 0x8b, 0x61, 0x89, 0x02,
+  0x10, 0xa8, 0x82, 0x43, 0x8a, 0xa6, 0x42, 0x28, 0x88, 0xa0, 0x24, 0x84,
+  0xdb, 0x74, 0xa0, 0x42, 0x90, 0x18, 0x28, 0xc0, 0x1d, 0x01, 0xf0, 0x0a,
+  0x00, 0x81, 0x00, 0x00, 0x12, 0x4a, 0x02, 0x80, 0x04, 0x84, 0x88, 0x48,
+  0x14, 0x2a, 0x84, 0x82, 0x21, 0x14, 0x04, 0x20, 0x24, 0x02, 0x00, 0x40,
+  0x08, 0x31, 0x07, 0xf0, 0x09, 0x08, 0x80, 0x01, 0x98, 0x00, 0x00, 0x70,
+  0x53, 0x09, 0x22, 0x00, 0x28, 0x00, 0x80, 0x23, 0x04, 0x83, 0x91, 0x28,
+  0x12, 0x18, 0x22, 0x00, 0x84, 0x2f, 0x0b, 0xf0, 0x00, 0x00, 0x20, 0x05,
+  0x84, 0x81, 0x11, 0x20, 0x42, 0x28, 0x22, 0x01, 0x20, 0x02, 0x22, 0x48,
+  0x2f, 0x00, 0xf0, 0x13, 0x82, 0xaa, 0x28, 0x80, 0x94, 0x18, 0x28, 0x22,
+  0x80, 0xf4, 0x84, 0xc1, 0x00, 0x42, 0xa0, 0x14, 0x22, 0x88, 0x1e, 0x28,
+  0x48, 0x80, 0x29, 0x04, 0x22, 0x80, 0x81, 0x01, 0x00, 0x20, 0x24, 0x82,
+  0x02, 0x84, 0x60, 0x09, 0x51, 0x84, 0x30, 0x51, 0x28, 0x42, 0x27, 0x0e,
+  0xf0, 0x20, 0xa0, 0x42, 0x20, 0x01, 0x00, 0x18, 0x80, 0x04, 0x42, 0x80,
+  0x04, 0xf0, 0x28, 0x91, 0x20, 0x22, 0x03, 0x20, 0xa5, 0x41, 0x00, 0x00,
+  0x88, 0x84, 0x44, 0x00, 0x00, 0x83, 0x22, 0x04, 0x48, 0x18, 0x32, 0x00,
+  0x2a, 0x89, 0x64, 0x88, 0x12, 0x22, 0x12, 0x48, 0x12, 0x00, 0x10, 0x08,
+  0x18, 0x9b, 0x09, 0xf0, 0x0d, 0x42, 0x28, 0x12, 0xa0, 0x12, 0x00, 0x10,
+  0xa8, 0x24, 0x38, 0x20, 0x02, 0xef, 0x3f, 0x0c, 0x84, 0x80, 0x04, 0xa0,
+  0x28, 0x40, 0x88, 0x01, 0x00, 0x80, 0x12, 0x08, 0x58, 0x8b, 0x01, 0x50,
+  0x00, 0x40, 0x28, 0x01, 0x84, 0xad, 0x04, 0xf0, 0x2a, 0x80, 0x04, 0x81,
+  0x00, 0xa0, 0x21, 0x48, 0x28, 0x00, 0x28, 0x00, 0x18, 0x2a, 0x04, 0x12,
+  0x00, 0x00, 0x27, 0x19, 0x20, 0x18, 0x08, 0x42, 0x00, 0x52, 0x28, 0x80,
+  0xac, 0x14, 0x00, 0x18, 0x22, 0x20, 0x04, 0x81, 0x84, 0x18, 0x00, 0x00,
+  0x81, 0x28, 0x12, 0x40, 0xa8, 0x14, 0x80, 0x91, 0x21, 0x42, 0x28, 0x22,
+  0x22, 0x4a, 0x93, 0x28, 0x8c, 0xc4, 0x8b, 0x0f, 0x00, 0xf8, 0x0b, 0x70,
+  0x84, 0x88, 0x00, 0x14, 0x1f, 0x7d, 0x0f, 0x76, 0x01, 0xf0, 0x05, 0x00,
+  0x80, 0x81, 0x48, 0x04, 0x00, 0x10, 0x81, 0x84, 0x01, 0x20, 0x02, 0x80,
+  0x24, 0x02, 0x40, 0x21, 0x34, 0x28, 0x52, 0x7d, 0x07, 0xa0, 0x1a, 0x84,
+  0x01, 0x00, 0x20, 0x04, 0x90, 0x21, 0x20, 0x8b, 0x5b, 0x0a, 0xf0, 0x03,
+  0x08, 0x5f, 0xe8, 0x0c, 0x84, 0xa0, 0x43, 0x10, 0x08, 0x28, 0x1a, 0x24,
+  0x04, 0x84, 0x4c, 0x04, 0x28, 0x20, 0xaa, 0x0e, 0xf0, 0x16, 0x11, 0x10,
+  0x08, 0x88, 0x42, 0x42, 0x00, 0x28, 0x80, 0x05, 0x84, 0x14, 0x48, 0x00,
+  0x80, 0x44, 0x08, 0x00, 0x12, 0x80, 0x03, 0x20, 0x08, 0x58, 0x80, 0x01,
+  0x00, 0xae, 0x57, 0x00, 0x22, 0x83, 0x02, 0x42, 0x62, 0x81, 0x80, 0x36,
+  0x04, 0xf0, 0x23, 0x18, 0x40, 0x08, 0x28, 0x42, 0x12, 0x20, 0x84, 0x25,
+  0x21, 0x02, 0x28, 0x13, 0xe2, 0x81, 0x02, 0x20, 0x02, 0x00, 0x11, 0x20,
+  0x02, 0x22, 0x78, 0x80, 0x03, 0x18, 0x00, 0x00, 0x30, 0x28, 0x28, 0x00,
+  0x00, 0xbf, 0x2d, 0x0c, 0x84, 0x83, 0x81, 0x24, 0x01, 0x12, 0x00, 0x84,
+  0x10, 0x44, 0x04, 0x28, 0x12, 0x23, 0x0a, 0xf1, 0xfe, 0x11, 0x22, 0x82,
+  0x01, 0x19, 0x0a, 0x81, 0x00, 0xc0, 0x21, 0x20, 0x41, 0x08, 0x2a, 0x84,
+  0x24, 0x01, 0x00, 0x80, 0x02, 0x44, 0x28, 0x28, 0x00, 0x58, 0x32, 0x00,
+  0x20, 0x12, 0x02, 0xbe, 0x46, 0x00, 0xb6, 0x38, 0x28, 0x32, 0x4a, 0x84,
+  0xa1, 0x16, 0x4a, 0x81, 0xa4, 0x91, 0x8f, 0x8d, 0x24, 0x12, 0x84, 0xa1,
+  0x12, 0x12, 0x42, 0x28, 0x48, 0x2a, 0x24, 0x22, 0x85, 0x22, 0x92, 0x48,
+  0xa8, 0x5a, 0x31, 0x78, 0x8c, 0x04, 0x87, 0x12, 0x2e, 0x48, 0x2a, 0xa3,
+  0x62, 0x80, 0x86, 0x01, 0x19, 0xa3, 0x36, 0x12, 0x8b, 0x22, 0x89, 0xa4,
+  0x62, 0x28, 0xa0, 0x13, 0x80, 0x01, 0x8a, 0xa8, 0x8b, 0x2a, 0x92, 0x68,
+  0x89, 0x84, 0x23, 0xc2, 0x81, 0xe0, 0xc2, 0x0c, 0x2a, 0x82, 0x26, 0x81,
+  0xb2, 0x28, 0xa2, 0x46, 0x8b, 0x21, 0x83, 0x31, 0x18, 0x90, 0x14, 0x87,
+  0x84, 0x20, 0x81, 0x82, 0x01, 0x81, 0x85, 0x88, 0x22, 0xa4, 0x62, 0x3a,
+  0x01, 0x46, 0x78, 0x28, 0x48, 0xa1, 0x18, 0x8f, 0x14, 0x21, 0xc2, 0x28,
+  0x8b, 0x31, 0xd0, 0x11, 0x01, 0x62, 0x99, 0x22, 0xa2, 0x42, 0x12, 0x81,
+  0x00, 0x5a, 0xa1, 0x44, 0x62, 0xa0, 0x11, 0xa0, 0x23, 0x3a, 0x81, 0x82,
+  0xe4, 0x82, 0xe9, 0x82, 0xa2, 0x81, 0x42, 0x00, 0x9f, 0x15, 0x06, 0x90,
+  0x18, 0x28, 0x4a, 0x25, 0xa1, 0x21, 0x84, 0x2a, 0xa6, 0x14, 0xc2, 0x88,
+  0xa0, 0x21, 0x60, 0x81, 0xe0, 0x11, 0x65, 0x84, 0x4a, 0x51, 0x88, 0x78,
+  0x18, 0x14, 0x00, 0x1a, 0xa5, 0x62, 0x48, 0xd0, 0x88, 0xa6, 0x51, 0x46,
+  0x21, 0x21, 0xe5, 0x83, 0x06, 0x80, 0x22, 0xd5, 0x88, 0xa4, 0x26, 0x42,
+  0x6a, 0x02, 0x22, 0x78, 0x28, 0x22, 0x11, 0x80, 0xa2, 0x14, 0x52, 0x42,
+  0x5a, 0x21, 0x82, 0x22, 0x22, 0xf4, 0x8c, 0xf7, 0x00, 0x22, 0x20, 0x82,
+  0x84, 0x01, 0x22, 0x12, 0x60, 0x89, 0x00, 0x20, 0x01, 0x16, 0x08, 0x48,
+  0x00, 0x28, 0x2e, 0x0b, 0x00, 0x34, 0x0a, 0x01, 0x01, 0x00, 0xf3, 0xff,
+  0x5a, 0x20, 0x02, 0x00, 0x28, 0x48, 0x00, 0x89, 0x02, 0x00, 0xf0, 0x2c,
+  0xcd, 0x20, 0xa8, 0x31, 0xf0, 0x18, 0x38, 0x8f, 0x82, 0xaa, 0x91, 0x1a,
+  0xf1, 0x48, 0x28, 0x5a, 0xd5, 0x88, 0x11, 0x18, 0x08, 0xd0, 0x88, 0x51,
+  0x88, 0x1f, 0x11, 0x01, 0x8f, 0x85, 0xd1, 0x88, 0xa2, 0x75, 0x4a, 0xf4,
+  0x11, 0x11, 0x2a, 0x62, 0x84, 0x46, 0xf8, 0x41, 0x41, 0x6a, 0x56, 0x19,
+  0x83, 0xf2, 0x59, 0x41, 0x5a, 0xa7, 0x33, 0x2a, 0xa2, 0x77, 0x4a, 0xd6,
+  0x11, 0xa2, 0x22, 0x1d, 0x21, 0x8f, 0x86, 0xa6, 0x33, 0x8f, 0x86, 0xf6,
+  0x78, 0x78, 0x5a, 0xa7, 0x26, 0x5a, 0xa5, 0x32, 0x1a, 0x51, 0x11, 0x00,
+  0x82, 0x3a, 0xa2, 0xdf, 0x3e, 0x58, 0x8a, 0xa8, 0x22, 0x8a, 0x08, 0x77,
+  0xdf, 0x80, 0xe2, 0x81, 0xa7, 0x13, 0x8f, 0x81, 0xf3, 0x78, 0x78, 0x7a,
+  0xa3, 0x55, 0x8f, 0x86, 0xa3, 0x55, 0x8f, 0x88, 0xf1, 0x9c, 0x84, 0x8b,
+  0x44, 0x28, 0x12, 0x87, 0x81, 0x85, 0xf8, 0x51, 0x49, 0x84, 0x5e, 0x18,
+  0x8f, 0x82, 0xe2, 0x27, 0xb7, 0x72, 0xf7, 0x31, 0x11, 0x2b, 0x32, 0x42,
+  0x8f, 0x8e, 0xfb, 0x71, 0x51, 0x6a, 0x57, 0x19, 0x87, 0x86, 0x9f, 0x17,
+  0xe4, 0x97, 0xa6, 0x33, 0x2a, 0xf3, 0x78, 0x78, 0x4a, 0xf4, 0x21, 0x61,
+  0x2a, 0xd2, 0x11, 0xf6, 0x48, 0x78, 0x8f, 0x87, 0xa7, 0x66, 0x8f, 0x87,
+  0xa3, 0x73, 0x6a, 0xf2, 0x54, 0x74, 0x2a, 0xe3, 0x41, 0xf3, 0x11, 0x11,
+  0x1a, 0xa1, 0xa2, 0xaa, 0xac, 0x23, 0x8b, 0xff, 0x7e, 0x78, 0x9e, 0x82,
+  0x2b, 0x22, 0xaa, 0x9a, 0x12, 0xde, 0x82, 0x20, 0xa2, 0x71, 0x1a, 0xf3,
+  0x18, 0x38, 0x8f, 0x81, 0xa9, 0x75, 0x3a, 0xa1, 0x24, 0x12, 0x8d, 0x98,
+  0x4e, 0xd4, 0x80, 0x02, 0x18, 0x18, 0x9f, 0x11, 0xb1, 0x48, 0xe4, 0x85,
+  0xf5, 0x28, 0x48, 0x5a, 0xb5, 0x42, 0xf5, 0x31, 0x31, 0x2a, 0xa3, 0x44,
+  0x4a, 0xf8, 0x71, 0x21, 0x7a, 0x56, 0x11, 0x6a, 0xf4, 0x19, 0x21, 0x8f,
+  0x17, 0xa6, 0x33, 0x6a, 0xe6, 0x83, 0xa3, 0x64, 0x1d, 0x61, 0xf0, 0x11,
+  0x11, 0x8f, 0x87, 0xf7, 0x78, 0x78, 0x8f, 0x86, 0xf4, 0x68, 0x68, 0x7a,
+  0xa7, 0x26, 0x5e, 0x74, 0x6a, 0xa6, 0x31, 0x1f, 0x11, 0xa1, 0x11, 0x28,
+  0xca, 0xa6, 0x23, 0xfe, 0xf8, 0x6e, 0x48, 0x9a, 0xbb, 0x22, 0xa2, 0xaa,
+  0x18, 0x9f, 0x8f, 0x02, 0xaa, 0xb2, 0x18, 0xa3, 0x33, 0x8f, 0x81, 0xf3,
+  0x58, 0x58, 0x4a, 0xab, 0x57, 0x8f, 0x86, 0xa3, 0x45, 0x8f, 0x8c, 0xe5,
+  0x4d, 0xfd, 0x48, 0x48, 0xa0, 0x11, 0x1a, 0x81, 0xf1, 0x59, 0x49, 0x8f,
+  0x84, 0x6f, 0x00, 0xb0, 0x62, 0xf3, 0x31, 0x13, 0x2a, 0xf2, 0x48, 0x48,
+  0x8f, 0x87, 0xfe, 0xdc, 0x00, 0x70, 0x11, 0x6a, 0xf4, 0x79, 0x61, 0x8f,
+  0x87, 0x71, 0x00, 0xa2, 0x87, 0xa5, 0x44, 0x1f, 0x12, 0x02, 0x1f, 0x17,
+  0xf3, 0x78, 0xdb, 0x00, 0xf0, 0x0f, 0x86, 0xa2, 0x77, 0x6a, 0xe2, 0x45,
+  0xa7, 0x77, 0x4b, 0x11, 0x15, 0x01, 0x2a, 0xaa, 0xde, 0x3a, 0xf2, 0xf8,
+  0xf8, 0x6e, 0x78, 0x9a, 0xbb, 0x22, 0xe2, 0x2a, 0x0a, 0xef, 0x49, 0x0f,
+  0x5d, 0x08, 0x13, 0x42, 0x59, 0x07, 0x00, 0x42, 0x05, 0x31, 0x81, 0x10,
+  0x08, 0xea, 0x0d, 0x10, 0x22, 0xf6, 0x0b, 0xf2, 0xff, 0x1c, 0x48, 0x00,
+  0x20, 0x01, 0x80, 0x82, 0x84, 0x02, 0x00, 0x6f, 0x33, 0x08, 0x00, 0x18,
+  0x1a, 0x22, 0x06, 0x89, 0x81, 0xa4, 0x14, 0x92, 0x42, 0x84, 0x00, 0x18,
+  0x12, 0x80, 0x14, 0x88, 0x84, 0x82, 0x84, 0x02, 0x60, 0x82, 0x12, 0x48,
+  0x20, 0x02, 0x18, 0x28, 0x48, 0x00, 0x28, 0x22, 0x12, 0x89, 0x01, 0x62,
+  0x20, 0x82, 0x22, 0x84, 0x86, 0x21, 0x01, 0xa2, 0x20, 0x32, 0x48, 0x12,
+  0x20, 0x02, 0x14, 0xd5, 0x0e, 0x2e, 0x42, 0x1f, 0x41, 0x72, 0x28, 0xf2,
+  0x11, 0x24, 0x83, 0xf4, 0x11, 0x64, 0xab, 0x16, 0x1f, 0x41, 0xb2, 0x4a,
+  0xf1, 0x91, 0x24, 0xab, 0x96, 0x1f, 0x81, 0xb2, 0x4a, 0x39, 0x15, 0xab,
+  0x94, 0x43, 0xf3, 0x4a, 0x91, 0x43, 0xf2, 0x42, 0xb1, 0x4f, 0x82, 0xd4,
+  0x12, 0xf9, 0x24, 0x48, 0x1c, 0xfb, 0x24, 0x4a, 0x1c, 0xf8, 0x24, 0x4a,
+  0x8f, 0x11, 0xf2, 0x24, 0x5a, 0x96, 0xe1, 0xa2, 0xe5, 0x59, 0xc2, 0x4a,
+  0x9e, 0x24, 0xac, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24, 0x8d, 0x12,
+  0x1f, 0x49, 0x32, 0x48, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a,
+  0xd1, 0x41, 0xb2, 0x6a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x43,
+  0xba, 0x4a, 0x3b, 0x24, 0xab, 0x94, 0x47, 0x82, 0x2f, 0x14, 0xfb, 0x24,
+  0x48, 0x4a, 0xf9, 0x24, 0x4a, 0x2f, 0x82, 0x0b, 0x2c, 0xf4, 0x11, 0x4c,
+  0x85, 0xf2, 0x11, 0x64, 0xf0, 0x11, 0x24, 0xa3, 0x54, 0x41, 0x2b, 0x14,
+  0x1d, 0x24, 0xaf, 0x44, 0x11, 0xf1, 0x4a, 0xb4, 0x51, 0xab, 0xb4, 0x53,
+  0xb2, 0x42, 0x79, 0x24, 0xf8, 0x42, 0x91, 0x47, 0x82, 0x2d, 0x91, 0x7d,
+  0x48, 0x29, 0xd9, 0xa4, 0xc5, 0x81, 0x5d, 0x9a, 0x12, 0x4d, 0xc2, 0x96,
+  0x41, 0x6a, 0x59, 0xbc, 0xe4, 0x48, 0xc2, 0x4b, 0x1f, 0xc9, 0xc2, 0x42,
+  0x9e, 0x6c, 0x85, 0xf3, 0x91, 0x64, 0x83, 0xf4, 0x91, 0x24, 0xa3, 0xf4,
+  0x81, 0x24, 0xa3, 0xd4, 0x41, 0xf2, 0x4a, 0x84, 0x15, 0xb4, 0x4a, 0x1b,
+  0xb5, 0x4a, 0x3b, 0x24, 0xa9, 0x39, 0x24, 0x23, 0x34, 0x24, 0x29, 0xf9,
+  0x26, 0x48, 0x29, 0xf1, 0x24, 0x5a, 0x15, 0x01, 0x9c, 0x08, 0x11, 0x11,
+  0x21, 0x0f, 0x11, 0x10, 0x13, 0x03, 0x04, 0xe7, 0x0f, 0x10, 0x44, 0xd9,
+  0x05, 0xf1, 0xff, 0x06, 0x00, 0x10, 0x02, 0xeb, 0xfc, 0x00, 0x40, 0x8c,
+  0x83, 0xa2, 0x21, 0x14, 0x32, 0x8c, 0x01, 0x81, 0x20, 0x79, 0x12, 0x24,
+  0x84, 0x21, 0xa1, 0x42, 0x22, 0x00, 0x22, 0x19, 0x02, 0x81, 0x28, 0xe0,
+  0x12, 0x84, 0xa1, 0x14, 0xac, 0x28, 0x03, 0x81, 0x12, 0x38, 0x26, 0xa2,
+  0x12, 0x18, 0x18, 0x00, 0x2a, 0x84, 0x51, 0x82, 0x90, 0x81, 0xc8, 0x88,
+  0x83, 0xa8, 0x28, 0x83, 0xc1, 0x88, 0x1a, 0x28, 0x02, 0x48, 0x80, 0xf4,
+  0x9e, 0xf3, 0x80, 0x21, 0xa9, 0x21, 0x20, 0x05, 0x1a, 0x02, 0x22, 0x8a,
+  0x84, 0xa3, 0x48, 0x81, 0x8a, 0x54, 0x81, 0x2e, 0x44, 0x4a, 0x28, 0xa1,
+  0x41, 0x2a, 0x34, 0x41, 0x00, 0x80, 0x04, 0x52, 0x81, 0x80, 0xa2, 0x41,
+  0x85, 0x84, 0xa1, 0x82, 0x8a, 0x82, 0x28, 0x01, 0x20, 0xb8, 0x22, 0x81,
+  0x83, 0xf8, 0x41, 0x88, 0x80, 0x2a, 0x16, 0xa8, 0x14, 0x11, 0x1a, 0x94,
+  0x84, 0x58, 0xc1, 0x80, 0xa6, 0x82, 0x46, 0x41, 0xf8, 0x29, 0xc9, 0x00,
+  0xca, 0xf1, 0x14, 0x28, 0x32, 0x4a, 0x03, 0x14, 0x2a, 0x91, 0x28, 0x30,
+  0x34, 0xb0, 0xa8, 0x11, 0x04, 0x22, 0x4a, 0x28, 0x27, 0x02, 0x3c, 0x84,
+  0x32, 0x21, 0x12, 0xa0, 0x28, 0x30, 0x69, 0x12, 0xe0, 0x21, 0xbc, 0x29,
+  0x01, 0x83, 0xb8, 0xa8, 0x21, 0x62, 0x27, 0x28, 0x18, 0x82, 0x38, 0x28,
+  0x48, 0x1d, 0x18, 0x25, 0x18, 0xb4, 0xc1, 0x62, 0x82, 0xca, 0x81, 0xa8,
+  0x83, 0x41, 0x8b, 0x14, 0x8d, 0x84, 0x22, 0x2e, 0x42, 0x2a, 0x88, 0xb4,
+  0x18, 0xf4, 0x34, 0xe9, 0x80, 0x01, 0x00, 0xa0, 0x21, 0x2a, 0x01, 0x18,
+  0x8a, 0x14, 0xa8, 0x48, 0x24, 0x9a, 0x74, 0x48, 0xb1, 0x14, 0x84, 0x01,
+  0x4a, 0xa1, 0x42, 0x00, 0x00, 0x83, 0x04, 0x52, 0x00, 0x2a, 0x15, 0x18,
+  0x24, 0x21, 0x02, 0x98, 0x80, 0x01, 0x2c, 0x01, 0x18, 0x8a, 0xa2, 0x84,
+  0xa0, 0x82, 0xa0, 0x84, 0x50, 0x18, 0x48, 0x89, 0x29, 0x88, 0x01, 0x80,
+  0x04, 0xf0, 0x34, 0x8a, 0xf9, 0x05, 0x50, 0x80, 0x82, 0x01, 0x00, 0x18,
+  0x7c, 0x07, 0xf0, 0x04, 0x81, 0x80, 0x02, 0x20, 0x22, 0x01, 0x14, 0x21,
+  0x92, 0x00, 0x00, 0x20, 0x01, 0x28, 0x10, 0x01, 0x00, 0x80, 0x18, 0x0a,
+  0x0b, 0xf0, 0x28, 0x42, 0x22, 0x40, 0xe2, 0xe6, 0x02, 0x20, 0x01, 0x00,
+  0x22, 0x82, 0x00, 0x80, 0x28, 0x02, 0x81, 0x20, 0x11, 0x08, 0x8e, 0x18,
+  0x48, 0x62, 0x10, 0x01, 0x91, 0x28, 0x22, 0x21, 0x20, 0x44, 0x08, 0x80,
+  0x24, 0x01, 0xa8, 0x00, 0x40, 0x04, 0x48, 0x20, 0x02, 0x40, 0x08, 0xc8,
+  0x68, 0x48, 0x48, 0xa0, 0x28, 0x20, 0x04, 0xf0, 0x8e, 0x1f, 0x5c, 0x00,
+  0x10, 0x88, 0x8f, 0x0c, 0x00, 0xa0, 0x06, 0xf0, 0x16, 0xc0, 0x18, 0x80,
+  0x02, 0x85, 0x01, 0x91, 0x22, 0x24, 0x28, 0x18, 0x48, 0x14, 0x20, 0x81,
+  0x24, 0x01, 0x00, 0x12, 0x80, 0x02, 0x11, 0x20, 0x02, 0x80, 0x18, 0x81,
+  0x28, 0x04, 0x22, 0x20, 0x02, 0x68, 0x40, 0xf2, 0xb9, 0x71, 0xb9, 0x0d,
+  0xf0, 0x06, 0x02, 0x00, 0x20, 0x01, 0x00, 0x20, 0x01, 0x81, 0x88, 0x42,
+  0x48, 0x00, 0x20, 0x02, 0x28, 0x00, 0x40, 0x18, 0x82, 0x08, 0x00, 0x5f,
+  0x00, 0x10, 0x42, 0xa0, 0x00, 0xf0, 0x7b, 0x84, 0x22, 0x24, 0x04, 0x88,
+  0x42, 0x00, 0xd0, 0x46, 0x01, 0x20, 0x02, 0x83, 0x09, 0x21, 0xa0, 0x12,
+  0x89, 0x01, 0x44, 0x12, 0x22, 0x00, 0x40, 0x24, 0x21, 0x42, 0x14, 0x12,
+  0x02, 0x12, 0x00, 0x2e, 0x18, 0x48, 0x81, 0x84, 0x80, 0xa4, 0x28, 0x83,
+  0xa2, 0x41, 0x22, 0x42, 0x84, 0x00, 0x80, 0x14, 0x48, 0x18, 0x08, 0x42,
+  0xb0, 0x48, 0x28, 0x04, 0x00, 0x18, 0x20, 0x01, 0x84, 0xf0, 0x73, 0x8e,
+  0x00, 0x42, 0x00, 0x32, 0x18, 0x00, 0x21, 0xb0, 0x84, 0x44, 0x62, 0x83,
+  0x00, 0x16, 0x21, 0x04, 0x80, 0x11, 0x11, 0x02, 0x80, 0xa1, 0x48, 0x00,
+  0x29, 0xc4, 0x24, 0x00, 0x30, 0x84, 0x81, 0x20, 0x14, 0x04, 0x40, 0x21,
+  0x08, 0x2c, 0x02, 0x28, 0x18, 0x28, 0x00, 0x12, 0x14, 0x20, 0x02, 0x11,
+  0x00, 0x16, 0xf8, 0x3c, 0xf2, 0x00, 0x00, 0x82, 0x10, 0x38, 0x21, 0x00,
+  0x58, 0x00, 0x10, 0x08, 0x22, 0x90, 0x28, 0x00, 0x90, 0x68, 0x22, 0x8d,
+  0x41, 0x59, 0x02, 0x10, 0x20, 0xc5, 0x06, 0xf0, 0x4e, 0x2a, 0x21, 0x01,
+  0x00, 0x88, 0x00, 0x00, 0x84, 0x14, 0x82, 0x89, 0x04, 0x9c, 0x82, 0x02,
+  0x44, 0x55, 0x0d, 0x00, 0xc0, 0x18, 0x22, 0x18, 0x26, 0x81, 0x81, 0xa1,
+  0x14, 0x82, 0x24, 0x00, 0x60, 0x11, 0x44, 0x2a, 0x81, 0x62, 0x41, 0x21,
+  0x46, 0x08, 0x83, 0x04, 0xa0, 0x25, 0x46, 0x12, 0x98, 0x28, 0x20, 0xa4,
+  0x81, 0x4c, 0x28, 0x85, 0x02, 0x44, 0x00, 0x2a, 0x81, 0x1c, 0x48, 0x08,
+  0xa8, 0x42, 0x90, 0xc8, 0xc0, 0x18, 0x20, 0xe8, 0x81, 0x04, 0x12, 0x10,
+  0x48, 0xf8, 0xea, 0x24, 0x20, 0x88, 0x02, 0xc0, 0x12, 0x84, 0x80, 0x12,
+  0x0a, 0x42, 0x12, 0x89, 0x41, 0x08, 0xc5, 0x00, 0xf0, 0x13, 0x14, 0x22,
+  0x28, 0x11, 0x80, 0x14, 0x08, 0x42, 0x41, 0x00, 0x28, 0x26, 0x08, 0x00,
+  0x81, 0x00, 0x11, 0x18, 0x60, 0x22, 0x84, 0x20, 0x01, 0x20, 0x04, 0x00,
+  0x28, 0x90, 0x28, 0x22, 0x10, 0xd4, 0xb9, 0x0e, 0xf0, 0x02, 0x11, 0x08,
+  0xa0, 0x0c, 0xf0, 0x08, 0x20, 0x14, 0x18, 0x1a, 0x08, 0x81, 0x52, 0x81,
   0x00, 0x10, 0x48, 0x02, 0x81, 0x00, 0x00, 0x84, 0x84, 0x12, 0x12, 0x84,
-  0x40, 0x08, 0x00, 0x84, 0x40, 0x08, 0x00, 0x18, 0x80, 0x01, 0x14, 0x8f,
+  0x40, 0x08, 0x00, 0x04, 0x00, 0xf0, 0x09, 0x18, 0x80, 0x01, 0x14, 0x8f,
   0xdb, 0x0f, 0x10, 0x08, 0x00, 0x10, 0x22, 0x01, 0x8a, 0x02, 0x12, 0x20,
-  0x08, 0x12, 0x20, 0x0a, 0x00, 0x40, 0x82, 0x04, 0x00, 0x00, 0x00, 0x22,
+  0x08, 0x12, 0x20, 0x0a, 0x00, 0x40, 0x82, 0x1e, 0x0f, 0xf0, 0x0f, 0x22,
   0x00, 0x60, 0x22, 0x81, 0x20, 0x24, 0x06, 0x42, 0x10, 0x28, 0x08, 0x84,
   0x20, 0x08, 0x80, 0x24, 0x28, 0x04, 0x00, 0x00, 0xdf, 0x58, 0x01, 0x82,
-  0x42, 0x80, 0x02, 0x22, 0x81, 0x00, 0x00, 0x00, 0x40, 0x28, 0x02, 0x24,
+  0x42, 0x80, 0x02, 0x22, 0x81, 0xda, 0x0b, 0xf0, 0x00, 0x28, 0x02, 0x24,
   0x20, 0x12, 0x02, 0x10, 0x04, 0x00, 0x22, 0x90, 0x28, 0x84, 0x48, 0x81,
-  0x42, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x12, 0x00, 0x12, 0xf0, 0xe1, 0xb7, 0x00, 0x80, 0x01, 0x80, 0x04, 0x00,
-  0x00, 0x48, 0x44, 0x00, 0x48, 0x00, 0x60, 0x44, 0x81, 0x48, 0xa5, 0x02,
-  0x81, 0x81, 0xa0, 0x18, 0x81, 0x88, 0x00, 0x80, 0x41, 0x88, 0x08, 0x18,
-  0x80, 0x48, 0x08, 0x84, 0x40, 0x48, 0x08, 0x00, 0x22, 0x84, 0x8c, 0x02,
-  0x00, 0x00, 0x28, 0xf0, 0x59, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x89, 0x42, 0x52, 0x28, 0x40, 0x42, 0x08, 0x22, 0x48, 0x22,
-  0x60, 0x28, 0x00, 0x20, 0x04, 0x00, 0x00, 0x42, 0x00, 0x00, 0x42, 0x20,
-  0x84, 0x05, 0x42, 0x20, 0x44, 0x08, 0x00, 0x00, 0x42, 0x18, 0x48, 0x18,
-  0xf0, 0xc3, 0x42, 0x00, 0x00, 0x42, 0x40, 0x82, 0x41, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00,
-  0x80, 0x44, 0x08, 0x12, 0x84, 0xc0, 0x88, 0x40, 0x48, 0x08, 0x00, 0x40,
-  0x48, 0x08, 0x00, 0x00, 0xf0, 0x47, 0x45, 0x00, 0x80, 0x04, 0x16, 0x22,
-  0x08, 0x00, 0x18, 0xc0, 0x84, 0x80, 0x01, 0x88, 0x60, 0x85, 0x84, 0x92,
-  0x30, 0x98, 0x21, 0x20, 0x18, 0x98, 0x88, 0x42, 0x40, 0x08, 0x00, 0x28,
-  0x00, 0x21, 0x29, 0x22, 0x24, 0x01, 0xa2, 0x12, 0x22, 0x00, 0x2a, 0x08,
-  0x28, 0x48, 0x88, 0x00, 0x60, 0x18, 0x20, 0x08, 0x82, 0xdf, 0xe8, 0x08,
-  0x20, 0x08, 0x20, 0x08, 0x80, 0x02, 0x00, 0x00, 0x80, 0x12, 0x08, 0xa1,
-  0x10, 0x12, 0x02, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x21, 0x42, 0x20, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00,
-  0x14, 0x48, 0xff, 0xcb, 0x02, 0x8c, 0x81, 0x82, 0x04, 0x24, 0x00, 0x48,
-  0x80, 0x04, 0x44, 0x80, 0x06, 0x00, 0x10, 0x0a, 0x00, 0x29, 0x14, 0x88,
-  0x21, 0x02, 0x81, 0x80, 0x01, 0x89, 0x59, 0x18, 0x88, 0xc0, 0x18, 0xd0,
-  0x82, 0x0c, 0x12, 0x42, 0x20, 0x04, 0x00, 0x44, 0x84, 0x28, 0x84, 0x00,
-  0x81, 0x19, 0x22, 0x84, 0x02, 0x21, 0xf0, 0xde, 0xfa, 0x80, 0xa1, 0x48,
-  0x12, 0xa0, 0x81, 0x00, 0x16, 0x08, 0x82, 0x80, 0x82, 0x82, 0x04, 0x42,
-  0x21, 0x4a, 0x11, 0xe2, 0xc4, 0x0a, 0x85, 0x28, 0x74, 0x62, 0x0c, 0x89,
-  0x01, 0x28, 0x10, 0x08, 0x22, 0x25, 0x08, 0x80, 0x65, 0x24, 0x2b, 0x81,
-  0xe0, 0x89, 0x84, 0xe5, 0x88, 0xc7, 0x48, 0x20, 0x58, 0x88, 0x20, 0x04,
-  0x83, 0x02, 0x8d, 0x48, 0x90, 0x41, 0x1c, 0x0c, 0xc0, 0x11, 0xb0, 0x28,
-  0x0d, 0x60, 0x88, 0x00, 0x80, 0x08, 0x00, 0x2a, 0x05, 0x5a, 0x18, 0x24,
-  0x18, 0x48, 0x58, 0x28, 0x2d, 0x2a, 0xd0, 0x22, 0x11, 0xa2, 0x86, 0x80,
-  0x04, 0xa4, 0x40, 0x08, 0x84, 0xc0, 0x18, 0xa0, 0xa1, 0x84, 0xa6, 0x42,
-  0x58, 0x28, 0x4a, 0x24, 0x24, 0x21, 0x24, 0xa1, 0x34, 0x20, 0x94, 0x88,
-  0x81, 0x82, 0x42, 0x00, 0x81, 0x42, 0x80, 0xa2, 0xc1, 0x26, 0x01, 0x1f,
-  0xcf, 0x07, 0x80, 0x02, 0x62, 0x24, 0x27, 0x26, 0x27, 0x81, 0x89, 0x06,
-  0x00, 0x00, 0x18, 0x2e, 0x28, 0x1a, 0x0a, 0x83, 0x58, 0xa8, 0x48, 0x85,
-  0x98, 0x12, 0x8d, 0x4a, 0xd0, 0x88, 0x28, 0x5e, 0x88, 0x9a, 0x44, 0xa8,
-  0x78, 0x85, 0xa8, 0x84, 0x81, 0x87, 0x84, 0x00, 0x21, 0x28, 0x85, 0xa8,
-  0x12, 0x83, 0x14, 0xb8, 0x48, 0x71, 0x88, 0x58, 0x88, 0xc0, 0x28, 0x50,
-  0x88, 0xd0, 0x88, 0x28, 0x62, 0x88, 0x28, 0x5a, 0x81, 0x01, 0x12, 0xc8,
-  0xfb, 0x48, 0x20, 0x01, 0x12, 0x20, 0x21, 0x24, 0xa1, 0x14, 0xa0, 0x94,
-  0xa0, 0x94, 0xa0, 0x94, 0xa0, 0x94, 0x84, 0x4e, 0x92, 0xd0, 0x28, 0x09,
-  0x98, 0x90, 0x88, 0x00, 0x30, 0x18, 0x20, 0x09, 0x8b, 0x29, 0xa0, 0x29,
-  0xa0, 0x29, 0xe0, 0x89, 0x02, 0x8a, 0x82, 0xa1, 0x28, 0xe0, 0x88, 0x82,
-  0x88, 0x82, 0x48, 0x88, 0x48, 0x88, 0x28, 0x82, 0x28, 0x82, 0x28, 0x83,
-  0x28, 0x82, 0xf8, 0x7b, 0xe4, 0xa0, 0x45, 0x3a, 0xa3, 0x11, 0x1a, 0xa1,
-  0x44, 0x5e, 0x52, 0x2f, 0x85, 0xe5, 0x87, 0xa2, 0x41, 0xc8, 0xda, 0xad,
-  0xab, 0x9a, 0x8c, 0xfc, 0xd8, 0xd8, 0x8f, 0xa9, 0xf8, 0xda, 0xc8, 0xab,
-  0xc4, 0x2b, 0x9d, 0x9e, 0xd2, 0x2f, 0x89, 0xf9, 0x28, 0x28, 0xde, 0xd8,
-  0xee, 0xe8, 0xe0, 0x22, 0xb3, 0x12, 0xa1, 0x44, 0x8f, 0x88, 0xf9, 0xc8,
-  0xd8, 0x9e, 0x98, 0xb6, 0xf8, 0x38, 0x98, 0x8f, 0x81, 0xa9, 0xbb, 0x7a,
-  0xe4, 0x23, 0xf9, 0x18, 0x92, 0xaf, 0x8b, 0xfa, 0x68, 0x58, 0x8f, 0x8a,
-  0xac, 0xdd, 0xea, 0xeb, 0x87, 0xa7, 0xa2, 0xce, 0xc8, 0x8f, 0x8a, 0xba,
-  0xc8, 0x9c, 0x88, 0x8b, 0xec, 0x8f, 0x8a, 0xfa, 0x88, 0x88, 0x89, 0xba,
-  0xc1, 0xbe, 0xe1, 0xae, 0x8a, 0x7a, 0xa6, 0xbb, 0xea, 0xfe, 0x58, 0x64,
-  0x20, 0xe1, 0x86, 0x02, 0x5a, 0xa5, 0x11, 0x21, 0xaf, 0x84, 0xf4, 0x78,
-  0x28, 0x1a, 0xa4, 0xd1, 0x4f, 0x4d, 0xad, 0x67, 0x1e, 0x64, 0x1a, 0xfd,
-  0xd8, 0xd8, 0x8f, 0xa5, 0x34, 0x12, 0x1a, 0xf9, 0xd2, 0xd8, 0x87, 0x84,
-  0x25, 0xf8, 0xb2, 0xb8, 0xde, 0xd8, 0xfe, 0xf8, 0xe0, 0x2a, 0xf3, 0x1a,
-  0x18, 0xde, 0xd8, 0x18, 0x8f, 0x84, 0xf5, 0x98, 0x98, 0x17, 0x9b, 0x8f,
-  0x82, 0xe8, 0x92, 0xfa, 0xb8, 0xb8, 0xfe, 0xc2, 0x2f, 0xa2, 0xfc, 0x28,
-  0xa2, 0xab, 0xbb, 0xfa, 0xac, 0x46, 0x7a, 0xa7, 0xff, 0xda, 0x8d, 0xf8,
-  0xc4, 0xcc, 0x2e, 0x28, 0x8f, 0x46, 0xd6, 0x88, 0xb8, 0xc8, 0xbe, 0x28,
-  0xf2, 0x28, 0x28, 0x8d, 0xa8, 0x1b, 0xec, 0x6a, 0x67, 0x22, 0x2b, 0xcd,
-  0x9a, 0xf9, 0x72, 0x71, 0xcf, 0x9b, 0x0c, 0x18, 0x2a, 0x06, 0xa0, 0x11,
-  0x20, 0xa4, 0x72, 0xa0, 0x1d, 0x4c, 0xa8, 0x76, 0x28, 0xda, 0xd1, 0x88,
-  0xf8, 0x48, 0x52, 0xa5, 0xb8, 0x9a, 0xf1, 0x42, 0x88, 0x8d, 0x4a, 0x25,
-  0xf8, 0xba, 0xb8, 0x46, 0xf8, 0x68, 0x78, 0x8a, 0xf8, 0x28, 0xa2, 0x21,
-  0x5a, 0x05, 0x8f, 0x85, 0x64, 0x89, 0x8d, 0xb9, 0x85, 0xf8, 0xa8, 0x28,
-  0x16, 0xe8, 0x2c, 0x9f, 0x42, 0x8f, 0xaa, 0x72, 0x1a, 0xf8, 0xc8, 0xf8,
-  0x8f, 0x84, 0xf4, 0x78, 0x68, 0x4a, 0xf5, 0xd8, 0xd8, 0x87, 0x88, 0x6e,
-  0xec, 0x84, 0x8f, 0x84, 0x36, 0x88, 0x8f, 0x84, 0x5c, 0x88, 0x8f, 0x82,
-  0x72, 0x88, 0xa8, 0xc6, 0x6e, 0x11, 0x1a, 0xb3, 0xd2, 0xad, 0x11, 0x6a,
-  0xf5, 0x96, 0x9d, 0x80, 0xb1, 0x28, 0xa6, 0x11, 0x5a, 0x41, 0xf2, 0x42,
-  0x42, 0xaf, 0x85, 0xf1, 0x28, 0x78, 0x20, 0xec, 0x45, 0xad, 0xba, 0x41,
-  0xc2, 0x8f, 0x85, 0xfd, 0x88, 0x92, 0xa5, 0xfa, 0xc8, 0x4a, 0x2f, 0xa5,
-  0xfd, 0xda, 0x98, 0x25, 0xf8, 0x28, 0x28, 0x8f, 0x8d, 0xfd, 0x68, 0x78,
-  0x8a, 0xe8, 0x23, 0xfa, 0x1a, 0x18, 0x8f, 0x8c, 0x04, 0x8f, 0x8d, 0x7c,
-  0x98, 0xd8, 0x98, 0x5b, 0x88, 0x9f, 0x89, 0xe1, 0x8b, 0xea, 0x24, 0x17,
-  0xfa, 0x98, 0x1a, 0xab, 0xbb, 0x8f, 0x85, 0xf6, 0x48, 0x48, 0x8b, 0xcd,
-  0xfa, 0xff, 0x78, 0x78, 0x87, 0x88, 0x6e, 0xec, 0x8e, 0x88, 0xcf, 0x84,
-  0x76, 0x88, 0xb8, 0x68, 0xbc, 0xa8, 0x5a, 0x88, 0x87, 0x88, 0x6a, 0xac,
-  0xde, 0x1a, 0xb3, 0x52, 0xe5, 0x2b, 0xab, 0xde, 0x3b, 0x54, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x24, 0x00, 0x20, 0x04,
-  0x81, 0x00, 0x10, 0x08, 0x00, 0x81, 0x00, 0x00, 0x00, 0x40, 0x08, 0x84,
-  0x00, 0x40, 0x08, 0x00, 0x00, 0x84, 0x00, 0x20, 0x01, 0xf0, 0x22, 0xe5,
-  0x20, 0x08, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x10, 0x48, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa4,
-  0x14, 0x12, 0x40, 0x08, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0xcf,
-  0xb9, 0x01, 0x2c, 0xf4, 0x11, 0x24, 0x87, 0x22, 0x1f, 0x41, 0x32, 0x68,
-  0x1f, 0x41, 0x36, 0x4a, 0x1d, 0x64, 0xab, 0x16, 0x1f, 0x48, 0xb6, 0x4a,
-  0xb9, 0x81, 0xb6, 0x4a, 0xb9, 0x85, 0xb4, 0x4a, 0xb9, 0xa4, 0xf4, 0x4a,
-  0xb3, 0x4b, 0x4a, 0x2f, 0x34, 0xfb, 0xa4, 0x48, 0x2f, 0x54, 0xfb, 0xa4,
-  0x48, 0x1c, 0xf9, 0xa4, 0x4a, 0x4e, 0x85, 0x4f, 0xa2, 0x64, 0x11, 0x4f,
-  0xa2, 0xe4, 0x19, 0xe2, 0xa2, 0xec, 0x5d, 0xc2, 0xca, 0xde, 0x24, 0x2d,
-  0xca, 0x1f, 0x49, 0xc2, 0xc2, 0x1f, 0x49, 0xd2, 0x28, 0xf8, 0x91, 0x24,
-  0x8b, 0x84, 0x1f, 0x49, 0xb2, 0x4a, 0xf9, 0x81, 0x24, 0xab, 0x94, 0x1f,
-  0xc8, 0xb2, 0x4a, 0xb9, 0x81, 0xb2, 0x4a, 0x39, 0x85, 0xab, 0x94, 0x43,
-  0xba, 0x4a, 0xb9, 0xa4, 0xb4, 0x42, 0x79, 0xa4, 0x98, 0x92, 0x4f, 0x8a,
-  0x84, 0xf9, 0xa4, 0x4a, 0x7f, 0x16, 0x0a, 0x24, 0x1d, 0x4c, 0x85, 0xd2,
-  0x41, 0x56, 0x28, 0x1d, 0x24, 0x81, 0x1d, 0x24, 0xa1, 0x15, 0x54, 0x4a,
-  0x11, 0xad, 0x24, 0x51, 0xa9, 0x12, 0x54, 0x12, 0x43, 0x52, 0x1a, 0x22,
-  0xa5, 0xb5, 0x26, 0x54, 0x18, 0x2f, 0x22, 0x45, 0xf5, 0x24, 0xda, 0x85,
-  0xd1, 0x24, 0x48, 0xc1, 0x4a, 0x85, 0xc5, 0x43, 0x54, 0xac, 0x54, 0x49,
-  0x48, 0x1d, 0x4c, 0x25, 0xd2, 0xc1, 0x34, 0x48, 0x17, 0x41, 0xab, 0x14,
-  0x15, 0xb4, 0x42, 0x51, 0x41, 0xad, 0x14, 0x15, 0xb4, 0x42, 0x53, 0x85,
-  0x29, 0x53, 0x84, 0xa9, 0x11, 0xb4, 0x42, 0x51, 0x84, 0x21, 0x65, 0x98,
-  0x12, 0x4d, 0x1a, 0xcc, 0x0b, 0x84, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x40, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00,
-  0x50, 0x12, 0x42, 0x6f, 0xb2, 0x08, 0x00, 0x00, 0x00, 0x83, 0x82, 0x24,
-  0xa1, 0x48, 0xa0, 0x48, 0x84, 0x8b, 0x48, 0x80, 0x84, 0xba, 0x82, 0xa4,
-  0x28, 0xb6, 0x02, 0x8a, 0xa1, 0x24, 0x22, 0x28, 0x42, 0x42, 0x46, 0x04,
-  0x4a, 0x9a, 0x22, 0x88, 0xa0, 0x84, 0xa0, 0xd2, 0x80, 0x88, 0x92, 0x9a,
-  0x90, 0x88, 0x80, 0x29, 0x08, 0x8a, 0x05, 0x8a, 0x84, 0x64, 0x8c, 0x98,
-  0x8a, 0x21, 0xa2, 0x48, 0x20, 0x0c, 0x82, 0xff, 0x65, 0x0f, 0x22, 0x8a,
-  0x02, 0x28, 0x26, 0x02, 0x25, 0x22, 0x81, 0x42, 0x22, 0x12, 0x02, 0x00,
-  0x82, 0x40, 0x22, 0xc4, 0x41, 0x40, 0x08, 0x42, 0x21, 0x00, 0x18, 0x48,
-  0x41, 0x80, 0x12, 0xc2, 0x22, 0x00, 0x20, 0x01, 0x41, 0x42, 0x12, 0x20,
-  0xa4, 0x14, 0x2a, 0x01, 0x18, 0x00, 0x20, 0x02, 0x18, 0x20, 0x46, 0xc1,
-  0x61, 0x48, 0x3f, 0x48, 0x07, 0xa0, 0x24, 0x80, 0x22, 0x42, 0x02, 0x23,
-  0xa1, 0x21, 0x88, 0x41, 0x21, 0x83, 0x42, 0x08, 0x88, 0xa2, 0x46, 0x22,
-  0x2a, 0x54, 0x22, 0x16, 0x28, 0xa4, 0x43, 0x20, 0x88, 0x24, 0x85, 0xa4,
-  0x68, 0x21, 0x1b, 0x28, 0x21, 0x8e, 0x42, 0x81, 0x1a, 0x26, 0x24, 0x28,
-  0x32, 0x18, 0x42, 0x89, 0x01, 0x52, 0xc8, 0x49, 0xa1, 0x84, 0x32, 0x88,
-  0x48, 0x8b, 0x84, 0xaa, 0xa1, 0x81, 0x38, 0x4a, 0xc8, 0x22, 0xc8, 0x66,
-  0xa1, 0xc1, 0xff, 0x11, 0x0d, 0x22, 0x00, 0x40, 0x02, 0x83, 0x82, 0x04,
-  0x48, 0x23, 0xa2, 0x48, 0xa0, 0x48, 0x80, 0x44, 0x22, 0x28, 0x34, 0xb1,
-  0x20, 0x88, 0x42, 0x82, 0x82, 0x04, 0x41, 0x10, 0x84, 0x02, 0x20, 0x02,
-  0x88, 0x80, 0x01, 0x69, 0x08, 0x88, 0x80, 0x28, 0x21, 0x22, 0x01, 0x48,
-  0x00, 0x00, 0x00, 0x42, 0x11, 0x00, 0x8f, 0x9b, 0x09, 0x00, 0x00, 0x2a,
-  0x81, 0x02, 0x68, 0x18, 0x1a, 0x04, 0x48, 0x00, 0x42, 0x80, 0xa2, 0x41,
-  0x20, 0x01, 0x84, 0x42, 0x82, 0x81, 0x00, 0x84, 0x42, 0x18, 0x80, 0x51,
-  0x48, 0x29, 0x08, 0x00, 0x00, 0x00, 0x2a, 0x28, 0x28, 0x02, 0x42, 0x82,
-  0x00, 0x00, 0x00, 0x28, 0x82, 0xa8, 0x82, 0x00, 0x5f, 0x11, 0x0e, 0x28,
-  0x12, 0x1a, 0x82, 0x01, 0x4c, 0x34, 0x38, 0x18, 0x22, 0x82, 0x88, 0xaa,
-  0x21, 0xa4, 0x18, 0x18, 0x8b, 0x94, 0x80, 0x28, 0x29, 0x3c, 0x32, 0x88,
-  0x60, 0x82, 0x42, 0x26, 0x22, 0x26, 0x21, 0x22, 0x94, 0x48, 0xa8, 0x48,
-  0x72, 0x68, 0xa2, 0xa0, 0x21, 0x11, 0x2b, 0x29, 0xc0, 0x14, 0x42, 0x86,
-  0x98, 0xd8, 0x22, 0x42, 0x80, 0x88, 0x88, 0x28, 0x82, 0x0c, 0x4b, 0x41,
-  0x90, 0x28, 0x2a, 0x84, 0xf2, 0xea, 0x73, 0x80, 0x82, 0x21, 0x03, 0x12,
-  0x48, 0x16, 0xa8, 0x14, 0x1a, 0xa2, 0x14, 0x82, 0x58, 0x48, 0x98, 0x42,
-  0x89, 0x81, 0xa2, 0x14, 0x92, 0xca, 0x01, 0x20, 0xa4, 0x82, 0x48, 0x30,
-  0x22, 0x80, 0xa2, 0x41, 0x84, 0x1a, 0x62, 0x44, 0x92, 0x48, 0xa2, 0xa0,
-  0x21, 0x30, 0x92, 0xe0, 0x48, 0x83, 0xb8, 0x88, 0xe2, 0x81, 0x8c, 0x84,
-  0x08, 0x88, 0x88, 0x88, 0x80, 0x28, 0xa2, 0x84, 0x2a, 0x88, 0x28, 0x02,
-  0xff, 0xa9, 0x03, 0x00, 0x80, 0x21, 0xc2, 0x24, 0x22, 0x28, 0x20, 0x08,
-  0xa2, 0x00, 0x12, 0xc8, 0x20, 0x08, 0x30, 0x32, 0x83, 0x08, 0x81, 0x81,
-  0x28, 0x42, 0x8c, 0x81, 0x04, 0x42, 0x82, 0xa4, 0x62, 0x22, 0x00, 0x10,
-  0x21, 0x02, 0x20, 0x04, 0x20, 0x22, 0x04, 0x00, 0x80, 0x22, 0x04, 0x4c,
-  0x01, 0x89, 0x82, 0x84, 0xf2, 0x66, 0x7f, 0x00, 0x32, 0x81, 0x24, 0x28,
-  0x8c, 0x04, 0x80, 0x22, 0x01, 0x22, 0xaa, 0x41, 0x08, 0x28, 0x84, 0x20,
-  0x01, 0x00, 0x18, 0x81, 0x40, 0x08, 0x00, 0x00, 0x20, 0x2d, 0x14, 0xe8,
-  0x41, 0x24, 0xb4, 0x18, 0x18, 0x8a, 0x24, 0x48, 0x04, 0x4e, 0x88, 0x40,
-  0x08, 0x12, 0x81, 0x80, 0x01, 0x22, 0xc1, 0x30, 0x84, 0x00, 0x43, 0xf9,
-  0x81, 0x36, 0x80, 0x04, 0x22, 0x20, 0x04, 0x00, 0x12, 0x22, 0x18, 0x60,
-  0x82, 0x42, 0x16, 0x08, 0x48, 0x18, 0x10, 0xc8, 0x2a, 0x42, 0x42, 0x28,
-  0x48, 0x20, 0xa1, 0x42, 0x82, 0x28, 0x80, 0x04, 0x83, 0x92, 0x28, 0x20,
-  0x84, 0x02, 0x41, 0x18, 0x48, 0x18, 0x00, 0x88, 0x4c, 0x22, 0x0a, 0x19,
-  0x21, 0xa6, 0xc2, 0x42, 0x88, 0x82, 0x10, 0x01, 0x12, 0xef, 0x18, 0x0e,
-  0x00, 0x80, 0x03, 0x80, 0x02, 0x42, 0x00, 0x84, 0x10, 0x01, 0x88, 0x82,
-  0x81, 0x2a, 0x14, 0x84, 0x08, 0x00, 0xa8, 0x42, 0x30, 0x14, 0x48, 0x00,
-  0x22, 0x89, 0x02, 0x80, 0x08, 0x80, 0x81, 0x02, 0x00, 0x60, 0x84, 0x10,
-  0x08, 0x48, 0x48, 0x00, 0x18, 0x48, 0x4a, 0x82, 0x44, 0x01, 0xe0, 0x28,
-  0x09, 0x48, 0x80, 0x82, 0x21, 0x14, 0x88, 0x02, 0x78, 0x2a, 0x01, 0x81,
-  0x84, 0x94, 0x83, 0x01, 0x8c, 0x84, 0x81, 0x51, 0x48, 0x00, 0x58, 0x28,
-  0x28, 0x83, 0x24, 0xb1, 0x54, 0x22, 0x88, 0x02, 0x42, 0xe2, 0x8b, 0x42,
-  0xe0, 0x49, 0x04, 0x87, 0x2b, 0x8c, 0x91, 0x24, 0x98, 0x48, 0x18, 0x86,
-  0x38, 0x48, 0x82, 0x89, 0x22, 0x81, 0x24, 0xa1, 0x16, 0x4a, 0x88, 0x82,
-  0x84, 0x12, 0x04, 0x10, 0xf4, 0xc2, 0xe6, 0x00, 0x1a, 0x12, 0x88, 0x32,
-  0x22, 0x48, 0x00, 0x00, 0x18, 0x28, 0x98, 0x48, 0x20, 0x8a, 0x48, 0xa8,
-  0x24, 0x90, 0xa8, 0x48, 0x40, 0xa8, 0x84, 0x00, 0x20, 0x04, 0x20, 0x32,
-  0x18, 0x80, 0x02, 0x00, 0x20, 0x04, 0x41, 0x20, 0x04, 0x81, 0x80, 0x48,
-  0x68, 0x14, 0x80, 0xa2, 0x41, 0x8d, 0x84, 0x8a, 0xa4, 0x84, 0x00, 0x82,
-  0x97, 0x7a, 0x00, 0x20, 0x01, 0x00, 0x12, 0x22, 0x80, 0x88, 0xa2, 0x29,
-  0x00, 0x80, 0x01, 0x00, 0x4a, 0x09, 0x40, 0xa2, 0x48, 0x10, 0x88, 0x84,
-  0x04, 0x83, 0x84, 0x04, 0x20, 0x02, 0x10, 0xa8, 0x21, 0xc0, 0x88, 0x22,
-  0x58, 0x42, 0xa6, 0x28, 0x48, 0x88, 0x48, 0x28, 0x08, 0x40, 0x08, 0x42,
-  0x00, 0x88, 0x00, 0x5f, 0x44, 0x0a, 0x28, 0x81, 0x28, 0x82, 0x2c, 0x02,
-  0x28, 0x40, 0x82, 0x01, 0x42, 0x24, 0x00, 0x4a, 0x08, 0x00, 0x22, 0x80,
-  0x21, 0x04, 0x00, 0x00, 0x10, 0x04, 0xae, 0x48, 0x50, 0x84, 0x20, 0x03,
-  0x43, 0x28, 0x24, 0x02, 0x00, 0x20, 0x84, 0x02, 0x00, 0x00, 0x00, 0x80,
-  0x84, 0x04, 0x80, 0xf8, 0xea, 0x19, 0x00, 0x22, 0x18, 0x28, 0x12, 0x68,
-  0x00, 0x20, 0x14, 0x08, 0x00, 0x00, 0x81, 0xc8, 0x00, 0x00, 0x48, 0x00,
-  0x80, 0x24, 0x01, 0x12, 0x81, 0x20, 0x06, 0x00, 0x28, 0x8a, 0x01, 0x88,
-  0xc0, 0x18, 0x20, 0x04, 0x80, 0x02, 0x88, 0x00, 0x00, 0x28, 0x00, 0x48,
-  0x20, 0xf8, 0x9b, 0x4c, 0x90, 0x22, 0x00, 0x00, 0x10, 0x08, 0x00, 0x20,
-  0x24, 0x22, 0x04, 0x42, 0x00, 0x00, 0x40, 0x08, 0x00, 0x21, 0x00, 0x42,
-  0x82, 0x10, 0x02, 0x68, 0x30, 0x92, 0x84, 0x20, 0x24, 0x01, 0x82, 0x00,
-  0x20, 0x04, 0x2a, 0x01, 0x44, 0x00, 0x00, 0x60, 0x44, 0x00, 0x12, 0xab,
-  0xf3, 0xa0, 0x18, 0x20, 0x02, 0x81, 0x00, 0x1a, 0x04, 0x00, 0x12, 0x20,
-  0x18, 0x08, 0x00, 0xa0, 0x84, 0xb0, 0x88, 0x01, 0x20, 0x08, 0x00, 0x10,
-  0x08, 0x8b, 0x12, 0x30, 0x18, 0x80, 0x04, 0x00, 0x28, 0x81, 0x00, 0x82,
-  0xc2, 0x12, 0x81, 0x10, 0x08, 0x80, 0x12, 0x08, 0x20, 0x03, 0x22, 0xf0,
-  0xdf, 0x41, 0x00, 0x81, 0x80, 0x92, 0x22, 0x20, 0x01, 0x80, 0x29, 0x22,
-  0x08, 0x12, 0x28, 0x98, 0x80, 0x01, 0x12, 0x83, 0x22, 0x02, 0x10, 0x08,
-  0x00, 0x00, 0x48, 0xc2, 0x80, 0x4c, 0xc8, 0x28, 0x48, 0x2a, 0x04, 0x21,
-  0xa0, 0x24, 0x20, 0x02, 0x80, 0x48, 0x04, 0x1a, 0x24, 0x28, 0xa1, 0x84,
-  0xa0, 0x84, 0xa0, 0x48, 0x00, 0xd7, 0xdf, 0x00, 0x24, 0x00, 0x00, 0x28,
-  0x21, 0x00, 0x10, 0x02, 0x40, 0x02, 0x24, 0x40, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x40, 0x04, 0x00, 0x44, 0x24, 0x00, 0x41, 0x10, 0x84, 0x04,
-  0x41, 0xe0, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf2, 0x96,
-  0x20, 0x81, 0x02, 0x80, 0x01, 0x80, 0x03, 0x2a, 0x04, 0x10, 0xa8, 0x94,
-  0x28, 0x00, 0x1a, 0x04, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x20, 0x04, 0x84,
-  0x18, 0x80, 0x09, 0x88, 0x00, 0x00, 0x84, 0x88, 0x20, 0x01, 0x48, 0x84,
-  0x40, 0x28, 0x02, 0x48, 0x82, 0x18, 0x88, 0x28, 0xa0, 0x21, 0xd0, 0x25,
-  0x07, 0x84, 0x90, 0x48, 0x00, 0x4a, 0x02, 0x42, 0x81, 0x00, 0x4c, 0x02,
-  0x28, 0x00, 0x80, 0x08, 0x22, 0x26, 0x08, 0x21, 0x48, 0x18, 0x84, 0x88,
-  0xa3, 0x45, 0xb8, 0x92, 0x04, 0xc0, 0x49, 0x21, 0x40, 0x08, 0x48, 0x30,
-  0x58, 0x80, 0x02, 0x83, 0x04, 0x81, 0x46, 0x14, 0x88, 0x02, 0x88, 0x26,
-  0x24, 0xe4, 0x42, 0x04, 0x00, 0x25, 0x04, 0x1f, 0xc4, 0x43, 0xa2, 0x21,
-  0x8f, 0xa8, 0x82, 0x01, 0x1e, 0x32, 0x60, 0x81, 0x2a, 0x04, 0x9a, 0xc3,
-  0x28, 0x32, 0x00, 0xb0, 0x42, 0x44, 0xa8, 0x49, 0x80, 0x03, 0x48, 0x42,
-  0x48, 0x8c, 0x08, 0x42, 0x12, 0xf0, 0xc4, 0x58, 0x84, 0x83, 0x2b, 0xb4,
-  0xf2, 0x44, 0xa2, 0x41, 0x85, 0xaa, 0x98, 0x48, 0x4c, 0x18, 0x88, 0x08,
-  0xca, 0x07, 0x90, 0xc8, 0x4b, 0x21, 0x8b, 0x88, 0x4a, 0x01, 0x18, 0x89,
-  0xa4, 0x22, 0x00, 0xca, 0xe8, 0x42, 0x81, 0xf8, 0xd9, 0x8d, 0x80, 0x01,
-  0x28, 0x2a, 0x12, 0x88, 0x02, 0x23, 0x45, 0x22, 0x24, 0x82, 0x8f, 0xa2,
-  0x5c, 0x83, 0x82, 0x09, 0x23, 0x04, 0xf2, 0x22, 0x8f, 0x81, 0x88, 0x24,
-  0x08, 0x81, 0x60, 0x84, 0x42, 0xa1, 0x46, 0xc2, 0x8c, 0x2a, 0xd4, 0x84,
-  0x11, 0xa8, 0xa2, 0x42, 0x2a, 0x22, 0xe4, 0x81, 0x61, 0x82, 0xfe, 0x4c,
-  0x4a, 0x44, 0x88, 0xc4, 0x18, 0xa6, 0x48, 0x48, 0x08, 0x8a, 0x68, 0x82,
-  0xca, 0xe8, 0x44, 0x24, 0xb4, 0x24, 0x85, 0x84, 0x82, 0xf1, 0x57, 0xff,
-  0x20, 0x22, 0x32, 0x38, 0x24, 0x22, 0x6a, 0xa4, 0x32, 0x38, 0x81, 0xc8,
-  0x30, 0xc2, 0x85, 0xa2, 0x81, 0x28, 0x92, 0x80, 0x09, 0x29, 0xdc, 0x88,
-  0xa2, 0x1a, 0x30, 0x42, 0x24, 0x84, 0x48, 0x29, 0x95, 0x48, 0x1a, 0x98,
-  0x48, 0x4a, 0x17, 0x98, 0xa8, 0xe0, 0x48, 0x21, 0x32, 0x14, 0x24, 0x8b,
-  0x2e, 0x80, 0x03, 0x8b, 0x82, 0xce, 0x84, 0x8b, 0x46, 0x4a, 0x12, 0x08,
-  0x49, 0x02, 0x4e, 0x24, 0x80, 0xa1, 0xc8, 0x4a, 0x02, 0x20, 0xf8, 0x6a,
-  0x3d, 0x24, 0x12, 0x26, 0x22, 0x61, 0x22, 0x12, 0x23, 0x26, 0xb1, 0x62,
-  0x01, 0x2b, 0x94, 0xb0, 0x62, 0x09, 0x2b, 0x94, 0xb0, 0x42, 0x09, 0x2b,
-  0x94, 0x90, 0xb2, 0x80, 0x09, 0x4a, 0x48, 0x02, 0x24, 0x12, 0x24, 0xd6,
-  0x44, 0xe2, 0x49, 0x42, 0xe2, 0x4d, 0x42, 0xe2, 0x49, 0x42, 0xe2, 0x49,
+  0xf7, 0x0c, 0x12, 0x40, 0xb2, 0x04, 0x80, 0x14, 0x12, 0x00, 0x12, 0xf0,
+  0xe1, 0xb7, 0x00, 0xa0, 0x0e, 0xf2, 0x1c, 0x00, 0x00, 0x48, 0x44, 0x00,
+  0x48, 0x00, 0x60, 0x44, 0x81, 0x48, 0xa5, 0x02, 0x81, 0x81, 0xa0, 0x18,
+  0x81, 0x88, 0x00, 0x80, 0x41, 0x88, 0x08, 0x18, 0x80, 0x48, 0x08, 0x84,
+  0x40, 0x48, 0x08, 0x00, 0x22, 0x84, 0x8c, 0x02, 0x00, 0x00, 0x28, 0xf0,
+  0x59, 0x17, 0xee, 0x04, 0xe0, 0x28, 0x00, 0x89, 0x42, 0x52, 0x28, 0x40,
+  0x42, 0x08, 0x22, 0x48, 0x22, 0x60, 0x28, 0x61, 0x08, 0x00, 0x73, 0x0d,
+  0xf0, 0x01, 0x42, 0x20, 0x84, 0x05, 0x42, 0x20, 0x44, 0x08, 0x00, 0x00,
+  0x42, 0x18, 0x48, 0x18, 0xf0, 0xc3, 0x13, 0x00, 0x36, 0x40, 0x82, 0x41,
+  0x7b, 0x0c, 0x00, 0x24, 0x05, 0x00, 0x59, 0x08, 0x40, 0x12, 0x84, 0xc0,
+  0x88, 0x57, 0x00, 0x00, 0x04, 0x00, 0xf1, 0x1b, 0x00, 0xf0, 0x47, 0x45,
+  0x00, 0x80, 0x04, 0x16, 0x22, 0x08, 0x00, 0x18, 0xc0, 0x84, 0x80, 0x01,
+  0x88, 0x60, 0x85, 0x84, 0x92, 0x30, 0x98, 0x21, 0x20, 0x18, 0x98, 0x88,
+  0x42, 0x40, 0x08, 0x00, 0x28, 0x00, 0x21, 0x29, 0x22, 0x24, 0x01, 0xa2,
+  0x12, 0x22, 0x91, 0x0c, 0xf0, 0x02, 0x88, 0x00, 0x60, 0x18, 0x20, 0x08,
+  0x82, 0xdf, 0xe8, 0x08, 0x20, 0x08, 0x20, 0x08, 0x80, 0x02, 0x00, 0x50,
+  0x09, 0x40, 0xa1, 0x10, 0x12, 0x02, 0xc6, 0x00, 0x01, 0x65, 0x0f, 0x41,
+  0x21, 0x42, 0x20, 0x84, 0xdc, 0x0c, 0xd0, 0x20, 0x04, 0x00, 0x14, 0x48,
+  0xff, 0xcb, 0x02, 0x8c, 0x81, 0x82, 0x04, 0x24, 0x93, 0x05, 0xf0, 0x0a,
+  0x44, 0x80, 0x06, 0x00, 0x10, 0x0a, 0x00, 0x29, 0x14, 0x88, 0x21, 0x02,
+  0x81, 0x80, 0x01, 0x89, 0x59, 0x18, 0x88, 0xc0, 0x18, 0xd0, 0x82, 0x0c,
+  0x12, 0x02, 0x0e, 0xf0, 0x41, 0x44, 0x84, 0x28, 0x84, 0x00, 0x81, 0x19,
+  0x22, 0x84, 0x02, 0x21, 0xf0, 0xde, 0xfa, 0x80, 0xa1, 0x48, 0x12, 0xa0,
+  0x81, 0x00, 0x16, 0x08, 0x82, 0x80, 0x82, 0x82, 0x04, 0x42, 0x21, 0x4a,
+  0x11, 0xe2, 0xc4, 0x0a, 0x85, 0x28, 0x74, 0x62, 0x0c, 0x89, 0x01, 0x28,
+  0x10, 0x08, 0x22, 0x25, 0x08, 0x80, 0x65, 0x24, 0x2b, 0x81, 0xe0, 0x89,
+  0x84, 0xe5, 0x88, 0xc7, 0x48, 0x20, 0x58, 0x88, 0x20, 0x04, 0x83, 0x02,
+  0x8d, 0x48, 0x90, 0x41, 0x1c, 0x0c, 0xc0, 0x11, 0xb0, 0x28, 0x0d, 0x60,
+  0x88, 0xa5, 0x0c, 0xf2, 0x7a, 0x2a, 0x05, 0x5a, 0x18, 0x24, 0x18, 0x48,
+  0x58, 0x28, 0x2d, 0x2a, 0xd0, 0x22, 0x11, 0xa2, 0x86, 0x80, 0x04, 0xa4,
+  0x40, 0x08, 0x84, 0xc0, 0x18, 0xa0, 0xa1, 0x84, 0xa6, 0x42, 0x58, 0x28,
+  0x4a, 0x24, 0x24, 0x21, 0x24, 0xa1, 0x34, 0x20, 0x94, 0x88, 0x81, 0x82,
+  0x42, 0x00, 0x81, 0x42, 0x80, 0xa2, 0xc1, 0x26, 0x01, 0x1f, 0xcf, 0x07,
+  0x80, 0x02, 0x62, 0x24, 0x27, 0x26, 0x27, 0x81, 0x89, 0x06, 0x00, 0x00,
+  0x18, 0x2e, 0x28, 0x1a, 0x0a, 0x83, 0x58, 0xa8, 0x48, 0x85, 0x98, 0x12,
+  0x8d, 0x4a, 0xd0, 0x88, 0x28, 0x5e, 0x88, 0x9a, 0x44, 0xa8, 0x78, 0x85,
+  0xa8, 0x84, 0x81, 0x87, 0x84, 0x00, 0x21, 0x28, 0x85, 0xa8, 0x12, 0x83,
+  0x14, 0xb8, 0x48, 0x71, 0x88, 0x58, 0x88, 0xc0, 0x28, 0x50, 0x88, 0xd0,
+  0x88, 0x28, 0x62, 0x88, 0x28, 0x5a, 0x81, 0x01, 0x12, 0xc8, 0xfb, 0x48,
+  0x20, 0x01, 0x12, 0x20, 0x21, 0x24, 0xa1, 0x14, 0xa0, 0x94, 0x02, 0x00,
+  0x80, 0x84, 0x4e, 0x92, 0xd0, 0x28, 0x09, 0x98, 0x90, 0xdf, 0x0d, 0xf0,
+  0xff, 0xb8, 0x20, 0x09, 0x8b, 0x29, 0xa0, 0x29, 0xa0, 0x29, 0xe0, 0x89,
+  0x02, 0x8a, 0x82, 0xa1, 0x28, 0xe0, 0x88, 0x82, 0x88, 0x82, 0x48, 0x88,
+  0x48, 0x88, 0x28, 0x82, 0x28, 0x82, 0x28, 0x83, 0x28, 0x82, 0xf8, 0x7b,
+  0xe4, 0xa0, 0x45, 0x3a, 0xa3, 0x11, 0x1a, 0xa1, 0x44, 0x5e, 0x52, 0x2f,
+  0x85, 0xe5, 0x87, 0xa2, 0x41, 0xc8, 0xda, 0xad, 0xab, 0x9a, 0x8c, 0xfc,
+  0xd8, 0xd8, 0x8f, 0xa9, 0xf8, 0xda, 0xc8, 0xab, 0xc4, 0x2b, 0x9d, 0x9e,
+  0xd2, 0x2f, 0x89, 0xf9, 0x28, 0x28, 0xde, 0xd8, 0xee, 0xe8, 0xe0, 0x22,
+  0xb3, 0x12, 0xa1, 0x44, 0x8f, 0x88, 0xf9, 0xc8, 0xd8, 0x9e, 0x98, 0xb6,
+  0xf8, 0x38, 0x98, 0x8f, 0x81, 0xa9, 0xbb, 0x7a, 0xe4, 0x23, 0xf9, 0x18,
+  0x92, 0xaf, 0x8b, 0xfa, 0x68, 0x58, 0x8f, 0x8a, 0xac, 0xdd, 0xea, 0xeb,
+  0x87, 0xa7, 0xa2, 0xce, 0xc8, 0x8f, 0x8a, 0xba, 0xc8, 0x9c, 0x88, 0x8b,
+  0xec, 0x8f, 0x8a, 0xfa, 0x88, 0x88, 0x89, 0xba, 0xc1, 0xbe, 0xe1, 0xae,
+  0x8a, 0x7a, 0xa6, 0xbb, 0xea, 0xfe, 0x58, 0x64, 0x20, 0xe1, 0x86, 0x02,
+  0x5a, 0xa5, 0x11, 0x21, 0xaf, 0x84, 0xf4, 0x78, 0x28, 0x1a, 0xa4, 0xd1,
+  0x4f, 0x4d, 0xad, 0x67, 0x1e, 0x64, 0x1a, 0xfd, 0xd8, 0xd8, 0x8f, 0xa5,
+  0x34, 0x12, 0x1a, 0xf9, 0xd2, 0xd8, 0x87, 0x84, 0x25, 0xf8, 0xb2, 0xb8,
+  0xde, 0xd8, 0xfe, 0xf8, 0xe0, 0x2a, 0xf3, 0x1a, 0x18, 0xde, 0xd8, 0x18,
+  0x8f, 0x84, 0xf5, 0x98, 0x98, 0x17, 0x9b, 0x8f, 0x82, 0xe8, 0x92, 0xfa,
+  0xb8, 0xb8, 0xfe, 0xc2, 0x2f, 0xa2, 0xfc, 0x28, 0xa2, 0xab, 0xbb, 0xfa,
+  0xac, 0x46, 0x7a, 0xa7, 0xff, 0xda, 0x8d, 0xf8, 0xc4, 0xcc, 0x2e, 0x28,
+  0x8f, 0x46, 0xd6, 0x88, 0xb8, 0xc8, 0xbe, 0x28, 0xf2, 0x28, 0x28, 0x8d,
+  0xa8, 0x1b, 0xec, 0x6a, 0x67, 0x22, 0x2b, 0xcd, 0x9a, 0xf9, 0x72, 0x71,
+  0xcf, 0x9b, 0x0c, 0x18, 0x2a, 0x06, 0xa0, 0x11, 0x20, 0xa4, 0x72, 0xa0,
+  0x1d, 0x4c, 0xa8, 0x76, 0x28, 0xda, 0xd1, 0x88, 0xf8, 0x48, 0x52, 0xa5,
+  0xb8, 0x9a, 0xf1, 0x42, 0x88, 0x8d, 0x4a, 0x25, 0xf8, 0xba, 0xb8, 0x46,
+  0xf8, 0x68, 0x78, 0x8a, 0xf8, 0x28, 0xa2, 0x21, 0x5a, 0x05, 0x8f, 0x85,
+  0x64, 0x89, 0x8d, 0xb9, 0x85, 0xf8, 0xa8, 0x28, 0x16, 0xe8, 0x2c, 0x9f,
+  0x42, 0x8f, 0xaa, 0x72, 0x1a, 0xf8, 0xc8, 0xf8, 0x8f, 0x84, 0xf4, 0x78,
+  0x68, 0x4a, 0xf5, 0xd8, 0xd8, 0x87, 0x88, 0x6e, 0xec, 0x84, 0x8f, 0x84,
+  0x36, 0x88, 0x8f, 0x84, 0x5c, 0x88, 0x8f, 0x82, 0x72, 0x88, 0xa8, 0xc6,
+  0x6e, 0x11, 0x1a, 0xb3, 0xd2, 0xad, 0x11, 0x6a, 0xf5, 0x96, 0x9d, 0x80,
+  0xb1, 0x28, 0xa6, 0x11, 0x5a, 0x41, 0xf2, 0x42, 0x42, 0xaf, 0x85, 0xf1,
+  0x28, 0x78, 0x20, 0xec, 0x45, 0xad, 0xba, 0x41, 0xc2, 0x8f, 0x85, 0xfd,
+  0x88, 0x92, 0xa5, 0xfa, 0xc8, 0x4a, 0x2f, 0xa5, 0xfd, 0xda, 0x98, 0x25,
+  0xf8, 0x28, 0x28, 0x8f, 0x8d, 0xfd, 0x68, 0x78, 0x8a, 0xe8, 0x23, 0xfa,
+  0x1a, 0x18, 0x8f, 0x8c, 0x04, 0x8f, 0x8d, 0x7c, 0x98, 0xd8, 0x98, 0x5b,
+  0x88, 0x9f, 0x89, 0xe1, 0x8b, 0xea, 0x24, 0x17, 0xfa, 0x98, 0x1a, 0xab,
+  0xbb, 0x8f, 0x85, 0xf6, 0x48, 0x48, 0x8b, 0xcd, 0xfa, 0xff, 0x78, 0x78,
+  0x73, 0x00, 0xf4, 0x0b, 0x8e, 0x88, 0xcf, 0x84, 0x76, 0x88, 0xb8, 0x68,
+  0xbc, 0xa8, 0x5a, 0x88, 0x87, 0x88, 0x6a, 0xac, 0xde, 0x1a, 0xb3, 0x52,
+  0xe5, 0x2b, 0xab, 0xde, 0x3b, 0x54, 0x74, 0x03, 0x70, 0x40, 0x02, 0x24,
+  0x00, 0x20, 0x04, 0x81, 0x6d, 0x04, 0x01, 0x15, 0x04, 0x21, 0x08, 0x84,
+  0x05, 0x04, 0x70, 0x84, 0x00, 0x20, 0x01, 0xf0, 0x22, 0xe5, 0x7f, 0x07,
+  0x00, 0x17, 0x00, 0x10, 0x10, 0x8d, 0x03, 0x05, 0x01, 0x00, 0x41, 0x80,
+  0xa4, 0x14, 0x12, 0x2a, 0x04, 0x00, 0xdc, 0x03, 0xf0, 0x03, 0xcf, 0xb9,
+  0x01, 0x2c, 0xf4, 0x11, 0x24, 0x87, 0x22, 0x1f, 0x41, 0x32, 0x68, 0x1f,
+  0x41, 0x36, 0x4a, 0x1d, 0x8f, 0x08, 0xf0, 0x40, 0x48, 0xb6, 0x4a, 0xb9,
+  0x81, 0xb6, 0x4a, 0xb9, 0x85, 0xb4, 0x4a, 0xb9, 0xa4, 0xf4, 0x4a, 0xb3,
+  0x4b, 0x4a, 0x2f, 0x34, 0xfb, 0xa4, 0x48, 0x2f, 0x54, 0xfb, 0xa4, 0x48,
+  0x1c, 0xf9, 0xa4, 0x4a, 0x4e, 0x85, 0x4f, 0xa2, 0x64, 0x11, 0x4f, 0xa2,
+  0xe4, 0x19, 0xe2, 0xa2, 0xec, 0x5d, 0xc2, 0xca, 0xde, 0x24, 0x2d, 0xca,
+  0x1f, 0x49, 0xc2, 0xc2, 0x1f, 0x49, 0xd2, 0x28, 0xf8, 0x91, 0x24, 0x8b,
+  0x84, 0x1f, 0x49, 0xb2, 0x4a, 0xf9, 0x81, 0x24, 0xab, 0x94, 0x1f, 0xc8,
+  0xb2, 0x4a, 0xb9, 0xd5, 0x08, 0x11, 0x85, 0x8f, 0x08, 0xf0, 0x49, 0xb9,
+  0xa4, 0xb4, 0x42, 0x79, 0xa4, 0x98, 0x92, 0x4f, 0x8a, 0x84, 0xf9, 0xa4,
+  0x4a, 0x7f, 0x16, 0x0a, 0x24, 0x1d, 0x4c, 0x85, 0xd2, 0x41, 0x56, 0x28,
+  0x1d, 0x24, 0x81, 0x1d, 0x24, 0xa1, 0x15, 0x54, 0x4a, 0x11, 0xad, 0x24,
+  0x51, 0xa9, 0x12, 0x54, 0x12, 0x43, 0x52, 0x1a, 0x22, 0xa5, 0xb5, 0x26,
+  0x54, 0x18, 0x2f, 0x22, 0x45, 0xf5, 0x24, 0xda, 0x85, 0xd1, 0x24, 0x48,
+  0xc1, 0x4a, 0x85, 0xc5, 0x43, 0x54, 0xac, 0x54, 0x49, 0x48, 0x1d, 0x4c,
+  0x25, 0xd2, 0xc1, 0x34, 0x48, 0x17, 0x41, 0xab, 0x14, 0x15, 0xb4, 0x42,
+  0x51, 0x41, 0xad, 0x07, 0x00, 0xf3, 0x05, 0x53, 0x85, 0x29, 0x53, 0x84,
+  0xa9, 0x11, 0xb4, 0x42, 0x51, 0x84, 0x21, 0x65, 0x98, 0x12, 0x4d, 0x1a,
+  0xcc, 0x0b, 0x84, 0x3b, 0x04, 0x02, 0x01, 0x00, 0x41, 0x88, 0x00, 0x00,
+  0x40, 0x3f, 0x04, 0x30, 0x00, 0x00, 0x44, 0x5f, 0x04, 0x60, 0x00, 0x50,
+  0x12, 0x42, 0x6f, 0xb2, 0x0a, 0x01, 0xf0, 0xd7, 0x83, 0x82, 0x24, 0xa1,
+  0x48, 0xa0, 0x48, 0x84, 0x8b, 0x48, 0x80, 0x84, 0xba, 0x82, 0xa4, 0x28,
+  0xb6, 0x02, 0x8a, 0xa1, 0x24, 0x22, 0x28, 0x42, 0x42, 0x46, 0x04, 0x4a,
+  0x9a, 0x22, 0x88, 0xa0, 0x84, 0xa0, 0xd2, 0x80, 0x88, 0x92, 0x9a, 0x90,
+  0x88, 0x80, 0x29, 0x08, 0x8a, 0x05, 0x8a, 0x84, 0x64, 0x8c, 0x98, 0x8a,
+  0x21, 0xa2, 0x48, 0x20, 0x0c, 0x82, 0xff, 0x65, 0x0f, 0x22, 0x8a, 0x02,
+  0x28, 0x26, 0x02, 0x25, 0x22, 0x81, 0x42, 0x22, 0x12, 0x02, 0x00, 0x82,
+  0x40, 0x22, 0xc4, 0x41, 0x40, 0x08, 0x42, 0x21, 0x00, 0x18, 0x48, 0x41,
+  0x80, 0x12, 0xc2, 0x22, 0x00, 0x20, 0x01, 0x41, 0x42, 0x12, 0x20, 0xa4,
+  0x14, 0x2a, 0x01, 0x18, 0x00, 0x20, 0x02, 0x18, 0x20, 0x46, 0xc1, 0x61,
+  0x48, 0x3f, 0x48, 0x07, 0xa0, 0x24, 0x80, 0x22, 0x42, 0x02, 0x23, 0xa1,
+  0x21, 0x88, 0x41, 0x21, 0x83, 0x42, 0x08, 0x88, 0xa2, 0x46, 0x22, 0x2a,
+  0x54, 0x22, 0x16, 0x28, 0xa4, 0x43, 0x20, 0x88, 0x24, 0x85, 0xa4, 0x68,
+  0x21, 0x1b, 0x28, 0x21, 0x8e, 0x42, 0x81, 0x1a, 0x26, 0x24, 0x28, 0x32,
+  0x18, 0x42, 0x89, 0x01, 0x52, 0xc8, 0x49, 0xa1, 0x84, 0x32, 0x88, 0x48,
+  0x8b, 0x84, 0xaa, 0xa1, 0x81, 0x38, 0x4a, 0xc8, 0x22, 0xc8, 0x66, 0xa1,
+  0xc1, 0xff, 0x11, 0x0d, 0x22, 0x00, 0x40, 0x02, 0x83, 0x82, 0x04, 0x48,
+  0x23, 0xa2, 0x48, 0xa0, 0x48, 0x80, 0x44, 0x22, 0x28, 0x34, 0xb1, 0x20,
+  0x88, 0x42, 0x82, 0x82, 0x04, 0x41, 0x10, 0x84, 0x02, 0x20, 0x02, 0x88,
+  0x80, 0x01, 0x69, 0x08, 0x88, 0x80, 0x28, 0x21, 0x22, 0x01, 0x79, 0x09,
+  0xf0, 0x14, 0x42, 0x11, 0x00, 0x8f, 0x9b, 0x09, 0x00, 0x00, 0x2a, 0x81,
+  0x02, 0x68, 0x18, 0x1a, 0x04, 0x48, 0x00, 0x42, 0x80, 0xa2, 0x41, 0x20,
+  0x01, 0x84, 0x42, 0x82, 0x81, 0x00, 0x84, 0x42, 0x18, 0x80, 0x51, 0x48,
+  0x29, 0x11, 0x01, 0x60, 0x2a, 0x28, 0x28, 0x02, 0x42, 0x82, 0x0f, 0x06,
+  0xf0, 0xc4, 0x82, 0xa8, 0x82, 0x00, 0x5f, 0x11, 0x0e, 0x28, 0x12, 0x1a,
+  0x82, 0x01, 0x4c, 0x34, 0x38, 0x18, 0x22, 0x82, 0x88, 0xaa, 0x21, 0xa4,
+  0x18, 0x18, 0x8b, 0x94, 0x80, 0x28, 0x29, 0x3c, 0x32, 0x88, 0x60, 0x82,
+  0x42, 0x26, 0x22, 0x26, 0x21, 0x22, 0x94, 0x48, 0xa8, 0x48, 0x72, 0x68,
+  0xa2, 0xa0, 0x21, 0x11, 0x2b, 0x29, 0xc0, 0x14, 0x42, 0x86, 0x98, 0xd8,
+  0x22, 0x42, 0x80, 0x88, 0x88, 0x28, 0x82, 0x0c, 0x4b, 0x41, 0x90, 0x28,
+  0x2a, 0x84, 0xf2, 0xea, 0x73, 0x80, 0x82, 0x21, 0x03, 0x12, 0x48, 0x16,
+  0xa8, 0x14, 0x1a, 0xa2, 0x14, 0x82, 0x58, 0x48, 0x98, 0x42, 0x89, 0x81,
+  0xa2, 0x14, 0x92, 0xca, 0x01, 0x20, 0xa4, 0x82, 0x48, 0x30, 0x22, 0x80,
+  0xa2, 0x41, 0x84, 0x1a, 0x62, 0x44, 0x92, 0x48, 0xa2, 0xa0, 0x21, 0x30,
+  0x92, 0xe0, 0x48, 0x83, 0xb8, 0x88, 0xe2, 0x81, 0x8c, 0x84, 0x08, 0x88,
+  0x88, 0x88, 0x80, 0x28, 0xa2, 0x84, 0x2a, 0x88, 0x28, 0x02, 0xff, 0xa9,
+  0x03, 0x00, 0x80, 0x21, 0xc2, 0x24, 0x22, 0x28, 0x20, 0x08, 0xa2, 0x00,
+  0x12, 0xc8, 0x20, 0x08, 0x30, 0x32, 0x83, 0x08, 0x81, 0x81, 0x28, 0x42,
+  0x8c, 0x81, 0x04, 0x42, 0x82, 0xa4, 0x62, 0x22, 0x00, 0x10, 0x21, 0x02,
+  0x20, 0x04, 0x20, 0x22, 0x04, 0x00, 0x80, 0x22, 0x04, 0x4c, 0x01, 0x89,
+  0x82, 0x84, 0xf2, 0x66, 0x7f, 0x00, 0x32, 0x81, 0x24, 0x28, 0x8c, 0x04,
+  0x80, 0x22, 0x01, 0x22, 0xaa, 0x41, 0x08, 0x28, 0x84, 0xf0, 0x0f, 0x10,
+  0x81, 0x02, 0x03, 0xf0, 0xda, 0x20, 0x2d, 0x14, 0xe8, 0x41, 0x24, 0xb4,
+  0x18, 0x18, 0x8a, 0x24, 0x48, 0x04, 0x4e, 0x88, 0x40, 0x08, 0x12, 0x81,
+  0x80, 0x01, 0x22, 0xc1, 0x30, 0x84, 0x00, 0x43, 0xf9, 0x81, 0x36, 0x80,
+  0x04, 0x22, 0x20, 0x04, 0x00, 0x12, 0x22, 0x18, 0x60, 0x82, 0x42, 0x16,
+  0x08, 0x48, 0x18, 0x10, 0xc8, 0x2a, 0x42, 0x42, 0x28, 0x48, 0x20, 0xa1,
+  0x42, 0x82, 0x28, 0x80, 0x04, 0x83, 0x92, 0x28, 0x20, 0x84, 0x02, 0x41,
+  0x18, 0x48, 0x18, 0x00, 0x88, 0x4c, 0x22, 0x0a, 0x19, 0x21, 0xa6, 0xc2,
+  0x42, 0x88, 0x82, 0x10, 0x01, 0x12, 0xef, 0x18, 0x0e, 0x00, 0x80, 0x03,
+  0x80, 0x02, 0x42, 0x00, 0x84, 0x10, 0x01, 0x88, 0x82, 0x81, 0x2a, 0x14,
+  0x84, 0x08, 0x00, 0xa8, 0x42, 0x30, 0x14, 0x48, 0x00, 0x22, 0x89, 0x02,
+  0x80, 0x08, 0x80, 0x81, 0x02, 0x00, 0x60, 0x84, 0x10, 0x08, 0x48, 0x48,
+  0x00, 0x18, 0x48, 0x4a, 0x82, 0x44, 0x01, 0xe0, 0x28, 0x09, 0x48, 0x80,
+  0x82, 0x21, 0x14, 0x88, 0x02, 0x78, 0x2a, 0x01, 0x81, 0x84, 0x94, 0x83,
+  0x01, 0x8c, 0x84, 0x81, 0x51, 0x48, 0x00, 0x58, 0x28, 0x28, 0x83, 0x24,
+  0xb1, 0x54, 0x22, 0x88, 0x02, 0x42, 0xe2, 0x8b, 0x42, 0xe0, 0x49, 0x04,
+  0x87, 0x2b, 0x8c, 0x91, 0x24, 0x98, 0x48, 0x18, 0x86, 0x38, 0x48, 0x82,
+  0x89, 0x22, 0x81, 0x24, 0xa1, 0x16, 0x4a, 0x88, 0x82, 0x84, 0x12, 0x04,
+  0x10, 0xf4, 0xc2, 0xe6, 0x00, 0x1a, 0x12, 0x88, 0x32, 0x22, 0x48, 0x00,
+  0x00, 0x18, 0x28, 0x98, 0x48, 0x20, 0x8a, 0x48, 0xa8, 0x24, 0x90, 0xa8,
+  0x48, 0x40, 0xa8, 0x84, 0x00, 0x20, 0x04, 0x20, 0x32, 0x18, 0xc4, 0x09,
+  0xf0, 0x06, 0x04, 0x41, 0x20, 0x04, 0x81, 0x80, 0x48, 0x68, 0x14, 0x80,
+  0xa2, 0x41, 0x8d, 0x84, 0x8a, 0xa4, 0x84, 0x00, 0x82, 0x97, 0x7a, 0x31,
+  0x09, 0xf0, 0x46, 0x12, 0x22, 0x80, 0x88, 0xa2, 0x29, 0x00, 0x80, 0x01,
+  0x00, 0x4a, 0x09, 0x40, 0xa2, 0x48, 0x10, 0x88, 0x84, 0x04, 0x83, 0x84,
+  0x04, 0x20, 0x02, 0x10, 0xa8, 0x21, 0xc0, 0x88, 0x22, 0x58, 0x42, 0xa6,
+  0x28, 0x48, 0x88, 0x48, 0x28, 0x08, 0x40, 0x08, 0x42, 0x00, 0x88, 0x00,
+  0x5f, 0x44, 0x0a, 0x28, 0x81, 0x28, 0x82, 0x2c, 0x02, 0x28, 0x40, 0x82,
+  0x01, 0x42, 0x24, 0x00, 0x4a, 0x08, 0x00, 0x22, 0x80, 0x21, 0x04, 0x00,
+  0x00, 0x10, 0x04, 0xae, 0x48, 0x50, 0x84, 0x20, 0x03, 0x43, 0x28, 0x24,
+  0x02, 0x00, 0x20, 0x84, 0x5f, 0x03, 0xf0, 0x01, 0x80, 0x84, 0x04, 0x80,
+  0xf8, 0xea, 0x19, 0x00, 0x22, 0x18, 0x28, 0x12, 0x68, 0x00, 0x20, 0x14,
+  0x8e, 0x04, 0x10, 0xc8, 0x00, 0x0c, 0xf0, 0x04, 0x80, 0x24, 0x01, 0x12,
+  0x81, 0x20, 0x06, 0x00, 0x28, 0x8a, 0x01, 0x88, 0xc0, 0x18, 0x20, 0x04,
+  0x80, 0x02, 0x88, 0x79, 0x08, 0x72, 0x48, 0x20, 0xf8, 0x9b, 0x4c, 0x90,
+  0x22, 0x3b, 0x09, 0x20, 0x24, 0x22, 0x60, 0x0a, 0xf0, 0x22, 0x40, 0x08,
+  0x00, 0x21, 0x00, 0x42, 0x82, 0x10, 0x02, 0x68, 0x30, 0x92, 0x84, 0x20,
+  0x24, 0x01, 0x82, 0x00, 0x20, 0x04, 0x2a, 0x01, 0x44, 0x00, 0x00, 0x60,
+  0x44, 0x00, 0x12, 0xab, 0xf3, 0xa0, 0x18, 0x20, 0x02, 0x81, 0x00, 0x1a,
+  0x04, 0x00, 0x12, 0x20, 0x18, 0x08, 0x00, 0xa0, 0x84, 0xb0, 0x88, 0x73,
+  0x0c, 0xf2, 0x4e, 0x10, 0x08, 0x8b, 0x12, 0x30, 0x18, 0x80, 0x04, 0x00,
+  0x28, 0x81, 0x00, 0x82, 0xc2, 0x12, 0x81, 0x10, 0x08, 0x80, 0x12, 0x08,
+  0x20, 0x03, 0x22, 0xf0, 0xdf, 0x41, 0x00, 0x81, 0x80, 0x92, 0x22, 0x20,
+  0x01, 0x80, 0x29, 0x22, 0x08, 0x12, 0x28, 0x98, 0x80, 0x01, 0x12, 0x83,
+  0x22, 0x02, 0x10, 0x08, 0x00, 0x00, 0x48, 0xc2, 0x80, 0x4c, 0xc8, 0x28,
+  0x48, 0x2a, 0x04, 0x21, 0xa0, 0x24, 0x20, 0x02, 0x80, 0x48, 0x04, 0x1a,
+  0x24, 0x28, 0xa1, 0x84, 0xa0, 0x84, 0xa0, 0x48, 0x00, 0xd7, 0xdf, 0x00,
+  0x24, 0x00, 0x00, 0x28, 0x21, 0x00, 0x10, 0x02, 0x40, 0x02, 0x24, 0x40,
+  0xd9, 0x0f, 0xd2, 0x40, 0x04, 0x00, 0x44, 0x24, 0x00, 0x41, 0x10, 0x84,
+  0x04, 0x41, 0xe0, 0x42, 0x64, 0x04, 0xf0, 0x01, 0xf0, 0xf2, 0x96, 0x20,
+  0x81, 0x02, 0x80, 0x01, 0x80, 0x03, 0x2a, 0x04, 0x10, 0xa8, 0x94, 0x28,
+  0x97, 0x00, 0x10, 0x4a, 0x65, 0x02, 0x50, 0x04, 0x84, 0x18, 0x80, 0x09,
+  0x90, 0x0a, 0xf0, 0xff, 0x42, 0x88, 0x20, 0x01, 0x48, 0x84, 0x40, 0x28,
+  0x02, 0x48, 0x82, 0x18, 0x88, 0x28, 0xa0, 0x21, 0xd0, 0x25, 0x07, 0x84,
+  0x90, 0x48, 0x00, 0x4a, 0x02, 0x42, 0x81, 0x00, 0x4c, 0x02, 0x28, 0x00,
+  0x80, 0x08, 0x22, 0x26, 0x08, 0x21, 0x48, 0x18, 0x84, 0x88, 0xa3, 0x45,
+  0xb8, 0x92, 0x04, 0xc0, 0x49, 0x21, 0x40, 0x08, 0x48, 0x30, 0x58, 0x80,
+  0x02, 0x83, 0x04, 0x81, 0x46, 0x14, 0x88, 0x02, 0x88, 0x26, 0x24, 0xe4,
+  0x42, 0x04, 0x00, 0x25, 0x04, 0x1f, 0xc4, 0x43, 0xa2, 0x21, 0x8f, 0xa8,
+  0x82, 0x01, 0x1e, 0x32, 0x60, 0x81, 0x2a, 0x04, 0x9a, 0xc3, 0x28, 0x32,
+  0x00, 0xb0, 0x42, 0x44, 0xa8, 0x49, 0x80, 0x03, 0x48, 0x42, 0x48, 0x8c,
+  0x08, 0x42, 0x12, 0xf0, 0xc4, 0x58, 0x84, 0x83, 0x2b, 0xb4, 0xf2, 0x44,
+  0xa2, 0x41, 0x85, 0xaa, 0x98, 0x48, 0x4c, 0x18, 0x88, 0x08, 0xca, 0x07,
+  0x90, 0xc8, 0x4b, 0x21, 0x8b, 0x88, 0x4a, 0x01, 0x18, 0x89, 0xa4, 0x22,
+  0x00, 0xca, 0xe8, 0x42, 0x81, 0xf8, 0xd9, 0x8d, 0x80, 0x01, 0x28, 0x2a,
+  0x12, 0x88, 0x02, 0x23, 0x45, 0x22, 0x24, 0x82, 0x8f, 0xa2, 0x5c, 0x83,
+  0x82, 0x09, 0x23, 0x04, 0xf2, 0x22, 0x8f, 0x81, 0x88, 0x24, 0x08, 0x81,
+  0x60, 0x84, 0x42, 0xa1, 0x46, 0xc2, 0x8c, 0x2a, 0xd4, 0x84, 0x11, 0xa8,
+  0xa2, 0x42, 0x2a, 0x22, 0xe4, 0x81, 0x61, 0x82, 0xfe, 0x4c, 0x4a, 0x44,
+  0x88, 0xc4, 0x18, 0xa6, 0x48, 0x48, 0x08, 0x8a, 0x68, 0x82, 0xca, 0xe8,
+  0x44, 0x24, 0xb4, 0x24, 0x85, 0x84, 0x82, 0xf1, 0x57, 0xff, 0x20, 0x22,
+  0x32, 0x38, 0x24, 0x22, 0x6a, 0xa4, 0x32, 0x38, 0x81, 0xc8, 0x30, 0xc2,
+  0x85, 0xa2, 0x81, 0x28, 0x92, 0x80, 0x09, 0x29, 0xdc, 0x88, 0xa2, 0x1a,
+  0x30, 0x42, 0x24, 0x84, 0x48, 0x29, 0x95, 0x48, 0x1a, 0x98, 0x48, 0x4a,
+  0x17, 0x98, 0xa8, 0xe0, 0x48, 0x21, 0x32, 0x14, 0x24, 0x8b, 0x2e, 0x80,
+  0x03, 0x8b, 0x82, 0xce, 0x84, 0x8b, 0x46, 0x4a, 0x12, 0x08, 0x49, 0x02,
+  0x4e, 0x24, 0x80, 0xa1, 0xc8, 0x4a, 0x02, 0x20, 0xf8, 0x6a, 0x3d, 0x24,
+  0x12, 0x26, 0x22, 0x61, 0x22, 0x12, 0x23, 0x26, 0xb1, 0x62, 0x01, 0x2b,
+  0x94, 0xb0, 0x62, 0x09, 0x2b, 0x94, 0xb0, 0x42, 0x09, 0x2b, 0x94, 0x90,
+  0xb2, 0x80, 0x09, 0x4a, 0x48, 0x02, 0x24, 0x12, 0x24, 0xd6, 0x44, 0xe2,
+  0x49, 0x42, 0xe2, 0x4d, 0x42, 0x06, 0x00, 0xf7, 0xff, 0xff, 0x21, 0x49,
   0x02, 0x9e, 0x24, 0xe0, 0x48, 0x02, 0x8e, 0x64, 0x88, 0x68, 0x88, 0x80,
   0x18, 0x84, 0x38, 0x24, 0x88, 0x53, 0x82, 0x38, 0x24, 0x4a, 0x38, 0x24,
   0x88, 0x3f, 0x7e, 0x0a, 0x5e, 0x52, 0x2f, 0x23, 0xf1, 0x1a, 0x1a, 0x2b,
@@ -1636,34 +1325,32 @@ const unsigned char USB_1208HS_rbf[] = {
   0xf8, 0xb8, 0x4f, 0x48, 0xfc, 0x78, 0x5c, 0x8f, 0x8e, 0xfa, 0x8c, 0x28,
   0x8b, 0x88, 0x4f, 0x4d, 0xb5, 0x84, 0xf8, 0xf8, 0x7c, 0x8f, 0x88, 0xbe,
   0x74, 0xf7, 0x84, 0x84, 0xba, 0xb7, 0xc2, 0xfe, 0x34, 0x32, 0x4f, 0x48,
-  0xda, 0x5d, 0x0d, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x04, 0x48, 0x00, 0x40, 0x08, 0x00, 0x84, 0x80, 0x04, 0x00,
-  0xf0, 0x65, 0x2b, 0x20, 0x0a, 0x00, 0x22, 0x20, 0x02, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x90, 0x28, 0x00, 0x8a, 0x04, 0x84, 0x42, 0x00, 0x84,
-  0x83, 0x04, 0x81, 0x00, 0x00, 0x00, 0x40, 0x08, 0x10, 0x08, 0x83, 0x84,
-  0x12, 0x08, 0x00, 0x80, 0x04, 0x00, 0x48, 0x00, 0x2f, 0xa8, 0x0d, 0x2e,
-  0x42, 0x1f, 0x41, 0x72, 0x28, 0xf2, 0x11, 0x24, 0x83, 0xf6, 0x11, 0x24,
-  0xa3, 0xd6, 0xc1, 0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x6a, 0xd9, 0x81, 0xb2,
-  0x4a, 0x19, 0xb5, 0x4a, 0x39, 0x24, 0xaf, 0x14, 0x79, 0x24, 0xf8, 0x42,
-  0x91, 0x47, 0x82, 0x2d, 0xb1, 0x4f, 0x82, 0xe4, 0x14, 0xf9, 0x24, 0x4a,
-  0x1c, 0xf8, 0x24, 0x4a, 0x16, 0xf1, 0x24, 0x4a, 0xd6, 0xe1, 0xa2, 0x64,
-  0x59, 0x2e, 0x4a, 0xde, 0x24, 0xac, 0xf4, 0x91, 0x24, 0x2e, 0x42, 0x1f,
-  0x49, 0x52, 0x28, 0x1f, 0x49, 0x32, 0x68, 0x1f, 0x49, 0x32, 0x4a, 0x1f,
-  0x48, 0xb2, 0x4a, 0xd1, 0x41, 0xb6, 0x6a, 0xb9, 0x11, 0xb6, 0x4a, 0x19,
-  0xb5, 0x4a, 0x39, 0x24, 0xab, 0x94, 0x43, 0xb2, 0x42, 0x79, 0x24, 0xb8,
-  0x42, 0xf9, 0x24, 0x48, 0x98, 0x4f, 0xa2, 0xe4, 0xf9, 0x06, 0x48, 0x1f,
-  0xc1, 0x84, 0xf4, 0x11, 0x24, 0x42, 0x1f, 0x41, 0x32, 0x48, 0x15, 0xb4,
-  0x48, 0xd1, 0x41, 0xf2, 0x48, 0x94, 0x1d, 0x24, 0x8b, 0xb4, 0x51, 0x8b,
-  0xb4, 0x43, 0xe2, 0x14, 0x39, 0x24, 0x4e, 0x91, 0x47, 0x82, 0x1c, 0x79,
-  0x26, 0xc8, 0x91, 0x6f, 0x82, 0xc1, 0x91, 0x4f, 0x82, 0xec, 0x11, 0xb8,
-  0x24, 0x64, 0x19, 0x26, 0x68, 0x19, 0x9c, 0x64, 0x19, 0x84, 0x1f, 0x89,
-  0x82, 0xf4, 0x91, 0x48, 0x81, 0x1b, 0x69, 0x81, 0x13, 0x39, 0x4a, 0x1b,
-  0x28, 0xa1, 0x19, 0xf2, 0x4a, 0x84, 0x11, 0xaf, 0x44, 0x1a, 0x91, 0xaa,
-  0x22, 0xab, 0x94, 0x22, 0x2b, 0x84, 0x26, 0x98, 0x92, 0x27, 0x82, 0x29,
-  0xe9, 0xa2, 0xe5, 0xcd, 0x0a, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40,
-  0x01, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x12, 0x00,
+  0xda, 0x5d, 0x0d, 0x00, 0x22, 0x0d, 0x08, 0x00, 0xfe, 0x08, 0x00, 0x34,
+  0x0d, 0x40, 0x00, 0x80, 0x04, 0x48, 0x67, 0x04, 0x00, 0x2b, 0x08, 0x90,
+  0xf0, 0x65, 0x2b, 0x20, 0x0a, 0x00, 0x22, 0x20, 0x02, 0xf5, 0x0e, 0xd2,
+  0x00, 0x00, 0x90, 0x28, 0x00, 0x8a, 0x04, 0x84, 0x42, 0x00, 0x84, 0x83,
+  0x04, 0x5d, 0x09, 0xf0, 0x56, 0x10, 0x08, 0x83, 0x84, 0x12, 0x08, 0x00,
+  0x80, 0x04, 0x00, 0x48, 0x00, 0x2f, 0xa8, 0x0d, 0x2e, 0x42, 0x1f, 0x41,
+  0x72, 0x28, 0xf2, 0x11, 0x24, 0x83, 0xf6, 0x11, 0x24, 0xa3, 0xd6, 0xc1,
+  0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x6a, 0xd9, 0x81, 0xb2, 0x4a, 0x19, 0xb5,
+  0x4a, 0x39, 0x24, 0xaf, 0x14, 0x79, 0x24, 0xf8, 0x42, 0x91, 0x47, 0x82,
+  0x2d, 0xb1, 0x4f, 0x82, 0xe4, 0x14, 0xf9, 0x24, 0x4a, 0x1c, 0xf8, 0x24,
+  0x4a, 0x16, 0xf1, 0x24, 0x4a, 0xd6, 0xe1, 0xa2, 0x64, 0x59, 0x2e, 0x4a,
+  0xde, 0x24, 0xac, 0xf4, 0x91, 0x24, 0x2e, 0x42, 0x1f, 0x49, 0x52, 0x28,
+  0x1f, 0x49, 0x32, 0x68, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0x46, 0x00,
+  0x52, 0xb6, 0x6a, 0xb9, 0x11, 0xb6, 0x46, 0x00, 0xf0, 0x6a, 0xab, 0x94,
+  0x43, 0xb2, 0x42, 0x79, 0x24, 0xb8, 0x42, 0xf9, 0x24, 0x48, 0x98, 0x4f,
+  0xa2, 0xe4, 0xf9, 0x06, 0x48, 0x1f, 0xc1, 0x84, 0xf4, 0x11, 0x24, 0x42,
+  0x1f, 0x41, 0x32, 0x48, 0x15, 0xb4, 0x48, 0xd1, 0x41, 0xf2, 0x48, 0x94,
+  0x1d, 0x24, 0x8b, 0xb4, 0x51, 0x8b, 0xb4, 0x43, 0xe2, 0x14, 0x39, 0x24,
+  0x4e, 0x91, 0x47, 0x82, 0x1c, 0x79, 0x26, 0xc8, 0x91, 0x6f, 0x82, 0xc1,
+  0x91, 0x4f, 0x82, 0xec, 0x11, 0xb8, 0x24, 0x64, 0x19, 0x26, 0x68, 0x19,
+  0x9c, 0x64, 0x19, 0x84, 0x1f, 0x89, 0x82, 0xf4, 0x91, 0x48, 0x81, 0x1b,
+  0x69, 0x81, 0x13, 0x39, 0x4a, 0x1b, 0x28, 0xa1, 0x19, 0xf2, 0x4a, 0x84,
+  0x11, 0xaf, 0x44, 0x1a, 0x91, 0xaa, 0x22, 0xab, 0x94, 0x22, 0x2b, 0x84,
+  0x26, 0x98, 0x92, 0x27, 0x82, 0x29, 0xe9, 0xa2, 0xe5, 0xcd, 0x0a, 0x4f,
+  0x0f, 0x31, 0x00, 0x00, 0x44, 0x2c, 0x01, 0x31, 0x21, 0x80, 0x01, 0x3d,
+  0x09, 0x02, 0x61, 0x0e, 0xf0, 0xff, 0x0e, 0x40, 0x04, 0x00, 0x12, 0x00,
   0x00, 0x00, 0x25, 0x01, 0xd7, 0xb8, 0x00, 0x20, 0x01, 0x21, 0x84, 0x28,
   0x22, 0x40, 0xc8, 0x68, 0x84, 0x48, 0x46, 0x08, 0x80, 0x91, 0x18, 0xc8,
   0x3a, 0xa4, 0x61, 0x84, 0x4c, 0x89, 0x84, 0x14, 0x28, 0xa1, 0x41, 0x00,
@@ -1687,10 +1374,10 @@ const unsigned char USB_1208HS_rbf[] = {
   0x48, 0x20, 0x01, 0x80, 0x09, 0x84, 0x42, 0x84, 0x00, 0x20, 0x22, 0x08,
   0x00, 0x16, 0x28, 0x82, 0x32, 0x48, 0x1a, 0x06, 0x1a, 0x84, 0x08, 0x44,
   0x1a, 0x14, 0x08, 0x10, 0x01, 0x22, 0x77, 0x77, 0x00, 0x00, 0x70, 0x26,
-  0x02, 0x18, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x16, 0x08, 0x40, 0xa4, 0x48,
+  0x02, 0x18, 0x1a, 0x0c, 0x06, 0xf0, 0x12, 0x16, 0x08, 0x40, 0xa4, 0x48,
   0x81, 0x82, 0x4a, 0x22, 0x68, 0x44, 0x48, 0x28, 0x00, 0x10, 0x98, 0x44,
   0x28, 0x00, 0x00, 0x81, 0x30, 0x22, 0x20, 0x22, 0x01, 0x10, 0x88, 0x02,
-  0x82, 0x00, 0xa0, 0x41, 0x80, 0x04, 0x00, 0xf0, 0x1e, 0xb1, 0x90, 0x32,
+  0x82, 0x00, 0xa0, 0x41, 0x6b, 0x02, 0xf0, 0xb6, 0x1e, 0xb1, 0x90, 0x32,
   0x18, 0xaa, 0x11, 0x8c, 0x71, 0x28, 0xe2, 0x42, 0x28, 0x22, 0xf3, 0xc6,
   0x18, 0x52, 0x9a, 0x84, 0x98, 0x9a, 0x80, 0xac, 0x82, 0xd2, 0x26, 0xa2,
   0x12, 0xaa, 0x25, 0x81, 0x11, 0x24, 0x08, 0x25, 0x22, 0xe1, 0x24, 0xa2,
@@ -1707,7 +1394,7 @@ const unsigned char USB_1208HS_rbf[] = {
   0x30, 0x48, 0x2a, 0x28, 0x1d, 0x94, 0x92, 0x12, 0x82, 0x4a, 0x02, 0x00,
   0x28, 0x12, 0x42, 0x80, 0x22, 0xb8, 0x18, 0x28, 0x87, 0x02, 0x00, 0x30,
   0x24, 0x48, 0x1a, 0x82, 0x25, 0x64, 0x86, 0x46, 0x28, 0x03, 0x00, 0x00,
-  0x42, 0x00, 0x28, 0x8a, 0x01, 0xf0, 0xff, 0xee, 0x80, 0x04, 0x85, 0x94,
+  0x42, 0xc2, 0x07, 0xf0, 0xa8, 0xf0, 0xff, 0xee, 0x80, 0x04, 0x85, 0x94,
   0x28, 0x44, 0x12, 0x40, 0x22, 0x02, 0x18, 0x68, 0x8a, 0x11, 0x08, 0x1a,
   0x22, 0x8a, 0x81, 0x9a, 0x44, 0x22, 0x21, 0x30, 0x18, 0x4c, 0x8e, 0x24,
   0x01, 0x16, 0x18, 0x28, 0x51, 0x28, 0x90, 0x22, 0x89, 0xa1, 0x84, 0x60,
@@ -1722,7 +1409,7 @@ const unsigned char USB_1208HS_rbf[] = {
   0x00, 0x2a, 0x08, 0x49, 0x94, 0x36, 0x4a, 0x01, 0x88, 0x00, 0x29, 0x04,
   0x48, 0x84, 0x84, 0x58, 0x22, 0x8e, 0x18, 0x41, 0x4c, 0x85, 0x0c, 0x80,
   0xa4, 0x42, 0x21, 0x12, 0x21, 0x42, 0x00, 0x22, 0x14, 0x00, 0x29, 0x11,
-  0x14, 0x28, 0x18, 0x04, 0x4a, 0x81, 0x21, 0x03, 0x80, 0x21, 0x04, 0x00,
+  0x14, 0x28, 0x18, 0x04, 0x4a, 0x81, 0x21, 0x03, 0xb5, 0x08, 0xf0, 0x76,
   0x42, 0x12, 0x8a, 0x04, 0xf0, 0x17, 0xd4, 0xa0, 0x34, 0x38, 0x44, 0x1e,
   0x28, 0x49, 0x83, 0x71, 0x44, 0xf8, 0x26, 0x12, 0x78, 0x2a, 0xa1, 0x84,
   0x83, 0x24, 0x91, 0x48, 0x58, 0x83, 0xcc, 0x28, 0x89, 0xe1, 0x26, 0x69,
@@ -1734,14 +1421,14 @@ const unsigned char USB_1208HS_rbf[] = {
   0x14, 0x0a, 0x42, 0x8c, 0x24, 0x02, 0x81, 0x80, 0x81, 0xc2, 0x82, 0x40,
   0x24, 0x83, 0x08, 0x00, 0x81, 0x41, 0x60, 0x82, 0x00, 0x83, 0xa1, 0x52,
   0x83, 0x84, 0x65, 0x44, 0x84, 0x00, 0x28, 0x48, 0x10, 0x08, 0x62, 0x1e,
-  0x28, 0x00, 0x00, 0x80, 0x04, 0x84, 0x4a, 0x01, 0x4a, 0x22, 0x09, 0x48,
+  0x28, 0x82, 0x04, 0xf0, 0x40, 0x84, 0x4a, 0x01, 0x4a, 0x22, 0x09, 0x48,
   0x44, 0x00, 0x4b, 0x42, 0x1f, 0x52, 0x06, 0x00, 0x00, 0x00, 0x18, 0x12,
   0xa0, 0x14, 0x22, 0x23, 0x08, 0x43, 0x08, 0x98, 0x8c, 0x41, 0x22, 0x31,
   0x44, 0x00, 0x22, 0x8c, 0x28, 0x12, 0x84, 0x06, 0x29, 0x21, 0x08, 0x1a,
   0x18, 0x02, 0x46, 0x04, 0x84, 0x22, 0x24, 0x12, 0x28, 0x32, 0x28, 0xa0,
   0x34, 0x12, 0x82, 0x80, 0x18, 0x18, 0x04, 0x1a, 0x04, 0x86, 0x04, 0x00,
   0x84, 0x7f, 0x6b, 0x08, 0x18, 0x43, 0x81, 0x01, 0x10, 0x84, 0x42, 0x04,
-  0x00, 0x80, 0x01, 0x00, 0x21, 0x00, 0x88, 0x18, 0x88, 0x00, 0x00, 0x50,
+  0xcc, 0x09, 0xf0, 0x94, 0x21, 0x00, 0x88, 0x18, 0x88, 0x00, 0x00, 0x50,
   0x82, 0x48, 0x20, 0x02, 0x12, 0x26, 0x88, 0x93, 0x14, 0x00, 0x44, 0x44,
   0x41, 0x00, 0x82, 0x88, 0x20, 0x86, 0x01, 0x80, 0x08, 0x22, 0x20, 0x04,
   0x80, 0xa4, 0x81, 0xaf, 0xac, 0x08, 0x86, 0x14, 0x12, 0x14, 0x32, 0x24,
@@ -1754,8 +1441,8 @@ const unsigned char USB_1208HS_rbf[] = {
   0x11, 0x06, 0x40, 0x02, 0x84, 0x41, 0x2d, 0x14, 0x00, 0x12, 0x84, 0x68,
   0x41, 0x00, 0x40, 0x02, 0xa0, 0x14, 0x81, 0x18, 0x8b, 0x38, 0x00, 0x44,
   0xa0, 0x24, 0x32, 0x00, 0x00, 0x81, 0x10, 0x44, 0x08, 0xdf, 0xe8, 0x05,
-  0x00, 0x89, 0x43, 0x02, 0x00, 0x80, 0x81, 0x28, 0x22, 0x14, 0xa8, 0x48,
-  0x00, 0x00, 0x00, 0x22, 0x21, 0x28, 0x21, 0x48, 0x24, 0x00, 0x18, 0x2c,
+  0x00, 0x89, 0x43, 0x02, 0x00, 0x80, 0x81, 0x28, 0x22, 0x14, 0xa8, 0x61,
+  0x04, 0xf1, 0x60, 0x22, 0x21, 0x28, 0x21, 0x48, 0x24, 0x00, 0x18, 0x2c,
   0x21, 0x04, 0x22, 0x32, 0x22, 0x1a, 0x48, 0x24, 0x28, 0x82, 0xc2, 0x24,
   0xa2, 0x4a, 0x22, 0x21, 0x05, 0xa2, 0xa0, 0x81, 0x00, 0x00, 0x80, 0x24,
   0x04, 0x41, 0x86, 0xf1, 0x3e, 0x2b, 0x20, 0x62, 0xc1, 0x40, 0x04, 0x44,
@@ -1764,220 +1451,218 @@ const unsigned char USB_1208HS_rbf[] = {
   0x20, 0x01, 0x89, 0x41, 0x68, 0x81, 0x28, 0x00, 0x18, 0x10, 0x04, 0x4c,
   0xe8, 0x42, 0x41, 0x04, 0x28, 0x00, 0x44, 0x28, 0x43, 0x61, 0x8a, 0xc0,
   0x88, 0x00, 0xff, 0x1f, 0x0d, 0x16, 0x08, 0x00, 0x20, 0x09, 0x12, 0x21,
-  0x40, 0xc2, 0x12, 0x00, 0x20, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x80, 0x21, 0x01, 0x00, 0x00, 0x44, 0x00, 0x80, 0x01, 0x00, 0x40,
-  0x24, 0x81, 0x02, 0x00, 0x80, 0x02, 0x84, 0x00, 0xf0, 0x52, 0xff, 0x00,
-  0x82, 0x26, 0x44, 0xc2, 0xa4, 0x10, 0x22, 0x24, 0x02, 0x18, 0x48, 0x18,
-  0x87, 0x64, 0x41, 0x48, 0x22, 0x21, 0x40, 0xbc, 0x24, 0x11, 0x48, 0x02,
-  0x27, 0x24, 0x16, 0x14, 0x04, 0x25, 0x82, 0x81, 0x04, 0x42, 0x00, 0x82,
-  0x60, 0x28, 0x12, 0x8c, 0x28, 0x24, 0x28, 0x81, 0x02, 0x83, 0x22, 0x81,
-  0x22, 0xa4, 0x12, 0x48, 0x41, 0x82, 0x45, 0x08, 0x46, 0x88, 0x58, 0x84,
-  0x81, 0x8f, 0xab, 0x0e, 0x8c, 0x12, 0xc8, 0x42, 0x40, 0x22, 0x44, 0x02,
-  0x80, 0x08, 0x16, 0x04, 0x28, 0x00, 0xb0, 0x48, 0x38, 0x22, 0x12, 0x48,
-  0x90, 0x52, 0x80, 0x01, 0x88, 0x20, 0x42, 0x08, 0x28, 0x14, 0x43, 0x49,
-  0x44, 0x0a, 0x49, 0x44, 0x24, 0x02, 0x20, 0x04, 0x22, 0x40, 0x54, 0x48,
-  0x38, 0x10, 0x04, 0x41, 0x22, 0x00, 0x41, 0x21, 0x28, 0x3e, 0xfd, 0x80,
-  0x63, 0x88, 0x1e, 0x12, 0x20, 0xda, 0x22, 0xe4, 0x23, 0xd2, 0x24, 0xf4,
-  0x22, 0x14, 0x9a, 0x21, 0xf2, 0x52, 0x92, 0x81, 0x86, 0x4c, 0xa4, 0x59,
-  0x45, 0x1a, 0x22, 0xe1, 0xe4, 0x61, 0x42, 0x40, 0x32, 0x18, 0x24, 0x2d,
-  0x16, 0x27, 0x41, 0x16, 0xe2, 0x21, 0x36, 0x82, 0x62, 0x89, 0xb3, 0x42,
-  0x21, 0x32, 0x68, 0x6c, 0x11, 0xe8, 0xea, 0x4a, 0xa2, 0x2b, 0x52, 0x2e,
-  0x18, 0x4a, 0xa4, 0xa8, 0x3e, 0x84, 0x89, 0xa2, 0xdb, 0x2e, 0x14, 0x82,
-  0x1e, 0x18, 0xca, 0x58, 0xc4, 0x44, 0x2e, 0x24, 0x44, 0x8c, 0x14, 0x54,
-  0x18, 0x89, 0xf3, 0x9e, 0x93, 0x60, 0x43, 0xcb, 0x19, 0x4b, 0x22, 0x61,
-  0x45, 0x92, 0x94, 0x44, 0x20, 0xb1, 0x44, 0xdc, 0x22, 0x82, 0x44, 0x88,
-  0x14, 0x44, 0x24, 0xf3, 0xc8, 0x8e, 0x41, 0x9a, 0xb8, 0x54, 0x47, 0x88,
-  0xf5, 0x82, 0x82, 0x2b, 0x22, 0x81, 0x43, 0x14, 0xb8, 0x64, 0xc1, 0x12,
-  0x78, 0x9a, 0xa8, 0x62, 0xc5, 0xb4, 0x14, 0xb2, 0x84, 0x68, 0x81, 0x80,
-  0x52, 0x4c, 0x2a, 0x27, 0x61, 0x41, 0x1e, 0x18, 0xca, 0x23, 0x81, 0x12,
-  0x84, 0x88, 0x82, 0x04, 0x4a, 0x19, 0x88, 0x18, 0x08, 0x8c, 0xa4, 0x82,
-  0x8f, 0x76, 0x08, 0x50, 0x42, 0x85, 0x44, 0xd6, 0x42, 0x62, 0x45, 0x29,
-  0xf1, 0x52, 0x14, 0x28, 0x44, 0x1a, 0x21, 0xb8, 0x12, 0xb1, 0x4c, 0x18,
-  0xf2, 0x44, 0x82, 0x89, 0x93, 0x44, 0x2b, 0x22, 0x49, 0x44, 0xa2, 0x88,
-  0x6a, 0x02, 0x4a, 0x34, 0x14, 0x2e, 0x62, 0x65, 0x14, 0xe2, 0x81, 0x28,
-  0x21, 0x22, 0xa1, 0xb9, 0x2d, 0x54, 0x12, 0x45, 0x14, 0xf4, 0x36, 0x14,
-  0x29, 0x59, 0x44, 0x8a, 0xaa, 0x32, 0x22, 0x48, 0x4b, 0x12, 0x42, 0x83,
-  0xa1, 0x55, 0x22, 0x45, 0x04, 0x4b, 0x6b, 0x4f, 0x81, 0xf1, 0xe8, 0x48,
-  0x42, 0x8f, 0xc8, 0x78, 0x44, 0x64, 0x88, 0xaf, 0x3e, 0x0e, 0x28, 0x18,
-  0x28, 0x80, 0xa2, 0x94, 0x28, 0x42, 0x1a, 0xa2, 0x84, 0x1a, 0xa2, 0x84,
-  0xa0, 0x84, 0xa0, 0x84, 0x36, 0xe8, 0x24, 0x28, 0x82, 0xa8, 0x43, 0x88,
-  0x2a, 0x84, 0xb8, 0x22, 0x04, 0x2a, 0x04, 0x2b, 0x42, 0x82, 0x58, 0x82,
-  0x2a, 0x25, 0xa8, 0x42, 0x82, 0x20, 0x38, 0x22, 0x82, 0x62, 0x82, 0x62,
-  0x92, 0x6a, 0x28, 0xa1, 0x84, 0x12, 0x4a, 0x08, 0x4e, 0x84, 0xe0, 0x44,
-  0x28, 0xa1, 0x84, 0x48, 0x88, 0x48, 0xa8, 0x5b, 0x97, 0xa0, 0x6e, 0x4f,
-  0x42, 0xf2, 0x28, 0x2e, 0x67, 0x42, 0x2f, 0x46, 0xfe, 0x74, 0x74, 0x2b,
-  0x77, 0x4f, 0x66, 0xb7, 0x72, 0xf3, 0xe4, 0xe6, 0x2b, 0xeb, 0xee, 0xe2,
-  0xce, 0xc8, 0x4f, 0x6c, 0xfc, 0xc6, 0xc4, 0x4f, 0x4e, 0xfe, 0xf8, 0x28,
-  0x6f, 0x4e, 0xbe, 0xe2, 0xfe, 0xec, 0xdc, 0x4f, 0x4f, 0xff, 0xe8, 0xc8,
-  0xfa, 0xe7, 0x24, 0xea, 0x26, 0xfe, 0x64, 0x66, 0x4f, 0x67, 0xf7, 0x74,
-  0x36, 0x7e, 0xf2, 0x8f, 0xaf, 0xbb, 0x62, 0xaf, 0xcc, 0xfa, 0xaf, 0x8c,
-  0x3e, 0x84, 0x9e, 0x86, 0x2b, 0x99, 0x8e, 0x82, 0x2f, 0x42, 0xfa, 0x88,
-  0xe8, 0xea, 0xac, 0xea, 0x4f, 0x4e, 0xaf, 0xfd, 0x4f, 0x4e, 0xfe, 0xa8,
-  0xf8, 0xea, 0xff, 0x98, 0xc8, 0xca, 0xac, 0x48, 0xca, 0xbc, 0xc4, 0xac,
-  0xee, 0x4f, 0x8a, 0xf5, 0xe8, 0xe8, 0xce, 0x48, 0xcf, 0xcc, 0xfc, 0xc8,
-  0xcc, 0x8f, 0x8c, 0xfc, 0x38, 0x8e, 0xf0, 0x34, 0x64, 0x4f, 0x45, 0xf7,
-  0x2c, 0x3e, 0x6f, 0x62, 0xf6, 0x66, 0x26, 0x4f, 0x65, 0xf7, 0x76, 0x34,
-  0x6f, 0x45, 0xf7, 0x66, 0x74, 0x4f, 0x6c, 0xff, 0x76, 0xe4, 0x2f, 0x2c,
-  0xff, 0x7a, 0xbc, 0x4f, 0x2c, 0xdc, 0x46, 0xfe, 0xe4, 0xd4, 0x4f, 0x4f,
-  0xfe, 0xec, 0xc4, 0x6f, 0x42, 0xfe, 0xfc, 0xec, 0x4f, 0x47, 0xff, 0xaa,
-  0xe8, 0xfa, 0xef, 0x27, 0xa7, 0x66, 0x4f, 0x68, 0xfe, 0x62, 0x64, 0x4f,
-  0x67, 0xfd, 0xf4, 0xf4, 0x8f, 0xaf, 0xbd, 0xf2, 0xfe, 0x91, 0xc1, 0xea,
-  0xe7, 0x5c, 0xee, 0xce, 0xf8, 0xc4, 0x86, 0x6f, 0x4d, 0xe5, 0x68, 0xea,
-  0x49, 0xfc, 0xfc, 0xf8, 0x4b, 0x7e, 0xea, 0xff, 0xf4, 0x74, 0xea, 0xfb,
-  0xd4, 0xe4, 0x8f, 0xc6, 0xaf, 0xff, 0x8f, 0x87, 0xaf, 0xdd, 0xca, 0xbc,
-  0xc4, 0xbc, 0x44, 0xb8, 0xe4, 0xfe, 0xfc, 0xf8, 0x8f, 0x8e, 0xfe, 0xc8,
-  0xca, 0xef, 0xc8, 0xfc, 0x4c, 0xcc, 0xaf, 0x8b, 0xff, 0x11, 0x98, 0xf0,
-  0x24, 0x74, 0x4f, 0x41, 0xf6, 0x3c, 0x2e, 0x65, 0xf6, 0x66, 0x24, 0x6f,
-  0x45, 0xf7, 0x76, 0x34, 0x4f, 0x45, 0xf6, 0x34, 0x34, 0x4f, 0x6c, 0xfe,
-  0x32, 0xb4, 0x2b, 0xfd, 0x2f, 0x84, 0xfa, 0xcc, 0xc6, 0x6d, 0xc4, 0x4f,
-  0x4e, 0xfc, 0x3c, 0x3c, 0x6f, 0x4e, 0xfc, 0x66, 0xe4, 0xcf, 0xcd, 0xfd,
-  0x64, 0xf4, 0xaf, 0x88, 0xac, 0x77, 0x8e, 0x92, 0xee, 0xe2, 0x4d, 0xe4,
-  0x4f, 0x47, 0xf7, 0x34, 0x16, 0x4f, 0x67, 0xf7, 0xb8, 0xba, 0x2b, 0x76,
-  0x8e, 0xc1, 0xda, 0xb7, 0x84, 0xe8, 0xc7, 0xe3, 0x6c, 0xb8, 0x92, 0xf5,
-  0x84, 0x82, 0x2f, 0x43, 0xf3, 0xac, 0xac, 0xfa, 0xa6, 0xbb, 0x4f, 0x4f,
-  0xa6, 0x9f, 0x4f, 0x4e, 0xdf, 0xc8, 0xa9, 0xfd, 0x8f, 0x81, 0xab, 0xdc,
-  0x1a, 0xe1, 0x4c, 0xbc, 0x44, 0xe8, 0x4f, 0xff, 0x2c, 0x38, 0x8f, 0x8e,
-  0xfe, 0x48, 0x48, 0xef, 0xc8, 0xfc, 0x4c, 0xcc, 0x8f, 0x88, 0xff, 0xc3,
-  0x27, 0xf0, 0xb4, 0x24, 0x4f, 0x41, 0xf5, 0x2c, 0x3e, 0x67, 0x66, 0x6f,
-  0x4a, 0xf2, 0xc6, 0x54, 0x6f, 0x63, 0xf3, 0x56, 0x56, 0x6f, 0x47, 0xf2,
-  0xc4, 0xd6, 0x2f, 0x43, 0xb7, 0xc2, 0xfd, 0x1e, 0x38, 0xcf, 0x6c, 0x7c,
-  0x26, 0xf4, 0xc4, 0xd4, 0xcf, 0xef, 0xf3, 0xcc, 0xc6, 0x6f, 0x42, 0xf6,
-  0xfc, 0xdc, 0x4b, 0x67, 0x8f, 0x8a, 0xa8, 0x7f, 0x4e, 0xa2, 0x2b, 0xe6,
-  0x6d, 0x86, 0x6f, 0x66, 0xf6, 0xd6, 0x16, 0x6f, 0x46, 0xff, 0xfa, 0x9a,
-  0x2b, 0xf7, 0xbe, 0xb1, 0x4a, 0xf7, 0xd5, 0xb4, 0x7e, 0xf4, 0xde, 0xd6,
-  0x2b, 0x51, 0x4f, 0x68, 0xea, 0x67, 0xfa, 0x9e, 0xfc, 0x4b, 0x47, 0xba,
-  0xff, 0x74, 0x54, 0xba, 0xfa, 0xf4, 0xd4, 0x8f, 0x82, 0xa7, 0xfc, 0x8f,
-  0x81, 0xa4, 0xdc, 0x9a, 0xf5, 0xc4, 0xc4, 0x41, 0x4f, 0x4e, 0xfe, 0xbc,
-  0x78, 0x8f, 0x8e, 0xfe, 0xc8, 0x48, 0xef, 0xc8, 0xf8, 0x4c, 0x4e, 0xae,
-  0xa8, 0x7f, 0xff, 0x08, 0x00, 0x00, 0x21, 0x80, 0x01, 0x20, 0x01, 0x00,
-  0x84, 0x44, 0x12, 0x40, 0x08, 0x40, 0x04, 0x00, 0x10, 0x42, 0x04, 0x10,
-  0x02, 0x00, 0x2a, 0x01, 0x18, 0x00, 0x90, 0x12, 0x20, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x44, 0x40, 0x04, 0x00, 0x85, 0x04, 0xaf, 0x1a, 0x0a, 0x40,
-  0xc4, 0x12, 0x44, 0x40, 0x14, 0x24, 0x11, 0x04, 0x20, 0x01, 0x00, 0x40,
-  0x06, 0x44, 0x12, 0x00, 0x20, 0x08, 0x00, 0x18, 0x16, 0x04, 0x12, 0x80,
-  0x02, 0x42, 0x41, 0x00, 0x28, 0x22, 0x16, 0x04, 0x80, 0x81, 0xa2, 0x12,
-  0x80, 0x01, 0x18, 0x00, 0x12, 0x28, 0x84, 0x81, 0x40, 0x64, 0x12, 0x4f,
-  0x71, 0x0e, 0x2c, 0xf5, 0x11, 0x24, 0xad, 0x12, 0x1f, 0x41, 0x32, 0x48,
-  0x1f, 0x41, 0xb2, 0x4a, 0xf1, 0x11, 0x24, 0xab, 0x14, 0x1f, 0x41, 0xb2,
-  0x4a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xaf, 0x24, 0x39, 0x34, 0xaf, 0x34,
-  0x79, 0x34, 0xf8, 0x42, 0x93, 0x47, 0x83, 0x2d, 0x91, 0x4f, 0x82, 0xd4,
-  0x18, 0xf9, 0x24, 0x4a, 0x8d, 0x81, 0x6f, 0xa2, 0x74, 0x18, 0xf1, 0x24,
-  0x4a, 0x96, 0xf1, 0x22, 0x4a, 0x87, 0x59, 0x2e, 0x5a, 0x8f, 0x49, 0xf2,
-  0x22, 0x5a, 0x1f, 0x49, 0xd2, 0x22, 0xf4, 0x91, 0x24, 0x87, 0x22, 0x1f,
-  0xc9, 0x32, 0x6a, 0x1f, 0x49, 0x32, 0x6a, 0x1f, 0xc9, 0xb2, 0x6a, 0xf1,
-  0x11, 0x2c, 0xab, 0x94, 0x1b, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x47,
-  0x82, 0xaf, 0x44, 0x79, 0x34, 0xf8, 0x42, 0x94, 0x47, 0x82, 0x2d, 0x94,
-  0x4f, 0x82, 0x84, 0xf9, 0x24, 0x4a, 0x6f, 0x31, 0x09, 0x2c, 0xf4, 0x11,
-  0x6c, 0x8d, 0x42, 0x1f, 0x41, 0x72, 0x48, 0xf2, 0x11, 0x24, 0x87, 0x24,
-  0x1d, 0x24, 0x8b, 0x14, 0x1d, 0x24, 0xaf, 0x64, 0xd9, 0x41, 0xb2, 0x48,
-  0x9b, 0x25, 0xab, 0x94, 0x43, 0xf2, 0x42, 0x81, 0x43, 0xf2, 0x42, 0x91,
-  0x47, 0x82, 0x2d, 0x91, 0x6f, 0x82, 0xc4, 0x91, 0x6f, 0xa2, 0xc5, 0x81,
-  0x4b, 0xd2, 0x1e, 0x81, 0x6f, 0x22, 0x64, 0x19, 0x2e, 0x42, 0x96, 0xc5,
-  0x43, 0x96, 0xd5, 0xa4, 0xf4, 0x91, 0x28, 0x2c, 0xf4, 0x91, 0x6c, 0xcd,
-  0x42, 0x1b, 0x29, 0x42, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a,
-  0xd1, 0x41, 0xf2, 0x42, 0x94, 0x19, 0xf2, 0x4a, 0xb4, 0x51, 0x2b, 0xb4,
-  0x43, 0xb2, 0x42, 0x39, 0x24, 0x3b, 0x94, 0x47, 0x82, 0x29, 0xf9, 0x26,
-  0x48, 0x29, 0xf9, 0x24, 0x5a, 0xad, 0xf3, 0x00, 0x82, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08,
-  0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x90, 0x22, 0xf0, 0xda, 0x72, 0x40, 0x22, 0x82, 0x91,
-  0x22, 0x28, 0xd0, 0x24, 0x51, 0x28, 0x15, 0x72, 0x58, 0xb2, 0x31, 0x84,
-  0x23, 0x04, 0x13, 0x68, 0x22, 0x66, 0x48, 0xc8, 0xd4, 0x85, 0xc5, 0x84,
-  0x00, 0x22, 0x8c, 0x06, 0x1a, 0xf4, 0x12, 0x22, 0x88, 0x8a, 0xc1, 0x22,
-  0x2a, 0xb4, 0x22, 0x14, 0xe2, 0x2a, 0x84, 0x84, 0x02, 0x60, 0x42, 0x43,
-  0x9c, 0x11, 0x20, 0xb3, 0x78, 0xb8, 0x81, 0x04, 0xc2, 0x18, 0x16, 0x64,
-  0x82, 0x4e, 0x18, 0x49, 0x11, 0x44, 0x04, 0x41, 0x8c, 0x04, 0xaf, 0x6e,
-  0x0b, 0x4a, 0x61, 0x49, 0x25, 0x18, 0x28, 0x24, 0x51, 0x81, 0x28, 0x8b,
-  0x14, 0x28, 0x82, 0x90, 0x81, 0x89, 0xe8, 0x81, 0x04, 0x1a, 0xa8, 0x42,
-  0x21, 0x22, 0x8c, 0x43, 0x91, 0x64, 0x49, 0x84, 0xf8, 0x24, 0x42, 0x00,
-  0x1a, 0xc4, 0x44, 0x9a, 0x24, 0x21, 0x88, 0x31, 0x12, 0x1d, 0x34, 0x23,
-  0x89, 0xe2, 0x43, 0xa8, 0x48, 0x28, 0x42, 0x28, 0x1c, 0x14, 0x82, 0xb1,
-  0x48, 0x13, 0x91, 0x44, 0x8b, 0x84, 0x49, 0x08, 0x8a, 0x82, 0x62, 0x84,
-  0x88, 0x8a, 0xe1, 0x1a, 0xa1, 0x42, 0xaf, 0xfb, 0x08, 0x70, 0xf2, 0x36,
-  0x18, 0x25, 0x28, 0x04, 0x16, 0x91, 0x2a, 0x8c, 0xf4, 0x48, 0x22, 0x4f,
-  0x16, 0x89, 0x32, 0xe1, 0x82, 0x93, 0x2c, 0xa2, 0x38, 0x8b, 0x24, 0x58,
-  0xc9, 0x62, 0x6b, 0x14, 0x4b, 0x42, 0x1e, 0x44, 0x8c, 0x7a, 0xe4, 0xc2,
-  0x12, 0x26, 0xa2, 0x81, 0x49, 0xa4, 0x4a, 0x19, 0xa6, 0x82, 0x27, 0x21,
-  0x8b, 0xa4, 0x6c, 0xa6, 0x16, 0x28, 0x9a, 0xa2, 0xa4, 0xc2, 0x1b, 0x14,
-  0x28, 0x24, 0x8b, 0x94, 0x4f, 0x14, 0x19, 0xb8, 0x21, 0x38, 0x14, 0xce,
-  0x1c, 0xcb, 0x28, 0x4e, 0x18, 0x1e, 0x84, 0x26, 0x44, 0x68, 0x28, 0x1a,
-  0xa8, 0xa4, 0x72, 0xdf, 0xe7, 0x04, 0x58, 0x00, 0x28, 0x22, 0x12, 0xc1,
-  0xd0, 0x32, 0x21, 0x01, 0x12, 0x40, 0x88, 0x01, 0xa3, 0x04, 0x2d, 0x84,
-  0x11, 0x81, 0x00, 0x22, 0x42, 0x20, 0x84, 0x21, 0x84, 0x29, 0xd1, 0x22,
-  0x21, 0x04, 0x12, 0x2d, 0x11, 0x82, 0x40, 0x14, 0xc4, 0x24, 0x00, 0x6e,
-  0x11, 0x28, 0xa0, 0x61, 0x42, 0x48, 0x00, 0x20, 0x02, 0x49, 0x04, 0x41,
-  0x89, 0x01, 0xff, 0x99, 0x0f, 0x00, 0x00, 0x14, 0x00, 0x44, 0x00, 0x00,
-  0x00, 0x81, 0x80, 0x01, 0x24, 0x00, 0x80, 0x08, 0x88, 0x40, 0x24, 0x02,
-  0x22, 0x80, 0x04, 0x00, 0x20, 0x01, 0x28, 0x26, 0x01, 0x42, 0x84, 0x41,
-  0x00, 0x84, 0x14, 0x11, 0x81, 0x00, 0x92, 0x00, 0x40, 0x08, 0xf0, 0xc1,
-  0x3c, 0x10, 0xc1, 0x22, 0x84, 0x38, 0x20, 0x41, 0x14, 0x82, 0xa1, 0x24,
-  0x92, 0x84, 0x18, 0x82, 0x18, 0x28, 0x88, 0x82, 0x29, 0x41, 0x84, 0x41,
-  0x08, 0x80, 0x84, 0x04, 0x48, 0x42, 0x00, 0x81, 0x22, 0x00, 0x80, 0x82,
-  0x08, 0x80, 0x02, 0x23, 0x02, 0x28, 0x89, 0x01, 0x12, 0x1a, 0x44, 0x24,
-  0x02, 0x60, 0x81, 0x00, 0x80, 0x08, 0x9f, 0x45, 0x07, 0x14, 0x28, 0xa1,
-  0x28, 0x80, 0x41, 0x46, 0x04, 0x28, 0x12, 0x84, 0x12, 0x88, 0x16, 0x08,
-  0x8a, 0xc1, 0x82, 0x00, 0x12, 0x80, 0x08, 0x42, 0x42, 0x20, 0x02, 0x22,
-  0x80, 0x84, 0x02, 0x00, 0x32, 0x80, 0x02, 0xc0, 0x42, 0x28, 0x20, 0x82,
-  0x41, 0x88, 0xb1, 0x11, 0x14, 0x08, 0x20, 0x88, 0x01, 0x40, 0x88, 0x08,
-  0xdf, 0x23, 0x05, 0x20, 0x04, 0x18, 0x14, 0x00, 0x80, 0x21, 0xc4, 0x84,
-  0x20, 0x02, 0x80, 0x02, 0x60, 0x21, 0x44, 0x10, 0x0a, 0x12, 0x82, 0x82,
-  0x41, 0x48, 0x42, 0x00, 0x91, 0x00, 0x81, 0x20, 0x84, 0x08, 0x1c, 0x22,
-  0x02, 0x84, 0x44, 0x50, 0x84, 0x60, 0x12, 0x40, 0x24, 0x02, 0x18, 0x84,
-  0x40, 0x02, 0x20, 0xf1, 0xdc, 0x7c, 0x00, 0x12, 0xe0, 0x81, 0x62, 0xa4,
-  0x4d, 0x2a, 0x22, 0x20, 0x42, 0x81, 0x08, 0x16, 0x0a, 0x48, 0xc4, 0x88,
-  0x48, 0x2e, 0x45, 0x48, 0x13, 0x22, 0x62, 0x84, 0x4c, 0x02, 0x14, 0x40,
-  0x8c, 0x02, 0x26, 0x64, 0x83, 0x83, 0xc1, 0x24, 0x23, 0x01, 0x28, 0x12,
-  0x88, 0x80, 0x12, 0x08, 0x00, 0x42, 0x2a, 0xc4, 0x18, 0x00, 0x42, 0x6a,
-  0x81, 0x06, 0x30, 0x44, 0x48, 0x48, 0x89, 0xf2, 0xe4, 0x95, 0x00, 0x28,
-  0x84, 0x51, 0x44, 0x00, 0x5c, 0x55, 0x18, 0x18, 0x00, 0x80, 0x44, 0x0d,
-  0x8c, 0x82, 0x21, 0x11, 0xe2, 0x84, 0xc8, 0x48, 0x28, 0x10, 0x44, 0x74,
-  0x41, 0x6c, 0x22, 0x43, 0x08, 0x8a, 0x04, 0xae, 0x42, 0x42, 0x41, 0x00,
-  0xa4, 0x18, 0x48, 0x80, 0x82, 0x41, 0x88, 0x81, 0x02, 0x10, 0x08, 0x4d,
-  0x22, 0x84, 0x12, 0x60, 0x2a, 0xb2, 0x82, 0x28, 0x44, 0x6f, 0x1d, 0x01,
-  0x00, 0x22, 0x80, 0xa2, 0x41, 0x84, 0x22, 0x00, 0x48, 0x48, 0x40, 0x82,
-  0xe1, 0x24, 0x01, 0x44, 0x40, 0x04, 0x12, 0x00, 0x80, 0x02, 0x23, 0x45,
-  0xa8, 0x12, 0x18, 0x10, 0x04, 0xa0, 0x14, 0x10, 0x42, 0x89, 0x02, 0x00,
-  0x25, 0x02, 0x00, 0x48, 0x11, 0x16, 0x68, 0x81, 0x00, 0xcc, 0x1d, 0x04,
-  0x10, 0x04, 0x7e, 0xef, 0x00, 0x22, 0x83, 0x42, 0x71, 0x28, 0x62, 0xc3,
-  0xa9, 0xb2, 0x25, 0x84, 0x22, 0x01, 0x80, 0x81, 0x74, 0x1a, 0xf4, 0x44,
-  0x18, 0x2d, 0x28, 0x4c, 0xf4, 0x14, 0x21, 0x4c, 0xe4, 0x14, 0x3a, 0x58,
-  0x84, 0x40, 0x14, 0xd5, 0x41, 0xb4, 0x36, 0xd4, 0x84, 0xa2, 0x12, 0x7a,
-  0xc8, 0x38, 0x8f, 0x62, 0x69, 0x42, 0x12, 0x42, 0x28, 0x83, 0x61, 0x91,
-  0x00, 0x81, 0x18, 0x21, 0x29, 0xa1, 0x42, 0x48, 0x4a, 0x41, 0xc1, 0x18,
-  0x6a, 0xe1, 0x85, 0x22, 0xa7, 0x81, 0x4c, 0xb2, 0x86, 0x85, 0x68, 0x44,
-  0x8c, 0xf2, 0x92, 0x36, 0x00, 0x12, 0xe0, 0xc1, 0x32, 0x44, 0x48, 0x20,
-  0x51, 0x18, 0x11, 0x4a, 0x88, 0x54, 0x28, 0x60, 0x14, 0x80, 0x28, 0x61,
-  0x24, 0x10, 0x28, 0xa2, 0x24, 0x43, 0x02, 0x22, 0x81, 0xa4, 0x82, 0x40,
-  0x04, 0x42, 0x2c, 0x44, 0x84, 0x01, 0x25, 0x22, 0x28, 0x86, 0x22, 0x02,
-  0x81, 0x00, 0x28, 0x81, 0x84, 0x50, 0x84, 0x21, 0x70, 0x48, 0x24, 0x88,
-  0x82, 0x84, 0x12, 0xf4, 0x41, 0x71, 0x00, 0x11, 0x81, 0x40, 0x82, 0x02,
-  0x10, 0x24, 0x08, 0x00, 0x40, 0x01, 0x83, 0x04, 0x98, 0x82, 0x40, 0x08,
-  0x24, 0x14, 0x21, 0x81, 0x41, 0x80, 0x04, 0x10, 0x08, 0x10, 0x12, 0x11,
-  0x02, 0x80, 0x06, 0x00, 0x20, 0x14, 0x01, 0x00, 0x41, 0x83, 0x04, 0x00,
-  0x80, 0x24, 0x84, 0xf4, 0x48, 0x31, 0x00, 0x21, 0x28, 0x28, 0x19, 0x12,
-  0x88, 0x65, 0x91, 0x10, 0x02, 0x1c, 0xe8, 0x24, 0x28, 0x04, 0x42, 0x40,
-  0x48, 0x0e, 0x54, 0x49, 0xa1, 0x24, 0x22, 0x90, 0x2c, 0x12, 0xc0, 0x48,
-  0x11, 0xa0, 0x21, 0x32, 0x1a, 0x0a, 0xb0, 0x82, 0x01, 0x10, 0x91, 0x14,
-  0x8d, 0x84, 0x19, 0xa3, 0x16, 0x89, 0x08, 0x30, 0x41, 0x51, 0x44, 0xc0,
-  0x22, 0x20, 0x98, 0x84, 0xe6, 0x14, 0x0c, 0x84, 0x4f, 0xa7, 0x05, 0x24,
-  0x13, 0x24, 0x02, 0x34, 0x22, 0x18, 0x18, 0x45, 0x22, 0x48, 0x34, 0x81,
-  0xe6, 0x02, 0x14, 0x48, 0x10, 0xa8, 0x81, 0x88, 0x41, 0x25, 0x88, 0x24,
-  0x03, 0x82, 0x89, 0x01, 0x00, 0x90, 0x11, 0x89, 0xa3, 0x12, 0x85, 0x02,
-  0xc2, 0x00, 0xc0, 0x24, 0x84, 0x1e, 0x21, 0x48, 0x10, 0x44, 0xa1, 0x42,
-  0x44, 0x00, 0x81, 0x00, 0xe0, 0x64, 0x42, 0x04, 0x16, 0xf8, 0xc8, 0x65,
-  0x50, 0x88, 0x8b, 0x44, 0x4e, 0x48, 0x62, 0x22, 0x81, 0x48, 0x85, 0x01,
-  0x50, 0x44, 0x45, 0xb4, 0x24, 0xa2, 0x26, 0x22, 0x60, 0x84, 0x40, 0x0e,
-  0x15, 0xd2, 0x62, 0xd1, 0x22, 0xa2, 0x11, 0x2f, 0x11, 0xf1, 0x9a, 0xa4,
-  0x8a, 0x68, 0x48, 0x89, 0xc4, 0x41, 0x70, 0x21, 0x51, 0x11, 0x13, 0x58,
-  0x88, 0x85, 0xfa, 0x48, 0x53, 0x4a, 0x24, 0x44, 0xa1, 0x14, 0x86, 0x04,
-  0x1a, 0x62, 0x88, 0x4d, 0x44, 0x45, 0xf4, 0x24, 0x21, 0x2e, 0x21, 0x43,
-  0x42, 0x24, 0x16, 0x22, 0x68, 0x48, 0x86, 0x72, 0x4a, 0xd2, 0x22, 0xa4,
-  0x15, 0x7f, 0x32, 0x05, 0x00, 0x00, 0x00, 0x18, 0x22, 0x80, 0x08, 0x18,
-  0x00, 0x18, 0x14, 0x21, 0x00, 0x46, 0x81, 0x82, 0x02, 0x00, 0x00, 0x10,
-  0x44, 0x28, 0x82, 0x06, 0x00, 0x00, 0x80, 0x02, 0x44, 0x20, 0xc1, 0x88,
-  0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x81, 0xf0, 0x77, 0xf2, 0x30,
+  0x40, 0xc2, 0x12, 0x00, 0x20, 0x11, 0xab, 0x09, 0x50, 0x18, 0x00, 0x80,
+  0x21, 0x01, 0xdb, 0x04, 0x60, 0x80, 0x01, 0x00, 0x40, 0x24, 0x81, 0xee,
+  0x05, 0xf0, 0xff, 0x83, 0x84, 0x00, 0xf0, 0x52, 0xff, 0x00, 0x82, 0x26,
+  0x44, 0xc2, 0xa4, 0x10, 0x22, 0x24, 0x02, 0x18, 0x48, 0x18, 0x87, 0x64,
+  0x41, 0x48, 0x22, 0x21, 0x40, 0xbc, 0x24, 0x11, 0x48, 0x02, 0x27, 0x24,
+  0x16, 0x14, 0x04, 0x25, 0x82, 0x81, 0x04, 0x42, 0x00, 0x82, 0x60, 0x28,
+  0x12, 0x8c, 0x28, 0x24, 0x28, 0x81, 0x02, 0x83, 0x22, 0x81, 0x22, 0xa4,
+  0x12, 0x48, 0x41, 0x82, 0x45, 0x08, 0x46, 0x88, 0x58, 0x84, 0x81, 0x8f,
+  0xab, 0x0e, 0x8c, 0x12, 0xc8, 0x42, 0x40, 0x22, 0x44, 0x02, 0x80, 0x08,
+  0x16, 0x04, 0x28, 0x00, 0xb0, 0x48, 0x38, 0x22, 0x12, 0x48, 0x90, 0x52,
+  0x80, 0x01, 0x88, 0x20, 0x42, 0x08, 0x28, 0x14, 0x43, 0x49, 0x44, 0x0a,
+  0x49, 0x44, 0x24, 0x02, 0x20, 0x04, 0x22, 0x40, 0x54, 0x48, 0x38, 0x10,
+  0x04, 0x41, 0x22, 0x00, 0x41, 0x21, 0x28, 0x3e, 0xfd, 0x80, 0x63, 0x88,
+  0x1e, 0x12, 0x20, 0xda, 0x22, 0xe4, 0x23, 0xd2, 0x24, 0xf4, 0x22, 0x14,
+  0x9a, 0x21, 0xf2, 0x52, 0x92, 0x81, 0x86, 0x4c, 0xa4, 0x59, 0x45, 0x1a,
+  0x22, 0xe1, 0xe4, 0x61, 0x42, 0x40, 0x32, 0x18, 0x24, 0x2d, 0x16, 0x27,
+  0x41, 0x16, 0xe2, 0x21, 0x36, 0x82, 0x62, 0x89, 0xb3, 0x42, 0x21, 0x32,
+  0x68, 0x6c, 0x11, 0xe8, 0xea, 0x4a, 0xa2, 0x2b, 0x52, 0x2e, 0x18, 0x4a,
+  0xa4, 0xa8, 0x3e, 0x84, 0x89, 0xa2, 0xdb, 0x2e, 0x14, 0x82, 0x1e, 0x18,
+  0xca, 0x58, 0xc4, 0x44, 0x2e, 0x24, 0x44, 0x8c, 0x14, 0x54, 0x18, 0x89,
+  0xf3, 0x9e, 0x93, 0x60, 0x43, 0xcb, 0x19, 0x4b, 0x22, 0x61, 0x45, 0x92,
+  0x94, 0x44, 0x20, 0xb1, 0x44, 0xdc, 0x22, 0x82, 0x44, 0x88, 0x14, 0x44,
+  0x24, 0xf3, 0xc8, 0x8e, 0x41, 0x9a, 0xb8, 0x54, 0x47, 0x88, 0xf5, 0x82,
+  0x82, 0x2b, 0x22, 0x81, 0x43, 0x14, 0xb8, 0x64, 0xc1, 0x12, 0x78, 0x9a,
+  0xa8, 0x62, 0xc5, 0xb4, 0x14, 0xb2, 0x84, 0x68, 0x81, 0x80, 0x52, 0x4c,
+  0x2a, 0x27, 0x61, 0x41, 0x1e, 0x18, 0xca, 0x23, 0x81, 0x12, 0x84, 0x88,
+  0x82, 0x04, 0x4a, 0x19, 0x88, 0x18, 0x08, 0x8c, 0xa4, 0x82, 0x8f, 0x76,
+  0x08, 0x50, 0x42, 0x85, 0x44, 0xd6, 0x42, 0x62, 0x45, 0x29, 0xf1, 0x52,
+  0x14, 0x28, 0x44, 0x1a, 0x21, 0xb8, 0x12, 0xb1, 0x4c, 0x18, 0xf2, 0x44,
+  0x82, 0x89, 0x93, 0x44, 0x2b, 0x22, 0x49, 0x44, 0xa2, 0x88, 0x6a, 0x02,
+  0x4a, 0x34, 0x14, 0x2e, 0x62, 0x65, 0x14, 0xe2, 0x81, 0x28, 0x21, 0x22,
+  0xa1, 0xb9, 0x2d, 0x54, 0x12, 0x45, 0x14, 0xf4, 0x36, 0x14, 0x29, 0x59,
+  0x44, 0x8a, 0xaa, 0x32, 0x22, 0x48, 0x4b, 0x12, 0x42, 0x83, 0xa1, 0x55,
+  0x22, 0x45, 0x04, 0x4b, 0x6b, 0x4f, 0x81, 0xf1, 0xe8, 0x48, 0x42, 0x8f,
+  0xc8, 0x78, 0x44, 0x64, 0x88, 0xaf, 0x3e, 0x0e, 0x28, 0x18, 0x28, 0x80,
+  0xa2, 0x94, 0x28, 0x42, 0x1a, 0xa2, 0x84, 0x1a, 0xa2, 0x7c, 0x0b, 0xf1,
+  0xff, 0xae, 0x84, 0x36, 0xe8, 0x24, 0x28, 0x82, 0xa8, 0x43, 0x88, 0x2a,
+  0x84, 0xb8, 0x22, 0x04, 0x2a, 0x04, 0x2b, 0x42, 0x82, 0x58, 0x82, 0x2a,
+  0x25, 0xa8, 0x42, 0x82, 0x20, 0x38, 0x22, 0x82, 0x62, 0x82, 0x62, 0x92,
+  0x6a, 0x28, 0xa1, 0x84, 0x12, 0x4a, 0x08, 0x4e, 0x84, 0xe0, 0x44, 0x28,
+  0xa1, 0x84, 0x48, 0x88, 0x48, 0xa8, 0x5b, 0x97, 0xa0, 0x6e, 0x4f, 0x42,
+  0xf2, 0x28, 0x2e, 0x67, 0x42, 0x2f, 0x46, 0xfe, 0x74, 0x74, 0x2b, 0x77,
+  0x4f, 0x66, 0xb7, 0x72, 0xf3, 0xe4, 0xe6, 0x2b, 0xeb, 0xee, 0xe2, 0xce,
+  0xc8, 0x4f, 0x6c, 0xfc, 0xc6, 0xc4, 0x4f, 0x4e, 0xfe, 0xf8, 0x28, 0x6f,
+  0x4e, 0xbe, 0xe2, 0xfe, 0xec, 0xdc, 0x4f, 0x4f, 0xff, 0xe8, 0xc8, 0xfa,
+  0xe7, 0x24, 0xea, 0x26, 0xfe, 0x64, 0x66, 0x4f, 0x67, 0xf7, 0x74, 0x36,
+  0x7e, 0xf2, 0x8f, 0xaf, 0xbb, 0x62, 0xaf, 0xcc, 0xfa, 0xaf, 0x8c, 0x3e,
+  0x84, 0x9e, 0x86, 0x2b, 0x99, 0x8e, 0x82, 0x2f, 0x42, 0xfa, 0x88, 0xe8,
+  0xea, 0xac, 0xea, 0x4f, 0x4e, 0xaf, 0xfd, 0x4f, 0x4e, 0xfe, 0xa8, 0xf8,
+  0xea, 0xff, 0x98, 0xc8, 0xca, 0xac, 0x48, 0xca, 0xbc, 0xc4, 0xac, 0xee,
+  0x4f, 0x8a, 0xf5, 0xe8, 0xe8, 0xce, 0x48, 0xcf, 0xcc, 0xfc, 0xc8, 0xcc,
+  0x8f, 0x8c, 0xfc, 0x38, 0x8e, 0xf0, 0x34, 0x64, 0x4f, 0x45, 0xf7, 0x2c,
+  0x3e, 0x6f, 0x62, 0xf6, 0x66, 0x26, 0x4f, 0x65, 0xf7, 0x76, 0x34, 0x6f,
+  0x45, 0xf7, 0x66, 0x74, 0x4f, 0x6c, 0xff, 0x76, 0xe4, 0x2f, 0x2c, 0xff,
+  0x7a, 0xbc, 0x4f, 0x2c, 0xdc, 0x46, 0xfe, 0xe4, 0xd4, 0x4f, 0x4f, 0xfe,
+  0xec, 0xc4, 0x6f, 0x42, 0xfe, 0xfc, 0xec, 0x4f, 0x47, 0xff, 0xaa, 0xe8,
+  0xfa, 0xef, 0x27, 0xa7, 0x66, 0x4f, 0x68, 0xfe, 0x62, 0x64, 0x4f, 0x67,
+  0xfd, 0xf4, 0xf4, 0x8f, 0xaf, 0xbd, 0xf2, 0xfe, 0x91, 0xc1, 0xea, 0xe7,
+  0x5c, 0xee, 0xce, 0xf8, 0xc4, 0x86, 0x6f, 0x4d, 0xe5, 0x68, 0xea, 0x49,
+  0xfc, 0xfc, 0xf8, 0x4b, 0x7e, 0xea, 0xff, 0xf4, 0x74, 0xea, 0xfb, 0xd4,
+  0xe4, 0x8f, 0xc6, 0xaf, 0xff, 0x8f, 0x87, 0xaf, 0xdd, 0xca, 0xbc, 0xc4,
+  0xbc, 0x44, 0xb8, 0xe4, 0xfe, 0xfc, 0xf8, 0x8f, 0x8e, 0xfe, 0xc8, 0xca,
+  0xef, 0xc8, 0xfc, 0x4c, 0xcc, 0xaf, 0x8b, 0xff, 0x11, 0x98, 0xf0, 0x24,
+  0x74, 0x4f, 0x41, 0xf6, 0x3c, 0x2e, 0x65, 0xf6, 0x66, 0x24, 0x6f, 0x45,
+  0xf7, 0x76, 0x34, 0x4f, 0x45, 0xf6, 0x34, 0x34, 0x4f, 0x6c, 0xfe, 0x32,
+  0xb4, 0x2b, 0xfd, 0x2f, 0x84, 0xfa, 0xcc, 0xc6, 0x6d, 0xc4, 0x4f, 0x4e,
+  0xfc, 0x3c, 0x3c, 0x6f, 0x4e, 0xfc, 0x66, 0xe4, 0xcf, 0xcd, 0xfd, 0x64,
+  0xf4, 0xaf, 0x88, 0xac, 0x77, 0x8e, 0x92, 0xee, 0xe2, 0x4d, 0xe4, 0x4f,
+  0x47, 0xf7, 0x34, 0x16, 0x4f, 0x67, 0xf7, 0xb8, 0xba, 0x2b, 0x76, 0x8e,
+  0xc1, 0xda, 0xb7, 0x84, 0xe8, 0xc7, 0xe3, 0x6c, 0xb8, 0x92, 0xf5, 0x84,
+  0x82, 0x2f, 0x43, 0xf3, 0xac, 0xac, 0xfa, 0xa6, 0xbb, 0x4f, 0x4f, 0xa6,
+  0x9f, 0x4f, 0x4e, 0xdf, 0xc8, 0xa9, 0xfd, 0x8f, 0x81, 0xab, 0xdc, 0x1a,
+  0xe1, 0x4c, 0xbc, 0x44, 0xe8, 0x4f, 0xff, 0x2c, 0x38, 0x8f, 0x8e, 0xfe,
+  0x48, 0x48, 0x86, 0x00, 0xf0, 0x6e, 0x8f, 0x88, 0xff, 0xc3, 0x27, 0xf0,
+  0xb4, 0x24, 0x4f, 0x41, 0xf5, 0x2c, 0x3e, 0x67, 0x66, 0x6f, 0x4a, 0xf2,
+  0xc6, 0x54, 0x6f, 0x63, 0xf3, 0x56, 0x56, 0x6f, 0x47, 0xf2, 0xc4, 0xd6,
+  0x2f, 0x43, 0xb7, 0xc2, 0xfd, 0x1e, 0x38, 0xcf, 0x6c, 0x7c, 0x26, 0xf4,
+  0xc4, 0xd4, 0xcf, 0xef, 0xf3, 0xcc, 0xc6, 0x6f, 0x42, 0xf6, 0xfc, 0xdc,
+  0x4b, 0x67, 0x8f, 0x8a, 0xa8, 0x7f, 0x4e, 0xa2, 0x2b, 0xe6, 0x6d, 0x86,
+  0x6f, 0x66, 0xf6, 0xd6, 0x16, 0x6f, 0x46, 0xff, 0xfa, 0x9a, 0x2b, 0xf7,
+  0xbe, 0xb1, 0x4a, 0xf7, 0xd5, 0xb4, 0x7e, 0xf4, 0xde, 0xd6, 0x2b, 0x51,
+  0x4f, 0x68, 0xea, 0x67, 0xfa, 0x9e, 0xfc, 0x4b, 0x47, 0xba, 0xff, 0x74,
+  0x54, 0xba, 0xfa, 0xf4, 0xd4, 0x8f, 0x82, 0xa7, 0xfc, 0x8f, 0x81, 0xa4,
+  0xdc, 0x9a, 0xf5, 0xc4, 0xc4, 0x41, 0x4f, 0x4e, 0xfe, 0xbc, 0x78, 0x0d,
+  0x01, 0xb1, 0x48, 0xef, 0xc8, 0xf8, 0x4c, 0x4e, 0xae, 0xa8, 0x7f, 0xff,
+  0x08, 0xc5, 0x08, 0xf1, 0x09, 0x20, 0x01, 0x00, 0x84, 0x44, 0x12, 0x40,
+  0x08, 0x40, 0x04, 0x00, 0x10, 0x42, 0x04, 0x10, 0x02, 0x00, 0x2a, 0x01,
+  0x18, 0x00, 0x90, 0x12, 0x20, 0xd5, 0x0d, 0xf0, 0x33, 0x44, 0x40, 0x04,
+  0x00, 0x85, 0x04, 0xaf, 0x1a, 0x0a, 0x40, 0xc4, 0x12, 0x44, 0x40, 0x14,
+  0x24, 0x11, 0x04, 0x20, 0x01, 0x00, 0x40, 0x06, 0x44, 0x12, 0x00, 0x20,
+  0x08, 0x00, 0x18, 0x16, 0x04, 0x12, 0x80, 0x02, 0x42, 0x41, 0x00, 0x28,
+  0x22, 0x16, 0x04, 0x80, 0x81, 0xa2, 0x12, 0x80, 0x01, 0x18, 0x00, 0x12,
+  0x28, 0x84, 0x81, 0x40, 0x64, 0x12, 0x4f, 0x71, 0x0e, 0x2c, 0xf5, 0x11,
+  0x24, 0xad, 0x12, 0x92, 0x09, 0x90, 0x1f, 0x41, 0xb2, 0x4a, 0xf1, 0x11,
+  0x24, 0xab, 0x14, 0x09, 0x00, 0xf0, 0x3d, 0x99, 0x21, 0xab, 0x94, 0x51,
+  0xaf, 0x24, 0x39, 0x34, 0xaf, 0x34, 0x79, 0x34, 0xf8, 0x42, 0x93, 0x47,
+  0x83, 0x2d, 0x91, 0x4f, 0x82, 0xd4, 0x18, 0xf9, 0x24, 0x4a, 0x8d, 0x81,
+  0x6f, 0xa2, 0x74, 0x18, 0xf1, 0x24, 0x4a, 0x96, 0xf1, 0x22, 0x4a, 0x87,
+  0x59, 0x2e, 0x5a, 0x8f, 0x49, 0xf2, 0x22, 0x5a, 0x1f, 0x49, 0xd2, 0x22,
+  0xf4, 0x91, 0x24, 0x87, 0x22, 0x1f, 0xc9, 0x32, 0x6a, 0x1f, 0x49, 0x32,
+  0x6a, 0x1f, 0xc9, 0xb2, 0x6a, 0xf1, 0x11, 0x2c, 0xab, 0x94, 0x1b, 0x4b,
+  0x00, 0x60, 0xab, 0x94, 0x47, 0x82, 0xaf, 0x44, 0x4b, 0x00, 0xf0, 0x04,
+  0x94, 0x47, 0x82, 0x2d, 0x94, 0x4f, 0x82, 0x84, 0xf9, 0x24, 0x4a, 0x6f,
+  0x31, 0x09, 0x2c, 0xf4, 0x11, 0x6c, 0x8d, 0x8e, 0x0a, 0xf1, 0x0d, 0x48,
+  0xf2, 0x11, 0x24, 0x87, 0x24, 0x1d, 0x24, 0x8b, 0x14, 0x1d, 0x24, 0xaf,
+  0x64, 0xd9, 0x41, 0xb2, 0x48, 0x9b, 0x25, 0xab, 0x94, 0x43, 0xf2, 0x42,
+  0x81, 0x43, 0xf2, 0x8b, 0x0a, 0xf6, 0x16, 0x91, 0x6f, 0x82, 0xc4, 0x91,
+  0x6f, 0xa2, 0xc5, 0x81, 0x4b, 0xd2, 0x1e, 0x81, 0x6f, 0x22, 0x64, 0x19,
+  0x2e, 0x42, 0x96, 0xc5, 0x43, 0x96, 0xd5, 0xa4, 0xf4, 0x91, 0x28, 0x2c,
+  0xf4, 0x91, 0x6c, 0xcd, 0x42, 0x1b, 0x29, 0x42, 0x89, 0x0a, 0xf2, 0x10,
+  0xf2, 0x42, 0x94, 0x19, 0xf2, 0x4a, 0xb4, 0x51, 0x2b, 0xb4, 0x43, 0xb2,
+  0x42, 0x39, 0x24, 0x3b, 0x94, 0x47, 0x82, 0x29, 0xf9, 0x26, 0x48, 0x29,
+  0xf9, 0x24, 0x5a, 0xad, 0xf3, 0x00, 0x82, 0x23, 0x0a, 0x01, 0x2d, 0x0b,
+  0x70, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x14, 0xdf, 0x0f, 0x04, 0x01,
+  0x00, 0xf0, 0xff, 0x2c, 0x90, 0x22, 0xf0, 0xda, 0x72, 0x40, 0x22, 0x82,
+  0x91, 0x22, 0x28, 0xd0, 0x24, 0x51, 0x28, 0x15, 0x72, 0x58, 0xb2, 0x31,
+  0x84, 0x23, 0x04, 0x13, 0x68, 0x22, 0x66, 0x48, 0xc8, 0xd4, 0x85, 0xc5,
+  0x84, 0x00, 0x22, 0x8c, 0x06, 0x1a, 0xf4, 0x12, 0x22, 0x88, 0x8a, 0xc1,
+  0x22, 0x2a, 0xb4, 0x22, 0x14, 0xe2, 0x2a, 0x84, 0x84, 0x02, 0x60, 0x42,
+  0x43, 0x9c, 0x11, 0x20, 0xb3, 0x78, 0xb8, 0x81, 0x04, 0xc2, 0x18, 0x16,
+  0x64, 0x82, 0x4e, 0x18, 0x49, 0x11, 0x44, 0x04, 0x41, 0x8c, 0x04, 0xaf,
+  0x6e, 0x0b, 0x4a, 0x61, 0x49, 0x25, 0x18, 0x28, 0x24, 0x51, 0x81, 0x28,
+  0x8b, 0x14, 0x28, 0x82, 0x90, 0x81, 0x89, 0xe8, 0x81, 0x04, 0x1a, 0xa8,
+  0x42, 0x21, 0x22, 0x8c, 0x43, 0x91, 0x64, 0x49, 0x84, 0xf8, 0x24, 0x42,
+  0x00, 0x1a, 0xc4, 0x44, 0x9a, 0x24, 0x21, 0x88, 0x31, 0x12, 0x1d, 0x34,
+  0x23, 0x89, 0xe2, 0x43, 0xa8, 0x48, 0x28, 0x42, 0x28, 0x1c, 0x14, 0x82,
+  0xb1, 0x48, 0x13, 0x91, 0x44, 0x8b, 0x84, 0x49, 0x08, 0x8a, 0x82, 0x62,
+  0x84, 0x88, 0x8a, 0xe1, 0x1a, 0xa1, 0x42, 0xaf, 0xfb, 0x08, 0x70, 0xf2,
+  0x36, 0x18, 0x25, 0x28, 0x04, 0x16, 0x91, 0x2a, 0x8c, 0xf4, 0x48, 0x22,
+  0x4f, 0x16, 0x89, 0x32, 0xe1, 0x82, 0x93, 0x2c, 0xa2, 0x38, 0x8b, 0x24,
+  0x58, 0xc9, 0x62, 0x6b, 0x14, 0x4b, 0x42, 0x1e, 0x44, 0x8c, 0x7a, 0xe4,
+  0xc2, 0x12, 0x26, 0xa2, 0x81, 0x49, 0xa4, 0x4a, 0x19, 0xa6, 0x82, 0x27,
+  0x21, 0x8b, 0xa4, 0x6c, 0xa6, 0x16, 0x28, 0x9a, 0xa2, 0xa4, 0xc2, 0x1b,
+  0x14, 0x28, 0x24, 0x8b, 0x94, 0x4f, 0x14, 0x19, 0xb8, 0x21, 0x38, 0x14,
+  0xce, 0x1c, 0xcb, 0x28, 0x4e, 0x18, 0x1e, 0x84, 0x26, 0x44, 0x68, 0x28,
+  0x1a, 0xa8, 0xa4, 0x72, 0xdf, 0xe7, 0x04, 0x58, 0x00, 0x28, 0x22, 0x12,
+  0xc1, 0xd0, 0x32, 0x21, 0x01, 0x12, 0x40, 0x88, 0x01, 0xa3, 0x04, 0x2d,
+  0x84, 0x11, 0x81, 0x00, 0x22, 0x42, 0x20, 0x84, 0x21, 0x84, 0x29, 0xd1,
+  0x22, 0x21, 0x04, 0x12, 0x2d, 0x11, 0x82, 0x40, 0x14, 0xc4, 0x24, 0x00,
+  0x6e, 0x11, 0x28, 0xa0, 0x61, 0x42, 0x48, 0x00, 0x20, 0x02, 0x49, 0x04,
+  0x41, 0x89, 0x01, 0xff, 0x99, 0x0f, 0x49, 0x01, 0x00, 0x7a, 0x0b, 0xf0,
+  0xff, 0xff, 0xff, 0x03, 0x81, 0x80, 0x01, 0x24, 0x00, 0x80, 0x08, 0x88,
+  0x40, 0x24, 0x02, 0x22, 0x80, 0x04, 0x00, 0x20, 0x01, 0x28, 0x26, 0x01,
+  0x42, 0x84, 0x41, 0x00, 0x84, 0x14, 0x11, 0x81, 0x00, 0x92, 0x00, 0x40,
+  0x08, 0xf0, 0xc1, 0x3c, 0x10, 0xc1, 0x22, 0x84, 0x38, 0x20, 0x41, 0x14,
+  0x82, 0xa1, 0x24, 0x92, 0x84, 0x18, 0x82, 0x18, 0x28, 0x88, 0x82, 0x29,
+  0x41, 0x84, 0x41, 0x08, 0x80, 0x84, 0x04, 0x48, 0x42, 0x00, 0x81, 0x22,
+  0x00, 0x80, 0x82, 0x08, 0x80, 0x02, 0x23, 0x02, 0x28, 0x89, 0x01, 0x12,
+  0x1a, 0x44, 0x24, 0x02, 0x60, 0x81, 0x00, 0x80, 0x08, 0x9f, 0x45, 0x07,
+  0x14, 0x28, 0xa1, 0x28, 0x80, 0x41, 0x46, 0x04, 0x28, 0x12, 0x84, 0x12,
+  0x88, 0x16, 0x08, 0x8a, 0xc1, 0x82, 0x00, 0x12, 0x80, 0x08, 0x42, 0x42,
+  0x20, 0x02, 0x22, 0x80, 0x84, 0x02, 0x00, 0x32, 0x80, 0x02, 0xc0, 0x42,
+  0x28, 0x20, 0x82, 0x41, 0x88, 0xb1, 0x11, 0x14, 0x08, 0x20, 0x88, 0x01,
+  0x40, 0x88, 0x08, 0xdf, 0x23, 0x05, 0x20, 0x04, 0x18, 0x14, 0x00, 0x80,
+  0x21, 0xc4, 0x84, 0x20, 0x02, 0x80, 0x02, 0x60, 0x21, 0x44, 0x10, 0x0a,
+  0x12, 0x82, 0x82, 0x41, 0x48, 0x42, 0x00, 0x91, 0x00, 0x81, 0x20, 0x84,
+  0x08, 0x1c, 0x22, 0x02, 0x84, 0x44, 0x50, 0x84, 0x60, 0x12, 0x40, 0x24,
+  0x02, 0x18, 0x84, 0x40, 0x02, 0x20, 0xf1, 0xdc, 0x7c, 0x00, 0x12, 0xe0,
+  0x81, 0x62, 0xa4, 0x4d, 0x2a, 0x22, 0x20, 0x42, 0x81, 0x08, 0x16, 0x0a,
+  0x48, 0xc4, 0x88, 0x48, 0x2e, 0x45, 0x48, 0x13, 0x22, 0x62, 0x84, 0x4c,
+  0x02, 0x14, 0x40, 0x8c, 0x02, 0x26, 0x64, 0x83, 0x83, 0xc1, 0x24, 0x23,
+  0x01, 0x28, 0x12, 0x88, 0x80, 0x12, 0x08, 0x00, 0x42, 0x2a, 0xc4, 0x18,
+  0x00, 0x42, 0x6a, 0x81, 0x06, 0x30, 0x44, 0x48, 0x48, 0x89, 0xf2, 0xe4,
+  0x95, 0x00, 0x28, 0x84, 0x51, 0x44, 0x00, 0x5c, 0x55, 0x18, 0x18, 0x00,
+  0x80, 0x44, 0x0d, 0x8c, 0x82, 0x21, 0x11, 0xe2, 0x84, 0xc8, 0x48, 0x28,
+  0x10, 0x44, 0x74, 0x41, 0x6c, 0x22, 0x43, 0x08, 0x8a, 0x04, 0xae, 0x42,
+  0x42, 0x41, 0x00, 0xa4, 0x18, 0x48, 0x80, 0x82, 0x41, 0x88, 0x81, 0x02,
+  0x10, 0x08, 0x4d, 0x22, 0x84, 0x12, 0x60, 0x2a, 0xb2, 0x82, 0x28, 0x44,
+  0x6f, 0x1d, 0x01, 0x00, 0x22, 0x80, 0xa2, 0x41, 0x84, 0x22, 0x00, 0x48,
+  0x48, 0x40, 0x82, 0xe1, 0x24, 0x01, 0x44, 0x40, 0x04, 0x12, 0x00, 0x80,
+  0x02, 0x23, 0x45, 0xa8, 0x12, 0x18, 0x10, 0x04, 0xa0, 0x14, 0x10, 0x42,
+  0x89, 0x02, 0x00, 0x25, 0x02, 0x00, 0x48, 0x11, 0x16, 0x68, 0x81, 0x00,
+  0xcc, 0x1d, 0x04, 0x10, 0x04, 0x7e, 0xef, 0x00, 0x22, 0x83, 0x42, 0x71,
+  0x28, 0x62, 0xc3, 0xa9, 0xb2, 0x25, 0x84, 0x22, 0x01, 0x80, 0x81, 0x74,
+  0x1a, 0xf4, 0x44, 0x18, 0x2d, 0x28, 0x4c, 0xf4, 0x14, 0x21, 0x4c, 0xe4,
+  0x14, 0x3a, 0x58, 0x84, 0x40, 0x14, 0xd5, 0x41, 0xb4, 0x36, 0xd4, 0x84,
+  0xa2, 0x12, 0x7a, 0xc8, 0x38, 0x8f, 0x62, 0x69, 0x42, 0x12, 0x42, 0x28,
+  0x83, 0x61, 0x91, 0x00, 0x81, 0x18, 0x21, 0x29, 0xa1, 0x42, 0x48, 0x4a,
+  0x41, 0xc1, 0x18, 0x6a, 0xe1, 0x85, 0x22, 0xa7, 0x81, 0x4c, 0xb2, 0x86,
+  0x85, 0x68, 0x44, 0x8c, 0xf2, 0x92, 0x36, 0x00, 0x12, 0xe0, 0xc1, 0x32,
+  0x44, 0x48, 0x20, 0x51, 0x18, 0x11, 0x4a, 0x88, 0x54, 0x28, 0x60, 0x14,
+  0x80, 0x28, 0x61, 0x24, 0x10, 0x28, 0xa2, 0x24, 0x43, 0x02, 0x22, 0x81,
+  0xa4, 0x82, 0x40, 0x04, 0x42, 0x2c, 0x44, 0x84, 0x01, 0x25, 0x22, 0x28,
+  0x86, 0x22, 0x02, 0x81, 0x00, 0x28, 0x81, 0x84, 0x50, 0x84, 0x21, 0x70,
+  0x48, 0x24, 0x88, 0x82, 0x84, 0x12, 0xf4, 0x41, 0x71, 0x00, 0x11, 0x81,
+  0x40, 0x82, 0x02, 0x10, 0x24, 0x08, 0x00, 0x40, 0x01, 0x83, 0x04, 0x98,
+  0x82, 0x40, 0x08, 0x24, 0x14, 0x21, 0x81, 0x41, 0x80, 0x04, 0x10, 0x08,
+  0x10, 0x12, 0x11, 0x02, 0x80, 0x06, 0x00, 0x20, 0x14, 0x01, 0x00, 0x41,
+  0x83, 0x04, 0x00, 0x80, 0x24, 0x84, 0xf4, 0x48, 0x31, 0x00, 0x21, 0x28,
+  0x28, 0x19, 0x12, 0x88, 0x65, 0x91, 0x10, 0x02, 0x1c, 0xe8, 0x24, 0x28,
+  0x04, 0x42, 0x40, 0x48, 0x0e, 0x54, 0x49, 0xa1, 0x24, 0x22, 0x90, 0x2c,
+  0x12, 0xc0, 0x48, 0x11, 0xa0, 0x21, 0x32, 0x1a, 0x0a, 0xb0, 0x82, 0x01,
+  0x10, 0x91, 0x14, 0x8d, 0x84, 0x19, 0xa3, 0x16, 0x89, 0x08, 0x30, 0x41,
+  0x51, 0x44, 0xc0, 0x22, 0x20, 0x98, 0x84, 0xe6, 0x14, 0x0c, 0x84, 0x4f,
+  0xa7, 0x05, 0x24, 0x13, 0x24, 0x02, 0x34, 0x22, 0x18, 0x18, 0x45, 0x22,
+  0x48, 0x34, 0x81, 0xe6, 0x02, 0x14, 0x48, 0x10, 0xa8, 0x81, 0x88, 0x41,
+  0x25, 0x88, 0x24, 0x03, 0x82, 0x89, 0x01, 0x00, 0x90, 0x11, 0x89, 0xa3,
+  0x12, 0x85, 0x02, 0xc2, 0x00, 0xc0, 0x24, 0x84, 0x1e, 0x21, 0x48, 0x10,
+  0x44, 0xa1, 0x42, 0x44, 0x00, 0x81, 0x00, 0xe0, 0x64, 0x42, 0x04, 0x16,
+  0xf8, 0xc8, 0x65, 0x50, 0x88, 0x8b, 0x44, 0x4e, 0x48, 0x62, 0x22, 0x81,
+  0x48, 0x85, 0x01, 0x50, 0x44, 0x45, 0xb4, 0x24, 0xa2, 0x26, 0x22, 0x60,
+  0x84, 0x40, 0x0e, 0x15, 0xd2, 0x62, 0xd1, 0x22, 0xa2, 0x11, 0x2f, 0x11,
+  0xf1, 0x9a, 0xa4, 0x8a, 0x68, 0x48, 0x89, 0xc4, 0x41, 0x70, 0x21, 0x51,
+  0x11, 0x13, 0x58, 0x88, 0x85, 0xfa, 0x48, 0x53, 0x4a, 0x24, 0x44, 0xa1,
+  0x14, 0x86, 0x04, 0x1a, 0x62, 0x88, 0x4d, 0x44, 0x45, 0xf4, 0x24, 0x21,
+  0x2e, 0x21, 0x43, 0x42, 0x24, 0x16, 0x22, 0x68, 0x48, 0x86, 0x72, 0x4a,
+  0xd2, 0x22, 0xa4, 0x15, 0x7f, 0x32, 0x05, 0xbc, 0x09, 0xf3, 0x0d, 0x22,
+  0x80, 0x08, 0x18, 0x00, 0x18, 0x14, 0x21, 0x00, 0x46, 0x81, 0x82, 0x02,
+  0x00, 0x00, 0x10, 0x44, 0x28, 0x82, 0x06, 0x00, 0x00, 0x80, 0x02, 0x44,
+  0x20, 0xc1, 0x88, 0x85, 0x04, 0xf0, 0x02, 0x81, 0xf0, 0x77, 0xf2, 0x30,
   0x28, 0x84, 0x42, 0x48, 0x00, 0x80, 0x01, 0x80, 0x14, 0x54, 0x42, 0xa2,
-  0x28, 0x00, 0x00, 0x80, 0x44, 0x02, 0x21, 0x12, 0x18, 0x13, 0xa8, 0x84,
+  0x64, 0x0b, 0xf1, 0x53, 0x44, 0x02, 0x21, 0x12, 0x18, 0x13, 0xa8, 0x84,
   0x10, 0x36, 0x12, 0x90, 0x81, 0x14, 0x10, 0x48, 0x2c, 0x84, 0x44, 0x02,
   0x00, 0x00, 0x90, 0x14, 0x44, 0x22, 0x1c, 0x03, 0x00, 0xc1, 0x20, 0x48,
   0x02, 0x21, 0x9d, 0x2a, 0x40, 0x48, 0x8c, 0x24, 0x12, 0x11, 0x14, 0x18,
@@ -1985,408 +1670,63 @@ const unsigned char USB_1208HS_rbf[] = {
   0x25, 0x39, 0x12, 0x18, 0x82, 0x88, 0x88, 0x00, 0x00, 0x1c, 0x21, 0x18,
   0xc8, 0x28, 0x80, 0x84, 0x04, 0x60, 0x81, 0x22, 0x30, 0x42, 0x48, 0x44,
   0x44, 0x28, 0x28, 0x00, 0x80, 0x01, 0x2a, 0x04, 0x21, 0x23, 0xf1, 0x62,
-  0xbc, 0x00, 0x48, 0x40, 0x02, 0x21, 0x00, 0x00, 0x44, 0x80, 0x02, 0x11,
-  0x80, 0x08, 0x00, 0x10, 0x02, 0x18, 0x48, 0x89, 0x08, 0x00, 0x00, 0x14,
-  0x00, 0x84, 0x80, 0x04, 0x00, 0x14, 0x00, 0x20, 0x48, 0x44, 0x82, 0x02,
-  0x00, 0x21, 0x00, 0x00, 0x21, 0x80, 0xf1, 0x89, 0xbe, 0x00, 0x00, 0x14,
-  0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x20, 0x02, 0x00,
-  0x10, 0x01, 0x00, 0x00, 0x50, 0x24, 0x00, 0x00, 0x10, 0x12, 0x04, 0x11,
-  0x00, 0x00, 0x20, 0x08, 0x00, 0x84, 0x20, 0x84, 0x18, 0x04, 0xf0, 0xf8,
-  0x1e, 0x10, 0x78, 0x48, 0x28, 0xa4, 0x44, 0x00, 0x20, 0x12, 0x01, 0x41,
-  0x45, 0x74, 0x64, 0x24, 0xa2, 0x22, 0x00, 0x00, 0x40, 0x46, 0x42, 0x32,
-  0x12, 0x12, 0xba, 0xe1, 0x88, 0xa8, 0x88, 0x00, 0x21, 0x11, 0x19, 0x58,
-  0x11, 0x81, 0x81, 0x87, 0x84, 0xc2, 0x4a, 0x04, 0x40, 0x81, 0x02, 0x10,
-  0x54, 0x44, 0xc7, 0x42, 0x2a, 0xa2, 0x62, 0x00, 0x00, 0x28, 0x45, 0x42,
-  0x52, 0x22, 0x23, 0xf1, 0x97, 0x92, 0x80, 0x31, 0x18, 0x20, 0x34, 0x24,
-  0x00, 0x00, 0x14, 0x42, 0x81, 0x45, 0x08, 0x22, 0x12, 0xc0, 0x84, 0x00,
-  0x00, 0x26, 0x82, 0x02, 0x12, 0x20, 0x98, 0x48, 0x00, 0x24, 0x24, 0x19,
-  0x81, 0x01, 0x8b, 0x81, 0x44, 0x42, 0x00, 0x00, 0x40, 0x11, 0x18, 0x18,
-  0x24, 0x24, 0x02, 0x00, 0x00, 0x00, 0x24, 0x26, 0xf4, 0xf8, 0x8e, 0x00,
-  0x40, 0x04, 0x40, 0x11, 0x01, 0x84, 0x81, 0x84, 0x48, 0x10, 0x82, 0x44,
-  0x02, 0x12, 0x10, 0x04, 0x00, 0x44, 0x28, 0x11, 0x00, 0x00, 0x30, 0x42,
-  0x18, 0x80, 0xa8, 0x81, 0x00, 0x00, 0x11, 0x00, 0x15, 0x18, 0x28, 0x04,
-  0x42, 0x21, 0x40, 0x02, 0x49, 0x08, 0x86, 0x04, 0x22, 0x28, 0xe0, 0x12,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00,
-  0x44, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x28,
-  0x00, 0x00, 0x00, 0x42, 0x00, 0x80, 0x01, 0x00, 0x00, 0x40, 0x04, 0x4f,
-  0xe4, 0x09, 0x32, 0x12, 0x44, 0x22, 0x10, 0x01, 0x50, 0x89, 0x11, 0x42,
-  0x87, 0x21, 0x81, 0x21, 0xc0, 0x12, 0x23, 0xd8, 0x44, 0x09, 0x11, 0x49,
-  0x02, 0x22, 0x41, 0x62, 0x85, 0x01, 0x42, 0x44, 0xc1, 0x18, 0xc0, 0x92,
-  0x20, 0x28, 0x22, 0x09, 0x40, 0x42, 0x51, 0x81, 0x2a, 0x52, 0x21, 0x13,
-  0xa8, 0x44, 0x85, 0x02, 0x23, 0x68, 0x11, 0x18, 0x90, 0x84, 0x87, 0x41,
-  0x88, 0x43, 0x08, 0x00, 0x4f, 0x26, 0x06, 0x00, 0x10, 0x41, 0x16, 0x04,
-  0x26, 0x08, 0x81, 0x89, 0x04, 0x42, 0x42, 0x52, 0x00, 0x30, 0x18, 0x41,
-  0x82, 0x22, 0x20, 0x02, 0x40, 0x01, 0x84, 0x25, 0x02, 0x2c, 0x04, 0x16,
-  0x02, 0x92, 0x60, 0x48, 0xa2, 0x28, 0x55, 0x04, 0xd0, 0x88, 0x98, 0x48,
-  0x20, 0x15, 0x28, 0x04, 0x24, 0x82, 0x84, 0x80, 0x24, 0x04, 0x83, 0x32,
-  0x24, 0xbf, 0x3e, 0x0e, 0x10, 0x04, 0xd0, 0x12, 0x02, 0x1d, 0x18, 0x1b,
-  0x21, 0x24, 0x82, 0x20, 0x04, 0x82, 0x14, 0x11, 0x40, 0x08, 0x48, 0x42,
-  0x49, 0x12, 0x4d, 0x01, 0x22, 0x15, 0x08, 0x48, 0xd0, 0x22, 0x22, 0x26,
-  0x99, 0x84, 0x12, 0x10, 0x04, 0x10, 0x02, 0x18, 0x13, 0x01, 0x10, 0x08,
-  0x42, 0x20, 0x04, 0x21, 0x00, 0x43, 0x82, 0x3a, 0x24, 0x41, 0xf0, 0x66,
-  0x6e, 0xf0, 0x26, 0x26, 0x2d, 0x22, 0x2a, 0xb3, 0x12, 0x21, 0x91, 0x12,
-  0xc0, 0x12, 0x25, 0x92, 0x82, 0x2f, 0x31, 0xf1, 0x13, 0x11, 0x1b, 0x98,
-  0x9e, 0x99, 0x8d, 0x88, 0x8f, 0x18, 0xec, 0x84, 0x24, 0xd4, 0x91, 0x54,
-  0x11, 0x1c, 0x54, 0x99, 0x85, 0xe8, 0x84, 0xf4, 0x48, 0x4c, 0x4d, 0x44,
-  0x4b, 0x64, 0x2e, 0x24, 0x22, 0x4c, 0x02, 0x28, 0x45, 0x54, 0x44, 0x2e,
-  0x24, 0x6f, 0x62, 0xd2, 0x22, 0xa2, 0x32, 0x2b, 0x11, 0x1a, 0xb8, 0x82,
-  0x29, 0xc8, 0x92, 0x25, 0x92, 0x82, 0x2f, 0x31, 0xf1, 0x13, 0x11, 0x1b,
-  0x98, 0x9e, 0x99, 0x8d, 0x88, 0x8b, 0xc8, 0x4e, 0x48, 0x42, 0x8c, 0x04,
-  0x48, 0x85, 0x58, 0x88, 0x4e, 0x48, 0x3d, 0x5d, 0xf0, 0x26, 0x22, 0x27,
-  0x21, 0x2a, 0xa1, 0x11, 0x23, 0x01, 0x18, 0x50, 0x22, 0x31, 0x3c, 0xf1,
-  0x11, 0x11, 0x99, 0xe8, 0x89, 0x78, 0x48, 0xb9, 0x88, 0xa4, 0x44, 0x46,
-  0x48, 0xd1, 0x11, 0x04, 0x15, 0x58, 0x88, 0x49, 0xf4, 0x48, 0x44, 0x47,
-  0x42, 0x4b, 0x24, 0x2a, 0x62, 0x42, 0x80, 0x02, 0x44, 0x45, 0x86, 0xf2,
-  0x26, 0x22, 0x27, 0x21, 0x2a, 0xa1, 0x19, 0x2b, 0x81, 0x8a, 0xa8, 0x18,
-  0xd0, 0x22, 0x18, 0xc3, 0x13, 0x1f, 0x11, 0x91, 0x89, 0x9e, 0x88, 0x87,
-  0x94, 0x8b, 0x48, 0x4a, 0x64, 0x84, 0x80, 0x04, 0x84, 0x85, 0x98, 0x44,
-  0x1f, 0xd4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x4f, 0x21,
+  0xbc, 0x00, 0x48, 0x40, 0x02, 0x21, 0x0a, 0x05, 0x91, 0x11, 0x80, 0x08,
+  0x00, 0x10, 0x02, 0x18, 0x48, 0x89, 0x0d, 0x05, 0xd0, 0x84, 0x80, 0x04,
+  0x00, 0x14, 0x00, 0x20, 0x48, 0x44, 0x82, 0x02, 0x00, 0x21, 0x82, 0x06,
+  0x30, 0xf1, 0x89, 0xbe, 0x18, 0x00, 0x21, 0x10, 0x01, 0x48, 0x0f, 0x31,
+  0x08, 0x20, 0x02, 0x0b, 0x00, 0x90, 0x50, 0x24, 0x00, 0x00, 0x10, 0x12,
+  0x04, 0x11, 0x00, 0x6a, 0x06, 0xf0, 0x66, 0x84, 0x20, 0x84, 0x18, 0x04,
+  0xf0, 0xf8, 0x1e, 0x10, 0x78, 0x48, 0x28, 0xa4, 0x44, 0x00, 0x20, 0x12,
+  0x01, 0x41, 0x45, 0x74, 0x64, 0x24, 0xa2, 0x22, 0x00, 0x00, 0x40, 0x46,
+  0x42, 0x32, 0x12, 0x12, 0xba, 0xe1, 0x88, 0xa8, 0x88, 0x00, 0x21, 0x11,
+  0x19, 0x58, 0x11, 0x81, 0x81, 0x87, 0x84, 0xc2, 0x4a, 0x04, 0x40, 0x81,
+  0x02, 0x10, 0x54, 0x44, 0xc7, 0x42, 0x2a, 0xa2, 0x62, 0x00, 0x00, 0x28,
+  0x45, 0x42, 0x52, 0x22, 0x23, 0xf1, 0x97, 0x92, 0x80, 0x31, 0x18, 0x20,
+  0x34, 0x24, 0x00, 0x00, 0x14, 0x42, 0x81, 0x45, 0x08, 0x22, 0x12, 0xc0,
+  0x84, 0x00, 0x00, 0x26, 0x82, 0x02, 0x12, 0x20, 0x98, 0x48, 0x00, 0x24,
+  0x24, 0x19, 0x81, 0x01, 0x8b, 0x81, 0x44, 0x42, 0x00, 0x00, 0x40, 0x11,
+  0x18, 0x18, 0x24, 0x24, 0xc2, 0x05, 0xf0, 0x26, 0x24, 0x26, 0xf4, 0xf8,
+  0x8e, 0x00, 0x40, 0x04, 0x40, 0x11, 0x01, 0x84, 0x81, 0x84, 0x48, 0x10,
+  0x82, 0x44, 0x02, 0x12, 0x10, 0x04, 0x00, 0x44, 0x28, 0x11, 0x00, 0x00,
+  0x30, 0x42, 0x18, 0x80, 0xa8, 0x81, 0x00, 0x00, 0x11, 0x00, 0x15, 0x18,
+  0x28, 0x04, 0x42, 0x21, 0x40, 0x02, 0x49, 0x08, 0x86, 0x04, 0x22, 0x28,
+  0xe0, 0x76, 0x0d, 0x00, 0x01, 0x00, 0x10, 0x20, 0x5a, 0x0b, 0x33, 0x44,
+  0x41, 0x11, 0xfb, 0x05, 0x30, 0x82, 0x28, 0x00, 0x1f, 0x0e, 0xf0, 0x4d,
+  0x80, 0x01, 0x00, 0x00, 0x40, 0x04, 0x4f, 0xe4, 0x09, 0x32, 0x12, 0x44,
+  0x22, 0x10, 0x01, 0x50, 0x89, 0x11, 0x42, 0x87, 0x21, 0x81, 0x21, 0xc0,
+  0x12, 0x23, 0xd8, 0x44, 0x09, 0x11, 0x49, 0x02, 0x22, 0x41, 0x62, 0x85,
+  0x01, 0x42, 0x44, 0xc1, 0x18, 0xc0, 0x92, 0x20, 0x28, 0x22, 0x09, 0x40,
+  0x42, 0x51, 0x81, 0x2a, 0x52, 0x21, 0x13, 0xa8, 0x44, 0x85, 0x02, 0x23,
+  0x68, 0x11, 0x18, 0x90, 0x84, 0x87, 0x41, 0x88, 0x43, 0x08, 0x00, 0x4f,
+  0x26, 0x06, 0x00, 0x10, 0x41, 0x16, 0x04, 0x26, 0x08, 0x81, 0x89, 0x04,
+  0x42, 0x42, 0x52, 0x00, 0x30, 0x18, 0x41, 0x82, 0xa6, 0x0f, 0xfa, 0x97,
+  0x01, 0x84, 0x25, 0x02, 0x2c, 0x04, 0x16, 0x02, 0x92, 0x60, 0x48, 0xa2,
+  0x28, 0x55, 0x04, 0xd0, 0x88, 0x98, 0x48, 0x20, 0x15, 0x28, 0x04, 0x24,
+  0x82, 0x84, 0x80, 0x24, 0x04, 0x83, 0x32, 0x24, 0xbf, 0x3e, 0x0e, 0x10,
+  0x04, 0xd0, 0x12, 0x02, 0x1d, 0x18, 0x1b, 0x21, 0x24, 0x82, 0x20, 0x04,
+  0x82, 0x14, 0x11, 0x40, 0x08, 0x48, 0x42, 0x49, 0x12, 0x4d, 0x01, 0x22,
+  0x15, 0x08, 0x48, 0xd0, 0x22, 0x22, 0x26, 0x99, 0x84, 0x12, 0x10, 0x04,
+  0x10, 0x02, 0x18, 0x13, 0x01, 0x10, 0x08, 0x42, 0x20, 0x04, 0x21, 0x00,
+  0x43, 0x82, 0x3a, 0x24, 0x41, 0xf0, 0x66, 0x6e, 0xf0, 0x26, 0x26, 0x2d,
+  0x22, 0x2a, 0xb3, 0x12, 0x21, 0x91, 0x12, 0xc0, 0x12, 0x25, 0x92, 0x82,
+  0x2f, 0x31, 0xf1, 0x13, 0x11, 0x1b, 0x98, 0x9e, 0x99, 0x8d, 0x88, 0x8f,
+  0x18, 0xec, 0x84, 0x24, 0xd4, 0x91, 0x54, 0x11, 0x1c, 0x54, 0x99, 0x85,
+  0xe8, 0x84, 0xf4, 0x48, 0x4c, 0x4d, 0x44, 0x4b, 0x64, 0x2e, 0x24, 0x22,
+  0x4c, 0x02, 0x28, 0x45, 0x54, 0x44, 0x2e, 0x24, 0x6f, 0x62, 0xd2, 0x22,
+  0xa2, 0x32, 0x2b, 0x11, 0x1a, 0xb8, 0x82, 0x29, 0xc8, 0x92, 0x3d, 0x00,
+  0xf2, 0x34, 0x8b, 0xc8, 0x4e, 0x48, 0x42, 0x8c, 0x04, 0x48, 0x85, 0x58,
+  0x88, 0x4e, 0x48, 0x3d, 0x5d, 0xf0, 0x26, 0x22, 0x27, 0x21, 0x2a, 0xa1,
+  0x11, 0x23, 0x01, 0x18, 0x50, 0x22, 0x31, 0x3c, 0xf1, 0x11, 0x11, 0x99,
+  0xe8, 0x89, 0x78, 0x48, 0xb9, 0x88, 0xa4, 0x44, 0x46, 0x48, 0xd1, 0x11,
+  0x04, 0x15, 0x58, 0x88, 0x49, 0xf4, 0x48, 0x44, 0x47, 0x42, 0x4b, 0x24,
+  0x2a, 0x62, 0x42, 0x80, 0x02, 0x44, 0x45, 0x86, 0xf2, 0x33, 0x00, 0xf5,
+  0x12, 0x19, 0x2b, 0x81, 0x8a, 0xa8, 0x18, 0xd0, 0x22, 0x18, 0xc3, 0x13,
+  0x1f, 0x11, 0x91, 0x89, 0x9e, 0x88, 0x87, 0x94, 0x8b, 0x48, 0x4a, 0x64,
+  0x84, 0x80, 0x04, 0x84, 0x85, 0x98, 0x44, 0x1f, 0xd4, 0x0e, 0x89, 0x07,
+  0x0f, 0x01, 0x00, 0x01, 0x3f, 0xf0, 0x4f, 0xfe, 0x16, 0x00, 0x00, 0x07,
+  0x01, 0x00, 0x3f, 0xff, 0xe4, 0x0f, 0x16, 0x00, 0x00, 0x06, 0x01, 0x00,
+  0x0f, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x8f, 0x4f, 0x21,
   0x02, 0x14, 0x9c, 0x84, 0x04, 0x2a, 0x44, 0x18, 0x32, 0x25, 0x21, 0x22,
   0x54, 0x44, 0x4c, 0x02, 0x24, 0x44, 0x34, 0x24, 0x8b, 0x2d, 0x82, 0x50,
   0x82, 0x82, 0x90, 0x11, 0x18, 0x11, 0x19, 0x11, 0x18, 0x08, 0x8b, 0x84,
@@ -2421,1792 +1761,1747 @@ const unsigned char USB_1208HS_rbf[] = {
   0x08, 0x86, 0x02, 0x00, 0x81, 0x2d, 0x89, 0x00, 0x10, 0x81, 0xc4, 0x41,
   0x15, 0x08, 0x8d, 0x41, 0x14, 0x10, 0x04, 0x22, 0x00, 0x10, 0x04, 0x10,
   0x44, 0xb4, 0x24, 0x21, 0x91, 0x22, 0x80, 0x01, 0xf0, 0xc4, 0x15, 0x00,
-  0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x98, 0x02, 0x52, 0x12, 0x40,
-  0xb4, 0x12, 0xd4, 0x94, 0x81, 0x92, 0x11, 0x48, 0x99, 0x21, 0x82, 0x0a,
-  0x24, 0x60, 0x44, 0x28, 0x49, 0x83, 0x8c, 0xc2, 0x48, 0x41, 0x1b, 0xc2,
-  0x28, 0x26, 0x68, 0x96, 0x48, 0x4c, 0x01, 0x42, 0x88, 0x60, 0x48, 0x20,
-  0x81, 0x04, 0x88, 0x4c, 0x19, 0xd1, 0x41, 0x22, 0x18, 0x11, 0x3a, 0x45,
-  0xc0, 0xa8, 0x1b, 0x84, 0x18, 0x43, 0x81, 0x29, 0x51, 0x42, 0x42, 0xa1,
-  0x8c, 0x18, 0x14, 0xa4, 0x42, 0x3f, 0xed, 0x49, 0x71, 0x22, 0x02, 0x27,
-  0xc2, 0x11, 0x19, 0x32, 0x42, 0x24, 0x44, 0x81, 0x8a, 0xa6, 0x85, 0x1e,
-  0x41, 0xc2, 0x10, 0x31, 0x88, 0x1f, 0x24, 0xc1, 0xc2, 0x8d, 0x14, 0x46,
-  0xa8, 0x18, 0x4a, 0xd2, 0x84, 0x81, 0x54, 0x26, 0x60, 0x21, 0xb4, 0xb6,
-  0x63, 0x68, 0x18, 0x89, 0x62, 0x21, 0x2e, 0x82, 0x86, 0x12, 0x84, 0x68,
-  0x81, 0x24, 0x42, 0x30, 0x58, 0x26, 0xec, 0x38, 0x31, 0xa8, 0x8c, 0x61,
-  0x34, 0x20, 0xd8, 0x82, 0x18, 0x52, 0x48, 0x83, 0x96, 0x94, 0x6a, 0xd8,
-  0x42, 0x84, 0x24, 0x4a, 0xd8, 0xeb, 0x0e, 0x1a, 0x24, 0x71, 0x28, 0x54,
-  0x14, 0x27, 0x35, 0x5d, 0x48, 0xc0, 0x15, 0x83, 0xd4, 0x81, 0xa1, 0x52,
-  0x13, 0x88, 0x0c, 0x21, 0xc4, 0x28, 0x4b, 0x92, 0x4b, 0x94, 0x62, 0x4e,
-  0x88, 0x44, 0x9c, 0xef, 0x24, 0x72, 0x24, 0xf8, 0x22, 0x41, 0x2c, 0xd4,
-  0x68, 0x21, 0x9a, 0x42, 0x2b, 0x81, 0x26, 0x68, 0x28, 0x8e, 0x22, 0x88,
-  0x4c, 0x24, 0x98, 0x88, 0x86, 0x34, 0x43, 0x22, 0xc2, 0x28, 0x99, 0x68,
-  0x54, 0x81, 0x1f, 0x84, 0x3a, 0x83, 0x2c, 0xd1, 0x24, 0x81, 0x99, 0x14,
-  0x6b, 0x42, 0xd6, 0xb4, 0x28, 0x5c, 0x84, 0x46, 0x14, 0x74, 0x68, 0xf2,
-  0xb8, 0x24, 0x70, 0x22, 0x02, 0x21, 0x20, 0x22, 0x61, 0x22, 0x00, 0x8a,
-  0x86, 0xa8, 0x61, 0x00, 0x14, 0x8a, 0xe4, 0x34, 0x81, 0x14, 0x4a, 0x88,
-  0xa1, 0x42, 0x44, 0x00, 0x84, 0x12, 0x11, 0x16, 0x91, 0x84, 0x00, 0x16,
-  0x04, 0x12, 0x21, 0x80, 0x21, 0x01, 0x15, 0x94, 0x18, 0x15, 0xdc, 0x22,
-  0xe1, 0x88, 0x82, 0x01, 0x42, 0x82, 0x89, 0x08, 0x81, 0x84, 0x24, 0xb0,
-  0x42, 0x08, 0xa8, 0xf0, 0x26, 0x7e, 0x40, 0x02, 0x2a, 0x01, 0x26, 0x02,
-  0x30, 0x11, 0x23, 0x02, 0x30, 0x11, 0x88, 0x00, 0x48, 0x4a, 0x22, 0x88,
-  0x83, 0x04, 0x86, 0x48, 0x04, 0x28, 0x80, 0x42, 0x08, 0x29, 0x05, 0x48,
-  0xe0, 0x22, 0x21, 0x28, 0xc2, 0x24, 0x88, 0xd0, 0x22, 0x28, 0x41, 0x01,
-  0x98, 0x28, 0x00, 0x42, 0x13, 0x08, 0x12, 0x28, 0x82, 0x20, 0x01, 0x82,
-  0x4c, 0xe2, 0x82, 0xe4, 0x5b, 0x0e, 0x13, 0x74, 0x11, 0x16, 0x84, 0xc2,
-  0x48, 0x18, 0x4b, 0x34, 0x30, 0x51, 0x92, 0x4e, 0x21, 0x21, 0xb4, 0x19,
-  0xc4, 0x82, 0x98, 0x67, 0x11, 0x2f, 0x12, 0x01, 0x2b, 0x18, 0x1c, 0x31,
-  0x14, 0x8b, 0xc1, 0x1b, 0x42, 0x34, 0xd0, 0x18, 0x31, 0x22, 0x1f, 0x82,
-  0x81, 0x22, 0xc7, 0x32, 0x41, 0x42, 0x68, 0x88, 0x12, 0x14, 0x41, 0x1a,
-  0x62, 0x18, 0x43, 0x28, 0x65, 0x12, 0x93, 0xe8, 0x16, 0xa8, 0x28, 0x85,
-  0x01, 0x90, 0x84, 0xc1, 0x20, 0x88, 0x88, 0x36, 0x64, 0x12, 0xf0, 0xfa,
-  0x7e, 0x50, 0x21, 0x16, 0x94, 0x36, 0xc0, 0x42, 0xa0, 0x52, 0x1c, 0x31,
-  0x32, 0x82, 0x26, 0x82, 0x61, 0x38, 0x14, 0x2c, 0x28, 0x3c, 0x45, 0x28,
-  0x24, 0x4a, 0x18, 0x11, 0xa4, 0x48, 0x22, 0x11, 0x21, 0x22, 0x21, 0x99,
-  0x93, 0x12, 0x28, 0x46, 0x12, 0x24, 0x94, 0xc2, 0x30, 0x14, 0x14, 0x10,
-  0x62, 0x18, 0x41, 0x52, 0x13, 0x68, 0x1a, 0xaa, 0x24, 0x6a, 0x14, 0x00,
-  0x92, 0x8c, 0x02, 0x82, 0x12, 0x4a, 0xe2, 0x44, 0x02, 0x81, 0xef, 0xbf,
-  0x0d, 0x42, 0x14, 0x20, 0x32, 0x28, 0x12, 0x44, 0x90, 0x41, 0x18, 0x46,
-  0x41, 0x41, 0x88, 0x04, 0x18, 0x2f, 0x22, 0xe1, 0x18, 0xa1, 0x12, 0x18,
-  0x12, 0x96, 0x78, 0x18, 0xc4, 0x41, 0x22, 0x70, 0x18, 0x61, 0x82, 0xa0,
-  0x24, 0x52, 0x38, 0xa0, 0x12, 0x22, 0xa8, 0x28, 0x88, 0x44, 0x1e, 0xa2,
-  0x12, 0x1c, 0x08, 0x2a, 0x11, 0x48, 0x01, 0x81, 0x19, 0x08, 0x44, 0x41,
-  0x82, 0x80, 0x08, 0x82, 0x49, 0xa3, 0x42, 0xcf, 0x21, 0x44, 0x02, 0x50,
-  0x12, 0x60, 0x85, 0x1c, 0x42, 0x93, 0x24, 0x90, 0x42, 0x42, 0x2c, 0xa4,
-  0x12, 0x14, 0x3c, 0x61, 0x32, 0x00, 0x1a, 0x44, 0x92, 0x11, 0x23, 0x26,
-  0x24, 0x11, 0x42, 0x01, 0x49, 0x07, 0x2f, 0x21, 0xc2, 0x28, 0x21, 0x88,
-  0x2b, 0x84, 0x2c, 0x84, 0x29, 0x44, 0x44, 0x18, 0x84, 0x18, 0x38, 0x58,
-  0x84, 0x8b, 0x14, 0x43, 0x28, 0x22, 0x03, 0x20, 0x82, 0xe1, 0x42, 0xd1,
-  0x84, 0x4a, 0x68, 0x21, 0x42, 0x44, 0x83, 0xff, 0xa8, 0x4f, 0x20, 0x21,
-  0x41, 0x02, 0x90, 0x42, 0x00, 0x42, 0x22, 0x87, 0x43, 0x35, 0x68, 0x82,
-  0x42, 0x00, 0x28, 0x89, 0x22, 0x92, 0x44, 0x28, 0x21, 0x2a, 0x31, 0x78,
-  0x89, 0x02, 0x28, 0x40, 0x18, 0x04, 0x1d, 0x5a, 0xc4, 0x44, 0x1e, 0x21,
-  0x41, 0x42, 0x84, 0x40, 0x08, 0x8e, 0x24, 0x28, 0x21, 0xb0, 0x44, 0xe1,
-  0x24, 0x31, 0x28, 0x21, 0x21, 0x25, 0x88, 0x08, 0x20, 0x63, 0x2c, 0xa8,
-  0x20, 0xf1, 0xb9, 0x95, 0x20, 0x22, 0x02, 0x1a, 0x62, 0x42, 0x87, 0x41,
-  0x44, 0x16, 0x91, 0x24, 0x11, 0x80, 0x42, 0x41, 0x12, 0x38, 0x14, 0x88,
-  0x16, 0x45, 0xc1, 0x28, 0xc4, 0x44, 0x40, 0x04, 0x42, 0x46, 0x12, 0x08,
-  0x48, 0x4c, 0x01, 0x42, 0x22, 0x41, 0x24, 0x20, 0x88, 0x83, 0x44, 0xa8,
-  0x41, 0x21, 0x14, 0x86, 0x02, 0x00, 0x58, 0x00, 0x44, 0x20, 0xa4, 0x48,
-  0xa1, 0x90, 0x48, 0x64, 0x4f, 0xda, 0x45, 0xa2, 0x12, 0x2a, 0x11, 0x83,
-  0x71, 0x68, 0x62, 0x51, 0x55, 0x92, 0x15, 0x68, 0x33, 0xe4, 0xa2, 0xd4,
-  0x21, 0x34, 0x18, 0x13, 0x74, 0x18, 0x33, 0x24, 0x29, 0x4a, 0x84, 0xc6,
-  0x2c, 0x8f, 0x51, 0x62, 0x46, 0x72, 0x87, 0x22, 0x89, 0x62, 0x14, 0x42,
-  0x4d, 0x78, 0x85, 0xe2, 0x44, 0x52, 0x42, 0x87, 0x21, 0x8b, 0x84, 0x4b,
-  0x48, 0x17, 0x64, 0x16, 0x14, 0xc2, 0x88, 0x89, 0x82, 0x94, 0x88, 0xcf,
-  0x21, 0x6e, 0x22, 0x84, 0x8d, 0x82, 0x4a, 0x68, 0x25, 0xa4, 0x16, 0x42,
-  0xc2, 0x28, 0x4c, 0xa8, 0x12, 0x49, 0xc6, 0x22, 0x92, 0xaa, 0x14, 0xf8,
-  0x28, 0x44, 0x97, 0xe7, 0x00, 0x40, 0x82, 0x92, 0x14, 0x8c, 0x06, 0x28,
-  0x41, 0x28, 0x18, 0x8c, 0x42, 0x01, 0x21, 0x13, 0x01, 0x17, 0x83, 0x1c,
-  0x81, 0x14, 0x02, 0x90, 0x44, 0x00, 0x28, 0x21, 0x80, 0xb1, 0x18, 0x92,
-  0x42, 0x44, 0x23, 0xa2, 0x21, 0x88, 0x10, 0x24, 0x11, 0x0c, 0xe0, 0x81,
-  0x44, 0xa1, 0x41, 0x18, 0x28, 0x18, 0x48, 0x00, 0x18, 0x41, 0x89, 0xe8,
-  0x89, 0x34, 0x48, 0x60, 0x44, 0x86, 0xf2, 0x7d, 0xfb, 0x80, 0x02, 0x1a,
-  0x02, 0x40, 0x01, 0x2a, 0x41, 0x08, 0x10, 0x1a, 0x24, 0x04, 0x18, 0x00,
-  0x00, 0x83, 0x04, 0x66, 0x02, 0x81, 0x80, 0x01, 0x21, 0x00, 0x12, 0x8d,
-  0x14, 0x14, 0x4c, 0x04, 0xc0, 0x22, 0x18, 0x12, 0x20, 0x09, 0x29, 0x41,
-  0x2a, 0x22, 0x98, 0x22, 0x20, 0x44, 0x08, 0x00, 0x44, 0x18, 0xa0, 0x24,
-  0xf0, 0x34, 0xb7, 0x00, 0x28, 0x25, 0x04, 0x00, 0x13, 0x12, 0x02, 0x40,
-  0x84, 0x18, 0x02, 0x00, 0x20, 0x01, 0x80, 0x21, 0x04, 0x20, 0x22, 0x01,
-  0x48, 0x20, 0x81, 0x02, 0x00, 0x40, 0x82, 0x02, 0x42, 0x00, 0x20, 0x02,
-  0x21, 0x20, 0x02, 0x00, 0x88, 0x00, 0x20, 0x02, 0x2a, 0x08, 0x48, 0x3a,
-  0x0f, 0x20, 0x81, 0x42, 0x04, 0x00, 0x20, 0xa1, 0x42, 0x81, 0x00, 0x00,
-  0x28, 0x2c, 0x01, 0x14, 0x83, 0x04, 0x00, 0xa1, 0x11, 0x26, 0x02, 0x81,
-  0x24, 0x83, 0xa2, 0x12, 0x89, 0x28, 0x02, 0xa0, 0x42, 0x12, 0x30, 0x24,
-  0x84, 0x12, 0x84, 0x00, 0x40, 0x08, 0x00, 0x00, 0x84, 0x00, 0x00, 0x20,
-  0x12, 0xf2, 0xe8, 0xa4, 0x40, 0x4a, 0x62, 0x41, 0x22, 0x00, 0x2c, 0x22,
-  0x15, 0x02, 0x00, 0x83, 0x81, 0x12, 0x08, 0x81, 0x52, 0x29, 0x81, 0x32,
-  0x22, 0x26, 0x08, 0x62, 0x22, 0x84, 0x20, 0x21, 0x01, 0x80, 0x01, 0x8c,
-  0x04, 0x82, 0x11, 0x44, 0x20, 0x8a, 0x02, 0x30, 0x88, 0x21, 0x18, 0x25,
-  0x04, 0x30, 0x28, 0x00, 0x14, 0x00, 0x00, 0x29, 0x04, 0xff, 0x1b, 0x0b,
-  0x28, 0x23, 0x01, 0x28, 0x40, 0x45, 0x08, 0x12, 0x88, 0x16, 0x0a, 0x30,
-  0x84, 0x18, 0x88, 0x40, 0x02, 0x24, 0x46, 0xa8, 0x48, 0x4a, 0x81, 0x46,
-  0x28, 0x01, 0x90, 0x11, 0x42, 0x10, 0x41, 0x08, 0x42, 0x48, 0x2c, 0x82,
-  0x42, 0x04, 0x28, 0x24, 0x22, 0x10, 0x48, 0x04, 0x18, 0x13, 0x88, 0x11,
-  0x08, 0x20, 0x91, 0x28, 0x2c, 0x02, 0xb0, 0x84, 0xf1, 0x74, 0xcb, 0x40,
-  0x98, 0x28, 0x00, 0x00, 0x00, 0x22, 0x28, 0xc0, 0x48, 0x28, 0x29, 0x32,
-  0x22, 0x42, 0x18, 0x49, 0x08, 0x8c, 0x4a, 0x01, 0x40, 0xa8, 0x18, 0x40,
-  0x51, 0xc2, 0x25, 0xe8, 0x22, 0x68, 0x21, 0x8c, 0x44, 0x81, 0x01, 0x30,
-  0x42, 0x48, 0x38, 0x81, 0x20, 0x13, 0x08, 0x88, 0x81, 0x44, 0x44, 0x00,
-  0x10, 0x88, 0x08, 0x82, 0x20, 0x12, 0x02, 0xad, 0x36, 0x40, 0x08, 0x00,
-  0x00, 0x11, 0x24, 0x00, 0x20, 0x01, 0x28, 0x80, 0x01, 0x60, 0x81, 0x21,
-  0x00, 0x89, 0x02, 0x00, 0x89, 0x02, 0x20, 0x41, 0x88, 0x02, 0x00, 0x00,
-  0x80, 0x24, 0x11, 0x88, 0x04, 0x21, 0x20, 0x52, 0x48, 0x00, 0x00, 0x10,
-  0x08, 0x00, 0x48, 0x21, 0xf0, 0x23, 0x6c, 0x00, 0x10, 0x08, 0x81, 0x00,
-  0x44, 0x28, 0x00, 0x18, 0x16, 0x02, 0x00, 0x14, 0x00, 0x20, 0x32, 0x24,
-  0x84, 0x18, 0x20, 0x82, 0xa1, 0x21, 0x84, 0x81, 0x11, 0x23, 0x02, 0x88,
-  0x11, 0x10, 0xc4, 0x84, 0xa0, 0x24, 0x1c, 0xc1, 0x28, 0x00, 0x00, 0x81,
-  0x00, 0x28, 0x80, 0x11, 0x08, 0x20, 0x02, 0x18, 0x29, 0xf4, 0x45, 0x56,
-  0x40, 0x48, 0x88, 0x04, 0xa0, 0x24, 0x80, 0x02, 0x00, 0x44, 0x21, 0x28,
-  0x22, 0x00, 0x21, 0x24, 0x00, 0x84, 0x21, 0x80, 0x41, 0xca, 0xa2, 0x40,
-  0x02, 0x00, 0x1c, 0x63, 0x81, 0xc0, 0x28, 0x90, 0x42, 0x00, 0x00, 0x31,
-  0x83, 0x04, 0x21, 0x37, 0x42, 0x61, 0x28, 0x81, 0x00, 0x20, 0x04, 0x00,
-  0x21, 0x84, 0xce, 0x27, 0x00, 0x84, 0x22, 0x2a, 0x12, 0x08, 0x89, 0xe2,
-  0x61, 0x03, 0xc0, 0x12, 0x8f, 0x8c, 0x61, 0xc2, 0x41, 0x20, 0xc1, 0x18,
-  0x12, 0x23, 0x71, 0x48, 0xd2, 0x98, 0xa6, 0x22, 0x2c, 0x34, 0x18, 0x8f,
-  0x82, 0x22, 0xe3, 0x22, 0xb2, 0x2e, 0x41, 0xb3, 0x88, 0xe1, 0x12, 0xb1,
-  0x19, 0x54, 0x88, 0x1a, 0x91, 0x45, 0x82, 0x2d, 0x24, 0x88, 0x4b, 0x52,
-  0x2e, 0x18, 0x89, 0xe1, 0x84, 0x23, 0x62, 0x24, 0xad, 0x88, 0x4d, 0x28,
-  0x33, 0xd8, 0x44, 0x02, 0x2a, 0x74, 0x88, 0xc8, 0x18, 0x80, 0xa1, 0x22,
-  0xa0, 0x42, 0x48, 0x65, 0xf8, 0x13, 0x67, 0x40, 0xb2, 0x2a, 0x32, 0x1c,
-  0x41, 0x50, 0x41, 0x15, 0x12, 0xb2, 0x12, 0xa2, 0xa2, 0x84, 0x23, 0xb1,
-  0x12, 0x11, 0xc2, 0x28, 0x18, 0x24, 0x6f, 0x24, 0x98, 0x11, 0x28, 0x32,
-  0x49, 0xa8, 0x36, 0x84, 0x88, 0x50, 0x12, 0x46, 0xf2, 0x12, 0x18, 0x2f,
-  0x83, 0xe6, 0xa1, 0x82, 0xb1, 0x34, 0xa3, 0x84, 0x42, 0x42, 0x2e, 0x11,
-  0x2b, 0x22, 0x29, 0x82, 0x92, 0x21, 0x85, 0xc2, 0x22, 0x92, 0x30, 0x3a,
-  0x8f, 0x22, 0x92, 0x12, 0x11, 0x38, 0x10, 0x88, 0x08, 0x8c, 0xa8, 0x21,
-  0x82, 0x6a, 0xa1, 0xc1, 0x5f, 0x5b, 0x0b, 0x2a, 0xe2, 0x21, 0xd1, 0x42,
-  0x03, 0xc0, 0x61, 0x26, 0x21, 0xe6, 0x82, 0x21, 0x54, 0x48, 0x24, 0x24,
-  0xc8, 0x2b, 0x12, 0x4a, 0x6a, 0x11, 0x18, 0xa4, 0x2f, 0x82, 0x38, 0x42,
-  0x8f, 0x84, 0x54, 0x88, 0x2b, 0x66, 0x11, 0x8d, 0x3a, 0x1e, 0x18, 0x16,
-  0x18, 0x48, 0x02, 0x2f, 0x8a, 0x02, 0x85, 0x09, 0x2e, 0x62, 0x46, 0x52,
-  0x44, 0x56, 0x34, 0xd8, 0x32, 0x3a, 0x18, 0x5b, 0x8a, 0x24, 0x24, 0x84,
-  0x80, 0x58, 0x88, 0x00, 0x85, 0x28, 0x44, 0x64, 0x22, 0x28, 0x2c, 0x22,
-  0xf4, 0x6d, 0x5a, 0x00, 0x23, 0x02, 0x00, 0x46, 0x01, 0x62, 0x12, 0x6a,
-  0x08, 0x4e, 0x82, 0xe0, 0x24, 0x08, 0x4a, 0x28, 0xe1, 0x24, 0x08, 0x88,
-  0xa0, 0x84, 0xa0, 0xa4, 0x00, 0x18, 0x90, 0x12, 0x8a, 0x92, 0x12, 0x82,
-  0x22, 0x82, 0x20, 0x08, 0x82, 0x4b, 0x12, 0x82, 0x2a, 0x21, 0x48, 0x22,
-  0xc8, 0x82, 0xc0, 0x82, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x0a,
-  0x4a, 0xf8, 0xbe, 0xb6, 0xa0, 0x44, 0x1a, 0x73, 0x1e, 0xfc, 0x24, 0x24,
-  0x8f, 0x84, 0xf4, 0x65, 0x25, 0x95, 0xf9, 0x44, 0x66, 0x4a, 0xa7, 0x88,
-  0x8f, 0x81, 0xb1, 0x4a, 0xad, 0xdd, 0x4f, 0x6c, 0xb8, 0x12, 0xa1, 0x44,
-  0x1f, 0x1c, 0xfd, 0x94, 0x94, 0x2b, 0x11, 0x8f, 0x84, 0xf6, 0x8b, 0x89,
-  0xcf, 0xc8, 0xe8, 0x81, 0x51, 0x88, 0x8f, 0x8a, 0xf8, 0x28, 0x2a, 0x3d,
-  0x13, 0xe5, 0xfe, 0xb1, 0xb9, 0x8f, 0xa7, 0xf4, 0x13, 0x11, 0xaf, 0x8d,
-  0xff, 0xb8, 0xb8, 0x8f, 0x89, 0xf1, 0x41, 0x41, 0x8e, 0xe2, 0x6f, 0x6a,
-  0x3a, 0x82, 0x1a, 0xf2, 0xc8, 0xe8, 0x1f, 0x18, 0xf9, 0xc8, 0x68, 0x1f,
-  0x12, 0xf2, 0xca, 0xc8, 0x8f, 0x88, 0xd8, 0x88, 0xf2, 0x39, 0xb1, 0x8a,
-  0xf8, 0x81, 0x81, 0x8f, 0x81, 0xc1, 0x88, 0x8f, 0x89, 0xb9, 0x88, 0xa8,
-  0x55, 0x8f, 0x82, 0xa2, 0x8a, 0xfa, 0xa7, 0xa2, 0xc7, 0xc4, 0xaf, 0x78,
-  0x01, 0x6e, 0x62, 0x5e, 0x52, 0x8f, 0xc1, 0xc1, 0x44, 0x8f, 0x84, 0xf4,
-  0x65, 0x25, 0x9f, 0x94, 0xf4, 0x36, 0x26, 0x2b, 0x54, 0x6a, 0xf6, 0xdc,
-  0xdc, 0x8f, 0xa1, 0xb9, 0xd2, 0x7f, 0x44, 0xb6, 0xd2, 0xad, 0x89, 0x1f,
-  0x3c, 0xfd, 0x54, 0x54, 0xaf, 0xad, 0xfd, 0x88, 0xaa, 0xbf, 0x9c, 0xfc,
-  0x2e, 0x64, 0x8f, 0x8d, 0xfd, 0x3a, 0x58, 0x8f, 0x8a, 0xf8, 0xa8, 0xaa,
-  0x9d, 0x1b, 0xcf, 0xe1, 0xf8, 0xb9, 0xa9, 0xaf, 0xaf, 0xfd, 0x9b, 0xb9,
-  0x9f, 0x97, 0xe5, 0x8b, 0xfb, 0x98, 0x18, 0x9f, 0x9c, 0xec, 0x26, 0xf6,
-  0xa6, 0xee, 0x27, 0x48, 0xbe, 0xa4, 0x8f, 0x84, 0xf7, 0xa9, 0x99, 0x8f,
-  0x8f, 0xf6, 0xa9, 0xab, 0xaf, 0xa4, 0x54, 0x8a, 0xaf, 0xea, 0xfa, 0x3b,
-  0xb9, 0x2b, 0xaa, 0x15, 0xf1, 0x98, 0x98, 0x8d, 0x88, 0x8f, 0x89, 0x59,
-  0x88, 0xda, 0xfd, 0xa8, 0xa8, 0xaa, 0xba, 0xf2, 0xa7, 0xe2, 0xcf, 0xc8,
-  0xfd, 0xff, 0x6d, 0xe0, 0x24, 0xe4, 0x21, 0xf7, 0x1e, 0x3c, 0x4d, 0x24,
-  0x8d, 0x48, 0x5f, 0x52, 0xf6, 0x29, 0x29, 0x6d, 0x24, 0x2b, 0x75, 0x4a,
-  0xf4, 0x18, 0x1c, 0xaf, 0x89, 0xa1, 0x79, 0x6d, 0x46, 0x2b, 0x11, 0x8a,
-  0xf8, 0xd1, 0xd1, 0x4f, 0x65, 0xf5, 0x1a, 0x18, 0xaf, 0x8e, 0xfc, 0xab,
-  0x89, 0xef, 0xc6, 0xf4, 0x38, 0x38, 0x8f, 0x8c, 0xff, 0x28, 0x28, 0x2e,
-  0x88, 0x9f, 0x91, 0x51, 0xec, 0xbf, 0x9b, 0xfb, 0xe8, 0xda, 0xbf, 0x93,
-  0xf1, 0x7a, 0x79, 0x8f, 0x81, 0xfb, 0x18, 0x98, 0x1f, 0x94, 0xe4, 0x26,
-  0xf6, 0x26, 0xe6, 0x6f, 0x42, 0xfa, 0x14, 0x34, 0x8f, 0x84, 0xf6, 0x19,
-  0xb9, 0x8f, 0xa6, 0xfe, 0x29, 0x29, 0x2f, 0x84, 0x54, 0xa8, 0xaf, 0xc2,
-  0xf2, 0xb9, 0x3b, 0x2b, 0x28, 0x15, 0xf1, 0x18, 0x18, 0x87, 0x88, 0x8f,
-  0x89, 0x51, 0x88, 0x5a, 0xf5, 0xa8, 0xa8, 0xaa, 0xba, 0x72, 0xaf, 0x62,
-  0xcf, 0xcc, 0xfd, 0xe7, 0x78, 0xe0, 0x22, 0xe2, 0x23, 0xf7, 0x3c, 0x3c,
-  0x4f, 0x46, 0xd2, 0x88, 0xf4, 0x24, 0x65, 0x95, 0xf9, 0x76, 0x64, 0x2b,
-  0x33, 0xaa, 0xfa, 0x18, 0x1e, 0xaf, 0xad, 0xf5, 0x92, 0x52, 0x6f, 0x68,
-  0xbc, 0x12, 0xa1, 0x45, 0x1f, 0x31, 0xf1, 0x94, 0x96, 0xaf, 0x85, 0xf4,
-  0x2a, 0x28, 0xbf, 0x96, 0xf6, 0xac, 0xcc, 0x8f, 0xa7, 0xf7, 0xa8, 0xc8,
-  0x87, 0x82, 0x8f, 0xa2, 0xf8, 0x3b, 0x39, 0xc7, 0xe9, 0xbf, 0x92, 0xf3,
-  0x7a, 0x5a, 0xbf, 0x92, 0xf3, 0xfa, 0xf9, 0x8f, 0x83, 0xf9, 0x18, 0x88,
-  0x1f, 0x94, 0xa4, 0xee, 0xef, 0x62, 0xda, 0x46, 0xa8, 0x33, 0x8f, 0x8c,
-  0xff, 0x39, 0xb9, 0x8f, 0xa7, 0xfe, 0x29, 0x2b, 0xaf, 0xac, 0xfc, 0x8a,
-  0x88, 0xaf, 0xa2, 0xf2, 0xbb, 0x39, 0x23, 0xf8, 0x81, 0x81, 0x8f, 0x81,
-  0x71, 0x88, 0xf8, 0x98, 0x18, 0x8f, 0x88, 0xa8, 0x55, 0x8f, 0x82, 0xa2,
-  0x22, 0x5a, 0xaf, 0x62, 0xcd, 0x4c, 0x57, 0xf7, 0x20, 0x02, 0x41, 0x00,
-  0x20, 0x02, 0x22, 0x40, 0x42, 0x08, 0x00, 0x40, 0x22, 0x01, 0x10, 0x08,
-  0x28, 0x90, 0x28, 0x80, 0x12, 0x02, 0x80, 0xa2, 0x12, 0x81, 0x18, 0x42,
-  0x22, 0x10, 0x04, 0x00, 0x2a, 0x01, 0x00, 0x24, 0x00, 0x00, 0x84, 0x00,
-  0x00, 0x28, 0x00, 0x70, 0x77, 0x07, 0x20, 0x31, 0x22, 0x00, 0x19, 0x04,
-  0x1a, 0x34, 0x42, 0xa0, 0x84, 0x82, 0x18, 0x8a, 0x04, 0x1a, 0xa4, 0x84,
-  0x82, 0x46, 0x62, 0x88, 0x28, 0x8a, 0x14, 0xe8, 0x88, 0x04, 0x10, 0xc8,
-  0x12, 0x12, 0x8c, 0x08, 0x8c, 0x08, 0x88, 0x80, 0x08, 0x29, 0x88, 0x92,
-  0x98, 0x28, 0x89, 0x08, 0xad, 0x82, 0xb0, 0x28, 0x28, 0x08, 0x80, 0x28,
-  0x08, 0x86, 0x08, 0x82, 0x20, 0x2a, 0x64, 0x18, 0x7f, 0x93, 0x0b, 0x2e,
-  0x42, 0x1f, 0x41, 0x52, 0x2a, 0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0x72,
-  0x6a, 0xf1, 0x11, 0x24, 0xab, 0x16, 0x1d, 0x2c, 0xaf, 0x24, 0x99, 0x21,
-  0xab, 0x94, 0x55, 0xb8, 0x4a, 0x79, 0x34, 0xf8, 0x4a, 0xb3, 0x57, 0x82,
-  0x2f, 0x14, 0x79, 0x34, 0xf8, 0x42, 0x91, 0x4f, 0x82, 0xe4, 0x14, 0xf9,
-  0x25, 0x4a, 0x1c, 0xfa, 0x24, 0x4a, 0x56, 0xf1, 0x24, 0x5a, 0x96, 0xf1,
-  0x22, 0x5a, 0x9e, 0x25, 0x4f, 0xa2, 0xe5, 0x4d, 0xd2, 0xa4, 0xf4, 0x91,
-  0x24, 0x2c, 0xf4, 0x91, 0x24, 0xcf, 0x32, 0xf1, 0x91, 0x24, 0xab, 0x16,
-  0x1f, 0x49, 0xf2, 0x4a, 0x12, 0x1f, 0x49, 0xf2, 0x4a, 0x12, 0x1f, 0x41,
-  0xf2, 0x4a, 0x92, 0x19, 0xb2, 0x4a, 0x19, 0xb5, 0x4a, 0xb9, 0x24, 0xb4,
-  0x4a, 0x39, 0x24, 0x2b, 0x94, 0x47, 0x83, 0x2d, 0x94, 0x4f, 0x82, 0xa4,
-  0xb4, 0x4f, 0xa2, 0xd4, 0x82, 0x05, 0x2c, 0xf4, 0x11, 0x4c, 0x8d, 0x42,
-  0x1f, 0x41, 0x22, 0x24, 0x31, 0x42, 0x11, 0xab, 0x14, 0x15, 0xf4, 0x4a,
-  0x94, 0x19, 0xf2, 0x4a, 0xb4, 0x11, 0x8b, 0xb4, 0x41, 0x2b, 0x94, 0x22,
-  0x2b, 0x94, 0x47, 0x82, 0x29, 0x79, 0x22, 0xc8, 0x91, 0x6d, 0x1a, 0x88,
-  0x4f, 0xa2, 0xad, 0x81, 0x2e, 0x4a, 0x92, 0x8c, 0x64, 0x49, 0xbc, 0xe4,
-  0x49, 0xc2, 0x4b, 0x9e, 0x2c, 0xac, 0xe4, 0x49, 0x56, 0x28, 0x1b, 0x69,
-  0x83, 0x64, 0x48, 0xa1, 0x8e, 0x24, 0x83, 0xd4, 0x41, 0xf2, 0x4a, 0x84,
-  0x28, 0xaf, 0x44, 0x1a, 0xb4, 0x4a, 0x3b, 0x24, 0xab, 0x94, 0x43, 0xb2,
-  0x42, 0x39, 0x24, 0x29, 0x79, 0x26, 0x88, 0xf8, 0x26, 0x12, 0xdf, 0xd8,
-  0x03, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x81, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0xf0, 0x18,
-  0x77, 0x00, 0x18, 0xc0, 0x22, 0x80, 0x86, 0x21, 0x62, 0x12, 0x44, 0x80,
-  0x11, 0x08, 0x85, 0x02, 0x23, 0x02, 0x5a, 0xe8, 0x62, 0xf4, 0x18, 0x21,
-  0x48, 0x18, 0x28, 0x48, 0x53, 0x92, 0x54, 0x00, 0x4c, 0x43, 0x24, 0x42,
-  0x3c, 0x44, 0x00, 0x28, 0x2a, 0x08, 0x8c, 0x59, 0x14, 0x24, 0x1c, 0x82,
-  0xb1, 0x24, 0x41, 0x02, 0x20, 0x18, 0x12, 0x14, 0x02, 0x12, 0x00, 0x43,
-  0x02, 0x83, 0xf8, 0xa8, 0xd8, 0x90, 0x42, 0x44, 0x20, 0x11, 0x04, 0x25,
-  0x02, 0x16, 0x0c, 0x12, 0x20, 0xe1, 0x84, 0x38, 0x82, 0x8a, 0x62, 0x49,
-  0x50, 0x12, 0x88, 0x48, 0x1e, 0x28, 0x94, 0x41, 0x29, 0x48, 0x12, 0x68,
-  0x12, 0x8d, 0x11, 0x2c, 0x84, 0x81, 0x84, 0x01, 0x28, 0x42, 0x16, 0x04,
-  0x27, 0x41, 0x20, 0x03, 0x16, 0xec, 0x48, 0x02, 0x89, 0x34, 0x21, 0x4a,
-  0x01, 0x41, 0x28, 0xa0, 0xa1, 0x87, 0x42, 0x2e, 0x4a, 0x4b, 0x61, 0x46,
-  0xd8, 0x18, 0xa1, 0x42, 0xdf, 0xcf, 0x47, 0x82, 0x24, 0x04, 0x18, 0x20,
-  0x24, 0x91, 0x22, 0x4c, 0x13, 0x14, 0x24, 0x31, 0x28, 0xc8, 0xa9, 0x28,
-  0xba, 0x16, 0x08, 0x1b, 0x1c, 0x6e, 0x84, 0xa7, 0x23, 0x8c, 0xc4, 0x18,
-  0x47, 0x23, 0x4a, 0x78, 0x84, 0xc2, 0x14, 0x1c, 0x82, 0x81, 0x81, 0x31,
-  0x61, 0x83, 0x31, 0x44, 0x83, 0x02, 0x66, 0x44, 0x32, 0x14, 0x1e, 0x88,
-  0x59, 0x02, 0x25, 0xe5, 0x48, 0x61, 0x42, 0x41, 0x27, 0x12, 0x6a, 0x01,
-  0x61, 0x49, 0x02, 0x8a, 0x22, 0xe1, 0xa2, 0xf4, 0x24, 0x12, 0x46, 0x8c,
-  0xb1, 0x18, 0xf8, 0x75, 0xf2, 0x00, 0x16, 0x04, 0x28, 0x61, 0x28, 0x21,
-  0x50, 0x18, 0x80, 0x01, 0x18, 0x84, 0x24, 0x80, 0x02, 0x21, 0x60, 0x14,
-  0x32, 0x14, 0x00, 0x13, 0x32, 0x48, 0x50, 0x18, 0x4f, 0x22, 0x44, 0x04,
-  0x44, 0x00, 0x48, 0x12, 0x2a, 0x08, 0x20, 0x01, 0x1e, 0x28, 0x22, 0x12,
-  0x83, 0x04, 0x20, 0x08, 0x10, 0x22, 0xd1, 0x48, 0x02, 0x42, 0x22, 0x81,
-  0x2a, 0xf4, 0x27, 0xb9, 0x40, 0xa2, 0x21, 0x25, 0xa1, 0x21, 0x00, 0x2e,
-  0x11, 0x19, 0x04, 0x92, 0x24, 0x1f, 0x88, 0x04, 0x48, 0x8d, 0x13, 0x41,
-  0x10, 0x01, 0x82, 0x18, 0x13, 0xa8, 0xa4, 0x13, 0x0a, 0x00, 0x11, 0xb0,
-  0x21, 0x04, 0x49, 0x68, 0x45, 0x88, 0x00, 0x10, 0x02, 0x41, 0x28, 0x49,
-  0x88, 0x62, 0x22, 0x00, 0x13, 0x18, 0x18, 0x51, 0x18, 0x80, 0x21, 0x01,
-  0x82, 0x28, 0x82, 0x28, 0x43, 0x78, 0xd2, 0x0c, 0x31, 0x80, 0x53, 0x94,
-  0x2d, 0x21, 0x93, 0x41, 0xc2, 0x28, 0x8b, 0x21, 0x23, 0x36, 0x21, 0x60,
-  0x81, 0x8d, 0x86, 0x4a, 0xf8, 0x49, 0x22, 0x6e, 0x91, 0xab, 0x86, 0xba,
-  0xe4, 0x14, 0xf1, 0x82, 0x21, 0x4d, 0x18, 0x53, 0x71, 0x44, 0xe8, 0x22,
-  0x84, 0x64, 0x33, 0x89, 0x86, 0x53, 0xa4, 0x87, 0x42, 0x42, 0x22, 0x43,
-  0x32, 0x24, 0x2d, 0xc1, 0x1c, 0x41, 0xb6, 0x24, 0xf1, 0x88, 0x63, 0x4c,
-  0xc1, 0x41, 0x12, 0x86, 0x24, 0xb8, 0x11, 0xba, 0x22, 0xc1, 0x81, 0x82,
-  0x6d, 0xc2, 0x4b, 0x4b, 0x2e, 0x86, 0x2c, 0xf8, 0x14, 0x42, 0x5c, 0xc3,
-  0x44, 0x1a, 0x86, 0x05, 0x4f, 0x39, 0x08, 0x24, 0x36, 0x42, 0x31, 0x34,
-  0x21, 0x15, 0xb8, 0x21, 0xb1, 0x41, 0x62, 0x83, 0xe8, 0x14, 0x3b, 0x84,
-  0x84, 0x8d, 0x82, 0x8b, 0x1c, 0xd3, 0xb6, 0x41, 0xb1, 0x48, 0x8a, 0x84,
-  0xbc, 0x81, 0xd1, 0x14, 0x49, 0xe5, 0x44, 0x8a, 0x32, 0x42, 0x24, 0x91,
-  0x12, 0x64, 0x4d, 0x28, 0x86, 0x64, 0x41, 0x82, 0x64, 0x88, 0x17, 0x21,
-  0x41, 0x70, 0x84, 0x2a, 0x31, 0x81, 0x18, 0x86, 0x94, 0x82, 0x1c, 0xba,
-  0x33, 0x58, 0x81, 0x88, 0x4e, 0x89, 0x43, 0xcb, 0xa6, 0x98, 0x42, 0x1b,
-  0x81, 0x28, 0x2a, 0x89, 0x13, 0xe4, 0x7c, 0x07, 0x25, 0x01, 0x38, 0x85,
-  0xc1, 0x21, 0x12, 0x50, 0x82, 0x24, 0x12, 0x28, 0x81, 0x18, 0x46, 0x44,
-  0x03, 0x23, 0x1a, 0xa3, 0x1a, 0x1c, 0x31, 0x22, 0x81, 0x1a, 0x4e, 0x29,
-  0x04, 0x2e, 0x11, 0x68, 0x28, 0x2e, 0x49, 0x20, 0x24, 0x66, 0x42, 0x28,
-  0x46, 0x01, 0xf0, 0x12, 0x24, 0x2e, 0x41, 0x4c, 0x62, 0x44, 0x28, 0x28,
-  0x20, 0x01, 0x88, 0x34, 0x41, 0x29, 0x24, 0x01, 0x2d, 0x14, 0x63, 0xc2,
-  0x44, 0x42, 0x42, 0x82, 0xb7, 0x16, 0xd0, 0x14, 0xc4, 0x12, 0x85, 0x22,
-  0x88, 0x21, 0x01, 0xa9, 0x62, 0x54, 0x80, 0xc2, 0x51, 0x23, 0x0a, 0x85,
-  0x71, 0x24, 0xa1, 0x84, 0x80, 0x01, 0xa2, 0x86, 0x02, 0x52, 0x00, 0x18,
-  0x28, 0x49, 0x26, 0xc2, 0x21, 0x44, 0x20, 0x92, 0x24, 0x44, 0x23, 0x5c,
-  0x12, 0x20, 0x31, 0x28, 0x44, 0x28, 0x31, 0x43, 0xf4, 0x24, 0x8a, 0x30,
-  0x22, 0x18, 0x58, 0xa3, 0x88, 0xc8, 0x12, 0x60, 0x48, 0x1e, 0x88, 0x22,
-  0x84, 0x1a, 0xf2, 0x58, 0x21, 0x14, 0x00, 0x28, 0x93, 0xa1, 0xa4, 0x48,
-  0x45, 0x68, 0x11, 0x00, 0x8c, 0x11, 0x26, 0xb2, 0x42, 0x41, 0x04, 0x1e,
-  0x22, 0x46, 0x63, 0x38, 0x6e, 0x18, 0x18, 0x29, 0x44, 0xa8, 0x21, 0x2a,
-  0x04, 0x83, 0x76, 0x1a, 0x34, 0x83, 0x43, 0x11, 0x08, 0xcc, 0x54, 0x42,
-  0x12, 0x15, 0x28, 0x64, 0x28, 0x24, 0x11, 0x14, 0xb0, 0x43, 0x81, 0x02,
-  0x59, 0x05, 0x32, 0x94, 0x00, 0xa4, 0x46, 0x6c, 0x41, 0x21, 0x2d, 0x42,
-  0x44, 0x16, 0xa4, 0x41, 0xad, 0xe3, 0x00, 0x20, 0x31, 0x84, 0x43, 0x18,
-  0x98, 0x22, 0x64, 0x00, 0x48, 0x28, 0x12, 0x84, 0x12, 0x50, 0x82, 0x28,
-  0x48, 0x44, 0x2d, 0x41, 0x44, 0x19, 0x15, 0x94, 0x84, 0x14, 0x54, 0x40,
-  0x02, 0x43, 0x24, 0x82, 0x23, 0x01, 0x29, 0x92, 0x24, 0x10, 0x08, 0x4b,
-  0x18, 0x22, 0x41, 0xc3, 0x81, 0x02, 0x80, 0x98, 0x44, 0xc0, 0x44, 0x21,
-  0x40, 0x08, 0x20, 0x84, 0x48, 0xd4, 0x14, 0x4c, 0x11, 0x24, 0xe1, 0x21,
-  0x32, 0x19, 0x58, 0xd0, 0x2a, 0xc2, 0x1c, 0x1c, 0x04, 0x1a, 0x92, 0x52,
-  0x1a, 0x18, 0xc8, 0x18, 0x13, 0xc2, 0x8a, 0x2c, 0x96, 0x81, 0xaf, 0x62,
-  0x44, 0xc1, 0x44, 0x9c, 0x94, 0x64, 0x49, 0x42, 0x71, 0x45, 0x7a, 0x28,
-  0xf6, 0xa1, 0x46, 0x44, 0x4d, 0x29, 0x44, 0x4d, 0x62, 0x18, 0x4b, 0x12,
-  0x37, 0x42, 0x2f, 0x68, 0x12, 0x51, 0x2a, 0x11, 0x8d, 0x21, 0xb0, 0x44,
-  0x51, 0x92, 0x41, 0x83, 0x07, 0x2b, 0x18, 0x94, 0x1a, 0x64, 0x4c, 0x8c,
-  0xf8, 0x42, 0x14, 0x47, 0x81, 0xb0, 0x18, 0x24, 0xb6, 0x18, 0x48, 0xf4,
-  0x1f, 0x4d, 0xc0, 0x41, 0x10, 0x4a, 0x34, 0x24, 0x1e, 0x48, 0x41, 0x19,
-  0x12, 0x06, 0x83, 0x94, 0x21, 0x25, 0xa2, 0x41, 0x54, 0x41, 0x2b, 0x34,
-  0x11, 0x4a, 0x21, 0xa1, 0xb4, 0x82, 0x18, 0xa0, 0x84, 0xa0, 0x21, 0x18,
-  0xa0, 0x12, 0x42, 0x22, 0x83, 0x31, 0x24, 0x00, 0x80, 0x08, 0x18, 0x96,
-  0x74, 0x24, 0x92, 0x21, 0x4b, 0x12, 0x68, 0x3c, 0x08, 0xb0, 0x14, 0x44,
-  0x42, 0x18, 0x42, 0x58, 0x22, 0x43, 0x98, 0x82, 0x41, 0x44, 0x2a, 0xe4,
-  0xbf, 0x08, 0x50, 0x22, 0x00, 0x24, 0x42, 0x20, 0x22, 0x21, 0xd8, 0x82,
-  0x22, 0x64, 0x81, 0x8b, 0x48, 0x31, 0x46, 0x01, 0x22, 0x12, 0x28, 0x00,
-  0x20, 0x08, 0x14, 0x18, 0x40, 0x62, 0x44, 0x22, 0x00, 0x21, 0x41, 0x7c,
-  0x34, 0x44, 0x82, 0x49, 0x64, 0x18, 0x61, 0x14, 0x20, 0x08, 0x24, 0x82,
-  0x26, 0x02, 0x11, 0x8a, 0x81, 0xd1, 0x22, 0x22, 0x01, 0x41, 0x00, 0x28,
-  0xaf, 0xcd, 0x0c, 0x21, 0x10, 0x04, 0x99, 0x02, 0x81, 0x00, 0x84, 0x18,
-  0xa1, 0x00, 0x18, 0x88, 0x40, 0x31, 0x28, 0x88, 0x28, 0x26, 0x31, 0x28,
-  0x16, 0x01, 0x21, 0x81, 0x23, 0x24, 0x02, 0x44, 0x46, 0x02, 0x00, 0x82,
-  0x16, 0x02, 0x10, 0x22, 0x01, 0x25, 0x04, 0x00, 0x22, 0x90, 0x84, 0x26,
-  0x04, 0x20, 0x11, 0x8c, 0x1a, 0x02, 0x81, 0x88, 0x5f, 0x33, 0x0b, 0x10,
-  0x58, 0x12, 0x21, 0x11, 0x2b, 0x42, 0x20, 0x54, 0x12, 0x82, 0x14, 0x62,
-  0x31, 0x88, 0x11, 0x19, 0x44, 0x02, 0x40, 0x02, 0x80, 0x01, 0x00, 0x40,
-  0x22, 0x02, 0x22, 0x10, 0x24, 0xba, 0x12, 0x42, 0x01, 0x24, 0x90, 0x81,
-  0x10, 0x01, 0x92, 0x44, 0x00, 0x00, 0x19, 0x02, 0x48, 0x41, 0xc0, 0x14,
-  0x2e, 0x14, 0x28, 0x10, 0xf4, 0x55, 0x4d, 0x50, 0x81, 0x10, 0x88, 0x02,
-  0x10, 0x02, 0x81, 0x28, 0x00, 0x20, 0x44, 0x04, 0x84, 0x46, 0x88, 0x02,
-  0x44, 0x10, 0x62, 0x24, 0x44, 0x29, 0x04, 0x22, 0x20, 0x12, 0x42, 0x04,
-  0x40, 0x22, 0x08, 0x8a, 0xc4, 0x28, 0x10, 0x02, 0x10, 0x61, 0x82, 0x41,
-  0x00, 0x8c, 0x02, 0x88, 0x00, 0x48, 0x00, 0x48, 0x24, 0xf0, 0xe1, 0x57,
-  0x80, 0x01, 0x81, 0x81, 0x2d, 0x28, 0x00, 0x50, 0x28, 0x84, 0x28, 0x29,
-  0x12, 0x06, 0x24, 0x82, 0x40, 0x01, 0x2e, 0x41, 0x28, 0x11, 0x40, 0x21,
-  0x08, 0x10, 0x11, 0x32, 0x81, 0x12, 0x2c, 0x88, 0x02, 0x00, 0x10, 0xb2,
-  0x14, 0x04, 0x44, 0x82, 0x29, 0x02, 0x29, 0xca, 0x42, 0x00, 0x23, 0x08,
-  0x28, 0x2c, 0x01, 0x18, 0x24, 0x42, 0x00, 0x47, 0x18, 0x9f, 0xed, 0x0a,
-  0x84, 0x40, 0x82, 0x02, 0x84, 0x26, 0x41, 0x18, 0x82, 0x14, 0x82, 0x88,
-  0xc2, 0x22, 0x22, 0x10, 0x82, 0x18, 0x92, 0x82, 0x18, 0x82, 0x22, 0x21,
-  0xc0, 0x11, 0x24, 0x60, 0x41, 0x41, 0x00, 0x10, 0x04, 0x41, 0x2d, 0x28,
-  0x55, 0x02, 0x49, 0x24, 0x12, 0x14, 0xb4, 0x44, 0x02, 0x14, 0x88, 0x45,
-  0x01, 0x24, 0x12, 0xc0, 0x88, 0x44, 0x49, 0x48, 0x22, 0x98, 0x12, 0x12,
-  0xbf, 0x2d, 0x44, 0x42, 0x0c, 0x22, 0x10, 0x84, 0x52, 0xa6, 0x30, 0x24,
-  0x00, 0xc4, 0x24, 0x81, 0x00, 0x00, 0x00, 0xa4, 0x42, 0x21, 0x40, 0x08,
-  0x41, 0x10, 0x58, 0x22, 0x81, 0x21, 0x10, 0x0a, 0x84, 0x41, 0x48, 0x10,
-  0x02, 0x20, 0x01, 0x20, 0x02, 0xc0, 0x24, 0x46, 0x14, 0x08, 0x12, 0x24,
-  0x40, 0x28, 0x14, 0x22, 0xf2, 0x75, 0xd9, 0x20, 0x28, 0x0a, 0x84, 0x88,
-  0x81, 0x11, 0xc0, 0x21, 0x22, 0x91, 0x82, 0x11, 0x20, 0x02, 0x81, 0x4a,
-  0x08, 0x2d, 0x41, 0x80, 0x58, 0x22, 0x28, 0x20, 0x01, 0x11, 0x10, 0x41,
-  0x14, 0x06, 0x49, 0x6a, 0x22, 0x00, 0x45, 0x01, 0x41, 0x90, 0x84, 0x18,
-  0x49, 0x93, 0x84, 0x13, 0x82, 0x12, 0x01, 0x24, 0x00, 0x43, 0x08, 0x12,
-  0x22, 0x82, 0x00, 0x2b, 0x1b, 0xd0, 0xa1, 0x11, 0xb8, 0x21, 0x04, 0x00,
-  0x2c, 0xe2, 0x84, 0x42, 0x22, 0x04, 0x44, 0x81, 0x28, 0x24, 0xc0, 0x16,
-  0x8c, 0x42, 0x04, 0x21, 0x22, 0x25, 0x04, 0x18, 0x90, 0x82, 0x22, 0xa0,
-  0x28, 0x20, 0x78, 0x14, 0x41, 0x42, 0x44, 0x08, 0x48, 0x00, 0x84, 0x48,
-  0x84, 0x11, 0x21, 0x18, 0xc4, 0x41, 0x28, 0x00, 0x00, 0x20, 0x22, 0x05,
-  0x21, 0xf0, 0xb3, 0xeb, 0x20, 0x71, 0x82, 0x5a, 0x9b, 0x27, 0xa2, 0x8e,
-  0x27, 0x8b, 0x26, 0xa4, 0xaf, 0x24, 0x86, 0xf2, 0x28, 0xa8, 0x2a, 0x92,
-  0xc8, 0x47, 0x12, 0x2f, 0x88, 0x1c, 0x31, 0x81, 0x70, 0x23, 0x59, 0x28,
-  0x23, 0x84, 0xa1, 0x88, 0x26, 0x04, 0x61, 0x2b, 0x11, 0x41, 0x15, 0x71,
-  0x12, 0x6a, 0x22, 0x63, 0xf3, 0x82, 0x82, 0x24, 0x2e, 0x22, 0x26, 0x64,
-  0x2c, 0xad, 0x36, 0x31, 0x2f, 0x27, 0xe4, 0x34, 0x88, 0xa3, 0x88, 0x6d,
-  0x24, 0x6a, 0x41, 0x14, 0xc1, 0x88, 0x34, 0x83, 0x38, 0x41, 0xa9, 0x09,
-  0x21, 0x83, 0x11, 0x74, 0x14, 0xa4, 0x8c, 0x34, 0x41, 0xdf, 0x95, 0x0d,
-  0x29, 0xa1, 0x28, 0x28, 0x89, 0x42, 0xd8, 0x82, 0xd4, 0x41, 0x02, 0x85,
-  0x73, 0x42, 0x52, 0x39, 0x23, 0x5c, 0x81, 0x87, 0x24, 0x2c, 0x12, 0x52,
-  0xa8, 0x88, 0x36, 0xe4, 0x3a, 0x72, 0x26, 0xba, 0x21, 0x72, 0x18, 0xa2,
-  0x1c, 0x2c, 0x78, 0x41, 0x83, 0x71, 0x62, 0x22, 0xd2, 0x17, 0xc2, 0x2c,
-  0x45, 0x44, 0x04, 0x2c, 0x11, 0x93, 0x44, 0x4b, 0x88, 0x10, 0x54, 0x46,
-  0x57, 0x34, 0x84, 0x5f, 0x38, 0xb2, 0xaa, 0xea, 0x36, 0xa3, 0x2a, 0x55,
-  0x44, 0x94, 0x24, 0x32, 0x2c, 0xa1, 0xb8, 0x18, 0x2e, 0x14, 0x2f, 0x86,
-  0x81, 0x12, 0xe8, 0x4b, 0x78, 0x55, 0x43, 0x52, 0x71, 0x81, 0x47, 0x22,
-  0x30, 0x29, 0x24, 0xa7, 0x12, 0x26, 0x78, 0x33, 0xac, 0x48, 0x27, 0x81,
-  0x2e, 0x2a, 0xa3, 0x01, 0x67, 0x13, 0x4e, 0xc1, 0x2d, 0x14, 0x8b, 0x6c,
-  0x29, 0x92, 0xc1, 0x28, 0x1c, 0x84, 0x72, 0x23, 0x41, 0x08, 0x85, 0x82,
-  0x92, 0x24, 0xce, 0x84, 0x24, 0x42, 0x6b, 0x21, 0x6f, 0xc8, 0x98, 0x26,
-  0x4d, 0x85, 0x40, 0x57, 0x4c, 0x37, 0x48, 0x84, 0x44, 0x1a, 0xe1, 0x41,
-  0x18, 0x44, 0x14, 0x82, 0x92, 0x86, 0x26, 0x27, 0xa8, 0x41, 0xc7, 0x61,
-  0x4d, 0x44, 0x2f, 0x29, 0xca, 0x62, 0x48, 0x18, 0x28, 0xef, 0x49, 0x0e,
-  0x15, 0x14, 0x52, 0xc1, 0x50, 0xc1, 0x62, 0x15, 0x2c, 0x56, 0xc1, 0x4a,
-  0x18, 0xa1, 0x86, 0x15, 0xa8, 0x84, 0x51, 0x4e, 0x83, 0x41, 0x4e, 0xa3,
-  0x45, 0xc8, 0xa1, 0x45, 0xc8, 0xa1, 0x45, 0xc8, 0x81, 0x45, 0x48, 0x51,
-  0x86, 0x1c, 0x42, 0xe8, 0x18, 0x52, 0x84, 0x82, 0x84, 0x82, 0x43, 0x32,
-  0x81, 0x41, 0x13, 0x18, 0x3c, 0x81, 0xe1, 0x13, 0x18, 0x3e, 0x91, 0xeb,
-  0x82, 0x11, 0xab, 0x82, 0x11, 0xa9, 0x08, 0xa9, 0x28, 0xd1, 0x4a, 0x68,
-  0x81, 0x2d, 0xa4, 0x16, 0x88, 0x48, 0x88, 0x68, 0xc4, 0x34, 0x77, 0x74,
-  0x5f, 0x72, 0xd2, 0x71, 0xd2, 0x5e, 0xd2, 0x5d, 0xfc, 0x4e, 0x67, 0x3d,
-  0x49, 0x7f, 0x54, 0x76, 0x45, 0xf7, 0xee, 0xe7, 0x3f, 0x3c, 0xf6, 0xeb,
-  0xe3, 0xbf, 0xb8, 0xf4, 0xcf, 0xc7, 0x7f, 0x7c, 0xf4, 0xc5, 0xc7, 0xfb,
-  0x9d, 0x1f, 0x7c, 0xfe, 0xc3, 0xce, 0xff, 0xfc, 0xfe, 0xbb, 0x1b, 0x9f,
-  0xdc, 0xfe, 0x81, 0x8c, 0xdf, 0xf2, 0x72, 0x8b, 0x5b, 0xdf, 0x55, 0xdf,
-  0xb9, 0xf2, 0xdd, 0xdd, 0x9f, 0xbc, 0xfe, 0x33, 0x96, 0xcf, 0xe8, 0xf8,
-  0xbc, 0xbe, 0x8e, 0x82, 0x2f, 0x7e, 0xfc, 0xc3, 0xc3, 0x2f, 0x72, 0xfa,
-  0x8b, 0x8f, 0xaf, 0xf9, 0xf9, 0xc9, 0xcf, 0xbf, 0x7a, 0xfa, 0xc1, 0xcf,
-  0x2f, 0xf2, 0xfb, 0x99, 0x9f, 0x2f, 0x7e, 0xfc, 0xd3, 0xfb, 0x3f, 0xba,
-  0x7a, 0x89, 0xfb, 0x86, 0x87, 0xff, 0xfc, 0xf4, 0xaa, 0xaa, 0xaf, 0xa8,
-  0xf9, 0x86, 0x82, 0x3f, 0x88, 0xf9, 0xac, 0xb9, 0xcf, 0x8b, 0xf4, 0x88,
-  0xc8, 0x9e, 0x98, 0xcf, 0xea, 0x68, 0xf3, 0x24, 0x3f, 0x35, 0xb5, 0x61,
-  0x56, 0xf9, 0x7f, 0x52, 0xf6, 0x41, 0x4b, 0x3f, 0x36, 0xf6, 0x6f, 0x45,
-  0xdf, 0x44, 0xf6, 0x49, 0x4b, 0x3f, 0x3e, 0xfe, 0xef, 0xa7, 0xbf, 0x2c,
-  0xfe, 0xeb, 0xe5, 0x9f, 0xac, 0xfc, 0x83, 0xc1, 0x5f, 0x7c, 0xfc, 0x5f,
-  0xd3, 0x1f, 0xfe, 0xfc, 0x23, 0xcf, 0xff, 0xfe, 0xfe, 0xb6, 0xb5, 0x3f,
-  0x5e, 0xde, 0xd1, 0xf8, 0x2f, 0x3f, 0x67, 0x78, 0x3f, 0x38, 0x48, 0xfb,
-  0x2d, 0xad, 0xde, 0x51, 0x1f, 0x7e, 0xfe, 0xbb, 0xbf, 0xff, 0xb8, 0xf8,
-  0xbc, 0x3e, 0x8e, 0xa7, 0xbf, 0xfe, 0xf4, 0xc3, 0xc3, 0x7f, 0xfa, 0xfe,
-  0x83, 0x83, 0x3f, 0x59, 0xf1, 0xc9, 0xcb, 0xbf, 0x6a, 0xf2, 0xc3, 0xcb,
-  0x3f, 0xfb, 0xfb, 0x8b, 0xbb, 0xbf, 0xdc, 0xfe, 0x73, 0xff, 0x3f, 0xa8,
-  0xfa, 0x8b, 0xab, 0xff, 0xd8, 0xf8, 0xc7, 0xe7, 0x2b, 0xbb, 0xad, 0x8a,
-  0xef, 0x89, 0xd8, 0xa6, 0xf9, 0xbe, 0x99, 0xbe, 0xb2, 0x2b, 0xcc, 0x1e,
-  0x98, 0xcf, 0xeb, 0xf9, 0x11, 0x83, 0x24, 0x35, 0xf3, 0x21, 0x62, 0xd5,
-  0x5b, 0x6a, 0xb7, 0x3a, 0xaf, 0x24, 0xd6, 0xdf, 0xb2, 0x4b, 0x56, 0x31,
-  0xaf, 0x2c, 0x7e, 0x63, 0xff, 0xeb, 0xe2, 0xbd, 0x29, 0x1f, 0xac, 0xdc,
-  0x33, 0xf4, 0xc7, 0xc3, 0xaf, 0x41, 0xf9, 0xcb, 0xe3, 0xef, 0x24, 0xfc,
-  0xe3, 0xeb, 0x6f, 0x53, 0xf3, 0xc3, 0xe1, 0xcb, 0x82, 0x1f, 0x9a, 0xf3,
-  0x86, 0x85, 0x3d, 0x83, 0x85, 0xd3, 0xb1, 0xf2, 0xb4, 0x15, 0x5f, 0x3a,
-  0xfa, 0x3e, 0x3e, 0x6f, 0x78, 0xf8, 0xb6, 0x36, 0xcf, 0xa8, 0xf8, 0xa6,
-  0x2e, 0x7f, 0x78, 0xf8, 0x22, 0x66, 0x3f, 0x78, 0xf8, 0x92, 0x16, 0x9f,
-  0x7c, 0xfc, 0xa3, 0x2c, 0x1f, 0x7c, 0xfc, 0x3a, 0x24, 0x1f, 0x79, 0xf9,
-  0xea, 0xcc, 0x3f, 0x77, 0xbd, 0xab, 0xda, 0x31, 0xf2, 0x8e, 0x8d, 0x7f,
-  0x74, 0xb4, 0xa2, 0xda, 0x22, 0xf9, 0x8e, 0x9c, 0xad, 0x96, 0x6f, 0x8b,
-  0xbb, 0x14, 0xb3, 0x82, 0xf8, 0x18, 0x91, 0x4f, 0xea, 0xfb, 0x8f, 0x5a,
-  0x24, 0x77, 0x74, 0x2b, 0x62, 0xff, 0xb2, 0xf2, 0x62, 0x25, 0xdf, 0xf2,
-  0xf4, 0x6a, 0x63, 0xbf, 0x12, 0xf6, 0x4e, 0x64, 0xdf, 0xd6, 0xf2, 0xca,
-  0xeb, 0xbf, 0xfa, 0xf2, 0xea, 0xc2, 0x5f, 0x98, 0xf4, 0xc8, 0xca, 0x77,
-  0x58, 0x7f, 0x3c, 0xfc, 0x5b, 0x16, 0xbf, 0xbe, 0xfe, 0x2f, 0x62, 0x7f,
-  0xfc, 0xfe, 0xb8, 0x18, 0x1f, 0x1e, 0x7e, 0x2d, 0xf2, 0xa5, 0x2d, 0x8f,
-  0x88, 0xd8, 0x31, 0x58, 0x6c, 0x5f, 0xfa, 0xf2, 0x38, 0x18, 0x1f, 0x78,
-  0xfa, 0x33, 0x96, 0xaf, 0xb8, 0xf8, 0x34, 0x36, 0x9f, 0xc8, 0xfa, 0x22,
-  0x2f, 0x3f, 0x18, 0xf8, 0x2e, 0xa7, 0x7f, 0x38, 0xf8, 0x1e, 0x1f, 0xdf,
-  0x3c, 0xfc, 0x26, 0x2e, 0x5f, 0x3c, 0xfc, 0x3e, 0xb7, 0xdf, 0xbb, 0xfa,
-  0xe6, 0xe5, 0x1f, 0x37, 0xf7, 0xaa, 0x82, 0x97, 0xb8, 0x3f, 0x58, 0xf8,
-  0xc5, 0x47, 0xaf, 0x8b, 0xfb, 0x18, 0x1a, 0x6b, 0x99, 0xcd, 0x13, 0x6f,
-  0xe8, 0xfb, 0xfa, 0x6c, 0x2b, 0xcc, 0x8b, 0x11, 0xae, 0xac, 0xef, 0xa6,
-  0x0e, 0x00, 0x40, 0x58, 0x22, 0x84, 0x22, 0x60, 0x22, 0x84, 0x24, 0x84,
-  0x24, 0x00, 0x00, 0xc0, 0x22, 0x00, 0x80, 0x02, 0x00, 0x00, 0x28, 0x21,
-  0x10, 0x02, 0x23, 0x02, 0x21, 0x10, 0x02, 0x41, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x20, 0x41, 0x04, 0x00, 0x00, 0xaf, 0xd5, 0x09, 0x24, 0x20,
-  0x02, 0x80, 0x12, 0x08, 0x00, 0x80, 0x02, 0x84, 0x00, 0x40, 0x08, 0x22,
-  0x00, 0x00, 0x88, 0x00, 0x00, 0x23, 0x42, 0x14, 0x04, 0x40, 0x14, 0x04,
-  0x40, 0x04, 0x10, 0x04, 0x18, 0x4c, 0x02, 0x28, 0x00, 0x44, 0x00, 0x40,
-  0x32, 0x24, 0x18, 0x48, 0x30, 0x24, 0x17, 0x78, 0xc0, 0x42, 0x1f, 0x41,
-  0x52, 0x2a, 0x1f, 0xc1, 0x32, 0x68, 0x1f, 0xc1, 0x32, 0x6a, 0x1f, 0xc1,
-  0xb2, 0x4a, 0xf1, 0x11, 0x2c, 0xab, 0x96, 0x1b, 0x21, 0xab, 0x94, 0x57,
-  0x81, 0xab, 0x94, 0x43, 0xf2, 0x4a, 0x91, 0x43, 0xf3, 0x42, 0xb1, 0x47,
-  0x82, 0x2d, 0xb1, 0x4f, 0x83, 0xe4, 0x14, 0xfb, 0x24, 0x4a, 0x4e, 0x81,
-  0x4f, 0xa2, 0x64, 0x15, 0x4f, 0xa2, 0xe5, 0x19, 0xf2, 0x24, 0x4a, 0xde,
-  0x25, 0xac, 0xe4, 0x49, 0xf2, 0x24, 0x4a, 0x1f, 0x49, 0xd2, 0x24, 0xf5,
-  0x91, 0x24, 0xcf, 0x22, 0xf1, 0x91, 0x24, 0xc3, 0xf4, 0x91, 0x24, 0xeb,
-  0x14, 0x1f, 0x49, 0xb2, 0x6e, 0xd1, 0x41, 0xb2, 0x6a, 0x99, 0x21, 0xab,
-  0x94, 0x51, 0xab, 0x94, 0x43, 0xf3, 0x4a, 0x92, 0x4b, 0x43, 0x2f, 0x64,
-  0xfb, 0x34, 0x48, 0x2d, 0xb4, 0x4f, 0x82, 0x84, 0xfb, 0x24, 0x4a, 0x5e,
-  0xd7, 0xc0, 0x42, 0x1f, 0x81, 0xd6, 0x28, 0xb4, 0x11, 0x32, 0x48, 0x1b,
-  0x21, 0xa3, 0x94, 0x21, 0x8b, 0x14, 0x19, 0xf2, 0x4a, 0x84, 0x19, 0xf2,
-  0x4a, 0xa4, 0x11, 0xab, 0xb4, 0x22, 0x8f, 0x14, 0x29, 0xe2, 0x14, 0x29,
-  0xd2, 0x12, 0x08, 0x1c, 0xf9, 0x22, 0x12, 0x1c, 0xb8, 0x22, 0xcd, 0x81,
-  0x24, 0x96, 0xe1, 0x22, 0x64, 0x19, 0x34, 0x8e, 0x25, 0x2c, 0x74, 0x81,
-  0xc8, 0x42, 0x1f, 0x89, 0x06, 0x1f, 0x48, 0x26, 0xf4, 0x81, 0x24, 0x21,
-  0x1f, 0x48, 0xb2, 0x42, 0x51, 0x41, 0x2f, 0x44, 0x19, 0xf1, 0x42, 0xb4,
-  0x51, 0x29, 0x3b, 0x24, 0x2b, 0x84, 0x22, 0x98, 0x41, 0x98, 0x6b, 0x42,
-  0x98, 0x6f, 0x22, 0xf5, 0x6e, 0x63, 0x00, 0x82, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x80, 0x08, 0x00,
-  0x00, 0x14, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x40, 0x01, 0x2f, 0xe5, 0x0f, 0x62, 0x22, 0x28, 0x12, 0x12,
-  0x2c, 0x43, 0x82, 0x42, 0x48, 0xb8, 0x52, 0x88, 0x11, 0x08, 0x83, 0x14,
-  0x08, 0x94, 0x20, 0x01, 0x68, 0x48, 0x00, 0x60, 0x22, 0x14, 0x84, 0x45,
-  0x92, 0x88, 0xa0, 0x18, 0xb0, 0x86, 0xc6, 0x42, 0xa8, 0x60, 0x81, 0x70,
-  0x84, 0x48, 0x14, 0x25, 0x81, 0x82, 0x43, 0x28, 0x41, 0x01, 0x24, 0x20,
-  0x02, 0xc0, 0x88, 0x46, 0x8c, 0x78, 0x64, 0xf2, 0x2e, 0x11, 0x10, 0xe4,
-  0x38, 0x61, 0x41, 0x14, 0x10, 0x69, 0x84, 0x34, 0x40, 0x11, 0xc8, 0x21,
-  0xc2, 0x14, 0x21, 0x25, 0x52, 0x81, 0x22, 0xf3, 0x4c, 0x92, 0x81, 0x60,
-  0x88, 0x26, 0xd2, 0x49, 0x88, 0x92, 0x47, 0x24, 0x15, 0x24, 0x52, 0x41,
-  0x27, 0x24, 0x44, 0x48, 0x14, 0x14, 0x20, 0x58, 0x12, 0x61, 0x3c, 0x22,
-  0xf1, 0x88, 0x12, 0x60, 0x31, 0x82, 0x26, 0x01, 0x64, 0x92, 0xe9, 0x02,
-  0x45, 0x92, 0x1c, 0x16, 0xa6, 0x14, 0x1c, 0x42, 0x01, 0x3f, 0xbd, 0x4c,
-  0x21, 0xe4, 0x1e, 0x91, 0x24, 0x1c, 0x21, 0xc1, 0x18, 0x83, 0xd4, 0x23,
-  0x42, 0x48, 0xd9, 0x84, 0xe5, 0x11, 0xb2, 0x28, 0x4c, 0x81, 0x54, 0x28,
-  0x11, 0x87, 0x32, 0x15, 0xc8, 0x12, 0x17, 0x28, 0x4a, 0x92, 0x48, 0x1a,
-  0x92, 0x81, 0x86, 0x32, 0x41, 0x25, 0x13, 0x85, 0xd2, 0xc3, 0x98, 0x41,
-  0x61, 0x48, 0x8f, 0x5a, 0x94, 0x41, 0x23, 0x2c, 0xd8, 0x3a, 0x01, 0x87,
-  0x32, 0x41, 0xdf, 0x21, 0x88, 0xc1, 0x23, 0x49, 0x4b, 0x21, 0x43, 0xc2,
-  0x92, 0x83, 0x02, 0x24, 0x16, 0x58, 0x24, 0xac, 0xdc, 0x48, 0x66, 0x18,
-  0x43, 0xf3, 0x78, 0xec, 0x30, 0x24, 0x90, 0x12, 0x00, 0x19, 0x12, 0x02,
-  0x00, 0x29, 0x08, 0x00, 0xa5, 0x02, 0x81, 0xe0, 0x44, 0x08, 0x00, 0x88,
-  0x24, 0x85, 0x24, 0xc2, 0x24, 0x10, 0x18, 0x04, 0x21, 0x92, 0x24, 0x00,
-  0x28, 0x00, 0x41, 0x86, 0x84, 0x01, 0x20, 0x01, 0x8c, 0x02, 0x51, 0x10,
-  0x14, 0x32, 0x24, 0x44, 0x12, 0x18, 0x14, 0x80, 0xf4, 0xbd, 0xd7, 0x00,
-  0x20, 0x08, 0x88, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x11, 0x00, 0x10, 0x01, 0x14, 0x00, 0x77, 0x5e, 0x80, 0x22,
-  0x14, 0x13, 0xc4, 0x14, 0x89, 0x42, 0x21, 0x56, 0x64, 0x25, 0x28, 0x81,
-  0x65, 0x1a, 0x2c, 0x08, 0x25, 0x18, 0x94, 0x42, 0x1f, 0x22, 0x41, 0xc1,
-  0x84, 0x81, 0x8c, 0x22, 0x85, 0xa4, 0x18, 0x74, 0xa0, 0x21, 0x84, 0xb0,
-  0x83, 0x14, 0xc4, 0x14, 0x83, 0x82, 0x2a, 0x14, 0x53, 0x88, 0x2a, 0x41,
-  0xc4, 0xa1, 0x46, 0x02, 0x25, 0x38, 0x34, 0x78, 0x86, 0x81, 0x48, 0x54,
-  0x84, 0x21, 0x48, 0x2a, 0x01, 0x6c, 0x08, 0x8c, 0x32, 0x58, 0x3f, 0x4b,
-  0x0b, 0x28, 0x42, 0x35, 0x18, 0x88, 0x41, 0x44, 0xe1, 0x24, 0x02, 0x25,
-  0x38, 0x14, 0x58, 0xa6, 0x85, 0x18, 0x66, 0xa1, 0x80, 0x35, 0x21, 0x14,
-  0x6c, 0x39, 0x18, 0x8c, 0x32, 0x41, 0x1c, 0x24, 0x58, 0x68, 0x84, 0x28,
-  0x12, 0xb0, 0x83, 0x14, 0xc4, 0x14, 0x83, 0x82, 0x2a, 0x14, 0x43, 0x84,
-  0x11, 0xcc, 0x85, 0x4e, 0x22, 0x41, 0x25, 0x28, 0x81, 0x65, 0x1a, 0x88,
+  0x00, 0x10, 0x02, 0xb2, 0x01, 0x00, 0x22, 0x00, 0x14, 0x07, 0x00, 0xf0,
+  0xff, 0xff, 0xed, 0xaf, 0x98, 0x02, 0x52, 0x12, 0x40, 0xb4, 0x12, 0xd4,
+  0x94, 0x81, 0x92, 0x11, 0x48, 0x99, 0x21, 0x82, 0x0a, 0x24, 0x60, 0x44,
+  0x28, 0x49, 0x83, 0x8c, 0xc2, 0x48, 0x41, 0x1b, 0xc2, 0x28, 0x26, 0x68,
+  0x96, 0x48, 0x4c, 0x01, 0x42, 0x88, 0x60, 0x48, 0x20, 0x81, 0x04, 0x88,
+  0x4c, 0x19, 0xd1, 0x41, 0x22, 0x18, 0x11, 0x3a, 0x45, 0xc0, 0xa8, 0x1b,
+  0x84, 0x18, 0x43, 0x81, 0x29, 0x51, 0x42, 0x42, 0xa1, 0x8c, 0x18, 0x14,
+  0xa4, 0x42, 0x3f, 0xed, 0x49, 0x71, 0x22, 0x02, 0x27, 0xc2, 0x11, 0x19,
+  0x32, 0x42, 0x24, 0x44, 0x81, 0x8a, 0xa6, 0x85, 0x1e, 0x41, 0xc2, 0x10,
+  0x31, 0x88, 0x1f, 0x24, 0xc1, 0xc2, 0x8d, 0x14, 0x46, 0xa8, 0x18, 0x4a,
+  0xd2, 0x84, 0x81, 0x54, 0x26, 0x60, 0x21, 0xb4, 0xb6, 0x63, 0x68, 0x18,
+  0x89, 0x62, 0x21, 0x2e, 0x82, 0x86, 0x12, 0x84, 0x68, 0x81, 0x24, 0x42,
+  0x30, 0x58, 0x26, 0xec, 0x38, 0x31, 0xa8, 0x8c, 0x61, 0x34, 0x20, 0xd8,
+  0x82, 0x18, 0x52, 0x48, 0x83, 0x96, 0x94, 0x6a, 0xd8, 0x42, 0x84, 0x24,
+  0x4a, 0xd8, 0xeb, 0x0e, 0x1a, 0x24, 0x71, 0x28, 0x54, 0x14, 0x27, 0x35,
+  0x5d, 0x48, 0xc0, 0x15, 0x83, 0xd4, 0x81, 0xa1, 0x52, 0x13, 0x88, 0x0c,
+  0x21, 0xc4, 0x28, 0x4b, 0x92, 0x4b, 0x94, 0x62, 0x4e, 0x88, 0x44, 0x9c,
+  0xef, 0x24, 0x72, 0x24, 0xf8, 0x22, 0x41, 0x2c, 0xd4, 0x68, 0x21, 0x9a,
+  0x42, 0x2b, 0x81, 0x26, 0x68, 0x28, 0x8e, 0x22, 0x88, 0x4c, 0x24, 0x98,
+  0x88, 0x86, 0x34, 0x43, 0x22, 0xc2, 0x28, 0x99, 0x68, 0x54, 0x81, 0x1f,
+  0x84, 0x3a, 0x83, 0x2c, 0xd1, 0x24, 0x81, 0x99, 0x14, 0x6b, 0x42, 0xd6,
+  0xb4, 0x28, 0x5c, 0x84, 0x46, 0x14, 0x74, 0x68, 0xf2, 0xb8, 0x24, 0x70,
+  0x22, 0x02, 0x21, 0x20, 0x22, 0x61, 0x22, 0x00, 0x8a, 0x86, 0xa8, 0x61,
+  0x00, 0x14, 0x8a, 0xe4, 0x34, 0x81, 0x14, 0x4a, 0x88, 0xa1, 0x42, 0x44,
+  0x00, 0x84, 0x12, 0x11, 0x16, 0x91, 0x84, 0x00, 0x16, 0x04, 0x12, 0x21,
+  0x80, 0x21, 0x01, 0x15, 0x94, 0x18, 0x15, 0xdc, 0x22, 0xe1, 0x88, 0x82,
+  0x01, 0x42, 0x82, 0x89, 0x08, 0x81, 0x84, 0x24, 0xb0, 0x42, 0x08, 0xa8,
+  0xf0, 0x26, 0x7e, 0x40, 0x02, 0x2a, 0x01, 0x26, 0x02, 0x30, 0x11, 0x23,
+  0x02, 0x30, 0x11, 0x88, 0x00, 0x48, 0x4a, 0x22, 0x88, 0x83, 0x04, 0x86,
+  0x48, 0x04, 0x28, 0x80, 0x42, 0x08, 0x29, 0x05, 0x48, 0xe0, 0x22, 0x21,
+  0x28, 0xc2, 0x24, 0x88, 0xd0, 0x22, 0x28, 0x41, 0x01, 0x98, 0x28, 0x00,
+  0x42, 0x13, 0x08, 0x12, 0x28, 0x82, 0x20, 0x01, 0x82, 0x4c, 0xe2, 0x82,
+  0xe4, 0x5b, 0x0e, 0x13, 0x74, 0x11, 0x16, 0x84, 0xc2, 0x48, 0x18, 0x4b,
+  0x34, 0x30, 0x51, 0x92, 0x4e, 0x21, 0x21, 0xb4, 0x19, 0xc4, 0x82, 0x98,
+  0x67, 0x11, 0x2f, 0x12, 0x01, 0x2b, 0x18, 0x1c, 0x31, 0x14, 0x8b, 0xc1,
+  0x1b, 0x42, 0x34, 0xd0, 0x18, 0x31, 0x22, 0x1f, 0x82, 0x81, 0x22, 0xc7,
+  0x32, 0x41, 0x42, 0x68, 0x88, 0x12, 0x14, 0x41, 0x1a, 0x62, 0x18, 0x43,
+  0x28, 0x65, 0x12, 0x93, 0xe8, 0x16, 0xa8, 0x28, 0x85, 0x01, 0x90, 0x84,
+  0xc1, 0x20, 0x88, 0x88, 0x36, 0x64, 0x12, 0xf0, 0xfa, 0x7e, 0x50, 0x21,
+  0x16, 0x94, 0x36, 0xc0, 0x42, 0xa0, 0x52, 0x1c, 0x31, 0x32, 0x82, 0x26,
+  0x82, 0x61, 0x38, 0x14, 0x2c, 0x28, 0x3c, 0x45, 0x28, 0x24, 0x4a, 0x18,
+  0x11, 0xa4, 0x48, 0x22, 0x11, 0x21, 0x22, 0x21, 0x99, 0x93, 0x12, 0x28,
+  0x46, 0x12, 0x24, 0x94, 0xc2, 0x30, 0x14, 0x14, 0x10, 0x62, 0x18, 0x41,
+  0x52, 0x13, 0x68, 0x1a, 0xaa, 0x24, 0x6a, 0x14, 0x00, 0x92, 0x8c, 0x02,
+  0x82, 0x12, 0x4a, 0xe2, 0x44, 0x02, 0x81, 0xef, 0xbf, 0x0d, 0x42, 0x14,
+  0x20, 0x32, 0x28, 0x12, 0x44, 0x90, 0x41, 0x18, 0x46, 0x41, 0x41, 0x88,
+  0x04, 0x18, 0x2f, 0x22, 0xe1, 0x18, 0xa1, 0x12, 0x18, 0x12, 0x96, 0x78,
+  0x18, 0xc4, 0x41, 0x22, 0x70, 0x18, 0x61, 0x82, 0xa0, 0x24, 0x52, 0x38,
+  0xa0, 0x12, 0x22, 0xa8, 0x28, 0x88, 0x44, 0x1e, 0xa2, 0x12, 0x1c, 0x08,
+  0x2a, 0x11, 0x48, 0x01, 0x81, 0x19, 0x08, 0x44, 0x41, 0x82, 0x80, 0x08,
+  0x82, 0x49, 0xa3, 0x42, 0xcf, 0x21, 0x44, 0x02, 0x50, 0x12, 0x60, 0x85,
+  0x1c, 0x42, 0x93, 0x24, 0x90, 0x42, 0x42, 0x2c, 0xa4, 0x12, 0x14, 0x3c,
+  0x61, 0x32, 0x00, 0x1a, 0x44, 0x92, 0x11, 0x23, 0x26, 0x24, 0x11, 0x42,
+  0x01, 0x49, 0x07, 0x2f, 0x21, 0xc2, 0x28, 0x21, 0x88, 0x2b, 0x84, 0x2c,
+  0x84, 0x29, 0x44, 0x44, 0x18, 0x84, 0x18, 0x38, 0x58, 0x84, 0x8b, 0x14,
+  0x43, 0x28, 0x22, 0x03, 0x20, 0x82, 0xe1, 0x42, 0xd1, 0x84, 0x4a, 0x68,
+  0x21, 0x42, 0x44, 0x83, 0xff, 0xa8, 0x4f, 0x20, 0x21, 0x41, 0x02, 0x90,
+  0x42, 0x00, 0x42, 0x22, 0x87, 0x43, 0x35, 0x68, 0x82, 0x42, 0x00, 0x28,
+  0x89, 0x22, 0x92, 0x44, 0x28, 0x21, 0x2a, 0x31, 0x78, 0x89, 0x02, 0x28,
+  0x40, 0x18, 0x04, 0x1d, 0x5a, 0xc4, 0x44, 0x1e, 0x21, 0x41, 0x42, 0x84,
+  0x40, 0x08, 0x8e, 0x24, 0x28, 0x21, 0xb0, 0x44, 0xe1, 0x24, 0x31, 0x28,
+  0x21, 0x21, 0x25, 0x88, 0x08, 0x20, 0x63, 0x2c, 0xa8, 0x20, 0xf1, 0xb9,
+  0x95, 0x20, 0x22, 0x02, 0x1a, 0x62, 0x42, 0x87, 0x41, 0x44, 0x16, 0x91,
+  0x24, 0x11, 0x80, 0x42, 0x41, 0x12, 0x38, 0x14, 0x88, 0x16, 0x45, 0xc1,
+  0x28, 0xc4, 0x44, 0x40, 0x04, 0x42, 0x46, 0x12, 0x08, 0xd8, 0x02, 0xf0,
+  0xff, 0x71, 0x22, 0x41, 0x24, 0x20, 0x88, 0x83, 0x44, 0xa8, 0x41, 0x21,
+  0x14, 0x86, 0x02, 0x00, 0x58, 0x00, 0x44, 0x20, 0xa4, 0x48, 0xa1, 0x90,
+  0x48, 0x64, 0x4f, 0xda, 0x45, 0xa2, 0x12, 0x2a, 0x11, 0x83, 0x71, 0x68,
+  0x62, 0x51, 0x55, 0x92, 0x15, 0x68, 0x33, 0xe4, 0xa2, 0xd4, 0x21, 0x34,
+  0x18, 0x13, 0x74, 0x18, 0x33, 0x24, 0x29, 0x4a, 0x84, 0xc6, 0x2c, 0x8f,
+  0x51, 0x62, 0x46, 0x72, 0x87, 0x22, 0x89, 0x62, 0x14, 0x42, 0x4d, 0x78,
+  0x85, 0xe2, 0x44, 0x52, 0x42, 0x87, 0x21, 0x8b, 0x84, 0x4b, 0x48, 0x17,
+  0x64, 0x16, 0x14, 0xc2, 0x88, 0x89, 0x82, 0x94, 0x88, 0xcf, 0x21, 0x6e,
+  0x22, 0x84, 0x8d, 0x82, 0x4a, 0x68, 0x25, 0xa4, 0x16, 0x42, 0xc2, 0x28,
+  0x4c, 0xa8, 0x12, 0x49, 0xc6, 0x22, 0x92, 0xaa, 0x14, 0xf8, 0x28, 0x44,
+  0x97, 0xe7, 0x00, 0x40, 0x82, 0x92, 0x14, 0x8c, 0x06, 0x28, 0x41, 0x28,
+  0x18, 0x8c, 0x42, 0x01, 0x21, 0x13, 0x01, 0x17, 0x83, 0x1c, 0x81, 0x14,
+  0x02, 0x90, 0x44, 0x00, 0x28, 0x21, 0x80, 0xb1, 0x18, 0x92, 0x42, 0x44,
+  0x23, 0xa2, 0x21, 0x88, 0x10, 0x24, 0x11, 0x0c, 0xe0, 0x81, 0x44, 0xa1,
+  0x41, 0x18, 0x28, 0x18, 0x48, 0x00, 0x18, 0x41, 0x89, 0xe8, 0x89, 0x34,
+  0x48, 0x60, 0x44, 0x86, 0xf2, 0x7d, 0xfb, 0x80, 0x02, 0x1a, 0x02, 0x40,
+  0x01, 0x2a, 0x41, 0x08, 0x10, 0x1a, 0x24, 0x04, 0x18, 0x00, 0x00, 0x83,
+  0x04, 0x66, 0x02, 0x81, 0x80, 0x01, 0x21, 0x00, 0x12, 0x8d, 0x14, 0x14,
+  0x4c, 0x04, 0xc0, 0x22, 0x18, 0x12, 0x20, 0x09, 0x29, 0x41, 0x2a, 0x22,
+  0x98, 0x22, 0x20, 0x44, 0x08, 0x00, 0x44, 0x18, 0xa0, 0x24, 0xf0, 0x34,
+  0xb7, 0x00, 0x28, 0x25, 0x04, 0x00, 0x13, 0x12, 0x02, 0x40, 0x84, 0x18,
+  0x02, 0x00, 0x20, 0x01, 0x80, 0x21, 0x04, 0x20, 0x22, 0x01, 0x48, 0x20,
+  0x81, 0x02, 0x00, 0x40, 0x82, 0x02, 0x42, 0x00, 0x20, 0x02, 0x21, 0x20,
+  0x02, 0x00, 0x88, 0x00, 0x20, 0x02, 0x2a, 0x08, 0x48, 0x3a, 0x0f, 0x20,
+  0x81, 0x42, 0x04, 0x00, 0x20, 0xa1, 0x42, 0x81, 0x00, 0x00, 0x28, 0x2c,
+  0x01, 0x14, 0x83, 0x04, 0x00, 0xa1, 0x11, 0x26, 0x02, 0x81, 0x24, 0x83,
+  0xa2, 0x12, 0x89, 0x28, 0x02, 0xa0, 0x42, 0x12, 0x30, 0x24, 0x84, 0x12,
+  0x84, 0x00, 0x40, 0x08, 0x00, 0x00, 0x84, 0x00, 0x00, 0x20, 0x12, 0xf2,
+  0xe8, 0xa4, 0x40, 0x4a, 0x62, 0x41, 0x22, 0x00, 0x2c, 0x22, 0x15, 0x02,
+  0x00, 0x83, 0x81, 0x12, 0x08, 0x81, 0x52, 0x29, 0x81, 0x32, 0x22, 0x26,
+  0x08, 0x62, 0x22, 0x84, 0x20, 0x21, 0x01, 0x80, 0x01, 0x8c, 0x04, 0x82,
+  0x11, 0x44, 0x20, 0x8a, 0x02, 0x30, 0x88, 0x21, 0x18, 0x25, 0x04, 0x30,
+  0x28, 0x85, 0x04, 0xf0, 0x6b, 0x29, 0x04, 0xff, 0x1b, 0x0b, 0x28, 0x23,
+  0x01, 0x28, 0x40, 0x45, 0x08, 0x12, 0x88, 0x16, 0x0a, 0x30, 0x84, 0x18,
+  0x88, 0x40, 0x02, 0x24, 0x46, 0xa8, 0x48, 0x4a, 0x81, 0x46, 0x28, 0x01,
+  0x90, 0x11, 0x42, 0x10, 0x41, 0x08, 0x42, 0x48, 0x2c, 0x82, 0x42, 0x04,
+  0x28, 0x24, 0x22, 0x10, 0x48, 0x04, 0x18, 0x13, 0x88, 0x11, 0x08, 0x20,
+  0x91, 0x28, 0x2c, 0x02, 0xb0, 0x84, 0xf1, 0x74, 0xcb, 0x40, 0x98, 0x28,
+  0x00, 0x00, 0x00, 0x22, 0x28, 0xc0, 0x48, 0x28, 0x29, 0x32, 0x22, 0x42,
+  0x18, 0x49, 0x08, 0x8c, 0x4a, 0x01, 0x40, 0xa8, 0x18, 0x40, 0x51, 0xc2,
+  0x25, 0xe8, 0x22, 0x68, 0x21, 0x8c, 0x44, 0x81, 0x01, 0x30, 0x42, 0x48,
+  0x38, 0x81, 0x20, 0x13, 0x08, 0x88, 0x81, 0x44, 0x44, 0x00, 0x10, 0x88,
+  0x08, 0x82, 0x20, 0x12, 0x02, 0xad, 0x36, 0xb9, 0x00, 0xf0, 0xff, 0xb4,
+  0x11, 0x24, 0x00, 0x20, 0x01, 0x28, 0x80, 0x01, 0x60, 0x81, 0x21, 0x00,
+  0x89, 0x02, 0x00, 0x89, 0x02, 0x20, 0x41, 0x88, 0x02, 0x00, 0x00, 0x80,
+  0x24, 0x11, 0x88, 0x04, 0x21, 0x20, 0x52, 0x48, 0x00, 0x00, 0x10, 0x08,
+  0x00, 0x48, 0x21, 0xf0, 0x23, 0x6c, 0x00, 0x10, 0x08, 0x81, 0x00, 0x44,
+  0x28, 0x00, 0x18, 0x16, 0x02, 0x00, 0x14, 0x00, 0x20, 0x32, 0x24, 0x84,
+  0x18, 0x20, 0x82, 0xa1, 0x21, 0x84, 0x81, 0x11, 0x23, 0x02, 0x88, 0x11,
+  0x10, 0xc4, 0x84, 0xa0, 0x24, 0x1c, 0xc1, 0x28, 0x00, 0x00, 0x81, 0x00,
+  0x28, 0x80, 0x11, 0x08, 0x20, 0x02, 0x18, 0x29, 0xf4, 0x45, 0x56, 0x40,
+  0x48, 0x88, 0x04, 0xa0, 0x24, 0x80, 0x02, 0x00, 0x44, 0x21, 0x28, 0x22,
+  0x00, 0x21, 0x24, 0x00, 0x84, 0x21, 0x80, 0x41, 0xca, 0xa2, 0x40, 0x02,
+  0x00, 0x1c, 0x63, 0x81, 0xc0, 0x28, 0x90, 0x42, 0x00, 0x00, 0x31, 0x83,
+  0x04, 0x21, 0x37, 0x42, 0x61, 0x28, 0x81, 0x00, 0x20, 0x04, 0x00, 0x21,
+  0x84, 0xce, 0x27, 0x00, 0x84, 0x22, 0x2a, 0x12, 0x08, 0x89, 0xe2, 0x61,
+  0x03, 0xc0, 0x12, 0x8f, 0x8c, 0x61, 0xc2, 0x41, 0x20, 0xc1, 0x18, 0x12,
+  0x23, 0x71, 0x48, 0xd2, 0x98, 0xa6, 0x22, 0x2c, 0x34, 0x18, 0x8f, 0x82,
+  0x22, 0xe3, 0x22, 0xb2, 0x2e, 0x41, 0xb3, 0x88, 0xe1, 0x12, 0xb1, 0x19,
+  0x54, 0x88, 0x1a, 0x91, 0x45, 0x82, 0x2d, 0x24, 0x88, 0x4b, 0x52, 0x2e,
+  0x18, 0x89, 0xe1, 0x84, 0x23, 0x62, 0x24, 0xad, 0x88, 0x4d, 0x28, 0x33,
+  0xd8, 0x44, 0x02, 0x2a, 0x74, 0x88, 0xc8, 0x18, 0x80, 0xa1, 0x22, 0xa0,
+  0x42, 0x48, 0x65, 0xf8, 0x13, 0x67, 0x40, 0xb2, 0x2a, 0x32, 0x1c, 0x41,
+  0x50, 0x41, 0x15, 0x12, 0xb2, 0x12, 0xa2, 0xa2, 0x84, 0x23, 0xb1, 0x12,
+  0x11, 0xc2, 0x28, 0x18, 0x24, 0x6f, 0x24, 0x98, 0x11, 0x28, 0x32, 0x49,
+  0xa8, 0x36, 0x84, 0x88, 0x50, 0x12, 0x46, 0xf2, 0x12, 0x18, 0x2f, 0x83,
+  0xe6, 0xa1, 0x82, 0xb1, 0x34, 0xa3, 0x84, 0x42, 0x42, 0x2e, 0x11, 0x2b,
+  0x22, 0x29, 0x82, 0x92, 0x21, 0x85, 0xc2, 0x22, 0x92, 0x30, 0x3a, 0x8f,
+  0x22, 0x92, 0x12, 0x11, 0x38, 0x10, 0x88, 0x08, 0x8c, 0xa8, 0x21, 0x82,
+  0x6a, 0xa1, 0xc1, 0x5f, 0x5b, 0x0b, 0x2a, 0xe2, 0x21, 0xd1, 0x42, 0x03,
+  0xc0, 0x61, 0x26, 0x21, 0xe6, 0x82, 0x21, 0x54, 0x48, 0x24, 0x24, 0xc8,
+  0x2b, 0x12, 0x4a, 0x6a, 0x11, 0x18, 0xa4, 0x2f, 0x82, 0x38, 0x42, 0x8f,
+  0x84, 0x54, 0x88, 0x2b, 0x66, 0x11, 0x8d, 0x3a, 0x1e, 0x18, 0x16, 0x18,
+  0x48, 0x02, 0x2f, 0x8a, 0x02, 0x85, 0x09, 0x2e, 0x62, 0x46, 0x52, 0x44,
+  0x56, 0x34, 0xd8, 0x32, 0x3a, 0x18, 0x5b, 0x8a, 0x24, 0x24, 0x84, 0x80,
+  0x58, 0x88, 0x00, 0x85, 0x28, 0x44, 0x64, 0x22, 0x28, 0x2c, 0x22, 0xf4,
+  0x6d, 0x5a, 0x00, 0x23, 0x02, 0x00, 0x46, 0x01, 0x62, 0x12, 0x6a, 0x08,
+  0x4e, 0x82, 0xe0, 0x24, 0x08, 0x4a, 0x28, 0xe1, 0x24, 0x08, 0x88, 0xa0,
+  0x84, 0xa0, 0xa4, 0x00, 0x18, 0x90, 0x12, 0x8a, 0x92, 0x12, 0x82, 0x22,
+  0x82, 0x20, 0x08, 0x82, 0x4b, 0x12, 0x82, 0x2a, 0x21, 0x48, 0x22, 0xc8,
+  0x82, 0xc0, 0x82, 0x80, 0x08, 0x88, 0x03, 0x00, 0xf1, 0x7f, 0x0a, 0x4a,
+  0xf8, 0xbe, 0xb6, 0xa0, 0x44, 0x1a, 0x73, 0x1e, 0xfc, 0x24, 0x24, 0x8f,
+  0x84, 0xf4, 0x65, 0x25, 0x95, 0xf9, 0x44, 0x66, 0x4a, 0xa7, 0x88, 0x8f,
+  0x81, 0xb1, 0x4a, 0xad, 0xdd, 0x4f, 0x6c, 0xb8, 0x12, 0xa1, 0x44, 0x1f,
+  0x1c, 0xfd, 0x94, 0x94, 0x2b, 0x11, 0x8f, 0x84, 0xf6, 0x8b, 0x89, 0xcf,
+  0xc8, 0xe8, 0x81, 0x51, 0x88, 0x8f, 0x8a, 0xf8, 0x28, 0x2a, 0x3d, 0x13,
+  0xe5, 0xfe, 0xb1, 0xb9, 0x8f, 0xa7, 0xf4, 0x13, 0x11, 0xaf, 0x8d, 0xff,
+  0xb8, 0xb8, 0x8f, 0x89, 0xf1, 0x41, 0x41, 0x8e, 0xe2, 0x6f, 0x6a, 0x3a,
+  0x82, 0x1a, 0xf2, 0xc8, 0xe8, 0x1f, 0x18, 0xf9, 0xc8, 0x68, 0x1f, 0x12,
+  0xf2, 0xca, 0xc8, 0x8f, 0x88, 0xd8, 0x88, 0xf2, 0x39, 0xb1, 0x8a, 0xf8,
+  0x81, 0x81, 0x8f, 0x81, 0xc1, 0x88, 0x8f, 0x89, 0xb9, 0x88, 0xa8, 0x55,
+  0x8f, 0x82, 0xa2, 0x8a, 0xfa, 0xa7, 0xa2, 0xc7, 0xc4, 0xaf, 0x78, 0x01,
+  0x6e, 0x62, 0x5e, 0x52, 0x8f, 0xc1, 0xc1, 0x44, 0x81, 0x00, 0xf0, 0xe4,
+  0x9f, 0x94, 0xf4, 0x36, 0x26, 0x2b, 0x54, 0x6a, 0xf6, 0xdc, 0xdc, 0x8f,
+  0xa1, 0xb9, 0xd2, 0x7f, 0x44, 0xb6, 0xd2, 0xad, 0x89, 0x1f, 0x3c, 0xfd,
+  0x54, 0x54, 0xaf, 0xad, 0xfd, 0x88, 0xaa, 0xbf, 0x9c, 0xfc, 0x2e, 0x64,
+  0x8f, 0x8d, 0xfd, 0x3a, 0x58, 0x8f, 0x8a, 0xf8, 0xa8, 0xaa, 0x9d, 0x1b,
+  0xcf, 0xe1, 0xf8, 0xb9, 0xa9, 0xaf, 0xaf, 0xfd, 0x9b, 0xb9, 0x9f, 0x97,
+  0xe5, 0x8b, 0xfb, 0x98, 0x18, 0x9f, 0x9c, 0xec, 0x26, 0xf6, 0xa6, 0xee,
+  0x27, 0x48, 0xbe, 0xa4, 0x8f, 0x84, 0xf7, 0xa9, 0x99, 0x8f, 0x8f, 0xf6,
+  0xa9, 0xab, 0xaf, 0xa4, 0x54, 0x8a, 0xaf, 0xea, 0xfa, 0x3b, 0xb9, 0x2b,
+  0xaa, 0x15, 0xf1, 0x98, 0x98, 0x8d, 0x88, 0x8f, 0x89, 0x59, 0x88, 0xda,
+  0xfd, 0xa8, 0xa8, 0xaa, 0xba, 0xf2, 0xa7, 0xe2, 0xcf, 0xc8, 0xfd, 0xff,
+  0x6d, 0xe0, 0x24, 0xe4, 0x21, 0xf7, 0x1e, 0x3c, 0x4d, 0x24, 0x8d, 0x48,
+  0x5f, 0x52, 0xf6, 0x29, 0x29, 0x6d, 0x24, 0x2b, 0x75, 0x4a, 0xf4, 0x18,
+  0x1c, 0xaf, 0x89, 0xa1, 0x79, 0x6d, 0x46, 0x2b, 0x11, 0x8a, 0xf8, 0xd1,
+  0xd1, 0x4f, 0x65, 0xf5, 0x1a, 0x18, 0xaf, 0x8e, 0xfc, 0xab, 0x89, 0xef,
+  0xc6, 0xf4, 0x38, 0x38, 0x8f, 0x8c, 0xff, 0x28, 0x28, 0x2e, 0x88, 0x9f,
+  0x91, 0x51, 0xec, 0xbf, 0x9b, 0xfb, 0xe8, 0xda, 0xbf, 0x93, 0xf1, 0x7a,
+  0x79, 0x8f, 0x81, 0xfb, 0x18, 0x98, 0x1f, 0x94, 0xe4, 0x26, 0xf6, 0x26,
+  0xe6, 0x6f, 0x42, 0xfa, 0x14, 0x34, 0x8f, 0x84, 0xf6, 0x19, 0xb9, 0x8f,
+  0xa6, 0xfe, 0x29, 0x29, 0x2f, 0x84, 0x54, 0xa8, 0xaf, 0xc2, 0xf2, 0xb9,
+  0x3b, 0x2b, 0x28, 0x15, 0xf1, 0x18, 0x18, 0x87, 0x88, 0x8f, 0x89, 0x51,
+  0x88, 0x5a, 0xf5, 0x86, 0x00, 0xf1, 0x67, 0x72, 0xaf, 0x62, 0xcf, 0xcc,
+  0xfd, 0xe7, 0x78, 0xe0, 0x22, 0xe2, 0x23, 0xf7, 0x3c, 0x3c, 0x4f, 0x46,
+  0xd2, 0x88, 0xf4, 0x24, 0x65, 0x95, 0xf9, 0x76, 0x64, 0x2b, 0x33, 0xaa,
+  0xfa, 0x18, 0x1e, 0xaf, 0xad, 0xf5, 0x92, 0x52, 0x6f, 0x68, 0xbc, 0x12,
+  0xa1, 0x45, 0x1f, 0x31, 0xf1, 0x94, 0x96, 0xaf, 0x85, 0xf4, 0x2a, 0x28,
+  0xbf, 0x96, 0xf6, 0xac, 0xcc, 0x8f, 0xa7, 0xf7, 0xa8, 0xc8, 0x87, 0x82,
+  0x8f, 0xa2, 0xf8, 0x3b, 0x39, 0xc7, 0xe9, 0xbf, 0x92, 0xf3, 0x7a, 0x5a,
+  0xbf, 0x92, 0xf3, 0xfa, 0xf9, 0x8f, 0x83, 0xf9, 0x18, 0x88, 0x1f, 0x94,
+  0xa4, 0xee, 0xef, 0x62, 0xda, 0x46, 0xa8, 0x33, 0x8f, 0x8c, 0xff, 0x39,
+  0xb9, 0x8f, 0xa7, 0xfe, 0x29, 0x2b, 0xaf, 0xac, 0xfc, 0x8a, 0x88, 0xaf,
+  0xa2, 0xf2, 0xbb, 0x39, 0x23, 0x93, 0x01, 0x62, 0x71, 0x88, 0xf8, 0x98,
+  0x18, 0x8f, 0x94, 0x01, 0xf1, 0x1d, 0x22, 0x5a, 0xaf, 0x62, 0xcd, 0x4c,
+  0x57, 0xf7, 0x20, 0x02, 0x41, 0x00, 0x20, 0x02, 0x22, 0x40, 0x42, 0x08,
+  0x00, 0x40, 0x22, 0x01, 0x10, 0x08, 0x28, 0x90, 0x28, 0x80, 0x12, 0x02,
+  0x80, 0xa2, 0x12, 0x81, 0x18, 0x42, 0x22, 0x10, 0x04, 0x00, 0x2a, 0x01,
+  0x00, 0x24, 0xbe, 0x04, 0xf0, 0x19, 0x28, 0x00, 0x70, 0x77, 0x07, 0x20,
+  0x31, 0x22, 0x00, 0x19, 0x04, 0x1a, 0x34, 0x42, 0xa0, 0x84, 0x82, 0x18,
+  0x8a, 0x04, 0x1a, 0xa4, 0x84, 0x82, 0x46, 0x62, 0x88, 0x28, 0x8a, 0x14,
+  0xe8, 0x88, 0x04, 0x10, 0xc8, 0x12, 0x12, 0x8c, 0x08, 0x8c, 0x70, 0x02,
+  0xf2, 0x65, 0x29, 0x88, 0x92, 0x98, 0x28, 0x89, 0x08, 0xad, 0x82, 0xb0,
+  0x28, 0x28, 0x08, 0x80, 0x28, 0x08, 0x86, 0x08, 0x82, 0x20, 0x2a, 0x64,
+  0x18, 0x7f, 0x93, 0x0b, 0x2e, 0x42, 0x1f, 0x41, 0x52, 0x2a, 0x1f, 0x41,
+  0x32, 0x48, 0x1f, 0x41, 0x72, 0x6a, 0xf1, 0x11, 0x24, 0xab, 0x16, 0x1d,
+  0x2c, 0xaf, 0x24, 0x99, 0x21, 0xab, 0x94, 0x55, 0xb8, 0x4a, 0x79, 0x34,
+  0xf8, 0x4a, 0xb3, 0x57, 0x82, 0x2f, 0x14, 0x79, 0x34, 0xf8, 0x42, 0x91,
+  0x4f, 0x82, 0xe4, 0x14, 0xf9, 0x25, 0x4a, 0x1c, 0xfa, 0x24, 0x4a, 0x56,
+  0xf1, 0x24, 0x5a, 0x96, 0xf1, 0x22, 0x5a, 0x9e, 0x25, 0x4f, 0xa2, 0xe5,
+  0x4d, 0xd2, 0xa4, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24, 0xcf, 0x32,
+  0xf1, 0x91, 0x24, 0xab, 0x16, 0x1f, 0x49, 0xf2, 0x4a, 0x12, 0x05, 0x00,
+  0xf0, 0x79, 0x41, 0xf2, 0x4a, 0x92, 0x19, 0xb2, 0x4a, 0x19, 0xb5, 0x4a,
+  0xb9, 0x24, 0xb4, 0x4a, 0x39, 0x24, 0x2b, 0x94, 0x47, 0x83, 0x2d, 0x94,
+  0x4f, 0x82, 0xa4, 0xb4, 0x4f, 0xa2, 0xd4, 0x82, 0x05, 0x2c, 0xf4, 0x11,
+  0x4c, 0x8d, 0x42, 0x1f, 0x41, 0x22, 0x24, 0x31, 0x42, 0x11, 0xab, 0x14,
+  0x15, 0xf4, 0x4a, 0x94, 0x19, 0xf2, 0x4a, 0xb4, 0x11, 0x8b, 0xb4, 0x41,
+  0x2b, 0x94, 0x22, 0x2b, 0x94, 0x47, 0x82, 0x29, 0x79, 0x22, 0xc8, 0x91,
+  0x6d, 0x1a, 0x88, 0x4f, 0xa2, 0xad, 0x81, 0x2e, 0x4a, 0x92, 0x8c, 0x64,
+  0x49, 0xbc, 0xe4, 0x49, 0xc2, 0x4b, 0x9e, 0x2c, 0xac, 0xe4, 0x49, 0x56,
+  0x28, 0x1b, 0x69, 0x83, 0x64, 0x48, 0xa1, 0x8e, 0x24, 0x83, 0xd4, 0x41,
+  0xf2, 0x4a, 0x84, 0x28, 0xaf, 0x44, 0x1a, 0xb4, 0x4a, 0x3b, 0x24, 0xab,
+  0x94, 0x43, 0xb2, 0x42, 0x39, 0x24, 0x29, 0x79, 0x26, 0x88, 0xf8, 0x26,
+  0x12, 0xdf, 0xd8, 0x03, 0x00, 0x48, 0x39, 0x0a, 0x11, 0x44, 0x3f, 0x0a,
+  0xb2, 0x81, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x31, 0x05, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xec, 0xf0, 0x18, 0x77, 0x00, 0x18, 0xc0, 0x22, 0x80, 0x86, 0x21, 0x62,
+  0x12, 0x44, 0x80, 0x11, 0x08, 0x85, 0x02, 0x23, 0x02, 0x5a, 0xe8, 0x62,
+  0xf4, 0x18, 0x21, 0x48, 0x18, 0x28, 0x48, 0x53, 0x92, 0x54, 0x00, 0x4c,
+  0x43, 0x24, 0x42, 0x3c, 0x44, 0x00, 0x28, 0x2a, 0x08, 0x8c, 0x59, 0x14,
+  0x24, 0x1c, 0x82, 0xb1, 0x24, 0x41, 0x02, 0x20, 0x18, 0x12, 0x14, 0x02,
+  0x12, 0x00, 0x43, 0x02, 0x83, 0xf8, 0xa8, 0xd8, 0x90, 0x42, 0x44, 0x20,
+  0x11, 0x04, 0x25, 0x02, 0x16, 0x0c, 0x12, 0x20, 0xe1, 0x84, 0x38, 0x82,
+  0x8a, 0x62, 0x49, 0x50, 0x12, 0x88, 0x48, 0x1e, 0x28, 0x94, 0x41, 0x29,
+  0x48, 0x12, 0x68, 0x12, 0x8d, 0x11, 0x2c, 0x84, 0x81, 0x84, 0x01, 0x28,
+  0x42, 0x16, 0x04, 0x27, 0x41, 0x20, 0x03, 0x16, 0xec, 0x48, 0x02, 0x89,
+  0x34, 0x21, 0x4a, 0x01, 0x41, 0x28, 0xa0, 0xa1, 0x87, 0x42, 0x2e, 0x4a,
+  0x4b, 0x61, 0x46, 0xd8, 0x18, 0xa1, 0x42, 0xdf, 0xcf, 0x47, 0x82, 0x24,
+  0x04, 0x18, 0x20, 0x24, 0x91, 0x22, 0x4c, 0x13, 0x14, 0x24, 0x31, 0x28,
+  0xc8, 0xa9, 0x28, 0xba, 0x16, 0x08, 0x1b, 0x1c, 0x6e, 0x84, 0xa7, 0x23,
+  0x8c, 0xc4, 0x18, 0x47, 0x23, 0x4a, 0x78, 0x84, 0xc2, 0x14, 0x1c, 0x82,
+  0x81, 0x81, 0x31, 0x61, 0x83, 0x31, 0x44, 0x83, 0x02, 0x66, 0x44, 0x32,
+  0x14, 0x1e, 0x88, 0x59, 0x02, 0x25, 0xe5, 0x48, 0x61, 0x42, 0x41, 0x27,
+  0x12, 0x6a, 0x01, 0x61, 0x49, 0x02, 0x8a, 0x22, 0xe1, 0xa2, 0xf4, 0x24,
+  0x12, 0x46, 0x8c, 0xb1, 0x18, 0xf8, 0x75, 0xf2, 0x00, 0x16, 0x04, 0x28,
+  0x61, 0x28, 0x21, 0x50, 0x18, 0x80, 0x01, 0x18, 0x84, 0x24, 0x80, 0x02,
+  0x21, 0x60, 0x14, 0x32, 0x14, 0x00, 0x13, 0x32, 0x48, 0x50, 0x18, 0x4f,
+  0x22, 0x44, 0x04, 0x44, 0x00, 0x48, 0x12, 0x2a, 0x08, 0x20, 0x01, 0x1e,
+  0x28, 0x22, 0x12, 0x83, 0x04, 0x20, 0x08, 0x10, 0x22, 0xd1, 0x48, 0x02,
+  0x42, 0x22, 0x81, 0x2a, 0xf4, 0x27, 0xb9, 0x40, 0xa2, 0x21, 0x25, 0xa1,
+  0x21, 0x00, 0x2e, 0x11, 0x19, 0x04, 0x92, 0x24, 0x1f, 0x88, 0x04, 0x48,
+  0x8d, 0x13, 0x41, 0x10, 0x01, 0x82, 0x18, 0x13, 0xa8, 0xa4, 0x13, 0x0a,
+  0x00, 0x11, 0xb0, 0x21, 0x04, 0x49, 0x68, 0x45, 0x88, 0x00, 0x10, 0x02,
+  0x41, 0x28, 0x49, 0x88, 0x62, 0x22, 0x00, 0x13, 0x18, 0x18, 0x51, 0x18,
+  0x80, 0x21, 0x01, 0x82, 0x28, 0x82, 0x28, 0x43, 0x78, 0xd2, 0x0c, 0x31,
+  0x80, 0x53, 0x94, 0x2d, 0x21, 0x93, 0x41, 0xc2, 0x28, 0x8b, 0x21, 0x23,
+  0x36, 0x21, 0x60, 0x81, 0x8d, 0x86, 0x4a, 0xf8, 0x49, 0x22, 0x6e, 0x91,
+  0xab, 0x86, 0xba, 0xe4, 0x14, 0xf1, 0x82, 0x21, 0x4d, 0x18, 0x53, 0x71,
+  0x44, 0xe8, 0x22, 0x84, 0x64, 0x33, 0x89, 0x86, 0x53, 0xa4, 0x87, 0x42,
+  0x42, 0x22, 0x43, 0x32, 0x24, 0x2d, 0xc1, 0x1c, 0x41, 0xb6, 0x24, 0xf1,
+  0x88, 0x63, 0x4c, 0xc1, 0x41, 0x12, 0x86, 0x24, 0xb8, 0x11, 0xba, 0x22,
+  0xc1, 0x81, 0x82, 0x6d, 0xc2, 0x4b, 0x4b, 0x2e, 0x86, 0x2c, 0xf8, 0x14,
+  0x42, 0x5c, 0xc3, 0x44, 0x1a, 0x86, 0x05, 0x4f, 0x39, 0x08, 0x24, 0x36,
+  0x42, 0x31, 0x34, 0x21, 0x15, 0xb8, 0x21, 0xb1, 0x41, 0x62, 0x83, 0xe8,
+  0x14, 0x3b, 0x84, 0x84, 0x8d, 0x82, 0x8b, 0x1c, 0xd3, 0xb6, 0x41, 0xb1,
+  0x48, 0x8a, 0x84, 0xbc, 0x81, 0xd1, 0x14, 0x49, 0xe5, 0x44, 0x8a, 0x32,
+  0x42, 0x24, 0x91, 0x12, 0x64, 0x4d, 0x28, 0x86, 0x64, 0x41, 0x82, 0x64,
+  0x88, 0x17, 0x21, 0x41, 0x70, 0x84, 0x2a, 0x31, 0x81, 0x18, 0x86, 0x94,
+  0x82, 0x1c, 0xba, 0x33, 0x58, 0x81, 0x88, 0x4e, 0x89, 0x43, 0xcb, 0xa6,
+  0x98, 0x42, 0x1b, 0x81, 0x28, 0x2a, 0x89, 0x13, 0xe4, 0x7c, 0x07, 0x25,
+  0x01, 0x38, 0x85, 0xc1, 0x21, 0x12, 0x50, 0x82, 0x24, 0x12, 0x28, 0x81,
+  0x18, 0x46, 0x44, 0x03, 0x23, 0x1a, 0xa3, 0x1a, 0x1c, 0x31, 0x22, 0x81,
+  0x1a, 0x4e, 0x29, 0x04, 0x2e, 0x11, 0x68, 0x28, 0x2e, 0x49, 0x20, 0x24,
+  0x66, 0x42, 0x28, 0x46, 0x01, 0xf0, 0x12, 0x24, 0x2e, 0x41, 0x4c, 0x62,
+  0x44, 0x28, 0x28, 0x20, 0x01, 0x88, 0x34, 0x41, 0x29, 0x24, 0x01, 0x2d,
+  0x14, 0x63, 0xc2, 0x44, 0x42, 0x42, 0x82, 0xb7, 0x16, 0xd0, 0x14, 0xc4,
+  0x12, 0x85, 0x22, 0x88, 0x21, 0x01, 0xa9, 0x62, 0x54, 0x80, 0xc2, 0x51,
+  0x23, 0x0a, 0x85, 0x71, 0x24, 0xa1, 0x84, 0x80, 0x01, 0xa2, 0x86, 0x02,
+  0x52, 0x00, 0x18, 0x28, 0x49, 0x26, 0xc2, 0x21, 0x44, 0x20, 0x92, 0x24,
+  0x44, 0x23, 0x5c, 0x12, 0x20, 0x31, 0x28, 0x44, 0x28, 0x31, 0x43, 0xf4,
+  0x24, 0x8a, 0x30, 0x22, 0x18, 0x58, 0xa3, 0x88, 0xc8, 0x12, 0x60, 0x48,
+  0x1e, 0x88, 0x22, 0x84, 0x1a, 0xf2, 0x58, 0x21, 0x14, 0x00, 0x28, 0x93,
+  0xa1, 0xa4, 0x48, 0x45, 0x68, 0x11, 0x00, 0x8c, 0x11, 0x26, 0xb2, 0x42,
+  0x41, 0x04, 0x1e, 0x22, 0x46, 0x63, 0x38, 0x6e, 0x18, 0x18, 0x29, 0x44,
+  0xa8, 0x21, 0x2a, 0x04, 0x83, 0x76, 0x1a, 0x34, 0x83, 0x43, 0x11, 0x08,
+  0xcc, 0x54, 0x42, 0x12, 0x15, 0x28, 0x64, 0x28, 0x24, 0x11, 0x14, 0xb0,
+  0x43, 0x81, 0x02, 0x59, 0x05, 0x32, 0x94, 0x00, 0xa4, 0x46, 0x6c, 0x41,
+  0x21, 0x2d, 0x42, 0x44, 0x16, 0xa4, 0x41, 0xad, 0xe3, 0x00, 0x20, 0x31,
+  0x84, 0x43, 0x18, 0x98, 0x22, 0x64, 0x00, 0x48, 0x28, 0x12, 0x84, 0x12,
+  0x50, 0x82, 0x28, 0x48, 0x44, 0x2d, 0x41, 0x44, 0x19, 0x15, 0x94, 0x84,
+  0x14, 0x54, 0x40, 0x02, 0x43, 0x24, 0x82, 0x23, 0x01, 0x29, 0x92, 0x24,
+  0x10, 0x08, 0x4b, 0x18, 0x22, 0x41, 0xc3, 0x81, 0x02, 0x80, 0x98, 0x44,
+  0xc0, 0x44, 0x21, 0x40, 0x08, 0x20, 0x84, 0x48, 0xd4, 0x14, 0x4c, 0x11,
+  0x24, 0xe1, 0x21, 0x32, 0x19, 0x58, 0xd0, 0x2a, 0xc2, 0x1c, 0x1c, 0x04,
+  0x1a, 0x92, 0x52, 0x1a, 0x18, 0xc8, 0x18, 0x13, 0xc2, 0x8a, 0x2c, 0x96,
+  0x81, 0xaf, 0x62, 0x44, 0xc1, 0x44, 0x9c, 0x94, 0x64, 0x49, 0x42, 0x71,
+  0x45, 0x7a, 0x28, 0xf6, 0xa1, 0x46, 0x44, 0x4d, 0x29, 0x44, 0x4d, 0x62,
+  0x18, 0x4b, 0x12, 0x37, 0x42, 0x2f, 0x68, 0x12, 0x51, 0x2a, 0x11, 0x8d,
+  0x21, 0xb0, 0x44, 0x51, 0x92, 0x41, 0x83, 0x07, 0x2b, 0x18, 0x94, 0x1a,
+  0x64, 0x4c, 0x8c, 0xf8, 0x42, 0x14, 0x47, 0x81, 0xb0, 0x18, 0x24, 0xb6,
+  0x18, 0x48, 0xf4, 0x1f, 0x4d, 0xc0, 0x41, 0x10, 0x4a, 0x34, 0x24, 0x1e,
+  0x48, 0x41, 0x19, 0x12, 0x06, 0x83, 0x94, 0x21, 0x25, 0xa2, 0x41, 0x54,
+  0x41, 0x2b, 0x34, 0x11, 0x4a, 0x21, 0xa1, 0xb4, 0x82, 0x18, 0xa0, 0x84,
+  0xa0, 0x21, 0x18, 0xa0, 0x12, 0x42, 0x22, 0x83, 0x31, 0x24, 0x00, 0x80,
+  0x08, 0x18, 0x96, 0x74, 0x24, 0x92, 0x21, 0x4b, 0x12, 0x68, 0x3c, 0x08,
+  0xb0, 0x14, 0x44, 0x42, 0x18, 0x42, 0x58, 0x22, 0x43, 0x98, 0x82, 0x41,
+  0x44, 0x2a, 0xe4, 0xbf, 0x08, 0x50, 0x22, 0x00, 0x24, 0x42, 0x20, 0x22,
+  0x21, 0xd8, 0x82, 0x22, 0x64, 0x81, 0x8b, 0x48, 0x31, 0x46, 0x01, 0x22,
+  0x12, 0x28, 0x00, 0x20, 0x08, 0x14, 0x18, 0x40, 0x62, 0x44, 0x22, 0x00,
+  0x21, 0x41, 0x7c, 0x34, 0x44, 0x82, 0x49, 0x64, 0x18, 0x61, 0x14, 0x20,
+  0x08, 0x24, 0x82, 0x26, 0x02, 0x11, 0x8a, 0x81, 0xd1, 0x22, 0x22, 0x01,
+  0x41, 0x00, 0x28, 0xaf, 0xcd, 0x0c, 0x21, 0x10, 0x04, 0x99, 0x02, 0x81,
+  0x00, 0x84, 0x18, 0xa1, 0x00, 0x18, 0x88, 0x40, 0x31, 0x28, 0x88, 0x28,
+  0x26, 0x31, 0x28, 0x16, 0x01, 0x21, 0x81, 0x23, 0x24, 0x02, 0x44, 0x46,
+  0x02, 0x00, 0x82, 0x16, 0x02, 0x10, 0x22, 0x01, 0x25, 0x04, 0x00, 0x22,
+  0x90, 0x84, 0x26, 0x04, 0x20, 0x11, 0x8c, 0x1a, 0x02, 0x81, 0x88, 0x5f,
+  0x33, 0x0b, 0x10, 0x58, 0x12, 0x21, 0x11, 0x2b, 0x42, 0x20, 0x54, 0x12,
+  0x82, 0x14, 0x62, 0x31, 0x88, 0x11, 0x19, 0x44, 0x02, 0x40, 0x02, 0x80,
+  0x01, 0x00, 0x40, 0x22, 0x02, 0x22, 0x10, 0x24, 0xba, 0x12, 0x42, 0x01,
+  0x24, 0x90, 0x81, 0x10, 0x01, 0x92, 0x44, 0x00, 0x00, 0x19, 0x02, 0x48,
+  0x41, 0xc0, 0x14, 0x2e, 0x14, 0x28, 0x10, 0xf4, 0x55, 0x4d, 0x50, 0x81,
+  0x10, 0x88, 0x02, 0x10, 0x02, 0x81, 0x28, 0x00, 0x20, 0x44, 0x04, 0x84,
+  0x46, 0x88, 0x02, 0x44, 0x10, 0x62, 0x24, 0x44, 0x29, 0x04, 0x22, 0x20,
+  0x12, 0x42, 0x04, 0x40, 0x22, 0x08, 0x8a, 0xc4, 0x28, 0x10, 0x02, 0x10,
+  0x61, 0x82, 0x41, 0x00, 0x8c, 0x02, 0x88, 0x00, 0x48, 0x00, 0x48, 0x24,
+  0xf0, 0xe1, 0x57, 0x80, 0x01, 0x81, 0x81, 0x2d, 0x28, 0x00, 0x50, 0x28,
+  0x84, 0x28, 0x29, 0x12, 0x06, 0x24, 0x82, 0x40, 0x01, 0x2e, 0x41, 0x28,
+  0x11, 0x40, 0x21, 0x08, 0x10, 0x11, 0x32, 0x81, 0x12, 0x2c, 0x88, 0x02,
+  0x00, 0x10, 0xb2, 0x14, 0x04, 0x44, 0x82, 0x29, 0x02, 0x29, 0xca, 0x42,
+  0x00, 0x23, 0x08, 0x28, 0x2c, 0x01, 0x18, 0x24, 0x42, 0x00, 0x47, 0x18,
+  0x9f, 0xed, 0x0a, 0x84, 0x40, 0x82, 0x02, 0x84, 0x26, 0x41, 0x18, 0x82,
+  0x14, 0x82, 0x88, 0xc2, 0x22, 0x22, 0x10, 0x82, 0x18, 0x92, 0x82, 0x18,
+  0x82, 0x22, 0x21, 0xc0, 0x11, 0x24, 0x60, 0x41, 0x41, 0x00, 0x10, 0x04,
+  0x41, 0x2d, 0x28, 0x55, 0x02, 0x49, 0x24, 0x12, 0x14, 0xb4, 0x44, 0x02,
+  0x14, 0x88, 0x45, 0x01, 0x24, 0x12, 0xc0, 0x88, 0x44, 0x49, 0x48, 0x22,
+  0x98, 0x12, 0x12, 0xbf, 0x2d, 0x44, 0x42, 0x0c, 0x22, 0x10, 0x84, 0x52,
+  0xa6, 0x30, 0x24, 0x00, 0xc4, 0x24, 0x81, 0x00, 0x00, 0x00, 0xa4, 0x42,
+  0x21, 0x40, 0x08, 0x41, 0x10, 0x58, 0x22, 0x81, 0x21, 0x10, 0x0a, 0x84,
+  0x41, 0x48, 0x10, 0x02, 0x20, 0x01, 0x20, 0x02, 0xc0, 0x24, 0x46, 0x14,
+  0x08, 0x12, 0x24, 0x40, 0x28, 0x14, 0x22, 0xf2, 0x75, 0xd9, 0x20, 0x28,
+  0x0a, 0x84, 0x88, 0x81, 0x11, 0xc0, 0x21, 0x22, 0x91, 0x82, 0x11, 0x20,
+  0x02, 0x81, 0x4a, 0x08, 0x2d, 0x41, 0x80, 0x58, 0x22, 0x28, 0x20, 0x01,
+  0x11, 0x10, 0x41, 0x14, 0x06, 0x49, 0x6a, 0x22, 0x00, 0x45, 0x01, 0x41,
+  0x90, 0x84, 0x18, 0x49, 0x93, 0x84, 0x13, 0x82, 0x12, 0x01, 0x24, 0x00,
+  0x43, 0x08, 0x12, 0x22, 0x82, 0x00, 0x2b, 0x1b, 0xd0, 0xa1, 0x11, 0xb8,
+  0x21, 0x04, 0x00, 0x2c, 0xe2, 0x84, 0x42, 0x22, 0x04, 0x44, 0x81, 0x28,
+  0x24, 0xc0, 0x16, 0x8c, 0x42, 0x04, 0x21, 0x22, 0x25, 0x04, 0x18, 0x90,
+  0x82, 0x22, 0xa0, 0x28, 0x20, 0x78, 0x14, 0x41, 0x42, 0x44, 0x08, 0x48,
+  0x00, 0x84, 0x48, 0x84, 0x11, 0x21, 0x18, 0xc4, 0x41, 0x28, 0x00, 0x00,
+  0x20, 0x22, 0x05, 0x21, 0xf0, 0xb3, 0xeb, 0x20, 0x71, 0x82, 0x5a, 0x9b,
+  0x27, 0xa2, 0x8e, 0x27, 0x8b, 0x26, 0xa4, 0xaf, 0x24, 0x86, 0xf2, 0x28,
+  0xa8, 0x2a, 0x92, 0xc8, 0x47, 0x12, 0x2f, 0x88, 0x1c, 0x31, 0x81, 0x70,
+  0x23, 0x59, 0x28, 0x23, 0x84, 0xa1, 0x88, 0x26, 0x04, 0x61, 0x2b, 0x11,
+  0x41, 0x15, 0x71, 0x12, 0x6a, 0x22, 0x63, 0xf3, 0x82, 0x82, 0x24, 0x2e,
+  0x22, 0x26, 0x64, 0x2c, 0xad, 0x36, 0x31, 0x2f, 0x27, 0xe4, 0x34, 0x88,
+  0xa3, 0x88, 0x6d, 0x24, 0x6a, 0x41, 0x14, 0xc1, 0x88, 0x34, 0x83, 0x38,
+  0x41, 0xa9, 0x09, 0x21, 0x83, 0x11, 0x74, 0x14, 0xa4, 0x8c, 0x34, 0x41,
+  0xdf, 0x95, 0x0d, 0x29, 0xa1, 0x28, 0x28, 0x89, 0x42, 0xd8, 0x82, 0xd4,
+  0x41, 0x02, 0x85, 0x73, 0x42, 0x52, 0x39, 0x23, 0x5c, 0x81, 0x87, 0x24,
+  0x2c, 0x12, 0x52, 0xa8, 0x88, 0x36, 0xe4, 0x3a, 0x72, 0x26, 0xba, 0x21,
+  0x72, 0x18, 0xa2, 0x1c, 0x2c, 0x78, 0x41, 0x83, 0x71, 0x62, 0x22, 0xd2,
+  0x17, 0xc2, 0x2c, 0x45, 0x44, 0x04, 0x2c, 0x11, 0x93, 0x44, 0x4b, 0x88,
+  0x10, 0x54, 0x46, 0x57, 0x34, 0x84, 0x5f, 0x38, 0xb2, 0xaa, 0xea, 0x36,
+  0xa3, 0x2a, 0x55, 0x44, 0x94, 0x24, 0x32, 0x2c, 0xa1, 0xb8, 0x18, 0x2e,
+  0x14, 0x2f, 0x86, 0x81, 0x12, 0xe8, 0x4b, 0x78, 0x55, 0x43, 0x52, 0x71,
+  0x81, 0x47, 0x22, 0x30, 0x29, 0x24, 0xa7, 0x12, 0x26, 0x78, 0x33, 0xac,
+  0x48, 0x27, 0x81, 0x2e, 0x2a, 0xa3, 0x01, 0x67, 0x13, 0x4e, 0xc1, 0x2d,
+  0x14, 0x8b, 0x6c, 0x29, 0x92, 0xc1, 0x28, 0x1c, 0x84, 0x72, 0x23, 0x41,
+  0x08, 0x85, 0x82, 0x92, 0x24, 0xce, 0x84, 0x24, 0x42, 0x6b, 0x21, 0x6f,
+  0xc8, 0x98, 0x26, 0x4d, 0x85, 0x40, 0x57, 0x4c, 0x37, 0x48, 0x84, 0x44,
+  0x1a, 0xe1, 0x41, 0x18, 0x44, 0x14, 0x82, 0x92, 0x86, 0x26, 0x27, 0xa8,
+  0x41, 0xc7, 0x61, 0x4d, 0x44, 0x2f, 0x29, 0xca, 0x62, 0x48, 0x18, 0x28,
+  0xef, 0x49, 0x0e, 0x15, 0x14, 0x52, 0xc1, 0x50, 0xc1, 0x62, 0x15, 0x2c,
+  0x56, 0xc1, 0x4a, 0x18, 0xa1, 0x86, 0x15, 0xa8, 0x84, 0x51, 0x4e, 0x83,
+  0x41, 0x4e, 0xa3, 0x45, 0xc8, 0xa1, 0x03, 0x00, 0xf1, 0xff, 0xff, 0x7b,
+  0x81, 0x45, 0x48, 0x51, 0x86, 0x1c, 0x42, 0xe8, 0x18, 0x52, 0x84, 0x82,
+  0x84, 0x82, 0x43, 0x32, 0x81, 0x41, 0x13, 0x18, 0x3c, 0x81, 0xe1, 0x13,
+  0x18, 0x3e, 0x91, 0xeb, 0x82, 0x11, 0xab, 0x82, 0x11, 0xa9, 0x08, 0xa9,
+  0x28, 0xd1, 0x4a, 0x68, 0x81, 0x2d, 0xa4, 0x16, 0x88, 0x48, 0x88, 0x68,
+  0xc4, 0x34, 0x77, 0x74, 0x5f, 0x72, 0xd2, 0x71, 0xd2, 0x5e, 0xd2, 0x5d,
+  0xfc, 0x4e, 0x67, 0x3d, 0x49, 0x7f, 0x54, 0x76, 0x45, 0xf7, 0xee, 0xe7,
+  0x3f, 0x3c, 0xf6, 0xeb, 0xe3, 0xbf, 0xb8, 0xf4, 0xcf, 0xc7, 0x7f, 0x7c,
+  0xf4, 0xc5, 0xc7, 0xfb, 0x9d, 0x1f, 0x7c, 0xfe, 0xc3, 0xce, 0xff, 0xfc,
+  0xfe, 0xbb, 0x1b, 0x9f, 0xdc, 0xfe, 0x81, 0x8c, 0xdf, 0xf2, 0x72, 0x8b,
+  0x5b, 0xdf, 0x55, 0xdf, 0xb9, 0xf2, 0xdd, 0xdd, 0x9f, 0xbc, 0xfe, 0x33,
+  0x96, 0xcf, 0xe8, 0xf8, 0xbc, 0xbe, 0x8e, 0x82, 0x2f, 0x7e, 0xfc, 0xc3,
+  0xc3, 0x2f, 0x72, 0xfa, 0x8b, 0x8f, 0xaf, 0xf9, 0xf9, 0xc9, 0xcf, 0xbf,
+  0x7a, 0xfa, 0xc1, 0xcf, 0x2f, 0xf2, 0xfb, 0x99, 0x9f, 0x2f, 0x7e, 0xfc,
+  0xd3, 0xfb, 0x3f, 0xba, 0x7a, 0x89, 0xfb, 0x86, 0x87, 0xff, 0xfc, 0xf4,
+  0xaa, 0xaa, 0xaf, 0xa8, 0xf9, 0x86, 0x82, 0x3f, 0x88, 0xf9, 0xac, 0xb9,
+  0xcf, 0x8b, 0xf4, 0x88, 0xc8, 0x9e, 0x98, 0xcf, 0xea, 0x68, 0xf3, 0x24,
+  0x3f, 0x35, 0xb5, 0x61, 0x56, 0xf9, 0x7f, 0x52, 0xf6, 0x41, 0x4b, 0x3f,
+  0x36, 0xf6, 0x6f, 0x45, 0xdf, 0x44, 0xf6, 0x49, 0x4b, 0x3f, 0x3e, 0xfe,
+  0xef, 0xa7, 0xbf, 0x2c, 0xfe, 0xeb, 0xe5, 0x9f, 0xac, 0xfc, 0x83, 0xc1,
+  0x5f, 0x7c, 0xfc, 0x5f, 0xd3, 0x1f, 0xfe, 0xfc, 0x23, 0xcf, 0xff, 0xfe,
+  0xfe, 0xb6, 0xb5, 0x3f, 0x5e, 0xde, 0xd1, 0xf8, 0x2f, 0x3f, 0x67, 0x78,
+  0x3f, 0x38, 0x48, 0xfb, 0x2d, 0xad, 0xde, 0x51, 0x1f, 0x7e, 0xfe, 0xbb,
+  0xbf, 0xff, 0xb8, 0xf8, 0xbc, 0x3e, 0x8e, 0xa7, 0xbf, 0xfe, 0xf4, 0xc3,
+  0xc3, 0x7f, 0xfa, 0xfe, 0x83, 0x83, 0x3f, 0x59, 0xf1, 0xc9, 0xcb, 0xbf,
+  0x6a, 0xf2, 0xc3, 0xcb, 0x3f, 0xfb, 0xfb, 0x8b, 0xbb, 0xbf, 0xdc, 0xfe,
+  0x73, 0xff, 0x3f, 0xa8, 0xfa, 0x8b, 0xab, 0xff, 0xd8, 0xf8, 0xc7, 0xe7,
+  0x2b, 0xbb, 0xad, 0x8a, 0xef, 0x89, 0xd8, 0xa6, 0xf9, 0xbe, 0x99, 0xbe,
+  0xb2, 0x2b, 0xcc, 0x1e, 0x98, 0xcf, 0xeb, 0xf9, 0x11, 0x83, 0x24, 0x35,
+  0xf3, 0x21, 0x62, 0xd5, 0x5b, 0x6a, 0xb7, 0x3a, 0xaf, 0x24, 0xd6, 0xdf,
+  0xb2, 0x4b, 0x56, 0x31, 0xaf, 0x2c, 0x7e, 0x63, 0xff, 0xeb, 0xe2, 0xbd,
+  0x29, 0x1f, 0xac, 0xdc, 0x33, 0xf4, 0xc7, 0xc3, 0xaf, 0x41, 0xf9, 0xcb,
+  0xe3, 0xef, 0x24, 0xfc, 0xe3, 0xeb, 0x6f, 0x53, 0xf3, 0xc3, 0xe1, 0xcb,
+  0x82, 0x1f, 0x9a, 0xf3, 0x86, 0x85, 0x3d, 0x83, 0x85, 0xd3, 0xb1, 0xf2,
+  0xb4, 0x15, 0x5f, 0x3a, 0xfa, 0x3e, 0x3e, 0x6f, 0x78, 0xf8, 0xb6, 0x36,
+  0xcf, 0xa8, 0xf8, 0xa6, 0x2e, 0x7f, 0x78, 0xf8, 0x22, 0x66, 0x3f, 0x78,
+  0xf8, 0x92, 0x16, 0x9f, 0x7c, 0xfc, 0xa3, 0x2c, 0x1f, 0x7c, 0xfc, 0x3a,
+  0x24, 0x1f, 0x79, 0xf9, 0xea, 0xcc, 0x3f, 0x77, 0xbd, 0xab, 0xda, 0x31,
+  0xf2, 0x8e, 0x8d, 0x7f, 0x74, 0xb4, 0xa2, 0xda, 0x22, 0xf9, 0x8e, 0x9c,
+  0xad, 0x96, 0x6f, 0x8b, 0xbb, 0x14, 0xb3, 0x82, 0xf8, 0x18, 0x91, 0x4f,
+  0xea, 0xfb, 0x8f, 0x5a, 0x24, 0x77, 0x74, 0x2b, 0x62, 0xff, 0xb2, 0xf2,
+  0x62, 0x25, 0xdf, 0xf2, 0xf4, 0x6a, 0x63, 0xbf, 0x12, 0xf6, 0x4e, 0x64,
+  0xdf, 0xd6, 0xf2, 0xca, 0xeb, 0xbf, 0xfa, 0xf2, 0xea, 0xc2, 0x5f, 0x98,
+  0xf4, 0xc8, 0xca, 0x77, 0x58, 0x7f, 0x3c, 0xfc, 0x5b, 0x16, 0xbf, 0xbe,
+  0xfe, 0x2f, 0x62, 0x7f, 0xfc, 0xfe, 0xb8, 0x18, 0x1f, 0x1e, 0x7e, 0x2d,
+  0xf2, 0xa5, 0x2d, 0x8f, 0x88, 0xd8, 0x31, 0x58, 0x6c, 0x5f, 0xfa, 0xf2,
+  0x38, 0x18, 0x1f, 0x78, 0xfa, 0x33, 0x96, 0xaf, 0xb8, 0xf8, 0x34, 0x36,
+  0x9f, 0xc8, 0xfa, 0x22, 0x2f, 0x3f, 0x18, 0xf8, 0x2e, 0xa7, 0x7f, 0x38,
+  0xf8, 0x1e, 0x1f, 0xdf, 0x3c, 0xfc, 0x26, 0x2e, 0x5f, 0x3c, 0xfc, 0x3e,
+  0xb7, 0xdf, 0xbb, 0xfa, 0xe6, 0xe5, 0x1f, 0x37, 0xf7, 0xaa, 0x82, 0x97,
+  0xb8, 0x3f, 0x58, 0xf8, 0xc5, 0x47, 0xaf, 0x8b, 0xfb, 0x18, 0x1a, 0x6b,
+  0x99, 0xcd, 0x13, 0x6f, 0xe8, 0xfb, 0xfa, 0x6c, 0x2b, 0xcc, 0x8b, 0x11,
+  0xae, 0xac, 0xef, 0xa6, 0x0e, 0x00, 0x40, 0x58, 0x22, 0x84, 0x22, 0x60,
+  0x22, 0x84, 0x24, 0x84, 0x24, 0x00, 0x00, 0xc0, 0x22, 0x00, 0x80, 0x02,
+  0x00, 0x00, 0x28, 0x21, 0x10, 0x02, 0x23, 0x02, 0x21, 0x10, 0x02, 0x41,
+  0x89, 0x09, 0xf0, 0x03, 0x12, 0x20, 0x41, 0x04, 0x00, 0x00, 0xaf, 0xd5,
+  0x09, 0x24, 0x20, 0x02, 0x80, 0x12, 0x08, 0x00, 0x80, 0x02, 0xad, 0x0f,
+  0xf2, 0x13, 0x22, 0x00, 0x00, 0x88, 0x00, 0x00, 0x23, 0x42, 0x14, 0x04,
+  0x40, 0x14, 0x04, 0x40, 0x04, 0x10, 0x04, 0x18, 0x4c, 0x02, 0x28, 0x00,
+  0x44, 0x00, 0x40, 0x32, 0x24, 0x18, 0x48, 0x30, 0x24, 0x17, 0x78, 0xc0,
+  0xc5, 0x0a, 0xf0, 0x4b, 0xc1, 0x32, 0x68, 0x1f, 0xc1, 0x32, 0x6a, 0x1f,
+  0xc1, 0xb2, 0x4a, 0xf1, 0x11, 0x2c, 0xab, 0x96, 0x1b, 0x21, 0xab, 0x94,
+  0x57, 0x81, 0xab, 0x94, 0x43, 0xf2, 0x4a, 0x91, 0x43, 0xf3, 0x42, 0xb1,
+  0x47, 0x82, 0x2d, 0xb1, 0x4f, 0x83, 0xe4, 0x14, 0xfb, 0x24, 0x4a, 0x4e,
+  0x81, 0x4f, 0xa2, 0x64, 0x15, 0x4f, 0xa2, 0xe5, 0x19, 0xf2, 0x24, 0x4a,
+  0xde, 0x25, 0xac, 0xe4, 0x49, 0xf2, 0x24, 0x4a, 0x1f, 0x49, 0xd2, 0x24,
+  0xf5, 0x91, 0x24, 0xcf, 0x22, 0xf1, 0x91, 0x24, 0xc3, 0xf4, 0x91, 0x24,
+  0xeb, 0x14, 0x1f, 0x49, 0xb2, 0x6e, 0xd1, 0x41, 0xb2, 0x6a, 0x0f, 0x0b,
+  0xf7, 0x70, 0x51, 0xab, 0x94, 0x43, 0xf3, 0x4a, 0x92, 0x4b, 0x43, 0x2f,
+  0x64, 0xfb, 0x34, 0x48, 0x2d, 0xb4, 0x4f, 0x82, 0x84, 0xfb, 0x24, 0x4a,
+  0x5e, 0xd7, 0xc0, 0x42, 0x1f, 0x81, 0xd6, 0x28, 0xb4, 0x11, 0x32, 0x48,
+  0x1b, 0x21, 0xa3, 0x94, 0x21, 0x8b, 0x14, 0x19, 0xf2, 0x4a, 0x84, 0x19,
+  0xf2, 0x4a, 0xa4, 0x11, 0xab, 0xb4, 0x22, 0x8f, 0x14, 0x29, 0xe2, 0x14,
+  0x29, 0xd2, 0x12, 0x08, 0x1c, 0xf9, 0x22, 0x12, 0x1c, 0xb8, 0x22, 0xcd,
+  0x81, 0x24, 0x96, 0xe1, 0x22, 0x64, 0x19, 0x34, 0x8e, 0x25, 0x2c, 0x74,
+  0x81, 0xc8, 0x42, 0x1f, 0x89, 0x06, 0x1f, 0x48, 0x26, 0xf4, 0x81, 0x24,
+  0x21, 0x1f, 0x48, 0xb2, 0x42, 0x51, 0x41, 0x2f, 0x44, 0x19, 0xf1, 0x42,
+  0xb4, 0x51, 0x29, 0x3b, 0x24, 0x2b, 0x84, 0x22, 0x98, 0x41, 0x98, 0x6b,
+  0x42, 0x98, 0x6f, 0x22, 0xf5, 0x6e, 0x63, 0x00, 0x82, 0xc2, 0x0a, 0x11,
+  0x21, 0xc2, 0x0a, 0x10, 0x14, 0x05, 0x0c, 0x04, 0x01, 0x00, 0xf2, 0xff,
+  0x13, 0x40, 0x01, 0x2f, 0xe5, 0x0f, 0x62, 0x22, 0x28, 0x12, 0x12, 0x2c,
+  0x43, 0x82, 0x42, 0x48, 0xb8, 0x52, 0x88, 0x11, 0x08, 0x83, 0x14, 0x08,
+  0x94, 0x20, 0x01, 0x68, 0x48, 0x00, 0x60, 0x22, 0x14, 0x84, 0x45, 0x92,
+  0x88, 0xa0, 0x18, 0xb0, 0x86, 0xc6, 0x42, 0xa8, 0x60, 0x81, 0x70, 0x84,
+  0x48, 0x14, 0x25, 0x81, 0x82, 0x43, 0x28, 0x41, 0x01, 0x24, 0x20, 0x02,
+  0xc0, 0x88, 0x46, 0x8c, 0x78, 0x64, 0xf2, 0x2e, 0x11, 0x10, 0xe4, 0x38,
+  0x61, 0x41, 0x14, 0x10, 0x69, 0x84, 0x34, 0x40, 0x11, 0xc8, 0x21, 0xc2,
+  0x14, 0x21, 0x25, 0x52, 0x81, 0x22, 0xf3, 0x4c, 0x92, 0x81, 0x60, 0x88,
+  0x26, 0xd2, 0x49, 0x88, 0x92, 0x47, 0x24, 0x15, 0x24, 0x52, 0x41, 0x27,
+  0x24, 0x44, 0x48, 0x14, 0x14, 0x20, 0x58, 0x12, 0x61, 0x3c, 0x22, 0xf1,
+  0x88, 0x12, 0x60, 0x31, 0x82, 0x26, 0x01, 0x64, 0x92, 0xe9, 0x02, 0x45,
+  0x92, 0x1c, 0x16, 0xa6, 0x14, 0x1c, 0x42, 0x01, 0x3f, 0xbd, 0x4c, 0x21,
+  0xe4, 0x1e, 0x91, 0x24, 0x1c, 0x21, 0xc1, 0x18, 0x83, 0xd4, 0x23, 0x42,
+  0x48, 0xd9, 0x84, 0xe5, 0x11, 0xb2, 0x28, 0x4c, 0x81, 0x54, 0x28, 0x11,
+  0x87, 0x32, 0x15, 0xc8, 0x12, 0x17, 0x28, 0x4a, 0x92, 0x48, 0x1a, 0x92,
+  0x81, 0x86, 0x32, 0x41, 0x25, 0x13, 0x85, 0xd2, 0xc3, 0x98, 0x41, 0x61,
+  0x48, 0x8f, 0x5a, 0x94, 0x41, 0x23, 0x2c, 0xd8, 0x3a, 0x01, 0x87, 0x32,
+  0x41, 0xdf, 0x21, 0x88, 0xc1, 0x23, 0x49, 0x4b, 0x21, 0x43, 0xc2, 0x92,
+  0x83, 0x02, 0x24, 0x16, 0x58, 0x24, 0xac, 0xdc, 0x48, 0x66, 0x18, 0x43,
+  0xf3, 0x78, 0xec, 0x30, 0x24, 0x90, 0x12, 0x00, 0x19, 0x12, 0x02, 0x00,
+  0x29, 0x08, 0x00, 0xa5, 0x02, 0x81, 0xe0, 0x44, 0x08, 0x00, 0x88, 0x24,
+  0x85, 0x24, 0xc2, 0x24, 0x10, 0x18, 0x04, 0x21, 0x92, 0x24, 0x00, 0x28,
+  0x00, 0x41, 0x86, 0x84, 0x01, 0x20, 0x01, 0x8c, 0x02, 0x51, 0x10, 0x14,
+  0x32, 0x24, 0x44, 0x12, 0x18, 0x14, 0x80, 0xf4, 0xbd, 0xd7, 0x00, 0x20,
+  0x08, 0x88, 0xf5, 0x0b, 0x0d, 0x01, 0x00, 0xf5, 0x68, 0x11, 0x00, 0x10,
+  0x01, 0x14, 0x00, 0x77, 0x5e, 0x80, 0x22, 0x14, 0x13, 0xc4, 0x14, 0x89,
+  0x42, 0x21, 0x56, 0x64, 0x25, 0x28, 0x81, 0x65, 0x1a, 0x2c, 0x08, 0x25,
+  0x18, 0x94, 0x42, 0x1f, 0x22, 0x41, 0xc1, 0x84, 0x81, 0x8c, 0x22, 0x85,
+  0xa4, 0x18, 0x74, 0xa0, 0x21, 0x84, 0xb0, 0x83, 0x14, 0xc4, 0x14, 0x83,
+  0x82, 0x2a, 0x14, 0x53, 0x88, 0x2a, 0x41, 0xc4, 0xa1, 0x46, 0x02, 0x25,
+  0x38, 0x34, 0x78, 0x86, 0x81, 0x48, 0x54, 0x84, 0x21, 0x48, 0x2a, 0x01,
+  0x6c, 0x08, 0x8c, 0x32, 0x58, 0x3f, 0x4b, 0x0b, 0x28, 0x42, 0x35, 0x18,
+  0x88, 0x41, 0x44, 0xe1, 0x24, 0x02, 0x25, 0x38, 0x14, 0x58, 0xa6, 0x85,
+  0x18, 0x66, 0xa1, 0x80, 0x35, 0x21, 0x14, 0x6c, 0x39, 0x18, 0x8c, 0x32,
+  0x41, 0x1c, 0x24, 0x58, 0x68, 0x84, 0x28, 0x12, 0x4a, 0x00, 0x81, 0x43,
+  0x84, 0x11, 0xcc, 0x85, 0x4e, 0x22, 0x41, 0x75, 0x00, 0xff, 0x00, 0x88,
   0x21, 0xa4, 0x41, 0x29, 0xe4, 0x22, 0x01, 0x4c, 0x18, 0xc8, 0x28, 0x52,
-  0x6e, 0x21, 0x00, 0x20, 0x08, 0x88, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x01, 0x14, 0x00, 0x77,
-  0x5e, 0x20, 0xa2, 0x21, 0x00, 0x81, 0x28, 0x00, 0x00, 0x00, 0x21, 0x40,
-  0x02, 0xa1, 0x84, 0x81, 0x80, 0x41, 0x08, 0x80, 0x42, 0x42, 0x54, 0xa2,
-  0x42, 0x21, 0x40, 0x22, 0xcc, 0x18, 0x00, 0x00, 0x15, 0x04, 0x28, 0x80,
-  0x32, 0x42, 0x28, 0x00, 0x88, 0x10, 0x22, 0x01, 0x41, 0x25, 0xa4, 0x42,
-  0x89, 0x08, 0x83, 0x04, 0x9e, 0x73, 0x60, 0x44, 0xd0, 0x62, 0x81, 0x91,
-  0x42, 0xcc, 0x41, 0x28, 0x72, 0x13, 0x5e, 0x48, 0x23, 0x11, 0x42, 0x98,
-  0x41, 0x82, 0x26, 0xb8, 0x24, 0xd8, 0x62, 0x02, 0xa7, 0x42, 0x46, 0x85,
-  0x66, 0x45, 0x47, 0x84, 0x4d, 0x4a, 0xb0, 0x48, 0x11, 0xf4, 0x28, 0x14,
-  0x72, 0x45, 0x48, 0x64, 0x22, 0x41, 0x17, 0x26, 0x4e, 0x16, 0x43, 0x43,
-  0x92, 0x38, 0x25, 0x8c, 0x41, 0xf4, 0x44, 0x18, 0x45, 0xc9, 0x54, 0x29,
-  0xb9, 0x29, 0x91, 0x58, 0xc4, 0x4f, 0x21, 0xe8, 0x24, 0xc2, 0x44, 0x3e,
-  0x48, 0x8b, 0x41, 0x45, 0x32, 0x44, 0x2a, 0x01, 0x4c, 0xd4, 0x91, 0x0d,
-  0x4c, 0x22, 0x13, 0x12, 0x92, 0x4a, 0x28, 0x84, 0x22, 0x27, 0x81, 0xa4,
-  0x00, 0x20, 0x24, 0x98, 0x2a, 0xc7, 0x22, 0xcc, 0x52, 0x82, 0x61, 0x17,
-  0x44, 0x66, 0x08, 0x8d, 0x44, 0x41, 0x21, 0x45, 0x1a, 0x6c, 0x22, 0x4a,
-  0x41, 0x4c, 0xa2, 0x82, 0x84, 0x19, 0x94, 0x12, 0x12, 0x24, 0x45, 0x58,
-  0x84, 0x00, 0x83, 0xc4, 0x45, 0x4d, 0x22, 0x98, 0x12, 0x88, 0xc5, 0x82,
-  0x88, 0x15, 0xd4, 0x2c, 0x62, 0x84, 0x46, 0xc4, 0x88, 0x32, 0x83, 0x04,
-  0x6f, 0xd3, 0x04, 0x42, 0x90, 0x14, 0x12, 0xd0, 0x48, 0x01, 0x40, 0x17,
-  0xc4, 0x12, 0x50, 0x82, 0x14, 0x00, 0x23, 0x08, 0x60, 0x82, 0x18, 0x30,
-  0x54, 0xb0, 0x48, 0x42, 0x22, 0x45, 0xe2, 0xc1, 0x84, 0x02, 0x44, 0x42,
-  0x63, 0x81, 0x32, 0x44, 0x2d, 0x24, 0x30, 0x31, 0x21, 0x2a, 0x11, 0xe4,
-  0x61, 0x42, 0x88, 0x05, 0x99, 0xb2, 0x18, 0x04, 0x16, 0x26, 0x92, 0x42,
-  0x1a, 0xc4, 0x14, 0x26, 0x92, 0x44, 0x00, 0x49, 0xf4, 0x64, 0x44, 0x20,
-  0x02, 0x10, 0x86, 0x02, 0x41, 0x12, 0x22, 0x10, 0x84, 0x21, 0x92, 0x14,
-  0x14, 0x2a, 0x11, 0x42, 0x24, 0xd4, 0x22, 0xe4, 0x22, 0xc1, 0x14, 0x20,
-  0x04, 0x80, 0x32, 0x4c, 0x22, 0x00, 0x42, 0x4c, 0x21, 0x51, 0x28, 0x10,
-  0x82, 0x02, 0x1e, 0x28, 0x49, 0x02, 0x4b, 0x12, 0x42, 0x90, 0x86, 0x13,
-  0x84, 0x44, 0xc8, 0x58, 0x44, 0x12, 0x40, 0x84, 0x41, 0x18, 0xc8, 0x84,
-  0x42, 0x7f, 0x23, 0x0c, 0x00, 0x44, 0x40, 0x34, 0x18, 0x89, 0x11, 0x64,
-  0x81, 0x50, 0x84, 0x24, 0x22, 0x10, 0x54, 0x12, 0x45, 0x48, 0x01, 0x32,
-  0x15, 0x22, 0xd4, 0x84, 0xe5, 0x21, 0x42, 0x58, 0x84, 0x48, 0x12, 0x44,
-  0x81, 0x43, 0x42, 0x05, 0x4d, 0x28, 0xc9, 0x01, 0x4b, 0x24, 0x12, 0x41,
-  0x80, 0x01, 0x13, 0x44, 0xa4, 0x41, 0x41, 0x84, 0x26, 0x78, 0x42, 0x04,
-  0x42, 0x60, 0x2c, 0x48, 0x10, 0x44, 0x82, 0x66, 0x81, 0xff, 0xcd, 0x0a,
-  0x40, 0x82, 0x61, 0x22, 0x50, 0x22, 0x40, 0x42, 0x21, 0x01, 0x80, 0x31,
-  0x82, 0x00, 0x28, 0x18, 0x44, 0x85, 0x84, 0x14, 0x48, 0x01, 0x80, 0x02,
-  0x30, 0x42, 0x1a, 0x92, 0x48, 0x00, 0x21, 0x10, 0x04, 0x00, 0x48, 0x40,
-  0x04, 0x12, 0x26, 0x04, 0x00, 0x20, 0x28, 0x18, 0x14, 0x9c, 0x18, 0x80,
-  0x02, 0x81, 0xf0, 0xad, 0xb1, 0x00, 0x24, 0x12, 0x25, 0x24, 0xd2, 0x2a,
-  0x61, 0xc1, 0x43, 0xc1, 0x38, 0x00, 0xd0, 0x22, 0x81, 0x11, 0x24, 0x32,
-  0x26, 0x15, 0x44, 0xd6, 0x48, 0x73, 0x22, 0x21, 0xf4, 0x11, 0x48, 0x24,
-  0x84, 0x8d, 0x24, 0x48, 0x1e, 0x4c, 0x28, 0x28, 0x8b, 0x42, 0x43, 0x94,
-  0x14, 0x4f, 0x81, 0x42, 0x12, 0xd4, 0x42, 0x82, 0x12, 0x34, 0x48, 0x2e,
-  0x14, 0xa0, 0x34, 0x16, 0xa4, 0x12, 0x82, 0x81, 0x42, 0x2d, 0x4c, 0x4a,
-  0x39, 0x44, 0x12, 0x47, 0x28, 0x4d, 0x48, 0x18, 0x8c, 0x42, 0xd8, 0x48,
-  0xc4, 0x48, 0x3e, 0xee, 0x20, 0x02, 0x41, 0x28, 0x61, 0x00, 0x50, 0x12,
-  0x12, 0x81, 0x12, 0x30, 0x84, 0x34, 0x13, 0x11, 0x28, 0x21, 0x84, 0xa4,
-  0x14, 0x47, 0x81, 0x44, 0x2a, 0x04, 0x80, 0x42, 0x62, 0x44, 0x8c, 0x41,
-  0x04, 0x10, 0x62, 0x41, 0x00, 0x18, 0xa0, 0x12, 0x10, 0x54, 0x41, 0x42,
-  0x4c, 0x14, 0x92, 0x41, 0x81, 0x10, 0x28, 0x48, 0xc4, 0x48, 0x18, 0x40,
-  0x04, 0xa8, 0x70, 0x8b, 0x0c, 0x44, 0x00, 0x40, 0x02, 0x44, 0x41, 0x40,
-  0x14, 0x06, 0x40, 0x02, 0x00, 0x24, 0x10, 0xcc, 0x48, 0x28, 0x2c, 0x02,
-  0x42, 0x44, 0x45, 0x48, 0x16, 0x04, 0x00, 0x47, 0x84, 0xc0, 0x44, 0x40,
-  0x04, 0x10, 0x04, 0x44, 0x00, 0x12, 0x00, 0x50, 0x48, 0xc1, 0x12, 0x20,
-  0x01, 0x4b, 0x41, 0x60, 0x81, 0x8c, 0x21, 0xf1, 0xa7, 0x7c, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x24, 0x12, 0x81, 0x40, 0x78, 0x11, 0x18, 0x02,
-  0x10, 0x01, 0x00, 0x11, 0x20, 0x81, 0x24, 0x02, 0x84, 0x44, 0x17, 0x26,
-  0x24, 0x44, 0x20, 0x06, 0x41, 0x41, 0x26, 0x42, 0x04, 0xc4, 0x2c, 0x04,
-  0x89, 0x21, 0x74, 0x28, 0x02, 0x00, 0x18, 0x80, 0x01, 0x18, 0x00, 0xf0,
-  0xf8, 0x26, 0x10, 0x04, 0x50, 0x22, 0x00, 0x21, 0x00, 0x83, 0x02, 0x10,
-  0x04, 0x24, 0x00, 0x00, 0x40, 0x82, 0x04, 0x4b, 0x41, 0x29, 0x24, 0x94,
-  0x44, 0x84, 0x44, 0x48, 0x00, 0x90, 0x42, 0x40, 0x14, 0x02, 0x24, 0x48,
-  0x20, 0x04, 0x18, 0x30, 0x44, 0x48, 0x40, 0x88, 0x02, 0x00, 0x46, 0x24,
-  0x05, 0x00, 0xd0, 0x9d, 0x0b, 0x14, 0x44, 0x8c, 0x01, 0x00, 0x54, 0x10,
-  0x08, 0x14, 0x44, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x22, 0x81, 0x50,
-  0x28, 0x80, 0x25, 0x52, 0x22, 0x10, 0x84, 0xd4, 0x85, 0x11, 0x42, 0x01,
-  0x49, 0x11, 0x02, 0x40, 0x09, 0x60, 0x41, 0x14, 0x00, 0x00, 0x80, 0x12,
-  0x04, 0x84, 0x24, 0x80, 0x12, 0xfc, 0x38, 0x18, 0x20, 0x08, 0x40, 0x04,
-  0x00, 0x30, 0x24, 0x26, 0x04, 0x20, 0x42, 0x24, 0x42, 0x08, 0x00, 0x41,
-  0x81, 0x80, 0x24, 0x04, 0x00, 0x22, 0x42, 0x00, 0x00, 0x10, 0x8c, 0x94,
-  0x48, 0x84, 0x10, 0x08, 0xa0, 0x14, 0x00, 0x00, 0x41, 0x41, 0x44, 0x20,
-  0x01, 0x12, 0x00, 0x80, 0x41, 0xf1, 0x78, 0xa3, 0x24, 0x00, 0x00, 0x24,
-  0x80, 0x41, 0x02, 0x24, 0x00, 0x90, 0x28, 0x25, 0x11, 0x04, 0x44, 0x81,
-  0x20, 0xb4, 0x24, 0x04, 0x00, 0x48, 0x84, 0x48, 0x90, 0x44, 0x48, 0x42,
-  0x84, 0x48, 0x48, 0x84, 0x80, 0x04, 0x43, 0x04, 0x4b, 0x14, 0x50, 0x84,
-  0x46, 0x24, 0x04, 0x80, 0x42, 0x81, 0x41, 0x88, 0x21, 0x04, 0x44, 0x18,
-  0x24, 0xf0, 0x34, 0x96, 0x00, 0x10, 0x48, 0x28, 0x41, 0x02, 0x21, 0x90,
-  0x12, 0x24, 0x44, 0x11, 0x18, 0x84, 0x40, 0x62, 0x11, 0x24, 0x12, 0x25,
-  0x64, 0x11, 0x81, 0x81, 0x25, 0x18, 0x01, 0x11, 0x10, 0x11, 0x04, 0x54,
-  0x28, 0x24, 0x00, 0x29, 0x42, 0x24, 0x21, 0x24, 0x52, 0x82, 0x22, 0x00,
-  0x23, 0x12, 0x81, 0x42, 0x02, 0x24, 0x00, 0x24, 0x81, 0x50, 0x82, 0x44,
-  0x9f, 0x43, 0x09, 0x10, 0x04, 0xa1, 0x00, 0x24, 0x41, 0x84, 0x00, 0x10,
-  0x4c, 0x88, 0x02, 0x00, 0x00, 0x00, 0x42, 0x18, 0x40, 0x04, 0x44, 0x10,
-  0x24, 0x54, 0x48, 0x00, 0x10, 0x14, 0x08, 0x24, 0x00, 0x40, 0x24, 0x05,
-  0x12, 0x30, 0x24, 0x00, 0x00, 0x00, 0x20, 0x41, 0x08, 0x81, 0xbf, 0xc5,
-  0x4b, 0xc2, 0x18, 0xc0, 0x41, 0x24, 0x14, 0x44, 0x00, 0x5c, 0x12, 0x02,
-  0x64, 0x80, 0x02, 0x21, 0x25, 0x02, 0xa5, 0x42, 0x18, 0x44, 0x58, 0x82,
-  0x50, 0x28, 0x84, 0x88, 0x84, 0x2a, 0x84, 0x01, 0x2c, 0x41, 0x41, 0x18,
-  0xd2, 0xa2, 0x41, 0xc6, 0x41, 0x21, 0x14, 0x4c, 0x34, 0x18, 0x4a, 0x41,
-  0x05, 0x40, 0x14, 0x88, 0x02, 0x00, 0x41, 0x49, 0x12, 0xd4, 0x84, 0x02,
-  0x21, 0xc0, 0x9a, 0x24, 0x69, 0x21, 0x78, 0x18, 0x48, 0x38, 0x12, 0x25,
-  0x16, 0x36, 0x16, 0x3c, 0x02, 0x11, 0x50, 0xc1, 0x24, 0x8f, 0xa2, 0x12,
-  0x41, 0x92, 0x12, 0x25, 0x12, 0x96, 0x48, 0xcb, 0x62, 0x42, 0x24, 0x85,
-  0xd8, 0x1a, 0x54, 0x4e, 0x49, 0xf6, 0x42, 0x44, 0xc9, 0x14, 0x64, 0x52,
-  0xa7, 0x24, 0x19, 0x14, 0xc8, 0x52, 0x45, 0x7e, 0x18, 0x12, 0xf6, 0x14,
-  0x46, 0x45, 0xe4, 0x44, 0x73, 0x18, 0xf4, 0x14, 0x45, 0x12, 0x1f, 0x44,
-  0x81, 0x14, 0x45, 0x18, 0x34, 0x12, 0x89, 0x21, 0xf1, 0x44, 0x14, 0xc7,
-  0x45, 0x41, 0x18, 0x8d, 0x11, 0x18, 0x2f, 0xd9, 0x0e, 0x40, 0x04, 0x25,
-  0x46, 0x03, 0x15, 0x44, 0x74, 0x2a, 0xf4, 0x2a, 0x12, 0x25, 0x24, 0x31,
-  0x26, 0x84, 0x10, 0x04, 0x45, 0x01, 0x1d, 0x18, 0x21, 0x27, 0x84, 0x81,
-  0x8f, 0x81, 0x84, 0x54, 0x84, 0x4a, 0x74, 0x48, 0x5d, 0x24, 0x46, 0xd4,
-  0x42, 0xd4, 0x24, 0x45, 0xf8, 0x5e, 0x2e, 0x2f, 0x44, 0x34, 0x64, 0x81,
-  0x41, 0x44, 0x46, 0x21, 0x94, 0x4d, 0x23, 0xd4, 0x28, 0xb3, 0x44, 0xa1,
-  0x41, 0x42, 0x8d, 0x28, 0x45, 0x44, 0x84, 0x21, 0x91, 0x12, 0x1a, 0x84,
-  0xe5, 0x41, 0x33, 0x12, 0x26, 0x58, 0xc8, 0xde, 0x27, 0x50, 0x41, 0x41,
-  0x34, 0x81, 0x00, 0x16, 0x02, 0x45, 0xd8, 0x44, 0x42, 0x12, 0x12, 0x98,
-  0x1c, 0x31, 0xa7, 0xa1, 0x21, 0x24, 0x85, 0x58, 0x68, 0x47, 0xc4, 0x1c,
-  0xe1, 0x82, 0xf6, 0x43, 0x14, 0x23, 0xe4, 0x44, 0x41, 0x28, 0xa3, 0x22,
-  0x1c, 0x21, 0x64, 0x84, 0x4d, 0x44, 0x50, 0x24, 0x35, 0x34, 0x42, 0x2d,
-  0x25, 0x24, 0xa3, 0x82, 0x64, 0x81, 0x4d, 0x58, 0x42, 0x44, 0x84, 0x29,
-  0x62, 0x62, 0x81, 0x17, 0x82, 0x20, 0x52, 0x44, 0x28, 0x50, 0x8a, 0x85,
-  0x68, 0x21, 0x41, 0xbf, 0x12, 0x0d, 0x13, 0x11, 0x34, 0x11, 0x21, 0x13,
-  0x01, 0x13, 0xd1, 0x24, 0x11, 0x81, 0x11, 0xc1, 0x12, 0x11, 0x2c, 0x11,
-  0xc1, 0x13, 0xc0, 0x11, 0xc0, 0x11, 0xd0, 0x18, 0x03, 0x14, 0x40, 0x05,
-  0x8f, 0x51, 0x12, 0x62, 0x11, 0x41, 0x1a, 0x12, 0xb6, 0x18, 0x02, 0x1b,
-  0x21, 0x41, 0x1b, 0x21, 0xb0, 0x11, 0x12, 0x96, 0x21, 0x61, 0x19, 0x12,
-  0x96, 0x21, 0x21, 0x15, 0x18, 0x02, 0x21, 0x22, 0x25, 0x24, 0x52, 0x42,
-  0x22, 0x20, 0x42, 0xf4, 0x81, 0xb2, 0x14, 0x1d, 0x15, 0x1f, 0x11, 0x51,
-  0xa9, 0xcf, 0x51, 0xe1, 0x11, 0xf1, 0x15, 0x15, 0x25, 0xc4, 0x13, 0x2f,
-  0x31, 0xf3, 0x17, 0x31, 0x1a, 0xd1, 0x31, 0xf1, 0x13, 0x11, 0x5f, 0xf1,
-  0xb1, 0x12, 0xd1, 0x56, 0xf1, 0x13, 0x13, 0x7f, 0x71, 0xf1, 0x11, 0x19,
-  0x25, 0xf3, 0x13, 0x59, 0x5f, 0x57, 0xf7, 0x71, 0x71, 0x4e, 0x43, 0x35,
-  0xfb, 0x41, 0x43, 0x7f, 0xb1, 0xb1, 0x76, 0xf5, 0x15, 0x11, 0x5f, 0x75,
-  0xd4, 0x77, 0xf5, 0x4e, 0x7e, 0x4f, 0xc3, 0xf7, 0x64, 0x65, 0x5f, 0x72,
-  0xf7, 0x43, 0x73, 0x3f, 0x73, 0xf3, 0x2b, 0x2c, 0x4f, 0x53, 0xf3, 0x18,
-  0x39, 0x3f, 0x36, 0xf3, 0x7a, 0x62, 0x2f, 0x76, 0xf3, 0x4a, 0x49, 0x3f,
-  0x33, 0xf2, 0x72, 0x72, 0x37, 0x34, 0x35, 0x51, 0x6e, 0x75, 0xf7, 0x32,
-  0x22, 0xaf, 0x83, 0xf3, 0x34, 0x32, 0x2f, 0x27, 0xb5, 0x12, 0xa3, 0x31,
-  0x2a, 0x32, 0x18, 0xed, 0x22, 0xbb, 0x52, 0xc0, 0x14, 0x1f, 0x55, 0xf5,
-  0x19, 0x1a, 0xed, 0x4d, 0x34, 0x5f, 0x71, 0xf1, 0x13, 0x17, 0x7c, 0xf1,
-  0x1a, 0x1f, 0x7f, 0x52, 0x52, 0x51, 0x18, 0x2b, 0x31, 0xd5, 0xdf, 0x13,
-  0xd2, 0xfe, 0xf1, 0x13, 0x13, 0x65, 0x44, 0xfa, 0x16, 0x17, 0x7f, 0xf1,
-  0xf5, 0x66, 0x6c, 0x6e, 0x68, 0x8f, 0xb5, 0x54, 0xb3, 0x4f, 0x28, 0x5c,
-  0xa6, 0x7f, 0xb2, 0xfc, 0x53, 0x73, 0x6f, 0x65, 0xd4, 0x66, 0xf5, 0x4f,
-  0x7f, 0x6f, 0xc3, 0xf7, 0x54, 0x5e, 0x4d, 0x5e, 0x2f, 0x64, 0xf7, 0x73,
-  0x77, 0xdf, 0xc1, 0x51, 0x56, 0xcf, 0xd4, 0xf6, 0x73, 0x77, 0xbf, 0x14,
-  0xf5, 0x44, 0x1d, 0xcf, 0x96, 0xf6, 0x37, 0x27, 0x3f, 0x57, 0x27, 0x34,
-  0x28, 0xf5, 0x57, 0x46, 0x1a, 0xf1, 0x18, 0x1a, 0x6f, 0x63, 0xf3, 0x72,
-  0x52, 0x6b, 0x75, 0xcf, 0xe1, 0xf3, 0x2a, 0x28, 0x8b, 0x33, 0xcf, 0xc1,
-  0xf3, 0x18, 0x8f, 0x70, 0x12, 0x94, 0x45, 0x8f, 0xb1, 0x51, 0xcc, 0x31,
-  0x65, 0xf4, 0x13, 0x15, 0x67, 0x21, 0x7d, 0x14, 0xc5, 0x5c, 0x51, 0x16,
-  0xd2, 0xaa, 0x53, 0xee, 0x35, 0x79, 0x17, 0xde, 0x32, 0x51, 0x46, 0x24,
-  0xbf, 0xa1, 0xd1, 0x92, 0xf4, 0x2e, 0x24, 0x8b, 0x62, 0x9d, 0x52, 0x2f,
-  0x34, 0xf4, 0x4a, 0xcc, 0x4f, 0x84, 0xf4, 0x6d, 0x43, 0x67, 0x23, 0x6d,
-  0x54, 0x4f, 0x44, 0xf4, 0x7c, 0x4f, 0x4d, 0x6c, 0xef, 0x61, 0xf1, 0x46,
-  0x4e, 0x4f, 0x27, 0xd4, 0x63, 0xf6, 0x1c, 0x1d, 0x45, 0x76, 0x2b, 0xfa,
-  0x44, 0x34, 0xf7, 0x51, 0x87, 0x44, 0x9f, 0xe7, 0xe7, 0x44, 0x54, 0x53,
-  0x6a, 0xc2, 0x2a, 0xc5, 0x54, 0x57, 0x1a, 0xf1, 0x18, 0x1a, 0x63, 0xe3,
-  0x45, 0xf3, 0x14, 0x16, 0x2b, 0x13, 0x21, 0x8f, 0x82, 0x92, 0x1c, 0x4f,
-  0xe5, 0x0b, 0x37, 0x51, 0x5f, 0x41, 0x55, 0xb8, 0xe7, 0xc4, 0x3b, 0x11,
-  0x7f, 0x51, 0x51, 0x62, 0x67, 0x61, 0xff, 0xc2, 0xf3, 0x3f, 0x3d, 0x24,
-  0x16, 0xd2, 0xbb, 0xf1, 0x1f, 0x1f, 0x25, 0x78, 0x1f, 0xde, 0x32, 0xf1,
-  0x17, 0x15, 0x85, 0x5a, 0xef, 0x2f, 0xd1, 0xf5, 0x5f, 0x7d, 0x2e, 0x28,
-  0x9d, 0x5a, 0xaf, 0xb4, 0xd4, 0xdf, 0xfc, 0x44, 0x48, 0xcf, 0xcb, 0xf5,
-  0x71, 0x65, 0x5d, 0x55, 0x49, 0xf4, 0x7c, 0x4f, 0x6f, 0x81, 0xf7, 0x6e,
-  0x6e, 0x69, 0xf4, 0x75, 0x47, 0x3f, 0x61, 0xf7, 0x2c, 0x2d, 0x65, 0xf6,
-  0x3f, 0x1e, 0x1f, 0x55, 0xf3, 0x6a, 0x72, 0xef, 0xc5, 0xf1, 0x5d, 0x5a,
-  0x5f, 0x53, 0xf3, 0x52, 0x52, 0x2b, 0x26, 0x9d, 0x2b, 0x95, 0x55, 0x66,
-  0x2b, 0x11, 0x8f, 0x83, 0xf3, 0x34, 0x16, 0x2f, 0x45, 0xf3, 0x54, 0x52,
-  0xef, 0x42, 0xf1, 0x2a, 0x28, 0x85, 0xd8, 0xcc, 0xb1, 0x16, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x41, 0x84, 0x00, 0x24, 0x84, 0x40, 0x08, 0x40, 0x02,
-  0x00, 0x42, 0x00, 0x10, 0x08, 0x10, 0x04, 0x41, 0x81, 0x41, 0x10, 0x02,
-  0x21, 0x00, 0x00, 0x10, 0x04, 0x00, 0x40, 0x48, 0x24, 0x01, 0x12, 0x00,
-  0x20, 0x01, 0xf0, 0x4d, 0x71, 0x70, 0x82, 0x51, 0x41, 0x24, 0x15, 0x48,
-  0x02, 0x45, 0x11, 0x41, 0x12, 0x01, 0x11, 0x10, 0x01, 0x50, 0x12, 0x50,
-  0x12, 0x50, 0x12, 0x15, 0x88, 0x42, 0x42, 0x01, 0x54, 0x24, 0x5c, 0x02,
-  0x46, 0x41, 0x02, 0x30, 0x41, 0x50, 0x41, 0x45, 0x12, 0x11, 0x94, 0x41,
-  0x21, 0x44, 0x25, 0x91, 0x41, 0x2d, 0x12, 0x11, 0x00, 0x25, 0x21, 0x91,
-  0x12, 0x43, 0x91, 0x12, 0x41, 0x29, 0x01, 0x81, 0x14, 0xff, 0xd7, 0x0c,
-  0x6d, 0x52, 0x1f, 0x41, 0xd2, 0x28, 0xf1, 0x11, 0x24, 0xab, 0x14, 0x1f,
-  0x41, 0xb2, 0x4e, 0xf1, 0x11, 0x24, 0xab, 0x14, 0x1f, 0x41, 0xb2, 0x4a,
-  0xb9, 0x11, 0xf2, 0x4a, 0x92, 0x53, 0xf1, 0x4a, 0x92, 0x43, 0xf3, 0x4a,
-  0x91, 0x43, 0xf3, 0x42, 0x91, 0x47, 0x83, 0xad, 0x91, 0x4f, 0x83, 0xc4,
-  0xb1, 0x4f, 0xa2, 0xc4, 0x85, 0x4f, 0xa2, 0x74, 0x18, 0xf5, 0x24, 0x5a,
-  0x8f, 0x59, 0xf2, 0x26, 0x5a, 0x96, 0xf5, 0x24, 0x5a, 0x8f, 0x49, 0xf2,
-  0x22, 0x5a, 0x1f, 0x49, 0xf2, 0x24, 0x52, 0x1f, 0x49, 0xf2, 0x28, 0x12,
-  0x1f, 0x49, 0xb2, 0x6c, 0xf1, 0x91, 0x24, 0xeb, 0x16, 0x1f, 0x48, 0xb2,
-  0x6e, 0xd1, 0x41, 0xb2, 0x6a, 0xd9, 0x81, 0xb2, 0x4a, 0x59, 0x85, 0xab,
-  0x94, 0x47, 0x82, 0xab, 0xb4, 0x43, 0xf2, 0x4a, 0xb4, 0x47, 0x82, 0x2d,
-  0xb4, 0x4f, 0x82, 0x84, 0xfb, 0x24, 0x4a, 0xe7, 0x59, 0xc0, 0x4a, 0x4c,
-  0x96, 0x48, 0x4c, 0x32, 0x48, 0x4c, 0x32, 0x4a, 0x4c, 0x32, 0x6a, 0x28,
-  0xaf, 0x44, 0x88, 0xf2, 0x4a, 0xa4, 0x41, 0x8b, 0xa4, 0x43, 0xb2, 0x48,
-  0x38, 0x24, 0xab, 0x84, 0x22, 0x2b, 0x84, 0x65, 0x98, 0x88, 0x6f, 0x22,
-  0xb5, 0x48, 0xb8, 0x24, 0xa9, 0x84, 0x45, 0x2a, 0x7c, 0x22, 0x28, 0xc8,
-  0x49, 0xc2, 0xa4, 0x86, 0xcc, 0x42, 0x8e, 0x48, 0x8d, 0x42, 0x86, 0x34,
-  0x48, 0x86, 0x04, 0x9e, 0x48, 0x83, 0x44, 0xd4, 0x48, 0x89, 0xf4, 0x48,
-  0xb4, 0x41, 0x8b, 0xb4, 0x41, 0x8b, 0x94, 0x80, 0xd9, 0x84, 0x84, 0x99,
-  0x46, 0x98, 0x8c, 0xf5, 0x51, 0x53, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x21, 0x00, 0x80, 0x01, 0x88, 0x00,
-  0x00, 0x40, 0x01, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x40, 0x01, 0xa8,
-  0x11, 0x00, 0x20, 0x01, 0x00, 0x21, 0xf0, 0x13, 0x25, 0x50, 0x42, 0x10,
-  0x38, 0x28, 0x28, 0x24, 0x24, 0x10, 0xa4, 0x12, 0x81, 0x00, 0x21, 0x41,
-  0x89, 0x72, 0x24, 0x5a, 0x84, 0x10, 0x1a, 0x04, 0x81, 0x84, 0x60, 0x24,
-  0x48, 0x41, 0x27, 0x42, 0x48, 0x41, 0x4f, 0x21, 0x64, 0x64, 0x12, 0x44,
-  0x12, 0x41, 0x2d, 0x22, 0x90, 0x41, 0x4c, 0x04, 0x12, 0x81, 0x88, 0x00,
-  0x11, 0x12, 0x91, 0x16, 0x64, 0x41, 0x41, 0x41, 0x84, 0x12, 0x85, 0x54,
-  0x48, 0xc1, 0xef, 0xa2, 0x04, 0x24, 0x8a, 0x12, 0x54, 0x42, 0x45, 0x32,
-  0x2c, 0x10, 0x48, 0x18, 0x16, 0xc1, 0x52, 0x40, 0x5c, 0x28, 0x18, 0x21,
-  0xc0, 0x24, 0x4c, 0x81, 0x44, 0x2c, 0x22, 0x14, 0x5c, 0x48, 0x70, 0x48,
-  0x01, 0x90, 0x12, 0x84, 0xc0, 0x44, 0x24, 0x4a, 0x02, 0x00, 0x1a, 0x12,
-  0x22, 0x54, 0x48, 0x4a, 0x41, 0xc4, 0x51, 0x80, 0x44, 0x24, 0x31, 0x42,
-  0x88, 0x89, 0x31, 0x48, 0x4e, 0x14, 0x43, 0x24, 0xc1, 0x41, 0x68, 0x3f,
-  0xb3, 0x4a, 0x42, 0x34, 0x42, 0xe4, 0xc1, 0x4c, 0x52, 0x86, 0x00, 0x85,
-  0x66, 0x42, 0x41, 0x70, 0x22, 0x02, 0xc1, 0xa9, 0x73, 0x22, 0x56, 0x48,
-  0x22, 0x41, 0x24, 0x41, 0x8c, 0xa2, 0x41, 0x60, 0xcc, 0x29, 0xd4, 0xa4,
-  0x34, 0x24, 0x46, 0x92, 0x14, 0x17, 0xc1, 0x4d, 0x42, 0x1e, 0x44, 0xc1,
-  0x48, 0x42, 0x29, 0x12, 0xa2, 0x41, 0x42, 0x70, 0x14, 0xc8, 0x48, 0x88,
-  0x47, 0x15, 0x20, 0x06, 0x8d, 0x13, 0x44, 0x86, 0xc4, 0x1c, 0x44, 0x84,
-  0x1e, 0x46, 0xc9, 0x41, 0x78, 0x18, 0xf4, 0xa4, 0x89, 0x00, 0x28, 0x80,
-  0x02, 0x28, 0x25, 0x42, 0x08, 0x12, 0x85, 0xa1, 0x41, 0x50, 0x84, 0x00,
-  0x81, 0x40, 0x66, 0x81, 0x46, 0x44, 0x08, 0x84, 0x85, 0x04, 0x10, 0x01,
-  0x00, 0x2c, 0x04, 0x00, 0x2b, 0x12, 0x44, 0x00, 0x26, 0x43, 0x24, 0x04,
-  0x18, 0x44, 0x00, 0x14, 0x43, 0x01, 0x1a, 0x84, 0x01, 0x83, 0xb4, 0x14,
-  0x04, 0x60, 0x44, 0x2a, 0xf4, 0x13, 0xb1, 0x00, 0x00, 0x16, 0x48, 0x03,
-  0x41, 0x84, 0x00, 0x18, 0x19, 0x42, 0x12, 0x74, 0x42, 0x22, 0x01, 0x50,
-  0x48, 0x84, 0x44, 0x40, 0x41, 0x02, 0x11, 0x44, 0x21, 0x14, 0x8c, 0x21,
-  0x11, 0x02, 0x00, 0x20, 0x11, 0x22, 0x41, 0x12, 0x01, 0x44, 0x40, 0x18,
-  0x22, 0x41, 0x62, 0x81, 0x34, 0x12, 0x20, 0x01, 0xc0, 0x84, 0x00, 0x22,
-  0xcf, 0x6c, 0x49, 0x33, 0x51, 0x1e, 0x21, 0xdc, 0x91, 0x22, 0x41, 0x4d,
-  0x39, 0x34, 0x18, 0x56, 0x58, 0x82, 0x3d, 0x88, 0x24, 0x85, 0x41, 0xc8,
-  0x11, 0x81, 0x2c, 0x88, 0x72, 0x42, 0xd1, 0x42, 0x63, 0x91, 0x15, 0xc8,
-  0x18, 0x49, 0x44, 0x42, 0x42, 0xc8, 0x24, 0xc4, 0x69, 0x56, 0x42, 0x1e,
-  0x48, 0x26, 0x94, 0x22, 0x22, 0x4d, 0x22, 0x4c, 0xc2, 0x86, 0x19, 0x32,
-  0x1a, 0x83, 0x41, 0x63, 0x91, 0x45, 0x12, 0x01, 0x84, 0x46, 0x48, 0x31,
-  0x44, 0xc4, 0x1e, 0x88, 0xe1, 0x27, 0xa1, 0x8d, 0x24, 0x81, 0x4f, 0x82,
-  0x34, 0x18, 0x84, 0xbf, 0xdc, 0x01, 0x3b, 0x14, 0x2e, 0x11, 0x15, 0xac,
-  0x21, 0x34, 0x1d, 0x3c, 0x15, 0x64, 0x81, 0x52, 0xc0, 0x11, 0x19, 0x52,
-  0x12, 0x65, 0x68, 0x34, 0x83, 0x81, 0x08, 0x6d, 0x48, 0x89, 0xc3, 0x14,
-  0x70, 0x18, 0xc1, 0x42, 0x40, 0x12, 0x64, 0x42, 0x84, 0x4e, 0x34, 0x25,
-  0x24, 0x25, 0x02, 0x60, 0x42, 0x38, 0x25, 0x34, 0x31, 0x25, 0x82, 0x41,
-  0x71, 0x19, 0x44, 0x46, 0x19, 0x22, 0x01, 0x15, 0x48, 0x53, 0x48, 0x1e,
-  0x88, 0x41, 0xa3, 0x21, 0xc2, 0x84, 0x66, 0x24, 0x71, 0x28, 0xe2, 0x1a,
-  0x08, 0x00, 0x18, 0xa1, 0x44, 0x40, 0x02, 0xa4, 0x85, 0xc2, 0x88, 0x10,
-  0x48, 0x22, 0x01, 0x24, 0x28, 0x11, 0x61, 0x15, 0x48, 0x09, 0x41, 0x10,
-  0x13, 0x18, 0x52, 0x41, 0xa1, 0x2c, 0x11, 0x48, 0x94, 0x22, 0x28, 0x24,
-  0x41, 0x2c, 0x08, 0x8c, 0x41, 0x49, 0x02, 0x00, 0x40, 0x68, 0xa4, 0x12,
-  0x43, 0x24, 0x01, 0xa3, 0x01, 0xa5, 0x44, 0x18, 0x18, 0x08, 0xff, 0x7e,
-  0x4d, 0x41, 0x2b, 0x11, 0x42, 0x04, 0x28, 0x50, 0x43, 0x90, 0x52, 0x41,
-  0x10, 0x02, 0x11, 0x34, 0x52, 0xa4, 0x41, 0x10, 0xd1, 0x48, 0xc2, 0x19,
-  0x18, 0x40, 0x01, 0x85, 0x92, 0x21, 0x28, 0x46, 0xd4, 0x21, 0x32, 0x28,
-  0x48, 0xcd, 0x12, 0x40, 0x34, 0x19, 0x21, 0x12, 0x12, 0x66, 0x22, 0x01,
-  0x87, 0x41, 0x41, 0x88, 0x84, 0x00, 0x16, 0x14, 0x14, 0x68, 0x11, 0x30,
-  0x44, 0x42, 0x00, 0xb7, 0xf7, 0x10, 0x22, 0x74, 0x28, 0x45, 0x11, 0x14,
-  0x42, 0x24, 0x99, 0x2a, 0x10, 0x55, 0x81, 0x22, 0x61, 0x10, 0x48, 0x68,
-  0x41, 0x40, 0x44, 0x02, 0x22, 0x43, 0x03, 0x22, 0x48, 0x44, 0x00, 0x90,
-  0x11, 0x48, 0xc4, 0x81, 0x18, 0x21, 0x00, 0x44, 0x41, 0x23, 0x41, 0x14,
-  0x01, 0x44, 0x20, 0x92, 0x14, 0x42, 0x81, 0x10, 0x04, 0x80, 0x02, 0x12,
-  0x83, 0xd1, 0xf2, 0x02, 0x10, 0x84, 0x01, 0x10, 0x04, 0x82, 0x45, 0x01,
-  0x00, 0x40, 0x61, 0x84, 0x10, 0x04, 0x10, 0x18, 0x82, 0x11, 0x44, 0x11,
-  0x06, 0x00, 0x41, 0x56, 0x54, 0x82, 0x10, 0x14, 0x02, 0x00, 0x44, 0x41,
-  0x84, 0x40, 0x14, 0x58, 0x84, 0x20, 0x61, 0x84, 0x10, 0x68, 0x41, 0x30,
-  0x12, 0x2a, 0x31, 0x4d, 0x87, 0x21, 0x8c, 0x08, 0xc4, 0xa2, 0xdb, 0x69,
-  0x10, 0x02, 0x87, 0x51, 0x14, 0x41, 0x69, 0x52, 0x24, 0x19, 0xd1, 0xa4,
-  0xa2, 0x14, 0x14, 0x81, 0x21, 0x51, 0x99, 0x14, 0x38, 0x4e, 0x85, 0x54,
-  0x42, 0x24, 0x14, 0x18, 0x17, 0x41, 0x34, 0x40, 0x81, 0x54, 0x48, 0x54,
-  0x62, 0x21, 0x24, 0x43, 0x92, 0x48, 0x49, 0x81, 0x41, 0x24, 0x51, 0x42,
-  0x8c, 0x21, 0xe1, 0x24, 0x02, 0x15, 0x18, 0x2c, 0x31, 0x88, 0x50, 0x48,
-  0x4c, 0x45, 0x6e, 0x41, 0x41, 0x4d, 0x18, 0x18, 0x63, 0x2c, 0x94, 0x18,
-  0x2e, 0x88, 0xff, 0x27, 0x0f, 0x34, 0x16, 0x34, 0x22, 0x44, 0x00, 0x40,
-  0x54, 0x12, 0x00, 0x11, 0x24, 0x00, 0x11, 0x18, 0x12, 0x50, 0x84, 0x70,
-  0x24, 0x98, 0x28, 0x43, 0x42, 0x24, 0x02, 0x24, 0x28, 0x49, 0x71, 0x48,
-  0xa4, 0x12, 0x83, 0x14, 0x06, 0x25, 0x02, 0xc5, 0x01, 0x41, 0x44, 0x69,
-  0x61, 0xc1, 0x41, 0x12, 0x80, 0x14, 0x28, 0x01, 0x12, 0x60, 0x83, 0x42,
-  0x84, 0x89, 0x02, 0x44, 0x34, 0x3f, 0x9b, 0x02, 0x00, 0x10, 0x02, 0x00,
-  0x21, 0x45, 0x03, 0x10, 0x48, 0x08, 0x11, 0x10, 0x04, 0x81, 0x00, 0xc0,
-  0x18, 0x24, 0x00, 0x84, 0x84, 0x00, 0x00, 0x4c, 0x02, 0x26, 0x06, 0x10,
-  0x12, 0x42, 0x18, 0x42, 0x02, 0x00, 0x10, 0x13, 0x08, 0x00, 0x10, 0x88,
-  0x61, 0x41, 0x00, 0x00, 0x5f, 0x6c, 0x03, 0x11, 0x27, 0x44, 0x40, 0x02,
-  0x00, 0x40, 0x48, 0x04, 0x21, 0x10, 0x12, 0x14, 0x02, 0x44, 0x49, 0x81,
-  0x01, 0x00, 0x18, 0x40, 0x14, 0x04, 0x00, 0x00, 0x70, 0x21, 0x14, 0x08,
-  0x00, 0x40, 0x44, 0x08, 0x10, 0x94, 0x12, 0x49, 0x01, 0x40, 0x08, 0x18,
-  0x41, 0x10, 0x04, 0x00, 0x84, 0x84, 0xbf, 0x75, 0x04, 0x14, 0x10, 0x51,
-  0x24, 0x81, 0x40, 0x01, 0x11, 0x10, 0x08, 0x00, 0x40, 0x04, 0x10, 0x48,
-  0x08, 0x21, 0x81, 0x84, 0x40, 0x08, 0x21, 0x16, 0x01, 0x24, 0x00, 0x15,
-  0x02, 0x12, 0x00, 0x64, 0x10, 0x44, 0x54, 0x12, 0x20, 0x01, 0x20, 0x02,
-  0x28, 0x44, 0x8c, 0x61, 0x41, 0x00, 0x12, 0x20, 0x01, 0x6f, 0x65, 0x05,
-  0x00, 0x20, 0x14, 0x01, 0x81, 0x00, 0x10, 0x41, 0x14, 0x11, 0x14, 0x04,
-  0x89, 0x11, 0x02, 0x00, 0x44, 0x00, 0x11, 0x25, 0x42, 0x04, 0x00, 0x11,
-  0x11, 0x00, 0x10, 0x42, 0x07, 0x00, 0x00, 0x44, 0x10, 0x04, 0x44, 0x41,
-  0xc0, 0x18, 0x00, 0x81, 0x80, 0x01, 0x84, 0x00, 0x1f, 0x24, 0x0a, 0x40,
-  0x0c, 0x00, 0x25, 0x44, 0x18, 0x48, 0x02, 0x46, 0x28, 0x44, 0x04, 0x14,
-  0x00, 0x10, 0x04, 0x44, 0x40, 0x14, 0x42, 0xc4, 0x18, 0x84, 0xc0, 0x12,
-  0x00, 0x00, 0x25, 0x84, 0x01, 0x00, 0x10, 0x04, 0x84, 0x00, 0x11, 0x85,
-  0x02, 0x40, 0x08, 0xc0, 0x16, 0x10, 0x54, 0x82, 0x00, 0x40, 0x78, 0x7a,
-  0x0b, 0xc4, 0x10, 0x04, 0x00, 0x50, 0x42, 0x00, 0x24, 0x81, 0x10, 0x0a,
-  0x21, 0x53, 0x81, 0x01, 0x80, 0x11, 0x04, 0x41, 0x81, 0x00, 0x00, 0x44,
-  0x00, 0x80, 0x12, 0x01, 0x81, 0x10, 0x44, 0x18, 0x0a, 0x40, 0x02, 0x00,
-  0x50, 0x12, 0x84, 0xa1, 0x40, 0x44, 0x08, 0x30, 0x18, 0x84, 0xb0, 0xbf,
-  0x03, 0x84, 0x21, 0x29, 0x04, 0x82, 0x00, 0x70, 0x14, 0x18, 0x0c, 0x44,
-  0x00, 0x20, 0x01, 0x60, 0x11, 0x10, 0x21, 0x11, 0x02, 0x18, 0x00, 0x00,
-  0x40, 0x84, 0x01, 0x00, 0x00, 0x44, 0x14, 0x00, 0x00, 0x41, 0x44, 0x40,
-  0x04, 0x28, 0x20, 0x01, 0x00, 0x10, 0x08, 0x00, 0x5f, 0xa6, 0x03, 0x41,
-  0x82, 0x11, 0x61, 0x95, 0x04, 0x15, 0x14, 0x08, 0x00, 0x40, 0x09, 0xc0,
-  0x14, 0x50, 0x42, 0x24, 0xe4, 0x41, 0x12, 0x49, 0x21, 0x51, 0x84, 0x41,
-  0x14, 0x85, 0x54, 0x24, 0x8d, 0x14, 0x12, 0x40, 0x42, 0x98, 0x24, 0x00,
-  0x00, 0x21, 0x45, 0x41, 0x04, 0x00, 0x00, 0xa4, 0x40, 0x42, 0x4c, 0x08,
-  0x1c, 0x01, 0x16, 0x98, 0x44, 0x16, 0x01, 0x9f, 0x2c, 0x08, 0x84, 0xd0,
-  0x42, 0x04, 0x50, 0x82, 0x80, 0x01, 0x81, 0x11, 0x44, 0x44, 0x8d, 0x24,
-  0x00, 0x84, 0x00, 0x00, 0x10, 0x43, 0x48, 0x02, 0x88, 0x21, 0x00, 0x24,
-  0x40, 0x01, 0xc0, 0x18, 0x81, 0x49, 0x04, 0x00, 0x40, 0x04, 0x20, 0x41,
-  0x14, 0x84, 0x22, 0x01, 0x30, 0x12, 0x50, 0x12, 0x00, 0x21, 0x12, 0xcf,
-  0x9a, 0x05, 0x44, 0x83, 0x48, 0x24, 0x74, 0x82, 0x12, 0x52, 0x31, 0x27,
-  0x81, 0x4d, 0x16, 0x41, 0x94, 0x23, 0x54, 0xd5, 0x84, 0x15, 0x36, 0x14,
-  0x8d, 0x12, 0x50, 0xdc, 0x81, 0xd0, 0x42, 0x71, 0x14, 0xcb, 0x18, 0x40,
-  0x5c, 0x4c, 0x90, 0x11, 0x8c, 0x41, 0x24, 0x01, 0x4f, 0x92, 0x72, 0x24,
-  0x22, 0x41, 0x03, 0x15, 0x12, 0x56, 0x8a, 0x45, 0x12, 0x42, 0x14, 0x42,
-  0x02, 0x49, 0x02, 0x8c, 0x61, 0x41, 0x44, 0x8c, 0x71, 0x14, 0xc8, 0x11,
-  0x00, 0x8f, 0x91, 0x01, 0x4f, 0xd6, 0x03, 0x45, 0xb2, 0x84, 0x54, 0x32,
-  0x61, 0x40, 0x4c, 0x08, 0x15, 0x51, 0x48, 0x17, 0x24, 0x85, 0x08, 0x44,
-  0x50, 0x42, 0x47, 0x81, 0x49, 0x81, 0x11, 0xd4, 0x12, 0x01, 0x18, 0x10,
-  0x3b, 0x18, 0x25, 0x5b, 0x8c, 0x24, 0x45, 0x44, 0x52, 0x12, 0x47, 0x22,
-  0x31, 0x4c, 0x02, 0xc1, 0x25, 0x14, 0x44, 0x56, 0x45, 0x81, 0x54, 0x45,
-  0x12, 0xe4, 0x41, 0x01, 0x85, 0x1a, 0x21, 0x91, 0x16, 0x89, 0x31, 0x1e,
-  0x15, 0x02, 0x1a, 0x81, 0x41, 0x31, 0x18, 0x3d, 0xb7, 0x50, 0x11, 0x25,
-  0x16, 0x45, 0x56, 0x9d, 0x10, 0x5c, 0x48, 0x85, 0x58, 0x82, 0x81, 0x50,
-  0x28, 0xe1, 0x45, 0x81, 0x41, 0x55, 0x42, 0x16, 0x62, 0x81, 0x45, 0x34,
-  0x14, 0x85, 0x34, 0x1c, 0x45, 0x1e, 0x06, 0x21, 0x16, 0x14, 0x32, 0x11,
-  0x00, 0x44, 0x37, 0x81, 0x29, 0x41, 0x18, 0x54, 0x42, 0x85, 0x08, 0x44,
-  0x41, 0xf0, 0x11, 0x14, 0x81, 0x25, 0x41, 0x54, 0x8a, 0x87, 0x22, 0x85,
-  0x78, 0x14, 0x4a, 0xc4, 0x14, 0x27, 0xc1, 0x85, 0xd8, 0x8c, 0x04, 0x84,
-  0x17, 0x4b, 0x10, 0x01, 0x11, 0x21, 0x11, 0x61, 0x11, 0x61, 0x13, 0x11,
-  0x92, 0x41, 0x21, 0x15, 0x18, 0x02, 0x21, 0x10, 0x02, 0xa5, 0x24, 0x01,
-  0x50, 0x48, 0x24, 0x40, 0x52, 0x48, 0x24, 0x40, 0x02, 0x2c, 0x01, 0x4d,
-  0x12, 0x40, 0x02, 0x24, 0x10, 0x06, 0x21, 0x10, 0x02, 0x21, 0x84, 0x21,
-  0x50, 0x42, 0x10, 0x12, 0x51, 0x12, 0x00, 0x00, 0xcf, 0x6f, 0x45, 0x51,
-  0x31, 0x35, 0x53, 0x51, 0x35, 0x75, 0x8d, 0x5f, 0xff, 0xf5, 0x5f, 0xfe,
-  0x9f, 0xb1, 0x51, 0x7f, 0xb5, 0x53, 0xba, 0x35, 0x53, 0x72, 0x35, 0x53,
-  0x22, 0xd5, 0x5b, 0xaa, 0x35, 0x51, 0x4e, 0x55, 0xd1, 0x44, 0x51, 0x55,
-  0xc7, 0x61, 0x65, 0x52, 0xee, 0x75, 0x5f, 0x66, 0x67, 0x61, 0xef, 0xc1,
-  0x51, 0x26, 0x25, 0xf2, 0x12, 0x12, 0xaf, 0xc1, 0xf3, 0x13, 0x33, 0x29,
-  0x51, 0x22, 0x65, 0x56, 0x77, 0x25, 0x56, 0x3b, 0xe5, 0x5e, 0x66, 0x65,
-  0xd6, 0x77, 0xd1, 0xa8, 0x51, 0x22, 0x85, 0x56, 0x33, 0x2f, 0x21, 0xd1,
-  0x22, 0xd1, 0xa6, 0xf1, 0x1e, 0x1e, 0xe7, 0xe1, 0xa7, 0xa1, 0x12, 0xcf,
-  0x44, 0xa4, 0x11, 0x16, 0xf3, 0x79, 0x61, 0x50, 0x31, 0x77, 0x24, 0x35,
-  0xf1, 0x47, 0x46, 0xd7, 0xf8, 0xf5, 0x5c, 0xff, 0xf5, 0xff, 0x1f, 0x1b,
-  0xf5, 0x5c, 0xfb, 0xbf, 0x94, 0xf4, 0x23, 0x27, 0xb5, 0xd5, 0x33, 0xf2,
-  0x16, 0x16, 0xf5, 0xfb, 0x1a, 0x18, 0x75, 0x5d, 0xc6, 0x55, 0xf3, 0x16,
-  0x14, 0x55, 0x7d, 0x14, 0x5e, 0x24, 0x6f, 0x68, 0x59, 0xb5, 0x6d, 0x8e,
-  0x47, 0x61, 0xef, 0xa1, 0x51, 0x26, 0x2f, 0x31, 0xe1, 0x21, 0xf1, 0x1a,
-  0x3e, 0x7d, 0x3b, 0x25, 0xf2, 0x42, 0x42, 0x65, 0xd6, 0x75, 0x54, 0x62,
-  0xf5, 0x51, 0xee, 0x65, 0x54, 0x66, 0x7f, 0x71, 0xd1, 0xea, 0x51, 0x22,
-  0xaf, 0x62, 0x52, 0x93, 0xaf, 0xa1, 0xd1, 0x4a, 0xf1, 0x16, 0x12, 0x6f,
-  0x41, 0x71, 0x1e, 0x7e, 0x13, 0x72, 0x1a, 0xf2, 0x5e, 0x54, 0x1a, 0xf1,
-  0x1a, 0x12, 0x4f, 0x54, 0x06, 0x15, 0xd3, 0x23, 0x54, 0x33, 0x31, 0x15,
-  0x5f, 0xcf, 0xb5, 0xdf, 0x4e, 0xf1, 0x19, 0x1b, 0xb5, 0xf8, 0x4b, 0x4f,
-  0xa5, 0xd8, 0x33, 0x52, 0x56, 0x75, 0x77, 0x16, 0x74, 0x19, 0x5b, 0x42,
-  0x35, 0xff, 0x1e, 0x1c, 0x77, 0x11, 0x6d, 0x14, 0x5d, 0x19, 0xcd, 0x1e,
-  0x45, 0xda, 0xe6, 0x58, 0xf5, 0xe5, 0xf6, 0x14, 0x12, 0xef, 0xc1, 0x51,
-  0x24, 0x25, 0x43, 0xd2, 0xca, 0xf2, 0x11, 0x1f, 0x2b, 0x11, 0x2c, 0x54,
-  0x66, 0x55, 0x57, 0xea, 0xb5, 0x5d, 0xee, 0x65, 0x54, 0x66, 0x75, 0x55,
-  0xe8, 0x21, 0x8d, 0x22, 0xbf, 0x11, 0xf1, 0x12, 0x12, 0xe5, 0x58, 0xae,
-  0xef, 0xc1, 0xf1, 0x1e, 0x1f, 0xa5, 0x28, 0xf1, 0x46, 0x44, 0x1a, 0xc1,
-  0x12, 0x7f, 0xc4, 0x0d, 0x15, 0xd3, 0x22, 0x54, 0x77, 0x67, 0x64, 0x15,
-  0x5f, 0xce, 0x95, 0xdf, 0xfe, 0xf1, 0x1d, 0x1b, 0xe5, 0xf8, 0x49, 0x4b,
-  0xaf, 0x94, 0xd4, 0x35, 0x52, 0xdb, 0x17, 0x32, 0x6f, 0x61, 0x71, 0x19,
-  0xfb, 0x12, 0x14, 0x5f, 0xf1, 0xf1, 0x16, 0x1c, 0x77, 0x51, 0x6f, 0x41,
-  0xf1, 0x15, 0x1d, 0x4d, 0x1c, 0xc5, 0xfe, 0x1e, 0x8c, 0x55, 0x7f, 0x8e,
-  0xfc, 0x14, 0x12, 0xef, 0x81, 0x51, 0x26, 0x2b, 0x11, 0x24, 0xaf, 0xc2,
-  0xf2, 0x37, 0x17, 0x21, 0x2d, 0x42, 0x65, 0x74, 0x45, 0x53, 0xea, 0x75,
-  0x55, 0xec, 0x61, 0x45, 0xf6, 0x17, 0x13, 0x85, 0x5a, 0x22, 0xcd, 0x22,
-  0xbf, 0x91, 0xf1, 0x18, 0x1a, 0xe5, 0xf4, 0x1c, 0x1a, 0xaf, 0xc1, 0x71,
-  0x1c, 0x7e, 0x12, 0x32, 0x18, 0xef, 0x44, 0xe4, 0x21, 0x81, 0xf1, 0x2b,
-  0x74, 0x00, 0x10, 0x02, 0x00, 0x40, 0x18, 0x04, 0x40, 0x08, 0x00, 0x00,
-  0x10, 0x08, 0x20, 0x41, 0x04, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x41, 0x00, 0x10, 0x04, 0x41, 0x12, 0x00, 0x40, 0x08, 0x12, 0x40, 0x58,
-  0x48, 0x12, 0x20, 0x01, 0xb0, 0xde, 0x07, 0x00, 0x24, 0x10, 0x44, 0x0c,
-  0x00, 0x00, 0x10, 0x08, 0x44, 0x12, 0x50, 0x84, 0x24, 0x00, 0x41, 0x81,
-  0x00, 0x45, 0x08, 0x00, 0x20, 0x01, 0x00, 0x4c, 0x02, 0x00, 0x10, 0x44,
-  0x08, 0x00, 0x00, 0x00, 0x12, 0x40, 0x58, 0x48, 0x80, 0x41, 0x08, 0x84,
-  0x00, 0xbd, 0xc2, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28, 0x1f, 0x41, 0x32,
-  0x4a, 0x1f, 0x41, 0x32, 0x4a, 0x1f, 0x41, 0xb2, 0x4a, 0xd1, 0x41, 0xb2,
+  0x6e, 0x21, 0xb7, 0x00, 0x10, 0x60, 0x20, 0xa2, 0x21, 0x00, 0x81, 0x28,
+  0x13, 0x02, 0xf0, 0xff, 0xff, 0x6f, 0x40, 0x02, 0xa1, 0x84, 0x81, 0x80,
+  0x41, 0x08, 0x80, 0x42, 0x42, 0x54, 0xa2, 0x42, 0x21, 0x40, 0x22, 0xcc,
+  0x18, 0x00, 0x00, 0x15, 0x04, 0x28, 0x80, 0x32, 0x42, 0x28, 0x00, 0x88,
+  0x10, 0x22, 0x01, 0x41, 0x25, 0xa4, 0x42, 0x89, 0x08, 0x83, 0x04, 0x9e,
+  0x73, 0x60, 0x44, 0xd0, 0x62, 0x81, 0x91, 0x42, 0xcc, 0x41, 0x28, 0x72,
+  0x13, 0x5e, 0x48, 0x23, 0x11, 0x42, 0x98, 0x41, 0x82, 0x26, 0xb8, 0x24,
+  0xd8, 0x62, 0x02, 0xa7, 0x42, 0x46, 0x85, 0x66, 0x45, 0x47, 0x84, 0x4d,
+  0x4a, 0xb0, 0x48, 0x11, 0xf4, 0x28, 0x14, 0x72, 0x45, 0x48, 0x64, 0x22,
+  0x41, 0x17, 0x26, 0x4e, 0x16, 0x43, 0x43, 0x92, 0x38, 0x25, 0x8c, 0x41,
+  0xf4, 0x44, 0x18, 0x45, 0xc9, 0x54, 0x29, 0xb9, 0x29, 0x91, 0x58, 0xc4,
+  0x4f, 0x21, 0xe8, 0x24, 0xc2, 0x44, 0x3e, 0x48, 0x8b, 0x41, 0x45, 0x32,
+  0x44, 0x2a, 0x01, 0x4c, 0xd4, 0x91, 0x0d, 0x4c, 0x22, 0x13, 0x12, 0x92,
+  0x4a, 0x28, 0x84, 0x22, 0x27, 0x81, 0xa4, 0x00, 0x20, 0x24, 0x98, 0x2a,
+  0xc7, 0x22, 0xcc, 0x52, 0x82, 0x61, 0x17, 0x44, 0x66, 0x08, 0x8d, 0x44,
+  0x41, 0x21, 0x45, 0x1a, 0x6c, 0x22, 0x4a, 0x41, 0x4c, 0xa2, 0x82, 0x84,
+  0x19, 0x94, 0x12, 0x12, 0x24, 0x45, 0x58, 0x84, 0x00, 0x83, 0xc4, 0x45,
+  0x4d, 0x22, 0x98, 0x12, 0x88, 0xc5, 0x82, 0x88, 0x15, 0xd4, 0x2c, 0x62,
+  0x84, 0x46, 0xc4, 0x88, 0x32, 0x83, 0x04, 0x6f, 0xd3, 0x04, 0x42, 0x90,
+  0x14, 0x12, 0xd0, 0x48, 0x01, 0x40, 0x17, 0xc4, 0x12, 0x50, 0x82, 0x14,
+  0x00, 0x23, 0x08, 0x60, 0x82, 0x18, 0x30, 0x54, 0xb0, 0x48, 0x42, 0x22,
+  0x45, 0xe2, 0xc1, 0x84, 0x02, 0x44, 0x42, 0x63, 0x81, 0x32, 0x44, 0x2d,
+  0x24, 0x30, 0x31, 0x21, 0x2a, 0x11, 0xe4, 0x61, 0x42, 0x88, 0x05, 0x99,
+  0xb2, 0x18, 0x04, 0x16, 0x26, 0x92, 0x42, 0x1a, 0xc4, 0x14, 0x26, 0x92,
+  0x44, 0x00, 0x49, 0xf4, 0x64, 0x44, 0x20, 0x02, 0x10, 0x86, 0x02, 0x41,
+  0x12, 0x22, 0x10, 0x84, 0x21, 0x92, 0x14, 0x14, 0x2a, 0x11, 0x42, 0x24,
+  0xd4, 0x22, 0xe4, 0x22, 0xc1, 0x14, 0x20, 0x04, 0x80, 0x32, 0x4c, 0x22,
+  0x00, 0x42, 0x4c, 0x21, 0x51, 0x28, 0x10, 0x82, 0x02, 0x1e, 0x28, 0x49,
+  0x02, 0x4b, 0x12, 0x42, 0x90, 0x86, 0x13, 0x84, 0x44, 0xc8, 0x58, 0x44,
+  0x12, 0x40, 0x84, 0x41, 0x18, 0xc8, 0x84, 0x42, 0x7f, 0x23, 0x0c, 0x00,
+  0x44, 0x40, 0x34, 0x18, 0x89, 0x11, 0x64, 0x81, 0x50, 0x84, 0x24, 0x22,
+  0x10, 0x54, 0x12, 0x45, 0x48, 0x01, 0x32, 0x15, 0x22, 0xd4, 0x84, 0xe5,
+  0x21, 0x42, 0x58, 0x84, 0x48, 0x12, 0x44, 0x81, 0x43, 0x42, 0x05, 0x4d,
+  0x28, 0xc9, 0x01, 0x4b, 0x24, 0x12, 0x41, 0x80, 0x01, 0x13, 0x44, 0xa4,
+  0x41, 0x41, 0x84, 0x26, 0x78, 0x42, 0x04, 0x42, 0x60, 0x2c, 0x48, 0x10,
+  0x44, 0x82, 0x66, 0x81, 0xff, 0xcd, 0x0a, 0x40, 0x82, 0x61, 0x22, 0x50,
+  0x22, 0x40, 0x42, 0x21, 0x01, 0x80, 0x31, 0x82, 0x00, 0x28, 0x18, 0x44,
+  0x85, 0x84, 0x14, 0x48, 0x01, 0x80, 0x02, 0x30, 0x42, 0x1a, 0x92, 0x48,
+  0x00, 0x21, 0x10, 0x04, 0x00, 0x48, 0x40, 0x04, 0x12, 0x26, 0x04, 0x00,
+  0x20, 0x28, 0x18, 0x14, 0x9c, 0x18, 0x80, 0x02, 0x81, 0xf0, 0xad, 0xb1,
+  0x00, 0x24, 0x12, 0x25, 0x24, 0xd2, 0x2a, 0x61, 0xc1, 0x43, 0xc1, 0x38,
+  0x00, 0xd0, 0x22, 0x81, 0x11, 0x24, 0x32, 0x26, 0x15, 0x44, 0xd6, 0x48,
+  0x73, 0x22, 0x21, 0xf4, 0x11, 0x48, 0x24, 0x84, 0x8d, 0x24, 0x48, 0x1e,
+  0x4c, 0x28, 0x28, 0x8b, 0x42, 0x43, 0x94, 0x14, 0x4f, 0x81, 0x42, 0x12,
+  0xd4, 0x42, 0x82, 0x12, 0x34, 0x48, 0x2e, 0x14, 0xa0, 0x34, 0x16, 0xa4,
+  0x12, 0x82, 0x81, 0x42, 0x2d, 0x4c, 0x4a, 0x39, 0x44, 0x12, 0x47, 0x28,
+  0x4d, 0x48, 0x18, 0x8c, 0x42, 0xd8, 0x48, 0xc4, 0x48, 0x3e, 0xee, 0x20,
+  0x02, 0x41, 0x28, 0x61, 0x00, 0x50, 0x12, 0x12, 0x81, 0x12, 0x30, 0x84,
+  0x34, 0x13, 0x11, 0x28, 0x21, 0x84, 0xa4, 0x14, 0x47, 0x81, 0x44, 0x2a,
+  0x04, 0x80, 0x42, 0x62, 0x44, 0x8c, 0x41, 0x04, 0x10, 0x62, 0x41, 0x00,
+  0x18, 0xa0, 0x12, 0x10, 0x54, 0x41, 0x42, 0x4c, 0x14, 0x92, 0x41, 0x81,
+  0x10, 0x28, 0x48, 0xc4, 0x48, 0x18, 0x40, 0x04, 0xa8, 0x70, 0x8b, 0x0c,
+  0x44, 0x00, 0x40, 0x02, 0x44, 0x41, 0x40, 0x14, 0x06, 0x40, 0x02, 0x00,
+  0x24, 0x10, 0xcc, 0x48, 0x28, 0x2c, 0x02, 0x42, 0x44, 0x45, 0x48, 0x16,
+  0x04, 0x00, 0x47, 0x84, 0xc0, 0x44, 0x93, 0x05, 0xf0, 0x04, 0x44, 0x00,
+  0x12, 0x00, 0x50, 0x48, 0xc1, 0x12, 0x20, 0x01, 0x4b, 0x41, 0x60, 0x81,
+  0x8c, 0x21, 0xf1, 0xa7, 0x7c, 0xa9, 0x02, 0xf0, 0x19, 0x12, 0x00, 0x24,
+  0x12, 0x81, 0x40, 0x78, 0x11, 0x18, 0x02, 0x10, 0x01, 0x00, 0x11, 0x20,
+  0x81, 0x24, 0x02, 0x84, 0x44, 0x17, 0x26, 0x24, 0x44, 0x20, 0x06, 0x41,
+  0x41, 0x26, 0x42, 0x04, 0xc4, 0x2c, 0x04, 0x89, 0x21, 0x74, 0x28, 0x02,
+  0x00, 0x99, 0x0e, 0xf1, 0x31, 0x00, 0xf0, 0xf8, 0x26, 0x10, 0x04, 0x50,
+  0x22, 0x00, 0x21, 0x00, 0x83, 0x02, 0x10, 0x04, 0x24, 0x00, 0x00, 0x40,
+  0x82, 0x04, 0x4b, 0x41, 0x29, 0x24, 0x94, 0x44, 0x84, 0x44, 0x48, 0x00,
+  0x90, 0x42, 0x40, 0x14, 0x02, 0x24, 0x48, 0x20, 0x04, 0x18, 0x30, 0x44,
+  0x48, 0x40, 0x88, 0x02, 0x00, 0x46, 0x24, 0x05, 0x00, 0xd0, 0x9d, 0x0b,
+  0x14, 0x44, 0x8c, 0x01, 0x00, 0x54, 0x10, 0x08, 0x14, 0x1d, 0x05, 0xf0,
+  0xff, 0xff, 0xff, 0xd7, 0x21, 0x84, 0x22, 0x81, 0x50, 0x28, 0x80, 0x25,
+  0x52, 0x22, 0x10, 0x84, 0xd4, 0x85, 0x11, 0x42, 0x01, 0x49, 0x11, 0x02,
+  0x40, 0x09, 0x60, 0x41, 0x14, 0x00, 0x00, 0x80, 0x12, 0x04, 0x84, 0x24,
+  0x80, 0x12, 0xfc, 0x38, 0x18, 0x20, 0x08, 0x40, 0x04, 0x00, 0x30, 0x24,
+  0x26, 0x04, 0x20, 0x42, 0x24, 0x42, 0x08, 0x00, 0x41, 0x81, 0x80, 0x24,
+  0x04, 0x00, 0x22, 0x42, 0x00, 0x00, 0x10, 0x8c, 0x94, 0x48, 0x84, 0x10,
+  0x08, 0xa0, 0x14, 0x00, 0x00, 0x41, 0x41, 0x44, 0x20, 0x01, 0x12, 0x00,
+  0x80, 0x41, 0xf1, 0x78, 0xa3, 0x24, 0x00, 0x00, 0x24, 0x80, 0x41, 0x02,
+  0x24, 0x00, 0x90, 0x28, 0x25, 0x11, 0x04, 0x44, 0x81, 0x20, 0xb4, 0x24,
+  0x04, 0x00, 0x48, 0x84, 0x48, 0x90, 0x44, 0x48, 0x42, 0x84, 0x48, 0x48,
+  0x84, 0x80, 0x04, 0x43, 0x04, 0x4b, 0x14, 0x50, 0x84, 0x46, 0x24, 0x04,
+  0x80, 0x42, 0x81, 0x41, 0x88, 0x21, 0x04, 0x44, 0x18, 0x24, 0xf0, 0x34,
+  0x96, 0x00, 0x10, 0x48, 0x28, 0x41, 0x02, 0x21, 0x90, 0x12, 0x24, 0x44,
+  0x11, 0x18, 0x84, 0x40, 0x62, 0x11, 0x24, 0x12, 0x25, 0x64, 0x11, 0x81,
+  0x81, 0x25, 0x18, 0x01, 0x11, 0x10, 0x11, 0x04, 0x54, 0x28, 0x24, 0x00,
+  0x29, 0x42, 0x24, 0x21, 0x24, 0x52, 0x82, 0x22, 0x00, 0x23, 0x12, 0x81,
+  0x42, 0x02, 0x24, 0x00, 0x24, 0x81, 0x50, 0x82, 0x44, 0x9f, 0x43, 0x09,
+  0x10, 0x04, 0xa1, 0x00, 0x24, 0x41, 0x84, 0x00, 0x10, 0x4c, 0x88, 0x02,
+  0x00, 0x00, 0x00, 0x42, 0x18, 0x40, 0x04, 0x44, 0x10, 0x24, 0x54, 0x48,
+  0x00, 0x10, 0x14, 0x08, 0x24, 0x00, 0x40, 0x24, 0x05, 0x12, 0x30, 0x24,
+  0x00, 0x00, 0x00, 0x20, 0x41, 0x08, 0x81, 0xbf, 0xc5, 0x4b, 0xc2, 0x18,
+  0xc0, 0x41, 0x24, 0x14, 0x44, 0x00, 0x5c, 0x12, 0x02, 0x64, 0x80, 0x02,
+  0x21, 0x25, 0x02, 0xa5, 0x42, 0x18, 0x44, 0x58, 0x82, 0x50, 0x28, 0x84,
+  0x88, 0x84, 0x2a, 0x84, 0x01, 0x2c, 0x41, 0x41, 0x18, 0xd2, 0xa2, 0x41,
+  0xc6, 0x41, 0x21, 0x14, 0x4c, 0x34, 0x18, 0x4a, 0x41, 0x05, 0x40, 0x14,
+  0x88, 0x02, 0x00, 0x41, 0x49, 0x12, 0xd4, 0x84, 0x02, 0x21, 0xc0, 0x9a,
+  0x24, 0x69, 0x21, 0x78, 0x18, 0x48, 0x38, 0x12, 0x25, 0x16, 0x36, 0x16,
+  0x3c, 0x02, 0x11, 0x50, 0xc1, 0x24, 0x8f, 0xa2, 0x12, 0x41, 0x92, 0x12,
+  0x25, 0x12, 0x96, 0x48, 0xcb, 0x62, 0x42, 0x24, 0x85, 0xd8, 0x1a, 0x54,
+  0x4e, 0x49, 0xf6, 0x42, 0x44, 0xc9, 0x14, 0x64, 0x52, 0xa7, 0x24, 0x19,
+  0x14, 0xc8, 0x52, 0x45, 0x7e, 0x18, 0x12, 0xf6, 0x14, 0x46, 0x45, 0xe4,
+  0x44, 0x73, 0x18, 0xf4, 0x14, 0x45, 0x12, 0x1f, 0x44, 0x81, 0x14, 0x45,
+  0x18, 0x34, 0x12, 0x89, 0x21, 0xf1, 0x44, 0x14, 0xc7, 0x45, 0x41, 0x18,
+  0x8d, 0x11, 0x18, 0x2f, 0xd9, 0x0e, 0x40, 0x04, 0x25, 0x46, 0x03, 0x15,
+  0x44, 0x74, 0x2a, 0xf4, 0x2a, 0x12, 0x25, 0x24, 0x31, 0x26, 0x84, 0x10,
+  0x04, 0x45, 0x01, 0x1d, 0x18, 0x21, 0x27, 0x84, 0x81, 0x8f, 0x81, 0x84,
+  0x54, 0x84, 0x4a, 0x74, 0x48, 0x5d, 0x24, 0x46, 0xd4, 0x42, 0xd4, 0x24,
+  0x45, 0xf8, 0x5e, 0x2e, 0x2f, 0x44, 0x34, 0x64, 0x81, 0x41, 0x44, 0x46,
+  0x21, 0x94, 0x4d, 0x23, 0xd4, 0x28, 0xb3, 0x44, 0xa1, 0x41, 0x42, 0x8d,
+  0x28, 0x45, 0x44, 0x84, 0x21, 0x91, 0x12, 0x1a, 0x84, 0xe5, 0x41, 0x33,
+  0x12, 0x26, 0x58, 0xc8, 0xde, 0x27, 0x50, 0x41, 0x41, 0x34, 0x81, 0x00,
+  0x16, 0x02, 0x45, 0xd8, 0x44, 0x42, 0x12, 0x12, 0x98, 0x1c, 0x31, 0xa7,
+  0xa1, 0x21, 0x24, 0x85, 0x58, 0x68, 0x47, 0xc4, 0x1c, 0xe1, 0x82, 0xf6,
+  0x43, 0x14, 0x23, 0xe4, 0x44, 0x41, 0x28, 0xa3, 0x22, 0x1c, 0x21, 0x64,
+  0x84, 0x4d, 0x44, 0x50, 0x24, 0x35, 0x34, 0x42, 0x2d, 0x25, 0x24, 0xa3,
+  0x82, 0x64, 0x81, 0x4d, 0x58, 0x42, 0x44, 0x84, 0x29, 0x62, 0x62, 0x81,
+  0x17, 0x82, 0x20, 0x52, 0x44, 0x28, 0x50, 0x8a, 0x85, 0x68, 0x21, 0x41,
+  0xbf, 0x12, 0x0d, 0x13, 0x11, 0x34, 0x11, 0x21, 0x13, 0x01, 0x13, 0xd1,
+  0x24, 0x11, 0x81, 0x11, 0xc1, 0x12, 0x11, 0x2c, 0x11, 0xc1, 0x13, 0xc0,
+  0x11, 0xc0, 0x11, 0xd0, 0x18, 0x03, 0x14, 0x40, 0x05, 0x8f, 0x51, 0x12,
+  0x62, 0x11, 0x41, 0x1a, 0x12, 0xb6, 0x18, 0x02, 0x1b, 0x21, 0x41, 0x1b,
+  0x21, 0xb0, 0x11, 0x12, 0x96, 0x21, 0x61, 0x19, 0x12, 0x96, 0x21, 0x21,
+  0x15, 0x18, 0x02, 0x21, 0x22, 0x25, 0x24, 0x52, 0x42, 0x22, 0x20, 0x42,
+  0xf4, 0x81, 0xb2, 0x14, 0x1d, 0x15, 0x1f, 0x11, 0x51, 0xa9, 0xcf, 0x51,
+  0xe1, 0x11, 0xf1, 0x15, 0x15, 0x25, 0xc4, 0x13, 0x2f, 0x31, 0xf3, 0x17,
+  0x31, 0x1a, 0xd1, 0x31, 0xf1, 0x13, 0x11, 0x5f, 0xf1, 0xb1, 0x12, 0xd1,
+  0x56, 0xf1, 0x13, 0x13, 0x7f, 0x71, 0xf1, 0x11, 0x19, 0x25, 0xf3, 0x13,
+  0x59, 0x5f, 0x57, 0xf7, 0x71, 0x71, 0x4e, 0x43, 0x35, 0xfb, 0x41, 0x43,
+  0x7f, 0xb1, 0xb1, 0x76, 0xf5, 0x15, 0x11, 0x5f, 0x75, 0xd4, 0x77, 0xf5,
+  0x4e, 0x7e, 0x4f, 0xc3, 0xf7, 0x64, 0x65, 0x5f, 0x72, 0xf7, 0x43, 0x73,
+  0x3f, 0x73, 0xf3, 0x2b, 0x2c, 0x4f, 0x53, 0xf3, 0x18, 0x39, 0x3f, 0x36,
+  0xf3, 0x7a, 0x62, 0x2f, 0x76, 0xf3, 0x4a, 0x49, 0x3f, 0x33, 0xf2, 0x72,
+  0x72, 0x37, 0x34, 0x35, 0x51, 0x6e, 0x75, 0xf7, 0x32, 0x22, 0xaf, 0x83,
+  0xf3, 0x34, 0x32, 0x2f, 0x27, 0xb5, 0x12, 0xa3, 0x31, 0x2a, 0x32, 0x18,
+  0xed, 0x22, 0xbb, 0x52, 0xc0, 0x14, 0x1f, 0x55, 0xf5, 0x19, 0x1a, 0xed,
+  0x4d, 0x34, 0x5f, 0x71, 0xf1, 0x13, 0x17, 0x7c, 0xf1, 0x1a, 0x1f, 0x7f,
+  0x52, 0x52, 0x51, 0x18, 0x2b, 0x31, 0xd5, 0xdf, 0x13, 0xd2, 0xfe, 0xf1,
+  0x13, 0x13, 0x65, 0x44, 0xfa, 0x16, 0x17, 0x7f, 0xf1, 0xf5, 0x66, 0x6c,
+  0x6e, 0x68, 0x8f, 0xb5, 0x54, 0xb3, 0x4f, 0x28, 0x5c, 0xa6, 0x7f, 0xb2,
+  0xfc, 0x53, 0x73, 0x6f, 0x65, 0xd4, 0x66, 0xf5, 0x4f, 0x7f, 0x6f, 0xc3,
+  0xf7, 0x54, 0x5e, 0x4d, 0x5e, 0x2f, 0x64, 0xf7, 0x73, 0x77, 0xdf, 0xc1,
+  0x51, 0x56, 0xcf, 0xd4, 0xf6, 0x73, 0x77, 0xbf, 0x14, 0xf5, 0x44, 0x1d,
+  0xcf, 0x96, 0xf6, 0x37, 0x27, 0x3f, 0x57, 0x27, 0x34, 0x28, 0xf5, 0x57,
+  0x46, 0x1a, 0xf1, 0x18, 0x1a, 0x6f, 0x63, 0xf3, 0x72, 0x52, 0x6b, 0x75,
+  0xcf, 0xe1, 0xf3, 0x2a, 0x28, 0x8b, 0x33, 0xcf, 0xc1, 0xf3, 0x18, 0x8f,
+  0x70, 0x12, 0x94, 0x45, 0x8f, 0xb1, 0x51, 0xcc, 0x31, 0x65, 0xf4, 0x13,
+  0x15, 0x67, 0x21, 0x7d, 0x14, 0xc5, 0x5c, 0x51, 0x16, 0xd2, 0xaa, 0x53,
+  0xee, 0x35, 0x79, 0x17, 0xde, 0x32, 0x51, 0x46, 0x24, 0xbf, 0xa1, 0xd1,
+  0x92, 0xf4, 0x2e, 0x24, 0x8b, 0x62, 0x9d, 0x52, 0x2f, 0x34, 0xf4, 0x4a,
+  0xcc, 0x4f, 0x84, 0xf4, 0x6d, 0x43, 0x67, 0x23, 0x6d, 0x54, 0x4f, 0x44,
+  0xf4, 0x7c, 0x4f, 0x4d, 0x6c, 0xef, 0x61, 0xf1, 0x46, 0x4e, 0x4f, 0x27,
+  0xd4, 0x63, 0xf6, 0x1c, 0x1d, 0x45, 0x76, 0x2b, 0xfa, 0x44, 0x34, 0xf7,
+  0x51, 0x87, 0x44, 0x9f, 0xe7, 0xe7, 0x44, 0x54, 0x53, 0x6a, 0xc2, 0x2a,
+  0xc5, 0x54, 0x57, 0x7a, 0x00, 0xf0, 0x82, 0x63, 0xe3, 0x45, 0xf3, 0x14,
+  0x16, 0x2b, 0x13, 0x21, 0x8f, 0x82, 0x92, 0x1c, 0x4f, 0xe5, 0x0b, 0x37,
+  0x51, 0x5f, 0x41, 0x55, 0xb8, 0xe7, 0xc4, 0x3b, 0x11, 0x7f, 0x51, 0x51,
+  0x62, 0x67, 0x61, 0xff, 0xc2, 0xf3, 0x3f, 0x3d, 0x24, 0x16, 0xd2, 0xbb,
+  0xf1, 0x1f, 0x1f, 0x25, 0x78, 0x1f, 0xde, 0x32, 0xf1, 0x17, 0x15, 0x85,
+  0x5a, 0xef, 0x2f, 0xd1, 0xf5, 0x5f, 0x7d, 0x2e, 0x28, 0x9d, 0x5a, 0xaf,
+  0xb4, 0xd4, 0xdf, 0xfc, 0x44, 0x48, 0xcf, 0xcb, 0xf5, 0x71, 0x65, 0x5d,
+  0x55, 0x49, 0xf4, 0x7c, 0x4f, 0x6f, 0x81, 0xf7, 0x6e, 0x6e, 0x69, 0xf4,
+  0x75, 0x47, 0x3f, 0x61, 0xf7, 0x2c, 0x2d, 0x65, 0xf6, 0x3f, 0x1e, 0x1f,
+  0x55, 0xf3, 0x6a, 0x72, 0xef, 0xc5, 0xf1, 0x5d, 0x5a, 0x5f, 0x53, 0xf3,
+  0x52, 0x52, 0x2b, 0x26, 0x9d, 0x2b, 0x95, 0x55, 0x66, 0x2b, 0x11, 0x8f,
+  0x83, 0xf3, 0x34, 0x16, 0x2f, 0x45, 0xf3, 0x54, 0x52, 0xef, 0x42, 0xf1,
+  0x2a, 0x28, 0x85, 0xd8, 0xcc, 0xb1, 0x16, 0x06, 0x7c, 0x04, 0xf0, 0x29,
+  0x41, 0x84, 0x00, 0x24, 0x84, 0x40, 0x08, 0x40, 0x02, 0x00, 0x42, 0x00,
+  0x10, 0x08, 0x10, 0x04, 0x41, 0x81, 0x41, 0x10, 0x02, 0x21, 0x00, 0x00,
+  0x10, 0x04, 0x00, 0x40, 0x48, 0x24, 0x01, 0x12, 0x00, 0x20, 0x01, 0xf0,
+  0x4d, 0x71, 0x70, 0x82, 0x51, 0x41, 0x24, 0x15, 0x48, 0x02, 0x45, 0x11,
+  0x41, 0x12, 0x01, 0x11, 0x10, 0x01, 0x50, 0x12, 0x02, 0x00, 0xf4, 0x2d,
+  0x15, 0x88, 0x42, 0x42, 0x01, 0x54, 0x24, 0x5c, 0x02, 0x46, 0x41, 0x02,
+  0x30, 0x41, 0x50, 0x41, 0x45, 0x12, 0x11, 0x94, 0x41, 0x21, 0x44, 0x25,
+  0x91, 0x41, 0x2d, 0x12, 0x11, 0x00, 0x25, 0x21, 0x91, 0x12, 0x43, 0x91,
+  0x12, 0x41, 0x29, 0x01, 0x81, 0x14, 0xff, 0xd7, 0x0c, 0x6d, 0x52, 0x1f,
+  0x41, 0xd2, 0x28, 0xf1, 0x11, 0x24, 0xab, 0x14, 0x1f, 0x41, 0xb2, 0x4e,
+  0x09, 0x00, 0xc1, 0x4a, 0xb9, 0x11, 0xf2, 0x4a, 0x92, 0x53, 0xf1, 0x4a,
+  0x92, 0x43, 0xf3, 0xf2, 0x0a, 0xf0, 0x0b, 0x91, 0x47, 0x83, 0xad, 0x91,
+  0x4f, 0x83, 0xc4, 0xb1, 0x4f, 0xa2, 0xc4, 0x85, 0x4f, 0xa2, 0x74, 0x18,
+  0xf5, 0x24, 0x5a, 0x8f, 0x59, 0xf2, 0x26, 0x5a, 0x96, 0x09, 0x00, 0xf2,
+  0x0a, 0x49, 0xf2, 0x22, 0x5a, 0x1f, 0x49, 0xf2, 0x24, 0x52, 0x1f, 0x49,
+  0xf2, 0x28, 0x12, 0x1f, 0x49, 0xb2, 0x6c, 0xf1, 0x91, 0x24, 0xeb, 0x16,
+  0x1f, 0x48, 0xf4, 0x0a, 0xf4, 0x03, 0xd9, 0x81, 0xb2, 0x4a, 0x59, 0x85,
+  0xab, 0x94, 0x47, 0x82, 0xab, 0xb4, 0x43, 0xf2, 0x4a, 0xb4, 0x47, 0x82,
+  0xf4, 0x0a, 0xf1, 0x52, 0xe7, 0x59, 0xc0, 0x4a, 0x4c, 0x96, 0x48, 0x4c,
+  0x32, 0x48, 0x4c, 0x32, 0x4a, 0x4c, 0x32, 0x6a, 0x28, 0xaf, 0x44, 0x88,
+  0xf2, 0x4a, 0xa4, 0x41, 0x8b, 0xa4, 0x43, 0xb2, 0x48, 0x38, 0x24, 0xab,
+  0x84, 0x22, 0x2b, 0x84, 0x65, 0x98, 0x88, 0x6f, 0x22, 0xb5, 0x48, 0xb8,
+  0x24, 0xa9, 0x84, 0x45, 0x2a, 0x7c, 0x22, 0x28, 0xc8, 0x49, 0xc2, 0xa4,
+  0x86, 0xcc, 0x42, 0x8e, 0x48, 0x8d, 0x42, 0x86, 0x34, 0x48, 0x86, 0x04,
+  0x9e, 0x48, 0x83, 0x44, 0xd4, 0x48, 0x89, 0xf4, 0x48, 0xb4, 0x41, 0x8b,
+  0xb4, 0x41, 0x8b, 0x94, 0x80, 0xd9, 0x84, 0x84, 0x99, 0x46, 0x98, 0x8c,
+  0xf5, 0x51, 0x53, 0x40, 0x08, 0xec, 0x0a, 0x00, 0x51, 0x01, 0x00, 0xeb,
+  0x0a, 0x20, 0x01, 0x88, 0xdf, 0x0a, 0x31, 0x00, 0x80, 0x04, 0xe7, 0x0a,
+  0xf0, 0xff, 0xff, 0xff, 0xff, 0x73, 0xa8, 0x11, 0x00, 0x20, 0x01, 0x00,
+  0x21, 0xf0, 0x13, 0x25, 0x50, 0x42, 0x10, 0x38, 0x28, 0x28, 0x24, 0x24,
+  0x10, 0xa4, 0x12, 0x81, 0x00, 0x21, 0x41, 0x89, 0x72, 0x24, 0x5a, 0x84,
+  0x10, 0x1a, 0x04, 0x81, 0x84, 0x60, 0x24, 0x48, 0x41, 0x27, 0x42, 0x48,
+  0x41, 0x4f, 0x21, 0x64, 0x64, 0x12, 0x44, 0x12, 0x41, 0x2d, 0x22, 0x90,
+  0x41, 0x4c, 0x04, 0x12, 0x81, 0x88, 0x00, 0x11, 0x12, 0x91, 0x16, 0x64,
+  0x41, 0x41, 0x41, 0x84, 0x12, 0x85, 0x54, 0x48, 0xc1, 0xef, 0xa2, 0x04,
+  0x24, 0x8a, 0x12, 0x54, 0x42, 0x45, 0x32, 0x2c, 0x10, 0x48, 0x18, 0x16,
+  0xc1, 0x52, 0x40, 0x5c, 0x28, 0x18, 0x21, 0xc0, 0x24, 0x4c, 0x81, 0x44,
+  0x2c, 0x22, 0x14, 0x5c, 0x48, 0x70, 0x48, 0x01, 0x90, 0x12, 0x84, 0xc0,
+  0x44, 0x24, 0x4a, 0x02, 0x00, 0x1a, 0x12, 0x22, 0x54, 0x48, 0x4a, 0x41,
+  0xc4, 0x51, 0x80, 0x44, 0x24, 0x31, 0x42, 0x88, 0x89, 0x31, 0x48, 0x4e,
+  0x14, 0x43, 0x24, 0xc1, 0x41, 0x68, 0x3f, 0xb3, 0x4a, 0x42, 0x34, 0x42,
+  0xe4, 0xc1, 0x4c, 0x52, 0x86, 0x00, 0x85, 0x66, 0x42, 0x41, 0x70, 0x22,
+  0x02, 0xc1, 0xa9, 0x73, 0x22, 0x56, 0x48, 0x22, 0x41, 0x24, 0x41, 0x8c,
+  0xa2, 0x41, 0x60, 0xcc, 0x29, 0xd4, 0xa4, 0x34, 0x24, 0x46, 0x92, 0x14,
+  0x17, 0xc1, 0x4d, 0x42, 0x1e, 0x44, 0xc1, 0x48, 0x42, 0x29, 0x12, 0xa2,
+  0x41, 0x42, 0x70, 0x14, 0xc8, 0x48, 0x88, 0x47, 0x15, 0x20, 0x06, 0x8d,
+  0x13, 0x44, 0x86, 0xc4, 0x1c, 0x44, 0x84, 0x1e, 0x46, 0xc9, 0x41, 0x78,
+  0x18, 0xf4, 0xa4, 0x89, 0x00, 0x28, 0x80, 0x02, 0x28, 0x25, 0x42, 0x08,
+  0x12, 0x85, 0xa1, 0x41, 0x50, 0x84, 0x00, 0x81, 0x40, 0x66, 0x81, 0x46,
+  0x44, 0x08, 0x84, 0x85, 0x04, 0x10, 0x01, 0x00, 0x2c, 0x04, 0x00, 0x2b,
+  0x12, 0x44, 0x00, 0x26, 0x43, 0x24, 0x04, 0x18, 0x44, 0x00, 0x14, 0x43,
+  0x01, 0x1a, 0x84, 0x01, 0x83, 0xb4, 0x14, 0x04, 0x60, 0x44, 0x2a, 0xf4,
+  0x13, 0xb1, 0x00, 0x00, 0x16, 0x48, 0x03, 0x41, 0x84, 0x00, 0x18, 0x19,
+  0x42, 0x12, 0x74, 0x42, 0x22, 0x01, 0x50, 0x48, 0x84, 0x44, 0x40, 0x41,
+  0x02, 0x11, 0x44, 0x21, 0x14, 0x8c, 0x21, 0x11, 0x02, 0x00, 0x20, 0x11,
+  0x22, 0x41, 0x12, 0x01, 0x44, 0x40, 0x18, 0x22, 0x41, 0x62, 0x81, 0x34,
+  0x12, 0x20, 0x01, 0xc0, 0x84, 0x00, 0x22, 0xcf, 0x6c, 0x49, 0x33, 0x51,
+  0x1e, 0x21, 0xdc, 0x91, 0x22, 0x41, 0x4d, 0x39, 0x34, 0x18, 0x56, 0x58,
+  0x82, 0x3d, 0x88, 0x24, 0x85, 0x41, 0xc8, 0x11, 0x81, 0x2c, 0x88, 0x72,
+  0x42, 0xd1, 0x42, 0x63, 0x91, 0x15, 0xc8, 0x18, 0x49, 0x44, 0x42, 0x42,
+  0xc8, 0x24, 0xc4, 0x69, 0x56, 0x42, 0x1e, 0x48, 0x26, 0x94, 0x22, 0x22,
+  0x4d, 0x22, 0x4c, 0xc2, 0x86, 0x19, 0x32, 0x1a, 0x83, 0x41, 0x63, 0x91,
+  0x45, 0x12, 0x01, 0x84, 0x46, 0x48, 0x31, 0x44, 0xc4, 0x1e, 0x88, 0xe1,
+  0x27, 0xa1, 0x8d, 0x24, 0x81, 0x4f, 0x82, 0x34, 0x18, 0x84, 0xbf, 0xdc,
+  0x01, 0x3b, 0x14, 0x2e, 0x11, 0x15, 0xac, 0x21, 0x34, 0x1d, 0x3c, 0x15,
+  0x64, 0x81, 0x52, 0xc0, 0x11, 0x19, 0x52, 0x12, 0x65, 0x68, 0x34, 0x83,
+  0x81, 0x08, 0x6d, 0x48, 0x89, 0xc3, 0x14, 0x70, 0x18, 0xc1, 0x42, 0x40,
+  0x12, 0x64, 0x42, 0x84, 0x4e, 0x34, 0x25, 0x24, 0x25, 0x02, 0x60, 0x42,
+  0x38, 0x25, 0x34, 0x31, 0x25, 0x82, 0x41, 0x71, 0x19, 0x44, 0x46, 0x19,
+  0x22, 0x01, 0x15, 0x48, 0x53, 0x48, 0x1e, 0x88, 0x41, 0xa3, 0x21, 0xc2,
+  0x84, 0x66, 0x24, 0x71, 0x28, 0xe2, 0x1a, 0x08, 0x00, 0x18, 0xa1, 0x44,
+  0x40, 0x02, 0xa4, 0x85, 0xc2, 0x88, 0x10, 0x48, 0x22, 0x01, 0x24, 0x28,
+  0x11, 0x61, 0x15, 0x48, 0x09, 0x41, 0x10, 0x13, 0x18, 0x52, 0x41, 0xa1,
+  0x2c, 0x11, 0x48, 0x94, 0x22, 0x28, 0x24, 0x41, 0x2c, 0x08, 0x8c, 0x41,
+  0x49, 0x02, 0x00, 0x40, 0x68, 0xa4, 0x12, 0x43, 0x24, 0x01, 0xa3, 0x01,
+  0xa5, 0x44, 0x18, 0x18, 0x08, 0xff, 0x7e, 0x4d, 0x41, 0x2b, 0x11, 0x42,
+  0x04, 0x28, 0x50, 0x43, 0x90, 0x52, 0x41, 0x10, 0x02, 0x11, 0x34, 0x52,
+  0xa4, 0x41, 0x10, 0xd1, 0x48, 0xc2, 0x19, 0x18, 0x40, 0x01, 0x85, 0x92,
+  0x21, 0x28, 0x46, 0xd4, 0x21, 0x32, 0x28, 0x48, 0xcd, 0x12, 0x40, 0x34,
+  0x19, 0x21, 0x12, 0x12, 0x66, 0x22, 0x01, 0x87, 0x41, 0x41, 0x88, 0x84,
+  0x00, 0x16, 0x14, 0x14, 0x68, 0x11, 0x30, 0x44, 0x42, 0x00, 0xb7, 0xf7,
+  0x10, 0x22, 0x74, 0x28, 0x45, 0x11, 0x14, 0x42, 0x24, 0x99, 0x2a, 0x10,
+  0x55, 0x81, 0x22, 0x61, 0x10, 0x48, 0x68, 0x41, 0x40, 0x44, 0x02, 0x22,
+  0x43, 0x03, 0x22, 0x48, 0x44, 0x00, 0x90, 0x11, 0x48, 0xc4, 0x81, 0x18,
+  0x21, 0x00, 0x44, 0x41, 0x23, 0x41, 0x14, 0x01, 0x44, 0x20, 0x92, 0x14,
+  0x42, 0x81, 0x10, 0x04, 0x80, 0x02, 0x12, 0x83, 0xd1, 0xf2, 0x02, 0x10,
+  0x84, 0x01, 0x10, 0x04, 0x82, 0x45, 0x01, 0x00, 0x40, 0x61, 0x84, 0x10,
+  0x04, 0x10, 0x18, 0x82, 0x11, 0x44, 0x11, 0x06, 0x00, 0x41, 0x56, 0x54,
+  0x82, 0x10, 0x14, 0x02, 0x00, 0x44, 0x41, 0x84, 0x40, 0x14, 0x58, 0x84,
+  0x20, 0x61, 0x84, 0x10, 0x68, 0x41, 0x30, 0x12, 0x2a, 0x31, 0x4d, 0x87,
+  0x21, 0x8c, 0x08, 0xc4, 0xa2, 0xdb, 0x69, 0x10, 0x02, 0x87, 0x51, 0x14,
+  0x41, 0x69, 0x52, 0x24, 0x19, 0xd1, 0xa4, 0xa2, 0x14, 0x14, 0x81, 0x21,
+  0x51, 0x99, 0x14, 0x38, 0x4e, 0x85, 0x54, 0x42, 0x24, 0x14, 0x18, 0x17,
+  0x41, 0x34, 0x40, 0x81, 0x54, 0x48, 0x54, 0x62, 0x21, 0x24, 0x43, 0x92,
+  0x48, 0x49, 0x81, 0x41, 0x24, 0x51, 0x42, 0x8c, 0x21, 0xe1, 0x24, 0x02,
+  0x15, 0x18, 0x2c, 0x31, 0x88, 0x50, 0x48, 0x4c, 0x45, 0x6e, 0x41, 0x41,
+  0x4d, 0x18, 0x18, 0x63, 0x2c, 0x94, 0x18, 0x2e, 0x88, 0xff, 0x27, 0x0f,
+  0x34, 0x16, 0x34, 0x22, 0x44, 0x00, 0x40, 0x54, 0x12, 0x00, 0x11, 0x24,
+  0x00, 0x11, 0x18, 0x12, 0x50, 0x84, 0x70, 0x24, 0x98, 0x28, 0x43, 0x42,
+  0x24, 0x02, 0x24, 0x28, 0x49, 0x71, 0x48, 0xa4, 0x12, 0x83, 0x14, 0x06,
+  0x25, 0x02, 0xc5, 0x01, 0x41, 0x44, 0x69, 0x61, 0xc1, 0x41, 0x12, 0x80,
+  0x14, 0x28, 0x01, 0x12, 0x60, 0x83, 0x42, 0x84, 0x89, 0x02, 0x44, 0x34,
+  0x3f, 0x9b, 0x02, 0x00, 0x10, 0x02, 0x00, 0x21, 0x45, 0x03, 0x10, 0x48,
+  0x08, 0x11, 0x10, 0x04, 0x81, 0x00, 0xc0, 0x18, 0x24, 0x00, 0x84, 0x84,
+  0x00, 0x00, 0x4c, 0x02, 0x26, 0x06, 0x10, 0x12, 0x42, 0x18, 0x42, 0x02,
+  0x00, 0x10, 0x13, 0x08, 0x00, 0x10, 0x88, 0x61, 0x41, 0x00, 0x00, 0x5f,
+  0x6c, 0x03, 0x11, 0x27, 0x44, 0x40, 0x02, 0x00, 0x40, 0x48, 0x04, 0x21,
+  0x10, 0x12, 0x14, 0x02, 0x44, 0x49, 0x81, 0x01, 0x00, 0x18, 0x40, 0x14,
+  0x04, 0x00, 0x00, 0x70, 0x21, 0x14, 0x08, 0x00, 0x40, 0x44, 0x08, 0x10,
+  0x94, 0x12, 0x49, 0x01, 0x40, 0x08, 0x18, 0x41, 0x10, 0x04, 0x00, 0x84,
+  0x84, 0xbf, 0x75, 0x04, 0x14, 0x10, 0x51, 0x24, 0x81, 0x40, 0x01, 0x11,
+  0x10, 0x08, 0x00, 0x40, 0x04, 0x10, 0x48, 0x08, 0x21, 0x81, 0x84, 0x40,
+  0x08, 0x21, 0x16, 0x01, 0x24, 0x00, 0x15, 0x02, 0x12, 0x00, 0x64, 0x10,
+  0x44, 0x54, 0x12, 0x20, 0x01, 0x20, 0x02, 0x28, 0x44, 0x8c, 0x61, 0x41,
+  0x00, 0x12, 0x20, 0x01, 0x6f, 0x65, 0x05, 0x00, 0x20, 0x14, 0x01, 0x81,
+  0x00, 0x10, 0x41, 0x14, 0x11, 0x14, 0x04, 0x89, 0x11, 0x02, 0x00, 0x44,
+  0x00, 0x11, 0x25, 0x42, 0x04, 0x00, 0x11, 0x11, 0x00, 0x10, 0x42, 0x07,
+  0x00, 0x00, 0x44, 0x10, 0x04, 0x44, 0x41, 0xc0, 0x18, 0x00, 0x81, 0x80,
+  0x01, 0x84, 0x00, 0x1f, 0x24, 0x0a, 0x40, 0x0c, 0x00, 0x25, 0x44, 0x18,
+  0x48, 0x02, 0x46, 0x28, 0x44, 0x04, 0x14, 0x00, 0x10, 0x04, 0x44, 0x40,
+  0x14, 0x42, 0xc4, 0x18, 0x84, 0xc0, 0x12, 0x00, 0x00, 0x25, 0x84, 0x01,
+  0x00, 0x10, 0x04, 0x84, 0x00, 0x11, 0x85, 0x02, 0x40, 0x08, 0xc0, 0x16,
+  0x10, 0x54, 0x82, 0x00, 0x40, 0x78, 0x7a, 0x0b, 0xc4, 0x10, 0x04, 0x00,
+  0x50, 0x42, 0x00, 0x24, 0x81, 0x10, 0x0a, 0x21, 0x53, 0x81, 0x01, 0x80,
+  0x11, 0x04, 0x41, 0x81, 0x82, 0x0f, 0xf0, 0x26, 0x80, 0x12, 0x01, 0x81,
+  0x10, 0x44, 0x18, 0x0a, 0x40, 0x02, 0x00, 0x50, 0x12, 0x84, 0xa1, 0x40,
+  0x44, 0x08, 0x30, 0x18, 0x84, 0xb0, 0xbf, 0x03, 0x84, 0x21, 0x29, 0x04,
+  0x82, 0x00, 0x70, 0x14, 0x18, 0x0c, 0x44, 0x00, 0x20, 0x01, 0x60, 0x11,
+  0x10, 0x21, 0x11, 0x02, 0x18, 0x00, 0x00, 0x40, 0x84, 0x01, 0x00, 0x00,
+  0x44, 0x51, 0x0a, 0xf0, 0x05, 0x44, 0x40, 0x04, 0x28, 0x20, 0x01, 0x00,
+  0x10, 0x08, 0x00, 0x5f, 0xa6, 0x03, 0x41, 0x82, 0x11, 0x61, 0x95, 0x04,
+  0x15, 0x10, 0x01, 0xf1, 0xff, 0x46, 0x09, 0xc0, 0x14, 0x50, 0x42, 0x24,
+  0xe4, 0x41, 0x12, 0x49, 0x21, 0x51, 0x84, 0x41, 0x14, 0x85, 0x54, 0x24,
+  0x8d, 0x14, 0x12, 0x40, 0x42, 0x98, 0x24, 0x00, 0x00, 0x21, 0x45, 0x41,
+  0x04, 0x00, 0x00, 0xa4, 0x40, 0x42, 0x4c, 0x08, 0x1c, 0x01, 0x16, 0x98,
+  0x44, 0x16, 0x01, 0x9f, 0x2c, 0x08, 0x84, 0xd0, 0x42, 0x04, 0x50, 0x82,
+  0x80, 0x01, 0x81, 0x11, 0x44, 0x44, 0x8d, 0x24, 0x00, 0x84, 0x00, 0x00,
+  0x10, 0x43, 0x48, 0x02, 0x88, 0x21, 0x00, 0x24, 0x40, 0x01, 0xc0, 0x18,
+  0x81, 0x49, 0x04, 0x00, 0x40, 0x04, 0x20, 0x41, 0x14, 0x84, 0x22, 0x01,
+  0x30, 0x12, 0x50, 0x12, 0x00, 0x21, 0x12, 0xcf, 0x9a, 0x05, 0x44, 0x83,
+  0x48, 0x24, 0x74, 0x82, 0x12, 0x52, 0x31, 0x27, 0x81, 0x4d, 0x16, 0x41,
+  0x94, 0x23, 0x54, 0xd5, 0x84, 0x15, 0x36, 0x14, 0x8d, 0x12, 0x50, 0xdc,
+  0x81, 0xd0, 0x42, 0x71, 0x14, 0xcb, 0x18, 0x40, 0x5c, 0x4c, 0x90, 0x11,
+  0x8c, 0x41, 0x24, 0x01, 0x4f, 0x92, 0x72, 0x24, 0x22, 0x41, 0x03, 0x15,
+  0x12, 0x56, 0x8a, 0x45, 0x12, 0x42, 0x14, 0x42, 0x02, 0x49, 0x02, 0x8c,
+  0x61, 0x41, 0x44, 0x8c, 0x71, 0x14, 0xc8, 0x11, 0x00, 0x8f, 0x91, 0x01,
+  0x4f, 0xd6, 0x03, 0x45, 0xb2, 0x84, 0x54, 0x32, 0x61, 0x40, 0x4c, 0x08,
+  0x15, 0x51, 0x48, 0x17, 0x24, 0x85, 0x08, 0x44, 0x50, 0x42, 0x47, 0x81,
+  0x49, 0x81, 0x11, 0xd4, 0x12, 0x01, 0x18, 0x10, 0x3b, 0x18, 0x25, 0x5b,
+  0x8c, 0x24, 0x45, 0x44, 0x52, 0x12, 0x47, 0x22, 0x31, 0x4c, 0x02, 0xc1,
+  0x25, 0x14, 0x44, 0x56, 0x45, 0x81, 0x54, 0x45, 0x12, 0xe4, 0x41, 0x01,
+  0x85, 0x1a, 0x21, 0x91, 0x16, 0x89, 0x31, 0x1e, 0x15, 0x02, 0x1a, 0x81,
+  0x41, 0x31, 0x18, 0x3d, 0xb7, 0x50, 0x11, 0x25, 0x16, 0x45, 0x56, 0x9d,
+  0x10, 0x5c, 0x48, 0x85, 0x58, 0x82, 0x81, 0x50, 0x28, 0xe1, 0x45, 0x81,
+  0x41, 0x55, 0x42, 0x16, 0x62, 0x81, 0x45, 0x34, 0x14, 0x85, 0x34, 0x1c,
+  0x45, 0x1e, 0x06, 0x21, 0x16, 0x14, 0x32, 0x11, 0x00, 0x44, 0x37, 0x81,
+  0x29, 0x41, 0x18, 0x54, 0x42, 0x85, 0x08, 0x44, 0x41, 0xf0, 0x11, 0x14,
+  0x81, 0x25, 0x41, 0x54, 0x8a, 0x87, 0x22, 0x85, 0x78, 0x14, 0x4a, 0xc4,
+  0x14, 0x27, 0xc1, 0x85, 0xd8, 0x8c, 0x04, 0x84, 0x17, 0x4b, 0x10, 0x01,
+  0x11, 0x21, 0x11, 0x61, 0x11, 0x61, 0x13, 0x11, 0x92, 0x41, 0x9c, 0x09,
+  0xf0, 0xff, 0x41, 0x10, 0x02, 0xa5, 0x24, 0x01, 0x50, 0x48, 0x24, 0x40,
+  0x52, 0x48, 0x24, 0x40, 0x02, 0x2c, 0x01, 0x4d, 0x12, 0x40, 0x02, 0x24,
+  0x10, 0x06, 0x21, 0x10, 0x02, 0x21, 0x84, 0x21, 0x50, 0x42, 0x10, 0x12,
+  0x51, 0x12, 0x00, 0x00, 0xcf, 0x6f, 0x45, 0x51, 0x31, 0x35, 0x53, 0x51,
+  0x35, 0x75, 0x8d, 0x5f, 0xff, 0xf5, 0x5f, 0xfe, 0x9f, 0xb1, 0x51, 0x7f,
+  0xb5, 0x53, 0xba, 0x35, 0x53, 0x72, 0x35, 0x53, 0x22, 0xd5, 0x5b, 0xaa,
+  0x35, 0x51, 0x4e, 0x55, 0xd1, 0x44, 0x51, 0x55, 0xc7, 0x61, 0x65, 0x52,
+  0xee, 0x75, 0x5f, 0x66, 0x67, 0x61, 0xef, 0xc1, 0x51, 0x26, 0x25, 0xf2,
+  0x12, 0x12, 0xaf, 0xc1, 0xf3, 0x13, 0x33, 0x29, 0x51, 0x22, 0x65, 0x56,
+  0x77, 0x25, 0x56, 0x3b, 0xe5, 0x5e, 0x66, 0x65, 0xd6, 0x77, 0xd1, 0xa8,
+  0x51, 0x22, 0x85, 0x56, 0x33, 0x2f, 0x21, 0xd1, 0x22, 0xd1, 0xa6, 0xf1,
+  0x1e, 0x1e, 0xe7, 0xe1, 0xa7, 0xa1, 0x12, 0xcf, 0x44, 0xa4, 0x11, 0x16,
+  0xf3, 0x79, 0x61, 0x50, 0x31, 0x77, 0x24, 0x35, 0xf1, 0x47, 0x46, 0xd7,
+  0xf8, 0xf5, 0x5c, 0xff, 0xf5, 0xff, 0x1f, 0x1b, 0xf5, 0x5c, 0xfb, 0xbf,
+  0x94, 0xf4, 0x23, 0x27, 0xb5, 0xd5, 0x33, 0xf2, 0x16, 0x16, 0xf5, 0xfb,
+  0x1a, 0x18, 0x75, 0x5d, 0xc6, 0x55, 0xf3, 0x16, 0x14, 0x55, 0x7d, 0x14,
+  0x5e, 0x24, 0x6f, 0x68, 0x59, 0xb5, 0x6d, 0x8e, 0x47, 0x61, 0xef, 0xa1,
+  0x51, 0x26, 0x2f, 0x31, 0xe1, 0x21, 0xf1, 0x1a, 0x3e, 0x7d, 0x3b, 0x25,
+  0xf2, 0x42, 0x42, 0x65, 0xd6, 0x75, 0x54, 0x62, 0xf5, 0x51, 0xee, 0x65,
+  0x54, 0x66, 0x7f, 0x71, 0xd1, 0xea, 0x51, 0x22, 0xaf, 0x62, 0x52, 0x93,
+  0xaf, 0xa1, 0xd1, 0x4a, 0xf1, 0x16, 0x12, 0x6f, 0x41, 0x71, 0x1e, 0x7e,
+  0x13, 0x72, 0x1a, 0xf2, 0x5e, 0x54, 0x1a, 0xf1, 0x1a, 0x12, 0x4f, 0x54,
+  0x06, 0x15, 0xd3, 0x23, 0x54, 0x33, 0x31, 0x15, 0x5f, 0xcf, 0xb5, 0xdf,
+  0x4e, 0xf1, 0x19, 0x1b, 0xb5, 0xf8, 0x4b, 0x4f, 0xa5, 0xd8, 0x33, 0x52,
+  0x56, 0x75, 0x77, 0x16, 0x74, 0x19, 0x5b, 0x42, 0x35, 0xff, 0x1e, 0x1c,
+  0x77, 0x11, 0x6d, 0x14, 0x5d, 0x19, 0xcd, 0x1e, 0x45, 0xda, 0xe6, 0x58,
+  0xf5, 0xe5, 0xf6, 0x14, 0x12, 0xef, 0xc1, 0x51, 0x24, 0x25, 0x43, 0xd2,
+  0xca, 0xf2, 0x11, 0x1f, 0x2b, 0x11, 0x2c, 0x54, 0x66, 0x55, 0x57, 0xea,
+  0xb5, 0x5d, 0x70, 0x00, 0xf0, 0x84, 0x75, 0x55, 0xe8, 0x21, 0x8d, 0x22,
+  0xbf, 0x11, 0xf1, 0x12, 0x12, 0xe5, 0x58, 0xae, 0xef, 0xc1, 0xf1, 0x1e,
+  0x1f, 0xa5, 0x28, 0xf1, 0x46, 0x44, 0x1a, 0xc1, 0x12, 0x7f, 0xc4, 0x0d,
+  0x15, 0xd3, 0x22, 0x54, 0x77, 0x67, 0x64, 0x15, 0x5f, 0xce, 0x95, 0xdf,
+  0xfe, 0xf1, 0x1d, 0x1b, 0xe5, 0xf8, 0x49, 0x4b, 0xaf, 0x94, 0xd4, 0x35,
+  0x52, 0xdb, 0x17, 0x32, 0x6f, 0x61, 0x71, 0x19, 0xfb, 0x12, 0x14, 0x5f,
+  0xf1, 0xf1, 0x16, 0x1c, 0x77, 0x51, 0x6f, 0x41, 0xf1, 0x15, 0x1d, 0x4d,
+  0x1c, 0xc5, 0xfe, 0x1e, 0x8c, 0x55, 0x7f, 0x8e, 0xfc, 0x14, 0x12, 0xef,
+  0x81, 0x51, 0x26, 0x2b, 0x11, 0x24, 0xaf, 0xc2, 0xf2, 0x37, 0x17, 0x21,
+  0x2d, 0x42, 0x65, 0x74, 0x45, 0x53, 0xea, 0x75, 0x55, 0xec, 0x61, 0x45,
+  0xf6, 0x17, 0x13, 0x85, 0x5a, 0x22, 0xcd, 0x22, 0xbf, 0x91, 0xf1, 0x18,
+  0x1a, 0xe5, 0xf4, 0x1c, 0x1a, 0xaf, 0xc1, 0x71, 0x1c, 0x7e, 0x12, 0x32,
+  0x18, 0xef, 0x44, 0xe4, 0x21, 0x81, 0xf1, 0x2b, 0x74, 0x9d, 0x04, 0xe3,
+  0x40, 0x18, 0x04, 0x40, 0x08, 0x00, 0x00, 0x10, 0x08, 0x20, 0x41, 0x04,
+  0x00, 0x81, 0x3c, 0x08, 0xf0, 0x07, 0x10, 0x04, 0x41, 0x12, 0x00, 0x40,
+  0x08, 0x12, 0x40, 0x58, 0x48, 0x12, 0x20, 0x01, 0xb0, 0xde, 0x07, 0x00,
+  0x24, 0x10, 0x44, 0x0c, 0x26, 0x00, 0xb0, 0x44, 0x12, 0x50, 0x84, 0x24,
+  0x00, 0x41, 0x81, 0x00, 0x45, 0x08, 0x4e, 0x08, 0x60, 0x4c, 0x02, 0x00,
+  0x10, 0x44, 0x08, 0xae, 0x0e, 0xf2, 0x05, 0x40, 0x58, 0x48, 0x80, 0x41,
+  0x08, 0x84, 0x00, 0xbd, 0xc2, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28, 0x1f,
+  0x41, 0x32, 0x4a, 0x04, 0x00, 0xf1, 0x3b, 0xb2, 0x4a, 0xd1, 0x41, 0xb2,
   0x4a, 0x99, 0x61, 0xab, 0x94, 0x55, 0xb8, 0x4a, 0x39, 0x24, 0xaf, 0x14,
   0x39, 0x34, 0xaf, 0x14, 0x79, 0x34, 0xd8, 0x12, 0xf9, 0x24, 0x48, 0x8d,
   0x91, 0x5f, 0xa2, 0xc4, 0x81, 0x6f, 0xa2, 0x74, 0x18, 0xf1, 0x27, 0x4a,
   0x96, 0xf1, 0x21, 0x4a, 0x96, 0xf5, 0x24, 0x4a, 0x9e, 0x24, 0x4d, 0x4a,
   0x1f, 0x49, 0xd2, 0x26, 0xf4, 0x91, 0x24, 0x85, 0xf3, 0x91, 0x24, 0xe3,
-  0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x81, 0x24, 0xaf, 0x14, 0xd1, 0x41, 0xb2,
-  0x4a, 0x99, 0x21, 0xaf, 0x14, 0x59, 0x85, 0xab, 0x94, 0x43, 0xf2, 0x4a,
-  0x94, 0x43, 0xb2, 0x42, 0x79, 0x24, 0xd8, 0x52, 0xf9, 0x24, 0x48, 0x98,
-  0x4f, 0xa2, 0xf4, 0x6f, 0xb7, 0xc0, 0x42, 0x1f, 0x81, 0x56, 0x2c, 0x1f,
-  0x41, 0x36, 0x4a, 0x1b, 0x21, 0xa3, 0x94, 0x21, 0x23, 0xd4, 0x41, 0xd2,
-  0x4a, 0x99, 0x21, 0xaf, 0x44, 0x9b, 0x25, 0xab, 0x94, 0x53, 0xf2, 0x4a,
-  0x94, 0x53, 0xb2, 0x42, 0x78, 0x21, 0x98, 0x82, 0x7f, 0x82, 0x84, 0xf9,
-  0x33, 0x48, 0x88, 0x4f, 0x82, 0xed, 0x11, 0xe8, 0x22, 0x64, 0x18, 0x1f,
-  0xa2, 0x24, 0xd9, 0xb4, 0x64, 0x49, 0x4d, 0x59, 0x1f, 0xc8, 0xd2, 0x24,
-  0xe4, 0xc9, 0xd6, 0x18, 0xe4, 0x49, 0x72, 0x4c, 0xf1, 0x91, 0x24, 0xa3,
-  0xf4, 0x81, 0x24, 0xab, 0x14, 0x1d, 0x24, 0xeb, 0x94, 0x19, 0xb2, 0x4a,
-  0x1b, 0xb5, 0x4a, 0x3b, 0x24, 0xaf, 0x44, 0x39, 0x24, 0x2f, 0x14, 0x79,
-  0x24, 0xf8, 0x42, 0x94, 0x67, 0x82, 0x2d, 0x94, 0x4f, 0x22, 0xf5, 0x2f,
-  0x29, 0x20, 0x28, 0x88, 0x04, 0x00, 0x40, 0x01, 0x00, 0x44, 0x80, 0x02,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x18, 0x80, 0x08, 0x10, 0x04, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-  0x12, 0xf0, 0x27, 0xd9, 0x00, 0x21, 0x84, 0x45, 0x11, 0x04, 0x84, 0x2d,
-  0x1e, 0x18, 0x14, 0x21, 0x25, 0x01, 0x55, 0x98, 0x18, 0x30, 0x88, 0x40,
-  0x58, 0x28, 0xd0, 0x18, 0x01, 0x87, 0x28, 0x94, 0x24, 0x00, 0x21, 0x82,
-  0x29, 0x32, 0x22, 0x44, 0x81, 0x1c, 0x21, 0x88, 0x21, 0x31, 0x1c, 0x12,
-  0x1d, 0x18, 0x21, 0x22, 0x83, 0x41, 0x48, 0x08, 0x84, 0x54, 0x23, 0x18,
-  0x14, 0x42, 0xa8, 0x12, 0x10, 0x42, 0x5c, 0x84, 0x84, 0x8f, 0xde, 0x03,
-  0x13, 0x32, 0x91, 0x96, 0x54, 0x28, 0x81, 0x17, 0x21, 0x10, 0x01, 0x10,
-  0x08, 0xa0, 0x84, 0x40, 0x0a, 0x84, 0x21, 0x00, 0x41, 0x8c, 0x21, 0x02,
-  0x81, 0x70, 0x42, 0x98, 0x24, 0x16, 0x1c, 0x04, 0x25, 0x02, 0x21, 0x16,
-  0x02, 0x28, 0x21, 0x81, 0x44, 0x85, 0x04, 0x10, 0x05, 0x80, 0x09, 0x16,
-  0x88, 0x91, 0x18, 0x51, 0x21, 0x44, 0x18, 0x1c, 0x48, 0x31, 0x84, 0xff,
-  0xe2, 0x0a, 0x22, 0xc6, 0x71, 0x84, 0x58, 0x81, 0x85, 0x64, 0x11, 0x25,
-  0x98, 0x13, 0x23, 0x11, 0x51, 0x2e, 0x20, 0x92, 0x49, 0x12, 0x81, 0x29,
-  0x18, 0x48, 0x08, 0x25, 0xc2, 0x11, 0x18, 0xb6, 0x08, 0x82, 0x24, 0x24,
-  0x22, 0x96, 0x6e, 0x42, 0x3d, 0x22, 0x64, 0x85, 0x32, 0x19, 0x88, 0x52,
-  0x1a, 0x92, 0x18, 0x8c, 0x31, 0x18, 0x25, 0x24, 0x42, 0x58, 0xc1, 0xc1,
-  0xe0, 0x8a, 0x51, 0x34, 0x89, 0x49, 0x34, 0x1a, 0x20, 0x13, 0x54, 0x22,
-  0x47, 0x88, 0xc5, 0xb1, 0x1c, 0x98, 0xf8, 0x40, 0x23, 0x81, 0x41, 0x14,
-  0x02, 0x40, 0x0c, 0x00, 0x11, 0x30, 0x84, 0x81, 0x10, 0x08, 0x21, 0x84,
-  0x50, 0x84, 0x81, 0x24, 0x85, 0x41, 0x0a, 0x8c, 0x44, 0x04, 0x00, 0x00,
-  0xc0, 0x12, 0x40, 0x42, 0x04, 0x15, 0x14, 0x08, 0x18, 0x00, 0x00, 0x00,
-  0x12, 0x50, 0x85, 0x21, 0x80, 0x11, 0x01, 0xf0, 0x59, 0x58, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x84, 0x41, 0x08, 0x00,
-  0x2c, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00, 0x44, 0x2c, 0x01, 0x00, 0x00,
-  0x00, 0x10, 0x01, 0x80, 0x08, 0x20, 0x02, 0x00, 0x00, 0x41, 0x00, 0x8f,
-  0x1e, 0x0a, 0x80, 0x42, 0xa2, 0x21, 0x84, 0x11, 0x21, 0x20, 0x21, 0x12,
-  0x52, 0x21, 0x18, 0x15, 0x82, 0x05, 0x16, 0x21, 0x12, 0x22, 0xc2, 0x11,
-  0x84, 0x11, 0x40, 0x01, 0x14, 0x48, 0x23, 0x81, 0x44, 0x01, 0x49, 0x91,
-  0x48, 0x2b, 0x21, 0x40, 0x41, 0xe2, 0x41, 0x02, 0x45, 0x01, 0x15, 0x64,
-  0x14, 0x00, 0x20, 0x14, 0x84, 0x48, 0xb4, 0x8a, 0x04, 0x18, 0x26, 0x04,
-  0x10, 0x14, 0xe4, 0xf9, 0x0f, 0x00, 0x80, 0x02, 0x24, 0x00, 0x2d, 0x18,
-  0x00, 0x10, 0x42, 0x03, 0x30, 0x11, 0x47, 0x22, 0x12, 0x84, 0x19, 0x01,
-  0x60, 0x24, 0x14, 0x41, 0x00, 0x21, 0x00, 0x60, 0x41, 0x48, 0x2d, 0x14,
-  0x24, 0x14, 0xb0, 0x16, 0x02, 0x44, 0x40, 0x64, 0x14, 0x00, 0x80, 0x08,
-  0x82, 0x43, 0xc2, 0x88, 0x00, 0x41, 0x40, 0x44, 0x04, 0xcf, 0x7c, 0x06,
-  0x20, 0x42, 0x82, 0x41, 0x48, 0x01, 0x00, 0x26, 0x02, 0x11, 0x18, 0xa0,
-  0x41, 0x00, 0x00, 0x22, 0x40, 0x18, 0x01, 0x00, 0x11, 0x42, 0x18, 0x48,
-  0x11, 0x00, 0x81, 0x28, 0x12, 0x00, 0x00, 0x14, 0x10, 0x01, 0x14, 0x00,
-  0x42, 0x41, 0x00, 0x29, 0x04, 0x18, 0x28, 0x00, 0x10, 0xb4, 0xfd, 0x0d,
-  0x00, 0x00, 0x18, 0x00, 0x40, 0x22, 0x01, 0x00, 0x00, 0x21, 0x84, 0x00,
-  0x00, 0x18, 0x10, 0x84, 0x84, 0x02, 0x00, 0x00, 0x20, 0x04, 0x44, 0x21,
-  0x00, 0x21, 0x00, 0x48, 0x00, 0x40, 0x01, 0x00, 0x00, 0x84, 0x00, 0x00,
-  0x12, 0x00, 0xaf, 0xb7, 0x41, 0x42, 0x04, 0x25, 0x42, 0x42, 0x22, 0x02,
-  0x10, 0x14, 0x08, 0x00, 0x00, 0x10, 0x54, 0x38, 0x10, 0x18, 0x01, 0x28,
-  0x10, 0x44, 0x41, 0x12, 0x14, 0x01, 0x65, 0x08, 0x22, 0x00, 0x41, 0x20,
-  0x03, 0x00, 0x10, 0x08, 0x10, 0x02, 0x11, 0x8c, 0x01, 0x81, 0xe0, 0x81,
-  0x32, 0x44, 0x44, 0x45, 0x88, 0x44, 0x08, 0x7f, 0x5b, 0x06, 0x00, 0x41,
-  0x10, 0x44, 0x28, 0x41, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x44,
-  0x10, 0x01, 0x00, 0x00, 0x40, 0x64, 0x42, 0x00, 0x40, 0x04, 0x13, 0x02,
-  0x00, 0x60, 0x92, 0x44, 0x00, 0x28, 0x22, 0x00, 0x00, 0x00, 0x10, 0x08,
-  0x80, 0x82, 0x02, 0x4f, 0x4b, 0x0d, 0x41, 0x10, 0x54, 0x22, 0x6c, 0x91,
-  0x28, 0x18, 0x44, 0x00, 0x00, 0x00, 0x24, 0x10, 0x48, 0x2a, 0x12, 0x08,
-  0x00, 0xc0, 0x44, 0x26, 0x01, 0x44, 0x51, 0x26, 0x04, 0xa0, 0x42, 0x41,
-  0x41, 0x1c, 0x02, 0x24, 0x00, 0x9c, 0x62, 0x44, 0x84, 0x80, 0x42, 0x01,
-  0x11, 0x89, 0x01, 0x10, 0x38, 0x28, 0x4d, 0x48, 0x41, 0xa0, 0x41, 0x00,
-  0xff, 0xd7, 0x02, 0x21, 0x10, 0x02, 0x00, 0x00, 0x45, 0x62, 0x81, 0x00,
-  0x00, 0x10, 0x41, 0x14, 0x01, 0x41, 0x14, 0x13, 0x81, 0x12, 0x04, 0x00,
-  0x21, 0x40, 0x52, 0x48, 0x00, 0x00, 0x61, 0xa0, 0x12, 0x00, 0x00, 0x00,
-  0x30, 0x22, 0x00, 0x00, 0x84, 0x20, 0x01, 0x50, 0x48, 0x22, 0x89, 0x02,
-  0x3f, 0xa4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x40, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00, 0x21, 0x80, 0x01, 0x88,
-  0x00, 0x00, 0x40, 0x01, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x18, 0x3f, 0x5f, 0x0b, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x01, 0x00, 0x00, 0x00, 0x11, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xf6, 0x03, 0x00, 0x16,
-  0x21, 0x02, 0x21, 0x00, 0x11, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x43,
-  0x02, 0x41, 0x20, 0x02, 0x24, 0x12, 0x00, 0x24, 0x00, 0x40, 0x02, 0x00,
-  0x00, 0x20, 0x88, 0x01, 0x18, 0x28, 0x00, 0x81, 0x00, 0x80, 0x01, 0x21,
-  0x00, 0x00, 0xcf, 0xa3, 0x0b, 0x00, 0x44, 0x00, 0x83, 0x04, 0x18, 0x24,
-  0x00, 0x8c, 0x14, 0x21, 0x14, 0x11, 0x53, 0x24, 0x11, 0x10, 0x01, 0x60,
-  0x84, 0x00, 0x81, 0x41, 0x00, 0x51, 0x84, 0x18, 0x42, 0x20, 0x24, 0x42,
-  0x82, 0x22, 0x02, 0x00, 0x42, 0x47, 0x18, 0x40, 0x81, 0x44, 0x81, 0x01,
-  0x48, 0x82, 0x90, 0x28, 0x00, 0x10, 0x08, 0xef, 0x1d, 0x05, 0x00, 0x47,
-  0x11, 0x28, 0xc0, 0x48, 0x00, 0x10, 0x02, 0x81, 0x60, 0x84, 0x15, 0x02,
-  0x00, 0x00, 0x22, 0x40, 0x08, 0x00, 0x00, 0x00, 0xa4, 0x12, 0x00, 0x90,
-  0x22, 0x80, 0x02, 0x00, 0x82, 0x42, 0x44, 0x20, 0x02, 0xc0, 0x18, 0x00,
-  0x20, 0x61, 0x22, 0x00, 0x40, 0x08, 0xdd, 0x32, 0x00, 0x00, 0x40, 0x02,
-  0x20, 0x41, 0x01, 0x80, 0x44, 0x01, 0x10, 0x41, 0x16, 0x01, 0x11, 0x44,
-  0x60, 0x44, 0x80, 0x42, 0x48, 0x94, 0x12, 0x10, 0x05, 0x20, 0x04, 0x42,
-  0x00, 0x21, 0x28, 0x00, 0x20, 0xc1, 0x81, 0x12, 0x14, 0x48, 0x14, 0x00,
-  0x48, 0x88, 0x10, 0x08, 0x00, 0x00, 0x5f, 0xab, 0x0e, 0x22, 0x00, 0x11,
-  0x40, 0x04, 0x12, 0x50, 0x81, 0x21, 0x13, 0x11, 0x48, 0x08, 0x45, 0x08,
-  0x41, 0x81, 0x11, 0x10, 0x44, 0x11, 0x04, 0x00, 0x60, 0x14, 0x41, 0x44,
-  0x48, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x50, 0x12, 0x84, 0x00, 0x18, 0x10,
-  0x02, 0x1c, 0x01, 0x18, 0x00, 0x00, 0x45, 0x48, 0x04, 0x6f, 0x79, 0x0d,
-  0x27, 0x21, 0x18, 0x24, 0x16, 0x28, 0x42, 0x02, 0x84, 0x22, 0x80, 0x51,
-  0x28, 0x88, 0x74, 0x40, 0x51, 0x86, 0x17, 0x85, 0x11, 0x2c, 0xb5, 0x2c,
-  0x01, 0x1a, 0x96, 0x41, 0x19, 0xc4, 0x2d, 0xa5, 0xd1, 0x24, 0x44, 0xc8,
-  0x19, 0xab, 0x24, 0x49, 0x61, 0x81, 0xaf, 0x22, 0x45, 0x44, 0x31, 0x36,
-  0x32, 0xa1, 0x16, 0x04, 0x4a, 0x21, 0x21, 0xd3, 0xc1, 0x41, 0xa1, 0x34,
-  0x12, 0x43, 0x01, 0x1e, 0x28, 0x45, 0x78, 0x18, 0x22, 0x62, 0x61, 0x80,
-  0x11, 0x48, 0xfc, 0xa1, 0xa3, 0x10, 0x02, 0x24, 0x81, 0x40, 0x02, 0x80,
-  0x52, 0x29, 0x00, 0x81, 0x85, 0x01, 0x11, 0x45, 0x98, 0x48, 0x81, 0x3c,
-  0x34, 0x28, 0x00, 0x41, 0x13, 0x44, 0x18, 0xc8, 0x46, 0x83, 0x34, 0x14,
-  0x26, 0x88, 0x41, 0x1c, 0x58, 0x42, 0x60, 0x42, 0x28, 0x80, 0x01, 0x11,
-  0x18, 0x1a, 0xd2, 0x84, 0x21, 0x01, 0x12, 0x12, 0x13, 0xe1, 0x81, 0x42,
-  0xc8, 0x18, 0x28, 0x18, 0x40, 0x48, 0x48, 0xfc, 0x26, 0xfe, 0x80, 0x93,
-  0x12, 0x90, 0x11, 0x28, 0x44, 0x30, 0x18, 0x00, 0x18, 0x1d, 0x1a, 0x82,
-  0x41, 0x21, 0xc4, 0x21, 0x17, 0x41, 0x14, 0x12, 0x43, 0x11, 0xe4, 0x11,
-  0x66, 0x14, 0xd0, 0x61, 0x12, 0x01, 0x14, 0x95, 0x62, 0x44, 0x49, 0x84,
-  0xbd, 0x22, 0x05, 0x34, 0x18, 0x12, 0xa1, 0x41, 0x30, 0x52, 0x84, 0x40,
-  0x11, 0xa1, 0x52, 0x21, 0x44, 0x00, 0x49, 0x01, 0x21, 0x64, 0x30, 0x14,
-  0x44, 0xf0, 0x64, 0x22, 0x14, 0x22, 0x41, 0x87, 0x41, 0x12, 0x25, 0x04,
-  0x84, 0x24, 0x81, 0x41, 0x61, 0x26, 0x28, 0x02, 0x45, 0x48, 0x44, 0x04,
-  0xc0, 0x14, 0x11, 0x16, 0x74, 0x2c, 0x21, 0x81, 0x22, 0x62, 0x84, 0x44,
-  0x00, 0x22, 0x11, 0x43, 0x04, 0x12, 0x21, 0x4a, 0x41, 0x29, 0x43, 0x04,
-  0x40, 0xc1, 0x21, 0x26, 0x18, 0x24, 0x02, 0x85, 0x91, 0x18, 0x10, 0x04,
-  0x80, 0x04, 0x20, 0x23, 0xb1, 0x54, 0x02, 0x20, 0x04, 0x22, 0x22, 0x12,
-  0x20, 0x12, 0x04, 0x47, 0x28, 0x20, 0x02, 0x12, 0x00, 0x89, 0x41, 0x01,
-  0x10, 0x02, 0x12, 0x40, 0x85, 0x21, 0x04, 0x30, 0x18, 0x91, 0x00, 0x54,
-  0x60, 0x44, 0x00, 0x48, 0x43, 0x51, 0x84, 0x00, 0x10, 0x04, 0x22, 0x52,
-  0x00, 0x12, 0x62, 0x18, 0x22, 0x10, 0x42, 0x24, 0xf1, 0xc8, 0xeb, 0x00,
-  0x00, 0x00, 0x85, 0x04, 0x44, 0x10, 0x02, 0x40, 0x18, 0x42, 0x02, 0x24,
-  0x54, 0x18, 0x81, 0x26, 0x48, 0x08, 0x83, 0x34, 0x44, 0x84, 0x00, 0x11,
-  0x84, 0x30, 0x44, 0x20, 0x04, 0x00, 0x00, 0x10, 0x88, 0x01, 0x48, 0x18,
-  0x8c, 0x33, 0x11, 0x00, 0x20, 0x01, 0x20, 0x02, 0x80, 0x04, 0x42, 0xdf,
-  0x71, 0x01, 0x40, 0x54, 0x84, 0x2a, 0xd1, 0x42, 0x92, 0x14, 0xc0, 0x24,
-  0x24, 0x45, 0x82, 0x38, 0x28, 0x85, 0x02, 0x49, 0x11, 0x42, 0xc2, 0x18,
-  0x12, 0xc4, 0x99, 0x42, 0x58, 0x94, 0x83, 0x84, 0x56, 0xc1, 0x8c, 0x64,
-  0x44, 0x11, 0x20, 0x91, 0x44, 0x42, 0x42, 0x4d, 0x11, 0x21, 0x43, 0x11,
-  0x01, 0x43, 0x34, 0x14, 0xcc, 0x41, 0x81, 0x44, 0x98, 0x38, 0x2e, 0x11,
-  0xc0, 0x49, 0x8c, 0x81, 0x81, 0x81, 0x26, 0x21, 0x04, 0x48, 0x43, 0x02,
-  0x1d, 0x91, 0x20, 0x02, 0x18, 0x00, 0x84, 0x81, 0x10, 0x0e, 0x24, 0x00,
-  0x10, 0x18, 0x44, 0x14, 0x45, 0x21, 0x01, 0x43, 0x81, 0x02, 0x44, 0x22,
-  0x12, 0x00, 0x84, 0x89, 0x42, 0x48, 0x04, 0x00, 0x10, 0xa8, 0x21, 0x40,
-  0x08, 0x60, 0x12, 0x1a, 0x02, 0x00, 0x12, 0x00, 0x44, 0x80, 0x22, 0x02,
-  0x80, 0xc1, 0x42, 0xaf, 0x1c, 0x03, 0x22, 0x42, 0x28, 0x00, 0x84, 0x22,
-  0x45, 0x38, 0x24, 0x8c, 0x32, 0x68, 0x00, 0x00, 0x40, 0x44, 0x28, 0x12,
-  0x4c, 0x94, 0x58, 0x1c, 0x52, 0x12, 0x41, 0x84, 0x83, 0x41, 0x98, 0x59,
-  0x16, 0xc8, 0x2c, 0x89, 0x14, 0x48, 0x88, 0x12, 0x81, 0x04, 0x48, 0x81,
-  0x84, 0x87, 0x14, 0x38, 0x42, 0x88, 0x89, 0x02, 0x4a, 0x11, 0x48, 0x01,
-  0x20, 0x01, 0x40, 0x04, 0x12, 0x30, 0xfb, 0x00, 0x44, 0x18, 0x85, 0xc4,
-  0x22, 0x44, 0x00, 0x24, 0x00, 0x48, 0x2c, 0x42, 0x28, 0x12, 0x88, 0x41,
-  0x04, 0x28, 0x48, 0x22, 0x18, 0x83, 0x92, 0x29, 0x00, 0x51, 0x40, 0x04,
-  0x44, 0x18, 0x40, 0x01, 0x11, 0x40, 0xc8, 0x33, 0x00, 0x46, 0x48, 0x0a,
-  0x16, 0x91, 0x28, 0x24, 0x40, 0x18, 0x9c, 0x14, 0x84, 0x41, 0x41, 0x28,
-  0x80, 0xa4, 0x12, 0x4f, 0x14, 0x04, 0x20, 0x02, 0x40, 0x08, 0x26, 0x88,
-  0x62, 0x82, 0x00, 0x2a, 0x11, 0x04, 0x10, 0x58, 0x81, 0x11, 0x22, 0x11,
-  0x81, 0x4d, 0x11, 0x28, 0x80, 0x52, 0x41, 0x40, 0x81, 0x94, 0x41, 0x12,
-  0x40, 0x04, 0x44, 0x18, 0x00, 0x20, 0x42, 0x61, 0x11, 0x18, 0x12, 0x40,
-  0x05, 0x00, 0x14, 0x10, 0x18, 0x84, 0x01, 0x12, 0x00, 0xf0, 0x9f, 0x83,
-  0x40, 0x29, 0x51, 0x48, 0x00, 0x40, 0x01, 0x90, 0x14, 0x4d, 0x11, 0x40,
-  0x88, 0x32, 0x28, 0x15, 0x04, 0x18, 0x00, 0x4a, 0x01, 0xc0, 0x44, 0x90,
-  0x12, 0x00, 0x44, 0x4c, 0x03, 0x21, 0x00, 0x10, 0x02, 0x15, 0x88, 0x01,
-  0x00, 0x99, 0x04, 0x14, 0x40, 0x15, 0x08, 0x62, 0x18, 0x41, 0x26, 0x18,
-  0x04, 0x41, 0x81, 0x40, 0xf8, 0x95, 0xc3, 0xa0, 0x68, 0x76, 0x18, 0x48,
-  0x0c, 0x00, 0x00, 0x80, 0x22, 0x02, 0x00, 0x00, 0x22, 0x11, 0x18, 0x15,
-  0x84, 0x84, 0x21, 0x02, 0x10, 0x01, 0x40, 0x98, 0x49, 0x4d, 0x29, 0x48,
-  0x00, 0x40, 0x21, 0x91, 0x51, 0x00, 0x80, 0xa2, 0x41, 0x00, 0x1c, 0x02,
-  0x85, 0x21, 0x41, 0x08, 0x4b, 0x21, 0x20, 0x8a, 0x08, 0xc0, 0x21, 0x5f,
-  0xeb, 0x06, 0x10, 0x84, 0x22, 0x32, 0x24, 0x00, 0x00, 0x10, 0x18, 0x48,
-  0x48, 0x44, 0x01, 0x12, 0x00, 0x84, 0x00, 0x94, 0x40, 0x44, 0xc4, 0x48,
-  0x40, 0x08, 0x80, 0x61, 0x91, 0x1d, 0x24, 0x48, 0x00, 0x10, 0x18, 0x33,
-  0x28, 0x28, 0x14, 0x26, 0x08, 0xa0, 0x14, 0x49, 0x85, 0x01, 0x20, 0x01,
-  0x22, 0x83, 0x01, 0x18, 0x4a, 0x11, 0xf8, 0x8f, 0xbc, 0xc0, 0x1c, 0x20,
-  0x01, 0x00, 0x10, 0x4a, 0x84, 0x82, 0x74, 0x42, 0x14, 0xc1, 0x28, 0x64,
-  0x12, 0x24, 0x00, 0x24, 0x28, 0x43, 0x02, 0x10, 0x08, 0x10, 0x24, 0xa1,
-  0x24, 0x22, 0x48, 0x14, 0x18, 0x44, 0x40, 0x02, 0x20, 0x01, 0x10, 0x42,
-  0xc1, 0xc8, 0x83, 0x7a, 0x82, 0x3c, 0x89, 0x4a, 0x42, 0x02, 0x24, 0x50,
-  0x28, 0xb0, 0x28, 0x41, 0x38, 0x88, 0xf0, 0x61, 0xba, 0x10, 0x14, 0x08,
-  0x48, 0x60, 0x43, 0x40, 0x84, 0x61, 0x41, 0x18, 0x16, 0x88, 0x81, 0x91,
-  0x18, 0x43, 0x01, 0x43, 0x81, 0x71, 0x14, 0x81, 0x01, 0x80, 0x04, 0x94,
-  0x80, 0x04, 0xe0, 0x41, 0x04, 0x28, 0x89, 0xa6, 0x21, 0x58, 0x52, 0x15,
-  0x08, 0x84, 0x13, 0xb1, 0x48, 0x02, 0x14, 0x68, 0x42, 0x00, 0x20, 0x94,
-  0x14, 0x81, 0x20, 0x22, 0x01, 0x43, 0x01, 0x42, 0xcf, 0x4d, 0x09, 0x16,
-  0x08, 0x45, 0x01, 0xc5, 0x01, 0x89, 0xa1, 0x12, 0x85, 0x01, 0x40, 0x04,
-  0x28, 0x44, 0x10, 0x48, 0x01, 0x28, 0x28, 0x14, 0x25, 0x58, 0x84, 0x19,
-  0x21, 0x81, 0x98, 0x12, 0x15, 0x54, 0x12, 0x20, 0x52, 0x14, 0x69, 0x41,
-  0x41, 0x08, 0x00, 0x00, 0x18, 0x00, 0x84, 0x18, 0x16, 0x54, 0x14, 0x4a,
-  0x12, 0x08, 0x00, 0x83, 0x41, 0x14, 0x08, 0xa5, 0x02, 0x2f, 0x4d, 0x0e,
-  0x2e, 0x14, 0x8f, 0x8a, 0x91, 0x14, 0x68, 0x4d, 0x22, 0x16, 0xa8, 0x32,
-  0x45, 0xfc, 0x24, 0x35, 0x16, 0xbc, 0x39, 0xe1, 0x82, 0x95, 0x15, 0xc0,
-  0x14, 0x65, 0xc8, 0x14, 0x47, 0x83, 0x18, 0x47, 0x43, 0x4f, 0xc2, 0xf5,
-  0x44, 0x21, 0x3e, 0x39, 0x41, 0x13, 0xc2, 0x1c, 0x18, 0xd5, 0xf4, 0x51,
-  0x54, 0x83, 0xf1, 0x14, 0x4c, 0x46, 0x98, 0x24, 0xef, 0x41, 0xe3, 0x33,
-  0x02, 0x16, 0x53, 0x89, 0x48, 0xbc, 0xf3, 0x11, 0x21, 0x4a, 0xb6, 0x28,
-  0xb6, 0x49, 0x54, 0x88, 0x36, 0xb1, 0x61, 0xe2, 0x44, 0x05, 0x22, 0x2d,
-  0x1c, 0x18, 0x26, 0x3c, 0x38, 0x4c, 0xb8, 0x18, 0x43, 0xf8, 0x48, 0x51,
-  0x8b, 0x22, 0x37, 0xfb, 0xb0, 0x14, 0xb4, 0x44, 0xa2, 0x23, 0x84, 0x26,
-  0x81, 0x12, 0x11, 0x42, 0x32, 0x24, 0xcc, 0xa4, 0x25, 0x89, 0x12, 0x78,
-  0x28, 0x58, 0x48, 0x12, 0x21, 0x10, 0x28, 0x64, 0x43, 0xf0, 0x61, 0x2c,
-  0x85, 0x15, 0x11, 0x08, 0xc5, 0xf1, 0x67, 0x6c, 0x87, 0x24, 0x41, 0x8d,
-  0x54, 0x17, 0x82, 0x1d, 0x44, 0x1c, 0x11, 0x41, 0xb1, 0x49, 0x01, 0x84,
-  0x9b, 0x12, 0x27, 0x14, 0x1e, 0x33, 0x8a, 0x9e, 0x38, 0x8f, 0x91, 0x38,
-  0x18, 0x4a, 0xd1, 0x18, 0x11, 0x54, 0xc4, 0x69, 0xd1, 0x44, 0x23, 0xf1,
-  0x24, 0x88, 0x81, 0x12, 0x18, 0xef, 0x63, 0x09, 0x19, 0xe2, 0x41, 0x54,
-  0xd8, 0xc5, 0x54, 0xc8, 0x45, 0x54, 0x88, 0x8b, 0x23, 0x85, 0x88, 0xa3,
-  0x24, 0xa1, 0xa4, 0x47, 0x81, 0x59, 0xe2, 0x11, 0x51, 0x89, 0x1d, 0x15,
-  0x2e, 0x21, 0x1d, 0x39, 0x2f, 0x11, 0x92, 0x59, 0x91, 0xa9, 0xd4, 0xa4,
-  0x72, 0x1c, 0xc1, 0x49, 0x2d, 0x51, 0x84, 0x1c, 0xe1, 0x12, 0xf3, 0x39,
-  0x64, 0x16, 0x88, 0x14, 0xa4, 0x41, 0x4a, 0x24, 0x61, 0xa1, 0x93, 0x13,
-  0x68, 0x91, 0x1f, 0x81, 0x41, 0x68, 0x14, 0x1f, 0xc4, 0x98, 0x12, 0x5d,
-  0x8b, 0x9d, 0x48, 0x1f, 0x84, 0x34, 0x18, 0x83, 0xb1, 0x18, 0x42, 0xf8,
-  0x26, 0x18, 0x44, 0x4b, 0x11, 0x8c, 0xd8, 0x82, 0xf4, 0x6d, 0xbb, 0x30,
-  0x41, 0x10, 0x21, 0x12, 0xb1, 0x22, 0x11, 0x31, 0x22, 0x13, 0x31, 0x22,
-  0x11, 0x21, 0x13, 0x11, 0x22, 0x11, 0x12, 0x91, 0x22, 0x13, 0x51, 0x42,
-  0x11, 0x4c, 0x02, 0x28, 0x24, 0x44, 0x15, 0x42, 0x44, 0x02, 0x55, 0x02,
-  0x47, 0x22, 0xc0, 0x12, 0xc0, 0x12, 0x40, 0x03, 0x2b, 0x12, 0x10, 0x22,
-  0x11, 0x22, 0x18, 0x22, 0x58, 0x12, 0x50, 0x42, 0x50, 0x42, 0x12, 0x2d,
-  0x24, 0x00, 0x82, 0x42, 0x9e, 0xc9, 0x14, 0x1f, 0x17, 0xf7, 0x21, 0x21,
-  0xd7, 0xc1, 0xc7, 0xd2, 0xc5, 0xf9, 0x1f, 0x1f, 0xaf, 0xa3, 0xf1, 0x3a,
-  0x3b, 0xef, 0x53, 0xf1, 0x37, 0x27, 0x27, 0xa2, 0xbf, 0xb1, 0xf5, 0x1b,
-  0x19, 0xaf, 0x61, 0xf1, 0x17, 0x17, 0x6d, 0x16, 0xef, 0xc1, 0xf1, 0x38,
-  0x1b, 0xaf, 0xa3, 0xf1, 0x1e, 0x3d, 0xcf, 0xc3, 0xf3, 0x2c, 0x7d, 0x5f,
-  0xc5, 0x77, 0x27, 0xff, 0x27, 0x2e, 0xa5, 0xfb, 0x5e, 0x4e, 0xd7, 0xd1,
-  0x2f, 0xd1, 0xf1, 0x52, 0x3f, 0xaf, 0xc3, 0xf3, 0x58, 0x38, 0x2f, 0xc7,
-  0xf7, 0x36, 0x3e, 0x6f, 0x47, 0xf7, 0x11, 0x12, 0x2f, 0x31, 0xf1, 0x13,
-  0x1a, 0x3f, 0x11, 0xf1, 0x39, 0x11, 0xbf, 0x31, 0x71, 0x5b, 0x7a, 0x12,
-  0xf3, 0x7b, 0x38, 0xaf, 0x2b, 0x53, 0x22, 0x3f, 0x3d, 0xbd, 0x43, 0xf1,
-  0x12, 0x12, 0xbf, 0x21, 0xf1, 0x4e, 0x42, 0xef, 0x81, 0xe1, 0x22, 0xf2,
-  0x3a, 0x3a, 0x25, 0xfa, 0x9a, 0x9c, 0xcf, 0xc8, 0xf8, 0x18, 0x18, 0xaf,
-  0xaa, 0xea, 0x97, 0x09, 0x4b, 0x77, 0x1f, 0x17, 0x72, 0x1d, 0x78, 0x2c,
-  0x7d, 0x2c, 0xfd, 0x3f, 0x1f, 0xbf, 0x93, 0xf1, 0x38, 0x19, 0xcf, 0x53,
-  0x71, 0x27, 0x57, 0xdf, 0x8f, 0x81, 0xf1, 0x18, 0x38, 0xff, 0xf1, 0xf1,
-  0x16, 0x1c, 0x5f, 0x51, 0xf1, 0x1d, 0x1f, 0xaf, 0xa1, 0xf1, 0x1a, 0x1a,
-  0xe7, 0x81, 0x6e, 0x62, 0x7d, 0x75, 0xdf, 0xd5, 0xd7, 0xd7, 0xf1, 0x2d,
-  0x2c, 0x8f, 0xa8, 0xf9, 0x5e, 0x4e, 0xdf, 0xd5, 0xfc, 0x16, 0x55, 0x2d,
-  0x76, 0xaf, 0xa1, 0xf7, 0x4f, 0x69, 0x2f, 0x47, 0xf7, 0x76, 0x56, 0xef,
-  0xe7, 0xb7, 0x53, 0xf5, 0x11, 0x19, 0x9f, 0xb1, 0xf1, 0x4a, 0x1a, 0x3f,
-  0x11, 0xf1, 0x13, 0x13, 0xaf, 0x95, 0xf3, 0x51, 0x59, 0x9f, 0x95, 0xf1,
-  0x7b, 0x7b, 0xbf, 0xd4, 0xf4, 0x59, 0x51, 0x1f, 0x97, 0xd7, 0x22, 0xb4,
-  0x1a, 0xf3, 0x5c, 0x48, 0x8f, 0xa1, 0xf1, 0x2a, 0x2e, 0xed, 0x3c, 0xcf,
-  0xc8, 0xfa, 0x98, 0xba, 0xef, 0xc8, 0x78, 0x48, 0xf8, 0xea, 0xb8, 0x4d,
-  0x3c, 0xa0, 0x47, 0x1b, 0x73, 0x4f, 0xd1, 0xf1, 0x24, 0x24, 0x55, 0xfe,
-  0x3c, 0x3c, 0x37, 0x93, 0xcf, 0xc2, 0xf3, 0x3d, 0x16, 0xcf, 0x42, 0xf2,
-  0x2b, 0x2d, 0x8f, 0x81, 0xf1, 0x18, 0x3a, 0x8d, 0x1c, 0x7f, 0x51, 0xb1,
-  0x14, 0xf1, 0x18, 0x12, 0xaf, 0x92, 0xf3, 0x35, 0x15, 0xcf, 0xf1, 0xf3,
-  0x1f, 0x3d, 0xff, 0xd7, 0xf7, 0x51, 0x71, 0x5f, 0x56, 0xf5, 0x25, 0x29,
-  0x4d, 0x8f, 0x5f, 0xd5, 0xf5, 0x16, 0x1c, 0x4f, 0x71, 0xe1, 0xd5, 0xf1,
-  0x31, 0x77, 0xaf, 0x11, 0xf7, 0x74, 0x76, 0x4f, 0xc3, 0xf3, 0x75, 0x7f,
-  0x37, 0x11, 0x1f, 0x11, 0x55, 0x99, 0x9f, 0xb1, 0xf1, 0x3b, 0x33, 0x1b,
-  0x31, 0x3f, 0x14, 0xf4, 0x11, 0x11, 0x9f, 0x37, 0xf7, 0x28, 0xa1, 0x2f,
-  0x5b, 0xf9, 0x51, 0x51, 0x1f, 0x3d, 0xfb, 0x51, 0x11, 0x3b, 0x55, 0x4b,
-  0x44, 0xc5, 0xfa, 0x36, 0x38, 0xcf, 0x83, 0xf3, 0x24, 0x3c, 0x8f, 0x49,
-  0x5b, 0xce, 0x8b, 0x98, 0x8f, 0x86, 0xd7, 0x59, 0x0a, 0x5f, 0x17, 0xb7,
-  0x35, 0xf7, 0x3c, 0x3d, 0xcf, 0xc2, 0xf2, 0x25, 0x2e, 0xdf, 0xd3, 0xf3,
-  0x3a, 0x2a, 0xef, 0xc2, 0xf3, 0x39, 0x32, 0x9f, 0x52, 0x52, 0xea, 0xad,
-  0x18, 0x9f, 0xb1, 0xd1, 0xdd, 0xf1, 0x16, 0x1e, 0x6f, 0x81, 0xb1, 0x18,
-  0xf1, 0x39, 0x3b, 0x7f, 0x53, 0x51, 0xfd, 0xf5, 0xfd, 0x6e, 0x7d, 0x9f,
-  0xa7, 0xf7, 0x65, 0x65, 0xdf, 0xf2, 0xf2, 0x1f, 0x8f, 0xdf, 0xd5, 0xf5,
-  0xdf, 0x5d, 0x4f, 0x75, 0xf5, 0x55, 0x57, 0x7f, 0x91, 0xf5, 0x3c, 0x79,
-  0x4f, 0x66, 0xf7, 0x74, 0x76, 0x7f, 0x97, 0xf7, 0x51, 0x51, 0x8f, 0x31,
-  0xf1, 0x1b, 0x1a, 0xbf, 0x81, 0xf1, 0x11, 0x32, 0x1e, 0x31, 0x3f, 0xb5,
-  0xf5, 0x12, 0x19, 0x9f, 0xa5, 0xf5, 0xa9, 0xa9, 0x3f, 0x3d, 0xfd, 0xd3,
-  0xd1, 0x1f, 0xbd, 0x7b, 0x41, 0xf9, 0x73, 0x53, 0xef, 0xc5, 0x74, 0x18,
-  0xfc, 0x28, 0x3e, 0xef, 0xe2, 0xf3, 0xbe, 0xbc, 0x8f, 0x8b, 0x5b, 0xce,
-  0x8f, 0xac, 0xfc, 0x68, 0x68, 0xaf, 0x4f, 0x09, 0x2a, 0x01, 0x40, 0x08,
-  0x10, 0x64, 0x81, 0x41, 0x00, 0x12, 0x20, 0x01, 0x84, 0x60, 0x81, 0x81,
-  0x10, 0x38, 0x11, 0x81, 0x00, 0x10, 0x88, 0x11, 0x88, 0x11, 0x08, 0x81,
-  0x2a, 0x01, 0x18, 0xc0, 0x11, 0x84, 0x18, 0x40, 0x01, 0x22, 0x00, 0x16,
-  0x08, 0x16, 0x08, 0x12, 0x44, 0xc0, 0x24, 0x12, 0x00, 0x00, 0xed, 0x9c,
-  0x70, 0x84, 0x31, 0x11, 0x40, 0x54, 0x14, 0x16, 0x78, 0x2e, 0x43, 0x64,
-  0x32, 0x17, 0xc1, 0x87, 0x24, 0x28, 0x14, 0x41, 0x25, 0x03, 0x54, 0x45,
-  0x58, 0x32, 0x47, 0x81, 0x8d, 0x31, 0x47, 0x82, 0x80, 0xc4, 0x25, 0x65,
-  0x7a, 0x48, 0x91, 0x15, 0xf0, 0x22, 0x12, 0x54, 0x40, 0x94, 0x46, 0xd0,
-  0x22, 0x04, 0x24, 0x40, 0x62, 0x81, 0x83, 0x12, 0xd1, 0x22, 0xd1, 0x81,
-  0xe2, 0x24, 0x91, 0x21, 0x30, 0x11, 0x27, 0x24, 0x8c, 0x04, 0x16, 0xd8,
-  0x2a, 0x52, 0x84, 0x81, 0x12, 0x81, 0x26, 0xf1, 0x2e, 0xb6, 0xc0, 0x42,
-  0x1f, 0x41, 0x52, 0x28, 0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0x32, 0x6a,
-  0x1d, 0x24, 0xab, 0x16, 0x1d, 0x24, 0xab, 0x94, 0x19, 0xb2, 0x4a, 0x19,
-  0xb5, 0x4a, 0x39, 0x25, 0xaf, 0x14, 0x39, 0x24, 0x2f, 0x14, 0x79, 0x24,
-  0xf8, 0x42, 0x95, 0x4f, 0x82, 0xc4, 0xb5, 0x4f, 0xa2, 0xc4, 0xa1, 0x4f,
-  0xa2, 0x64, 0x51, 0x4f, 0xa2, 0x64, 0x5d, 0x4f, 0xa2, 0x64, 0x5d, 0x4d,
-  0x4a, 0x9e, 0x24, 0xac, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24, 0x85,
-  0xf2, 0x91, 0x24, 0x83, 0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x91, 0x64, 0xab,
-  0x14, 0x1f, 0x48, 0xb6, 0x4a, 0xb9, 0x81, 0xb2, 0x4a, 0x99, 0x45, 0xab,
-  0x94, 0x43, 0xf2, 0x4a, 0x94, 0x43, 0xf3, 0x42, 0x94, 0x47, 0x82, 0x2d,
-  0x94, 0x4f, 0x8a, 0x84, 0xf9, 0x24, 0x4a, 0xff, 0xcc, 0x0b, 0x24, 0x1e,
-  0x6c, 0x85, 0xe2, 0x41, 0x36, 0x48, 0x4c, 0x32, 0x48, 0x44, 0x83, 0x44,
-  0xf4, 0x48, 0x94, 0x28, 0x8f, 0x44, 0x1a, 0xb4, 0x48, 0x3a, 0x24, 0x8b,
-  0x94, 0x43, 0xe2, 0x14, 0x68, 0x82, 0x1c, 0x59, 0x82, 0x1c, 0xd9, 0x84,
-  0xc5, 0x81, 0x2e, 0xd8, 0x1e, 0x81, 0x2e, 0x48, 0x96, 0x61, 0x82, 0x86,
-  0x45, 0x69, 0x49, 0x9c, 0xf4, 0x81, 0x2c, 0x8c, 0xf4, 0x81, 0x64, 0x81,
-  0x1f, 0x49, 0x36, 0x48, 0x17, 0x48, 0x81, 0x1f, 0x48, 0x12, 0xd8, 0x41,
-  0xf2, 0x48, 0x14, 0x19, 0xd2, 0x48, 0x13, 0xb5, 0x48, 0x3b, 0x24, 0x8b,
-  0x94, 0x22, 0x4a, 0x48, 0x88, 0xf1, 0x26, 0x48, 0x18, 0x4f, 0x82, 0xf5,
-  0x18, 0x18, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-  0x00, 0x20, 0x08, 0x21, 0x80, 0x41, 0x88, 0x08, 0x00, 0x14, 0x00, 0x00,
-  0x84, 0x21, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x18,
-  0x00, 0x10, 0x02, 0x2f, 0x4a, 0x09, 0x16, 0x04, 0xc1, 0x22, 0x90, 0x24,
-  0x84, 0x49, 0x02, 0x18, 0x90, 0x28, 0x40, 0x58, 0x18, 0x17, 0x41, 0x89,
-  0x33, 0x21, 0x12, 0x40, 0x31, 0x44, 0x60, 0x84, 0x44, 0x44, 0x46, 0xd5,
-  0xc1, 0x41, 0xc4, 0x18, 0x4f, 0x32, 0x11, 0x44, 0x08, 0x49, 0x23, 0x44,
-  0x22, 0x22, 0x43, 0xa8, 0x21, 0x22, 0x00, 0x22, 0x99, 0x14, 0x02, 0x18,
-  0x82, 0x48, 0x43, 0xc1, 0x54, 0x12, 0x21, 0x92, 0x30, 0x1c, 0xe0, 0xa3,
-  0x02, 0x1c, 0x32, 0xb2, 0x30, 0x1e, 0x16, 0x48, 0xe8, 0x41, 0x82, 0x94,
-  0x18, 0xb0, 0x18, 0x12, 0x42, 0x08, 0x16, 0x04, 0xc0, 0x18, 0x41, 0x4f,
-  0x8a, 0x05, 0x89, 0x48, 0x38, 0x81, 0xa4, 0x13, 0x14, 0x18, 0xd2, 0x21,
-  0x34, 0x44, 0x10, 0x88, 0xa2, 0x14, 0x14, 0x44, 0x14, 0x40, 0x11, 0x02,
-  0x16, 0xc4, 0x41, 0x85, 0xc4, 0x89, 0x22, 0x86, 0x63, 0x84, 0x1c, 0xc4,
-  0x4d, 0x80, 0x24, 0x92, 0x48, 0x84, 0x81, 0x16, 0x64, 0x1a, 0x46, 0xf4,
-  0x97, 0x61, 0x20, 0xa1, 0x34, 0xa4, 0x22, 0x84, 0x89, 0x92, 0x24, 0x26,
-  0x24, 0x01, 0xc7, 0x23, 0x83, 0x62, 0x82, 0x81, 0x5d, 0x18, 0x4c, 0xa1,
-  0x21, 0x89, 0x11, 0xf4, 0xa4, 0x58, 0x15, 0x52, 0x48, 0x84, 0x8b, 0xc1,
-  0x85, 0xb4, 0x86, 0xc4, 0x4a, 0x43, 0x31, 0x45, 0x23, 0xd5, 0x14, 0x11,
-  0x69, 0x82, 0x42, 0x8d, 0x15, 0x4c, 0x64, 0x34, 0x90, 0x21, 0x21, 0x28,
-  0x43, 0x02, 0xc0, 0xa1, 0x4f, 0x14, 0x02, 0x26, 0x48, 0xc1, 0xc8, 0x42,
-  0x49, 0xa5, 0x52, 0x1e, 0x4a, 0x40, 0x32, 0x14, 0xaa, 0x31, 0x14, 0x5f,
-  0x1e, 0x08, 0x47, 0x32, 0x10, 0x64, 0xc1, 0x18, 0x44, 0x89, 0x81, 0x14,
-  0x28, 0x01, 0x00, 0x00, 0x11, 0x81, 0x13, 0x82, 0x01, 0xa0, 0x48, 0x10,
-  0x01, 0x11, 0x54, 0x15, 0x08, 0x45, 0x88, 0x12, 0x06, 0x18, 0x28, 0x00,
-  0x22, 0x12, 0x81, 0x12, 0x18, 0x19, 0x14, 0x4c, 0x58, 0x28, 0x13, 0x38,
-  0x42, 0x1a, 0x44, 0x05, 0x10, 0x04, 0x84, 0x89, 0x09, 0x85, 0x84, 0xf4,
-  0x34, 0x6c, 0x30, 0x24, 0x28, 0xa0, 0x21, 0x22, 0x84, 0x81, 0x44, 0x24,
-  0x00, 0x1a, 0x14, 0x82, 0x94, 0x12, 0x1e, 0x48, 0x10, 0x41, 0x03, 0x20,
-  0x41, 0x04, 0x85, 0x34, 0x21, 0x1c, 0x02, 0xd0, 0x24, 0x84, 0xd2, 0x22,
-  0x04, 0x41, 0x4c, 0x12, 0x04, 0x29, 0x41, 0x34, 0x22, 0x13, 0x21, 0x42,
-  0x2c, 0x14, 0x01, 0x9a, 0x14, 0x12, 0x41, 0x14, 0x04, 0x12, 0x25, 0x24,
-  0x08, 0x82, 0x18, 0xe0, 0x34, 0x48, 0x11, 0x42, 0xe4, 0x22, 0x51, 0x38,
-  0x45, 0xf8, 0x62, 0x13, 0x2c, 0xd1, 0x28, 0x33, 0x21, 0x2e, 0x1a, 0x83,
-  0x42, 0x01, 0x27, 0x11, 0xc1, 0x25, 0x42, 0xc5, 0x5a, 0x28, 0x8f, 0x33,
-  0x64, 0x42, 0xcc, 0xb2, 0x48, 0x82, 0x54, 0x22, 0x2c, 0x44, 0xd8, 0x43,
-  0x71, 0x2e, 0x02, 0x41, 0x18, 0x45, 0xaa, 0x21, 0x27, 0x31, 0x24, 0x40,
-  0x18, 0x4a, 0x74, 0x4a, 0x92, 0x14, 0x26, 0x63, 0x82, 0x8d, 0xd2, 0x1a,
-  0x78, 0x21, 0x08, 0x8e, 0x54, 0x1d, 0x9a, 0xac, 0x65, 0x46, 0x89, 0xc2,
-  0x48, 0x8d, 0x14, 0xc1, 0x81, 0xc9, 0xc2, 0x24, 0x8f, 0x81, 0x06, 0x60,
-  0x42, 0x2c, 0x32, 0x21, 0x81, 0x91, 0x84, 0x43, 0x71, 0x22, 0x91, 0x32,
-  0x25, 0x38, 0x51, 0x21, 0x11, 0x12, 0x23, 0x55, 0x43, 0x46, 0x41, 0xc1,
-  0x11, 0x21, 0x41, 0x48, 0x2c, 0x44, 0x64, 0x34, 0x26, 0xd2, 0x14, 0x81,
-  0x52, 0x24, 0x4c, 0x72, 0x52, 0x52, 0x48, 0x6d, 0x22, 0x43, 0x12, 0x02,
-  0x23, 0x11, 0x58, 0x24, 0x58, 0x21, 0x24, 0x00, 0x21, 0x1f, 0x8e, 0x11,
-  0xa2, 0x48, 0x17, 0x21, 0x84, 0x23, 0x22, 0xd3, 0x82, 0xd4, 0x84, 0x18,
-  0x08, 0x16, 0x4c, 0xf2, 0xef, 0xa9, 0xd0, 0x42, 0x02, 0x18, 0x8d, 0x12,
-  0x43, 0xf2, 0x62, 0x12, 0x12, 0x2d, 0x28, 0x40, 0x88, 0x02, 0x90, 0x52,
-  0xe1, 0x81, 0x60, 0xa1, 0x28, 0x27, 0x86, 0x49, 0xc2, 0x38, 0xc3, 0x02,
-  0x81, 0x23, 0x52, 0x81, 0x50, 0x4a, 0x23, 0x04, 0x00, 0x18, 0x13, 0x41,
-  0x14, 0x42, 0x4a, 0x86, 0x52, 0x18, 0x1e, 0x24, 0x1d, 0x2c, 0x8b, 0x42,
-  0x1f, 0x89, 0x84, 0x09, 0x30, 0x15, 0x47, 0x88, 0x56, 0x64, 0x44, 0x84,
-  0x41, 0x12, 0x41, 0x8c, 0x28, 0x92, 0x24, 0xad, 0x1b, 0x24, 0x47, 0xa4,
-  0x42, 0x81, 0x90, 0x48, 0x18, 0x18, 0x81, 0x41, 0x22, 0x41, 0x11, 0x26,
-  0x22, 0x04, 0x80, 0x01, 0x41, 0x50, 0x28, 0xa0, 0x12, 0x26, 0x26, 0x41,
-  0x04, 0x22, 0x91, 0x80, 0x52, 0x48, 0x2a, 0x84, 0x32, 0x18, 0x20, 0x44,
-  0xc4, 0x11, 0x41, 0x21, 0x84, 0x81, 0x4c, 0x08, 0x47, 0x11, 0x8c, 0x21,
-  0x1a, 0xb6, 0x18, 0x24, 0x32, 0x84, 0x22, 0x12, 0x84, 0x80, 0x22, 0x44,
-  0xb2, 0x25, 0x01, 0x18, 0x52, 0x32, 0x21, 0x00, 0x48, 0x40, 0x48, 0x54,
-  0x86, 0x20, 0x02, 0x34, 0x41, 0x46, 0xd8, 0xa1, 0x04, 0x64, 0x4d, 0x42,
-  0x41, 0x20, 0x11, 0xe4, 0x14, 0x62, 0x81, 0x29, 0x84, 0x61, 0x44, 0x5c,
-  0xb1, 0x11, 0x22, 0x91, 0x18, 0x81, 0x42, 0x42, 0x14, 0x00, 0x83, 0x82,
-  0x08, 0x20, 0x54, 0x84, 0x20, 0x82, 0x01, 0x27, 0x24, 0x81, 0x20, 0x82,
-  0x62, 0x82, 0x6c, 0x21, 0xa1, 0xc1, 0xdf, 0x81, 0x0b, 0x28, 0x50, 0x41,
-  0x4b, 0x21, 0x70, 0x29, 0x54, 0x68, 0x1a, 0xb2, 0x12, 0x06, 0x00, 0x21,
-  0x14, 0xc3, 0x41, 0x02, 0x12, 0x18, 0x83, 0x22, 0x12, 0x48, 0x21, 0x84,
-  0x02, 0x22, 0xe4, 0x44, 0x81, 0x00, 0x61, 0x25, 0x04, 0x2d, 0x12, 0x41,
-  0x24, 0x80, 0x02, 0x44, 0x22, 0x42, 0x80, 0x28, 0x84, 0x81, 0x04, 0x81,
-  0x12, 0x64, 0x84, 0x12, 0x41, 0x40, 0x2c, 0xf2, 0x9b, 0xf5, 0x70, 0x42,
-  0x34, 0x12, 0x2e, 0x12, 0x43, 0x22, 0x34, 0x34, 0x81, 0xa3, 0x31, 0x34,
-  0x43, 0x02, 0x10, 0x12, 0x51, 0x2c, 0xf0, 0x12, 0x48, 0x48, 0x43, 0x31,
-  0x28, 0x2f, 0xc2, 0x54, 0x48, 0x60, 0x62, 0x26, 0x14, 0x64, 0x21, 0xcc,
-  0x92, 0x16, 0x42, 0x5c, 0xc1, 0x34, 0x6b, 0x41, 0xa1, 0x2c, 0xa1, 0x41,
-  0x25, 0x44, 0x14, 0x41, 0x94, 0x28, 0xc1, 0x28, 0x8e, 0x44, 0x90, 0x91,
-  0x83, 0x81, 0x89, 0x65, 0xa4, 0x83, 0x62, 0xc9, 0x28, 0x23, 0xe3, 0x81,
-  0x02, 0x4c, 0xb3, 0x48, 0xa1, 0x4a, 0x6f, 0xf4, 0x02, 0x2a, 0x01, 0xc5,
-  0x21, 0x11, 0x58, 0x81, 0x4b, 0x14, 0x28, 0xa3, 0x04, 0xa1, 0x11, 0x24,
-  0x48, 0x1c, 0x11, 0x04, 0x17, 0x81, 0x21, 0x41, 0x00, 0x1c, 0x83, 0x04,
-  0x1b, 0x42, 0x89, 0x82, 0x54, 0x18, 0x45, 0x88, 0x42, 0x88, 0xb2, 0x24,
-  0x01, 0x00, 0x34, 0x12, 0x26, 0x02, 0x88, 0x84, 0x80, 0x14, 0x88, 0x44,
-  0x12, 0x84, 0x81, 0x14, 0x12, 0x14, 0x08, 0x8d, 0x24, 0x40, 0x44, 0x62,
-  0xf7, 0x10, 0x24, 0x22, 0x82, 0x04, 0x76, 0x82, 0x22, 0x44, 0x38, 0x22,
-  0x58, 0x62, 0x41, 0x20, 0x04, 0x00, 0x24, 0x72, 0x40, 0x81, 0x82, 0x84,
-  0x82, 0x07, 0x00, 0x44, 0x24, 0x12, 0x00, 0x16, 0x04, 0x45, 0x02, 0x10,
-  0x0a, 0x00, 0x11, 0x84, 0x46, 0xc8, 0x48, 0x8e, 0x14, 0x81, 0x14, 0x81,
-  0x50, 0x48, 0x12, 0x84, 0xc2, 0x2a, 0xa4, 0x18, 0x42, 0xbb, 0x5d, 0x00,
-  0x89, 0x21, 0x01, 0x44, 0x00, 0x18, 0x00, 0x00, 0x42, 0x21, 0x2e, 0x12,
-  0x00, 0x80, 0x14, 0x08, 0x22, 0xa4, 0x4c, 0x52, 0x84, 0x40, 0x08, 0x28,
-  0x12, 0x40, 0x22, 0x91, 0x11, 0x10, 0x01, 0x20, 0x64, 0x15, 0x44, 0x60,
-  0x81, 0x12, 0x41, 0x82, 0x40, 0x1a, 0x24, 0x0c, 0x2c, 0x01, 0x88, 0x00,
-  0x18, 0x24, 0xf0, 0x7f, 0x2e, 0x20, 0x34, 0x44, 0xa0, 0x42, 0x84, 0x10,
-  0x88, 0x91, 0x12, 0x24, 0x00, 0x44, 0x21, 0x29, 0x62, 0x32, 0x12, 0x27,
-  0x22, 0x16, 0x42, 0x21, 0x42, 0x08, 0xa4, 0x24, 0xa4, 0x42, 0x46, 0x68,
-  0x21, 0xec, 0xd4, 0xa4, 0x01, 0x60, 0x84, 0xc0, 0x42, 0x46, 0x02, 0x32,
-  0x18, 0x18, 0x84, 0x20, 0x04, 0x18, 0x90, 0x24, 0x30, 0x28, 0x4c, 0x18,
-  0x0c, 0x21, 0x10, 0x04, 0x40, 0xb4, 0x88, 0x04, 0x00, 0x24, 0x80, 0x14,
-  0x88, 0x96, 0x28, 0x42, 0x40, 0x08, 0x29, 0x01, 0x00, 0x2a, 0x04, 0x60,
-  0x24, 0x8c, 0x81, 0x41, 0x08, 0x45, 0x18, 0x41, 0x68, 0x32, 0x15, 0xa8,
-  0x21, 0xc0, 0x48, 0x45, 0x4a, 0x12, 0x58, 0x82, 0x28, 0x44, 0x61, 0x00,
-  0x42, 0x89, 0x12, 0x98, 0x18, 0x90, 0x18, 0xc0, 0x22, 0x18, 0x48, 0x4a,
-  0x18, 0x3a, 0x44, 0x43, 0x82, 0x84, 0x81, 0x04, 0x6f, 0x97, 0x08, 0x27,
-  0x18, 0x12, 0x00, 0x21, 0x20, 0x04, 0x29, 0x44, 0x88, 0x01, 0x83, 0x04,
-  0x42, 0x28, 0x80, 0x81, 0x21, 0x22, 0x11, 0x28, 0x74, 0x22, 0x01, 0x24,
-  0x14, 0x00, 0x94, 0x18, 0x00, 0x80, 0x51, 0x24, 0xc1, 0x20, 0x14, 0x24,
-  0x24, 0xa1, 0x42, 0x20, 0x24, 0x08, 0x10, 0x14, 0x84, 0x11, 0xc8, 0x14,
-  0x10, 0x08, 0x84, 0x82, 0x14, 0xb7, 0xb8, 0xe0, 0x81, 0x22, 0x62, 0x21,
-  0x20, 0x92, 0x24, 0x12, 0x21, 0x22, 0x2d, 0x12, 0x22, 0x83, 0x04, 0x8c,
-  0x02, 0x12, 0x21, 0x80, 0x24, 0x11, 0x84, 0x92, 0x22, 0x84, 0x38, 0x28,
-  0x24, 0x28, 0x19, 0x84, 0x22, 0x72, 0x14, 0x92, 0x44, 0x41, 0x41, 0x28,
-  0x80, 0x02, 0x30, 0x18, 0x28, 0x40, 0x08, 0x11, 0x46, 0x14, 0x81, 0x21,
-  0x44, 0x88, 0x21, 0xb4, 0x52, 0x88, 0x62, 0x82, 0x28, 0x2a, 0xa1, 0x42,
-  0x3e, 0x7e, 0x00, 0x00, 0x40, 0x26, 0x04, 0x48, 0x00, 0x30, 0x12, 0x22,
-  0x80, 0x11, 0x82, 0x21, 0xd2, 0x82, 0x42, 0x04, 0x00, 0x24, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x58, 0xc0, 0x18, 0x40, 0x01, 0x21, 0x40, 0x21, 0x61,
-  0x41, 0x00, 0x40, 0xc2, 0x28, 0x00, 0x00, 0x80, 0x04, 0x88, 0x00, 0xd7,
-  0x51, 0x80, 0x04, 0x48, 0xd0, 0x22, 0x06, 0x2c, 0xc1, 0x28, 0x2a, 0x01,
-  0x2a, 0x14, 0x08, 0x10, 0x22, 0x61, 0x26, 0x1c, 0x81, 0x02, 0x28, 0x48,
-  0x12, 0x5c, 0x44, 0x42, 0x09, 0xa9, 0x64, 0x25, 0x14, 0x4a, 0x92, 0x48,
-  0x83, 0x54, 0x82, 0x80, 0x91, 0x28, 0x28, 0x12, 0x42, 0x60, 0x85, 0x20,
-  0x24, 0xd1, 0x84, 0x04, 0x00, 0x18, 0x4b, 0x41, 0x41, 0x1a, 0x44, 0x94,
-  0x44, 0x20, 0x24, 0xc2, 0x14, 0x4f, 0x63, 0x4a, 0x71, 0x33, 0x28, 0x84,
-  0x94, 0x21, 0x50, 0x28, 0x81, 0x40, 0xa8, 0x21, 0x81, 0x2f, 0x61, 0x22,
-  0xa1, 0x21, 0x00, 0x00, 0x40, 0x58, 0x28, 0x18, 0x21, 0x12, 0x19, 0x01,
-  0xa8, 0x15, 0x42, 0x68, 0x24, 0x95, 0x14, 0xc4, 0x11, 0x41, 0x25, 0x52,
-  0x84, 0xc0, 0x42, 0x22, 0x85, 0x54, 0xe2, 0x22, 0x40, 0x44, 0x84, 0xc1,
-  0x14, 0x8b, 0x14, 0x2c, 0xf3, 0x28, 0x84, 0x80, 0x04, 0x84, 0x40, 0x0c,
-  0x21, 0xd0, 0x23, 0x4a, 0x92, 0x44, 0x9a, 0x26, 0xd1, 0x22, 0xe6, 0xa4,
-  0xc2, 0x58, 0xa3, 0xa6, 0x65, 0x89, 0x92, 0x3a, 0x8c, 0x86, 0x17, 0x44,
-  0xb2, 0x22, 0x21, 0x92, 0x42, 0x38, 0x23, 0xf7, 0x44, 0x52, 0x8b, 0x31,
-  0x9d, 0x28, 0xf0, 0x69, 0x46, 0x61, 0x9b, 0x12, 0xe0, 0xa6, 0xd6, 0x3a,
-  0xf4, 0x79, 0x12, 0x85, 0x8e, 0xf5, 0x12, 0x44, 0x87, 0x94, 0xc4, 0x64,
-  0x29, 0x92, 0x22, 0x4a, 0xf7, 0x52, 0x14, 0x4d, 0x14, 0x9b, 0x25, 0x42,
-  0x4a, 0x45, 0xf4, 0x18, 0x58, 0x52, 0x1f, 0xe1, 0x72, 0x1c, 0x64, 0x1e,
-  0x18, 0xc7, 0xc1, 0x27, 0xa4, 0xda, 0xf9, 0x6c, 0x24, 0xc7, 0x84, 0x8c,
-  0xe9, 0x1a, 0x29, 0xf5, 0x65, 0x57, 0xa0, 0x23, 0x2a, 0x81, 0x21, 0x94,
-  0x46, 0x4e, 0x24, 0x1e, 0x3a, 0x2d, 0x18, 0x2b, 0x54, 0xe0, 0x24, 0x51,
-  0x8a, 0x5e, 0x12, 0x81, 0x1a, 0xc2, 0x11, 0x2e, 0x22, 0x36, 0xc2, 0x42,
-  0x87, 0x81, 0x26, 0x28, 0xf1, 0x28, 0x48, 0x4d, 0x21, 0x87, 0x92, 0x27,
-  0x14, 0xb4, 0x31, 0x1f, 0x83, 0xd1, 0x94, 0xb4, 0x66, 0x73, 0x4e, 0x54,
-  0xac, 0x6c, 0xe1, 0x21, 0xb1, 0x16, 0xc3, 0x48, 0x26, 0x62, 0x21, 0xc1,
-  0x87, 0x85, 0x2f, 0x82, 0xb1, 0x38, 0x52, 0x48, 0xc3, 0x11, 0x54, 0x88,
-  0xcb, 0x14, 0x21, 0xed, 0xa8, 0x88, 0x18, 0xcb, 0x11, 0xcd, 0x44, 0xe0,
-  0x42, 0x24, 0x85, 0xd4, 0x22, 0x74, 0xb2, 0x0c, 0x3f, 0x14, 0x71, 0x44,
-  0x68, 0x22, 0x13, 0x62, 0x42, 0xa7, 0x22, 0x48, 0x87, 0x22, 0x36, 0x6a,
-  0x23, 0xa3, 0x63, 0x27, 0xaf, 0x42, 0x34, 0x12, 0x4e, 0x42, 0x2f, 0x21,
-  0xa2, 0x15, 0x31, 0x8c, 0xf3, 0x22, 0x21, 0x45, 0xa2, 0x52, 0x2c, 0x73,
-  0x12, 0xc8, 0x26, 0xac, 0x92, 0x6a, 0x85, 0xa1, 0x24, 0x2d, 0x24, 0x16,
-  0x61, 0xa1, 0x4a, 0xb1, 0x16, 0x14, 0x66, 0x14, 0xc7, 0x62, 0x15, 0x34,
-  0x26, 0xbc, 0x04, 0x48, 0x8c, 0x71, 0x14, 0xe9, 0x84, 0xb1, 0xc1, 0x88,
-  0x25, 0xc8, 0x1a, 0x1e, 0x54, 0xcf, 0xc5, 0xe4, 0x2c, 0xc4, 0x44, 0x21,
-  0x8c, 0x24, 0xa8, 0x62, 0x1a, 0x72, 0x24, 0xf4, 0xf2, 0xb4, 0x14, 0x80,
-  0x01, 0x25, 0x41, 0x18, 0x44, 0x28, 0x22, 0x01, 0x00, 0x00, 0xc0, 0x21,
-  0xc0, 0x21, 0xc0, 0x21, 0xc0, 0x21, 0x20, 0x14, 0x01, 0x11, 0x4a, 0x02,
-  0x42, 0x19, 0x21, 0x04, 0x42, 0x10, 0x11, 0x14, 0x21, 0x92, 0x41, 0x45,
-  0x92, 0x41, 0x22, 0x1d, 0x48, 0xb0, 0x11, 0x04, 0x13, 0x41, 0x84, 0x44,
-  0x84, 0x44, 0x84, 0x44, 0x04, 0x8b, 0x24, 0x40, 0xf4, 0x84, 0x94, 0x34,
-  0x5f, 0x57, 0xf6, 0x34, 0x24, 0x28, 0x1f, 0x32, 0xf2, 0x29, 0x61, 0xef,
-  0x23, 0xf2, 0x1a, 0x68, 0x8b, 0x11, 0x8f, 0x87, 0xa5, 0x22, 0xaf, 0x23,
-  0xe3, 0x22, 0xa2, 0x55, 0xa5, 0xb8, 0x42, 0x85, 0xf2, 0x51, 0x51, 0x1f,
-  0x21, 0xb3, 0x53, 0xb1, 0x32, 0xf1, 0x17, 0x1d, 0x1f, 0x84, 0xd5, 0x81,
-  0x71, 0x14, 0x5e, 0x87, 0x26, 0xa8, 0x22, 0xb4, 0x1f, 0xb2, 0xf5, 0x34,
-  0x7e, 0x7f, 0xc2, 0x56, 0xc4, 0x1e, 0x56, 0x8f, 0xc1, 0x54, 0x16, 0x25,
-  0x57, 0x31, 0xe0, 0x31, 0xd3, 0x32, 0xf1, 0x1f, 0x1b, 0x8b, 0x31, 0x8d,
-  0x11, 0x4f, 0x51, 0xd1, 0x55, 0xb1, 0xd8, 0xfd, 0x81, 0x81, 0x1f, 0x3c,
-  0xfd, 0x11, 0x1c, 0x4f, 0x18, 0xe9, 0xc4, 0x31, 0x4c, 0xef, 0x44, 0xf1,
-  0x96, 0x98, 0x4b, 0x26, 0x4f, 0x44, 0xa4, 0x64, 0x4a, 0xb4, 0x72, 0xf4,
-  0xf6, 0x72, 0x14, 0x4f, 0x54, 0xf4, 0x14, 0x64, 0x1e, 0x22, 0x3f, 0x12,
-  0xf2, 0x61, 0x63, 0x2f, 0x24, 0xf2, 0x4a, 0x42, 0xaf, 0x27, 0xf2, 0x7a,
-  0x78, 0x8f, 0xa2, 0xf2, 0x72, 0x56, 0x2f, 0x26, 0xf7, 0x5a, 0x7e, 0xa5,
-  0xba, 0x42, 0x75, 0x33, 0xf3, 0x73, 0x51, 0x1f, 0x22, 0xb3, 0x51, 0xf5,
-  0x3f, 0x5d, 0x7f, 0xd1, 0xf3, 0x53, 0x78, 0x1f, 0x84, 0xf5, 0x14, 0x1e,
-  0x65, 0xfc, 0xa1, 0x8a, 0xaf, 0xa6, 0xf6, 0x2b, 0x88, 0x97, 0xb2, 0x8f,
-  0xe3, 0xd4, 0xa6, 0x55, 0xd5, 0xcf, 0xa1, 0xf1, 0x1c, 0x5b, 0x6d, 0x1b,
-  0x25, 0xf3, 0x27, 0x67, 0x7d, 0x25, 0x6d, 0x27, 0xa5, 0xff, 0x5b, 0x5f,
-  0x17, 0x11, 0x8f, 0x17, 0xf7, 0x1c, 0x1d, 0xdf, 0xd4, 0xf5, 0xc9, 0x9d,
-  0x8f, 0x88, 0xe8, 0x8c, 0xfe, 0x17, 0x1e, 0xef, 0x5d, 0xe9, 0x8d, 0xf9,
-  0xdc, 0x94, 0xef, 0x41, 0xf1, 0xd2, 0x9c, 0x46, 0x74, 0x44, 0xb6, 0xfa,
-  0xac, 0xcf, 0x6f, 0x47, 0xf7, 0x6e, 0x75, 0x34, 0x7e, 0x65, 0x3e, 0x74,
-  0x2e, 0x32, 0x2f, 0x22, 0xd2, 0xf9, 0x74, 0x1e, 0xfe, 0x1a, 0x68, 0x8f,
-  0x83, 0xf3, 0x78, 0x78, 0x2a, 0xf3, 0x78, 0x7e, 0x6e, 0x22, 0x2b, 0x75,
-  0x85, 0xba, 0x52, 0xf5, 0x31, 0x31, 0x7a, 0xc5, 0x23, 0xaf, 0xa4, 0xf2,
-  0x23, 0x23, 0x6f, 0xc1, 0xf1, 0x42, 0x79, 0x9c, 0xf1, 0x44, 0x7f, 0x75,
-  0xcd, 0x89, 0x95, 0xf9, 0x61, 0x4b, 0x2e, 0x43, 0xcf, 0xf3, 0xf6, 0x27,
-  0x7f, 0x6f, 0xb4, 0xf4, 0x16, 0x5e, 0x6f, 0xa1, 0xe5, 0xc1, 0xf1, 0x31,
-  0x36, 0x6f, 0x42, 0x76, 0x25, 0xf7, 0x34, 0x36, 0xbf, 0x65, 0x55, 0x64,
-  0xbf, 0x14, 0xb6, 0x38, 0xf3, 0x59, 0x54, 0xcb, 0x11, 0x9f, 0x5d, 0x5d,
-  0x88, 0x8b, 0x75, 0xdf, 0xc1, 0xf1, 0x94, 0xdd, 0xcf, 0x85, 0xf1, 0x58,
-  0x16, 0xeb, 0x14, 0xef, 0xc9, 0xfd, 0xec, 0xac, 0x8f, 0xcc, 0xfc, 0x7a,
-  0x78, 0xea, 0xfc, 0x64, 0x56, 0xcf, 0x46, 0x4c, 0xf1, 0x61, 0x65, 0x1e,
-  0x24, 0x3e, 0x22, 0x2b, 0x22, 0x5f, 0x74, 0xf4, 0x56, 0x16, 0xaf, 0x25,
-  0xf5, 0x78, 0x32, 0xaf, 0x87, 0xa7, 0x33, 0x7e, 0x72, 0x7e, 0x32, 0xef,
-  0xa5, 0x55, 0xaa, 0x2b, 0x55, 0x3a, 0xf1, 0x71, 0x51, 0x2e, 0x23, 0xaf,
-  0x86, 0xf6, 0x2e, 0x7c, 0x7d, 0x35, 0x5e, 0x79, 0x4e, 0x51, 0x5f, 0xf4,
-  0xd7, 0x55, 0xd2, 0xb1, 0xf8, 0x4b, 0x49, 0xbf, 0xbe, 0x74, 0x69, 0xfa,
-  0x7d, 0x4f, 0x7f, 0x72, 0xe7, 0xd4, 0xf4, 0x5c, 0x1e, 0x9f, 0xe5, 0xf5,
-  0x12, 0x14, 0x3f, 0x21, 0xf1, 0x27, 0x27, 0x6d, 0x26, 0x6d, 0x26, 0xbf,
-  0x64, 0xf4, 0x49, 0x4f, 0xab, 0x44, 0x8b, 0x77, 0xdf, 0xc5, 0xf5, 0x45,
-  0x55, 0x8f, 0x8c, 0xf9, 0x48, 0x48, 0x9f, 0xb4, 0xf4, 0x1b, 0x1e, 0xef,
-  0x9d, 0xfd, 0xdc, 0x9c, 0x8b, 0xdd, 0x2d, 0x54, 0xef, 0xcd, 0xfd, 0xec,
-  0xac, 0x4f, 0x8e, 0xfe, 0x7a, 0x58, 0xbe, 0x82, 0x4f, 0x66, 0xb7, 0xa3,
-  0x06, 0x43, 0x02, 0x22, 0x20, 0x02, 0x22, 0x00, 0x40, 0x62, 0x81, 0x60,
-  0x81, 0x00, 0x28, 0x12, 0x8d, 0x22, 0x12, 0x28, 0x12, 0x00, 0x00, 0x83,
-  0x04, 0x80, 0xa1, 0x24, 0x49, 0x01, 0x61, 0xb0, 0x22, 0x01, 0x25, 0x01,
-  0x2d, 0x11, 0x48, 0x14, 0x48, 0x80, 0x04, 0x16, 0x48, 0x02, 0x44, 0x12,
-  0x20, 0x11, 0x08, 0x20, 0x21, 0x04, 0x6f, 0x7a, 0x04, 0x2b, 0x18, 0xa0,
-  0x12, 0x10, 0xaa, 0x41, 0x81, 0x48, 0x8d, 0x12, 0x28, 0x2a, 0x01, 0x81,
-  0x10, 0x32, 0x11, 0x21, 0x11, 0x90, 0x41, 0x30, 0x21, 0xb0, 0x21, 0x04,
-  0x11, 0x28, 0x22, 0x14, 0x8c, 0x44, 0x15, 0x42, 0xd4, 0x84, 0x14, 0x01,
-  0x1d, 0x24, 0x43, 0x02, 0xc1, 0x12, 0x90, 0x21, 0x50, 0xc1, 0x18, 0x19,
-  0x14, 0x38, 0x11, 0xa3, 0x04, 0x46, 0x14, 0x24, 0x04, 0x8d, 0x24, 0x2a,
-  0x04, 0x1c, 0xf4, 0xaa, 0x38, 0xd0, 0x22, 0xf4, 0x11, 0x24, 0x8d, 0x12,
-  0x1f, 0x41, 0x32, 0x4a, 0x1f, 0xc1, 0x36, 0x6a, 0x1f, 0xc1, 0xb6, 0x4a,
-  0xd1, 0x41, 0xb6, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x59, 0xb4, 0x4a, 0xb9,
-  0x24, 0xf4, 0x4a, 0xb1, 0x4b, 0x42, 0x2f, 0x14, 0xfb, 0x24, 0x48, 0x2d,
-  0xb1, 0x4f, 0x82, 0xe4, 0x14, 0xfb, 0x24, 0x4a, 0x4e, 0x81, 0x4f, 0xa2,
-  0x64, 0x15, 0x4f, 0xa2, 0xe4, 0x1d, 0xe2, 0xa2, 0x64, 0x5d, 0xac, 0xe5,
-  0x4d, 0xc2, 0x4a, 0x1f, 0x4d, 0xd2, 0x24, 0xf4, 0x91, 0x24, 0x87, 0x22,
-  0x1f, 0x49, 0x32, 0x4c, 0x1f, 0x49, 0x36, 0x6a, 0x1f, 0x48, 0xb6, 0x4a,
-  0xf1, 0x91, 0x6c, 0xab, 0x94, 0x1b, 0x61, 0xab, 0x94, 0x53, 0xf8, 0x4a,
-  0x94, 0x4b, 0x4a, 0xaf, 0x44, 0xb9, 0xa4, 0xf4, 0x42, 0x94, 0x4f, 0x82,
-  0xf4, 0x42, 0x94, 0x4f, 0x82, 0x84, 0xfb, 0xa4, 0x4a, 0x3f, 0x5f, 0x09,
-  0x24, 0x1f, 0xc5, 0xd2, 0x28, 0xe4, 0x41, 0x12, 0xb8, 0x11, 0x16, 0xd8,
-  0x41, 0x96, 0x1a, 0x1d, 0x64, 0xad, 0x94, 0x19, 0xd6, 0x4a, 0x9b, 0x45,
-  0xa9, 0xbb, 0x24, 0xd4, 0x1a, 0x99, 0x44, 0x2d, 0x91, 0x2e, 0x48, 0x2d,
-  0x91, 0x65, 0xc8, 0x91, 0x6f, 0xa2, 0x85, 0xf8, 0x24, 0x9a, 0x1a, 0xd8,
-  0xa4, 0x64, 0x19, 0x26, 0x6a, 0x49, 0xbc, 0xe4, 0x48, 0x42, 0xfb, 0x91,
-  0x2c, 0x24, 0x1f, 0xc9, 0x54, 0x28, 0x1f, 0x49, 0x36, 0x48, 0x1f, 0x49,
-  0x32, 0x48, 0x17, 0x48, 0x23, 0xf4, 0x81, 0x24, 0xad, 0x14, 0x1b, 0x28,
-  0xad, 0xb4, 0x13, 0x98, 0x3a, 0xa2, 0xa9, 0x21, 0x8a, 0x61, 0x8a, 0x29,
-  0x39, 0x86, 0x18, 0x4f, 0x88, 0xf5, 0x52, 0xc9, 0x00, 0x80, 0x04, 0x00,
-  0x80, 0x04, 0x40, 0x41, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00,
-  0x88, 0x20, 0x04, 0x00, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0a, 0xbf, 0x67, 0x0e, 0x22, 0x00,
-  0x2c, 0xe1, 0xa4, 0x82, 0x01, 0x80, 0xc1, 0x28, 0x42, 0x18, 0x8b, 0x41,
-  0x19, 0x11, 0x02, 0x84, 0x80, 0x95, 0x41, 0x19, 0xf2, 0x41, 0x28, 0x4a,
-  0xd2, 0x29, 0x22, 0x32, 0x48, 0x60, 0x12, 0x1a, 0x12, 0x01, 0x81, 0x63,
-  0x84, 0x78, 0x22, 0xc4, 0x14, 0x16, 0x72, 0xa4, 0x08, 0x30, 0x14, 0x83,
-  0xf4, 0x12, 0x44, 0x89, 0x64, 0x48, 0xd8, 0x83, 0x01, 0x41, 0x18, 0x80,
-  0x61, 0x4a, 0x85, 0x44, 0x68, 0x84, 0x84, 0x30, 0x24, 0xff, 0xda, 0x06,
-  0x43, 0xb4, 0x82, 0x01, 0xa1, 0x41, 0x8f, 0x22, 0x14, 0xd4, 0x2a, 0x52,
-  0x49, 0x30, 0x3a, 0x83, 0x14, 0x01, 0x50, 0x24, 0x1b, 0x41, 0x19, 0x33,
-  0x28, 0x26, 0x68, 0x41, 0x20, 0x81, 0x84, 0x84, 0x82, 0x51, 0x28, 0x20,
-  0x96, 0x1a, 0x48, 0x8b, 0x12, 0x5a, 0x42, 0x22, 0x14, 0xc2, 0x12, 0x85,
-  0x01, 0x14, 0x40, 0x29, 0x01, 0x84, 0x13, 0x32, 0xd8, 0x30, 0x88, 0x8a,
-  0xc1, 0xcc, 0x18, 0xc2, 0x63, 0x84, 0xc3, 0x54, 0x47, 0x18, 0x48, 0x6f,
-  0x8d, 0x02, 0x90, 0x12, 0xf0, 0x12, 0x42, 0x68, 0x27, 0x23, 0x24, 0x24,
-  0x17, 0x41, 0xd0, 0x84, 0x31, 0x48, 0x1b, 0x16, 0x12, 0x21, 0x45, 0x92,
-  0x41, 0x18, 0x58, 0x62, 0x15, 0x92, 0x48, 0x22, 0x1a, 0xb6, 0x22, 0xe4,
-  0x88, 0x86, 0x51, 0xa1, 0x32, 0x46, 0x91, 0x12, 0x13, 0x64, 0x41, 0x4a,
-  0x18, 0xbc, 0x46, 0x71, 0x42, 0xf2, 0x18, 0x26, 0x85, 0x01, 0x16, 0x85,
-  0xd4, 0x12, 0x61, 0x84, 0x82, 0x43, 0x65, 0x12, 0x8b, 0xd2, 0x44, 0x82,
-  0x82, 0xc9, 0x28, 0x21, 0x3c, 0x4a, 0xac, 0x75, 0x58, 0x64, 0x48, 0x56,
-  0xf4, 0xd4, 0x98, 0xb0, 0x24, 0x04, 0x40, 0x18, 0xcc, 0x48, 0x41, 0x8c,
-  0x12, 0xc8, 0x28, 0x23, 0x26, 0x11, 0x18, 0x01, 0x90, 0x18, 0x13, 0x92,
-  0x28, 0x15, 0xc8, 0x34, 0x13, 0xa2, 0x14, 0x15, 0x08, 0x00, 0x22, 0x20,
-  0x12, 0x48, 0xba, 0x48, 0xe2, 0x22, 0x81, 0x02, 0x12, 0x88, 0x00, 0x10,
-  0xc8, 0x4c, 0x18, 0x44, 0x89, 0x68, 0x81, 0x00, 0x89, 0x21, 0xa1, 0x14,
-  0x43, 0x5a, 0x48, 0x41, 0x28, 0x00, 0x22, 0x4f, 0x71, 0x01, 0x00, 0x00,
-  0x00, 0x2a, 0x81, 0x84, 0x81, 0x86, 0x91, 0x41, 0x00, 0x24, 0x41, 0x25,
-  0x51, 0x81, 0x00, 0x80, 0x24, 0x44, 0x08, 0x24, 0x28, 0x84, 0x00, 0x4a,
-  0x82, 0x04, 0x61, 0x11, 0xc0, 0x24, 0x10, 0x21, 0x84, 0x14, 0x08, 0x21,
-  0x1a, 0x04, 0x15, 0x08, 0x40, 0x12, 0x84, 0x01, 0x00, 0xa0, 0x48, 0x42,
-  0xf0, 0xbb, 0xf3, 0x24, 0x18, 0x1b, 0x21, 0x1c, 0xc2, 0x18, 0x18, 0x8b,
-  0x42, 0x90, 0x18, 0x27, 0x82, 0x84, 0x00, 0x89, 0x51, 0xa1, 0x42, 0x85,
-  0x81, 0xae, 0x41, 0x33, 0x62, 0x34, 0x46, 0x49, 0xc1, 0x24, 0x4a, 0x42,
-  0x81, 0x92, 0x44, 0x12, 0x23, 0x62, 0x24, 0x11, 0x8c, 0x92, 0x12, 0x83,
-  0x44, 0x24, 0x64, 0x11, 0x29, 0x93, 0x86, 0x36, 0x28, 0x83, 0x44, 0xc4,
-  0x41, 0x2a, 0xc8, 0x49, 0xd8, 0x13, 0x99, 0x91, 0x8a, 0x81, 0x08, 0x48,
-  0x82, 0x8a, 0x97, 0x44, 0x84, 0x22, 0x84, 0xdf, 0x63, 0x09, 0x21, 0x2e,
-  0x11, 0x14, 0x81, 0x30, 0x48, 0x32, 0x52, 0x22, 0x80, 0x01, 0x12, 0x85,
-  0xc1, 0x42, 0x54, 0x70, 0x18, 0x11, 0x63, 0x34, 0x00, 0x4c, 0x14, 0x18,
-  0x21, 0xe2, 0x42, 0x14, 0x88, 0x02, 0x2a, 0xb4, 0x28, 0x04, 0x45, 0x58,
-  0x41, 0x20, 0x82, 0x11, 0xa7, 0x16, 0x00, 0x40, 0xa1, 0x1e, 0x87, 0x14,
-  0x19, 0x05, 0x13, 0xc8, 0x12, 0x86, 0x04, 0x00, 0xaa, 0x31, 0x44, 0x8a,
-  0xa4, 0x24, 0x81, 0xcf, 0xf7, 0x0c, 0x12, 0x80, 0x82, 0x81, 0x21, 0x02,
-  0xa4, 0x89, 0x31, 0x68, 0x90, 0x41, 0x81, 0x10, 0x42, 0xf8, 0x82, 0x61,
-  0x48, 0x28, 0x60, 0x94, 0x1c, 0x24, 0x82, 0x06, 0x10, 0xc2, 0x12, 0x80,
-  0x54, 0x12, 0x24, 0x16, 0x82, 0x04, 0x48, 0x7c, 0x81, 0x82, 0x48, 0xa8,
-  0x34, 0x8c, 0x44, 0x94, 0x42, 0x00, 0x83, 0x98, 0x91, 0x18, 0x88, 0x80,
-  0x81, 0x84, 0x88, 0x04, 0x84, 0x00, 0x9d, 0xa9, 0x10, 0x21, 0x44, 0x08,
-  0x42, 0x14, 0x26, 0x58, 0x18, 0x44, 0x95, 0x02, 0x2a, 0x21, 0x82, 0x04,
-  0x89, 0x72, 0x38, 0x04, 0x88, 0x46, 0x54, 0x61, 0x4e, 0x18, 0x22, 0x93,
-  0x01, 0x50, 0x21, 0x44, 0x11, 0x38, 0x15, 0x28, 0x21, 0x22, 0xe2, 0x22,
-  0x24, 0xa4, 0x14, 0x10, 0xf2, 0x12, 0x28, 0x44, 0x29, 0x86, 0x43, 0x21,
-  0x04, 0x20, 0x12, 0x82, 0xb4, 0x22, 0x38, 0x88, 0x84, 0x90, 0x28, 0x00,
-  0x60, 0x81, 0x9f, 0xf4, 0x4a, 0xc2, 0x28, 0x42, 0x12, 0x27, 0x42, 0x80,
-  0x01, 0x2b, 0x14, 0x1e, 0x28, 0x42, 0x40, 0x24, 0xc2, 0x11, 0x00, 0x21,
-  0x15, 0x88, 0x84, 0x42, 0x82, 0x12, 0x28, 0x64, 0x41, 0x28, 0x28, 0x10,
-  0x02, 0x41, 0x11, 0x40, 0x44, 0x18, 0x34, 0x42, 0x80, 0x08, 0x12, 0x18,
-  0x60, 0x84, 0x00, 0x41, 0x22, 0x20, 0x01, 0x28, 0x41, 0x12, 0x48, 0x8e,
-  0x41, 0x16, 0x04, 0xf0, 0x45, 0xa1, 0x20, 0x44, 0x14, 0x43, 0x72, 0x24,
-  0x08, 0x48, 0x22, 0x48, 0x22, 0x22, 0x84, 0xa5, 0x02, 0x83, 0x11, 0x81,
-  0x04, 0x14, 0x00, 0x80, 0x81, 0x08, 0x14, 0x80, 0x44, 0x18, 0x02, 0x42,
-  0x48, 0x12, 0x00, 0x40, 0xc4, 0x21, 0x20, 0x02, 0x21, 0x80, 0x81, 0x02,
-  0x86, 0xc8, 0x48, 0x20, 0x81, 0x64, 0x24, 0x82, 0x40, 0x89, 0xea, 0x81,
-  0x84, 0xf2, 0x79, 0xe2, 0x24, 0x13, 0x04, 0xa1, 0x27, 0x22, 0x26, 0x48,
-  0x91, 0x68, 0x20, 0x31, 0x68, 0x20, 0x52, 0xa2, 0x19, 0xc4, 0x18, 0x1d,
-  0x28, 0x1e, 0x24, 0x84, 0x1c, 0x34, 0x24, 0x15, 0xa4, 0x34, 0x83, 0xf2,
-  0x88, 0x41, 0x41, 0x26, 0x41, 0x41, 0x12, 0xa1, 0x12, 0x15, 0x28, 0x04,
-  0xa0, 0x24, 0x46, 0x04, 0xf0, 0x82, 0x22, 0x83, 0x82, 0x91, 0x12, 0x28,
-  0x94, 0x12, 0x22, 0x00, 0x84, 0x1a, 0x84, 0xe9, 0x82, 0x4c, 0x86, 0xc9,
-  0x28, 0x83, 0x88, 0x33, 0x18, 0x26, 0xf8, 0xc1, 0xcb, 0x20, 0x42, 0xc4,
-  0x11, 0x44, 0x43, 0x24, 0x41, 0xf2, 0x11, 0x68, 0xc3, 0x16, 0x31, 0x22,
-  0x16, 0x08, 0x12, 0x00, 0xa3, 0x14, 0x81, 0x88, 0x04, 0x84, 0x18, 0x00,
-  0x80, 0x92, 0x46, 0x81, 0x21, 0x44, 0x18, 0x4a, 0xb2, 0x24, 0x01, 0x25,
-  0x22, 0x11, 0x14, 0x81, 0xc1, 0x24, 0x66, 0x22, 0x21, 0x84, 0x04, 0xd0,
-  0x28, 0x88, 0x44, 0x22, 0x02, 0x8c, 0x04, 0x48, 0x42, 0x43, 0x28, 0x04,
-  0x6f, 0x82, 0x03, 0x19, 0x02, 0x2b, 0x21, 0x90, 0x22, 0x83, 0x04, 0x00,
-  0x80, 0x01, 0x21, 0x80, 0x04, 0x10, 0x38, 0x42, 0x14, 0x22, 0x00, 0x20,
-  0x22, 0x62, 0x12, 0x22, 0x80, 0x24, 0x02, 0x12, 0x00, 0x40, 0x09, 0x44,
-  0x4e, 0x21, 0x2a, 0x04, 0x00, 0xa0, 0x24, 0x16, 0x01, 0x21, 0x22, 0x00,
-  0x00, 0x82, 0x2a, 0x08, 0x4c, 0x84, 0xf4, 0xc5, 0x86, 0x00, 0x28, 0x41,
-  0x22, 0x42, 0x30, 0x42, 0x84, 0x23, 0x84, 0x11, 0x04, 0x00, 0x20, 0x24,
-  0x04, 0x81, 0x40, 0x02, 0x83, 0x81, 0x04, 0x10, 0x08, 0x60, 0x12, 0x00,
-  0x20, 0x01, 0x80, 0x31, 0x11, 0x42, 0x00, 0x49, 0xc2, 0x24, 0x28, 0x19,
-  0xc2, 0x81, 0x22, 0x1c, 0xc8, 0x11, 0x4a, 0x28, 0x08, 0x88, 0x8d, 0x51,
-  0x18, 0x48, 0x90, 0x88, 0xb0, 0xef, 0x07, 0x20, 0x41, 0x01, 0x14, 0x12,
-  0x11, 0x22, 0x11, 0x22, 0x11, 0x22, 0x22, 0x00, 0x4e, 0x28, 0x90, 0x28,
-  0x80, 0x02, 0x28, 0x1c, 0x22, 0x02, 0x18, 0x80, 0x04, 0x00, 0x24, 0x22,
-  0x34, 0x00, 0x20, 0x81, 0x02, 0x20, 0x24, 0x84, 0x01, 0x20, 0x49, 0x04,
-  0x00, 0xc8, 0x00, 0x22, 0x12, 0x42, 0x00, 0x5f, 0xa1, 0x07, 0x42, 0x81,
-  0x12, 0x42, 0x81, 0x62, 0x89, 0x02, 0x81, 0x30, 0x48, 0x00, 0x28, 0x85,
-  0x04, 0xa1, 0x11, 0x00, 0x4c, 0x82, 0x44, 0x42, 0x41, 0x14, 0x01, 0x00,
-  0x24, 0x00, 0x00, 0x14, 0x20, 0x04, 0x46, 0x88, 0x82, 0x41, 0x04, 0x40,
-  0x98, 0x21, 0x80, 0x41, 0x88, 0x01, 0x19, 0x81, 0x01, 0x18, 0x22, 0x80,
-  0x01, 0x9f, 0x71, 0x01, 0x82, 0x00, 0x22, 0x00, 0x89, 0x84, 0xc4, 0x48,
-  0x1a, 0x44, 0x88, 0x02, 0x80, 0x23, 0x42, 0x81, 0x22, 0x01, 0x00, 0x00,
-  0x21, 0x70, 0x42, 0x41, 0x42, 0x01, 0x00, 0x80, 0x41, 0x21, 0x24, 0x54,
-  0x21, 0x00, 0x21, 0x14, 0x21, 0x30, 0x41, 0xf0, 0x22, 0x41, 0x00, 0x2c,
-  0x08, 0x98, 0x62, 0x82, 0x00, 0xc8, 0x18, 0xb0, 0xa7, 0x07, 0x22, 0xa0,
-  0x42, 0x20, 0x02, 0x18, 0x28, 0x22, 0x00, 0x48, 0x00, 0x21, 0x20, 0x05,
-  0x22, 0x28, 0x00, 0x00, 0x28, 0x80, 0x02, 0x44, 0x80, 0x26, 0x02, 0x22,
-  0x81, 0xa4, 0x12, 0x48, 0x41, 0x14, 0x14, 0x22, 0x1e, 0x21, 0x13, 0x92,
-  0x22, 0x00, 0x11, 0x68, 0x20, 0x0c, 0x86, 0xa8, 0x21, 0x82, 0x12, 0x4c,
-  0xa1, 0x84, 0x82, 0xcf, 0xe4, 0x05, 0x44, 0x32, 0x24, 0x50, 0x84, 0x10,
-  0x04, 0x41, 0x84, 0x42, 0x00, 0x28, 0x42, 0x00, 0x00, 0x14, 0x8c, 0x61,
-  0x14, 0x00, 0x9c, 0x24, 0x32, 0x14, 0x14, 0x89, 0xc1, 0x21, 0x81, 0x40,
-  0x11, 0x88, 0x41, 0x41, 0x41, 0x84, 0x01, 0x28, 0x00, 0x00, 0x40, 0x84,
-  0x12, 0x81, 0x12, 0x08, 0x00, 0x60, 0x88, 0x10, 0x24, 0xf4, 0xd9, 0x54,
-  0x00, 0x84, 0x20, 0x04, 0x00, 0x00, 0x30, 0x33, 0x40, 0x04, 0x8c, 0x12,
-  0x01, 0x19, 0x04, 0x50, 0x12, 0x13, 0x02, 0x31, 0x48, 0x00, 0x14, 0x00,
-  0x1c, 0x04, 0x1a, 0x22, 0x24, 0x12, 0x01, 0x10, 0x01, 0x10, 0x11, 0x34,
-  0x11, 0x42, 0x82, 0x20, 0x88, 0x8c, 0x01, 0x20, 0x81, 0x82, 0x04, 0x00,
-  0x88, 0xcf, 0x44, 0x06, 0x8c, 0x84, 0x84, 0x04, 0x80, 0x02, 0x42, 0x12,
-  0x4a, 0x02, 0x87, 0x44, 0x12, 0x28, 0x00, 0x26, 0x04, 0x44, 0x80, 0x04,
-  0x35, 0x84, 0x82, 0xb1, 0x11, 0x84, 0x88, 0x04, 0x80, 0x81, 0x44, 0x81,
-  0x02, 0x84, 0x90, 0x44, 0x20, 0x44, 0x28, 0xc4, 0x18, 0x42, 0x20, 0x44,
-  0x2c, 0x84, 0x22, 0x84, 0x21, 0x04, 0x23, 0x84, 0x02, 0x10, 0x02, 0x8f,
-  0xba, 0x08, 0x1c, 0xa2, 0x38, 0x2d, 0x32, 0x2a, 0xd4, 0x4b, 0x82, 0x04,
-  0x8c, 0x04, 0x68, 0x9f, 0x44, 0x45, 0xc8, 0x24, 0xa0, 0x22, 0x9f, 0x22,
-  0x04, 0x11, 0x83, 0xb2, 0x21, 0x02, 0x35, 0x41, 0x74, 0x43, 0x32, 0x24,
-  0x1f, 0x22, 0x72, 0x35, 0xa1, 0x24, 0x84, 0x30, 0x32, 0xa0, 0x13, 0xf0,
-  0x18, 0x21, 0x11, 0x1c, 0xf1, 0x14, 0x14, 0x13, 0xe6, 0x12, 0x14, 0x42,
-  0x21, 0xd2, 0x11, 0xa1, 0x42, 0x26, 0xe1, 0x87, 0xb8, 0x21, 0x98, 0x48,
-  0x88, 0xa3, 0x84, 0xa4, 0x85, 0xa9, 0xa8, 0x19, 0x4a, 0x83, 0xd1, 0x44,
-  0x0d, 0xff, 0xd7, 0x07, 0x48, 0x83, 0x12, 0x01, 0x48, 0x4e, 0x1a, 0x56,
-  0x44, 0xb2, 0x49, 0x92, 0x18, 0x23, 0x63, 0x24, 0x18, 0xb0, 0x48, 0x21,
-  0x84, 0x66, 0x22, 0x44, 0x14, 0x67, 0x96, 0x2a, 0x34, 0x29, 0x14, 0x4a,
-  0xc4, 0x51, 0x48, 0x1d, 0x43, 0x14, 0x15, 0x41, 0x89, 0x96, 0x22, 0x1a,
-  0x16, 0x43, 0x91, 0x41, 0x24, 0x4b, 0x41, 0x13, 0x94, 0x21, 0x62, 0x7f,
-  0xc4, 0x23, 0xf7, 0x49, 0x21, 0xca, 0x8c, 0x61, 0x3c, 0x52, 0xe2, 0x1a,
-  0xa8, 0x14, 0xa2, 0x6a, 0x83, 0xe8, 0x88, 0x88, 0x3c, 0x88, 0xca, 0xfc,
-  0x68, 0x79, 0x60, 0x46, 0x56, 0x38, 0x34, 0x4a, 0x62, 0x82, 0x2a, 0xd2,
-  0x89, 0xa6, 0x26, 0xcc, 0x25, 0x47, 0xa9, 0x62, 0x00, 0x6d, 0x48, 0x28,
-  0x4e, 0x1d, 0x8d, 0x69, 0x58, 0x80, 0xa3, 0x24, 0x16, 0xa3, 0x22, 0x9c,
-  0x22, 0x91, 0x28, 0x30, 0x14, 0x6a, 0xa2, 0x64, 0x00, 0x1f, 0x82, 0x01,
-  0x2c, 0x64, 0x85, 0x15, 0x51, 0x48, 0x28, 0x2e, 0x58, 0x5d, 0x64, 0x12,
-  0x28, 0x21, 0x19, 0xd2, 0x13, 0x32, 0x14, 0x17, 0x18, 0x1a, 0x27, 0xa8,
-  0x89, 0x89, 0xa1, 0x41, 0x2a, 0x26, 0x33, 0x44, 0x52, 0x70, 0x65, 0x01,
-  0x17, 0x44, 0x2b, 0x12, 0x15, 0x34, 0x22, 0x15, 0x24, 0x52, 0x41, 0x50,
-  0x41, 0xa0, 0x41, 0x00, 0x90, 0x44, 0x10, 0x05, 0x55, 0x88, 0x52, 0x85,
-  0x50, 0x84, 0x28, 0x55, 0x88, 0x52, 0x84, 0x50, 0x81, 0x28, 0x15, 0x08,
-  0x8c, 0x01, 0x00, 0x18, 0x50, 0x18, 0x70, 0x2a, 0x01, 0xa5, 0x21, 0x11,
-  0x0a, 0xa3, 0x02, 0xa1, 0x10, 0x2a, 0x18, 0x7a, 0x11, 0x88, 0x62, 0x89,
-  0x44, 0x84, 0x42, 0xdb, 0xdb, 0x14, 0x4f, 0x74, 0xf2, 0x17, 0x2f, 0x2f,
-  0x41, 0xd2, 0x77, 0xf2, 0x4f, 0x25, 0xdf, 0x54, 0xf2, 0x48, 0x48, 0x5f,
-  0x54, 0xf4, 0x7d, 0x7d, 0x5f, 0x62, 0xd6, 0x9a, 0x87, 0xe2, 0x41, 0x51,
-  0x64, 0x6f, 0x41, 0x71, 0x24, 0xb4, 0x75, 0x55, 0x41, 0x1f, 0xc1, 0x51,
-  0xec, 0xaf, 0x83, 0x71, 0x48, 0x5d, 0xd1, 0xc7, 0xe2, 0xa7, 0x82, 0xcf,
-  0xf2, 0xf5, 0x37, 0x1c, 0x85, 0xfa, 0x1e, 0x1c, 0x87, 0x82, 0x3a, 0x55,
-  0x88, 0x87, 0x81, 0x4a, 0xf6, 0x11, 0x31, 0x1f, 0x24, 0x54, 0x93, 0xd5,
-  0xfa, 0x1a, 0x18, 0x9f, 0x84, 0xd2, 0x28, 0x72, 0x22, 0xfe, 0x22, 0x2e,
-  0xaf, 0x82, 0xf2, 0x61, 0x23, 0x3f, 0xa8, 0xda, 0xb2, 0xf2, 0x8b, 0x8c,
-  0x27, 0x24, 0xbf, 0xb9, 0xd9, 0xaa, 0xf8, 0x1a, 0x18, 0x26, 0xf2, 0x62,
-  0x98, 0x9f, 0x8b, 0xf9, 0x38, 0xd8, 0x8f, 0xc8, 0xfc, 0x94, 0xdc, 0x8d,
-  0x48, 0x2f, 0xfd, 0x43, 0xc1, 0x43, 0x3f, 0xb1, 0x56, 0x53, 0x6d, 0x26,
-  0xa3, 0xf4, 0x59, 0x31, 0xdf, 0xd7, 0xf7, 0x64, 0x24, 0x8f, 0x85, 0x55,
-  0x31, 0xff, 0xc4, 0xa2, 0x24, 0x1a, 0x43, 0xf2, 0x5a, 0x58, 0xc7, 0xc6,
-  0xdf, 0x87, 0xf5, 0x29, 0x2c, 0x1f, 0xc3, 0x73, 0x2c, 0xff, 0x36, 0x14,
-  0x3f, 0x56, 0xf2, 0x21, 0x2d, 0xdf, 0xf2, 0xf1, 0x46, 0x44, 0x1f, 0x38,
-  0xff, 0x53, 0x59, 0xcd, 0x8e, 0x3b, 0x11, 0x1c, 0xf2, 0x18, 0x58, 0x9f,
-  0x94, 0xf4, 0x28, 0x28, 0x4e, 0x41, 0x9f, 0x93, 0xf3, 0x41, 0x43, 0x3f,
-  0x11, 0x61, 0x31, 0x2b, 0x15, 0x87, 0xa4, 0xa7, 0x22, 0x65, 0xed, 0xc6,
-  0xf7, 0x58, 0x7b, 0xbf, 0xa6, 0xf2, 0xc7, 0xcd, 0x1f, 0x91, 0xf3, 0xd9,
-  0xfd, 0xa7, 0xa4, 0x3f, 0x1d, 0x0d, 0x8f, 0x89, 0xf9, 0xe8, 0x6a, 0x2f,
-  0x9d, 0xf9, 0x38, 0x98, 0x2c, 0xdd, 0x42, 0xe4, 0xd5, 0xf5, 0x4a, 0x98,
-  0x3f, 0x1a, 0x0d, 0x1b, 0x64, 0x2b, 0x61, 0x7f, 0x31, 0xd2, 0x42, 0xd2,
-  0x8a, 0xa2, 0x31, 0xdf, 0x55, 0xb5, 0x28, 0xa2, 0x77, 0x1f, 0x24, 0xf4,
-  0x5a, 0x55, 0x8b, 0x26, 0x1a, 0x43, 0xf2, 0x1a, 0x58, 0x4f, 0x12, 0xf6,
-  0x59, 0x15, 0x9b, 0x26, 0xdb, 0x11, 0x1d, 0x2b, 0x7f, 0x53, 0xf5, 0x63,
-  0x61, 0xdf, 0x14, 0xf4, 0x61, 0x5a, 0x77, 0x42, 0x1f, 0x32, 0xfc, 0x3b,
-  0x11, 0x1f, 0xb4, 0xf4, 0x57, 0x55, 0x1f, 0x16, 0xf4, 0x39, 0x59, 0x2e,
-  0x21, 0x3a, 0xf3, 0x48, 0x68, 0x1f, 0x91, 0xf3, 0x41, 0x43, 0x3b, 0x51,
-  0x17, 0x71, 0x7f, 0x51, 0xf1, 0x49, 0x22, 0x3f, 0x94, 0xf6, 0x61, 0x44,
-  0x9f, 0x52, 0xf3, 0x11, 0x32, 0xbf, 0x9e, 0xea, 0x58, 0xfa, 0x49, 0x71,
-  0x1d, 0x33, 0x9f, 0x94, 0xd9, 0x13, 0xa9, 0xd4, 0xce, 0xd2, 0xaf, 0x82,
-  0xb1, 0x68, 0xe9, 0x9f, 0xa5, 0x13, 0x6f, 0x4c, 0xdc, 0x48, 0xc4, 0xd8,
-  0x1f, 0x32, 0x06, 0x5f, 0x42, 0xf4, 0x3b, 0x31, 0x6f, 0x22, 0xf1, 0x22,
-  0x24, 0xff, 0xd6, 0xf4, 0x71, 0x71, 0x8b, 0x55, 0xcf, 0x46, 0xf2, 0x7d,
-  0x7d, 0x9d, 0x4b, 0xb7, 0x44, 0x8b, 0x26, 0x1a, 0x41, 0xf2, 0x5e, 0x5c,
-  0x4f, 0x16, 0xf2, 0x59, 0x15, 0x9f, 0x16, 0xf2, 0x1d, 0x11, 0x4f, 0xf2,
-  0xf2, 0x3b, 0x59, 0x1f, 0x16, 0xf6, 0x4d, 0x41, 0x5f, 0xf6, 0xf6, 0x4b,
-  0x69, 0x3e, 0xe3, 0xff, 0x47, 0xf5, 0xc4, 0x4f, 0xbf, 0x95, 0xe5, 0x16,
-  0xf6, 0x31, 0x51, 0x8f, 0x94, 0xa4, 0x22, 0x9f, 0x84, 0xf4, 0x31, 0x39,
-  0x1f, 0x34, 0xf4, 0x12, 0x11, 0x57, 0x71, 0xff, 0xd1, 0xf1, 0x49, 0x21,
-  0x1f, 0xb6, 0xf6, 0x63, 0x67, 0xbf, 0x56, 0xf7, 0x59, 0x59, 0xee, 0xa3,
-  0x3f, 0x7e, 0xfc, 0xea, 0xf1, 0xdf, 0xac, 0xfd, 0x41, 0x91, 0x3f, 0x34,
-  0xfd, 0x4a, 0x58, 0x8f, 0xac, 0xbd, 0xf2, 0xb7, 0xd8, 0xe9, 0x87, 0xff,
-  0x18, 0xb8, 0x6f, 0x4d, 0xfd, 0x1c, 0x56, 0x8c, 0xf8, 0xda, 0xf7, 0x00,
-  0x00, 0x00, 0x48, 0x18, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x11, 0x00, 0x10, 0x01, 0x00, 0x00, 0x22, 0x00, 0x40, 0x01, 0x45, 0x01,
-  0x00, 0x22, 0x20, 0x02, 0x14, 0x40, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00,
-  0xf0, 0xd7, 0x3d, 0x20, 0x6a, 0x41, 0x47, 0x12, 0x11, 0xd0, 0x41, 0x06,
-  0x1d, 0x64, 0x43, 0x16, 0x81, 0x81, 0x06, 0x40, 0x94, 0x41, 0x4e, 0x24,
-  0x11, 0x4c, 0x52, 0x84, 0x8d, 0x21, 0xc0, 0x24, 0x26, 0x58, 0x48, 0x22,
-  0x85, 0x04, 0x54, 0x15, 0x88, 0x62, 0x82, 0x12, 0x26, 0x08, 0x00, 0x18,
-  0xc4, 0x14, 0x8c, 0x72, 0x2a, 0x01, 0x2d, 0x11, 0x8c, 0xd2, 0x22, 0xc8,
-  0x28, 0x88, 0x84, 0x29, 0x48, 0x98, 0x82, 0x84, 0xa9, 0x2b, 0xb3, 0x48,
-  0x28, 0x98, 0x88, 0x8e, 0x42, 0x4f, 0x9f, 0x07, 0x2e, 0x42, 0x1f, 0x41,
-  0xf2, 0x28, 0x12, 0x1f, 0x41, 0x72, 0x68, 0xf2, 0x11, 0x24, 0xa7, 0x24,
-  0x1d, 0x24, 0xab, 0x14, 0x1f, 0x41, 0xf2, 0x4a, 0x92, 0x19, 0xb6, 0x4a,
-  0x19, 0xf5, 0x4a, 0x92, 0x4b, 0x42, 0xaf, 0x34, 0x39, 0x24, 0x2f, 0x14,
-  0xf9, 0x24, 0x48, 0x2f, 0x14, 0xfb, 0x34, 0x48, 0x1c, 0xf9, 0x24, 0x4a,
-  0x4e, 0xa1, 0x4f, 0xa2, 0xe4, 0x15, 0xf2, 0x24, 0x4a, 0x9e, 0x21, 0x2e,
-  0x4a, 0xde, 0x25, 0x2d, 0x4a, 0x9e, 0x24, 0x2d, 0x5a, 0x1f, 0x49, 0xd2,
-  0x22, 0xf4, 0x91, 0x24, 0x8f, 0x22, 0xf1, 0x91, 0x24, 0x83, 0xf6, 0x91,
-  0x64, 0xab, 0x14, 0x1f, 0x49, 0xb6, 0x4a, 0xd1, 0x41, 0xb6, 0x6a, 0x99,
-  0x61, 0xab, 0x94, 0x59, 0xb4, 0x4a, 0xb9, 0xa4, 0xb4, 0x4a, 0xb9, 0x34,
-  0xb4, 0x42, 0xf9, 0xb4, 0x48, 0x29, 0xfb, 0x24, 0x48, 0x4a, 0xf9, 0xa4,
-  0x4a, 0x4f, 0x52, 0x09, 0x48, 0x1d, 0x48, 0x81, 0x1b, 0x41, 0x81, 0x13,
-  0x31, 0x48, 0x19, 0xb2, 0x4a, 0x91, 0x21, 0x8f, 0x44, 0x18, 0xf1, 0x4a,
-  0xb4, 0x11, 0x89, 0x2b, 0x92, 0x9a, 0x22, 0x98, 0x90, 0x92, 0x23, 0xc2,
-  0x91, 0x2d, 0x52, 0x88, 0x2a, 0xe9, 0x11, 0x48, 0x22, 0xa9, 0x42, 0x96,
-  0x44, 0xe3, 0x48, 0xc2, 0x41, 0x17, 0xc9, 0x2c, 0xf4, 0x81, 0x6c, 0xe0,
-  0x49, 0x06, 0x9e, 0x24, 0x21, 0x8a, 0x12, 0xd2, 0x41, 0xd2, 0x42, 0x19,
-  0xd1, 0x42, 0x1b, 0x94, 0x32, 0x43, 0x92, 0x92, 0x43, 0x12, 0x12, 0x94,
-  0x83, 0x2b, 0x42, 0x29, 0xf1, 0x24, 0x12, 0xdf, 0xd5, 0x03, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x40, 0x01, 0x40, 0x18, 0x82, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x12, 0xf0, 0xaf, 0xc3, 0x00,
-  0x6c, 0x43, 0x04, 0x00, 0x48, 0x22, 0x87, 0x21, 0x83, 0x82, 0xc4, 0x2a,
-  0x40, 0x88, 0x34, 0x21, 0x90, 0x18, 0x12, 0x19, 0x12, 0x24, 0x64, 0x41,
-  0x88, 0xc0, 0x28, 0x41, 0x14, 0x84, 0x82, 0x28, 0x12, 0x80, 0x43, 0x02,
-  0x41, 0xc0, 0x12, 0x10, 0x44, 0x21, 0x51, 0x14, 0x25, 0x41, 0xc1, 0x11,
-  0x10, 0x28, 0x4c, 0x08, 0x22, 0x86, 0x82, 0x22, 0x28, 0x23, 0x08, 0xdf,
-  0xc6, 0x47, 0x21, 0x64, 0x18, 0x8c, 0x41, 0x41, 0x68, 0x13, 0x47, 0x81,
-  0x46, 0x31, 0x41, 0x2c, 0x48, 0xa8, 0x18, 0x1c, 0x45, 0x01, 0x46, 0x3a,
-  0x41, 0x27, 0x22, 0xd3, 0x92, 0x82, 0x11, 0x14, 0x94, 0x42, 0x11, 0x42,
-  0x24, 0x00, 0x66, 0x14, 0x2b, 0xc4, 0x28, 0x42, 0x21, 0x43, 0x64, 0x22,
-  0x00, 0x86, 0xd4, 0x21, 0xb1, 0x14, 0x54, 0xa2, 0x48, 0x8d, 0x82, 0x9a,
-  0x04, 0x9a, 0xc4, 0x12, 0x40, 0xa2, 0x41, 0x35, 0xe2, 0xc1, 0xa4, 0x84,
-  0x52, 0x42, 0x47, 0x11, 0x8a, 0x94, 0x83, 0x14, 0x42, 0x5e, 0x21, 0x16,
-  0x48, 0x41, 0x48, 0xc1, 0x4c, 0x14, 0x17, 0x25, 0x26, 0xd8, 0x84, 0x64,
-  0x82, 0x23, 0x52, 0x81, 0xd0, 0x38, 0x92, 0x41, 0x2f, 0x21, 0x72, 0x21,
-  0x6a, 0x18, 0x15, 0x66, 0x14, 0x43, 0xa1, 0x85, 0x14, 0x83, 0x1c, 0x04,
-  0xe0, 0x48, 0x34, 0x2b, 0x1b, 0x14, 0x89, 0xa2, 0x34, 0xa1, 0x27, 0x44,
-  0x42, 0x21, 0x18, 0x44, 0x17, 0x21, 0x1a, 0x74, 0x18, 0x92, 0x44, 0xbd,
-  0x82, 0x4b, 0x41, 0x11, 0x2a, 0x74, 0x18, 0x22, 0x48, 0xa2, 0x41, 0x27,
-  0x22, 0x4f, 0x21, 0xa4, 0x84, 0x1e, 0x42, 0x52, 0x47, 0x11, 0x1a, 0xe8,
-  0x49, 0x07, 0x40, 0x14, 0x06, 0xa0, 0x21, 0x18, 0x68, 0x81, 0x82, 0x21,
-  0x92, 0x4e, 0x11, 0x20, 0x84, 0x04, 0x84, 0x4c, 0x21, 0x02, 0x50, 0x18,
-  0x00, 0x22, 0x10, 0x13, 0x28, 0x02, 0x00, 0x00, 0xc0, 0x24, 0x00, 0x29,
-  0x48, 0x54, 0x34, 0x40, 0x01, 0x1c, 0x28, 0x81, 0x09, 0x42, 0x84, 0x10,
-  0x91, 0x88, 0x22, 0x88, 0x22, 0x88, 0x48, 0x1f, 0xc5, 0x09, 0x22, 0x40,
-  0x01, 0x24, 0x40, 0x41, 0x38, 0x24, 0x8c, 0x32, 0x22, 0x40, 0x12, 0x91,
-  0x12, 0x19, 0x44, 0x04, 0x2d, 0x24, 0x10, 0x48, 0x08, 0x48, 0x80, 0x64,
-  0x41, 0x11, 0x46, 0x01, 0x89, 0x02, 0x00, 0x80, 0x51, 0x41, 0x40, 0x08,
-  0x15, 0x58, 0x28, 0x28, 0xa0, 0x41, 0x25, 0x11, 0xc1, 0x92, 0x80, 0x71,
-  0x24, 0x68, 0x24, 0x00, 0x90, 0x18, 0x22, 0x10, 0xf4, 0x3f, 0x37, 0x70,
-  0x43, 0x24, 0x62, 0x62, 0x90, 0x44, 0x89, 0xb1, 0x14, 0x26, 0x13, 0x82,
-  0x18, 0x28, 0xd1, 0x81, 0x89, 0xc4, 0x45, 0x2c, 0x12, 0x61, 0x12, 0x15,
-  0xc8, 0x49, 0x17, 0x42, 0x1c, 0x32, 0x61, 0x11, 0x65, 0x18, 0xd1, 0x28,
-  0xe6, 0x44, 0x72, 0x24, 0xa8, 0x12, 0x48, 0x40, 0x08, 0x23, 0x82, 0x82,
-  0x52, 0x68, 0x18, 0x00, 0x4c, 0x45, 0xb8, 0x21, 0x94, 0xa8, 0x8e, 0x6a,
-  0x4a, 0xc8, 0x41, 0x94, 0x27, 0x98, 0x33, 0xc1, 0x18, 0x83, 0x68, 0xa2,
-  0x80, 0x94, 0x41, 0x4e, 0x8c, 0xf0, 0x27, 0xc1, 0x90, 0x62, 0x28, 0x6c,
-  0x02, 0x46, 0x14, 0x38, 0x64, 0x2a, 0xc1, 0x24, 0xa2, 0x84, 0x18, 0x12,
-  0x33, 0xf4, 0x41, 0x14, 0x42, 0x45, 0x81, 0x32, 0x26, 0x14, 0xd4, 0x83,
-  0xa2, 0x42, 0x48, 0x65, 0x18, 0x31, 0x5c, 0x5c, 0xd4, 0x84, 0xa6, 0x12,
-  0x28, 0x40, 0x08, 0x28, 0x22, 0x1c, 0x02, 0x16, 0x08, 0x91, 0x1e, 0x48,
-  0x81, 0x14, 0x83, 0xf9, 0x83, 0x22, 0x82, 0x1e, 0x82, 0x95, 0xc2, 0x9a,
-  0x97, 0x43, 0x16, 0x12, 0x68, 0x82, 0x21, 0x8c, 0xa5, 0x24, 0x84, 0x41,
-  0x4f, 0x24, 0x04, 0x45, 0x01, 0x11, 0x40, 0x22, 0x31, 0x11, 0x84, 0x21,
-  0x84, 0x29, 0x02, 0x86, 0x49, 0x02, 0x13, 0x12, 0x12, 0x41, 0x99, 0x48,
-  0x22, 0x11, 0x14, 0x11, 0x80, 0x84, 0x32, 0x22, 0x11, 0x60, 0x84, 0x00,
-  0x24, 0x20, 0x41, 0x54, 0x48, 0x21, 0x00, 0x45, 0x22, 0x82, 0xa6, 0x42,
-  0x8c, 0x34, 0x41, 0x1c, 0x04, 0x11, 0x30, 0x48, 0x88, 0x00, 0x10, 0xb1,
-  0x84, 0x04, 0x5f, 0xf8, 0x0e, 0x28, 0x42, 0x24, 0x22, 0x50, 0x82, 0x00,
-  0x40, 0x22, 0x28, 0x42, 0x48, 0x51, 0x41, 0x00, 0x2c, 0x91, 0x21, 0x42,
-  0x24, 0x83, 0x04, 0x11, 0x41, 0x86, 0x14, 0x81, 0x04, 0x10, 0x12, 0x06,
-  0x83, 0x58, 0x24, 0x30, 0x56, 0x28, 0xa0, 0x24, 0x8a, 0x04, 0x28, 0x8c,
-  0x04, 0x19, 0x08, 0x23, 0x42, 0x54, 0x18, 0x00, 0x15, 0x04, 0x2c, 0x02,
-  0x89, 0x14, 0xe4, 0x21, 0xf2, 0x97, 0xf5, 0x00, 0x66, 0x04, 0x1c, 0x01,
-  0x14, 0x10, 0x02, 0x42, 0x41, 0xa3, 0x24, 0x32, 0x14, 0x60, 0x12, 0x00,
-  0x88, 0x28, 0x34, 0x40, 0xe1, 0x23, 0xc4, 0x42, 0x87, 0x1c, 0x00, 0x11,
-  0x8c, 0x02, 0x84, 0x41, 0x12, 0x81, 0x42, 0x42, 0x85, 0x11, 0x11, 0x08,
-  0x12, 0x14, 0x21, 0x28, 0x41, 0x83, 0xa4, 0x12, 0x18, 0x48, 0x12, 0x54,
-  0x58, 0x82, 0x83, 0x51, 0x28, 0x28, 0x20, 0xe1, 0x5b, 0x08, 0x20, 0x15,
-  0x04, 0x20, 0x02, 0x28, 0x16, 0x68, 0x52, 0x11, 0x10, 0x11, 0x08, 0xa1,
-  0x12, 0x45, 0x11, 0x34, 0x12, 0x12, 0xa8, 0x44, 0x80, 0x22, 0x38, 0x24,
-  0x40, 0x12, 0x04, 0x18, 0x80, 0x82, 0x12, 0x04, 0x00, 0x41, 0x26, 0x91,
-  0x28, 0x00, 0x27, 0x44, 0x48, 0x18, 0x60, 0x14, 0x20, 0x74, 0x42, 0x11,
-  0x21, 0x02, 0x00, 0x84, 0x42, 0x9e, 0xc4, 0x00, 0x4c, 0x41, 0xb6, 0x21,
-  0x01, 0x29, 0x02, 0x28, 0x12, 0x26, 0x61, 0x28, 0x26, 0x48, 0x98, 0x1c,
-  0x70, 0x28, 0x21, 0x41, 0xe7, 0x48, 0xb2, 0x22, 0x24, 0x91, 0x68, 0x51,
-  0x26, 0xd1, 0x62, 0x54, 0x84, 0x1d, 0x24, 0x10, 0x91, 0x2e, 0x21, 0x16,
-  0x14, 0xa4, 0x28, 0x22, 0x46, 0x14, 0xd4, 0x18, 0x02, 0xc3, 0x64, 0x18,
-  0x1e, 0x28, 0x22, 0xa7, 0x24, 0x43, 0x24, 0x28, 0x81, 0x71, 0x41, 0x44,
-  0x68, 0x25, 0x49, 0x24, 0x84, 0x48, 0x18, 0x98, 0x48, 0x81, 0x24, 0x5f,
-  0xff, 0x09, 0x22, 0x28, 0x00, 0x50, 0x81, 0x24, 0x10, 0xc8, 0x44, 0x25,
-  0x81, 0x44, 0x11, 0x41, 0x07, 0x20, 0x41, 0x21, 0x41, 0x21, 0x08, 0x48,
-  0x28, 0x19, 0x04, 0x48, 0x00, 0x50, 0x82, 0xc0, 0x18, 0x44, 0x25, 0x22,
-  0x01, 0x11, 0x22, 0x68, 0x10, 0x01, 0x28, 0x46, 0xc1, 0x48, 0x21, 0x12,
-  0x46, 0x01, 0x30, 0x14, 0x28, 0x32, 0x21, 0x22, 0x44, 0x2e, 0x41, 0xaf,
-  0xee, 0x0e, 0x41, 0x18, 0x00, 0x22, 0x28, 0x16, 0x04, 0x49, 0x02, 0x88,
-  0x22, 0x88, 0x00, 0x11, 0x00, 0x83, 0x01, 0x00, 0xa4, 0x13, 0x44, 0x01,
-  0x00, 0x41, 0x44, 0x80, 0x22, 0x01, 0x80, 0x04, 0x82, 0x00, 0xc0, 0x68,
-  0x25, 0x04, 0x40, 0x02, 0x44, 0xc0, 0x22, 0x80, 0x98, 0x2a, 0x4a, 0x38,
-  0x24, 0x46, 0x08, 0x81, 0xf0, 0x94, 0xfa, 0xa0, 0x24, 0x10, 0xc4, 0x64,
-  0x44, 0x20, 0x24, 0x02, 0x28, 0x11, 0x40, 0x88, 0xc2, 0x48, 0x00, 0x00,
-  0x20, 0x08, 0x00, 0xc0, 0x21, 0x4e, 0x88, 0x14, 0x10, 0x61, 0x88, 0x41,
-  0x00, 0x88, 0x90, 0x88, 0x41, 0x42, 0x80, 0x02, 0x12, 0x42, 0x23, 0x28,
-  0x24, 0x09, 0x00, 0x12, 0x80, 0x14, 0x24, 0x48, 0x32, 0x44, 0x00, 0xdf,
-  0x2a, 0x0f, 0x22, 0x23, 0x04, 0x00, 0x00, 0x00, 0x44, 0x11, 0x50, 0x41,
-  0x10, 0x05, 0x28, 0x14, 0x41, 0x24, 0x80, 0x42, 0x2a, 0x41, 0xa4, 0x48,
-  0x00, 0x89, 0x42, 0x12, 0x01, 0x81, 0x10, 0x08, 0x00, 0x28, 0x21, 0x40,
-  0x02, 0x10, 0x24, 0x08, 0x82, 0x84, 0x00, 0x42, 0x00, 0x21, 0xc2, 0x40,
-  0xa2, 0x41, 0xf7, 0x2d, 0x40, 0x29, 0x02, 0x84, 0x40, 0x84, 0x01, 0x11,
-  0x8c, 0x08, 0x20, 0x12, 0x08, 0x28, 0x84, 0x00, 0x10, 0x84, 0x14, 0x22,
-  0x02, 0x90, 0x85, 0x1c, 0x16, 0x41, 0x44, 0x88, 0x24, 0x82, 0x44, 0x44,
-  0x34, 0x44, 0x4d, 0x42, 0x00, 0x60, 0x42, 0x81, 0x22, 0x00, 0x81, 0x22,
-  0x49, 0x22, 0x02, 0x00, 0x00, 0x00, 0x10, 0xd4, 0x6b, 0x0e, 0x43, 0x0c,
-  0x20, 0x03, 0x40, 0x01, 0x00, 0x88, 0x95, 0x22, 0x08, 0x1a, 0x44, 0x12,
-  0x04, 0x00, 0x8a, 0x91, 0x22, 0x00, 0x00, 0xa0, 0x82, 0x44, 0x00, 0x00,
-  0x81, 0x88, 0x24, 0x88, 0x30, 0x48, 0x14, 0x84, 0x00, 0x24, 0x81, 0x1c,
-  0x08, 0x11, 0x10, 0x41, 0x18, 0x14, 0x14, 0x08, 0x23, 0x88, 0x44, 0x28,
-  0xf6, 0x9f, 0x59, 0x40, 0x38, 0x28, 0x44, 0x40, 0x01, 0x41, 0x00, 0x10,
-  0x44, 0x04, 0x14, 0x23, 0x02, 0x00, 0x26, 0x38, 0x21, 0x8c, 0x06, 0x3f,
-  0x42, 0x44, 0x91, 0x48, 0x26, 0xc1, 0x48, 0x00, 0x48, 0x80, 0xa4, 0x42,
-  0x20, 0x94, 0x41, 0x00, 0x00, 0x00, 0x42, 0x44, 0x4a, 0x48, 0x22, 0x84,
-  0x14, 0x02, 0x21, 0x88, 0x46, 0x98, 0x82, 0x46, 0x44, 0x88, 0x02, 0x12,
-  0xaf, 0xe3, 0x08, 0xa4, 0x24, 0x15, 0xc2, 0x42, 0x41, 0x18, 0x42, 0x10,
-  0x04, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x48, 0x21, 0x40, 0x81, 0x04,
-  0x00, 0x11, 0x17, 0x4c, 0x22, 0x41, 0x42, 0x44, 0x40, 0x84, 0x14, 0x44,
-  0x46, 0x24, 0x04, 0x80, 0x01, 0x00, 0x49, 0x13, 0x44, 0x04, 0x12, 0x4c,
-  0x34, 0x11, 0x10, 0x34, 0x16, 0x41, 0xaf, 0x36, 0x03, 0x10, 0x08, 0x40,
-  0x01, 0x11, 0x22, 0x11, 0x88, 0x00, 0x84, 0x60, 0x82, 0x26, 0xc8, 0x28,
-  0x40, 0x04, 0x00, 0x41, 0x42, 0xc4, 0x40, 0x24, 0xc4, 0x68, 0x20, 0x04,
-  0x40, 0x22, 0x04, 0x50, 0x21, 0x40, 0x02, 0x11, 0xc0, 0x41, 0x84, 0x90,
-  0x48, 0x50, 0x82, 0x40, 0x88, 0x04, 0x94, 0x00, 0x40, 0x01, 0x2f, 0x57,
-  0x06, 0x15, 0x08, 0x39, 0x04, 0x40, 0x08, 0x84, 0x10, 0x01, 0xcc, 0x12,
-  0x81, 0x12, 0x05, 0x41, 0x89, 0x12, 0x02, 0x4d, 0x28, 0xb0, 0x42, 0x22,
-  0x82, 0x21, 0x91, 0x81, 0x88, 0x11, 0x00, 0x40, 0x11, 0x04, 0x84, 0x80,
-  0x54, 0x28, 0x10, 0x08, 0x84, 0x41, 0x41, 0x48, 0x44, 0x22, 0x20, 0x24,
-  0x12, 0x04, 0x10, 0x02, 0x50, 0x42, 0xf0, 0x9a, 0xf1, 0x70, 0x41, 0xb4,
-  0xa8, 0x14, 0xb1, 0x44, 0x44, 0x25, 0x01, 0x22, 0x14, 0x1b, 0x82, 0x86,
-  0x41, 0x78, 0x86, 0x01, 0x2e, 0x49, 0x13, 0xc2, 0x24, 0x94, 0x63, 0x63,
-  0x32, 0xae, 0x38, 0x22, 0xcb, 0x42, 0x2f, 0x12, 0x41, 0x91, 0xd1, 0x4f,
-  0x44, 0x84, 0x08, 0x40, 0x89, 0x46, 0xc8, 0x48, 0x88, 0x2c, 0xc4, 0xc8,
-  0x4c, 0xb8, 0x62, 0x54, 0x41, 0x84, 0x14, 0x63, 0x41, 0xd1, 0x4a, 0x88,
-  0x78, 0xc2, 0x38, 0x21, 0x20, 0x62, 0x82, 0x41, 0xcb, 0x34, 0xa5, 0x77,
-  0x85, 0x74, 0x48, 0x28, 0x52, 0x38, 0x22, 0x5f, 0xa1, 0x0a, 0x26, 0x82,
-  0x43, 0x07, 0x22, 0x43, 0xf2, 0x45, 0x15, 0x8c, 0x12, 0x34, 0x8c, 0x11,
-  0x11, 0x15, 0x18, 0x19, 0xc3, 0x28, 0x25, 0x28, 0x42, 0x08, 0x8d, 0x44,
-  0x42, 0x54, 0x28, 0xcc, 0x64, 0x14, 0x15, 0x31, 0x61, 0xc1, 0x45, 0xf5,
-  0x8a, 0x44, 0x43, 0x82, 0x54, 0x24, 0x45, 0x68, 0x44, 0x45, 0x54, 0x14,
-  0x24, 0x24, 0x26, 0x64, 0xa6, 0x46, 0x68, 0x64, 0x4e, 0x18, 0x42, 0x83,
-  0x21, 0x54, 0x4e, 0x15, 0x12, 0x88, 0x8c, 0x84, 0xbc, 0x42, 0x01, 0x43,
-  0x44, 0xfd, 0x14, 0x44, 0xbb, 0x79, 0xd0, 0x14, 0x56, 0xa2, 0x61, 0x8f,
-  0x23, 0x12, 0x45, 0xa8, 0x41, 0x70, 0x21, 0x04, 0x49, 0xb8, 0x28, 0x92,
-  0xa8, 0xf0, 0x4c, 0x34, 0x30, 0x2c, 0x50, 0x48, 0xd0, 0x24, 0x88, 0xe6,
-  0xa4, 0xb2, 0x41, 0x14, 0xad, 0x22, 0x85, 0xe8, 0x18, 0xf6, 0x61, 0x2d,
-  0x19, 0xb4, 0x41, 0x28, 0xe4, 0x42, 0x23, 0xe4, 0x4c, 0x14, 0x21, 0x48,
-  0x52, 0xc8, 0x21, 0xa1, 0x4c, 0x16, 0x98, 0x64, 0x43, 0xf8, 0x81, 0x42,
-  0x48, 0x8e, 0x26, 0x8c, 0xb1, 0x44, 0x32, 0x16, 0xc6, 0x46, 0x78, 0xc4,
-  0x88, 0xb2, 0x82, 0xdc, 0x42, 0x94, 0x14, 0x4a, 0xf1, 0xa2, 0xa2, 0x50,
-  0x41, 0x50, 0x41, 0x81, 0x15, 0x94, 0x18, 0x15, 0x14, 0x48, 0x54, 0x18,
-  0x40, 0x01, 0x14, 0x41, 0x14, 0x41, 0x14, 0x45, 0x48, 0x51, 0x84, 0x46,
-  0x51, 0x84, 0x42, 0x45, 0x28, 0x54, 0x84, 0x42, 0x84, 0x50, 0x84, 0x42,
-  0x45, 0x28, 0x04, 0x13, 0x14, 0x14, 0x11, 0x1c, 0x11, 0x9e, 0x41, 0xab,
+  0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x81, 0x24, 0xaf, 0x14, 0x48, 0x00, 0x30,
+  0x21, 0xaf, 0x14, 0x5c, 0x09, 0xf0, 0x18, 0x43, 0xf2, 0x4a, 0x94, 0x43,
+  0xb2, 0x42, 0x79, 0x24, 0xd8, 0x52, 0xf9, 0x24, 0x48, 0x98, 0x4f, 0xa2,
+  0xf4, 0x6f, 0xb7, 0xc0, 0x42, 0x1f, 0x81, 0x56, 0x2c, 0x1f, 0x41, 0x36,
+  0x4a, 0x1b, 0x21, 0xa3, 0x94, 0x21, 0x23, 0xd4, 0x41, 0xd2, 0x30, 0x00,
+  0xf2, 0x26, 0x44, 0x9b, 0x25, 0xab, 0x94, 0x53, 0xf2, 0x4a, 0x94, 0x53,
+  0xb2, 0x42, 0x78, 0x21, 0x98, 0x82, 0x7f, 0x82, 0x84, 0xf9, 0x33, 0x48,
+  0x88, 0x4f, 0x82, 0xed, 0x11, 0xe8, 0x22, 0x64, 0x18, 0x1f, 0xa2, 0x24,
+  0xd9, 0xb4, 0x64, 0x49, 0x4d, 0x59, 0x1f, 0xc8, 0xd2, 0x24, 0xe4, 0xc9,
+  0xd6, 0x18, 0xe4, 0x49, 0x72, 0x4c, 0xf1, 0x74, 0x00, 0xf0, 0x17, 0xab,
+  0x14, 0x1d, 0x24, 0xeb, 0x94, 0x19, 0xb2, 0x4a, 0x1b, 0xb5, 0x4a, 0x3b,
+  0x24, 0xaf, 0x44, 0x39, 0x24, 0x2f, 0x14, 0x79, 0x24, 0xf8, 0x42, 0x94,
+  0x67, 0x82, 0x2d, 0x94, 0x4f, 0x22, 0xf5, 0x2f, 0x29, 0x20, 0x28, 0x88,
+  0x04, 0x65, 0x09, 0xc0, 0x44, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00,
+  0x18, 0x80, 0x08, 0x10, 0x70, 0x09, 0x04, 0x89, 0x09, 0xf0, 0xe8, 0x00,
+  0x00, 0x50, 0x12, 0xf0, 0x27, 0xd9, 0x00, 0x21, 0x84, 0x45, 0x11, 0x04,
+  0x84, 0x2d, 0x1e, 0x18, 0x14, 0x21, 0x25, 0x01, 0x55, 0x98, 0x18, 0x30,
+  0x88, 0x40, 0x58, 0x28, 0xd0, 0x18, 0x01, 0x87, 0x28, 0x94, 0x24, 0x00,
+  0x21, 0x82, 0x29, 0x32, 0x22, 0x44, 0x81, 0x1c, 0x21, 0x88, 0x21, 0x31,
+  0x1c, 0x12, 0x1d, 0x18, 0x21, 0x22, 0x83, 0x41, 0x48, 0x08, 0x84, 0x54,
+  0x23, 0x18, 0x14, 0x42, 0xa8, 0x12, 0x10, 0x42, 0x5c, 0x84, 0x84, 0x8f,
+  0xde, 0x03, 0x13, 0x32, 0x91, 0x96, 0x54, 0x28, 0x81, 0x17, 0x21, 0x10,
+  0x01, 0x10, 0x08, 0xa0, 0x84, 0x40, 0x0a, 0x84, 0x21, 0x00, 0x41, 0x8c,
+  0x21, 0x02, 0x81, 0x70, 0x42, 0x98, 0x24, 0x16, 0x1c, 0x04, 0x25, 0x02,
+  0x21, 0x16, 0x02, 0x28, 0x21, 0x81, 0x44, 0x85, 0x04, 0x10, 0x05, 0x80,
+  0x09, 0x16, 0x88, 0x91, 0x18, 0x51, 0x21, 0x44, 0x18, 0x1c, 0x48, 0x31,
+  0x84, 0xff, 0xe2, 0x0a, 0x22, 0xc6, 0x71, 0x84, 0x58, 0x81, 0x85, 0x64,
+  0x11, 0x25, 0x98, 0x13, 0x23, 0x11, 0x51, 0x2e, 0x20, 0x92, 0x49, 0x12,
+  0x81, 0x29, 0x18, 0x48, 0x08, 0x25, 0xc2, 0x11, 0x18, 0xb6, 0x08, 0x82,
+  0x24, 0x24, 0x22, 0x96, 0x6e, 0x42, 0x3d, 0x22, 0x64, 0x85, 0x32, 0x19,
+  0x88, 0x52, 0x1a, 0x92, 0x18, 0x8c, 0x31, 0x18, 0x25, 0x24, 0x42, 0x58,
+  0xc1, 0xc1, 0xe0, 0x8a, 0x51, 0x34, 0x89, 0x49, 0x34, 0x1a, 0x20, 0x13,
+  0x54, 0x22, 0x47, 0x88, 0xc5, 0xb1, 0x1c, 0x98, 0xf8, 0x40, 0x23, 0x81,
+  0x41, 0x14, 0x02, 0x40, 0x0c, 0x00, 0x11, 0x30, 0x84, 0x81, 0x10, 0x08,
+  0x21, 0x84, 0x50, 0x84, 0x81, 0x24, 0x85, 0x41, 0x0a, 0x8c, 0x44, 0x04,
+  0x00, 0x00, 0xc0, 0x12, 0x40, 0x42, 0xa0, 0x05, 0x10, 0x18, 0x18, 0x02,
+  0x90, 0x50, 0x85, 0x21, 0x80, 0x11, 0x01, 0xf0, 0x59, 0x58, 0x0b, 0x01,
+  0x20, 0x10, 0x0a, 0x05, 0x00, 0x70, 0x84, 0x41, 0x08, 0x00, 0x2c, 0x04,
+  0x41, 0x11, 0x00, 0x30, 0x44, 0x2c, 0x01, 0x12, 0x00, 0x50, 0x01, 0x80,
+  0x08, 0x20, 0x02, 0x79, 0x02, 0xf0, 0x49, 0x8f, 0x1e, 0x0a, 0x80, 0x42,
+  0xa2, 0x21, 0x84, 0x11, 0x21, 0x20, 0x21, 0x12, 0x52, 0x21, 0x18, 0x15,
+  0x82, 0x05, 0x16, 0x21, 0x12, 0x22, 0xc2, 0x11, 0x84, 0x11, 0x40, 0x01,
+  0x14, 0x48, 0x23, 0x81, 0x44, 0x01, 0x49, 0x91, 0x48, 0x2b, 0x21, 0x40,
+  0x41, 0xe2, 0x41, 0x02, 0x45, 0x01, 0x15, 0x64, 0x14, 0x00, 0x20, 0x14,
+  0x84, 0x48, 0xb4, 0x8a, 0x04, 0x18, 0x26, 0x04, 0x10, 0x14, 0xe4, 0xf9,
+  0x0f, 0x00, 0x80, 0x02, 0x24, 0x00, 0x2d, 0x18, 0x00, 0x10, 0x42, 0x03,
+  0x30, 0x11, 0x47, 0x22, 0x12, 0x84, 0x19, 0x01, 0x60, 0x24, 0x14, 0x0f,
+  0x0b, 0xf0, 0x5a, 0x60, 0x41, 0x48, 0x2d, 0x14, 0x24, 0x14, 0xb0, 0x16,
+  0x02, 0x44, 0x40, 0x64, 0x14, 0x00, 0x80, 0x08, 0x82, 0x43, 0xc2, 0x88,
+  0x00, 0x41, 0x40, 0x44, 0x04, 0xcf, 0x7c, 0x06, 0x20, 0x42, 0x82, 0x41,
+  0x48, 0x01, 0x00, 0x26, 0x02, 0x11, 0x18, 0xa0, 0x41, 0x00, 0x00, 0x22,
+  0x40, 0x18, 0x01, 0x00, 0x11, 0x42, 0x18, 0x48, 0x11, 0x00, 0x81, 0x28,
+  0x12, 0x00, 0x00, 0x14, 0x10, 0x01, 0x14, 0x00, 0x42, 0x41, 0x00, 0x29,
+  0x04, 0x18, 0x28, 0x00, 0x10, 0xb4, 0xfd, 0x0d, 0x00, 0x00, 0x18, 0x00,
+  0x40, 0x22, 0x01, 0x00, 0x00, 0x21, 0x84, 0x00, 0x00, 0x18, 0x10, 0x84,
+  0x84, 0x02, 0x00, 0x00, 0x20, 0x04, 0x44, 0x21, 0x00, 0x21, 0x00, 0x48,
+  0x0f, 0x02, 0x00, 0x5c, 0x06, 0xe0, 0x12, 0x00, 0xaf, 0xb7, 0x41, 0x42,
+  0x04, 0x25, 0x42, 0x42, 0x22, 0x02, 0x10, 0x14, 0x65, 0x03, 0xf0, 0x04,
+  0x54, 0x38, 0x10, 0x18, 0x01, 0x28, 0x10, 0x44, 0x41, 0x12, 0x14, 0x01,
+  0x65, 0x08, 0x22, 0x00, 0x41, 0x20, 0x03, 0xef, 0x0c, 0xf0, 0x07, 0x02,
+  0x11, 0x8c, 0x01, 0x81, 0xe0, 0x81, 0x32, 0x44, 0x44, 0x45, 0x88, 0x44,
+  0x08, 0x7f, 0x5b, 0x06, 0x00, 0x41, 0x10, 0x44, 0x28, 0xc0, 0x06, 0xf0,
+  0x09, 0x00, 0x14, 0x00, 0x28, 0x44, 0x10, 0x01, 0x00, 0x00, 0x40, 0x64,
+  0x42, 0x00, 0x40, 0x04, 0x13, 0x02, 0x00, 0x60, 0x92, 0x44, 0x00, 0x28,
+  0x22, 0x35, 0x01, 0xf0, 0x30, 0x08, 0x80, 0x82, 0x02, 0x4f, 0x4b, 0x0d,
+  0x41, 0x10, 0x54, 0x22, 0x6c, 0x91, 0x28, 0x18, 0x44, 0x00, 0x00, 0x00,
+  0x24, 0x10, 0x48, 0x2a, 0x12, 0x08, 0x00, 0xc0, 0x44, 0x26, 0x01, 0x44,
+  0x51, 0x26, 0x04, 0xa0, 0x42, 0x41, 0x41, 0x1c, 0x02, 0x24, 0x00, 0x9c,
+  0x62, 0x44, 0x84, 0x80, 0x42, 0x01, 0x11, 0x89, 0x01, 0x10, 0x38, 0x28,
+  0x4d, 0x48, 0x41, 0xa0, 0x41, 0x00, 0xff, 0xd7, 0xe5, 0x05, 0x60, 0x00,
+  0x00, 0x45, 0x62, 0x81, 0x00, 0x0b, 0x08, 0xf5, 0x14, 0x01, 0x41, 0x14,
+  0x13, 0x81, 0x12, 0x04, 0x00, 0x21, 0x40, 0x52, 0x48, 0x00, 0x00, 0x61,
+  0xa0, 0x12, 0x00, 0x00, 0x00, 0x30, 0x22, 0x00, 0x00, 0x84, 0x20, 0x01,
+  0x50, 0x48, 0x22, 0x89, 0x02, 0x3f, 0xa4, 0x0b, 0xd1, 0x02, 0x0f, 0x01,
+  0x00, 0x01, 0x3f, 0xf0, 0x4f, 0xfe, 0x16, 0x00, 0x00, 0x07, 0x01, 0x00,
+  0x32, 0xff, 0xe4, 0x0f, 0x88, 0x0c, 0x20, 0x04, 0x28, 0x0f, 0x00, 0x13,
+  0x21, 0x9d, 0x0c, 0x03, 0xb2, 0x0c, 0x00, 0x3e, 0x03, 0x7f, 0x00, 0x00,
+  0x10, 0x02, 0x18, 0x3f, 0x5f, 0x68, 0x00, 0x2f, 0x0f, 0x16, 0x00, 0x00,
+  0x06, 0x01, 0x00, 0x0f, 0x41, 0x00, 0xd6, 0x05, 0x81, 0x04, 0x10, 0x20,
+  0x63, 0x03, 0x20, 0x11, 0x20, 0x7d, 0x01, 0x05, 0x01, 0x00, 0xa1, 0xd0,
+  0xf6, 0x03, 0x00, 0x16, 0x21, 0x02, 0x21, 0x00, 0x11, 0xaa, 0x02, 0xc0,
+  0x00, 0x43, 0x02, 0x41, 0x20, 0x02, 0x24, 0x12, 0x00, 0x24, 0x00, 0x40,
+  0xc9, 0x02, 0xf0, 0x43, 0x88, 0x01, 0x18, 0x28, 0x00, 0x81, 0x00, 0x80,
+  0x01, 0x21, 0x00, 0x00, 0xcf, 0xa3, 0x0b, 0x00, 0x44, 0x00, 0x83, 0x04,
+  0x18, 0x24, 0x00, 0x8c, 0x14, 0x21, 0x14, 0x11, 0x53, 0x24, 0x11, 0x10,
+  0x01, 0x60, 0x84, 0x00, 0x81, 0x41, 0x00, 0x51, 0x84, 0x18, 0x42, 0x20,
+  0x24, 0x42, 0x82, 0x22, 0x02, 0x00, 0x42, 0x47, 0x18, 0x40, 0x81, 0x44,
+  0x81, 0x01, 0x48, 0x82, 0x90, 0x28, 0x00, 0x10, 0x08, 0xef, 0x1d, 0x05,
+  0x00, 0x47, 0x11, 0x28, 0xc0, 0x48, 0x00, 0x10, 0x02, 0x81, 0x60, 0x84,
+  0x15, 0x02, 0x53, 0x03, 0x00, 0x28, 0x06, 0xf0, 0x57, 0xa4, 0x12, 0x00,
+  0x90, 0x22, 0x80, 0x02, 0x00, 0x82, 0x42, 0x44, 0x20, 0x02, 0xc0, 0x18,
+  0x00, 0x20, 0x61, 0x22, 0x00, 0x40, 0x08, 0xdd, 0x32, 0x00, 0x00, 0x40,
+  0x02, 0x20, 0x41, 0x01, 0x80, 0x44, 0x01, 0x10, 0x41, 0x16, 0x01, 0x11,
+  0x44, 0x60, 0x44, 0x80, 0x42, 0x48, 0x94, 0x12, 0x10, 0x05, 0x20, 0x04,
+  0x42, 0x00, 0x21, 0x28, 0x00, 0x20, 0xc1, 0x81, 0x12, 0x14, 0x48, 0x14,
+  0x00, 0x48, 0x88, 0x10, 0x08, 0x00, 0x00, 0x5f, 0xab, 0x0e, 0x22, 0x00,
+  0x11, 0x40, 0x04, 0x12, 0x50, 0x81, 0x21, 0x13, 0x11, 0x48, 0x08, 0x45,
+  0x08, 0x41, 0x81, 0x11, 0x10, 0x44, 0x11, 0x04, 0x00, 0x60, 0x14, 0x41,
+  0x44, 0x48, 0xc6, 0xec, 0x00, 0xf0, 0xff, 0x63, 0x50, 0x12, 0x84, 0x00,
+  0x18, 0x10, 0x02, 0x1c, 0x01, 0x18, 0x00, 0x00, 0x45, 0x48, 0x04, 0x6f,
+  0x79, 0x0d, 0x27, 0x21, 0x18, 0x24, 0x16, 0x28, 0x42, 0x02, 0x84, 0x22,
+  0x80, 0x51, 0x28, 0x88, 0x74, 0x40, 0x51, 0x86, 0x17, 0x85, 0x11, 0x2c,
+  0xb5, 0x2c, 0x01, 0x1a, 0x96, 0x41, 0x19, 0xc4, 0x2d, 0xa5, 0xd1, 0x24,
+  0x44, 0xc8, 0x19, 0xab, 0x24, 0x49, 0x61, 0x81, 0xaf, 0x22, 0x45, 0x44,
+  0x31, 0x36, 0x32, 0xa1, 0x16, 0x04, 0x4a, 0x21, 0x21, 0xd3, 0xc1, 0x41,
+  0xa1, 0x34, 0x12, 0x43, 0x01, 0x1e, 0x28, 0x45, 0x78, 0x18, 0x22, 0x62,
+  0x61, 0x80, 0x11, 0x48, 0xfc, 0xa1, 0xa3, 0x10, 0x02, 0x24, 0x81, 0x40,
+  0x02, 0x80, 0x52, 0x29, 0x00, 0x81, 0x85, 0x01, 0x11, 0x45, 0x98, 0x48,
+  0x81, 0x3c, 0x34, 0x28, 0x00, 0x41, 0x13, 0x44, 0x18, 0xc8, 0x46, 0x83,
+  0x34, 0x14, 0x26, 0x88, 0x41, 0x1c, 0x58, 0x42, 0x60, 0x42, 0x28, 0x80,
+  0x01, 0x11, 0x18, 0x1a, 0xd2, 0x84, 0x21, 0x01, 0x12, 0x12, 0x13, 0xe1,
+  0x81, 0x42, 0xc8, 0x18, 0x28, 0x18, 0x40, 0x48, 0x48, 0xfc, 0x26, 0xfe,
+  0x80, 0x93, 0x12, 0x90, 0x11, 0x28, 0x44, 0x30, 0x18, 0x00, 0x18, 0x1d,
+  0x1a, 0x82, 0x41, 0x21, 0xc4, 0x21, 0x17, 0x41, 0x14, 0x12, 0x43, 0x11,
+  0xe4, 0x11, 0x66, 0x14, 0xd0, 0x61, 0x12, 0x01, 0x14, 0x95, 0x62, 0x44,
+  0x49, 0x84, 0xbd, 0x22, 0x05, 0x34, 0x18, 0x12, 0xa1, 0x41, 0x30, 0x52,
+  0x84, 0x40, 0x11, 0xa1, 0x52, 0x21, 0x44, 0x00, 0x49, 0x01, 0x21, 0x64,
+  0x30, 0x14, 0x44, 0xf0, 0x64, 0x22, 0x14, 0x22, 0x41, 0x87, 0x41, 0x12,
+  0x25, 0x04, 0x84, 0x24, 0x81, 0x41, 0x61, 0x26, 0x28, 0x02, 0x45, 0x48,
+  0x44, 0x04, 0xc0, 0x14, 0x11, 0x16, 0x74, 0x2c, 0x21, 0x81, 0x22, 0x62,
+  0x84, 0x44, 0x00, 0x22, 0x11, 0x43, 0x04, 0x12, 0x21, 0x4a, 0x41, 0x29,
+  0x43, 0x04, 0x40, 0xc1, 0x21, 0x26, 0x18, 0x24, 0x02, 0x85, 0x91, 0x18,
+  0x10, 0x04, 0x80, 0x04, 0x20, 0x23, 0xb1, 0x54, 0x02, 0x20, 0x04, 0x22,
+  0x22, 0x12, 0x20, 0x12, 0x04, 0x47, 0x28, 0x20, 0x02, 0x12, 0x00, 0x89,
+  0x41, 0x01, 0x10, 0x02, 0x12, 0x40, 0x85, 0x21, 0x04, 0x30, 0x18, 0x91,
+  0x00, 0x54, 0x60, 0x44, 0x00, 0x48, 0x43, 0x51, 0x84, 0x00, 0x10, 0x04,
+  0x22, 0x52, 0x00, 0x12, 0x62, 0x18, 0x22, 0x10, 0x42, 0x24, 0xf1, 0xc8,
+  0xeb, 0x00, 0x00, 0x00, 0x85, 0x04, 0x44, 0x10, 0x02, 0x40, 0x18, 0x42,
+  0x02, 0x24, 0x54, 0x18, 0x81, 0x26, 0x48, 0x08, 0x83, 0x34, 0x44, 0x84,
+  0x00, 0x11, 0x84, 0x30, 0x44, 0x62, 0x02, 0x90, 0x10, 0x88, 0x01, 0x48,
+  0x18, 0x8c, 0x33, 0x11, 0x00, 0x74, 0x0c, 0xf0, 0xff, 0x0a, 0x80, 0x04,
+  0x42, 0xdf, 0x71, 0x01, 0x40, 0x54, 0x84, 0x2a, 0xd1, 0x42, 0x92, 0x14,
+  0xc0, 0x24, 0x24, 0x45, 0x82, 0x38, 0x28, 0x85, 0x02, 0x49, 0x11, 0x42,
+  0xc2, 0x18, 0x12, 0xc4, 0x99, 0x42, 0x58, 0x94, 0x83, 0x84, 0x56, 0xc1,
+  0x8c, 0x64, 0x44, 0x11, 0x20, 0x91, 0x44, 0x42, 0x42, 0x4d, 0x11, 0x21,
+  0x43, 0x11, 0x01, 0x43, 0x34, 0x14, 0xcc, 0x41, 0x81, 0x44, 0x98, 0x38,
+  0x2e, 0x11, 0xc0, 0x49, 0x8c, 0x81, 0x81, 0x81, 0x26, 0x21, 0x04, 0x48,
+  0x43, 0x02, 0x1d, 0x91, 0x20, 0x02, 0x18, 0x00, 0x84, 0x81, 0x10, 0x0e,
+  0x24, 0x00, 0x10, 0x18, 0x44, 0x14, 0x45, 0x21, 0x01, 0x43, 0x81, 0x02,
+  0x44, 0x22, 0x12, 0x00, 0x84, 0x89, 0x42, 0x48, 0x04, 0x00, 0x10, 0xa8,
+  0x21, 0x40, 0x08, 0x60, 0x12, 0x1a, 0x02, 0x00, 0x12, 0x00, 0x44, 0x80,
+  0x22, 0x02, 0x80, 0xc1, 0x42, 0xaf, 0x1c, 0x03, 0x22, 0x42, 0x28, 0x00,
+  0x84, 0x22, 0x45, 0x38, 0x24, 0x8c, 0x32, 0x68, 0x00, 0x00, 0x40, 0x44,
+  0x28, 0x12, 0x4c, 0x94, 0x58, 0x1c, 0x52, 0x12, 0x41, 0x84, 0x83, 0x41,
+  0x98, 0x59, 0x16, 0xc8, 0x2c, 0x89, 0x14, 0x48, 0x88, 0x12, 0x81, 0x04,
+  0x48, 0x81, 0x84, 0x87, 0x14, 0x38, 0x42, 0x88, 0x89, 0x02, 0x4a, 0x11,
+  0x48, 0x01, 0x20, 0x01, 0x40, 0x04, 0x12, 0x30, 0xfb, 0x00, 0x44, 0x18,
+  0x85, 0xc4, 0x22, 0x44, 0x00, 0x24, 0x00, 0x48, 0x2c, 0x42, 0x28, 0x12,
+  0x88, 0x41, 0x04, 0x28, 0x48, 0x22, 0x18, 0x83, 0x92, 0x29, 0x00, 0x51,
+  0x40, 0x04, 0x44, 0x18, 0x40, 0x01, 0x11, 0x40, 0xc8, 0x33, 0x00, 0x46,
+  0x48, 0x0a, 0x16, 0x91, 0x28, 0x24, 0x40, 0x18, 0x9c, 0x14, 0x84, 0x41,
+  0x41, 0x28, 0x80, 0xa4, 0x12, 0x4f, 0x14, 0x04, 0x20, 0x02, 0x40, 0x08,
+  0x26, 0x88, 0x62, 0x82, 0x00, 0x2a, 0x11, 0x04, 0x10, 0x58, 0x81, 0x11,
+  0x22, 0x11, 0x81, 0x4d, 0x11, 0x28, 0x80, 0x52, 0x41, 0x40, 0x81, 0x94,
+  0x41, 0x12, 0x3e, 0x00, 0xf0, 0x08, 0x00, 0x20, 0x42, 0x61, 0x11, 0x18,
+  0x12, 0x40, 0x05, 0x00, 0x14, 0x10, 0x18, 0x84, 0x01, 0x12, 0x00, 0xf0,
+  0x9f, 0x83, 0x40, 0x29, 0x51, 0x3c, 0x06, 0xf0, 0x2b, 0x90, 0x14, 0x4d,
+  0x11, 0x40, 0x88, 0x32, 0x28, 0x15, 0x04, 0x18, 0x00, 0x4a, 0x01, 0xc0,
+  0x44, 0x90, 0x12, 0x00, 0x44, 0x4c, 0x03, 0x21, 0x00, 0x10, 0x02, 0x15,
+  0x88, 0x01, 0x00, 0x99, 0x04, 0x14, 0x40, 0x15, 0x08, 0x62, 0x18, 0x41,
+  0x26, 0x18, 0x04, 0x41, 0x81, 0x40, 0xf8, 0x95, 0xc3, 0xa0, 0x68, 0x76,
+  0x18, 0x48, 0x0c, 0x00, 0x00, 0x80, 0x22, 0x66, 0x03, 0xf0, 0x53, 0x11,
+  0x18, 0x15, 0x84, 0x84, 0x21, 0x02, 0x10, 0x01, 0x40, 0x98, 0x49, 0x4d,
+  0x29, 0x48, 0x00, 0x40, 0x21, 0x91, 0x51, 0x00, 0x80, 0xa2, 0x41, 0x00,
+  0x1c, 0x02, 0x85, 0x21, 0x41, 0x08, 0x4b, 0x21, 0x20, 0x8a, 0x08, 0xc0,
+  0x21, 0x5f, 0xeb, 0x06, 0x10, 0x84, 0x22, 0x32, 0x24, 0x00, 0x00, 0x10,
+  0x18, 0x48, 0x48, 0x44, 0x01, 0x12, 0x00, 0x84, 0x00, 0x94, 0x40, 0x44,
+  0xc4, 0x48, 0x40, 0x08, 0x80, 0x61, 0x91, 0x1d, 0x24, 0x48, 0x00, 0x10,
+  0x18, 0x33, 0x28, 0x28, 0x14, 0x26, 0x08, 0xa0, 0x14, 0x49, 0x85, 0x01,
+  0x20, 0x01, 0x22, 0x83, 0x01, 0x18, 0x4a, 0x11, 0xf8, 0x8f, 0xbc, 0xc0,
+  0x1c, 0x89, 0x0d, 0xf0, 0x8c, 0x4a, 0x84, 0x82, 0x74, 0x42, 0x14, 0xc1,
+  0x28, 0x64, 0x12, 0x24, 0x00, 0x24, 0x28, 0x43, 0x02, 0x10, 0x08, 0x10,
+  0x24, 0xa1, 0x24, 0x22, 0x48, 0x14, 0x18, 0x44, 0x40, 0x02, 0x20, 0x01,
+  0x10, 0x42, 0xc1, 0xc8, 0x83, 0x7a, 0x82, 0x3c, 0x89, 0x4a, 0x42, 0x02,
+  0x24, 0x50, 0x28, 0xb0, 0x28, 0x41, 0x38, 0x88, 0xf0, 0x61, 0xba, 0x10,
+  0x14, 0x08, 0x48, 0x60, 0x43, 0x40, 0x84, 0x61, 0x41, 0x18, 0x16, 0x88,
+  0x81, 0x91, 0x18, 0x43, 0x01, 0x43, 0x81, 0x71, 0x14, 0x81, 0x01, 0x80,
+  0x04, 0x94, 0x80, 0x04, 0xe0, 0x41, 0x04, 0x28, 0x89, 0xa6, 0x21, 0x58,
+  0x52, 0x15, 0x08, 0x84, 0x13, 0xb1, 0x48, 0x02, 0x14, 0x68, 0x42, 0x00,
+  0x20, 0x94, 0x14, 0x81, 0x20, 0x22, 0x01, 0x43, 0x01, 0x42, 0xcf, 0x4d,
+  0x09, 0x16, 0x08, 0x45, 0x01, 0xc5, 0x01, 0x89, 0xa1, 0x12, 0x85, 0x01,
+  0x40, 0x04, 0x28, 0x44, 0x10, 0x48, 0x01, 0x28, 0x28, 0x14, 0x25, 0x58,
+  0x84, 0x19, 0x21, 0x81, 0x98, 0x12, 0x15, 0x54, 0x12, 0x20, 0x52, 0x14,
+  0x69, 0x41, 0x41, 0x08, 0x9a, 0x07, 0xf0, 0xff, 0xff, 0x13, 0x84, 0x18,
+  0x16, 0x54, 0x14, 0x4a, 0x12, 0x08, 0x00, 0x83, 0x41, 0x14, 0x08, 0xa5,
+  0x02, 0x2f, 0x4d, 0x0e, 0x2e, 0x14, 0x8f, 0x8a, 0x91, 0x14, 0x68, 0x4d,
+  0x22, 0x16, 0xa8, 0x32, 0x45, 0xfc, 0x24, 0x35, 0x16, 0xbc, 0x39, 0xe1,
+  0x82, 0x95, 0x15, 0xc0, 0x14, 0x65, 0xc8, 0x14, 0x47, 0x83, 0x18, 0x47,
+  0x43, 0x4f, 0xc2, 0xf5, 0x44, 0x21, 0x3e, 0x39, 0x41, 0x13, 0xc2, 0x1c,
+  0x18, 0xd5, 0xf4, 0x51, 0x54, 0x83, 0xf1, 0x14, 0x4c, 0x46, 0x98, 0x24,
+  0xef, 0x41, 0xe3, 0x33, 0x02, 0x16, 0x53, 0x89, 0x48, 0xbc, 0xf3, 0x11,
+  0x21, 0x4a, 0xb6, 0x28, 0xb6, 0x49, 0x54, 0x88, 0x36, 0xb1, 0x61, 0xe2,
+  0x44, 0x05, 0x22, 0x2d, 0x1c, 0x18, 0x26, 0x3c, 0x38, 0x4c, 0xb8, 0x18,
+  0x43, 0xf8, 0x48, 0x51, 0x8b, 0x22, 0x37, 0xfb, 0xb0, 0x14, 0xb4, 0x44,
+  0xa2, 0x23, 0x84, 0x26, 0x81, 0x12, 0x11, 0x42, 0x32, 0x24, 0xcc, 0xa4,
+  0x25, 0x89, 0x12, 0x78, 0x28, 0x58, 0x48, 0x12, 0x21, 0x10, 0x28, 0x64,
+  0x43, 0xf0, 0x61, 0x2c, 0x85, 0x15, 0x11, 0x08, 0xc5, 0xf1, 0x67, 0x6c,
+  0x87, 0x24, 0x41, 0x8d, 0x54, 0x17, 0x82, 0x1d, 0x44, 0x1c, 0x11, 0x41,
+  0xb1, 0x49, 0x01, 0x84, 0x9b, 0x12, 0x27, 0x14, 0x1e, 0x33, 0x8a, 0x9e,
+  0x38, 0x8f, 0x91, 0x38, 0x18, 0x4a, 0xd1, 0x18, 0x11, 0x54, 0xc4, 0x69,
+  0xd1, 0x44, 0x23, 0xf1, 0x24, 0x88, 0x81, 0x12, 0x18, 0xef, 0x63, 0x09,
+  0x19, 0xe2, 0x41, 0x54, 0xd8, 0xc5, 0x54, 0xc8, 0x45, 0x54, 0x88, 0x8b,
+  0x23, 0x85, 0x88, 0xa3, 0x24, 0xa1, 0xa4, 0x47, 0x81, 0x59, 0xe2, 0x11,
+  0x51, 0x89, 0x1d, 0x15, 0x2e, 0x21, 0x1d, 0x39, 0x2f, 0x11, 0x92, 0x59,
+  0x91, 0xa9, 0xd4, 0xa4, 0x72, 0x1c, 0xc1, 0x49, 0x2d, 0x51, 0x84, 0x1c,
+  0xe1, 0x12, 0xf3, 0x39, 0x64, 0x16, 0x88, 0x14, 0xa4, 0x41, 0x4a, 0x24,
+  0x61, 0xa1, 0x93, 0x13, 0x68, 0x91, 0x1f, 0x81, 0x41, 0x68, 0x14, 0x1f,
+  0xc4, 0x98, 0x12, 0x5d, 0x8b, 0x9d, 0x48, 0x1f, 0x84, 0x34, 0x18, 0x83,
+  0xb1, 0x18, 0x42, 0xf8, 0x26, 0x18, 0x44, 0x4b, 0x11, 0x8c, 0xd8, 0x82,
+  0xf4, 0x6d, 0xbb, 0x30, 0x41, 0x10, 0x21, 0x12, 0xb1, 0x22, 0x11, 0x31,
+  0x22, 0x13, 0x31, 0x22, 0x11, 0x21, 0x13, 0x11, 0x22, 0x11, 0x12, 0x91,
+  0x22, 0x13, 0x51, 0x42, 0x11, 0x4c, 0x02, 0x28, 0x24, 0x44, 0x15, 0x42,
+  0x44, 0x02, 0x55, 0x02, 0x47, 0x22, 0xc0, 0x12, 0xc0, 0x12, 0x40, 0x03,
+  0x2b, 0x12, 0x10, 0x22, 0x11, 0x22, 0x18, 0x22, 0x58, 0x12, 0x50, 0x42,
+  0x50, 0x42, 0x12, 0x2d, 0x24, 0x00, 0x82, 0x42, 0x9e, 0xc9, 0x14, 0x1f,
+  0x17, 0xf7, 0x21, 0x21, 0xd7, 0xc1, 0xc7, 0xd2, 0xc5, 0xf9, 0x1f, 0x1f,
+  0xaf, 0xa3, 0xf1, 0x3a, 0x3b, 0xef, 0x53, 0xf1, 0x37, 0x27, 0x27, 0xa2,
+  0xbf, 0xb1, 0xf5, 0x1b, 0x19, 0xaf, 0x61, 0xf1, 0x17, 0x17, 0x6d, 0x16,
+  0xef, 0xc1, 0xf1, 0x38, 0x1b, 0xaf, 0xa3, 0xf1, 0x1e, 0x3d, 0xcf, 0xc3,
+  0xf3, 0x2c, 0x7d, 0x5f, 0xc5, 0x77, 0x27, 0xff, 0x27, 0x2e, 0xa5, 0xfb,
+  0x5e, 0x4e, 0xd7, 0xd1, 0x2f, 0xd1, 0xf1, 0x52, 0x3f, 0xaf, 0xc3, 0xf3,
+  0x58, 0x38, 0x2f, 0xc7, 0xf7, 0x36, 0x3e, 0x6f, 0x47, 0xf7, 0x11, 0x12,
+  0x2f, 0x31, 0xf1, 0x13, 0x1a, 0x3f, 0x11, 0xf1, 0x39, 0x11, 0xbf, 0x31,
+  0x71, 0x5b, 0x7a, 0x12, 0xf3, 0x7b, 0x38, 0xaf, 0x2b, 0x53, 0x22, 0x3f,
+  0x3d, 0xbd, 0x43, 0xf1, 0x12, 0x12, 0xbf, 0x21, 0xf1, 0x4e, 0x42, 0xef,
+  0x81, 0xe1, 0x22, 0xf2, 0x3a, 0x3a, 0x25, 0xfa, 0x9a, 0x9c, 0xcf, 0xc8,
+  0xf8, 0x18, 0x18, 0xaf, 0xaa, 0xea, 0x97, 0x09, 0x4b, 0x77, 0x1f, 0x17,
+  0x72, 0x1d, 0x78, 0x2c, 0x7d, 0x2c, 0xfd, 0x3f, 0x1f, 0xbf, 0x93, 0xf1,
+  0x38, 0x19, 0xcf, 0x53, 0x71, 0x27, 0x57, 0xdf, 0x8f, 0x81, 0xf1, 0x18,
+  0x38, 0xff, 0x4a, 0x0d, 0xf0, 0x29, 0x5f, 0x51, 0xf1, 0x1d, 0x1f, 0xaf,
+  0xa1, 0xf1, 0x1a, 0x1a, 0xe7, 0x81, 0x6e, 0x62, 0x7d, 0x75, 0xdf, 0xd5,
+  0xd7, 0xd7, 0xf1, 0x2d, 0x2c, 0x8f, 0xa8, 0xf9, 0x5e, 0x4e, 0xdf, 0xd5,
+  0xfc, 0x16, 0x55, 0x2d, 0x76, 0xaf, 0xa1, 0xf7, 0x4f, 0x69, 0x2f, 0x47,
+  0xf7, 0x76, 0x56, 0xef, 0xe7, 0xb7, 0x53, 0xf5, 0x11, 0x19, 0x9f, 0xb1,
+  0xf1, 0x4a, 0x8e, 0x00, 0xf0, 0x39, 0x13, 0x13, 0xaf, 0x95, 0xf3, 0x51,
+  0x59, 0x9f, 0x95, 0xf1, 0x7b, 0x7b, 0xbf, 0xd4, 0xf4, 0x59, 0x51, 0x1f,
+  0x97, 0xd7, 0x22, 0xb4, 0x1a, 0xf3, 0x5c, 0x48, 0x8f, 0xa1, 0xf1, 0x2a,
+  0x2e, 0xed, 0x3c, 0xcf, 0xc8, 0xfa, 0x98, 0xba, 0xef, 0xc8, 0x78, 0x48,
+  0xf8, 0xea, 0xb8, 0x4d, 0x3c, 0xa0, 0x47, 0x1b, 0x73, 0x4f, 0xd1, 0xf1,
+  0x24, 0x24, 0x55, 0xfe, 0x3c, 0x3c, 0x37, 0x93, 0xcf, 0xc2, 0xf3, 0x3d,
+  0x16, 0xcf, 0x42, 0xf2, 0x2b, 0x2d, 0x8e, 0x00, 0xf5, 0xff, 0x76, 0x3a,
+  0x8d, 0x1c, 0x7f, 0x51, 0xb1, 0x14, 0xf1, 0x18, 0x12, 0xaf, 0x92, 0xf3,
+  0x35, 0x15, 0xcf, 0xf1, 0xf3, 0x1f, 0x3d, 0xff, 0xd7, 0xf7, 0x51, 0x71,
+  0x5f, 0x56, 0xf5, 0x25, 0x29, 0x4d, 0x8f, 0x5f, 0xd5, 0xf5, 0x16, 0x1c,
+  0x4f, 0x71, 0xe1, 0xd5, 0xf1, 0x31, 0x77, 0xaf, 0x11, 0xf7, 0x74, 0x76,
+  0x4f, 0xc3, 0xf3, 0x75, 0x7f, 0x37, 0x11, 0x1f, 0x11, 0x55, 0x99, 0x9f,
+  0xb1, 0xf1, 0x3b, 0x33, 0x1b, 0x31, 0x3f, 0x14, 0xf4, 0x11, 0x11, 0x9f,
+  0x37, 0xf7, 0x28, 0xa1, 0x2f, 0x5b, 0xf9, 0x51, 0x51, 0x1f, 0x3d, 0xfb,
+  0x51, 0x11, 0x3b, 0x55, 0x4b, 0x44, 0xc5, 0xfa, 0x36, 0x38, 0xcf, 0x83,
+  0xf3, 0x24, 0x3c, 0x8f, 0x49, 0x5b, 0xce, 0x8b, 0x98, 0x8f, 0x86, 0xd7,
+  0x59, 0x0a, 0x5f, 0x17, 0xb7, 0x35, 0xf7, 0x3c, 0x3d, 0xcf, 0xc2, 0xf2,
+  0x25, 0x2e, 0xdf, 0xd3, 0xf3, 0x3a, 0x2a, 0xef, 0xc2, 0xf3, 0x39, 0x32,
+  0x9f, 0x52, 0x52, 0xea, 0xad, 0x18, 0x9f, 0xb1, 0xd1, 0xdd, 0xf1, 0x16,
+  0x1e, 0x6f, 0x81, 0xb1, 0x18, 0xf1, 0x39, 0x3b, 0x7f, 0x53, 0x51, 0xfd,
+  0xf5, 0xfd, 0x6e, 0x7d, 0x9f, 0xa7, 0xf7, 0x65, 0x65, 0xdf, 0xf2, 0xf2,
+  0x1f, 0x8f, 0xdf, 0xd5, 0xf5, 0xdf, 0x5d, 0x4f, 0x75, 0xf5, 0x55, 0x57,
+  0x7f, 0x91, 0xf5, 0x3c, 0x79, 0x4f, 0x66, 0xf7, 0x74, 0x76, 0x7f, 0x97,
+  0xf7, 0x51, 0x51, 0x8f, 0x31, 0xf1, 0x1b, 0x1a, 0xbf, 0x81, 0xf1, 0x11,
+  0x32, 0x1e, 0x31, 0x3f, 0xb5, 0xf5, 0x12, 0x19, 0x9f, 0xa5, 0xf5, 0xa9,
+  0xa9, 0x3f, 0x3d, 0xfd, 0xd3, 0xd1, 0x1f, 0xbd, 0x7b, 0x41, 0xf9, 0x73,
+  0x53, 0xef, 0xc5, 0x74, 0x18, 0xfc, 0x28, 0x3e, 0xef, 0xe2, 0xf3, 0xbe,
+  0xbc, 0x8f, 0x8b, 0x5b, 0xce, 0x8f, 0xac, 0xfc, 0x68, 0x68, 0xaf, 0x4f,
+  0x09, 0x2a, 0x01, 0x40, 0x08, 0x10, 0x64, 0x81, 0x41, 0x00, 0x12, 0x20,
+  0x01, 0x84, 0x60, 0x81, 0x81, 0x10, 0x38, 0x11, 0x81, 0x00, 0x10, 0x88,
+  0x11, 0x88, 0x11, 0x08, 0x81, 0x2a, 0x01, 0x18, 0xc0, 0x11, 0x84, 0x18,
+  0x40, 0x01, 0x22, 0x00, 0x16, 0x08, 0x16, 0x08, 0x12, 0x44, 0xc0, 0x24,
+  0x12, 0x00, 0x00, 0xed, 0x9c, 0x70, 0x84, 0x31, 0x11, 0x40, 0x54, 0x14,
+  0x16, 0x78, 0x2e, 0x43, 0x64, 0x32, 0x17, 0xc1, 0x87, 0x24, 0x28, 0x14,
+  0x41, 0x25, 0x03, 0x54, 0x45, 0x58, 0x32, 0x47, 0x81, 0x8d, 0x31, 0x47,
+  0x82, 0x80, 0xc4, 0x25, 0x65, 0x7a, 0x48, 0x91, 0x15, 0xf0, 0x22, 0x12,
+  0x54, 0x40, 0x94, 0x46, 0xd0, 0x22, 0x04, 0x24, 0x40, 0x62, 0x81, 0x83,
+  0x12, 0xd1, 0x22, 0xd1, 0x81, 0xe2, 0x24, 0x91, 0x21, 0x30, 0x11, 0x27,
+  0x24, 0x8c, 0x04, 0x16, 0xd8, 0x2a, 0x52, 0x84, 0x81, 0x12, 0x81, 0x26,
+  0xf1, 0x2e, 0xb6, 0xb3, 0x0e, 0xc0, 0x48, 0x1f, 0x41, 0x32, 0x6a, 0x1d,
+  0x24, 0xab, 0x16, 0x1d, 0x24, 0xab, 0xf7, 0x0d, 0x74, 0x19, 0xb5, 0x4a,
+  0x39, 0x25, 0xaf, 0x14, 0xf7, 0x0d, 0xf0, 0x02, 0x95, 0x4f, 0x82, 0xc4,
+  0xb5, 0x4f, 0xa2, 0xc4, 0xa1, 0x4f, 0xa2, 0x64, 0x51, 0x4f, 0xa2, 0x64,
+  0x5d, 0x04, 0x00, 0x90, 0x4d, 0x4a, 0x9e, 0x24, 0xac, 0xf4, 0x91, 0x24,
+  0x2c, 0xb0, 0x0e, 0x41, 0xf2, 0x91, 0x24, 0x83, 0xb0, 0x0e, 0xe3, 0x91,
+  0x64, 0xab, 0x14, 0x1f, 0x48, 0xb6, 0x4a, 0xb9, 0x81, 0xb2, 0x4a, 0x99,
+  0x45, 0xb0, 0x0e, 0x40, 0xf3, 0x42, 0x94, 0x47, 0x39, 0x0e, 0xf1, 0x5e,
+  0x8a, 0x84, 0xf9, 0x24, 0x4a, 0xff, 0xcc, 0x0b, 0x24, 0x1e, 0x6c, 0x85,
+  0xe2, 0x41, 0x36, 0x48, 0x4c, 0x32, 0x48, 0x44, 0x83, 0x44, 0xf4, 0x48,
+  0x94, 0x28, 0x8f, 0x44, 0x1a, 0xb4, 0x48, 0x3a, 0x24, 0x8b, 0x94, 0x43,
+  0xe2, 0x14, 0x68, 0x82, 0x1c, 0x59, 0x82, 0x1c, 0xd9, 0x84, 0xc5, 0x81,
+  0x2e, 0xd8, 0x1e, 0x81, 0x2e, 0x48, 0x96, 0x61, 0x82, 0x86, 0x45, 0x69,
+  0x49, 0x9c, 0xf4, 0x81, 0x2c, 0x8c, 0xf4, 0x81, 0x64, 0x81, 0x1f, 0x49,
+  0x36, 0x48, 0x17, 0x48, 0x81, 0x1f, 0x48, 0x12, 0xd8, 0x41, 0xf2, 0x48,
+  0x14, 0x19, 0xd2, 0x48, 0x13, 0xb5, 0x48, 0x3b, 0x24, 0x8b, 0x94, 0x22,
+  0x4a, 0x48, 0x88, 0xf1, 0x26, 0x48, 0x18, 0x4f, 0x82, 0xf5, 0x18, 0x18,
+  0x00, 0x77, 0x0b, 0xf2, 0x03, 0x00, 0x40, 0x04, 0x00, 0x00, 0x20, 0x08,
+  0x21, 0x80, 0x41, 0x88, 0x08, 0x00, 0x14, 0x00, 0x00, 0x84, 0x21, 0x20,
+  0x0a, 0x10, 0x28, 0x2f, 0x05, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x10,
+  0x02, 0x2f, 0x4a, 0x09, 0x16, 0x04, 0xc1, 0x22, 0x90, 0x24, 0x84, 0x49,
+  0x02, 0x18, 0x90, 0x28, 0x40, 0x58, 0x18, 0x17, 0x41, 0x89, 0x33, 0x21,
+  0x12, 0x40, 0x31, 0x44, 0x60, 0x84, 0x44, 0x44, 0x46, 0xd5, 0xc1, 0x41,
+  0xc4, 0x18, 0x4f, 0x32, 0x11, 0x44, 0x08, 0x49, 0x23, 0x44, 0x22, 0x22,
+  0x43, 0xa8, 0x21, 0x22, 0x00, 0x22, 0x99, 0x14, 0x02, 0x18, 0x82, 0x48,
+  0x43, 0xc1, 0x54, 0x12, 0x21, 0x92, 0x30, 0x1c, 0xe0, 0xa3, 0x02, 0x1c,
+  0x32, 0xb2, 0x30, 0x1e, 0x16, 0x48, 0xe8, 0x41, 0x82, 0x94, 0x18, 0xb0,
+  0x18, 0x12, 0x42, 0x08, 0x16, 0x04, 0xc0, 0x18, 0x41, 0x4f, 0x8a, 0x05,
+  0x89, 0x48, 0x38, 0x81, 0xa4, 0x13, 0x14, 0x18, 0xd2, 0x21, 0x34, 0x44,
+  0x10, 0x88, 0xa2, 0x14, 0x14, 0x44, 0x14, 0x40, 0x11, 0x02, 0x16, 0xc4,
+  0x41, 0x85, 0xc4, 0x89, 0x22, 0x86, 0x63, 0x84, 0x1c, 0xc4, 0x4d, 0x80,
+  0x24, 0x92, 0x48, 0x84, 0x81, 0x16, 0x64, 0x1a, 0x46, 0xf4, 0x97, 0x61,
+  0x20, 0xa1, 0x34, 0xa4, 0x22, 0x84, 0x89, 0x92, 0x24, 0x26, 0x24, 0x01,
+  0xc7, 0x23, 0x83, 0x62, 0x82, 0x81, 0x5d, 0x18, 0x4c, 0xa1, 0x21, 0x89,
+  0x11, 0xf4, 0xa4, 0x58, 0x15, 0x52, 0x48, 0x84, 0x8b, 0xc1, 0x85, 0xb4,
+  0x86, 0xc4, 0x4a, 0x43, 0x31, 0x45, 0x23, 0xd5, 0x14, 0x11, 0x69, 0x82,
+  0x42, 0x8d, 0x15, 0x4c, 0x64, 0x34, 0x90, 0x21, 0x21, 0x28, 0x43, 0x02,
+  0xc0, 0xa1, 0x4f, 0x14, 0x02, 0x26, 0x48, 0xc1, 0xc8, 0x42, 0x49, 0xa5,
+  0x52, 0x1e, 0x4a, 0x40, 0x32, 0x14, 0xaa, 0x31, 0x14, 0x5f, 0x1e, 0x08,
+  0x47, 0x32, 0x10, 0x64, 0xc1, 0x18, 0x44, 0x89, 0x81, 0x14, 0x28, 0x01,
+  0x00, 0x00, 0x11, 0x81, 0x13, 0x82, 0x01, 0xa0, 0x48, 0x10, 0x01, 0x11,
+  0x54, 0x15, 0x08, 0x45, 0x88, 0x12, 0x06, 0x18, 0x28, 0x00, 0x22, 0x12,
+  0x81, 0x12, 0x18, 0x19, 0x14, 0x4c, 0x58, 0x28, 0x13, 0x38, 0x42, 0x1a,
+  0x44, 0x05, 0x10, 0x04, 0x84, 0x89, 0x09, 0x85, 0x84, 0xf4, 0x34, 0x6c,
+  0x30, 0x24, 0x28, 0xa0, 0x21, 0x22, 0x84, 0x81, 0x44, 0x24, 0x00, 0x1a,
+  0x14, 0x82, 0x94, 0x12, 0x1e, 0x48, 0x10, 0x41, 0x03, 0x20, 0x41, 0x04,
+  0x85, 0x34, 0x21, 0x1c, 0x02, 0xd0, 0x24, 0x84, 0xd2, 0x22, 0x04, 0x41,
+  0x4c, 0x12, 0x04, 0x29, 0x41, 0x34, 0x22, 0x13, 0x21, 0x42, 0x2c, 0x14,
+  0x01, 0x9a, 0x14, 0x12, 0x41, 0x14, 0x04, 0x12, 0x25, 0x24, 0x08, 0x82,
+  0x18, 0xe0, 0x34, 0x48, 0x11, 0x42, 0xe4, 0x22, 0x51, 0x38, 0x45, 0xf8,
+  0x62, 0x13, 0x2c, 0xd1, 0x28, 0x33, 0x21, 0x2e, 0x1a, 0x83, 0x42, 0x01,
+  0x27, 0x11, 0xc1, 0x25, 0x42, 0xc5, 0x5a, 0x28, 0x8f, 0x33, 0x64, 0x42,
+  0xcc, 0xb2, 0x48, 0x82, 0x54, 0x22, 0x2c, 0x44, 0xd8, 0x43, 0x71, 0x2e,
+  0x02, 0x41, 0x18, 0x45, 0xaa, 0x21, 0x27, 0x31, 0x24, 0x40, 0x18, 0x4a,
+  0x74, 0x4a, 0x92, 0x14, 0x26, 0x63, 0x82, 0x8d, 0xd2, 0x1a, 0x78, 0x21,
+  0x08, 0x8e, 0x54, 0x1d, 0x9a, 0xac, 0x65, 0x46, 0x89, 0xc2, 0x48, 0x8d,
+  0x14, 0xc1, 0x81, 0xc9, 0xc2, 0x24, 0x8f, 0x81, 0x06, 0x60, 0x42, 0x2c,
+  0x32, 0x21, 0x81, 0x91, 0x84, 0x43, 0x71, 0x22, 0x91, 0x32, 0x25, 0x38,
+  0x51, 0x21, 0x11, 0x12, 0x23, 0x55, 0x43, 0x46, 0x41, 0xc1, 0x11, 0x21,
+  0x41, 0x48, 0x2c, 0x44, 0x64, 0x34, 0x26, 0xd2, 0x14, 0x81, 0x52, 0x24,
+  0x4c, 0x72, 0x52, 0x52, 0x48, 0x6d, 0x22, 0x43, 0x12, 0x02, 0x23, 0x11,
+  0x58, 0x24, 0x58, 0x21, 0x24, 0x00, 0x21, 0x1f, 0x8e, 0x11, 0xa2, 0x48,
+  0x17, 0x21, 0x84, 0x23, 0x22, 0xd3, 0x82, 0xd4, 0x84, 0x18, 0x08, 0x16,
+  0x4c, 0xf2, 0xef, 0xa9, 0xd0, 0x42, 0x02, 0x18, 0x8d, 0x12, 0x43, 0xf2,
+  0x62, 0x12, 0x12, 0x2d, 0x28, 0x40, 0x88, 0x02, 0x90, 0x52, 0xe1, 0x81,
+  0x60, 0xa1, 0x28, 0x27, 0x86, 0x49, 0xc2, 0x38, 0xc3, 0x02, 0x81, 0x23,
+  0x52, 0x81, 0x50, 0x4a, 0x23, 0x04, 0x00, 0x18, 0x13, 0x41, 0x14, 0x42,
+  0x4a, 0x86, 0x52, 0x18, 0x1e, 0x24, 0x1d, 0x2c, 0x8b, 0x42, 0x1f, 0x89,
+  0x84, 0x09, 0x30, 0x15, 0x47, 0x88, 0x56, 0x64, 0x44, 0x84, 0x41, 0x12,
+  0x41, 0x8c, 0x28, 0x92, 0x24, 0xad, 0x1b, 0x24, 0x47, 0xa4, 0x42, 0x81,
+  0x90, 0x48, 0x18, 0x18, 0x81, 0x41, 0x22, 0x41, 0x11, 0x26, 0x22, 0x04,
+  0x80, 0x01, 0x41, 0x50, 0x28, 0xa0, 0x12, 0x26, 0x26, 0x41, 0x04, 0x22,
+  0x91, 0x80, 0x52, 0x48, 0x2a, 0x84, 0x32, 0x18, 0x20, 0x44, 0xc4, 0x11,
+  0x41, 0x21, 0x84, 0x81, 0x4c, 0x08, 0x47, 0x11, 0x8c, 0x21, 0x1a, 0xb6,
+  0x18, 0x24, 0x32, 0x84, 0x22, 0x12, 0x84, 0x80, 0x22, 0x44, 0xb2, 0x25,
+  0x01, 0x18, 0x52, 0x32, 0x21, 0x00, 0x48, 0x40, 0x48, 0x54, 0x86, 0x20,
+  0x02, 0x34, 0x41, 0x46, 0xd8, 0xa1, 0x04, 0x64, 0x4d, 0x42, 0x41, 0x20,
+  0x11, 0xe4, 0x14, 0x62, 0x81, 0x29, 0x84, 0x61, 0x44, 0x5c, 0xb1, 0x11,
+  0x22, 0x91, 0x18, 0x81, 0x42, 0x42, 0x14, 0x00, 0x83, 0x82, 0x08, 0x20,
+  0x54, 0x84, 0x20, 0x82, 0x01, 0x27, 0x24, 0x81, 0x20, 0x82, 0x62, 0x82,
+  0x6c, 0x21, 0xa1, 0xc1, 0xdf, 0x81, 0x0b, 0x28, 0x50, 0x41, 0x4b, 0x21,
+  0x70, 0x29, 0x54, 0x68, 0x1a, 0xb2, 0x12, 0x06, 0x00, 0x21, 0x14, 0xc3,
+  0x41, 0x02, 0x12, 0x18, 0x83, 0x22, 0x12, 0x48, 0x21, 0x84, 0x02, 0x22,
+  0xe4, 0x44, 0x81, 0x00, 0x61, 0x25, 0x04, 0x2d, 0x12, 0x41, 0x24, 0x80,
+  0x02, 0x44, 0x22, 0x42, 0x80, 0x28, 0x84, 0x81, 0x04, 0x81, 0x12, 0x64,
+  0x84, 0x12, 0x41, 0x40, 0x2c, 0xf2, 0x9b, 0xf5, 0x70, 0x42, 0x34, 0x12,
+  0x2e, 0x12, 0x43, 0x22, 0x34, 0x34, 0x81, 0xa3, 0x31, 0x34, 0x43, 0x02,
+  0x10, 0x12, 0x51, 0x2c, 0xf0, 0x12, 0x48, 0x48, 0x43, 0x31, 0x28, 0x2f,
+  0xc2, 0x54, 0x48, 0x60, 0x62, 0x26, 0x14, 0x64, 0x21, 0xcc, 0x92, 0x16,
+  0x42, 0x5c, 0xc1, 0x34, 0x6b, 0x41, 0xa1, 0x2c, 0xa1, 0x41, 0x25, 0x44,
+  0x14, 0x41, 0x94, 0x28, 0xc1, 0x28, 0x8e, 0x44, 0x90, 0x91, 0x83, 0x81,
+  0x89, 0x65, 0xa4, 0x83, 0x62, 0xc9, 0x28, 0x23, 0xe3, 0x81, 0x02, 0x4c,
+  0xb3, 0x48, 0xa1, 0x4a, 0x6f, 0xf4, 0x02, 0x2a, 0x01, 0xc5, 0x21, 0x11,
+  0x58, 0x81, 0x4b, 0x14, 0x28, 0xa3, 0x04, 0xa1, 0x11, 0x24, 0x48, 0x1c,
+  0x11, 0x04, 0x17, 0x81, 0x21, 0x41, 0x00, 0x1c, 0x83, 0x04, 0x1b, 0x42,
+  0x89, 0x82, 0x54, 0x18, 0x45, 0x88, 0x42, 0x88, 0xb2, 0x24, 0x01, 0x00,
+  0x34, 0x12, 0x26, 0x02, 0x88, 0x84, 0x80, 0x14, 0x88, 0x44, 0x12, 0x84,
+  0x81, 0x14, 0x12, 0x14, 0x08, 0x8d, 0x24, 0x40, 0x44, 0x62, 0xf7, 0x10,
+  0x24, 0x22, 0x82, 0x04, 0x76, 0x82, 0x22, 0x44, 0x38, 0x22, 0x58, 0x62,
+  0x41, 0x20, 0x04, 0x00, 0x24, 0x72, 0x40, 0x81, 0x82, 0x84, 0x82, 0x07,
+  0x00, 0x44, 0x24, 0x12, 0x00, 0x16, 0x04, 0x45, 0x02, 0x10, 0x0a, 0x00,
+  0x11, 0x84, 0x46, 0xc8, 0x48, 0x8e, 0x14, 0x81, 0x14, 0x81, 0x50, 0x48,
+  0x12, 0x84, 0xc2, 0x2a, 0xa4, 0x18, 0x42, 0xbb, 0x5d, 0x00, 0x89, 0x21,
+  0x01, 0x44, 0x00, 0x18, 0x00, 0x00, 0x42, 0x21, 0x2e, 0x12, 0x00, 0x80,
+  0x14, 0x08, 0x22, 0xa4, 0x4c, 0x52, 0x84, 0x40, 0x08, 0x28, 0x12, 0x40,
+  0x22, 0x91, 0x11, 0x10, 0x01, 0x20, 0x64, 0x15, 0x44, 0x60, 0x81, 0x12,
+  0x41, 0x82, 0x40, 0x1a, 0x24, 0x0c, 0x2c, 0x01, 0x88, 0x00, 0x18, 0x24,
+  0xf0, 0x7f, 0x2e, 0x20, 0x34, 0x44, 0xa0, 0x42, 0x84, 0x10, 0x88, 0x91,
+  0x12, 0x24, 0x00, 0x44, 0x21, 0x29, 0x62, 0x32, 0x12, 0x27, 0x22, 0x16,
+  0x42, 0x21, 0x42, 0x08, 0xa4, 0x24, 0xa4, 0x42, 0x46, 0x68, 0x21, 0xec,
+  0xd4, 0xa4, 0x01, 0x60, 0x84, 0xc0, 0x42, 0x46, 0x02, 0x32, 0x18, 0x18,
+  0x84, 0x20, 0x04, 0x18, 0x90, 0x24, 0x30, 0x28, 0x4c, 0x18, 0x0c, 0x21,
+  0x10, 0x04, 0x40, 0xb4, 0x88, 0x04, 0x00, 0x24, 0x80, 0x14, 0x88, 0x96,
+  0x28, 0x42, 0x40, 0x08, 0x29, 0x01, 0x00, 0x2a, 0x04, 0x60, 0x24, 0x8c,
+  0x81, 0x41, 0x08, 0x45, 0x18, 0x41, 0x68, 0x32, 0x15, 0xa8, 0x21, 0xc0,
+  0x48, 0x45, 0x4a, 0x12, 0x58, 0x82, 0x28, 0x44, 0x61, 0x00, 0x42, 0x89,
+  0x12, 0x98, 0x18, 0x90, 0x18, 0xc0, 0x22, 0x18, 0x48, 0x4a, 0x18, 0x3a,
+  0x44, 0x43, 0x82, 0x84, 0x81, 0x04, 0x6f, 0x97, 0x08, 0x27, 0x18, 0x12,
+  0x00, 0x21, 0x20, 0x04, 0x29, 0x44, 0x88, 0x01, 0x83, 0x04, 0x42, 0x28,
+  0x80, 0x81, 0x21, 0x22, 0x11, 0x28, 0x74, 0x22, 0x01, 0x24, 0x14, 0x00,
+  0x94, 0x18, 0x00, 0x80, 0x51, 0x24, 0xc1, 0x20, 0x14, 0x24, 0x24, 0xa1,
+  0x42, 0x20, 0x24, 0x08, 0x10, 0x14, 0x84, 0x11, 0xc8, 0x14, 0x10, 0x08,
+  0x84, 0x82, 0x14, 0xb7, 0xb8, 0xe0, 0x81, 0x22, 0x62, 0x21, 0x20, 0x92,
+  0x24, 0x12, 0x21, 0x22, 0x2d, 0x12, 0x22, 0x83, 0x04, 0x8c, 0x02, 0x12,
+  0x21, 0x80, 0x24, 0x11, 0x84, 0x92, 0x22, 0x84, 0x38, 0x28, 0x24, 0x28,
+  0x19, 0x84, 0x22, 0x72, 0x14, 0x92, 0x44, 0xac, 0x0b, 0xf2, 0xff, 0xf5,
+  0x02, 0x30, 0x18, 0x28, 0x40, 0x08, 0x11, 0x46, 0x14, 0x81, 0x21, 0x44,
+  0x88, 0x21, 0xb4, 0x52, 0x88, 0x62, 0x82, 0x28, 0x2a, 0xa1, 0x42, 0x3e,
+  0x7e, 0x00, 0x00, 0x40, 0x26, 0x04, 0x48, 0x00, 0x30, 0x12, 0x22, 0x80,
+  0x11, 0x82, 0x21, 0xd2, 0x82, 0x42, 0x04, 0x00, 0x24, 0x00, 0x00, 0x22,
+  0x00, 0x00, 0x58, 0xc0, 0x18, 0x40, 0x01, 0x21, 0x40, 0x21, 0x61, 0x41,
+  0x00, 0x40, 0xc2, 0x28, 0x00, 0x00, 0x80, 0x04, 0x88, 0x00, 0xd7, 0x51,
+  0x80, 0x04, 0x48, 0xd0, 0x22, 0x06, 0x2c, 0xc1, 0x28, 0x2a, 0x01, 0x2a,
+  0x14, 0x08, 0x10, 0x22, 0x61, 0x26, 0x1c, 0x81, 0x02, 0x28, 0x48, 0x12,
+  0x5c, 0x44, 0x42, 0x09, 0xa9, 0x64, 0x25, 0x14, 0x4a, 0x92, 0x48, 0x83,
+  0x54, 0x82, 0x80, 0x91, 0x28, 0x28, 0x12, 0x42, 0x60, 0x85, 0x20, 0x24,
+  0xd1, 0x84, 0x04, 0x00, 0x18, 0x4b, 0x41, 0x41, 0x1a, 0x44, 0x94, 0x44,
+  0x20, 0x24, 0xc2, 0x14, 0x4f, 0x63, 0x4a, 0x71, 0x33, 0x28, 0x84, 0x94,
+  0x21, 0x50, 0x28, 0x81, 0x40, 0xa8, 0x21, 0x81, 0x2f, 0x61, 0x22, 0xa1,
+  0x21, 0x00, 0x00, 0x40, 0x58, 0x28, 0x18, 0x21, 0x12, 0x19, 0x01, 0xa8,
+  0x15, 0x42, 0x68, 0x24, 0x95, 0x14, 0xc4, 0x11, 0x41, 0x25, 0x52, 0x84,
+  0xc0, 0x42, 0x22, 0x85, 0x54, 0xe2, 0x22, 0x40, 0x44, 0x84, 0xc1, 0x14,
+  0x8b, 0x14, 0x2c, 0xf3, 0x28, 0x84, 0x80, 0x04, 0x84, 0x40, 0x0c, 0x21,
+  0xd0, 0x23, 0x4a, 0x92, 0x44, 0x9a, 0x26, 0xd1, 0x22, 0xe6, 0xa4, 0xc2,
+  0x58, 0xa3, 0xa6, 0x65, 0x89, 0x92, 0x3a, 0x8c, 0x86, 0x17, 0x44, 0xb2,
+  0x22, 0x21, 0x92, 0x42, 0x38, 0x23, 0xf7, 0x44, 0x52, 0x8b, 0x31, 0x9d,
+  0x28, 0xf0, 0x69, 0x46, 0x61, 0x9b, 0x12, 0xe0, 0xa6, 0xd6, 0x3a, 0xf4,
+  0x79, 0x12, 0x85, 0x8e, 0xf5, 0x12, 0x44, 0x87, 0x94, 0xc4, 0x64, 0x29,
+  0x92, 0x22, 0x4a, 0xf7, 0x52, 0x14, 0x4d, 0x14, 0x9b, 0x25, 0x42, 0x4a,
+  0x45, 0xf4, 0x18, 0x58, 0x52, 0x1f, 0xe1, 0x72, 0x1c, 0x64, 0x1e, 0x18,
+  0xc7, 0xc1, 0x27, 0xa4, 0xda, 0xf9, 0x6c, 0x24, 0xc7, 0x84, 0x8c, 0xe9,
+  0x1a, 0x29, 0xf5, 0x65, 0x57, 0xa0, 0x23, 0x2a, 0x81, 0x21, 0x94, 0x46,
+  0x4e, 0x24, 0x1e, 0x3a, 0x2d, 0x18, 0x2b, 0x54, 0xe0, 0x24, 0x51, 0x8a,
+  0x5e, 0x12, 0x81, 0x1a, 0xc2, 0x11, 0x2e, 0x22, 0x36, 0xc2, 0x42, 0x87,
+  0x81, 0x26, 0x28, 0xf1, 0x28, 0x48, 0x4d, 0x21, 0x87, 0x92, 0x27, 0x14,
+  0xb4, 0x31, 0x1f, 0x83, 0xd1, 0x94, 0xb4, 0x66, 0x73, 0x4e, 0x54, 0xac,
+  0x6c, 0xe1, 0x21, 0xb1, 0x16, 0xc3, 0x48, 0x26, 0x62, 0x21, 0xc1, 0x87,
+  0x85, 0x2f, 0x82, 0xb1, 0x38, 0x52, 0x48, 0xc3, 0x11, 0x54, 0x88, 0xcb,
+  0x14, 0x21, 0xed, 0xa8, 0x88, 0x18, 0xcb, 0x11, 0xcd, 0x44, 0xe0, 0x42,
+  0x24, 0x85, 0xd4, 0x22, 0x74, 0xb2, 0x0c, 0x3f, 0x14, 0x71, 0x44, 0x68,
+  0x22, 0x13, 0x62, 0x42, 0xa7, 0x22, 0x48, 0x87, 0x22, 0x36, 0x6a, 0x23,
+  0xa3, 0x63, 0x27, 0xaf, 0x42, 0x34, 0x12, 0x4e, 0x42, 0x2f, 0x21, 0xa2,
+  0x15, 0x31, 0x8c, 0xf3, 0x22, 0x21, 0x45, 0xa2, 0x52, 0x2c, 0x73, 0x12,
+  0xc8, 0x26, 0xac, 0x92, 0x6a, 0x85, 0xa1, 0x24, 0x2d, 0x24, 0x16, 0x61,
+  0xa1, 0x4a, 0xb1, 0x16, 0x14, 0x66, 0x14, 0xc7, 0x62, 0x15, 0x34, 0x26,
+  0xbc, 0x04, 0x48, 0x8c, 0x71, 0x14, 0xe9, 0x84, 0xb1, 0xc1, 0x88, 0x25,
+  0xc8, 0x1a, 0x1e, 0x54, 0xcf, 0xc5, 0xe4, 0x2c, 0xc4, 0x44, 0x21, 0x8c,
+  0x24, 0xa8, 0x62, 0x1a, 0x72, 0x24, 0xf4, 0xf2, 0xb4, 0x14, 0x80, 0x01,
+  0x25, 0x41, 0x18, 0x44, 0x28, 0x22, 0x01, 0x00, 0x00, 0xc0, 0x21, 0x02,
+  0x00, 0xf0, 0x0f, 0x20, 0x14, 0x01, 0x11, 0x4a, 0x02, 0x42, 0x19, 0x21,
+  0x04, 0x42, 0x10, 0x11, 0x14, 0x21, 0x92, 0x41, 0x45, 0x92, 0x41, 0x22,
+  0x1d, 0x48, 0xb0, 0x11, 0x04, 0x13, 0x41, 0x84, 0x44, 0x02, 0x00, 0xf0,
+  0xff, 0xff, 0xdf, 0x04, 0x8b, 0x24, 0x40, 0xf4, 0x84, 0x94, 0x34, 0x5f,
+  0x57, 0xf6, 0x34, 0x24, 0x28, 0x1f, 0x32, 0xf2, 0x29, 0x61, 0xef, 0x23,
+  0xf2, 0x1a, 0x68, 0x8b, 0x11, 0x8f, 0x87, 0xa5, 0x22, 0xaf, 0x23, 0xe3,
+  0x22, 0xa2, 0x55, 0xa5, 0xb8, 0x42, 0x85, 0xf2, 0x51, 0x51, 0x1f, 0x21,
+  0xb3, 0x53, 0xb1, 0x32, 0xf1, 0x17, 0x1d, 0x1f, 0x84, 0xd5, 0x81, 0x71,
+  0x14, 0x5e, 0x87, 0x26, 0xa8, 0x22, 0xb4, 0x1f, 0xb2, 0xf5, 0x34, 0x7e,
+  0x7f, 0xc2, 0x56, 0xc4, 0x1e, 0x56, 0x8f, 0xc1, 0x54, 0x16, 0x25, 0x57,
+  0x31, 0xe0, 0x31, 0xd3, 0x32, 0xf1, 0x1f, 0x1b, 0x8b, 0x31, 0x8d, 0x11,
+  0x4f, 0x51, 0xd1, 0x55, 0xb1, 0xd8, 0xfd, 0x81, 0x81, 0x1f, 0x3c, 0xfd,
+  0x11, 0x1c, 0x4f, 0x18, 0xe9, 0xc4, 0x31, 0x4c, 0xef, 0x44, 0xf1, 0x96,
+  0x98, 0x4b, 0x26, 0x4f, 0x44, 0xa4, 0x64, 0x4a, 0xb4, 0x72, 0xf4, 0xf6,
+  0x72, 0x14, 0x4f, 0x54, 0xf4, 0x14, 0x64, 0x1e, 0x22, 0x3f, 0x12, 0xf2,
+  0x61, 0x63, 0x2f, 0x24, 0xf2, 0x4a, 0x42, 0xaf, 0x27, 0xf2, 0x7a, 0x78,
+  0x8f, 0xa2, 0xf2, 0x72, 0x56, 0x2f, 0x26, 0xf7, 0x5a, 0x7e, 0xa5, 0xba,
+  0x42, 0x75, 0x33, 0xf3, 0x73, 0x51, 0x1f, 0x22, 0xb3, 0x51, 0xf5, 0x3f,
+  0x5d, 0x7f, 0xd1, 0xf3, 0x53, 0x78, 0x1f, 0x84, 0xf5, 0x14, 0x1e, 0x65,
+  0xfc, 0xa1, 0x8a, 0xaf, 0xa6, 0xf6, 0x2b, 0x88, 0x97, 0xb2, 0x8f, 0xe3,
+  0xd4, 0xa6, 0x55, 0xd5, 0xcf, 0xa1, 0xf1, 0x1c, 0x5b, 0x6d, 0x1b, 0x25,
+  0xf3, 0x27, 0x67, 0x7d, 0x25, 0x6d, 0x27, 0xa5, 0xff, 0x5b, 0x5f, 0x17,
+  0x11, 0x8f, 0x17, 0xf7, 0x1c, 0x1d, 0xdf, 0xd4, 0xf5, 0xc9, 0x9d, 0x8f,
+  0x88, 0xe8, 0x8c, 0xfe, 0x17, 0x1e, 0xef, 0x5d, 0xe9, 0x8d, 0xf9, 0xdc,
+  0x94, 0xef, 0x41, 0xf1, 0xd2, 0x9c, 0x46, 0x74, 0x44, 0xb6, 0xfa, 0xac,
+  0xcf, 0x6f, 0x47, 0xf7, 0x6e, 0x75, 0x34, 0x7e, 0x65, 0x3e, 0x74, 0x2e,
+  0x32, 0x2f, 0x22, 0xd2, 0xf9, 0x74, 0x1e, 0xfe, 0x1a, 0x68, 0x8f, 0x83,
+  0xf3, 0x78, 0x78, 0x2a, 0xf3, 0x78, 0x7e, 0x6e, 0x22, 0x2b, 0x75, 0x85,
+  0xba, 0x52, 0xf5, 0x31, 0x31, 0x7a, 0xc5, 0x23, 0xaf, 0xa4, 0xf2, 0x23,
+  0x23, 0x6f, 0xc1, 0xf1, 0x42, 0x79, 0x9c, 0xf1, 0x44, 0x7f, 0x75, 0xcd,
+  0x89, 0x95, 0xf9, 0x61, 0x4b, 0x2e, 0x43, 0xcf, 0xf3, 0xf6, 0x27, 0x7f,
+  0x6f, 0xb4, 0xf4, 0x16, 0x5e, 0x6f, 0xa1, 0xe5, 0xc1, 0xf1, 0x31, 0x36,
+  0x6f, 0x42, 0x76, 0x25, 0xf7, 0x34, 0x36, 0xbf, 0x65, 0x55, 0x64, 0xbf,
+  0x14, 0xb6, 0x38, 0xf3, 0x59, 0x54, 0xcb, 0x11, 0x9f, 0x5d, 0x5d, 0x88,
+  0x8b, 0x75, 0xdf, 0xc1, 0xf1, 0x94, 0xdd, 0xcf, 0x85, 0xf1, 0x58, 0x16,
+  0xeb, 0x14, 0xef, 0xc9, 0xfd, 0xec, 0xac, 0x8f, 0xcc, 0xfc, 0x7a, 0x78,
+  0xea, 0xfc, 0x64, 0x56, 0xcf, 0x46, 0x4c, 0xf1, 0x61, 0x65, 0x1e, 0x24,
+  0x3e, 0x22, 0x2b, 0x22, 0x5f, 0x74, 0xf4, 0x56, 0x16, 0xaf, 0x25, 0xf5,
+  0x78, 0x32, 0xaf, 0x87, 0xa7, 0x33, 0x7e, 0x72, 0x7e, 0x32, 0xef, 0xa5,
+  0x55, 0xaa, 0x2b, 0x55, 0x3a, 0xf1, 0x71, 0x51, 0x2e, 0x23, 0xaf, 0x86,
+  0xf6, 0x2e, 0x7c, 0x7d, 0x35, 0x5e, 0x79, 0x4e, 0x51, 0x5f, 0xf4, 0xd7,
+  0x55, 0xd2, 0xb1, 0xf8, 0x4b, 0x49, 0xbf, 0xbe, 0x74, 0x69, 0xfa, 0x7d,
+  0x4f, 0x7f, 0x72, 0xe7, 0xd4, 0xf4, 0x5c, 0x1e, 0x9f, 0xe5, 0xf5, 0x12,
+  0x14, 0x3f, 0x21, 0xf1, 0x27, 0x27, 0x6d, 0x26, 0x6d, 0x26, 0xbf, 0x64,
+  0xf4, 0x49, 0x4f, 0xab, 0x44, 0x8b, 0x77, 0xdf, 0xc5, 0xf5, 0x45, 0x55,
+  0x8f, 0x8c, 0xf9, 0x48, 0x48, 0x9f, 0xb4, 0xf4, 0x1b, 0x1e, 0xef, 0x9d,
+  0xfd, 0xdc, 0x9c, 0x8b, 0xdd, 0x2d, 0x54, 0xef, 0xcd, 0xfd, 0xec, 0xac,
+  0x4f, 0x8e, 0xfe, 0x7a, 0x58, 0xbe, 0x82, 0x4f, 0x66, 0xb7, 0xa3, 0x06,
+  0x43, 0x02, 0x22, 0x20, 0x02, 0x22, 0x00, 0x40, 0x62, 0x81, 0x60, 0x81,
+  0x00, 0x28, 0x12, 0x8d, 0x22, 0x12, 0x28, 0x12, 0x00, 0x00, 0x83, 0x04,
+  0x80, 0xa1, 0x24, 0x49, 0x01, 0x61, 0xb0, 0x22, 0x01, 0x25, 0x01, 0x2d,
+  0x11, 0x48, 0x14, 0x48, 0x80, 0x04, 0x16, 0x48, 0x02, 0x44, 0x12, 0x20,
+  0x11, 0x08, 0x20, 0x21, 0x04, 0x6f, 0x7a, 0x04, 0x2b, 0x18, 0xa0, 0x12,
+  0x10, 0xaa, 0x41, 0x81, 0x48, 0x8d, 0x12, 0x28, 0x2a, 0x01, 0x81, 0x10,
+  0x32, 0x11, 0x21, 0x11, 0x90, 0x41, 0x30, 0x21, 0xb0, 0x21, 0x04, 0x11,
+  0x28, 0x22, 0x14, 0x8c, 0x44, 0x15, 0x42, 0xd4, 0x84, 0x14, 0x01, 0x1d,
+  0x24, 0x43, 0x02, 0xc1, 0x12, 0x90, 0x21, 0x50, 0xc1, 0x18, 0x19, 0x14,
+  0x38, 0x11, 0xa3, 0x04, 0x46, 0x14, 0x24, 0x04, 0x8d, 0x24, 0x2a, 0x04,
+  0x1c, 0xf4, 0xaa, 0x38, 0xd0, 0x22, 0xf4, 0x11, 0x24, 0x8d, 0x12, 0x1f,
+  0x41, 0x32, 0x4a, 0x1f, 0xc1, 0x36, 0x6a, 0x1f, 0xc1, 0xb6, 0x4a, 0xd1,
+  0x41, 0xb6, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x59, 0xb4, 0x4a, 0xb9, 0x24,
+  0xf4, 0x4a, 0xb1, 0x4b, 0x42, 0x2f, 0x14, 0xfb, 0x24, 0x48, 0x2d, 0xb1,
+  0x4f, 0x82, 0xe4, 0x14, 0xfb, 0x24, 0x4a, 0x4e, 0x81, 0x4f, 0xa2, 0x64,
+  0x15, 0x4f, 0xa2, 0xe4, 0x1d, 0xe2, 0xa2, 0x64, 0x5d, 0xac, 0xe5, 0x4d,
+  0xc2, 0x4a, 0x1f, 0x4d, 0xd2, 0x24, 0xf4, 0x91, 0x24, 0x87, 0x22, 0x1f,
+  0x49, 0x32, 0x4c, 0x1f, 0x49, 0x36, 0x6a, 0xb7, 0x0a, 0xf1, 0x09, 0xf1,
+  0x91, 0x6c, 0xab, 0x94, 0x1b, 0x61, 0xab, 0x94, 0x53, 0xf8, 0x4a, 0x94,
+  0x4b, 0x4a, 0xaf, 0x44, 0xb9, 0xa4, 0xf4, 0x42, 0x94, 0x4f, 0x82, 0x05,
+  0x00, 0xf0, 0x3a, 0x84, 0xfb, 0xa4, 0x4a, 0x3f, 0x5f, 0x09, 0x24, 0x1f,
+  0xc5, 0xd2, 0x28, 0xe4, 0x41, 0x12, 0xb8, 0x11, 0x16, 0xd8, 0x41, 0x96,
+  0x1a, 0x1d, 0x64, 0xad, 0x94, 0x19, 0xd6, 0x4a, 0x9b, 0x45, 0xa9, 0xbb,
+  0x24, 0xd4, 0x1a, 0x99, 0x44, 0x2d, 0x91, 0x2e, 0x48, 0x2d, 0x91, 0x65,
+  0xc8, 0x91, 0x6f, 0xa2, 0x85, 0xf8, 0x24, 0x9a, 0x1a, 0xd8, 0xa4, 0x64,
+  0x19, 0x26, 0x6a, 0x49, 0xbc, 0xe4, 0x48, 0x42, 0xfb, 0x91, 0x2c, 0x24,
+  0x1f, 0xc9, 0x54, 0x28, 0xc2, 0x0a, 0xf0, 0x13, 0x1f, 0x49, 0x32, 0x48,
+  0x17, 0x48, 0x23, 0xf4, 0x81, 0x24, 0xad, 0x14, 0x1b, 0x28, 0xad, 0xb4,
+  0x13, 0x98, 0x3a, 0xa2, 0xa9, 0x21, 0x8a, 0x61, 0x8a, 0x29, 0x39, 0x86,
+  0x18, 0x4f, 0x88, 0xf5, 0x52, 0xc9, 0xc2, 0x0a, 0x41, 0x80, 0x04, 0x40,
+  0x41, 0xc8, 0x0a, 0x91, 0x10, 0x02, 0x00, 0x88, 0x20, 0x04, 0x00, 0x14,
+  0x12, 0xbf, 0x0a, 0x02, 0x01, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xed, 0x10,
+  0x0a, 0xbf, 0x67, 0x0e, 0x22, 0x00, 0x2c, 0xe1, 0xa4, 0x82, 0x01, 0x80,
+  0xc1, 0x28, 0x42, 0x18, 0x8b, 0x41, 0x19, 0x11, 0x02, 0x84, 0x80, 0x95,
+  0x41, 0x19, 0xf2, 0x41, 0x28, 0x4a, 0xd2, 0x29, 0x22, 0x32, 0x48, 0x60,
+  0x12, 0x1a, 0x12, 0x01, 0x81, 0x63, 0x84, 0x78, 0x22, 0xc4, 0x14, 0x16,
+  0x72, 0xa4, 0x08, 0x30, 0x14, 0x83, 0xf4, 0x12, 0x44, 0x89, 0x64, 0x48,
+  0xd8, 0x83, 0x01, 0x41, 0x18, 0x80, 0x61, 0x4a, 0x85, 0x44, 0x68, 0x84,
+  0x84, 0x30, 0x24, 0xff, 0xda, 0x06, 0x43, 0xb4, 0x82, 0x01, 0xa1, 0x41,
+  0x8f, 0x22, 0x14, 0xd4, 0x2a, 0x52, 0x49, 0x30, 0x3a, 0x83, 0x14, 0x01,
+  0x50, 0x24, 0x1b, 0x41, 0x19, 0x33, 0x28, 0x26, 0x68, 0x41, 0x20, 0x81,
+  0x84, 0x84, 0x82, 0x51, 0x28, 0x20, 0x96, 0x1a, 0x48, 0x8b, 0x12, 0x5a,
+  0x42, 0x22, 0x14, 0xc2, 0x12, 0x85, 0x01, 0x14, 0x40, 0x29, 0x01, 0x84,
+  0x13, 0x32, 0xd8, 0x30, 0x88, 0x8a, 0xc1, 0xcc, 0x18, 0xc2, 0x63, 0x84,
+  0xc3, 0x54, 0x47, 0x18, 0x48, 0x6f, 0x8d, 0x02, 0x90, 0x12, 0xf0, 0x12,
+  0x42, 0x68, 0x27, 0x23, 0x24, 0x24, 0x17, 0x41, 0xd0, 0x84, 0x31, 0x48,
+  0x1b, 0x16, 0x12, 0x21, 0x45, 0x92, 0x41, 0x18, 0x58, 0x62, 0x15, 0x92,
+  0x48, 0x22, 0x1a, 0xb6, 0x22, 0xe4, 0x88, 0x86, 0x51, 0xa1, 0x32, 0x46,
+  0x91, 0x12, 0x13, 0x64, 0x41, 0x4a, 0x18, 0xbc, 0x46, 0x71, 0x42, 0xf2,
+  0x18, 0x26, 0x85, 0x01, 0x16, 0x85, 0xd4, 0x12, 0x61, 0x84, 0x82, 0x43,
+  0x65, 0x12, 0x8b, 0xd2, 0x44, 0x82, 0x82, 0xc9, 0x28, 0x21, 0x3c, 0x4a,
+  0xac, 0x75, 0x58, 0x64, 0x48, 0x56, 0xf4, 0xd4, 0x98, 0xb0, 0x24, 0x04,
+  0x40, 0x18, 0xcc, 0x48, 0x41, 0x8c, 0x12, 0xc8, 0x28, 0x23, 0x26, 0x11,
+  0x18, 0x01, 0x90, 0x18, 0x13, 0x92, 0x28, 0x15, 0xc8, 0x34, 0x13, 0xa2,
+  0x14, 0x15, 0x08, 0x00, 0x22, 0x20, 0x12, 0x48, 0xba, 0x48, 0xe2, 0x22,
+  0x81, 0x02, 0x12, 0x88, 0x00, 0x10, 0xc8, 0x4c, 0x18, 0x44, 0x89, 0x68,
+  0x81, 0x00, 0x89, 0x21, 0xa1, 0x14, 0x43, 0x5a, 0x48, 0x41, 0x28, 0x00,
+  0x22, 0x4f, 0x71, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x81, 0x84, 0x81, 0x86,
+  0x91, 0x41, 0x00, 0x24, 0x41, 0x25, 0x51, 0x81, 0x00, 0x80, 0x24, 0x44,
+  0x08, 0x24, 0x28, 0x84, 0x00, 0x4a, 0x82, 0x04, 0x61, 0x11, 0xc0, 0x24,
+  0x10, 0x21, 0x84, 0x14, 0x08, 0x21, 0x1a, 0x04, 0x15, 0x08, 0x40, 0x12,
+  0x84, 0x01, 0x00, 0xa0, 0x48, 0x42, 0xf0, 0xbb, 0xf3, 0x24, 0x18, 0x1b,
+  0x21, 0x1c, 0xc2, 0x18, 0x18, 0x8b, 0x42, 0x90, 0x18, 0x27, 0x82, 0x84,
+  0x00, 0x89, 0x51, 0xa1, 0x42, 0x85, 0x81, 0xae, 0x41, 0x33, 0x62, 0x34,
+  0x46, 0x49, 0xc1, 0x24, 0x4a, 0x42, 0x81, 0x92, 0x44, 0x12, 0x23, 0x62,
+  0x24, 0x11, 0x8c, 0x92, 0x12, 0x83, 0x44, 0x24, 0x64, 0x11, 0x29, 0x93,
+  0x86, 0x36, 0x28, 0x83, 0x44, 0xc4, 0x41, 0x2a, 0xc8, 0x49, 0xd8, 0x13,
+  0x99, 0x91, 0x8a, 0x81, 0x08, 0x48, 0x82, 0x8a, 0x97, 0x44, 0x84, 0x22,
+  0x84, 0xdf, 0x63, 0x09, 0x21, 0x2e, 0x11, 0x14, 0x81, 0x30, 0x48, 0x32,
+  0x52, 0x22, 0x80, 0x01, 0x12, 0x85, 0xc1, 0x42, 0x54, 0x70, 0x18, 0x11,
+  0x63, 0x34, 0x00, 0x4c, 0x14, 0x18, 0x21, 0xe2, 0x42, 0x14, 0x88, 0x02,
+  0x2a, 0xb4, 0x28, 0x04, 0x45, 0x58, 0x41, 0x20, 0x82, 0x11, 0xa7, 0x16,
+  0x00, 0x40, 0xa1, 0x1e, 0x87, 0x14, 0x19, 0x05, 0x13, 0xc8, 0x12, 0x86,
+  0x04, 0x00, 0xaa, 0x31, 0x44, 0x8a, 0xa4, 0x24, 0x81, 0xcf, 0xf7, 0x0c,
+  0x12, 0x80, 0x82, 0x81, 0x21, 0x02, 0xa4, 0x89, 0x31, 0x68, 0x90, 0x41,
+  0x81, 0x10, 0x42, 0xf8, 0x82, 0x61, 0x48, 0x28, 0x60, 0x94, 0x1c, 0x24,
+  0x82, 0x06, 0x10, 0xc2, 0x12, 0x80, 0x54, 0x12, 0x24, 0x16, 0x82, 0x04,
+  0x48, 0x7c, 0x81, 0x82, 0x48, 0xa8, 0x34, 0x8c, 0x44, 0x94, 0x42, 0x00,
+  0x83, 0x98, 0x91, 0x18, 0x88, 0x80, 0x81, 0x84, 0x88, 0x04, 0x84, 0x00,
+  0x9d, 0xa9, 0x10, 0x21, 0x44, 0x08, 0x42, 0x14, 0x26, 0x58, 0x18, 0x44,
+  0x95, 0x02, 0x2a, 0x21, 0x82, 0x04, 0x89, 0x72, 0x38, 0x04, 0x88, 0x46,
+  0x54, 0x61, 0x4e, 0x18, 0x22, 0x93, 0x01, 0x50, 0x21, 0x44, 0x11, 0x38,
+  0x15, 0x28, 0x21, 0x22, 0xe2, 0x22, 0x24, 0xa4, 0x14, 0x10, 0xf2, 0x12,
+  0x28, 0x44, 0x29, 0x86, 0x43, 0x21, 0x04, 0x20, 0x12, 0x82, 0xb4, 0x22,
+  0x38, 0x88, 0x84, 0x90, 0x28, 0x00, 0x60, 0x81, 0x9f, 0xf4, 0x4a, 0xc2,
+  0x28, 0x42, 0x12, 0x27, 0x42, 0x80, 0x01, 0x2b, 0x14, 0x1e, 0x28, 0x42,
+  0x40, 0x24, 0xc2, 0x11, 0x00, 0x21, 0x15, 0x88, 0x84, 0x42, 0x82, 0x12,
+  0x28, 0x64, 0x41, 0x28, 0x28, 0x10, 0x02, 0x41, 0x11, 0x40, 0x44, 0x18,
+  0x34, 0x42, 0x80, 0x08, 0x12, 0x18, 0x60, 0x84, 0x00, 0x41, 0x22, 0x20,
+  0x01, 0x28, 0x41, 0x12, 0x48, 0x8e, 0x41, 0x16, 0x04, 0xf0, 0x45, 0xa1,
+  0x20, 0x44, 0x14, 0x43, 0x72, 0x24, 0x08, 0x48, 0x22, 0x48, 0x22, 0x22,
+  0x84, 0xa5, 0x02, 0x83, 0x11, 0x81, 0x04, 0x14, 0x00, 0x80, 0x81, 0x08,
+  0x14, 0x80, 0x44, 0x18, 0x02, 0x42, 0x48, 0x12, 0x00, 0x40, 0xc4, 0x21,
+  0x20, 0x02, 0x21, 0x80, 0x81, 0x02, 0x86, 0xc8, 0x48, 0x20, 0x81, 0x64,
+  0x24, 0x82, 0x40, 0x89, 0xea, 0x81, 0x84, 0xf2, 0x79, 0xe2, 0x24, 0x13,
+  0x04, 0xa1, 0x27, 0x22, 0x26, 0x48, 0x91, 0x68, 0x20, 0x31, 0x68, 0x20,
+  0x52, 0xa2, 0x19, 0xc4, 0x18, 0x1d, 0x28, 0x1e, 0x24, 0x84, 0x1c, 0x34,
+  0x24, 0x15, 0xa4, 0x34, 0x83, 0xf2, 0x88, 0x41, 0x41, 0x26, 0x41, 0x41,
+  0x12, 0xa1, 0x12, 0x15, 0x28, 0x04, 0xa0, 0x24, 0x46, 0x04, 0xf0, 0x82,
+  0x22, 0x83, 0x82, 0x91, 0x12, 0x28, 0x94, 0x12, 0x22, 0x00, 0x84, 0x1a,
+  0x84, 0xe9, 0x82, 0x4c, 0x86, 0xc9, 0x28, 0x83, 0x88, 0x33, 0x18, 0x26,
+  0xf8, 0xc1, 0xcb, 0x20, 0x42, 0xc4, 0x11, 0x44, 0x43, 0x24, 0x41, 0xf2,
+  0x11, 0x68, 0xc3, 0x16, 0x31, 0x22, 0x16, 0x08, 0x12, 0x00, 0xa3, 0x14,
+  0x81, 0x88, 0x04, 0x84, 0x18, 0x00, 0x80, 0x92, 0x46, 0x81, 0x21, 0x44,
+  0x18, 0x4a, 0xb2, 0x24, 0x01, 0x25, 0x22, 0x11, 0x14, 0x81, 0xc1, 0x24,
+  0x66, 0x22, 0x21, 0x84, 0x04, 0xd0, 0x28, 0x88, 0x44, 0x22, 0x02, 0x8c,
+  0x04, 0x48, 0x42, 0x43, 0x28, 0x04, 0x6f, 0x82, 0x03, 0x19, 0x02, 0x2b,
+  0x21, 0x90, 0x22, 0x83, 0x04, 0x00, 0x80, 0x01, 0x21, 0x80, 0x04, 0x10,
+  0x38, 0x42, 0x14, 0x22, 0x00, 0x20, 0x22, 0x62, 0x12, 0x22, 0x80, 0x24,
+  0x02, 0x12, 0x00, 0x40, 0x09, 0x44, 0x4e, 0x21, 0x2a, 0x04, 0x00, 0xa0,
+  0x24, 0x16, 0x01, 0x21, 0x22, 0x00, 0x00, 0x82, 0x2a, 0x08, 0x4c, 0x84,
+  0xf4, 0xc5, 0x86, 0x00, 0x28, 0x41, 0x22, 0x42, 0x30, 0x42, 0x84, 0x23,
+  0x84, 0x11, 0x04, 0x00, 0x20, 0x24, 0x04, 0x81, 0x40, 0x02, 0x83, 0x81,
+  0x04, 0x10, 0x08, 0x60, 0x12, 0x00, 0x20, 0x01, 0x80, 0x31, 0x11, 0x42,
+  0x00, 0x49, 0xc2, 0x24, 0x28, 0x19, 0xc2, 0x81, 0x22, 0x1c, 0xc8, 0x11,
+  0x4a, 0x28, 0x08, 0x88, 0x8d, 0x51, 0x18, 0x48, 0x90, 0x88, 0xb0, 0xef,
+  0x07, 0x20, 0x41, 0x01, 0x14, 0x12, 0x11, 0x22, 0x02, 0x00, 0xf0, 0x32,
+  0x22, 0x00, 0x4e, 0x28, 0x90, 0x28, 0x80, 0x02, 0x28, 0x1c, 0x22, 0x02,
+  0x18, 0x80, 0x04, 0x00, 0x24, 0x22, 0x34, 0x00, 0x20, 0x81, 0x02, 0x20,
+  0x24, 0x84, 0x01, 0x20, 0x49, 0x04, 0x00, 0xc8, 0x00, 0x22, 0x12, 0x42,
+  0x00, 0x5f, 0xa1, 0x07, 0x42, 0x81, 0x12, 0x42, 0x81, 0x62, 0x89, 0x02,
+  0x81, 0x30, 0x48, 0x00, 0x28, 0x85, 0x04, 0xa1, 0x11, 0x00, 0x4c, 0x82,
+  0x44, 0x42, 0x41, 0x14, 0x01, 0xdb, 0x09, 0xa0, 0x14, 0x20, 0x04, 0x46,
+  0x88, 0x82, 0x41, 0x04, 0x40, 0x98, 0x22, 0x0f, 0xf0, 0x0c, 0x01, 0x19,
+  0x81, 0x01, 0x18, 0x22, 0x80, 0x01, 0x9f, 0x71, 0x01, 0x82, 0x00, 0x22,
+  0x00, 0x89, 0x84, 0xc4, 0x48, 0x1a, 0x44, 0x88, 0x02, 0x80, 0x23, 0x42,
+  0x81, 0x36, 0x08, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x21, 0x70, 0x42,
+  0x41, 0x42, 0x01, 0x00, 0x80, 0x41, 0x21, 0x24, 0x54, 0x21, 0x00, 0x21,
+  0x14, 0x21, 0x30, 0x41, 0xf0, 0x22, 0x41, 0x00, 0x2c, 0x08, 0x98, 0x62,
+  0x82, 0x00, 0xc8, 0x18, 0xb0, 0xa7, 0x07, 0x22, 0xa0, 0x42, 0x20, 0x02,
+  0x18, 0x28, 0x22, 0x00, 0x48, 0x00, 0x21, 0x20, 0x05, 0x22, 0x28, 0x00,
+  0x00, 0x28, 0x80, 0x02, 0x44, 0x80, 0x26, 0x02, 0x22, 0x81, 0xa4, 0x12,
+  0x48, 0x41, 0x14, 0x14, 0x22, 0x1e, 0x21, 0x13, 0x92, 0x22, 0x00, 0x11,
+  0x68, 0x20, 0x0c, 0x86, 0xa8, 0x21, 0x82, 0x12, 0x4c, 0xa1, 0x84, 0x82,
+  0xcf, 0xe4, 0x05, 0x44, 0x32, 0x24, 0x50, 0x84, 0x10, 0x04, 0x41, 0x84,
+  0x42, 0x00, 0x28, 0x42, 0x00, 0x00, 0x14, 0x8c, 0x61, 0x14, 0x00, 0x9c,
+  0x24, 0x32, 0x14, 0x14, 0x89, 0xc1, 0x21, 0x81, 0x40, 0x11, 0x88, 0x41,
+  0x41, 0x41, 0x84, 0x01, 0x28, 0x00, 0x00, 0x40, 0x84, 0x12, 0x81, 0x12,
+  0x08, 0x00, 0x60, 0x88, 0x10, 0x24, 0xf4, 0xd9, 0x54, 0x00, 0x84, 0x20,
+  0x04, 0x00, 0x00, 0x30, 0x33, 0x40, 0x04, 0x8c, 0x12, 0x01, 0x19, 0x04,
+  0x50, 0x12, 0x13, 0x02, 0x31, 0x48, 0x00, 0x14, 0x00, 0x1c, 0x04, 0x1a,
+  0x22, 0x24, 0x12, 0x01, 0x10, 0x01, 0x10, 0x11, 0x34, 0x11, 0x42, 0x82,
+  0x20, 0x88, 0x8c, 0x01, 0x20, 0x81, 0x82, 0x04, 0x00, 0x88, 0xcf, 0x44,
+  0x06, 0x8c, 0x84, 0x84, 0x04, 0x80, 0x02, 0x42, 0x12, 0x4a, 0x02, 0x87,
+  0x44, 0x12, 0x28, 0x00, 0x26, 0x04, 0x44, 0x80, 0x04, 0x35, 0x84, 0x82,
+  0xb1, 0x11, 0x84, 0x88, 0x04, 0x80, 0x81, 0x44, 0x81, 0x02, 0x84, 0x90,
+  0x44, 0x20, 0x44, 0x28, 0xc4, 0x18, 0x42, 0x20, 0x44, 0x2c, 0x84, 0x22,
+  0x84, 0x21, 0x04, 0x23, 0x84, 0x02, 0x10, 0x02, 0x8f, 0xba, 0x08, 0x1c,
+  0xa2, 0x38, 0x2d, 0x32, 0x2a, 0xd4, 0x4b, 0x82, 0x04, 0x8c, 0x04, 0x68,
+  0x9f, 0x44, 0x45, 0xc8, 0x24, 0xa0, 0x22, 0x9f, 0x22, 0x04, 0x11, 0x83,
+  0xb2, 0x21, 0x02, 0x35, 0x41, 0x74, 0x43, 0x32, 0x24, 0x1f, 0x22, 0x72,
+  0x35, 0xa1, 0x24, 0x84, 0x30, 0x32, 0xa0, 0x13, 0xf0, 0x18, 0x21, 0x11,
+  0x1c, 0xf1, 0x14, 0x14, 0x13, 0xe6, 0x12, 0x14, 0x42, 0x21, 0xd2, 0x11,
+  0xa1, 0x42, 0x26, 0xe1, 0x87, 0xb8, 0x21, 0x98, 0x48, 0x88, 0xa3, 0x84,
+  0xa4, 0x85, 0xa9, 0xa8, 0x19, 0x4a, 0x83, 0xd1, 0x44, 0x0d, 0xff, 0xd7,
+  0x07, 0x48, 0x83, 0x12, 0x01, 0x48, 0x4e, 0x1a, 0x56, 0x44, 0xb2, 0x49,
+  0x92, 0x18, 0x23, 0x63, 0x24, 0x18, 0xb0, 0x48, 0x21, 0x84, 0x66, 0x22,
+  0x44, 0x14, 0x67, 0x96, 0x2a, 0x34, 0x29, 0x14, 0x4a, 0xc4, 0x51, 0x48,
+  0x1d, 0x43, 0x14, 0x15, 0x41, 0x89, 0x96, 0x22, 0x1a, 0x16, 0x43, 0x91,
+  0x41, 0x24, 0x4b, 0x41, 0x13, 0x94, 0x21, 0x62, 0x7f, 0xc4, 0x23, 0xf7,
+  0x49, 0x21, 0xca, 0x8c, 0x61, 0x3c, 0x52, 0xe2, 0x1a, 0xa8, 0x14, 0xa2,
+  0x6a, 0x83, 0xe8, 0x88, 0x88, 0x3c, 0x88, 0xca, 0xfc, 0x68, 0x79, 0x60,
+  0x46, 0x56, 0x38, 0x34, 0x4a, 0x62, 0x82, 0x2a, 0xd2, 0x89, 0xa6, 0x26,
+  0xcc, 0x25, 0x47, 0xa9, 0x62, 0x00, 0x6d, 0x48, 0x28, 0x4e, 0x1d, 0x8d,
+  0x69, 0x58, 0x80, 0xa3, 0x24, 0x16, 0xa3, 0x22, 0x9c, 0x22, 0x91, 0x28,
+  0x30, 0x14, 0x6a, 0xa2, 0x64, 0x00, 0x1f, 0x82, 0x01, 0x2c, 0x64, 0x85,
+  0x15, 0x51, 0x48, 0x28, 0x2e, 0x58, 0x5d, 0x64, 0x12, 0x28, 0x21, 0x19,
+  0xd2, 0x13, 0x32, 0x14, 0x17, 0x18, 0x1a, 0x27, 0xa8, 0x89, 0x89, 0xa1,
+  0x41, 0x2a, 0x26, 0x33, 0x44, 0x52, 0x70, 0x65, 0x01, 0x17, 0x44, 0x2b,
+  0x12, 0x15, 0x34, 0x22, 0x15, 0x24, 0x52, 0x41, 0x50, 0x41, 0xa0, 0x41,
+  0x00, 0x90, 0x44, 0x10, 0x05, 0x55, 0x88, 0x52, 0x85, 0x50, 0x84, 0x28,
+  0x55, 0x88, 0x52, 0x84, 0x50, 0x81, 0x28, 0x15, 0x08, 0x8c, 0x01, 0x00,
+  0x18, 0x50, 0x18, 0x70, 0x2a, 0x01, 0xa5, 0x21, 0x11, 0x0a, 0xa3, 0x02,
+  0xa1, 0x10, 0x2a, 0x18, 0x7a, 0x11, 0x88, 0x62, 0x89, 0x44, 0x84, 0x42,
+  0xdb, 0xdb, 0x14, 0x4f, 0x74, 0xf2, 0x17, 0x2f, 0x2f, 0x41, 0xd2, 0x77,
+  0xf2, 0x4f, 0x25, 0xdf, 0x54, 0xf2, 0x48, 0x48, 0x5f, 0x54, 0xf4, 0x7d,
+  0x7d, 0x5f, 0x62, 0xd6, 0x9a, 0x87, 0xe2, 0x41, 0x51, 0x64, 0x6f, 0x41,
+  0x71, 0x24, 0xb4, 0x75, 0x55, 0x41, 0x1f, 0xc1, 0x51, 0xec, 0xaf, 0x83,
+  0x71, 0x48, 0x5d, 0xd1, 0xc7, 0xe2, 0xa7, 0x82, 0xcf, 0xf2, 0xf5, 0x37,
+  0x1c, 0x85, 0xfa, 0x1e, 0x1c, 0x87, 0x82, 0x3a, 0x55, 0x88, 0x87, 0x81,
+  0x4a, 0xf6, 0x11, 0x31, 0x1f, 0x24, 0x54, 0x93, 0xd5, 0xfa, 0x1a, 0x18,
+  0x9f, 0x84, 0xd2, 0x28, 0x72, 0x22, 0xfe, 0x22, 0x2e, 0xaf, 0x82, 0xf2,
+  0x61, 0x23, 0x3f, 0xa8, 0xda, 0xb2, 0xf2, 0x8b, 0x8c, 0x27, 0x24, 0xbf,
+  0xb9, 0xd9, 0xaa, 0xf8, 0x1a, 0x18, 0x26, 0xf2, 0x62, 0x98, 0x9f, 0x8b,
+  0xf9, 0x38, 0xd8, 0x8f, 0xc8, 0xfc, 0x94, 0xdc, 0x8d, 0x48, 0x2f, 0xfd,
+  0x43, 0xc1, 0x43, 0x3f, 0xb1, 0x56, 0x53, 0x6d, 0x26, 0xa3, 0xf4, 0x59,
+  0x31, 0xdf, 0xd7, 0xf7, 0x64, 0x24, 0x8f, 0x85, 0x55, 0x31, 0xff, 0xc4,
+  0xa2, 0x24, 0x1a, 0x43, 0xf2, 0x5a, 0x58, 0xc7, 0xc6, 0xdf, 0x87, 0xf5,
+  0x29, 0x2c, 0x1f, 0xc3, 0x73, 0x2c, 0xff, 0x36, 0x14, 0x3f, 0x56, 0xf2,
+  0x21, 0x2d, 0xdf, 0xf2, 0xf1, 0x46, 0x44, 0x1f, 0x38, 0xff, 0x53, 0x59,
+  0xcd, 0x8e, 0x3b, 0x11, 0x1c, 0xf2, 0x18, 0x58, 0x9f, 0x94, 0xf4, 0x28,
+  0x28, 0x4e, 0x41, 0x9f, 0x93, 0xf3, 0x41, 0x43, 0x3f, 0x11, 0x61, 0x31,
+  0x2b, 0x15, 0x87, 0xa4, 0xa7, 0x22, 0x65, 0xed, 0xc6, 0xf7, 0x58, 0x7b,
+  0xbf, 0xa6, 0xf2, 0xc7, 0xcd, 0x1f, 0x91, 0xf3, 0xd9, 0xfd, 0xa7, 0xa4,
+  0x3f, 0x1d, 0x0d, 0x8f, 0x89, 0xf9, 0xe8, 0x6a, 0x2f, 0x9d, 0xf9, 0x38,
+  0x98, 0x2c, 0xdd, 0x42, 0xe4, 0xd5, 0xf5, 0x4a, 0x98, 0x3f, 0x1a, 0x0d,
+  0x1b, 0x64, 0x2b, 0x61, 0x7f, 0x31, 0xd2, 0x42, 0xd2, 0x8a, 0xa2, 0x31,
+  0xdf, 0x55, 0xb5, 0x28, 0xa2, 0x77, 0x1f, 0x24, 0xf4, 0x5a, 0x55, 0x8b,
+  0x26, 0x1a, 0x43, 0xf2, 0x1a, 0x58, 0x4f, 0x12, 0xf6, 0x59, 0x15, 0x9b,
+  0x26, 0xdb, 0x11, 0x1d, 0x2b, 0x7f, 0x53, 0xf5, 0x63, 0x61, 0xdf, 0x14,
+  0xf4, 0x61, 0x5a, 0x77, 0x42, 0x1f, 0x32, 0xfc, 0x3b, 0x11, 0x1f, 0xb4,
+  0xf4, 0x57, 0x55, 0x1f, 0x16, 0xf4, 0x39, 0x59, 0x2e, 0x21, 0x3a, 0xf3,
+  0x48, 0x68, 0x1f, 0x91, 0xf3, 0x41, 0x43, 0x3b, 0x51, 0x17, 0x71, 0x7f,
+  0x51, 0xf1, 0x49, 0x22, 0x3f, 0x94, 0xf6, 0x61, 0x44, 0x9f, 0x52, 0xf3,
+  0x11, 0x32, 0xbf, 0x9e, 0xea, 0x58, 0xfa, 0x49, 0x71, 0x1d, 0x33, 0x9f,
+  0x94, 0xd9, 0x13, 0xa9, 0xd4, 0xce, 0xd2, 0xaf, 0x82, 0xb1, 0x68, 0xe9,
+  0x9f, 0xa5, 0x13, 0x6f, 0x4c, 0xdc, 0x48, 0xc4, 0xd8, 0x1f, 0x32, 0x06,
+  0x5f, 0x42, 0xf4, 0x3b, 0x31, 0x6f, 0x22, 0xf1, 0x22, 0x24, 0xff, 0xd6,
+  0xf4, 0x71, 0x71, 0x8b, 0x55, 0xcf, 0x46, 0xf2, 0x7d, 0x7d, 0x9d, 0x4b,
+  0xb7, 0x44, 0x8b, 0x26, 0x1a, 0x41, 0xf2, 0x5e, 0x5c, 0x4f, 0x16, 0xf2,
+  0x59, 0x15, 0x9f, 0x16, 0xf2, 0x1d, 0x11, 0x4f, 0xf2, 0xf2, 0x3b, 0x59,
+  0x1f, 0x16, 0xf6, 0x4d, 0x41, 0x5f, 0xf6, 0xf6, 0x4b, 0x69, 0x3e, 0xe3,
+  0xff, 0x47, 0xf5, 0xc4, 0x4f, 0xbf, 0x95, 0xe5, 0x16, 0xf6, 0x31, 0x51,
+  0x8f, 0x94, 0xa4, 0x22, 0x9f, 0x84, 0xf4, 0x31, 0x39, 0x1f, 0x34, 0xf4,
+  0x12, 0x11, 0x57, 0x71, 0xff, 0xd1, 0xf1, 0x49, 0x21, 0x1f, 0xb6, 0xf6,
+  0x63, 0x67, 0xbf, 0x56, 0xf7, 0x59, 0x59, 0xee, 0xa3, 0x3f, 0x7e, 0xfc,
+  0xea, 0xf1, 0xdf, 0xac, 0xfd, 0x41, 0x91, 0x3f, 0x34, 0xfd, 0x4a, 0x58,
+  0x8f, 0xac, 0xbd, 0xf2, 0xb7, 0xd8, 0xe9, 0x87, 0xff, 0x18, 0xb8, 0x6f,
+  0x4d, 0xfd, 0x1c, 0x56, 0x8c, 0xf8, 0xda, 0xf7, 0x00, 0x00, 0x00, 0x48,
+  0x18, 0x48, 0xc8, 0x08, 0x70, 0x28, 0x00, 0x00, 0x11, 0x00, 0x10, 0x01,
+  0x6a, 0x0e, 0xa0, 0x40, 0x01, 0x45, 0x01, 0x00, 0x22, 0x20, 0x02, 0x14,
+  0x40, 0xad, 0x07, 0xf1, 0xa0, 0x42, 0x00, 0xf0, 0xd7, 0x3d, 0x20, 0x6a,
+  0x41, 0x47, 0x12, 0x11, 0xd0, 0x41, 0x06, 0x1d, 0x64, 0x43, 0x16, 0x81,
+  0x81, 0x06, 0x40, 0x94, 0x41, 0x4e, 0x24, 0x11, 0x4c, 0x52, 0x84, 0x8d,
+  0x21, 0xc0, 0x24, 0x26, 0x58, 0x48, 0x22, 0x85, 0x04, 0x54, 0x15, 0x88,
+  0x62, 0x82, 0x12, 0x26, 0x08, 0x00, 0x18, 0xc4, 0x14, 0x8c, 0x72, 0x2a,
+  0x01, 0x2d, 0x11, 0x8c, 0xd2, 0x22, 0xc8, 0x28, 0x88, 0x84, 0x29, 0x48,
+  0x98, 0x82, 0x84, 0xa9, 0x2b, 0xb3, 0x48, 0x28, 0x98, 0x88, 0x8e, 0x42,
+  0x4f, 0x9f, 0x07, 0x2e, 0x42, 0x1f, 0x41, 0xf2, 0x28, 0x12, 0x1f, 0x41,
+  0x72, 0x68, 0xf2, 0x11, 0x24, 0xa7, 0x24, 0x1d, 0x24, 0xab, 0x14, 0x1f,
+  0x41, 0xf2, 0x4a, 0x92, 0x19, 0xb6, 0x4a, 0x19, 0xf5, 0x4a, 0x92, 0x4b,
+  0x42, 0xaf, 0x34, 0x39, 0x24, 0x2f, 0x14, 0xf9, 0x24, 0x48, 0x2f, 0x14,
+  0xfb, 0x34, 0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x4e, 0xa1, 0x4f, 0xa2, 0xe4,
+  0x15, 0xf2, 0x24, 0x4a, 0x9e, 0x21, 0x2e, 0x4a, 0xde, 0x25, 0x2d, 0x4a,
+  0x9e, 0x24, 0x2d, 0x5a, 0x1f, 0x49, 0xd2, 0x22, 0xf4, 0x91, 0x24, 0x8f,
+  0x22, 0xf1, 0x91, 0x24, 0x83, 0xf6, 0x91, 0x64, 0xab, 0x14, 0x1f, 0x49,
+  0x87, 0x0a, 0x32, 0x6a, 0x99, 0x61, 0x87, 0x0a, 0xf0, 0x62, 0xa4, 0xb4,
+  0x4a, 0xb9, 0x34, 0xb4, 0x42, 0xf9, 0xb4, 0x48, 0x29, 0xfb, 0x24, 0x48,
+  0x4a, 0xf9, 0xa4, 0x4a, 0x4f, 0x52, 0x09, 0x48, 0x1d, 0x48, 0x81, 0x1b,
+  0x41, 0x81, 0x13, 0x31, 0x48, 0x19, 0xb2, 0x4a, 0x91, 0x21, 0x8f, 0x44,
+  0x18, 0xf1, 0x4a, 0xb4, 0x11, 0x89, 0x2b, 0x92, 0x9a, 0x22, 0x98, 0x90,
+  0x92, 0x23, 0xc2, 0x91, 0x2d, 0x52, 0x88, 0x2a, 0xe9, 0x11, 0x48, 0x22,
+  0xa9, 0x42, 0x96, 0x44, 0xe3, 0x48, 0xc2, 0x41, 0x17, 0xc9, 0x2c, 0xf4,
+  0x81, 0x6c, 0xe0, 0x49, 0x06, 0x9e, 0x24, 0x21, 0x8a, 0x12, 0xd2, 0x41,
+  0xd2, 0x42, 0x19, 0xd1, 0x42, 0x1b, 0x94, 0x32, 0x43, 0x92, 0x92, 0x43,
+  0x12, 0x12, 0x94, 0x83, 0x2b, 0x42, 0x29, 0xf1, 0x24, 0x12, 0xdf, 0xd5,
+  0x03, 0x00, 0x80, 0x32, 0x01, 0x13, 0x44, 0x1b, 0x0a, 0x80, 0x88, 0x00,
+  0x00, 0x40, 0x01, 0x40, 0x18, 0x82, 0x3c, 0x0a, 0x11, 0x40, 0x41, 0x0a,
+  0xf0, 0xff, 0xff, 0xff, 0xe2, 0x50, 0x12, 0xf0, 0xaf, 0xc3, 0x00, 0x6c,
+  0x43, 0x04, 0x00, 0x48, 0x22, 0x87, 0x21, 0x83, 0x82, 0xc4, 0x2a, 0x40,
+  0x88, 0x34, 0x21, 0x90, 0x18, 0x12, 0x19, 0x12, 0x24, 0x64, 0x41, 0x88,
+  0xc0, 0x28, 0x41, 0x14, 0x84, 0x82, 0x28, 0x12, 0x80, 0x43, 0x02, 0x41,
+  0xc0, 0x12, 0x10, 0x44, 0x21, 0x51, 0x14, 0x25, 0x41, 0xc1, 0x11, 0x10,
+  0x28, 0x4c, 0x08, 0x22, 0x86, 0x82, 0x22, 0x28, 0x23, 0x08, 0xdf, 0xc6,
+  0x47, 0x21, 0x64, 0x18, 0x8c, 0x41, 0x41, 0x68, 0x13, 0x47, 0x81, 0x46,
+  0x31, 0x41, 0x2c, 0x48, 0xa8, 0x18, 0x1c, 0x45, 0x01, 0x46, 0x3a, 0x41,
+  0x27, 0x22, 0xd3, 0x92, 0x82, 0x11, 0x14, 0x94, 0x42, 0x11, 0x42, 0x24,
+  0x00, 0x66, 0x14, 0x2b, 0xc4, 0x28, 0x42, 0x21, 0x43, 0x64, 0x22, 0x00,
+  0x86, 0xd4, 0x21, 0xb1, 0x14, 0x54, 0xa2, 0x48, 0x8d, 0x82, 0x9a, 0x04,
+  0x9a, 0xc4, 0x12, 0x40, 0xa2, 0x41, 0x35, 0xe2, 0xc1, 0xa4, 0x84, 0x52,
+  0x42, 0x47, 0x11, 0x8a, 0x94, 0x83, 0x14, 0x42, 0x5e, 0x21, 0x16, 0x48,
+  0x41, 0x48, 0xc1, 0x4c, 0x14, 0x17, 0x25, 0x26, 0xd8, 0x84, 0x64, 0x82,
+  0x23, 0x52, 0x81, 0xd0, 0x38, 0x92, 0x41, 0x2f, 0x21, 0x72, 0x21, 0x6a,
+  0x18, 0x15, 0x66, 0x14, 0x43, 0xa1, 0x85, 0x14, 0x83, 0x1c, 0x04, 0xe0,
+  0x48, 0x34, 0x2b, 0x1b, 0x14, 0x89, 0xa2, 0x34, 0xa1, 0x27, 0x44, 0x42,
+  0x21, 0x18, 0x44, 0x17, 0x21, 0x1a, 0x74, 0x18, 0x92, 0x44, 0xbd, 0x82,
+  0x4b, 0x41, 0x11, 0x2a, 0x74, 0x18, 0x22, 0x48, 0xa2, 0x41, 0x27, 0x22,
+  0x4f, 0x21, 0xa4, 0x84, 0x1e, 0x42, 0x52, 0x47, 0x11, 0x1a, 0xe8, 0x49,
+  0x07, 0x40, 0x14, 0x06, 0xa0, 0x21, 0x18, 0x68, 0x81, 0x82, 0x21, 0x92,
+  0x4e, 0x11, 0x20, 0x84, 0x04, 0x84, 0x4c, 0x21, 0x02, 0x50, 0x18, 0x00,
+  0x22, 0x10, 0x13, 0x28, 0x02, 0x00, 0x00, 0xc0, 0x24, 0x00, 0x29, 0x48,
+  0x54, 0x34, 0x40, 0x01, 0x1c, 0x28, 0x81, 0x09, 0x42, 0x84, 0x10, 0x91,
+  0x88, 0x22, 0x88, 0x22, 0x88, 0x48, 0x1f, 0xc5, 0x09, 0x22, 0x40, 0x01,
+  0x24, 0x40, 0x41, 0x38, 0x24, 0x8c, 0x32, 0x22, 0x40, 0x12, 0x91, 0x12,
+  0x19, 0x44, 0x04, 0x2d, 0x24, 0x10, 0x48, 0x08, 0x48, 0x80, 0x64, 0x41,
+  0x11, 0x46, 0x01, 0x89, 0x02, 0x00, 0x80, 0x51, 0x41, 0x40, 0x08, 0x15,
+  0x58, 0x28, 0x28, 0xa0, 0x41, 0x25, 0x11, 0xc1, 0x92, 0x80, 0x71, 0x24,
+  0x68, 0x24, 0x00, 0x90, 0x18, 0x22, 0x10, 0xf4, 0x3f, 0x37, 0x70, 0x43,
+  0x24, 0x62, 0x62, 0x90, 0x44, 0x89, 0xb1, 0x14, 0x26, 0x13, 0x82, 0x18,
+  0x28, 0xd1, 0x81, 0x89, 0xc4, 0x45, 0x2c, 0x12, 0x61, 0x12, 0x15, 0xc8,
+  0x49, 0x17, 0x42, 0x1c, 0x32, 0x61, 0x11, 0x65, 0x18, 0xd1, 0x28, 0xe6,
+  0x44, 0x72, 0x24, 0xa8, 0x12, 0x48, 0x40, 0x08, 0x23, 0x82, 0x82, 0x52,
+  0x68, 0x18, 0x00, 0x4c, 0x45, 0xb8, 0x21, 0x94, 0xa8, 0x8e, 0x6a, 0x4a,
+  0xc8, 0x41, 0x94, 0x27, 0x98, 0x33, 0xc1, 0x18, 0x83, 0x68, 0xa2, 0x80,
+  0x94, 0x41, 0x4e, 0x8c, 0xf0, 0x27, 0xc1, 0x90, 0x62, 0x28, 0x6c, 0x02,
+  0x46, 0x14, 0x38, 0x64, 0x2a, 0xc1, 0x24, 0xa2, 0x84, 0x18, 0x12, 0x33,
+  0xf4, 0x41, 0x14, 0x42, 0x45, 0x81, 0x32, 0x26, 0x14, 0xd4, 0x83, 0xa2,
+  0x42, 0x48, 0x65, 0x18, 0x31, 0x5c, 0x5c, 0xd4, 0x84, 0xa6, 0x12, 0x28,
+  0x40, 0x08, 0x28, 0x22, 0x1c, 0x02, 0x16, 0x08, 0x91, 0x1e, 0x48, 0x81,
+  0x14, 0x83, 0xf9, 0x83, 0x22, 0x82, 0x1e, 0x82, 0x95, 0xc2, 0x9a, 0x97,
+  0x43, 0x16, 0x12, 0x68, 0x82, 0x21, 0x8c, 0xa5, 0x24, 0x84, 0x41, 0x4f,
+  0x24, 0x04, 0x45, 0x01, 0x11, 0x40, 0x22, 0x31, 0x11, 0x84, 0x21, 0x84,
+  0x29, 0x02, 0x86, 0x49, 0x02, 0x13, 0x12, 0x12, 0x41, 0x99, 0x48, 0x22,
+  0x11, 0x14, 0x11, 0x80, 0x84, 0x32, 0x22, 0x11, 0x60, 0x84, 0x00, 0x24,
+  0x20, 0x41, 0x54, 0x48, 0x21, 0x00, 0x45, 0x22, 0x82, 0xa6, 0x42, 0x8c,
+  0x34, 0x41, 0x1c, 0x04, 0x11, 0x30, 0x48, 0x88, 0x00, 0x10, 0xb1, 0x84,
+  0x04, 0x5f, 0xf8, 0x0e, 0x28, 0x42, 0x24, 0x22, 0x50, 0x82, 0x00, 0x40,
+  0x22, 0x28, 0x42, 0x48, 0x51, 0x41, 0x00, 0x2c, 0x91, 0x21, 0x42, 0x24,
+  0x83, 0x04, 0x11, 0x41, 0x86, 0x14, 0x81, 0x04, 0x10, 0x12, 0x06, 0x83,
+  0x58, 0x24, 0x30, 0x56, 0x28, 0xa0, 0x24, 0x8a, 0x04, 0x28, 0x8c, 0x04,
+  0x19, 0x08, 0x23, 0x42, 0x54, 0x18, 0x00, 0x15, 0x04, 0x2c, 0x02, 0x89,
+  0x14, 0xe4, 0x21, 0xf2, 0x97, 0xf5, 0x00, 0x66, 0x04, 0x1c, 0x01, 0x14,
+  0x10, 0x02, 0x42, 0x41, 0xa3, 0x24, 0x32, 0x14, 0x60, 0x12, 0x00, 0x88,
+  0x28, 0x34, 0x40, 0xe1, 0x23, 0xc4, 0x42, 0x87, 0x1c, 0x00, 0x11, 0x8c,
+  0x02, 0x84, 0x41, 0x12, 0x81, 0x42, 0x42, 0x85, 0x11, 0x11, 0x08, 0x12,
+  0x14, 0x21, 0x28, 0x41, 0x83, 0xa4, 0x12, 0x18, 0x48, 0x12, 0x54, 0x58,
+  0x82, 0x83, 0x51, 0x28, 0x28, 0x20, 0xe1, 0x5b, 0x08, 0x20, 0x15, 0x04,
+  0x20, 0x02, 0x28, 0x16, 0x68, 0x52, 0x11, 0x10, 0x11, 0x08, 0xa1, 0x12,
+  0x45, 0x11, 0x34, 0x12, 0x12, 0xa8, 0x44, 0x80, 0x22, 0x38, 0x24, 0x40,
+  0x12, 0x04, 0x18, 0x80, 0x82, 0x12, 0x04, 0x00, 0x41, 0x26, 0x91, 0x28,
+  0x00, 0x27, 0x44, 0x48, 0x18, 0x60, 0x14, 0x20, 0x74, 0x42, 0x11, 0x21,
+  0x02, 0x00, 0x84, 0x42, 0x9e, 0xc4, 0x00, 0x4c, 0x41, 0xb6, 0x21, 0x01,
+  0x29, 0x02, 0x28, 0x12, 0x26, 0x61, 0x28, 0x26, 0x48, 0x98, 0x1c, 0x70,
+  0x28, 0x21, 0x41, 0xe7, 0x48, 0xb2, 0x22, 0x24, 0x91, 0x68, 0x51, 0x26,
+  0xd1, 0x62, 0x54, 0x84, 0x1d, 0x24, 0x10, 0x91, 0x2e, 0x21, 0x16, 0x14,
+  0xa4, 0x28, 0x22, 0x46, 0x14, 0xd4, 0x18, 0x02, 0xc3, 0x64, 0x18, 0x1e,
+  0x28, 0x22, 0xa7, 0x24, 0x43, 0x24, 0x28, 0x81, 0x71, 0x41, 0x44, 0x68,
+  0x25, 0x49, 0x24, 0x84, 0x48, 0x18, 0x98, 0x48, 0x81, 0x24, 0x5f, 0xff,
+  0x09, 0x22, 0x28, 0x00, 0x50, 0x81, 0x24, 0x10, 0xc8, 0x44, 0x25, 0x81,
+  0x44, 0x11, 0x41, 0x07, 0x20, 0x41, 0x21, 0x41, 0x21, 0x08, 0x48, 0x28,
+  0x19, 0x04, 0x48, 0x00, 0x50, 0x82, 0xc0, 0x18, 0x44, 0x25, 0x22, 0x01,
+  0x11, 0x22, 0x68, 0x10, 0x01, 0x28, 0x46, 0xc1, 0x48, 0x21, 0x12, 0x46,
+  0x01, 0x30, 0x14, 0x28, 0x32, 0x21, 0x22, 0x44, 0x2e, 0x41, 0xaf, 0xee,
+  0x0e, 0x41, 0x18, 0x00, 0x22, 0x28, 0x16, 0x04, 0x49, 0x02, 0x88, 0x22,
+  0x88, 0x00, 0x11, 0x00, 0x83, 0x01, 0x00, 0xa4, 0x13, 0x44, 0x01, 0x00,
+  0x41, 0x44, 0x80, 0x22, 0x01, 0x80, 0x04, 0x82, 0x00, 0xc0, 0x68, 0x25,
+  0x04, 0x40, 0x02, 0x44, 0xc0, 0x22, 0x80, 0x98, 0x2a, 0x4a, 0x38, 0x24,
+  0x46, 0x08, 0x81, 0xf0, 0x94, 0xfa, 0xa0, 0x24, 0x10, 0xc4, 0x64, 0x44,
+  0x20, 0x24, 0x02, 0x28, 0x11, 0x40, 0x88, 0xc2, 0x48, 0x00, 0x00, 0x20,
+  0x08, 0x00, 0xc0, 0x21, 0x4e, 0x88, 0x14, 0x10, 0x61, 0x88, 0x41, 0x00,
+  0x88, 0x90, 0x88, 0x41, 0x42, 0x80, 0x02, 0x12, 0x42, 0x23, 0x28, 0x24,
+  0x09, 0x00, 0x12, 0x80, 0x14, 0x24, 0x48, 0x32, 0x44, 0x00, 0xdf, 0x2a,
+  0x0f, 0x22, 0x23, 0xf3, 0x03, 0xf0, 0x4c, 0x44, 0x11, 0x50, 0x41, 0x10,
+  0x05, 0x28, 0x14, 0x41, 0x24, 0x80, 0x42, 0x2a, 0x41, 0xa4, 0x48, 0x00,
+  0x89, 0x42, 0x12, 0x01, 0x81, 0x10, 0x08, 0x00, 0x28, 0x21, 0x40, 0x02,
+  0x10, 0x24, 0x08, 0x82, 0x84, 0x00, 0x42, 0x00, 0x21, 0xc2, 0x40, 0xa2,
+  0x41, 0xf7, 0x2d, 0x40, 0x29, 0x02, 0x84, 0x40, 0x84, 0x01, 0x11, 0x8c,
+  0x08, 0x20, 0x12, 0x08, 0x28, 0x84, 0x00, 0x10, 0x84, 0x14, 0x22, 0x02,
+  0x90, 0x85, 0x1c, 0x16, 0x41, 0x44, 0x88, 0x24, 0x82, 0x44, 0x44, 0x34,
+  0x44, 0x4d, 0x42, 0x00, 0x60, 0x42, 0x81, 0x22, 0x00, 0x81, 0x22, 0x49,
+  0x22, 0x02, 0x7d, 0x0e, 0xf0, 0x4d, 0xd4, 0x6b, 0x0e, 0x43, 0x0c, 0x20,
+  0x03, 0x40, 0x01, 0x00, 0x88, 0x95, 0x22, 0x08, 0x1a, 0x44, 0x12, 0x04,
+  0x00, 0x8a, 0x91, 0x22, 0x00, 0x00, 0xa0, 0x82, 0x44, 0x00, 0x00, 0x81,
+  0x88, 0x24, 0x88, 0x30, 0x48, 0x14, 0x84, 0x00, 0x24, 0x81, 0x1c, 0x08,
+  0x11, 0x10, 0x41, 0x18, 0x14, 0x14, 0x08, 0x23, 0x88, 0x44, 0x28, 0xf6,
+  0x9f, 0x59, 0x40, 0x38, 0x28, 0x44, 0x40, 0x01, 0x41, 0x00, 0x10, 0x44,
+  0x04, 0x14, 0x23, 0x02, 0x00, 0x26, 0x38, 0x21, 0x8c, 0x06, 0x3f, 0x42,
+  0x44, 0x91, 0x48, 0x26, 0xc1, 0x48, 0x00, 0x48, 0x80, 0xa4, 0x42, 0x20,
+  0x94, 0x41, 0xfc, 0x05, 0xf2, 0x0f, 0x44, 0x4a, 0x48, 0x22, 0x84, 0x14,
+  0x02, 0x21, 0x88, 0x46, 0x98, 0x82, 0x46, 0x44, 0x88, 0x02, 0x12, 0xaf,
+  0xe3, 0x08, 0xa4, 0x24, 0x15, 0xc2, 0x42, 0x41, 0x18, 0x42, 0x10, 0x04,
+  0xd5, 0x04, 0xf0, 0xff, 0xa5, 0x48, 0x21, 0x40, 0x81, 0x04, 0x00, 0x11,
+  0x17, 0x4c, 0x22, 0x41, 0x42, 0x44, 0x40, 0x84, 0x14, 0x44, 0x46, 0x24,
+  0x04, 0x80, 0x01, 0x00, 0x49, 0x13, 0x44, 0x04, 0x12, 0x4c, 0x34, 0x11,
+  0x10, 0x34, 0x16, 0x41, 0xaf, 0x36, 0x03, 0x10, 0x08, 0x40, 0x01, 0x11,
+  0x22, 0x11, 0x88, 0x00, 0x84, 0x60, 0x82, 0x26, 0xc8, 0x28, 0x40, 0x04,
+  0x00, 0x41, 0x42, 0xc4, 0x40, 0x24, 0xc4, 0x68, 0x20, 0x04, 0x40, 0x22,
+  0x04, 0x50, 0x21, 0x40, 0x02, 0x11, 0xc0, 0x41, 0x84, 0x90, 0x48, 0x50,
+  0x82, 0x40, 0x88, 0x04, 0x94, 0x00, 0x40, 0x01, 0x2f, 0x57, 0x06, 0x15,
+  0x08, 0x39, 0x04, 0x40, 0x08, 0x84, 0x10, 0x01, 0xcc, 0x12, 0x81, 0x12,
+  0x05, 0x41, 0x89, 0x12, 0x02, 0x4d, 0x28, 0xb0, 0x42, 0x22, 0x82, 0x21,
+  0x91, 0x81, 0x88, 0x11, 0x00, 0x40, 0x11, 0x04, 0x84, 0x80, 0x54, 0x28,
+  0x10, 0x08, 0x84, 0x41, 0x41, 0x48, 0x44, 0x22, 0x20, 0x24, 0x12, 0x04,
+  0x10, 0x02, 0x50, 0x42, 0xf0, 0x9a, 0xf1, 0x70, 0x41, 0xb4, 0xa8, 0x14,
+  0xb1, 0x44, 0x44, 0x25, 0x01, 0x22, 0x14, 0x1b, 0x82, 0x86, 0x41, 0x78,
+  0x86, 0x01, 0x2e, 0x49, 0x13, 0xc2, 0x24, 0x94, 0x63, 0x63, 0x32, 0xae,
+  0x38, 0x22, 0xcb, 0x42, 0x2f, 0x12, 0x41, 0x91, 0xd1, 0x4f, 0x44, 0x84,
+  0x08, 0x40, 0x89, 0x46, 0xc8, 0x48, 0x88, 0x2c, 0xc4, 0xc8, 0x4c, 0xb8,
+  0x62, 0x54, 0x41, 0x84, 0x14, 0x63, 0x41, 0xd1, 0x4a, 0x88, 0x78, 0xc2,
+  0x38, 0x21, 0x20, 0x62, 0x82, 0x41, 0xcb, 0x34, 0xa5, 0x77, 0x85, 0x74,
+  0x48, 0x28, 0x52, 0x38, 0x22, 0x5f, 0xa1, 0x0a, 0x26, 0x82, 0x43, 0x07,
+  0x22, 0x43, 0xf2, 0x45, 0x15, 0x8c, 0x12, 0x34, 0x8c, 0x11, 0x11, 0x15,
+  0x18, 0x19, 0xc3, 0x28, 0x25, 0x28, 0x42, 0x08, 0x8d, 0x44, 0x42, 0x54,
+  0x28, 0xcc, 0x64, 0x14, 0x15, 0x31, 0x61, 0xc1, 0x45, 0xf5, 0x8a, 0x44,
+  0x43, 0x82, 0x54, 0x24, 0x45, 0x68, 0x44, 0x45, 0x54, 0x14, 0x24, 0x24,
+  0x26, 0x64, 0xa6, 0x46, 0x68, 0x64, 0x4e, 0x18, 0x42, 0x83, 0x21, 0x54,
+  0x4e, 0x15, 0x12, 0x88, 0x8c, 0x84, 0xbc, 0x42, 0x01, 0x43, 0x44, 0xfd,
+  0x14, 0x44, 0xbb, 0x79, 0xd0, 0x14, 0x56, 0xa2, 0x61, 0x8f, 0x23, 0x12,
+  0x45, 0xa8, 0x41, 0x70, 0x21, 0x04, 0x49, 0xb8, 0x28, 0x92, 0xa8, 0xf0,
+  0x4c, 0x34, 0x30, 0x2c, 0x50, 0x48, 0xd0, 0x24, 0x88, 0xe6, 0xa4, 0xb2,
+  0x41, 0x14, 0xad, 0x22, 0x85, 0xe8, 0x18, 0xf6, 0x61, 0x2d, 0x19, 0xb4,
+  0x41, 0x28, 0xe4, 0x42, 0x23, 0xe4, 0x4c, 0x14, 0x21, 0x48, 0x52, 0xc8,
+  0x21, 0xa1, 0x4c, 0x16, 0x98, 0x64, 0x43, 0xf8, 0x81, 0x42, 0x48, 0x8e,
+  0x26, 0x8c, 0xb1, 0x44, 0x32, 0x16, 0xc6, 0x46, 0x78, 0xc4, 0x88, 0xb2,
+  0x82, 0xdc, 0x42, 0x94, 0x14, 0x4a, 0xf1, 0xa2, 0xa2, 0x50, 0x41, 0x50,
+  0x41, 0x81, 0x15, 0x94, 0x18, 0x15, 0x14, 0x48, 0x54, 0x18, 0x40, 0x01,
+  0x14, 0x41, 0x14, 0x41, 0x14, 0x45, 0x48, 0x51, 0x84, 0x46, 0x51, 0x84,
+  0x42, 0x45, 0x28, 0x54, 0x84, 0x42, 0x84, 0x50, 0x09, 0x00, 0xf1, 0xff,
+  0xff, 0x32, 0x04, 0x13, 0x14, 0x14, 0x11, 0x1c, 0x11, 0x9e, 0x41, 0xab,
   0x12, 0x19, 0xb4, 0x2a, 0x91, 0x41, 0xa9, 0x11, 0x91, 0x1a, 0xd0, 0x4a,
   0x83, 0xd4, 0x4a, 0xc1, 0x48, 0x2c, 0x41, 0xc8, 0x14, 0x84, 0xf0, 0xae,
   0x2e, 0x34, 0x7f, 0x44, 0xf4, 0x25, 0x27, 0xc5, 0xfd, 0x34, 0x37, 0x7d,
@@ -4254,570 +3549,564 @@ const unsigned char USB_1208HS_rbf[] = {
   0x54, 0xdd, 0x4f, 0x45, 0xf5, 0xae, 0xb8, 0x4f, 0xcc, 0xf8, 0xea, 0xee,
   0xdf, 0xef, 0xff, 0x72, 0x73, 0xef, 0xc2, 0xfa, 0x7a, 0x74, 0x85, 0xfe,
   0x6c, 0x65, 0x2f, 0xaf, 0x0e, 0x21, 0x10, 0x02, 0x00, 0x00, 0x20, 0x48,
-  0x01, 0x14, 0x40, 0x01, 0x00, 0x00, 0x42, 0x00, 0x11, 0x42, 0x11, 0x10,
-  0x01, 0x00, 0x20, 0x14, 0x04, 0x14, 0xc0, 0x81, 0x40, 0x01, 0x14, 0x48,
-  0x41, 0x48, 0x00, 0x14, 0x00, 0x00, 0x40, 0xa2, 0x48, 0x00, 0x44, 0x70,
-  0xe3, 0x01, 0x48, 0x28, 0x24, 0x00, 0x00, 0x48, 0x20, 0x08, 0x00, 0x00,
-  0x2a, 0x44, 0x01, 0x14, 0xc0, 0x81, 0x60, 0x14, 0x00, 0x20, 0x24, 0x22,
-  0x04, 0x46, 0xa1, 0x82, 0x81, 0x41, 0xc2, 0x14, 0x44, 0x14, 0x40, 0x01,
-  0x14, 0x44, 0x14, 0x11, 0x88, 0x48, 0x14, 0x51, 0x14, 0x00, 0x48, 0x00,
-  0x80, 0x04, 0xf0, 0xfa, 0xdd, 0xe0, 0x32, 0xf4, 0x11, 0x24, 0xc7, 0x32,
-  0x1f, 0xc1, 0x72, 0x6c, 0xf1, 0x11, 0x2c, 0xaf, 0x16, 0xd1, 0xc1, 0xf2,
-  0x6e, 0x11, 0x1f, 0xc8, 0xb2, 0x6a, 0xd9, 0x81, 0xb2, 0x4a, 0x19, 0xb5,
-  0x4a, 0x39, 0x24, 0xaf, 0x14, 0x3b, 0x34, 0x2f, 0x34, 0x79, 0x24, 0xf8,
-  0x42, 0x91, 0x4f, 0x82, 0xe4, 0x14, 0xf9, 0x24, 0x4a, 0x4e, 0xa1, 0x4f,
-  0xa2, 0xe4, 0x15, 0xf2, 0x24, 0x4a, 0x9e, 0x21, 0x2e, 0x4a, 0xd6, 0xd5,
-  0xa2, 0xe4, 0x4d, 0xc2, 0x5a, 0x1f, 0x4d, 0xd2, 0x24, 0xf4, 0x91, 0x24,
-  0x85, 0xf2, 0x91, 0x24, 0x87, 0x24, 0x1f, 0x49, 0x72, 0x6a, 0xf2, 0x91,
-  0x6c, 0xaf, 0x26, 0xf1, 0x91, 0x64, 0xaf, 0x24, 0xb9, 0x11, 0xf6, 0x4a,
-  0x92, 0x53, 0xf1, 0x4a, 0x92, 0x43, 0xf3, 0x4a, 0x92, 0x4b, 0x43, 0x2b,
-  0x94, 0x4f, 0x83, 0xb4, 0x42, 0xf9, 0x34, 0x48, 0x4e, 0x94, 0x4f, 0xa2,
-  0xf4, 0x75, 0xa2, 0xc0, 0x42, 0x56, 0xcc, 0x42, 0x12, 0x42, 0x30, 0x42,
-  0x44, 0x2b, 0x14, 0x82, 0x2f, 0x44, 0x21, 0xf8, 0x48, 0xb4, 0x41, 0x8b,
-  0xa4, 0x41, 0x8f, 0x14, 0x19, 0xe4, 0x14, 0x78, 0x84, 0xc8, 0x81, 0x6d,
-  0x48, 0x1c, 0xd9, 0xa6, 0xc1, 0x81, 0x4f, 0xa8, 0xe5, 0x11, 0x58, 0xa4,
-  0x96, 0xe1, 0x82, 0x64, 0x19, 0xb4, 0x8e, 0x21, 0x8c, 0xf4, 0x91, 0x2c,
-  0xf0, 0x91, 0x68, 0x85, 0xb2, 0x91, 0x36, 0x48, 0x1b, 0x29, 0x42, 0x13,
-  0x38, 0x48, 0x17, 0x48, 0x85, 0xb4, 0x81, 0xd2, 0x48, 0x1a, 0x95, 0xa8,
-  0x82, 0x81, 0xa2, 0x42, 0x26, 0x88, 0x78, 0x22, 0x88, 0xf8, 0xa6, 0x18,
-  0x7f, 0xb6, 0x06, 0x86, 0x28, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x46, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x01, 0x8f, 0xc1, 0x42, 0x22, 0x51, 0x41, 0x10, 0x94, 0x14, 0x56,
-  0x11, 0x24, 0x12, 0x93, 0x41, 0x88, 0x2d, 0x11, 0x11, 0x14, 0x18, 0x27,
-  0x41, 0x82, 0xa4, 0x53, 0x38, 0x86, 0x10, 0x08, 0x49, 0x04, 0x81, 0x23,
-  0x54, 0x68, 0x19, 0x42, 0x46, 0xc4, 0x88, 0x41, 0x86, 0x88, 0x02, 0x50,
-  0x82, 0xa2, 0x81, 0x4c, 0x02, 0xa2, 0x81, 0x21, 0x81, 0x11, 0x8d, 0x81,
-  0x84, 0x21, 0x12, 0x12, 0x2c, 0x11, 0x88, 0x44, 0x08, 0x22, 0x30, 0x57,
-  0x00, 0x8a, 0x12, 0x02, 0x23, 0x92, 0x24, 0x2d, 0x18, 0x51, 0x2c, 0x62,
-  0xc2, 0x89, 0x81, 0x02, 0x40, 0x44, 0x41, 0x44, 0x34, 0x48, 0x8d, 0x23,
-  0x45, 0x09, 0x11, 0x2e, 0x82, 0x42, 0x44, 0x44, 0x22, 0x41, 0x10, 0x78,
-  0x42, 0x06, 0x44, 0x21, 0x00, 0x43, 0x01, 0x45, 0x22, 0x41, 0x99, 0x1a,
-  0x82, 0x8f, 0x14, 0x99, 0x42, 0x20, 0x34, 0x11, 0x81, 0x24, 0x10, 0x82,
-  0x12, 0x18, 0x22, 0x78, 0x44, 0x11, 0xf8, 0x42, 0xfe, 0x30, 0x12, 0x57,
-  0x2a, 0xc0, 0x44, 0x2d, 0x14, 0x47, 0x35, 0x8c, 0x51, 0x34, 0x30, 0x2a,
-  0x43, 0x98, 0x11, 0x11, 0xc0, 0x22, 0x16, 0x24, 0x58, 0x24, 0x47, 0xbc,
-  0xa6, 0x54, 0xa1, 0x84, 0x14, 0x1e, 0x66, 0x48, 0x64, 0x48, 0x4d, 0xa8,
-  0x17, 0x42, 0x44, 0xa4, 0x17, 0x8c, 0x21, 0x86, 0x9e, 0x28, 0x20, 0x74,
-  0x12, 0x88, 0x12, 0xb8, 0x22, 0x01, 0x10, 0xf8, 0x12, 0x89, 0x4d, 0x48,
-  0x14, 0x1b, 0x82, 0x8c, 0x41, 0x28, 0x91, 0x12, 0x16, 0x32, 0x28, 0x81,
-  0xa5, 0x02, 0x45, 0x21, 0xf1, 0x32, 0x91, 0x00, 0x00, 0x20, 0x82, 0x12,
-  0x84, 0x62, 0x12, 0x1d, 0x44, 0x8d, 0x12, 0x28, 0x10, 0xc1, 0x14, 0x11,
-  0x44, 0x84, 0x50, 0x81, 0x25, 0x04, 0x20, 0x08, 0x84, 0x44, 0x24, 0x40,
-  0x42, 0x14, 0x44, 0x04, 0x00, 0x10, 0x24, 0x18, 0x44, 0x54, 0x38, 0x9e,
-  0x28, 0x88, 0x48, 0x21, 0x30, 0x48, 0x11, 0x21, 0x40, 0x02, 0x80, 0x04,
-  0x82, 0x4a, 0x42, 0xf8, 0x65, 0x6d, 0x10, 0x84, 0x02, 0x00, 0x10, 0x88,
-  0x02, 0x28, 0x83, 0x84, 0x82, 0x01, 0x00, 0x00, 0x21, 0xc0, 0x24, 0x30,
-  0x48, 0x8c, 0x44, 0x04, 0x54, 0x60, 0x48, 0x48, 0x52, 0x48, 0x87, 0x44,
-  0x41, 0x44, 0x41, 0x40, 0x01, 0x43, 0x02, 0x18, 0x15, 0x08, 0x48, 0x10,
-  0x51, 0x12, 0x00, 0x40, 0x84, 0xc4, 0x24, 0x82, 0x00, 0x10, 0xf4, 0xfd,
-  0x27, 0x30, 0x62, 0x18, 0x24, 0x38, 0x61, 0x89, 0x22, 0x31, 0x18, 0x4a,
-  0xc2, 0x81, 0x40, 0x88, 0x54, 0x34, 0x48, 0x9d, 0x92, 0x26, 0x88, 0xf4,
-  0x14, 0x68, 0xcd, 0x12, 0x46, 0x29, 0x24, 0x82, 0x98, 0x48, 0x42, 0x89,
-  0xc2, 0x44, 0x83, 0xc4, 0x14, 0x26, 0x34, 0x94, 0xc0, 0x12, 0x48, 0x12,
-  0x21, 0x22, 0x43, 0x91, 0x11, 0xc7, 0x12, 0x83, 0x9a, 0x44, 0x53, 0x44,
-  0xa9, 0x48, 0x42, 0x48, 0x42, 0x59, 0x0c, 0x22, 0xc4, 0x81, 0x8d, 0x42,
-  0x8f, 0x44, 0x02, 0xc4, 0x60, 0x9d, 0xa0, 0x24, 0x12, 0x30, 0x12, 0x60,
-  0x82, 0x60, 0x81, 0x28, 0x19, 0xc8, 0x48, 0x8c, 0x82, 0x51, 0x14, 0x23,
-  0x24, 0xc1, 0x28, 0x90, 0x42, 0x89, 0x11, 0x83, 0xc4, 0x48, 0x83, 0x68,
-  0x44, 0x42, 0x9c, 0x42, 0xc4, 0x4c, 0x18, 0x4b, 0x61, 0x12, 0xc4, 0x18,
-  0x63, 0x44, 0x02, 0x11, 0x41, 0x43, 0xd2, 0x41, 0xe2, 0x81, 0xd8, 0x48,
-  0x44, 0x41, 0x88, 0x68, 0x14, 0x25, 0x81, 0xb4, 0x41, 0x08, 0x28, 0x81,
-  0x44, 0x30, 0x44, 0x50, 0x48, 0xf0, 0x27, 0x37, 0x50, 0x42, 0x28, 0x20,
-  0x12, 0x06, 0x83, 0x81, 0x82, 0x24, 0x02, 0x80, 0x04, 0x70, 0x81, 0x0a,
-  0x42, 0xcc, 0x43, 0x34, 0x6c, 0x20, 0x82, 0x14, 0x08, 0x44, 0x42, 0x88,
-  0x4c, 0x04, 0x4b, 0x48, 0x42, 0x41, 0xc0, 0x14, 0x20, 0x82, 0x61, 0x11,
-  0x81, 0x28, 0x11, 0x46, 0x94, 0x41, 0x42, 0x20, 0x04, 0x44, 0x10, 0x34,
-  0x44, 0x83, 0xd2, 0x28, 0x9c, 0x28, 0x00, 0x41, 0x2e, 0x8e, 0x00, 0x00,
-  0x21, 0x1e, 0x28, 0x41, 0x81, 0x80, 0x82, 0x13, 0x84, 0x12, 0x08, 0x00,
-  0x58, 0x19, 0x04, 0x18, 0x22, 0x80, 0xe4, 0x11, 0x52, 0x84, 0x86, 0x58,
-  0x28, 0x90, 0x44, 0x84, 0x41, 0x10, 0x24, 0x18, 0x18, 0x24, 0xc5, 0x24,
-  0x18, 0x8c, 0x52, 0x48, 0x82, 0x61, 0x48, 0x69, 0x14, 0x04, 0x2c, 0x11,
-  0x04, 0x20, 0x13, 0x24, 0x91, 0x48, 0x28, 0x84, 0x43, 0x21, 0xf2, 0x65,
-  0x7a, 0x00, 0x56, 0x44, 0x04, 0x48, 0x12, 0x40, 0x08, 0x41, 0x51, 0x30,
-  0x21, 0x25, 0x04, 0x11, 0x44, 0x64, 0x12, 0x20, 0x11, 0x08, 0x12, 0x28,
-  0x86, 0x04, 0x00, 0x42, 0x90, 0x21, 0x18, 0x81, 0x15, 0x88, 0x34, 0x44,
-  0x00, 0x00, 0x80, 0x02, 0x12, 0x51, 0x87, 0x12, 0x10, 0x39, 0x88, 0x89,
-  0x02, 0x24, 0x22, 0x21, 0xa0, 0x21, 0xe0, 0x81, 0xf8, 0x7e, 0x2e, 0x00,
-  0x21, 0x21, 0x40, 0x04, 0x21, 0x49, 0x81, 0x24, 0x04, 0x00, 0x91, 0x10,
-  0x18, 0x28, 0x31, 0xa4, 0x46, 0x14, 0x01, 0x44, 0x48, 0x48, 0x00, 0x4b,
-  0x24, 0x24, 0x44, 0x12, 0x12, 0x00, 0x44, 0x00, 0x10, 0x42, 0x44, 0x71,
-  0x14, 0x18, 0x88, 0x03, 0x12, 0x88, 0x20, 0x04, 0x52, 0x41, 0x10, 0x08,
-  0x00, 0x89, 0x04, 0xcf, 0x19, 0x0e, 0x24, 0x10, 0x12, 0xd2, 0x48, 0x31,
-  0x14, 0xa1, 0x49, 0x81, 0x42, 0x14, 0x21, 0x42, 0x18, 0x04, 0x11, 0xc1,
-  0x46, 0x27, 0xb8, 0x44, 0x91, 0x11, 0x81, 0x44, 0x14, 0x28, 0x45, 0x48,
-  0x9a, 0x24, 0x4c, 0x74, 0x42, 0x2c, 0x81, 0x93, 0x14, 0x83, 0x58, 0x41,
-  0x49, 0xc4, 0x14, 0x26, 0x14, 0x52, 0x48, 0xd4, 0x6c, 0x11, 0x6c, 0x24,
-  0x4c, 0x05, 0x89, 0x88, 0xc1, 0x4d, 0x84, 0x4e, 0x38, 0x18, 0x24, 0x26,
-  0x18, 0x02, 0x38, 0x47, 0x81, 0x89, 0x78, 0xe9, 0x01, 0x60, 0x41, 0x41,
-  0x20, 0x06, 0x40, 0x28, 0xa4, 0x61, 0x00, 0x34, 0x15, 0x08, 0x84, 0x4a,
-  0x21, 0xc1, 0x34, 0x80, 0x02, 0x42, 0x2a, 0x74, 0x48, 0x04, 0x80, 0x04,
-  0x40, 0x04, 0x00, 0x00, 0x00, 0x12, 0x22, 0x90, 0x88, 0x28, 0x2a, 0x01,
-  0x1c, 0x91, 0x21, 0x24, 0x80, 0x08, 0x4c, 0x12, 0x84, 0xc1, 0x48, 0x28,
-  0x84, 0x42, 0x22, 0xaf, 0xab, 0x06, 0x29, 0x92, 0x24, 0x22, 0xc0, 0x24,
-  0x00, 0x80, 0x92, 0x24, 0x80, 0x82, 0x42, 0x04, 0x14, 0x40, 0x28, 0x02,
-  0x28, 0x10, 0x24, 0x03, 0x42, 0x30, 0x28, 0x42, 0x84, 0x26, 0x04, 0x10,
-  0x08, 0x88, 0x00, 0x4b, 0x41, 0x81, 0x12, 0x10, 0x08, 0x4a, 0x08, 0x40,
-  0x04, 0x20, 0x55, 0x84, 0x22, 0x00, 0x90, 0x44, 0x48, 0xe0, 0x13, 0x02,
-  0x00, 0x20, 0x03, 0x26, 0x08, 0x8d, 0x24, 0x48, 0x00, 0x00, 0x00, 0x47,
-  0x82, 0x41, 0x18, 0x84, 0x60, 0x44, 0x00, 0x44, 0x22, 0x80, 0x14, 0x24,
-  0x22, 0x02, 0x44, 0xcc, 0x82, 0xa4, 0x21, 0x40, 0x48, 0x04, 0x44, 0x28,
-  0x85, 0x84, 0x82, 0x01, 0x00, 0x00, 0x12, 0x00, 0x45, 0x38, 0x34, 0x90,
-  0x44, 0x00, 0x41, 0x2d, 0x9d, 0x80, 0x82, 0x21, 0x03, 0x26, 0x04, 0x00,
-  0x8c, 0x02, 0x8c, 0x02, 0x00, 0x40, 0x08, 0x41, 0x10, 0x08, 0x4c, 0x06,
-  0x48, 0x90, 0x14, 0x80, 0x34, 0x28, 0x48, 0x84, 0x20, 0x01, 0x81, 0x00,
-  0x80, 0x02, 0x41, 0x80, 0xa1, 0x24, 0x68, 0x43, 0x81, 0x02, 0x20, 0x04,
-  0x00, 0x14, 0x80, 0x24, 0x22, 0x01, 0xbf, 0x48, 0x06, 0x41, 0x00, 0x41,
-  0x40, 0x4c, 0x04, 0x90, 0x48, 0x00, 0x18, 0x20, 0x02, 0x00, 0x4c, 0x91,
-  0x24, 0x00, 0x44, 0x80, 0x62, 0x82, 0x41, 0x00, 0x00, 0x84, 0x10, 0x01,
-  0x48, 0x42, 0x41, 0x80, 0x01, 0x12, 0x85, 0x04, 0x4c, 0x28, 0x02, 0x49,
-  0x01, 0x90, 0x44, 0x40, 0xc1, 0x8c, 0x45, 0x88, 0x41, 0x88, 0x88, 0xf4,
-  0x92, 0xa4, 0x24, 0x82, 0x40, 0x14, 0x02, 0x00, 0x22, 0x44, 0x00, 0x40,
-  0x14, 0x14, 0x14, 0x91, 0x24, 0x11, 0x00, 0x41, 0x11, 0x80, 0x02, 0x20,
-  0xa4, 0x28, 0x41, 0x45, 0x88, 0x46, 0xc4, 0x18, 0x81, 0x88, 0x12, 0x41,
-  0x20, 0x05, 0x84, 0x54, 0x00, 0x40, 0x01, 0x00, 0x10, 0x04, 0x00, 0x50,
-  0x84, 0x42, 0xc4, 0x83, 0xf4, 0xb4, 0xe9, 0x00, 0x00, 0x20, 0x01, 0x22,
-  0x84, 0x00, 0xe0, 0xc2, 0x01, 0x00, 0x41, 0x00, 0x10, 0x84, 0x46, 0x04,
-  0x00, 0x89, 0x08, 0x80, 0x04, 0x44, 0x8c, 0x02, 0x38, 0x89, 0x41, 0x28,
-  0x84, 0x04, 0x89, 0x82, 0x81, 0x22, 0x12, 0x04, 0x20, 0x01, 0x80, 0x24,
-  0x01, 0x1e, 0x84, 0x22, 0x41, 0x90, 0x88, 0x40, 0xf4, 0xd5, 0x67, 0x00,
-  0x00, 0x90, 0x48, 0x10, 0x08, 0x00, 0x00, 0x80, 0x02, 0x10, 0xc8, 0x18,
-  0x00, 0x80, 0xa2, 0x24, 0x44, 0xc1, 0x90, 0x28, 0xc3, 0x04, 0x42, 0x00,
-  0x14, 0x00, 0x00, 0x28, 0x44, 0x44, 0x00, 0x00, 0x20, 0x88, 0x02, 0x18,
-  0x12, 0xc0, 0x14, 0x81, 0x00, 0x00, 0x2a, 0x04, 0x2f, 0xb6, 0x0c, 0xd0,
-  0x48, 0x42, 0x84, 0x24, 0x41, 0x04, 0x40, 0x2c, 0xc2, 0x2c, 0x12, 0x43,
-  0x01, 0x20, 0x12, 0x91, 0x21, 0x53, 0x01, 0x80, 0x34, 0x61, 0x42, 0x44,
-  0x62, 0x80, 0x48, 0x0c, 0x81, 0x42, 0x41, 0x4a, 0x01, 0x4a, 0x01, 0x20,
-  0x88, 0x51, 0x94, 0x89, 0x61, 0x41, 0x40, 0xa1, 0x61, 0x80, 0x24, 0x04,
-  0x00, 0x60, 0x81, 0x00, 0x80, 0x02, 0x4f, 0xe6, 0x07, 0xc4, 0x12, 0x48,
-  0x4b, 0x21, 0x80, 0x62, 0x42, 0x41, 0x50, 0x84, 0x40, 0x2c, 0x02, 0x84,
-  0x80, 0x42, 0x04, 0x22, 0x40, 0x11, 0x02, 0x8c, 0x61, 0x41, 0xc9, 0x02,
-  0x90, 0x24, 0x00, 0x1c, 0x02, 0x28, 0x84, 0x80, 0x86, 0x02, 0x82, 0x22,
-  0xc0, 0x74, 0x4c, 0x12, 0x61, 0x45, 0x12, 0x1a, 0x02, 0x00, 0x1a, 0x28,
-  0x48, 0x28, 0xe1, 0x42, 0x38, 0x9e, 0xf0, 0x13, 0x1c, 0x24, 0x21, 0x4f,
-  0x8b, 0xa1, 0x22, 0x1a, 0x94, 0x14, 0x4b, 0x22, 0x28, 0x40, 0x24, 0x12,
-  0xa4, 0x22, 0x4c, 0x42, 0x04, 0x40, 0xc1, 0x14, 0x8f, 0x11, 0x13, 0x8c,
-  0x86, 0xe6, 0x14, 0x42, 0x34, 0x28, 0x2e, 0x34, 0x2a, 0xe2, 0xc8, 0x0e,
-  0x00, 0x44, 0x49, 0x33, 0x59, 0x8d, 0x28, 0x40, 0x9c, 0x24, 0x4a, 0x57,
-  0x84, 0x1b, 0x19, 0x47, 0x41, 0x83, 0xa1, 0x14, 0x5b, 0x64, 0x1c, 0x82,
-  0x06, 0x12, 0x42, 0x41, 0x00, 0x47, 0x48, 0x45, 0x54, 0x44, 0x83, 0xe6,
-  0x48, 0x64, 0xc4, 0x2f, 0xe3, 0x06, 0x40, 0x44, 0xe6, 0x42, 0x22, 0x54,
-  0x48, 0x44, 0x41, 0x84, 0xcc, 0x42, 0x88, 0xa1, 0x12, 0x30, 0x24, 0x87,
-  0xc2, 0x41, 0x83, 0x01, 0x22, 0x47, 0x44, 0x30, 0x24, 0x49, 0x44, 0x78,
-  0xd4, 0x18, 0x14, 0x54, 0xc4, 0x8d, 0x48, 0x85, 0x18, 0x08, 0x84, 0x18,
-  0x4a, 0x28, 0x64, 0x42, 0x43, 0x7b, 0x18, 0x44, 0xd4, 0x88, 0xf2, 0x24,
-  0x34, 0x16, 0x64, 0x4a, 0x1a, 0x28, 0x03, 0x18, 0x18, 0x46, 0x54, 0xc4,
-  0x44, 0x8c, 0x08, 0x8c, 0xd1, 0x84, 0xf2, 0x18, 0x88, 0x49, 0xf4, 0xa9,
-  0x74, 0xf0, 0x24, 0x24, 0x28, 0x43, 0x91, 0x14, 0x8f, 0x43, 0x42, 0x38,
-  0x2c, 0x8f, 0xc2, 0xb2, 0x2c, 0x36, 0x4c, 0x8b, 0x22, 0x87, 0x81, 0x43,
-  0x11, 0x14, 0xd8, 0x15, 0xf2, 0x28, 0x24, 0x57, 0x92, 0x45, 0xc4, 0x24,
-  0x22, 0x57, 0x56, 0x4c, 0xa4, 0x36, 0x4d, 0x24, 0x89, 0xf4, 0x48, 0x4c,
-  0x83, 0xb6, 0x68, 0xf6, 0x64, 0x24, 0x4f, 0x42, 0xd6, 0x84, 0x76, 0x38,
-  0x8c, 0x27, 0xab, 0x51, 0x48, 0x40, 0x84, 0x73, 0x2c, 0xb8, 0x21, 0x41,
-  0xb8, 0x24, 0x86, 0xf8, 0x61, 0x14, 0x18, 0x4f, 0x45, 0x81, 0xa4, 0x41,
-  0x1a, 0x85, 0xf1, 0x9c, 0xb8, 0x8b, 0x33, 0x85, 0xa8, 0x45, 0x8e, 0xc4,
-  0x4b, 0x36, 0xf0, 0xf6, 0x57, 0x00, 0x41, 0x00, 0x84, 0x41, 0x84, 0x41,
-  0x00, 0x00, 0x40, 0x44, 0x48, 0x54, 0x81, 0x44, 0x11, 0x44, 0x00, 0x11,
-  0x00, 0x44, 0x40, 0x04, 0x00, 0x00, 0x80, 0x08, 0x00, 0x49, 0x01, 0x49,
-  0x01, 0x41, 0x40, 0x21, 0x08, 0x00, 0x40, 0x24, 0x41, 0x04, 0x81, 0x10,
-  0x08, 0xf0, 0x46, 0xe4, 0x20, 0x32, 0x24, 0x4f, 0x63, 0xf1, 0x36, 0x24,
-  0x8f, 0xc5, 0x05, 0x85, 0x08, 0x4b, 0x44, 0x8f, 0x84, 0x56, 0x88, 0x87,
-  0x81, 0x12, 0x45, 0x14, 0x58, 0x48, 0xcf, 0x42, 0xa2, 0x33, 0x8f, 0x83,
-  0xf1, 0x28, 0x2c, 0x4d, 0x64, 0x4d, 0x64, 0x41, 0x4d, 0x44, 0x4f, 0xc4,
-  0xf4, 0x28, 0x28, 0x26, 0x78, 0x68, 0x5c, 0xcc, 0xcf, 0xc4, 0xf6, 0x4c,
-  0x6c, 0x8f, 0x82, 0xf2, 0x78, 0x68, 0x85, 0xa8, 0x77, 0x9a, 0x51, 0xc4,
-  0x2a, 0xa2, 0x8a, 0x85, 0xf8, 0x9d, 0x99, 0x9f, 0xd1, 0xf1, 0x18, 0x3c,
-  0x4b, 0x71, 0x2a, 0xa2, 0xb7, 0x4a, 0x26, 0xa4, 0x55, 0x42, 0xd0, 0x88,
-  0xf1, 0x98, 0x98, 0x9a, 0xa1, 0x11, 0x1a, 0xf1, 0x9c, 0x9c, 0x4f, 0x41,
-  0x59, 0x88, 0x8f, 0x9f, 0x45, 0x32, 0x22, 0x4f, 0xc5, 0x65, 0x22, 0x2b,
-  0x43, 0x5e, 0x78, 0x45, 0x14, 0x7c, 0x24, 0xa4, 0x44, 0xcb, 0x66, 0x44,
-  0x8f, 0x83, 0xa1, 0x13, 0xf0, 0x2c, 0x24, 0x45, 0x75, 0x28, 0xec, 0x13,
-  0xf3, 0x38, 0x18, 0xcd, 0x2c, 0x6c, 0xf2, 0x66, 0x65, 0x4f, 0x46, 0xf6,
-  0x26, 0x74, 0xcf, 0xc6, 0xf4, 0x2c, 0x2c, 0x8f, 0xc2, 0xf6, 0xec, 0xe8,
-  0xcf, 0xc2, 0xd4, 0x88, 0xf4, 0x48, 0x68, 0xdf, 0xd6, 0xf6, 0x6c, 0x7c,
-  0x8d, 0x19, 0x8f, 0x87, 0xa7, 0x19, 0x45, 0x44, 0xf4, 0xd4, 0x94, 0x87,
-  0xc1, 0x9f, 0xd9, 0xf8, 0x18, 0x18, 0x8d, 0x1c, 0x5a, 0xb7, 0x64, 0xf2,
-  0x71, 0x34, 0x4a, 0xa6, 0x36, 0x5a, 0xa5, 0x74, 0x4d, 0x44, 0xc5, 0xf8,
-  0xbc, 0x8c, 0xc7, 0x83, 0x4f, 0xc1, 0xf1, 0x18, 0x5e, 0x2b, 0xff, 0x8b,
-  0xb9, 0x6f, 0xc1, 0xf1, 0x5c, 0xd7, 0x60, 0x42, 0x4b, 0x51, 0x47, 0x62,
-  0x67, 0x43, 0x8f, 0xc5, 0x55, 0x88, 0x85, 0x5c, 0xc8, 0x4e, 0x44, 0x6a,
-  0x56, 0xc8, 0x87, 0x83, 0x1a, 0x53, 0x44, 0x85, 0x58, 0xd9, 0x57, 0x52,
-  0x9f, 0x92, 0xf2, 0x29, 0x11, 0x8d, 0x24, 0x4d, 0x24, 0x7f, 0x52, 0x72,
-  0x25, 0xf5, 0x44, 0x54, 0xcf, 0xc4, 0xf4, 0x6c, 0xc8, 0xcf, 0x82, 0xf4,
-  0x28, 0x6c, 0xc7, 0xc2, 0x85, 0xf8, 0x4c, 0x6c, 0x8f, 0x92, 0xf2, 0x7c,
-  0x6c, 0x8f, 0x84, 0xe4, 0x8e, 0xaf, 0x4c, 0x4d, 0x44, 0x4b, 0x22, 0x4b,
-  0xba, 0x8d, 0x18, 0xdf, 0x99, 0xf9, 0x39, 0x3d, 0x8f, 0xc3, 0xe3, 0x45,
-  0xf3, 0x71, 0xb1, 0x1f, 0x55, 0xab, 0x64, 0x4a, 0xa2, 0x55, 0x4a, 0xa1,
-  0x15, 0x4d, 0x1c, 0xbe, 0xbc, 0x3e, 0x34, 0xc5, 0xb8, 0x14, 0xf5, 0xce,
-  0xc8, 0x4b, 0x99, 0xcd, 0x5c, 0x5f, 0x1c, 0x48, 0x42, 0xf4, 0x1c, 0x54,
-  0x26, 0x72, 0x72, 0xf4, 0x64, 0x6c, 0x45, 0x3c, 0x2c, 0xc5, 0x04, 0x2e,
-  0x24, 0x84, 0x16, 0xa8, 0x31, 0x45, 0x54, 0x88, 0x54, 0xd5, 0xfd, 0x3c,
-  0x29, 0x9f, 0x13, 0xd1, 0x48, 0xf2, 0x44, 0x64, 0x6f, 0x56, 0xf6, 0x25,
-  0x27, 0x6e, 0x64, 0xcf, 0xc6, 0xf6, 0x6c, 0x4c, 0x8f, 0xc2, 0xf6, 0xa8,
-  0x6c, 0xcf, 0xc6, 0xf4, 0x48, 0x44, 0x8f, 0xc4, 0xf4, 0x4c, 0x41, 0xcf,
-  0x87, 0xb7, 0x79, 0xe7, 0x8f, 0xaf, 0x4c, 0x45, 0x44, 0xf4, 0x94, 0x94,
-  0x4f, 0xc3, 0xf2, 0xbd, 0xbd, 0x4f, 0x83, 0xf3, 0x3c, 0x3c, 0x7a, 0xf3,
-  0x51, 0xb5, 0x1b, 0xb7, 0x4a, 0xa6, 0x35, 0x5a, 0xa5, 0x16, 0x4f, 0x45,
-  0x11, 0xf4, 0xb4, 0xb4, 0xcf, 0x83, 0x52, 0xc4, 0x5e, 0x54, 0xef, 0xcc,
-  0xfe, 0x98, 0x92, 0x4f, 0x84, 0xe5, 0x72, 0x08, 0x23, 0x02, 0x18, 0x80,
-  0x01, 0x22, 0x00, 0x84, 0x22, 0x84, 0x00, 0x00, 0x28, 0x80, 0x02, 0x44,
-  0x00, 0x10, 0x08, 0x89, 0x02, 0x8d, 0x24, 0x90, 0x28, 0x41, 0x81, 0x18,
-  0x00, 0x20, 0x02, 0x18, 0x84, 0x49, 0x01, 0x20, 0x01, 0x12, 0x20, 0x01,
-  0x40, 0x24, 0xc8, 0x24, 0x12, 0x87, 0x44, 0x10, 0x08, 0xbe, 0x22, 0x30,
-  0x84, 0x10, 0x84, 0x92, 0x14, 0x10, 0x04, 0x41, 0x00, 0x80, 0x11, 0x04,
-  0x41, 0x14, 0x43, 0xc2, 0x11, 0x22, 0x20, 0x42, 0x15, 0x04, 0x48, 0x44,
-  0x00, 0x40, 0x84, 0x84, 0xa2, 0x42, 0x52, 0x00, 0x40, 0x14, 0x94, 0x21,
-  0x81, 0x1a, 0x32, 0x24, 0xe0, 0x16, 0x01, 0x42, 0x00, 0x00, 0x12, 0x81,
-  0x00, 0x43, 0x88, 0x4b, 0xf1, 0xac, 0xc6, 0xd0, 0x24, 0xf4, 0x11, 0x24,
-  0x85, 0xf2, 0x11, 0x24, 0xc3, 0xf6, 0x91, 0x24, 0xe3, 0xd4, 0x41, 0xb2,
-  0x6a, 0xd1, 0x41, 0xb2, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xaf, 0x44,
-  0x39, 0x24, 0xaf, 0x54, 0x39, 0x24, 0x2f, 0x54, 0x79, 0x24, 0xf8, 0x42,
-  0x95, 0x4f, 0x82, 0xe4, 0x14, 0xf9, 0x24, 0x4a, 0x1c, 0xfa, 0x24, 0x4a,
-  0x56, 0xf5, 0x24, 0x4a, 0xd6, 0xe5, 0xa2, 0x64, 0x59, 0xac, 0xe4, 0x49,
-  0xc2, 0x4a, 0x1f, 0x49, 0xc2, 0xc2, 0x1f, 0x49, 0x52, 0x2c, 0x1f, 0x49,
-  0xb2, 0x4c, 0xf1, 0x91, 0x24, 0xeb, 0x14, 0x1f, 0x48, 0xb2, 0x4a, 0xd1,
-  0x41, 0xb6, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x4b, 0x42,
-  0xaf, 0x44, 0x39, 0x24, 0xaf, 0x44, 0x79, 0x24, 0x98, 0x9a, 0x4f, 0x82,
-  0xa4, 0x94, 0x4f, 0xa2, 0x74, 0xf6, 0x0f, 0x2c, 0xf4, 0x11, 0x6c, 0x85,
-  0xf2, 0x11, 0x64, 0x70, 0x11, 0x34, 0x42, 0x1d, 0x24, 0xa9, 0x51, 0x41,
-  0xaf, 0x44, 0x99, 0x21, 0xaf, 0x44, 0x1b, 0xb1, 0x42, 0x2b, 0xb2, 0x42,
-  0x29, 0xb2, 0x4a, 0x69, 0x82, 0x2d, 0x91, 0x67, 0x82, 0x29, 0xd9, 0xa4,
-  0xc1, 0x81, 0x4f, 0xa2, 0x6d, 0x11, 0x2e, 0x8a, 0x96, 0x61, 0xa2, 0x96,
-  0xc5, 0x4b, 0x9e, 0x24, 0xbc, 0xf4, 0x19, 0x24, 0x2c, 0xf4, 0x91, 0x6c,
-  0x85, 0xb2, 0x91, 0x36, 0x48, 0x1f, 0x48, 0x32, 0x4a, 0x1f, 0x48, 0x92,
-  0x1a, 0x4c, 0xf2, 0x4a, 0x14, 0x19, 0xf2, 0x4a, 0xb4, 0x59, 0x92, 0x9a,
-  0x22, 0x2b, 0x84, 0x22, 0x2b, 0x94, 0x47, 0x82, 0x29, 0xb9, 0x26, 0x94,
-  0x12, 0x4f, 0xa2, 0xf1, 0x7c, 0xc4, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x14, 0x00, 0x80, 0x12, 0x01, 0x10, 0x02, 0x00, 0x88,
-  0x00, 0x20, 0x01, 0x14, 0x00, 0x84, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x9f, 0xdb, 0x09, 0x41, 0x00,
-  0x83, 0x01, 0x00, 0x44, 0x45, 0x01, 0x28, 0x28, 0x20, 0x44, 0x91, 0x81,
-  0x90, 0x11, 0x90, 0x19, 0xd0, 0x41, 0x24, 0xc2, 0x44, 0x20, 0x92, 0x14,
-  0x26, 0x3c, 0x64, 0x4c, 0x0c, 0x44, 0x64, 0x40, 0x02, 0x24, 0x81, 0x60,
-  0x81, 0x41, 0x44, 0x44, 0x41, 0x82, 0x00, 0x84, 0x10, 0x01, 0x81, 0x43,
-  0x12, 0x98, 0x82, 0x82, 0x89, 0x13, 0x44, 0xfc, 0xe5, 0x8d, 0x24, 0x22,
-  0x86, 0x92, 0x38, 0x44, 0x30, 0x48, 0x10, 0x62, 0x83, 0x84, 0xc0, 0x82,
-  0x8a, 0x01, 0xa4, 0xa0, 0x81, 0x66, 0x8c, 0xa2, 0x86, 0x4e, 0x28, 0x20,
-  0x94, 0x28, 0x4a, 0x12, 0x24, 0x84, 0x01, 0x81, 0x10, 0x02, 0x81, 0x00,
-  0x00, 0x89, 0x88, 0xa2, 0x41, 0x42, 0xa3, 0xb4, 0x48, 0x98, 0x44, 0x84,
-  0x9a, 0x84, 0x94, 0x58, 0x18, 0x48, 0x2a, 0xa4, 0x49, 0xb0, 0x28, 0xa5,
-  0x42, 0x42, 0x4e, 0x21, 0x28, 0xcf, 0x92, 0x46, 0x02, 0x42, 0x1a, 0x92,
-  0x1c, 0xc0, 0x48, 0x24, 0x44, 0x8d, 0x15, 0x30, 0x24, 0x8a, 0xb2, 0x22,
-  0x29, 0x14, 0xd9, 0x12, 0x88, 0xf9, 0x41, 0x34, 0xe0, 0x8c, 0x43, 0x42,
-  0x81, 0xa2, 0x21, 0x30, 0xa4, 0x18, 0xc9, 0xa3, 0x24, 0x8d, 0x84, 0x24,
-  0x11, 0x45, 0x12, 0x18, 0x18, 0x62, 0x24, 0x81, 0x81, 0x8c, 0x62, 0x41,
-  0x42, 0x42, 0x4c, 0xcc, 0x84, 0xc1, 0x18, 0x62, 0x83, 0x81, 0x01, 0x8b,
-  0x24, 0x50, 0x28, 0x83, 0xe8, 0x24, 0xe2, 0x84, 0x33, 0x24, 0x4b, 0x21,
-  0x4f, 0xbf, 0x05, 0x43, 0x02, 0xa1, 0x00, 0x00, 0x20, 0x42, 0x08, 0x00,
-  0x00, 0x00, 0x84, 0x28, 0x11, 0x8b, 0x24, 0x49, 0x24, 0xd4, 0x84, 0xa4,
-  0x24, 0x60, 0x44, 0x40, 0x84, 0x04, 0x41, 0x00, 0x00, 0x00, 0x82, 0x18,
-  0x48, 0x45, 0x42, 0x1c, 0x88, 0x04, 0x8a, 0x14, 0x88, 0x44, 0x81, 0x04,
-  0x4b, 0x4b, 0xa0, 0x43, 0x88, 0x20, 0x44, 0xf8, 0xa8, 0x63, 0x10, 0xa4,
-  0x21, 0x40, 0x98, 0x14, 0x28, 0x80, 0x02, 0x84, 0x00, 0x00, 0x44, 0x40,
-  0x04, 0x80, 0x44, 0x85, 0x44, 0x41, 0x08, 0x00, 0x90, 0x28, 0x10, 0x08,
-  0x12, 0x48, 0x44, 0x00, 0x60, 0x81, 0x00, 0x42, 0x44, 0x83, 0x02, 0x81,
-  0x12, 0x40, 0x08, 0x86, 0x08, 0x43, 0x0a, 0x26, 0x18, 0x68, 0x81, 0x80,
-  0xf4, 0xb7, 0xba, 0x00, 0x00, 0x28, 0x20, 0xc4, 0x48, 0x47, 0xa1, 0x22,
-  0x24, 0x00, 0x84, 0x84, 0x50, 0x48, 0x19, 0x41, 0xdc, 0x49, 0x98, 0x28,
-  0xa2, 0x30, 0x28, 0x41, 0xc1, 0x00, 0x18, 0x4b, 0x48, 0x81, 0x41, 0x45,
-  0x58, 0x84, 0xa1, 0x22, 0x42, 0x15, 0x04, 0x41, 0x84, 0xc3, 0x01, 0x8c,
-  0x81, 0x44, 0x88, 0x0c, 0xe0, 0x44, 0x81, 0x04, 0x36, 0x58, 0x81, 0x1a,
-  0xbe, 0x84, 0x85, 0xe4, 0x1a, 0x34, 0x68, 0x47, 0x82, 0xdf, 0x81, 0x02,
-  0x00, 0x80, 0x32, 0x14, 0xc0, 0x48, 0x85, 0x04, 0x24, 0x00, 0x84, 0x10,
-  0x14, 0xd8, 0x14, 0x41, 0xc4, 0x8d, 0x60, 0x1a, 0x50, 0x18, 0x41, 0xc4,
-  0x00, 0x12, 0x43, 0x08, 0x41, 0x81, 0x84, 0x29, 0x14, 0x04, 0x00, 0x16,
-  0x0c, 0xc1, 0x60, 0x81, 0x28, 0x80, 0x28, 0x01, 0x00, 0x60, 0x82, 0xa8,
-  0xaa, 0x65, 0x43, 0x46, 0x38, 0xd1, 0x22, 0x4d, 0x28, 0x2e, 0x2e, 0x40,
-  0xa4, 0x21, 0x40, 0x08, 0x62, 0x60, 0x23, 0x28, 0x81, 0x00, 0x40, 0x08,
-  0x44, 0x40, 0x08, 0x66, 0x48, 0x84, 0x24, 0x42, 0x08, 0x00, 0x30, 0x68,
-  0x84, 0x84, 0x41, 0x4c, 0x41, 0x88, 0x22, 0x14, 0x05, 0x10, 0x28, 0x21,
-  0x14, 0x34, 0x48, 0x84, 0x83, 0x04, 0xf0, 0x14, 0x48, 0x42, 0x89, 0x88,
-  0x11, 0x0d, 0xc6, 0x08, 0x8c, 0xc2, 0x48, 0x42, 0x8f, 0xa2, 0x0c, 0x23,
-  0x61, 0x24, 0x80, 0xe1, 0x86, 0x21, 0x04, 0x00, 0x89, 0x91, 0x14, 0x81,
-  0x84, 0x45, 0x18, 0x08, 0x48, 0x11, 0x45, 0x82, 0x02, 0x20, 0x32, 0x84,
-  0x60, 0x84, 0x90, 0x28, 0x40, 0x02, 0x28, 0x22, 0x10, 0x28, 0x42, 0x04,
-  0x90, 0x48, 0x48, 0x8c, 0x01, 0x16, 0x08, 0x20, 0x04, 0xc0, 0x48, 0x12,
-  0x82, 0x00, 0x42, 0x42, 0x52, 0x46, 0x24, 0xf1, 0x1d, 0xbb, 0x40, 0x34,
-  0x44, 0x84, 0x00, 0x00, 0x18, 0x80, 0x34, 0x84, 0x20, 0x82, 0x04, 0x82,
-  0x12, 0x44, 0x00, 0x28, 0x84, 0x4c, 0x21, 0x11, 0x04, 0x40, 0x84, 0x22,
-  0x04, 0x44, 0x60, 0x84, 0x83, 0x04, 0x42, 0x41, 0x00, 0x18, 0x80, 0x01,
-  0x10, 0x84, 0x22, 0x42, 0x81, 0x21, 0x14, 0x14, 0x88, 0x11, 0x88, 0x0a,
-  0x18, 0x56, 0xf8, 0x79, 0x22, 0x00, 0x00, 0x41, 0x40, 0x44, 0x38, 0x22,
-  0x24, 0x44, 0x00, 0x00, 0x44, 0x26, 0x01, 0x00, 0x20, 0x24, 0x04, 0x20,
-  0x02, 0x00, 0xc1, 0x84, 0x81, 0x80, 0x84, 0x42, 0x84, 0x04, 0x81, 0x60,
-  0x41, 0x20, 0x28, 0x86, 0x24, 0x84, 0x04, 0x80, 0x01, 0x80, 0x24, 0x44,
-  0xa8, 0x12, 0x30, 0x28, 0x84, 0xe0, 0x74, 0x42, 0x42, 0x14, 0x54, 0x82,
-  0x43, 0x61, 0x85, 0x41, 0x24, 0x00, 0xa9, 0xa5, 0x81, 0x40, 0x88, 0x14,
-  0x2c, 0xa8, 0x14, 0x45, 0x01, 0x23, 0x82, 0x84, 0x34, 0x34, 0x82, 0x28,
-  0x42, 0x50, 0x48, 0x89, 0x62, 0x24, 0x10, 0x24, 0xb4, 0x48, 0x62, 0x44,
-  0x42, 0x10, 0x04, 0x1e, 0x4c, 0x18, 0x86, 0xa8, 0x12, 0x12, 0x80, 0x84,
-  0x06, 0x10, 0xa8, 0x14, 0x49, 0x08, 0x12, 0x83, 0x22, 0xbe, 0x48, 0x63,
-  0xc5, 0x42, 0x4f, 0xb4, 0x0a, 0x8a, 0x01, 0x00, 0x22, 0x48, 0x81, 0x1a,
-  0x02, 0x44, 0x40, 0x08, 0x45, 0x08, 0x13, 0x02, 0x40, 0x04, 0x28, 0x84,
-  0x10, 0x44, 0x44, 0x08, 0x22, 0x44, 0x84, 0x81, 0x22, 0x28, 0x00, 0x22,
-  0x44, 0x81, 0x00, 0x48, 0x18, 0x48, 0x83, 0x84, 0x04, 0x00, 0x13, 0xa1,
-  0x14, 0x20, 0xc4, 0x48, 0x81, 0x1a, 0x04, 0x00, 0x94, 0xcf, 0x48, 0x0c,
-  0x00, 0x44, 0x00, 0x44, 0x20, 0x11, 0x24, 0x42, 0x28, 0x42, 0x48, 0x04,
-  0x10, 0x48, 0x04, 0x85, 0x04, 0x40, 0x28, 0x02, 0x81, 0x41, 0x49, 0x02,
-  0x00, 0x00, 0x81, 0x48, 0x00, 0x84, 0x00, 0x00, 0x20, 0x11, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x42, 0xe0, 0x84, 0x08, 0x12, 0xbf, 0x36, 0x09, 0x00,
-  0x60, 0xc4, 0x81, 0x22, 0x83, 0x05, 0x18, 0x84, 0x48, 0x42, 0x00, 0x84,
-  0x42, 0x44, 0x28, 0x42, 0xe0, 0x84, 0x02, 0x00, 0x4a, 0x02, 0x83, 0x12,
-  0x18, 0x94, 0x24, 0x45, 0xc8, 0x48, 0x45, 0x08, 0xa0, 0x24, 0x00, 0x10,
-  0x28, 0x22, 0x12, 0x08, 0x1a, 0x08, 0x22, 0x41, 0x4c, 0x28, 0x08, 0x10,
-  0x98, 0xb8, 0x60, 0x84, 0xa0, 0x82, 0x62, 0x4f, 0xed, 0x01, 0x82, 0x49,
-  0x12, 0x28, 0x05, 0x18, 0x10, 0x14, 0x48, 0x04, 0x40, 0x04, 0x80, 0x02,
-  0x00, 0x10, 0x14, 0x18, 0x48, 0x08, 0x4c, 0x01, 0x50, 0x48, 0x48, 0x81,
-  0x30, 0x48, 0x10, 0x88, 0x82, 0x04, 0x00, 0x84, 0x60, 0x84, 0x40, 0x08,
-  0x60, 0x42, 0x20, 0x21, 0x22, 0x41, 0x08, 0x84, 0x22, 0x20, 0x52, 0x18,
-  0xaf, 0x43, 0x0e, 0x38, 0x12, 0x48, 0x28, 0x28, 0xa0, 0x21, 0x68, 0x28,
-  0x84, 0x49, 0x02, 0x4a, 0x02, 0x42, 0x44, 0x10, 0x28, 0xa2, 0x42, 0x20,
-  0x02, 0x00, 0x22, 0x81, 0x20, 0x42, 0x28, 0x06, 0x20, 0x04, 0x80, 0x82,
-  0x22, 0x02, 0x10, 0x28, 0x92, 0x28, 0x42, 0x43, 0x09, 0x12, 0x60, 0x42,
-  0x48, 0x81, 0x4a, 0x42, 0xa8, 0x12, 0x89, 0x21, 0x82, 0x05, 0x3f, 0x37,
-  0x0d, 0x20, 0x22, 0x42, 0x28, 0x61, 0x82, 0x81, 0x16, 0x28, 0x04, 0x84,
-  0x84, 0x81, 0x10, 0x48, 0x0c, 0x28, 0x84, 0x10, 0x48, 0x08, 0x00, 0x80,
-  0x02, 0x80, 0x02, 0x48, 0x20, 0x04, 0x00, 0x84, 0x00, 0x40, 0x08, 0x84,
-  0x20, 0x01, 0x92, 0x12, 0x18, 0x20, 0x22, 0x01, 0x20, 0x05, 0x84, 0x42,
-  0xbf, 0x1a, 0x0a, 0x41, 0x84, 0x49, 0x04, 0x44, 0x20, 0x14, 0x04, 0x22,
-  0x42, 0x22, 0x40, 0x38, 0x44, 0x2a, 0x04, 0x30, 0x44, 0x44, 0x00, 0x40,
-  0x88, 0x41, 0x14, 0x84, 0x02, 0x42, 0x20, 0x02, 0x00, 0x40, 0x08, 0x46,
-  0x08, 0x00, 0x00, 0x12, 0x88, 0x00, 0x28, 0x88, 0xb0, 0x14, 0x08, 0x88,
-  0x28, 0x82, 0x82, 0x88, 0xf0, 0xda, 0xc1, 0x00, 0x44, 0x1e, 0x48, 0x44,
-  0x00, 0x44, 0x50, 0x48, 0x00, 0x42, 0x00, 0x00, 0x44, 0x00, 0x00, 0x80,
-  0x04, 0x89, 0x01, 0xc0, 0x4c, 0x48, 0x00, 0x40, 0x24, 0x22, 0x24, 0x84,
-  0x82, 0x24, 0xc2, 0x28, 0x28, 0x22, 0x00, 0x8a, 0x82, 0xc2, 0x34, 0xa0,
-  0x28, 0x00, 0x20, 0x88, 0x52, 0x81, 0xa0, 0x12, 0x12, 0x81, 0x1f, 0xb7,
-  0x04, 0x58, 0x83, 0x2c, 0x02, 0x41, 0xc1, 0x60, 0x82, 0x22, 0x44, 0x22,
-  0x10, 0x44, 0x28, 0x42, 0x08, 0x10, 0x34, 0x28, 0x41, 0x28, 0x22, 0x10,
-  0xc8, 0x28, 0x00, 0x68, 0x84, 0x20, 0x22, 0x32, 0x28, 0x00, 0x81, 0x00,
-  0x00, 0x00, 0x32, 0x00, 0x42, 0x22, 0x00, 0x40, 0x08, 0x00, 0x28, 0x4e,
-  0x18, 0x94, 0x70, 0xf5, 0x05, 0xa6, 0x2c, 0xa1, 0x41, 0x22, 0x76, 0x28,
-  0x81, 0x82, 0x04, 0x00, 0x44, 0x90, 0x24, 0x41, 0x60, 0x84, 0x45, 0xc8,
-  0x28, 0x48, 0x00, 0x21, 0x12, 0x18, 0x80, 0x08, 0x81, 0xa0, 0x24, 0x84,
-  0x46, 0x01, 0x22, 0x84, 0x80, 0x16, 0x88, 0x32, 0x48, 0xa0, 0x21, 0x00,
-  0x28, 0x4c, 0x01, 0x68, 0x00, 0x26, 0x24, 0xca, 0x11, 0x12, 0x00, 0x23,
-  0x84, 0xe2, 0x97, 0x06, 0x4b, 0x13, 0x87, 0xc9, 0x87, 0x83, 0x4f, 0x46,
-  0xf1, 0x28, 0x1c, 0x1a, 0xc1, 0x44, 0x2e, 0x28, 0xc7, 0x44, 0x28, 0x84,
-  0x68, 0x4c, 0x04, 0xc4, 0x4f, 0x82, 0x16, 0x44, 0x94, 0x64, 0xc4, 0x8f,
-  0x84, 0x72, 0x28, 0x08, 0x10, 0xe8, 0x41, 0x12, 0x74, 0x28, 0xc4, 0x48,
-  0x43, 0x84, 0x82, 0x82, 0xa6, 0x62, 0x8c, 0x84, 0x42, 0x48, 0x58, 0x88,
-  0x28, 0x00, 0x28, 0x87, 0x82, 0x82, 0x9a, 0x02, 0x47, 0x41, 0x8a, 0xac,
-  0x1b, 0x4a, 0xd2, 0x84, 0x22, 0x2e, 0x98, 0x18, 0x2a, 0x9e, 0x48, 0xe6,
-  0x91, 0x18, 0x3f, 0xb1, 0x07, 0x48, 0xa2, 0x49, 0x81, 0x36, 0x54, 0x26,
-  0xe8, 0x84, 0xe1, 0x44, 0x84, 0x52, 0x84, 0x4a, 0x16, 0x58, 0x84, 0x41,
-  0x8b, 0x44, 0x42, 0x81, 0x89, 0x62, 0xc4, 0x2a, 0x42, 0x04, 0x8d, 0x68,
-  0x8b, 0x21, 0x4a, 0x72, 0x28, 0x98, 0x28, 0x45, 0x78, 0x68, 0xc4, 0x28,
-  0x8b, 0x44, 0x2e, 0x48, 0x85, 0x14, 0x28, 0xa4, 0x42, 0x89, 0x36, 0x28,
-  0x4a, 0x32, 0x28, 0x2a, 0x02, 0x36, 0xa8, 0x11, 0x18, 0x2e, 0x84, 0x3a,
-  0x82, 0x0a, 0x88, 0xb0, 0x28, 0xc1, 0xa8, 0x9d, 0x88, 0x9c, 0x62, 0x85,
-  0x2e, 0x18, 0x8d, 0xb1, 0x62, 0x9f, 0x48, 0x04, 0x4c, 0xb2, 0x44, 0xc3,
-  0x24, 0x85, 0x88, 0xd2, 0x4c, 0xb2, 0x38, 0xb2, 0x1c, 0x61, 0x83, 0x87,
-  0x42, 0x87, 0x42, 0x62, 0x89, 0x52, 0xc8, 0x49, 0x52, 0x48, 0x46, 0x7c,
-  0x24, 0x38, 0x28, 0xcb, 0x44, 0x41, 0x28, 0x40, 0x48, 0x18, 0x64, 0xc2,
-  0x68, 0x49, 0xb2, 0x28, 0x74, 0x24, 0x38, 0x48, 0x47, 0x84, 0x46, 0x88,
-  0x22, 0x24, 0x82, 0x22, 0x42, 0xd8, 0x88, 0xf4, 0x28, 0x28, 0x83, 0x84,
-  0xf2, 0x58, 0xa8, 0x18, 0x58, 0x2a, 0xc1, 0x14, 0x41, 0xe0, 0x41, 0x98,
-  0x18, 0x3a, 0xa3, 0x43, 0x89, 0xa1, 0xad, 0x1e, 0x48, 0x8c, 0xb6, 0x66,
-  0x02, 0x20, 0x02, 0x40, 0x08, 0x84, 0x00, 0x40, 0x08, 0x84, 0x00, 0x40,
-  0x08, 0x80, 0x82, 0x04, 0x48, 0x28, 0x48, 0x85, 0x84, 0x44, 0x04, 0x85,
-  0x04, 0x85, 0x24, 0x12, 0x28, 0x02, 0x00, 0x40, 0x28, 0x44, 0x28, 0x64,
-  0x81, 0x62, 0x20, 0x04, 0x42, 0x43, 0x21, 0x64, 0x81, 0x42, 0x13, 0x11,
-  0x08, 0x83, 0x04, 0x81, 0x7f, 0xeb, 0x08, 0x4f, 0x46, 0xf6, 0x34, 0x34,
-  0xcf, 0x81, 0xf3, 0x38, 0x3c, 0x4f, 0x85, 0xfd, 0x38, 0x18, 0x8d, 0x38,
-  0xcf, 0xc2, 0xf3, 0x68, 0x5c, 0x85, 0x74, 0x28, 0xa8, 0x24, 0x00, 0x85,
-  0x7c, 0x48, 0xa8, 0x66, 0x49, 0xb2, 0x68, 0x22, 0xb6, 0x28, 0xa4, 0x44,
-  0x8b, 0x44, 0x6a, 0xa4, 0x42, 0x6a, 0xa6, 0x44, 0x2e, 0x24, 0x4f, 0x42,
-  0xe4, 0xc4, 0xf4, 0x24, 0x4c, 0x4f, 0xc4, 0xc4, 0x68, 0x66, 0xa8, 0x42,
-  0x6a, 0x84, 0xd2, 0x4c, 0x52, 0xc4, 0x89, 0x86, 0xb4, 0x68, 0xb6, 0x28,
-  0xb2, 0x78, 0xa5, 0xd5, 0x4a, 0xa4, 0x35, 0x9a, 0xdd, 0x44, 0xfc, 0x54,
-  0x54, 0x49, 0xf2, 0xc8, 0xe4, 0x8b, 0x66, 0x8f, 0x85, 0xf3, 0x39, 0x78,
-  0xca, 0xa8, 0x22, 0x22, 0x8c, 0xf4, 0xd6, 0xdd, 0xf0, 0x64, 0x64, 0x4f,
-  0x43, 0xb7, 0x38, 0xf3, 0x38, 0x38, 0x8b, 0xd7, 0xcf, 0x82, 0xa3, 0x77,
-  0x4f, 0x46, 0xf6, 0x48, 0x4c, 0x8d, 0x2c, 0x4e, 0x24, 0x87, 0x86, 0x2a,
-  0x02, 0xc7, 0x84, 0x87, 0x84, 0x6a, 0x96, 0x24, 0x4a, 0x32, 0x6c, 0x4f,
-  0xa2, 0xb4, 0x42, 0x04, 0xab, 0x13, 0x2e, 0x48, 0x8f, 0x8e, 0xac, 0x46,
-  0x4b, 0xa2, 0x4f, 0xc6, 0xe2, 0xc4, 0xf4, 0x44, 0x44, 0x5d, 0x6d, 0x4a,
-  0xe6, 0x94, 0xe4, 0x84, 0xa4, 0x66, 0x6a, 0xf6, 0x24, 0x24, 0x45, 0xd4,
-  0x88, 0x84, 0xb4, 0x68, 0xa6, 0x46, 0x8b, 0x13, 0x8b, 0x91, 0x4f, 0x44,
-  0x2e, 0xa5, 0xda, 0x1a, 0xad, 0xe6, 0x4f, 0x46, 0xb4, 0xac, 0xa8, 0x9b,
-  0x8f, 0x9e, 0xf8, 0x38, 0x78, 0x8e, 0x8a, 0xaf, 0x8a, 0xe8, 0x1a, 0xde,
-  0x8a, 0xf5, 0x87, 0xcd, 0xa0, 0x66, 0x3a, 0x86, 0xd2, 0x88, 0xe3, 0xc4,
-  0xd5, 0x88, 0xf1, 0x5c, 0x3c, 0x8f, 0x86, 0xf7, 0x48, 0x58, 0xcd, 0x28,
-  0x4c, 0xa6, 0x46, 0x28, 0x44, 0x48, 0x8f, 0x86, 0xa6, 0x66, 0x44, 0x2e,
-  0x2c, 0x4f, 0x44, 0xe4, 0x46, 0xb2, 0x2a, 0xc6, 0x28, 0x2a, 0xf3, 0x68,
-  0x28, 0x2a, 0x2c, 0xe2, 0x46, 0xf6, 0x6c, 0x64, 0x4f, 0x82, 0xe4, 0xc6,
-  0xe2, 0x94, 0xf4, 0x64, 0x6c, 0x4e, 0x68, 0x6e, 0x68, 0x6a, 0x86, 0xd6,
-  0x44, 0xd2, 0x44, 0xb2, 0x28, 0x72, 0x68, 0x98, 0x28, 0x8b, 0x67, 0x8f,
-  0x82, 0xe3, 0x89, 0x6b, 0x4e, 0x1a, 0xa7, 0xb9, 0xca, 0xa8, 0x19, 0x4b,
-  0x46, 0x8f, 0x4b, 0xb9, 0xa8, 0xfa, 0x78, 0x98, 0x8f, 0x83, 0xf7, 0xa8,
-  0x88, 0x2b, 0xaa, 0x89, 0xe8, 0x86, 0xd5, 0x86, 0x06, 0x6a, 0xe6, 0x43,
-  0xf1, 0x14, 0x38, 0x8f, 0xc1, 0xe3, 0x85, 0xf5, 0x28, 0x3c, 0x8b, 0x35,
-  0x4f, 0x47, 0xf7, 0x58, 0x7c, 0xcf, 0xc2, 0xf2, 0x68, 0x48, 0x8f, 0x84,
-  0x96, 0x28, 0x41, 0x4e, 0x48, 0xcb, 0x66, 0x8b, 0x66, 0x47, 0x42, 0x4f,
-  0x44, 0xf4, 0x44, 0x4c, 0x6e, 0x24, 0x2f, 0x82, 0xe6, 0x24, 0xe6, 0x82,
-  0xe3, 0x86, 0xf2, 0x2c, 0xc8, 0x22, 0xee, 0x6c, 0xcf, 0xc6, 0x76, 0x64,
-  0xf8, 0x68, 0x44, 0x8f, 0x96, 0xf2, 0x2c, 0x64, 0x9f, 0x84, 0xa2, 0x66,
-  0x6a, 0xa6, 0x62, 0xcd, 0x24, 0x4d, 0x2c, 0x8f, 0x82, 0xa2, 0x26, 0x8f,
-  0x86, 0xe6, 0x81, 0xb2, 0x28, 0xb3, 0xf8, 0xef, 0x4e, 0xab, 0x61, 0x9a,
-  0xaa, 0x8c, 0x4f, 0x4d, 0x7d, 0x24, 0xf4, 0xbc, 0x98, 0xee, 0xc8, 0x8f,
-  0x87, 0xf9, 0x38, 0x71, 0xae, 0xb8, 0xaf, 0x8a, 0xfa, 0x68, 0xd3, 0x8f,
-  0x86, 0xf6, 0x7d, 0xb2, 0x00, 0x90, 0x14, 0x84, 0x49, 0x01, 0x49, 0x01,
-  0x41, 0x00, 0x84, 0x00, 0x44, 0x84, 0x28, 0x84, 0x81, 0x50, 0x48, 0x10,
-  0x08, 0x00, 0x00, 0x42, 0x30, 0x48, 0x30, 0x48, 0x00, 0x22, 0x30, 0x24,
-  0x84, 0x22, 0x48, 0x22, 0x1e, 0x48, 0xa0, 0x41, 0x22, 0x1a, 0x04, 0x12,
-  0x00, 0x28, 0x1a, 0x84, 0xa2, 0x41, 0x4a, 0x02, 0x28, 0x70, 0xa4, 0x0c,
-  0x41, 0x28, 0x80, 0x22, 0x42, 0x18, 0xa8, 0x21, 0x81, 0x00, 0x10, 0x08,
-  0x10, 0x04, 0x43, 0x02, 0x22, 0xa0, 0x42, 0x42, 0x22, 0x83, 0x04, 0x4c,
-  0xc2, 0x48, 0x85, 0x04, 0x28, 0x00, 0x20, 0x04, 0x00, 0x00, 0x84, 0x00,
-  0x81, 0x00, 0x00, 0x48, 0x80, 0x94, 0x18, 0x10, 0x08, 0x81, 0x12, 0x81,
-  0x48, 0x3f, 0xba, 0x06, 0x2e, 0x52, 0x1f, 0x41, 0x52, 0x28, 0x1f, 0x41,
-  0x32, 0x48, 0x1f, 0xc1, 0x32, 0x4a, 0x1d, 0x2c, 0xab, 0x14, 0x1d, 0x24,
-  0xab, 0x94, 0x1d, 0x28, 0xab, 0x94, 0x5d, 0x48, 0xab, 0x94, 0x43, 0xf2,
-  0x4a, 0x91, 0x47, 0x82, 0x2f, 0x14, 0x79, 0x24, 0xd8, 0x12, 0xfb, 0x24,
-  0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x8d, 0xa1, 0x4f, 0xa2, 0x64, 0x51, 0x4f,
-  0xa2, 0x74, 0x98, 0xf5, 0x24, 0x4a, 0x87, 0x59, 0x4f, 0xa2, 0xf4, 0x98,
-  0x24, 0x2e, 0x4a, 0x1f, 0x49, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f,
-  0x49, 0x32, 0x48, 0x1f, 0xc9, 0x32, 0x4a, 0x1f, 0xc9, 0xb2, 0x6a, 0xd1,
-  0xc1, 0xb2, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x53, 0xf1, 0x4a, 0x94, 0x43,
-  0xf3, 0x4a, 0x94, 0x47, 0x83, 0xab, 0x94, 0x47, 0x82, 0xab, 0x94, 0x4f,
-  0x82, 0x94, 0x98, 0x4f, 0xa2, 0xb4, 0x6f, 0x0d, 0x2c, 0xf4, 0x11, 0x4c,
-  0x85, 0xf2, 0x11, 0x64, 0x42, 0x1f, 0x41, 0x12, 0xd2, 0x41, 0x32, 0x4a,
-  0x15, 0xd4, 0x42, 0x19, 0xf1, 0x42, 0xb4, 0x51, 0xa9, 0x3b, 0x24, 0x2f,
-  0x14, 0x39, 0x24, 0x2d, 0x91, 0x45, 0xd8, 0x12, 0x79, 0x26, 0xd8, 0x12,
-  0xd9, 0xa4, 0xc1, 0x81, 0x2e, 0x92, 0x1e, 0x81, 0xa4, 0x96, 0xe1, 0x22,
-  0x64, 0x19, 0xbc, 0x64, 0x19, 0xac, 0x74, 0x91, 0xcc, 0x42, 0x1f, 0xc9,
-  0x56, 0x28, 0x1f, 0x49, 0x06, 0x1f, 0x49, 0x12, 0xfa, 0x81, 0x24, 0x29,
-  0x51, 0x41, 0xad, 0x14, 0x19, 0xd2, 0x4a, 0x1b, 0x91, 0x2a, 0x22, 0xa9,
-  0x38, 0x24, 0x21, 0x47, 0x82, 0x29, 0x79, 0x26, 0x98, 0x12, 0x4d, 0x5a,
-  0x2d, 0x92, 0x20, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x01, 0xef, 0x39, 0x09, 0x42, 0x00, 0x89, 0xc2, 0x18, 0x40, 0xc8,
-  0x24, 0x28, 0x20, 0x32, 0x88, 0x42, 0xe1, 0x84, 0x41, 0x84, 0x45, 0x41,
-  0x92, 0x44, 0x42, 0x54, 0x42, 0x41, 0x42, 0x45, 0x21, 0x14, 0x44, 0x14,
-  0x08, 0x00, 0x8c, 0x64, 0x24, 0x44, 0x22, 0x8c, 0x02, 0x48, 0x42, 0x20,
-  0xc1, 0x48, 0x48, 0x00, 0x89, 0x0d, 0x48, 0x30, 0x8c, 0x58, 0x8b, 0x42,
-  0x12, 0x22, 0x00, 0xf0, 0x4f, 0x69, 0x20, 0x21, 0x08, 0x41, 0x70, 0x12,
-  0x04, 0x29, 0x08, 0x8a, 0x42, 0x08, 0x84, 0x20, 0x14, 0x08, 0x83, 0x22,
-  0x06, 0xc0, 0x28, 0x43, 0xc2, 0x28, 0x44, 0x2a, 0x24, 0x02, 0x12, 0x44,
-  0x28, 0x4d, 0x48, 0x20, 0x02, 0x40, 0x62, 0x48, 0x28, 0x81, 0xe0, 0x41,
-  0x14, 0x82, 0x89, 0x88, 0x81, 0x08, 0x10, 0x98, 0x84, 0x18, 0x13, 0x02,
-  0x84, 0x48, 0x28, 0x4d, 0x51, 0x22, 0xbf, 0x4d, 0x03, 0x4a, 0x21, 0x0c,
-  0x26, 0x84, 0x11, 0x44, 0x02, 0x20, 0x9a, 0x2c, 0x83, 0xa8, 0x42, 0x41,
-  0x48, 0x84, 0x84, 0xd4, 0x46, 0x62, 0x44, 0x2c, 0x74, 0x2c, 0xb1, 0x24,
-  0x34, 0x18, 0x49, 0xe4, 0x5c, 0x82, 0x14, 0x04, 0xc4, 0x22, 0x17, 0xc4,
-  0xa0, 0x24, 0x89, 0x14, 0x26, 0x34, 0xaa, 0x28, 0x42, 0xa0, 0x14, 0x18,
-  0x1e, 0x88, 0x88, 0x41, 0x88, 0x2e, 0x8c, 0x90, 0x48, 0x88, 0x87, 0x49,
-  0x18, 0x89, 0x44, 0xc8, 0x62, 0xc0, 0x55, 0x32, 0x1f, 0xe1, 0x04, 0x00,
-  0x40, 0x58, 0x28, 0x12, 0x81, 0x4c, 0x2a, 0x02, 0x00, 0x85, 0x42, 0x18,
-  0x18, 0x04, 0x22, 0x28, 0x00, 0x00, 0x43, 0x02, 0x80, 0x02, 0x16, 0x04,
-  0x00, 0x40, 0x08, 0x80, 0x12, 0x04, 0x81, 0x48, 0x45, 0x02, 0x42, 0x48,
-  0x18, 0xa0, 0x14, 0x00, 0x41, 0xb0, 0x21, 0x84, 0x22, 0x01, 0x22, 0x00,
-  0x9f, 0x11, 0x06, 0x00, 0x20, 0x01, 0x48, 0x00, 0x10, 0x41, 0x01, 0x80,
-  0x04, 0x48, 0x00, 0x42, 0x11, 0x00, 0x40, 0x08, 0x22, 0x00, 0x20, 0x02,
-  0x00, 0x00, 0x48, 0x19, 0x02, 0x00, 0x44, 0x00, 0x90, 0x21, 0x30, 0x11,
-  0x4a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf0, 0x2d, 0x28, 0x20, 0x31,
-  0x24, 0x00, 0x84, 0x80, 0x02, 0x12, 0xb0, 0x12, 0x08, 0x18, 0x80, 0x18,
-  0xa2, 0x21, 0x4a, 0x02, 0x8c, 0x02, 0xc4, 0x90, 0x21, 0x80, 0x14, 0xc4,
-  0x24, 0x12, 0x00, 0x89, 0x44, 0x02, 0x18, 0x18, 0x44, 0x2d, 0x12, 0x60,
-  0x84, 0xc0, 0x44, 0x14, 0x84, 0x20, 0x24, 0x02, 0x42, 0x00, 0x84, 0x22,
-  0x4a, 0x41, 0x04, 0x89, 0x04, 0xf0, 0xff, 0x3c, 0x00, 0x28, 0x80, 0x41,
-  0x08, 0x00, 0x18, 0x24, 0x86, 0x01, 0x18, 0x48, 0x00, 0x28, 0x68, 0x48,
-  0x26, 0x08, 0x84, 0x60, 0x82, 0x80, 0x44, 0x34, 0x24, 0x18, 0x22, 0xc0,
-  0x48, 0x00, 0x80, 0x75, 0x24, 0x81, 0x11, 0x92, 0x48, 0x20, 0x04, 0x81,
-  0x26, 0x01, 0xa0, 0x14, 0x00, 0x10, 0x88, 0x02, 0x44, 0xc0, 0x48, 0x28,
-  0xf0, 0xa3, 0x5b, 0x80, 0x31, 0x44, 0x00, 0x20, 0x84, 0x02, 0x10, 0x31,
-  0x14, 0x20, 0x02, 0x82, 0x29, 0x24, 0x01, 0x10, 0x41, 0x12, 0x04, 0x16,
-  0x01, 0xa2, 0x00, 0x00, 0x10, 0x01, 0x21, 0x12, 0x60, 0x24, 0x00, 0x10,
-  0x44, 0x14, 0x01, 0x90, 0x44, 0x36, 0x21, 0x82, 0x04, 0x00, 0xa0, 0x41,
-  0x40, 0x02, 0x20, 0xf1, 0x5d, 0xe2, 0x00, 0x10, 0x01, 0x12, 0x19, 0x31,
-  0x68, 0x14, 0x10, 0x09, 0x46, 0x01, 0x00, 0x82, 0x10, 0x14, 0x42, 0x08,
-  0x10, 0x61, 0x18, 0x88, 0x41, 0x24, 0x41, 0x40, 0x02, 0x48, 0x00, 0x46,
-  0x64, 0x48, 0x80, 0x12, 0x81, 0x44, 0x01, 0x20, 0x01, 0x82, 0x00, 0x00,
-  0x26, 0x12, 0x1c, 0x04, 0x44, 0x84, 0x80, 0x41, 0xf4, 0x8c, 0xc4, 0xa0,
-  0x21, 0x22, 0x20, 0x03, 0x00, 0x48, 0x80, 0x04, 0xc0, 0x18, 0x11, 0x10,
-  0x29, 0x9c, 0x48, 0x34, 0x38, 0x81, 0x20, 0xc4, 0x48, 0x42, 0x4a, 0xa2,
-  0x42, 0x12, 0x00, 0x00, 0x12, 0xc8, 0x24, 0x24, 0x00, 0x18, 0x22, 0x41,
-  0x29, 0x02, 0x46, 0x14, 0x84, 0xa5, 0x14, 0x80, 0x31, 0x82, 0x2b, 0x1c,
-  0x20, 0x67, 0x84, 0x81, 0x48, 0x00, 0x89, 0xf4, 0x28, 0x31, 0x10, 0x02,
-  0x41, 0x20, 0x42, 0x08, 0x83, 0x32, 0x21, 0x90, 0x11, 0x00, 0x12, 0x18,
-  0x10, 0x02, 0x81, 0x24, 0x62, 0x10, 0x08, 0x00, 0x85, 0x14, 0x88, 0x04,
-  0x46, 0x02, 0x00, 0x80, 0x01, 0x20, 0x02, 0x42, 0x00, 0x29, 0x88, 0x04,
-  0x24, 0x8a, 0x84, 0x14, 0x04, 0x48, 0x80, 0x81, 0x04, 0x4c, 0x01, 0x28,
-  0x5f, 0x73, 0x4c, 0xa2, 0x21, 0x22, 0x15, 0x84, 0xa1, 0x12, 0x91, 0x28,
-  0x93, 0x36, 0x21, 0x81, 0x14, 0x42, 0x83, 0x41, 0x01, 0x11, 0x23, 0x34,
-  0x4c, 0x91, 0x16, 0x22, 0x06, 0x84, 0x99, 0x8c, 0x94, 0x44, 0x8f, 0x22,
-  0x94, 0x1c, 0x42, 0x24, 0x10, 0x02, 0x42, 0x43, 0x34, 0x86, 0x21, 0xc0,
-  0x11, 0x22, 0x5d, 0x42, 0x00, 0x2b, 0x84, 0x48, 0xd8, 0x30, 0xc2, 0x48,
-  0x69, 0xf8, 0x82, 0x22, 0x4d, 0x48, 0x46, 0xe4, 0x84, 0x81, 0x94, 0x48,
-  0x16, 0x24, 0xa1, 0x24, 0xff, 0x5e, 0x0e, 0x00, 0x80, 0x02, 0x12, 0x83,
-  0x04, 0x90, 0x41, 0x18, 0x11, 0x20, 0x81, 0x61, 0x88, 0x88, 0x50, 0x22,
-  0x26, 0x18, 0x08, 0x46, 0x01, 0x88, 0x22, 0x44, 0x00, 0x20, 0x84, 0x24,
-  0x81, 0x08, 0x18, 0x20, 0x82, 0x22, 0x04, 0x22, 0x90, 0x14, 0x44, 0xa0,
-  0x41, 0x20, 0x01, 0x1a, 0x04, 0x32, 0x50, 0x84, 0x00, 0x50, 0x84, 0x4f,
-  0xff, 0x08, 0xc0, 0x24, 0x40, 0x44, 0x01, 0x81, 0x30, 0x48, 0x00, 0x00,
-  0x00, 0x84, 0x81, 0x84, 0x00, 0x80, 0x04, 0x80, 0x12, 0x21, 0x15, 0x04,
-  0x21, 0x16, 0x84, 0x01, 0x00, 0x00, 0x88, 0x50, 0x22, 0x40, 0x01, 0x88,
-  0x00, 0x00, 0x41, 0x88, 0x40, 0x04, 0x00, 0x00, 0x80, 0xf4, 0xcb, 0xca,
-  0x00, 0x11, 0x18, 0x00, 0x81, 0x49, 0x12, 0x68, 0x22, 0x48, 0x18, 0x86,
-  0x21, 0x75, 0x42, 0x51, 0xa2, 0x2c, 0x98, 0x84, 0x88, 0x44, 0x49, 0x88,
-  0x32, 0x85, 0x13, 0x92, 0x45, 0x40, 0x04, 0x22, 0x40, 0x21, 0x24, 0x2a,
-  0x92, 0x14, 0x22, 0xd0, 0x26, 0x68, 0x41, 0x8e, 0x35, 0x15, 0x84, 0xa4,
-  0x81, 0x61, 0x00, 0x60, 0x14, 0x88, 0x42, 0x24, 0x12, 0x90, 0x82, 0x46,
-  0x24, 0xca, 0x28, 0x88, 0x28, 0x22, 0xaf, 0xe9, 0x0b, 0xb0, 0x44, 0x02,
-  0x44, 0x14, 0x30, 0x28, 0x84, 0x83, 0x24, 0x14, 0x04, 0x22, 0x11, 0x00,
-  0xa1, 0x00, 0x43, 0xc8, 0x22, 0x1c, 0xc4, 0x21, 0x4f, 0x11, 0x24, 0x32,
-  0x84, 0x90, 0x24, 0x10, 0x43, 0xb4, 0x21, 0x08, 0x12, 0x00, 0x42, 0x82,
-  0x43, 0x18, 0x04, 0x1d, 0x12, 0x44, 0x00, 0x41, 0x13, 0xa4, 0x82, 0x00,
-  0x18, 0x24, 0x82, 0x42, 0x28, 0x2c, 0x22, 0x08, 0x1a, 0xe2, 0xb2, 0x0a,
-  0x85, 0xf8, 0x48, 0x41, 0x4a, 0x25, 0x04, 0x84, 0x44, 0xc0, 0x22, 0xd0,
-  0x44, 0xd1, 0x54, 0xb8, 0x34, 0xb6, 0x22, 0x36, 0x2a, 0x27, 0x88, 0x4c,
-  0x68, 0x88, 0x41, 0x40, 0xd2, 0x62, 0x58, 0x22, 0x1a, 0xa1, 0x11, 0x1b,
-  0x89, 0xca, 0x29, 0x08, 0xa0, 0x14, 0x1d, 0x11, 0x17, 0x12, 0x51, 0x83,
-  0x42, 0xe2, 0x4c, 0xb4, 0x56, 0xf4, 0x41, 0x32, 0x14, 0x23, 0x24, 0x08,
-  0x82, 0x50, 0x44, 0x45, 0xb4, 0x24, 0xe2, 0x42, 0x26, 0x1a, 0x42, 0x04,
-  0x41, 0x88, 0xa4, 0x25, 0x72, 0x22, 0xa2, 0x15, 0x4f, 0xf8, 0x05, 0x22,
-  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x21, 0x00, 0x10, 0x02, 0x12, 0x41,
-  0x42, 0x10, 0x01, 0x42, 0x40, 0x01, 0x00, 0x20, 0x86, 0x48, 0x04, 0x00,
-  0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00,
-  0x6f, 0x55, 0x05, 0x81, 0x45, 0x28, 0x84, 0x04, 0x00, 0x10, 0x08, 0x10,
-  0x44, 0x24, 0x8a, 0x02, 0x00, 0x00, 0x88, 0x24, 0x10, 0x22, 0x81, 0x21,
-  0x88, 0x18, 0x02, 0x20, 0x91, 0x11, 0x1c, 0x48, 0x38, 0x28, 0xc4, 0x42,
-  0x48, 0x00, 0x20, 0x02, 0x00, 0x43, 0x41, 0x24, 0x8a, 0x03, 0x00, 0x45,
-  0x08, 0x40, 0x42, 0x18, 0xf2, 0xc4, 0x86, 0x40, 0x08, 0x48, 0x26, 0x02,
-  0x41, 0x20, 0x41, 0x02, 0x40, 0x04, 0x28, 0x38, 0x80, 0x18, 0x08, 0x14,
-  0x24, 0x10, 0x02, 0x18, 0x8a, 0x81, 0xa8, 0x84, 0x41, 0x41, 0x23, 0x02,
-  0x14, 0x00, 0x84, 0x80, 0xc4, 0x62, 0x00, 0x12, 0x20, 0x18, 0x02, 0x44,
-  0x44, 0x28, 0x19, 0x42, 0x02, 0x80, 0x21, 0xa4, 0x68, 0x10, 0x02, 0x8f,
-  0x35, 0x05, 0x80, 0x04, 0x00, 0x00, 0x28, 0x00, 0x44, 0x12, 0x28, 0x00,
-  0x14, 0x00, 0x80, 0x04, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01,
-  0x40, 0x08, 0x48, 0x00, 0x00, 0x80, 0x01, 0x88, 0x44, 0x24, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x21, 0x80, 0xf1, 0xd9, 0x1c, 0x00, 0x00, 0x00, 0x21,
-  0x00, 0x46, 0x88, 0x08, 0x10, 0x08, 0x1c, 0x04, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x20, 0x04, 0x00, 0x80, 0x09, 0x00, 0x25, 0x05,
-  0x00, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x41, 0x82, 0x00, 0xf0, 0x6b,
-  0x88, 0x10, 0x78, 0x48, 0xe8, 0x44, 0xb4, 0x41, 0x84, 0x42, 0x04, 0x26,
-  0x01, 0x30, 0x44, 0x41, 0x47, 0x42, 0x6a, 0xa2, 0x22, 0x12, 0x80, 0x08,
-  0x40, 0x46, 0x62, 0x22, 0x23, 0x21, 0xa1, 0x19, 0x8a, 0xa8, 0x88, 0x48,
-  0x00, 0x31, 0x17, 0x18, 0x15, 0x93, 0x88, 0x81, 0x83, 0xe4, 0x4c, 0xa4,
-  0x44, 0x28, 0x00, 0x11, 0x11, 0x10, 0x54, 0x44, 0x47, 0x42, 0x2a, 0xa2,
-  0x22, 0x10, 0x22, 0x08, 0x40, 0x46, 0x52, 0x22, 0x63, 0xf1, 0x42, 0x37,
-  0x00, 0x81, 0x20, 0x04, 0x10, 0x01, 0x50, 0x18, 0x80, 0x74, 0x44, 0x02,
-  0x22, 0x00, 0x00, 0x00, 0x28, 0x64, 0x1d, 0x24, 0x20, 0x01, 0x82, 0x00,
-  0x00, 0x90, 0x11, 0x12, 0x8c, 0x41, 0x08, 0x4e, 0x81, 0x00, 0x11, 0x22,
+  0x01, 0x1d, 0x0a, 0xf0, 0x04, 0x42, 0x00, 0x11, 0x42, 0x11, 0x10, 0x01,
+  0x00, 0x20, 0x14, 0x04, 0x14, 0xc0, 0x81, 0x40, 0x01, 0x14, 0x48, 0x41,
+  0xfd, 0x0d, 0xfc, 0x5e, 0x00, 0x40, 0xa2, 0x48, 0x00, 0x44, 0x70, 0xe3,
+  0x01, 0x48, 0x28, 0x24, 0x00, 0x00, 0x48, 0x20, 0x08, 0x00, 0x00, 0x2a,
+  0x44, 0x01, 0x14, 0xc0, 0x81, 0x60, 0x14, 0x00, 0x20, 0x24, 0x22, 0x04,
+  0x46, 0xa1, 0x82, 0x81, 0x41, 0xc2, 0x14, 0x44, 0x14, 0x40, 0x01, 0x14,
+  0x44, 0x14, 0x11, 0x88, 0x48, 0x14, 0x51, 0x14, 0x00, 0x48, 0x00, 0x80,
+  0x04, 0xf0, 0xfa, 0xdd, 0xe0, 0x32, 0xf4, 0x11, 0x24, 0xc7, 0x32, 0x1f,
+  0xc1, 0x72, 0x6c, 0xf1, 0x11, 0x2c, 0xaf, 0x16, 0xd1, 0xc1, 0xf2, 0x6e,
+  0x11, 0x1f, 0xc8, 0xb2, 0x6a, 0xd9, 0x81, 0xb2, 0x4a, 0x19, 0xb5, 0x4a,
+  0x39, 0x24, 0xaf, 0x14, 0x3b, 0x34, 0x2f, 0x34, 0x79, 0x24, 0xf8, 0x42,
+  0x91, 0x4f, 0x82, 0xe4, 0x14, 0x1d, 0x0a, 0xf1, 0x95, 0xd6, 0xd5, 0xa2,
+  0xe4, 0x4d, 0xc2, 0x5a, 0x1f, 0x4d, 0xd2, 0x24, 0xf4, 0x91, 0x24, 0x85,
+  0xf2, 0x91, 0x24, 0x87, 0x24, 0x1f, 0x49, 0x72, 0x6a, 0xf2, 0x91, 0x6c,
+  0xaf, 0x26, 0xf1, 0x91, 0x64, 0xaf, 0x24, 0xb9, 0x11, 0xf6, 0x4a, 0x92,
+  0x53, 0xf1, 0x4a, 0x92, 0x43, 0xf3, 0x4a, 0x92, 0x4b, 0x43, 0x2b, 0x94,
+  0x4f, 0x83, 0xb4, 0x42, 0xf9, 0x34, 0x48, 0x4e, 0x94, 0x4f, 0xa2, 0xf4,
+  0x75, 0xa2, 0xc0, 0x42, 0x56, 0xcc, 0x42, 0x12, 0x42, 0x30, 0x42, 0x44,
+  0x2b, 0x14, 0x82, 0x2f, 0x44, 0x21, 0xf8, 0x48, 0xb4, 0x41, 0x8b, 0xa4,
+  0x41, 0x8f, 0x14, 0x19, 0xe4, 0x14, 0x78, 0x84, 0xc8, 0x81, 0x6d, 0x48,
+  0x1c, 0xd9, 0xa6, 0xc1, 0x81, 0x4f, 0xa8, 0xe5, 0x11, 0x58, 0xa4, 0x96,
+  0xe1, 0x82, 0x64, 0x19, 0xb4, 0x8e, 0x21, 0x8c, 0xf4, 0x91, 0x2c, 0xf0,
+  0x91, 0x68, 0x85, 0xb2, 0x91, 0x36, 0x48, 0x1b, 0x29, 0x42, 0x13, 0x38,
+  0x48, 0x17, 0x48, 0x85, 0xb4, 0x81, 0xd2, 0x48, 0x1a, 0x95, 0xa8, 0x82,
+  0x81, 0xa2, 0x42, 0x26, 0x88, 0x78, 0x22, 0x88, 0xf8, 0xa6, 0x18, 0x7f,
+  0xb6, 0x06, 0x86, 0x28, 0x88, 0x38, 0x05, 0x10, 0x80, 0xc2, 0x05, 0x70,
+  0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x46, 0x37, 0x0a, 0x03, 0x86, 0x0b,
+  0xf0, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x25, 0x01, 0x8f, 0xc1, 0x42, 0x22,
+  0x51, 0x41, 0x10, 0x94, 0x14, 0x56, 0x11, 0x24, 0x12, 0x93, 0x41, 0x88,
+  0x2d, 0x11, 0x11, 0x14, 0x18, 0x27, 0x41, 0x82, 0xa4, 0x53, 0x38, 0x86,
+  0x10, 0x08, 0x49, 0x04, 0x81, 0x23, 0x54, 0x68, 0x19, 0x42, 0x46, 0xc4,
+  0x88, 0x41, 0x86, 0x88, 0x02, 0x50, 0x82, 0xa2, 0x81, 0x4c, 0x02, 0xa2,
+  0x81, 0x21, 0x81, 0x11, 0x8d, 0x81, 0x84, 0x21, 0x12, 0x12, 0x2c, 0x11,
+  0x88, 0x44, 0x08, 0x22, 0x30, 0x57, 0x00, 0x8a, 0x12, 0x02, 0x23, 0x92,
+  0x24, 0x2d, 0x18, 0x51, 0x2c, 0x62, 0xc2, 0x89, 0x81, 0x02, 0x40, 0x44,
+  0x41, 0x44, 0x34, 0x48, 0x8d, 0x23, 0x45, 0x09, 0x11, 0x2e, 0x82, 0x42,
+  0x44, 0x44, 0x22, 0x41, 0x10, 0x78, 0x42, 0x06, 0x44, 0x21, 0x00, 0x43,
+  0x01, 0x45, 0x22, 0x41, 0x99, 0x1a, 0x82, 0x8f, 0x14, 0x99, 0x42, 0x20,
+  0x34, 0x11, 0x81, 0x24, 0x10, 0x82, 0x12, 0x18, 0x22, 0x78, 0x44, 0x11,
+  0xf8, 0x42, 0xfe, 0x30, 0x12, 0x57, 0x2a, 0xc0, 0x44, 0x2d, 0x14, 0x47,
+  0x35, 0x8c, 0x51, 0x34, 0x30, 0x2a, 0x43, 0x98, 0x11, 0x11, 0xc0, 0x22,
+  0x16, 0x24, 0x58, 0x24, 0x47, 0xbc, 0xa6, 0x54, 0xa1, 0x84, 0x14, 0x1e,
+  0x66, 0x48, 0x64, 0x48, 0x4d, 0xa8, 0x17, 0x42, 0x44, 0xa4, 0x17, 0x8c,
+  0x21, 0x86, 0x9e, 0x28, 0x20, 0x74, 0x12, 0x88, 0x12, 0xb8, 0x22, 0x01,
+  0x10, 0xf8, 0x12, 0x89, 0x4d, 0x48, 0x14, 0x1b, 0x82, 0x8c, 0x41, 0x28,
+  0x91, 0x12, 0x16, 0x32, 0x28, 0x81, 0xa5, 0x02, 0x45, 0x21, 0xf1, 0x32,
+  0x91, 0x00, 0x00, 0x20, 0x82, 0x12, 0x84, 0x62, 0x12, 0x1d, 0x44, 0x8d,
+  0x12, 0x28, 0x10, 0xc1, 0x14, 0x11, 0x44, 0x84, 0x50, 0x81, 0x25, 0x04,
+  0x20, 0x08, 0x84, 0x44, 0x24, 0x40, 0x42, 0x14, 0x44, 0x04, 0x00, 0x10,
+  0x24, 0x18, 0x44, 0x54, 0x38, 0x9e, 0x28, 0x88, 0x48, 0x21, 0x30, 0x48,
+  0x11, 0x21, 0x40, 0x02, 0x80, 0x04, 0x82, 0x4a, 0x42, 0xf8, 0x65, 0x6d,
+  0x10, 0x84, 0x02, 0x00, 0x10, 0x88, 0x02, 0x28, 0x83, 0x84, 0x82, 0x01,
+  0x00, 0x00, 0x21, 0xc0, 0x24, 0x30, 0x48, 0x8c, 0x44, 0x04, 0x54, 0x60,
+  0x48, 0x48, 0x52, 0x48, 0x87, 0x44, 0x41, 0x44, 0x41, 0x40, 0x01, 0x43,
+  0x02, 0x18, 0x15, 0x08, 0x48, 0x10, 0x51, 0x12, 0x00, 0x40, 0x84, 0xc4,
+  0x24, 0x82, 0x00, 0x10, 0xf4, 0xfd, 0x27, 0x30, 0x62, 0x18, 0x24, 0x38,
+  0x61, 0x89, 0x22, 0x31, 0x18, 0x4a, 0xc2, 0x81, 0x40, 0x88, 0x54, 0x34,
+  0x48, 0x9d, 0x92, 0x26, 0x88, 0xf4, 0x14, 0x68, 0xcd, 0x12, 0x46, 0x29,
+  0x24, 0x82, 0x98, 0x48, 0x42, 0x89, 0xc2, 0x44, 0x83, 0xc4, 0x14, 0x26,
+  0x34, 0x94, 0xc0, 0x12, 0x48, 0x12, 0x21, 0x22, 0x43, 0x91, 0x11, 0xc7,
+  0x12, 0x83, 0x9a, 0x44, 0x53, 0x44, 0xa9, 0x48, 0x42, 0x48, 0x42, 0x59,
+  0x0c, 0x22, 0xc4, 0x81, 0x8d, 0x42, 0x8f, 0x44, 0x02, 0xc4, 0x60, 0x9d,
+  0xa0, 0x24, 0x12, 0x30, 0x12, 0x60, 0x82, 0x60, 0x81, 0x28, 0x19, 0xc8,
+  0x48, 0x8c, 0x82, 0x51, 0x14, 0x23, 0x24, 0xc1, 0x28, 0x90, 0x42, 0x89,
+  0x11, 0x83, 0xc4, 0x48, 0x83, 0x68, 0x44, 0x42, 0x9c, 0x42, 0xc4, 0x4c,
+  0x18, 0x4b, 0x61, 0x12, 0xc4, 0x18, 0x63, 0x44, 0x02, 0x11, 0x41, 0x43,
+  0xd2, 0x41, 0xe2, 0x81, 0xd8, 0x48, 0x44, 0x41, 0x88, 0x68, 0x14, 0x25,
+  0x81, 0xb4, 0x41, 0x08, 0x28, 0x81, 0x44, 0x30, 0x44, 0x50, 0x48, 0xf0,
+  0x27, 0x37, 0x50, 0x42, 0x28, 0x20, 0x12, 0x06, 0x83, 0x81, 0x82, 0x24,
+  0x02, 0x80, 0x04, 0x70, 0x81, 0x0a, 0x42, 0xcc, 0x43, 0x34, 0x6c, 0x20,
+  0x82, 0x14, 0x08, 0x44, 0x42, 0x88, 0x4c, 0x04, 0x4b, 0x48, 0x42, 0x41,
+  0xc0, 0x14, 0x20, 0x82, 0x61, 0x11, 0x81, 0x28, 0x11, 0x46, 0x94, 0x41,
+  0x42, 0x20, 0x04, 0x44, 0x10, 0x34, 0x44, 0x83, 0xd2, 0x28, 0x9c, 0x28,
+  0x00, 0x41, 0x2e, 0x8e, 0x00, 0x00, 0x21, 0x1e, 0x28, 0x41, 0x81, 0x80,
+  0x82, 0x13, 0x84, 0x12, 0x08, 0x00, 0x58, 0x19, 0x04, 0x18, 0x22, 0x80,
+  0xe4, 0x11, 0x52, 0x84, 0x86, 0x58, 0x28, 0x90, 0x44, 0x84, 0x41, 0x10,
+  0x24, 0x18, 0x18, 0x24, 0xc5, 0x24, 0x18, 0x8c, 0x52, 0x48, 0x82, 0x61,
+  0x48, 0x69, 0x14, 0x04, 0x2c, 0x11, 0x04, 0x20, 0x13, 0x24, 0x91, 0x48,
+  0x28, 0x84, 0x43, 0x21, 0xf2, 0x65, 0x7a, 0x00, 0x56, 0x44, 0x04, 0x48,
+  0x12, 0x40, 0x08, 0x41, 0x51, 0x30, 0x21, 0x25, 0x04, 0x11, 0x44, 0x64,
+  0x12, 0x20, 0x11, 0x08, 0x12, 0x28, 0x86, 0x04, 0x00, 0x42, 0x90, 0x21,
+  0x18, 0x81, 0x15, 0x88, 0x34, 0x44, 0xa3, 0x02, 0xf2, 0xa0, 0x12, 0x51,
+  0x87, 0x12, 0x10, 0x39, 0x88, 0x89, 0x02, 0x24, 0x22, 0x21, 0xa0, 0x21,
+  0xe0, 0x81, 0xf8, 0x7e, 0x2e, 0x00, 0x21, 0x21, 0x40, 0x04, 0x21, 0x49,
+  0x81, 0x24, 0x04, 0x00, 0x91, 0x10, 0x18, 0x28, 0x31, 0xa4, 0x46, 0x14,
+  0x01, 0x44, 0x48, 0x48, 0x00, 0x4b, 0x24, 0x24, 0x44, 0x12, 0x12, 0x00,
+  0x44, 0x00, 0x10, 0x42, 0x44, 0x71, 0x14, 0x18, 0x88, 0x03, 0x12, 0x88,
+  0x20, 0x04, 0x52, 0x41, 0x10, 0x08, 0x00, 0x89, 0x04, 0xcf, 0x19, 0x0e,
+  0x24, 0x10, 0x12, 0xd2, 0x48, 0x31, 0x14, 0xa1, 0x49, 0x81, 0x42, 0x14,
+  0x21, 0x42, 0x18, 0x04, 0x11, 0xc1, 0x46, 0x27, 0xb8, 0x44, 0x91, 0x11,
+  0x81, 0x44, 0x14, 0x28, 0x45, 0x48, 0x9a, 0x24, 0x4c, 0x74, 0x42, 0x2c,
+  0x81, 0x93, 0x14, 0x83, 0x58, 0x41, 0x49, 0xc4, 0x14, 0x26, 0x14, 0x52,
+  0x48, 0xd4, 0x6c, 0x11, 0x6c, 0x24, 0x4c, 0x05, 0x89, 0x88, 0xc1, 0x4d,
+  0x84, 0x4e, 0x38, 0x18, 0x24, 0x26, 0x18, 0x02, 0x38, 0x47, 0x81, 0x89,
+  0x78, 0xe9, 0x01, 0x60, 0x41, 0x41, 0x20, 0x06, 0x40, 0x28, 0xa4, 0x61,
+  0x00, 0x34, 0x15, 0x08, 0x84, 0x4a, 0x21, 0xc1, 0x34, 0x80, 0x02, 0x42,
+  0x2a, 0x74, 0x48, 0x04, 0x80, 0x93, 0x08, 0xf0, 0x47, 0x12, 0x22, 0x90,
+  0x88, 0x28, 0x2a, 0x01, 0x1c, 0x91, 0x21, 0x24, 0x80, 0x08, 0x4c, 0x12,
+  0x84, 0xc1, 0x48, 0x28, 0x84, 0x42, 0x22, 0xaf, 0xab, 0x06, 0x29, 0x92,
+  0x24, 0x22, 0xc0, 0x24, 0x00, 0x80, 0x92, 0x24, 0x80, 0x82, 0x42, 0x04,
+  0x14, 0x40, 0x28, 0x02, 0x28, 0x10, 0x24, 0x03, 0x42, 0x30, 0x28, 0x42,
+  0x84, 0x26, 0x04, 0x10, 0x08, 0x88, 0x00, 0x4b, 0x41, 0x81, 0x12, 0x10,
+  0x08, 0x4a, 0x08, 0x40, 0x04, 0x20, 0x55, 0x84, 0x22, 0x00, 0x90, 0x44,
+  0x48, 0xe0, 0x13, 0x02, 0x00, 0x20, 0x03, 0x26, 0x08, 0x8d, 0x24, 0x27,
+  0x0f, 0xf1, 0x0b, 0x47, 0x82, 0x41, 0x18, 0x84, 0x60, 0x44, 0x00, 0x44,
+  0x22, 0x80, 0x14, 0x24, 0x22, 0x02, 0x44, 0xcc, 0x82, 0xa4, 0x21, 0x40,
+  0x48, 0x04, 0x44, 0x28, 0x85, 0x92, 0x02, 0xf0, 0xd4, 0x12, 0x00, 0x45,
+  0x38, 0x34, 0x90, 0x44, 0x00, 0x41, 0x2d, 0x9d, 0x80, 0x82, 0x21, 0x03,
+  0x26, 0x04, 0x00, 0x8c, 0x02, 0x8c, 0x02, 0x00, 0x40, 0x08, 0x41, 0x10,
+  0x08, 0x4c, 0x06, 0x48, 0x90, 0x14, 0x80, 0x34, 0x28, 0x48, 0x84, 0x20,
+  0x01, 0x81, 0x00, 0x80, 0x02, 0x41, 0x80, 0xa1, 0x24, 0x68, 0x43, 0x81,
+  0x02, 0x20, 0x04, 0x00, 0x14, 0x80, 0x24, 0x22, 0x01, 0xbf, 0x48, 0x06,
+  0x41, 0x00, 0x41, 0x40, 0x4c, 0x04, 0x90, 0x48, 0x00, 0x18, 0x20, 0x02,
+  0x00, 0x4c, 0x91, 0x24, 0x00, 0x44, 0x80, 0x62, 0x82, 0x41, 0x00, 0x00,
+  0x84, 0x10, 0x01, 0x48, 0x42, 0x41, 0x80, 0x01, 0x12, 0x85, 0x04, 0x4c,
+  0x28, 0x02, 0x49, 0x01, 0x90, 0x44, 0x40, 0xc1, 0x8c, 0x45, 0x88, 0x41,
+  0x88, 0x88, 0xf4, 0x92, 0xa4, 0x24, 0x82, 0x40, 0x14, 0x02, 0x00, 0x22,
+  0x44, 0x00, 0x40, 0x14, 0x14, 0x14, 0x91, 0x24, 0x11, 0x00, 0x41, 0x11,
+  0x80, 0x02, 0x20, 0xa4, 0x28, 0x41, 0x45, 0x88, 0x46, 0xc4, 0x18, 0x81,
+  0x88, 0x12, 0x41, 0x20, 0x05, 0x84, 0x54, 0x00, 0x40, 0x01, 0x00, 0x10,
+  0x04, 0x00, 0x50, 0x84, 0x42, 0xc4, 0x83, 0xf4, 0xb4, 0xe9, 0x00, 0x00,
+  0x20, 0x01, 0x22, 0x84, 0x00, 0xe0, 0xc2, 0x01, 0x00, 0x41, 0x00, 0x10,
+  0x84, 0x46, 0x04, 0x00, 0x89, 0x08, 0x80, 0x04, 0x44, 0x8c, 0x02, 0x38,
+  0x89, 0x41, 0x28, 0x84, 0x04, 0x89, 0x82, 0x81, 0x22, 0x12, 0x04, 0x20,
+  0x01, 0x80, 0x24, 0x01, 0x1e, 0x84, 0x22, 0x41, 0x90, 0x88, 0x40, 0xf4,
+  0xd5, 0x67, 0x00, 0x00, 0x90, 0x48, 0x10, 0x08, 0x15, 0x02, 0xe0, 0x10,
+  0xc8, 0x18, 0x00, 0x80, 0xa2, 0x24, 0x44, 0xc1, 0x90, 0x28, 0xc3, 0x04,
+  0x42, 0xf1, 0x05, 0xf0, 0x38, 0x28, 0x44, 0x44, 0x00, 0x00, 0x20, 0x88,
+  0x02, 0x18, 0x12, 0xc0, 0x14, 0x81, 0x00, 0x00, 0x2a, 0x04, 0x2f, 0xb6,
+  0x0c, 0xd0, 0x48, 0x42, 0x84, 0x24, 0x41, 0x04, 0x40, 0x2c, 0xc2, 0x2c,
+  0x12, 0x43, 0x01, 0x20, 0x12, 0x91, 0x21, 0x53, 0x01, 0x80, 0x34, 0x61,
+  0x42, 0x44, 0x62, 0x80, 0x48, 0x0c, 0x81, 0x42, 0x41, 0x4a, 0x01, 0x4a,
+  0x01, 0x20, 0x88, 0x51, 0x94, 0x89, 0x61, 0x41, 0x40, 0xa1, 0x61, 0x80,
+  0x24, 0x04, 0x00, 0x60, 0x18, 0x01, 0xf0, 0xff, 0x4a, 0x4f, 0xe6, 0x07,
+  0xc4, 0x12, 0x48, 0x4b, 0x21, 0x80, 0x62, 0x42, 0x41, 0x50, 0x84, 0x40,
+  0x2c, 0x02, 0x84, 0x80, 0x42, 0x04, 0x22, 0x40, 0x11, 0x02, 0x8c, 0x61,
+  0x41, 0xc9, 0x02, 0x90, 0x24, 0x00, 0x1c, 0x02, 0x28, 0x84, 0x80, 0x86,
+  0x02, 0x82, 0x22, 0xc0, 0x74, 0x4c, 0x12, 0x61, 0x45, 0x12, 0x1a, 0x02,
+  0x00, 0x1a, 0x28, 0x48, 0x28, 0xe1, 0x42, 0x38, 0x9e, 0xf0, 0x13, 0x1c,
+  0x24, 0x21, 0x4f, 0x8b, 0xa1, 0x22, 0x1a, 0x94, 0x14, 0x4b, 0x22, 0x28,
+  0x40, 0x24, 0x12, 0xa4, 0x22, 0x4c, 0x42, 0x04, 0x40, 0xc1, 0x14, 0x8f,
+  0x11, 0x13, 0x8c, 0x86, 0xe6, 0x14, 0x42, 0x34, 0x28, 0x2e, 0x34, 0x2a,
+  0xe2, 0xc8, 0x0e, 0x00, 0x44, 0x49, 0x33, 0x59, 0x8d, 0x28, 0x40, 0x9c,
+  0x24, 0x4a, 0x57, 0x84, 0x1b, 0x19, 0x47, 0x41, 0x83, 0xa1, 0x14, 0x5b,
+  0x64, 0x1c, 0x82, 0x06, 0x12, 0x42, 0x41, 0x00, 0x47, 0x48, 0x45, 0x54,
+  0x44, 0x83, 0xe6, 0x48, 0x64, 0xc4, 0x2f, 0xe3, 0x06, 0x40, 0x44, 0xe6,
+  0x42, 0x22, 0x54, 0x48, 0x44, 0x41, 0x84, 0xcc, 0x42, 0x88, 0xa1, 0x12,
+  0x30, 0x24, 0x87, 0xc2, 0x41, 0x83, 0x01, 0x22, 0x47, 0x44, 0x30, 0x24,
+  0x49, 0x44, 0x78, 0xd4, 0x18, 0x14, 0x54, 0xc4, 0x8d, 0x48, 0x85, 0x18,
+  0x08, 0x84, 0x18, 0x4a, 0x28, 0x64, 0x42, 0x43, 0x7b, 0x18, 0x44, 0xd4,
+  0x88, 0xf2, 0x24, 0x34, 0x16, 0x64, 0x4a, 0x1a, 0x28, 0x03, 0x18, 0x18,
+  0x46, 0x54, 0xc4, 0x44, 0x8c, 0x08, 0x8c, 0xd1, 0x84, 0xf2, 0x18, 0x88,
+  0x49, 0xf4, 0xa9, 0x74, 0xf0, 0x24, 0x24, 0x28, 0x43, 0x91, 0x14, 0x8f,
+  0x43, 0x42, 0x38, 0x2c, 0x8f, 0xc2, 0xb2, 0x2c, 0x36, 0x4c, 0x8b, 0x22,
+  0x87, 0x81, 0x43, 0x11, 0x14, 0xd8, 0x15, 0xf2, 0x28, 0x24, 0x57, 0x92,
+  0x45, 0xc4, 0x24, 0x22, 0x57, 0x56, 0x4c, 0xa4, 0x36, 0x4d, 0x24, 0x89,
+  0xf4, 0x48, 0x4c, 0x83, 0xb6, 0x68, 0xf6, 0x64, 0x24, 0x4f, 0x42, 0xd6,
+  0x84, 0x76, 0x38, 0x8c, 0x27, 0xab, 0x51, 0x48, 0x40, 0x84, 0x73, 0x2c,
+  0xb8, 0x21, 0x41, 0xb8, 0x24, 0x86, 0xf8, 0x61, 0x14, 0x18, 0x4f, 0x45,
+  0x81, 0xa4, 0x41, 0x1a, 0x85, 0xf1, 0x9c, 0xb8, 0x8b, 0x33, 0x85, 0xa8,
+  0x45, 0x8e, 0xc4, 0x4b, 0x36, 0xf0, 0xf6, 0x57, 0x00, 0x41, 0x00, 0x84,
+  0x41, 0x84, 0x41, 0x00, 0x00, 0x40, 0x44, 0x48, 0x54, 0x81, 0x44, 0x11,
+  0x44, 0x00, 0x11, 0x00, 0x44, 0x1a, 0x03, 0xf0, 0xff, 0xff, 0x71, 0x80,
+  0x08, 0x00, 0x49, 0x01, 0x49, 0x01, 0x41, 0x40, 0x21, 0x08, 0x00, 0x40,
+  0x24, 0x41, 0x04, 0x81, 0x10, 0x08, 0xf0, 0x46, 0xe4, 0x20, 0x32, 0x24,
+  0x4f, 0x63, 0xf1, 0x36, 0x24, 0x8f, 0xc5, 0x05, 0x85, 0x08, 0x4b, 0x44,
+  0x8f, 0x84, 0x56, 0x88, 0x87, 0x81, 0x12, 0x45, 0x14, 0x58, 0x48, 0xcf,
+  0x42, 0xa2, 0x33, 0x8f, 0x83, 0xf1, 0x28, 0x2c, 0x4d, 0x64, 0x4d, 0x64,
+  0x41, 0x4d, 0x44, 0x4f, 0xc4, 0xf4, 0x28, 0x28, 0x26, 0x78, 0x68, 0x5c,
+  0xcc, 0xcf, 0xc4, 0xf6, 0x4c, 0x6c, 0x8f, 0x82, 0xf2, 0x78, 0x68, 0x85,
+  0xa8, 0x77, 0x9a, 0x51, 0xc4, 0x2a, 0xa2, 0x8a, 0x85, 0xf8, 0x9d, 0x99,
+  0x9f, 0xd1, 0xf1, 0x18, 0x3c, 0x4b, 0x71, 0x2a, 0xa2, 0xb7, 0x4a, 0x26,
+  0xa4, 0x55, 0x42, 0xd0, 0x88, 0xf1, 0x98, 0x98, 0x9a, 0xa1, 0x11, 0x1a,
+  0xf1, 0x9c, 0x9c, 0x4f, 0x41, 0x59, 0x88, 0x8f, 0x9f, 0x45, 0x32, 0x22,
+  0x4f, 0xc5, 0x65, 0x22, 0x2b, 0x43, 0x5e, 0x78, 0x45, 0x14, 0x7c, 0x24,
+  0xa4, 0x44, 0xcb, 0x66, 0x44, 0x8f, 0x83, 0xa1, 0x13, 0xf0, 0x2c, 0x24,
+  0x45, 0x75, 0x28, 0xec, 0x13, 0xf3, 0x38, 0x18, 0xcd, 0x2c, 0x6c, 0xf2,
+  0x66, 0x65, 0x4f, 0x46, 0xf6, 0x26, 0x74, 0xcf, 0xc6, 0xf4, 0x2c, 0x2c,
+  0x8f, 0xc2, 0xf6, 0xec, 0xe8, 0xcf, 0xc2, 0xd4, 0x88, 0xf4, 0x48, 0x68,
+  0xdf, 0xd6, 0xf6, 0x6c, 0x7c, 0x8d, 0x19, 0x8f, 0x87, 0xa7, 0x19, 0x45,
+  0x44, 0xf4, 0xd4, 0x94, 0x87, 0xc1, 0x9f, 0xd9, 0xf8, 0x18, 0x18, 0x8d,
+  0x1c, 0x5a, 0xb7, 0x64, 0xf2, 0x71, 0x34, 0x4a, 0xa6, 0x36, 0x5a, 0xa5,
+  0x74, 0x4d, 0x44, 0xc5, 0xf8, 0xbc, 0x8c, 0xc7, 0x83, 0x4f, 0xc1, 0xf1,
+  0x18, 0x5e, 0x2b, 0xff, 0x8b, 0xb9, 0x6f, 0xc1, 0xf1, 0x5c, 0xd7, 0x60,
+  0x42, 0x4b, 0x51, 0x47, 0x62, 0x67, 0x43, 0x8f, 0xc5, 0x55, 0x88, 0x85,
+  0x5c, 0xc8, 0x4e, 0x44, 0x6a, 0x56, 0xc8, 0x87, 0x83, 0x1a, 0x53, 0x44,
+  0x85, 0x58, 0xd9, 0x57, 0x52, 0x9f, 0x92, 0xf2, 0x29, 0x11, 0x8d, 0x24,
+  0x4d, 0x24, 0x7f, 0x52, 0x72, 0x25, 0xf5, 0x44, 0x54, 0xcf, 0xc4, 0xf4,
+  0x6c, 0xc8, 0xcf, 0x82, 0xf4, 0x28, 0x6c, 0xc7, 0xc2, 0x85, 0xf8, 0x4c,
+  0x6c, 0x8f, 0x92, 0xf2, 0x7c, 0x6c, 0x8f, 0x84, 0xe4, 0x8e, 0xaf, 0x4c,
+  0x4d, 0x44, 0x4b, 0x22, 0x4b, 0xba, 0x8d, 0x18, 0xdf, 0x99, 0xf9, 0x39,
+  0x3d, 0x8f, 0xc3, 0xe3, 0x45, 0xf3, 0x71, 0xb1, 0x1f, 0x55, 0xab, 0x64,
+  0x4a, 0xa2, 0x55, 0x4a, 0xa1, 0x15, 0x4d, 0x1c, 0xbe, 0xbc, 0x3e, 0x34,
+  0xc5, 0xb8, 0x14, 0xf5, 0xce, 0xc8, 0x4b, 0x99, 0xcd, 0x5c, 0x5f, 0x1c,
+  0x48, 0x42, 0xf4, 0x1c, 0x54, 0x26, 0x72, 0x72, 0xf4, 0x64, 0x6c, 0x45,
+  0x3c, 0x2c, 0xc5, 0x04, 0x2e, 0x24, 0x84, 0x16, 0xa8, 0x31, 0x45, 0x54,
+  0x88, 0x54, 0xd5, 0xfd, 0x3c, 0x29, 0x9f, 0x13, 0xd1, 0x48, 0xf2, 0x44,
+  0x64, 0x6f, 0x56, 0xf6, 0x25, 0x27, 0x6e, 0x64, 0xcf, 0xc6, 0xf6, 0x6c,
+  0x4c, 0x8f, 0xc2, 0xf6, 0xa8, 0x6c, 0xcf, 0xc6, 0xf4, 0x48, 0x44, 0x8f,
+  0xc4, 0xf4, 0x4c, 0x41, 0xcf, 0x87, 0xb7, 0x79, 0xe7, 0x8f, 0xaf, 0x4c,
+  0x45, 0x44, 0xf4, 0x94, 0x94, 0x4f, 0xc3, 0xf2, 0xbd, 0xbd, 0x4f, 0x83,
+  0xf3, 0x3c, 0x3c, 0x7a, 0xf3, 0x51, 0xb5, 0x1b, 0xb7, 0x4a, 0xa6, 0x35,
+  0x5a, 0xa5, 0x16, 0x4f, 0x45, 0x11, 0xf4, 0xb4, 0xb4, 0xcf, 0x83, 0x52,
+  0xc4, 0x5e, 0x54, 0xef, 0xcc, 0xfe, 0x98, 0x92, 0x4f, 0x84, 0xe5, 0x72,
+  0x08, 0x23, 0x02, 0x18, 0x80, 0x01, 0x22, 0x00, 0x84, 0x22, 0x84, 0x00,
+  0x00, 0x28, 0x80, 0x02, 0x44, 0x00, 0x10, 0x08, 0x89, 0x02, 0x8d, 0x24,
+  0x90, 0x28, 0x41, 0x81, 0x18, 0x00, 0x20, 0x02, 0x18, 0x84, 0x49, 0x01,
+  0x20, 0x01, 0x12, 0x20, 0x01, 0x40, 0x24, 0xc8, 0x24, 0x12, 0x87, 0x44,
+  0x10, 0x08, 0xbe, 0x22, 0x30, 0x84, 0x10, 0x84, 0x92, 0x14, 0x10, 0x04,
+  0x41, 0x00, 0x80, 0x11, 0x04, 0x41, 0x14, 0x43, 0xc2, 0x11, 0x22, 0x20,
+  0x42, 0x15, 0x04, 0x48, 0x44, 0x00, 0x40, 0x84, 0x84, 0xa2, 0x42, 0x52,
+  0x00, 0x40, 0x14, 0x94, 0x21, 0x81, 0x1a, 0x32, 0x24, 0xe0, 0x16, 0x01,
+  0x42, 0x00, 0x00, 0x12, 0x81, 0x00, 0x43, 0x88, 0x4b, 0xf1, 0xac, 0xc6,
+  0xd0, 0x24, 0xf4, 0x11, 0x24, 0x85, 0xf2, 0x11, 0x24, 0xc3, 0xf6, 0x91,
+  0x24, 0xe3, 0xd4, 0x41, 0xb2, 0x6a, 0xd1, 0x41, 0xb2, 0x4a, 0x99, 0x21,
+  0xab, 0x94, 0x51, 0xaf, 0x44, 0x39, 0x24, 0xaf, 0x54, 0x39, 0x24, 0x2f,
+  0x54, 0xb3, 0x09, 0x13, 0x95, 0xb3, 0x09, 0xf2, 0x1b, 0x1c, 0xfa, 0x24,
+  0x4a, 0x56, 0xf5, 0x24, 0x4a, 0xd6, 0xe5, 0xa2, 0x64, 0x59, 0xac, 0xe4,
+  0x49, 0xc2, 0x4a, 0x1f, 0x49, 0xc2, 0xc2, 0x1f, 0x49, 0x52, 0x2c, 0x1f,
+  0x49, 0xb2, 0x4c, 0xf1, 0x91, 0x24, 0xeb, 0x14, 0x1f, 0x48, 0xb2, 0x4a,
+  0xd1, 0x41, 0xb6, 0x46, 0x00, 0x41, 0xab, 0x94, 0x4b, 0x42, 0x4a, 0x00,
+  0xf1, 0x40, 0x44, 0x79, 0x24, 0x98, 0x9a, 0x4f, 0x82, 0xa4, 0x94, 0x4f,
+  0xa2, 0x74, 0xf6, 0x0f, 0x2c, 0xf4, 0x11, 0x6c, 0x85, 0xf2, 0x11, 0x64,
+  0x70, 0x11, 0x34, 0x42, 0x1d, 0x24, 0xa9, 0x51, 0x41, 0xaf, 0x44, 0x99,
+  0x21, 0xaf, 0x44, 0x1b, 0xb1, 0x42, 0x2b, 0xb2, 0x42, 0x29, 0xb2, 0x4a,
+  0x69, 0x82, 0x2d, 0x91, 0x67, 0x82, 0x29, 0xd9, 0xa4, 0xc1, 0x81, 0x4f,
+  0xa2, 0x6d, 0x11, 0x2e, 0x8a, 0x96, 0x61, 0xa2, 0x96, 0xc5, 0x4b, 0x9e,
+  0x24, 0xbc, 0xf4, 0x19, 0x24, 0x2c, 0xf4, 0x91, 0x6c, 0xb1, 0x09, 0xf0,
+  0x18, 0x1f, 0x48, 0x32, 0x4a, 0x1f, 0x48, 0x92, 0x1a, 0x4c, 0xf2, 0x4a,
+  0x14, 0x19, 0xf2, 0x4a, 0xb4, 0x59, 0x92, 0x9a, 0x22, 0x2b, 0x84, 0x22,
+  0x2b, 0x94, 0x47, 0x82, 0x29, 0xb9, 0x26, 0x94, 0x12, 0x4f, 0xa2, 0xf1,
+  0x7c, 0xc4, 0x40, 0x08, 0x01, 0x06, 0xf6, 0x04, 0x00, 0x00, 0x28, 0x14,
+  0x00, 0x80, 0x12, 0x01, 0x10, 0x02, 0x00, 0x88, 0x00, 0x20, 0x01, 0x14,
+  0x00, 0x84, 0x80, 0xcd, 0x09, 0xf0, 0x22, 0x10, 0x02, 0x9f, 0xdb, 0x09,
+  0x41, 0x00, 0x83, 0x01, 0x00, 0x44, 0x45, 0x01, 0x28, 0x28, 0x20, 0x44,
+  0x91, 0x81, 0x90, 0x11, 0x90, 0x19, 0xd0, 0x41, 0x24, 0xc2, 0x44, 0x20,
+  0x92, 0x14, 0x26, 0x3c, 0x64, 0x4c, 0x0c, 0x44, 0x64, 0x40, 0x02, 0x24,
+  0x81, 0x60, 0x81, 0x41, 0x44, 0x44, 0x41, 0x82, 0xda, 0x05, 0xf0, 0xd4,
+  0x81, 0x43, 0x12, 0x98, 0x82, 0x82, 0x89, 0x13, 0x44, 0xfc, 0xe5, 0x8d,
+  0x24, 0x22, 0x86, 0x92, 0x38, 0x44, 0x30, 0x48, 0x10, 0x62, 0x83, 0x84,
+  0xc0, 0x82, 0x8a, 0x01, 0xa4, 0xa0, 0x81, 0x66, 0x8c, 0xa2, 0x86, 0x4e,
+  0x28, 0x20, 0x94, 0x28, 0x4a, 0x12, 0x24, 0x84, 0x01, 0x81, 0x10, 0x02,
+  0x81, 0x00, 0x00, 0x89, 0x88, 0xa2, 0x41, 0x42, 0xa3, 0xb4, 0x48, 0x98,
+  0x44, 0x84, 0x9a, 0x84, 0x94, 0x58, 0x18, 0x48, 0x2a, 0xa4, 0x49, 0xb0,
+  0x28, 0xa5, 0x42, 0x42, 0x4e, 0x21, 0x28, 0xcf, 0x92, 0x46, 0x02, 0x42,
+  0x1a, 0x92, 0x1c, 0xc0, 0x48, 0x24, 0x44, 0x8d, 0x15, 0x30, 0x24, 0x8a,
+  0xb2, 0x22, 0x29, 0x14, 0xd9, 0x12, 0x88, 0xf9, 0x41, 0x34, 0xe0, 0x8c,
+  0x43, 0x42, 0x81, 0xa2, 0x21, 0x30, 0xa4, 0x18, 0xc9, 0xa3, 0x24, 0x8d,
+  0x84, 0x24, 0x11, 0x45, 0x12, 0x18, 0x18, 0x62, 0x24, 0x81, 0x81, 0x8c,
+  0x62, 0x41, 0x42, 0x42, 0x4c, 0xcc, 0x84, 0xc1, 0x18, 0x62, 0x83, 0x81,
+  0x01, 0x8b, 0x24, 0x50, 0x28, 0x83, 0xe8, 0x24, 0xe2, 0x84, 0x33, 0x24,
+  0x4b, 0x21, 0x4f, 0xbf, 0x05, 0x43, 0x02, 0xa1, 0x00, 0x00, 0x20, 0x42,
+  0x08, 0x00, 0x00, 0x00, 0x84, 0x28, 0x11, 0x8b, 0x24, 0x49, 0x24, 0xd4,
+  0x84, 0xa4, 0x24, 0x60, 0x44, 0x40, 0x84, 0x04, 0x41, 0x00, 0x00, 0x00,
+  0x82, 0x18, 0x48, 0x45, 0x42, 0x1c, 0x88, 0x04, 0x8a, 0x14, 0x88, 0x44,
+  0x81, 0x04, 0x4b, 0x4b, 0xa0, 0x43, 0x88, 0x20, 0x44, 0xf8, 0xa8, 0x63,
+  0x10, 0xa4, 0x21, 0x40, 0x98, 0x14, 0x28, 0x80, 0x02, 0x84, 0x00, 0x7d,
+  0x04, 0xe0, 0x80, 0x44, 0x85, 0x44, 0x41, 0x08, 0x00, 0x90, 0x28, 0x10,
+  0x08, 0x12, 0x48, 0x44, 0xeb, 0x05, 0xf0, 0xff, 0xff, 0x06, 0x42, 0x44,
+  0x83, 0x02, 0x81, 0x12, 0x40, 0x08, 0x86, 0x08, 0x43, 0x0a, 0x26, 0x18,
+  0x68, 0x81, 0x80, 0xf4, 0xb7, 0xba, 0x00, 0x00, 0x28, 0x20, 0xc4, 0x48,
+  0x47, 0xa1, 0x22, 0x24, 0x00, 0x84, 0x84, 0x50, 0x48, 0x19, 0x41, 0xdc,
+  0x49, 0x98, 0x28, 0xa2, 0x30, 0x28, 0x41, 0xc1, 0x00, 0x18, 0x4b, 0x48,
+  0x81, 0x41, 0x45, 0x58, 0x84, 0xa1, 0x22, 0x42, 0x15, 0x04, 0x41, 0x84,
+  0xc3, 0x01, 0x8c, 0x81, 0x44, 0x88, 0x0c, 0xe0, 0x44, 0x81, 0x04, 0x36,
+  0x58, 0x81, 0x1a, 0xbe, 0x84, 0x85, 0xe4, 0x1a, 0x34, 0x68, 0x47, 0x82,
+  0xdf, 0x81, 0x02, 0x00, 0x80, 0x32, 0x14, 0xc0, 0x48, 0x85, 0x04, 0x24,
+  0x00, 0x84, 0x10, 0x14, 0xd8, 0x14, 0x41, 0xc4, 0x8d, 0x60, 0x1a, 0x50,
+  0x18, 0x41, 0xc4, 0x00, 0x12, 0x43, 0x08, 0x41, 0x81, 0x84, 0x29, 0x14,
+  0x04, 0x00, 0x16, 0x0c, 0xc1, 0x60, 0x81, 0x28, 0x80, 0x28, 0x01, 0x00,
+  0x60, 0x82, 0xa8, 0xaa, 0x65, 0x43, 0x46, 0x38, 0xd1, 0x22, 0x4d, 0x28,
+  0x2e, 0x2e, 0x40, 0xa4, 0x21, 0x40, 0x08, 0x62, 0x60, 0x23, 0x28, 0x81,
+  0x00, 0x40, 0x08, 0x44, 0x40, 0x08, 0x66, 0x48, 0x84, 0x24, 0x42, 0x08,
+  0x00, 0x30, 0x68, 0x84, 0x84, 0x41, 0x4c, 0x41, 0x88, 0x22, 0x14, 0x05,
+  0x10, 0x28, 0x21, 0x14, 0x34, 0x48, 0x84, 0x83, 0x04, 0xf0, 0x14, 0x48,
+  0x42, 0x89, 0x88, 0x11, 0x0d, 0xc6, 0x08, 0x8c, 0xc2, 0x48, 0x42, 0x8f,
+  0xa2, 0x0c, 0x23, 0x61, 0x24, 0x80, 0xe1, 0x86, 0x21, 0x04, 0x00, 0x89,
+  0x91, 0x14, 0x81, 0x84, 0x45, 0x18, 0x08, 0x48, 0x11, 0x45, 0x82, 0x02,
+  0x20, 0x32, 0x84, 0x60, 0x84, 0x90, 0x28, 0x40, 0x02, 0x28, 0x22, 0x10,
+  0x28, 0x42, 0x04, 0x90, 0x48, 0x48, 0x8c, 0x01, 0x16, 0x08, 0x20, 0x04,
+  0xc0, 0x48, 0x12, 0x82, 0x00, 0x42, 0x42, 0x52, 0x46, 0x24, 0xf1, 0x1d,
+  0xbb, 0x40, 0x34, 0x44, 0x84, 0x00, 0x00, 0x18, 0x80, 0x34, 0x84, 0x20,
+  0x82, 0x04, 0x82, 0x12, 0x44, 0x00, 0x28, 0x84, 0x4c, 0x21, 0x11, 0x04,
+  0x40, 0x84, 0x22, 0x04, 0x44, 0x60, 0x84, 0x83, 0x04, 0x42, 0x41, 0x00,
+  0x18, 0x80, 0x01, 0x10, 0x84, 0x22, 0x42, 0x81, 0x21, 0x14, 0x14, 0x88,
+  0x11, 0x88, 0x0a, 0x18, 0x56, 0xf8, 0x79, 0x22, 0x00, 0x00, 0x41, 0x40,
+  0x44, 0x38, 0x22, 0x24, 0x44, 0x00, 0x00, 0x44, 0x26, 0x01, 0x00, 0x20,
+  0x24, 0x04, 0x20, 0x02, 0x00, 0xc1, 0x84, 0x81, 0x80, 0x84, 0x42, 0x84,
+  0x04, 0x81, 0x60, 0x41, 0x20, 0x28, 0x86, 0x24, 0x84, 0x04, 0x80, 0x01,
+  0x80, 0x24, 0x44, 0xa8, 0x12, 0x30, 0x28, 0x84, 0xe0, 0x74, 0x42, 0x42,
+  0x14, 0x54, 0x82, 0x43, 0x61, 0x85, 0x41, 0x24, 0x00, 0xa9, 0xa5, 0x81,
+  0x40, 0x88, 0x14, 0x2c, 0xa8, 0x14, 0x45, 0x01, 0x23, 0x82, 0x84, 0x34,
+  0x34, 0x82, 0x28, 0x42, 0x50, 0x48, 0x89, 0x62, 0x24, 0x10, 0x24, 0xb4,
+  0x48, 0x62, 0x44, 0x42, 0x10, 0x04, 0x1e, 0x4c, 0x18, 0x86, 0xa8, 0x12,
+  0x12, 0x80, 0x84, 0x06, 0x10, 0xa8, 0x14, 0x49, 0x08, 0x12, 0x83, 0x22,
+  0xbe, 0x48, 0x63, 0xc5, 0x42, 0x4f, 0xb4, 0x0a, 0x8a, 0x01, 0x00, 0x22,
+  0x48, 0x81, 0x1a, 0x02, 0x44, 0x40, 0x08, 0x45, 0x08, 0x13, 0x02, 0x40,
+  0x04, 0x28, 0x84, 0x10, 0x44, 0x44, 0x08, 0x22, 0x44, 0x84, 0x81, 0x22,
+  0x28, 0x00, 0x22, 0x44, 0x81, 0x00, 0x48, 0x18, 0x48, 0x83, 0x84, 0x04,
+  0x00, 0x13, 0xa1, 0x14, 0x20, 0xc4, 0x48, 0x81, 0x1a, 0x04, 0x00, 0x94,
+  0xcf, 0x48, 0x0c, 0x00, 0x44, 0x00, 0x44, 0x20, 0x11, 0x24, 0x42, 0x28,
+  0x42, 0x48, 0x04, 0x10, 0x48, 0x04, 0x85, 0x04, 0x40, 0x28, 0x02, 0x81,
+  0x41, 0x49, 0x02, 0x00, 0x00, 0x81, 0x48, 0x00, 0x84, 0x00, 0x00, 0x20,
+  0x11, 0x64, 0x02, 0xf0, 0xf0, 0x00, 0x42, 0xe0, 0x84, 0x08, 0x12, 0xbf,
+  0x36, 0x09, 0x00, 0x60, 0xc4, 0x81, 0x22, 0x83, 0x05, 0x18, 0x84, 0x48,
+  0x42, 0x00, 0x84, 0x42, 0x44, 0x28, 0x42, 0xe0, 0x84, 0x02, 0x00, 0x4a,
+  0x02, 0x83, 0x12, 0x18, 0x94, 0x24, 0x45, 0xc8, 0x48, 0x45, 0x08, 0xa0,
+  0x24, 0x00, 0x10, 0x28, 0x22, 0x12, 0x08, 0x1a, 0x08, 0x22, 0x41, 0x4c,
+  0x28, 0x08, 0x10, 0x98, 0xb8, 0x60, 0x84, 0xa0, 0x82, 0x62, 0x4f, 0xed,
+  0x01, 0x82, 0x49, 0x12, 0x28, 0x05, 0x18, 0x10, 0x14, 0x48, 0x04, 0x40,
+  0x04, 0x80, 0x02, 0x00, 0x10, 0x14, 0x18, 0x48, 0x08, 0x4c, 0x01, 0x50,
+  0x48, 0x48, 0x81, 0x30, 0x48, 0x10, 0x88, 0x82, 0x04, 0x00, 0x84, 0x60,
+  0x84, 0x40, 0x08, 0x60, 0x42, 0x20, 0x21, 0x22, 0x41, 0x08, 0x84, 0x22,
+  0x20, 0x52, 0x18, 0xaf, 0x43, 0x0e, 0x38, 0x12, 0x48, 0x28, 0x28, 0xa0,
+  0x21, 0x68, 0x28, 0x84, 0x49, 0x02, 0x4a, 0x02, 0x42, 0x44, 0x10, 0x28,
+  0xa2, 0x42, 0x20, 0x02, 0x00, 0x22, 0x81, 0x20, 0x42, 0x28, 0x06, 0x20,
+  0x04, 0x80, 0x82, 0x22, 0x02, 0x10, 0x28, 0x92, 0x28, 0x42, 0x43, 0x09,
+  0x12, 0x60, 0x42, 0x48, 0x81, 0x4a, 0x42, 0xa8, 0x12, 0x89, 0x21, 0x82,
+  0x05, 0x3f, 0x37, 0x0d, 0x20, 0x22, 0x42, 0x28, 0x61, 0x82, 0x81, 0x16,
+  0x28, 0x04, 0x84, 0x84, 0x81, 0x10, 0x48, 0x0c, 0x28, 0x84, 0x10, 0x48,
+  0x08, 0x00, 0x80, 0x02, 0x80, 0x02, 0x48, 0x20, 0x04, 0x00, 0x84, 0x00,
+  0x40, 0x08, 0x84, 0x20, 0x01, 0x92, 0x12, 0x18, 0x20, 0x22, 0x01, 0x20,
+  0x05, 0x84, 0x42, 0xbf, 0x1a, 0x0a, 0x41, 0x84, 0x49, 0x04, 0x44, 0x20,
+  0x14, 0x04, 0x22, 0x42, 0x22, 0x40, 0x38, 0x44, 0x2a, 0x04, 0x30, 0x44,
+  0x44, 0x00, 0x40, 0x88, 0x41, 0x14, 0x84, 0x02, 0x73, 0x00, 0xf0, 0x14,
+  0x40, 0x08, 0x46, 0x08, 0x00, 0x00, 0x12, 0x88, 0x00, 0x28, 0x88, 0xb0,
+  0x14, 0x08, 0x88, 0x28, 0x82, 0x82, 0x88, 0xf0, 0xda, 0xc1, 0x00, 0x44,
+  0x1e, 0x48, 0x44, 0x00, 0x44, 0x50, 0x48, 0x00, 0x42, 0x00, 0x00, 0x9d,
+  0x0b, 0xf1, 0xff, 0x8f, 0x04, 0x89, 0x01, 0xc0, 0x4c, 0x48, 0x00, 0x40,
+  0x24, 0x22, 0x24, 0x84, 0x82, 0x24, 0xc2, 0x28, 0x28, 0x22, 0x00, 0x8a,
+  0x82, 0xc2, 0x34, 0xa0, 0x28, 0x00, 0x20, 0x88, 0x52, 0x81, 0xa0, 0x12,
+  0x12, 0x81, 0x1f, 0xb7, 0x04, 0x58, 0x83, 0x2c, 0x02, 0x41, 0xc1, 0x60,
+  0x82, 0x22, 0x44, 0x22, 0x10, 0x44, 0x28, 0x42, 0x08, 0x10, 0x34, 0x28,
+  0x41, 0x28, 0x22, 0x10, 0xc8, 0x28, 0x00, 0x68, 0x84, 0x20, 0x22, 0x32,
+  0x28, 0x00, 0x81, 0x00, 0x00, 0x00, 0x32, 0x00, 0x42, 0x22, 0x00, 0x40,
+  0x08, 0x00, 0x28, 0x4e, 0x18, 0x94, 0x70, 0xf5, 0x05, 0xa6, 0x2c, 0xa1,
+  0x41, 0x22, 0x76, 0x28, 0x81, 0x82, 0x04, 0x00, 0x44, 0x90, 0x24, 0x41,
+  0x60, 0x84, 0x45, 0xc8, 0x28, 0x48, 0x00, 0x21, 0x12, 0x18, 0x80, 0x08,
+  0x81, 0xa0, 0x24, 0x84, 0x46, 0x01, 0x22, 0x84, 0x80, 0x16, 0x88, 0x32,
+  0x48, 0xa0, 0x21, 0x00, 0x28, 0x4c, 0x01, 0x68, 0x00, 0x26, 0x24, 0xca,
+  0x11, 0x12, 0x00, 0x23, 0x84, 0xe2, 0x97, 0x06, 0x4b, 0x13, 0x87, 0xc9,
+  0x87, 0x83, 0x4f, 0x46, 0xf1, 0x28, 0x1c, 0x1a, 0xc1, 0x44, 0x2e, 0x28,
+  0xc7, 0x44, 0x28, 0x84, 0x68, 0x4c, 0x04, 0xc4, 0x4f, 0x82, 0x16, 0x44,
+  0x94, 0x64, 0xc4, 0x8f, 0x84, 0x72, 0x28, 0x08, 0x10, 0xe8, 0x41, 0x12,
+  0x74, 0x28, 0xc4, 0x48, 0x43, 0x84, 0x82, 0x82, 0xa6, 0x62, 0x8c, 0x84,
+  0x42, 0x48, 0x58, 0x88, 0x28, 0x00, 0x28, 0x87, 0x82, 0x82, 0x9a, 0x02,
+  0x47, 0x41, 0x8a, 0xac, 0x1b, 0x4a, 0xd2, 0x84, 0x22, 0x2e, 0x98, 0x18,
+  0x2a, 0x9e, 0x48, 0xe6, 0x91, 0x18, 0x3f, 0xb1, 0x07, 0x48, 0xa2, 0x49,
+  0x81, 0x36, 0x54, 0x26, 0xe8, 0x84, 0xe1, 0x44, 0x84, 0x52, 0x84, 0x4a,
+  0x16, 0x58, 0x84, 0x41, 0x8b, 0x44, 0x42, 0x81, 0x89, 0x62, 0xc4, 0x2a,
+  0x42, 0x04, 0x8d, 0x68, 0x8b, 0x21, 0x4a, 0x72, 0x28, 0x98, 0x28, 0x45,
+  0x78, 0x68, 0xc4, 0x28, 0x8b, 0x44, 0x2e, 0x48, 0x85, 0x14, 0x28, 0xa4,
+  0x42, 0x89, 0x36, 0x28, 0x4a, 0x32, 0x28, 0x2a, 0x02, 0x36, 0xa8, 0x11,
+  0x18, 0x2e, 0x84, 0x3a, 0x82, 0x0a, 0x88, 0xb0, 0x28, 0xc1, 0xa8, 0x9d,
+  0x88, 0x9c, 0x62, 0x85, 0x2e, 0x18, 0x8d, 0xb1, 0x62, 0x9f, 0x48, 0x04,
+  0x4c, 0xb2, 0x44, 0xc3, 0x24, 0x85, 0x88, 0xd2, 0x4c, 0xb2, 0x38, 0xb2,
+  0x1c, 0x61, 0x83, 0x87, 0x42, 0x87, 0x42, 0x62, 0x89, 0x52, 0xc8, 0x49,
+  0x52, 0x48, 0x46, 0x7c, 0x24, 0x38, 0x28, 0xcb, 0x44, 0x41, 0x28, 0x40,
+  0x48, 0x18, 0x64, 0xc2, 0x68, 0x49, 0xb2, 0x28, 0x74, 0x24, 0x38, 0x48,
+  0x47, 0x84, 0x46, 0x88, 0x22, 0x24, 0x82, 0x22, 0x42, 0xd8, 0x88, 0xf4,
+  0x28, 0x28, 0x83, 0x84, 0xf2, 0x58, 0xa8, 0x18, 0x58, 0x2a, 0xc1, 0x14,
+  0x41, 0xe0, 0x41, 0x98, 0x18, 0x3a, 0xa3, 0x43, 0x89, 0xa1, 0xad, 0x1e,
+  0x48, 0x8c, 0xb6, 0x66, 0x02, 0x20, 0x02, 0x40, 0x08, 0xf6, 0x01, 0xf1,
+  0xff, 0xf4, 0x00, 0x40, 0x08, 0x80, 0x82, 0x04, 0x48, 0x28, 0x48, 0x85,
+  0x84, 0x44, 0x04, 0x85, 0x04, 0x85, 0x24, 0x12, 0x28, 0x02, 0x00, 0x40,
+  0x28, 0x44, 0x28, 0x64, 0x81, 0x62, 0x20, 0x04, 0x42, 0x43, 0x21, 0x64,
+  0x81, 0x42, 0x13, 0x11, 0x08, 0x83, 0x04, 0x81, 0x7f, 0xeb, 0x08, 0x4f,
+  0x46, 0xf6, 0x34, 0x34, 0xcf, 0x81, 0xf3, 0x38, 0x3c, 0x4f, 0x85, 0xfd,
+  0x38, 0x18, 0x8d, 0x38, 0xcf, 0xc2, 0xf3, 0x68, 0x5c, 0x85, 0x74, 0x28,
+  0xa8, 0x24, 0x00, 0x85, 0x7c, 0x48, 0xa8, 0x66, 0x49, 0xb2, 0x68, 0x22,
+  0xb6, 0x28, 0xa4, 0x44, 0x8b, 0x44, 0x6a, 0xa4, 0x42, 0x6a, 0xa6, 0x44,
+  0x2e, 0x24, 0x4f, 0x42, 0xe4, 0xc4, 0xf4, 0x24, 0x4c, 0x4f, 0xc4, 0xc4,
+  0x68, 0x66, 0xa8, 0x42, 0x6a, 0x84, 0xd2, 0x4c, 0x52, 0xc4, 0x89, 0x86,
+  0xb4, 0x68, 0xb6, 0x28, 0xb2, 0x78, 0xa5, 0xd5, 0x4a, 0xa4, 0x35, 0x9a,
+  0xdd, 0x44, 0xfc, 0x54, 0x54, 0x49, 0xf2, 0xc8, 0xe4, 0x8b, 0x66, 0x8f,
+  0x85, 0xf3, 0x39, 0x78, 0xca, 0xa8, 0x22, 0x22, 0x8c, 0xf4, 0xd6, 0xdd,
+  0xf0, 0x64, 0x64, 0x4f, 0x43, 0xb7, 0x38, 0xf3, 0x38, 0x38, 0x8b, 0xd7,
+  0xcf, 0x82, 0xa3, 0x77, 0x4f, 0x46, 0xf6, 0x48, 0x4c, 0x8d, 0x2c, 0x4e,
+  0x24, 0x87, 0x86, 0x2a, 0x02, 0xc7, 0x84, 0x87, 0x84, 0x6a, 0x96, 0x24,
+  0x4a, 0x32, 0x6c, 0x4f, 0xa2, 0xb4, 0x42, 0x04, 0xab, 0x13, 0x2e, 0x48,
+  0x8f, 0x8e, 0xac, 0x46, 0x4b, 0xa2, 0x4f, 0xc6, 0xe2, 0xc4, 0xf4, 0x44,
+  0x44, 0x5d, 0x6d, 0x4a, 0xe6, 0x94, 0xe4, 0x84, 0xa4, 0x66, 0x6a, 0xf6,
+  0x24, 0x24, 0x45, 0xd4, 0x88, 0x84, 0xb4, 0x68, 0xa6, 0x46, 0x8b, 0x13,
+  0x8b, 0x91, 0x4f, 0x44, 0x2e, 0xa5, 0xda, 0x1a, 0xad, 0xe6, 0x4f, 0x46,
+  0xb4, 0xac, 0xa8, 0x9b, 0x8f, 0x9e, 0xf8, 0x38, 0x78, 0x8e, 0x8a, 0xaf,
+  0x8a, 0xe8, 0x1a, 0xde, 0x8a, 0xf5, 0x87, 0xcd, 0xa0, 0x66, 0x3a, 0x86,
+  0xd2, 0x88, 0xe3, 0xc4, 0xd5, 0x88, 0xf1, 0x5c, 0x3c, 0x8f, 0x86, 0xf7,
+  0x48, 0x58, 0xcd, 0x28, 0x4c, 0xa6, 0x46, 0x28, 0x44, 0x48, 0x8f, 0x86,
+  0xa6, 0x66, 0x44, 0x2e, 0x2c, 0x4f, 0x44, 0xe4, 0x46, 0xb2, 0x2a, 0xc6,
+  0x28, 0x2a, 0xf3, 0x68, 0x28, 0x2a, 0x2c, 0xe2, 0x46, 0xf6, 0x6c, 0x64,
+  0x4f, 0x82, 0xe4, 0xc6, 0xe2, 0x94, 0xf4, 0x64, 0x6c, 0x4e, 0x68, 0x6e,
+  0x68, 0x6a, 0x86, 0xd6, 0x44, 0xd2, 0x44, 0xb2, 0x28, 0x72, 0x68, 0x98,
+  0x28, 0x8b, 0x67, 0x8f, 0x82, 0xe3, 0x89, 0x6b, 0x4e, 0x1a, 0xa7, 0xb9,
+  0xca, 0xa8, 0x19, 0x4b, 0x46, 0x8f, 0x4b, 0xb9, 0xa8, 0xfa, 0x78, 0x98,
+  0x8f, 0x83, 0xf7, 0xa8, 0x88, 0x2b, 0xaa, 0x89, 0xe8, 0x86, 0xd5, 0x86,
+  0x06, 0x6a, 0xe6, 0x43, 0xf1, 0x14, 0x38, 0x8f, 0xc1, 0xe3, 0x85, 0xf5,
+  0x28, 0x3c, 0x8b, 0x35, 0x4f, 0x47, 0xf7, 0x58, 0x7c, 0xcf, 0xc2, 0xf2,
+  0x68, 0x48, 0x8f, 0x84, 0x96, 0x28, 0x41, 0x4e, 0x48, 0xcb, 0x66, 0x8b,
+  0x66, 0x47, 0x42, 0x4f, 0x44, 0xf4, 0x44, 0x4c, 0x6e, 0x24, 0x2f, 0x82,
+  0xe6, 0x24, 0xe6, 0x82, 0xe3, 0x86, 0xf2, 0x2c, 0xc8, 0x22, 0xee, 0x6c,
+  0xcf, 0xc6, 0x76, 0x64, 0xf8, 0x68, 0x44, 0x8f, 0x96, 0xf2, 0x2c, 0x64,
+  0x9f, 0x84, 0xa2, 0x66, 0x6a, 0xa6, 0x62, 0xcd, 0x24, 0x4d, 0x2c, 0x8f,
+  0x82, 0xa2, 0x26, 0x8f, 0x86, 0xe6, 0x81, 0xb2, 0x28, 0xb3, 0xf8, 0xef,
+  0x4e, 0xab, 0x61, 0x9a, 0xaa, 0x8c, 0x4f, 0x4d, 0x7d, 0x24, 0xf4, 0xbc,
+  0x98, 0xee, 0xc8, 0x8f, 0x87, 0xf9, 0x38, 0x71, 0xae, 0xb8, 0xaf, 0x8a,
+  0xfa, 0x68, 0xd3, 0x8f, 0x86, 0xf6, 0x7d, 0xb2, 0x00, 0x90, 0x14, 0x84,
+  0x6f, 0x0b, 0x91, 0x00, 0x84, 0x00, 0x44, 0x84, 0x28, 0x84, 0x81, 0x50,
+  0x40, 0x0d, 0xf0, 0x35, 0x42, 0x30, 0x48, 0x30, 0x48, 0x00, 0x22, 0x30,
+  0x24, 0x84, 0x22, 0x48, 0x22, 0x1e, 0x48, 0xa0, 0x41, 0x22, 0x1a, 0x04,
+  0x12, 0x00, 0x28, 0x1a, 0x84, 0xa2, 0x41, 0x4a, 0x02, 0x28, 0x70, 0xa4,
+  0x0c, 0x41, 0x28, 0x80, 0x22, 0x42, 0x18, 0xa8, 0x21, 0x81, 0x00, 0x10,
+  0x08, 0x10, 0x04, 0x43, 0x02, 0x22, 0xa0, 0x42, 0x42, 0x22, 0x83, 0x04,
+  0x4c, 0xc2, 0x48, 0x85, 0x04, 0x28, 0x00, 0x20, 0x04, 0x00, 0x00, 0x84,
+  0xb6, 0x03, 0xf0, 0x44, 0x48, 0x80, 0x94, 0x18, 0x10, 0x08, 0x81, 0x12,
+  0x81, 0x48, 0x3f, 0xba, 0x06, 0x2e, 0x52, 0x1f, 0x41, 0x52, 0x28, 0x1f,
+  0x41, 0x32, 0x48, 0x1f, 0xc1, 0x32, 0x4a, 0x1d, 0x2c, 0xab, 0x14, 0x1d,
+  0x24, 0xab, 0x94, 0x1d, 0x28, 0xab, 0x94, 0x5d, 0x48, 0xab, 0x94, 0x43,
+  0xf2, 0x4a, 0x91, 0x47, 0x82, 0x2f, 0x14, 0x79, 0x24, 0xd8, 0x12, 0xfb,
+  0x24, 0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x8d, 0xa1, 0x4f, 0xa2, 0x64, 0x51,
+  0x4f, 0xa2, 0x74, 0x98, 0xf5, 0x24, 0x4a, 0x87, 0x59, 0x4f, 0xa2, 0xf4,
+  0x98, 0x24, 0x2e, 0x85, 0x09, 0xf2, 0x04, 0x42, 0x1f, 0x49, 0x52, 0x28,
+  0x1f, 0x49, 0x32, 0x48, 0x1f, 0xc9, 0x32, 0x4a, 0x1f, 0xc9, 0xb2, 0x6a,
+  0xd1, 0xc1, 0xca, 0x09, 0xf0, 0x0e, 0x53, 0xf1, 0x4a, 0x94, 0x43, 0xf3,
+  0x4a, 0x94, 0x47, 0x83, 0xab, 0x94, 0x47, 0x82, 0xab, 0x94, 0x4f, 0x82,
+  0x94, 0x98, 0x4f, 0xa2, 0xb4, 0x6f, 0x0d, 0x2c, 0xf4, 0x11, 0x4c, 0x85,
+  0x09, 0xf0, 0x11, 0x42, 0x1f, 0x41, 0x12, 0xd2, 0x41, 0x32, 0x4a, 0x15,
+  0xd4, 0x42, 0x19, 0xf1, 0x42, 0xb4, 0x51, 0xa9, 0x3b, 0x24, 0x2f, 0x14,
+  0x39, 0x24, 0x2d, 0x91, 0x45, 0xd8, 0x12, 0x79, 0x26, 0xd8, 0x12, 0x86,
+  0x09, 0xf1, 0x2d, 0x2e, 0x92, 0x1e, 0x81, 0xa4, 0x96, 0xe1, 0x22, 0x64,
+  0x19, 0xbc, 0x64, 0x19, 0xac, 0x74, 0x91, 0xcc, 0x42, 0x1f, 0xc9, 0x56,
+  0x28, 0x1f, 0x49, 0x06, 0x1f, 0x49, 0x12, 0xfa, 0x81, 0x24, 0x29, 0x51,
+  0x41, 0xad, 0x14, 0x19, 0xd2, 0x4a, 0x1b, 0x91, 0x2a, 0x22, 0xa9, 0x38,
+  0x24, 0x21, 0x47, 0x82, 0x29, 0x79, 0x26, 0x98, 0x12, 0x4d, 0x5a, 0x2d,
+  0x92, 0x20, 0x28, 0x1e, 0x06, 0x01, 0x01, 0x00, 0x60, 0x10, 0x02, 0x18,
+  0x80, 0x08, 0x00, 0x79, 0x0e, 0x10, 0x58, 0x0f, 0x00, 0x30, 0x4c, 0x04,
+  0x28, 0x07, 0x00, 0xf0, 0xd5, 0x25, 0x01, 0xef, 0x39, 0x09, 0x42, 0x00,
+  0x89, 0xc2, 0x18, 0x40, 0xc8, 0x24, 0x28, 0x20, 0x32, 0x88, 0x42, 0xe1,
+  0x84, 0x41, 0x84, 0x45, 0x41, 0x92, 0x44, 0x42, 0x54, 0x42, 0x41, 0x42,
+  0x45, 0x21, 0x14, 0x44, 0x14, 0x08, 0x00, 0x8c, 0x64, 0x24, 0x44, 0x22,
+  0x8c, 0x02, 0x48, 0x42, 0x20, 0xc1, 0x48, 0x48, 0x00, 0x89, 0x0d, 0x48,
+  0x30, 0x8c, 0x58, 0x8b, 0x42, 0x12, 0x22, 0x00, 0xf0, 0x4f, 0x69, 0x20,
+  0x21, 0x08, 0x41, 0x70, 0x12, 0x04, 0x29, 0x08, 0x8a, 0x42, 0x08, 0x84,
+  0x20, 0x14, 0x08, 0x83, 0x22, 0x06, 0xc0, 0x28, 0x43, 0xc2, 0x28, 0x44,
+  0x2a, 0x24, 0x02, 0x12, 0x44, 0x28, 0x4d, 0x48, 0x20, 0x02, 0x40, 0x62,
+  0x48, 0x28, 0x81, 0xe0, 0x41, 0x14, 0x82, 0x89, 0x88, 0x81, 0x08, 0x10,
+  0x98, 0x84, 0x18, 0x13, 0x02, 0x84, 0x48, 0x28, 0x4d, 0x51, 0x22, 0xbf,
+  0x4d, 0x03, 0x4a, 0x21, 0x0c, 0x26, 0x84, 0x11, 0x44, 0x02, 0x20, 0x9a,
+  0x2c, 0x83, 0xa8, 0x42, 0x41, 0x48, 0x84, 0x84, 0xd4, 0x46, 0x62, 0x44,
+  0x2c, 0x74, 0x2c, 0xb1, 0x24, 0x34, 0x18, 0x49, 0xe4, 0x5c, 0x82, 0x14,
+  0x04, 0xc4, 0x22, 0x17, 0xc4, 0xa0, 0x24, 0x89, 0x14, 0x26, 0x34, 0xaa,
+  0x28, 0x42, 0xa0, 0x14, 0x18, 0x1e, 0x88, 0x88, 0x41, 0x88, 0x2e, 0x8c,
+  0x90, 0x48, 0x88, 0x87, 0x49, 0x18, 0x89, 0x44, 0xc8, 0x62, 0xc0, 0x55,
+  0x32, 0x1f, 0xe1, 0x04, 0x00, 0x40, 0x58, 0x28, 0x12, 0x81, 0x4c, 0x2a,
+  0x02, 0x00, 0x85, 0x42, 0x18, 0x18, 0x04, 0x22, 0x28, 0x00, 0x00, 0x43,
+  0x02, 0x80, 0x02, 0x16, 0x04, 0x52, 0x04, 0xf1, 0x2b, 0x12, 0x04, 0x81,
+  0x48, 0x45, 0x02, 0x42, 0x48, 0x18, 0xa0, 0x14, 0x00, 0x41, 0xb0, 0x21,
+  0x84, 0x22, 0x01, 0x22, 0x00, 0x9f, 0x11, 0x06, 0x00, 0x20, 0x01, 0x48,
+  0x00, 0x10, 0x41, 0x01, 0x80, 0x04, 0x48, 0x00, 0x42, 0x11, 0x00, 0x40,
+  0x08, 0x22, 0x00, 0x20, 0x02, 0x00, 0x00, 0x48, 0x19, 0x02, 0x00, 0x44,
+  0x00, 0x90, 0x21, 0x30, 0x11, 0x4a, 0x01, 0xc0, 0x0a, 0xf0, 0xff, 0xa2,
+  0xf0, 0x2d, 0x28, 0x20, 0x31, 0x24, 0x00, 0x84, 0x80, 0x02, 0x12, 0xb0,
+  0x12, 0x08, 0x18, 0x80, 0x18, 0xa2, 0x21, 0x4a, 0x02, 0x8c, 0x02, 0xc4,
+  0x90, 0x21, 0x80, 0x14, 0xc4, 0x24, 0x12, 0x00, 0x89, 0x44, 0x02, 0x18,
+  0x18, 0x44, 0x2d, 0x12, 0x60, 0x84, 0xc0, 0x44, 0x14, 0x84, 0x20, 0x24,
+  0x02, 0x42, 0x00, 0x84, 0x22, 0x4a, 0x41, 0x04, 0x89, 0x04, 0xf0, 0xff,
+  0x3c, 0x00, 0x28, 0x80, 0x41, 0x08, 0x00, 0x18, 0x24, 0x86, 0x01, 0x18,
+  0x48, 0x00, 0x28, 0x68, 0x48, 0x26, 0x08, 0x84, 0x60, 0x82, 0x80, 0x44,
+  0x34, 0x24, 0x18, 0x22, 0xc0, 0x48, 0x00, 0x80, 0x75, 0x24, 0x81, 0x11,
+  0x92, 0x48, 0x20, 0x04, 0x81, 0x26, 0x01, 0xa0, 0x14, 0x00, 0x10, 0x88,
+  0x02, 0x44, 0xc0, 0x48, 0x28, 0xf0, 0xa3, 0x5b, 0x80, 0x31, 0x44, 0x00,
+  0x20, 0x84, 0x02, 0x10, 0x31, 0x14, 0x20, 0x02, 0x82, 0x29, 0x24, 0x01,
+  0x10, 0x41, 0x12, 0x04, 0x16, 0x01, 0xa2, 0x00, 0x00, 0x10, 0x01, 0x21,
+  0x12, 0x60, 0x24, 0x00, 0x10, 0x44, 0x14, 0x01, 0x90, 0x44, 0x36, 0x21,
+  0x82, 0x04, 0x00, 0xa0, 0x41, 0x40, 0x02, 0x20, 0xf1, 0x5d, 0xe2, 0x00,
+  0x10, 0x01, 0x12, 0x19, 0x31, 0x68, 0x14, 0x10, 0x09, 0x46, 0x01, 0x00,
+  0x82, 0x10, 0x14, 0x42, 0x08, 0x10, 0x61, 0x18, 0x88, 0x41, 0x24, 0x41,
+  0x40, 0x02, 0x48, 0x00, 0x46, 0x64, 0x48, 0x80, 0x12, 0x81, 0x44, 0x01,
+  0x20, 0x01, 0x82, 0x00, 0x00, 0x26, 0x12, 0x1c, 0x04, 0x44, 0x84, 0x80,
+  0x41, 0xf4, 0x8c, 0xc4, 0xa0, 0x21, 0x22, 0x20, 0x03, 0x00, 0x48, 0x80,
+  0x04, 0xc0, 0x18, 0x11, 0x10, 0x29, 0x9c, 0x48, 0x34, 0x38, 0x81, 0x20,
+  0xc4, 0x48, 0x42, 0x4a, 0xa2, 0x42, 0x12, 0x00, 0x00, 0x12, 0xc8, 0x24,
+  0x24, 0x00, 0x18, 0x22, 0x41, 0x29, 0x02, 0x46, 0x14, 0x84, 0xa5, 0x14,
+  0x80, 0x31, 0x82, 0x2b, 0x1c, 0x20, 0x67, 0x84, 0x81, 0x48, 0x00, 0x89,
+  0xf4, 0x28, 0x31, 0x10, 0x02, 0x41, 0x20, 0x42, 0x08, 0x83, 0x32, 0x21,
+  0x90, 0x11, 0x00, 0x12, 0x18, 0x10, 0x02, 0x81, 0x24, 0x62, 0x10, 0x08,
+  0x00, 0x85, 0x14, 0x88, 0x04, 0x46, 0x02, 0x00, 0x80, 0x01, 0x20, 0x02,
+  0x42, 0x00, 0x29, 0x88, 0x04, 0x24, 0x8a, 0x84, 0x14, 0x04, 0x48, 0x80,
+  0x81, 0x04, 0x4c, 0x01, 0x28, 0x5f, 0x73, 0x4c, 0xa2, 0x21, 0x22, 0x15,
+  0x84, 0xa1, 0x12, 0x91, 0x28, 0x93, 0x36, 0x21, 0x81, 0x14, 0x42, 0x83,
+  0x41, 0x01, 0x11, 0x23, 0x34, 0x4c, 0x91, 0x16, 0x22, 0x06, 0x84, 0x99,
+  0x8c, 0x94, 0x44, 0x8f, 0x22, 0x94, 0x1c, 0x42, 0x24, 0x10, 0x02, 0x42,
+  0x43, 0x34, 0x86, 0x21, 0xc0, 0x11, 0x22, 0x5d, 0x42, 0x00, 0x2b, 0x84,
+  0x48, 0xd8, 0x30, 0xc2, 0x48, 0x69, 0xf8, 0x82, 0x22, 0x4d, 0x48, 0x46,
+  0xe4, 0x84, 0x81, 0x94, 0x48, 0x16, 0x24, 0xa1, 0x24, 0xff, 0x5e, 0x0e,
+  0x00, 0x80, 0x02, 0x12, 0x83, 0x04, 0x90, 0x41, 0x18, 0x11, 0x20, 0x81,
+  0x61, 0x88, 0x88, 0x50, 0x22, 0x26, 0x18, 0x08, 0x46, 0x01, 0x88, 0x22,
+  0x3a, 0x01, 0xf0, 0x13, 0x24, 0x81, 0x08, 0x18, 0x20, 0x82, 0x22, 0x04,
+  0x22, 0x90, 0x14, 0x44, 0xa0, 0x41, 0x20, 0x01, 0x1a, 0x04, 0x32, 0x50,
+  0x84, 0x00, 0x50, 0x84, 0x4f, 0xff, 0x08, 0xc0, 0x24, 0x40, 0x44, 0x01,
+  0x81, 0x30, 0x9d, 0x0c, 0xf1, 0x0c, 0x84, 0x81, 0x84, 0x00, 0x80, 0x04,
+  0x80, 0x12, 0x21, 0x15, 0x04, 0x21, 0x16, 0x84, 0x01, 0x00, 0x00, 0x88,
+  0x50, 0x22, 0x40, 0x01, 0x88, 0x00, 0x00, 0x41, 0x88, 0xfe, 0x0f, 0xf1,
+  0xe6, 0xf4, 0xcb, 0xca, 0x00, 0x11, 0x18, 0x00, 0x81, 0x49, 0x12, 0x68,
+  0x22, 0x48, 0x18, 0x86, 0x21, 0x75, 0x42, 0x51, 0xa2, 0x2c, 0x98, 0x84,
+  0x88, 0x44, 0x49, 0x88, 0x32, 0x85, 0x13, 0x92, 0x45, 0x40, 0x04, 0x22,
+  0x40, 0x21, 0x24, 0x2a, 0x92, 0x14, 0x22, 0xd0, 0x26, 0x68, 0x41, 0x8e,
+  0x35, 0x15, 0x84, 0xa4, 0x81, 0x61, 0x00, 0x60, 0x14, 0x88, 0x42, 0x24,
+  0x12, 0x90, 0x82, 0x46, 0x24, 0xca, 0x28, 0x88, 0x28, 0x22, 0xaf, 0xe9,
+  0x0b, 0xb0, 0x44, 0x02, 0x44, 0x14, 0x30, 0x28, 0x84, 0x83, 0x24, 0x14,
+  0x04, 0x22, 0x11, 0x00, 0xa1, 0x00, 0x43, 0xc8, 0x22, 0x1c, 0xc4, 0x21,
+  0x4f, 0x11, 0x24, 0x32, 0x84, 0x90, 0x24, 0x10, 0x43, 0xb4, 0x21, 0x08,
+  0x12, 0x00, 0x42, 0x82, 0x43, 0x18, 0x04, 0x1d, 0x12, 0x44, 0x00, 0x41,
+  0x13, 0xa4, 0x82, 0x00, 0x18, 0x24, 0x82, 0x42, 0x28, 0x2c, 0x22, 0x08,
+  0x1a, 0xe2, 0xb2, 0x0a, 0x85, 0xf8, 0x48, 0x41, 0x4a, 0x25, 0x04, 0x84,
+  0x44, 0xc0, 0x22, 0xd0, 0x44, 0xd1, 0x54, 0xb8, 0x34, 0xb6, 0x22, 0x36,
+  0x2a, 0x27, 0x88, 0x4c, 0x68, 0x88, 0x41, 0x40, 0xd2, 0x62, 0x58, 0x22,
+  0x1a, 0xa1, 0x11, 0x1b, 0x89, 0xca, 0x29, 0x08, 0xa0, 0x14, 0x1d, 0x11,
+  0x17, 0x12, 0x51, 0x83, 0x42, 0xe2, 0x4c, 0xb4, 0x56, 0xf4, 0x41, 0x32,
+  0x14, 0x23, 0x24, 0x08, 0x82, 0x50, 0x44, 0x45, 0xb4, 0x24, 0xe2, 0x42,
+  0x26, 0x1a, 0x42, 0x04, 0x41, 0x88, 0xa4, 0x25, 0x72, 0x22, 0xa2, 0x15,
+  0x4f, 0xf8, 0x05, 0x22, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x21, 0x00,
+  0x10, 0x02, 0x12, 0x41, 0x42, 0x10, 0x01, 0x42, 0x40, 0x01, 0x00, 0x20,
+  0x86, 0x48, 0x04, 0x00, 0x00, 0x10, 0x9f, 0x0d, 0x10, 0x20, 0x3c, 0x04,
+  0x80, 0x6f, 0x55, 0x05, 0x81, 0x45, 0x28, 0x84, 0x04, 0x57, 0x05, 0xf0,
+  0x0a, 0x44, 0x24, 0x8a, 0x02, 0x00, 0x00, 0x88, 0x24, 0x10, 0x22, 0x81,
+  0x21, 0x88, 0x18, 0x02, 0x20, 0x91, 0x11, 0x1c, 0x48, 0x38, 0x28, 0xc4,
+  0x42, 0x48, 0x34, 0x03, 0xf0, 0x07, 0x43, 0x41, 0x24, 0x8a, 0x03, 0x00,
+  0x45, 0x08, 0x40, 0x42, 0x18, 0xf2, 0xc4, 0x86, 0x40, 0x08, 0x48, 0x26,
+  0x02, 0x41, 0x20, 0x41, 0xe8, 0x0a, 0xf0, 0x02, 0x38, 0x80, 0x18, 0x08,
+  0x14, 0x24, 0x10, 0x02, 0x18, 0x8a, 0x81, 0xa8, 0x84, 0x41, 0x41, 0x23,
+  0x02, 0x01, 0x0e, 0xf0, 0x07, 0xc4, 0x62, 0x00, 0x12, 0x20, 0x18, 0x02,
+  0x44, 0x44, 0x28, 0x19, 0x42, 0x02, 0x80, 0x21, 0xa4, 0x68, 0x10, 0x02,
+  0x8f, 0x35, 0x05, 0x18, 0x0e, 0xc0, 0x28, 0x00, 0x44, 0x12, 0x28, 0x00,
+  0x14, 0x00, 0x80, 0x04, 0x21, 0x80, 0x88, 0x01, 0x21, 0x40, 0x01, 0x46,
+  0x0e, 0x51, 0x80, 0x01, 0x88, 0x44, 0x24, 0xb3, 0x04, 0x50, 0x21, 0x80,
+  0xf1, 0xd9, 0x1c, 0x08, 0x00, 0x71, 0x00, 0x46, 0x88, 0x08, 0x10, 0x08,
+  0x1c, 0x34, 0x00, 0x00, 0x03, 0x00, 0xa1, 0x20, 0x04, 0x00, 0x80, 0x09,
+  0x00, 0x25, 0x05, 0x00, 0x19, 0xc0, 0x00, 0xf0, 0x4b, 0x41, 0x82, 0x00,
+  0xf0, 0x6b, 0x88, 0x10, 0x78, 0x48, 0xe8, 0x44, 0xb4, 0x41, 0x84, 0x42,
+  0x04, 0x26, 0x01, 0x30, 0x44, 0x41, 0x47, 0x42, 0x6a, 0xa2, 0x22, 0x12,
+  0x80, 0x08, 0x40, 0x46, 0x62, 0x22, 0x23, 0x21, 0xa1, 0x19, 0x8a, 0xa8,
+  0x88, 0x48, 0x00, 0x31, 0x17, 0x18, 0x15, 0x93, 0x88, 0x81, 0x83, 0xe4,
+  0x4c, 0xa4, 0x44, 0x28, 0x00, 0x11, 0x11, 0x10, 0x54, 0x44, 0x47, 0x42,
+  0x2a, 0xa2, 0x22, 0x10, 0x22, 0x08, 0x40, 0x46, 0x52, 0x22, 0x63, 0xf1,
+  0x42, 0x37, 0x00, 0x81, 0x20, 0x04, 0x10, 0x01, 0x50, 0x18, 0x80, 0x74,
+  0x44, 0x02, 0x22, 0x12, 0x04, 0x31, 0x64, 0x1d, 0x24, 0x49, 0x03, 0xf0,
+  0x26, 0x90, 0x11, 0x12, 0x8c, 0x41, 0x08, 0x4e, 0x81, 0x00, 0x11, 0x22,
   0x00, 0x00, 0x43, 0x84, 0x24, 0x22, 0x01, 0x44, 0x20, 0x02, 0x28, 0x24,
   0x22, 0xbe, 0x7d, 0x80, 0x81, 0x01, 0x40, 0x14, 0x01, 0x40, 0x01, 0x81,
   0x84, 0x00, 0x10, 0x02, 0x20, 0x81, 0x02, 0x41, 0x00, 0x22, 0x14, 0x00,
-  0x00, 0x21, 0x60, 0x21, 0x00, 0x82, 0x00, 0x00, 0x00, 0x80, 0x04, 0x42,
+  0x00, 0x21, 0x60, 0x21, 0x00, 0x82, 0xfd, 0x0e, 0xf5, 0x00, 0x04, 0x42,
   0x48, 0x24, 0x80, 0x14, 0x02, 0x18, 0x18, 0x00, 0x41, 0x44, 0xf0, 0xd1,
-  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
-  0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x28, 0xf0, 0xf1, 0x5a,
+  0x34, 0xa8, 0x05, 0x00, 0xa7, 0x0a, 0x00, 0xa6, 0x05, 0x10, 0x10, 0x1e,
+  0x0f, 0x03, 0x01, 0x00, 0xf0, 0x1d, 0x82, 0x00, 0x28, 0xf0, 0xf1, 0x5a,
   0x00, 0x41, 0x44, 0xc0, 0x24, 0x41, 0x11, 0x1a, 0x42, 0x12, 0x21, 0x34,
   0x48, 0x30, 0x82, 0x52, 0x39, 0x01, 0x84, 0x20, 0xa2, 0x24, 0x10, 0x71,
   0x24, 0x21, 0x42, 0x11, 0x21, 0x04, 0x24, 0x80, 0xa5, 0x89, 0x12, 0x20,
-  0x22, 0x08, 0x10, 0x02, 0x20, 0x81, 0x08, 0x00, 0x30, 0x82, 0x42, 0x2d,
+  0x22, 0x08, 0x6c, 0x00, 0xf9, 0xc2, 0x08, 0x00, 0x30, 0x82, 0x42, 0x2d,
   0x12, 0x21, 0x49, 0x49, 0x34, 0x24, 0x8a, 0x22, 0x12, 0x04, 0x7f, 0xd6,
   0x0b, 0x22, 0x12, 0x10, 0x41, 0x12, 0x81, 0x01, 0x83, 0x24, 0x08, 0x12,
   0x81, 0x42, 0x14, 0x24, 0x82, 0x20, 0x91, 0x41, 0x82, 0x43, 0x22, 0x02,
@@ -4834,499 +4123,154 @@ const unsigned char USB_1208HS_rbf[] = {
   0xf8, 0x88, 0xc1, 0x4e, 0x48, 0x42, 0x1d, 0x49, 0x15, 0xc1, 0x41, 0x95,
   0x19, 0xa8, 0x44, 0x8f, 0x44, 0xd4, 0x44, 0xb4, 0x44, 0xe6, 0x42, 0x22,
   0xc2, 0x24, 0x80, 0x52, 0x44, 0x45, 0xe4, 0x42, 0xf2, 0x26, 0x26, 0x2d,
-  0x22, 0x2a, 0xb3, 0x12, 0xa1, 0x81, 0x2b, 0x98, 0x82, 0x2c, 0x59, 0x22,
-  0x29, 0xf8, 0x12, 0x13, 0x3f, 0x11, 0xb1, 0x81, 0xe9, 0x99, 0xd9, 0x88,
-  0xa8, 0xc8, 0x4e, 0x48, 0x42, 0x8c, 0x04, 0x48, 0x85, 0x58, 0x88, 0x4e,
-  0x48, 0x2f, 0xb4, 0x09, 0x6f, 0x22, 0x72, 0x12, 0xa2, 0x12, 0x1a, 0x31,
-  0x12, 0x80, 0x01, 0x25, 0x12, 0xc3, 0x13, 0x1f, 0x11, 0x91, 0x89, 0x9e,
-  0x88, 0x87, 0x94, 0x8b, 0x48, 0x4a, 0x64, 0x84, 0x94, 0x1d, 0x41, 0x50,
-  0x81, 0x85, 0x98, 0x44, 0x4e, 0x44, 0x47, 0x42, 0x4b, 0x24, 0x2a, 0x62,
-  0x42, 0x80, 0x02, 0x44, 0x45, 0x86, 0xf2, 0x26, 0x22, 0x27, 0x21, 0x2a,
-  0xa1, 0x19, 0x2b, 0x81, 0x8a, 0xa8, 0x18, 0xd0, 0x22, 0x18, 0xc3, 0x13,
-  0x1f, 0x11, 0x91, 0x81, 0x9e, 0x88, 0x87, 0x14, 0x8b, 0x48, 0x4a, 0x24,
-  0x04, 0x48, 0x40, 0x58, 0x88, 0x49, 0x64, 0xef, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x10, 0x62, 0x14, 0x8c, 0x41, 0x11, 0x14, 0xc4,
-  0x18, 0x4f, 0x82, 0x84, 0x24, 0x32, 0x24, 0x60, 0x12, 0x40, 0x56, 0x21,
-  0x28, 0x15, 0xc6, 0x23, 0x12, 0xd2, 0x12, 0x82, 0x8a, 0x14, 0x92, 0x12,
-  0x18, 0x88, 0x98, 0x61, 0x11, 0x41, 0x10, 0x24, 0x64, 0x14, 0x12, 0x18,
-  0x14, 0x3c, 0x04, 0x48, 0x50, 0x24, 0x13, 0x13, 0x02, 0x26, 0x41, 0xc4,
-  0x27, 0x64, 0x44, 0x4c, 0x62, 0x21, 0x24, 0x8a, 0x22, 0x11, 0x38, 0x82,
-  0x9f, 0x59, 0x0a, 0x46, 0xb1, 0x18, 0x12, 0x61, 0x84, 0xbc, 0xc5, 0x48,
-  0x66, 0x44, 0xd2, 0x24, 0xb2, 0x44, 0x88, 0x81, 0x73, 0x88, 0x44, 0xac,
-  0x86, 0x49, 0x46, 0xb4, 0x42, 0x93, 0x14, 0x8e, 0x62, 0x26, 0x83, 0x88,
-  0xd1, 0x42, 0x21, 0xfc, 0x81, 0x42, 0x55, 0x92, 0x11, 0x6d, 0x21, 0x1c,
-  0x89, 0xbd, 0xe1, 0xb1, 0x44, 0x38, 0xc1, 0x54, 0x29, 0xc2, 0x41, 0x25,
-  0x21, 0x9c, 0x94, 0x46, 0x64, 0x4a, 0x6c, 0xa7, 0x86, 0x4c, 0xe4, 0x41,
-  0xa2, 0x82, 0x43, 0x08, 0x88, 0x28, 0x26, 0x82, 0x71, 0x22, 0xac, 0x1a,
-  0x4e, 0x12, 0x83, 0x28, 0x69, 0xa5, 0x5c, 0x06, 0x11, 0x22, 0x91, 0x84,
-  0x48, 0x83, 0x04, 0x22, 0x22, 0x00, 0x12, 0x28, 0x44, 0x82, 0x15, 0x44,
-  0x52, 0x21, 0x20, 0xc2, 0x41, 0x12, 0xb0, 0x42, 0xc1, 0x82, 0x42, 0x24,
-  0x92, 0x40, 0x14, 0x91, 0x44, 0x44, 0x41, 0x46, 0x21, 0xa2, 0x41, 0x19,
-  0x21, 0x08, 0x90, 0x84, 0x28, 0x27, 0x28, 0x12, 0x20, 0x88, 0x08, 0xa6,
-  0x84, 0x02, 0xb0, 0x18, 0x22, 0x91, 0x42, 0x10, 0xb8, 0x8a, 0xf4, 0x72,
-  0x41, 0x24, 0x80, 0x21, 0x01, 0x19, 0x11, 0xf6, 0x24, 0x18, 0x8d, 0x42,
-  0x41, 0x23, 0x8a, 0x01, 0x93, 0x48, 0xb8, 0x44, 0x62, 0x26, 0x80, 0x15,
-  0x91, 0x42, 0x2a, 0x08, 0x60, 0x48, 0x42, 0xc0, 0x14, 0x24, 0x1e, 0x24,
-  0x8a, 0x81, 0xec, 0x18, 0x82, 0x44, 0x41, 0x06, 0x10, 0x82, 0xe4, 0x71,
-  0x08, 0x22, 0x43, 0x01, 0x1f, 0x42, 0xb4, 0x12, 0x02, 0x11, 0x40, 0x01,
-  0x61, 0x44, 0x24, 0x80, 0x48, 0x88, 0x08, 0xbf, 0x4c, 0x4c, 0x81, 0x34,
-  0x48, 0x20, 0x44, 0x04, 0x10, 0x24, 0x04, 0x22, 0x00, 0x00, 0x21, 0x43,
-  0x02, 0x12, 0x24, 0x12, 0x80, 0x01, 0x70, 0x11, 0x02, 0x14, 0x82, 0x00,
-  0x20, 0x28, 0x08, 0x13, 0x04, 0x00, 0xc0, 0x44, 0x80, 0x84, 0x02, 0x00,
-  0x28, 0x44, 0x10, 0x62, 0x22, 0x00, 0x28, 0x12, 0x20, 0x01, 0x1f, 0xa8,
-  0x0b, 0x40, 0x01, 0x11, 0x84, 0x80, 0x04, 0x30, 0x44, 0x41, 0x28, 0x41,
-  0x00, 0x00, 0x43, 0x92, 0x24, 0x8a, 0x01, 0x29, 0x28, 0x48, 0x02, 0x88,
-  0x11, 0x40, 0x11, 0x83, 0x21, 0x01, 0x48, 0x00, 0x11, 0x40, 0x81, 0x04,
-  0x42, 0x30, 0x44, 0x40, 0x24, 0x42, 0x04, 0x10, 0x04, 0x1a, 0x12, 0x26,
-  0x28, 0xb2, 0x12, 0x08, 0x18, 0xeb, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x42, 0x29, 0x03, 0x11, 0x40, 0x11, 0xc2, 0x21,
-  0x81, 0x44, 0x2b, 0x48, 0x11, 0x81, 0x4c, 0x01, 0x60, 0x84, 0x46, 0x12,
-  0x09, 0x88, 0x28, 0xb0, 0x44, 0x88, 0x22, 0x22, 0x01, 0x2a, 0x28, 0x48,
-  0x04, 0x43, 0x48, 0xe2, 0x41, 0x48, 0x06, 0x24, 0x16, 0x04, 0x14, 0x21,
-  0x28, 0x16, 0x14, 0x34, 0x82, 0x13, 0x28, 0x14, 0x81, 0x28, 0x82, 0x21,
-  0x92, 0x82, 0x83, 0x02, 0x42, 0xa0, 0x84, 0x2d, 0xda, 0x00, 0x11, 0x10,
-  0x04, 0x29, 0x11, 0x28, 0x84, 0x01, 0x84, 0x22, 0xc0, 0x82, 0x89, 0x88,
-  0x32, 0x11, 0xc0, 0xd4, 0x2a, 0xc8, 0x21, 0xc0, 0x14, 0x00, 0x42, 0x21,
-  0x4d, 0x22, 0x13, 0x41, 0x84, 0x22, 0x8c, 0x63, 0x44, 0x80, 0x04, 0x00,
-  0x42, 0x44, 0x1a, 0x04, 0x00, 0x48, 0x00, 0x88, 0x21, 0x8c, 0x28, 0x24,
-  0x14, 0x04, 0x12, 0x84, 0x30, 0x24, 0x8f, 0x5f, 0x08, 0x48, 0x18, 0x40,
-  0x04, 0x14, 0x21, 0x26, 0x11, 0x58, 0x24, 0x83, 0x14, 0x01, 0x41, 0x29,
-  0x08, 0x1c, 0x61, 0x24, 0x99, 0x28, 0x62, 0x18, 0x28, 0x18, 0x4e, 0x84,
-  0x28, 0x46, 0x02, 0x26, 0x62, 0x19, 0x43, 0x48, 0xa4, 0x84, 0x43, 0x08,
-  0x43, 0x49, 0x14, 0x42, 0xc2, 0x14, 0x42, 0x34, 0x48, 0xc0, 0x14, 0x64,
-  0x48, 0x13, 0x08, 0x24, 0xa0, 0x28, 0x12, 0x2e, 0x42, 0x88, 0x00, 0x00,
-  0x6a, 0xf8, 0x23, 0x43, 0x40, 0x92, 0x21, 0x10, 0x41, 0x22, 0x11, 0x88,
-  0x84, 0x01, 0x88, 0x28, 0x81, 0x92, 0x81, 0x22, 0x83, 0x04, 0x4e, 0x14,
-  0x82, 0x28, 0x40, 0x04, 0x20, 0x22, 0x11, 0x84, 0x02, 0x28, 0xa0, 0x21,
-  0x4d, 0x42, 0x80, 0x04, 0x00, 0x40, 0x84, 0x81, 0x02, 0x80, 0x08, 0x42,
-  0x13, 0x88, 0x48, 0x28, 0x04, 0x44, 0x26, 0x88, 0xc1, 0x48, 0x10, 0xf4,
-  0x96, 0x84, 0x70, 0x22, 0x82, 0x02, 0x1a, 0x42, 0x02, 0x89, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x84, 0x14, 0x26, 0x08, 0x26,
-  0x08, 0x4b, 0x42, 0x80, 0x24, 0x04, 0x00, 0x1a, 0x02, 0x12, 0x40, 0x14,
-  0x04, 0x00, 0x21, 0x12, 0x42, 0x92, 0x44, 0x22, 0x18, 0x40, 0x04, 0x98,
-  0x43, 0x09, 0xf0, 0xee, 0x74, 0x00, 0x41, 0x26, 0x58, 0x84, 0x10, 0x0c,
-  0x19, 0x84, 0x94, 0x44, 0x1e, 0x22, 0x24, 0x00, 0x1a, 0x38, 0x2a, 0x26,
-  0x22, 0x92, 0x82, 0x81, 0x22, 0x89, 0x22, 0xa4, 0x24, 0x20, 0x34, 0x22,
-  0x20, 0x03, 0x41, 0x21, 0x49, 0x88, 0x04, 0x42, 0x40, 0x24, 0x18, 0x2e,
-  0x84, 0xa4, 0x41, 0x44, 0x9a, 0x84, 0x88, 0x04, 0xa0, 0x41, 0x40, 0xac,
-  0x49, 0x28, 0x58, 0x46, 0x34, 0x28, 0x92, 0xf0, 0x1c, 0x66, 0x00, 0x22,
-  0x28, 0x00, 0xc0, 0x18, 0x46, 0x01, 0x20, 0x03, 0x00, 0x20, 0x22, 0x32,
-  0x22, 0x88, 0x81, 0x82, 0x00, 0x10, 0x01, 0x28, 0x80, 0x01, 0x41, 0x48,
-  0x80, 0x04, 0x80, 0x11, 0x84, 0x41, 0x08, 0x20, 0x44, 0x84, 0x81, 0x88,
-  0x05, 0x00, 0x40, 0xac, 0x41, 0x22, 0x18, 0x49, 0x28, 0x01, 0xf0, 0x16,
-  0x4f, 0x24, 0x2c, 0x42, 0x44, 0xc8, 0x3c, 0x24, 0x85, 0x04, 0x20, 0x64,
-  0x44, 0x24, 0x10, 0x02, 0x92, 0x25, 0x08, 0x24, 0x00, 0x28, 0x26, 0x28,
-  0xe4, 0x82, 0x04, 0x2e, 0x48, 0x21, 0x26, 0x88, 0xe2, 0x42, 0x04, 0x21,
-  0x4e, 0x84, 0x00, 0x48, 0x22, 0x80, 0x18, 0x66, 0x44, 0x46, 0x24, 0x01,
-  0x8e, 0x42, 0x00, 0x42, 0x98, 0x43, 0x85, 0x82, 0x21, 0x18, 0x84, 0x24,
-  0xf5, 0x84, 0x28, 0x1a, 0x08, 0x8e, 0x2b, 0x10, 0x72, 0x42, 0x52, 0x18,
-  0x21, 0x20, 0x44, 0x14, 0x28, 0x04, 0x40, 0x62, 0x22, 0x43, 0x04, 0x44,
-  0x00, 0x41, 0x12, 0x94, 0x48, 0x40, 0x81, 0x04, 0x48, 0x40, 0x98, 0x24,
-  0x00, 0x25, 0x44, 0x82, 0x04, 0x00, 0x40, 0x48, 0x84, 0x34, 0x48, 0x28,
-  0x81, 0x4d, 0x48, 0x62, 0x10, 0x09, 0x62, 0x16, 0x3c, 0x44, 0x52, 0x30,
-  0x88, 0x82, 0x12, 0x43, 0x74, 0x75, 0x0f, 0x20, 0x04, 0x22, 0x00, 0x81,
-  0x28, 0x80, 0x11, 0x14, 0x28, 0x02, 0x42, 0x11, 0x60, 0x14, 0x20, 0x42,
-  0x02, 0x48, 0x83, 0x08, 0x10, 0x54, 0x22, 0x64, 0x2c, 0x01, 0x22, 0x2c,
-  0x02, 0x83, 0x02, 0x27, 0x44, 0x49, 0x41, 0x84, 0x04, 0x82, 0x20, 0xa4,
-  0x48, 0x49, 0x08, 0x12, 0x00, 0x82, 0x48, 0x00, 0x12, 0x48, 0x48, 0x44,
-  0x12, 0xbf, 0xfb, 0x06, 0x1a, 0x06, 0x00, 0x52, 0x00, 0x90, 0x16, 0x20,
-  0x82, 0x04, 0x88, 0x81, 0x42, 0x46, 0x02, 0x00, 0x44, 0x00, 0x46, 0x84,
-  0x02, 0xa0, 0x42, 0x00, 0x00, 0x48, 0x43, 0x04, 0x48, 0x12, 0x00, 0x30,
-  0x42, 0x00, 0x40, 0x24, 0x81, 0x01, 0x4c, 0x8c, 0x04, 0x88, 0x40, 0x08,
-  0x00, 0x84, 0xb0, 0xa1, 0x0e, 0x36, 0x02, 0x25, 0x08, 0x00, 0xc1, 0x22,
-  0x18, 0x12, 0x40, 0x0a, 0x27, 0x4c, 0x84, 0x17, 0x44, 0x70, 0x42, 0x11,
-  0x84, 0x52, 0x41, 0x42, 0x48, 0x5f, 0x84, 0x28, 0x02, 0x49, 0x84, 0x52,
-  0x62, 0x2c, 0x03, 0x26, 0x62, 0x42, 0x27, 0x44, 0x48, 0x42, 0x43, 0x61,
-  0x41, 0x20, 0x94, 0x42, 0xc8, 0xa0, 0x42, 0x41, 0x48, 0x32, 0x12, 0xc6,
-  0x84, 0x84, 0xe2, 0x81, 0x28, 0xe4, 0x81, 0x04, 0xc6, 0x88, 0x34, 0x18,
-  0x44, 0x4b, 0xab, 0x90, 0x42, 0x40, 0x83, 0xa2, 0x14, 0x48, 0x40, 0x38,
-  0x46, 0x20, 0x82, 0x04, 0x20, 0x04, 0x42, 0x00, 0x12, 0x81, 0x00, 0x20,
-  0x04, 0x90, 0x42, 0x81, 0x41, 0x00, 0x42, 0x24, 0x28, 0x24, 0x00, 0x44,
-  0x81, 0x44, 0xc0, 0x48, 0xe0, 0x88, 0x94, 0x98, 0x48, 0x50, 0x81, 0xa0,
-  0x48, 0x46, 0x14, 0x04, 0x12, 0x20, 0x48, 0x84, 0xf4, 0xf7, 0x2c, 0x90,
-  0x42, 0x21, 0x20, 0x01, 0x46, 0x38, 0x28, 0x48, 0x60, 0x86, 0x50, 0x82,
-  0x84, 0x81, 0x29, 0x02, 0x20, 0x04, 0x28, 0x48, 0x80, 0x04, 0x48, 0x00,
-  0x24, 0x40, 0x02, 0x41, 0x44, 0x42, 0x10, 0x04, 0x41, 0x21, 0x41, 0x44,
-  0x41, 0x41, 0x42, 0x49, 0x08, 0x68, 0x00, 0x12, 0x80, 0x28, 0xc3, 0x24,
-  0x4c, 0x28, 0x61, 0x41, 0x00, 0x6e, 0x25, 0x00, 0x18, 0x61, 0x24, 0x58,
-  0x00, 0x22, 0x00, 0x40, 0x22, 0x12, 0x02, 0x00, 0x10, 0x08, 0x00, 0x81,
-  0x00, 0x22, 0x81, 0x00, 0x44, 0x48, 0x00, 0x41, 0x48, 0x40, 0x04, 0x42,
-  0x80, 0x02, 0x42, 0x80, 0x81, 0x08, 0x48, 0x18, 0x88, 0x46, 0x84, 0x41,
-  0x95, 0x88, 0x42, 0x43, 0x08, 0x81, 0x43, 0xf1, 0x93, 0xee, 0x10, 0x22,
-  0x04, 0x22, 0x20, 0x01, 0x00, 0x50, 0xc2, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x20, 0x84, 0x04, 0x48, 0x80, 0x04, 0x90, 0x24, 0x00, 0x00, 0x85, 0x04,
-  0x81, 0x00, 0x42, 0x60, 0x42, 0x28, 0x18, 0x80, 0x21, 0x04, 0x44, 0x80,
-  0x04, 0x42, 0x12, 0x42, 0x00, 0x18, 0xf0, 0x8c, 0xdc, 0x00, 0x40, 0x02,
-  0x89, 0x02, 0x52, 0x84, 0x89, 0x14, 0x08, 0x84, 0x24, 0x28, 0x46, 0x04,
-  0x48, 0x00, 0x40, 0x24, 0x42, 0x02, 0x44, 0x24, 0x00, 0x80, 0x44, 0x04,
-  0x00, 0x00, 0x40, 0x54, 0xa4, 0x44, 0x42, 0x00, 0x60, 0x84, 0x00, 0xc0,
-  0x48, 0x00, 0x00, 0x00, 0x80, 0x84, 0x08, 0xaf, 0x1a, 0x0b, 0x48, 0x29,
-  0x01, 0x4a, 0x21, 0x14, 0xa8, 0x42, 0x20, 0x04, 0x40, 0x02, 0x00, 0x20,
-  0x04, 0x00, 0x00, 0x20, 0x04, 0x42, 0x20, 0x04, 0x90, 0x44, 0x42, 0x48,
-  0x41, 0x48, 0x42, 0x00, 0x21, 0x00, 0x48, 0x00, 0x82, 0x4b, 0xc2, 0x28,
-  0x20, 0x81, 0x15, 0xc4, 0xc4, 0x22, 0x2a, 0x04, 0x88, 0x00, 0x14, 0xcf,
-  0x4c, 0x0d, 0x00, 0x22, 0x24, 0x20, 0x02, 0x42, 0x85, 0x42, 0x02, 0x21,
-  0x00, 0x00, 0x28, 0x48, 0x00, 0x42, 0x80, 0x02, 0x28, 0x00, 0xc0, 0x24,
-  0x21, 0x00, 0x00, 0x41, 0x84, 0x00, 0x00, 0x22, 0x20, 0x24, 0x24, 0x01,
-  0x44, 0x43, 0x18, 0x04, 0x00, 0x84, 0x18, 0x10, 0x44, 0x24, 0x21, 0xf4,
-  0x9d, 0x15, 0x40, 0x04, 0x21, 0x29, 0x52, 0x84, 0x48, 0x41, 0x10, 0x24,
-  0x04, 0x00, 0x8c, 0x92, 0x22, 0x22, 0x00, 0x22, 0x60, 0x82, 0x10, 0x02,
-  0x84, 0x30, 0x24, 0x90, 0x4a, 0x30, 0x2a, 0x00, 0x81, 0x40, 0x08, 0x21,
-  0x41, 0x22, 0x00, 0x4c, 0x21, 0x01, 0x00, 0x48, 0x40, 0xb4, 0x18, 0x08,
-  0x10, 0x64, 0x49, 0x84, 0x60, 0x44, 0x88, 0x5f, 0x11, 0x04, 0x10, 0x88,
-  0x02, 0x28, 0x12, 0x83, 0x21, 0x42, 0x02, 0x49, 0x04, 0x00, 0x00, 0x22,
-  0x00, 0x28, 0x22, 0x22, 0x20, 0x02, 0x28, 0x22, 0x22, 0x68, 0x62, 0x00,
-  0x41, 0x10, 0x08, 0x41, 0x40, 0x82, 0x24, 0x04, 0x12, 0x80, 0x04, 0x00,
-  0x10, 0x84, 0x08, 0x42, 0x00, 0x80, 0x04, 0x88, 0x46, 0x05, 0x84, 0x80,
-  0x24, 0x04, 0x00, 0x81, 0x00, 0x81, 0x10, 0x8c, 0x02, 0x24, 0x44, 0x22,
+  0x22, 0x2a, 0xb3, 0x12, 0xa1, 0x81, 0x2b, 0x98, 0x82, 0x2c, 0x59, 0x3c,
+  0x00, 0xf1, 0x43, 0xa8, 0xc8, 0x4e, 0x48, 0x42, 0x8c, 0x04, 0x48, 0x85,
+  0x58, 0x88, 0x4e, 0x48, 0x2f, 0xb4, 0x09, 0x6f, 0x22, 0x72, 0x12, 0xa2,
+  0x12, 0x1a, 0x31, 0x12, 0x80, 0x01, 0x25, 0x12, 0xc3, 0x13, 0x1f, 0x11,
+  0x91, 0x89, 0x9e, 0x88, 0x87, 0x94, 0x8b, 0x48, 0x4a, 0x64, 0x84, 0x94,
+  0x1d, 0x41, 0x50, 0x81, 0x85, 0x98, 0x44, 0x4e, 0x44, 0x47, 0x42, 0x4b,
+  0x24, 0x2a, 0x62, 0x42, 0x80, 0x02, 0x44, 0x45, 0x86, 0xf2, 0x26, 0x22,
+  0x27, 0x21, 0x2a, 0xa1, 0x19, 0x2b, 0x81, 0x8a, 0xa8, 0x18, 0xd0, 0x22,
+  0x18, 0x35, 0x00, 0xf6, 0x02, 0x81, 0x9e, 0x88, 0x87, 0x14, 0x8b, 0x48,
+  0x4a, 0x24, 0x04, 0x48, 0x40, 0x58, 0x88, 0x49, 0x64, 0xef, 0x80, 0x01,
+  0x0f, 0x01, 0x00, 0x01, 0x3f, 0xff, 0xe4, 0x0f, 0x16, 0x00, 0x00, 0x06,
+  0x01, 0x00, 0x3f, 0xf0, 0x4f, 0xfe, 0x16, 0x00, 0x00, 0x07, 0x01, 0x00,
+  0x0f, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x81, 0x10, 0x62,
+  0x14, 0x8c, 0x41, 0x11, 0x14, 0xc4, 0x18, 0x4f, 0x82, 0x84, 0x24, 0x32,
+  0x24, 0x60, 0x12, 0x40, 0x56, 0x21, 0x28, 0x15, 0xc6, 0x23, 0x12, 0xd2,
+  0x12, 0x82, 0x8a, 0x14, 0x92, 0x12, 0x18, 0x88, 0x98, 0x61, 0x11, 0x41,
+  0x10, 0x24, 0x64, 0x14, 0x12, 0x18, 0x14, 0x3c, 0x04, 0x48, 0x50, 0x24,
+  0x13, 0x13, 0x02, 0x26, 0x41, 0xc4, 0x27, 0x64, 0x44, 0x4c, 0x62, 0x21,
+  0x24, 0x8a, 0x22, 0x11, 0x38, 0x82, 0x9f, 0x59, 0x0a, 0x46, 0xb1, 0x18,
+  0x12, 0x61, 0x84, 0xbc, 0xc5, 0x48, 0x66, 0x44, 0xd2, 0x24, 0xb2, 0x44,
+  0x88, 0x81, 0x73, 0x88, 0x44, 0xac, 0x86, 0x49, 0x46, 0xb4, 0x42, 0x93,
+  0x14, 0x8e, 0x62, 0x26, 0x83, 0x88, 0xd1, 0x42, 0x21, 0xfc, 0x81, 0x42,
+  0x55, 0x92, 0x11, 0x6d, 0x21, 0x1c, 0x89, 0xbd, 0xe1, 0xb1, 0x44, 0x38,
+  0xc1, 0x54, 0x29, 0xc2, 0x41, 0x25, 0x21, 0x9c, 0x94, 0x46, 0x64, 0x4a,
+  0x6c, 0xa7, 0x86, 0x4c, 0xe4, 0x41, 0xa2, 0x82, 0x43, 0x08, 0x88, 0x28,
+  0x26, 0x82, 0x71, 0x22, 0xac, 0x1a, 0x4e, 0x12, 0x83, 0x28, 0x69, 0xa5,
+  0x5c, 0x06, 0x11, 0x22, 0x91, 0x84, 0x48, 0x83, 0x04, 0x22, 0x22, 0x00,
+  0x12, 0x28, 0x44, 0x82, 0x15, 0x44, 0x52, 0x21, 0x20, 0xc2, 0x41, 0x12,
+  0xb0, 0x42, 0xc1, 0x82, 0x42, 0x24, 0x92, 0x40, 0x14, 0x91, 0x44, 0x44,
+  0x41, 0x46, 0x21, 0xa2, 0x41, 0x19, 0x21, 0x08, 0x90, 0x84, 0x28, 0x27,
+  0x28, 0x12, 0x20, 0x88, 0x08, 0xa6, 0x84, 0x02, 0xb0, 0x18, 0x22, 0x91,
+  0x42, 0x10, 0xb8, 0x8a, 0xf4, 0x72, 0x41, 0x24, 0x80, 0x21, 0x01, 0x19,
+  0x11, 0xf6, 0x24, 0x18, 0x8d, 0x42, 0x41, 0x23, 0x8a, 0x01, 0x93, 0x48,
+  0xb8, 0x44, 0x62, 0x26, 0x80, 0x15, 0x91, 0x42, 0x2a, 0x08, 0x60, 0x48,
+  0x42, 0xc0, 0x14, 0x24, 0x1e, 0x24, 0x8a, 0x81, 0xec, 0x18, 0x82, 0x44,
+  0x41, 0x06, 0x10, 0x82, 0xe4, 0x71, 0x08, 0x22, 0x43, 0x01, 0x1f, 0x42,
+  0xb4, 0x12, 0x02, 0x11, 0x40, 0x01, 0x61, 0x44, 0x24, 0x80, 0x48, 0x88,
+  0x08, 0xbf, 0x4c, 0x4c, 0x81, 0x34, 0x48, 0x20, 0x44, 0x04, 0x10, 0x24,
+  0x04, 0x22, 0x00, 0x00, 0x21, 0x43, 0x02, 0x12, 0x24, 0x12, 0x80, 0x01,
+  0x70, 0x11, 0x02, 0x14, 0x82, 0x00, 0x20, 0x28, 0x08, 0x13, 0x04, 0x00,
+  0xc0, 0x44, 0x80, 0x84, 0x02, 0x00, 0x28, 0x44, 0x10, 0x62, 0x22, 0x00,
+  0x28, 0x12, 0x20, 0x01, 0x1f, 0xa8, 0x0b, 0x40, 0x01, 0x11, 0x84, 0x80,
+  0x04, 0x30, 0x44, 0x41, 0x28, 0x41, 0x00, 0x00, 0x43, 0x92, 0x24, 0x8a,
+  0x01, 0x29, 0x28, 0x48, 0x02, 0x88, 0x11, 0x40, 0x11, 0x83, 0x21, 0x01,
+  0x48, 0x00, 0x11, 0x40, 0x81, 0x04, 0x42, 0x30, 0x44, 0x40, 0x24, 0x42,
+  0x04, 0x10, 0x04, 0x1a, 0x12, 0x26, 0x28, 0xb2, 0x12, 0x08, 0x18, 0xeb,
+  0x7d, 0xa5, 0x01, 0x00, 0x07, 0x01, 0x00, 0xf2, 0xf7, 0xff, 0xe4, 0x0f,
+  0x42, 0x29, 0x03, 0x11, 0x40, 0x11, 0xc2, 0x21, 0x81, 0x44, 0x2b, 0x48,
+  0x11, 0x81, 0x4c, 0x01, 0x60, 0x84, 0x46, 0x12, 0x09, 0x88, 0x28, 0xb0,
+  0x44, 0x88, 0x22, 0x22, 0x01, 0x2a, 0x28, 0x48, 0x04, 0x43, 0x48, 0xe2,
+  0x41, 0x48, 0x06, 0x24, 0x16, 0x04, 0x14, 0x21, 0x28, 0x16, 0x14, 0x34,
+  0x82, 0x13, 0x28, 0x14, 0x81, 0x28, 0x82, 0x21, 0x92, 0x82, 0x83, 0x02,
+  0x42, 0xa0, 0x84, 0x2d, 0xda, 0x00, 0x11, 0x10, 0x04, 0x29, 0x11, 0x28,
+  0x84, 0x01, 0x84, 0x22, 0xc0, 0x82, 0x89, 0x88, 0x32, 0x11, 0xc0, 0xd4,
+  0x2a, 0xc8, 0x21, 0xc0, 0x14, 0x00, 0x42, 0x21, 0x4d, 0x22, 0x13, 0x41,
+  0x84, 0x22, 0x8c, 0x63, 0x44, 0x80, 0x04, 0x00, 0x42, 0x44, 0x1a, 0x04,
+  0x00, 0x48, 0x00, 0x88, 0x21, 0x8c, 0x28, 0x24, 0x14, 0x04, 0x12, 0x84,
+  0x30, 0x24, 0x8f, 0x5f, 0x08, 0x48, 0x18, 0x40, 0x04, 0x14, 0x21, 0x26,
+  0x11, 0x58, 0x24, 0x83, 0x14, 0x01, 0x41, 0x29, 0x08, 0x1c, 0x61, 0x24,
+  0x99, 0x28, 0x62, 0x18, 0x28, 0x18, 0x4e, 0x84, 0x28, 0x46, 0x02, 0x26,
+  0x62, 0x19, 0x43, 0x48, 0xa4, 0x84, 0x43, 0x08, 0x43, 0x49, 0x14, 0x42,
+  0xc2, 0x14, 0x42, 0x34, 0x48, 0xc0, 0x14, 0x64, 0x48, 0x13, 0x08, 0x24,
+  0xa0, 0x28, 0x12, 0x2e, 0x42, 0x88, 0x00, 0x00, 0x6a, 0xf8, 0x23, 0x43,
+  0x40, 0x92, 0x21, 0x10, 0x41, 0x22, 0x11, 0x88, 0x84, 0x01, 0x88, 0x28,
+  0x81, 0x92, 0x81, 0x22, 0x83, 0x04, 0x4e, 0x14, 0x82, 0x28, 0x40, 0x04,
+  0x20, 0x22, 0x11, 0x84, 0x02, 0x28, 0xa0, 0x21, 0x4d, 0x42, 0x80, 0x04,
+  0x00, 0x40, 0x84, 0x81, 0x02, 0x80, 0x08, 0x42, 0x13, 0x88, 0x48, 0x28,
+  0x04, 0x44, 0x26, 0x88, 0xc1, 0x48, 0x10, 0xf4, 0x96, 0x84, 0x70, 0x22,
+  0x82, 0x02, 0x1a, 0x42, 0x02, 0x89, 0x01, 0x0c, 0x01, 0xf0, 0xff, 0xff,
+  0xff, 0x8a, 0x88, 0x00, 0x84, 0x14, 0x26, 0x08, 0x26, 0x08, 0x4b, 0x42,
+  0x80, 0x24, 0x04, 0x00, 0x1a, 0x02, 0x12, 0x40, 0x14, 0x04, 0x00, 0x21,
+  0x12, 0x42, 0x92, 0x44, 0x22, 0x18, 0x40, 0x04, 0x98, 0x43, 0x09, 0xf0,
+  0xee, 0x74, 0x00, 0x41, 0x26, 0x58, 0x84, 0x10, 0x0c, 0x19, 0x84, 0x94,
+  0x44, 0x1e, 0x22, 0x24, 0x00, 0x1a, 0x38, 0x2a, 0x26, 0x22, 0x92, 0x82,
+  0x81, 0x22, 0x89, 0x22, 0xa4, 0x24, 0x20, 0x34, 0x22, 0x20, 0x03, 0x41,
+  0x21, 0x49, 0x88, 0x04, 0x42, 0x40, 0x24, 0x18, 0x2e, 0x84, 0xa4, 0x41,
+  0x44, 0x9a, 0x84, 0x88, 0x04, 0xa0, 0x41, 0x40, 0xac, 0x49, 0x28, 0x58,
+  0x46, 0x34, 0x28, 0x92, 0xf0, 0x1c, 0x66, 0x00, 0x22, 0x28, 0x00, 0xc0,
+  0x18, 0x46, 0x01, 0x20, 0x03, 0x00, 0x20, 0x22, 0x32, 0x22, 0x88, 0x81,
+  0x82, 0x00, 0x10, 0x01, 0x28, 0x80, 0x01, 0x41, 0x48, 0x80, 0x04, 0x80,
+  0x11, 0x84, 0x41, 0x08, 0x20, 0x44, 0x84, 0x81, 0x88, 0x05, 0x00, 0x40,
+  0xac, 0x41, 0x22, 0x18, 0x49, 0x28, 0x01, 0xf0, 0x16, 0x4f, 0x24, 0x2c,
+  0x42, 0x44, 0xc8, 0x3c, 0x24, 0x85, 0x04, 0x20, 0x64, 0x44, 0x24, 0x10,
+  0x02, 0x92, 0x25, 0x08, 0x24, 0x00, 0x28, 0x26, 0x28, 0xe4, 0x82, 0x04,
+  0x2e, 0x48, 0x21, 0x26, 0x88, 0xe2, 0x42, 0x04, 0x21, 0x4e, 0x84, 0x00,
+  0x48, 0x22, 0x80, 0x18, 0x66, 0x44, 0x46, 0x24, 0x01, 0x8e, 0x42, 0x00,
+  0x42, 0x98, 0x43, 0x85, 0x82, 0x21, 0x18, 0x84, 0x24, 0xf5, 0x84, 0x28,
+  0x1a, 0x08, 0x8e, 0x2b, 0x10, 0x72, 0x42, 0x52, 0x18, 0x21, 0x20, 0x44,
+  0x14, 0x28, 0x04, 0x40, 0x62, 0x22, 0x43, 0x04, 0x44, 0x00, 0x41, 0x12,
+  0x94, 0x48, 0x40, 0x81, 0x04, 0x48, 0x40, 0x98, 0x24, 0x00, 0x25, 0x44,
+  0x82, 0x04, 0x00, 0x40, 0x48, 0x84, 0x34, 0x48, 0x28, 0x81, 0x4d, 0x48,
+  0x62, 0x10, 0x09, 0x62, 0x16, 0x3c, 0x44, 0x52, 0x30, 0x88, 0x82, 0x12,
+  0x43, 0x74, 0x75, 0x0f, 0x20, 0x04, 0x22, 0x00, 0x81, 0x28, 0x80, 0x11,
+  0x14, 0x28, 0x02, 0x42, 0x11, 0x60, 0x14, 0x20, 0x42, 0x02, 0x48, 0x83,
+  0x08, 0x10, 0x54, 0x22, 0x64, 0x2c, 0x01, 0x22, 0x2c, 0x02, 0x83, 0x02,
+  0x27, 0x44, 0x49, 0x41, 0x84, 0x04, 0x82, 0x20, 0xa4, 0x48, 0x49, 0x08,
+  0x12, 0x00, 0x82, 0x48, 0x00, 0x12, 0x48, 0x48, 0x44, 0x12, 0xbf, 0xfb,
+  0x06, 0x1a, 0x06, 0x00, 0x52, 0x00, 0x90, 0x16, 0x20, 0x82, 0x04, 0x88,
+  0x81, 0x42, 0x46, 0x02, 0x00, 0x44, 0x00, 0x46, 0x84, 0x02, 0xa0, 0x42,
+  0x00, 0x00, 0x48, 0x43, 0x04, 0x48, 0x12, 0x00, 0x30, 0x42, 0x00, 0x40,
+  0x24, 0x81, 0x01, 0x4c, 0x8c, 0x04, 0x88, 0x40, 0x08, 0x00, 0x84, 0xb0,
+  0xa1, 0x0e, 0x36, 0x02, 0x25, 0x08, 0x00, 0xc1, 0x22, 0x18, 0x12, 0x40,
+  0x0a, 0x27, 0x4c, 0x84, 0x17, 0x44, 0x70, 0x42, 0x11, 0x84, 0x52, 0x41,
+  0x42, 0x48, 0x5f, 0x84, 0x28, 0x02, 0x49, 0x84, 0x52, 0x62, 0x2c, 0x03,
+  0x26, 0x62, 0x42, 0x27, 0x44, 0x48, 0x42, 0x43, 0x61, 0x41, 0x20, 0x94,
+  0x42, 0xc8, 0xa0, 0x42, 0x41, 0x48, 0x32, 0x12, 0xc6, 0x84, 0x84, 0xe2,
+  0x81, 0x28, 0xe4, 0x81, 0x04, 0xc6, 0x88, 0x34, 0x18, 0x44, 0x4b, 0xab,
+  0x90, 0x42, 0x40, 0x83, 0xa2, 0x14, 0x48, 0x40, 0x38, 0x46, 0x20, 0x82,
+  0x04, 0x20, 0x04, 0x42, 0x00, 0x12, 0x81, 0x00, 0x20, 0x04, 0x90, 0x42,
+  0x81, 0x41, 0x00, 0x42, 0x24, 0x28, 0x24, 0x00, 0x44, 0x81, 0x44, 0xc0,
+  0x48, 0xe0, 0x88, 0x94, 0x98, 0x48, 0x50, 0x81, 0xa0, 0x48, 0x46, 0x14,
+  0x04, 0x12, 0x20, 0x48, 0x84, 0xf4, 0xf7, 0x2c, 0x90, 0x42, 0x21, 0x20,
+  0x01, 0x46, 0x38, 0x28, 0x48, 0x60, 0x86, 0x50, 0x82, 0x84, 0x81, 0x29,
+  0x02, 0x20, 0x04, 0x28, 0x48, 0x80, 0x04, 0x48, 0x00, 0x24, 0x40, 0x02,
+  0x41, 0x44, 0x42, 0x10, 0x04, 0x41, 0x21, 0x41, 0x44, 0x41, 0x41, 0x42,
+  0x49, 0x08, 0x68, 0x00, 0x12, 0x80, 0x28, 0xc3, 0x24, 0x4c, 0x28, 0x61,
+  0x41, 0x00, 0x6e, 0x25, 0x00, 0x18, 0x61, 0x24, 0x58, 0x00, 0x22, 0x00,
+  0x40, 0x22, 0x12, 0x02, 0x00, 0x10, 0x08, 0x00, 0x81, 0x00, 0x22, 0x81,
+  0x00, 0x44, 0x48, 0x00, 0x41, 0x48, 0x40, 0x04, 0x42, 0x80, 0x02, 0x42,
+  0x80, 0x81, 0x08, 0x48, 0x18, 0x88, 0x46, 0x84, 0x41, 0x95, 0x88, 0x42,
+  0x43, 0x08, 0x81, 0x43, 0xf1, 0x93, 0xee, 0x10, 0x22, 0x04, 0x22, 0x20,
+  0x01, 0x00, 0x50, 0xc2, 0x00, 0x00, 0x28, 0x00, 0x00, 0x20, 0x84, 0x04,
+  0x48, 0x80, 0x04, 0x90, 0x24, 0x00, 0x00, 0x85, 0x04, 0x81, 0x00, 0x42,
+  0x60, 0x42, 0x28, 0x18, 0x80, 0x21, 0x04, 0x44, 0x80, 0x04, 0x42, 0x12,
+  0x42, 0x00, 0x18, 0xf0, 0x8c, 0xdc, 0x00, 0x40, 0x02, 0x89, 0x02, 0x52,
+  0x84, 0x89, 0x14, 0x08, 0x84, 0x24, 0x28, 0x46, 0x04, 0x48, 0x00, 0x40,
+  0x24, 0x42, 0x02, 0x44, 0x24, 0x00, 0x80, 0x44, 0x04, 0x00, 0x00, 0x40,
+  0x54, 0xa4, 0x44, 0x42, 0x00, 0x60, 0x84, 0x00, 0xc0, 0x48, 0x00, 0x00,
+  0x00, 0x80, 0x84, 0x08, 0xaf, 0x1a, 0x0b, 0x48, 0x29, 0x01, 0x4a, 0x21,
+  0x14, 0xa8, 0x42, 0x20, 0x04, 0x40, 0x02, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0x20, 0x04, 0x42, 0x20, 0x04, 0x90, 0x44, 0x42, 0x48, 0x41, 0x48, 0x42,
+  0x00, 0x21, 0x00, 0x48, 0x00, 0x82, 0x4b, 0xc2, 0x28, 0x20, 0x81, 0x15,
+  0xc4, 0xc4, 0x22, 0x2a, 0x04, 0x88, 0x00, 0x14, 0xcf, 0x4c, 0x0d, 0x00,
+  0x22, 0x24, 0x20, 0x02, 0x42, 0x85, 0x42, 0x02, 0x21, 0x00, 0x00, 0x28,
+  0x48, 0x00, 0x42, 0x80, 0x02, 0x28, 0x00, 0xc0, 0x24, 0x21, 0x00, 0x00,
+  0x41, 0x84, 0x00, 0x00, 0x22, 0x20, 0x24, 0x24, 0x01, 0x44, 0x43, 0x18,
+  0x04, 0x00, 0x84, 0x18, 0x10, 0x44, 0x24, 0x21, 0xf4, 0x9d, 0x15, 0x40,
+  0x04, 0x21, 0x29, 0x52, 0x84, 0x48, 0x41, 0x10, 0x24, 0x04, 0x00, 0x8c,
+  0x92, 0x22, 0x22, 0x00, 0x22, 0x60, 0x82, 0x10, 0x02, 0x84, 0x30, 0x24,
+  0x90, 0x4a, 0x30, 0x2a, 0x00, 0x81, 0x40, 0x08, 0x21, 0x41, 0x22, 0x00,
+  0x4c, 0x21, 0x01, 0x00, 0x48, 0x40, 0xb4, 0x18, 0x08, 0x10, 0x64, 0x49,
+  0x84, 0x60, 0x44, 0x88, 0x5f, 0x11, 0x04, 0x10, 0x88, 0x02, 0x28, 0x12,
+  0x83, 0x21, 0x42, 0x02, 0x49, 0x04, 0x00, 0x00, 0x22, 0x00, 0x28, 0x22,
+  0x22, 0x20, 0x02, 0x28, 0x22, 0x22, 0x68, 0x62, 0x00, 0x41, 0x10, 0x08,
+  0x41, 0x40, 0x82, 0x24, 0x04, 0x12, 0x80, 0x04, 0x00, 0x10, 0x84, 0x08,
+  0x42, 0x00, 0x80, 0x04, 0x88, 0x46, 0x05, 0x84, 0x8c, 0x03, 0xf0, 0xff,
+  0xff, 0xff, 0x48, 0x81, 0x00, 0x81, 0x10, 0x8c, 0x02, 0x24, 0x44, 0x22,
   0x46, 0x44, 0x02, 0x48, 0x25, 0x04, 0x18, 0x80, 0x0c, 0x00, 0x22, 0xc0,
   0x41, 0x48, 0x40, 0x18, 0x82, 0x04, 0x22, 0x84, 0x28, 0x8c, 0x02, 0x20,
   0x41, 0x1c, 0x84, 0x06, 0x12, 0x4c, 0x11, 0x04, 0x12, 0x18, 0x90, 0x46,
@@ -5397,172 +4341,169 @@ const unsigned char USB_1208HS_rbf[] = {
   0xf5, 0xcc, 0xcc, 0xcf, 0xc4, 0xad, 0x66, 0xcf, 0x47, 0xf7, 0xc4, 0xc8,
   0x8f, 0x8c, 0xfd, 0x42, 0x44, 0xcf, 0x25, 0xf5, 0x44, 0xdc, 0x2e, 0x93,
   0x10, 0x02, 0x22, 0x00, 0xa0, 0x12, 0x40, 0x42, 0x08, 0x00, 0x84, 0x00,
-  0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x21, 0x28, 0x41, 0x42, 0x00,
-  0x41, 0x10, 0x04, 0x63, 0x82, 0x24, 0x02, 0x80, 0x04, 0x00, 0x12, 0x00,
-  0x00, 0x4c, 0x22, 0x21, 0x24, 0x01, 0xf0, 0x5a, 0xd2, 0x20, 0x08, 0x2d,
-  0x12, 0x12, 0x40, 0x08, 0x8c, 0x04, 0x00, 0x84, 0x25, 0x02, 0x00, 0x28,
-  0x80, 0x22, 0x02, 0x22, 0xa0, 0x42, 0xa0, 0x42, 0xa0, 0x42, 0x42, 0x61,
-  0x28, 0x48, 0x10, 0x04, 0x48, 0x00, 0x00, 0x30, 0x44, 0x12, 0x00, 0x4a,
-  0x81, 0x02, 0x48, 0x46, 0x04, 0x4e, 0x14, 0x12, 0x42, 0x41, 0x00, 0x44,
-  0x14, 0x15, 0x09, 0x6d, 0x42, 0x1f, 0x41, 0x52, 0x2c, 0x1f, 0x41, 0x32,
-  0x4e, 0x1f, 0xc1, 0x32, 0x4e, 0x1d, 0x64, 0xeb, 0x14, 0x1d, 0x2c, 0xab,
-  0x94, 0x19, 0xb2, 0x4a, 0x19, 0xf5, 0x4a, 0x94, 0x4b, 0x42, 0xaf, 0x54,
-  0x39, 0x24, 0xaf, 0x54, 0x79, 0x24, 0xd8, 0x5a, 0xf9, 0x24, 0x48, 0x8d,
-  0x95, 0x4f, 0xa2, 0xd4, 0x58, 0xf8, 0x24, 0x4a, 0x87, 0x51, 0x6f, 0xa2,
-  0x74, 0x98, 0xf5, 0x24, 0x4a, 0x8f, 0x59, 0xd2, 0xa4, 0xf4, 0x98, 0x24,
-  0xac, 0xf4, 0x91, 0x24, 0x4d, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f, 0xc9,
-  0x32, 0x4c, 0x1f, 0xc9, 0x32, 0x4e, 0x1f, 0xc8, 0xb2, 0x4a, 0xd1, 0xc1,
-  0xb2, 0x4a, 0xd9, 0x81, 0xb2, 0x4a, 0x79, 0x85, 0xb8, 0x4a, 0x79, 0x24,
-  0xb8, 0x4a, 0x79, 0xb4, 0xb8, 0x4a, 0x79, 0x24, 0x98, 0x9a, 0x4f, 0x8b,
-  0x94, 0x98, 0x4f, 0xa2, 0xb4, 0xcc, 0x0c, 0x24, 0x1f, 0x81, 0x16, 0xb8,
-  0x11, 0x06, 0x13, 0x31, 0x4a, 0x19, 0xb2, 0x22, 0x11, 0xf1, 0x4a, 0x94,
-  0x19, 0xf2, 0x6a, 0x94, 0x11, 0xab, 0xb4, 0x22, 0x8d, 0x91, 0x22, 0x2f,
-  0x14, 0x29, 0xc2, 0x91, 0x2b, 0x42, 0x1c, 0xf9, 0x22, 0x12, 0x1c, 0xa9,
-  0x82, 0x1e, 0x81, 0x26, 0x62, 0x19, 0x2a, 0xe4, 0x59, 0x42, 0xe3, 0x59,
-  0xc2, 0x42, 0x1f, 0xc9, 0x02, 0x1f, 0x89, 0x46, 0xf2, 0x91, 0x64, 0x42,
-  0x1b, 0x29, 0x21, 0x1b, 0x28, 0x2b, 0x14, 0x1d, 0x24, 0x2d, 0x14, 0x19,
-  0xf2, 0x42, 0xb4, 0x59, 0x92, 0x92, 0x43, 0x92, 0x12, 0x43, 0x92, 0x82,
-  0x43, 0x92, 0x12, 0x6b, 0x42, 0x2b, 0x84, 0x4f, 0x22, 0xf1, 0xcb, 0x3d,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x84, 0x80, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0xa0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x21, 0xf0, 0xa3,
-  0xc2, 0x00, 0x40, 0x08, 0x81, 0x40, 0x48, 0x18, 0x08, 0x81, 0x00, 0x10,
-  0x08, 0xa9, 0x04, 0x41, 0x00, 0x20, 0x04, 0x10, 0x04, 0x24, 0x42, 0x82,
-  0x49, 0x04, 0x80, 0x08, 0x00, 0x82, 0x00, 0x10, 0x98, 0x1a, 0x83, 0x01,
-  0x18, 0x80, 0x48, 0x64, 0x84, 0x41, 0x58, 0x00, 0x41, 0x00, 0x10, 0xb4,
-  0x92, 0x0d, 0xa0, 0x18, 0x12, 0x18, 0x80, 0x01, 0xa0, 0x42, 0x00, 0x42,
-  0x00, 0x48, 0x43, 0x08, 0xa8, 0x23, 0x02, 0x20, 0x24, 0xa2, 0x82, 0x48,
-  0x42, 0x80, 0x03, 0x43, 0x84, 0x22, 0x35, 0x24, 0x24, 0x22, 0x48, 0x22,
-  0x40, 0x84, 0x22, 0x82, 0x24, 0x62, 0x48, 0x43, 0x82, 0x24, 0x03, 0x00,
-  0x88, 0x82, 0x49, 0xa2, 0x58, 0x20, 0x8c, 0x72, 0xa8, 0x01, 0xef, 0xd5,
-  0x0a, 0xa0, 0x14, 0x81, 0x18, 0x80, 0x11, 0x18, 0x98, 0x48, 0x10, 0x04,
-  0x22, 0x90, 0x48, 0x82, 0xa9, 0x24, 0xd2, 0x42, 0x02, 0x24, 0x42, 0x28,
-  0x1a, 0x22, 0x64, 0x4c, 0xa0, 0x21, 0x60, 0x4c, 0x43, 0x36, 0x41, 0x43,
-  0xc2, 0x82, 0x83, 0x82, 0x24, 0x24, 0x48, 0x04, 0x22, 0x8c, 0x34, 0x22,
-  0x85, 0x34, 0x24, 0x49, 0x24, 0x22, 0x42, 0x24, 0x64, 0x48, 0x58, 0x49,
-  0xa2, 0x1c, 0x41, 0x86, 0x82, 0x62, 0x88, 0x43, 0xf1, 0x2a, 0xd9, 0x00,
-  0x80, 0x01, 0x81, 0x00, 0x20, 0x02, 0x81, 0x48, 0x00, 0x10, 0x04, 0x82,
-  0x00, 0x00, 0x42, 0x82, 0x00, 0x40, 0x22, 0x04, 0x80, 0x01, 0x00, 0x80,
-  0x02, 0x20, 0x02, 0x60, 0x81, 0x98, 0x80, 0x21, 0x81, 0x08, 0x81, 0x80,
-  0x08, 0x00, 0x42, 0x80, 0x02, 0xaf, 0xe1, 0x0e, 0x24, 0x00, 0x00, 0x44,
-  0x80, 0x24, 0x82, 0x32, 0x48, 0x00, 0x20, 0x04, 0x00, 0x4c, 0x13, 0x24,
-  0x44, 0xa8, 0x24, 0x22, 0x40, 0x08, 0x20, 0x18, 0xa4, 0x25, 0x00, 0x24,
-  0x4c, 0x02, 0x44, 0x40, 0x04, 0x10, 0xc8, 0x44, 0x00, 0x20, 0x01, 0x82,
-  0x10, 0x44, 0xa4, 0x42, 0x20, 0x02, 0x43, 0x0a, 0xf0, 0x4e, 0x76, 0x24,
-  0x42, 0x30, 0x32, 0x6d, 0x12, 0x45, 0x08, 0x18, 0xc1, 0x46, 0xc8, 0x48,
-  0x00, 0x18, 0x44, 0x88, 0x89, 0x14, 0x08, 0x11, 0x81, 0x28, 0x00, 0x42,
-  0x48, 0xa0, 0x41, 0x42, 0x3a, 0x24, 0x04, 0x87, 0x44, 0x44, 0x44, 0x30,
-  0x44, 0x21, 0x4c, 0x28, 0xc1, 0x48, 0x43, 0x81, 0x94, 0x18, 0x41, 0x96,
-  0x88, 0x24, 0x04, 0x18, 0x8a, 0x31, 0x51, 0x48, 0x88, 0x9e, 0x44, 0x87,
-  0x44, 0x4b, 0x1a, 0x83, 0x84, 0xd2, 0x48, 0xf2, 0x48, 0x79, 0x24, 0x10,
-  0xe2, 0x21, 0x82, 0x51, 0x48, 0x00, 0x87, 0x44, 0x83, 0x14, 0x18, 0x08,
-  0x18, 0x41, 0x42, 0x84, 0x81, 0x20, 0x12, 0x88, 0x04, 0x48, 0x68, 0x48,
-  0xa0, 0x41, 0x20, 0x82, 0x84, 0x65, 0x44, 0x40, 0x04, 0x6c, 0x44, 0x14,
-  0x44, 0x04, 0x30, 0x48, 0x8f, 0x44, 0x41, 0x04, 0x42, 0x42, 0x80, 0x28,
-  0xe9, 0x44, 0x21, 0x24, 0x24, 0x35, 0x68, 0x18, 0x43, 0x04, 0x84, 0xfe,
-  0x59, 0x20, 0x04, 0x21, 0x44, 0x21, 0x44, 0x12, 0x80, 0x22, 0x26, 0x04,
-  0x00, 0x82, 0x42, 0x00, 0x17, 0x41, 0x44, 0x22, 0x84, 0x22, 0x00, 0x84,
-  0x80, 0xa4, 0x94, 0x41, 0x22, 0x84, 0x41, 0xd0, 0x42, 0x02, 0x80, 0x28,
-  0x91, 0x48, 0x16, 0x04, 0x00, 0x96, 0x08, 0x12, 0x20, 0x01, 0x14, 0x44,
-  0xa8, 0x49, 0x18, 0x94, 0xa4, 0x2e, 0x88, 0x28, 0x43, 0xe2, 0xa5, 0x05,
-  0x30, 0x42, 0x41, 0x40, 0x08, 0x28, 0x20, 0x32, 0x28, 0x20, 0x24, 0x82,
-  0x44, 0x58, 0x48, 0x00, 0x41, 0x30, 0x24, 0x00, 0x42, 0x00, 0x20, 0x22,
-  0x04, 0x00, 0x49, 0x02, 0x00, 0x00, 0xc0, 0x18, 0x20, 0x24, 0x04, 0x40,
-  0x08, 0x00, 0x48, 0xc0, 0x18, 0x18, 0x20, 0x04, 0x42, 0x1a, 0x84, 0xf4,
-  0x6e, 0x34, 0x24, 0x48, 0x42, 0x81, 0x22, 0x00, 0x00, 0x00, 0x49, 0x08,
-  0x26, 0x18, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x02, 0x00,
-  0x43, 0x18, 0x08, 0x42, 0x81, 0x48, 0x46, 0x04, 0x40, 0x04, 0x18, 0x10,
-  0x4c, 0x34, 0x84, 0x20, 0x22, 0x34, 0x14, 0x00, 0x00, 0x4c, 0x21, 0x02,
-  0x20, 0xf1, 0x52, 0x9b, 0x00, 0x00, 0x21, 0x00, 0x00, 0x48, 0x00, 0x28,
-  0x00, 0x00, 0x20, 0x44, 0x08, 0x80, 0x01, 0x44, 0x00, 0x00, 0x41, 0x30,
-  0x42, 0x42, 0x20, 0x01, 0x00, 0x00, 0x10, 0x04, 0x00, 0x81, 0x12, 0x00,
-  0x81, 0x80, 0x01, 0x41, 0x30, 0x28, 0x8a, 0x84, 0x08, 0x44, 0x53, 0x05,
-  0x42, 0x21, 0xc4, 0x21, 0x84, 0x00, 0x20, 0x22, 0x02, 0x22, 0x80, 0x04,
-  0x22, 0x00, 0x84, 0x10, 0x84, 0x01, 0x4c, 0x04, 0x80, 0x82, 0x02, 0x30,
-  0x86, 0x81, 0x28, 0x18, 0x80, 0x44, 0x04, 0x20, 0x01, 0x18, 0x42, 0x40,
-  0x24, 0x08, 0x00, 0x41, 0xc0, 0x18, 0x18, 0x00, 0x2a, 0x24, 0xa4, 0x41,
-  0x46, 0xf4, 0xf8, 0xec, 0x10, 0x02, 0x80, 0x02, 0x20, 0x02, 0x42, 0x84,
-  0x88, 0x48, 0x85, 0x02, 0x81, 0x45, 0x08, 0x48, 0x44, 0x80, 0x02, 0x00,
-  0x00, 0x44, 0x60, 0x44, 0x20, 0x84, 0x44, 0x84, 0x04, 0x00, 0x00, 0xc1,
-  0x44, 0x42, 0x10, 0x4c, 0x98, 0x18, 0x00, 0x8c, 0xa4, 0x14, 0x12, 0x10,
-  0x04, 0x4f, 0x83, 0x84, 0x28, 0x08, 0x30, 0xf5, 0x80, 0x12, 0x02, 0x40,
-  0x08, 0x12, 0x22, 0x46, 0x08, 0x81, 0x84, 0x00, 0x00, 0x00, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x44, 0x00, 0x10, 0x14,
-  0x04, 0x00, 0x20, 0xa4, 0x14, 0x20, 0x84, 0x04, 0x18, 0x20, 0x04, 0x12,
-  0x00, 0x5f, 0x3e, 0x0e, 0x80, 0x14, 0x0e, 0x28, 0x30, 0x28, 0x00, 0x81,
-  0x00, 0x84, 0x68, 0x22, 0x20, 0x04, 0x81, 0x42, 0x00, 0x81, 0x80, 0x04,
-  0x81, 0x00, 0x00, 0x22, 0x00, 0x20, 0x02, 0x40, 0x24, 0x02, 0x00, 0x41,
-  0x12, 0x20, 0x01, 0x80, 0x01, 0x48, 0x42, 0x87, 0x41, 0x43, 0x11, 0x04,
-  0x81, 0xb0, 0x33, 0x02, 0x00, 0x20, 0x04, 0x28, 0x18, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x22, 0x22, 0x20, 0x02, 0x22, 0x20, 0x02, 0x22, 0x00,
-  0x41, 0x20, 0x04, 0x00, 0x10, 0x04, 0x00, 0x80, 0x84, 0x41, 0x04, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xd0, 0xc4, 0x05, 0x20, 0xd2, 0x22,
-  0x05, 0x00, 0x10, 0x08, 0x00, 0x00, 0x28, 0x26, 0x24, 0x86, 0x22, 0x02,
-  0x42, 0x44, 0x00, 0xc0, 0x24, 0x00, 0x00, 0x44, 0x00, 0x41, 0x44, 0x44,
-  0x00, 0x40, 0x08, 0x00, 0x41, 0x41, 0x84, 0x00, 0x22, 0x46, 0x08, 0x80,
-  0x62, 0x41, 0x41, 0x88, 0x44, 0x42, 0x28, 0xf0, 0x6b, 0x79, 0x20, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x48, 0x28, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x41, 0x12,
-  0x80, 0x01, 0x00, 0x80, 0x04, 0x20, 0x84, 0x81, 0x81, 0x08, 0x40, 0xd5,
-  0x58, 0x04, 0x20, 0x12, 0x48, 0x02, 0x22, 0x22, 0xb0, 0x28, 0x04, 0x43,
-  0x02, 0x10, 0x08, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x28, 0xc0, 0x64,
-  0x28, 0x10, 0x14, 0x04, 0x20, 0x04, 0x00, 0x80, 0x04, 0x20, 0x01, 0x43,
-  0x48, 0x04, 0x38, 0x18, 0xa0, 0x84, 0x84, 0x82, 0x00, 0x18, 0x00, 0x2f,
-  0x1d, 0x0d, 0x4c, 0x12, 0xc2, 0x42, 0x84, 0x4f, 0x81, 0x02, 0x41, 0x10,
-  0xe4, 0x82, 0x44, 0xc8, 0x48, 0x8c, 0x04, 0x00, 0x00, 0x48, 0x22, 0x84,
-  0x00, 0x28, 0x84, 0x22, 0x41, 0x10, 0x08, 0xc3, 0x02, 0x90, 0x28, 0x41,
-  0x00, 0x68, 0x00, 0x20, 0x42, 0x24, 0x02, 0x12, 0x22, 0x42, 0x40, 0xb4,
-  0x88, 0x05, 0x41, 0x90, 0x44, 0x16, 0x28, 0x28, 0x05, 0xae, 0x64, 0x00,
-  0x84, 0x80, 0x04, 0x40, 0x28, 0x02, 0x00, 0x40, 0x84, 0x02, 0x22, 0x00,
-  0x00, 0x28, 0x22, 0x00, 0x00, 0x4a, 0x02, 0x22, 0x41, 0x22, 0x41, 0x00,
-  0x84, 0x40, 0x48, 0x44, 0x04, 0x00, 0x12, 0x90, 0x44, 0x00, 0x28, 0x46,
-  0xe4, 0x48, 0x02, 0x00, 0x00, 0x00, 0x42, 0x50, 0xea, 0xc0, 0x18, 0x80,
-  0x44, 0x08, 0x84, 0x10, 0x08, 0x48, 0x22, 0x00, 0x28, 0x42, 0x60, 0x42,
-  0x40, 0x04, 0x00, 0x2d, 0x64, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01,
-  0x00, 0x80, 0x04, 0x40, 0x08, 0x84, 0x20, 0x08, 0xc4, 0x41, 0x1a, 0x02,
-  0x82, 0x12, 0x80, 0x02, 0x28, 0x30, 0x82, 0x48, 0xaf, 0xee, 0x0f, 0x18,
-  0x23, 0x28, 0x51, 0x22, 0x3e, 0x24, 0xc0, 0x28, 0x81, 0x46, 0xa8, 0x44,
-  0x26, 0x28, 0x24, 0x04, 0x62, 0x2a, 0x22, 0x82, 0x92, 0x48, 0x80, 0x24,
-  0x62, 0x46, 0x10, 0x04, 0x41, 0xc0, 0x28, 0x26, 0xe4, 0x44, 0x22, 0x12,
-  0x44, 0x44, 0x04, 0x00, 0x44, 0x00, 0x28, 0x43, 0x01, 0x8a, 0x84, 0x69,
-  0x81, 0x5e, 0x44, 0x8d, 0x54, 0x45, 0x34, 0x88, 0x18, 0x16, 0xf4, 0x1c,
-  0x94, 0x4c, 0xb4, 0x84, 0xa1, 0x81, 0x4e, 0xc1, 0x49, 0xf4, 0x7c, 0xf5,
-  0xc0, 0x22, 0x2e, 0x48, 0x81, 0x87, 0x84, 0x40, 0x48, 0x04, 0x89, 0x16,
-  0x88, 0x92, 0x28, 0x84, 0x81, 0x00, 0x00, 0x46, 0xa4, 0x46, 0x4d, 0x28,
-  0x90, 0x28, 0x22, 0x22, 0x22, 0x4a, 0x02, 0x10, 0x64, 0x82, 0x44, 0x48,
-  0x28, 0x20, 0x42, 0x08, 0x00, 0x42, 0x41, 0x84, 0x4f, 0x41, 0x33, 0x18,
-  0x41, 0x20, 0x32, 0x54, 0x58, 0x88, 0x4a, 0xa8, 0x44, 0xa0, 0x81, 0xcc,
-  0xaa, 0x14, 0x8b, 0x12, 0xf0, 0xbb, 0x11, 0x60, 0x42, 0x2c, 0x52, 0xa6,
-  0x48, 0x85, 0xa8, 0x22, 0x8b, 0x13, 0x2e, 0x28, 0x44, 0x8c, 0x32, 0x4c,
-  0x84, 0x87, 0x42, 0x4a, 0x94, 0x24, 0x42, 0x4c, 0x06, 0x22, 0x28, 0x22,
-  0x28, 0x80, 0x62, 0x84, 0x28, 0x83, 0x82, 0xb2, 0x24, 0x04, 0x41, 0x41,
-  0x44, 0x84, 0xc1, 0x48, 0x41, 0x4d, 0x24, 0xc3, 0x24, 0x52, 0x84, 0x44,
-  0x4e, 0x14, 0xd0, 0x44, 0x01, 0x68, 0x28, 0xa0, 0xa5, 0x4a, 0xa5, 0x42,
-  0xc9, 0x81, 0xb2, 0x44, 0x81, 0x04, 0x00, 0xcc, 0x0f, 0x16, 0x04, 0x16,
-  0x04, 0x16, 0x04, 0x44, 0x40, 0x04, 0x48, 0x22, 0x48, 0x90, 0x44, 0x10,
-  0x04, 0x45, 0x08, 0x4d, 0x48, 0xd0, 0x84, 0x04, 0x4d, 0x48, 0xd0, 0x84,
-  0x04, 0x8c, 0x04, 0x8c, 0x84, 0xc2, 0x48, 0x28, 0x48, 0x28, 0x80, 0x12,
-  0x88, 0x32, 0x48, 0x28, 0x83, 0x84, 0x32, 0x48, 0x1a, 0x12, 0x28, 0x11,
-  0x08, 0x81, 0xb2, 0x81, 0x2e, 0x48, 0x44, 0xb6, 0x08, 0xb6, 0x28, 0xe4,
-  0xb8, 0x49, 0xf2, 0x26, 0x34, 0x4f, 0x43, 0x51, 0xe8, 0x6f, 0x61, 0xf1,
-  0x96, 0x34, 0xcf, 0x41, 0xd2, 0x88, 0x71, 0x2c, 0xf4, 0x2c, 0x6c, 0xcf,
-  0xc6, 0x06, 0x2a, 0x22, 0x54, 0x44, 0x4f, 0x44, 0xf4, 0x24, 0x24, 0x4b,
-  0x22, 0x44, 0xc4, 0xcf, 0xc4, 0x74, 0x28, 0xf8, 0x48, 0x4c, 0x6e, 0x2c,
-  0xc7, 0xc4, 0x8f, 0x82, 0xf6, 0x6c, 0x4c, 0x47, 0xc6, 0x8f, 0x84, 0xd2,
-  0xcc, 0xf2, 0x68, 0x68, 0x6a, 0xf2, 0x4c, 0x2c, 0x8f, 0xc2, 0xf2, 0x64,
-  0x64, 0x4f, 0x46, 0xd6, 0x44, 0xf2, 0x24, 0x24, 0x8f, 0xc2, 0xf2, 0x28,
-  0x28, 0xcf, 0xc4, 0xf6, 0x6c, 0x64, 0x6e, 0x68, 0x2e, 0x2c, 0xcd, 0x4c,
-  0x4b, 0x63, 0x7e, 0xb8, 0x1e, 0x48, 0x8f, 0x85, 0xa4, 0xdc, 0x8f, 0x84,
-  0xf5, 0xe8, 0xa8, 0x8f, 0x82, 0xa6, 0x26, 0x1f, 0x8b, 0xd8, 0x89, 0xf2,
-  0x18, 0x38, 0x8f, 0x83, 0x62, 0x81, 0x8d, 0x68, 0x67, 0xfa, 0x24, 0x2b,
-  0x32, 0x3e, 0x78, 0x1e, 0x1c, 0x4d, 0x4c, 0xaa, 0xb2, 0x38, 0x73, 0x1c,
-  0x5c, 0xcc, 0x8d, 0x48, 0x8f, 0x86, 0x16, 0x04, 0xcf, 0xc4, 0x06, 0x28,
-  0x4f, 0x42, 0xb2, 0x24, 0xe2, 0x42, 0xe2, 0xc2, 0xf6, 0x4c, 0x4c, 0x4f,
+  0x00, 0x00, 0x42, 0xf2, 0x06, 0x40, 0x21, 0x28, 0x41, 0x42, 0x2e, 0x02,
+  0xf0, 0x18, 0x63, 0x82, 0x24, 0x02, 0x80, 0x04, 0x00, 0x12, 0x00, 0x00,
+  0x4c, 0x22, 0x21, 0x24, 0x01, 0xf0, 0x5a, 0xd2, 0x20, 0x08, 0x2d, 0x12,
+  0x12, 0x40, 0x08, 0x8c, 0x04, 0x00, 0x84, 0x25, 0x02, 0x00, 0x28, 0x80,
+  0x22, 0x02, 0x22, 0xa0, 0x42, 0x02, 0x00, 0xf0, 0x7b, 0x42, 0x61, 0x28,
+  0x48, 0x10, 0x04, 0x48, 0x00, 0x00, 0x30, 0x44, 0x12, 0x00, 0x4a, 0x81,
+  0x02, 0x48, 0x46, 0x04, 0x4e, 0x14, 0x12, 0x42, 0x41, 0x00, 0x44, 0x14,
+  0x15, 0x09, 0x6d, 0x42, 0x1f, 0x41, 0x52, 0x2c, 0x1f, 0x41, 0x32, 0x4e,
+  0x1f, 0xc1, 0x32, 0x4e, 0x1d, 0x64, 0xeb, 0x14, 0x1d, 0x2c, 0xab, 0x94,
+  0x19, 0xb2, 0x4a, 0x19, 0xf5, 0x4a, 0x94, 0x4b, 0x42, 0xaf, 0x54, 0x39,
+  0x24, 0xaf, 0x54, 0x79, 0x24, 0xd8, 0x5a, 0xf9, 0x24, 0x48, 0x8d, 0x95,
+  0x4f, 0xa2, 0xd4, 0x58, 0xf8, 0x24, 0x4a, 0x87, 0x51, 0x6f, 0xa2, 0x74,
+  0x98, 0xf5, 0x24, 0x4a, 0x8f, 0x59, 0xd2, 0xa4, 0xf4, 0x98, 0x24, 0xac,
+  0xf4, 0x91, 0x24, 0x4d, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f, 0xc9, 0x32,
+  0x4c, 0x1f, 0xc9, 0x32, 0x4e, 0x1f, 0xc8, 0xb2, 0x4a, 0xd1, 0xc1, 0xb2,
+  0x4a, 0xd9, 0x81, 0xb2, 0x4a, 0x79, 0x85, 0xb8, 0x4a, 0x79, 0x24, 0xb8,
+  0x4a, 0x79, 0xb4, 0x08, 0x00, 0xf2, 0x61, 0x98, 0x9a, 0x4f, 0x8b, 0x94,
+  0x98, 0x4f, 0xa2, 0xb4, 0xcc, 0x0c, 0x24, 0x1f, 0x81, 0x16, 0xb8, 0x11,
+  0x06, 0x13, 0x31, 0x4a, 0x19, 0xb2, 0x22, 0x11, 0xf1, 0x4a, 0x94, 0x19,
+  0xf2, 0x6a, 0x94, 0x11, 0xab, 0xb4, 0x22, 0x8d, 0x91, 0x22, 0x2f, 0x14,
+  0x29, 0xc2, 0x91, 0x2b, 0x42, 0x1c, 0xf9, 0x22, 0x12, 0x1c, 0xa9, 0x82,
+  0x1e, 0x81, 0x26, 0x62, 0x19, 0x2a, 0xe4, 0x59, 0x42, 0xe3, 0x59, 0xc2,
+  0x42, 0x1f, 0xc9, 0x02, 0x1f, 0x89, 0x46, 0xf2, 0x91, 0x64, 0x42, 0x1b,
+  0x29, 0x21, 0x1b, 0x28, 0x2b, 0x14, 0x1d, 0x24, 0x2d, 0x14, 0x19, 0xf2,
+  0x42, 0xb4, 0x59, 0x92, 0x92, 0x43, 0x92, 0x12, 0x43, 0x92, 0x82, 0x43,
+  0x92, 0x12, 0x6b, 0x42, 0x2b, 0x84, 0x4f, 0x22, 0xf1, 0xcb, 0x3d, 0x29,
+  0x08, 0x12, 0x44, 0x07, 0x00, 0xa0, 0x18, 0x80, 0x08, 0x00, 0x00, 0x14,
+  0x00, 0x84, 0x80, 0x04, 0x0e, 0x00, 0x21, 0xa0, 0x28, 0x52, 0x01, 0xf0,
+  0xcc, 0xf0, 0xa3, 0xc2, 0x00, 0x40, 0x08, 0x81, 0x40, 0x48, 0x18, 0x08,
+  0x81, 0x00, 0x10, 0x08, 0xa9, 0x04, 0x41, 0x00, 0x20, 0x04, 0x10, 0x04,
+  0x24, 0x42, 0x82, 0x49, 0x04, 0x80, 0x08, 0x00, 0x82, 0x00, 0x10, 0x98,
+  0x1a, 0x83, 0x01, 0x18, 0x80, 0x48, 0x64, 0x84, 0x41, 0x58, 0x00, 0x41,
+  0x00, 0x10, 0xb4, 0x92, 0x0d, 0xa0, 0x18, 0x12, 0x18, 0x80, 0x01, 0xa0,
+  0x42, 0x00, 0x42, 0x00, 0x48, 0x43, 0x08, 0xa8, 0x23, 0x02, 0x20, 0x24,
+  0xa2, 0x82, 0x48, 0x42, 0x80, 0x03, 0x43, 0x84, 0x22, 0x35, 0x24, 0x24,
+  0x22, 0x48, 0x22, 0x40, 0x84, 0x22, 0x82, 0x24, 0x62, 0x48, 0x43, 0x82,
+  0x24, 0x03, 0x00, 0x88, 0x82, 0x49, 0xa2, 0x58, 0x20, 0x8c, 0x72, 0xa8,
+  0x01, 0xef, 0xd5, 0x0a, 0xa0, 0x14, 0x81, 0x18, 0x80, 0x11, 0x18, 0x98,
+  0x48, 0x10, 0x04, 0x22, 0x90, 0x48, 0x82, 0xa9, 0x24, 0xd2, 0x42, 0x02,
+  0x24, 0x42, 0x28, 0x1a, 0x22, 0x64, 0x4c, 0xa0, 0x21, 0x60, 0x4c, 0x43,
+  0x36, 0x41, 0x43, 0xc2, 0x82, 0x83, 0x82, 0x24, 0x24, 0x48, 0x04, 0x22,
+  0x8c, 0x34, 0x22, 0x85, 0x34, 0x24, 0x49, 0x24, 0x22, 0x42, 0x24, 0x64,
+  0x48, 0x58, 0x49, 0xa2, 0x1c, 0x41, 0x86, 0x82, 0x62, 0x88, 0x43, 0xf1,
+  0x2a, 0xd9, 0x00, 0x80, 0x01, 0x81, 0x00, 0x20, 0x02, 0x81, 0x48, 0x00,
+  0x10, 0x04, 0x82, 0x00, 0x00, 0x42, 0x82, 0x00, 0x40, 0x22, 0x04, 0x80,
+  0x01, 0x00, 0x80, 0x02, 0x20, 0x02, 0x60, 0x81, 0x98, 0x80, 0x21, 0x81,
+  0x08, 0x81, 0x80, 0x08, 0x15, 0x06, 0xc0, 0xaf, 0xe1, 0x0e, 0x24, 0x00,
+  0x00, 0x44, 0x80, 0x24, 0x82, 0x32, 0x48, 0x5b, 0x06, 0xf0, 0xff, 0x18,
+  0x4c, 0x13, 0x24, 0x44, 0xa8, 0x24, 0x22, 0x40, 0x08, 0x20, 0x18, 0xa4,
+  0x25, 0x00, 0x24, 0x4c, 0x02, 0x44, 0x40, 0x04, 0x10, 0xc8, 0x44, 0x00,
+  0x20, 0x01, 0x82, 0x10, 0x44, 0xa4, 0x42, 0x20, 0x02, 0x43, 0x0a, 0xf0,
+  0x4e, 0x76, 0x24, 0x42, 0x30, 0x32, 0x6d, 0x12, 0x45, 0x08, 0x18, 0xc1,
+  0x46, 0xc8, 0x48, 0x00, 0x18, 0x44, 0x88, 0x89, 0x14, 0x08, 0x11, 0x81,
+  0x28, 0x00, 0x42, 0x48, 0xa0, 0x41, 0x42, 0x3a, 0x24, 0x04, 0x87, 0x44,
+  0x44, 0x44, 0x30, 0x44, 0x21, 0x4c, 0x28, 0xc1, 0x48, 0x43, 0x81, 0x94,
+  0x18, 0x41, 0x96, 0x88, 0x24, 0x04, 0x18, 0x8a, 0x31, 0x51, 0x48, 0x88,
+  0x9e, 0x44, 0x87, 0x44, 0x4b, 0x1a, 0x83, 0x84, 0xd2, 0x48, 0xf2, 0x48,
+  0x79, 0x24, 0x10, 0xe2, 0x21, 0x82, 0x51, 0x48, 0x00, 0x87, 0x44, 0x83,
+  0x14, 0x18, 0x08, 0x18, 0x41, 0x42, 0x84, 0x81, 0x20, 0x12, 0x88, 0x04,
+  0x48, 0x68, 0x48, 0xa0, 0x41, 0x20, 0x82, 0x84, 0x65, 0x44, 0x40, 0x04,
+  0x6c, 0x44, 0x14, 0x44, 0x04, 0x30, 0x48, 0x8f, 0x44, 0x41, 0x04, 0x42,
+  0x42, 0x80, 0x28, 0xe9, 0x44, 0x21, 0x24, 0x24, 0x35, 0x68, 0x18, 0x43,
+  0x04, 0x84, 0xfe, 0x59, 0x20, 0x04, 0x21, 0x44, 0x21, 0x44, 0x12, 0x80,
+  0x22, 0x26, 0x04, 0x00, 0x82, 0x42, 0x00, 0x17, 0x41, 0x44, 0x22, 0x84,
+  0x22, 0x00, 0x84, 0x80, 0xa4, 0x94, 0x41, 0x22, 0x84, 0x41, 0xd0, 0x42,
+  0x02, 0x80, 0x28, 0x91, 0x48, 0x16, 0x04, 0x00, 0x96, 0x08, 0x12, 0x20,
+  0x01, 0x14, 0x44, 0xa8, 0x49, 0x18, 0x94, 0xa4, 0x2e, 0x88, 0x28, 0x43,
+  0xe2, 0xa5, 0x05, 0x30, 0x42, 0x41, 0x40, 0x08, 0x28, 0x20, 0x32, 0x28,
+  0x20, 0x24, 0x82, 0x44, 0x58, 0x48, 0x00, 0x41, 0x30, 0x24, 0x00, 0x42,
+  0x00, 0x20, 0x22, 0x04, 0x00, 0x49, 0x02, 0x00, 0x00, 0xc0, 0x18, 0x20,
+  0x24, 0x04, 0x40, 0x08, 0x00, 0x48, 0xc0, 0x18, 0x18, 0x20, 0x04, 0x42,
+  0x1a, 0x84, 0xf4, 0x6e, 0x34, 0x24, 0x48, 0x42, 0x81, 0x22, 0x00, 0x00,
+  0x00, 0x49, 0x08, 0x26, 0x18, 0x02, 0x09, 0x00, 0xf1, 0x18, 0x00, 0x00,
+  0x43, 0x02, 0x00, 0x43, 0x18, 0x08, 0x42, 0x81, 0x48, 0x46, 0x04, 0x40,
+  0x04, 0x18, 0x10, 0x4c, 0x34, 0x84, 0x20, 0x22, 0x34, 0x14, 0x00, 0x00,
+  0x4c, 0x21, 0x02, 0x20, 0xf1, 0x52, 0x9b, 0x00, 0x00, 0x21, 0x00, 0x00,
+  0x48, 0x12, 0x08, 0xf0, 0x48, 0x44, 0x08, 0x80, 0x01, 0x44, 0x00, 0x00,
+  0x41, 0x30, 0x42, 0x42, 0x20, 0x01, 0x00, 0x00, 0x10, 0x04, 0x00, 0x81,
+  0x12, 0x00, 0x81, 0x80, 0x01, 0x41, 0x30, 0x28, 0x8a, 0x84, 0x08, 0x44,
+  0x53, 0x05, 0x42, 0x21, 0xc4, 0x21, 0x84, 0x00, 0x20, 0x22, 0x02, 0x22,
+  0x80, 0x04, 0x22, 0x00, 0x84, 0x10, 0x84, 0x01, 0x4c, 0x04, 0x80, 0x82,
+  0x02, 0x30, 0x86, 0x81, 0x28, 0x18, 0x80, 0x44, 0x04, 0x20, 0x01, 0x18,
+  0x42, 0x40, 0x24, 0x08, 0x00, 0x41, 0xc0, 0x18, 0x18, 0x00, 0x2a, 0x24,
+  0xa4, 0x41, 0x46, 0xf4, 0xf8, 0xec, 0x10, 0x02, 0xcf, 0x01, 0xf0, 0x29,
+  0x42, 0x84, 0x88, 0x48, 0x85, 0x02, 0x81, 0x45, 0x08, 0x48, 0x44, 0x80,
+  0x02, 0x00, 0x00, 0x44, 0x60, 0x44, 0x20, 0x84, 0x44, 0x84, 0x04, 0x00,
+  0x00, 0xc1, 0x44, 0x42, 0x10, 0x4c, 0x98, 0x18, 0x00, 0x8c, 0xa4, 0x14,
+  0x12, 0x10, 0x04, 0x4f, 0x83, 0x84, 0x28, 0x08, 0x30, 0xf5, 0x80, 0x12,
+  0x02, 0x40, 0x08, 0x12, 0x22, 0x46, 0x08, 0x81, 0x34, 0x04, 0x00, 0x62,
+  0x08, 0x00, 0x4d, 0x08, 0x00, 0x02, 0x03, 0xf0, 0x18, 0x10, 0x14, 0x04,
+  0x00, 0x20, 0xa4, 0x14, 0x20, 0x84, 0x04, 0x18, 0x20, 0x04, 0x12, 0x00,
+  0x5f, 0x3e, 0x0e, 0x80, 0x14, 0x0e, 0x28, 0x30, 0x28, 0x00, 0x81, 0x00,
+  0x84, 0x68, 0x22, 0x20, 0x04, 0x81, 0x42, 0x00, 0x81, 0x80, 0x04, 0x81,
+  0xe4, 0x07, 0xf0, 0x07, 0x20, 0x02, 0x40, 0x24, 0x02, 0x00, 0x41, 0x12,
+  0x20, 0x01, 0x80, 0x01, 0x48, 0x42, 0x87, 0x41, 0x43, 0x11, 0x04, 0x81,
+  0xb0, 0x33, 0x9a, 0x08, 0x22, 0x28, 0x18, 0x56, 0x00, 0x00, 0x05, 0x08,
+  0x00, 0x03, 0x00, 0x40, 0x00, 0x41, 0x20, 0x04, 0xee, 0x00, 0x41, 0x80,
+  0x84, 0x41, 0x04, 0x66, 0x03, 0x90, 0xc8, 0x00, 0xd0, 0xc4, 0x05, 0x20,
+  0xd2, 0x22, 0x05, 0x5a, 0x09, 0xb0, 0x00, 0x28, 0x26, 0x24, 0x86, 0x22,
+  0x02, 0x42, 0x44, 0x00, 0xc0, 0x84, 0x02, 0xf0, 0x0d, 0x00, 0x41, 0x44,
+  0x44, 0x00, 0x40, 0x08, 0x00, 0x41, 0x41, 0x84, 0x00, 0x22, 0x46, 0x08,
+  0x80, 0x62, 0x41, 0x41, 0x88, 0x44, 0x42, 0x28, 0xf0, 0x6b, 0x79, 0x20,
+  0x08, 0xa8, 0x00, 0x21, 0x48, 0x28, 0x77, 0x01, 0x22, 0x20, 0x02, 0xae,
+  0x03, 0x50, 0x00, 0x42, 0x00, 0x41, 0x12, 0xd4, 0x02, 0xf0, 0x06, 0x04,
+  0x20, 0x84, 0x81, 0x81, 0x08, 0x40, 0xd5, 0x58, 0x04, 0x20, 0x12, 0x48,
+  0x02, 0x22, 0x22, 0xb0, 0x28, 0x04, 0x43, 0x02, 0x5f, 0x00, 0xd0, 0x80,
+  0x06, 0x00, 0x00, 0x28, 0xc0, 0x64, 0x28, 0x10, 0x14, 0x04, 0x20, 0x04,
+  0x28, 0x00, 0xf0, 0x3a, 0x01, 0x43, 0x48, 0x04, 0x38, 0x18, 0xa0, 0x84,
+  0x84, 0x82, 0x00, 0x18, 0x00, 0x2f, 0x1d, 0x0d, 0x4c, 0x12, 0xc2, 0x42,
+  0x84, 0x4f, 0x81, 0x02, 0x41, 0x10, 0xe4, 0x82, 0x44, 0xc8, 0x48, 0x8c,
+  0x04, 0x00, 0x00, 0x48, 0x22, 0x84, 0x00, 0x28, 0x84, 0x22, 0x41, 0x10,
+  0x08, 0xc3, 0x02, 0x90, 0x28, 0x41, 0x00, 0x68, 0x00, 0x20, 0x42, 0x24,
+  0x02, 0x12, 0x22, 0x42, 0x40, 0xb4, 0x88, 0x05, 0x41, 0x90, 0x44, 0x16,
+  0x28, 0x28, 0x05, 0xae, 0x64, 0x24, 0x04, 0x60, 0x40, 0x28, 0x02, 0x00,
+  0x40, 0x84, 0x0b, 0x02, 0x00, 0x98, 0x00, 0xf0, 0x06, 0x4a, 0x02, 0x22,
+  0x41, 0x22, 0x41, 0x00, 0x84, 0x40, 0x48, 0x44, 0x04, 0x00, 0x12, 0x90,
+  0x44, 0x00, 0x28, 0x46, 0xe4, 0x48, 0xaa, 0x00, 0xf0, 0x0e, 0x42, 0x50,
+  0xea, 0xc0, 0x18, 0x80, 0x44, 0x08, 0x84, 0x10, 0x08, 0x48, 0x22, 0x00,
+  0x28, 0x42, 0x60, 0x42, 0x40, 0x04, 0x00, 0x2d, 0x64, 0x80, 0x01, 0x88,
+  0x00, 0x00, 0x40, 0xbe, 0x00, 0xf0, 0x2c, 0x40, 0x08, 0x84, 0x20, 0x08,
+  0xc4, 0x41, 0x1a, 0x02, 0x82, 0x12, 0x80, 0x02, 0x28, 0x30, 0x82, 0x48,
+  0xaf, 0xee, 0x0f, 0x18, 0x23, 0x28, 0x51, 0x22, 0x3e, 0x24, 0xc0, 0x28,
+  0x81, 0x46, 0xa8, 0x44, 0x26, 0x28, 0x24, 0x04, 0x62, 0x2a, 0x22, 0x82,
+  0x92, 0x48, 0x80, 0x24, 0x62, 0x46, 0x10, 0x04, 0x41, 0xc0, 0x28, 0x26,
+  0xe4, 0x44, 0x22, 0x12, 0x44, 0x44, 0x54, 0x01, 0xf0, 0x9e, 0x28, 0x43,
+  0x01, 0x8a, 0x84, 0x69, 0x81, 0x5e, 0x44, 0x8d, 0x54, 0x45, 0x34, 0x88,
+  0x18, 0x16, 0xf4, 0x1c, 0x94, 0x4c, 0xb4, 0x84, 0xa1, 0x81, 0x4e, 0xc1,
+  0x49, 0xf4, 0x7c, 0xf5, 0xc0, 0x22, 0x2e, 0x48, 0x81, 0x87, 0x84, 0x40,
+  0x48, 0x04, 0x89, 0x16, 0x88, 0x92, 0x28, 0x84, 0x81, 0x00, 0x00, 0x46,
+  0xa4, 0x46, 0x4d, 0x28, 0x90, 0x28, 0x22, 0x22, 0x22, 0x4a, 0x02, 0x10,
+  0x64, 0x82, 0x44, 0x48, 0x28, 0x20, 0x42, 0x08, 0x00, 0x42, 0x41, 0x84,
+  0x4f, 0x41, 0x33, 0x18, 0x41, 0x20, 0x32, 0x54, 0x58, 0x88, 0x4a, 0xa8,
+  0x44, 0xa0, 0x81, 0xcc, 0xaa, 0x14, 0x8b, 0x12, 0xf0, 0xbb, 0x11, 0x60,
+  0x42, 0x2c, 0x52, 0xa6, 0x48, 0x85, 0xa8, 0x22, 0x8b, 0x13, 0x2e, 0x28,
+  0x44, 0x8c, 0x32, 0x4c, 0x84, 0x87, 0x42, 0x4a, 0x94, 0x24, 0x42, 0x4c,
+  0x06, 0x22, 0x28, 0x22, 0x28, 0x80, 0x62, 0x84, 0x28, 0x83, 0x82, 0xb2,
+  0x24, 0x04, 0x41, 0x41, 0x44, 0x84, 0xc1, 0x48, 0x41, 0x4d, 0x24, 0xc3,
+  0x24, 0x52, 0x84, 0x44, 0x4e, 0x14, 0xd0, 0x44, 0x01, 0x68, 0x28, 0xa0,
+  0xa5, 0x4a, 0xa5, 0x42, 0xc9, 0x81, 0xb2, 0x44, 0x81, 0x04, 0x00, 0xcc,
+  0x0f, 0x16, 0x04, 0x02, 0x00, 0x80, 0x44, 0x40, 0x04, 0x48, 0x22, 0x48,
+  0x90, 0x44, 0xd4, 0x08, 0x51, 0x4d, 0x48, 0xd0, 0x84, 0x04, 0x05, 0x00,
+  0xf0, 0x5b, 0x8c, 0x04, 0x8c, 0x84, 0xc2, 0x48, 0x28, 0x48, 0x28, 0x80,
+  0x12, 0x88, 0x32, 0x48, 0x28, 0x83, 0x84, 0x32, 0x48, 0x1a, 0x12, 0x28,
+  0x11, 0x08, 0x81, 0xb2, 0x81, 0x2e, 0x48, 0x44, 0xb6, 0x08, 0xb6, 0x28,
+  0xe4, 0xb8, 0x49, 0xf2, 0x26, 0x34, 0x4f, 0x43, 0x51, 0xe8, 0x6f, 0x61,
+  0xf1, 0x96, 0x34, 0xcf, 0x41, 0xd2, 0x88, 0x71, 0x2c, 0xf4, 0x2c, 0x6c,
+  0xcf, 0xc6, 0x06, 0x2a, 0x22, 0x54, 0x44, 0x4f, 0x44, 0xf4, 0x24, 0x24,
+  0x4b, 0x22, 0x44, 0xc4, 0xcf, 0xc4, 0x74, 0x28, 0xf8, 0x48, 0x4c, 0x6e,
+  0x2c, 0xc7, 0xc4, 0x8f, 0x82, 0xf6, 0x6c, 0x4c, 0x47, 0xc6, 0x8f, 0x84,
+  0xd2, 0xcc, 0xf2, 0x68, 0x68, 0x6a, 0xf2, 0x4c, 0x2c, 0x8f, 0xc2, 0xf2,
+  0x87, 0x09, 0xf1, 0x48, 0xd6, 0x44, 0xf2, 0x24, 0x24, 0x8f, 0xc2, 0xf2,
+  0x28, 0x28, 0xcf, 0xc4, 0xf6, 0x6c, 0x64, 0x6e, 0x68, 0x2e, 0x2c, 0xcd,
+  0x4c, 0x4b, 0x63, 0x7e, 0xb8, 0x1e, 0x48, 0x8f, 0x85, 0xa4, 0xdc, 0x8f,
+  0x84, 0xf5, 0xe8, 0xa8, 0x8f, 0x82, 0xa6, 0x26, 0x1f, 0x8b, 0xd8, 0x89,
+  0xf2, 0x18, 0x38, 0x8f, 0x83, 0x62, 0x81, 0x8d, 0x68, 0x67, 0xfa, 0x24,
+  0x2b, 0x32, 0x3e, 0x78, 0x1e, 0x1c, 0x4d, 0x4c, 0xaa, 0xb2, 0x38, 0x73,
+  0x1c, 0x5c, 0xcc, 0x8d, 0x48, 0x8f, 0x86, 0x16, 0x04, 0xcf, 0xc4, 0x06,
+  0x28, 0x4f, 0x42, 0xb2, 0x24, 0xe2, 0x42, 0xb1, 0x08, 0xf0, 0x20, 0x4f,
   0x66, 0xf6, 0x62, 0x44, 0x6e, 0x2c, 0xef, 0xc5, 0xd1, 0x44, 0xa4, 0xfe,
   0x6e, 0x28, 0xcf, 0xc6, 0xaa, 0x66, 0x6a, 0xf6, 0x48, 0x28, 0xdf, 0xd4,
   0xf2, 0x6c, 0x68, 0x4e, 0x41, 0xcf, 0x44, 0xd4, 0x44, 0xf2, 0x6c, 0x6c,
-  0xc0, 0x44, 0xcd, 0x2c, 0xcf, 0x42, 0xe2, 0xc4, 0xe4, 0x84, 0xf4, 0x2c,
-  0x6c, 0xcf, 0xc2, 0xf6, 0x74, 0xbc, 0x1e, 0x48, 0x8f, 0x87, 0xf4, 0xdc,
+  0xc0, 0x44, 0xcd, 0x2c, 0xcf, 0x42, 0xe2, 0xc4, 0xe4, 0x84, 0xc2, 0x00,
+  0xf0, 0xfd, 0xc2, 0xf6, 0x74, 0xbc, 0x1e, 0x48, 0x8f, 0x87, 0xf4, 0xdc,
   0xd8, 0x7e, 0x54, 0x8a, 0xfc, 0xd8, 0xd8, 0x8f, 0x86, 0xf6, 0xf4, 0x99,
   0x8f, 0x8d, 0xea, 0x29, 0xbb, 0xb2, 0xeb, 0x93, 0xf6, 0x1a, 0x78, 0x4f,
   0xff, 0x4a, 0xb2, 0x32, 0xa2, 0x62, 0x4f, 0x21, 0x51, 0xca, 0x28, 0x8f,
@@ -5584,461 +4525,350 @@ const unsigned char USB_1208HS_rbf[] = {
   0x16, 0xd8, 0x8c, 0xb1, 0x64, 0xe3, 0x45, 0xb9, 0x38, 0xf7, 0x58, 0x78,
   0xca, 0xac, 0x51, 0x8f, 0x8d, 0xfd, 0xb8, 0xf8, 0x7a, 0xb1, 0xd8, 0xff,
   0x51, 0x58, 0x8f, 0x8b, 0xb9, 0xb2, 0xfb, 0xd8, 0xd3, 0x4e, 0x58, 0x2f,
-  0xc1, 0x02, 0x00, 0x40, 0x38, 0x22, 0x20, 0x42, 0x08, 0x00, 0x84, 0x00,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0x02, 0x28, 0x20, 0x14, 0x04, 0x00,
-  0x41, 0x42, 0x00, 0x41, 0x00, 0x10, 0x24, 0x01, 0x00, 0x00, 0x12, 0x44,
-  0x00, 0x1a, 0x04, 0x82, 0x00, 0x00, 0xdf, 0xe1, 0x06, 0x26, 0x02, 0x00,
-  0x81, 0x00, 0x30, 0x48, 0x00, 0x10, 0x08, 0x00, 0x28, 0x22, 0x80, 0x04,
-  0x48, 0x42, 0x80, 0x82, 0x04, 0x48, 0x80, 0x04, 0x48, 0x46, 0x04, 0x00,
-  0x00, 0x00, 0x48, 0x42, 0x12, 0xe0, 0x48, 0x24, 0x04, 0x4a, 0x01, 0x80,
-  0x04, 0x60, 0x44, 0x40, 0x84, 0x04, 0xf0, 0x95, 0x2b, 0xd0, 0x24, 0xf5,
-  0x11, 0x24, 0xcd, 0x12, 0x1f, 0x41, 0xb2, 0x4c, 0xf1, 0x11, 0x24, 0xeb,
-  0x14, 0x1d, 0x24, 0xeb, 0x14, 0x1d, 0x24, 0xab, 0x94, 0x19, 0xb2, 0x4a,
-  0x19, 0xf5, 0x4a, 0x94, 0x43, 0xf2, 0x4a, 0x95, 0x4b, 0x42, 0xaf, 0x54,
-  0x79, 0x24, 0xd8, 0x5a, 0xf9, 0x24, 0x48, 0x8d, 0xb5, 0x4f, 0xa2, 0xd4,
-  0x58, 0xf8, 0x24, 0x4a, 0x87, 0x51, 0x4f, 0xa2, 0x74, 0x98, 0xe5, 0xa2,
-  0x74, 0x98, 0xe5, 0xa2, 0xf4, 0x98, 0x24, 0x2e, 0x4a, 0x1f, 0x49, 0xe2,
-  0x22, 0xf4, 0x91, 0x24, 0x87, 0x22, 0x1f, 0xc9, 0x32, 0x68, 0x1f, 0xc9,
-  0x32, 0x6a, 0x1f, 0xc8, 0xb2, 0x6a, 0xd1, 0xc1, 0xb2, 0x6a, 0xf9, 0x11,
-  0x28, 0xab, 0x94, 0x55, 0xb8, 0x4a, 0x79, 0x24, 0xb8, 0x4a, 0x7b, 0x24,
-  0xb8, 0x4a, 0x7b, 0xa4, 0xd8, 0x4a, 0xfb, 0x24, 0x48, 0x89, 0xfb, 0x24,
-  0x4a, 0xce, 0xf7, 0xc0, 0x42, 0x1f, 0x84, 0x52, 0x28, 0x19, 0x36, 0x48,
-  0x19, 0x32, 0x4a, 0x19, 0xb2, 0x6a, 0x11, 0xf1, 0x2a, 0x94, 0x19, 0xf4,
-  0x2a, 0x94, 0x19, 0x92, 0x9a, 0x22, 0xaf, 0x14, 0x29, 0xf2, 0x42, 0x91,
-  0x22, 0x2d, 0x91, 0x29, 0xd4, 0x12, 0xeb, 0x22, 0xc5, 0x91, 0x2e, 0xc2,
-  0x1e, 0x81, 0x2e, 0x42, 0x9e, 0x21, 0x2e, 0x42, 0x9e, 0x25, 0x3c, 0x64,
-  0x59, 0x2c, 0x74, 0x91, 0xcc, 0x42, 0x1f, 0x89, 0x44, 0xf2, 0x91, 0x44,
-  0x42, 0x13, 0x39, 0x42, 0x17, 0x48, 0x2b, 0x14, 0x15, 0xf4, 0x42, 0x84,
-  0x11, 0x2f, 0x44, 0x1a, 0xb5, 0x42, 0x12, 0x34, 0x42, 0x41, 0x29, 0x01,
-  0x29, 0x98, 0x46, 0x23, 0xc4, 0x12, 0x2f, 0x44, 0x0f, 0x20, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x18,
-  0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x84, 0x80, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x12, 0x01, 0x00, 0x80, 0x02, 0x50, 0x12, 0xf0, 0xa1, 0x2a,
-  0x40, 0x02, 0x28, 0x00, 0x80, 0x01, 0x00, 0x80, 0x08, 0x10, 0x01, 0x20,
-  0x84, 0x04, 0x20, 0x84, 0x04, 0x00, 0x00, 0x80, 0x24, 0x24, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x40, 0x04, 0x82, 0x12, 0x00, 0x92, 0x88, 0x80, 0x1d,
-  0x04, 0x20, 0x08, 0x20, 0xf4, 0xe6, 0xdc, 0x00, 0x8a, 0x82, 0x08, 0x80,
-  0x22, 0x02, 0x81, 0x88, 0x42, 0x00, 0x00, 0x42, 0xa8, 0x88, 0x80, 0x0e,
-  0x00, 0x82, 0x20, 0x04, 0x62, 0x20, 0x08, 0x82, 0x00, 0x00, 0x20, 0x08,
-  0x48, 0x00, 0x12, 0x12, 0x00, 0x00, 0x00, 0x49, 0x04, 0x40, 0x81, 0x04,
-  0x4c, 0x48, 0x01, 0xff, 0x24, 0x03, 0xb0, 0xc2, 0xa2, 0x28, 0x00, 0x28,
-  0x38, 0x10, 0x28, 0x38, 0x44, 0x00, 0x80, 0x02, 0x2a, 0x88, 0x0c, 0x4a,
-  0x4a, 0x02, 0x48, 0x1a, 0x08, 0x8a, 0x04, 0x68, 0x80, 0x04, 0x13, 0x08,
-  0x10, 0x08, 0x42, 0x82, 0x80, 0x04, 0x00, 0x80, 0x18, 0x04, 0x22, 0x20,
-  0x38, 0x44, 0x9a, 0x04, 0x20, 0x44, 0x82, 0x48, 0x21, 0xd1, 0xdc, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x40, 0x81, 0x04, 0x20, 0x04,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x88, 0x42, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x16, 0x84, 0x01, 0x18, 0x00, 0x92, 0x00, 0x10, 0x44, 0x01, 0x88,
-  0x41, 0x80, 0xf4, 0x7c, 0xf3, 0x00, 0x4c, 0x02, 0x16, 0x04, 0x00, 0x00,
-  0x20, 0x04, 0x10, 0x04, 0x00, 0x80, 0x08, 0x42, 0x00, 0x84, 0x00, 0x40,
-  0x08, 0x24, 0x44, 0x00, 0x00, 0xa0, 0x21, 0x20, 0x01, 0x20, 0x04, 0x42,
-  0x20, 0x04, 0x18, 0x20, 0x04, 0x20, 0x02, 0x00, 0x41, 0x42, 0xf0, 0x9c,
-  0x23, 0x00, 0x00, 0x22, 0x00, 0x28, 0x81, 0x10, 0x24, 0x08, 0x12, 0x10,
-  0x82, 0x82, 0x05, 0x00, 0x28, 0x81, 0x4a, 0x28, 0x04, 0x80, 0x84, 0x22,
-  0x0c, 0x62, 0xa0, 0x48, 0x81, 0x44, 0x00, 0x00, 0x00, 0x00, 0x12, 0x42,
-  0x12, 0x00, 0x00, 0x42, 0x48, 0x44, 0x10, 0x84, 0x21, 0x04, 0x81, 0x4e,
-  0xb2, 0x00, 0x26, 0x04, 0x4c, 0x01, 0x00, 0x00, 0x44, 0x48, 0x00, 0x44,
-  0x20, 0x02, 0x00, 0xa0, 0x42, 0x84, 0x8a, 0xc4, 0x48, 0x00, 0x60, 0x82,
-  0x82, 0xb0, 0x26, 0x04, 0x8a, 0x44, 0x08, 0x80, 0x01, 0x00, 0x20, 0x04,
-  0x52, 0xa0, 0x14, 0x80, 0x01, 0x42, 0x00, 0x26, 0x04, 0x80, 0x61, 0x44,
-  0x48, 0x84, 0x5f, 0x62, 0x02, 0x00, 0x80, 0x02, 0x20, 0x42, 0x08, 0x80,
-  0x08, 0x12, 0x24, 0x00, 0x1a, 0x04, 0x82, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x48, 0x00, 0x00, 0x40, 0x04, 0x22, 0x80, 0x01, 0x00, 0x00, 0x42, 0x00,
-  0x00, 0x80, 0x24, 0x04, 0x40, 0x04, 0x00, 0xf0, 0xeb, 0xd8, 0x00, 0x22,
-  0x00, 0x20, 0x14, 0x04, 0x44, 0x80, 0x02, 0x22, 0x00, 0x00, 0x42, 0x42,
-  0x20, 0x04, 0x00, 0x00, 0x20, 0x04, 0x40, 0x84, 0x04, 0x28, 0x80, 0x24,
-  0x14, 0x04, 0x20, 0x01, 0x00, 0x88, 0x82, 0x00, 0x80, 0x04, 0x48, 0x00,
-  0x42, 0x20, 0x02, 0x52, 0x7b, 0x69, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80,
-  0x82, 0x88, 0x22, 0x22, 0x08, 0x00, 0x80, 0x0a, 0x41, 0x00, 0xca, 0x02,
-  0x10, 0x04, 0x44, 0x00, 0x00, 0x00, 0x20, 0x04, 0x80, 0x04, 0x18, 0xa0,
-  0x81, 0x81, 0x80, 0x01, 0x42, 0x00, 0x84, 0x00, 0x00, 0x44, 0x58, 0x12,
-  0xef, 0xbe, 0x05, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x04, 0x10, 0x08,
-  0x82, 0x00, 0x41, 0x00, 0x00, 0x41, 0x00, 0x22, 0x28, 0x80, 0x82, 0x08,
-  0x00, 0x90, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x88, 0x48,
-  0x00, 0x1a, 0x44, 0x04, 0x00, 0xf0, 0x2a, 0x38, 0x00, 0x22, 0x00, 0x00,
-  0x20, 0x02, 0x28, 0x42, 0x22, 0x10, 0x08, 0x88, 0x80, 0x34, 0xc4, 0x80,
-  0x04, 0xc0, 0xa4, 0x00, 0x28, 0x22, 0x41, 0x28, 0x82, 0x42, 0x20, 0x02,
-  0x42, 0x00, 0x20, 0x84, 0x21, 0x11, 0xa8, 0x81, 0x82, 0x80, 0x01, 0x42,
-  0x88, 0x80, 0x04, 0x42, 0x44, 0x20, 0x22, 0x25, 0xf4, 0xfa, 0xc6, 0x00,
-  0x00, 0x00, 0x1a, 0x14, 0x04, 0x41, 0xa0, 0x82, 0x00, 0x82, 0x00, 0x00,
-  0x28, 0x40, 0x04, 0x80, 0x04, 0x40, 0x84, 0x04, 0x40, 0x04, 0x00, 0x90,
-  0x82, 0x10, 0x04, 0x00, 0x00, 0x40, 0x88, 0x08, 0x00, 0x42, 0x48, 0x81,
-  0x80, 0x81, 0x04, 0x41, 0x00, 0x5b, 0x4d, 0x00, 0x00, 0x00, 0x28, 0x80,
-  0x02, 0x00, 0x80, 0x02, 0x00, 0x22, 0x00, 0x20, 0x02, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x20, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xf4, 0x2b, 0x15, 0x00, 0x40, 0x08, 0x40,
-  0x08, 0x00, 0x40, 0x18, 0x18, 0x08, 0x89, 0x02, 0x40, 0x08, 0x22, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x48, 0x62, 0x00, 0x00, 0x48, 0x00, 0x42, 0x00,
-  0x42, 0x18, 0x42, 0x1a, 0x04, 0x00, 0x80, 0x04, 0x42, 0x42, 0x18, 0x20,
-  0x21, 0x01, 0xf0, 0xe3, 0xce, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x42, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0x52, 0x0a, 0xc0, 0x28, 0x20, 0x02, 0x00, 0x84, 0x00, 0x22,
-  0x22, 0x80, 0x02, 0x00, 0x28, 0x00, 0x48, 0x4a, 0x02, 0x00, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01,
-  0x00, 0x40, 0x01, 0x20, 0x24, 0x04, 0xef, 0x8b, 0x03, 0x00, 0x80, 0x08,
-  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
-  0x00, 0x20, 0x02, 0x42, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xcb, 0x86, 0x00, 0x00, 0x26, 0x08,
-  0x22, 0x00, 0x22, 0x00, 0x00, 0x20, 0x02, 0x28, 0x28, 0x00, 0x22, 0x48,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x42, 0x48,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x52, 0x42, 0x00, 0xf0, 0xc9,
-  0xb4, 0x80, 0x22, 0x32, 0x28, 0x40, 0x08, 0x8c, 0x22, 0x02, 0x22, 0x81,
-  0x8c, 0x42, 0x88, 0x02, 0x8c, 0x42, 0x18, 0x88, 0x82, 0x02, 0x28, 0x00,
-  0x22, 0x28, 0x80, 0x02, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x01, 0x20, 0x01, 0x12, 0x20, 0x81, 0x25, 0x01, 0x1a, 0x04, 0x18, 0x20,
-  0x81, 0x74, 0xce, 0x08, 0x22, 0x86, 0x28, 0x02, 0x00, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x42, 0x00, 0x00, 0x00, 0x20, 0x22, 0x02,
-  0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x42, 0x00, 0xab, 0x49, 0x60, 0x88, 0x80, 0x04, 0x22, 0x20, 0x02,
-  0x00, 0x40, 0x04, 0x8c, 0x42, 0x08, 0x00, 0x00, 0x00, 0x21, 0x28, 0x18,
-  0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x84, 0x80, 0x04, 0x00, 0x48, 0x20,
-  0x01, 0x40, 0x04, 0x1a, 0x82, 0x84, 0x84, 0x04, 0x20, 0x25, 0x04, 0x23,
-  0x04, 0x2f, 0xe9, 0x01, 0x30, 0xa8, 0x28, 0x00, 0x81, 0x28, 0x00, 0x90,
-  0x28, 0x28, 0x81, 0x10, 0x18, 0x08, 0x20, 0x02, 0x2a, 0x04, 0x22, 0x20,
-  0x02, 0x00, 0x28, 0x28, 0x62, 0x00, 0x42, 0x48, 0x48, 0x00, 0x20, 0x04,
-  0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0x42, 0x42, 0x42, 0x4a, 0x81,
-  0x81, 0xf4, 0x66, 0xb4, 0x80, 0xa2, 0x28, 0x85, 0x08, 0x2a, 0x02, 0x22,
-  0x28, 0x00, 0x22, 0x26, 0x08, 0x00, 0x80, 0x52, 0x88, 0x80, 0x02, 0x2a,
-  0x04, 0x22, 0x20, 0x02, 0x00, 0x22, 0x48, 0x00, 0x00, 0x00, 0xa0, 0x44,
-  0x20, 0x24, 0x04, 0x20, 0x01, 0x00, 0x12, 0x80, 0x84, 0x01, 0x20, 0xa1,
-  0x11, 0x20, 0x04, 0x4f, 0xff, 0x0b, 0x22, 0x84, 0x22, 0x8b, 0x22, 0x81,
-  0x2e, 0x28, 0x81, 0x83, 0x82, 0x82, 0x42, 0x18, 0xc8, 0x28, 0x84, 0x2e,
-  0x28, 0x22, 0x83, 0xa2, 0x22, 0x28, 0x22, 0x4a, 0xa2, 0x24, 0x28, 0x28,
-  0x80, 0x02, 0x22, 0x22, 0x4a, 0x84, 0x22, 0xa4, 0x44, 0x48, 0x42, 0x42,
-  0x00, 0x00, 0x80, 0x24, 0x81, 0x85, 0x84, 0x01, 0x4a, 0x85, 0xa1, 0x54,
-  0x4a, 0xa1, 0x44, 0xa0, 0x11, 0x58, 0x48, 0x1a, 0x84, 0x24, 0x74, 0x73,
-  0x0d, 0x00, 0x00, 0x84, 0x40, 0x08, 0x20, 0x02, 0x00, 0x00, 0x28, 0x84,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x20, 0x01, 0x12, 0x20, 0x01, 0x12, 0x00, 0x80, 0x04, 0x00,
-  0x12, 0xf0, 0xcc, 0x21, 0x20, 0x22, 0x72, 0x28, 0x28, 0xa2, 0xa2, 0x2a,
-  0xf2, 0x28, 0x28, 0x8f, 0x82, 0xa2, 0x22, 0x2a, 0x52, 0x88, 0x85, 0x48,
-  0x48, 0x58, 0x88, 0x2a, 0xf2, 0x28, 0x28, 0x2e, 0x28, 0x28, 0x2a, 0xa2,
-  0x42, 0x4a, 0x06, 0x2a, 0xa2, 0x22, 0x2a, 0x02, 0x2a, 0xa2, 0x66, 0x6a,
-  0xa6, 0x62, 0x48, 0x48, 0x42, 0x4a, 0xa4, 0x44, 0x00, 0x00, 0xa0, 0x44,
-  0x4a, 0xa4, 0x55, 0x5a, 0xa4, 0x11, 0x1a, 0xa1, 0x11, 0x5a, 0xa4, 0x55,
-  0x4a, 0xa4, 0x55, 0x4a, 0x14, 0xe1, 0x11, 0xa1, 0x55, 0x12, 0x40, 0xf1,
-  0x62, 0x8a, 0x20, 0xe2, 0x86, 0x74, 0x28, 0xf8, 0x28, 0x68, 0x8d, 0x88,
-  0x89, 0xf2, 0x28, 0x28, 0x28, 0x2a, 0xa2, 0x22, 0xc5, 0x1c, 0xc8, 0x2c,
-  0x84, 0xa0, 0x22, 0x8d, 0x28, 0x2a, 0x82, 0xa2, 0x22, 0x66, 0xb2, 0x42,
-  0x24, 0xb2, 0x32, 0x03, 0xaa, 0x0b, 0x2a, 0xaa, 0x64, 0x4a, 0xa6, 0x66,
-  0x1f, 0x14, 0xa4, 0x44, 0x4e, 0x41, 0x8f, 0x84, 0xa4, 0x44, 0x4e, 0x48,
-  0x80, 0xa4, 0x44, 0xa0, 0x44, 0x4a, 0xa4, 0x54, 0x5a, 0xf4, 0x14, 0x14,
-  0x1a, 0xe1, 0x43, 0xa3, 0x44, 0x5a, 0xa7, 0x55, 0x5a, 0xa5, 0x44, 0x4e,
-  0x41, 0x5a, 0xe4, 0x25, 0xb5, 0x12, 0x24, 0xb1, 0x42, 0xf1, 0xc8, 0x93,
-  0xa0, 0x22, 0x2a, 0x76, 0x28, 0xf8, 0x28, 0x28, 0x8f, 0x82, 0xb2, 0x28,
-  0xf2, 0x28, 0x28, 0x2a, 0xa2, 0x22, 0x2a, 0xd2, 0x48, 0x32, 0x28, 0x8d,
-  0x28, 0x84, 0x85, 0xa8, 0x22, 0x8f, 0x82, 0x92, 0x28, 0x28, 0x2a, 0xa2,
-  0x66, 0x29, 0x24, 0xa2, 0x32, 0x2a, 0xa2, 0xa2, 0x2a, 0xa2, 0x22, 0x2a,
-  0xa2, 0x44, 0x4a, 0xe4, 0x14, 0xa4, 0x44, 0x4a, 0xc4, 0x48, 0x4a, 0x84,
-  0x04, 0x00, 0x4a, 0xa4, 0x44, 0x1a, 0xa1, 0x15, 0x4a, 0xe1, 0x41, 0x01,
-  0x5a, 0xa7, 0x54, 0x5a, 0xa5, 0x44, 0x5a, 0x01, 0x5a, 0xe5, 0x15, 0xa1,
-  0x55, 0x2b, 0x11, 0x80, 0xf1, 0x2c, 0x87, 0x20, 0xb2, 0x28, 0x76, 0x28,
-  0xf8, 0x68, 0x28, 0x85, 0xb8, 0x28, 0xf2, 0x28, 0x28, 0x8f, 0x82, 0x02,
-  0x2a, 0x72, 0x28, 0x9c, 0x28, 0xc5, 0x48, 0x58, 0x88, 0x2a, 0x72, 0x28,
-  0xf8, 0x28, 0x28, 0x28, 0x28, 0x4a, 0xb4, 0x42, 0x42, 0xa2, 0x32, 0x2a,
-  0xa2, 0xa3, 0x2a, 0xa2, 0x2a, 0x22, 0x4a, 0xa4, 0x44, 0x4e, 0x41, 0x48,
-  0x13, 0xe4, 0x84, 0xa4, 0x44, 0x81, 0x20, 0xa4, 0x44, 0x4a, 0xa4, 0x44,
-  0x18, 0x4a, 0xa1, 0x14, 0x1e, 0x14, 0xb0, 0x54, 0xa7, 0x55, 0x3a, 0xa5,
-  0x55, 0x5a, 0x01, 0x5a, 0xa5, 0x55, 0x5a, 0xb5, 0x52, 0xe5, 0x21, 0x41,
-  0xf1, 0xcb, 0xde, 0x00, 0x00, 0x84, 0x22, 0x20, 0x02, 0x00, 0x22, 0x84,
-  0x40, 0x08, 0x00, 0x00, 0x20, 0x04, 0x28, 0x80, 0x02, 0x28, 0x00, 0xa0,
-  0x24, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x00, 0x20, 0x01, 0x20, 0x04, 0x4f, 0x1b, 0x0b, 0x80, 0x02, 0x28, 0x00,
-  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x80, 0x02, 0x28, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x20,
-  0x04, 0x80, 0x04, 0x00, 0x00, 0x48, 0x00, 0x77, 0x87, 0xc0, 0x42, 0x1f,
-  0x41, 0x52, 0x28, 0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0x32, 0x4a, 0x1d,
-  0x24, 0xab, 0x14, 0x1d, 0x24, 0xab, 0x94, 0x19, 0xb2, 0x4a, 0x19, 0xb5,
-  0x4a, 0x39, 0x24, 0xaf, 0x14, 0x39, 0x24, 0x2f, 0x14, 0x79, 0x24, 0xd8,
-  0x12, 0xfb, 0x24, 0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x1c, 0xf8, 0x24, 0x4a,
-  0x16, 0xf1, 0x24, 0x4a, 0x96, 0xe1, 0xa2, 0x64, 0x59, 0xac, 0xe4, 0x49,
-  0xc2, 0x4a, 0x1f, 0x49, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f, 0x49,
-  0x32, 0x48, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a, 0xd1, 0x41,
-  0xb2, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x43, 0xb2, 0x4a,
-  0x39, 0x24, 0x2b, 0x94, 0x47, 0x82, 0x29, 0xf9, 0x24, 0x48, 0x98, 0x4f,
-  0xa2, 0xf4, 0x1d, 0x5d, 0xc0, 0x42, 0x1f, 0xc1, 0xd6, 0x28, 0xf4, 0x11,
-  0x24, 0x42, 0x1f, 0x41, 0x32, 0x4a, 0x1d, 0x24, 0xab, 0x14, 0x1d, 0x24,
-  0xaf, 0x44, 0xd9, 0x41, 0xb2, 0x4a, 0x1b, 0xb5, 0x42, 0x3b, 0x24, 0xaf,
-  0x14, 0x39, 0x24, 0x2f, 0x14, 0x59, 0x84, 0x2d, 0x91, 0x6f, 0x82, 0xd4,
-  0x12, 0xf9, 0x24, 0x5a, 0x1c, 0xf9, 0x24, 0xca, 0x1e, 0x81, 0x4f, 0xa2,
-  0x64, 0x19, 0x2e, 0x4a, 0x96, 0xc5, 0x4b, 0x9e, 0x25, 0xac, 0xf4, 0x91,
-  0x2c, 0xac, 0xf4, 0x91, 0x64, 0x85, 0xf2, 0x91, 0x64, 0x81, 0x1f, 0x49,
-  0x32, 0x4a, 0x1f, 0x48, 0x32, 0x4a, 0x1d, 0x24, 0xaf, 0x44, 0xd9, 0x41,
-  0xb2, 0x4a, 0x9b, 0x25, 0xab, 0x94, 0x43, 0xb2, 0x4a, 0x39, 0x24, 0x29,
-  0x78, 0x24, 0x98, 0x92, 0x6f, 0x82, 0x94, 0x82, 0x4f, 0xa2, 0xe5, 0x9d,
-  0x08, 0x86, 0x28, 0x88, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x84,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x01, 0x2f, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x30, 0x28, 0x28, 0x00,
-  0x00, 0x00, 0x84, 0x00, 0x80, 0x08, 0x00, 0xc8, 0x20, 0x02, 0x28, 0x80,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x12, 0x00, 0x00, 0x48, 0x00,
-  0x20, 0x02, 0x00, 0x00, 0x20, 0xf4, 0xf2, 0xf9, 0x00, 0x82, 0x00, 0x00,
-  0x20, 0x08, 0x00, 0x88, 0x00, 0x20, 0x88, 0x22, 0x04, 0x48, 0x20, 0x86,
-  0x04, 0x00, 0x00, 0x80, 0x02, 0x82, 0x00, 0x48, 0x00, 0x00, 0x88, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x88, 0x11, 0x80, 0x81, 0x48, 0x01,
-  0x7f, 0xa9, 0x06, 0x20, 0x0c, 0x00, 0x00, 0x83, 0x88, 0x02, 0x41, 0x82,
-  0x22, 0x00, 0x83, 0x28, 0x22, 0x04, 0x48, 0x24, 0x2a, 0x04, 0xd2, 0xa0,
-  0x28, 0x80, 0x02, 0x88, 0x90, 0x81, 0x00, 0x83, 0x04, 0x42, 0x00, 0x2a,
-  0x08, 0x80, 0x01, 0x10, 0x04, 0x2a, 0x04, 0x20, 0x24, 0x82, 0x08, 0xc0,
-  0x12, 0x88, 0x14, 0x52, 0x3f, 0xbb, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x42, 0x00, 0x00, 0x00, 0x22,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
-  0x11, 0x00, 0x00, 0xb0, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x02, 0x00, 0x00, 0x24, 0x00,
-  0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xcf, 0x94, 0x05, 0x00, 0x82, 0x18, 0x82, 0x00, 0x18, 0x81,
-  0x00, 0x32, 0x8a, 0x04, 0x49, 0x08, 0x88, 0x28, 0x00, 0x82, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x00, 0x18, 0x58, 0x41, 0x00, 0x24, 0x80, 0x24, 0x28,
-  0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x20, 0x08, 0x00, 0x00, 0x5f, 0xd9,
-  0x0f, 0x00, 0x88, 0x18, 0x82, 0x00, 0x16, 0x42, 0x08, 0x80, 0x22, 0x08,
-  0x49, 0x08, 0x20, 0x02, 0x20, 0x28, 0x02, 0x22, 0x00, 0x00, 0x20, 0x12,
-  0x02, 0x80, 0x01, 0x00, 0x88, 0x20, 0x24, 0x08, 0x00, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x48, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x42, 0x41, 0x00, 0x24, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x82, 0x00, 0x00, 0xe0, 0xdf, 0x05, 0x00, 0x00, 0x60, 0x24,
-  0x00, 0x00, 0x41, 0x00, 0x00, 0x82, 0x12, 0x00, 0x20, 0x05, 0x00, 0x00,
-  0x18, 0x80, 0x04, 0x43, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x08, 0x10, 0x01, 0x00, 0x00, 0x5b, 0x72, 0x00, 0x44,
-  0x81, 0x00, 0x00, 0x00, 0x28, 0x41, 0x20, 0x24, 0x88, 0x01, 0x28, 0x20,
-  0x8c, 0x04, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x84, 0xc2, 0x00, 0x00,
-  0x12, 0xdf, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x88, 0x82, 0x00,
-  0x00, 0x40, 0x02, 0x00, 0x80, 0x08, 0x00, 0x80, 0x02, 0x00, 0x88, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x20, 0x02, 0x00, 0x88, 0x00, 0x40,
-  0x19, 0x81, 0x08, 0x00, 0xf0, 0x1b, 0xcd, 0x00, 0x44, 0x84, 0x00, 0x20,
-  0x02, 0xa0, 0x82, 0x88, 0x80, 0x84, 0x08, 0x20, 0x03, 0x88, 0x48, 0x1a,
-  0x24, 0x08, 0x88, 0x00, 0x2a, 0x01, 0x42, 0xa0, 0x28, 0x80, 0x01, 0x00,
-  0x00, 0x00, 0xa0, 0x42, 0x48, 0x80, 0x03, 0x00, 0x82, 0x20, 0x08, 0x89,
-  0x88, 0x28, 0x08, 0x00, 0x70, 0xaf, 0x0b, 0x00, 0x00, 0x80, 0x14, 0x02,
-  0x00, 0x00, 0x00, 0x18, 0x82, 0x24, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x24, 0x04, 0x00, 0x40, 0xf1, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x80, 0x01, 0x00, 0x18, 0x30, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x01, 0x18, 0x00, 0x80, 0x01, 0x18, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1b, 0xe5, 0x10, 0x04, 0x00,
-  0x41, 0x41, 0x10, 0x14, 0x34, 0x14, 0x00, 0x00, 0x00, 0x41, 0x20, 0x01,
-  0x41, 0x00, 0x00, 0x41, 0x10, 0x04, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x81, 0xf0, 0xa6,
-  0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x40, 0xf1, 0x1a, 0x66, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x01, 0x10, 0x08, 0x00, 0xcf, 0x94, 0x0d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x01, 0x00, 0x18, 0x00, 0x80, 0x01, 0x18, 0x12, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x01, 0x12, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x34, 0x2f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x40, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0xf2, 0x22, 0x00, 0x10, 0x04, 0x88, 0x44,
-  0x30, 0x14, 0x44, 0x00, 0x90, 0x14, 0x00, 0x41, 0x44, 0x60, 0x41, 0x40,
-  0x04, 0x41, 0x00, 0x00, 0x10, 0x24, 0x01, 0x20, 0x81, 0x01, 0x20, 0x81,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x08,
-  0x17, 0x75, 0x20, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x01,
-  0x3f, 0xd3, 0x0d, 0x84, 0xc1, 0x4d, 0x48, 0x41, 0x00, 0x00, 0x10, 0x04,
-  0x44, 0x41, 0x28, 0x00, 0x60, 0x41, 0x40, 0x04, 0x50, 0x42, 0x80, 0x41,
-  0x84, 0xc8, 0x14, 0x00, 0x00, 0x14, 0x20, 0x41, 0x08, 0x48, 0x18, 0x80,
-  0x01, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x85, 0x01, 0x10, 0x12,
-  0xf8, 0x4e, 0xa7, 0x10, 0x24, 0x58, 0x48, 0x20, 0x18, 0x04, 0x10, 0x04,
-  0x20, 0x01, 0x00, 0x41, 0x44, 0x12, 0x41, 0x40, 0x24, 0x11, 0x04, 0x40,
-  0x04, 0x4d, 0x14, 0x41, 0x12, 0x80, 0xa1, 0x11, 0x12, 0x80, 0x21, 0x21,
-  0x01, 0x18, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x88,
-  0x85, 0x01, 0x8f, 0xf6, 0x08, 0x20, 0x18, 0x04, 0x41, 0x00, 0x00, 0x47,
-  0x41, 0x84, 0xd0, 0x44, 0x01, 0x00, 0x41, 0x20, 0x01, 0x41, 0x44, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x41, 0x41, 0x08, 0x14, 0xf0, 0x77, 0xa3, 0x00,
-  0xc4, 0x40, 0x04, 0x44, 0xd0, 0x44, 0x41, 0x04, 0x80, 0x01, 0x00, 0x1a,
-  0x81, 0x91, 0x14, 0x18, 0x4b, 0x11, 0x18, 0x49, 0xc1, 0x14, 0x00, 0x41,
-  0x00, 0x00, 0x20, 0x01, 0x18, 0x12, 0x12, 0x00, 0x12, 0x12, 0x20, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x40, 0x48, 0xf8, 0xa3, 0xf5,
-  0x00, 0x41, 0x10, 0x04, 0x00, 0x18, 0x80, 0x01, 0x20, 0x01, 0x40, 0x24,
-  0x41, 0x04, 0x44, 0x12, 0x20, 0x01, 0x00, 0x20, 0x01, 0x12, 0x00, 0x00,
-  0x18, 0x00, 0x80, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x81, 0x00, 0x10, 0xf8, 0x19, 0x11, 0x10, 0x54, 0x44, 0xc5, 0x58, 0x44,
-  0x4c, 0x58, 0x44, 0xf0, 0x14, 0x14, 0x4f, 0x41, 0xd1, 0x44, 0x81, 0x01,
-  0x18, 0x00, 0x41, 0x45, 0xf4, 0x14, 0x14, 0x4f, 0x41, 0x11, 0x04, 0x45,
-  0xc4, 0x14, 0x00, 0xa0, 0x11, 0x47, 0x41, 0x1a, 0xa1, 0x11, 0x18, 0x12,
-  0x20, 0x21, 0x01, 0x1a, 0x01, 0x12, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x50, 0x88, 0x95, 0x58, 0x88, 0x85, 0x18, 0x58, 0x88, 0x1f, 0x2d,
-  0x04, 0x41, 0x4f, 0xc4, 0x54, 0x88, 0x4d, 0x44, 0x44, 0x45, 0x04, 0x45,
-  0x54, 0x44, 0x4d, 0x14, 0x4c, 0x81, 0xe1, 0x42, 0x03, 0x28, 0x80, 0xf1,
-  0x14, 0x14, 0x1a, 0x11, 0xd4, 0x24, 0xd1, 0x46, 0xd1, 0x44, 0xb1, 0x12,
-  0x01, 0x8a, 0xa9, 0x11, 0x1a, 0x08, 0xa0, 0x11, 0x1d, 0x11, 0x40, 0x71,
-  0x18, 0x28, 0xe1, 0x85, 0xa5, 0x11, 0x1a, 0x24, 0x21, 0x21, 0x01, 0x00,
-  0x45, 0x04, 0x2e, 0x24, 0x80, 0x02, 0x00, 0x85, 0x58, 0x88, 0x24, 0x21,
-  0x14, 0xaf, 0x81, 0xf1, 0xb2, 0x37, 0x40, 0xd4, 0x44, 0x54, 0xc8, 0x45,
-  0x54, 0x44, 0x45, 0x54, 0x44, 0x45, 0x54, 0x44, 0x16, 0x64, 0x41, 0xa0,
-  0x31, 0x00, 0x49, 0xd1, 0x44, 0xd1, 0x44, 0xa1, 0x11, 0x4d, 0x14, 0x18,
-  0x61, 0x1a, 0x81, 0x01, 0x4d, 0x84, 0x12, 0x4d, 0x14, 0x00, 0x18, 0x16,
-  0x21, 0x21, 0xe1, 0x81, 0x01, 0x1a, 0x05, 0x1a, 0x01, 0x1a, 0x01, 0x00,
-  0x40, 0x04, 0x28, 0x00, 0x00, 0x40, 0x51, 0x89, 0x85, 0x58, 0x8a, 0x84,
-  0x8d, 0x18, 0x1f, 0x98, 0x05, 0x44, 0xcd, 0x44, 0xc5, 0x7c, 0x44, 0x74,
-  0x84, 0x54, 0x44, 0x45, 0xf4, 0x14, 0x14, 0x45, 0x74, 0x14, 0x24, 0xa1,
-  0x11, 0x4b, 0x31, 0x20, 0x92, 0x14, 0x4d, 0x14, 0x4f, 0x41, 0xf1, 0x14,
-  0x14, 0x4d, 0x14, 0x4d, 0x14, 0x6f, 0x41, 0xf1, 0x14, 0x16, 0x18, 0xf0,
-  0x14, 0x84, 0x12, 0x4f, 0x48, 0x01, 0x1a, 0xa1, 0x11, 0x1c, 0x21, 0x31,
-  0x11, 0x1e, 0x18, 0x1a, 0xb1, 0x18, 0xa5, 0x11, 0x5a, 0xa1, 0x11, 0x1a,
-  0xa1, 0x11, 0x00, 0x40, 0x04, 0x49, 0x02, 0x22, 0x00, 0x00, 0x85, 0x08,
-  0xa5, 0x58, 0xb8, 0x8d, 0x18, 0xf6, 0x0c, 0x00, 0x00, 0x41, 0x10, 0x04,
-  0x41, 0x12, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x40, 0x04, 0x00, 0x00,
-  0x80, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x08, 0x00, 0x5b, 0x7f, 0x00, 0x00, 0x00, 0x10, 0x04,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x2f, 0xbe, 0x07, 0x2c, 0xf4, 0x11, 0x24, 0x85, 0xf2,
-  0x11, 0x24, 0x83, 0xf4, 0x11, 0x24, 0xa3, 0xd4, 0x41, 0xb2, 0x4a, 0xd1,
-  0x41, 0xb2, 0x4a, 0xd9, 0x81, 0xb2, 0x4a, 0x19, 0xb5, 0x4a, 0x39, 0x24,
-  0xaf, 0x14, 0x39, 0x24, 0x2f, 0x14, 0x79, 0x24, 0xd8, 0x12, 0xf9, 0x24,
-  0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x1c, 0xf8, 0x24, 0x4a, 0x16, 0xf1, 0x24,
-  0x4a, 0x96, 0xe1, 0xa2, 0x64, 0x59, 0xac, 0xe4, 0x49, 0xc2, 0x4a, 0x1f,
-  0x49, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f, 0x49, 0x32, 0x48, 0x1f,
-  0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x4a, 0x99,
-  0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x43, 0xb2, 0x4a, 0x39, 0x24, 0x2b,
-  0x94, 0x47, 0x82, 0x29, 0xf9, 0x24, 0x48, 0x98, 0x4f, 0xa2, 0xd4, 0x46,
-  0x05, 0x2c, 0xf4, 0x11, 0x6c, 0x2c, 0xf4, 0x11, 0x24, 0x83, 0xf4, 0x11,
-  0x24, 0xa3, 0xd4, 0x41, 0xb2, 0x4a, 0xd1, 0x41, 0xf2, 0x42, 0x94, 0x19,
-  0xf2, 0x4a, 0xa4, 0x59, 0xb2, 0x4a, 0x29, 0xf2, 0x4a, 0x81, 0x43, 0xf2,
-  0x42, 0x91, 0x26, 0xd8, 0x12, 0xf8, 0x26, 0x48, 0x2d, 0x81, 0x4f, 0xa2,
-  0xc5, 0x81, 0x2e, 0xda, 0x1e, 0x81, 0x2e, 0x4a, 0x96, 0xe1, 0xa2, 0x64,
-  0x59, 0xbc, 0xe4, 0x58, 0xc2, 0x4a, 0x1f, 0xc8, 0xc2, 0x4a, 0x1f, 0x49,
-  0xd6, 0x28, 0xf4, 0x81, 0x24, 0x83, 0xf4, 0x81, 0x24, 0xa3, 0xf4, 0x81,
-  0x24, 0xab, 0x14, 0x1d, 0x24, 0xaf, 0x44, 0xd9, 0x41, 0xb2, 0x4a, 0x9b,
-  0x25, 0xab, 0x94, 0x43, 0xb2, 0x4a, 0x39, 0x24, 0x2b, 0x94, 0x47, 0x82,
-  0x29, 0xf9, 0x26, 0x48, 0x29, 0xf9, 0x24, 0x5a, 0xef, 0x11, 0x0e, 0x20,
-  0x88, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x40, 0x08, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x50, 0x12, 0xf0,
-  0xcd, 0x76, 0x80, 0x02, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x88, 0x00,
-  0x82, 0x00, 0x88, 0x22, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x80, 0x08,
-  0x00, 0x50, 0x86, 0x00, 0x82, 0x00, 0x00, 0x22, 0x40, 0x08, 0x80, 0x08,
-  0x42, 0x00, 0x38, 0x42, 0x20, 0x04, 0x88, 0x48, 0x88, 0x00, 0x00, 0x00,
-  0x20, 0x08, 0x00, 0x00, 0x82, 0x20, 0x08, 0x00, 0x8a, 0x02, 0x80, 0x08,
-  0x4a, 0x08, 0x88, 0x20, 0x04, 0x42, 0x14, 0x88, 0x14, 0xf0, 0x37, 0x13,
-  0x80, 0x22, 0x0c, 0x00, 0x80, 0x02, 0x84, 0x10, 0x84, 0x28, 0x22, 0x0c,
-  0xa0, 0x1a, 0x42, 0x20, 0x4c, 0x22, 0x08, 0x92, 0x20, 0x08, 0x00, 0x00,
-  0x19, 0x08, 0x10, 0x08, 0x42, 0x82, 0x18, 0x82, 0x00, 0xa0, 0x28, 0x10,
-  0x84, 0x28, 0x82, 0x0c, 0x88, 0x80, 0x04, 0xc2, 0x24, 0x88, 0x14, 0x12,
-  0x9f, 0xbe, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x42, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x12, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00,
-  0x1f, 0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xb7, 0x05,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1c, 0x08, 0xc8, 0x80,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x0f,
-  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x82, 0x20, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc7, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x08, 0x14, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x5a, 0x0d, 0x00, 0x00,
-  0x20, 0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x80, 0x02, 0x00, 0x20,
-  0x01, 0x00, 0x00, 0x00, 0x82, 0x82, 0x12, 0x00, 0xf0, 0x2d, 0x66, 0x00,
+  0xc1, 0x02, 0x00, 0x40, 0x38, 0x22, 0x8d, 0x02, 0x00, 0x9c, 0x04, 0xa0,
+  0x00, 0x28, 0x00, 0x80, 0x02, 0x28, 0x20, 0x14, 0x04, 0x00, 0xd3, 0x08,
+  0xa0, 0x00, 0x10, 0x24, 0x01, 0x00, 0x00, 0x12, 0x44, 0x00, 0x1a, 0xd0,
+  0x06, 0xa0, 0xdf, 0xe1, 0x06, 0x26, 0x02, 0x00, 0x81, 0x00, 0x30, 0x48,
+  0x47, 0x04, 0x80, 0x28, 0x22, 0x80, 0x04, 0x48, 0x42, 0x80, 0x82, 0x76,
+  0x0d, 0x20, 0x48, 0x46, 0xbc, 0x07, 0xf1, 0x15, 0x48, 0x42, 0x12, 0xe0,
+  0x48, 0x24, 0x04, 0x4a, 0x01, 0x80, 0x04, 0x60, 0x44, 0x40, 0x84, 0x04,
+  0xf0, 0x95, 0x2b, 0xd0, 0x24, 0xf5, 0x11, 0x24, 0xcd, 0x12, 0x1f, 0x41,
+  0xb2, 0x4c, 0xf1, 0x11, 0x24, 0xeb, 0x14, 0x1d, 0x04, 0x00, 0x05, 0xcc,
+  0x08, 0x40, 0x43, 0xf2, 0x4a, 0x95, 0xd0, 0x08, 0x04, 0xcc, 0x08, 0x15,
+  0xb5, 0xcc, 0x08, 0x51, 0x4f, 0xa2, 0x74, 0x98, 0xe5, 0x04, 0x00, 0xf2,
+  0x15, 0xf4, 0x98, 0x24, 0x2e, 0x4a, 0x1f, 0x49, 0xe2, 0x22, 0xf4, 0x91,
+  0x24, 0x87, 0x22, 0x1f, 0xc9, 0x32, 0x68, 0x1f, 0xc9, 0x32, 0x6a, 0x1f,
+  0xc8, 0xb2, 0x6a, 0xd1, 0xc1, 0xb2, 0x6a, 0xf9, 0x11, 0x28, 0xab, 0x94,
+  0x55, 0xcc, 0x08, 0x10, 0x7b, 0x04, 0x00, 0xf2, 0x63, 0xa4, 0xd8, 0x4a,
+  0xfb, 0x24, 0x48, 0x89, 0xfb, 0x24, 0x4a, 0xce, 0xf7, 0xc0, 0x42, 0x1f,
+  0x84, 0x52, 0x28, 0x19, 0x36, 0x48, 0x19, 0x32, 0x4a, 0x19, 0xb2, 0x6a,
+  0x11, 0xf1, 0x2a, 0x94, 0x19, 0xf4, 0x2a, 0x94, 0x19, 0x92, 0x9a, 0x22,
+  0xaf, 0x14, 0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x29, 0xd4, 0x12,
+  0xeb, 0x22, 0xc5, 0x91, 0x2e, 0xc2, 0x1e, 0x81, 0x2e, 0x42, 0x9e, 0x21,
+  0x2e, 0x42, 0x9e, 0x25, 0x3c, 0x64, 0x59, 0x2c, 0x74, 0x91, 0xcc, 0x42,
+  0x1f, 0x89, 0x44, 0xf2, 0x91, 0x44, 0x42, 0x13, 0x39, 0x42, 0x17, 0x48,
+  0x2b, 0x14, 0x15, 0xf4, 0x42, 0x84, 0x11, 0x2f, 0x44, 0x1a, 0xb5, 0x42,
+  0x12, 0x34, 0x42, 0x41, 0x29, 0x01, 0x29, 0x98, 0x46, 0x23, 0xc4, 0x12,
+  0x2f, 0x44, 0x0f, 0x27, 0x05, 0x01, 0x07, 0x06, 0x3a, 0x00, 0x10, 0x02,
+  0xce, 0x08, 0x20, 0x80, 0x12, 0xfe, 0x07, 0x90, 0x50, 0x12, 0xf0, 0xa1,
+  0x2a, 0x40, 0x02, 0x28, 0x00, 0x38, 0x05, 0x70, 0x08, 0x10, 0x01, 0x20,
+  0x84, 0x04, 0x20, 0x2c, 0x06, 0x31, 0x80, 0x24, 0x24, 0x26, 0x00, 0xf0,
+  0x22, 0x40, 0x04, 0x82, 0x12, 0x00, 0x92, 0x88, 0x80, 0x1d, 0x04, 0x20,
+  0x08, 0x20, 0xf4, 0xe6, 0xdc, 0x00, 0x8a, 0x82, 0x08, 0x80, 0x22, 0x02,
+  0x81, 0x88, 0x42, 0x00, 0x00, 0x42, 0xa8, 0x88, 0x80, 0x0e, 0x00, 0x82,
+  0x20, 0x04, 0x62, 0x20, 0x08, 0x82, 0x00, 0x00, 0x20, 0x08, 0x48, 0x00,
+  0x12, 0x12, 0x11, 0x07, 0xf2, 0x31, 0x04, 0x40, 0x81, 0x04, 0x4c, 0x48,
+  0x01, 0xff, 0x24, 0x03, 0xb0, 0xc2, 0xa2, 0x28, 0x00, 0x28, 0x38, 0x10,
+  0x28, 0x38, 0x44, 0x00, 0x80, 0x02, 0x2a, 0x88, 0x0c, 0x4a, 0x4a, 0x02,
+  0x48, 0x1a, 0x08, 0x8a, 0x04, 0x68, 0x80, 0x04, 0x13, 0x08, 0x10, 0x08,
+  0x42, 0x82, 0x80, 0x04, 0x00, 0x80, 0x18, 0x04, 0x22, 0x20, 0x38, 0x44,
+  0x9a, 0x04, 0x20, 0x44, 0x82, 0x48, 0x21, 0xd1, 0xdc, 0x07, 0x85, 0x06,
+  0x61, 0x08, 0x40, 0x81, 0x04, 0x20, 0x04, 0xad, 0x00, 0x22, 0x88, 0x42,
+  0x99, 0x06, 0xf1, 0x05, 0x16, 0x84, 0x01, 0x18, 0x00, 0x92, 0x00, 0x10,
+  0x44, 0x01, 0x88, 0x41, 0x80, 0xf4, 0x7c, 0xf3, 0x00, 0x4c, 0x02, 0x16,
+  0xfd, 0x0e, 0x00, 0x52, 0x06, 0xf1, 0x00, 0x08, 0x42, 0x00, 0x84, 0x00,
+  0x40, 0x08, 0x24, 0x44, 0x00, 0x00, 0xa0, 0x21, 0x20, 0x01, 0x12, 0x0f,
+  0xb1, 0x18, 0x20, 0x04, 0x20, 0x02, 0x00, 0x41, 0x42, 0xf0, 0x9c, 0x23,
+  0x8c, 0x0e, 0xf1, 0x08, 0x81, 0x10, 0x24, 0x08, 0x12, 0x10, 0x82, 0x82,
+  0x05, 0x00, 0x28, 0x81, 0x4a, 0x28, 0x04, 0x80, 0x84, 0x22, 0x0c, 0x62,
+  0xa0, 0x48, 0x81, 0xef, 0x09, 0xf0, 0x06, 0x12, 0x42, 0x12, 0x00, 0x00,
+  0x42, 0x48, 0x44, 0x10, 0x84, 0x21, 0x04, 0x81, 0x4e, 0xb2, 0x00, 0x26,
+  0x04, 0x4c, 0x01, 0x00, 0xe8, 0x0f, 0xf0, 0x03, 0x44, 0x20, 0x02, 0x00,
+  0xa0, 0x42, 0x84, 0x8a, 0xc4, 0x48, 0x00, 0x60, 0x82, 0x82, 0xb0, 0x26,
+  0x04, 0x8a, 0xbe, 0x07, 0xf0, 0x05, 0x00, 0x20, 0x04, 0x52, 0xa0, 0x14,
+  0x80, 0x01, 0x42, 0x00, 0x26, 0x04, 0x80, 0x61, 0x44, 0x48, 0x84, 0x5f,
+  0x62, 0x02, 0x4f, 0x09, 0x62, 0x42, 0x08, 0x80, 0x08, 0x12, 0x24, 0x97,
+  0x02, 0x20, 0x00, 0x80, 0x48, 0x0b, 0x51, 0x40, 0x04, 0x22, 0x80, 0x01,
+  0x90, 0x0b, 0x90, 0x80, 0x24, 0x04, 0x40, 0x04, 0x00, 0xf0, 0xeb, 0xd8,
+  0x34, 0x07, 0x40, 0x14, 0x04, 0x44, 0x80, 0x2d, 0x06, 0x22, 0x42, 0x42,
+  0xc1, 0x0f, 0xd1, 0x40, 0x84, 0x04, 0x28, 0x80, 0x24, 0x14, 0x04, 0x20,
+  0x01, 0x00, 0x88, 0x82, 0x3a, 0x00, 0x60, 0x42, 0x20, 0x02, 0x52, 0x7b,
+  0x69, 0x9b, 0x00, 0xf0, 0x01, 0x00, 0x80, 0x82, 0x88, 0x22, 0x22, 0x08,
+  0x00, 0x80, 0x0a, 0x41, 0x00, 0xca, 0x02, 0x10, 0x04, 0xb1, 0x00, 0x00,
+  0x1c, 0x01, 0x40, 0x18, 0xa0, 0x81, 0x81, 0x83, 0x00, 0x91, 0x84, 0x00,
+  0x00, 0x44, 0x58, 0x12, 0xef, 0xbe, 0x05, 0x0f, 0x07, 0xf0, 0x03, 0x20,
+  0x04, 0x10, 0x08, 0x82, 0x00, 0x41, 0x00, 0x00, 0x41, 0x00, 0x22, 0x28,
+  0x80, 0x82, 0x08, 0x00, 0x90, 0x8c, 0x00, 0x10, 0x81, 0x49, 0x01, 0xb0,
+  0x48, 0x00, 0x1a, 0x44, 0x04, 0x00, 0xf0, 0x2a, 0x38, 0x00, 0x22, 0x2a,
+  0x00, 0xf0, 0x2f, 0x28, 0x42, 0x22, 0x10, 0x08, 0x88, 0x80, 0x34, 0xc4,
+  0x80, 0x04, 0xc0, 0xa4, 0x00, 0x28, 0x22, 0x41, 0x28, 0x82, 0x42, 0x20,
+  0x02, 0x42, 0x00, 0x20, 0x84, 0x21, 0x11, 0xa8, 0x81, 0x82, 0x80, 0x01,
+  0x42, 0x88, 0x80, 0x04, 0x42, 0x44, 0x20, 0x22, 0x25, 0xf4, 0xfa, 0xc6,
+  0x00, 0x00, 0x00, 0x1a, 0x14, 0x04, 0x41, 0xa0, 0x82, 0x00, 0x82, 0x00,
+  0x00, 0x28, 0x40, 0x04, 0x80, 0xb3, 0x00, 0xf0, 0x08, 0x40, 0x04, 0x00,
+  0x90, 0x82, 0x10, 0x04, 0x00, 0x00, 0x40, 0x88, 0x08, 0x00, 0x42, 0x48,
+  0x81, 0x80, 0x81, 0x04, 0x41, 0x00, 0x5b, 0x4d, 0xaf, 0x03, 0x10, 0x80,
+  0x10, 0x01, 0x01, 0x1e, 0x08, 0x01, 0xa2, 0x07, 0x01, 0x58, 0x02, 0x05,
+  0x01, 0x00, 0xf0, 0x04, 0x80, 0xf4, 0x2b, 0x15, 0x00, 0x40, 0x08, 0x40,
+  0x08, 0x00, 0x40, 0x18, 0x18, 0x08, 0x89, 0x02, 0x40, 0x08, 0x22, 0x93,
+  0x00, 0x30, 0x00, 0x48, 0x62, 0x30, 0x08, 0x60, 0x42, 0x00, 0x42, 0x18,
+  0x42, 0x1a, 0xa3, 0x07, 0xa0, 0x42, 0x42, 0x18, 0x20, 0x21, 0x01, 0xf0,
+  0xe3, 0xce, 0x00, 0x4d, 0x00, 0x06, 0x01, 0x00, 0x00, 0xa6, 0x00, 0x03,
+  0x4a, 0x00, 0x02, 0x57, 0x00, 0xf0, 0x04, 0x7f, 0x52, 0x0a, 0xc0, 0x28,
+  0x20, 0x02, 0x00, 0x84, 0x00, 0x22, 0x22, 0x80, 0x02, 0x00, 0x28, 0x00,
+  0x48, 0x4a, 0x06, 0x00, 0x01, 0x01, 0x00, 0x01, 0x2b, 0x00, 0xe1, 0x20,
+  0x01, 0x00, 0x40, 0x01, 0x20, 0x24, 0x04, 0xef, 0x8b, 0x03, 0x00, 0x80,
+  0x08, 0x52, 0x04, 0x00, 0x01, 0x00, 0x00, 0x75, 0x00, 0x00, 0x4d, 0x00,
+  0x02, 0x62, 0x02, 0x01, 0x01, 0x00, 0x72, 0x12, 0x00, 0xcb, 0x86, 0x00,
+  0x00, 0x26, 0x92, 0x00, 0x60, 0x20, 0x02, 0x28, 0x28, 0x00, 0x22, 0x1e,
+  0x00, 0x10, 0x28, 0x48, 0x04, 0x00, 0x23, 0x02, 0x03, 0x29, 0x09, 0xf0,
+  0x0d, 0x52, 0x42, 0x00, 0xf0, 0xc9, 0xb4, 0x80, 0x22, 0x32, 0x28, 0x40,
+  0x08, 0x8c, 0x22, 0x02, 0x22, 0x81, 0x8c, 0x42, 0x88, 0x02, 0x8c, 0x42,
+  0x18, 0x88, 0x82, 0x02, 0x28, 0x79, 0x01, 0x22, 0x02, 0x42, 0xa3, 0x00,
+  0xf0, 0x05, 0x20, 0x01, 0x20, 0x01, 0x12, 0x20, 0x81, 0x25, 0x01, 0x1a,
+  0x04, 0x18, 0x20, 0x81, 0x74, 0xce, 0x08, 0x22, 0x86, 0x28, 0xcb, 0x00,
+  0x00, 0x9d, 0x00, 0x11, 0x80, 0xc7, 0x00, 0x34, 0x20, 0x22, 0x02, 0xc7,
+  0x00, 0x01, 0x01, 0x00, 0xf0, 0x01, 0x42, 0x00, 0xab, 0x49, 0x60, 0x88,
+  0x80, 0x04, 0x22, 0x20, 0x02, 0x00, 0x40, 0x04, 0x8c, 0x42, 0xc7, 0x03,
+  0x27, 0x21, 0x28, 0xc0, 0x03, 0xf1, 0x14, 0x48, 0x20, 0x01, 0x40, 0x04,
+  0x1a, 0x82, 0x84, 0x84, 0x04, 0x20, 0x25, 0x04, 0x23, 0x04, 0x2f, 0xe9,
+  0x01, 0x30, 0xa8, 0x28, 0x00, 0x81, 0x28, 0x00, 0x90, 0x28, 0x28, 0x81,
+  0x10, 0x18, 0x08, 0x20, 0x02, 0x2a, 0x3d, 0x00, 0x60, 0x28, 0x28, 0x62,
+  0x00, 0x42, 0x48, 0xc8, 0x0b, 0x00, 0x82, 0x02, 0x00, 0xc0, 0x00, 0xf3,
+  0x0b, 0x42, 0x42, 0x4a, 0x81, 0x81, 0xf4, 0x66, 0xb4, 0x80, 0xa2, 0x28,
+  0x85, 0x08, 0x2a, 0x02, 0x22, 0x28, 0x00, 0x22, 0x26, 0x08, 0x00, 0x80,
+  0x52, 0x88, 0x80, 0x33, 0x00, 0x01, 0xeb, 0x00, 0x40, 0xa0, 0x44, 0x20,
+  0x24, 0x89, 0x02, 0xf0, 0x25, 0x12, 0x80, 0x84, 0x01, 0x20, 0xa1, 0x11,
+  0x20, 0x04, 0x4f, 0xff, 0x0b, 0x22, 0x84, 0x22, 0x8b, 0x22, 0x81, 0x2e,
+  0x28, 0x81, 0x83, 0x82, 0x82, 0x42, 0x18, 0xc8, 0x28, 0x84, 0x2e, 0x28,
+  0x22, 0x83, 0xa2, 0x22, 0x28, 0x22, 0x4a, 0xa2, 0x24, 0x28, 0x28, 0x80,
+  0x02, 0x22, 0x22, 0x4a, 0x84, 0x22, 0xa4, 0x44, 0x48, 0xf6, 0x00, 0xf0,
+  0x0d, 0x80, 0x24, 0x81, 0x85, 0x84, 0x01, 0x4a, 0x85, 0xa1, 0x54, 0x4a,
+  0xa1, 0x44, 0xa0, 0x11, 0x58, 0x48, 0x1a, 0x84, 0x24, 0x74, 0x73, 0x0d,
+  0x00, 0x00, 0x84, 0x40, 0x08, 0x0d, 0x02, 0x23, 0x28, 0x84, 0xfe, 0x00,
+  0x01, 0xef, 0x00, 0x20, 0x48, 0x00, 0x21, 0x01, 0x20, 0x01, 0x12, 0x04,
+  0x01, 0xf0, 0x0c, 0x12, 0xf0, 0xcc, 0x21, 0x20, 0x22, 0x72, 0x28, 0x28,
+  0xa2, 0xa2, 0x2a, 0xf2, 0x28, 0x28, 0x8f, 0x82, 0xa2, 0x22, 0x2a, 0x52,
+  0x88, 0x85, 0x48, 0x48, 0x58, 0x88, 0x10, 0x00, 0xf0, 0x09, 0x2e, 0x28,
+  0x28, 0x2a, 0xa2, 0x42, 0x4a, 0x06, 0x2a, 0xa2, 0x22, 0x2a, 0x02, 0x2a,
+  0xa2, 0x66, 0x6a, 0xa6, 0x62, 0x48, 0x48, 0x42, 0x4a, 0xa4, 0xf5, 0x03,
+  0xf0, 0x19, 0x44, 0x4a, 0xa4, 0x55, 0x5a, 0xa4, 0x11, 0x1a, 0xa1, 0x11,
+  0x5a, 0xa4, 0x55, 0x4a, 0xa4, 0x55, 0x4a, 0x14, 0xe1, 0x11, 0xa1, 0x55,
+  0x12, 0x40, 0xf1, 0x62, 0x8a, 0x20, 0xe2, 0x86, 0x74, 0x28, 0xf8, 0x28,
+  0x68, 0x8d, 0x88, 0x89, 0xf2, 0x28, 0x43, 0x00, 0xf0, 0x1d, 0x22, 0xc5,
+  0x1c, 0xc8, 0x2c, 0x84, 0xa0, 0x22, 0x8d, 0x28, 0x2a, 0x82, 0xa2, 0x22,
+  0x66, 0xb2, 0x42, 0x24, 0xb2, 0x32, 0x03, 0xaa, 0x0b, 0x2a, 0xaa, 0x64,
+  0x4a, 0xa6, 0x66, 0x1f, 0x14, 0xa4, 0x44, 0x4e, 0x41, 0x8f, 0x84, 0xa4,
+  0x44, 0x4e, 0x48, 0x80, 0xa4, 0x44, 0x59, 0x00, 0xf0, 0x14, 0x54, 0x5a,
+  0xf4, 0x14, 0x14, 0x1a, 0xe1, 0x43, 0xa3, 0x44, 0x5a, 0xa7, 0x55, 0x5a,
+  0xa5, 0x44, 0x4e, 0x41, 0x5a, 0xe4, 0x25, 0xb5, 0x12, 0x24, 0xb1, 0x42,
+  0xf1, 0xc8, 0x93, 0xa0, 0x22, 0x2a, 0x76, 0x28, 0xf8, 0xad, 0x00, 0x31,
+  0xb2, 0x28, 0xf2, 0x5e, 0x00, 0xe0, 0x2a, 0xd2, 0x48, 0x32, 0x28, 0x8d,
+  0x28, 0x84, 0x85, 0xa8, 0x22, 0x8f, 0x82, 0x92, 0x13, 0x00, 0x80, 0x66,
+  0x29, 0x24, 0xa2, 0x32, 0x2a, 0xa2, 0xa2, 0x1d, 0x00, 0xf0, 0x26, 0xa2,
+  0x44, 0x4a, 0xe4, 0x14, 0xa4, 0x44, 0x4a, 0xc4, 0x48, 0x4a, 0x84, 0x04,
+  0x00, 0x4a, 0xa4, 0x44, 0x1a, 0xa1, 0x15, 0x4a, 0xe1, 0x41, 0x01, 0x5a,
+  0xa7, 0x54, 0x5a, 0xa5, 0x44, 0x5a, 0x01, 0x5a, 0xe5, 0x15, 0xa1, 0x55,
+  0x2b, 0x11, 0x80, 0xf1, 0x2c, 0x87, 0x20, 0xb2, 0x28, 0x76, 0x28, 0xf8,
+  0x68, 0x28, 0x85, 0xb8, 0x5a, 0x00, 0x90, 0x8f, 0x82, 0x02, 0x2a, 0x72,
+  0x28, 0x9c, 0x28, 0xc5, 0x0e, 0x01, 0x10, 0x72, 0x73, 0x00, 0x60, 0x28,
+  0x28, 0x4a, 0xb4, 0x42, 0x42, 0x5a, 0x00, 0x60, 0xa3, 0x2a, 0xa2, 0x2a,
+  0x22, 0x4a, 0xb9, 0x00, 0xf1, 0x1c, 0x48, 0x13, 0xe4, 0x84, 0xa4, 0x44,
+  0x81, 0x20, 0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x18, 0x4a, 0xa1, 0x14, 0x1e,
+  0x14, 0xb0, 0x54, 0xa7, 0x55, 0x3a, 0xa5, 0x55, 0x5a, 0x01, 0x5a, 0xa5,
+  0x55, 0x5a, 0xb5, 0x52, 0xe5, 0x21, 0x41, 0xf1, 0xcb, 0xde, 0x00, 0x00,
+  0x84, 0xf1, 0x01, 0x30, 0x84, 0x40, 0x08, 0x4e, 0x04, 0x70, 0x28, 0x80,
+  0x02, 0x28, 0x00, 0xa0, 0x24, 0x8d, 0x04, 0x02, 0x01, 0x00, 0x10, 0x12,
+  0xba, 0x02, 0x40, 0x04, 0x4f, 0x1b, 0x0b, 0x19, 0x00, 0x02, 0x29, 0x03,
+  0x01, 0x0a, 0x00, 0x01, 0x5e, 0x03, 0x03, 0x79, 0x03, 0x02, 0xa1, 0x05,
+  0xf5, 0x06, 0x48, 0x00, 0x77, 0x87, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28,
+  0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0x32, 0x4a, 0x1d, 0x24, 0xab, 0x4e,
+  0x07, 0xf6, 0x54, 0xb5, 0x4a, 0x39, 0x24, 0xaf, 0x14, 0x39, 0x24, 0x2f,
+  0x14, 0x79, 0x24, 0xd8, 0x12, 0xfb, 0x24, 0x48, 0x1c, 0xf9, 0x24, 0x4a,
+  0x1c, 0xf8, 0x24, 0x4a, 0x16, 0xf1, 0x24, 0x4a, 0x96, 0xe1, 0xa2, 0x64,
+  0x59, 0xac, 0xe4, 0x49, 0xc2, 0x4a, 0x1f, 0x49, 0xc2, 0x42, 0x1f, 0x49,
+  0x52, 0x28, 0x1f, 0x49, 0x32, 0x48, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48,
+  0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x4a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xab,
+  0x94, 0x43, 0xb2, 0x4a, 0x39, 0x24, 0x2b, 0x94, 0x47, 0x82, 0x29, 0xf9,
+  0x24, 0x48, 0x98, 0x4f, 0xa2, 0xf4, 0x1d, 0x5d, 0xc0, 0x42, 0x1f, 0xc1,
+  0xd6, 0x28, 0xf4, 0x11, 0x24, 0x42, 0x73, 0x00, 0xa3, 0xaf, 0x44, 0xd9,
+  0x41, 0xb2, 0x4a, 0x1b, 0xb5, 0x42, 0x3b, 0x74, 0x00, 0xf2, 0x1a, 0x59,
+  0x84, 0x2d, 0x91, 0x6f, 0x82, 0xd4, 0x12, 0xf9, 0x24, 0x5a, 0x1c, 0xf9,
+  0x24, 0xca, 0x1e, 0x81, 0x4f, 0xa2, 0x64, 0x19, 0x2e, 0x4a, 0x96, 0xc5,
+  0x4b, 0x9e, 0x25, 0xac, 0xf4, 0x91, 0x2c, 0xac, 0xf4, 0x91, 0x64, 0x85,
+  0xf2, 0x91, 0x64, 0x81, 0x74, 0x00, 0x00, 0x48, 0x00, 0x02, 0x44, 0x00,
+  0x23, 0x9b, 0x25, 0x75, 0x00, 0xf0, 0x02, 0x29, 0x78, 0x24, 0x98, 0x92,
+  0x6f, 0x82, 0x94, 0x82, 0x4f, 0xa2, 0xe5, 0x9d, 0x08, 0x86, 0x28, 0x88,
+  0x22, 0x01, 0x11, 0x40, 0x27, 0x01, 0x0b, 0x55, 0x07, 0x21, 0x40, 0x04,
+  0x19, 0x01, 0xa0, 0x25, 0x01, 0x2f, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x30,
+  0x28, 0x0f, 0x00, 0x90, 0x84, 0x00, 0x80, 0x08, 0x00, 0xc8, 0x20, 0x02,
+  0x28, 0x2a, 0x00, 0x00, 0xf6, 0x03, 0x11, 0x12, 0xf2, 0x02, 0x70, 0x02,
+  0x00, 0x00, 0x20, 0xf4, 0xf2, 0xf9, 0x4c, 0x05, 0xc0, 0x20, 0x08, 0x00,
+  0x88, 0x00, 0x20, 0x88, 0x22, 0x04, 0x48, 0x20, 0x86, 0x7c, 0x07, 0x20,
+  0x02, 0x82, 0x60, 0x04, 0x11, 0x88, 0x85, 0x01, 0xf6, 0x30, 0x1c, 0x04,
+  0x88, 0x11, 0x80, 0x81, 0x48, 0x01, 0x7f, 0xa9, 0x06, 0x20, 0x0c, 0x00,
+  0x00, 0x83, 0x88, 0x02, 0x41, 0x82, 0x22, 0x00, 0x83, 0x28, 0x22, 0x04,
+  0x48, 0x24, 0x2a, 0x04, 0xd2, 0xa0, 0x28, 0x80, 0x02, 0x88, 0x90, 0x81,
+  0x00, 0x83, 0x04, 0x42, 0x00, 0x2a, 0x08, 0x80, 0x01, 0x10, 0x04, 0x2a,
+  0x04, 0x20, 0x24, 0x82, 0x08, 0xc0, 0x12, 0x88, 0x14, 0x52, 0x3f, 0xbb,
+  0x0d, 0x65, 0x03, 0x11, 0x82, 0x06, 0x05, 0x02, 0xa8, 0x0e, 0x01, 0x01,
+  0x00, 0x71, 0x11, 0x00, 0x11, 0x00, 0x00, 0xb0, 0x29, 0x18, 0x04, 0x12,
+  0x21, 0x13, 0x00, 0x00, 0x0f, 0x02, 0x20, 0x00, 0x24, 0x34, 0x00, 0x01,
+  0xab, 0x00, 0x02, 0x01, 0x00, 0xf0, 0x03, 0xcf, 0x94, 0x05, 0x00, 0x82,
+  0x18, 0x82, 0x00, 0x18, 0x81, 0x00, 0x32, 0x8a, 0x04, 0x49, 0x08, 0x88,
+  0x28, 0xb4, 0x00, 0x00, 0xc9, 0x00, 0x80, 0x18, 0x58, 0x41, 0x00, 0x24,
+  0x80, 0x24, 0x28, 0x43, 0x00, 0x10, 0x88, 0xc6, 0x00, 0xf0, 0x06, 0x00,
+  0x5f, 0xd9, 0x0f, 0x00, 0x88, 0x18, 0x82, 0x00, 0x16, 0x42, 0x08, 0x80,
+  0x22, 0x08, 0x49, 0x08, 0x20, 0x02, 0x20, 0x28, 0xe4, 0x06, 0x90, 0x20,
+  0x12, 0x02, 0x80, 0x01, 0x00, 0x88, 0x20, 0x24, 0x58, 0x00, 0x02, 0x5d,
+  0x00, 0x22, 0x2d, 0x6f, 0x5f, 0x00, 0x21, 0x18, 0x48, 0x3a, 0x00, 0x01,
+  0x01, 0x00, 0x50, 0x12, 0x42, 0x41, 0x00, 0x24, 0x8b, 0x08, 0x00, 0x01,
+  0x00, 0xa0, 0x82, 0x00, 0x00, 0xe0, 0xdf, 0x05, 0x00, 0x00, 0x60, 0x24,
+  0xc9, 0x06, 0xd0, 0x00, 0x82, 0x12, 0x00, 0x20, 0x05, 0x00, 0x00, 0x18,
+  0x80, 0x04, 0x43, 0x02, 0x55, 0x0e, 0x01, 0x01, 0x00, 0xa0, 0x20, 0x08,
+  0x10, 0x01, 0x00, 0x00, 0x5b, 0x72, 0x00, 0x44, 0xde, 0x06, 0xc4, 0x28,
+  0x41, 0x20, 0x24, 0x88, 0x01, 0x28, 0x20, 0x8c, 0x04, 0x00, 0x92, 0x22,
+  0x00, 0x12, 0x80, 0xfa, 0x04, 0x91, 0x1b, 0x84, 0xc2, 0x00, 0x00, 0x12,
+  0xdf, 0x12, 0x0c, 0xb9, 0x00, 0x60, 0x88, 0x82, 0x00, 0x00, 0x40, 0x02,
+  0x89, 0x00, 0x23, 0x80, 0x02, 0x68, 0x01, 0x30, 0x28, 0x42, 0x20, 0x0b,
+  0x00, 0xf1, 0x13, 0x40, 0x19, 0x81, 0x08, 0x00, 0xf0, 0x1b, 0xcd, 0x00,
+  0x44, 0x84, 0x00, 0x20, 0x02, 0xa0, 0x82, 0x88, 0x80, 0x84, 0x08, 0x20,
+  0x03, 0x88, 0x48, 0x1a, 0x24, 0x08, 0x88, 0x00, 0x2a, 0x01, 0x42, 0xa0,
+  0x28, 0x4f, 0x00, 0xf0, 0x06, 0xa0, 0x42, 0x48, 0x80, 0x03, 0x00, 0x82,
+  0x20, 0x08, 0x89, 0x88, 0x28, 0x08, 0x00, 0x70, 0xaf, 0x0b, 0x00, 0x00,
+  0x80, 0x14, 0x68, 0x01, 0x24, 0x18, 0x82, 0x41, 0x03, 0x01, 0x54, 0x08,
+  0x03, 0x84, 0x00, 0x72, 0x24, 0x04, 0x00, 0x40, 0xf1, 0xe7, 0x63, 0x0e,
+  0x00, 0x10, 0x12, 0xe1, 0x00, 0x31, 0x18, 0x30, 0x14, 0x0d, 0x00, 0x65,
+  0x20, 0x01, 0x18, 0x00, 0x80, 0x01, 0xd0, 0x00, 0xb0, 0xf0, 0x1b, 0xe5,
+  0x10, 0x04, 0x00, 0x41, 0x41, 0x10, 0x14, 0x34, 0x20, 0x00, 0x30, 0x41,
+  0x20, 0x01, 0xc6, 0x07, 0x20, 0x10, 0x04, 0xbd, 0x06, 0x06, 0x01, 0x00,
+  0x51, 0x84, 0x81, 0xf0, 0xa6, 0xef, 0x0a, 0x00, 0x00, 0xd5, 0x0e, 0x0e,
+  0x01, 0x00, 0x7f, 0x10, 0x01, 0x00, 0x40, 0xf1, 0x1a, 0x66, 0x1a, 0x00,
+  0x00, 0x03, 0x01, 0x00, 0x70, 0x40, 0x01, 0x10, 0x08, 0x00, 0xcf, 0x94,
+  0x1e, 0x02, 0x11, 0x00, 0x8e, 0x00, 0x00, 0x84, 0x00, 0x00, 0xbb, 0x09,
+  0x03, 0xf6, 0x03, 0x03, 0x0b, 0x00, 0x55, 0x00, 0x00, 0xf0, 0x34, 0x2f,
+  0x35, 0x00, 0x13, 0x12, 0xf4, 0x02, 0x05, 0xad, 0x00, 0x01, 0x01, 0x00,
+  0xf0, 0x08, 0xf0, 0xf2, 0x22, 0x00, 0x10, 0x04, 0x88, 0x44, 0x30, 0x14,
+  0x44, 0x00, 0x90, 0x14, 0x00, 0x41, 0x44, 0x60, 0x41, 0x40, 0x04, 0x41,
+  0x00, 0x9f, 0x0b, 0x20, 0x20, 0x81, 0x03, 0x00, 0x04, 0x29, 0x00, 0x73,
+  0x40, 0x48, 0x08, 0x17, 0x75, 0x20, 0x28, 0xb1, 0x00, 0x01, 0x75, 0x00,
+  0x00, 0x03, 0x00, 0x08, 0xd9, 0x00, 0xb0, 0x14, 0x00, 0x40, 0x01, 0x3f,
+  0xd3, 0x0d, 0x84, 0xc1, 0x4d, 0x48, 0x42, 0x00, 0x50, 0x04, 0x44, 0x41,
+  0x28, 0x00, 0x4f, 0x00, 0xf0, 0x00, 0x50, 0x42, 0x80, 0x41, 0x84, 0xc8,
+  0x14, 0x00, 0x00, 0x14, 0x20, 0x41, 0x08, 0x48, 0x18, 0x82, 0x01, 0x01,
+  0xd4, 0x0a, 0xf0, 0x00, 0x85, 0x01, 0x10, 0x12, 0xf8, 0x4e, 0xa7, 0x10,
+  0x24, 0x58, 0x48, 0x20, 0x18, 0x04, 0x10, 0xb1, 0x06, 0xf1, 0x07, 0x41,
+  0x44, 0x12, 0x41, 0x40, 0x24, 0x11, 0x04, 0x40, 0x04, 0x4d, 0x14, 0x41,
+  0x12, 0x80, 0xa1, 0x11, 0x12, 0x80, 0x21, 0x21, 0x01, 0x33, 0x00, 0x00,
+  0x01, 0x00, 0x90, 0x50, 0x88, 0x85, 0x01, 0x8f, 0xf6, 0x08, 0x20, 0x18,
+  0xa3, 0x00, 0x61, 0x47, 0x41, 0x84, 0xd0, 0x44, 0x01, 0x65, 0x01, 0x14,
+  0x44, 0x75, 0x02, 0x04, 0x90, 0x00, 0xf0, 0x01, 0x10, 0x41, 0x41, 0x08,
+  0x14, 0xf0, 0x77, 0xa3, 0x00, 0xc4, 0x40, 0x04, 0x44, 0xd0, 0x44, 0x41,
+  0x46, 0x02, 0xb0, 0x1a, 0x81, 0x91, 0x14, 0x18, 0x4b, 0x11, 0x18, 0x49,
+  0xc1, 0x14, 0x91, 0x02, 0x83, 0x20, 0x01, 0x18, 0x12, 0x12, 0x00, 0x12,
+  0x12, 0x32, 0x00, 0x71, 0x40, 0x08, 0x40, 0x48, 0xf8, 0xa3, 0xf5, 0xae,
+  0x01, 0xa0, 0x18, 0x80, 0x01, 0x20, 0x01, 0x40, 0x24, 0x41, 0x04, 0x44,
+  0x1e, 0x00, 0x01, 0x50, 0x01, 0x07, 0xe7, 0x01, 0xf0, 0x0f, 0x11, 0x81,
+  0x00, 0x10, 0xf8, 0x19, 0x11, 0x10, 0x54, 0x44, 0xc5, 0x58, 0x44, 0x4c,
+  0x58, 0x44, 0xf0, 0x14, 0x14, 0x4f, 0x41, 0xd1, 0x44, 0x81, 0x01, 0x18,
+  0x00, 0x41, 0x45, 0xf4, 0x0d, 0x00, 0xf0, 0x04, 0x11, 0x04, 0x45, 0xc4,
+  0x14, 0x00, 0xa0, 0x11, 0x47, 0x41, 0x1a, 0xa1, 0x11, 0x18, 0x12, 0x20,
+  0x21, 0x01, 0x1a, 0x21, 0x07, 0x03, 0xc3, 0x00, 0xf2, 0x50, 0x95, 0x58,
+  0x88, 0x85, 0x18, 0x58, 0x88, 0x1f, 0x2d, 0x04, 0x41, 0x4f, 0xc4, 0x54,
+  0x88, 0x4d, 0x44, 0x44, 0x45, 0x04, 0x45, 0x54, 0x44, 0x4d, 0x14, 0x4c,
+  0x81, 0xe1, 0x42, 0x03, 0x28, 0x80, 0xf1, 0x14, 0x14, 0x1a, 0x11, 0xd4,
+  0x24, 0xd1, 0x46, 0xd1, 0x44, 0xb1, 0x12, 0x01, 0x8a, 0xa9, 0x11, 0x1a,
+  0x08, 0xa0, 0x11, 0x1d, 0x11, 0x40, 0x71, 0x18, 0x28, 0xe1, 0x85, 0xa5,
+  0x11, 0x1a, 0x24, 0x21, 0x21, 0x01, 0x00, 0x45, 0x04, 0x2e, 0x24, 0x80,
+  0x02, 0x00, 0x85, 0x58, 0x88, 0x24, 0x21, 0x14, 0xaf, 0x81, 0xf1, 0xb2,
+  0x37, 0x40, 0xd4, 0x44, 0x54, 0xc8, 0x45, 0x54, 0x44, 0x03, 0x00, 0xf2,
+  0x18, 0x16, 0x64, 0x41, 0xa0, 0x31, 0x00, 0x49, 0xd1, 0x44, 0xd1, 0x44,
+  0xa1, 0x11, 0x4d, 0x14, 0x18, 0x61, 0x1a, 0x81, 0x01, 0x4d, 0x84, 0x12,
+  0x4d, 0x14, 0x00, 0x18, 0x16, 0x21, 0x21, 0xe1, 0x81, 0x01, 0x1a, 0x05,
+  0x1a, 0x01, 0x1a, 0x01, 0xf3, 0x04, 0xf0, 0x07, 0x40, 0x51, 0x89, 0x85,
+  0x58, 0x8a, 0x84, 0x8d, 0x18, 0x1f, 0x98, 0x05, 0x44, 0xcd, 0x44, 0xc5,
+  0x7c, 0x44, 0x74, 0x84, 0x54, 0x44, 0xcc, 0x00, 0xf0, 0x24, 0x45, 0x74,
+  0x14, 0x24, 0xa1, 0x11, 0x4b, 0x31, 0x20, 0x92, 0x14, 0x4d, 0x14, 0x4f,
+  0x41, 0xf1, 0x14, 0x14, 0x4d, 0x14, 0x4d, 0x14, 0x6f, 0x41, 0xf1, 0x14,
+  0x16, 0x18, 0xf0, 0x14, 0x84, 0x12, 0x4f, 0x48, 0x01, 0x1a, 0xa1, 0x11,
+  0x1c, 0x21, 0x31, 0x11, 0x1e, 0x18, 0x1a, 0xb1, 0x18, 0xa5, 0x11, 0x5a,
+  0xa1, 0xc1, 0x07, 0x40, 0x00, 0x40, 0x04, 0x49, 0x38, 0x04, 0x91, 0x85,
+  0x08, 0xa5, 0x58, 0xb8, 0x8d, 0x18, 0xf6, 0x0c, 0x06, 0x03, 0x10, 0x41,
+  0x98, 0x02, 0x00, 0xc7, 0x09, 0x00, 0x25, 0x05, 0x06, 0x35, 0x03, 0x02,
+  0x08, 0x03, 0x20, 0x5b, 0x7f, 0x08, 0x00, 0x16, 0x04, 0x1b, 0x04, 0x01,
+  0x2f, 0x01, 0x04, 0xd7, 0x01, 0x00, 0x01, 0x00, 0xf2, 0x03, 0x2f, 0xbe,
+  0x07, 0x2c, 0xf4, 0x11, 0x24, 0x85, 0xf2, 0x11, 0x24, 0x83, 0xf4, 0x11,
+  0x24, 0xa3, 0xd4, 0x41, 0x61, 0x06, 0x2d, 0xd9, 0x81, 0xa5, 0x06, 0x1f,
+  0xf9, 0xa5, 0x06, 0x34, 0x70, 0xd4, 0x46, 0x05, 0x2c, 0xf4, 0x11, 0x6c,
+  0x77, 0x00, 0x07, 0x73, 0x00, 0xf2, 0x14, 0xf2, 0x42, 0x94, 0x19, 0xf2,
+  0x4a, 0xa4, 0x59, 0xb2, 0x4a, 0x29, 0xf2, 0x4a, 0x81, 0x43, 0xf2, 0x42,
+  0x91, 0x26, 0xd8, 0x12, 0xf8, 0x26, 0x48, 0x2d, 0x81, 0x4f, 0xa2, 0xc5,
+  0x81, 0x2e, 0xda, 0x1e, 0x81, 0x2e, 0x73, 0x00, 0x70, 0xbc, 0xe4, 0x58,
+  0xc2, 0x4a, 0x1f, 0xc8, 0x77, 0x00, 0xc7, 0xd6, 0x28, 0xf4, 0x81, 0x24,
+  0x83, 0xf4, 0x81, 0x24, 0xa3, 0xf4, 0x81, 0xe9, 0x06, 0x05, 0xa5, 0x06,
+  0x02, 0x75, 0x00, 0xa3, 0x26, 0x48, 0x29, 0xf9, 0x24, 0x5a, 0xef, 0x11,
+  0x0e, 0x20, 0xa5, 0x06, 0x01, 0x90, 0x06, 0x40, 0x21, 0x80, 0x01, 0x88,
+  0xf5, 0x03, 0x21, 0x40, 0x08, 0xe5, 0x0a, 0x02, 0x10, 0x0e, 0x80, 0x50,
+  0x12, 0xf0, 0xcd, 0x76, 0x80, 0x02, 0x00, 0xbc, 0x0b, 0x73, 0x00, 0x88,
+  0x00, 0x82, 0x00, 0x88, 0x22, 0x4c, 0x0b, 0x00, 0xab, 0x02, 0x03, 0x37,
+  0x06, 0x50, 0x80, 0x08, 0x00, 0x50, 0x86, 0x8a, 0x05, 0x30, 0x22, 0x40,
+  0x08, 0x61, 0x0d, 0x60, 0x38, 0x42, 0x20, 0x04, 0x88, 0x48, 0x32, 0x05,
+  0x00, 0xb4, 0x05, 0xf0, 0x19, 0x82, 0x20, 0x08, 0x00, 0x8a, 0x02, 0x80,
+  0x08, 0x4a, 0x08, 0x88, 0x20, 0x04, 0x42, 0x14, 0x88, 0x14, 0xf0, 0x37,
+  0x13, 0x80, 0x22, 0x0c, 0x00, 0x80, 0x02, 0x84, 0x10, 0x84, 0x28, 0x22,
+  0x0c, 0xa0, 0x1a, 0x42, 0x20, 0x4c, 0x22, 0x08, 0x92, 0x2c, 0x00, 0x11,
+  0x19, 0xee, 0x0d, 0xf0, 0x05, 0x18, 0x82, 0x00, 0xa0, 0x28, 0x10, 0x84,
+  0x28, 0x82, 0x0c, 0x88, 0x80, 0x04, 0xc2, 0x24, 0x88, 0x14, 0x12, 0x9f,
+  0xbe, 0x3c, 0x0c, 0x03, 0x74, 0x08, 0x00, 0x0e, 0x0b, 0x01, 0x3f, 0x05,
+  0x02, 0x81, 0x04, 0x01, 0xad, 0x06, 0x53, 0x10, 0x01, 0x00, 0x1f, 0x2a,
+  0x20, 0x00, 0x02, 0xab, 0x05, 0x01, 0x01, 0x00, 0x09, 0x86, 0x04, 0x20,
+  0xe0, 0xb7, 0x1a, 0x06, 0x01, 0x52, 0x0b, 0x34, 0x1c, 0x08, 0xc8, 0xbd,
+  0x06, 0x18, 0x41, 0x23, 0x00, 0x43, 0x00, 0xff, 0xc9, 0x0f, 0x58, 0x00,
+  0x20, 0x80, 0x08, 0xb9, 0x00, 0x01, 0x01, 0x00, 0x09, 0x57, 0x05, 0x31,
+  0x00, 0x1f, 0xc7, 0x2b, 0x07, 0x55, 0x20, 0x02, 0x20, 0x08, 0x14, 0x8f,
+  0x0b, 0x0a, 0x46, 0x00, 0x30, 0x3f, 0x5a, 0x0d, 0xf5, 0x08, 0x01, 0xa4,
+  0x0b, 0x02, 0x32, 0x0c, 0x01, 0x53, 0x00, 0x42, 0x20, 0x08, 0x80, 0x02,
+  0x4d, 0x00, 0xf0, 0x09, 0x82, 0x82, 0x12, 0x00, 0xf0, 0x2d, 0x66, 0x00,
   0x10, 0x88, 0x81, 0x02, 0x40, 0x08, 0x20, 0x12, 0x08, 0x8a, 0x01, 0x48,
-  0x28, 0x00, 0xa0, 0x84, 0x00, 0x82, 0x20, 0x04, 0x44, 0x48, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x4a, 0x81, 0x08, 0x21, 0x20, 0x22, 0x28, 0x04,
-  0x00, 0x80, 0x28, 0x04, 0x00, 0x88, 0x86, 0xd8, 0xee, 0x08, 0x00, 0x00,
-  0x00, 0x40, 0x24, 0x31, 0x21, 0xc2, 0x00, 0x00, 0x82, 0x00, 0xc8, 0x40,
-  0x81, 0x08, 0x00, 0x00, 0x00, 0x80, 0x08, 0xa0, 0x2c, 0x00, 0x00, 0x00,
-  0x90, 0x28, 0x20, 0x88, 0x22, 0x08, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x64, 0xba, 0x00, 0x10, 0x88, 0x21, 0x02, 0x10, 0x08, 0x1c, 0xa2,
-  0xa4, 0x84, 0x80, 0x04, 0x88, 0x2a, 0x04, 0x4a, 0x08, 0x13, 0x2c, 0x08,
-  0x88, 0x80, 0x04, 0x44, 0x42, 0x20, 0x08, 0xa0, 0xc2, 0x00, 0x28, 0x88,
-  0x00, 0x28, 0xa2, 0x80, 0x88, 0x82, 0x8a, 0x88, 0x04, 0x88, 0x00, 0x82,
-  0x88, 0x00, 0x00, 0x8c, 0xb8, 0x66, 0x09, 0x00, 0x00, 0x80, 0x04, 0x44,
-  0x18, 0x00, 0x00, 0x92, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x14, 0x08, 0x21, 0x80, 0x01,
-  0x00, 0x18, 0x00, 0x20, 0x24, 0x88, 0x01, 0x88, 0xf0, 0x38, 0xe4, 0x00,
-  0x00, 0x15, 0x44, 0x08, 0x00, 0x00, 0x24, 0x10, 0x01, 0x21, 0x00, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x20, 0x01, 0x00, 0x24, 0x00,
-  0x00, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f,
-  0xc6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xd1, 0x03, 0x00, 0x10, 0x08,
-  0x10, 0x88, 0x04, 0x11, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0xa0,
-  0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xe0, 0x13, 0x0d, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x2f, 0xaa,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x40, 0x08, 0x00, 0x48, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x00, 0x88, 0x10, 0x08, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x9d, 0xc4, 0x00, 0x00, 0x00, 0x40, 0x08, 0x40,
-  0x01, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-  0x00, 0x00, 0xb0, 0xcc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x40, 0x01, 0x00, 0x80, 0x04, 0x54, 0x00, 0x00, 0x48, 0x40,
-  0x04, 0x00, 0x21, 0x00, 0x44, 0x00, 0x10, 0x02, 0x18, 0x80, 0x88, 0x02,
-  0x21, 0x80, 0x01, 0x88, 0x40, 0x08, 0x00, 0x00, 0x28, 0x84, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x9f, 0xd2, 0x01, 0x00, 0x14, 0x00, 0x00, 0x48,
-  0x40, 0x55, 0x88, 0x28, 0x10, 0x82, 0x04, 0x44, 0x80, 0x02, 0x21, 0x00,
-  0x44, 0x80, 0x02, 0x21, 0x48, 0x18, 0x80, 0x88, 0x02, 0x21, 0x48, 0x18,
-  0x44, 0x88, 0x28, 0x84, 0x21, 0x48, 0x40, 0x84, 0xa1, 0x21, 0x84, 0x21,
-  0x48, 0xe0, 0x41, 0x01, 0x28, 0x10, 0xa2, 0x11, 0x40, 0xf4, 0x94, 0xca,
-  0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x48, 0x04, 0x00, 0x00, 0x40,
-  0x04, 0x00, 0x21, 0x00, 0x44, 0x00, 0x10, 0x02, 0x00, 0x80, 0x02, 0x21,
-  0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x84, 0x20, 0x01, 0x00, 0x20,
-  0x01, 0x9f, 0x96, 0x06, 0x00, 0x14, 0x00, 0x00, 0x48, 0x40, 0x05, 0x00,
-  0x80, 0x04, 0x44, 0x00, 0x10, 0x02, 0x40, 0x04, 0x00, 0x21, 0x80, 0x01,
-  0x88, 0x38, 0x10, 0x02, 0x18, 0x80, 0x08, 0x84, 0x88, 0x00, 0x00, 0x28,
-  0x84, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x3e, 0x92, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10,
-  0x02, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00,
-  0x80, 0x04, 0x44, 0x80, 0x02, 0x21, 0x48, 0x40, 0x04, 0x00, 0x21, 0x48,
-  0x40, 0x04, 0x00, 0x21, 0xef, 0xa2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-  0x40, 0x04, 0x00, 0x00, 0x10, 0x02, 0x40, 0x04, 0x00, 0x21, 0x00, 0x00,
-  0x00, 0x21, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00,
-  0x00, 0xf0, 0x2a, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbd, 0x3a, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02,
-  0x40, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x80, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0xf0, 0xd8, 0x48, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x28, 0x00, 0xa0, 0x84, 0x28, 0x0f, 0x10, 0x44, 0x32, 0x00, 0xf0, 0x05,
+  0x80, 0x02, 0x00, 0x4a, 0x81, 0x08, 0x21, 0x20, 0x22, 0x28, 0x04, 0x00,
+  0x80, 0x28, 0x04, 0x00, 0x88, 0x86, 0xd8, 0xee, 0x8e, 0x00, 0x50, 0x40,
+  0x24, 0x31, 0x21, 0xc2, 0xf6, 0x06, 0x32, 0xc8, 0x40, 0x81, 0x26, 0x07,
+  0xd0, 0xa0, 0x2c, 0x00, 0x00, 0x00, 0x90, 0x28, 0x20, 0x88, 0x22, 0x08,
+  0x00, 0x98, 0x66, 0x00, 0xf0, 0x28, 0xf0, 0x64, 0xba, 0x00, 0x10, 0x88,
+  0x21, 0x02, 0x10, 0x08, 0x1c, 0xa2, 0xa4, 0x84, 0x80, 0x04, 0x88, 0x2a,
+  0x04, 0x4a, 0x08, 0x13, 0x2c, 0x08, 0x88, 0x80, 0x04, 0x44, 0x42, 0x20,
+  0x08, 0xa0, 0xc2, 0x00, 0x28, 0x88, 0x00, 0x28, 0xa2, 0x80, 0x88, 0x82,
+  0x8a, 0x88, 0x04, 0x88, 0x00, 0x82, 0x88, 0x00, 0x00, 0x8c, 0xb8, 0x66,
+  0x09, 0xd7, 0x01, 0x53, 0x44, 0x18, 0x00, 0x00, 0x92, 0xd4, 0x00, 0x03,
+  0x3b, 0x01, 0x41, 0x1a, 0x14, 0x08, 0x21, 0x87, 0x05, 0x00, 0x35, 0x07,
+  0xf2, 0x00, 0x88, 0xf0, 0x38, 0xe4, 0x00, 0x00, 0x15, 0x44, 0x08, 0x00,
+  0x00, 0x24, 0x10, 0x01, 0x21, 0xbe, 0x06, 0x11, 0x44, 0x21, 0x01, 0x00,
+  0x10, 0x08, 0x14, 0x81, 0x48, 0x03, 0x32, 0x9f, 0xc6, 0x03, 0x09, 0x00,
+  0x0f, 0x01, 0x00, 0x04, 0x3f, 0xf0, 0x4f, 0xfe, 0x16, 0x00, 0x00, 0x07,
+  0x01, 0x00, 0x3f, 0xff, 0xe4, 0x0f, 0x16, 0x00, 0x00, 0x06, 0x01, 0x00,
+  0x0f, 0x41, 0x00, 0x24, 0x07, 0x1a, 0x02, 0xa2, 0x8f, 0xd1, 0x03, 0x00,
+  0x10, 0x08, 0x10, 0x88, 0x04, 0x11, 0xa7, 0x0d, 0x06, 0x20, 0x00, 0x40,
+  0x84, 0x00, 0x00, 0xa0, 0xea, 0x08, 0x52, 0x18, 0x00, 0x00, 0xe0, 0x13,
+  0xfd, 0x06, 0x0f, 0x01, 0x00, 0x05, 0x0e, 0x87, 0x00, 0x0a, 0xf7, 0x06,
+  0x41, 0x00, 0xf0, 0x4f, 0xeb, 0x08, 0x00, 0x00, 0x80, 0x08, 0x0e, 0x01,
+  0x00, 0x00, 0x48, 0x09, 0x2f, 0x2f, 0xaa, 0x9d, 0x07, 0x02, 0x05, 0x01,
+  0x00, 0x0f, 0xea, 0x00, 0x12, 0x52, 0x40, 0x08, 0x00, 0x48, 0x00, 0x2b,
+  0x08, 0x00, 0x01, 0x00, 0x01, 0x85, 0x00, 0x10, 0x88, 0xf6, 0x07, 0x12,
+  0x1a, 0xd6, 0x09, 0x32, 0xf0, 0x9d, 0xc4, 0x7c, 0x06, 0x16, 0x01, 0x41,
+  0x0e, 0x08, 0xbd, 0x09, 0x50, 0x38, 0x00, 0x00, 0xb0, 0xcc, 0xf5, 0x08,
+  0x0f, 0x01, 0x00, 0x07, 0x00, 0x88, 0x00, 0x01, 0x3f, 0x00, 0x70, 0x54,
+  0x00, 0x00, 0x48, 0x40, 0x04, 0x00, 0xfd, 0x01, 0x00, 0xd8, 0x0a, 0x20,
+  0x88, 0x02, 0x38, 0x04, 0x00, 0x1c, 0x0c, 0x22, 0x28, 0x84, 0x0f, 0x04,
+  0x30, 0x9f, 0xd2, 0x01, 0x8c, 0x00, 0xc0, 0x48, 0x40, 0x55, 0x88, 0x28,
+  0x10, 0x82, 0x04, 0x44, 0x80, 0x02, 0x21, 0x4d, 0x04, 0x21, 0x21, 0x48,
+  0x2d, 0x00, 0xf1, 0x0b, 0x48, 0x18, 0x44, 0x88, 0x28, 0x84, 0x21, 0x48,
+  0x40, 0x84, 0xa1, 0x21, 0x84, 0x21, 0x48, 0xe0, 0x41, 0x01, 0x28, 0x10,
+  0xa2, 0x11, 0x40, 0xf4, 0x94, 0xca, 0xdb, 0x07, 0x32, 0x00, 0x10, 0x48,
+  0xea, 0x03, 0x02, 0x60, 0x00, 0x20, 0x00, 0x80, 0x5f, 0x00, 0x01, 0xa1,
+  0x05, 0x11, 0x84, 0x24, 0x07, 0x32, 0x9f, 0x96, 0x06, 0x5d, 0x00, 0x10,
+  0x05, 0xaf, 0x02, 0x30, 0x00, 0x10, 0x02, 0x2b, 0x00, 0x41, 0x80, 0x01,
+  0x88, 0x38, 0x64, 0x0b, 0x26, 0x84, 0x88, 0x87, 0x00, 0x15, 0x3e, 0xdd,
+  0x09, 0x0f, 0x01, 0x00, 0x03, 0x0f, 0x63, 0x02, 0x11, 0x12, 0x10, 0x3f,
+  0x01, 0x11, 0x28, 0x89, 0x00, 0x00, 0x57, 0x00, 0x00, 0x3e, 0x01, 0x11,
+  0x80, 0xd3, 0x00, 0x01, 0x04, 0x01, 0x01, 0x05, 0x00, 0x3d, 0xef, 0xa2,
+  0x0a, 0x3d, 0x00, 0x08, 0x01, 0x00, 0x03, 0x3a, 0x01, 0x41, 0x00, 0x00,
+  0x00, 0x54, 0xc3, 0x04, 0x02, 0xb4, 0x00, 0x02, 0x71, 0x05, 0x00, 0x16,
+  0x00, 0x00, 0x3c, 0x01, 0x4d, 0x00, 0xf0, 0x2a, 0x8c, 0x39, 0x00, 0x09,
+  0x01, 0x00, 0x00, 0xaf, 0x00, 0x03, 0xe2, 0x01, 0x04, 0x08, 0x05, 0x0a,
+  0x01, 0x00, 0x32, 0xf0, 0xbd, 0x3a, 0x09, 0x00, 0x20, 0x40, 0x05, 0x06,
+  0x00, 0x0f, 0x66, 0x00, 0x03, 0x3f, 0xd8, 0x48, 0xff, 0x01, 0x00, 0x1b,
+  0x00
 };
+const unsigned int USB_1208HS_rbf_lz_len = 58321;
 const unsigned int USB_1208HS_rbf_len = 72381;
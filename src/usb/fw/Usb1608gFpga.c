@@ -1,938 +1,702 @@
 ///////////////////////////////////////////////////////////////////
 //
 // Usb1608gFpga.c
-// - created using the xxd command of Debian based systems
+// - created using fpga2c.py
 // - created from 'USB_1608G.rbf'
-// - xxd -i USB_1608G.rbf > Usb1608hsFpga.c
+// - python3 fpga2c.py USB_1608G_rbf USB_1608G.rbf
+//
 ///////////////////////////////////////////////////////////////////
 
-const unsigned char USB_1608G_rbf[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x6a, 0xde, 0xff, 0x7f, 0x00, 0x24, 0x03, 0x09,
-  0x00, 0x6a, 0xde, 0xff, 0x7f, 0x00, 0x24, 0x03, 0x09, 0x00, 0x6a, 0xde,
-  0xff, 0x7f, 0x00, 0x24, 0x03, 0x09, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x44, 0x55, 0x54, 0x44, 0x55, 0x55, 0x74, 0x75, 0x57, 0x77, 0x75, 0x57,
-  0x77, 0x75, 0x57, 0x77, 0x75, 0x57, 0x77, 0x65, 0x56, 0x66, 0x65, 0x56,
-  0x36, 0x25, 0x52, 0x32, 0x35, 0xd2, 0xa3, 0x79, 0xd2, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x15,
-  0x51, 0x11, 0x15, 0x51, 0x11, 0x15, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22,
-  0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x11, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x2f, 0x21,
-  0xf1, 0x12, 0x12, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x25, 0x52, 0x22, 0x25,
-  0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22,
-  0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22,
-  0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x21,
-  0xf1, 0x12, 0x12, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x25, 0x52, 0x22,
-  0x25, 0x52, 0x22, 0x00, 0x1a, 0xa1, 0x11, 0x2f, 0x21, 0xf1, 0x12, 0x12,
-  0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x1a, 0xa1,
-  0x11, 0x00, 0x25, 0x52, 0x22, 0x00, 0x1a, 0xa1, 0x11, 0x00, 0x25, 0x52,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x25, 0x52, 0x22, 0x00, 0x00, 0x75, 0x57, 0x77, 0x1f, 0x1b, 0xfb,
-  0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x00, 0x00, 0x25, 0x52,
-  0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52,
-  0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0x25, 0x52,
-  0x22, 0x00, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x44,
-  0xf4, 0x44, 0x44, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0x54, 0x44, 0x45, 0x54, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4f, 0x44, 0xf4, 0x44, 0x44, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0x6f,
-  0x64, 0xf4, 0x46, 0x46, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84,
-  0x84, 0x6f, 0x69, 0xf9, 0x96, 0x96, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00,
-  0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x4f, 0x44, 0xf4, 0x44, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x4f, 0x48,
-  0xf8, 0x84, 0x84, 0x25, 0x52, 0x22, 0x00, 0x4a, 0xa4, 0x44, 0x4a, 0xa4,
-  0x44, 0x6f, 0x6c, 0xfc, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xa8,
-  0x88, 0x2f, 0x29, 0xf9, 0x92, 0x92, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00,
-  0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x6f, 0x65, 0xf5, 0x56, 0x56,
-  0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44,
-  0x44, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x8a, 0xa8, 0x88, 0x2f, 0x21, 0xf1,
-  0x12, 0x12, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x6a, 0xa6, 0x66, 0x3f,
-  0x38, 0xf8, 0x83, 0x83, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x6f, 0x6d,
-  0xfd, 0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x8c, 0xfc, 0xc8, 0xc8,
-  0xaf, 0xac, 0xfc, 0xca, 0xca, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0xc5,
-  0x5c, 0xcc, 0xc5, 0x5c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x45, 0x54, 0x44,
-  0x45, 0x54, 0x44, 0x8f, 0x8c, 0xfc, 0xc8, 0xc8, 0x25, 0x52, 0x22, 0x00,
-  0x45, 0x54, 0x44, 0x45, 0x54, 0x44, 0xef, 0xec, 0xfc, 0xce, 0xce, 0x00,
-  0x00, 0x00, 0x00, 0xcf, 0xcc, 0xfc, 0xcc, 0xcc, 0xcf, 0xcc, 0xfc, 0xcc,
-  0xcc, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x5c, 0xcc, 0xe5, 0x5e, 0xee, 0x25,
-  0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x22, 0xef, 0xec, 0xfc,
-  0xce, 0xce, 0x00, 0x00, 0x25, 0x52, 0x22, 0x25, 0x52, 0x22, 0xef, 0xec,
-  0xfc, 0xce, 0xce, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c,
-  0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4,
-  0x4c, 0x4c, 0xef, 0xe4, 0xf4, 0x4e, 0x4e, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0x8f, 0x84, 0xf4, 0x48, 0x48, 0xaf, 0xa4, 0xf4, 0x4a, 0x4a, 0x6f,
-  0x68, 0xf8, 0x86, 0x86, 0x00, 0x00, 0xaf, 0xa4, 0xf4, 0x4a, 0x4a, 0xaf,
-  0xa4, 0xf4, 0x4a, 0x4a, 0xef, 0xec, 0xfc, 0xce, 0xce, 0x00, 0x00, 0x00,
-  0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0x00,
-  0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x6f, 0x64, 0xf4, 0x46,
-  0x46, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44,
-  0x6f, 0x64, 0xf4, 0x46, 0x46, 0x2f, 0x28, 0xf8, 0x82, 0x82, 0x00, 0x00,
-  0x6f, 0x64, 0xf4, 0x46, 0x46, 0x6f, 0x64, 0xf4, 0x46, 0x46, 0x6f, 0x6c,
-  0xfc, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c,
-  0xcf, 0xcb, 0xfb, 0xbc, 0xbc, 0x3a, 0xa3, 0x33, 0x00, 0x00, 0x00, 0xcf,
-  0xc4, 0xf4, 0x4c, 0x4c, 0xef, 0xe5, 0xf5, 0x5e, 0x5e, 0x2f, 0x21, 0xf1,
-  0x12, 0x12, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x6f, 0x64,
-  0xf4, 0x46, 0x46, 0xaf, 0xa8, 0xf8, 0x8a, 0x8a, 0x3a, 0xa3, 0x33, 0x00,
-  0x5f, 0x52, 0xf2, 0x25, 0x25, 0x5f, 0x5f, 0xff, 0xf5, 0xf5, 0x00, 0x6f,
-  0x64, 0xf4, 0x46, 0x46, 0x6f, 0x64, 0xf4, 0x46, 0x46, 0xef, 0xef, 0xff,
-  0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0x88, 0xba, 0xab, 0xbb,
-  0x3a, 0xa3, 0x33, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xef,
-  0xe5, 0xf5, 0x5e, 0x5e, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x00, 0x00,
-  0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xef, 0xe4, 0xf4, 0x4e, 0x4e, 0x2f, 0x28,
-  0xf8, 0x82, 0x82, 0x1a, 0xa1, 0x11, 0x00, 0xef, 0xe4, 0xf4, 0x4e, 0x4e,
-  0xef, 0xe4, 0xf4, 0x4e, 0x4e, 0xef, 0xed, 0xfd, 0xde, 0xde, 0x00, 0x00,
-  0x00, 0x00, 0x4a, 0xa4, 0x44, 0x1f, 0x14, 0xf4, 0x41, 0x41, 0x15, 0x51,
-  0x11, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xef, 0xeb, 0xfb,
-  0xbe, 0xbe, 0x2f, 0x23, 0xf3, 0x32, 0x32, 0x00, 0x00, 0x00, 0xcf, 0xc8,
-  0xf8, 0x8c, 0x8c, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0x2f, 0x27, 0xf7, 0x72,
-  0x72, 0x00, 0x00, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0xef, 0xeb, 0xfb, 0xbe,
-  0xbe, 0xef, 0xef, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x84,
-  0xf4, 0x48, 0x48, 0x9f, 0x95, 0xf5, 0x59, 0x59, 0x1f, 0x11, 0xf1, 0x11,
-  0x11, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xff, 0xfb, 0xfb,
-  0xbf, 0xbf, 0x3f, 0x33, 0xf3, 0x33, 0x33, 0x00, 0x00, 0x00, 0x4f, 0x48,
-  0xf8, 0x84, 0x84, 0x7f, 0x7a, 0xfa, 0xa7, 0xa7, 0xbf, 0xb6, 0xf6, 0x6b,
-  0x6b, 0x1a, 0xa1, 0x11, 0x00, 0x7f, 0x7a, 0xfa, 0xa7, 0xa7, 0x7f, 0x7a,
-  0xfa, 0xa7, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xff, 0xf4, 0xf4, 0x4f, 0x4f, 0x35, 0x53,
-  0x33, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84, 0x5f, 0x5b, 0xfb,
-  0xb5, 0xb5, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x4f, 0x48,
-  0xf8, 0x84, 0x84, 0x4f, 0x4b, 0xfb, 0xb4, 0xb4, 0x7a, 0xa7, 0x77, 0x35,
-  0x53, 0x33, 0x00, 0x4f, 0x4b, 0xfb, 0xb4, 0xb4, 0x4f, 0x4b, 0xfb, 0xb4,
-  0xb4, 0x7f, 0x7f, 0xff, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x45, 0x54,
-  0x44, 0x4f, 0x42, 0xf2, 0x24, 0x24, 0x2a, 0xa2, 0x22, 0x00, 0x00, 0x00,
-  0xcf, 0xcc, 0xfc, 0xcc, 0xcc, 0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x3f, 0x31,
-  0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0xcf, 0xcc, 0xfc, 0xcc, 0xcc, 0xff,
-  0xfd, 0xfd, 0xdf, 0xdf, 0x3f, 0x31, 0xf1, 0x13, 0x13, 0x00, 0xcf, 0xc4,
-  0xf4, 0x4c, 0x4c, 0x8f, 0x8c, 0xfc, 0xc8, 0xc8, 0x00, 0x00, 0xff, 0xfd,
-  0xfd, 0xdf, 0xdf, 0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0xff, 0xfd, 0xfd, 0xdf,
-  0xdf, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xa4, 0x44, 0x6a, 0xa6, 0x66, 0x2a,
-  0xa2, 0x22, 0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xff, 0xf9,
-  0xf9, 0x9f, 0x9f, 0x3f, 0x31, 0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0xcf,
-  0xc8, 0xf8, 0x8c, 0x8c, 0xff, 0xf9, 0xf9, 0x9f, 0x9f, 0x3f, 0x35, 0xf5,
-  0x53, 0x53, 0x00, 0x00, 0xff, 0xf9, 0xf9, 0x9f, 0x9f, 0xff, 0xf9, 0xf9,
-  0x9f, 0x9f, 0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xcf,
-  0xc4, 0xf4, 0x4c, 0x4c, 0xcf, 0xc6, 0xf6, 0x6c, 0x6c, 0x2a, 0xa2, 0x22,
-  0x00, 0x00, 0x00, 0xcf, 0xc8, 0xf8, 0x8c, 0x8c, 0xff, 0xf9, 0xf9, 0x9f,
-  0x9f, 0x3f, 0x31, 0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8,
-  0x84, 0x84, 0x7f, 0x79, 0xf9, 0x97, 0x97, 0xbf, 0xb5, 0xf5, 0x5b, 0x5b,
-  0x00, 0x00, 0x7f, 0x79, 0xf9, 0x97, 0x97, 0x7f, 0x79, 0xf9, 0x97, 0x97,
-  0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8,
-  0x84, 0x84, 0x6f, 0x68, 0xf8, 0x86, 0x86, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xdf, 0xd7, 0xf7, 0x7d, 0x7d, 0x1f,
-  0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c,
-  0xdf, 0xd7, 0xf7, 0x7d, 0x7d, 0x1f, 0x1b, 0xfb, 0xb1, 0xb1, 0x25, 0x52,
-  0x22, 0x00, 0xdf, 0xd7, 0xf7, 0x7d, 0x7d, 0xdf, 0xd7, 0xf7, 0x7d, 0x7d,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8,
-  0x84, 0x84, 0x6f, 0x68, 0xf8, 0x86, 0x86, 0x25, 0x52, 0x22, 0x00, 0x00,
-  0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xff, 0xf7, 0xf7, 0x7f, 0x7f, 0x3f,
-  0x33, 0xf3, 0x33, 0x33, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c,
-  0xff, 0xf7, 0xf7, 0x7f, 0x7f, 0x3f, 0x3b, 0xfb, 0xb3, 0xb3, 0x00, 0x00,
-  0xff, 0xf7, 0xf7, 0x7f, 0x7f, 0xff, 0xf7, 0xf7, 0x7f, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x48, 0xf8, 0x84, 0x84,
-  0x6f, 0x68, 0xf8, 0x86, 0x86, 0x25, 0x52, 0x22, 0x00, 0x00, 0x00, 0xcf,
-  0xc4, 0xf4, 0x4c, 0x4c, 0xdf, 0xd7, 0xf7, 0x7d, 0x7d, 0x1f, 0x13, 0xf3,
-  0x31, 0x31, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0xf4, 0x4c, 0x4c, 0xdf, 0xd7,
-  0xf7, 0x7d, 0x7d, 0x1f, 0x1b, 0xfb, 0xb1, 0xb1, 0xcf, 0xcc, 0xfc, 0xcc,
-  0xcc, 0x2f, 0x21, 0xf1, 0x12, 0x12, 0x00, 0x00, 0x00, 0xdf, 0xd7, 0xf7,
-  0x7d, 0x7d, 0xdf, 0xd7, 0xf7, 0x7d, 0x7d, 0xdf, 0xdf, 0xff, 0xfd, 0xfd,
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x7f, 0x75, 0xf5,
-  0x57, 0x57, 0x3f, 0x31, 0xf1, 0x13, 0x13, 0x00, 0x00, 0x00, 0x8f, 0x88,
-  0xf8, 0x88, 0x88, 0xbf, 0xbb, 0xfb, 0xbb, 0xbb, 0x3f, 0x33, 0xf3, 0x33,
-  0x33, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x8a, 0xfa,
-  0xa8, 0xa8, 0x4f, 0x46, 0xf6, 0x64, 0x64, 0x3f, 0x31, 0xf1, 0x13, 0x13,
-  0x00, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44,
-  0x44, 0x5f, 0x55, 0xf5, 0x55, 0x55, 0x1f, 0x11, 0xf1, 0x11, 0x11, 0x00,
-  0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x9f, 0x9b, 0xfb, 0xb9, 0xb9,
-  0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88,
-  0x88, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x4f, 0x46, 0xf6, 0x64, 0x64, 0x1f,
-  0x11, 0xf1, 0x11, 0x11, 0x00, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x8f, 0x8a,
-  0xfa, 0xa8, 0xa8, 0xdf, 0xdf, 0xff, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x00,
-  0x4f, 0x44, 0xf4, 0x44, 0x44, 0x5f, 0x57, 0xf7, 0x75, 0x75, 0x1f, 0x13,
-  0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x9f,
-  0x99, 0xf9, 0x99, 0x99, 0x1f, 0x11, 0xf1, 0x11, 0x11, 0x00, 0x00, 0x00,
-  0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x4f, 0x44,
-  0xf4, 0x44, 0x44, 0x1f, 0x11, 0xf1, 0x11, 0x11, 0x00, 0x8f, 0x88, 0xf8,
-  0x88, 0x88, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0xdf, 0xdd, 0xfd, 0xdd, 0xdd,
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x5f, 0x57, 0xf7,
-  0x75, 0x75, 0x1f, 0x13, 0xf3, 0x31, 0x31, 0x00, 0x00, 0x00, 0x8f, 0x88,
-  0xf8, 0x88, 0x88, 0x9f, 0x99, 0xf9, 0x99, 0x99, 0x1f, 0x11, 0xf1, 0x11,
-  0x11, 0x00, 0x00, 0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x88, 0xf8,
-  0x88, 0x88, 0x4f, 0x44, 0xf4, 0x44, 0x44, 0x1f, 0x11, 0xf1, 0x11, 0x11,
-  0x00, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0x8f, 0x88, 0xf8, 0x88, 0x88, 0xdf,
-  0xdd, 0xfd, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x46,
-  0xf6, 0x64, 0x64, 0xdf, 0xd8, 0xf8, 0x8d, 0x8d, 0x00, 0x00, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0xc7, 0xd7, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xee, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x80, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xac, 0x3c, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x28, 0x00, 0x00, 0x14, 0x00,
-  0x00, 0x48, 0x40, 0x01, 0x28, 0x00, 0x48, 0x40, 0x01, 0x28, 0x00, 0x00,
-  0x14, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x21, 0x48, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x10, 0x82, 0x04, 0x00, 0x00, 0x21, 0xbf, 0xe8, 0x0c,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x48, 0x18, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x14, 0x10, 0x41, 0x11, 0x02,
-  0x50, 0x12, 0x00, 0x00, 0x00, 0x14, 0x80, 0x42, 0x01, 0x00, 0x14, 0x88,
-  0x28, 0x14, 0x00, 0x00, 0x88, 0x28, 0x00, 0x00, 0xf0, 0x97, 0xcd, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x10, 0x22, 0x01, 0x00,
-  0x20, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x1f, 0x88, 0x08,
-  0x48, 0x18, 0x14, 0x80, 0x02, 0x80, 0x04, 0x14, 0x18, 0x28, 0x10, 0x82,
-  0x04, 0x16, 0x01, 0x28, 0x10, 0xa2, 0x11, 0x40, 0x01, 0x28, 0x10, 0xa2,
-  0x41, 0x40, 0x01, 0x00, 0x2b, 0x11, 0x48, 0x40, 0x01, 0x28, 0x00, 0x48,
-  0x40, 0x81, 0x88, 0x02, 0x21, 0x48, 0x00, 0x88, 0x28, 0x10, 0x82, 0x04,
-  0xf0, 0x5c, 0x65, 0x80, 0x84, 0x01, 0x80, 0x02, 0x00, 0x00, 0x00, 0x10,
-  0x02, 0x00, 0x00, 0x10, 0x02, 0x40, 0x01, 0x00, 0x21, 0x00, 0x14, 0x00,
-  0x00, 0x00, 0x14, 0x80, 0x02, 0x00, 0x40, 0x81, 0x88, 0x02, 0x00, 0x00,
-  0x88, 0x28, 0x00, 0x00, 0xf0, 0x4c, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x80, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0xaa, 0xf9, 0x80, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x12, 0x00, 0x13, 0x21, 0x08,
-  0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x10, 0x21, 0x08, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0x00, 0xf0, 0x19, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x82, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xa3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0xcd,
-  0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-  0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x47, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xac, 0x06, 0x20, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4f, 0x88, 0x0c, 0x48, 0x42, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x22, 0x00, 0x40, 0x21, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x87, 0x78, 0x20, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00,
-  0x6f, 0x67, 0x0b, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41,
-  0x02, 0x28, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0xf0, 0xeb, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x19, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x14,
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x80, 0x08, 0x28, 0x00, 0x00,
-  0x00, 0x6f, 0x21, 0x0f, 0x28, 0x00, 0x20, 0x22, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0xac, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x20,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xb1,
-  0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x6e, 0x36, 0x00, 0x00,
-  0x00, 0x20, 0x02, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x82,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe1, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x80, 0x14, 0x21, 0x01, 0x00,
-  0x10, 0x02, 0x13, 0x02, 0x00, 0x00, 0x00, 0x18, 0x18, 0x60, 0x11, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xaf, 0x08,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x20, 0x14,
-  0x01, 0x00, 0x00, 0x21, 0x30, 0x21, 0x00, 0x00, 0x00, 0x80, 0x01, 0x60,
-  0x11, 0x40, 0x01, 0x00, 0x80, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x37, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf1, 0xe8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x82, 0x62, 0x00, 0x00, 0x00,
-  0x20, 0x08, 0x00, 0x00, 0x10, 0x02, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x02, 0x28, 0x90, 0x22, 0x00, 0x40, 0x01, 0x00, 0x00, 0x14, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x10, 0x01, 0xf0, 0xf1, 0x6c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x11, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x2f, 0x83, 0x06, 0x00, 0x00,
-  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x20, 0x02, 0x28, 0x00, 0x40, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00,
-  0x10, 0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0xf0, 0xc6, 0x8d, 0x00, 0x00,
-  0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x40, 0x02, 0x12,
-  0x12, 0x00, 0x29, 0x02, 0x00, 0x24, 0x11, 0x00, 0x11, 0x2c, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x20, 0x02, 0x4f,
-  0x68, 0x09, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x20, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x82, 0x80, 0x08, 0x22, 0x00, 0x14, 0x00, 0x00, 0xf0,
-  0x7e, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x12, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x40, 0x02, 0x00, 0x00,
-  0x18, 0x00, 0x28, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x10, 0x01, 0x22,
-  0x00, 0xf0, 0x24, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x13,
-  0x41, 0x02, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x22, 0x40, 0x02, 0x00,
-  0x24, 0x40, 0x01, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x86, 0x01, 0x82,
-  0x20, 0x02, 0x00, 0x20, 0x02, 0x22, 0xe0, 0x8a, 0x05, 0x00, 0x00, 0x24,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
-  0x00, 0x10, 0x02, 0x00, 0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0xcf, 0x16, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0x12, 0x8f, 0x5f, 0x0c, 0x00, 0x00, 0x80, 0x08,
-  0x00, 0x00, 0x21, 0x20, 0x11, 0x02, 0x00, 0x20, 0x01, 0x00, 0x00, 0x18,
-  0x20, 0x01, 0x21, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x24, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18, 0x21, 0x80, 0x41,
-  0x42, 0x02, 0x11, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x18, 0x23, 0x01,
-  0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf1, 0x68,
-  0xe1, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x40, 0x22, 0x01, 0x00, 0x00,
-  0x10, 0x02, 0x23, 0x01, 0x80, 0x61, 0x11, 0x18, 0x14, 0x21, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x57, 0x95, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-  0x00, 0x00, 0x10, 0x42, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x20, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0xf7, 0x69, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x20,
-  0x01, 0x12, 0x00, 0x12, 0x20, 0x01, 0x40, 0x02, 0x80, 0x01, 0xc0, 0x12,
-  0x80, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0xb9, 0xd4, 0x00, 0x00, 0x40, 0x02, 0x21, 0x12,
-  0x18, 0x80, 0x01, 0x2c, 0x01, 0x21, 0x21, 0x10, 0x02, 0x00, 0x80, 0x01,
-  0x18, 0x50, 0x22, 0x12, 0x2c, 0x01, 0x18, 0x00, 0x3c, 0x01, 0x29, 0x01,
-  0x24, 0x10, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41, 0x01,
-  0x00, 0xf0, 0xc4, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x00, 0x21, 0x40, 0x41, 0x12, 0x01, 0x00, 0x40, 0x11, 0x01, 0x14, 0x00,
-  0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x14, 0xf0, 0x65, 0x6d, 0x20, 0x01, 0x48, 0x40, 0x02, 0x00,
-  0x00, 0x00, 0x80, 0x62, 0x21, 0x60, 0x21, 0x40, 0x42, 0x01, 0x50, 0x22,
-  0x80, 0x01, 0x88, 0x25, 0x01, 0x18, 0x00, 0x1c, 0x81, 0x81, 0x91, 0x12,
-  0x28, 0x48, 0x10, 0x12, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x14, 0x00,
-  0x10, 0x01, 0x21, 0x22, 0x1f, 0x78, 0x0d, 0x18, 0x00, 0x00, 0x40, 0x02,
-  0x18, 0xc0, 0x12, 0x00, 0x25, 0x82, 0x01, 0x29, 0x01, 0x10, 0x02, 0x21,
-  0x18, 0x21, 0x24, 0x1e, 0x11, 0x14, 0x14, 0x12, 0x60, 0x21, 0x00, 0x17,
-  0x11, 0x20, 0x81, 0x02, 0x00, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x01, 0x11, 0x11, 0x11, 0x40, 0x81, 0xf2, 0x3c, 0x14, 0x00, 0x00, 0x40,
-  0x12, 0x12, 0x92, 0x12, 0x20, 0x01, 0x24, 0x23, 0x01, 0x25, 0x52, 0x22,
-  0x24, 0x21, 0x21, 0x12, 0x25, 0x01, 0x40, 0x02, 0xd0, 0x23, 0x51, 0x23,
-  0x25, 0xc2, 0x12, 0x00, 0xc0, 0x12, 0x24, 0x29, 0x21, 0x21, 0x51, 0x22,
-  0x21, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe0,
-  0x18, 0x01, 0x12, 0x00, 0x00, 0x00, 0x30, 0x12, 0x18, 0x00, 0x18, 0x1a,
-  0x01, 0x18, 0x00, 0x3c, 0xd1, 0x31, 0x81, 0x81, 0x21, 0x01, 0x21, 0x15,
-  0x22, 0xa1, 0x11, 0x14, 0x23, 0x11, 0x22, 0xa1, 0x11, 0x20, 0x81, 0x02,
-  0x24, 0x18, 0x12, 0x11, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0xf2, 0x2c, 0xbf, 0x00, 0x00, 0x20, 0x88, 0x08, 0x24, 0x00,
-  0x12, 0x00, 0x20, 0x01, 0x12, 0x24, 0x12, 0x30, 0x11, 0x00, 0x00, 0x00,
-  0x90, 0x11, 0x80, 0x01, 0x00, 0x00, 0x18, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x00, 0x20, 0x08, 0x00, 0x40, 0x01, 0x00, 0xf0, 0x2f, 0x8d, 0xa0, 0x19,
-  0x00, 0x40, 0x42, 0x52, 0x22, 0x2b, 0x11, 0x2b, 0x11, 0x18, 0x00, 0x1a,
-  0x21, 0x41, 0xf2, 0x12, 0x12, 0x25, 0xf2, 0x13, 0x13, 0x2b, 0x11, 0x21,
-  0x21, 0x00, 0x24, 0x21, 0x15, 0x73, 0x11, 0xe3, 0x21, 0x51, 0x21, 0x2c,
-  0x11, 0xa2, 0x11, 0x1a, 0xe1, 0x21, 0xb1, 0x12, 0xb1, 0x32, 0xa2, 0x22,
-  0x24, 0x24, 0x50, 0x11, 0x1d, 0x11, 0x00, 0x00, 0x00, 0x8a, 0xa8, 0x88,
-  0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x2e, 0x21, 0x7f, 0xa6, 0x0e, 0x1a,
-  0xa1, 0x44, 0x80, 0x64, 0x28, 0x25, 0x52, 0x22, 0x25, 0x12, 0x82, 0x81,
-  0x01, 0x3e, 0x32, 0x2f, 0x21, 0xf1, 0x12, 0x32, 0x2f, 0x21, 0xf1, 0x12,
-  0x12, 0x1f, 0x31, 0xa1, 0x11, 0x39, 0xf1, 0x13, 0x12, 0x2b, 0x11, 0xc0,
-  0x12, 0x25, 0xf2, 0x83, 0x91, 0x17, 0x11, 0x2c, 0xf8, 0x12, 0x12, 0x2f,
-  0x21, 0xf1, 0x12, 0x12, 0x2f, 0x11, 0xa1, 0x11, 0x1e, 0x11, 0x2f, 0x21,
-  0xb1, 0x32, 0xa3, 0x55, 0x24, 0x29, 0x14, 0xd2, 0x11, 0xd1, 0x11, 0x01,
-  0x00, 0x00, 0x2a, 0xa2, 0x88, 0x8a, 0x0a, 0x14, 0x00, 0x50, 0x21, 0x21,
-  0xf0, 0x22, 0x21, 0x8d, 0x62, 0xa0, 0x11, 0x48, 0x00, 0x24, 0x24, 0x25,
-  0xf2, 0x12, 0x12, 0x2b, 0x11, 0x1a, 0x41, 0xb2, 0x12, 0xb1, 0x12, 0xc3,
-  0x12, 0x2b, 0x11, 0x24, 0x1e, 0x12, 0x35, 0xb3, 0x12, 0xd1, 0x11, 0xf1,
-  0x13, 0x11, 0x21, 0x1a, 0xc1, 0x12, 0x25, 0x92, 0x83, 0x13, 0x51, 0x31,
-  0x1f, 0x31, 0x61, 0x21, 0x2f, 0x21, 0x51, 0x12, 0x12, 0x1e, 0x12, 0x2b,
-  0x11, 0x2b, 0x23, 0x2a, 0x06, 0x00, 0x15, 0xe1, 0x11, 0x01, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x11, 0x10, 0x02, 0x2a, 0xe2, 0xec, 0x01, 0x8a,
-  0x81, 0x04, 0x42, 0x24, 0x27, 0x28, 0x21, 0x24, 0x2b, 0x11, 0x1a, 0xe1,
-  0x21, 0xb1, 0x12, 0xf1, 0x12, 0x32, 0x2f, 0x21, 0xf1, 0x32, 0x12, 0x1e,
-  0x12, 0x1e, 0x12, 0x15, 0xb3, 0x12, 0x91, 0x13, 0x3f, 0x11, 0xb1, 0x12,
-  0xa1, 0x11, 0x24, 0x25, 0xf2, 0x12, 0x82, 0x16, 0x71, 0x81, 0xe3, 0x31,
-  0xf1, 0x12, 0x12, 0x2f, 0x21, 0xb1, 0x12, 0xa1, 0x11, 0x1b, 0x11, 0x2f,
-  0x21, 0xb1, 0x32, 0xa3, 0x51, 0x1e, 0x12, 0x2b, 0x15, 0x2b, 0x11, 0x1f,
-  0x11, 0xe1, 0x11, 0x01, 0x00, 0x00, 0x28, 0x20, 0x02, 0x00, 0x11, 0x00,
-  0x21, 0x24, 0x2e, 0x21, 0x3f, 0x7e, 0x09, 0x00, 0x00, 0x00, 0x20, 0x01,
-  0x40, 0x22, 0x41, 0x02, 0x24, 0x00, 0x40, 0x02, 0x00, 0x00, 0x10, 0x01,
-  0x18, 0x00, 0x10, 0x02, 0x18, 0x90, 0x12, 0x00, 0x10, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x31, 0x0d, 0x18, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x40, 0x02,
-  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf2, 0x39, 0xaa, 0x80, 0xb4, 0x11,
-  0x02, 0x1b, 0x21, 0x42, 0x1b, 0x21, 0x23, 0x94, 0x21, 0x2b, 0x14, 0x19,
-  0xb2, 0x42, 0x99, 0x21, 0x2b, 0x94, 0x11, 0x2b, 0x94, 0x22, 0x2f, 0x14,
-  0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x2a, 0xc4, 0x91, 0x2e, 0x42,
-  0x1c, 0xe8, 0x22, 0x64, 0x11, 0x2e, 0x42, 0x96, 0xe1, 0x22, 0x64, 0x19,
-  0x2c, 0xa4, 0x29, 0x2c, 0xb4, 0x91, 0xc2, 0x42, 0x1b, 0x29, 0x24, 0x1b,
-  0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x32, 0x42, 0x19, 0xb2, 0x42,
-  0x98, 0x21, 0x2b, 0x84, 0x11, 0x2b, 0x84, 0x22, 0x2b, 0x84, 0x22, 0x3b,
-  0x84, 0x22, 0x39, 0xa8, 0x42, 0x88, 0x2e, 0x42, 0x1e, 0x1f, 0x80, 0xb4,
-  0x11, 0x86, 0xb4, 0x11, 0x22, 0xbc, 0x11, 0x22, 0x94, 0x21, 0x2b, 0x14,
-  0x19, 0xb2, 0x42, 0x98, 0x21, 0x2b, 0xb4, 0x19, 0xb2, 0x42, 0x29, 0xf2,
-  0x42, 0x91, 0x22, 0x2f, 0x14, 0x29, 0x92, 0x82, 0x2b, 0x42, 0x1c, 0xf8,
-  0x22, 0x52, 0x1c, 0xa8, 0xd2, 0x1e, 0x81, 0x2e, 0x42, 0x92, 0x2e, 0x42,
-  0x96, 0xc1, 0x43, 0x9a, 0xc2, 0x43, 0x1b, 0x29, 0x2c, 0xb4, 0x81, 0xc6,
-  0x42, 0x1b, 0x28, 0x42, 0x1b, 0x28, 0x23, 0xb4, 0x81, 0x32, 0x42, 0x19,
-  0xb2, 0x42, 0x98, 0x21, 0x2b, 0xa4, 0x1b, 0x28, 0x23, 0x24, 0xb2, 0x42,
-  0x28, 0xb2, 0x42, 0x28, 0x92, 0x82, 0x2b, 0x42, 0x29, 0xe8, 0x22, 0xf4,
-  0x9b, 0x41, 0x00, 0x82, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x21, 0x80, 0x01, 0x88, 0x00, 0x40, 0x02, 0x14, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x01, 0x1e, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2d, 0x82, 0x00, 0x12, 0x20, 0x02, 0x40, 0x02, 0x00, 0x24, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0xd2, 0xfd, 0x00, 0x82, 0x20, 0x08, 0x00, 0x00, 0x50,
-  0x22, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x80, 0x01, 0x00,
-  0x18, 0x00, 0x40, 0x41, 0x02, 0x10, 0x12, 0x02, 0x10, 0x01, 0x00, 0x11,
-  0x00, 0x00, 0x00, 0x11, 0x00, 0x14, 0x14, 0xf0, 0x7f, 0xa5, 0x00, 0xc2,
-  0x80, 0x08, 0x00, 0x00, 0x00, 0x21, 0x22, 0x00, 0x00, 0x00, 0xc0, 0x22,
-  0x00, 0x12, 0x31, 0x82, 0x18, 0x00, 0x20, 0x11, 0x01, 0x10, 0x01, 0x23,
-  0x44, 0x02, 0x00, 0x11, 0x11, 0x00, 0x10, 0x21, 0x02, 0x00, 0x00, 0x14,
-  0x40, 0x42, 0x41, 0x01, 0x4f, 0xe3, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x80, 0x01, 0x24, 0x82, 0x21, 0x80, 0x01, 0x00, 0x00, 0x00, 0x40,
-  0x02, 0x00, 0x80, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x8b, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf7, 0xeb, 0x10, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x41, 0x01, 0x00, 0x00, 0x40, 0x81, 0x02, 0x14, 0x00, 0x00, 0x00, 0x40,
-  0x01, 0x00, 0x00, 0xf0, 0xea, 0xbe, 0x00, 0x80, 0x08, 0x00, 0x10, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24,
-  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x02, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x0b, 0x11, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x00, 0x00, 0x00, 0x2f, 0x15, 0x01, 0x00, 0x10, 0x01, 0x00, 0x40, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x12, 0x00, 0x12, 0x00, 0x00,
-  0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x02,
-  0x00, 0x00, 0x00, 0xf0, 0x6f, 0x4e, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x21, 0x00, 0x00, 0xa0, 0x21, 0x00, 0x29, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x40,
-  0x02, 0x00, 0x40, 0x12, 0x01, 0xf0, 0x41, 0x9e, 0x00, 0x00, 0x00, 0x24,
-  0x00, 0x12, 0x48, 0x00, 0x11, 0x00, 0x00, 0x14, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x40, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00,
-  0x82, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0xf0, 0x87, 0x34, 0x00, 0x00,
-  0x11, 0x40, 0x02, 0x00, 0x23, 0x04, 0x00, 0x80, 0x01, 0x50, 0x12, 0x00,
-  0x21, 0x20, 0x21, 0x02, 0x24, 0x38, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00,
-  0x7f, 0x2b, 0x0a, 0x20, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x14, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x11, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x11, 0x00, 0x24, 0x00, 0x00, 0x00, 0x10,
-  0x01, 0xcb, 0xec, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x70, 0x76,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x11, 0x12, 0x00, 0x00,
-  0x00, 0x20, 0x01, 0x00, 0x18, 0x12, 0x18, 0x12, 0x00, 0x80, 0x01, 0x80,
-  0x01, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0xf0, 0xe9, 0xe9, 0x00, 0x82, 0x00, 0x00, 0x00, 0x80, 0x01, 0x20,
-  0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x80, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x03, 0x9f, 0xdb, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
-  0x12, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0xc0, 0x11, 0x12, 0x00, 0x00,
-  0x00, 0x80, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xe0, 0x97, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00,
-  0x20, 0x01, 0x00, 0x12, 0x20, 0x21, 0x01, 0x20, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0x2e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x21, 0xf0, 0xd3, 0x29, 0x00, 0x00, 0x20, 0x08, 0x00, 0x12, 0x00,
-  0x18, 0x00, 0x12, 0x00, 0x18, 0x00, 0x12, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x18, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x02, 0x21, 0xd0, 0x7f, 0x0c, 0x20, 0x08, 0x00, 0x00, 0x12,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x20, 0x01,
-  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x11, 0x40, 0x01, 0x4f, 0x7c, 0x01, 0x00, 0x48, 0x00,
-  0x82, 0x00, 0x80, 0x01, 0x11, 0x80, 0x02, 0x00, 0x12, 0x00, 0x00, 0x21,
-  0x14, 0x18, 0x80, 0x08, 0x00, 0x80, 0x41, 0x81, 0x01, 0x00, 0x48, 0x20,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x02, 0x40, 0x01, 0x14, 0x14, 0x00, 0x21,
-  0xf0, 0x1b, 0x82, 0x00, 0x82, 0x00, 0x88, 0x00, 0x80, 0x01, 0x18, 0x12,
-  0x12, 0x12, 0x12, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x11, 0x12, 0x18,
-  0x1a, 0x81, 0x21, 0x01, 0x18, 0x20, 0x81, 0x01, 0x40, 0x42, 0x02, 0x12,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x40, 0x01, 0x24, 0x40, 0x01, 0x1b,
-  0xda, 0x00, 0x82, 0x00, 0x80, 0x08, 0x1a, 0x01, 0x00, 0x19, 0xc1, 0x11,
-  0x80, 0x01, 0x18, 0x18, 0x18, 0x1a, 0x01, 0x80, 0x01, 0x14, 0x18, 0x12,
-  0x20, 0x81, 0x01, 0x12, 0x80, 0x01, 0x20, 0x01, 0x00, 0x20, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x11, 0x01, 0x14, 0xf0, 0x99, 0x16, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1a, 0x21, 0x41, 0x01, 0x18, 0x00, 0x20, 0x21,
-  0x01, 0x20, 0x01, 0x11, 0x00, 0x00, 0x00, 0x12, 0xa0, 0x11, 0x00, 0x18,
-  0x00, 0x2b, 0x11, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x02, 0xff, 0x64, 0x04, 0x00, 0x00, 0x80, 0x08, 0x20, 0x01,
-  0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x01, 0x12, 0x00, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-  0x02, 0x14, 0x11, 0x00, 0xf0, 0x88, 0xc6, 0x20, 0x08, 0x00, 0x88, 0x00,
-  0x12, 0x1a, 0x01, 0x40, 0xf1, 0x11, 0x11, 0x00, 0x1a, 0xa1, 0x11, 0xa0,
-  0x11, 0x18, 0x1a, 0x21, 0xa1, 0x11, 0x00, 0xa0, 0x11, 0x12, 0x20, 0x01,
-  0x18, 0x1a, 0xa1, 0x11, 0x12, 0x12, 0xe0, 0x21, 0xf1, 0x12, 0x12, 0x2b,
-  0x11, 0xa0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x50, 0x21, 0x25, 0x52, 0x12,
-  0x00, 0x10, 0x41, 0xf1, 0x68, 0x8e, 0x00, 0x4a, 0x04, 0x48, 0x88, 0x82,
-  0x00, 0x1a, 0x01, 0xe0, 0x11, 0xf1, 0x31, 0x31, 0x80, 0x03, 0x1a, 0xa1,
-  0x11, 0x1a, 0x01, 0x1e, 0x12, 0x21, 0x1a, 0x91, 0x12, 0xa0, 0x98, 0x80,
-  0xa8, 0x11, 0x1a, 0xa1, 0x11, 0x1f, 0x11, 0xa1, 0x11, 0x1e, 0x11, 0x12,
-  0x12, 0x4a, 0xe4, 0x21, 0xf1, 0x12, 0x52, 0x2b, 0x11, 0x1a, 0xa1, 0x11,
-  0x00, 0x00, 0xa0, 0x22, 0x80, 0x02, 0x34, 0x25, 0x52, 0x12, 0x40, 0x12,
-  0x02, 0x14, 0xaf, 0x66, 0x05, 0x80, 0x04, 0x00, 0x00, 0x12, 0x1a, 0x01,
-  0x50, 0x11, 0x1d, 0x31, 0x00, 0xa0, 0x11, 0x80, 0x81, 0xa1, 0x11, 0x29,
-  0xa1, 0x11, 0x18, 0x14, 0x88, 0x1a, 0x21, 0x81, 0xa1, 0x11, 0x1a, 0x61,
-  0x11, 0x18, 0x1a, 0xa1, 0x11, 0x1a, 0x81, 0x04, 0x2b, 0x11, 0x1a, 0x01,
-  0x1a, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x11, 0x02, 0xf0,
+const unsigned char USB_1608G_rbf_lz[] = {
+  0x1b, 0xff, 0x01, 0x00, 0x9e, 0x6a, 0xde, 0xff, 0x7f, 0x00, 0x24, 0x03,
+  0x09, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0x05,
+  0xa5, 0x44, 0x55, 0x54, 0x44, 0x55, 0x55, 0x74, 0x75, 0x57, 0x77, 0x03,
+  0x00, 0xff, 0x02, 0x65, 0x56, 0x66, 0x65, 0x56, 0x36, 0x25, 0x52, 0x32,
+  0x35, 0xd2, 0xa3, 0x79, 0xd2, 0x51, 0x11, 0x15, 0x03, 0x00, 0x25, 0x1e,
+  0x00, 0x01, 0x00, 0x32, 0x25, 0x52, 0x22, 0x03, 0x00, 0x03, 0x0a, 0x00,
+  0x01, 0x15, 0x00, 0x60, 0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x11, 0x12, 0x00,
+  0x0d, 0x30, 0x00, 0x03, 0x27, 0x00, 0x51, 0x2f, 0x21, 0xf1, 0x12, 0x12,
+  0x05, 0x00, 0x05, 0x41, 0x00, 0x03, 0x2e, 0x00, 0x08, 0x10, 0x00, 0x0e,
+  0x03, 0x00, 0x00, 0x22, 0x00, 0x06, 0x3c, 0x00, 0x04, 0x74, 0x00, 0x34,
+  0x1a, 0xa1, 0x11, 0x4c, 0x00, 0x03, 0x43, 0x00, 0x04, 0x7f, 0x00, 0x09,
+  0x87, 0x00, 0x09, 0x62, 0x00, 0x06, 0x12, 0x00, 0x86, 0x75, 0x57, 0x77,
+  0x1f, 0x1b, 0xfb, 0xb1, 0xb1, 0xa4, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x0b,
+  0x3c, 0x00, 0x0f, 0xa3, 0x00, 0x09, 0x04, 0x5d, 0x00, 0x51, 0x4f, 0x44,
+  0xf4, 0x44, 0x44, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x45, 0x54, 0x44,
+  0x45, 0x54, 0x0a, 0x00, 0x03, 0x1a, 0x00, 0x02, 0x4e, 0x00, 0x51, 0x6f,
+  0x64, 0xf4, 0x46, 0x46, 0x14, 0x00, 0x92, 0x48, 0xf8, 0x84, 0x84, 0x6f,
+  0x69, 0xf9, 0x96, 0x96, 0xdb, 0x00, 0x0c, 0x40, 0x00, 0x61, 0x4a, 0xa4,
+  0x44, 0x4a, 0xa4, 0x44, 0x26, 0x00, 0x00, 0x61, 0x00, 0x02, 0x0f, 0x00,
+  0x50, 0x6f, 0x6c, 0xfc, 0xc6, 0xc6, 0x1e, 0x00, 0x89, 0x8a, 0xa8, 0x88,
+  0x2f, 0x29, 0xf9, 0x92, 0x92, 0x3c, 0x00, 0x5e, 0x6f, 0x65, 0xf5, 0x56,
+  0x56, 0x4e, 0x00, 0x00, 0x2c, 0x00, 0x01, 0x15, 0x00, 0x01, 0x0e, 0x00,
+  0x83, 0x6a, 0xa6, 0x66, 0x3f, 0x38, 0xf8, 0x83, 0x83, 0x33, 0x00, 0x40,
+  0x6d, 0xfd, 0xd6, 0xd6, 0x51, 0x00, 0xa2, 0x8f, 0x8c, 0xfc, 0xc8, 0xc8,
+  0xaf, 0xac, 0xfc, 0xca, 0xca, 0xcf, 0x00, 0x66, 0xc5, 0x5c, 0xcc, 0xc5,
+  0x5c, 0xcc, 0xc9, 0x00, 0x01, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x02, 0x0f,
+  0x00, 0x50, 0xef, 0xec, 0xfc, 0xce, 0xce, 0x1e, 0x00, 0x51, 0xcf, 0xcc,
+  0xfc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x66, 0xc5, 0x5c, 0xcc,
+  0xe5, 0x5e, 0xee, 0x3c, 0x01, 0x03, 0x27, 0x00, 0x02, 0x29, 0x01, 0x06,
+  0x34, 0x00, 0x41, 0xc8, 0xf8, 0x8c, 0x8c, 0x05, 0x00, 0x01, 0x0e, 0x00,
+  0x92, 0xc4, 0xf4, 0x4c, 0x4c, 0xef, 0xe4, 0xf4, 0x4e, 0x4e, 0x38, 0x00,
+  0xf1, 0x02, 0x8f, 0x84, 0xf4, 0x48, 0x48, 0xaf, 0xa4, 0xf4, 0x4a, 0x4a,
+  0x6f, 0x68, 0xf8, 0x86, 0x86, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x05, 0x00,
+  0x0f, 0x42, 0x00, 0x04, 0x02, 0xca, 0x00, 0x00, 0x59, 0x01, 0x02, 0x42,
+  0x00, 0x06, 0x10, 0x00, 0x71, 0x2f, 0x28, 0xf8, 0x82, 0x82, 0x00, 0x00,
+  0x0c, 0x00, 0x02, 0x05, 0x00, 0x04, 0x41, 0x01, 0x02, 0x42, 0x00, 0x75,
+  0xcb, 0xfb, 0xbc, 0xbc, 0x3a, 0xa3, 0x33, 0x86, 0x00, 0x4a, 0xe5, 0xf5,
+  0x5e, 0x5e, 0x53, 0x01, 0x00, 0x35, 0x00, 0x50, 0xaf, 0xa8, 0xf8, 0x8a,
+  0x8a, 0x27, 0x00, 0xa7, 0x5f, 0x52, 0xf2, 0x25, 0x25, 0x5f, 0x5f, 0xff,
+  0xf5, 0xf5, 0x53, 0x00, 0x53, 0xef, 0xef, 0xff, 0xfe, 0xfe, 0x94, 0x01,
+  0x3f, 0xba, 0xab, 0xbb, 0x4f, 0x00, 0x05, 0x06, 0xe7, 0x00, 0x01, 0x95,
+  0x00, 0x00, 0xa9, 0x02, 0x01, 0x0e, 0x00, 0x02, 0x05, 0x00, 0x43, 0xed,
+  0xfd, 0xde, 0xde, 0xf6, 0x01, 0x52, 0x1f, 0x14, 0xf4, 0x41, 0x41, 0x7d,
+  0x03, 0x01, 0xa5, 0x00, 0xaa, 0xef, 0xeb, 0xfb, 0xbe, 0xbe, 0x2f, 0x23,
+  0xf3, 0x32, 0x32, 0x12, 0x00, 0x61, 0x27, 0xf7, 0x72, 0x72, 0x00, 0x00,
+  0x0c, 0x00, 0x02, 0x05, 0x00, 0x04, 0x88, 0x00, 0x01, 0x41, 0x01, 0x95,
+  0x9f, 0x95, 0xf5, 0x59, 0x59, 0x1f, 0x11, 0xf1, 0x11, 0x48, 0x00, 0x90,
+  0xff, 0xfb, 0xfb, 0xbf, 0xbf, 0x3f, 0x33, 0xf3, 0x33, 0xa0, 0x00, 0x01,
+  0x58, 0x02, 0xa0, 0x7f, 0x7a, 0xfa, 0xa7, 0xa7, 0xbf, 0xb6, 0xf6, 0x6b,
+  0x6b, 0x8e, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x05, 0x00, 0x01, 0x58, 0x04,
+  0x05, 0x9b, 0x01, 0x75, 0xff, 0xf4, 0xf4, 0x4f, 0x4f, 0x35, 0x53, 0x36,
+  0x00, 0xa4, 0x5f, 0x5b, 0xfb, 0xb5, 0xb5, 0x1f, 0x13, 0xf3, 0x31, 0x31,
+  0x12, 0x00, 0x80, 0x4f, 0x4b, 0xfb, 0xb4, 0xb4, 0x7a, 0xa7, 0x77, 0x25,
+  0x00, 0x01, 0x0c, 0x00, 0x01, 0x05, 0x00, 0x53, 0x7f, 0x7f, 0xff, 0xf7,
+  0xf7, 0x41, 0x02, 0x70, 0x4f, 0x42, 0xf2, 0x24, 0x24, 0x2a, 0xa2, 0x9d,
+  0x01, 0x01, 0x2c, 0x02, 0xaf, 0xff, 0xfd, 0xfd, 0xdf, 0xdf, 0x3f, 0x31,
+  0xf1, 0x13, 0x13, 0x12, 0x00, 0x00, 0x01, 0x76, 0x00, 0x01, 0x70, 0x02,
+  0x21, 0x00, 0x00, 0x17, 0x00, 0x06, 0x05, 0x00, 0x03, 0x23, 0x01, 0x33,
+  0x6a, 0xa6, 0x66, 0x4d, 0x00, 0x01, 0xd9, 0x00, 0x45, 0xf9, 0xf9, 0x9f,
+  0x9f, 0x4d, 0x00, 0x06, 0x12, 0x00, 0x61, 0x35, 0xf5, 0x53, 0x53, 0x00,
+  0x00, 0x0c, 0x00, 0x02, 0x05, 0x00, 0x04, 0x42, 0x00, 0x01, 0x61, 0x00,
+  0x5f, 0xcf, 0xc6, 0xf6, 0x6c, 0x6c, 0x46, 0x00, 0x05, 0x02, 0x1f, 0x01,
+  0xb1, 0x79, 0xf9, 0x97, 0x97, 0xbf, 0xb5, 0xf5, 0x5b, 0x5b, 0x00, 0x00,
+  0x0c, 0x00, 0x01, 0x05, 0x00, 0x05, 0x46, 0x00, 0x02, 0xc1, 0x03, 0x00,
+  0xa3, 0x02, 0x02, 0x76, 0x02, 0x01, 0x56, 0x00, 0x54, 0xdf, 0xd7, 0xf7,
+  0x7d, 0x7d, 0x1d, 0x01, 0x07, 0x12, 0x00, 0x00, 0x70, 0x04, 0x00, 0x27,
+  0x00, 0x01, 0x0e, 0x00, 0x01, 0x05, 0x00, 0x05, 0x65, 0x01, 0x0f, 0x48,
+  0x00, 0x02, 0x54, 0xff, 0xf7, 0xf7, 0x7f, 0x7f, 0xad, 0x01, 0x07, 0x12,
+  0x00, 0x61, 0x3b, 0xfb, 0xb3, 0xb3, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x05,
+  0x00, 0x0f, 0x46, 0x00, 0x0a, 0x0f, 0x8e, 0x00, 0x09, 0x01, 0x76, 0x01,
+  0x04, 0x9d, 0x02, 0x06, 0x97, 0x00, 0x01, 0x69, 0x01, 0x05, 0x55, 0x03,
+  0x54, 0x7f, 0x75, 0xf5, 0x57, 0x57, 0x15, 0x01, 0xa4, 0x8f, 0x88, 0xf8,
+  0x88, 0x88, 0xbf, 0xbb, 0xfb, 0xbb, 0xbb, 0x99, 0x00, 0x01, 0x12, 0x00,
+  0xa2, 0x8f, 0x8a, 0xfa, 0xa8, 0xa8, 0x4f, 0x46, 0xf6, 0x64, 0x64, 0x29,
+  0x00, 0x01, 0x10, 0x00, 0x01, 0x05, 0x00, 0x06, 0x9d, 0x00, 0x00, 0x4c,
+  0x00, 0x54, 0x5f, 0x55, 0xf5, 0x55, 0x55, 0x92, 0x02, 0x01, 0x3a, 0x00,
+  0x54, 0x9f, 0x9b, 0xfb, 0xb9, 0xb9, 0x9f, 0x00, 0x0b, 0x4c, 0x00, 0x02,
+  0x29, 0x00, 0x06, 0x4c, 0x00, 0x0a, 0x98, 0x00, 0x59, 0x5f, 0x57, 0xf7,
+  0x75, 0x75, 0x3a, 0x00, 0x59, 0x9f, 0x99, 0xf9, 0x99, 0x99, 0x5e, 0x00,
+  0x01, 0x05, 0x00, 0x01, 0x2e, 0x00, 0x03, 0x4c, 0x00, 0x05, 0x15, 0x00,
+  0x5f, 0xdf, 0xdd, 0xfd, 0xdd, 0xdd, 0x4c, 0x00, 0x3d, 0x0a, 0x01, 0x00,
+  0x01, 0xc4, 0x00, 0x85, 0xdf, 0xd8, 0xf8, 0x8d, 0x8d, 0x00, 0x00, 0x48,
+  0x16, 0x00, 0x27, 0x40, 0x01, 0x23, 0x00, 0x20, 0x80, 0x08, 0x06, 0x00,
+  0x77, 0xf0, 0xc7, 0xd7, 0x00, 0x00, 0x80, 0x02, 0x18, 0x00, 0x02, 0x1d,
+  0x00, 0x06, 0x12, 0x00, 0x29, 0xee, 0x29, 0x1a, 0x00, 0x0d, 0x01, 0x00,
+  0x6f, 0xff, 0xe4, 0x0f, 0x00, 0x80, 0x84, 0x42, 0x00, 0x03, 0x03, 0x64,
+  0x00, 0x2c, 0xac, 0x3c, 0x1e, 0x00, 0x0a, 0x01, 0x00, 0xd2, 0xff, 0xe4,
+  0x0f, 0x28, 0x00, 0x00, 0x14, 0x00, 0x00, 0x48, 0x40, 0x01, 0x28, 0x05,
+  0x00, 0x90, 0x00, 0x14, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x21, 0xbe,
+  0x00, 0x50, 0x48, 0x00, 0x00, 0x10, 0x82, 0x0d, 0x00, 0x3f, 0xbf, 0xe8,
+  0x0c, 0x3f, 0x00, 0x00, 0x06, 0x01, 0x00, 0x21, 0xf0, 0x4f, 0x82, 0x04,
+  0x0f, 0x01, 0x00, 0x07, 0x70, 0xff, 0xe4, 0x0f, 0x48, 0x18, 0x00, 0x28,
+  0x0b, 0x00, 0x11, 0x21, 0x04, 0x00, 0x60, 0x14, 0x10, 0x41, 0x11, 0x02,
+  0x50, 0x84, 0x02, 0xf2, 0x03, 0x14, 0x80, 0x42, 0x01, 0x00, 0x14, 0x88,
+  0x28, 0x14, 0x00, 0x00, 0x88, 0x28, 0x00, 0x00, 0xf0, 0x97, 0xcd, 0x33,
+  0x00, 0x81, 0x1a, 0x01, 0x00, 0x10, 0x22, 0x01, 0x00, 0x20, 0x03, 0x00,
+  0x20, 0x00, 0x00, 0x2b, 0x00, 0x03, 0x01, 0x00, 0x71, 0x28, 0x00, 0x1f,
+  0x88, 0x08, 0x48, 0x18, 0xaa, 0x00, 0xd0, 0x14, 0x18, 0x28, 0x10, 0x82,
+  0x04, 0x16, 0x01, 0x28, 0x10, 0xa2, 0x11, 0x40, 0x06, 0x00, 0x63, 0x41,
+  0x40, 0x01, 0x00, 0x2b, 0x11, 0xd1, 0x00, 0x70, 0x81, 0x88, 0x02, 0x21,
+  0x48, 0x00, 0x88, 0x23, 0x00, 0x61, 0xf0, 0x5c, 0x65, 0x80, 0x84, 0x01,
+  0x1e, 0x01, 0x20, 0x10, 0x02, 0x04, 0x00, 0x20, 0x40, 0x01, 0x87, 0x00,
+  0x01, 0x81, 0x00, 0x20, 0x02, 0x00, 0x2a, 0x00, 0x03, 0x80, 0x00, 0x26,
+  0x4c, 0xbe, 0x6a, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x52, 0xff, 0xe4, 0x0f,
+  0x80, 0x05, 0xcb, 0x00, 0x03, 0xce, 0x00, 0x02, 0xdf, 0x01, 0x00, 0x5b,
+  0x00, 0x21, 0x80, 0x0a, 0x15, 0x00, 0x63, 0xf0, 0xaa, 0xf9, 0x80, 0x04,
+  0x00, 0x8e, 0x08, 0x00, 0x62, 0x00, 0x70, 0x00, 0x24, 0x12, 0x00, 0x13,
+  0x21, 0x08, 0x0a, 0x00, 0x30, 0x28, 0x00, 0x10, 0x09, 0x00, 0x00, 0xa2,
+  0x01, 0x35, 0xf0, 0x19, 0x88, 0x23, 0x00, 0x00, 0x01, 0x00, 0x28, 0x40,
+  0x82, 0x28, 0x02, 0x00, 0x01, 0x00, 0x37, 0xff, 0xa3, 0x05, 0x0e, 0x00,
+  0x57, 0x10, 0x01, 0x00, 0x00, 0x80, 0x23, 0x00, 0x66, 0x82, 0x00, 0x00,
+  0x00, 0xcd, 0x5e, 0x10, 0x00, 0x14, 0x24, 0x09, 0x00, 0x01, 0x91, 0x00,
+  0x12, 0x20, 0x1b, 0x02, 0x2c, 0x70, 0x47, 0x55, 0x00, 0x0a, 0x01, 0x00,
+  0x0d, 0xbb, 0x01, 0x00, 0x66, 0x00, 0x05, 0x3e, 0x00, 0x00, 0x01, 0x00,
+  0x57, 0xff, 0xac, 0x06, 0x20, 0x01, 0xce, 0x00, 0x05, 0x60, 0x02, 0x05,
+  0x01, 0x00, 0x55, 0x4f, 0x88, 0x0c, 0x48, 0x42, 0x13, 0x01, 0x01, 0x01,
+  0x00, 0x02, 0x46, 0x00, 0x52, 0x22, 0x00, 0x40, 0x21, 0x28, 0x2c, 0x00,
+  0x55, 0xf0, 0x87, 0x78, 0x20, 0x02, 0x46, 0x00, 0x00, 0xbb, 0x00, 0x00,
+  0x01, 0x00, 0x02, 0x34, 0x00, 0x22, 0x20, 0x08, 0x11, 0x00, 0x42, 0x6f,
+  0x67, 0x0b, 0x00, 0xee, 0x01, 0x32, 0x00, 0x10, 0x01, 0x42, 0x00, 0x00,
+  0xce, 0x00, 0x31, 0x41, 0x02, 0x28, 0x24, 0x00, 0x01, 0x63, 0x01, 0x27,
+  0xf0, 0xeb, 0x68, 0x00, 0x13, 0x19, 0x88, 0x00, 0x20, 0x20, 0x02, 0xc9,
+  0x01, 0x60, 0x00, 0x88, 0x88, 0x00, 0x80, 0x08, 0x1f, 0x00, 0x71, 0x6f,
+  0x21, 0x0f, 0x28, 0x00, 0x20, 0x22, 0x42, 0x00, 0x07, 0x7d, 0x03, 0x26,
+  0x40, 0x02, 0xc6, 0x00, 0x31, 0xf0, 0xac, 0xcf, 0x08, 0x00, 0x14, 0x12,
+  0x72, 0x00, 0x08, 0x62, 0x02, 0x02, 0x22, 0x00, 0x2a, 0xb1, 0xc4, 0x11,
+  0x00, 0x09, 0xe1, 0x00, 0x00, 0x21, 0x00, 0x22, 0x6e, 0x36, 0x2a, 0x01,
+  0x0c, 0x19, 0x00, 0x15, 0x14, 0xe1, 0x00, 0x22, 0x2f, 0xe1, 0xa2, 0x00,
+  0x00, 0x5c, 0x00, 0x90, 0x11, 0x80, 0x14, 0x21, 0x01, 0x00, 0x10, 0x02,
+  0x13, 0x5b, 0x01, 0x31, 0x18, 0x18, 0x60, 0x67, 0x0b, 0x00, 0xd7, 0x00,
+  0x40, 0x00, 0x00, 0x5f, 0xaf, 0x07, 0x00, 0x40, 0x28, 0x00, 0x20, 0x03,
+  0x13, 0x00, 0x60, 0x14, 0x01, 0x00, 0x00, 0x21, 0x30, 0x5a, 0x02, 0x92,
+  0x80, 0x01, 0x60, 0x11, 0x40, 0x01, 0x00, 0x80, 0x08, 0x27, 0x00, 0x25,
+  0x37, 0x8e, 0x63, 0x00, 0x14, 0x11, 0xb6, 0x00, 0x35, 0x00, 0x00, 0x18,
+  0x15, 0x00, 0x46, 0x00, 0xf0, 0xf1, 0xe8, 0x0d, 0x00, 0x0a, 0x01, 0x00,
+  0x01, 0x21, 0x01, 0x43, 0x00, 0xf0, 0x82, 0x62, 0x75, 0x00, 0x22, 0x10,
+  0x02, 0xa4, 0x01, 0x51, 0x10, 0x02, 0x28, 0x90, 0x22, 0x25, 0x01, 0x02,
+  0x22, 0x00, 0x73, 0x80, 0x02, 0x10, 0x01, 0xf0, 0xf1, 0x6c, 0x36, 0x00,
+  0x10, 0x21, 0x6a, 0x00, 0x00, 0x01, 0x00, 0x17, 0x40, 0x69, 0x04, 0x00,
+  0x87, 0x01, 0x30, 0x2f, 0x83, 0x06, 0x71, 0x01, 0x06, 0x15, 0x00, 0x44,
+  0x21, 0x20, 0x02, 0x28, 0x47, 0x00, 0x01, 0x59, 0x00, 0x53, 0x40, 0x01,
+  0xf0, 0xc6, 0x8d, 0x22, 0x03, 0x00, 0x05, 0x00, 0xd4, 0x40, 0x02, 0x12,
+  0x12, 0x00, 0x29, 0x02, 0x00, 0x24, 0x11, 0x00, 0x11, 0x2c, 0x4e, 0x00,
+  0x10, 0x14, 0x40, 0x01, 0x54, 0x4f, 0x68, 0x09, 0x20, 0x04, 0x48, 0x00,
+  0x21, 0x40, 0x02, 0xd9, 0x00, 0x04, 0x84, 0x0c, 0x40, 0x82, 0x80, 0x08,
+  0x22, 0x26, 0x00, 0x21, 0xf0, 0x7e, 0x69, 0x0a, 0x44, 0x00, 0x00, 0x70,
+  0x12, 0xf8, 0x00, 0x20, 0x10, 0x02, 0x95, 0x00, 0x01, 0x56, 0x04, 0xb2,
+  0x11, 0x00, 0x00, 0x11, 0x10, 0x01, 0x22, 0x00, 0xf0, 0x24, 0x7c, 0x1c,
+  0x00, 0x30, 0x24, 0x13, 0x41, 0x63, 0x00, 0x00, 0xb8, 0x02, 0x62, 0x40,
+  0x02, 0x00, 0x24, 0x40, 0x01, 0x28, 0x00, 0xc7, 0x86, 0x01, 0x82, 0x20,
+  0x02, 0x00, 0x20, 0x02, 0x22, 0xe0, 0x8a, 0x05, 0x30, 0x03, 0x01, 0x0b,
+  0x00, 0x47, 0x10, 0x02, 0x00, 0x26, 0xe5, 0x00, 0x40, 0x11, 0x14, 0xcf,
+  0x16, 0xe3, 0x00, 0x01, 0x72, 0x03, 0x00, 0x32, 0x04, 0x09, 0x03, 0x01,
+  0x01, 0x01, 0x00, 0x52, 0x60, 0x12, 0x8f, 0x5f, 0x0c, 0x0d, 0x03, 0x41,
+  0x21, 0x20, 0x11, 0x02, 0x92, 0x01, 0x42, 0x18, 0x20, 0x01, 0x21, 0x92,
+  0x01, 0x05, 0x97, 0x01, 0x30, 0xf0, 0x24, 0x1e, 0x07, 0x00, 0x21, 0x80,
+  0x81, 0xb9, 0x00, 0x90, 0x18, 0x21, 0x80, 0x41, 0x42, 0x02, 0x11, 0x00,
+  0x24, 0x7e, 0x00, 0x35, 0x18, 0x23, 0x01, 0xc7, 0x01, 0x40, 0x40, 0xf1,
+  0x68, 0xe1, 0x08, 0x00, 0x30, 0x21, 0x00, 0x40, 0xb9, 0x02, 0x91, 0x10,
+  0x02, 0x23, 0x01, 0x80, 0x61, 0x11, 0x18, 0x14, 0x40, 0x01, 0x03, 0x50,
+  0x03, 0x01, 0x4f, 0x00, 0x23, 0x57, 0x95, 0x05, 0x04, 0x50, 0x21, 0x00,
+  0x00, 0x10, 0x42, 0x0b, 0x00, 0x00, 0x4b, 0x00, 0x03, 0xee, 0x02, 0x03,
+  0x24, 0x00, 0x20, 0xf7, 0x69, 0x07, 0x00, 0x10, 0x24, 0x02, 0x01, 0xb1,
+  0x12, 0x00, 0x12, 0x20, 0x01, 0x40, 0x02, 0x80, 0x01, 0xc0, 0x12, 0x38,
+  0x00, 0x06, 0x2f, 0x02, 0x30, 0xf0, 0xb9, 0xd4, 0xd6, 0x00, 0xf0, 0x0c,
+  0x21, 0x12, 0x18, 0x80, 0x01, 0x2c, 0x01, 0x21, 0x21, 0x10, 0x02, 0x00,
+  0x80, 0x01, 0x18, 0x50, 0x22, 0x12, 0x2c, 0x01, 0x18, 0x00, 0x3c, 0x01,
+  0x29, 0x01, 0x24, 0x81, 0x05, 0x00, 0x01, 0x00, 0x70, 0x10, 0x41, 0x01,
+  0x00, 0xf0, 0xc4, 0x8f, 0x0b, 0x00, 0x02, 0xcf, 0x01, 0x92, 0x40, 0x41,
+  0x12, 0x01, 0x00, 0x40, 0x11, 0x01, 0x14, 0xaa, 0x01, 0x05, 0x9e, 0x00,
+  0x71, 0x14, 0xf0, 0x65, 0x6d, 0x20, 0x01, 0x48, 0x2b, 0x01, 0xf1, 0x0a,
+  0x80, 0x62, 0x21, 0x60, 0x21, 0x40, 0x42, 0x01, 0x50, 0x22, 0x80, 0x01,
+  0x88, 0x25, 0x01, 0x18, 0x00, 0x1c, 0x81, 0x81, 0x91, 0x12, 0x28, 0x48,
+  0x10, 0xc2, 0x01, 0xc0, 0x28, 0x00, 0x14, 0x00, 0x10, 0x01, 0x21, 0x22,
+  0x1f, 0x78, 0x0d, 0x18, 0x86, 0x00, 0xf1, 0x0f, 0x18, 0xc0, 0x12, 0x00,
+  0x25, 0x82, 0x01, 0x29, 0x01, 0x10, 0x02, 0x21, 0x18, 0x21, 0x24, 0x1e,
+  0x11, 0x14, 0x14, 0x12, 0x60, 0x21, 0x00, 0x17, 0x11, 0x20, 0x81, 0x02,
+  0x00, 0x16, 0x60, 0x00, 0xf5, 0x23, 0x10, 0x01, 0x11, 0x11, 0x11, 0x40,
+  0x81, 0xf2, 0x3c, 0x14, 0x00, 0x00, 0x40, 0x12, 0x12, 0x92, 0x12, 0x20,
+  0x01, 0x24, 0x23, 0x01, 0x25, 0x52, 0x22, 0x24, 0x21, 0x21, 0x12, 0x25,
+  0x01, 0x40, 0x02, 0xd0, 0x23, 0x51, 0x23, 0x25, 0xc2, 0x12, 0x00, 0xc0,
+  0x12, 0x24, 0x29, 0x21, 0x21, 0x51, 0x22, 0x21, 0x2e, 0x05, 0x40, 0x14,
+  0xe0, 0x18, 0x01, 0x84, 0x03, 0x60, 0x30, 0x12, 0x18, 0x00, 0x18, 0x1a,
+  0xdf, 0x00, 0xf0, 0x01, 0xd1, 0x31, 0x81, 0x81, 0x21, 0x01, 0x21, 0x15,
+  0x22, 0xa1, 0x11, 0x14, 0x23, 0x11, 0x22, 0xa1, 0x68, 0x00, 0x42, 0x24,
+  0x18, 0x12, 0x11, 0x6b, 0x00, 0x00, 0x51, 0x01, 0xb0, 0xf2, 0x2c, 0xbf,
+  0x00, 0x00, 0x20, 0x88, 0x08, 0x24, 0x00, 0x12, 0x47, 0x01, 0x30, 0x24,
+  0x12, 0x30, 0xeb, 0x00, 0x20, 0x90, 0x11, 0x55, 0x00, 0x12, 0x18, 0x89,
+  0x05, 0x20, 0x20, 0x08, 0xf3, 0x02, 0xf0, 0x2b, 0xf0, 0x2f, 0x8d, 0xa0,
+  0x19, 0x00, 0x40, 0x42, 0x52, 0x22, 0x2b, 0x11, 0x2b, 0x11, 0x18, 0x00,
+  0x1a, 0x21, 0x41, 0xf2, 0x12, 0x12, 0x25, 0xf2, 0x13, 0x13, 0x2b, 0x11,
+  0x21, 0x21, 0x00, 0x24, 0x21, 0x15, 0x73, 0x11, 0xe3, 0x21, 0x51, 0x21,
+  0x2c, 0x11, 0xa2, 0x11, 0x1a, 0xe1, 0x21, 0xb1, 0x12, 0xb1, 0x32, 0xa2,
+  0x22, 0x24, 0x24, 0x50, 0x11, 0x1d, 0x51, 0x00, 0xf0, 0x05, 0x8a, 0xa8,
+  0x88, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x2e, 0x21, 0x7f, 0xa6, 0x0e,
+  0x1a, 0xa1, 0x44, 0x80, 0x64, 0x28, 0x39, 0x0d, 0x60, 0x12, 0x82, 0x81,
+  0x01, 0x3e, 0x32, 0xaa, 0x09, 0x01, 0x05, 0x00, 0xf3, 0x06, 0x12, 0x1f,
+  0x31, 0xa1, 0x11, 0x39, 0xf1, 0x13, 0x12, 0x2b, 0x11, 0xc0, 0x12, 0x25,
+  0xf2, 0x83, 0x91, 0x17, 0x11, 0x2c, 0xf8, 0x20, 0x0f, 0xf0, 0x55, 0x2f,
+  0x11, 0xa1, 0x11, 0x1e, 0x11, 0x2f, 0x21, 0xb1, 0x32, 0xa3, 0x55, 0x24,
+  0x29, 0x14, 0xd2, 0x11, 0xd1, 0x11, 0x01, 0x00, 0x00, 0x2a, 0xa2, 0x88,
+  0x8a, 0x0a, 0x14, 0x00, 0x50, 0x21, 0x21, 0xf0, 0x22, 0x21, 0x8d, 0x62,
+  0xa0, 0x11, 0x48, 0x00, 0x24, 0x24, 0x25, 0xf2, 0x12, 0x12, 0x2b, 0x11,
+  0x1a, 0x41, 0xb2, 0x12, 0xb1, 0x12, 0xc3, 0x12, 0x2b, 0x11, 0x24, 0x1e,
+  0x12, 0x35, 0xb3, 0x12, 0xd1, 0x11, 0xf1, 0x13, 0x11, 0x21, 0x1a, 0xc1,
+  0x12, 0x25, 0x92, 0x83, 0x13, 0x51, 0x31, 0x1f, 0x31, 0x61, 0x21, 0x2f,
+  0x21, 0x51, 0x12, 0x12, 0x1e, 0x12, 0x2b, 0x11, 0x2b, 0x23, 0x2a, 0x06,
+  0x00, 0x15, 0xe1, 0x52, 0x00, 0x00, 0xe8, 0x04, 0xf2, 0x02, 0x11, 0x10,
+  0x02, 0x2a, 0xe2, 0xec, 0x01, 0x8a, 0x81, 0x04, 0x42, 0x24, 0x27, 0x28,
+  0x21, 0x24, 0x2b, 0xd3, 0x00, 0x02, 0xa6, 0x00, 0xf0, 0x02, 0x32, 0x12,
+  0x1e, 0x12, 0x1e, 0x12, 0x15, 0xb3, 0x12, 0x91, 0x13, 0x3f, 0x11, 0xb1,
+  0x12, 0xa1, 0x11, 0x70, 0x00, 0x61, 0x82, 0x16, 0x71, 0x81, 0xe3, 0x31,
+  0xcc, 0x0f, 0x00, 0x13, 0x00, 0x12, 0x1b, 0xa9, 0x00, 0x92, 0x51, 0x1e,
+  0x12, 0x2b, 0x15, 0x2b, 0x11, 0x1f, 0x11, 0x5a, 0x00, 0xc1, 0x20, 0x02,
+  0x00, 0x11, 0x00, 0x21, 0x24, 0x2e, 0x21, 0x3f, 0x7e, 0x09, 0xb9, 0x03,
+  0x51, 0x40, 0x22, 0x41, 0x02, 0x24, 0x74, 0x03, 0x92, 0x10, 0x01, 0x18,
+  0x00, 0x10, 0x02, 0x18, 0x90, 0x12, 0x87, 0x03, 0x02, 0x01, 0x00, 0x20,
+  0xef, 0x31, 0x37, 0x02, 0x03, 0x01, 0x00, 0x20, 0x40, 0x01, 0x28, 0x00,
+  0x00, 0x06, 0x03, 0x07, 0x8a, 0x05, 0xf3, 0x60, 0x20, 0xf2, 0x39, 0xaa,
+  0x80, 0xb4, 0x11, 0x02, 0x1b, 0x21, 0x42, 0x1b, 0x21, 0x23, 0x94, 0x21,
+  0x2b, 0x14, 0x19, 0xb2, 0x42, 0x99, 0x21, 0x2b, 0x94, 0x11, 0x2b, 0x94,
+  0x22, 0x2f, 0x14, 0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x2a, 0xc4,
+  0x91, 0x2e, 0x42, 0x1c, 0xe8, 0x22, 0x64, 0x11, 0x2e, 0x42, 0x96, 0xe1,
+  0x22, 0x64, 0x19, 0x2c, 0xa4, 0x29, 0x2c, 0xb4, 0x91, 0xc2, 0x42, 0x1b,
+  0x29, 0x24, 0x1b, 0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x32, 0x42,
+  0x19, 0xb2, 0x42, 0x98, 0x21, 0x2b, 0x84, 0x11, 0x2b, 0x84, 0x22, 0x2b,
+  0x84, 0x22, 0x3b, 0x84, 0x22, 0x39, 0xa8, 0x42, 0x88, 0x2e, 0x42, 0x1e,
+  0x1f, 0x80, 0xb4, 0x11, 0x86, 0xb4, 0x11, 0x22, 0xbc, 0x11, 0x22, 0x61,
+  0x00, 0x71, 0x98, 0x21, 0x2b, 0xb4, 0x19, 0xb2, 0x42, 0x5e, 0x00, 0xf7,
+  0x18, 0x2f, 0x14, 0x29, 0x92, 0x82, 0x2b, 0x42, 0x1c, 0xf8, 0x22, 0x52,
+  0x1c, 0xa8, 0xd2, 0x1e, 0x81, 0x2e, 0x42, 0x92, 0x2e, 0x42, 0x96, 0xc1,
+  0x43, 0x9a, 0xc2, 0x43, 0x1b, 0x29, 0x2c, 0xb4, 0x81, 0xc6, 0x42, 0x1b,
+  0x28, 0x42, 0x1b, 0x28, 0x62, 0x00, 0xb0, 0xa4, 0x1b, 0x28, 0x23, 0x24,
+  0xb2, 0x42, 0x28, 0xb2, 0x42, 0x28, 0x3a, 0x00, 0x82, 0x29, 0xe8, 0x22,
+  0xf4, 0x9b, 0x41, 0x00, 0x82, 0x4a, 0x0a, 0x02, 0x3e, 0x09, 0x50, 0x80,
+  0x01, 0x88, 0x00, 0x40, 0xef, 0x06, 0x07, 0x15, 0x00, 0x44, 0x25, 0x01,
+  0x1e, 0x86, 0xf7, 0x00, 0x50, 0x2d, 0x82, 0x00, 0x12, 0x20, 0x1a, 0x05,
+  0x13, 0x24, 0x1d, 0x00, 0x02, 0xd7, 0x05, 0x00, 0xef, 0x03, 0x40, 0xd2,
+  0xfd, 0x00, 0x82, 0xfb, 0x05, 0x23, 0x50, 0x22, 0x75, 0x04, 0x00, 0xcb,
+  0x02, 0x10, 0x18, 0x60, 0x07, 0x51, 0x10, 0x12, 0x02, 0x10, 0x01, 0xca,
+  0x03, 0x91, 0x11, 0x00, 0x14, 0x14, 0xf0, 0x7f, 0xa5, 0x00, 0xc2, 0xe3,
+  0x07, 0x10, 0x21, 0x30, 0x07, 0xf1, 0x11, 0xc0, 0x22, 0x00, 0x12, 0x31,
+  0x82, 0x18, 0x00, 0x20, 0x11, 0x01, 0x10, 0x01, 0x23, 0x44, 0x02, 0x00,
+  0x11, 0x11, 0x00, 0x10, 0x21, 0x02, 0x00, 0x00, 0x14, 0x40, 0x42, 0x41,
+  0x01, 0x4f, 0xe3, 0x26, 0x05, 0x00, 0x99, 0x00, 0x22, 0x24, 0x82, 0x71,
+  0x03, 0x21, 0x40, 0x02, 0x23, 0x06, 0x07, 0xae, 0x01, 0x25, 0xb7, 0x8b,
+  0x40, 0x05, 0x03, 0x75, 0x05, 0x1b, 0x25, 0x4d, 0x05, 0x42, 0xf7, 0xeb,
+  0x10, 0x01, 0x4e, 0x06, 0x06, 0x37, 0x00, 0x71, 0x20, 0x41, 0x01, 0x00,
+  0x00, 0x40, 0x81, 0xdc, 0x07, 0x00, 0x5a, 0x06, 0x30, 0xf0, 0xea, 0xbe,
+  0x6d, 0x05, 0x02, 0x21, 0x00, 0x02, 0x17, 0x05, 0x00, 0x46, 0x05, 0x00,
+  0x1f, 0x00, 0x03, 0x01, 0x08, 0x63, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x0b,
+  0x3c, 0x06, 0x07, 0x49, 0x00, 0x00, 0x96, 0x00, 0x02, 0x16, 0x00, 0x00,
+  0x06, 0x00, 0x30, 0x2f, 0x15, 0x01, 0xb2, 0x04, 0x03, 0xd0, 0x05, 0x31,
+  0x21, 0x00, 0x12, 0x9f, 0x07, 0x03, 0xc4, 0x04, 0x12, 0x11, 0x38, 0x00,
+  0x34, 0xf0, 0x6f, 0x4e, 0x2a, 0x05, 0x10, 0x12, 0x6c, 0x00, 0x20, 0xa0,
+  0x21, 0xbc, 0x06, 0x04, 0x50, 0x00, 0x10, 0x08, 0x3d, 0x00, 0x61, 0x40,
+  0x12, 0x01, 0xf0, 0x41, 0x9e, 0xd3, 0x00, 0x20, 0x12, 0x48, 0x59, 0x00,
+  0x11, 0x14, 0x5d, 0x05, 0x10, 0x40, 0x61, 0x06, 0x02, 0x73, 0x00, 0x01,
+  0x05, 0x08, 0xf2, 0x0a, 0x10, 0x01, 0xf0, 0x87, 0x34, 0x00, 0x00, 0x11,
+  0x40, 0x02, 0x00, 0x23, 0x04, 0x00, 0x80, 0x01, 0x50, 0x12, 0x00, 0x21,
+  0x20, 0x21, 0x02, 0x24, 0x38, 0x80, 0x00, 0x00, 0x65, 0x00, 0x13, 0x20,
+  0xd5, 0x00, 0x30, 0x7f, 0x2b, 0x0a, 0x38, 0x00, 0x26, 0x80, 0x01, 0xb5,
+  0x01, 0x32, 0x00, 0x00, 0x22, 0xb9, 0x00, 0x21, 0x88, 0x11, 0x3b, 0x01,
+  0x45, 0x10, 0x01, 0xcb, 0xec, 0x3e, 0x09, 0x02, 0x01, 0x00, 0x05, 0x42,
+  0x06, 0x02, 0x01, 0x00, 0x30, 0x14, 0x70, 0x76, 0x46, 0x08, 0x00, 0x63,
+  0x08, 0x10, 0x11, 0xd8, 0x00, 0xd6, 0x20, 0x01, 0x00, 0x18, 0x12, 0x18,
+  0x12, 0x00, 0x80, 0x01, 0x80, 0x01, 0x24, 0xe4, 0x08, 0x41, 0x14, 0xf0,
+  0xe9, 0xe9, 0x49, 0x00, 0x20, 0x80, 0x01, 0x24, 0x06, 0x02, 0x32, 0x00,
+  0x02, 0x30, 0x05, 0x05, 0x25, 0x00, 0x51, 0x40, 0x03, 0x9f, 0xdb, 0x0b,
+  0x0a, 0x00, 0x50, 0x10, 0x01, 0x12, 0x20, 0x01, 0x02, 0x00, 0x11, 0xc0,
+  0x54, 0x00, 0x03, 0xcc, 0x06, 0x03, 0x01, 0x00, 0x32, 0xe0, 0x97, 0x0e,
+  0x68, 0x00, 0x62, 0x20, 0x01, 0x00, 0x12, 0x20, 0x21, 0xd3, 0x06, 0x23,
+  0x80, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x28, 0x2f, 0x2e, 0xcb, 0x0a,
+  0x04, 0x01, 0x00, 0x16, 0x2d, 0x91, 0x00, 0x41, 0x21, 0xf0, 0xd3, 0x29,
+  0x0b, 0x01, 0x33, 0x12, 0x00, 0x18, 0x04, 0x00, 0x01, 0x6a, 0x05, 0x08,
+  0xf2, 0x0a, 0x60, 0x40, 0x02, 0x21, 0xd0, 0x7f, 0x0c, 0xc4, 0x02, 0x00,
+  0x21, 0x00, 0x02, 0xab, 0x00, 0x14, 0x11, 0xbf, 0x00, 0x14, 0x21, 0x4c,
+  0x00, 0xf0, 0x01, 0x11, 0x40, 0x01, 0x4f, 0x7c, 0x01, 0x00, 0x48, 0x00,
+  0x82, 0x00, 0x80, 0x01, 0x11, 0x80, 0x02, 0x26, 0x00, 0xc2, 0x21, 0x14,
+  0x18, 0x80, 0x08, 0x00, 0x80, 0x41, 0x81, 0x01, 0x00, 0x48, 0xa0, 0x00,
+  0xe0, 0x02, 0x40, 0x01, 0x14, 0x14, 0x00, 0x21, 0xf0, 0x1b, 0x82, 0x00,
+  0x82, 0x00, 0x88, 0xfa, 0x06, 0x50, 0x12, 0x12, 0x12, 0x12, 0x18, 0x38,
+  0x01, 0xf2, 0x00, 0x00, 0x11, 0x12, 0x18, 0x1a, 0x81, 0x21, 0x01, 0x18,
+  0x20, 0x81, 0x01, 0x40, 0x42, 0x02, 0x58, 0x00, 0x80, 0x11, 0x40, 0x01,
+  0x24, 0x40, 0x01, 0x1b, 0xda, 0x56, 0x00, 0xf0, 0x08, 0x08, 0x1a, 0x01,
+  0x00, 0x19, 0xc1, 0x11, 0x80, 0x01, 0x18, 0x18, 0x18, 0x1a, 0x01, 0x80,
+  0x01, 0x14, 0x18, 0x12, 0x20, 0x81, 0x01, 0x12, 0x4b, 0x01, 0x04, 0x8f,
+  0x01, 0x00, 0x1d, 0x07, 0x31, 0xf0, 0x99, 0x16, 0x0c, 0x00, 0x61, 0x1a,
+  0x21, 0x41, 0x01, 0x18, 0x00, 0x1a, 0x01, 0x00, 0xcd, 0x01, 0x60, 0x12,
+  0xa0, 0x11, 0x00, 0x18, 0x00, 0x2c, 0x06, 0x03, 0xb1, 0x00, 0x60, 0x00,
+  0x40, 0x02, 0xff, 0x64, 0x04, 0x4a, 0x08, 0x03, 0xeb, 0x0c, 0x02, 0xd3,
+  0x00, 0x02, 0x69, 0x06, 0x04, 0x22, 0x00, 0xf0, 0x00, 0x14, 0x11, 0x00,
+  0xf0, 0x88, 0xc6, 0x20, 0x08, 0x00, 0x88, 0x00, 0x12, 0x1a, 0x01, 0x40,
+  0x8f, 0x0e, 0xf0, 0x08, 0x1a, 0xa1, 0x11, 0xa0, 0x11, 0x18, 0x1a, 0x21,
+  0xa1, 0x11, 0x00, 0xa0, 0x11, 0x12, 0x20, 0x01, 0x18, 0x1a, 0xa1, 0x11,
+  0x12, 0x12, 0xe0, 0x13, 0x06, 0x31, 0x2b, 0x11, 0xa0, 0x5e, 0x00, 0xf1,
+  0x20, 0x50, 0x21, 0x25, 0x52, 0x12, 0x00, 0x10, 0x41, 0xf1, 0x68, 0x8e,
+  0x00, 0x4a, 0x04, 0x48, 0x88, 0x82, 0x00, 0x1a, 0x01, 0xe0, 0x11, 0xf1,
+  0x31, 0x31, 0x80, 0x03, 0x1a, 0xa1, 0x11, 0x1a, 0x01, 0x1e, 0x12, 0x21,
+  0x1a, 0x91, 0x12, 0xa0, 0x98, 0x80, 0xa8, 0x11, 0x1a, 0xa1, 0x11, 0x1f,
+  0x49, 0x06, 0x90, 0x12, 0x12, 0x4a, 0xe4, 0x21, 0xf1, 0x12, 0x52, 0x2b,
+  0x13, 0x00, 0xf0, 0x02, 0x00, 0x00, 0xa0, 0x22, 0x80, 0x02, 0x34, 0x25,
+  0x52, 0x12, 0x40, 0x12, 0x02, 0x14, 0xaf, 0x66, 0x05, 0x1e, 0x0e, 0xf0,
+  0x0d, 0x12, 0x1a, 0x01, 0x50, 0x11, 0x1d, 0x31, 0x00, 0xa0, 0x11, 0x80,
+  0x81, 0xa1, 0x11, 0x29, 0xa1, 0x11, 0x18, 0x14, 0x88, 0x1a, 0x21, 0x81,
+  0xa1, 0x11, 0x1a, 0x61, 0x11, 0x85, 0x00, 0x83, 0x1a, 0x81, 0x04, 0x2b,
+  0x11, 0x1a, 0x01, 0x1a, 0x34, 0x06, 0xf0, 0x07, 0x10, 0x11, 0x02, 0xf0,
   0x9d, 0x3f, 0x20, 0x88, 0x04, 0x42, 0x00, 0xa0, 0x11, 0x1a, 0x01, 0x18,
-  0x1d, 0x11, 0x1d, 0x31, 0x20, 0xa2, 0x11, 0x1a, 0xa1, 0x11, 0x18, 0x1a,
-  0xa1, 0x11, 0x2b, 0x11, 0x1e, 0x12, 0x40, 0xa1, 0x81, 0x1a, 0x21, 0x09,
-  0xa0, 0x11, 0x1e, 0x11, 0x1a, 0xb1, 0x11, 0xa1, 0x11, 0x1a, 0x81, 0x04,
-  0x5a, 0x81, 0xa1, 0x11, 0x1a, 0x01, 0x00, 0x00, 0x28, 0x20, 0x02, 0x00,
-  0x10, 0x01, 0x21, 0x40, 0xf1, 0xdc, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0x20, 0x41, 0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0xdb, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x11, 0x14, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x01,
-  0x00, 0x00, 0x12, 0x00, 0x00, 0x24, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x2d, 0x05, 0x48, 0x1b, 0x21, 0xb0,
-  0x11, 0x22, 0xb4, 0x11, 0x32, 0x42, 0x19, 0xb2, 0x42, 0x91, 0x21, 0x2b,
-  0x94, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0x42, 0x29, 0xf2, 0x42, 0x91, 0x22,
-  0x2f, 0x14, 0x29, 0xd2, 0x12, 0xa9, 0x42, 0x1c, 0xe9, 0x22, 0xc4, 0x81,
-  0x2e, 0x42, 0x16, 0xe1, 0x22, 0x64, 0x19, 0x2e, 0x42, 0x96, 0xc1, 0x42,
-  0x9a, 0xc2, 0x42, 0x1b, 0x29, 0x2c, 0xb4, 0x91, 0x42, 0xb2, 0x91, 0x22,
-  0xb4, 0x91, 0x32, 0x42, 0x1b, 0x28, 0x23, 0x94, 0x21, 0x2b, 0x84, 0x19,
-  0xb2, 0x42, 0x18, 0xb1, 0x42, 0x28, 0xb2, 0x42, 0x28, 0xb2, 0x42, 0x28,
-  0x92, 0x82, 0x2a, 0x84, 0xe8, 0x22, 0xb4, 0x2c, 0x01, 0x48, 0x1b, 0x61,
-  0x48, 0x1b, 0xa1, 0x42, 0x1b, 0x21, 0x23, 0x94, 0x21, 0x23, 0x94, 0x21,
-  0x2b, 0x94, 0x19, 0xb2, 0x42, 0x9b, 0x21, 0x2b, 0x94, 0x22, 0x2f, 0x14,
-  0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x81, 0x2b, 0x42, 0x2d, 0x91, 0x2e,
-  0x52, 0x1c, 0xe8, 0x22, 0xcd, 0x81, 0x2e, 0x42, 0x96, 0xe1, 0x22, 0x64,
-  0x19, 0x3c, 0xe4, 0x19, 0xc2, 0x42, 0x1b, 0x29, 0x2c, 0xb4, 0x91, 0xc6,
-  0x42, 0x1b, 0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x32, 0x42, 0x19,
-  0xb2, 0x42, 0x98, 0x21, 0x2b, 0xa4, 0x19, 0xb2, 0x42, 0x28, 0xb2, 0x42,
-  0x28, 0xa2, 0x84, 0x22, 0x39, 0xb8, 0x22, 0x84, 0xf8, 0x22, 0x42, 0x4f,
-  0x32, 0x0f, 0x20, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x00, 0x00, 0x30, 0x22, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x40, 0x02, 0x40, 0x01,
-  0x50, 0x12, 0xf0, 0xca, 0x7b, 0x00, 0x00, 0x11, 0x12, 0x00, 0x00, 0x00,
-  0x40, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x32,
-  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08,
-  0x00, 0x00, 0x00, 0x9f, 0xe7, 0x01, 0x20, 0x08, 0x00, 0x20, 0x28, 0x08,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x80, 0x01,
-  0x00, 0x00, 0x00, 0x18, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00,
-  0x11, 0x40, 0x01, 0x14, 0x40, 0x01, 0x5f, 0x84, 0x02, 0x20, 0x0c, 0x14,
-  0x00, 0x82, 0x00, 0x00, 0x30, 0x21, 0x00, 0x00, 0x00, 0x40, 0x02, 0x12,
-  0x12, 0x20, 0x48, 0x02, 0x18, 0xa0, 0x12, 0x11, 0x00, 0x00, 0x4e, 0x12,
-  0x20, 0x01, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x82, 0x00, 0x50, 0x21,
-  0x40, 0x01, 0x9f, 0xea, 0x0b, 0x00, 0x00, 0x18, 0x00, 0x82, 0x00, 0x00,
-  0x00, 0x80, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x14, 0x40, 0x01,
-  0x00, 0x00, 0x47, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0x20, 0x01, 0x12, 0x42, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x24, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x48, 0x00, 0x88, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0x00, 0xcf, 0xeb, 0x0f, 0x00, 0x00, 0x88, 0x42, 0x88, 0x58,
-  0x00, 0x28, 0x42, 0x00, 0x80, 0x04, 0x00, 0x48, 0x12, 0x00, 0x00, 0x00,
-  0xa0, 0x24, 0x00, 0x00, 0x24, 0x80, 0x22, 0x81, 0x01, 0x00, 0x20, 0x04,
-  0x82, 0x00, 0x20, 0x08, 0x82, 0x00, 0x00, 0x42, 0x26, 0x21, 0x02, 0x9d,
-  0x28, 0x00, 0x00, 0x80, 0x88, 0x04, 0x18, 0x00, 0x22, 0x48, 0x00, 0x80,
-  0x04, 0x12, 0xa0, 0x14, 0x52, 0x00, 0x00, 0x00, 0x20, 0x04, 0x42, 0x00,
-  0x10, 0x02, 0x18, 0x18, 0x20, 0x01, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x24, 0x82, 0x02, 0x3f, 0xdf, 0x05, 0x00, 0x00, 0x00, 0x82,
-  0x42, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x02, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x80, 0x08, 0x80,
-  0x28, 0x08, 0x82, 0x00, 0x88, 0x00, 0x14, 0x00, 0x5f, 0x7b, 0x0e, 0x20,
-  0x04, 0x00, 0x00, 0x20, 0x04, 0x00, 0x20, 0x86, 0x04, 0x42, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x82, 0x04, 0x00, 0x00, 0x00, 0x18, 0x48, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x20, 0xac, 0x48, 0x82, 0x00, 0x48, 0x22, 0x88, 0x28,
-  0x00, 0xd0, 0xe6, 0x02, 0x20, 0x04, 0x00, 0x00, 0x00, 0x20, 0x01, 0x20,
-  0x22, 0x01, 0x00, 0x12, 0x00, 0x20, 0x21, 0x05, 0x48, 0x52, 0x00, 0x18,
-  0x20, 0x02, 0x22, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00,
-  0x00, 0x00, 0x00, 0x14, 0x00, 0x46, 0x05, 0x00, 0x80, 0x02, 0x00, 0x42,
-  0x00, 0x00, 0x14, 0x24, 0x11, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x42, 0x00, 0x20, 0x04, 0x29, 0x02, 0x00, 0x00, 0x88, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xf0, 0xaa, 0xc9, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x42, 0x80, 0x01, 0x80, 0x34, 0x52, 0x80, 0x04, 0x18,
+  0x1d, 0x11, 0x1d, 0x31, 0x20, 0xa2, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0xf1,
+  0x02, 0x2b, 0x11, 0x1e, 0x12, 0x40, 0xa1, 0x81, 0x1a, 0x21, 0x09, 0xa0,
+  0x11, 0x1e, 0x11, 0x1a, 0xb1, 0x11, 0x40, 0x00, 0x10, 0x5a, 0x4e, 0x00,
+  0x03, 0x1a, 0x06, 0x71, 0x10, 0x01, 0x21, 0x40, 0xf1, 0xdc, 0xcb, 0x09,
+  0x01, 0x10, 0x12, 0x16, 0x04, 0x03, 0x64, 0x01, 0x1a, 0x18, 0x24, 0x01,
+  0x42, 0x00, 0xf0, 0xdb, 0x2a, 0x09, 0x00, 0x22, 0x11, 0x14, 0x36, 0x02,
+  0x10, 0x14, 0x29, 0x00, 0x47, 0x12, 0x00, 0x00, 0x24, 0x45, 0x02, 0xb1,
+  0xaf, 0x2d, 0x05, 0x48, 0x1b, 0x21, 0xb0, 0x11, 0x22, 0xb4, 0x11, 0x77,
+  0x05, 0x95, 0x91, 0x21, 0x2b, 0x94, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0xb5,
+  0x05, 0xc0, 0xd2, 0x12, 0xa9, 0x42, 0x1c, 0xe9, 0x22, 0xc4, 0x81, 0x2e,
+  0x42, 0x16, 0x13, 0x06, 0x00, 0xb5, 0x05, 0x20, 0x42, 0x9a, 0x13, 0x06,
+  0xa0, 0x2c, 0xb4, 0x91, 0x42, 0xb2, 0x91, 0x22, 0xb4, 0x91, 0x32, 0xb8,
+  0x05, 0x91, 0x94, 0x21, 0x2b, 0x84, 0x19, 0xb2, 0x42, 0x18, 0xb1, 0xb1,
+  0x05, 0x01, 0xb4, 0x05, 0xd2, 0x2a, 0x84, 0xe8, 0x22, 0xb4, 0x2c, 0x01,
+  0x48, 0x1b, 0x61, 0x48, 0x1b, 0xa1, 0x78, 0x06, 0x00, 0x27, 0x00, 0x00,
+  0x61, 0x00, 0x27, 0x9b, 0x21, 0x78, 0x06, 0xc3, 0x81, 0x2b, 0x42, 0x2d,
+  0x91, 0x2e, 0x52, 0x1c, 0xe8, 0x22, 0xcd, 0x81, 0x79, 0x06, 0x33, 0x3c,
+  0xe4, 0x19, 0x63, 0x00, 0x2c, 0xc6, 0x42, 0x7a, 0x06, 0x22, 0xa4, 0x19,
+  0x61, 0x00, 0xf1, 0x00, 0xa2, 0x84, 0x22, 0x39, 0xb8, 0x22, 0x84, 0xf8,
+  0x22, 0x42, 0x4f, 0x32, 0x0f, 0x20, 0x88, 0x35, 0x0b, 0x01, 0xd3, 0x0e,
+  0x10, 0x30, 0x64, 0x09, 0x01, 0x26, 0x05, 0x00, 0x9f, 0x01, 0x01, 0xde,
+  0x02, 0xa1, 0x02, 0x40, 0x01, 0x50, 0x12, 0xf0, 0xca, 0x7b, 0x00, 0x00,
+  0xb3, 0x03, 0x00, 0x41, 0x05, 0x01, 0x08, 0x00, 0x33, 0x02, 0x00, 0x32,
+  0x5c, 0x02, 0x03, 0x0a, 0x0c, 0x81, 0x00, 0x9f, 0xe7, 0x01, 0x20, 0x08,
+  0x00, 0x20, 0xa9, 0x0d, 0x00, 0x56, 0x06, 0x13, 0x12, 0x1f, 0x00, 0x12,
+  0x18, 0x64, 0x05, 0x10, 0x48, 0xfb, 0x02, 0x90, 0x14, 0x40, 0x01, 0x5f,
+  0x84, 0x02, 0x20, 0x0c, 0x14, 0x34, 0x04, 0x01, 0x9c, 0x0c, 0x00, 0xd0,
+  0x0b, 0xb1, 0x20, 0x48, 0x02, 0x18, 0xa0, 0x12, 0x11, 0x00, 0x00, 0x4e,
+  0x12, 0x93, 0x01, 0xc0, 0x20, 0x02, 0x00, 0x82, 0x00, 0x50, 0x21, 0x40,
+  0x01, 0x9f, 0xea, 0x0b, 0x98, 0x01, 0x01, 0x60, 0x04, 0x18, 0x04, 0xc2,
+  0x03, 0x02, 0x51, 0x00, 0x10, 0x14, 0x8e, 0x00, 0x24, 0x47, 0x4e, 0x11,
+  0x00, 0x50, 0x12, 0x20, 0x01, 0x12, 0x42, 0x09, 0x00, 0x11, 0xa0, 0x1e,
+  0x06, 0x10, 0x18, 0x23, 0x00, 0x12, 0x88, 0x59, 0x0b, 0xc0, 0xcf, 0xeb,
+  0x0f, 0x00, 0x00, 0x88, 0x42, 0x88, 0x58, 0x00, 0x28, 0x42, 0xdc, 0x00,
+  0x10, 0x48, 0xc4, 0x00, 0x00, 0x27, 0x00, 0xf0, 0x16, 0x24, 0x80, 0x22,
+  0x81, 0x01, 0x00, 0x20, 0x04, 0x82, 0x00, 0x20, 0x08, 0x82, 0x00, 0x00,
+  0x42, 0x26, 0x21, 0x02, 0x9d, 0x28, 0x00, 0x00, 0x80, 0x88, 0x04, 0x18,
+  0x00, 0x22, 0x48, 0x00, 0x80, 0x04, 0x12, 0xa0, 0x14, 0x52, 0x93, 0x00,
+  0x20, 0x04, 0x42, 0x3e, 0x08, 0x25, 0x18, 0x20, 0x1b, 0x01, 0x50, 0x24,
+  0x82, 0x02, 0x3f, 0xdf, 0x8d, 0x04, 0x10, 0x82, 0x74, 0x00, 0x03, 0x9d,
+  0x00, 0x10, 0x80, 0x64, 0x0e, 0x00, 0xac, 0x02, 0x60, 0x48, 0x80, 0x08,
+  0x80, 0x28, 0x08, 0x12, 0x04, 0x50, 0x14, 0x00, 0x5f, 0x7b, 0x0e, 0x99,
+  0x0c, 0x61, 0x20, 0x04, 0x00, 0x20, 0x86, 0x04, 0xa1, 0x00, 0x20, 0x10,
+  0x82, 0x44, 0x00, 0x21, 0x18, 0x48, 0x28, 0x01, 0xd1, 0x20, 0xac, 0x48,
+  0x82, 0x00, 0x48, 0x22, 0x88, 0x28, 0x00, 0xd0, 0xe6, 0x02, 0xc2, 0x0c,
+  0x20, 0x20, 0x01, 0x87, 0x0b, 0xc3, 0x12, 0x00, 0x20, 0x21, 0x05, 0x48,
+  0x52, 0x00, 0x18, 0x20, 0x02, 0x22, 0xa7, 0x07, 0x01, 0x78, 0x0e, 0x40,
+  0x14, 0x00, 0x46, 0x05, 0xaf, 0x01, 0x60, 0x42, 0x00, 0x00, 0x14, 0x24,
+  0x11, 0x07, 0x00, 0x01, 0xc1, 0x07, 0x40, 0x42, 0x00, 0x20, 0x04, 0x5c,
+  0x06, 0x12, 0x88, 0x11, 0x00, 0x51, 0x40, 0x01, 0xf0, 0xaa, 0xc9, 0x32,
+  0x00, 0xf1, 0x08, 0x42, 0x80, 0x01, 0x80, 0x34, 0x52, 0x80, 0x04, 0x18,
   0x00, 0x20, 0x81, 0x04, 0x46, 0x22, 0x21, 0x24, 0x82, 0x01, 0x00, 0x22,
-  0x20, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x80, 0x88, 0x28, 0x08, 0x80,
-  0x04, 0x80, 0x02, 0x00, 0x4f, 0xec, 0x0b, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x00, 0x40, 0x01, 0x14, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
-  0x00, 0x2a, 0x04, 0x00, 0x18, 0x30, 0x22, 0x00, 0x00, 0x80, 0x88, 0x04,
-  0x20, 0x84, 0x04, 0x00, 0x80, 0x22, 0x08, 0x10, 0x41, 0xf1, 0x71, 0xeb,
-  0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x2a, 0x84, 0x02, 0x48, 0x22, 0x48,
-  0x00, 0x1a, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x88, 0x0a, 0x48, 0x00, 0x22, 0x8a, 0x04,
-  0x00, 0x40, 0xf1, 0x1a, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x2a, 0x04, 0x00, 0x80, 0x01, 0x80, 0x84, 0x04, 0x00, 0x48, 0x20, 0x04,
-  0x00, 0x00, 0x20, 0x01, 0x48, 0x12, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80,
-  0x04, 0x42, 0x00, 0x20, 0x04, 0x82, 0x00, 0xbf, 0x2e, 0x0e, 0x00, 0x80,
-  0x84, 0x08, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x80, 0x01, 0x00, 0x00, 0x48, 0x00, 0x80, 0x04, 0x00, 0x42, 0x00, 0x80,
-  0x04, 0x48, 0x00, 0x20, 0x08, 0x00, 0x28, 0x00, 0x42, 0x40, 0xf1, 0xd3,
-  0xcd, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x22, 0x04, 0x52,
-  0x48, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x12,
-  0x48, 0x00, 0x80, 0x04, 0x00, 0x00, 0x42, 0x00, 0x00, 0x88, 0x00, 0x00,
-  0x82, 0xf0, 0x4c, 0xc1, 0x00, 0x00, 0x80, 0x04, 0x00, 0x42, 0x00, 0x28,
-  0x00, 0x48, 0x12, 0x48, 0x80, 0x04, 0x48, 0x20, 0x04, 0x00, 0x42, 0x48,
-  0x18, 0x28, 0x42, 0x00, 0x20, 0x04, 0x12, 0x00, 0x80, 0x04, 0x42, 0x00,
-  0x82, 0xc8, 0x80, 0x84, 0x08, 0x20, 0x22, 0x08, 0x88, 0x80, 0x08, 0xbf,
-  0x9e, 0x0d, 0x00, 0x48, 0x00, 0x80, 0x04, 0x00, 0x2a, 0x04, 0x00, 0x00,
-  0x80, 0x81, 0x01, 0x80, 0x04, 0x80, 0x04, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x42, 0x20, 0x08, 0x42,
-  0x00, 0x00, 0xf0, 0xc3, 0x7b, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04,
-  0x42, 0x20, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
-  0x80, 0x3c, 0x41, 0x00, 0xf0, 0x8d, 0xb4, 0x80, 0x24, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x80, 0x04, 0x20, 0x04, 0x20, 0x04,
-  0x00, 0x18, 0x42, 0x00, 0x48, 0x4a, 0x01, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x84, 0x44, 0x01, 0x4b, 0x4c, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x20, 0x21, 0x04, 0x00,
-  0x90, 0x12, 0x48, 0x18, 0x80, 0x0c, 0x00, 0x80, 0x44, 0x01, 0x80, 0x05,
-  0x48, 0x48, 0x42, 0x00, 0x00, 0x20, 0x24, 0xa4, 0x84, 0x28, 0x00, 0x14,
-  0x82, 0x11, 0x86, 0x01, 0x10, 0x02, 0xbf, 0x4b, 0x01, 0x00, 0x00, 0x42,
-  0x00, 0xa0, 0x44, 0x00, 0x48, 0x4a, 0x02, 0x00, 0x12, 0x42, 0x00, 0x48,
-  0x00, 0x48, 0x42, 0x42, 0x42, 0x20, 0xa1, 0x11, 0x80, 0x04, 0x48, 0x1a,
-  0xa1, 0x41, 0x48, 0x12, 0x20, 0x04, 0x20, 0x84, 0x04, 0x4a, 0x2c, 0xa8,
-  0xa4, 0x80, 0x08, 0x11, 0x2a, 0x28, 0x12, 0xe1, 0x14, 0xa8, 0x48, 0x1c,
-  0x08, 0x9f, 0x74, 0x04, 0x20, 0x04, 0x48, 0x00, 0x42, 0x00, 0x20, 0xa2,
-  0x24, 0x00, 0x28, 0x80, 0x84, 0x84, 0x81, 0x04, 0x4a, 0x04, 0x42, 0x00,
-  0xa0, 0x44, 0x20, 0x04, 0x42, 0x00, 0x20, 0xa4, 0x11, 0x18, 0x80, 0x04,
-  0x42, 0x00, 0x00, 0x88, 0x48, 0x20, 0x2c, 0x84, 0x88, 0xb2, 0x41, 0x02,
-  0x20, 0x44, 0x01, 0xdb, 0xd9, 0x80, 0x04, 0x20, 0x04, 0x00, 0x00, 0x42,
-  0x4a, 0x26, 0x82, 0xa4, 0x44, 0x4a, 0xa4, 0x54, 0x4a, 0xa1, 0x11, 0x5a,
-  0x24, 0x24, 0x04, 0x4a, 0x05, 0x48, 0x1a, 0x84, 0x04, 0x20, 0xa2, 0x44,
-  0x00, 0xa0, 0x44, 0x18, 0x00, 0x48, 0xa0, 0x44, 0x48, 0x48, 0x00, 0xa0,
-  0x44, 0x82, 0x4a, 0x84, 0x84, 0x04, 0x82, 0x8a, 0xac, 0xcc, 0x48, 0x20,
-  0x08, 0x5e, 0x57, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x20, 0x02, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x48, 0x00, 0x00, 0x28, 0x11, 0x14,
-  0x00, 0x00, 0x5f, 0xff, 0x09, 0x4a, 0x04, 0x00, 0xca, 0x04, 0x4a, 0x04,
-  0x00, 0x42, 0x22, 0x48, 0x00, 0x42, 0x80, 0xa1, 0x55, 0x80, 0xa4, 0x44,
-  0x5a, 0xa5, 0x44, 0x00, 0x48, 0x48, 0x1a, 0xa1, 0x32, 0x4a, 0xa4, 0x44,
-  0xa0, 0x44, 0x5a, 0xa5, 0x55, 0x1a, 0x21, 0x01, 0x4a, 0xa4, 0x44, 0x4a,
-  0x24, 0x04, 0xa0, 0xcc, 0xa0, 0x84, 0xa0, 0x44, 0x42, 0x1b, 0x88, 0xa0,
-  0xcc, 0x42, 0x1c, 0x88, 0x1c, 0x01, 0xbf, 0xa4, 0x05, 0x4a, 0xa4, 0x48,
-  0x00, 0x4a, 0x04, 0x4a, 0x04, 0xa0, 0x44, 0x42, 0x6a, 0x86, 0x06, 0x48,
-  0x5a, 0xa1, 0x44, 0x5a, 0xa1, 0x55, 0xe0, 0x24, 0xb4, 0x42, 0xa4, 0x15,
-  0x2b, 0x55, 0x4a, 0xa4, 0xd8, 0xa0, 0x84, 0x18, 0x2a, 0xa3, 0x44, 0x1f,
-  0x14, 0x04, 0x4e, 0x41, 0x4a, 0xa4, 0x51, 0x1a, 0xa5, 0x11, 0xa0, 0x44,
-  0x4a, 0xa4, 0x44, 0x4a, 0x04, 0xa0, 0x88, 0xc2, 0xaa, 0xa2, 0x44, 0x4a,
-  0xa4, 0x44, 0x8e, 0x81, 0x22, 0x1b, 0xee, 0xca, 0xcc, 0x82, 0x29, 0x4c,
-  0x11, 0xf2, 0x9f, 0xf9, 0xa0, 0x44, 0x48, 0x00, 0x4a, 0x04, 0x4a, 0x04,
-  0x4a, 0x04, 0x4a, 0x26, 0xa2, 0x24, 0x42, 0x42, 0x5a, 0x01, 0x5a, 0xa5,
-  0x11, 0x42, 0x4a, 0xb4, 0x42, 0xa4, 0x55, 0x4a, 0x05, 0x4a, 0xac, 0x44,
-  0x4a, 0xa4, 0x11, 0x2a, 0xa3, 0x44, 0x46, 0x01, 0x4a, 0xa4, 0x55, 0x5a,
-  0xa5, 0x51, 0x1a, 0x01, 0x4a, 0x84, 0xa4, 0x44, 0x4a, 0x04, 0xa0, 0xcc,
-  0x4a, 0xa4, 0xa4, 0x4a, 0xa4, 0xcc, 0x4a, 0xa4, 0x88, 0x2a, 0xa2, 0xc4,
-  0x4e, 0x41, 0x4a, 0xb8, 0x42, 0xe8, 0x18, 0x08, 0xd7, 0x92, 0xa0, 0x44,
-  0x82, 0x00, 0x4a, 0x2c, 0xa8, 0x44, 0xa0, 0x44, 0x4a, 0xa4, 0x64, 0x2a,
-  0xa2, 0x44, 0x4a, 0xa4, 0x44, 0x5a, 0xa1, 0x44, 0x5a, 0xa1, 0x55, 0x42,
-  0x4a, 0xb4, 0x42, 0xe4, 0x25, 0xa5, 0x54, 0x4a, 0xa4, 0xc1, 0x20, 0xac,
-  0x11, 0x2a, 0xa3, 0x44, 0x4e, 0x41, 0xb0, 0x41, 0xa4, 0x45, 0x5a, 0xa5,
-  0x11, 0x1a, 0x01, 0x4a, 0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x00, 0x8a, 0xa8,
-  0x8c, 0x8a, 0xaa, 0x44, 0xca, 0xac, 0x44, 0x8a, 0xa8, 0x8a, 0x6a, 0xae,
-  0xcc, 0x1b, 0xc4, 0x2b, 0xc4, 0x8e, 0x83, 0xf0, 0xc2, 0xf5, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x80, 0x04, 0x12, 0x80, 0x24, 0x04,
-  0x42, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x18, 0x00, 0x48,
-  0x80, 0x04, 0x00, 0x82, 0x00, 0x00, 0x20, 0x08, 0x40, 0x01, 0x00, 0x9f,
-  0x6b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x48, 0x80, 0x04, 0x12,
-  0x42, 0x00, 0x20, 0x04, 0x00, 0x00, 0x42, 0x00, 0x00, 0x48, 0x00, 0x80,
-  0x21, 0x01, 0x00, 0x00, 0x48, 0x00, 0x80, 0x24, 0x04, 0x88, 0x48, 0x20,
-  0x02, 0x48, 0x1b, 0x84, 0x80, 0x08, 0x13, 0x05, 0x48, 0x1b, 0x21, 0xb0,
-  0x11, 0x22, 0xb4, 0x11, 0x32, 0x42, 0x19, 0xb2, 0x42, 0x91, 0x21, 0x2b,
-  0x96, 0x19, 0xb2, 0x42, 0x19, 0xb1, 0x42, 0xa9, 0x42, 0x2f, 0x14, 0x29,
-  0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x2a, 0xc4, 0x91, 0x2e, 0x42, 0x4e,
-  0x81, 0x2e, 0x42, 0x16, 0xe1, 0x22, 0x64, 0x1d, 0x2e, 0x42, 0x96, 0xc1,
-  0x42, 0x9a, 0xc2, 0x42, 0x1b, 0x29, 0x2c, 0xb4, 0x91, 0x42, 0xb2, 0x91,
-  0x22, 0xb4, 0x91, 0x32, 0x42, 0x1b, 0x28, 0x23, 0x94, 0x61, 0x2b, 0x84,
-  0x19, 0xb6, 0x42, 0x98, 0x41, 0x2b, 0x84, 0x22, 0x2b, 0x84, 0x22, 0x2f,
-  0x14, 0x2a, 0x92, 0x82, 0x2a, 0x84, 0xe8, 0x22, 0xf4, 0xbb, 0xef, 0x00,
-  0x1b, 0x61, 0xb0, 0x11, 0x26, 0xb4, 0x11, 0x32, 0x42, 0x19, 0xb2, 0x42,
-  0x91, 0x21, 0x2b, 0x96, 0x19, 0xb2, 0x42, 0x9b, 0x21, 0x2b, 0x94, 0x22,
-  0x2f, 0x14, 0x29, 0xf2, 0x42, 0x91, 0x22, 0x2d, 0x91, 0x2b, 0x42, 0x2d,
-  0x81, 0x2e, 0x52, 0x4e, 0x81, 0x2e, 0xd2, 0x1e, 0x81, 0x2e, 0x42, 0xc6,
-  0x41, 0xe2, 0x19, 0xc2, 0x43, 0xde, 0x21, 0x24, 0x1b, 0x29, 0x2c, 0xb4,
-  0x91, 0xc6, 0x42, 0x1b, 0x29, 0x42, 0x1b, 0x29, 0x23, 0xb4, 0x81, 0x12,
-  0x92, 0x61, 0x23, 0x94, 0x61, 0x2b, 0xa4, 0x19, 0xb6, 0x42, 0x28, 0x32,
+  0x20, 0x04, 0x39, 0x00, 0xb0, 0x80, 0x88, 0x28, 0x08, 0x80, 0x04, 0x80,
+  0x02, 0x00, 0x4f, 0xec, 0xa2, 0x05, 0x62, 0x80, 0x04, 0x00, 0x40, 0x01,
+  0x14, 0x6d, 0x00, 0x91, 0x42, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x18, 0x30,
+  0x22, 0x0e, 0x01, 0xc1, 0x20, 0x84, 0x04, 0x00, 0x80, 0x22, 0x08, 0x10,
+  0x41, 0xf1, 0x71, 0xeb, 0x1c, 0x00, 0xa4, 0x00, 0x2a, 0x84, 0x02, 0x48,
+  0x22, 0x48, 0x00, 0x1a, 0x04, 0x44, 0x08, 0x01, 0x01, 0x00, 0xd2, 0x20,
+  0x88, 0x0a, 0x48, 0x00, 0x22, 0x8a, 0x04, 0x00, 0x40, 0xf1, 0x1a, 0xab,
+  0x13, 0x00, 0x20, 0x48, 0x2a, 0xb0, 0x06, 0x51, 0x80, 0x84, 0x04, 0x00,
+  0x48, 0x07, 0x01, 0x10, 0x01, 0x7d, 0x01, 0x10, 0x42, 0x6d, 0x00, 0x00,
+  0xb3, 0x00, 0x93, 0x82, 0x00, 0xbf, 0x2e, 0x0e, 0x00, 0x80, 0x84, 0x08,
+  0xc9, 0x00, 0x00, 0x3b, 0x01, 0x10, 0x01, 0x53, 0x00, 0x10, 0x80, 0xa2,
+  0x00, 0x30, 0x80, 0x04, 0x48, 0x5d, 0x02, 0x74, 0x28, 0x00, 0x42, 0x40,
+  0xf1, 0xd3, 0xcd, 0x7b, 0x01, 0x42, 0x22, 0x04, 0x52, 0x48, 0x0b, 0x00,
+  0x01, 0x68, 0x02, 0x01, 0x2c, 0x00, 0x00, 0x3f, 0x00, 0x71, 0x88, 0x00,
+  0x00, 0x82, 0xf0, 0x4c, 0xc1, 0xc8, 0x00, 0x90, 0x42, 0x00, 0x28, 0x00,
+  0x48, 0x12, 0x48, 0x80, 0x04, 0x75, 0x00, 0x40, 0x42, 0x48, 0x18, 0x28,
+  0x6d, 0x00, 0x11, 0x12, 0x75, 0x00, 0xe2, 0x82, 0xc8, 0x80, 0x84, 0x08,
+  0x20, 0x22, 0x08, 0x88, 0x80, 0x08, 0xbf, 0x9e, 0x0d, 0x6b, 0x00, 0x10,
+  0x2a, 0x38, 0x05, 0x50, 0x81, 0x01, 0x80, 0x04, 0x80, 0xad, 0x00, 0x01,
+  0x3d, 0x02, 0x01, 0x8b, 0x01, 0x91, 0x42, 0x20, 0x08, 0x42, 0x00, 0x00,
+  0xf0, 0xc3, 0x7b, 0x64, 0x00, 0x51, 0x80, 0x04, 0x42, 0x20, 0x04, 0xee,
+  0x00, 0x03, 0x2d, 0x04, 0x03, 0x07, 0x00, 0xb1, 0x42, 0x00, 0x80, 0x3c,
+  0x41, 0x00, 0xf0, 0x8d, 0xb4, 0x80, 0x24, 0x97, 0x00, 0x00, 0x3b, 0x00,
+  0xc1, 0x80, 0x04, 0x20, 0x04, 0x20, 0x04, 0x00, 0x18, 0x42, 0x00, 0x48,
+  0x4a, 0xd1, 0x00, 0x01, 0x01, 0x00, 0x75, 0x28, 0x20, 0x84, 0x44, 0x01,
+  0x4b, 0x4c, 0x60, 0x03, 0xf0, 0x16, 0x20, 0x21, 0x04, 0x00, 0x90, 0x12,
+  0x48, 0x18, 0x80, 0x0c, 0x00, 0x80, 0x44, 0x01, 0x80, 0x05, 0x48, 0x48,
+  0x42, 0x00, 0x00, 0x20, 0x24, 0xa4, 0x84, 0x28, 0x00, 0x14, 0x82, 0x11,
+  0x86, 0x01, 0x10, 0x02, 0xbf, 0x4b, 0x01, 0x61, 0x00, 0xf0, 0x0d, 0xa0,
+  0x44, 0x00, 0x48, 0x4a, 0x02, 0x00, 0x12, 0x42, 0x00, 0x48, 0x00, 0x48,
+  0x42, 0x42, 0x42, 0x20, 0xa1, 0x11, 0x80, 0x04, 0x48, 0x1a, 0xa1, 0x41,
+  0x48, 0x12, 0x20, 0x9e, 0x01, 0xf0, 0x04, 0x4a, 0x2c, 0xa8, 0xa4, 0x80,
+  0x08, 0x11, 0x2a, 0x28, 0x12, 0xe1, 0x14, 0xa8, 0x48, 0x1c, 0x08, 0x9f,
+  0x74, 0x04, 0xab, 0x00, 0xd0, 0x42, 0x00, 0x20, 0xa2, 0x24, 0x00, 0x28,
+  0x80, 0x84, 0x84, 0x81, 0x04, 0x4a, 0x39, 0x05, 0x10, 0x44, 0xca, 0x02,
+  0x40, 0x20, 0xa4, 0x11, 0x18, 0x0a, 0x01, 0xf0, 0x00, 0x00, 0x88, 0x48,
+  0x20, 0x2c, 0x84, 0x88, 0xb2, 0x41, 0x02, 0x20, 0x44, 0x01, 0xdb, 0xd9,
+  0xb3, 0x00, 0xf2, 0x27, 0x00, 0x00, 0x42, 0x4a, 0x26, 0x82, 0xa4, 0x44,
+  0x4a, 0xa4, 0x54, 0x4a, 0xa1, 0x11, 0x5a, 0x24, 0x24, 0x04, 0x4a, 0x05,
+  0x48, 0x1a, 0x84, 0x04, 0x20, 0xa2, 0x44, 0x00, 0xa0, 0x44, 0x18, 0x00,
+  0x48, 0xa0, 0x44, 0x48, 0x48, 0x00, 0xa0, 0x44, 0x82, 0x4a, 0x84, 0x84,
+  0x04, 0x82, 0x8a, 0xac, 0xcc, 0x48, 0x20, 0x08, 0x5e, 0x57, 0xc5, 0x0f,
+  0x22, 0x20, 0x02, 0xd7, 0x00, 0x16, 0x20, 0xac, 0x03, 0x00, 0xc1, 0x01,
+  0xf0, 0x6d, 0x00, 0x28, 0x11, 0x14, 0x00, 0x00, 0x5f, 0xff, 0x09, 0x4a,
+  0x04, 0x00, 0xca, 0x04, 0x4a, 0x04, 0x00, 0x42, 0x22, 0x48, 0x00, 0x42,
+  0x80, 0xa1, 0x55, 0x80, 0xa4, 0x44, 0x5a, 0xa5, 0x44, 0x00, 0x48, 0x48,
+  0x1a, 0xa1, 0x32, 0x4a, 0xa4, 0x44, 0xa0, 0x44, 0x5a, 0xa5, 0x55, 0x1a,
+  0x21, 0x01, 0x4a, 0xa4, 0x44, 0x4a, 0x24, 0x04, 0xa0, 0xcc, 0xa0, 0x84,
+  0xa0, 0x44, 0x42, 0x1b, 0x88, 0xa0, 0xcc, 0x42, 0x1c, 0x88, 0x1c, 0x01,
+  0xbf, 0xa4, 0x05, 0x4a, 0xa4, 0x48, 0x00, 0x4a, 0x04, 0x4a, 0x04, 0xa0,
+  0x44, 0x42, 0x6a, 0x86, 0x06, 0x48, 0x5a, 0xa1, 0x44, 0x5a, 0xa1, 0x55,
+  0xe0, 0x24, 0xb4, 0x42, 0xa4, 0x15, 0x2b, 0x55, 0x4a, 0xa4, 0xd8, 0xa0,
+  0x84, 0x18, 0x2a, 0xa3, 0x44, 0x1f, 0x14, 0x04, 0x4e, 0x41, 0x4a, 0xa4,
+  0x51, 0x1a, 0xa5, 0x11, 0xa0, 0x44, 0x4c, 0x00, 0x60, 0x04, 0xa0, 0x88,
+  0xc2, 0xaa, 0xa2, 0x0b, 0x00, 0xf2, 0x01, 0x8e, 0x81, 0x22, 0x1b, 0xee,
+  0xca, 0xcc, 0x82, 0x29, 0x4c, 0x11, 0xf2, 0x9f, 0xf9, 0xa0, 0x44, 0x4f,
+  0x00, 0xf1, 0x1b, 0x4a, 0x04, 0x4a, 0x26, 0xa2, 0x24, 0x42, 0x42, 0x5a,
+  0x01, 0x5a, 0xa5, 0x11, 0x42, 0x4a, 0xb4, 0x42, 0xa4, 0x55, 0x4a, 0x05,
+  0x4a, 0xac, 0x44, 0x4a, 0xa4, 0x11, 0x2a, 0xa3, 0x44, 0x46, 0x01, 0x4a,
+  0xa4, 0x55, 0x5a, 0xa5, 0x51, 0x1a, 0x01, 0x4a, 0x84, 0x4d, 0x00, 0xf0,
+  0x10, 0xcc, 0x4a, 0xa4, 0xa4, 0x4a, 0xa4, 0xcc, 0x4a, 0xa4, 0x88, 0x2a,
+  0xa2, 0xc4, 0x4e, 0x41, 0x4a, 0xb8, 0x42, 0xe8, 0x18, 0x08, 0xd7, 0x92,
+  0xa0, 0x44, 0x82, 0x00, 0x4a, 0x2c, 0xa8, 0x44, 0x74, 0x00, 0x21, 0x64,
+  0x2a, 0x6f, 0x00, 0x02, 0xa1, 0x00, 0x00, 0x52, 0x00, 0x90, 0xe4, 0x25,
+  0xa5, 0x54, 0x4a, 0xa4, 0xc1, 0x20, 0xac, 0x52, 0x00, 0xa1, 0x4e, 0x41,
+  0xb0, 0x41, 0xa4, 0x45, 0x5a, 0xa5, 0x11, 0x1a, 0xeb, 0x00, 0xf1, 0x0c,
+  0xa4, 0x44, 0x00, 0x8a, 0xa8, 0x8c, 0x8a, 0xaa, 0x44, 0xca, 0xac, 0x44,
+  0x8a, 0xa8, 0x8a, 0x6a, 0xae, 0xcc, 0x1b, 0xc4, 0x2b, 0xc4, 0x8e, 0x83,
+  0xf0, 0xc2, 0xf5, 0x43, 0x01, 0x20, 0x20, 0x02, 0x87, 0x04, 0x20, 0x80,
+  0x24, 0x7c, 0x02, 0x02, 0x6d, 0x02, 0x20, 0x18, 0x00, 0xff, 0x02, 0x10,
+  0x82, 0x78, 0x05, 0x53, 0x40, 0x01, 0x00, 0x9f, 0x6b, 0x17, 0x00, 0x40,
+  0x48, 0x80, 0x04, 0x12, 0xe6, 0x02, 0x01, 0x0c, 0x03, 0x42, 0x48, 0x00,
+  0x80, 0x21, 0x48, 0x03, 0xcd, 0x24, 0x04, 0x88, 0x48, 0x20, 0x02, 0x48,
+  0x1b, 0x84, 0x80, 0x08, 0x13, 0xb4, 0x06, 0x12, 0x96, 0xb4, 0x06, 0x2a,
+  0xa9, 0x42, 0xcb, 0x0c, 0x13, 0x4e, 0xb5, 0x06, 0x1f, 0x1d, 0xb5, 0x06,
+  0x06, 0x82, 0x61, 0x2b, 0x84, 0x19, 0xb6, 0x42, 0x98, 0x41, 0xcc, 0x0c,
+  0x32, 0x2f, 0x14, 0x2a, 0xb6, 0x06, 0x9a, 0xf4, 0xbb, 0xef, 0x00, 0x1b,
+  0x61, 0xb0, 0x11, 0x26, 0x63, 0x00, 0x09, 0xb6, 0x06, 0xa1, 0x91, 0x2b,
+  0x42, 0x2d, 0x81, 0x2e, 0x52, 0x4e, 0x81, 0x2e, 0xce, 0x0c, 0x9b, 0xc6,
+  0x41, 0xe2, 0x19, 0xc2, 0x43, 0xde, 0x21, 0x24, 0xb6, 0x06, 0x30, 0x12,
+  0x92, 0x61, 0x67, 0x00, 0xf1, 0x06, 0xa4, 0x19, 0xb6, 0x42, 0x28, 0x32,
   0x42, 0xb0, 0x42, 0x3a, 0x21, 0x29, 0xb8, 0x22, 0x94, 0x82, 0x2e, 0x42,
-  0x3f, 0xdd, 0x09, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-  0x02, 0x80, 0x04, 0x10, 0x02, 0x18, 0x80, 0x08, 0x00, 0x00, 0x14, 0x80,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
-  0x25, 0x01, 0x5f, 0x71, 0x0e, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x80,
-  0xa4, 0x41, 0x42, 0x48, 0x23, 0x22, 0x08, 0x48, 0x48, 0x00, 0x48, 0x42,
-  0x20, 0x44, 0x82, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x90, 0x41,
-  0x22, 0x80, 0x04, 0x86, 0x82, 0x08, 0x00, 0x20, 0x82, 0x02, 0x00, 0x48,
-  0xf0, 0x15, 0x19, 0x80, 0x21, 0x08, 0x20, 0x02, 0x20, 0x43, 0x02, 0x24,
-  0x50, 0x12, 0x12, 0x14, 0xc0, 0x42, 0x00, 0x80, 0x21, 0x05, 0x00, 0x21,
-  0x80, 0x01, 0x00, 0x23, 0x02, 0x29, 0x01, 0x21, 0x80, 0x83, 0x92, 0x12,
-  0x80, 0x81, 0x24, 0x02, 0x62, 0x00, 0x20, 0x08, 0x48, 0x50, 0x21, 0x1c,
-  0xe4, 0x14, 0x08, 0x86, 0x01, 0xce, 0xac, 0x20, 0x21, 0x0e, 0x80, 0x06,
-  0x80, 0x02, 0x00, 0x42, 0x2b, 0x16, 0x00, 0x28, 0x8e, 0x42, 0x20, 0x24,
-  0x44, 0x02, 0x42, 0x1a, 0x04, 0x8a, 0x44, 0x82, 0x01, 0x00, 0x11, 0x80,
-  0x81, 0x02, 0x42, 0x28, 0x28, 0x00, 0x42, 0x28, 0x00, 0x48, 0x86, 0x22,
-  0x02, 0x00, 0x20, 0x82, 0x42, 0xc1, 0x42, 0xc0, 0x81, 0xf0, 0x5a, 0xe3,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x40, 0x02, 0x14, 0x1a, 0x64, 0x34,
-  0x00, 0x00, 0x80, 0xa1, 0x41, 0x00, 0x10, 0x02, 0x22, 0x00, 0x30, 0x22,
-  0x10, 0x02, 0x21, 0x80, 0x01, 0x29, 0x01, 0x1c, 0x81, 0x24, 0x82, 0x24,
-  0x02, 0x88, 0x80, 0x08, 0x42, 0x50, 0x21, 0x48, 0x1c, 0x08, 0x42, 0xe0,
-  0xff, 0x0c, 0x00, 0x00, 0x80, 0x24, 0x02, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x80, 0x81, 0x24, 0x24, 0x22, 0x24, 0x02, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x28, 0x14, 0x00, 0x00, 0x00, 0x82, 0x20, 0x08, 0x82,
-  0x20, 0x08, 0x20, 0x04, 0xaf, 0xc6, 0x02, 0x00, 0x18, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x40, 0x42, 0x81, 0x11, 0x02, 0x80, 0x44, 0x01, 0x00, 0x00,
-  0x29, 0x12, 0x82, 0x02, 0x80, 0xa4, 0x41, 0x26, 0x02, 0x40, 0x41, 0x01,
-  0x11, 0x00, 0x00, 0x80, 0xa8, 0x84, 0x00, 0x20, 0x04, 0x22, 0x00, 0x48,
-  0x00, 0xc2, 0xdf, 0xbf, 0x0a, 0x00, 0x12, 0x00, 0x48, 0x80, 0x04, 0x00,
-  0x42, 0x00, 0x80, 0x11, 0x02, 0x20, 0x14, 0x01, 0x00, 0x48, 0x00, 0x21,
-  0x28, 0x00, 0x80, 0x84, 0x12, 0x02, 0x14, 0x14, 0x10, 0x01, 0x14, 0x00,
-  0x00, 0x82, 0x20, 0x08, 0x42, 0x80, 0x0a, 0x80, 0x04, 0x00, 0x4b, 0x3b,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x20,
-  0x81, 0x84, 0x24, 0x02, 0x22, 0x23, 0x22, 0x02, 0x00, 0x48, 0x12, 0x00,
-  0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x88, 0x04, 0x00, 0x88, 0x00, 0x20,
-  0x08, 0x20, 0xa4, 0x48, 0x2f, 0xe1, 0x0c, 0x42, 0x6a, 0x01, 0x80, 0x04,
-  0x00, 0x19, 0x04, 0x00, 0x20, 0x02, 0x28, 0x00, 0x28, 0x20, 0x02, 0x00,
-  0x20, 0x04, 0x48, 0x24, 0x28, 0x20, 0x02, 0x00, 0xc0, 0x41, 0x00, 0x00,
-  0x00, 0x00, 0x14, 0x00, 0x48, 0x00, 0x88, 0x10, 0x01, 0x11, 0x42, 0x42,
-  0x48, 0x9d, 0x7d, 0x14, 0x20, 0x04, 0x00, 0x00, 0xa2, 0x00, 0x00, 0xa0,
-  0x42, 0x48, 0x18, 0x00, 0x00, 0x24, 0x42, 0x20, 0x81, 0x04, 0x28, 0x00,
-  0x80, 0x14, 0x01, 0x40, 0x21, 0x81, 0x24, 0x21, 0x01, 0x00, 0x00, 0x14,
-  0x20, 0x24, 0x02, 0x00, 0x48, 0x80, 0x04, 0x24, 0x14, 0x00, 0x8f, 0xad,
-  0x02, 0x00, 0x00, 0x28, 0x40, 0x82, 0x08, 0x00, 0x48, 0x00, 0x21, 0x00,
-  0x14, 0x00, 0x00, 0x42, 0x00, 0x28, 0x00, 0x00, 0x00, 0x20, 0x22, 0x81,
-  0x04, 0x00, 0x23, 0x04, 0x20, 0x04, 0x00, 0x82, 0x82, 0x88, 0x00, 0x00,
-  0x11, 0x90, 0x81, 0x14, 0x00, 0x8b, 0xb8, 0x00, 0x1a, 0x02, 0x20, 0x06,
-  0x30, 0x22, 0x46, 0x01, 0x00, 0x00, 0x21, 0x28, 0x00, 0x22, 0x00, 0x42,
-  0x48, 0x00, 0x28, 0x22, 0x42, 0x30, 0x22, 0x20, 0x02, 0x10, 0x21, 0x14,
-  0x01, 0x90, 0x42, 0x00, 0x00, 0x11, 0x20, 0x28, 0x08, 0x00, 0xc2, 0x80,
-  0x04, 0x88, 0x42, 0x42, 0x46, 0xf2, 0xee, 0x86, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x04, 0x48, 0x42, 0x12, 0x10, 0x01, 0x80, 0x02, 0x00,
-  0x42, 0x48, 0x00, 0x00, 0x42, 0x00, 0x22, 0x12, 0x18, 0x80, 0x21, 0x01,
-  0x00, 0x48, 0x00, 0x14, 0x48, 0xa0, 0x48, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x14, 0x1f, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x30,
-  0x21, 0x28, 0x20, 0x06, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x82,
-  0x82, 0x00, 0x42, 0x82, 0x14, 0x3f, 0x16, 0x0b, 0x20, 0x04, 0x40, 0x22,
-  0x02, 0x12, 0x46, 0x02, 0x20, 0x41, 0x02, 0x20, 0x01, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x20, 0x82, 0x02, 0xa0, 0x42, 0x00, 0x20, 0x02, 0x00, 0x26,
-  0x02, 0x00, 0x24, 0x00, 0x40, 0x02, 0x42, 0x82, 0x42, 0x20, 0x04, 0x80,
-  0x08, 0xc2, 0xa7, 0x7e, 0x00, 0x00, 0x20, 0x24, 0x84, 0x24, 0x02, 0x4a,
+  0x3f, 0xdd, 0x09, 0x71, 0x06, 0x01, 0x3e, 0x06, 0x40, 0x80, 0x04, 0x10,
+  0x02, 0x94, 0x09, 0x13, 0x00, 0xac, 0x07, 0x01, 0x01, 0x00, 0x81, 0x42,
+  0x00, 0x25, 0x01, 0x5f, 0x71, 0x0e, 0x80, 0x90, 0x02, 0x90, 0x80, 0xa4,
+  0x41, 0x42, 0x48, 0x23, 0x22, 0x08, 0x48, 0x39, 0x03, 0x41, 0x20, 0x44,
+  0x82, 0x02, 0x53, 0x01, 0xf0, 0x16, 0x00, 0x90, 0x41, 0x22, 0x80, 0x04,
+  0x86, 0x82, 0x08, 0x00, 0x20, 0x82, 0x02, 0x00, 0x48, 0xf0, 0x15, 0x19,
+  0x80, 0x21, 0x08, 0x20, 0x02, 0x20, 0x43, 0x02, 0x24, 0x50, 0x12, 0x12,
+  0x14, 0xc0, 0x42, 0x00, 0x80, 0x21, 0x05, 0x8f, 0x0c, 0xf0, 0x13, 0x00,
+  0x23, 0x02, 0x29, 0x01, 0x21, 0x80, 0x83, 0x92, 0x12, 0x80, 0x81, 0x24,
+  0x02, 0x62, 0x00, 0x20, 0x08, 0x48, 0x50, 0x21, 0x1c, 0xe4, 0x14, 0x08,
+  0x86, 0x01, 0xce, 0xac, 0x20, 0x21, 0x0e, 0x80, 0x06, 0x8c, 0x05, 0xf0,
+  0x1d, 0x2b, 0x16, 0x00, 0x28, 0x8e, 0x42, 0x20, 0x24, 0x44, 0x02, 0x42,
+  0x1a, 0x04, 0x8a, 0x44, 0x82, 0x01, 0x00, 0x11, 0x80, 0x81, 0x02, 0x42,
+  0x28, 0x28, 0x00, 0x42, 0x28, 0x00, 0x48, 0x86, 0x22, 0x02, 0x00, 0x20,
+  0x82, 0x42, 0xc1, 0x42, 0xc0, 0x81, 0xf0, 0x5a, 0xe3, 0xa2, 0x00, 0xf0,
+  0x1f, 0x12, 0x24, 0x40, 0x02, 0x14, 0x1a, 0x64, 0x34, 0x00, 0x00, 0x80,
+  0xa1, 0x41, 0x00, 0x10, 0x02, 0x22, 0x00, 0x30, 0x22, 0x10, 0x02, 0x21,
+  0x80, 0x01, 0x29, 0x01, 0x1c, 0x81, 0x24, 0x82, 0x24, 0x02, 0x88, 0x80,
+  0x08, 0x42, 0x50, 0x21, 0x48, 0x1c, 0x08, 0x42, 0xe0, 0xff, 0x0c, 0x6f,
+  0x06, 0x00, 0x06, 0x02, 0x01, 0x34, 0x0b, 0x51, 0x24, 0x24, 0x22, 0x24,
+  0x02, 0x0a, 0x06, 0x30, 0x00, 0x00, 0x28, 0xe2, 0x0b, 0xb2, 0x82, 0x20,
+  0x08, 0x82, 0x20, 0x08, 0x20, 0x04, 0xaf, 0xc6, 0x02, 0xf5, 0x06, 0xf0,
+  0x07, 0x00, 0x40, 0x42, 0x81, 0x11, 0x02, 0x80, 0x44, 0x01, 0x00, 0x00,
+  0x29, 0x12, 0x82, 0x02, 0x80, 0xa4, 0x41, 0x26, 0x02, 0x40, 0x41, 0x35,
+  0x0a, 0x60, 0x80, 0xa8, 0x84, 0x00, 0x20, 0x04, 0x4f, 0x06, 0x61, 0xc2,
+  0xdf, 0xbf, 0x0a, 0x00, 0x12, 0x49, 0x02, 0x70, 0x42, 0x00, 0x80, 0x11,
+  0x02, 0x20, 0x14, 0xeb, 0x0a, 0xc1, 0x21, 0x28, 0x00, 0x80, 0x84, 0x12,
+  0x02, 0x14, 0x14, 0x10, 0x01, 0x14, 0x59, 0x00, 0x84, 0x42, 0x80, 0x0a,
+  0x80, 0x04, 0x00, 0x4b, 0x3b, 0x22, 0x08, 0xc2, 0x31, 0x00, 0x00, 0x20,
+  0x81, 0x84, 0x24, 0x02, 0x22, 0x23, 0x22, 0x02, 0x46, 0x07, 0x20, 0x80,
+  0x02, 0x20, 0x06, 0xf1, 0x08, 0x00, 0x88, 0x00, 0x20, 0x08, 0x20, 0xa4,
+  0x48, 0x2f, 0xe1, 0x0c, 0x42, 0x6a, 0x01, 0x80, 0x04, 0x00, 0x19, 0x04,
+  0x00, 0x20, 0x02, 0x28, 0x78, 0x09, 0x40, 0x20, 0x04, 0x48, 0x24, 0x08,
+  0x00, 0x20, 0xc0, 0x41, 0xb3, 0x00, 0x00, 0x5f, 0x06, 0xa0, 0x88, 0x10,
+  0x01, 0x11, 0x42, 0x42, 0x48, 0x9d, 0x7d, 0x14, 0xae, 0x02, 0xf0, 0x08,
+  0xa2, 0x00, 0x00, 0xa0, 0x42, 0x48, 0x18, 0x00, 0x00, 0x24, 0x42, 0x20,
+  0x81, 0x04, 0x28, 0x00, 0x80, 0x14, 0x01, 0x40, 0x21, 0x81, 0x24, 0xbf,
+  0x02, 0x40, 0x14, 0x20, 0x24, 0x02, 0xa4, 0x00, 0xc0, 0x24, 0x14, 0x00,
+  0x8f, 0xad, 0x02, 0x00, 0x00, 0x28, 0x40, 0x82, 0x08, 0xa7, 0x00, 0x00,
+  0xda, 0x0c, 0x00, 0xe2, 0x05, 0x80, 0x00, 0x00, 0x20, 0x22, 0x81, 0x04,
+  0x00, 0x23, 0xb9, 0x04, 0xf0, 0x07, 0x82, 0x82, 0x88, 0x00, 0x00, 0x11,
+  0x90, 0x81, 0x14, 0x00, 0x8b, 0xb8, 0x00, 0x1a, 0x02, 0x20, 0x06, 0x30,
+  0x22, 0x46, 0x01, 0x00, 0xd3, 0x00, 0xf0, 0x03, 0x22, 0x00, 0x42, 0x48,
+  0x00, 0x28, 0x22, 0x42, 0x30, 0x22, 0x20, 0x02, 0x10, 0x21, 0x14, 0x01,
+  0x90, 0x42, 0xf0, 0x0b, 0xd3, 0x28, 0x08, 0x00, 0xc2, 0x80, 0x04, 0x88,
+  0x42, 0x42, 0x46, 0xf2, 0xee, 0x86, 0x90, 0x05, 0x60, 0x04, 0x48, 0x42,
+  0x12, 0x10, 0x01, 0xd1, 0x01, 0x10, 0x48, 0x61, 0x00, 0x30, 0x22, 0x12,
+  0x18, 0x46, 0x03, 0x51, 0x48, 0x00, 0x14, 0x48, 0xa0, 0xc1, 0x05, 0x53,
+  0x11, 0x14, 0x1f, 0x29, 0x0c, 0x63, 0x02, 0x40, 0x30, 0x21, 0x28, 0x20,
+  0xb5, 0x0e, 0x01, 0x3b, 0x00, 0x30, 0x48, 0x00, 0x00, 0xba, 0x05, 0x00,
+  0x71, 0x07, 0xf1, 0x05, 0x82, 0x82, 0x00, 0x42, 0x82, 0x14, 0x3f, 0x16,
+  0x0b, 0x20, 0x04, 0x40, 0x22, 0x02, 0x12, 0x46, 0x02, 0x20, 0x41, 0x02,
+  0x90, 0x0d, 0x00, 0x04, 0x02, 0x30, 0x02, 0xa0, 0x42, 0x7e, 0x02, 0x10,
+  0x26, 0x59, 0x0f, 0xc0, 0x40, 0x02, 0x42, 0x82, 0x42, 0x20, 0x04, 0x80,
+  0x08, 0xc2, 0xa7, 0x7e, 0xf5, 0x05, 0xf2, 0x03, 0x84, 0x24, 0x02, 0x4a,
   0x02, 0x28, 0x00, 0x2a, 0x04, 0x20, 0x04, 0x22, 0x80, 0x84, 0x84, 0x06,
-  0x28, 0x48, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x80,
-  0x88, 0x08, 0x28, 0x00, 0x00, 0x00, 0x20, 0x08, 0x40, 0xf1, 0xdb, 0x3c,
-  0xc0, 0x41, 0x80, 0x05, 0x00, 0x26, 0x01, 0x00, 0x14, 0x20, 0x04, 0x11,
-  0x80, 0x04, 0x42, 0x00, 0x28, 0x20, 0x01, 0x23, 0x01, 0x58, 0x80, 0x04,
-  0x21, 0x80, 0x05, 0x29, 0x04, 0x18, 0x00, 0x48, 0x00, 0x00, 0x00, 0x82,
-  0x80, 0x08, 0x8a, 0x02, 0x00, 0x00, 0x28, 0xf0, 0xb3, 0xcb, 0x80, 0x04,
-  0x00, 0x00, 0x00, 0x42, 0x20, 0x84, 0x24, 0x06, 0x42, 0x48, 0x4a, 0x22,
-  0x02, 0x00, 0x22, 0xa0, 0x42, 0x20, 0x02, 0x42, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x84, 0x04, 0x00, 0x00, 0x00, 0x82, 0x00, 0x82, 0x88, 0x82,
-  0x88, 0x82, 0x88, 0x82, 0x88, 0x8a, 0xf4, 0x42, 0xed, 0x00, 0x00, 0x80,
-  0x84, 0x82, 0x81, 0x02, 0x00, 0x00, 0x4a, 0x02, 0x22, 0x00, 0x42, 0x62,
-  0x00, 0x20, 0x81, 0x22, 0x04, 0x00, 0x20, 0x02, 0x14, 0x00, 0x00, 0x00,
-  0x21, 0x80, 0x01, 0x48, 0xa0, 0x84, 0x82, 0x22, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x48, 0x00, 0x1b, 0xee, 0x00, 0x00, 0xa0, 0x21, 0x00, 0x21, 0x80,
-  0x01, 0x21, 0x11, 0x18, 0x24, 0x40, 0x22, 0x81, 0x62, 0x21, 0x28, 0x12,
-  0x00, 0x18, 0x80, 0x02, 0x00, 0x00, 0x80, 0x22, 0x04, 0x24, 0x28, 0x20,
-  0x01, 0x22, 0x21, 0x22, 0x00, 0x23, 0x02, 0x40, 0x02, 0x24, 0x40, 0x02,
-  0x00, 0x48, 0xf0, 0xb1, 0x6d, 0x00, 0xa2, 0x20, 0x86, 0x02, 0x28, 0x00,
-  0x00, 0x00, 0x42, 0x00, 0x22, 0x40, 0x01, 0x17, 0x22, 0x00, 0x00, 0x00,
-  0x22, 0x11, 0x22, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x48, 0x00, 0x82,
-  0x80, 0x88, 0x04, 0x00, 0x14, 0x10, 0x41, 0x41, 0x02, 0x14, 0xf0, 0x1a,
-  0x48, 0x80, 0x01, 0x1c, 0x04, 0x1c, 0x28, 0x04, 0x40, 0x21, 0x04, 0x48,
-  0x80, 0x02, 0x48, 0x00, 0x20, 0x04, 0xc0, 0x42, 0x00, 0x80, 0x18, 0x02,
-  0x29, 0x81, 0x92, 0x11, 0x14, 0x31, 0x80, 0x01, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x82, 0x19, 0x06, 0x24, 0xf0, 0x97,
-  0xf5, 0x80, 0xa5, 0x28, 0x12, 0x68, 0x16, 0xa2, 0x24, 0x28, 0x1a, 0xc2,
-  0x41, 0x42, 0x1b, 0x44, 0x4a, 0x14, 0x21, 0xa4, 0x64, 0x23, 0xa6, 0x44,
-  0x2a, 0x21, 0xa4, 0x62, 0x20, 0x82, 0xb2, 0x22, 0x02, 0x3a, 0x24, 0x22,
-  0x04, 0x4a, 0xa2, 0x22, 0x13, 0x02, 0x21, 0x46, 0x82, 0x41, 0x22, 0x21,
-  0xe4, 0x25, 0x84, 0x84, 0x02, 0x42, 0x88, 0x42, 0xa0, 0x82, 0x80, 0xb2,
-  0x82, 0x88, 0x8c, 0xc8, 0xc1, 0x88, 0x88, 0xc8, 0x8e, 0x81, 0xc8, 0x67,
-  0x61, 0x20, 0xa4, 0x48, 0x00, 0xee, 0x41, 0x2a, 0xb4, 0x21, 0x14, 0x62,
-  0x24, 0x2a, 0x01, 0x32, 0x22, 0x48, 0x11, 0x48, 0x2a, 0x92, 0x22, 0xa0,
-  0x14, 0x1c, 0x22, 0x04, 0x5a, 0x05, 0x20, 0xa4, 0x62, 0x30, 0x22, 0x24,
-  0x18, 0xa0, 0x25, 0x48, 0x6a, 0x04, 0x00, 0x20, 0x24, 0x14, 0xc2, 0x22,
-  0x82, 0x82, 0x20, 0x0c, 0x82, 0x10, 0x31, 0x82, 0x40, 0xf1, 0x81, 0x22,
-  0x60, 0x12, 0xc2, 0xef, 0xe4, 0x02, 0x11, 0x40, 0x01, 0x28, 0x20, 0x21,
-  0x02, 0x48, 0x10, 0xe2, 0x24, 0x84, 0x61, 0x12, 0x1a, 0x02, 0x4a, 0xe4,
-  0x12, 0x04, 0x27, 0x22, 0x38, 0x4a, 0x04, 0x26, 0x82, 0x82, 0x34, 0x12,
-  0x2e, 0x21, 0x18, 0x20, 0x04, 0x14, 0x00, 0x48, 0x28, 0x24, 0x22, 0x20,
-  0x01, 0x00, 0x88, 0x2b, 0xa8, 0x2c, 0x02, 0x48, 0x20, 0x0a, 0x8a, 0x32,
-  0x82, 0x4a, 0x24, 0x8c, 0x14, 0xf2, 0x3b, 0xc8, 0x30, 0x51, 0x30, 0x11,
-  0xb0, 0x11, 0x14, 0x32, 0x11, 0x2b, 0x12, 0x19, 0x94, 0x12, 0x11, 0x29,
-  0x91, 0x41, 0x29, 0x01, 0x29, 0x03, 0x29, 0x81, 0x94, 0x12, 0x80, 0x01,
-  0x4a, 0x42, 0x82, 0x42, 0x22, 0x45, 0xa2, 0x21, 0x24, 0x1a, 0x42, 0xa2,
-  0x21, 0x24, 0x5a, 0x42, 0xa2, 0x21, 0x24, 0x1a, 0x16, 0x82, 0x12, 0x82,
-  0x12, 0xa2, 0x28, 0x21, 0x10, 0x02, 0x21, 0x13, 0x12, 0x22, 0x1a, 0x32,
-  0xa1, 0x42, 0xa2, 0xf0, 0xb4, 0x6e, 0x14, 0x1f, 0x14, 0xf5, 0x31, 0x31,
-  0x11, 0x3e, 0x31, 0xde, 0x11, 0x3f, 0x37, 0x51, 0x22, 0x2f, 0x32, 0xf1,
-  0x52, 0x51, 0x3f, 0x31, 0xf1, 0x12, 0x12, 0x3f, 0x34, 0xf1, 0x53, 0x11,
-  0x3f, 0x25, 0xf1, 0x52, 0x53, 0x2f, 0x24, 0xb1, 0x32, 0xe1, 0x21, 0xf1,
-  0x13, 0x13, 0x21, 0x1f, 0x13, 0xa1, 0x11, 0x3a, 0xc5, 0x42, 0x25, 0xf2,
-  0x42, 0x42, 0x2f, 0x21, 0xa1, 0x57, 0x3f, 0x11, 0x71, 0x12, 0x92, 0x12,
-  0x38, 0x2b, 0x33, 0x2f, 0x22, 0xb2, 0x22, 0xe3, 0x24, 0xf3, 0x32, 0x32,
-  0x2f, 0x22, 0xb2, 0x32, 0xa3, 0x71, 0x2f, 0x22, 0xf2, 0x72, 0x72, 0x2f,
-  0x22, 0xb2, 0x42, 0xf4, 0x22, 0x22, 0x2f, 0x2e, 0x5e, 0x22, 0x2b, 0xc4,
-  0x25, 0x52, 0x22, 0x2f, 0x22, 0xba, 0xa2, 0xea, 0x22, 0xf2, 0x22, 0x83,
-  0x2d, 0x23, 0x2b, 0xa8, 0x2a, 0x96, 0x81, 0x3c, 0xf2, 0xe6, 0xda, 0x80,
-  0xf1, 0x31, 0x71, 0x1b, 0x11, 0x2e, 0x21, 0x4e, 0x21, 0x3f, 0x33, 0xf1,
-  0x13, 0x11, 0x2e, 0x31, 0x5e, 0x11, 0x35, 0x53, 0x13, 0x4a, 0xa5, 0x35,
-  0x35, 0x13, 0x83, 0xe3, 0x27, 0xf5, 0x22, 0x22, 0x37, 0x34, 0x2b, 0x57,
-  0x1f, 0x33, 0x01, 0x26, 0xb2, 0x12, 0xa4, 0x22, 0xde, 0xc2, 0x2f, 0x22,
-  0xa2, 0xc2, 0x3f, 0x11, 0x73, 0x32, 0xf2, 0x22, 0x32, 0x3d, 0x31, 0x2b,
-  0x33, 0x2f, 0x21, 0xd1, 0x22, 0xb1, 0x42, 0xa7, 0x73, 0x1e, 0x12, 0x25,
-  0xb2, 0x42, 0xf6, 0x32, 0x32, 0x2b, 0x44, 0xa0, 0x66, 0x2f, 0x22, 0xb2,
-  0x62, 0x0e, 0x6a, 0x5c, 0x22, 0x23, 0x02, 0x24, 0x2f, 0x2a, 0x3a, 0x22,
-  0xa8, 0x1f, 0x24, 0xa2, 0xea, 0x6e, 0x62, 0x2d, 0xa1, 0x3f, 0xe7, 0x0d,
-  0x5a, 0xb4, 0x21, 0xe6, 0x11, 0xa1, 0x22, 0x17, 0x24, 0x6a, 0xf2, 0x13,
-  0x31, 0x32, 0x1f, 0x24, 0x05, 0x3f, 0x14, 0x24, 0xe5, 0x24, 0x33, 0x41,
-  0x2f, 0x14, 0x24, 0xe7, 0x26, 0xb1, 0x42, 0xf4, 0x61, 0x61, 0x1e, 0x32,
-  0x37, 0x12, 0x2b, 0x22, 0x2a, 0xa4, 0x72, 0xe0, 0x26, 0x0e, 0x2b, 0x46,
-  0x17, 0x33, 0x2a, 0x43, 0x72, 0x32, 0xc1, 0x22, 0x1a, 0xc1, 0x42, 0x23,
-  0x87, 0xa6, 0x11, 0x24, 0x2f, 0x22, 0xa4, 0x24, 0x2b, 0x55, 0xe0, 0x26,
-  0x06, 0x2b, 0xcc, 0xaa, 0xea, 0x24, 0x06, 0x21, 0x88, 0x8e, 0x83, 0x2b,
-  0x8a, 0x19, 0xea, 0x18, 0xa8, 0xca, 0x2b, 0xc8, 0x2a, 0xaa, 0xcc, 0xcb,
-  0x51, 0x70, 0x11, 0xb1, 0x31, 0x43, 0xa1, 0x22, 0x1f, 0x2d, 0xf7, 0x31,
-  0x71, 0x2d, 0x22, 0x2b, 0x23, 0x1f, 0x24, 0xf1, 0x51, 0x51, 0x25, 0xb2,
-  0x52, 0xf4, 0x41, 0x53, 0x1f, 0x11, 0x55, 0x23, 0x2b, 0x67, 0x6a, 0xe1,
-  0x27, 0xf7, 0x63, 0x21, 0x6e, 0x62, 0x3f, 0x13, 0xb1, 0x32, 0x63, 0x26,
-  0x6a, 0xe7, 0x22, 0xf2, 0x62, 0xe2, 0x6a, 0xb6, 0xb2, 0xf5, 0x31, 0x23,
-  0x2e, 0x12, 0x2b, 0x22, 0x36, 0xe1, 0x21, 0xe3, 0x22, 0x92, 0x42, 0x7a,
-  0xe4, 0x21, 0xf3, 0x22, 0x22, 0x21, 0x7e, 0x52, 0x5a, 0xf3, 0x62, 0x62,
-  0x21, 0x4e, 0x42, 0xaa, 0xfa, 0x42, 0xc2, 0x2b, 0xaa, 0xce, 0xe2, 0x50,
-  0x22, 0x2b, 0x88, 0x2a, 0xe2, 0x2a, 0xd8, 0x22, 0x92, 0x82, 0x6a, 0xb4,
-  0xa2, 0xee, 0x24, 0xe4, 0x14, 0xfc, 0x2c, 0xd5, 0x00, 0x00, 0x20, 0x82,
-  0x04, 0x00, 0x48, 0x80, 0x04, 0x48, 0x80, 0x04, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x88, 0x08, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x22, 0x00, 0x28, 0x22, 0xa0,
-  0x42, 0x20, 0x02, 0x2a, 0x04, 0x80, 0x02, 0x00, 0x42, 0x00, 0x00, 0x80,
-  0x04, 0x00, 0x00, 0x80, 0x08, 0x00, 0x88, 0x82, 0x20, 0x08, 0x8a, 0x04,
-  0x8a, 0xb4, 0x65, 0x0a, 0x1c, 0xb5, 0x11, 0xc2, 0x11, 0x1b, 0x21, 0x4e,
-  0x13, 0x1b, 0x61, 0x2f, 0x36, 0xb1, 0x11, 0xf6, 0x62, 0x13, 0x1b, 0x61,
-  0x2f, 0x36, 0xb9, 0x11, 0xf2, 0x42, 0x93, 0x1b, 0x41, 0x2f, 0x34, 0x29,
-  0xf3, 0x42, 0xb3, 0x32, 0x2f, 0x34, 0xa9, 0x43, 0x2f, 0x14, 0xa9, 0x43,
-  0x4e, 0x91, 0x2e, 0x42, 0x1c, 0xfa, 0x22, 0x42, 0x5e, 0x21, 0x2f, 0x22,
-  0x65, 0x1d, 0x2f, 0x22, 0xe5, 0x1d, 0xf2, 0x22, 0x52, 0xda, 0xf2, 0x22,
-  0x52, 0x1b, 0x2d, 0x2f, 0x22, 0xb5, 0x91, 0xf2, 0x22, 0x12, 0x1b, 0x29,
-  0x2f, 0x26, 0xb1, 0x91, 0xf6, 0x62, 0x12, 0x1b, 0x28, 0x27, 0x26, 0x1b,
-  0x28, 0x2f, 0x26, 0x98, 0x21, 0x2f, 0x24, 0x38, 0x81, 0x2f, 0x24, 0xa8,
-  0x42, 0x2f, 0x24, 0xaa, 0x4a, 0x2f, 0x24, 0xaa, 0x4a, 0x2b, 0xa4, 0xaa,
-  0x84, 0xea, 0x2a, 0xf4, 0x93, 0x1e, 0x00, 0x68, 0x48, 0x20, 0x84, 0x26,
-  0x84, 0x04, 0x48, 0x4a, 0x88, 0x82, 0x8a, 0xa4, 0xa4, 0x22, 0x4e, 0x81,
-  0x22, 0x4a, 0xa8, 0x42, 0x4a, 0x38, 0x22, 0x4e, 0x81, 0x2b, 0x52, 0x4e,
-  0x81, 0x2a, 0xe9, 0x14, 0xa8, 0x42, 0xc2, 0x60, 0x1c, 0x1c, 0x24, 0x4c,
-  0x31, 0xc1, 0x48, 0x1b, 0x48, 0x48, 0x13, 0x28, 0xb4, 0x81, 0x04, 0x1b,
-  0x48, 0x42, 0x1b, 0x48, 0x90, 0x41, 0x4a, 0xba, 0x81, 0x84, 0x8a, 0xa4,
-  0x84, 0x8a, 0x04, 0x8a, 0x04, 0x23, 0x08, 0x2b, 0x48, 0xbf, 0x65, 0x04,
-  0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x28, 0x14, 0x20, 0x02, 0x00, 0x00,
-  0x00, 0x20, 0x04, 0x00, 0x80, 0x42, 0x01, 0x00, 0x00, 0x00, 0x25, 0x01,
-  0x4f, 0xbe, 0x03, 0x1c, 0x21, 0xc2, 0x11, 0xc0, 0x53, 0x42, 0x34, 0x2a,
-  0x41, 0x63, 0x11, 0x14, 0x24, 0x34, 0xc0, 0x42, 0xc0, 0x42, 0x40, 0x82,
-  0x01, 0x4a, 0x01, 0x20, 0x36, 0x22, 0x90, 0x12, 0x30, 0x22, 0xa0, 0x12,
-  0x10, 0x02, 0x29, 0x01, 0x23, 0x02, 0x27, 0x21, 0x42, 0x24, 0x60, 0x24,
-  0x60, 0x24, 0x88, 0x25, 0x02, 0x86, 0x02, 0x2c, 0x82, 0x04, 0x80, 0x02,
-  0x8a, 0x02, 0xcf, 0xd3, 0x09, 0x20, 0x08, 0x00, 0x80, 0x0c, 0x48, 0x20,
-  0x84, 0x82, 0xa4, 0x84, 0x14, 0x00, 0x22, 0x42, 0x22, 0x80, 0x02, 0x42,
-  0x80, 0x04, 0x20, 0x22, 0x01, 0x46, 0x82, 0x22, 0x06, 0x42, 0x20, 0x01,
-  0x00, 0x90, 0x41, 0x00, 0x88, 0x20, 0x08, 0x48, 0x13, 0x88, 0x08, 0x82,
-  0x40, 0x81, 0x44, 0x21, 0xf4, 0x3f, 0xe1, 0x10, 0xa1, 0x2c, 0x11, 0x30,
-  0x41, 0x29, 0x94, 0x41, 0x21, 0x19, 0x94, 0x13, 0x13, 0x84, 0xb2, 0x22,
-  0x94, 0xc2, 0x13, 0x14, 0x22, 0x34, 0x22, 0xb0, 0x12, 0x42, 0xa2, 0x14,
-  0x20, 0xc5, 0x42, 0x82, 0x24, 0x12, 0x24, 0x32, 0xd0, 0x21, 0x44, 0x22,
-  0x44, 0x22, 0x64, 0x24, 0x40, 0x22, 0x01, 0x30, 0x43, 0x42, 0x21, 0x50,
-  0x22, 0x22, 0x80, 0x8c, 0x28, 0x0a, 0x88, 0x40, 0x82, 0x44, 0x01, 0x5e,
-  0xd4, 0x80, 0x01, 0x18, 0x80, 0x01, 0x88, 0x1a, 0x02, 0x00, 0x40, 0x01,
-  0x00, 0x00, 0x42, 0x00, 0x22, 0x00, 0x28, 0x2a, 0x04, 0x80, 0x02, 0xa0,
-  0x12, 0x28, 0x22, 0x80, 0x01, 0x2a, 0x01, 0x24, 0x48, 0x00, 0x00, 0x4a,
-  0x28, 0xc8, 0x82, 0x40, 0x12, 0x41, 0x82, 0x04, 0x90, 0x21, 0x80, 0x8a,
-  0xf4, 0x53, 0x84, 0x00, 0x40, 0x01, 0x14, 0x70, 0x22, 0x02, 0x22, 0x48,
-  0x18, 0x48, 0x1c, 0x21, 0xc1, 0x12, 0x40, 0x22, 0x01, 0x12, 0x28, 0x00,
-  0x00, 0x00, 0x21, 0x90, 0x12, 0x00, 0x80, 0x01, 0x00, 0x25, 0x02, 0x22,
-  0x40, 0x02, 0x80, 0x22, 0xa4, 0x48, 0x00, 0x24, 0x40, 0x02, 0x20, 0x28,
-  0x24, 0x88, 0x02, 0xb6, 0x07, 0x4a, 0x02, 0x00, 0x10, 0x32, 0x11, 0x12,
-  0x42, 0x29, 0x11, 0x91, 0x12, 0x48, 0x21, 0x11, 0x58, 0x80, 0x84, 0x24,
-  0xa4, 0x41, 0x58, 0x28, 0x20, 0x04, 0x20, 0x84, 0xa4, 0x24, 0x4e, 0x32,
-  0x12, 0x22, 0x28, 0x2c, 0x81, 0x02, 0x28, 0x24, 0x42, 0x2b, 0x21, 0x2a,
-  0x24, 0x04, 0x23, 0x08, 0x21, 0x30, 0x82, 0x20, 0x0c, 0x88, 0x28, 0x42,
-  0x00, 0x88, 0x88, 0x2f, 0x7c, 0x04, 0x00, 0x11, 0x10, 0x11, 0xb2, 0x11,
-  0x32, 0x12, 0x4a, 0x92, 0x52, 0x11, 0x2b, 0x14, 0x11, 0x29, 0x11, 0x91,
-  0x12, 0x90, 0x12, 0x48, 0x58, 0x2a, 0xa4, 0x14, 0x00, 0x48, 0x40, 0x02,
-  0x2c, 0x84, 0x63, 0x23, 0x18, 0x22, 0x2a, 0x61, 0x21, 0x28, 0x24, 0x28,
-  0x24, 0x28, 0x23, 0x22, 0x12, 0x02, 0x29, 0x88, 0x34, 0xc2, 0x90, 0x82,
-  0x10, 0x02, 0x29, 0x08, 0xc8, 0x42, 0x88, 0x88, 0x82, 0x8f, 0x4f, 0x08,
-  0x2a, 0x04, 0x00, 0x40, 0x02, 0x00, 0x80, 0x01, 0x58, 0x80, 0x81, 0x04,
-  0x48, 0x00, 0x18, 0x20, 0x02, 0x00, 0x80, 0x04, 0x48, 0x42, 0x00, 0x00,
-  0x00, 0x10, 0x22, 0x84, 0x21, 0x24, 0x04, 0x28, 0x00, 0x00, 0x20, 0x0c,
-  0x80, 0x02, 0x00, 0x22, 0xf0, 0x97, 0xcb, 0x00, 0x6a, 0x01, 0x80, 0x02,
-  0x00, 0x48, 0x11, 0x18, 0x00, 0x22, 0x12, 0x22, 0x00, 0x24, 0x00, 0x80,
-  0x01, 0x22, 0x20, 0x83, 0x01, 0x00, 0x20, 0x81, 0x82, 0x02, 0x2a, 0x04,
-  0x00, 0x28, 0x00, 0x20, 0x02, 0x00, 0x42, 0x80, 0x04, 0x48, 0xa0, 0x28,
-  0x00, 0x00, 0x9f, 0x1e, 0x0c, 0x48, 0x42, 0x20, 0x02, 0x20, 0x04, 0x11,
-  0x00, 0x00, 0x22, 0x00, 0x42, 0x14, 0x20, 0x12, 0x02, 0x60, 0x21, 0x40,
-  0x01, 0x42, 0x80, 0x82, 0x22, 0xc2, 0x42, 0x00, 0x42, 0x48, 0x18, 0x18,
-  0x48, 0x42, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x82, 0x00, 0x30, 0x42,
-  0x20, 0x44, 0xf2, 0xd4, 0xa6, 0x00, 0x00, 0x18, 0x80, 0x81, 0x82, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x42, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x04, 0x00, 0x82, 0x00,
-  0x80, 0x04, 0x48, 0x80, 0x08, 0x00, 0xcf, 0x18, 0x0f, 0x48, 0x32, 0xa0,
-  0x12, 0x28, 0x18, 0x42, 0x80, 0x04, 0x00, 0x00, 0x12, 0x22, 0x48, 0xc0,
-  0x12, 0x22, 0x23, 0x04, 0x18, 0x24, 0x22, 0x80, 0x81, 0x05, 0x28, 0x00,
-  0x80, 0x22, 0x82, 0x84, 0x82, 0x01, 0x20, 0x06, 0x20, 0x24, 0x02, 0x80,
-  0x2c, 0x04, 0xa0, 0x84, 0x48, 0x48, 0x30, 0xc2, 0x20, 0x44, 0xf2, 0xa9,
-  0x1a, 0x00, 0x00, 0x00, 0x20, 0x82, 0x42, 0x11, 0x81, 0x01, 0x00, 0x00,
-  0x10, 0x01, 0x00, 0x00, 0x00, 0x11, 0x28, 0x20, 0x04, 0x1a, 0x22, 0x22,
-  0x15, 0x02, 0x00, 0x20, 0x21, 0x04, 0x22, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x20, 0x0a, 0x00, 0xf0, 0x41, 0x91, 0x00, 0x42, 0x80, 0x24, 0x84,
-  0x04, 0xc0, 0x22, 0x28, 0x80, 0x02, 0x12, 0x11, 0x00, 0x20, 0x81, 0x82,
-  0x04, 0x48, 0x00, 0x20, 0x01, 0x00, 0x48, 0x18, 0x18, 0x42, 0x18, 0x80,
-  0x02, 0x2c, 0x01, 0x00, 0x40, 0x02, 0x22, 0x28, 0x20, 0x08, 0x42, 0x42,
-  0x00, 0x00, 0x00, 0x8a, 0xf2, 0x6a, 0xa1, 0x00, 0x00, 0x00, 0x20, 0x04,
-  0x4a, 0x01, 0x1a, 0x22, 0xa4, 0x12, 0x80, 0x01, 0x00, 0x10, 0x02, 0x00,
-  0x00, 0x00, 0x48, 0x18, 0x48, 0x00, 0x00, 0x80, 0x81, 0x01, 0x20, 0x21,
-  0x01, 0x00, 0x00, 0x20, 0x04, 0x00, 0x80, 0x08, 0x21, 0x00, 0x00, 0xd7,
-  0x16, 0x80, 0x04, 0x00, 0x00, 0x00, 0x28, 0x48, 0x1c, 0x04, 0x42, 0x80,
-  0x02, 0x12, 0x18, 0x00, 0x18, 0x42, 0x20, 0x84, 0x24, 0x06, 0x12, 0x48,
-  0x80, 0x21, 0x84, 0x02, 0x22, 0x29, 0x04, 0x00, 0x42, 0x20, 0x04, 0x48,
-  0x20, 0x04, 0x20, 0x24, 0x08, 0x00, 0x00, 0x00, 0x80, 0xf4, 0xad, 0x73,
-  0x00, 0x80, 0x24, 0x01, 0x12, 0x20, 0x14, 0x21, 0x81, 0x02, 0x20, 0x04,
-  0x18, 0x00, 0x00, 0x42, 0x20, 0x05, 0x20, 0x01, 0x00, 0x22, 0x00, 0x2c,
-  0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x20, 0x04, 0x20, 0xa4, 0x84,
-  0x88, 0x80, 0x08, 0x00, 0x00, 0x2f, 0xc6, 0x0c, 0x20, 0x02, 0x28, 0x24,
-  0x80, 0x24, 0x03, 0x20, 0x24, 0x82, 0x04, 0x00, 0x20, 0x02, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x12, 0x4a, 0x81, 0x04, 0x00, 0x20, 0x01, 0x20, 0x45,
-  0x02, 0x80, 0x04, 0x00, 0x20, 0x02, 0x88, 0x20, 0x88, 0x08, 0x00, 0x00,
-  0x14, 0xaf, 0x8e, 0x07, 0x12, 0x00, 0x80, 0xa4, 0x41, 0x18, 0x21, 0x42,
-  0x40, 0x82, 0x05, 0x29, 0x01, 0x21, 0x2c, 0x01, 0x20, 0x81, 0x82, 0x04,
-  0x48, 0x18, 0x00, 0x00, 0x20, 0x82, 0x04, 0x80, 0x85, 0x02, 0x48, 0x00,
-  0x18, 0x10, 0x02, 0x28, 0x26, 0x02, 0x48, 0x29, 0x2a, 0x12, 0x42, 0x02,
-  0x88, 0x00, 0x00, 0x88, 0x9f, 0x53, 0x0a, 0x42, 0x00, 0x00, 0x00, 0x20,
-  0x21, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x18, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0x00, 0x48, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x8e, 0x0e, 0x00, 0x00, 0x14,
-  0x40, 0x21, 0x05, 0x42, 0x20, 0x41, 0x81, 0x24, 0x21, 0x01, 0xa0, 0x14,
-  0xa0, 0x21, 0x80, 0x01, 0x42, 0x20, 0x01, 0x42, 0x23, 0x82, 0x11, 0xa2,
-  0x41, 0x18, 0x48, 0x80, 0x12, 0x02, 0x42, 0x48, 0x4a, 0x01, 0x00, 0x42,
-  0x2a, 0x04, 0x48, 0x42, 0x82, 0x00, 0x00, 0x20, 0x24, 0x08, 0xbf, 0xa7,
-  0x0c, 0x11, 0x90, 0x41, 0x00, 0x80, 0x01, 0x20, 0x21, 0x01, 0x80, 0x02,
-  0x00, 0x18, 0x80, 0x01, 0x18, 0x21, 0xc0, 0x12, 0x42, 0x2c, 0x28, 0x01,
-  0x18, 0x22, 0x40, 0x81, 0x04, 0x48, 0x18, 0x48, 0x00, 0x00, 0x42, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x20, 0x04, 0x00, 0x21, 0x22, 0x6b, 0x29, 0x00,
+  0x28, 0x48, 0x4b, 0x08, 0x01, 0xa8, 0x07, 0x11, 0x08, 0xed, 0x00, 0xf0,
+  0x02, 0x08, 0x40, 0xf1, 0xdb, 0x3c, 0xc0, 0x41, 0x80, 0x05, 0x00, 0x26,
+  0x01, 0x00, 0x14, 0x20, 0x04, 0x11, 0xc6, 0x05, 0xe1, 0x28, 0x20, 0x01,
+  0x23, 0x01, 0x58, 0x80, 0x04, 0x21, 0x80, 0x05, 0x29, 0x04, 0x18, 0x30,
+  0x00, 0x40, 0x82, 0x80, 0x08, 0x8a, 0x2f, 0x01, 0x31, 0xf0, 0xb3, 0xcb,
+  0x9f, 0x00, 0xf1, 0x02, 0x42, 0x20, 0x84, 0x24, 0x06, 0x42, 0x48, 0x4a,
+  0x22, 0x02, 0x00, 0x22, 0xa0, 0x42, 0x20, 0x02, 0x42, 0xd4, 0x0f, 0x00,
+  0xd5, 0x07, 0x00, 0x5f, 0x0e, 0x22, 0x82, 0x88, 0x02, 0x00, 0xf0, 0x08,
+  0x8a, 0xf4, 0x42, 0xed, 0x00, 0x00, 0x80, 0x84, 0x82, 0x81, 0x02, 0x00,
+  0x00, 0x4a, 0x02, 0x22, 0x00, 0x42, 0x62, 0x00, 0x20, 0x81, 0x22, 0xca,
+  0x01, 0x00, 0x68, 0x02, 0x81, 0x21, 0x80, 0x01, 0x48, 0xa0, 0x84, 0x82,
+  0x22, 0x95, 0x00, 0x41, 0x48, 0x00, 0x1b, 0xee, 0xd0, 0x0e, 0xf0, 0x01,
+  0x21, 0x80, 0x01, 0x21, 0x11, 0x18, 0x24, 0x40, 0x22, 0x81, 0x62, 0x21,
+  0x28, 0x12, 0x00, 0x18, 0x27, 0x02, 0xf0, 0x02, 0x80, 0x22, 0x04, 0x24,
+  0x28, 0x20, 0x01, 0x22, 0x21, 0x22, 0x00, 0x23, 0x02, 0x40, 0x02, 0x24,
+  0x40, 0x62, 0x03, 0x60, 0xb1, 0x6d, 0x00, 0xa2, 0x20, 0x86, 0x21, 0x09,
+  0x00, 0x5a, 0x01, 0x30, 0x40, 0x01, 0x17, 0xc4, 0x02, 0x20, 0x22, 0x11,
+  0x60, 0x08, 0x01, 0x44, 0x08, 0x10, 0x82, 0x47, 0x02, 0xf0, 0x0b, 0x14,
+  0x10, 0x41, 0x41, 0x02, 0x14, 0xf0, 0x1a, 0x48, 0x80, 0x01, 0x1c, 0x04,
+  0x1c, 0x28, 0x04, 0x40, 0x21, 0x04, 0x48, 0x80, 0x02, 0x48, 0x00, 0x20,
+  0x04, 0x92, 0x03, 0xa2, 0x18, 0x02, 0x29, 0x81, 0x92, 0x11, 0x14, 0x31,
+  0x80, 0x01, 0x4f, 0x07, 0x00, 0x6d, 0x09, 0xf0, 0xea, 0x82, 0x19, 0x06,
+  0x24, 0xf0, 0x97, 0xf5, 0x80, 0xa5, 0x28, 0x12, 0x68, 0x16, 0xa2, 0x24,
+  0x28, 0x1a, 0xc2, 0x41, 0x42, 0x1b, 0x44, 0x4a, 0x14, 0x21, 0xa4, 0x64,
+  0x23, 0xa6, 0x44, 0x2a, 0x21, 0xa4, 0x62, 0x20, 0x82, 0xb2, 0x22, 0x02,
+  0x3a, 0x24, 0x22, 0x04, 0x4a, 0xa2, 0x22, 0x13, 0x02, 0x21, 0x46, 0x82,
+  0x41, 0x22, 0x21, 0xe4, 0x25, 0x84, 0x84, 0x02, 0x42, 0x88, 0x42, 0xa0,
+  0x82, 0x80, 0xb2, 0x82, 0x88, 0x8c, 0xc8, 0xc1, 0x88, 0x88, 0xc8, 0x8e,
+  0x81, 0xc8, 0x67, 0x61, 0x20, 0xa4, 0x48, 0x00, 0xee, 0x41, 0x2a, 0xb4,
+  0x21, 0x14, 0x62, 0x24, 0x2a, 0x01, 0x32, 0x22, 0x48, 0x11, 0x48, 0x2a,
+  0x92, 0x22, 0xa0, 0x14, 0x1c, 0x22, 0x04, 0x5a, 0x05, 0x20, 0xa4, 0x62,
+  0x30, 0x22, 0x24, 0x18, 0xa0, 0x25, 0x48, 0x6a, 0x04, 0x00, 0x20, 0x24,
+  0x14, 0xc2, 0x22, 0x82, 0x82, 0x20, 0x0c, 0x82, 0x10, 0x31, 0x82, 0x40,
+  0xf1, 0x81, 0x22, 0x60, 0x12, 0xc2, 0xef, 0xe4, 0x02, 0x11, 0x40, 0x01,
+  0x28, 0x20, 0x21, 0x02, 0x48, 0x10, 0xe2, 0x24, 0x84, 0x61, 0x12, 0x1a,
+  0x02, 0x4a, 0xe4, 0x12, 0x04, 0x27, 0x22, 0x38, 0x4a, 0x04, 0x26, 0x82,
+  0x82, 0x34, 0x12, 0x2e, 0x21, 0x18, 0x20, 0x04, 0x14, 0x00, 0x48, 0x28,
+  0x24, 0x22, 0x20, 0x01, 0x00, 0x88, 0x2b, 0xa8, 0x2c, 0x02, 0x48, 0x20,
+  0x0a, 0x8a, 0x32, 0x82, 0x4a, 0x24, 0x8c, 0x14, 0xf2, 0x3b, 0xc8, 0x30,
+  0x51, 0x30, 0x11, 0xb0, 0x11, 0x14, 0x32, 0x11, 0x2b, 0x12, 0x19, 0x94,
+  0x12, 0x11, 0x29, 0x91, 0x41, 0x29, 0x01, 0x29, 0x03, 0x29, 0x81, 0x94,
+  0x12, 0x80, 0x01, 0x4a, 0x42, 0x82, 0x42, 0x22, 0x45, 0xa2, 0x21, 0x24,
+  0x1a, 0x42, 0xa2, 0x21, 0x24, 0x5a, 0x05, 0x00, 0xf0, 0xff, 0xcc, 0x1a,
+  0x16, 0x82, 0x12, 0x82, 0x12, 0xa2, 0x28, 0x21, 0x10, 0x02, 0x21, 0x13,
+  0x12, 0x22, 0x1a, 0x32, 0xa1, 0x42, 0xa2, 0xf0, 0xb4, 0x6e, 0x14, 0x1f,
+  0x14, 0xf5, 0x31, 0x31, 0x11, 0x3e, 0x31, 0xde, 0x11, 0x3f, 0x37, 0x51,
+  0x22, 0x2f, 0x32, 0xf1, 0x52, 0x51, 0x3f, 0x31, 0xf1, 0x12, 0x12, 0x3f,
+  0x34, 0xf1, 0x53, 0x11, 0x3f, 0x25, 0xf1, 0x52, 0x53, 0x2f, 0x24, 0xb1,
+  0x32, 0xe1, 0x21, 0xf1, 0x13, 0x13, 0x21, 0x1f, 0x13, 0xa1, 0x11, 0x3a,
+  0xc5, 0x42, 0x25, 0xf2, 0x42, 0x42, 0x2f, 0x21, 0xa1, 0x57, 0x3f, 0x11,
+  0x71, 0x12, 0x92, 0x12, 0x38, 0x2b, 0x33, 0x2f, 0x22, 0xb2, 0x22, 0xe3,
+  0x24, 0xf3, 0x32, 0x32, 0x2f, 0x22, 0xb2, 0x32, 0xa3, 0x71, 0x2f, 0x22,
+  0xf2, 0x72, 0x72, 0x2f, 0x22, 0xb2, 0x42, 0xf4, 0x22, 0x22, 0x2f, 0x2e,
+  0x5e, 0x22, 0x2b, 0xc4, 0x25, 0x52, 0x22, 0x2f, 0x22, 0xba, 0xa2, 0xea,
+  0x22, 0xf2, 0x22, 0x83, 0x2d, 0x23, 0x2b, 0xa8, 0x2a, 0x96, 0x81, 0x3c,
+  0xf2, 0xe6, 0xda, 0x80, 0xf1, 0x31, 0x71, 0x1b, 0x11, 0x2e, 0x21, 0x4e,
+  0x21, 0x3f, 0x33, 0xf1, 0x13, 0x11, 0x2e, 0x31, 0x5e, 0x11, 0x35, 0x53,
+  0x13, 0x4a, 0xa5, 0x35, 0x35, 0x13, 0x83, 0xe3, 0x27, 0xf5, 0x22, 0x22,
+  0x37, 0x34, 0x2b, 0x57, 0x1f, 0x33, 0x01, 0x26, 0xb2, 0x12, 0xa4, 0x22,
+  0xde, 0xc2, 0x2f, 0x22, 0xa2, 0xc2, 0x3f, 0x11, 0x73, 0x32, 0xf2, 0x22,
+  0x32, 0x3d, 0x31, 0x2b, 0x33, 0x2f, 0x21, 0xd1, 0x22, 0xb1, 0x42, 0xa7,
+  0x73, 0x1e, 0x12, 0x25, 0xb2, 0x42, 0xf6, 0x32, 0x32, 0x2b, 0x44, 0xa0,
+  0x66, 0x2f, 0x22, 0xb2, 0x62, 0x0e, 0x6a, 0x5c, 0x22, 0x23, 0x02, 0x24,
+  0x2f, 0x2a, 0x3a, 0x22, 0xa8, 0x1f, 0x24, 0xa2, 0xea, 0x6e, 0x62, 0x2d,
+  0xa1, 0x3f, 0xe7, 0x0d, 0x5a, 0xb4, 0x21, 0xe6, 0x11, 0xa1, 0x22, 0x17,
+  0x24, 0x6a, 0xf2, 0x13, 0x31, 0x32, 0x1f, 0x24, 0x05, 0x3f, 0x14, 0x24,
+  0xe5, 0x24, 0x33, 0x41, 0x2f, 0x14, 0x24, 0xe7, 0x26, 0xb1, 0x42, 0xf4,
+  0x61, 0x61, 0x1e, 0x32, 0x37, 0x12, 0x2b, 0x22, 0x2a, 0xa4, 0x72, 0xe0,
+  0x26, 0x0e, 0x2b, 0x46, 0x17, 0x33, 0x2a, 0x43, 0x72, 0x32, 0xc1, 0x22,
+  0x1a, 0xc1, 0x42, 0x23, 0x87, 0xa6, 0x11, 0x24, 0x2f, 0x22, 0xa4, 0x24,
+  0x2b, 0x55, 0xe0, 0x26, 0x06, 0x2b, 0xcc, 0xaa, 0xea, 0x24, 0x06, 0x21,
+  0x88, 0x8e, 0x83, 0x2b, 0x8a, 0x19, 0xea, 0x18, 0xa8, 0xca, 0x2b, 0xc8,
+  0x2a, 0xaa, 0xcc, 0xcb, 0x51, 0x70, 0x11, 0xb1, 0x31, 0x43, 0xa1, 0x22,
+  0x1f, 0x2d, 0xf7, 0x31, 0x71, 0x2d, 0x22, 0x2b, 0x23, 0x1f, 0x24, 0xf1,
+  0x51, 0x51, 0x25, 0xb2, 0x52, 0xf4, 0x41, 0x53, 0x1f, 0x11, 0x55, 0x23,
+  0x2b, 0x67, 0x6a, 0xe1, 0x27, 0xf7, 0x63, 0x21, 0x6e, 0x62, 0x3f, 0x13,
+  0xb1, 0x32, 0x63, 0x26, 0x6a, 0xe7, 0x22, 0xf2, 0x62, 0xe2, 0x6a, 0xb6,
+  0xb2, 0xf5, 0x31, 0x23, 0x2e, 0x12, 0x2b, 0x22, 0x36, 0xe1, 0x21, 0xe3,
+  0x22, 0x92, 0x42, 0x7a, 0xe4, 0x21, 0xf3, 0x22, 0x22, 0x21, 0x7e, 0x52,
+  0x5a, 0xf3, 0x62, 0x62, 0x21, 0x4e, 0x42, 0xaa, 0xfa, 0x42, 0xc2, 0x2b,
+  0xaa, 0xce, 0xe2, 0x50, 0x22, 0x2b, 0x88, 0x2a, 0xe2, 0x2a, 0xd8, 0x22,
+  0x92, 0x82, 0x6a, 0xb4, 0xa2, 0xee, 0x24, 0xe4, 0x14, 0xfc, 0x2c, 0xd5,
+  0x00, 0x00, 0x20, 0x82, 0x04, 0xf6, 0x04, 0x00, 0x9d, 0x05, 0x07, 0x5c,
+  0x0b, 0x00, 0xab, 0x03, 0x02, 0x01, 0x00, 0x20, 0x7f, 0x88, 0x00, 0x07,
+  0x01, 0x04, 0x06, 0x51, 0x22, 0x42, 0x22, 0x00, 0x28, 0xd4, 0x03, 0x10,
+  0x2a, 0xc8, 0x0b, 0x01, 0x58, 0x0b, 0x01, 0xf4, 0x0c, 0xf1, 0x0c, 0x88,
+  0x82, 0x20, 0x08, 0x8a, 0x04, 0x8a, 0xb4, 0x65, 0x0a, 0x1c, 0xb5, 0x11,
+  0xc2, 0x11, 0x1b, 0x21, 0x4e, 0x13, 0x1b, 0x61, 0x2f, 0x36, 0xb1, 0x11,
+  0xf6, 0x62, 0x09, 0x00, 0xf0, 0x48, 0xb9, 0x11, 0xf2, 0x42, 0x93, 0x1b,
+  0x41, 0x2f, 0x34, 0x29, 0xf3, 0x42, 0xb3, 0x32, 0x2f, 0x34, 0xa9, 0x43,
+  0x2f, 0x14, 0xa9, 0x43, 0x4e, 0x91, 0x2e, 0x42, 0x1c, 0xfa, 0x22, 0x42,
+  0x5e, 0x21, 0x2f, 0x22, 0x65, 0x1d, 0x2f, 0x22, 0xe5, 0x1d, 0xf2, 0x22,
+  0x52, 0xda, 0xf2, 0x22, 0x52, 0x1b, 0x2d, 0x2f, 0x22, 0xb5, 0x91, 0xf2,
+  0x22, 0x12, 0x1b, 0x29, 0x2f, 0x26, 0xb1, 0x91, 0xf6, 0x62, 0x12, 0x1b,
+  0x28, 0x27, 0x26, 0x1b, 0x28, 0x2f, 0x26, 0x98, 0x21, 0x2f, 0x24, 0x38,
+  0x81, 0x2f, 0x24, 0xa8, 0x42, 0x2f, 0x24, 0xaa, 0x4a, 0x04, 0x00, 0xf4,
+  0x49, 0x2b, 0xa4, 0xaa, 0x84, 0xea, 0x2a, 0xf4, 0x93, 0x1e, 0x00, 0x68,
+  0x48, 0x20, 0x84, 0x26, 0x84, 0x04, 0x48, 0x4a, 0x88, 0x82, 0x8a, 0xa4,
+  0xa4, 0x22, 0x4e, 0x81, 0x22, 0x4a, 0xa8, 0x42, 0x4a, 0x38, 0x22, 0x4e,
+  0x81, 0x2b, 0x52, 0x4e, 0x81, 0x2a, 0xe9, 0x14, 0xa8, 0x42, 0xc2, 0x60,
+  0x1c, 0x1c, 0x24, 0x4c, 0x31, 0xc1, 0x48, 0x1b, 0x48, 0x48, 0x13, 0x28,
+  0xb4, 0x81, 0x04, 0x1b, 0x48, 0x42, 0x1b, 0x48, 0x90, 0x41, 0x4a, 0xba,
+  0x81, 0x84, 0x8a, 0xa4, 0x84, 0x8a, 0x04, 0x8a, 0x04, 0x23, 0x08, 0x2b,
+  0x48, 0xbf, 0x65, 0x04, 0x82, 0xff, 0x00, 0x02, 0x8c, 0x04, 0x10, 0x88,
+  0xff, 0x06, 0x00, 0xca, 0x07, 0x00, 0xf3, 0x08, 0x20, 0x80, 0x42, 0xfe,
+  0x07, 0xf0, 0x33, 0x25, 0x01, 0x4f, 0xbe, 0x03, 0x1c, 0x21, 0xc2, 0x11,
+  0xc0, 0x53, 0x42, 0x34, 0x2a, 0x41, 0x63, 0x11, 0x14, 0x24, 0x34, 0xc0,
+  0x42, 0xc0, 0x42, 0x40, 0x82, 0x01, 0x4a, 0x01, 0x20, 0x36, 0x22, 0x90,
+  0x12, 0x30, 0x22, 0xa0, 0x12, 0x10, 0x02, 0x29, 0x01, 0x23, 0x02, 0x27,
+  0x21, 0x42, 0x24, 0x60, 0x24, 0x60, 0x24, 0x88, 0x25, 0x02, 0x86, 0x02,
+  0x2c, 0x82, 0x04, 0x80, 0x02, 0x8a, 0x02, 0xcf, 0xd3, 0x5a, 0x08, 0x90,
+  0x80, 0x0c, 0x48, 0x20, 0x84, 0x82, 0xa4, 0x84, 0x14, 0x5d, 0x01, 0xf1,
+  0x5d, 0x80, 0x02, 0x42, 0x80, 0x04, 0x20, 0x22, 0x01, 0x46, 0x82, 0x22,
+  0x06, 0x42, 0x20, 0x01, 0x00, 0x90, 0x41, 0x00, 0x88, 0x20, 0x08, 0x48,
+  0x13, 0x88, 0x08, 0x82, 0x40, 0x81, 0x44, 0x21, 0xf4, 0x3f, 0xe1, 0x10,
+  0xa1, 0x2c, 0x11, 0x30, 0x41, 0x29, 0x94, 0x41, 0x21, 0x19, 0x94, 0x13,
+  0x13, 0x84, 0xb2, 0x22, 0x94, 0xc2, 0x13, 0x14, 0x22, 0x34, 0x22, 0xb0,
+  0x12, 0x42, 0xa2, 0x14, 0x20, 0xc5, 0x42, 0x82, 0x24, 0x12, 0x24, 0x32,
+  0xd0, 0x21, 0x44, 0x22, 0x44, 0x22, 0x64, 0x24, 0x40, 0x22, 0x01, 0x30,
+  0x43, 0x42, 0x21, 0x50, 0x22, 0x22, 0x80, 0x8c, 0x28, 0x0a, 0x88, 0x40,
+  0x82, 0x44, 0x01, 0x5e, 0xd4, 0x80, 0x01, 0x18, 0x80, 0x01, 0x88, 0x1a,
+  0x02, 0x5e, 0x0f, 0x50, 0x42, 0x00, 0x22, 0x00, 0x28, 0xcc, 0x01, 0xf0,
+  0x0d, 0xa0, 0x12, 0x28, 0x22, 0x80, 0x01, 0x2a, 0x01, 0x24, 0x48, 0x00,
+  0x00, 0x4a, 0x28, 0xc8, 0x82, 0x40, 0x12, 0x41, 0x82, 0x04, 0x90, 0x21,
+  0x80, 0x8a, 0xf4, 0x53, 0x84, 0xa7, 0x0d, 0xf0, 0x00, 0x70, 0x22, 0x02,
+  0x22, 0x48, 0x18, 0x48, 0x1c, 0x21, 0xc1, 0x12, 0x40, 0x22, 0x01, 0x12,
+  0x58, 0x05, 0x30, 0x21, 0x90, 0x12, 0xbe, 0x0c, 0xf0, 0x1c, 0x25, 0x02,
+  0x22, 0x40, 0x02, 0x80, 0x22, 0xa4, 0x48, 0x00, 0x24, 0x40, 0x02, 0x20,
+  0x28, 0x24, 0x88, 0x02, 0xb6, 0x07, 0x4a, 0x02, 0x00, 0x10, 0x32, 0x11,
+  0x12, 0x42, 0x29, 0x11, 0x91, 0x12, 0x48, 0x21, 0x11, 0x58, 0x80, 0x84,
+  0x24, 0xa4, 0x41, 0x58, 0x28, 0x3c, 0x0c, 0xf0, 0x22, 0xa4, 0x24, 0x4e,
+  0x32, 0x12, 0x22, 0x28, 0x2c, 0x81, 0x02, 0x28, 0x24, 0x42, 0x2b, 0x21,
+  0x2a, 0x24, 0x04, 0x23, 0x08, 0x21, 0x30, 0x82, 0x20, 0x0c, 0x88, 0x28,
+  0x42, 0x00, 0x88, 0x88, 0x2f, 0x7c, 0x04, 0x00, 0x11, 0x10, 0x11, 0xb2,
+  0x11, 0x32, 0x12, 0x4a, 0x92, 0x52, 0x11, 0x2b, 0x14, 0x11, 0x44, 0x00,
+  0xf0, 0x2d, 0x90, 0x12, 0x48, 0x58, 0x2a, 0xa4, 0x14, 0x00, 0x48, 0x40,
+  0x02, 0x2c, 0x84, 0x63, 0x23, 0x18, 0x22, 0x2a, 0x61, 0x21, 0x28, 0x24,
+  0x28, 0x24, 0x28, 0x23, 0x22, 0x12, 0x02, 0x29, 0x88, 0x34, 0xc2, 0x90,
+  0x82, 0x10, 0x02, 0x29, 0x08, 0xc8, 0x42, 0x88, 0x88, 0x82, 0x8f, 0x4f,
+  0x08, 0x2a, 0x04, 0x00, 0x40, 0x02, 0x00, 0x80, 0x01, 0x58, 0x80, 0x81,
+  0x04, 0x48, 0xd3, 0x0e, 0x01, 0x6c, 0x07, 0x00, 0x0b, 0x0f, 0xf0, 0x04,
+  0x22, 0x84, 0x21, 0x24, 0x04, 0x28, 0x00, 0x00, 0x20, 0x0c, 0x80, 0x02,
+  0x00, 0x22, 0xf0, 0x97, 0xcb, 0x00, 0x6a, 0x81, 0x07, 0xf0, 0x0a, 0x48,
+  0x11, 0x18, 0x00, 0x22, 0x12, 0x22, 0x00, 0x24, 0x00, 0x80, 0x01, 0x22,
+  0x20, 0x83, 0x01, 0x00, 0x20, 0x81, 0x82, 0x02, 0x2a, 0x04, 0x00, 0x28,
+  0x3f, 0x07, 0xf0, 0x03, 0x42, 0x80, 0x04, 0x48, 0xa0, 0x28, 0x00, 0x00,
+  0x9f, 0x1e, 0x0c, 0x48, 0x42, 0x20, 0x02, 0x20, 0x04, 0x11, 0x0e, 0x03,
+  0xf0, 0x00, 0x42, 0x14, 0x20, 0x12, 0x02, 0x60, 0x21, 0x40, 0x01, 0x42,
+  0x80, 0x82, 0x22, 0xc2, 0x42, 0xf6, 0x0d, 0x11, 0x18, 0x64, 0x00, 0x10,
+  0x2a, 0x2d, 0x0b, 0xc0, 0x30, 0x42, 0x20, 0x44, 0xf2, 0xd4, 0xa6, 0x00,
+  0x00, 0x18, 0x80, 0x81, 0x04, 0x0a, 0x00, 0x8a, 0x0e, 0x01, 0x03, 0x0f,
+  0x12, 0x04, 0xc5, 0x0d, 0x00, 0x13, 0x0f, 0x10, 0x82, 0x96, 0x00, 0xd0,
+  0x80, 0x08, 0x00, 0xcf, 0x18, 0x0f, 0x48, 0x32, 0xa0, 0x12, 0x28, 0x18,
+  0x42, 0x4d, 0x03, 0xf0, 0x1a, 0x12, 0x22, 0x48, 0xc0, 0x12, 0x22, 0x23,
+  0x04, 0x18, 0x24, 0x22, 0x80, 0x81, 0x05, 0x28, 0x00, 0x80, 0x22, 0x82,
+  0x84, 0x82, 0x01, 0x20, 0x06, 0x20, 0x24, 0x02, 0x80, 0x2c, 0x04, 0xa0,
+  0x84, 0x48, 0x48, 0x30, 0xc2, 0x20, 0x44, 0xf2, 0xa9, 0x1a, 0x54, 0x00,
+  0x80, 0x82, 0x42, 0x11, 0x81, 0x01, 0x00, 0x00, 0x10, 0x8f, 0x02, 0xd1,
+  0x11, 0x28, 0x20, 0x04, 0x1a, 0x22, 0x22, 0x15, 0x02, 0x00, 0x20, 0x21,
+  0x04, 0xae, 0x03, 0xf0, 0x06, 0x48, 0x00, 0x20, 0x0a, 0x00, 0xf0, 0x41,
+  0x91, 0x00, 0x42, 0x80, 0x24, 0x84, 0x04, 0xc0, 0x22, 0x28, 0x80, 0x02,
+  0x12, 0x11, 0xdb, 0x00, 0x00, 0xe8, 0x0e, 0xf0, 0x04, 0x01, 0x00, 0x48,
+  0x18, 0x18, 0x42, 0x18, 0x80, 0x02, 0x2c, 0x01, 0x00, 0x40, 0x02, 0x22,
+  0x28, 0x20, 0x08, 0x42, 0xa1, 0x00, 0x41, 0x8a, 0xf2, 0x6a, 0xa1, 0xe5,
+  0x02, 0xa0, 0x4a, 0x01, 0x1a, 0x22, 0xa4, 0x12, 0x80, 0x01, 0x00, 0x10,
+  0xbf, 0x00, 0x31, 0x48, 0x18, 0x48, 0xb3, 0x0e, 0x10, 0x20, 0x28, 0x09,
+  0x00, 0x02, 0x03, 0x61, 0x08, 0x21, 0x00, 0x00, 0xd7, 0x16, 0xef, 0x07,
+  0xb1, 0x28, 0x48, 0x1c, 0x04, 0x42, 0x80, 0x02, 0x12, 0x18, 0x00, 0x18,
+  0xfa, 0x07, 0xa0, 0x12, 0x48, 0x80, 0x21, 0x84, 0x02, 0x22, 0x29, 0x04,
+  0x00, 0xc0, 0x0e, 0x40, 0x20, 0x04, 0x20, 0x24, 0x40, 0x04, 0xf0, 0x00,
+  0x80, 0xf4, 0xad, 0x73, 0x00, 0x80, 0x24, 0x01, 0x12, 0x20, 0x14, 0x21,
+  0x81, 0x02, 0x20, 0x08, 0x01, 0x91, 0x42, 0x20, 0x05, 0x20, 0x01, 0x00,
+  0x22, 0x00, 0x2c, 0x35, 0x08, 0x00, 0x58, 0x00, 0x40, 0x20, 0xa4, 0x84,
+  0x88, 0x5f, 0x0b, 0xd0, 0x2f, 0xc6, 0x0c, 0x20, 0x02, 0x28, 0x24, 0x80,
+  0x24, 0x03, 0x20, 0x24, 0x82, 0x12, 0x08, 0x01, 0xfd, 0x0e, 0x90, 0x12,
+  0x4a, 0x81, 0x04, 0x00, 0x20, 0x01, 0x20, 0x45, 0x6a, 0x0b, 0x40, 0x20,
+  0x02, 0x88, 0x20, 0x99, 0x04, 0x50, 0x14, 0xaf, 0x8e, 0x07, 0x12, 0x77,
+  0x0b, 0xb1, 0x18, 0x21, 0x42, 0x40, 0x82, 0x05, 0x29, 0x01, 0x21, 0x2c,
+  0x01, 0xe3, 0x00, 0x00, 0x55, 0x0f, 0xf0, 0x0b, 0x82, 0x04, 0x80, 0x85,
+  0x02, 0x48, 0x00, 0x18, 0x10, 0x02, 0x28, 0x26, 0x02, 0x48, 0x29, 0x2a,
+  0x12, 0x42, 0x02, 0x88, 0x00, 0x00, 0x88, 0x9f, 0x53, 0x0a, 0xec, 0x00,
+  0x30, 0x20, 0x21, 0x02, 0xc7, 0x0b, 0x32, 0x80, 0x02, 0x18, 0x5b, 0x0f,
+  0x00, 0xce, 0x08, 0x01, 0x09, 0x00, 0x01, 0xb0, 0x08, 0xd0, 0x00, 0x5f,
+  0x8e, 0x0e, 0x00, 0x00, 0x14, 0x40, 0x21, 0x05, 0x42, 0x20, 0x41, 0x21,
+  0x0a, 0xf0, 0x06, 0xa0, 0x14, 0xa0, 0x21, 0x80, 0x01, 0x42, 0x20, 0x01,
+  0x42, 0x23, 0x82, 0x11, 0xa2, 0x41, 0x18, 0x48, 0x80, 0x12, 0x02, 0x42,
+  0x6f, 0x0f, 0x50, 0x42, 0x2a, 0x04, 0x48, 0x42, 0x21, 0x0d, 0xa0, 0x24,
+  0x08, 0xbf, 0xa7, 0x0c, 0x11, 0x90, 0x41, 0x00, 0x80, 0x29, 0x01, 0xf1,
+  0x04, 0x80, 0x02, 0x00, 0x18, 0x80, 0x01, 0x18, 0x21, 0xc0, 0x12, 0x42,
+  0x2c, 0x28, 0x01, 0x18, 0x22, 0x40, 0x81, 0x04, 0x47, 0x01, 0x00, 0x36,
+  0x05, 0x00, 0xa8, 0x0a, 0xf1, 0xc1, 0x00, 0x21, 0x22, 0x6b, 0x29, 0x00,
   0x40, 0x01, 0x4a, 0x84, 0x81, 0xb5, 0x42, 0xe1, 0x25, 0x84, 0xa4, 0x15,
   0xe0, 0x14, 0x26, 0x04, 0x80, 0x91, 0x12, 0xa0, 0x21, 0x62, 0x18, 0x52,
   0x00, 0x1a, 0x82, 0x31, 0x42, 0x20, 0xa6, 0x54, 0x18, 0x42, 0x5a, 0x24,
@@ -949,163 +713,157 @@ const unsigned char USB_1608G_rbf[] = {
   0xa1, 0x11, 0x58, 0x23, 0xa1, 0x23, 0x4a, 0x04, 0x18, 0x2c, 0x21, 0xa1,
   0x12, 0x80, 0x91, 0x42, 0x23, 0x84, 0x21, 0x04, 0x28, 0x2a, 0x26, 0xa4,
   0x44, 0x4a, 0x08, 0x2b, 0x44, 0x8a, 0x08, 0xc6, 0x02, 0x00, 0x00, 0xb7,
-  0x28, 0x30, 0x41, 0x10, 0x01, 0x19, 0x14, 0x92, 0x41, 0x21, 0x19, 0x14,
-  0x92, 0x41, 0x21, 0x1b, 0x41, 0x21, 0x10, 0x22, 0x11, 0x02, 0x21, 0x12,
-  0x00, 0x40, 0x22, 0x44, 0x02, 0x24, 0x42, 0x2c, 0x01, 0x24, 0x42, 0x24,
-  0x42, 0x24, 0x40, 0x02, 0x21, 0x48, 0x21, 0x10, 0x02, 0x21, 0x48, 0x21,
-  0x8a, 0x14, 0x22, 0x18, 0x22, 0x18, 0x02, 0x00, 0x70, 0x34, 0x43, 0x11,
-  0xb1, 0x21, 0x42, 0xf1, 0x31, 0x31, 0x1f, 0x21, 0x95, 0x13, 0x5e, 0x11,
-  0x1f, 0x37, 0xd2, 0x22, 0x21, 0x56, 0x13, 0x1f, 0x37, 0xf1, 0x53, 0x42,
-  0x31, 0x16, 0xe1, 0x21, 0xf1, 0x12, 0x12, 0x2b, 0x22, 0x4a, 0xb4, 0x12,
-  0xb3, 0x12, 0xa5, 0x44, 0x48, 0x4e, 0x42, 0x2d, 0x42, 0x2c, 0x04, 0x2d,
-  0x12, 0x27, 0x21, 0x2e, 0x72, 0x58, 0x2f, 0x27, 0xb6, 0x22, 0xa7, 0x32,
-  0x3e, 0x22, 0x2f, 0x24, 0x51, 0x22, 0x24, 0xf0, 0x42, 0x42, 0x2b, 0x54,
-  0x12, 0x46, 0xf2, 0x22, 0x22, 0xb0, 0x42, 0xe6, 0x26, 0x76, 0x42, 0x32,
-  0x42, 0x4a, 0x44, 0xf2, 0x82, 0x82, 0x21, 0x4a, 0x54, 0x22, 0x21, 0x4a,
-  0xa4, 0x88, 0x24, 0x7f, 0xbd, 0x4a, 0xb1, 0x51, 0xb5, 0x21, 0x46, 0xf1,
-  0x31, 0x31, 0x1b, 0x55, 0x1f, 0x21, 0xf1, 0x42, 0x13, 0x3f, 0x32, 0x72,
-  0x43, 0xf3, 0x61, 0x21, 0x2f, 0x24, 0xf2, 0x73, 0x33, 0x3b, 0x34, 0x1f,
-  0x21, 0xd1, 0x32, 0x71, 0x12, 0x92, 0x12, 0x2e, 0x22, 0x2b, 0x44, 0x2b,
-  0x23, 0x2f, 0x26, 0xb5, 0x42, 0xa4, 0x44, 0x2f, 0x25, 0x55, 0x22, 0xce,
-  0x82, 0xf0, 0x12, 0x82, 0x27, 0x24, 0x66, 0xa2, 0x56, 0x3f, 0x37, 0xf6,
-  0x22, 0x72, 0x2f, 0x36, 0xb3, 0x22, 0xe6, 0x26, 0xd2, 0x22, 0x44, 0x02,
-  0x29, 0xe4, 0x24, 0xf5, 0x12, 0x42, 0x27, 0x24, 0x2f, 0x22, 0x02, 0x2f,
-  0x26, 0xf6, 0x62, 0x62, 0x2b, 0x62, 0x8e, 0x82, 0x2d, 0x82, 0x27, 0x24,
-  0x29, 0xe8, 0x28, 0xb8, 0x42, 0x5c, 0x22, 0x25, 0xb2, 0x42, 0xa4, 0x88,
-  0x27, 0x28, 0x6e, 0xf5, 0x14, 0x1e, 0x51, 0x2a, 0x16, 0xe1, 0x12, 0xc2,
-  0x41, 0x5a, 0xf1, 0x51, 0x12, 0x3f, 0x36, 0xd2, 0x13, 0x36, 0x62, 0x2e,
-  0x42, 0x2f, 0x37, 0xf1, 0x52, 0x71, 0x11, 0x16, 0xf3, 0x12, 0x12, 0x2b,
-  0x11, 0x2a, 0xe2, 0x24, 0xe4, 0x23, 0xa1, 0x57, 0x2b, 0x44, 0x4a, 0xa4,
-  0x54, 0x2b, 0x44, 0x2b, 0xc4, 0x2c, 0x01, 0x23, 0xb4, 0x42, 0xe4, 0x25,
-  0xe4, 0x35, 0xf4, 0x42, 0x52, 0x29, 0x21, 0xa4, 0x26, 0x2b, 0x73, 0x21,
-  0x24, 0x4a, 0xa4, 0x55, 0x24, 0x2f, 0x24, 0xb4, 0x22, 0x12, 0xe2, 0x26,
-  0xf6, 0x62, 0x62, 0x2b, 0x64, 0x4a, 0xe4, 0x2c, 0xfc, 0x42, 0x42, 0x2b,
-  0x88, 0xe0, 0x2c, 0x4c, 0x02, 0x2b, 0x44, 0x8a, 0xa8, 0xa2, 0xdf, 0xa1,
-  0x44, 0xe1, 0x14, 0xa4, 0x22, 0x11, 0x2e, 0x21, 0x4e, 0x43, 0x2b, 0x14,
-  0x1b, 0x54, 0x3a, 0xa6, 0x74, 0x2b, 0x26, 0x1f, 0x16, 0xe5, 0x17, 0x61,
-  0x34, 0x3b, 0x55, 0x1c, 0xa1, 0x11, 0x24, 0x2b, 0x22, 0x4e, 0x52, 0x36,
-  0xa2, 0x47, 0x2b, 0x44, 0x4e, 0x52, 0x4a, 0x15, 0xb2, 0x42, 0x68, 0x21,
-  0x82, 0x23, 0xb5, 0x62, 0xe3, 0x27, 0xe6, 0x15, 0xa4, 0x55, 0x1b, 0x14,
-  0x5e, 0x42, 0x2b, 0x14, 0x2b, 0x33, 0x21, 0x16, 0xe2, 0x24, 0xb4, 0x52,
-  0x85, 0xa4, 0x44, 0x2a, 0x12, 0xa2, 0x26, 0x6a, 0xc6, 0x62, 0x2b, 0x88,
-  0x88, 0xca, 0xc8, 0x82, 0x2b, 0x88, 0x4e, 0xc2, 0x24, 0xb0, 0x42, 0xe4,
-  0x28, 0xa8, 0x2a, 0xef, 0xeb, 0x03, 0x18, 0x00, 0x00, 0x80, 0x21, 0x21,
-  0x02, 0x22, 0x00, 0x12, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x80, 0x21, 0x04, 0x00, 0x80, 0x01, 0x18, 0x80, 0x81, 0x84, 0x01, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xce, 0xa1, 0xc0, 0x41,
-  0x40, 0x01, 0x34, 0x48, 0x46, 0x03, 0x46, 0x23, 0x41, 0x83, 0xe4, 0x34,
-  0x01, 0x34, 0xc0, 0x12, 0x40, 0x02, 0x38, 0x1a, 0x04, 0x48, 0x42, 0x21,
-  0x10, 0x02, 0x29, 0xa4, 0x21, 0x21, 0x90, 0x52, 0xb0, 0x22, 0x04, 0x21,
-  0x50, 0x22, 0x60, 0x24, 0x40, 0x02, 0x24, 0x28, 0x24, 0x8a, 0x64, 0x24,
-  0x82, 0x24, 0x82, 0x24, 0x00, 0x00, 0x14, 0x27, 0x7a, 0x80, 0xb4, 0x11,
-  0x02, 0x1b, 0x21, 0x42, 0x1b, 0x61, 0x23, 0x94, 0x61, 0x2b, 0x14, 0x19,
-  0xb6, 0x42, 0xb9, 0x11, 0xb6, 0x42, 0xb9, 0x11, 0xb4, 0x42, 0x29, 0xf3,
-  0x42, 0x91, 0x22, 0x2f, 0x14, 0x29, 0xd3, 0x12, 0xa9, 0x42, 0x1c, 0xe9,
-  0x22, 0xe4, 0x14, 0xe8, 0x22, 0xe4, 0x15, 0xe2, 0x22, 0x64, 0x1d, 0x2e,
-  0x42, 0x96, 0xc1, 0x52, 0xda, 0xc2, 0x42, 0x1b, 0x2d, 0x2c, 0xb4, 0x91,
-  0x42, 0xb2, 0x91, 0x22, 0xb4, 0x91, 0x32, 0x42, 0x1b, 0x68, 0x23, 0x94,
-  0x61, 0x2b, 0x84, 0x19, 0xb2, 0x42, 0xb8, 0x81, 0xb4, 0x42, 0xa8, 0x4a,
-  0x2b, 0x84, 0xaa, 0xb4, 0x42, 0x28, 0x92, 0x82, 0x2a, 0xa4, 0x84, 0xae,
-  0x42, 0xdf, 0xa8, 0x03, 0x2a, 0xb4, 0x11, 0xa4, 0x42, 0x11, 0x42, 0x1b,
-  0x61, 0x23, 0x92, 0x61, 0x2b, 0x14, 0x19, 0xb6, 0x42, 0x99, 0x61, 0x2b,
-  0xa4, 0x19, 0xb6, 0x42, 0x28, 0xf2, 0x42, 0x81, 0x22, 0x2d, 0xb1, 0x2a,
-  0xd4, 0x12, 0xb8, 0x22, 0xd4, 0x12, 0xe9, 0x22, 0xe5, 0x14, 0xc8, 0xd2,
-  0x5e, 0xa1, 0x26, 0x62, 0x1d, 0x2e, 0x42, 0x86, 0xc1, 0x43, 0xd6, 0x41,
-  0x32, 0xd1, 0x24, 0x1b, 0x69, 0x2c, 0xb4, 0x91, 0x22, 0xb4, 0x91, 0x12,
-  0xb2, 0x81, 0x16, 0x92, 0x41, 0x2b, 0x84, 0x19, 0xb2, 0x42, 0xba, 0x81,
-  0x94, 0xa2, 0xaa, 0x94, 0x82, 0xaa, 0x14, 0xa2, 0x42, 0x2b, 0x84, 0x23,
-  0x3a, 0x42, 0xae, 0x42, 0xbe, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x88, 0x00, 0x00, 0x40,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x21, 0xf0, 0x33, 0xe3, 0x80, 0x04, 0x00, 0x1c, 0x84, 0x02, 0x1a,
-  0x42, 0x01, 0x12, 0x21, 0x46, 0x21, 0x01, 0x12, 0x20, 0x81, 0x02, 0x20,
-  0x81, 0x03, 0x00, 0x00, 0x12, 0x21, 0x10, 0x22, 0xa1, 0x12, 0x00, 0x2c,
-  0x81, 0x02, 0x48, 0x18, 0x00, 0x62, 0x60, 0x2c, 0x86, 0x42, 0x02, 0x88,
-  0x00, 0x28, 0x42, 0x88, 0x00, 0x00, 0x6f, 0xc9, 0x02, 0x12, 0x80, 0xa3,
-  0x21, 0x00, 0x4a, 0x01, 0x52, 0x00, 0x22, 0x12, 0x80, 0x84, 0xa2, 0x49,
-  0x48, 0x42, 0x20, 0x21, 0x06, 0x42, 0x42, 0x48, 0x18, 0x28, 0xa0, 0x12,
-  0x32, 0x62, 0x00, 0x12, 0x42, 0x28, 0x00, 0x00, 0x20, 0x02, 0x00, 0x20,
-  0x08, 0x00, 0xc8, 0x42, 0x28, 0x21, 0x28, 0xa2, 0x8e, 0x21, 0x82, 0x5a,
-  0x08, 0x52, 0x42, 0x22, 0x18, 0x13, 0x04, 0x42, 0x22, 0x16, 0x01, 0x30,
-  0x22, 0x3a, 0x04, 0x48, 0x38, 0x1a, 0x2c, 0x84, 0x06, 0x16, 0x82, 0x81,
-  0x21, 0x85, 0x24, 0x0c, 0x22, 0x12, 0x29, 0x22, 0x92, 0x61, 0x18, 0x00,
-  0x42, 0x76, 0x02, 0x80, 0x04, 0x00, 0x28, 0x00, 0x25, 0xa2, 0x82, 0x21,
-  0x00, 0xc2, 0x80, 0x14, 0x42, 0x82, 0x28, 0x88, 0xf8, 0x56, 0xf1, 0x00,
-  0x80, 0x81, 0x02, 0x28, 0x18, 0x12, 0x42, 0x80, 0x01, 0x14, 0x12, 0x00,
-  0x20, 0x01, 0x00, 0x2a, 0x84, 0x02, 0x00, 0x12, 0x00, 0x18, 0x12, 0x21,
-  0xa0, 0x12, 0x12, 0x00, 0x22, 0x00, 0x12, 0x80, 0x22, 0x04, 0x4a, 0x28,
-  0x08, 0x80, 0x08, 0xa0, 0x42, 0x28, 0x82, 0x28, 0x22, 0x28, 0xe0, 0x86,
-  0x0c, 0x14, 0x40, 0x01, 0x00, 0x46, 0x02, 0x00, 0x00, 0x14, 0x48, 0x24,
-  0x48, 0x24, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0xa3, 0x24, 0x00, 0x00,
-  0x00, 0x00, 0x25, 0x01, 0x00, 0x24, 0x20, 0x04, 0x2c, 0x08, 0x00, 0x24,
-  0x82, 0x24, 0x40, 0x02, 0x00, 0x80, 0xf4, 0xa6, 0xb5, 0x00, 0x00, 0x40,
-  0x11, 0x12, 0x01, 0x10, 0x42, 0x31, 0x72, 0x10, 0x12, 0x01, 0x22, 0x48,
-  0x42, 0x29, 0x24, 0x04, 0x42, 0x80, 0x24, 0x04, 0x00, 0x23, 0xc4, 0x32,
-  0x24, 0x58, 0x40, 0x32, 0x41, 0x28, 0x40, 0x02, 0x21, 0x00, 0x70, 0x82,
-  0x01, 0x80, 0x28, 0x08, 0x48, 0x42, 0x80, 0x24, 0x0c, 0x88, 0x88, 0x88,
-  0x8f, 0x55, 0x06, 0x11, 0x10, 0x01, 0x11, 0x21, 0x11, 0x21, 0x10, 0x12,
-  0x31, 0x42, 0x11, 0x21, 0x11, 0x29, 0x04, 0x23, 0xc4, 0x42, 0x42, 0x42,
-  0x00, 0x14, 0x42, 0x42, 0x24, 0x80, 0x32, 0x42, 0x2c, 0x43, 0xa2, 0x41,
-  0x40, 0x62, 0x14, 0x24, 0x40, 0x02, 0x21, 0x10, 0x82, 0x94, 0x82, 0x00,
-  0x80, 0x08, 0x21, 0x10, 0x02, 0x21, 0x80, 0x08, 0x82, 0xff, 0x2f, 0x04,
-  0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x32, 0x20, 0x04, 0x80, 0x02, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x14, 0x48, 0x00, 0x00, 0x00, 0x20, 0x12, 0x01,
-  0x00, 0x00, 0x10, 0x81, 0x18, 0x82, 0x08, 0xa0, 0x84, 0x48, 0x20, 0xa4,
-  0x84, 0x00, 0x82, 0x48, 0x7f, 0x7a, 0x05, 0x20, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x62, 0x21, 0x2a, 0x04, 0x24, 0x00, 0x00, 0x20, 0x08, 0x42, 0x80,
-  0x04, 0x12, 0x48, 0x48, 0x48, 0x13, 0x24, 0x01, 0x80, 0x94, 0x42, 0x00,
-  0x21, 0x00, 0x46, 0x02, 0x22, 0x1c, 0x14, 0x81, 0x0c, 0x00, 0x00, 0x40,
-  0xa2, 0x28, 0x00, 0x42, 0xff, 0x54, 0x06, 0x20, 0x04, 0x20, 0x04, 0x20,
-  0x92, 0x43, 0x18, 0x00, 0x20, 0x02, 0x20, 0x04, 0x22, 0x10, 0x02, 0x48,
-  0x16, 0x02, 0x80, 0x22, 0x12, 0x81, 0x02, 0x11, 0x46, 0x22, 0x04, 0x80,
-  0x04, 0x80, 0x04, 0x28, 0x00, 0x00, 0x20, 0x82, 0x08, 0x42, 0x29, 0x04,
-  0x82, 0x40, 0x82, 0x04, 0xf0, 0x8f, 0x6f, 0x00, 0x00, 0x00, 0x18, 0x29,
+  0x28, 0x30, 0x41, 0x10, 0x01, 0x19, 0x14, 0x92, 0x41, 0x21, 0x05, 0x00,
+  0xf0, 0x0c, 0x1b, 0x41, 0x21, 0x10, 0x22, 0x11, 0x02, 0x21, 0x12, 0x00,
+  0x40, 0x22, 0x44, 0x02, 0x24, 0x42, 0x2c, 0x01, 0x24, 0x42, 0x24, 0x42,
+  0x24, 0x40, 0x02, 0x21, 0x48, 0x37, 0x08, 0xf0, 0x86, 0x48, 0x21, 0x8a,
+  0x14, 0x22, 0x18, 0x22, 0x18, 0x02, 0x00, 0x70, 0x34, 0x43, 0x11, 0xb1,
+  0x21, 0x42, 0xf1, 0x31, 0x31, 0x1f, 0x21, 0x95, 0x13, 0x5e, 0x11, 0x1f,
+  0x37, 0xd2, 0x22, 0x21, 0x56, 0x13, 0x1f, 0x37, 0xf1, 0x53, 0x42, 0x31,
+  0x16, 0xe1, 0x21, 0xf1, 0x12, 0x12, 0x2b, 0x22, 0x4a, 0xb4, 0x12, 0xb3,
+  0x12, 0xa5, 0x44, 0x48, 0x4e, 0x42, 0x2d, 0x42, 0x2c, 0x04, 0x2d, 0x12,
+  0x27, 0x21, 0x2e, 0x72, 0x58, 0x2f, 0x27, 0xb6, 0x22, 0xa7, 0x32, 0x3e,
+  0x22, 0x2f, 0x24, 0x51, 0x22, 0x24, 0xf0, 0x42, 0x42, 0x2b, 0x54, 0x12,
+  0x46, 0xf2, 0x22, 0x22, 0xb0, 0x42, 0xe6, 0x26, 0x76, 0x42, 0x32, 0x42,
+  0x4a, 0x44, 0xf2, 0x82, 0x82, 0x21, 0x4a, 0x54, 0x22, 0x21, 0x4a, 0xa4,
+  0x88, 0x24, 0x7f, 0xbd, 0x4a, 0xb1, 0x51, 0xb5, 0x21, 0x46, 0xf1, 0x31,
+  0x31, 0x1b, 0x55, 0x1f, 0x21, 0xf1, 0x42, 0x13, 0x3f, 0x32, 0x72, 0x43,
+  0xf3, 0x61, 0x21, 0x2f, 0x24, 0xf2, 0x73, 0x33, 0x3b, 0x34, 0x1f, 0x21,
+  0xd1, 0x32, 0x83, 0x08, 0xf0, 0x76, 0x2e, 0x22, 0x2b, 0x44, 0x2b, 0x23,
+  0x2f, 0x26, 0xb5, 0x42, 0xa4, 0x44, 0x2f, 0x25, 0x55, 0x22, 0xce, 0x82,
+  0xf0, 0x12, 0x82, 0x27, 0x24, 0x66, 0xa2, 0x56, 0x3f, 0x37, 0xf6, 0x22,
+  0x72, 0x2f, 0x36, 0xb3, 0x22, 0xe6, 0x26, 0xd2, 0x22, 0x44, 0x02, 0x29,
+  0xe4, 0x24, 0xf5, 0x12, 0x42, 0x27, 0x24, 0x2f, 0x22, 0x02, 0x2f, 0x26,
+  0xf6, 0x62, 0x62, 0x2b, 0x62, 0x8e, 0x82, 0x2d, 0x82, 0x27, 0x24, 0x29,
+  0xe8, 0x28, 0xb8, 0x42, 0x5c, 0x22, 0x25, 0xb2, 0x42, 0xa4, 0x88, 0x27,
+  0x28, 0x6e, 0xf5, 0x14, 0x1e, 0x51, 0x2a, 0x16, 0xe1, 0x12, 0xc2, 0x41,
+  0x5a, 0xf1, 0x51, 0x12, 0x3f, 0x36, 0xd2, 0x13, 0x36, 0x62, 0x2e, 0x42,
+  0x2f, 0x37, 0xf1, 0x52, 0x71, 0x11, 0x16, 0xf3, 0x12, 0x12, 0x2b, 0x11,
+  0x2a, 0xe2, 0x24, 0xe4, 0x23, 0xa1, 0x57, 0x2b, 0x44, 0x4a, 0xa4, 0x54,
+  0x2b, 0x44, 0x2b, 0xc4, 0x2c, 0x01, 0x23, 0xbb, 0x0f, 0xf1, 0x08, 0xe4,
+  0x35, 0xf4, 0x42, 0x52, 0x29, 0x21, 0xa4, 0x26, 0x2b, 0x73, 0x21, 0x24,
+  0x4a, 0xa4, 0x55, 0x24, 0x2f, 0x24, 0xb4, 0x22, 0x12, 0xe2, 0x6b, 0x00,
+  0xf0, 0x0a, 0x64, 0x4a, 0xe4, 0x2c, 0xfc, 0x42, 0x42, 0x2b, 0x88, 0xe0,
+  0x2c, 0x4c, 0x02, 0x2b, 0x44, 0x8a, 0xa8, 0xa2, 0xdf, 0xa1, 0x44, 0xe1,
+  0x14, 0xa4, 0x22, 0x01, 0x09, 0xf0, 0x58, 0x43, 0x2b, 0x14, 0x1b, 0x54,
+  0x3a, 0xa6, 0x74, 0x2b, 0x26, 0x1f, 0x16, 0xe5, 0x17, 0x61, 0x34, 0x3b,
+  0x55, 0x1c, 0xa1, 0x11, 0x24, 0x2b, 0x22, 0x4e, 0x52, 0x36, 0xa2, 0x47,
+  0x2b, 0x44, 0x4e, 0x52, 0x4a, 0x15, 0xb2, 0x42, 0x68, 0x21, 0x82, 0x23,
+  0xb5, 0x62, 0xe3, 0x27, 0xe6, 0x15, 0xa4, 0x55, 0x1b, 0x14, 0x5e, 0x42,
+  0x2b, 0x14, 0x2b, 0x33, 0x21, 0x16, 0xe2, 0x24, 0xb4, 0x52, 0x85, 0xa4,
+  0x44, 0x2a, 0x12, 0xa2, 0x26, 0x6a, 0xc6, 0x62, 0x2b, 0x88, 0x88, 0xca,
+  0xc8, 0x82, 0x2b, 0x88, 0x4e, 0xc2, 0x24, 0xb0, 0x42, 0xe4, 0x28, 0xa8,
+  0x2a, 0xef, 0xeb, 0x03, 0x18, 0x00, 0x00, 0x80, 0x21, 0x21, 0x02, 0x22,
+  0x00, 0x12, 0x3a, 0x04, 0x00, 0x2c, 0x03, 0x40, 0x80, 0x21, 0x04, 0x00,
+  0x4b, 0x06, 0x32, 0x81, 0x84, 0x01, 0x95, 0x0c, 0xf1, 0x39, 0x00, 0x00,
+  0xf0, 0xce, 0xa1, 0xc0, 0x41, 0x40, 0x01, 0x34, 0x48, 0x46, 0x03, 0x46,
+  0x23, 0x41, 0x83, 0xe4, 0x34, 0x01, 0x34, 0xc0, 0x12, 0x40, 0x02, 0x38,
+  0x1a, 0x04, 0x48, 0x42, 0x21, 0x10, 0x02, 0x29, 0xa4, 0x21, 0x21, 0x90,
+  0x52, 0xb0, 0x22, 0x04, 0x21, 0x50, 0x22, 0x60, 0x24, 0x40, 0x02, 0x24,
+  0x28, 0x24, 0x8a, 0x64, 0x24, 0x82, 0x24, 0x82, 0x24, 0x00, 0x00, 0x14,
+  0x27, 0x7a, 0x80, 0xb4, 0x11, 0x02, 0x1b, 0x21, 0x42, 0x1b, 0x88, 0x0f,
+  0x60, 0x14, 0x19, 0xb6, 0x42, 0xb9, 0x11, 0x04, 0x00, 0x60, 0xb4, 0x42,
+  0x29, 0xf3, 0x42, 0x91, 0xcf, 0x0f, 0xf0, 0x19, 0xd3, 0x12, 0xa9, 0x42,
+  0x1c, 0xe9, 0x22, 0xe4, 0x14, 0xe8, 0x22, 0xe4, 0x15, 0xe2, 0x22, 0x64,
+  0x1d, 0x2e, 0x42, 0x96, 0xc1, 0x52, 0xda, 0xc2, 0x42, 0x1b, 0x2d, 0x2c,
+  0xb4, 0x91, 0x42, 0xb2, 0x91, 0x22, 0xb4, 0x91, 0x32, 0x42, 0x1b, 0x68,
+  0x40, 0x00, 0xf0, 0x11, 0x84, 0x19, 0xb2, 0x42, 0xb8, 0x81, 0xb4, 0x42,
+  0xa8, 0x4a, 0x2b, 0x84, 0xaa, 0xb4, 0x42, 0x28, 0x92, 0x82, 0x2a, 0xa4,
+  0x84, 0xae, 0x42, 0xdf, 0xa8, 0x03, 0x2a, 0xb4, 0x11, 0xa4, 0x42, 0x11,
+  0x67, 0x00, 0x12, 0x92, 0x67, 0x00, 0x13, 0x99, 0xf6, 0x0f, 0xf0, 0x17,
+  0xf2, 0x42, 0x81, 0x22, 0x2d, 0xb1, 0x2a, 0xd4, 0x12, 0xb8, 0x22, 0xd4,
+  0x12, 0xe9, 0x22, 0xe5, 0x14, 0xc8, 0xd2, 0x5e, 0xa1, 0x26, 0x62, 0x1d,
+  0x2e, 0x42, 0x86, 0xc1, 0x43, 0xd6, 0x41, 0x32, 0xd1, 0x24, 0x1b, 0x69,
+  0x2c, 0xb4, 0x65, 0x00, 0x61, 0x12, 0xb2, 0x81, 0x16, 0x92, 0x41, 0x64,
+  0x00, 0xf4, 0x05, 0xba, 0x81, 0x94, 0xa2, 0xaa, 0x94, 0x82, 0xaa, 0x14,
+  0xa2, 0x42, 0x2b, 0x84, 0x23, 0x3a, 0x42, 0xae, 0x42, 0xbe, 0x15, 0x36,
+  0x08, 0x00, 0x70, 0x06, 0x41, 0x02, 0x00, 0x88, 0x00, 0x69, 0x07, 0x01,
+  0x01, 0x00, 0x01, 0x58, 0x04, 0xf0, 0x1d, 0x21, 0xf0, 0x33, 0xe3, 0x80,
+  0x04, 0x00, 0x1c, 0x84, 0x02, 0x1a, 0x42, 0x01, 0x12, 0x21, 0x46, 0x21,
+  0x01, 0x12, 0x20, 0x81, 0x02, 0x20, 0x81, 0x03, 0x00, 0x00, 0x12, 0x21,
+  0x10, 0x22, 0xa1, 0x12, 0x00, 0x2c, 0x81, 0x02, 0x48, 0x18, 0x00, 0x62,
+  0x60, 0x2c, 0x86, 0xaf, 0x04, 0xf0, 0x18, 0x28, 0x42, 0x88, 0x00, 0x00,
+  0x6f, 0xc9, 0x02, 0x12, 0x80, 0xa3, 0x21, 0x00, 0x4a, 0x01, 0x52, 0x00,
+  0x22, 0x12, 0x80, 0x84, 0xa2, 0x49, 0x48, 0x42, 0x20, 0x21, 0x06, 0x42,
+  0x42, 0x48, 0x18, 0x28, 0xa0, 0x12, 0x32, 0x62, 0x00, 0x12, 0x65, 0x0d,
+  0x00, 0xff, 0x0e, 0xf0, 0x23, 0x08, 0x00, 0xc8, 0x42, 0x28, 0x21, 0x28,
+  0xa2, 0x8e, 0x21, 0x82, 0x5a, 0x08, 0x52, 0x42, 0x22, 0x18, 0x13, 0x04,
+  0x42, 0x22, 0x16, 0x01, 0x30, 0x22, 0x3a, 0x04, 0x48, 0x38, 0x1a, 0x2c,
+  0x84, 0x06, 0x16, 0x82, 0x81, 0x21, 0x85, 0x24, 0x0c, 0x22, 0x12, 0x29,
+  0x22, 0x92, 0x61, 0x18, 0x00, 0x42, 0x76, 0x4e, 0x05, 0xf1, 0x0d, 0x28,
+  0x00, 0x25, 0xa2, 0x82, 0x21, 0x00, 0xc2, 0x80, 0x14, 0x42, 0x82, 0x28,
+  0x88, 0xf8, 0x56, 0xf1, 0x00, 0x80, 0x81, 0x02, 0x28, 0x18, 0x12, 0x42,
+  0x80, 0x01, 0x14, 0xf3, 0x01, 0xf0, 0x20, 0x2a, 0x84, 0x02, 0x00, 0x12,
+  0x00, 0x18, 0x12, 0x21, 0xa0, 0x12, 0x12, 0x00, 0x22, 0x00, 0x12, 0x80,
+  0x22, 0x04, 0x4a, 0x28, 0x08, 0x80, 0x08, 0xa0, 0x42, 0x28, 0x82, 0x28,
+  0x22, 0x28, 0xe0, 0x86, 0x0c, 0x14, 0x40, 0x01, 0x00, 0x46, 0x02, 0x00,
+  0x00, 0x14, 0x48, 0x24, 0x48, 0x24, 0x90, 0x06, 0x30, 0x00, 0x10, 0xa3,
+  0x08, 0x00, 0xc0, 0x00, 0x25, 0x01, 0x00, 0x24, 0x20, 0x04, 0x2c, 0x08,
+  0x00, 0x24, 0x82, 0x9c, 0x0d, 0xf0, 0x4f, 0x80, 0xf4, 0xa6, 0xb5, 0x00,
+  0x00, 0x40, 0x11, 0x12, 0x01, 0x10, 0x42, 0x31, 0x72, 0x10, 0x12, 0x01,
+  0x22, 0x48, 0x42, 0x29, 0x24, 0x04, 0x42, 0x80, 0x24, 0x04, 0x00, 0x23,
+  0xc4, 0x32, 0x24, 0x58, 0x40, 0x32, 0x41, 0x28, 0x40, 0x02, 0x21, 0x00,
+  0x70, 0x82, 0x01, 0x80, 0x28, 0x08, 0x48, 0x42, 0x80, 0x24, 0x0c, 0x88,
+  0x88, 0x88, 0x8f, 0x55, 0x06, 0x11, 0x10, 0x01, 0x11, 0x21, 0x11, 0x21,
+  0x10, 0x12, 0x31, 0x42, 0x11, 0x21, 0x11, 0x29, 0x04, 0x23, 0xc4, 0x42,
+  0x42, 0x42, 0x00, 0x14, 0x42, 0x42, 0x24, 0x80, 0x32, 0x42, 0x2c, 0x43,
+  0xa2, 0x41, 0x40, 0x62, 0x14, 0x6a, 0x04, 0x40, 0x10, 0x82, 0x94, 0x82,
+  0xa2, 0x06, 0x83, 0x10, 0x02, 0x21, 0x80, 0x08, 0x82, 0xff, 0x2f, 0x5f,
+  0x06, 0x20, 0x32, 0x20, 0xb4, 0x0a, 0x00, 0xe4, 0x0a, 0x10, 0x14, 0xe8,
+  0x0a, 0x20, 0x20, 0x12, 0x3a, 0x07, 0xf1, 0x02, 0x81, 0x18, 0x82, 0x08,
+  0xa0, 0x84, 0x48, 0x20, 0xa4, 0x84, 0x00, 0x82, 0x48, 0x7f, 0x7a, 0x05,
+  0x20, 0xcb, 0x02, 0x50, 0x62, 0x21, 0x2a, 0x04, 0x24, 0x02, 0x0f, 0xf0,
+  0x1b, 0x42, 0x80, 0x04, 0x12, 0x48, 0x48, 0x48, 0x13, 0x24, 0x01, 0x80,
+  0x94, 0x42, 0x00, 0x21, 0x00, 0x46, 0x02, 0x22, 0x1c, 0x14, 0x81, 0x0c,
+  0x00, 0x00, 0x40, 0xa2, 0x28, 0x00, 0x42, 0xff, 0x54, 0x06, 0x20, 0x04,
+  0x20, 0x04, 0x20, 0x92, 0x43, 0x18, 0x00, 0x19, 0x08, 0xf1, 0x03, 0x22,
+  0x10, 0x02, 0x48, 0x16, 0x02, 0x80, 0x22, 0x12, 0x81, 0x02, 0x11, 0x46,
+  0x22, 0x04, 0x80, 0x04, 0x80, 0x6c, 0x08, 0xc0, 0x82, 0x08, 0x42, 0x29,
+  0x04, 0x82, 0x40, 0x82, 0x04, 0xf0, 0x8f, 0x6f, 0x3b, 0x03, 0xe0, 0x29,
   0x04, 0x00, 0x40, 0x21, 0x01, 0x00, 0x40, 0x01, 0x22, 0x00, 0x90, 0x21,
-  0x28, 0x00, 0x10, 0x02, 0x00, 0x80, 0x22, 0x41, 0x01, 0x00, 0x00, 0x82,
-  0x90, 0x21, 0x00, 0x24, 0x00, 0x00, 0x00, 0x48, 0x80, 0x04, 0x40, 0xf2,
-  0xfd, 0x96, 0x00, 0x00, 0x20, 0xc4, 0x12, 0x42, 0x22, 0x00, 0x40, 0x21,
-  0x01, 0x00, 0x23, 0x04, 0x22, 0x22, 0x21, 0x88, 0x70, 0x21, 0x82, 0x22,
-  0x24, 0xc2, 0x32, 0x20, 0x22, 0x84, 0x84, 0x81, 0x02, 0x00, 0x40, 0x02,
-  0x80, 0x08, 0x33, 0x82, 0x62, 0x14, 0x10, 0x02, 0x00, 0x23, 0x04, 0x8a,
-  0x04, 0x22, 0x00, 0xf0, 0x17, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42,
-  0x21, 0x01, 0x68, 0x21, 0x48, 0x00, 0x10, 0x01, 0x00, 0x20, 0x84, 0x04,
-  0x00, 0x60, 0x14, 0x48, 0x00, 0x42, 0x29, 0x24, 0xc1, 0x43, 0x00, 0x20,
-  0x04, 0x22, 0x48, 0x00, 0x10, 0xa1, 0x84, 0x82, 0x80, 0x04, 0x00, 0xb0,
-  0x42, 0x88, 0x04, 0x2c, 0xf4, 0x6c, 0x54, 0x00, 0x48, 0x00, 0x48, 0x48,
-  0x2c, 0x02, 0x24, 0x20, 0x94, 0x42, 0x00, 0x19, 0x82, 0x24, 0x82, 0x04,
-  0x00, 0x22, 0x80, 0x01, 0x00, 0x80, 0x04, 0x00, 0x20, 0x04, 0x21, 0x00,
-  0x24, 0x00, 0x42, 0x40, 0x82, 0x48, 0x02, 0x30, 0x82, 0x30, 0x42, 0x48,
-  0x48, 0x86, 0x02, 0x20, 0x88, 0x28, 0xf8, 0xa5, 0x4a, 0xa0, 0x24, 0x80,
-  0x02, 0x10, 0x02, 0x12, 0x68, 0x00, 0x13, 0x01, 0x42, 0x30, 0x12, 0x00,
-  0x30, 0x22, 0x22, 0xa0, 0x42, 0x00, 0x80, 0x04, 0x80, 0xa4, 0x42, 0x22,
-  0x00, 0x20, 0x02, 0x80, 0x24, 0x02, 0x10, 0x02, 0x00, 0x20, 0x88, 0x24,
-  0x84, 0x08, 0x29, 0x08, 0x00, 0x00, 0x60, 0xc5, 0x00, 0x28, 0x11, 0x00,
-  0x90, 0x41, 0x28, 0x00, 0x80, 0x82, 0x44, 0x01, 0x22, 0xa0, 0x42, 0x00,
-  0x20, 0x04, 0x40, 0x03, 0x24, 0x00, 0x10, 0x01, 0x00, 0x10, 0x02, 0x00,
-  0x48, 0x00, 0x00, 0x20, 0x88, 0x88, 0x04, 0x88, 0x00, 0x00, 0x20, 0x98,
-  0x82, 0x10, 0xd2, 0x1c, 0x0d, 0x19, 0x02, 0x38, 0x28, 0x00, 0x00, 0x19,
-  0x92, 0x22, 0x28, 0x80, 0x82, 0x22, 0x04, 0x42, 0x20, 0x04, 0x22, 0x20,
-  0x82, 0x04, 0x40, 0x81, 0x45, 0x22, 0x22, 0x82, 0x44, 0x82, 0x01, 0x80,
-  0x84, 0x05, 0x00, 0x00, 0x10, 0x01, 0x00, 0x42, 0x80, 0x88, 0x0a, 0x00,
-  0x00, 0x28, 0xd0, 0x6c, 0x06, 0x00, 0x80, 0x52, 0x21, 0x42, 0x80, 0x02,
-  0x42, 0x14, 0x00, 0x48, 0xa0, 0x42, 0x00, 0x15, 0x22, 0x02, 0x28, 0x48,
-  0x00, 0x80, 0x04, 0x20, 0xc4, 0x42, 0x11, 0x00, 0x00, 0x24, 0x40, 0x42,
-  0x02, 0x40, 0x81, 0x14, 0x02, 0x00, 0x21, 0x48, 0x00, 0x88, 0x24, 0x00,
-  0x00, 0x86, 0xf1, 0xc8, 0x2f, 0x00, 0x00, 0x42, 0x00, 0x2a, 0x11, 0x02,
-  0x40, 0x02, 0x10, 0x42, 0x11, 0x42, 0x02, 0x00, 0x11, 0x00, 0x48, 0x20,
-  0x04, 0x48, 0x00, 0x80, 0x44, 0x11, 0x01, 0x48, 0x00, 0x00, 0x80, 0x11,
-  0x02, 0x82, 0xc6, 0x02, 0x42, 0x14, 0x10, 0x62, 0x2c, 0x00, 0x00, 0x00,
-  0xf0, 0xd7, 0xdf, 0x00, 0x00, 0x20, 0x01, 0x00, 0x80, 0x01, 0x48, 0x11,
-  0x18, 0x00, 0x19, 0x22, 0x01, 0x12, 0x20, 0x11, 0x01, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x28, 0x00, 0x80, 0x02, 0x12, 0x20, 0x02, 0x22, 0x00, 0x22,
-  0x80, 0x08, 0x48, 0x80, 0x04, 0x00, 0x10, 0x02, 0x87, 0x97, 0x20, 0xa4,
-  0x28, 0x00, 0x48, 0x40, 0x01, 0x19, 0xa4, 0x42, 0x14, 0x40, 0x11, 0x82,
-  0x04, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x20, 0x01, 0x40, 0x82, 0x02, 0x21,
-  0x24, 0x00, 0x10, 0x11, 0x12, 0x01, 0x31, 0x00, 0x00, 0x80, 0xa8, 0x82,
-  0x20, 0x0a, 0x00, 0x82, 0x00, 0x20, 0x08, 0xef, 0x21, 0x02, 0x19, 0x01,
-  0x19, 0x04, 0x13, 0x08, 0x00, 0x00, 0x62, 0x28, 0x48, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x21, 0xc0, 0x12, 0xc0, 0x82, 0x40, 0x81, 0x01, 0x18, 0x14,
-  0x11, 0x14, 0x18, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x25, 0x02, 0xa0, 0x80, 0x22, 0x41, 0x01, 0x00, 0x00, 0x82, 0x90,
+  0x21, 0x00, 0x32, 0x01, 0xe1, 0x48, 0x80, 0x04, 0x40, 0xf2, 0xfd, 0x96,
+  0x00, 0x00, 0x20, 0xc4, 0x12, 0x42, 0x22, 0x2c, 0x00, 0xf0, 0x19, 0x23,
+  0x04, 0x22, 0x22, 0x21, 0x88, 0x70, 0x21, 0x82, 0x22, 0x24, 0xc2, 0x32,
+  0x20, 0x22, 0x84, 0x84, 0x81, 0x02, 0x00, 0x40, 0x02, 0x80, 0x08, 0x33,
+  0x82, 0x62, 0x14, 0x10, 0x02, 0x00, 0x23, 0x04, 0x8a, 0x04, 0x22, 0x00,
+  0xf0, 0x17, 0xdf, 0xbd, 0x00, 0x70, 0x70, 0x42, 0x21, 0x01, 0x68, 0x21,
+  0x48, 0x16, 0x08, 0x00, 0x74, 0x0f, 0xf0, 0x1d, 0x60, 0x14, 0x48, 0x00,
+  0x42, 0x29, 0x24, 0xc1, 0x43, 0x00, 0x20, 0x04, 0x22, 0x48, 0x00, 0x10,
+  0xa1, 0x84, 0x82, 0x80, 0x04, 0x00, 0xb0, 0x42, 0x88, 0x04, 0x2c, 0xf4,
+  0x6c, 0x54, 0x00, 0x48, 0x00, 0x48, 0x48, 0x2c, 0x02, 0x24, 0x20, 0x94,
+  0x42, 0x00, 0x19, 0x82, 0x6d, 0x07, 0x21, 0x22, 0x80, 0xd1, 0x03, 0x20,
+  0x20, 0x04, 0x8d, 0x00, 0xf0, 0x3f, 0x42, 0x40, 0x82, 0x48, 0x02, 0x30,
+  0x82, 0x30, 0x42, 0x48, 0x48, 0x86, 0x02, 0x20, 0x88, 0x28, 0xf8, 0xa5,
+  0x4a, 0xa0, 0x24, 0x80, 0x02, 0x10, 0x02, 0x12, 0x68, 0x00, 0x13, 0x01,
+  0x42, 0x30, 0x12, 0x00, 0x30, 0x22, 0x22, 0xa0, 0x42, 0x00, 0x80, 0x04,
+  0x80, 0xa4, 0x42, 0x22, 0x00, 0x20, 0x02, 0x80, 0x24, 0x02, 0x10, 0x02,
+  0x00, 0x20, 0x88, 0x24, 0x84, 0x08, 0x29, 0x08, 0x00, 0x00, 0x60, 0xc5,
+  0x00, 0x28, 0x11, 0x00, 0x90, 0x41, 0x28, 0x00, 0x80, 0x82, 0x44, 0x01,
+  0x2a, 0x00, 0x50, 0x20, 0x04, 0x40, 0x03, 0x24, 0x9c, 0x00, 0x20, 0x10,
+  0x02, 0x8b, 0x01, 0xf1, 0x20, 0x20, 0x88, 0x88, 0x04, 0x88, 0x00, 0x00,
+  0x20, 0x98, 0x82, 0x10, 0xd2, 0x1c, 0x0d, 0x19, 0x02, 0x38, 0x28, 0x00,
+  0x00, 0x19, 0x92, 0x22, 0x28, 0x80, 0x82, 0x22, 0x04, 0x42, 0x20, 0x04,
+  0x22, 0x20, 0x82, 0x04, 0x40, 0x81, 0x45, 0x22, 0x22, 0x82, 0x44, 0x82,
+  0x01, 0x80, 0x84, 0x05, 0xec, 0x08, 0xf0, 0x2b, 0x42, 0x80, 0x88, 0x0a,
+  0x00, 0x00, 0x28, 0xd0, 0x6c, 0x06, 0x00, 0x80, 0x52, 0x21, 0x42, 0x80,
+  0x02, 0x42, 0x14, 0x00, 0x48, 0xa0, 0x42, 0x00, 0x15, 0x22, 0x02, 0x28,
+  0x48, 0x00, 0x80, 0x04, 0x20, 0xc4, 0x42, 0x11, 0x00, 0x00, 0x24, 0x40,
+  0x42, 0x02, 0x40, 0x81, 0x14, 0x02, 0x00, 0x21, 0x48, 0x00, 0x88, 0x24,
+  0x00, 0x00, 0x86, 0xf1, 0xc8, 0x2f, 0x08, 0x02, 0xf0, 0x06, 0x2a, 0x11,
+  0x02, 0x40, 0x02, 0x10, 0x42, 0x11, 0x42, 0x02, 0x00, 0x11, 0x00, 0x48,
+  0x20, 0x04, 0x48, 0x00, 0x80, 0x44, 0x11, 0xe3, 0x0f, 0xb0, 0x80, 0x11,
+  0x02, 0x82, 0xc6, 0x02, 0x42, 0x14, 0x10, 0x62, 0x2c, 0xcd, 0x04, 0x20,
+  0xd7, 0xdf, 0xb5, 0x09, 0x30, 0x00, 0x80, 0x01, 0x1d, 0x0a, 0x71, 0x19,
+  0x22, 0x01, 0x12, 0x20, 0x11, 0x01, 0x3e, 0x02, 0xc0, 0x28, 0x00, 0x80,
+  0x02, 0x12, 0x20, 0x02, 0x22, 0x00, 0x22, 0x80, 0x08, 0x35, 0x0d, 0xf1,
+  0x04, 0x10, 0x02, 0x87, 0x97, 0x20, 0xa4, 0x28, 0x00, 0x48, 0x40, 0x01,
+  0x19, 0xa4, 0x42, 0x14, 0x40, 0x11, 0x82, 0x04, 0xd2, 0x08, 0xf2, 0x18,
+  0x20, 0x01, 0x40, 0x82, 0x02, 0x21, 0x24, 0x00, 0x10, 0x11, 0x12, 0x01,
+  0x31, 0x00, 0x00, 0x80, 0xa8, 0x82, 0x20, 0x0a, 0x00, 0x82, 0x00, 0x20,
+  0x08, 0xef, 0x21, 0x02, 0x19, 0x01, 0x19, 0x04, 0x13, 0x08, 0x00, 0x00,
+  0x62, 0x28, 0x48, 0x15, 0x04, 0xc3, 0xc0, 0x12, 0xc0, 0x82, 0x40, 0x81,
+  0x01, 0x18, 0x14, 0x11, 0x14, 0x18, 0x4f, 0x05, 0xf1, 0xda, 0x00, 0x00,
   0x4a, 0x02, 0x28, 0x10, 0x02, 0x1f, 0x72, 0x0d, 0x1b, 0x74, 0xaa, 0xe6,
   0x11, 0x02, 0x17, 0x2d, 0x00, 0x2b, 0x21, 0x2c, 0x82, 0x06, 0x50, 0x11,
   0x20, 0x24, 0x66, 0x14, 0x29, 0x41, 0x01, 0x22, 0x22, 0x2a, 0xa4, 0x54,
@@ -1125,498 +883,492 @@ const unsigned char USB_1608G_rbf[] = {
   0x44, 0x12, 0x02, 0x28, 0x19, 0x34, 0x22, 0x21, 0x1a, 0x04, 0x00, 0x24,
   0x8a, 0xa2, 0x48, 0x2b, 0x88, 0x4a, 0x12, 0xa2, 0xc2, 0xa0, 0x2c, 0x00,
   0x8a, 0x28, 0x28, 0xf8, 0x34, 0x5b, 0x30, 0x11, 0x22, 0x13, 0x21, 0xb2,
-  0x91, 0x14, 0x32, 0x11, 0x29, 0x11, 0x91, 0x12, 0x11, 0x2b, 0x12, 0x19,
-  0x94, 0x12, 0x48, 0x29, 0x81, 0x94, 0x12, 0x90, 0x32, 0x80, 0x03, 0x40,
-  0x02, 0x24, 0x12, 0x24, 0x12, 0x24, 0x1a, 0x42, 0xa2, 0x21, 0x24, 0x1a,
-  0x42, 0xa2, 0x21, 0x24, 0x1a, 0x12, 0x82, 0x12, 0x82, 0x12, 0xa2, 0x28,
-  0x21, 0x48, 0x21, 0x10, 0xa2, 0x4a, 0x21, 0x22, 0x21, 0x22, 0x20, 0x0a,
-  0x2e, 0x42, 0xd0, 0x11, 0xf3, 0x11, 0x31, 0x15, 0xb1, 0x11, 0xf3, 0x11,
-  0x53, 0x3f, 0x31, 0xd1, 0x33, 0xf2, 0x23, 0x32, 0x1f, 0x37, 0xf3, 0x33,
-  0x33, 0x1f, 0x35, 0xf1, 0x23, 0x32, 0x1f, 0x31, 0xf1, 0x13, 0x13, 0x3f,
-  0x31, 0xf5, 0x22, 0x32, 0x1f, 0x33, 0xf1, 0x53, 0x13, 0x2b, 0x11, 0x22,
-  0x1f, 0x11, 0xa1, 0x13, 0x1f, 0x17, 0xe5, 0x24, 0x54, 0x22, 0x3f, 0x14,
-  0xf4, 0x53, 0x13, 0x3f, 0x15, 0xf5, 0x12, 0x52, 0x3f, 0x17, 0xf6, 0x63,
-  0x73, 0x2b, 0x74, 0x2f, 0x23, 0xf3, 0x22, 0x22, 0x3f, 0x32, 0xf3, 0x42,
-  0x72, 0x2f, 0x23, 0xf3, 0x23, 0x21, 0x2f, 0x23, 0xf3, 0x13, 0x33, 0x3f,
-  0x32, 0xf2, 0x32, 0x32, 0x3f, 0x32, 0xe2, 0x24, 0xf4, 0x23, 0x23, 0x1f,
-  0x3e, 0x96, 0x82, 0x2f, 0x2c, 0x5c, 0x22, 0x3f, 0x3c, 0xb4, 0x62, 0xf2,
-  0x22, 0x62, 0x2f, 0x2a, 0xfa, 0xe2, 0xc2, 0x29, 0x92, 0x22, 0x2a, 0x22,
-  0xc8, 0xa2, 0x1f, 0xcf, 0x42, 0xf1, 0x41, 0x11, 0x3e, 0x51, 0x1f, 0x13,
-  0x71, 0x21, 0xd1, 0x31, 0xfc, 0x52, 0x11, 0x3f, 0x33, 0xf3, 0x23, 0x33,
-  0x3f, 0x37, 0xf3, 0x22, 0x23, 0x3d, 0x43, 0x3d, 0x73, 0x3f, 0x35, 0xd7,
-  0x12, 0xd4, 0x33, 0xf4, 0x62, 0x32, 0x3f, 0x33, 0x77, 0x43, 0x51, 0x22,
-  0x1e, 0x32, 0x1f, 0x31, 0x93, 0x22, 0x1d, 0x41, 0x2f, 0x25, 0x44, 0xf2,
-  0xd3, 0xd3, 0x3f, 0x34, 0xf4, 0x43, 0xc3, 0x2f, 0x25, 0xf5, 0x73, 0x63,
-  0x3f, 0x36, 0xf7, 0x42, 0x73, 0x2f, 0x23, 0xf3, 0x12, 0x12, 0x1d, 0x13,
-  0x2f, 0x24, 0xe7, 0x23, 0xf7, 0x13, 0x13, 0x25, 0xd2, 0x33, 0xf2, 0x33,
-  0x33, 0x24, 0x35, 0xf3, 0x62, 0x62, 0x3f, 0x32, 0xf2, 0xe3, 0xe3, 0x2f,
-  0x28, 0xf8, 0xa2, 0x82, 0x27, 0x2c, 0x1f, 0x3e, 0xf6, 0xc2, 0x42, 0x2f,
-  0x28, 0xfc, 0xe2, 0xa2, 0xee, 0xc2, 0x2d, 0x22, 0x2d, 0x22, 0x2b, 0xa2,
-  0xaa, 0xc2, 0xa2, 0x8f, 0x23, 0x05, 0x1f, 0x13, 0xe2, 0x12, 0xf6, 0x31,
-  0x11, 0x2a, 0xd2, 0x31, 0xd4, 0x12, 0xf4, 0x33, 0x33, 0x2b, 0x23, 0x1d,
-  0x73, 0x2f, 0x12, 0x76, 0x41, 0xb3, 0x32, 0xf2, 0x41, 0x33, 0x37, 0x14,
-  0x3d, 0x43, 0x2b, 0x63, 0x1f, 0x32, 0xf3, 0x43, 0x41, 0x25, 0xe2, 0x23,
-  0xd3, 0x11, 0xb2, 0x22, 0xf2, 0x61, 0x61, 0x4e, 0x52, 0x24, 0x2b, 0xc4,
-  0x4e, 0x42, 0x3f, 0x14, 0xe4, 0x25, 0xb4, 0x62, 0xe7, 0x24, 0xf2, 0x72,
-  0x41, 0x2c, 0xf2, 0x12, 0x12, 0x15, 0xf3, 0x72, 0x42, 0x2c, 0xf6, 0x13,
-  0x11, 0x24, 0x37, 0x32, 0x3d, 0x23, 0x1e, 0x12, 0x35, 0xe1, 0x26, 0x96,
-  0x82, 0xce, 0x42, 0x2b, 0xaa, 0xce, 0xe2, 0x2f, 0x24, 0xfc, 0xc1, 0x43,
-  0x2b, 0xc4, 0x2c, 0xfc, 0xa2, 0xc2, 0xce, 0xe2, 0x21, 0x22, 0x23, 0xa8,
-  0x2a, 0x8a, 0xf8, 0xcd, 0x8d, 0x70, 0x51, 0xa1, 0x13, 0x17, 0x12, 0x13,
-  0xf2, 0x11, 0x53, 0x2b, 0x55, 0x1f, 0x32, 0xf2, 0x33, 0x22, 0x1f, 0x36,
-  0xf7, 0x72, 0x72, 0x1f, 0x36, 0xf6, 0x53, 0x62, 0x1f, 0x34, 0xf5, 0x12,
-  0x51, 0x1d, 0x43, 0x2f, 0x27, 0xf6, 0x21, 0x73, 0x3f, 0x15, 0x45, 0xd2,
-  0x22, 0xf2, 0x13, 0x31, 0x2b, 0x31, 0x1f, 0x34, 0xa4, 0x54, 0x24, 0x2b,
-  0xc5, 0x2f, 0x24, 0xf4, 0xd3, 0x51, 0x2f, 0x25, 0xb4, 0x62, 0xf7, 0x62,
-  0x62, 0x2b, 0x47, 0x2f, 0x21, 0xb3, 0x22, 0x52, 0x31, 0x2b, 0x47, 0x1e,
-  0x32, 0x3f, 0x12, 0x52, 0x22, 0x3f, 0x33, 0xf1, 0x13, 0x31, 0x2e, 0x22,
-  0x35, 0xe3, 0x24, 0xf4, 0x22, 0xa2, 0xce, 0xc2, 0x2b, 0xaa, 0x2f, 0x28,
-  0xba, 0xc2, 0xf8, 0xe1, 0x43, 0x2b, 0x4c, 0x2f, 0x2a, 0xbe, 0xe2, 0xec,
-  0x2c, 0x16, 0x32, 0x22, 0x2b, 0xaa, 0x82, 0x8e, 0x82, 0xbf, 0x91, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x42, 0x20, 0x04, 0x4a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x82, 0x00, 0x20, 0x08, 0x8a, 0x04, 0x82, 0x00, 0x00, 0x20, 0xf8,
-  0xc4, 0x86, 0x00, 0x28, 0x22, 0x20, 0x04, 0x22, 0x00, 0x48, 0x42, 0x28,
-  0x80, 0x24, 0x24, 0x22, 0x04, 0x24, 0x80, 0x02, 0x28, 0x48, 0x00, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x08,
-  0x00, 0x80, 0x04, 0x00, 0x80, 0x48, 0xf1, 0xb8, 0x1a, 0xa0, 0x52, 0x1b,
-  0x21, 0x2a, 0xb1, 0x11, 0xa2, 0x14, 0x1b, 0x61, 0x2b, 0x14, 0x1b, 0x61,
-  0x2b, 0x14, 0x1b, 0x21, 0x2b, 0x96, 0x1b, 0x21, 0x2f, 0x14, 0xb9, 0x11,
-  0xf4, 0x42, 0x91, 0x3a, 0xf4, 0x42, 0x91, 0x3a, 0xf4, 0x42, 0xb1, 0x3a,
-  0xf4, 0x42, 0xb1, 0x3a, 0xc4, 0xb1, 0x1f, 0x22, 0xc4, 0x81, 0x2e, 0x42,
-  0x16, 0xe1, 0x22, 0x65, 0x19, 0x2e, 0x52, 0x96, 0xe1, 0x22, 0xa5, 0x2d,
-  0x2e, 0x52, 0x1b, 0x29, 0x2e, 0x52, 0x1b, 0x29, 0x2e, 0x12, 0x1b, 0x29,
-  0x6a, 0xb1, 0x91, 0xb6, 0x62, 0xb1, 0x81, 0x36, 0x62, 0x1b, 0x28, 0x2b,
-  0x86, 0x19, 0xb2, 0x42, 0x98, 0x41, 0x2b, 0x84, 0xa2, 0x2b, 0xa4, 0x2a,
-  0xb4, 0x42, 0x2a, 0x9a, 0xa2, 0xaa, 0x84, 0xea, 0x22, 0x74, 0x65, 0x07,
-  0x2a, 0x94, 0x41, 0x2a, 0x14, 0x01, 0x19, 0x16, 0x92, 0x61, 0x23, 0x94,
-  0x21, 0x2b, 0x86, 0x28, 0x2b, 0xa4, 0x68, 0x29, 0xa8, 0x42, 0x2b, 0x84,
-  0x48, 0x2d, 0xa1, 0x48, 0x2b, 0xa4, 0x21, 0x29, 0xea, 0x22, 0xa5, 0x84,
-  0x2e, 0x92, 0x1c, 0xe8, 0x22, 0x64, 0x18, 0x2e, 0x42, 0x86, 0xc1, 0x43,
-  0xc2, 0x34, 0xc2, 0x2c, 0xb4, 0x81, 0xc4, 0x42, 0x13, 0x08, 0x8a, 0x14,
-  0xa2, 0x48, 0x21, 0x1b, 0x48, 0x29, 0x98, 0x41, 0x2b, 0xa4, 0x19, 0xb4,
-  0x42, 0x2a, 0xb8, 0x42, 0x88, 0x94, 0x82, 0x8a, 0x14, 0xb2, 0x82, 0x84,
-  0xd8, 0x22, 0x74, 0xc1, 0x02, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x44, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xaf, 0x22, 0x41, 0x01, 0x90, 0x11, 0x80, 0x01, 0x22, 0x14,
-  0x40, 0x01, 0x24, 0x14, 0x40, 0x52, 0x21, 0x48, 0x40, 0x92, 0x11, 0x80,
-  0x42, 0x01, 0x10, 0x01, 0x28, 0xa0, 0x12, 0x89, 0x02, 0x24, 0x2a, 0x19,
-  0xc2, 0x11, 0x11, 0x20, 0x02, 0x40, 0x11, 0x51, 0x12, 0x30, 0x82, 0x00,
-  0x80, 0x08, 0x29, 0x62, 0x28, 0x10, 0x62, 0x42, 0x00, 0x28, 0xee, 0x9d,
-  0xa0, 0x61, 0x1b, 0x1a, 0x82, 0x14, 0x42, 0x33, 0xa2, 0x1c, 0x26, 0xa2,
-  0x42, 0x28, 0x29, 0x04, 0x2c, 0xe4, 0x24, 0x41, 0x01, 0x88, 0x11, 0x13,
-  0x84, 0x52, 0x42, 0x48, 0xa0, 0x48, 0x68, 0x40, 0x54, 0x21, 0x34, 0x50,
-  0x21, 0x2c, 0x01, 0x42, 0x18, 0x82, 0x21, 0x10, 0x92, 0x42, 0x34, 0x4c,
-  0x12, 0x82, 0x52, 0x12, 0x30, 0x11, 0x82, 0x21, 0x21, 0x21, 0x41, 0x21,
-  0x43, 0x08, 0x23, 0x0c, 0x8e, 0x41, 0x48, 0x7b, 0xb9, 0x80, 0x67, 0x1e,
-  0x1c, 0x08, 0x52, 0x27, 0x12, 0x8a, 0x92, 0x21, 0x48, 0x34, 0x48, 0x30,
-  0x63, 0x2c, 0x54, 0x21, 0x14, 0x2b, 0x84, 0x10, 0x11, 0x52, 0x22, 0x28,
-  0x11, 0x1a, 0x2c, 0x24, 0x08, 0x50, 0x32, 0x28, 0x97, 0x22, 0x11, 0x24,
-  0xa8, 0x23, 0x31, 0x81, 0x23, 0x04, 0x29, 0x22, 0x44, 0x91, 0x25, 0x34,
-  0x13, 0x52, 0x12, 0x88, 0x11, 0x22, 0x21, 0x21, 0x21, 0x22, 0x21, 0x27,
-  0x28, 0x70, 0xa2, 0x06, 0xc2, 0x2c, 0xf2, 0xda, 0x46, 0x00, 0x12, 0x18,
-  0x11, 0x00, 0x4a, 0x01, 0x23, 0x82, 0x02, 0x40, 0x22, 0x01, 0x00, 0x11,
-  0x42, 0x13, 0x43, 0x84, 0x04, 0x80, 0x12, 0x41, 0x34, 0x21, 0x80, 0x01,
-  0x2c, 0x01, 0x58, 0x80, 0x11, 0x01, 0x10, 0x02, 0x25, 0x02, 0x00, 0x21,
-  0x12, 0x88, 0x80, 0x08, 0x25, 0x24, 0x48, 0x04, 0x42, 0x00, 0x48, 0x1f,
-  0xb4, 0x08, 0x00, 0x29, 0x01, 0x2f, 0x22, 0x81, 0x02, 0xc0, 0x12, 0x20,
-  0x24, 0xc1, 0x13, 0x48, 0x14, 0xc0, 0x12, 0x80, 0x81, 0x44, 0x01, 0x80,
-  0x04, 0x00, 0x21, 0x00, 0x28, 0x22, 0x80, 0x01, 0x18, 0x00, 0x28, 0x18,
-  0x19, 0x66, 0x26, 0x28, 0x22, 0x00, 0x12, 0x14, 0x82, 0x1c, 0x08, 0x00,
-  0x24, 0xa0, 0x84, 0x20, 0xa4, 0x48, 0x9f, 0xfe, 0x01, 0x2e, 0x11, 0x30,
-  0x25, 0x30, 0x81, 0x84, 0x1e, 0x63, 0x48, 0xb0, 0x41, 0xc1, 0x23, 0x00,
-  0x81, 0x24, 0x58, 0x80, 0xe1, 0x22, 0x64, 0x11, 0x41, 0xa0, 0x49, 0x80,
-  0x14, 0x82, 0x22, 0xd1, 0x22, 0x64, 0x22, 0x20, 0x24, 0x8c, 0x82, 0x91,
-  0x23, 0x25, 0xe3, 0x11, 0x42, 0xc2, 0x23, 0x70, 0x14, 0x31, 0x51, 0x14,
-  0xca, 0x81, 0x3a, 0x42, 0x24, 0x70, 0x46, 0x02, 0x30, 0xc2, 0x88, 0x4a,
-  0x68, 0x42, 0x82, 0x22, 0xf0, 0x5e, 0x53, 0x90, 0x21, 0x40, 0x05, 0x90,
-  0x22, 0x22, 0x00, 0x39, 0x31, 0x61, 0x12, 0x1d, 0x12, 0x50, 0x21, 0x48,
-  0x18, 0x80, 0x74, 0x42, 0x41, 0x04, 0xca, 0x01, 0x2c, 0x04, 0x28, 0x21,
-  0x42, 0x28, 0x28, 0x80, 0x04, 0x90, 0x21, 0x31, 0x1e, 0x21, 0xe0, 0x11,
-  0x22, 0xb4, 0x11, 0x82, 0xc5, 0x21, 0x12, 0x20, 0x44, 0x61, 0x28, 0x43,
-  0x18, 0x02, 0x21, 0x82, 0x42, 0x4b, 0xa4, 0x80, 0x22, 0xe4, 0x34, 0x08,
-  0x18, 0xb0, 0x12, 0x02, 0x2f, 0x19, 0x12, 0xe8, 0x34, 0x81, 0x84, 0x81,
-  0x44, 0x02, 0xc0, 0x48, 0x80, 0x41, 0x82, 0xa1, 0x12, 0x12, 0x14, 0x00,
-  0x48, 0x00, 0xc0, 0x12, 0x10, 0x12, 0xa2, 0x24, 0x82, 0x32, 0x12, 0x29,
-  0x01, 0x21, 0x2c, 0x42, 0xc2, 0x21, 0x47, 0x24, 0x19, 0x02, 0xc8, 0x2a,
-  0x38, 0x12, 0x10, 0xc2, 0x41, 0x00, 0xc8, 0x24, 0x82, 0x80, 0x88, 0x84,
-  0xf8, 0xf8, 0x9a, 0x00, 0x4a, 0x01, 0x20, 0x04, 0x24, 0xe0, 0x34, 0x42,
-  0x34, 0x16, 0x46, 0x41, 0x22, 0x82, 0x81, 0x02, 0x10, 0xa4, 0x34, 0x69,
-  0x31, 0x84, 0x41, 0x16, 0x24, 0x02, 0x24, 0x10, 0x81, 0x52, 0x14, 0x13,
-  0x22, 0x02, 0x20, 0xa4, 0x41, 0x90, 0x14, 0x21, 0x00, 0x4e, 0x22, 0x00,
-  0x41, 0xc0, 0x42, 0x00, 0x10, 0x02, 0x00, 0x2b, 0x81, 0x80, 0x61, 0x41,
-  0x4e, 0x6e, 0x20, 0x25, 0x06, 0x14, 0x21, 0x81, 0x00, 0x80, 0x12, 0x04,
-  0x29, 0x61, 0x46, 0x50, 0x14, 0x40, 0x89, 0x04, 0x1d, 0x42, 0x42, 0x12,
-  0x1e, 0x23, 0x00, 0x42, 0x18, 0x38, 0x80, 0x92, 0x41, 0x18, 0x18, 0x22,
-  0x33, 0x81, 0x14, 0x01, 0x40, 0xe1, 0x28, 0x44, 0x41, 0x01, 0x51, 0x3c,
-  0x22, 0x02, 0x82, 0x28, 0xc0, 0x48, 0x80, 0x02, 0x10, 0x28, 0xf5, 0x91,
-  0xf9, 0x00, 0x10, 0x02, 0x00, 0x18, 0x4e, 0x22, 0x00, 0x00, 0x00, 0x14,
-  0x10, 0x02, 0x36, 0x01, 0x80, 0x02, 0x42, 0x42, 0x44, 0x43, 0xc1, 0x42,
-  0x24, 0x80, 0x01, 0x21, 0x00, 0x44, 0x00, 0x13, 0x82, 0x41, 0x44, 0x04,
-  0xc8, 0x12, 0x48, 0x80, 0x08, 0x18, 0x00, 0x44, 0x49, 0x04, 0x00, 0x20,
-  0xf2, 0xab, 0x33, 0x80, 0x85, 0x01, 0x24, 0x48, 0x84, 0x16, 0x62, 0x26,
-  0x1b, 0x42, 0x21, 0x21, 0x46, 0x63, 0x21, 0x41, 0x19, 0x41, 0x03, 0x81,
-  0x47, 0x14, 0x2c, 0xc1, 0x14, 0x49, 0x2e, 0x21, 0xb4, 0x22, 0x04, 0x4e,
-  0x12, 0x2c, 0x35, 0x21, 0x22, 0x5b, 0x21, 0x2c, 0xa4, 0x21, 0x20, 0x92,
-  0x45, 0x00, 0x43, 0x81, 0x51, 0x14, 0x4e, 0x82, 0x26, 0x61, 0x14, 0x80,
-  0x84, 0x22, 0x08, 0x82, 0x28, 0x90, 0x4c, 0x48, 0x26, 0x22, 0x01, 0x83,
-  0xa1, 0x42, 0xab, 0x36, 0x00, 0x28, 0x21, 0x11, 0x00, 0x00, 0xc0, 0x24,
-  0x18, 0x00, 0x48, 0x30, 0x24, 0x10, 0x81, 0xa3, 0x42, 0x46, 0x01, 0x44,
-  0x53, 0x02, 0x41, 0x44, 0x20, 0x11, 0x02, 0x22, 0x80, 0x01, 0x29, 0x21,
-  0x41, 0x91, 0x21, 0x21, 0x10, 0x84, 0x94, 0x82, 0x12, 0x14, 0x11, 0x27,
-  0x24, 0x80, 0x01, 0x21, 0x40, 0x04, 0x88, 0x00, 0x41, 0x7f, 0x59, 0x0d,
-  0x00, 0x22, 0x42, 0x48, 0x00, 0x21, 0x80, 0x42, 0x23, 0x84, 0x44, 0xf2,
-  0x11, 0x22, 0x42, 0x80, 0x02, 0x22, 0x12, 0x28, 0x00, 0x20, 0x21, 0x04,
-  0xa0, 0x42, 0x14, 0xa0, 0x42, 0x40, 0x02, 0x20, 0x51, 0x41, 0x80, 0x42,
-  0x82, 0x06, 0x29, 0x2c, 0x55, 0x12, 0x14, 0x41, 0x00, 0x90, 0x24, 0x28,
-  0x82, 0x80, 0x04, 0x22, 0x39, 0x01, 0x40, 0x88, 0x81, 0x01, 0x63, 0x24,
-  0x62, 0x41, 0x11, 0x00, 0x00, 0x00, 0x10, 0x34, 0x12, 0x13, 0x02, 0x40,
-  0x24, 0xa2, 0x41, 0x00, 0x11, 0x4a, 0x21, 0x01, 0x18, 0x23, 0x01, 0x00,
-  0x12, 0x22, 0x24, 0x22, 0x18, 0x21, 0x42, 0x20, 0x12, 0x01, 0x90, 0x14,
-  0x80, 0x11, 0x22, 0x24, 0x24, 0xa4, 0x12, 0x2a, 0x08, 0x22, 0x86, 0xe8,
-  0xfb, 0x06, 0x14, 0x52, 0x80, 0x02, 0x70, 0x11, 0x08, 0x12, 0x30, 0x41,
-  0x10, 0x19, 0x02, 0x20, 0x11, 0x21, 0x01, 0x20, 0x81, 0x91, 0x22, 0x24,
-  0x00, 0x00, 0x00, 0x2b, 0x21, 0x12, 0x42, 0x6c, 0x03, 0x29, 0x01, 0x18,
-  0x40, 0x04, 0x00, 0xa2, 0x43, 0x28, 0x82, 0x0c, 0x00, 0xa2, 0x00, 0x00,
-  0x00, 0x42, 0x4d, 0x94, 0xc0, 0x48, 0x44, 0x1b, 0x42, 0x00, 0x1a, 0x24,
-  0x22, 0x12, 0x01, 0x12, 0x28, 0x43, 0x02, 0x13, 0x04, 0x41, 0x00, 0x41,
-  0x00, 0x00, 0x1c, 0xa1, 0x41, 0x12, 0x24, 0x00, 0x80, 0x04, 0x11, 0x00,
-  0x20, 0x02, 0x12, 0x18, 0x00, 0x2a, 0x04, 0x40, 0x14, 0x05, 0x22, 0x28,
-  0x00, 0x00, 0x80, 0x42, 0x88, 0xb8, 0xd9, 0x07, 0x8a, 0x84, 0x02, 0x00,
-  0x21, 0x24, 0x40, 0x82, 0x01, 0x00, 0x00, 0x18, 0x14, 0x12, 0x2c, 0x12,
-  0x04, 0x28, 0x48, 0x20, 0x24, 0x02, 0x48, 0x42, 0x2a, 0x24, 0x84, 0x84,
-  0x24, 0x24, 0x02, 0x24, 0x40, 0x22, 0x32, 0x22, 0x28, 0x2a, 0x64, 0x24,
-  0x22, 0x62, 0x1b, 0x42, 0x30, 0x42, 0x88, 0x20, 0x85, 0xe6, 0x2c, 0xa1,
-  0x68, 0x12, 0x44, 0x40, 0xf1, 0xc6, 0xdc, 0x00, 0x85, 0x04, 0x1a, 0x32,
-  0x51, 0x28, 0x00, 0x00, 0x5a, 0x92, 0x22, 0x12, 0x80, 0x12, 0x46, 0x02,
-  0x80, 0x41, 0x02, 0x23, 0x22, 0x04, 0x80, 0x14, 0x22, 0x01, 0x00, 0x26,
-  0x91, 0x22, 0x00, 0x22, 0x48, 0x80, 0x04, 0x12, 0x25, 0x01, 0x42, 0x10,
-  0x82, 0x81, 0x62, 0x24, 0x40, 0x02, 0x28, 0x20, 0x08, 0x28, 0x4c, 0xf2,
-  0xb4, 0xbb, 0xd0, 0x84, 0x01, 0x12, 0x40, 0x84, 0x01, 0x16, 0x84, 0x01,
-  0x20, 0x04, 0x00, 0x48, 0x80, 0x02, 0x00, 0x41, 0x21, 0x80, 0x21, 0x04,
-  0x40, 0x82, 0x81, 0x12, 0x21, 0x81, 0x01, 0x32, 0x20, 0xa1, 0x34, 0x80,
-  0x21, 0x04, 0x00, 0x88, 0x16, 0x84, 0x84, 0x02, 0x22, 0x00, 0x00, 0x22,
-  0x22, 0x42, 0xf0, 0xde, 0x6e, 0x80, 0x31, 0x12, 0x11, 0x21, 0x16, 0x01,
-  0x1b, 0x41, 0x80, 0x94, 0x12, 0x00, 0x54, 0x21, 0x42, 0x18, 0x00, 0x14,
-  0x00, 0x48, 0x42, 0x20, 0x04, 0x24, 0x90, 0x41, 0x18, 0x42, 0x28, 0xc0,
-  0x21, 0x80, 0x94, 0x14, 0x21, 0x30, 0x22, 0x11, 0x10, 0x04, 0x00, 0x42,
-  0x2c, 0x42, 0x01, 0x20, 0x12, 0x02, 0x00, 0x00, 0x48, 0x6f, 0x6b, 0x0a,
-  0x55, 0x08, 0x48, 0x10, 0x48, 0x04, 0x22, 0x00, 0x22, 0x44, 0x80, 0x02,
-  0x22, 0x18, 0xa0, 0x14, 0x18, 0x2d, 0x15, 0x90, 0x13, 0xc0, 0x12, 0x41,
-  0x1a, 0x08, 0x24, 0xe0, 0x42, 0x01, 0x14, 0x23, 0x61, 0x11, 0x8c, 0x92,
-  0x41, 0x2a, 0x04, 0x00, 0x32, 0x00, 0x20, 0x42, 0x04, 0x4a, 0x02, 0x00,
-  0x00, 0x23, 0x04, 0xb0, 0x4a, 0x08, 0x3f, 0x3b, 0x01, 0x1e, 0x12, 0xcb,
-  0x28, 0x28, 0x50, 0x49, 0x5a, 0xe2, 0x32, 0x93, 0x32, 0x12, 0x30, 0x21,
-  0xc0, 0x53, 0x24, 0x1b, 0x25, 0x58, 0x45, 0x82, 0x41, 0x41, 0x54, 0x22,
-  0x4b, 0x52, 0x1e, 0x42, 0x18, 0xa0, 0x42, 0x58, 0x60, 0x21, 0x5a, 0xa6,
-  0x24, 0x2a, 0xe4, 0x22, 0xa4, 0x24, 0x4f, 0x22, 0x83, 0xf2, 0x11, 0x14,
-  0x22, 0x3e, 0x23, 0x23, 0xb4, 0x14, 0x22, 0x84, 0x46, 0xa2, 0x26, 0xda,
-  0x84, 0xd2, 0x11, 0xb5, 0x41, 0xe4, 0x21, 0x98, 0x22, 0xca, 0xa2, 0x42,
-  0x46, 0xa2, 0x22, 0x98, 0x28, 0x2e, 0xc9, 0x4b, 0x28, 0x9f, 0x85, 0x0c,
-  0x4e, 0x45, 0xcc, 0x65, 0x23, 0x1a, 0x62, 0x34, 0x69, 0x04, 0x12, 0x15,
-  0xa1, 0x13, 0x1e, 0x21, 0x2b, 0x44, 0x5d, 0x2c, 0x21, 0x26, 0x12, 0x64,
-  0x11, 0x27, 0x13, 0x1a, 0xb2, 0x16, 0x41, 0xc1, 0x24, 0x2a, 0x02, 0x1b,
-  0x44, 0x18, 0x11, 0x29, 0xa1, 0x44, 0x29, 0xc1, 0x44, 0x11, 0x38, 0x2d,
-  0x41, 0x11, 0x18, 0x23, 0x84, 0x12, 0xa4, 0x11, 0x23, 0x82, 0x66, 0x44,
-  0x2a, 0x24, 0xe8, 0x22, 0xb2, 0x42, 0x65, 0x46, 0x44, 0x62, 0x22, 0x2c,
-  0xb4, 0x42, 0x82, 0xb8, 0xc2, 0xa4, 0x22, 0x43, 0x02, 0x4a, 0xf4, 0xda,
-  0x39, 0x10, 0x25, 0xd1, 0x11, 0xa1, 0x52, 0x1a, 0xc5, 0x14, 0x17, 0x85,
-  0x47, 0x42, 0x4e, 0x12, 0x21, 0x4e, 0x52, 0x2a, 0x02, 0xc0, 0x41, 0x23,
-  0xc7, 0x14, 0x28, 0x1b, 0x16, 0x28, 0x1e, 0x14, 0xe0, 0x14, 0xa1, 0x64,
-  0x24, 0x63, 0x65, 0x25, 0x4a, 0xd4, 0x12, 0x21, 0xf2, 0x31, 0x12, 0x2b,
-  0x35, 0x52, 0x1b, 0x13, 0x12, 0x2b, 0x43, 0x2e, 0x22, 0x2b, 0x11, 0x2b,
-  0x14, 0x2e, 0x22, 0x19, 0xe1, 0x23, 0x31, 0x23, 0x4a, 0xd2, 0x12, 0xcc,
-  0x84, 0x17, 0x12, 0x47, 0x29, 0x21, 0x00, 0x2a, 0x41, 0xa4, 0x72, 0x1a,
-  0x28, 0x28, 0xb4, 0x48, 0xb2, 0x28, 0xf8, 0x27, 0x76, 0x10, 0x81, 0x11,
-  0x01, 0x11, 0x29, 0x11, 0x11, 0x12, 0x11, 0x92, 0x41, 0x21, 0x11, 0x21,
-  0x50, 0x42, 0x10, 0x22, 0x11, 0x02, 0x00, 0x42, 0x24, 0x42, 0x24, 0x40,
-  0x02, 0x24, 0x42, 0x24, 0x42, 0x24, 0x40, 0x02, 0x24, 0x30, 0x22, 0x48,
-  0x23, 0x02, 0x21, 0x82, 0x21, 0x48, 0x21, 0x10, 0x82, 0x14, 0x82, 0x14,
-  0x22, 0x09, 0x00, 0xfd, 0x51, 0xd0, 0x35, 0xf5, 0x23, 0x21, 0x15, 0x33,
-  0x33, 0x9f, 0xbc, 0xf1, 0x27, 0x27, 0x3f, 0x36, 0xf6, 0x27, 0x26, 0x3f,
-  0x34, 0xd4, 0x33, 0xf1, 0x13, 0x53, 0x3f, 0x21, 0x53, 0x31, 0x3f, 0x31,
-  0xf1, 0x13, 0x13, 0x6f, 0x22, 0x72, 0x17, 0xf7, 0x23, 0x23, 0x6a, 0xf6,
-  0x11, 0x15, 0x4f, 0x41, 0xa1, 0x55, 0x15, 0xf1, 0x41, 0x43, 0x35, 0xf3,
-  0x66, 0x64, 0x2f, 0x21, 0xf4, 0x52, 0x52, 0x3f, 0x35, 0xf4, 0x52, 0x62,
-  0x6f, 0x61, 0xb2, 0x22, 0xf4, 0x12, 0x32, 0x2f, 0x21, 0x75, 0x33, 0xf3,
-  0x42, 0x42, 0x67, 0x61, 0x35, 0x51, 0x33, 0x3f, 0x37, 0xf6, 0x32, 0x32,
-  0x3f, 0x37, 0x77, 0x27, 0xf7, 0x62, 0x62, 0x27, 0x24, 0x6e, 0x62, 0x2b,
-  0x57, 0x2f, 0x25, 0x55, 0x22, 0x3f, 0x3c, 0x1c, 0xf2, 0x52, 0x12, 0x2d,
-  0x22, 0x2f, 0x2f, 0x9d, 0xa2, 0x2b, 0x93, 0x45, 0xb4, 0x88, 0xfe, 0x6c,
-  0x46, 0x4f, 0xbc, 0x41, 0x51, 0x35, 0x6f, 0x92, 0xd6, 0x31, 0x72, 0x23,
-  0x71, 0x49, 0xfb, 0x26, 0x65, 0x3f, 0x36, 0xf6, 0x37, 0x25, 0x3f, 0x34,
-  0xf4, 0x12, 0x11, 0x3f, 0x75, 0xf5, 0x33, 0x33, 0x3d, 0x27, 0x2f, 0x11,
-  0xf1, 0x53, 0x53, 0x6b, 0x77, 0x7d, 0x17, 0x2f, 0x22, 0xf2, 0x62, 0x62,
-  0x3f, 0x51, 0xd1, 0x64, 0xb1, 0x72, 0xf7, 0x31, 0x31, 0x1d, 0x53, 0x15,
-  0xf3, 0xa6, 0xe6, 0x2f, 0x25, 0xf4, 0x52, 0xd2, 0x1f, 0x35, 0xf4, 0x52,
-  0x62, 0x4f, 0x65, 0x57, 0x32, 0x2f, 0x24, 0xf4, 0x32, 0x22, 0x9d, 0x2b,
-  0x2f, 0x24, 0xd4, 0xe4, 0x74, 0x13, 0x73, 0x13, 0xf3, 0x63, 0x43, 0x2f,
-  0x21, 0xf3, 0x71, 0x13, 0x7f, 0x52, 0xf2, 0x62, 0x62, 0x2f, 0x2c, 0xf4,
-  0xe2, 0xc6, 0x2f, 0x36, 0xf6, 0x72, 0x33, 0x25, 0xf2, 0xc1, 0xc3, 0x25,
-  0xf2, 0x12, 0x12, 0x2f, 0x26, 0xe4, 0x2b, 0x79, 0x62, 0xf2, 0x32, 0x92,
-  0x6d, 0x24, 0x8f, 0x8c, 0xfc, 0xce, 0xde, 0x2f, 0x3a, 0x03, 0x5d, 0x47,
-  0x2f, 0x52, 0x56, 0x31, 0x2b, 0x22, 0xd7, 0xf4, 0x6f, 0x56, 0xf2, 0x67,
-  0x67, 0x6f, 0x42, 0xf2, 0x43, 0x43, 0x2f, 0x11, 0xf1, 0x33, 0x77, 0x2b,
-  0x35, 0x1d, 0x23, 0x35, 0x71, 0x43, 0xb3, 0x66, 0x72, 0x17, 0xf3, 0x23,
-  0x21, 0x6e, 0x62, 0x7f, 0x51, 0xf1, 0x14, 0x14, 0x2b, 0x46, 0x5f, 0x53,
-  0xe1, 0x24, 0x45, 0xf2, 0x66, 0xe4, 0x4e, 0x52, 0x2f, 0x24, 0xd4, 0x31,
-  0xf5, 0x62, 0x42, 0x4f, 0x65, 0xd4, 0x12, 0xe5, 0x25, 0xf5, 0x12, 0x52,
-  0x17, 0xb2, 0x2f, 0x24, 0xd4, 0x64, 0x55, 0x13, 0x24, 0x2f, 0x26, 0xf7,
-  0x32, 0x22, 0x1f, 0x36, 0xf6, 0x27, 0x25, 0x2f, 0x26, 0xb6, 0x42, 0xec,
-  0x66, 0xfe, 0x73, 0x71, 0x1f, 0x35, 0x57, 0x22, 0x1f, 0x3c, 0x1c, 0xe2,
-  0x25, 0xf1, 0x42, 0x62, 0xfe, 0xd2, 0x2b, 0xf4, 0x2a, 0x59, 0x46, 0xea,
-  0xfc, 0xc4, 0xd4, 0x5f, 0xbc, 0x08, 0x5d, 0x17, 0xef, 0x43, 0xd2, 0x31,
-  0xb2, 0x33, 0xf2, 0x49, 0x9b, 0x6f, 0x47, 0xf6, 0x65, 0x67, 0x77, 0x42,
-  0x1f, 0x34, 0xb4, 0x12, 0xf1, 0x51, 0x53, 0x3f, 0x27, 0x53, 0x35, 0x25,
-  0xf1, 0x41, 0x43, 0x6f, 0x43, 0xd3, 0x75, 0xd1, 0x22, 0xe2, 0x27, 0x56,
-  0x77, 0x67, 0x41, 0x2b, 0x66, 0x5f, 0x54, 0x84, 0xe4, 0x24, 0xf4, 0x26,
-  0xe4, 0x2f, 0x24, 0xb5, 0xc2, 0xf4, 0x51, 0x53, 0x2b, 0x67, 0x4f, 0x65,
-  0xb7, 0x22, 0xf1, 0x52, 0x72, 0x2b, 0x32, 0x1d, 0x2b, 0x2b, 0x44, 0xcd,
-  0x26, 0x3d, 0x11, 0x2d, 0x32, 0x2f, 0x26, 0xb4, 0x22, 0xf1, 0x71, 0x13,
-  0x7f, 0x56, 0xe4, 0x26, 0xf6, 0xc2, 0x62, 0xee, 0x82, 0x2b, 0x57, 0x3f,
-  0x35, 0xb3, 0x42, 0xf4, 0xc1, 0xc3, 0x23, 0xf2, 0x12, 0x12, 0x2b, 0x46,
-  0xbe, 0x92, 0x2b, 0x1e, 0x2b, 0x9a, 0x67, 0x42, 0x8f, 0xac, 0xfc, 0xec,
-  0xce, 0x4f, 0x85, 0x08, 0x49, 0x01, 0x00, 0x18, 0x20, 0x02, 0x00, 0x22,
-  0x00, 0x00, 0x48, 0x10, 0x81, 0x02, 0x20, 0x01, 0x00, 0x20, 0x84, 0x21,
-  0x84, 0x21, 0x24, 0x22, 0x84, 0x01, 0x22, 0x00, 0x00, 0x80, 0x01, 0xa0,
-  0x48, 0xa0, 0x41, 0x00, 0x00, 0x28, 0x48, 0x28, 0x48, 0x28, 0x80, 0x22,
-  0xf8, 0x9c, 0x7e, 0x00, 0xa0, 0x12, 0x10, 0xa4, 0x41, 0x20, 0x01, 0xa0,
-  0x14, 0x00, 0x00, 0x80, 0x01, 0x3c, 0x11, 0x84, 0x11, 0xe4, 0x44, 0x02,
-  0x80, 0x24, 0x04, 0x00, 0x1a, 0x02, 0x00, 0x1a, 0x02, 0xa0, 0x12, 0x80,
-  0x81, 0x22, 0x84, 0x02, 0x28, 0x22, 0xe0, 0x14, 0x01, 0x00, 0x00, 0x00,
-  0x88, 0x20, 0x44, 0xe1, 0x35, 0x09, 0x2c, 0xf4, 0x11, 0x24, 0x8d, 0x12,
-  0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0xb2, 0x4a, 0xd1, 0xc1, 0xb2, 0x6a,
-  0xd1, 0x41, 0xb2, 0x4a, 0x99, 0x61, 0xaf, 0x24, 0xd9, 0x85, 0xb4, 0x4a,
-  0x39, 0x34, 0xaf, 0x14, 0x39, 0x35, 0x2f, 0x14, 0x79, 0x24, 0xd8, 0x12,
-  0xfb, 0x24, 0x48, 0x4e, 0x91, 0x4f, 0xa2, 0xe4, 0x14, 0xfa, 0x25, 0x4a,
-  0x16, 0xf1, 0x24, 0x4a, 0x96, 0xf1, 0x23, 0x4a, 0xd6, 0xc5, 0x4a, 0xde,
-  0x24, 0x4f, 0xa2, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24, 0xe5, 0xf2,
-  0x91, 0x24, 0xe3, 0xf6, 0x91, 0x24, 0xa3, 0xf6, 0x81, 0x64, 0xab, 0x14,
-  0x1f, 0x49, 0xf2, 0x4a, 0x91, 0x1b, 0x28, 0xab, 0x94, 0x5b, 0x41, 0xaf,
-  0x44, 0x39, 0xa4, 0xab, 0x94, 0x4b, 0x42, 0x2f, 0x44, 0xfb, 0xa4, 0x48,
-  0x2b, 0xb4, 0x4f, 0x82, 0x84, 0xf9, 0x24, 0x4a, 0xbf, 0x8f, 0x05, 0x2e,
-  0x42, 0x1d, 0x6c, 0x89, 0xf4, 0x11, 0x24, 0x83, 0xd6, 0xc1, 0x12, 0xda,
-  0x81, 0xb6, 0x4a, 0xd1, 0x41, 0xf4, 0x4a, 0x94, 0x19, 0xd6, 0x4a, 0xdb,
-  0x85, 0xb4, 0x48, 0x0b, 0xab, 0x84, 0x43, 0x92, 0x92, 0x4f, 0x82, 0xf4,
-  0x42, 0xb1, 0x67, 0x82, 0x4a, 0xd9, 0xa6, 0xe1, 0x14, 0xd8, 0xa4, 0xa9,
-  0x81, 0x4f, 0x82, 0x24, 0xe9, 0xa2, 0x64, 0x1d, 0xbc, 0xe4, 0x4d, 0xc2,
-  0x4b, 0xd6, 0x4c, 0xb8, 0x91, 0x96, 0x48, 0x1b, 0x29, 0x81, 0x1b, 0x49,
-  0xa1, 0x8e, 0x44, 0xab, 0x14, 0x1f, 0x49, 0xf2, 0x4a, 0x94, 0x1b, 0x28,
+  0x91, 0x14, 0x32, 0xe3, 0x0b, 0xf3, 0x0b, 0x11, 0x2b, 0x12, 0x19, 0x94,
+  0x12, 0x48, 0x29, 0x81, 0x94, 0x12, 0x90, 0x32, 0x80, 0x03, 0x40, 0x02,
+  0x24, 0x12, 0x24, 0x12, 0x24, 0x1a, 0x42, 0xa2, 0x21, 0x05, 0x00, 0x70,
+  0x12, 0x82, 0x12, 0x82, 0x12, 0xa2, 0x28, 0x48, 0x08, 0xf1, 0xff, 0xfd,
+  0xa2, 0x4a, 0x21, 0x22, 0x21, 0x22, 0x20, 0x0a, 0x2e, 0x42, 0xd0, 0x11,
+  0xf3, 0x11, 0x31, 0x15, 0xb1, 0x11, 0xf3, 0x11, 0x53, 0x3f, 0x31, 0xd1,
+  0x33, 0xf2, 0x23, 0x32, 0x1f, 0x37, 0xf3, 0x33, 0x33, 0x1f, 0x35, 0xf1,
+  0x23, 0x32, 0x1f, 0x31, 0xf1, 0x13, 0x13, 0x3f, 0x31, 0xf5, 0x22, 0x32,
+  0x1f, 0x33, 0xf1, 0x53, 0x13, 0x2b, 0x11, 0x22, 0x1f, 0x11, 0xa1, 0x13,
+  0x1f, 0x17, 0xe5, 0x24, 0x54, 0x22, 0x3f, 0x14, 0xf4, 0x53, 0x13, 0x3f,
+  0x15, 0xf5, 0x12, 0x52, 0x3f, 0x17, 0xf6, 0x63, 0x73, 0x2b, 0x74, 0x2f,
+  0x23, 0xf3, 0x22, 0x22, 0x3f, 0x32, 0xf3, 0x42, 0x72, 0x2f, 0x23, 0xf3,
+  0x23, 0x21, 0x2f, 0x23, 0xf3, 0x13, 0x33, 0x3f, 0x32, 0xf2, 0x32, 0x32,
+  0x3f, 0x32, 0xe2, 0x24, 0xf4, 0x23, 0x23, 0x1f, 0x3e, 0x96, 0x82, 0x2f,
+  0x2c, 0x5c, 0x22, 0x3f, 0x3c, 0xb4, 0x62, 0xf2, 0x22, 0x62, 0x2f, 0x2a,
+  0xfa, 0xe2, 0xc2, 0x29, 0x92, 0x22, 0x2a, 0x22, 0xc8, 0xa2, 0x1f, 0xcf,
+  0x42, 0xf1, 0x41, 0x11, 0x3e, 0x51, 0x1f, 0x13, 0x71, 0x21, 0xd1, 0x31,
+  0xfc, 0x52, 0x11, 0x3f, 0x33, 0xf3, 0x23, 0x33, 0x3f, 0x37, 0xf3, 0x22,
+  0x23, 0x3d, 0x43, 0x3d, 0x73, 0x3f, 0x35, 0xd7, 0x12, 0xd4, 0x33, 0xf4,
+  0x62, 0x32, 0x3f, 0x33, 0x77, 0x43, 0x51, 0x22, 0x1e, 0x32, 0x1f, 0x31,
+  0x93, 0x22, 0x1d, 0x41, 0x2f, 0x25, 0x44, 0xf2, 0xd3, 0xd3, 0x3f, 0x34,
+  0xf4, 0x43, 0xc3, 0x2f, 0x25, 0xf5, 0x73, 0x63, 0x3f, 0x36, 0xf7, 0x42,
+  0x73, 0x2f, 0x23, 0xf3, 0x12, 0x12, 0x1d, 0x13, 0x2f, 0x24, 0xe7, 0x23,
+  0xf7, 0x13, 0x13, 0x25, 0xd2, 0x33, 0xf2, 0x33, 0x33, 0x24, 0x35, 0xf3,
+  0x62, 0x62, 0x3f, 0x32, 0xf2, 0xe3, 0xe3, 0x2f, 0x28, 0xf8, 0xa2, 0x82,
+  0x27, 0x2c, 0x1f, 0x3e, 0xf6, 0xc2, 0x42, 0x2f, 0x28, 0xfc, 0xe2, 0xa2,
+  0xee, 0xc2, 0x2d, 0x22, 0x2d, 0x22, 0x2b, 0xa2, 0xaa, 0xc2, 0xa2, 0x8f,
+  0x23, 0x05, 0x1f, 0x13, 0xe2, 0x12, 0xf6, 0x31, 0x11, 0x2a, 0xd2, 0x31,
+  0xd4, 0x12, 0xf4, 0x33, 0x33, 0x2b, 0x23, 0x1d, 0x73, 0x2f, 0x12, 0x76,
+  0x41, 0xb3, 0x32, 0xf2, 0x41, 0x33, 0x37, 0x14, 0x3d, 0x43, 0x2b, 0x63,
+  0x1f, 0x32, 0xf3, 0x43, 0x41, 0x25, 0xe2, 0x23, 0xd3, 0x11, 0xb2, 0x22,
+  0xf2, 0x61, 0x61, 0x4e, 0x52, 0x24, 0x2b, 0xc4, 0x4e, 0x42, 0x3f, 0x14,
+  0xe4, 0x25, 0xb4, 0x62, 0xe7, 0x24, 0xf2, 0x72, 0x41, 0x2c, 0xf2, 0x12,
+  0x12, 0x15, 0xf3, 0x72, 0x42, 0x2c, 0xf6, 0x13, 0x11, 0x24, 0x37, 0x32,
+  0x3d, 0x23, 0x1e, 0x12, 0x35, 0xe1, 0x26, 0x96, 0x82, 0xce, 0x42, 0x2b,
+  0xaa, 0xce, 0xe2, 0x2f, 0x24, 0xfc, 0xc1, 0x43, 0x2b, 0xc4, 0x2c, 0xfc,
+  0xa2, 0xc2, 0xce, 0xe2, 0x21, 0x22, 0x23, 0xa8, 0x2a, 0x8a, 0xf8, 0xcd,
+  0x8d, 0x70, 0x51, 0xa1, 0x13, 0x17, 0x12, 0x13, 0xf2, 0x11, 0x53, 0x2b,
+  0x55, 0x1f, 0x32, 0xf2, 0x33, 0x22, 0x1f, 0x36, 0xf7, 0x72, 0x72, 0x1f,
+  0x36, 0xf6, 0x53, 0x62, 0x1f, 0x34, 0xf5, 0x12, 0x51, 0x1d, 0x43, 0x2f,
+  0x27, 0xf6, 0x21, 0x73, 0x3f, 0x15, 0x45, 0xd2, 0x22, 0xf2, 0x13, 0x31,
+  0x2b, 0x31, 0x1f, 0x34, 0xa4, 0x54, 0x24, 0x2b, 0xc5, 0x2f, 0x24, 0xf4,
+  0xd3, 0x51, 0x2f, 0x25, 0xb4, 0x62, 0xf7, 0x62, 0x62, 0x2b, 0x47, 0x2f,
+  0x21, 0xb3, 0x22, 0x52, 0x31, 0x2b, 0x47, 0x1e, 0x32, 0x3f, 0x12, 0x52,
+  0x22, 0x3f, 0x33, 0xf1, 0x13, 0x31, 0x2e, 0x22, 0x35, 0xe3, 0x24, 0xf4,
+  0x22, 0xa2, 0xce, 0xc2, 0x2b, 0xaa, 0x2f, 0x28, 0xba, 0xc2, 0xf8, 0xe1,
+  0x43, 0x2b, 0x4c, 0x2f, 0x2a, 0xbe, 0xe2, 0xec, 0x2c, 0x16, 0x32, 0x22,
+  0x2b, 0xaa, 0x82, 0x8e, 0x82, 0xbf, 0x91, 0x2b, 0x03, 0x00, 0xee, 0x0c,
+  0x00, 0xdb, 0x05, 0x00, 0x53, 0x0c, 0x21, 0x04, 0x4a, 0x09, 0x00, 0x11,
+  0x00, 0x6a, 0x03, 0x20, 0x8a, 0x04, 0x97, 0x0b, 0xf0, 0x05, 0xf8, 0xc4,
+  0x86, 0x00, 0x28, 0x22, 0x20, 0x04, 0x22, 0x00, 0x48, 0x42, 0x28, 0x80,
+  0x24, 0x24, 0x22, 0x04, 0x24, 0x80, 0x2a, 0x04, 0x04, 0xb8, 0x08, 0x00,
+  0x6a, 0x03, 0x10, 0x08, 0x0d, 0x00, 0xf2, 0x02, 0x80, 0x48, 0xf1, 0xb8,
+  0x1a, 0xa0, 0x52, 0x1b, 0x21, 0x2a, 0xb1, 0x11, 0xa2, 0x14, 0x1b, 0x61,
+  0x2b, 0x04, 0x00, 0xd2, 0x21, 0x2b, 0x96, 0x1b, 0x21, 0x2f, 0x14, 0xb9,
+  0x11, 0xf4, 0x42, 0x91, 0x3a, 0x04, 0x00, 0x11, 0xb1, 0x04, 0x00, 0xf1,
+  0x09, 0xc4, 0xb1, 0x1f, 0x22, 0xc4, 0x81, 0x2e, 0x42, 0x16, 0xe1, 0x22,
+  0x65, 0x19, 0x2e, 0x52, 0x96, 0xe1, 0x22, 0xa5, 0x2d, 0x2e, 0x52, 0x1b,
+  0x29, 0x04, 0x00, 0xf1, 0x43, 0x12, 0x1b, 0x29, 0x6a, 0xb1, 0x91, 0xb6,
+  0x62, 0xb1, 0x81, 0x36, 0x62, 0x1b, 0x28, 0x2b, 0x86, 0x19, 0xb2, 0x42,
+  0x98, 0x41, 0x2b, 0x84, 0xa2, 0x2b, 0xa4, 0x2a, 0xb4, 0x42, 0x2a, 0x9a,
+  0xa2, 0xaa, 0x84, 0xea, 0x22, 0x74, 0x65, 0x07, 0x2a, 0x94, 0x41, 0x2a,
+  0x14, 0x01, 0x19, 0x16, 0x92, 0x61, 0x23, 0x94, 0x21, 0x2b, 0x86, 0x28,
+  0x2b, 0xa4, 0x68, 0x29, 0xa8, 0x42, 0x2b, 0x84, 0x48, 0x2d, 0xa1, 0x48,
+  0x2b, 0xa4, 0x21, 0x29, 0xea, 0x22, 0xa5, 0x84, 0x2e, 0x92, 0x1c, 0xe8,
+  0x22, 0x64, 0x18, 0x8a, 0x08, 0xf0, 0x1b, 0xc2, 0x34, 0xc2, 0x2c, 0xb4,
+  0x81, 0xc4, 0x42, 0x13, 0x08, 0x8a, 0x14, 0xa2, 0x48, 0x21, 0x1b, 0x48,
+  0x29, 0x98, 0x41, 0x2b, 0xa4, 0x19, 0xb4, 0x42, 0x2a, 0xb8, 0x42, 0x88,
+  0x94, 0x82, 0x8a, 0x14, 0xb2, 0x82, 0x84, 0xd8, 0x22, 0x74, 0xc1, 0x02,
+  0x20, 0x76, 0x0d, 0x02, 0x01, 0x00, 0x64, 0x10, 0x02, 0x18, 0x80, 0x08,
+  0x44, 0x0e, 0x00, 0x13, 0x14, 0xe0, 0x0c, 0xf0, 0x1d, 0xaf, 0x22, 0x41,
+  0x01, 0x90, 0x11, 0x80, 0x01, 0x22, 0x14, 0x40, 0x01, 0x24, 0x14, 0x40,
+  0x52, 0x21, 0x48, 0x40, 0x92, 0x11, 0x80, 0x42, 0x01, 0x10, 0x01, 0x28,
+  0xa0, 0x12, 0x89, 0x02, 0x24, 0x2a, 0x19, 0xc2, 0x11, 0x11, 0x20, 0x02,
+  0x40, 0x11, 0x51, 0x12, 0x30, 0x50, 0x07, 0xf0, 0xff, 0x9f, 0x29, 0x62,
+  0x28, 0x10, 0x62, 0x42, 0x00, 0x28, 0xee, 0x9d, 0xa0, 0x61, 0x1b, 0x1a,
+  0x82, 0x14, 0x42, 0x33, 0xa2, 0x1c, 0x26, 0xa2, 0x42, 0x28, 0x29, 0x04,
+  0x2c, 0xe4, 0x24, 0x41, 0x01, 0x88, 0x11, 0x13, 0x84, 0x52, 0x42, 0x48,
+  0xa0, 0x48, 0x68, 0x40, 0x54, 0x21, 0x34, 0x50, 0x21, 0x2c, 0x01, 0x42,
+  0x18, 0x82, 0x21, 0x10, 0x92, 0x42, 0x34, 0x4c, 0x12, 0x82, 0x52, 0x12,
+  0x30, 0x11, 0x82, 0x21, 0x21, 0x21, 0x41, 0x21, 0x43, 0x08, 0x23, 0x0c,
+  0x8e, 0x41, 0x48, 0x7b, 0xb9, 0x80, 0x67, 0x1e, 0x1c, 0x08, 0x52, 0x27,
+  0x12, 0x8a, 0x92, 0x21, 0x48, 0x34, 0x48, 0x30, 0x63, 0x2c, 0x54, 0x21,
+  0x14, 0x2b, 0x84, 0x10, 0x11, 0x52, 0x22, 0x28, 0x11, 0x1a, 0x2c, 0x24,
+  0x08, 0x50, 0x32, 0x28, 0x97, 0x22, 0x11, 0x24, 0xa8, 0x23, 0x31, 0x81,
+  0x23, 0x04, 0x29, 0x22, 0x44, 0x91, 0x25, 0x34, 0x13, 0x52, 0x12, 0x88,
+  0x11, 0x22, 0x21, 0x21, 0x21, 0x22, 0x21, 0x27, 0x28, 0x70, 0xa2, 0x06,
+  0xc2, 0x2c, 0xf2, 0xda, 0x46, 0x00, 0x12, 0x18, 0x11, 0x00, 0x4a, 0x01,
+  0x23, 0x82, 0x02, 0x40, 0x22, 0x01, 0x00, 0x11, 0x42, 0x13, 0x43, 0x84,
+  0x04, 0x80, 0x12, 0x41, 0x34, 0x21, 0x80, 0x01, 0x2c, 0x01, 0x58, 0x80,
+  0x11, 0x01, 0x10, 0x02, 0x25, 0x02, 0x00, 0x21, 0x12, 0x88, 0x80, 0x08,
+  0x25, 0x24, 0x48, 0x04, 0x42, 0x00, 0x48, 0x1f, 0xb4, 0x08, 0x00, 0x29,
+  0x01, 0x2f, 0x22, 0x81, 0x02, 0xc0, 0x12, 0x20, 0x24, 0xc1, 0x13, 0x48,
+  0x14, 0xc0, 0x12, 0x80, 0x81, 0x44, 0x01, 0x80, 0x04, 0x00, 0x21, 0x00,
+  0x28, 0x22, 0x80, 0x01, 0x18, 0x00, 0x28, 0x18, 0x19, 0x66, 0x26, 0x28,
+  0x22, 0x00, 0x12, 0x14, 0x82, 0x1c, 0x08, 0x00, 0x24, 0xa0, 0x84, 0x20,
+  0xa4, 0x48, 0x9f, 0xfe, 0x01, 0x2e, 0x11, 0x30, 0x25, 0x30, 0x81, 0x84,
+  0x1e, 0x63, 0x48, 0xb0, 0x41, 0xc1, 0x23, 0x00, 0x81, 0x24, 0x58, 0x80,
+  0xe1, 0x22, 0x64, 0x11, 0x41, 0xa0, 0x49, 0x80, 0x14, 0x82, 0x22, 0xd1,
+  0x22, 0x64, 0x22, 0x20, 0x24, 0x8c, 0x82, 0x91, 0x23, 0x25, 0xe3, 0x11,
+  0x42, 0xc2, 0x23, 0x70, 0x14, 0x31, 0x51, 0x14, 0xca, 0x81, 0x3a, 0x42,
+  0x24, 0x70, 0x46, 0x02, 0x30, 0xc2, 0x88, 0x4a, 0x68, 0x42, 0x82, 0x22,
+  0xf0, 0x5e, 0x53, 0x90, 0x21, 0x40, 0x05, 0x90, 0x22, 0x22, 0x00, 0x39,
+  0x31, 0x61, 0x12, 0x1d, 0x12, 0x50, 0x21, 0x48, 0x18, 0x80, 0x74, 0x42,
+  0x41, 0x04, 0xca, 0x01, 0x2c, 0x04, 0x28, 0x21, 0x42, 0x28, 0x28, 0x80,
+  0x04, 0x90, 0x21, 0x31, 0x1e, 0x21, 0xe0, 0x11, 0x22, 0xb4, 0x11, 0x82,
+  0xc5, 0x21, 0x12, 0x20, 0x44, 0x61, 0x28, 0x43, 0x18, 0x02, 0x21, 0x82,
+  0x42, 0x4b, 0xa4, 0x80, 0x22, 0xe4, 0x34, 0x08, 0x18, 0xb0, 0x12, 0x02,
+  0x2f, 0x19, 0x12, 0xe8, 0x34, 0x81, 0x84, 0x81, 0x44, 0x02, 0xc0, 0x48,
+  0x80, 0x41, 0x82, 0xa1, 0x12, 0x12, 0x14, 0x00, 0x48, 0x00, 0xc0, 0x12,
+  0x10, 0x12, 0xa2, 0x24, 0x82, 0x32, 0x12, 0x08, 0x0f, 0xf0, 0x39, 0x42,
+  0xc2, 0x21, 0x47, 0x24, 0x19, 0x02, 0xc8, 0x2a, 0x38, 0x12, 0x10, 0xc2,
+  0x41, 0x00, 0xc8, 0x24, 0x82, 0x80, 0x88, 0x84, 0xf8, 0xf8, 0x9a, 0x00,
+  0x4a, 0x01, 0x20, 0x04, 0x24, 0xe0, 0x34, 0x42, 0x34, 0x16, 0x46, 0x41,
+  0x22, 0x82, 0x81, 0x02, 0x10, 0xa4, 0x34, 0x69, 0x31, 0x84, 0x41, 0x16,
+  0x24, 0x02, 0x24, 0x10, 0x81, 0x52, 0x14, 0x13, 0x22, 0x02, 0x20, 0xa4,
+  0x41, 0x90, 0x14, 0x21, 0x00, 0x4e, 0x22, 0x00, 0x41, 0xc0, 0x42, 0xab,
+  0x07, 0xf0, 0x33, 0x2b, 0x81, 0x80, 0x61, 0x41, 0x4e, 0x6e, 0x20, 0x25,
+  0x06, 0x14, 0x21, 0x81, 0x00, 0x80, 0x12, 0x04, 0x29, 0x61, 0x46, 0x50,
+  0x14, 0x40, 0x89, 0x04, 0x1d, 0x42, 0x42, 0x12, 0x1e, 0x23, 0x00, 0x42,
+  0x18, 0x38, 0x80, 0x92, 0x41, 0x18, 0x18, 0x22, 0x33, 0x81, 0x14, 0x01,
+  0x40, 0xe1, 0x28, 0x44, 0x41, 0x01, 0x51, 0x3c, 0x22, 0x02, 0x82, 0x28,
+  0xc0, 0x48, 0x80, 0x02, 0x10, 0x28, 0xf5, 0x91, 0xf9, 0x46, 0x00, 0x20,
+  0x18, 0x4e, 0xab, 0x03, 0xf0, 0x8e, 0x14, 0x10, 0x02, 0x36, 0x01, 0x80,
+  0x02, 0x42, 0x42, 0x44, 0x43, 0xc1, 0x42, 0x24, 0x80, 0x01, 0x21, 0x00,
+  0x44, 0x00, 0x13, 0x82, 0x41, 0x44, 0x04, 0xc8, 0x12, 0x48, 0x80, 0x08,
+  0x18, 0x00, 0x44, 0x49, 0x04, 0x00, 0x20, 0xf2, 0xab, 0x33, 0x80, 0x85,
+  0x01, 0x24, 0x48, 0x84, 0x16, 0x62, 0x26, 0x1b, 0x42, 0x21, 0x21, 0x46,
+  0x63, 0x21, 0x41, 0x19, 0x41, 0x03, 0x81, 0x47, 0x14, 0x2c, 0xc1, 0x14,
+  0x49, 0x2e, 0x21, 0xb4, 0x22, 0x04, 0x4e, 0x12, 0x2c, 0x35, 0x21, 0x22,
+  0x5b, 0x21, 0x2c, 0xa4, 0x21, 0x20, 0x92, 0x45, 0x00, 0x43, 0x81, 0x51,
+  0x14, 0x4e, 0x82, 0x26, 0x61, 0x14, 0x80, 0x84, 0x22, 0x08, 0x82, 0x28,
+  0x90, 0x4c, 0x48, 0x26, 0x22, 0x01, 0x83, 0xa1, 0x42, 0xab, 0x36, 0x00,
+  0x28, 0x21, 0x11, 0x00, 0x00, 0xc0, 0x24, 0x18, 0x00, 0x48, 0x30, 0x24,
+  0x10, 0x81, 0xa3, 0x42, 0x46, 0x01, 0x44, 0x53, 0x02, 0x41, 0x44, 0x20,
+  0x11, 0x02, 0x22, 0x80, 0x01, 0x29, 0x21, 0x41, 0x91, 0x21, 0x21, 0x10,
+  0x84, 0x94, 0x82, 0x12, 0x14, 0x11, 0x27, 0x90, 0x00, 0xf0, 0x38, 0x40,
+  0x04, 0x88, 0x00, 0x41, 0x7f, 0x59, 0x0d, 0x00, 0x22, 0x42, 0x48, 0x00,
+  0x21, 0x80, 0x42, 0x23, 0x84, 0x44, 0xf2, 0x11, 0x22, 0x42, 0x80, 0x02,
+  0x22, 0x12, 0x28, 0x00, 0x20, 0x21, 0x04, 0xa0, 0x42, 0x14, 0xa0, 0x42,
+  0x40, 0x02, 0x20, 0x51, 0x41, 0x80, 0x42, 0x82, 0x06, 0x29, 0x2c, 0x55,
+  0x12, 0x14, 0x41, 0x00, 0x90, 0x24, 0x28, 0x82, 0x80, 0x04, 0x22, 0x39,
+  0x01, 0x40, 0x88, 0x81, 0x01, 0x63, 0x24, 0x62, 0x41, 0x11, 0x7a, 0x03,
+  0xf0, 0x31, 0x34, 0x12, 0x13, 0x02, 0x40, 0x24, 0xa2, 0x41, 0x00, 0x11,
+  0x4a, 0x21, 0x01, 0x18, 0x23, 0x01, 0x00, 0x12, 0x22, 0x24, 0x22, 0x18,
+  0x21, 0x42, 0x20, 0x12, 0x01, 0x90, 0x14, 0x80, 0x11, 0x22, 0x24, 0x24,
+  0xa4, 0x12, 0x2a, 0x08, 0x22, 0x86, 0xe8, 0xfb, 0x06, 0x14, 0x52, 0x80,
+  0x02, 0x70, 0x11, 0x08, 0x12, 0x30, 0x41, 0x10, 0x19, 0x02, 0x20, 0x11,
+  0x21, 0x01, 0x20, 0x81, 0x91, 0x22, 0x10, 0x0a, 0xf0, 0x04, 0x2b, 0x21,
+  0x12, 0x42, 0x6c, 0x03, 0x29, 0x01, 0x18, 0x40, 0x04, 0x00, 0xa2, 0x43,
+  0x28, 0x82, 0x0c, 0x00, 0xa2, 0xeb, 0x04, 0xf0, 0xba, 0x4d, 0x94, 0xc0,
+  0x48, 0x44, 0x1b, 0x42, 0x00, 0x1a, 0x24, 0x22, 0x12, 0x01, 0x12, 0x28,
+  0x43, 0x02, 0x13, 0x04, 0x41, 0x00, 0x41, 0x00, 0x00, 0x1c, 0xa1, 0x41,
+  0x12, 0x24, 0x00, 0x80, 0x04, 0x11, 0x00, 0x20, 0x02, 0x12, 0x18, 0x00,
+  0x2a, 0x04, 0x40, 0x14, 0x05, 0x22, 0x28, 0x00, 0x00, 0x80, 0x42, 0x88,
+  0xb8, 0xd9, 0x07, 0x8a, 0x84, 0x02, 0x00, 0x21, 0x24, 0x40, 0x82, 0x01,
+  0x00, 0x00, 0x18, 0x14, 0x12, 0x2c, 0x12, 0x04, 0x28, 0x48, 0x20, 0x24,
+  0x02, 0x48, 0x42, 0x2a, 0x24, 0x84, 0x84, 0x24, 0x24, 0x02, 0x24, 0x40,
+  0x22, 0x32, 0x22, 0x28, 0x2a, 0x64, 0x24, 0x22, 0x62, 0x1b, 0x42, 0x30,
+  0x42, 0x88, 0x20, 0x85, 0xe6, 0x2c, 0xa1, 0x68, 0x12, 0x44, 0x40, 0xf1,
+  0xc6, 0xdc, 0x00, 0x85, 0x04, 0x1a, 0x32, 0x51, 0x28, 0x00, 0x00, 0x5a,
+  0x92, 0x22, 0x12, 0x80, 0x12, 0x46, 0x02, 0x80, 0x41, 0x02, 0x23, 0x22,
+  0x04, 0x80, 0x14, 0x22, 0x01, 0x00, 0x26, 0x91, 0x22, 0x00, 0x22, 0x48,
+  0x80, 0x04, 0x12, 0x25, 0x01, 0x42, 0x10, 0x82, 0x81, 0x62, 0x24, 0x40,
+  0x02, 0x28, 0x20, 0x08, 0x28, 0x4c, 0xf2, 0xb4, 0xbb, 0xd0, 0x84, 0x01,
+  0x12, 0x40, 0x84, 0x01, 0x16, 0x84, 0x01, 0x20, 0x04, 0x00, 0x48, 0x80,
+  0x02, 0x00, 0x41, 0x21, 0x80, 0x21, 0x04, 0x40, 0x82, 0x81, 0x12, 0x21,
+  0x81, 0x01, 0x32, 0x20, 0xa1, 0x34, 0x4b, 0x0e, 0xf0, 0x2f, 0x88, 0x16,
+  0x84, 0x84, 0x02, 0x22, 0x00, 0x00, 0x22, 0x22, 0x42, 0xf0, 0xde, 0x6e,
+  0x80, 0x31, 0x12, 0x11, 0x21, 0x16, 0x01, 0x1b, 0x41, 0x80, 0x94, 0x12,
+  0x00, 0x54, 0x21, 0x42, 0x18, 0x00, 0x14, 0x00, 0x48, 0x42, 0x20, 0x04,
+  0x24, 0x90, 0x41, 0x18, 0x42, 0x28, 0xc0, 0x21, 0x80, 0x94, 0x14, 0x21,
+  0x30, 0x22, 0x11, 0x10, 0x04, 0x00, 0x42, 0x2c, 0x42, 0x01, 0x20, 0x12,
+  0xd7, 0x0b, 0xf1, 0x20, 0x6f, 0x6b, 0x0a, 0x55, 0x08, 0x48, 0x10, 0x48,
+  0x04, 0x22, 0x00, 0x22, 0x44, 0x80, 0x02, 0x22, 0x18, 0xa0, 0x14, 0x18,
+  0x2d, 0x15, 0x90, 0x13, 0xc0, 0x12, 0x41, 0x1a, 0x08, 0x24, 0xe0, 0x42,
+  0x01, 0x14, 0x23, 0x61, 0x11, 0x8c, 0x92, 0x41, 0x2a, 0x04, 0x00, 0x32,
+  0x00, 0x20, 0x42, 0x28, 0x06, 0xf0, 0xff, 0x1b, 0x23, 0x04, 0xb0, 0x4a,
+  0x08, 0x3f, 0x3b, 0x01, 0x1e, 0x12, 0xcb, 0x28, 0x28, 0x50, 0x49, 0x5a,
+  0xe2, 0x32, 0x93, 0x32, 0x12, 0x30, 0x21, 0xc0, 0x53, 0x24, 0x1b, 0x25,
+  0x58, 0x45, 0x82, 0x41, 0x41, 0x54, 0x22, 0x4b, 0x52, 0x1e, 0x42, 0x18,
+  0xa0, 0x42, 0x58, 0x60, 0x21, 0x5a, 0xa6, 0x24, 0x2a, 0xe4, 0x22, 0xa4,
+  0x24, 0x4f, 0x22, 0x83, 0xf2, 0x11, 0x14, 0x22, 0x3e, 0x23, 0x23, 0xb4,
+  0x14, 0x22, 0x84, 0x46, 0xa2, 0x26, 0xda, 0x84, 0xd2, 0x11, 0xb5, 0x41,
+  0xe4, 0x21, 0x98, 0x22, 0xca, 0xa2, 0x42, 0x46, 0xa2, 0x22, 0x98, 0x28,
+  0x2e, 0xc9, 0x4b, 0x28, 0x9f, 0x85, 0x0c, 0x4e, 0x45, 0xcc, 0x65, 0x23,
+  0x1a, 0x62, 0x34, 0x69, 0x04, 0x12, 0x15, 0xa1, 0x13, 0x1e, 0x21, 0x2b,
+  0x44, 0x5d, 0x2c, 0x21, 0x26, 0x12, 0x64, 0x11, 0x27, 0x13, 0x1a, 0xb2,
+  0x16, 0x41, 0xc1, 0x24, 0x2a, 0x02, 0x1b, 0x44, 0x18, 0x11, 0x29, 0xa1,
+  0x44, 0x29, 0xc1, 0x44, 0x11, 0x38, 0x2d, 0x41, 0x11, 0x18, 0x23, 0x84,
+  0x12, 0xa4, 0x11, 0x23, 0x82, 0x66, 0x44, 0x2a, 0x24, 0xe8, 0x22, 0xb2,
+  0x42, 0x65, 0x46, 0x44, 0x62, 0x22, 0x2c, 0xb4, 0x42, 0x82, 0xb8, 0xc2,
+  0xa4, 0x22, 0x43, 0x02, 0x4a, 0xf4, 0xda, 0x39, 0x10, 0x25, 0xd1, 0x11,
+  0xa1, 0x52, 0x1a, 0xc5, 0x14, 0x17, 0x85, 0x47, 0x42, 0x4e, 0x12, 0x21,
+  0x4e, 0x52, 0x2a, 0x02, 0xc0, 0x41, 0x23, 0xc7, 0x14, 0x28, 0x1b, 0x16,
+  0x28, 0x1e, 0x14, 0xe0, 0x14, 0xa1, 0x64, 0x24, 0x63, 0x65, 0x25, 0x4a,
+  0xd4, 0x12, 0x21, 0xf2, 0x31, 0x12, 0x2b, 0x35, 0x52, 0x1b, 0x13, 0x12,
+  0x2b, 0x43, 0x2e, 0x22, 0x2b, 0x11, 0x2b, 0x14, 0x2e, 0x22, 0x19, 0xe1,
+  0x23, 0x31, 0x23, 0x4a, 0xd2, 0x12, 0xcc, 0x84, 0x17, 0x12, 0x47, 0x29,
+  0x21, 0x00, 0x2a, 0x41, 0xa4, 0x72, 0x1a, 0x28, 0x28, 0xb4, 0x48, 0xb2,
+  0x28, 0xf8, 0x27, 0x76, 0x10, 0x81, 0x11, 0x01, 0x11, 0x29, 0x11, 0x11,
+  0x12, 0x11, 0x92, 0x41, 0x21, 0x11, 0x21, 0x50, 0x42, 0x10, 0x22, 0x11,
+  0x02, 0x00, 0x42, 0x24, 0x42, 0xaf, 0x0f, 0x03, 0x07, 0x00, 0x70, 0x30,
+  0x22, 0x48, 0x23, 0x02, 0x21, 0x82, 0x88, 0x09, 0xf0, 0x18, 0x82, 0x14,
+  0x82, 0x14, 0x22, 0x09, 0x00, 0xfd, 0x51, 0xd0, 0x35, 0xf5, 0x23, 0x21,
+  0x15, 0x33, 0x33, 0x9f, 0xbc, 0xf1, 0x27, 0x27, 0x3f, 0x36, 0xf6, 0x27,
+  0x26, 0x3f, 0x34, 0xd4, 0x33, 0xf1, 0x13, 0x53, 0x3f, 0x21, 0x53, 0x31,
+  0x3f, 0x88, 0x09, 0xf0, 0x93, 0x6f, 0x22, 0x72, 0x17, 0xf7, 0x23, 0x23,
+  0x6a, 0xf6, 0x11, 0x15, 0x4f, 0x41, 0xa1, 0x55, 0x15, 0xf1, 0x41, 0x43,
+  0x35, 0xf3, 0x66, 0x64, 0x2f, 0x21, 0xf4, 0x52, 0x52, 0x3f, 0x35, 0xf4,
+  0x52, 0x62, 0x6f, 0x61, 0xb2, 0x22, 0xf4, 0x12, 0x32, 0x2f, 0x21, 0x75,
+  0x33, 0xf3, 0x42, 0x42, 0x67, 0x61, 0x35, 0x51, 0x33, 0x3f, 0x37, 0xf6,
+  0x32, 0x32, 0x3f, 0x37, 0x77, 0x27, 0xf7, 0x62, 0x62, 0x27, 0x24, 0x6e,
+  0x62, 0x2b, 0x57, 0x2f, 0x25, 0x55, 0x22, 0x3f, 0x3c, 0x1c, 0xf2, 0x52,
+  0x12, 0x2d, 0x22, 0x2f, 0x2f, 0x9d, 0xa2, 0x2b, 0x93, 0x45, 0xb4, 0x88,
+  0xfe, 0x6c, 0x46, 0x4f, 0xbc, 0x41, 0x51, 0x35, 0x6f, 0x92, 0xd6, 0x31,
+  0x72, 0x23, 0x71, 0x49, 0xfb, 0x26, 0x65, 0x3f, 0x36, 0xf6, 0x37, 0x25,
+  0x3f, 0x34, 0xf4, 0x12, 0x11, 0x3f, 0x75, 0xf5, 0x33, 0x33, 0x3d, 0x27,
+  0x2f, 0x11, 0xf1, 0x53, 0x53, 0x6b, 0x77, 0x7d, 0x17, 0x2f, 0x22, 0xf2,
+  0x62, 0x62, 0x3f, 0x51, 0xd1, 0x64, 0xb1, 0x72, 0xf7, 0x31, 0x31, 0x1d,
+  0x53, 0x15, 0xf3, 0xa6, 0xe6, 0x2f, 0x25, 0xf4, 0x52, 0xd2, 0x1f, 0x85,
+  0x00, 0xf0, 0xff, 0x3f, 0x4f, 0x65, 0x57, 0x32, 0x2f, 0x24, 0xf4, 0x32,
+  0x22, 0x9d, 0x2b, 0x2f, 0x24, 0xd4, 0xe4, 0x74, 0x13, 0x73, 0x13, 0xf3,
+  0x63, 0x43, 0x2f, 0x21, 0xf3, 0x71, 0x13, 0x7f, 0x52, 0xf2, 0x62, 0x62,
+  0x2f, 0x2c, 0xf4, 0xe2, 0xc6, 0x2f, 0x36, 0xf6, 0x72, 0x33, 0x25, 0xf2,
+  0xc1, 0xc3, 0x25, 0xf2, 0x12, 0x12, 0x2f, 0x26, 0xe4, 0x2b, 0x79, 0x62,
+  0xf2, 0x32, 0x92, 0x6d, 0x24, 0x8f, 0x8c, 0xfc, 0xce, 0xde, 0x2f, 0x3a,
+  0x03, 0x5d, 0x47, 0x2f, 0x52, 0x56, 0x31, 0x2b, 0x22, 0xd7, 0xf4, 0x6f,
+  0x56, 0xf2, 0x67, 0x67, 0x6f, 0x42, 0xf2, 0x43, 0x43, 0x2f, 0x11, 0xf1,
+  0x33, 0x77, 0x2b, 0x35, 0x1d, 0x23, 0x35, 0x71, 0x43, 0xb3, 0x66, 0x72,
+  0x17, 0xf3, 0x23, 0x21, 0x6e, 0x62, 0x7f, 0x51, 0xf1, 0x14, 0x14, 0x2b,
+  0x46, 0x5f, 0x53, 0xe1, 0x24, 0x45, 0xf2, 0x66, 0xe4, 0x4e, 0x52, 0x2f,
+  0x24, 0xd4, 0x31, 0xf5, 0x62, 0x42, 0x4f, 0x65, 0xd4, 0x12, 0xe5, 0x25,
+  0xf5, 0x12, 0x52, 0x17, 0xb2, 0x2f, 0x24, 0xd4, 0x64, 0x55, 0x13, 0x24,
+  0x2f, 0x26, 0xf7, 0x32, 0x22, 0x1f, 0x36, 0xf6, 0x27, 0x25, 0x2f, 0x26,
+  0xb6, 0x42, 0xec, 0x66, 0xfe, 0x73, 0x71, 0x1f, 0x35, 0x57, 0x22, 0x1f,
+  0x3c, 0x1c, 0xe2, 0x25, 0xf1, 0x42, 0x62, 0xfe, 0xd2, 0x2b, 0xf4, 0x2a,
+  0x59, 0x46, 0xea, 0xfc, 0xc4, 0xd4, 0x5f, 0xbc, 0x08, 0x5d, 0x17, 0xef,
+  0x43, 0xd2, 0x31, 0xb2, 0x33, 0xf2, 0x49, 0x9b, 0x6f, 0x47, 0xf6, 0x65,
+  0x67, 0x77, 0x42, 0x1f, 0x34, 0xb4, 0x12, 0xf1, 0x51, 0x53, 0x3f, 0x27,
+  0x53, 0x35, 0x25, 0xf1, 0x41, 0x43, 0x6f, 0x43, 0xd3, 0x75, 0xd1, 0x22,
+  0xe2, 0x27, 0x56, 0x77, 0x67, 0x41, 0x2b, 0x66, 0x5f, 0x54, 0x84, 0xe4,
+  0x24, 0xf4, 0x26, 0xe4, 0x2f, 0x24, 0xb5, 0xc2, 0xf4, 0x51, 0x53, 0x2b,
+  0x67, 0x4f, 0x65, 0xb7, 0x22, 0xf1, 0x52, 0x72, 0x2b, 0x32, 0x1d, 0x2b,
+  0x2b, 0x44, 0xcd, 0x26, 0x3d, 0x11, 0x2d, 0x32, 0x2f, 0x26, 0xb4, 0x22,
+  0xf1, 0x71, 0x13, 0x7f, 0x56, 0xe4, 0x26, 0xf6, 0xc2, 0x62, 0xee, 0x82,
+  0x2b, 0x57, 0x3f, 0x35, 0xb3, 0x42, 0xf4, 0xc1, 0xc3, 0x23, 0xf2, 0x12,
+  0x12, 0x2b, 0x46, 0xbe, 0x92, 0x2b, 0x1e, 0x2b, 0x9a, 0x67, 0x42, 0x8f,
+  0xac, 0xfc, 0xec, 0xce, 0x4f, 0x85, 0x08, 0x49, 0x01, 0x00, 0x18, 0x20,
+  0x02, 0x97, 0x09, 0x50, 0x48, 0x10, 0x81, 0x02, 0x20, 0x88, 0x0e, 0xf0,
+  0x17, 0x21, 0x84, 0x21, 0x24, 0x22, 0x84, 0x01, 0x22, 0x00, 0x00, 0x80,
+  0x01, 0xa0, 0x48, 0xa0, 0x41, 0x00, 0x00, 0x28, 0x48, 0x28, 0x48, 0x28,
+  0x80, 0x22, 0xf8, 0x9c, 0x7e, 0x00, 0xa0, 0x12, 0x10, 0xa4, 0x41, 0x20,
+  0x01, 0xa0, 0x14, 0x1e, 0x00, 0xf2, 0xdf, 0x3c, 0x11, 0x84, 0x11, 0xe4,
+  0x44, 0x02, 0x80, 0x24, 0x04, 0x00, 0x1a, 0x02, 0x00, 0x1a, 0x02, 0xa0,
+  0x12, 0x80, 0x81, 0x22, 0x84, 0x02, 0x28, 0x22, 0xe0, 0x14, 0x01, 0x00,
+  0x00, 0x00, 0x88, 0x20, 0x44, 0xe1, 0x35, 0x09, 0x2c, 0xf4, 0x11, 0x24,
+  0x8d, 0x12, 0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0xb2, 0x4a, 0xd1, 0xc1,
+  0xb2, 0x6a, 0xd1, 0x41, 0xb2, 0x4a, 0x99, 0x61, 0xaf, 0x24, 0xd9, 0x85,
+  0xb4, 0x4a, 0x39, 0x34, 0xaf, 0x14, 0x39, 0x35, 0x2f, 0x14, 0x79, 0x24,
+  0xd8, 0x12, 0xfb, 0x24, 0x48, 0x4e, 0x91, 0x4f, 0xa2, 0xe4, 0x14, 0xfa,
+  0x25, 0x4a, 0x16, 0xf1, 0x24, 0x4a, 0x96, 0xf1, 0x23, 0x4a, 0xd6, 0xc5,
+  0x4a, 0xde, 0x24, 0x4f, 0xa2, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24,
+  0xe5, 0xf2, 0x91, 0x24, 0xe3, 0xf6, 0x91, 0x24, 0xa3, 0xf6, 0x81, 0x64,
+  0xab, 0x14, 0x1f, 0x49, 0xf2, 0x4a, 0x91, 0x1b, 0x28, 0xab, 0x94, 0x5b,
+  0x41, 0xaf, 0x44, 0x39, 0xa4, 0xab, 0x94, 0x4b, 0x42, 0x2f, 0x44, 0xfb,
+  0xa4, 0x48, 0x2b, 0xb4, 0x4f, 0x82, 0x84, 0xf9, 0x24, 0x4a, 0xbf, 0x8f,
+  0x05, 0x2e, 0x42, 0x1d, 0x6c, 0x89, 0xf4, 0x11, 0x24, 0x83, 0xd6, 0xc1,
+  0x12, 0xda, 0x81, 0xb6, 0x4a, 0xd1, 0x41, 0xf4, 0x4a, 0x94, 0x19, 0xd6,
+  0x4a, 0xdb, 0x85, 0xb4, 0x48, 0x0b, 0xab, 0x84, 0x43, 0x92, 0x92, 0x4f,
+  0x82, 0xf4, 0x42, 0xb1, 0x67, 0x82, 0x4a, 0xd9, 0xa6, 0xe1, 0x14, 0xd8,
+  0xa4, 0xa9, 0x81, 0x4f, 0x82, 0x24, 0xe9, 0xa2, 0x64, 0x1d, 0xbc, 0xe4,
+  0x4d, 0xc2, 0x4b, 0xd6, 0x4c, 0xb8, 0x91, 0x96, 0x48, 0x1b, 0x29, 0x81,
+  0x1b, 0x49, 0xa1, 0x8e, 0x44, 0x71, 0x00, 0xf0, 0x0f, 0x94, 0x1b, 0x28,
   0xad, 0x34, 0x5b, 0x49, 0xa9, 0xb3, 0xb4, 0xb4, 0x4a, 0xa1, 0x49, 0x2b,
   0x14, 0x4f, 0x88, 0x94, 0x82, 0x27, 0x8a, 0x29, 0xe1, 0x22, 0xf5, 0x59,
-  0x66, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x08, 0x42, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x21, 0xf0, 0x9e,
-  0xf5, 0x80, 0x04, 0x18, 0x27, 0x12, 0x11, 0x33, 0xa7, 0x14, 0x14, 0x23,
-  0x44, 0x88, 0x91, 0x11, 0x20, 0x41, 0x01, 0x1c, 0x52, 0x21, 0x12, 0x40,
-  0x21, 0x05, 0x1c, 0xc4, 0x24, 0x91, 0x1a, 0x02, 0x40, 0x02, 0x24, 0x1a,
-  0x42, 0x62, 0x11, 0x42, 0x25, 0x62, 0x12, 0x21, 0x21, 0x4c, 0xa1, 0x42,
-  0x5a, 0x02, 0x44, 0x86, 0x31, 0x42, 0x8a, 0x24, 0x61, 0x14, 0xa0, 0x41,
-  0x00, 0x29, 0x02, 0xa8, 0x28, 0x2e, 0x48, 0xc7, 0x5d, 0x00, 0x82, 0x20,
-  0x21, 0x43, 0x12, 0x31, 0x32, 0x93, 0x72, 0x21, 0x82, 0x24, 0x34, 0x11,
-  0x15, 0x02, 0x1a, 0x2a, 0x04, 0xd0, 0x23, 0x23, 0x01, 0x22, 0x24, 0x11,
-  0x28, 0x25, 0x02, 0x29, 0xb1, 0x44, 0x21, 0x21, 0x82, 0x34, 0x14, 0x24,
-  0xa0, 0x12, 0x00, 0x60, 0x24, 0x10, 0x21, 0xb2, 0x22, 0x18, 0x92, 0x21,
-  0x14, 0x24, 0x8a, 0x01, 0x29, 0x92, 0x24, 0x83, 0xc2, 0x42, 0x4a, 0x89,
-  0x44, 0x01, 0x3f, 0x83, 0x0a, 0x20, 0x2c, 0x11, 0x51, 0x21, 0x2a, 0x75,
-  0x53, 0xd2, 0x21, 0x33, 0x41, 0x13, 0x92, 0x56, 0x11, 0x13, 0xc3, 0x13,
-  0x11, 0x8a, 0x62, 0x12, 0x34, 0x18, 0x2b, 0x21, 0x27, 0x21, 0x1a, 0x24,
-  0x72, 0x51, 0x12, 0xf1, 0x88, 0x21, 0x26, 0x02, 0x29, 0x01, 0x12, 0x19,
-  0xa2, 0x42, 0x18, 0x85, 0xc1, 0x42, 0x4e, 0x32, 0x24, 0x00, 0x43, 0x91,
-  0x62, 0x13, 0x04, 0x6b, 0x82, 0x49, 0xc8, 0x61, 0x2a, 0x8c, 0xa1, 0x81,
-  0xa0, 0x16, 0x49, 0x52, 0x28, 0xd0, 0x22, 0x08, 0xb0, 0x58, 0xf2, 0x57,
-  0x7f, 0x80, 0x04, 0x24, 0x1a, 0xa2, 0x12, 0x11, 0x00, 0x83, 0x42, 0x08,
-  0x1a, 0x04, 0x00, 0x12, 0x42, 0x00, 0x11, 0x14, 0x00, 0xc0, 0x24, 0x24,
-  0x12, 0x00, 0x4d, 0x52, 0x40, 0x22, 0x51, 0x24, 0x12, 0x21, 0x60, 0x12,
-  0x10, 0x82, 0x04, 0x1a, 0x22, 0x02, 0x25, 0x03, 0x14, 0x70, 0x42, 0x01,
-  0x21, 0x80, 0xa2, 0x42, 0x4a, 0xa1, 0x4a, 0x28, 0xf0, 0x86, 0x1f, 0x20,
-  0x02, 0x2d, 0x11, 0x60, 0x22, 0x00, 0x12, 0x26, 0x02, 0x18, 0x13, 0x01,
-  0x00, 0x00, 0x00, 0x13, 0x52, 0x42, 0x00, 0x00, 0x00, 0x23, 0x02, 0x18,
-  0x42, 0x00, 0x2a, 0x25, 0x34, 0x22, 0x00, 0xd0, 0x22, 0x01, 0x41, 0x28,
-  0x22, 0x40, 0x01, 0x00, 0x00, 0x24, 0xc0, 0x24, 0x80, 0x2a, 0x02, 0x48,
-  0x2f, 0xe8, 0x02, 0x1c, 0x21, 0xc3, 0x24, 0x11, 0x16, 0x91, 0x11, 0x2e,
-  0x57, 0x19, 0x12, 0x22, 0xc6, 0x21, 0x25, 0x52, 0x21, 0x4a, 0x41, 0x91,
-  0x12, 0x2e, 0x41, 0x33, 0x21, 0x92, 0x52, 0x62, 0x76, 0x81, 0x02, 0x46,
-  0x06, 0x12, 0x19, 0xb5, 0x1b, 0x34, 0x22, 0x28, 0x23, 0x81, 0x52, 0x42,
-  0x00, 0x2d, 0x23, 0x16, 0x81, 0x11, 0x84, 0x51, 0x21, 0x40, 0x22, 0x88,
-  0x3a, 0x23, 0x27, 0x28, 0x82, 0x82, 0x11, 0x28, 0x28, 0x23, 0x58, 0x22,
-  0x80, 0xa4, 0x68, 0x82, 0x93, 0x0d, 0x38, 0x16, 0xc2, 0x21, 0x11, 0x19,
-  0x12, 0x02, 0xd0, 0x22, 0x22, 0xe2, 0x22, 0x41, 0x11, 0x02, 0x11, 0x12,
-  0x20, 0x21, 0x72, 0x42, 0x91, 0x42, 0x14, 0x22, 0xc0, 0x46, 0x80, 0x31,
-  0x22, 0x56, 0x82, 0x41, 0x22, 0x61, 0x22, 0x1e, 0x44, 0x42, 0x10, 0x32,
-  0x11, 0x24, 0x43, 0x11, 0x42, 0x04, 0x22, 0x21, 0x2c, 0x82, 0x42, 0x82,
-  0x88, 0x48, 0x41, 0x22, 0x72, 0x22, 0x14, 0xa2, 0x82, 0x62, 0x48, 0x48,
-  0xaf, 0x6f, 0x0e, 0x11, 0x28, 0x16, 0x04, 0x18, 0x1c, 0xe1, 0x76, 0xe1,
-  0x11, 0x02, 0x48, 0x14, 0x18, 0x11, 0x2b, 0x41, 0x24, 0xb0, 0x41, 0x52,
-  0x12, 0x20, 0x33, 0x24, 0x4a, 0x03, 0x00, 0x00, 0x17, 0x25, 0x94, 0x28,
-  0x4a, 0x02, 0x20, 0x02, 0x29, 0x62, 0x32, 0x20, 0x01, 0x18, 0x15, 0x82,
-  0x02, 0x88, 0x19, 0x48, 0x83, 0x08, 0x00, 0x28, 0x80, 0x48, 0x02, 0x80,
-  0x8a, 0xf8, 0x54, 0x25, 0x00, 0x42, 0x00, 0x20, 0x02, 0x80, 0x06, 0x41,
-  0x10, 0x32, 0x22, 0x43, 0x01, 0x00, 0x4c, 0x22, 0x11, 0x84, 0x42, 0x01,
-  0x28, 0x90, 0x14, 0x22, 0x31, 0x68, 0x21, 0x19, 0x04, 0x80, 0x83, 0x84,
-  0x04, 0x8b, 0x38, 0x00, 0x24, 0xc0, 0x21, 0x10, 0x04, 0x22, 0x00, 0x00,
-  0x83, 0x04, 0x1c, 0x12, 0x02, 0x00, 0x9f, 0x88, 0x07, 0x45, 0x62, 0x24,
-  0xc0, 0x32, 0x00, 0x4c, 0x04, 0x84, 0x18, 0x41, 0x11, 0x30, 0x28, 0xe0,
-  0x12, 0x01, 0x25, 0x22, 0x01, 0x35, 0x02, 0x20, 0x11, 0x24, 0x14, 0x21,
-  0x01, 0xb0, 0x18, 0x12, 0x31, 0x44, 0x10, 0x49, 0x04, 0x1b, 0x25, 0x14,
-  0x00, 0x28, 0x11, 0x88, 0x44, 0x51, 0x11, 0x22, 0x43, 0x08, 0x18, 0x2b,
-  0x82, 0xc0, 0x44, 0x45, 0x78, 0x84, 0x31, 0x88, 0x40, 0xf6, 0x56, 0x95,
-  0x20, 0x05, 0x50, 0x14, 0x24, 0x80, 0x63, 0x22, 0x13, 0x21, 0x84, 0x21,
-  0x02, 0x40, 0x41, 0x82, 0x54, 0x14, 0x80, 0x02, 0x12, 0x48, 0x34, 0xc0,
-  0x21, 0x00, 0x48, 0x18, 0x42, 0x28, 0x26, 0x02, 0x40, 0x02, 0x40, 0x02,
-  0x00, 0x2c, 0x12, 0x04, 0x88, 0x22, 0x29, 0x18, 0x01, 0x62, 0x90, 0x14,
-  0x40, 0xe1, 0x12, 0x04, 0x20, 0x74, 0xa3, 0x41, 0xa1, 0x41, 0x21, 0xd0,
-  0x25, 0x01, 0x28, 0x1e, 0x44, 0xd0, 0x12, 0x06, 0x18, 0x1c, 0x42, 0x12,
-  0x18, 0x65, 0x32, 0x48, 0x74, 0x26, 0x64, 0x21, 0xa0, 0x21, 0x1c, 0x04,
-  0x80, 0x82, 0x81, 0x33, 0x41, 0x2c, 0x63, 0x81, 0x4a, 0x62, 0x46, 0x21,
-  0x19, 0xc2, 0x44, 0x80, 0x73, 0xa9, 0x02, 0xc0, 0x22, 0x34, 0x41, 0x20,
-  0x28, 0x02, 0x59, 0x08, 0x46, 0x02, 0x8f, 0x44, 0x41, 0x84, 0x12, 0x46,
-  0x08, 0x46, 0xf4, 0xbb, 0x9d, 0x10, 0x04, 0x21, 0x28, 0x24, 0x20, 0x82,
-  0x92, 0x18, 0x1a, 0x04, 0x10, 0x02, 0x18, 0x12, 0x24, 0x80, 0x21, 0x42,
-  0x05, 0x50, 0x21, 0x4c, 0x92, 0x41, 0x54, 0x24, 0x80, 0xa4, 0x24, 0x00,
-  0x20, 0x41, 0x02, 0x14, 0x12, 0x00, 0x80, 0xe2, 0x12, 0x48, 0x44, 0x11,
-  0x91, 0x82, 0x00, 0x32, 0xa8, 0x20, 0x54, 0x84, 0x4a, 0x2a, 0x18, 0x41,
-  0xf1, 0x21, 0x6c, 0x00, 0x42, 0x16, 0x14, 0x22, 0xa2, 0x12, 0x16, 0x01,
-  0x13, 0xc5, 0x24, 0x11, 0x2b, 0x42, 0x00, 0x00, 0x24, 0x28, 0x49, 0x82,
-  0x14, 0x94, 0x24, 0x20, 0x91, 0x24, 0x31, 0x20, 0x91, 0x32, 0x40, 0x02,
-  0x28, 0x28, 0x22, 0x28, 0x42, 0x28, 0x56, 0xc2, 0x12, 0x22, 0x10, 0x02,
-  0x22, 0xc8, 0x48, 0x40, 0x04, 0x60, 0x28, 0x82, 0x10, 0x28, 0x2a, 0x08,
-  0x14, 0xef, 0xff, 0x0b, 0x38, 0x12, 0x90, 0x24, 0x12, 0x20, 0x02, 0x90,
-  0x42, 0x00, 0x52, 0x21, 0x10, 0x02, 0x48, 0x20, 0x02, 0x18, 0x1c, 0x02,
-  0xa0, 0x42, 0x68, 0x46, 0x11, 0x01, 0x00, 0x18, 0x00, 0x12, 0x44, 0x20,
-  0x02, 0x18, 0x00, 0x10, 0x02, 0x29, 0x08, 0x00, 0x22, 0x00, 0x89, 0x1a,
-  0x02, 0x48, 0x2a, 0x88, 0xf2, 0x91, 0x2a, 0x00, 0x22, 0x41, 0x00, 0xc0,
-  0x41, 0x22, 0x00, 0x00, 0x00, 0x90, 0x22, 0x12, 0x00, 0x21, 0x00, 0x40,
-  0x04, 0x30, 0x51, 0x28, 0x00, 0x18, 0x11, 0x24, 0x12, 0x10, 0x22, 0x12,
-  0x12, 0x14, 0x12, 0x02, 0x28, 0x42, 0x40, 0x92, 0x21, 0x8a, 0x02, 0x00,
-  0x00, 0x24, 0x22, 0x00, 0xc0, 0x41, 0x5f, 0x96, 0x01, 0x00, 0x12, 0x18,
-  0x11, 0x20, 0x01, 0x00, 0x13, 0x84, 0x11, 0x85, 0x92, 0x12, 0x20, 0x04,
-  0x4a, 0x01, 0x14, 0xa0, 0x12, 0x22, 0x00, 0x26, 0x02, 0x28, 0x22, 0x24,
-  0x18, 0x54, 0x11, 0x18, 0x28, 0x12, 0x00, 0x00, 0x32, 0x00, 0x11, 0x00,
-  0x00, 0x88, 0x41, 0x28, 0x22, 0x00, 0x28, 0x28, 0x00, 0x8f, 0xa4, 0x0f,
-  0x11, 0x22, 0x11, 0x22, 0x10, 0x42, 0x82, 0x01, 0x42, 0x10, 0x02, 0x20,
-  0x02, 0x11, 0x42, 0x40, 0x01, 0x14, 0x00, 0x50, 0x12, 0xc0, 0x51, 0x00,
-  0x28, 0x00, 0x90, 0x11, 0x18, 0x81, 0x81, 0x12, 0x18, 0x00, 0x21, 0x24,
-  0x22, 0x90, 0x81, 0x45, 0x02, 0x22, 0x8a, 0x82, 0x88, 0xc8, 0x68, 0x43,
-  0x88, 0xa8, 0x2c, 0x2a, 0x08, 0x7f, 0x59, 0x0e, 0x28, 0x80, 0x82, 0x84,
-  0x02, 0x22, 0x28, 0x1c, 0x11, 0x22, 0x01, 0xf0, 0x12, 0x24, 0x11, 0x40,
-  0x92, 0x24, 0x22, 0xc0, 0x12, 0x41, 0x21, 0x22, 0x62, 0x00, 0x22, 0x10,
-  0x02, 0x22, 0x22, 0x28, 0x81, 0x84, 0x00, 0x42, 0x40, 0x01, 0x54, 0x00,
-  0x40, 0x44, 0x11, 0x01, 0x21, 0x46, 0x02, 0x00, 0x42, 0x00, 0x4c, 0xb4,
-  0x54, 0x08, 0x12, 0x00, 0x41, 0x18, 0x22, 0x00, 0x00, 0x20, 0x24, 0x81,
-  0x22, 0xa1, 0x21, 0x38, 0x50, 0x41, 0x48, 0x44, 0x32, 0x5c, 0x01, 0x44,
-  0x48, 0x00, 0x00, 0x4c, 0x01, 0x14, 0x60, 0x42, 0x84, 0x12, 0x32, 0x00,
-  0x12, 0x20, 0x02, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x24,
-  0xf2, 0x91, 0x58, 0x00, 0x82, 0x28, 0x40, 0x11, 0x42, 0x02, 0x48, 0x20,
-  0x04, 0x41, 0xc0, 0x21, 0x80, 0x04, 0x52, 0x40, 0x41, 0x01, 0x84, 0x11,
-  0x32, 0x3c, 0x41, 0x48, 0x01, 0x1c, 0x82, 0x41, 0x32, 0x11, 0x10, 0x02,
-  0x21, 0x22, 0x10, 0x04, 0x80, 0x02, 0x41, 0x70, 0x81, 0x06, 0x22, 0x23,
-  0x48, 0x91, 0x24, 0x13, 0xe8, 0x98, 0x02, 0x40, 0x11, 0xf8, 0x24, 0x12,
-  0x50, 0xa1, 0x90, 0x41, 0x18, 0x88, 0x12, 0x20, 0x01, 0x00, 0x4c, 0x31,
-  0x21, 0x28, 0x80, 0x81, 0x82, 0x01, 0x54, 0x21, 0x50, 0x62, 0xa0, 0x14,
-  0x80, 0x08, 0x24, 0x28, 0x80, 0x62, 0x11, 0x00, 0x84, 0x13, 0xa2, 0x41,
-  0x14, 0x00, 0x32, 0x00, 0x41, 0x40, 0x04, 0x28, 0x00, 0x22, 0x00, 0x90,
-  0x41, 0x90, 0x42, 0xf0, 0xc4, 0x99, 0x10, 0xa1, 0x28, 0x47, 0x12, 0x69,
-  0x93, 0x81, 0x22, 0x2a, 0x84, 0xb1, 0x11, 0x94, 0x44, 0x58, 0x2a, 0xc4,
-  0x12, 0x41, 0x17, 0x12, 0x28, 0x12, 0x22, 0x4c, 0xf4, 0x44, 0x61, 0x35,
-  0x77, 0x21, 0x25, 0xa1, 0x22, 0x64, 0x1d, 0x41, 0x14, 0x3d, 0x39, 0x35,
-  0xa3, 0x22, 0x26, 0xc2, 0x31, 0x45, 0x82, 0x22, 0xb2, 0x12, 0xd3, 0x29,
-  0x84, 0x91, 0x14, 0x21, 0x35, 0xc4, 0x22, 0x22, 0x48, 0x28, 0x86, 0xb2,
-  0x81, 0xf4, 0x84, 0x21, 0x11, 0x24, 0xd0, 0x21, 0x02, 0x17, 0x82, 0x33,
-  0x32, 0x61, 0x4a, 0xe6, 0x12, 0x92, 0x24, 0xff, 0x6b, 0x0f, 0x3e, 0x31,
-  0xaa, 0x81, 0x23, 0xe1, 0x12, 0x12, 0xe2, 0x21, 0x21, 0x43, 0x32, 0x42,
-  0x15, 0x23, 0x21, 0x82, 0x81, 0x81, 0xe1, 0x32, 0xb1, 0x46, 0xa4, 0x22,
-  0x21, 0x18, 0x4b, 0x11, 0x1f, 0x52, 0xd1, 0x82, 0xe1, 0x16, 0x22, 0xe2,
-  0x25, 0xa7, 0x47, 0x28, 0x80, 0x22, 0x23, 0xf2, 0x22, 0x11, 0x16, 0x26,
-  0xa2, 0x21, 0x8b, 0x22, 0x68, 0x2c, 0x21, 0x23, 0x12, 0x22, 0x62, 0x52,
-  0x48, 0x2b, 0x82, 0x11, 0x21, 0x30, 0x22, 0xea, 0x98, 0xa6, 0x24, 0x84,
-  0x8a, 0x3c, 0xa4, 0x86, 0xe1, 0x84, 0xf4, 0x79, 0x8a, 0x40, 0x82, 0x74,
-  0x11, 0x64, 0x46, 0x1e, 0x12, 0x1a, 0xd3, 0x11, 0x92, 0x22, 0x4e, 0x11,
-  0x22, 0x42, 0x2b, 0x14, 0x5f, 0x51, 0x54, 0x22, 0x1e, 0x22, 0x23, 0xa3,
-  0x64, 0x1a, 0xf2, 0x54, 0x11, 0x11, 0x41, 0x28, 0x49, 0x42, 0x94, 0x44,
-  0x2b, 0x34, 0x13, 0x02, 0x2a, 0x11, 0xe2, 0x51, 0x11, 0xa2, 0x31, 0x13,
-  0x91, 0x39, 0xb0, 0x24, 0x31, 0x12, 0x17, 0x27, 0x12, 0x18, 0x1a, 0xd1,
-  0x41, 0x42, 0x12, 0x32, 0x44, 0x14, 0x6c, 0x48, 0xa4, 0x2a, 0x8e, 0xa4,
-  0x20, 0xba, 0xc8, 0xba, 0x8c, 0x8a, 0x82, 0xa8, 0xc4, 0x22, 0xab, 0x62,
-  0x10, 0xa1, 0x12, 0x11, 0x22, 0x11, 0x23, 0x12, 0x31, 0x22, 0x19, 0x14,
-  0x12, 0x11, 0x12, 0x11, 0x02, 0x29, 0xa2, 0x41, 0x2d, 0x24, 0x50, 0x42,
-  0x11, 0x28, 0x80, 0x42, 0x82, 0xd2, 0x21, 0x81, 0x52, 0x21, 0x28, 0x24,
-  0x40, 0x02, 0x24, 0x40, 0x02, 0x24, 0x10, 0x02, 0x21, 0x30, 0x22, 0x50,
-  0x12, 0x82, 0x21, 0x10, 0x02, 0x21, 0x82, 0x29, 0x02, 0x42, 0x82, 0x70,
-  0x2b, 0x02, 0x17, 0x31, 0x3f, 0x13, 0x72, 0x11, 0xb1, 0x21, 0xd2, 0x31,
-  0xd2, 0x33, 0xf3, 0x33, 0x23, 0x3f, 0x22, 0x72, 0x41, 0xf3, 0x13, 0x13,
-  0x3f, 0x34, 0xf4, 0x53, 0x12, 0x17, 0x31, 0x7f, 0x71, 0xf1, 0x13, 0x13,
-  0x3f, 0x32, 0xf2, 0x62, 0x22, 0x6f, 0x63, 0xf1, 0x43, 0x41, 0x47, 0x44,
-  0x1b, 0x11, 0x2e, 0x25, 0x3e, 0x21, 0xc7, 0xc2, 0x7f, 0x74, 0xf4, 0x62,
-  0x62, 0x3f, 0x23, 0xf7, 0x4a, 0x4a, 0x3f, 0x23, 0xf1, 0x13, 0x11, 0x67,
-  0x62, 0x2f, 0x22, 0xf2, 0x32, 0x22, 0x2b, 0x32, 0x7f, 0x72, 0xf2, 0x32,
-  0x22, 0x2f, 0x23, 0xf3, 0x3b, 0x3b, 0x3f, 0x32, 0x56, 0x22, 0x65, 0x56,
-  0x31, 0x75, 0xd7, 0x22, 0xd2, 0x77, 0xf2, 0x43, 0x43, 0x3f, 0x14, 0xf4,
-  0x83, 0x82, 0x25, 0x52, 0x33, 0x2b, 0x88, 0x3f, 0x2e, 0x5c, 0x66, 0x3f,
-  0xac, 0xdc, 0xe7, 0xb8, 0x83, 0x5e, 0x44, 0x19, 0xf8, 0x2c, 0x2f, 0xbf,
-  0x11, 0x41, 0xf1, 0x11, 0x33, 0x2d, 0x59, 0x1d, 0x11, 0x1d, 0x21, 0x15,
-  0xf3, 0x12, 0x31, 0x3f, 0x32, 0xf2, 0x23, 0x23, 0x35, 0xf3, 0x52, 0x51,
-  0x3f, 0x74, 0xf4, 0x53, 0x53, 0x3d, 0x37, 0x65, 0x55, 0x33, 0x3f, 0x12,
-  0xf2, 0x22, 0x22, 0x6f, 0x45, 0xf7, 0x43, 0x63, 0x7f, 0x14, 0xf4, 0x11,
-  0x13, 0x3f, 0x52, 0xb2, 0x21, 0xf3, 0x1c, 0x3a, 0x7f, 0x34, 0xf6, 0xe3,
-  0xe3, 0x1f, 0x36, 0xf6, 0x7b, 0xcb, 0x1f, 0x33, 0xf1, 0x33, 0x33, 0x65,
-  0xf6, 0x22, 0x23, 0x24, 0x2f, 0x22, 0xf2, 0x2f, 0x2f, 0x2f, 0x23, 0xe2,
-  0x23, 0x76, 0x3b, 0xdb, 0x31, 0x56, 0x22, 0x65, 0x56, 0x33, 0x75, 0xd5,
-  0x22, 0xd2, 0x77, 0xf2, 0x41, 0x47, 0x3f, 0x34, 0xdc, 0x22, 0x52, 0x22,
-  0x15, 0xf3, 0xa2, 0xa2, 0x2f, 0x2c, 0xdc, 0x66, 0xf8, 0x48, 0x4a, 0x6f,
-  0xc8, 0xf8, 0xa3, 0x82, 0x6f, 0x4c, 0xa6, 0x6a, 0xef, 0xf7, 0xf7, 0xfe,
-  0xa9, 0xf0, 0x11, 0x13, 0x2f, 0x12, 0x56, 0x55, 0x2e, 0x24, 0x1d, 0x23,
-  0x2d, 0x31, 0x3f, 0x33, 0xb2, 0x22, 0x72, 0x41, 0xf3, 0x52, 0x51, 0x3f,
-  0x74, 0xb4, 0x52, 0xf5, 0x11, 0x23, 0x7f, 0x51, 0x51, 0x33, 0x3f, 0x12,
-  0xf2, 0x62, 0x22, 0x6f, 0x47, 0xf4, 0x43, 0x57, 0x6f, 0x44, 0xf4, 0x15,
-  0x14, 0x6f, 0x43, 0xa2, 0x22, 0x8f, 0x82, 0xf1, 0x41, 0x43, 0x2f, 0x26,
-  0xfe, 0x71, 0x72, 0xaf, 0xa4, 0x76, 0x21, 0xf2, 0x23, 0x21, 0x47, 0x62,
-  0x2f, 0x32, 0xc2, 0x22, 0x23, 0xf2, 0x35, 0x3f, 0x27, 0x22, 0x3e, 0x72,
-  0xbf, 0xb3, 0xf3, 0x21, 0x23, 0x25, 0x52, 0x46, 0x15, 0x53, 0x57, 0x27,
-  0x22, 0x6d, 0x26, 0x64, 0x2f, 0x18, 0xfc, 0x81, 0xa2, 0x25, 0x52, 0x31,
-  0x2b, 0x88, 0x6e, 0xc3, 0x6f, 0x68, 0xf8, 0xc1, 0xca, 0xef, 0xc8, 0xba,
-  0x82, 0xfc, 0xa6, 0x24, 0xca, 0xfc, 0x2c, 0x3c, 0x7f, 0x55, 0x0f, 0x1f,
-  0x31, 0xb3, 0x3a, 0xf3, 0x31, 0x35, 0x1f, 0x41, 0x72, 0x21, 0xb3, 0x32,
-  0xf3, 0x21, 0x23, 0x37, 0x22, 0x1d, 0x13, 0x2b, 0x55, 0x1f, 0x34, 0xf4,
-  0x53, 0x52, 0x57, 0x31, 0x65, 0xf5, 0x11, 0x13, 0x3d, 0x31, 0x2e, 0x22,
-  0x6f, 0x47, 0xf6, 0x65, 0x77, 0x7f, 0x34, 0xb4, 0x16, 0xd1, 0x53, 0xb3,
-  0x21, 0xf2, 0x28, 0x38, 0x3f, 0x36, 0xf6, 0x43, 0xa1, 0x7e, 0x72, 0xbf,
-  0x9f, 0x66, 0x22, 0x3f, 0x12, 0x72, 0x16, 0xb6, 0x22, 0x62, 0x23, 0x29,
-  0xf3, 0x17, 0x1f, 0x2b, 0x31, 0x16, 0xf2, 0x2b, 0x39, 0x17, 0x35, 0x25,
-  0x52, 0x66, 0x17, 0x31, 0x7d, 0x25, 0x26, 0xd2, 0x46, 0x42, 0xd2, 0x12,
-  0x5c, 0x22, 0x21, 0x15, 0xb3, 0xa2, 0xfa, 0xe2, 0xe2, 0x6f, 0x42, 0xf8,
-  0x48, 0x4a, 0xff, 0xca, 0xa8, 0xcc, 0x6f, 0x4c, 0xe6, 0x2a, 0xf6, 0x6c,
-  0x7f, 0x87, 0x25, 0x00, 0x20, 0x02, 0x00, 0x18, 0x00, 0x00, 0x00, 0x12,
-  0x00, 0x20, 0x01, 0x48, 0x20, 0x41, 0x04, 0x4a, 0x02, 0x42, 0x18, 0x00,
-  0xa0, 0x12, 0xa0, 0x12, 0x20, 0x02, 0x22, 0x00, 0x00, 0x20, 0x02, 0x00,
-  0x00, 0x20, 0x08, 0x10, 0x28, 0x08, 0x80, 0x02, 0x1f, 0x27, 0x0d, 0x8a,
-  0xa1, 0x21, 0x00, 0x18, 0x28, 0x22, 0x12, 0x42, 0x20, 0x04, 0x18, 0x00,
-  0x32, 0x42, 0xe0, 0x24, 0x02, 0x14, 0x13, 0x02, 0x41, 0x30, 0x21, 0x30,
-  0x21, 0x00, 0x28, 0x00, 0x20, 0x01, 0x12, 0x20, 0x01, 0x12, 0x22, 0x00,
-  0x00, 0xc0, 0x81, 0x00, 0x80, 0x22, 0x82, 0x08, 0x28, 0x48, 0x4a, 0x08,
-  0xcf, 0x86, 0x07, 0x2e, 0x42, 0x1f, 0x41, 0xf2, 0x28, 0x12, 0x1f, 0x41,
-  0x32, 0x6a, 0x1f, 0x41, 0xb2, 0x6a, 0xd1, 0x41, 0xb6, 0x6e, 0xd1, 0x41,
+  0x66, 0x00, 0x82, 0xad, 0x09, 0x13, 0x40, 0xab, 0x0a, 0x73, 0x80, 0x08,
+  0x42, 0x00, 0x00, 0x00, 0x84, 0xcb, 0x09, 0x10, 0x12, 0x3b, 0x0e, 0xf0,
+  0xff, 0x13, 0xf0, 0x9e, 0xf5, 0x80, 0x04, 0x18, 0x27, 0x12, 0x11, 0x33,
+  0xa7, 0x14, 0x14, 0x23, 0x44, 0x88, 0x91, 0x11, 0x20, 0x41, 0x01, 0x1c,
+  0x52, 0x21, 0x12, 0x40, 0x21, 0x05, 0x1c, 0xc4, 0x24, 0x91, 0x1a, 0x02,
+  0x40, 0x02, 0x24, 0x1a, 0x42, 0x62, 0x11, 0x42, 0x25, 0x62, 0x12, 0x21,
+  0x21, 0x4c, 0xa1, 0x42, 0x5a, 0x02, 0x44, 0x86, 0x31, 0x42, 0x8a, 0x24,
+  0x61, 0x14, 0xa0, 0x41, 0x00, 0x29, 0x02, 0xa8, 0x28, 0x2e, 0x48, 0xc7,
+  0x5d, 0x00, 0x82, 0x20, 0x21, 0x43, 0x12, 0x31, 0x32, 0x93, 0x72, 0x21,
+  0x82, 0x24, 0x34, 0x11, 0x15, 0x02, 0x1a, 0x2a, 0x04, 0xd0, 0x23, 0x23,
+  0x01, 0x22, 0x24, 0x11, 0x28, 0x25, 0x02, 0x29, 0xb1, 0x44, 0x21, 0x21,
+  0x82, 0x34, 0x14, 0x24, 0xa0, 0x12, 0x00, 0x60, 0x24, 0x10, 0x21, 0xb2,
+  0x22, 0x18, 0x92, 0x21, 0x14, 0x24, 0x8a, 0x01, 0x29, 0x92, 0x24, 0x83,
+  0xc2, 0x42, 0x4a, 0x89, 0x44, 0x01, 0x3f, 0x83, 0x0a, 0x20, 0x2c, 0x11,
+  0x51, 0x21, 0x2a, 0x75, 0x53, 0xd2, 0x21, 0x33, 0x41, 0x13, 0x92, 0x56,
+  0x11, 0x13, 0xc3, 0x13, 0x11, 0x8a, 0x62, 0x12, 0x34, 0x18, 0x2b, 0x21,
+  0x27, 0x21, 0x1a, 0x24, 0x72, 0x51, 0x12, 0xf1, 0x88, 0x21, 0x26, 0x02,
+  0x29, 0x01, 0x12, 0x19, 0xa2, 0x42, 0x18, 0x85, 0xc1, 0x42, 0x4e, 0x32,
+  0x24, 0x00, 0x43, 0x91, 0x62, 0x13, 0x04, 0x6b, 0x82, 0x49, 0xc8, 0x61,
+  0x2a, 0x8c, 0xa1, 0x81, 0xa0, 0x16, 0x49, 0x52, 0x28, 0xd0, 0x22, 0x08,
+  0xb0, 0x58, 0xf2, 0x57, 0x7f, 0x80, 0x04, 0x24, 0x1a, 0xa2, 0x12, 0x11,
+  0x00, 0x83, 0x42, 0x08, 0x1a, 0x04, 0x00, 0x12, 0x42, 0x00, 0x11, 0x14,
+  0x00, 0xc0, 0x24, 0x24, 0x12, 0x00, 0x4d, 0x52, 0x40, 0x22, 0x51, 0x24,
+  0x12, 0x21, 0x60, 0x12, 0x10, 0x82, 0x04, 0x1a, 0x22, 0x02, 0x25, 0x03,
+  0x14, 0x70, 0x42, 0x01, 0x21, 0x80, 0xa2, 0x42, 0x4a, 0xa1, 0x4a, 0x28,
+  0xf0, 0x86, 0x1f, 0x20, 0x02, 0x2d, 0x11, 0x60, 0x22, 0x00, 0x12, 0x26,
+  0x02, 0x18, 0x13, 0x37, 0x02, 0x20, 0x13, 0x52, 0x38, 0x01, 0xf0, 0xff,
+  0xff, 0x7f, 0x23, 0x02, 0x18, 0x42, 0x00, 0x2a, 0x25, 0x34, 0x22, 0x00,
+  0xd0, 0x22, 0x01, 0x41, 0x28, 0x22, 0x40, 0x01, 0x00, 0x00, 0x24, 0xc0,
+  0x24, 0x80, 0x2a, 0x02, 0x48, 0x2f, 0xe8, 0x02, 0x1c, 0x21, 0xc3, 0x24,
+  0x11, 0x16, 0x91, 0x11, 0x2e, 0x57, 0x19, 0x12, 0x22, 0xc6, 0x21, 0x25,
+  0x52, 0x21, 0x4a, 0x41, 0x91, 0x12, 0x2e, 0x41, 0x33, 0x21, 0x92, 0x52,
+  0x62, 0x76, 0x81, 0x02, 0x46, 0x06, 0x12, 0x19, 0xb5, 0x1b, 0x34, 0x22,
+  0x28, 0x23, 0x81, 0x52, 0x42, 0x00, 0x2d, 0x23, 0x16, 0x81, 0x11, 0x84,
+  0x51, 0x21, 0x40, 0x22, 0x88, 0x3a, 0x23, 0x27, 0x28, 0x82, 0x82, 0x11,
+  0x28, 0x28, 0x23, 0x58, 0x22, 0x80, 0xa4, 0x68, 0x82, 0x93, 0x0d, 0x38,
+  0x16, 0xc2, 0x21, 0x11, 0x19, 0x12, 0x02, 0xd0, 0x22, 0x22, 0xe2, 0x22,
+  0x41, 0x11, 0x02, 0x11, 0x12, 0x20, 0x21, 0x72, 0x42, 0x91, 0x42, 0x14,
+  0x22, 0xc0, 0x46, 0x80, 0x31, 0x22, 0x56, 0x82, 0x41, 0x22, 0x61, 0x22,
+  0x1e, 0x44, 0x42, 0x10, 0x32, 0x11, 0x24, 0x43, 0x11, 0x42, 0x04, 0x22,
+  0x21, 0x2c, 0x82, 0x42, 0x82, 0x88, 0x48, 0x41, 0x22, 0x72, 0x22, 0x14,
+  0xa2, 0x82, 0x62, 0x48, 0x48, 0xaf, 0x6f, 0x0e, 0x11, 0x28, 0x16, 0x04,
+  0x18, 0x1c, 0xe1, 0x76, 0xe1, 0x11, 0x02, 0x48, 0x14, 0x18, 0x11, 0x2b,
+  0x41, 0x24, 0xb0, 0x41, 0x52, 0x12, 0x20, 0x33, 0x24, 0x4a, 0x03, 0x00,
+  0x00, 0x17, 0x25, 0x94, 0x28, 0x4a, 0x02, 0x20, 0x02, 0x29, 0x62, 0x32,
+  0x20, 0x01, 0x18, 0x15, 0x82, 0x02, 0x88, 0x19, 0x48, 0x83, 0x08, 0x00,
+  0x28, 0x80, 0x48, 0x02, 0x80, 0x8a, 0xf8, 0x54, 0x25, 0x00, 0x42, 0x00,
+  0x20, 0x02, 0x80, 0x06, 0x41, 0x10, 0x32, 0x22, 0x43, 0x01, 0x00, 0x4c,
+  0x22, 0x11, 0x84, 0x42, 0x01, 0x28, 0x90, 0x14, 0x22, 0x31, 0x68, 0x21,
+  0x19, 0x04, 0x80, 0x83, 0x84, 0x04, 0x8b, 0x38, 0x00, 0x24, 0xc0, 0x21,
+  0x10, 0x04, 0x22, 0x00, 0x00, 0x83, 0x04, 0x1c, 0x12, 0x02, 0x00, 0x9f,
+  0x88, 0x07, 0x45, 0x62, 0x24, 0xc0, 0x32, 0x00, 0x4c, 0x04, 0x84, 0x18,
+  0x41, 0x11, 0x30, 0x28, 0xe0, 0x12, 0x01, 0x25, 0x22, 0x01, 0x35, 0x02,
+  0x20, 0x11, 0x24, 0x14, 0x21, 0x01, 0xb0, 0x18, 0x12, 0x31, 0x44, 0x10,
+  0x49, 0x04, 0x1b, 0x25, 0x14, 0x00, 0x28, 0x11, 0x88, 0x44, 0x51, 0x11,
+  0x22, 0x43, 0x08, 0x18, 0x2b, 0x82, 0xc0, 0x44, 0x45, 0x78, 0x84, 0x31,
+  0x88, 0x40, 0xf6, 0x56, 0x95, 0x20, 0x05, 0x50, 0x14, 0x24, 0x80, 0x63,
+  0x22, 0x13, 0x21, 0x84, 0x21, 0x02, 0x40, 0x41, 0x82, 0x54, 0x14, 0x80,
+  0x02, 0x12, 0x48, 0x34, 0xc0, 0x21, 0x00, 0x48, 0x18, 0x42, 0x28, 0x26,
+  0x02, 0x40, 0x02, 0x40, 0x02, 0x00, 0x2c, 0x12, 0x04, 0x88, 0x22, 0x29,
+  0x18, 0x01, 0x62, 0x90, 0x14, 0x40, 0xe1, 0x12, 0x04, 0x20, 0x74, 0xa3,
+  0x41, 0xa1, 0x41, 0x21, 0xd0, 0x25, 0x01, 0x28, 0x1e, 0x44, 0xd0, 0x12,
+  0x06, 0x18, 0x1c, 0x42, 0x12, 0x18, 0x65, 0x32, 0x48, 0x74, 0x26, 0x64,
+  0x21, 0xa0, 0x21, 0x1c, 0x04, 0x80, 0x82, 0x81, 0x33, 0x41, 0x2c, 0x63,
+  0x81, 0x4a, 0x62, 0x46, 0x21, 0x19, 0xc2, 0x44, 0x80, 0x73, 0xa9, 0x02,
+  0xc0, 0x22, 0x34, 0x41, 0x20, 0x28, 0x02, 0x59, 0x08, 0x46, 0x02, 0x8f,
+  0x44, 0x41, 0x84, 0x12, 0x46, 0x08, 0x46, 0xf4, 0xbb, 0x9d, 0x10, 0x04,
+  0x21, 0x28, 0x24, 0x20, 0x82, 0x92, 0x18, 0x1a, 0x04, 0x10, 0x02, 0x18,
+  0x12, 0x24, 0x80, 0x21, 0x42, 0x05, 0x50, 0x21, 0x4c, 0x92, 0x41, 0x54,
+  0x24, 0x80, 0xa4, 0x24, 0x00, 0x20, 0x41, 0x02, 0x14, 0x12, 0x00, 0x80,
+  0xe2, 0x12, 0x48, 0x44, 0x11, 0x91, 0x82, 0x00, 0x32, 0xa8, 0x20, 0x54,
+  0x84, 0x4a, 0x2a, 0x18, 0x41, 0xf1, 0x21, 0x6c, 0x00, 0x42, 0x16, 0x14,
+  0x22, 0xa2, 0x12, 0x16, 0x01, 0x13, 0xc5, 0x24, 0x11, 0x2b, 0x42, 0x00,
+  0x00, 0x24, 0x28, 0x49, 0x82, 0x14, 0x94, 0x24, 0x20, 0x91, 0x24, 0x31,
+  0x20, 0x91, 0x32, 0x40, 0x02, 0x28, 0x28, 0x22, 0x28, 0x42, 0x28, 0x56,
+  0xc2, 0x12, 0x22, 0x10, 0x02, 0x22, 0xc8, 0x48, 0x40, 0x04, 0x60, 0x28,
+  0x82, 0x10, 0x28, 0x2a, 0x08, 0x14, 0xef, 0xff, 0x0b, 0x38, 0x12, 0x90,
+  0x24, 0x12, 0x20, 0x02, 0x90, 0x42, 0x00, 0x52, 0x21, 0x10, 0x02, 0x48,
+  0x20, 0x02, 0x18, 0x1c, 0x02, 0xa0, 0x42, 0x68, 0x46, 0x11, 0x01, 0x00,
+  0x18, 0x00, 0x12, 0x44, 0x20, 0x02, 0x18, 0x00, 0x10, 0x02, 0x29, 0x08,
+  0x00, 0x22, 0x00, 0x89, 0x1a, 0x02, 0x48, 0x2a, 0x88, 0xf2, 0x91, 0x2a,
+  0x00, 0x22, 0x41, 0x00, 0xc0, 0x41, 0x0a, 0x0b, 0xf0, 0x19, 0x90, 0x22,
+  0x12, 0x00, 0x21, 0x00, 0x40, 0x04, 0x30, 0x51, 0x28, 0x00, 0x18, 0x11,
+  0x24, 0x12, 0x10, 0x22, 0x12, 0x12, 0x14, 0x12, 0x02, 0x28, 0x42, 0x40,
+  0x92, 0x21, 0x8a, 0x02, 0x00, 0x00, 0x24, 0x22, 0x00, 0xc0, 0x41, 0x5f,
+  0x96, 0x01, 0xe4, 0x0c, 0xf0, 0x72, 0x20, 0x01, 0x00, 0x13, 0x84, 0x11,
+  0x85, 0x92, 0x12, 0x20, 0x04, 0x4a, 0x01, 0x14, 0xa0, 0x12, 0x22, 0x00,
+  0x26, 0x02, 0x28, 0x22, 0x24, 0x18, 0x54, 0x11, 0x18, 0x28, 0x12, 0x00,
+  0x00, 0x32, 0x00, 0x11, 0x00, 0x00, 0x88, 0x41, 0x28, 0x22, 0x00, 0x28,
+  0x28, 0x00, 0x8f, 0xa4, 0x0f, 0x11, 0x22, 0x11, 0x22, 0x10, 0x42, 0x82,
+  0x01, 0x42, 0x10, 0x02, 0x20, 0x02, 0x11, 0x42, 0x40, 0x01, 0x14, 0x00,
+  0x50, 0x12, 0xc0, 0x51, 0x00, 0x28, 0x00, 0x90, 0x11, 0x18, 0x81, 0x81,
+  0x12, 0x18, 0x00, 0x21, 0x24, 0x22, 0x90, 0x81, 0x45, 0x02, 0x22, 0x8a,
+  0x82, 0x88, 0xc8, 0x68, 0x43, 0x88, 0xa8, 0x2c, 0x2a, 0x08, 0x7f, 0x59,
+  0x0e, 0x28, 0x80, 0x82, 0x84, 0x02, 0x22, 0x28, 0x1c, 0x11, 0x22, 0x01,
+  0xf0, 0x12, 0x24, 0x11, 0x40, 0x92, 0x24, 0x22, 0xc0, 0x12, 0x41, 0x21,
+  0x22, 0x62, 0x00, 0xfd, 0x00, 0xf1, 0x2f, 0x22, 0x28, 0x81, 0x84, 0x00,
+  0x42, 0x40, 0x01, 0x54, 0x00, 0x40, 0x44, 0x11, 0x01, 0x21, 0x46, 0x02,
+  0x00, 0x42, 0x00, 0x4c, 0xb4, 0x54, 0x08, 0x12, 0x00, 0x41, 0x18, 0x22,
+  0x00, 0x00, 0x20, 0x24, 0x81, 0x22, 0xa1, 0x21, 0x38, 0x50, 0x41, 0x48,
+  0x44, 0x32, 0x5c, 0x01, 0x44, 0x48, 0x00, 0x00, 0x4c, 0x01, 0x14, 0x60,
+  0x42, 0x84, 0x12, 0x32, 0x00, 0x12, 0x20, 0x02, 0x20, 0xc4, 0x04, 0xf0,
+  0xff, 0x8c, 0x40, 0x84, 0x24, 0xf2, 0x91, 0x58, 0x00, 0x82, 0x28, 0x40,
+  0x11, 0x42, 0x02, 0x48, 0x20, 0x04, 0x41, 0xc0, 0x21, 0x80, 0x04, 0x52,
+  0x40, 0x41, 0x01, 0x84, 0x11, 0x32, 0x3c, 0x41, 0x48, 0x01, 0x1c, 0x82,
+  0x41, 0x32, 0x11, 0x10, 0x02, 0x21, 0x22, 0x10, 0x04, 0x80, 0x02, 0x41,
+  0x70, 0x81, 0x06, 0x22, 0x23, 0x48, 0x91, 0x24, 0x13, 0xe8, 0x98, 0x02,
+  0x40, 0x11, 0xf8, 0x24, 0x12, 0x50, 0xa1, 0x90, 0x41, 0x18, 0x88, 0x12,
+  0x20, 0x01, 0x00, 0x4c, 0x31, 0x21, 0x28, 0x80, 0x81, 0x82, 0x01, 0x54,
+  0x21, 0x50, 0x62, 0xa0, 0x14, 0x80, 0x08, 0x24, 0x28, 0x80, 0x62, 0x11,
+  0x00, 0x84, 0x13, 0xa2, 0x41, 0x14, 0x00, 0x32, 0x00, 0x41, 0x40, 0x04,
+  0x28, 0x00, 0x22, 0x00, 0x90, 0x41, 0x90, 0x42, 0xf0, 0xc4, 0x99, 0x10,
+  0xa1, 0x28, 0x47, 0x12, 0x69, 0x93, 0x81, 0x22, 0x2a, 0x84, 0xb1, 0x11,
+  0x94, 0x44, 0x58, 0x2a, 0xc4, 0x12, 0x41, 0x17, 0x12, 0x28, 0x12, 0x22,
+  0x4c, 0xf4, 0x44, 0x61, 0x35, 0x77, 0x21, 0x25, 0xa1, 0x22, 0x64, 0x1d,
+  0x41, 0x14, 0x3d, 0x39, 0x35, 0xa3, 0x22, 0x26, 0xc2, 0x31, 0x45, 0x82,
+  0x22, 0xb2, 0x12, 0xd3, 0x29, 0x84, 0x91, 0x14, 0x21, 0x35, 0xc4, 0x22,
+  0x22, 0x48, 0x28, 0x86, 0xb2, 0x81, 0xf4, 0x84, 0x21, 0x11, 0x24, 0xd0,
+  0x21, 0x02, 0x17, 0x82, 0x33, 0x32, 0x61, 0x4a, 0xe6, 0x12, 0x92, 0x24,
+  0xff, 0x6b, 0x0f, 0x3e, 0x31, 0xaa, 0x81, 0x23, 0xe1, 0x12, 0x12, 0xe2,
+  0x21, 0x21, 0x43, 0x32, 0x42, 0x15, 0x23, 0x21, 0x82, 0x81, 0x81, 0xe1,
+  0x32, 0xb1, 0x46, 0xa4, 0x22, 0x21, 0x18, 0x4b, 0x11, 0x1f, 0x52, 0xd1,
+  0x82, 0xe1, 0x16, 0x22, 0xe2, 0x25, 0xa7, 0x47, 0x28, 0x80, 0x22, 0x23,
+  0xf2, 0x22, 0x11, 0x16, 0x26, 0xa2, 0x21, 0x8b, 0x22, 0x68, 0x2c, 0x21,
+  0x23, 0x12, 0x22, 0x62, 0x52, 0x48, 0x2b, 0x82, 0x11, 0x21, 0x30, 0x22,
+  0xea, 0x98, 0xa6, 0x24, 0x84, 0x8a, 0x3c, 0xa4, 0x86, 0xe1, 0x84, 0xf4,
+  0x79, 0x8a, 0x40, 0x82, 0x74, 0x11, 0x64, 0x46, 0x1e, 0x12, 0x1a, 0xd3,
+  0x11, 0x92, 0x22, 0x4e, 0x11, 0x22, 0x42, 0x2b, 0x14, 0x5f, 0x51, 0x54,
+  0x22, 0x1e, 0x22, 0x23, 0xa3, 0x64, 0x1a, 0xf2, 0x54, 0x11, 0x11, 0x41,
+  0x28, 0x49, 0x42, 0x94, 0x44, 0x2b, 0x34, 0x13, 0x02, 0x2a, 0x11, 0xe2,
+  0x51, 0x11, 0xa2, 0x31, 0x13, 0x91, 0x39, 0xb0, 0x24, 0x31, 0x12, 0x17,
+  0x27, 0x12, 0x18, 0x1a, 0xd1, 0x41, 0x42, 0x12, 0x32, 0x44, 0x14, 0x6c,
+  0x48, 0xa4, 0x2a, 0x8e, 0xa4, 0x20, 0xba, 0xc8, 0xba, 0x8c, 0x8a, 0x82,
+  0xa8, 0xc4, 0x22, 0xab, 0x62, 0x10, 0xa1, 0x12, 0x11, 0x22, 0x11, 0x23,
+  0x12, 0x31, 0x22, 0x19, 0x14, 0x12, 0x11, 0x12, 0x11, 0x02, 0x29, 0xa2,
+  0x41, 0x2d, 0x24, 0x50, 0x42, 0x11, 0x28, 0x80, 0x42, 0x82, 0xd2, 0x21,
+  0x81, 0x52, 0x21, 0x28, 0xde, 0x09, 0xf0, 0xe3, 0x40, 0x02, 0x24, 0x10,
+  0x02, 0x21, 0x30, 0x22, 0x50, 0x12, 0x82, 0x21, 0x10, 0x02, 0x21, 0x82,
+  0x29, 0x02, 0x42, 0x82, 0x70, 0x2b, 0x02, 0x17, 0x31, 0x3f, 0x13, 0x72,
+  0x11, 0xb1, 0x21, 0xd2, 0x31, 0xd2, 0x33, 0xf3, 0x33, 0x23, 0x3f, 0x22,
+  0x72, 0x41, 0xf3, 0x13, 0x13, 0x3f, 0x34, 0xf4, 0x53, 0x12, 0x17, 0x31,
+  0x7f, 0x71, 0xf1, 0x13, 0x13, 0x3f, 0x32, 0xf2, 0x62, 0x22, 0x6f, 0x63,
+  0xf1, 0x43, 0x41, 0x47, 0x44, 0x1b, 0x11, 0x2e, 0x25, 0x3e, 0x21, 0xc7,
+  0xc2, 0x7f, 0x74, 0xf4, 0x62, 0x62, 0x3f, 0x23, 0xf7, 0x4a, 0x4a, 0x3f,
+  0x23, 0xf1, 0x13, 0x11, 0x67, 0x62, 0x2f, 0x22, 0xf2, 0x32, 0x22, 0x2b,
+  0x32, 0x7f, 0x72, 0xf2, 0x32, 0x22, 0x2f, 0x23, 0xf3, 0x3b, 0x3b, 0x3f,
+  0x32, 0x56, 0x22, 0x65, 0x56, 0x31, 0x75, 0xd7, 0x22, 0xd2, 0x77, 0xf2,
+  0x43, 0x43, 0x3f, 0x14, 0xf4, 0x83, 0x82, 0x25, 0x52, 0x33, 0x2b, 0x88,
+  0x3f, 0x2e, 0x5c, 0x66, 0x3f, 0xac, 0xdc, 0xe7, 0xb8, 0x83, 0x5e, 0x44,
+  0x19, 0xf8, 0x2c, 0x2f, 0xbf, 0x11, 0x41, 0xf1, 0x11, 0x33, 0x2d, 0x59,
+  0x1d, 0x11, 0x1d, 0x21, 0x15, 0xf3, 0x12, 0x31, 0x3f, 0x32, 0xf2, 0x23,
+  0x23, 0x35, 0xf3, 0x52, 0x51, 0x3f, 0x74, 0xf4, 0x53, 0x53, 0x3d, 0x37,
+  0x65, 0x55, 0x33, 0x3f, 0x12, 0xf2, 0x22, 0x22, 0x6f, 0x45, 0xf7, 0x43,
+  0x63, 0x7f, 0x14, 0xf4, 0x11, 0x13, 0x3f, 0x52, 0xb2, 0x21, 0xf3, 0x1c,
+  0x3a, 0x7f, 0x34, 0xf6, 0xe3, 0xe3, 0x1f, 0x36, 0xf6, 0x7b, 0xcb, 0x1f,
+  0x33, 0xf1, 0x33, 0x33, 0x65, 0xf6, 0x22, 0x23, 0x24, 0x2f, 0x22, 0xf2,
+  0x2f, 0x2f, 0x2f, 0x23, 0xe2, 0x23, 0x76, 0x3b, 0xdb, 0x31, 0x81, 0x00,
+  0x30, 0x33, 0x75, 0xd5, 0x81, 0x00, 0xf0, 0x22, 0x41, 0x47, 0x3f, 0x34,
+  0xdc, 0x22, 0x52, 0x22, 0x15, 0xf3, 0xa2, 0xa2, 0x2f, 0x2c, 0xdc, 0x66,
+  0xf8, 0x48, 0x4a, 0x6f, 0xc8, 0xf8, 0xa3, 0x82, 0x6f, 0x4c, 0xa6, 0x6a,
+  0xef, 0xf7, 0xf7, 0xfe, 0xa9, 0xf0, 0x11, 0x13, 0x2f, 0x12, 0x56, 0x55,
+  0x2e, 0x24, 0x1d, 0x23, 0x2d, 0x31, 0x3f, 0x33, 0xb2, 0x07, 0x01, 0x00,
+  0x83, 0x00, 0x80, 0xb4, 0x52, 0xf5, 0x11, 0x23, 0x7f, 0x51, 0x51, 0x84,
+  0x00, 0xf0, 0x74, 0x62, 0x22, 0x6f, 0x47, 0xf4, 0x43, 0x57, 0x6f, 0x44,
+  0xf4, 0x15, 0x14, 0x6f, 0x43, 0xa2, 0x22, 0x8f, 0x82, 0xf1, 0x41, 0x43,
+  0x2f, 0x26, 0xfe, 0x71, 0x72, 0xaf, 0xa4, 0x76, 0x21, 0xf2, 0x23, 0x21,
+  0x47, 0x62, 0x2f, 0x32, 0xc2, 0x22, 0x23, 0xf2, 0x35, 0x3f, 0x27, 0x22,
+  0x3e, 0x72, 0xbf, 0xb3, 0xf3, 0x21, 0x23, 0x25, 0x52, 0x46, 0x15, 0x53,
+  0x57, 0x27, 0x22, 0x6d, 0x26, 0x64, 0x2f, 0x18, 0xfc, 0x81, 0xa2, 0x25,
+  0x52, 0x31, 0x2b, 0x88, 0x6e, 0xc3, 0x6f, 0x68, 0xf8, 0xc1, 0xca, 0xef,
+  0xc8, 0xba, 0x82, 0xfc, 0xa6, 0x24, 0xca, 0xfc, 0x2c, 0x3c, 0x7f, 0x55,
+  0x0f, 0x1f, 0x31, 0xb3, 0x3a, 0xf3, 0x31, 0x35, 0x1f, 0x41, 0x72, 0x21,
+  0xb3, 0x32, 0xf3, 0x21, 0x23, 0x37, 0x22, 0x1d, 0x13, 0x2b, 0x55, 0x1f,
+  0x34, 0xf4, 0x53, 0x52, 0x57, 0x31, 0x65, 0xf5, 0x11, 0x13, 0x3d, 0x31,
+  0x2e, 0x22, 0xf7, 0x09, 0xf1, 0x49, 0x77, 0x7f, 0x34, 0xb4, 0x16, 0xd1,
+  0x53, 0xb3, 0x21, 0xf2, 0x28, 0x38, 0x3f, 0x36, 0xf6, 0x43, 0xa1, 0x7e,
+  0x72, 0xbf, 0x9f, 0x66, 0x22, 0x3f, 0x12, 0x72, 0x16, 0xb6, 0x22, 0x62,
+  0x23, 0x29, 0xf3, 0x17, 0x1f, 0x2b, 0x31, 0x16, 0xf2, 0x2b, 0x39, 0x17,
+  0x35, 0x25, 0x52, 0x66, 0x17, 0x31, 0x7d, 0x25, 0x26, 0xd2, 0x46, 0x42,
+  0xd2, 0x12, 0x5c, 0x22, 0x21, 0x15, 0xb3, 0xa2, 0xfa, 0xe2, 0xe2, 0x6f,
+  0x42, 0xf8, 0x48, 0x4a, 0xff, 0xca, 0xa8, 0xcc, 0x6f, 0x4c, 0xe6, 0x2a,
+  0xf6, 0x6c, 0x7f, 0x87, 0x25, 0x00, 0x20, 0x02, 0x00, 0x18, 0x76, 0x08,
+  0xf0, 0x01, 0x20, 0x01, 0x48, 0x20, 0x41, 0x04, 0x4a, 0x02, 0x42, 0x18,
+  0x00, 0xa0, 0x12, 0xa0, 0x12, 0x20, 0xba, 0x0d, 0xf0, 0x39, 0x20, 0x02,
+  0x00, 0x00, 0x20, 0x08, 0x10, 0x28, 0x08, 0x80, 0x02, 0x1f, 0x27, 0x0d,
+  0x8a, 0xa1, 0x21, 0x00, 0x18, 0x28, 0x22, 0x12, 0x42, 0x20, 0x04, 0x18,
+  0x00, 0x32, 0x42, 0xe0, 0x24, 0x02, 0x14, 0x13, 0x02, 0x41, 0x30, 0x21,
+  0x30, 0x21, 0x00, 0x28, 0x00, 0x20, 0x01, 0x12, 0x20, 0x01, 0x12, 0x22,
+  0x00, 0x00, 0xc0, 0x81, 0x00, 0x80, 0x22, 0x82, 0x08, 0x28, 0x48, 0x4a,
+  0x08, 0xcf, 0x86, 0x07, 0x2e, 0x42, 0x1f, 0x41, 0xf2, 0x28, 0xd6, 0x09,
+  0x30, 0x6a, 0x1f, 0x41, 0xd2, 0x09, 0xf1, 0x09, 0xb6, 0x6e, 0xd1, 0x41,
   0xb6, 0x6a, 0x99, 0x21, 0xaf, 0x24, 0x99, 0x45, 0xab, 0x94, 0x43, 0xf3,
-  0x4a, 0xb1, 0x4b, 0x42, 0x2f, 0x14, 0x7b, 0x25, 0xd8, 0x12, 0xfb, 0x24,
-  0x48, 0x1c, 0xfb, 0x24, 0x4a, 0x1c, 0xfa, 0x25, 0x4a, 0x1e, 0x21, 0x5f,
-  0xa2, 0xe5, 0x19, 0xf2, 0x22, 0x4a, 0x9e, 0x25, 0x4d, 0x4a, 0x9e, 0x24,
-  0xac, 0xf4, 0x91, 0x24, 0x4d, 0x42, 0x1f, 0x49, 0x52, 0x2c, 0x1f, 0x49,
-  0x32, 0x68, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x6a, 0xf1, 0x81,
-  0x64, 0xab, 0x96, 0x1b, 0x28, 0xaf, 0x14, 0x39, 0x85, 0xaf, 0x44, 0x39,
-  0x24, 0xaf, 0x44, 0x39, 0xa4, 0x2f, 0x14, 0x79, 0x24, 0xb8, 0x42, 0xfb,
-  0xa4, 0x48, 0x98, 0x4f, 0xa2, 0xf4, 0x1b, 0x46, 0xc0, 0x48, 0x1d, 0x64,
-  0x89, 0x34, 0x11, 0x83, 0x54, 0x41, 0xa1, 0x1d, 0x44, 0xeb, 0x14, 0x19,
-  0xf6, 0x4a, 0x84, 0x19, 0xd2, 0x4a, 0x9b, 0x45, 0x8b, 0xb4, 0x43, 0xf2,
-  0x4a, 0x81, 0x2a, 0xb4, 0x42, 0x69, 0x82, 0x29, 0xd8, 0x86, 0xc4, 0x91,
-  0x6f, 0x22, 0x85, 0xf8, 0x24, 0xda, 0x88, 0x49, 0x24, 0xc8, 0x4a, 0x96,
-  0xc1, 0x4b, 0x9e, 0x24, 0xbc, 0xe4, 0x89, 0xc2, 0x42, 0x1f, 0xcd, 0x42,
-  0xe2, 0x49, 0x32, 0x48, 0x13, 0x39, 0x4a, 0x8e, 0x24, 0xab, 0x14, 0x1b,
-  0x68, 0xad, 0x14, 0x82, 0xaf, 0x44, 0x3b, 0x85, 0xab, 0x34, 0x43, 0xb2,
-  0x4a, 0xb9, 0xa4, 0xb4, 0x42, 0xd9, 0x84, 0x94, 0x93, 0x27, 0x8a, 0x29,
-  0xe9, 0xa2, 0xf5, 0x1a, 0x95, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x20,
-  0x42, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4a, 0xb1, 0x4b, 0x42, 0x2f, 0x14, 0x7b, 0x25, 0xd6, 0x09, 0xf0, 0x2d,
+  0x1c, 0xfb, 0x24, 0x4a, 0x1c, 0xfa, 0x25, 0x4a, 0x1e, 0x21, 0x5f, 0xa2,
+  0xe5, 0x19, 0xf2, 0x22, 0x4a, 0x9e, 0x25, 0x4d, 0x4a, 0x9e, 0x24, 0xac,
+  0xf4, 0x91, 0x24, 0x4d, 0x42, 0x1f, 0x49, 0x52, 0x2c, 0x1f, 0x49, 0x32,
+  0x68, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x6a, 0xf1, 0x81, 0x64,
+  0xab, 0x96, 0x1b, 0x28, 0xaf, 0x14, 0x39, 0x85, 0xaf, 0x44, 0x39, 0x24,
+  0xda, 0x09, 0x00, 0x1f, 0x0a, 0xf3, 0x67, 0xb8, 0x42, 0xfb, 0xa4, 0x48,
+  0x98, 0x4f, 0xa2, 0xf4, 0x1b, 0x46, 0xc0, 0x48, 0x1d, 0x64, 0x89, 0x34,
+  0x11, 0x83, 0x54, 0x41, 0xa1, 0x1d, 0x44, 0xeb, 0x14, 0x19, 0xf6, 0x4a,
+  0x84, 0x19, 0xd2, 0x4a, 0x9b, 0x45, 0x8b, 0xb4, 0x43, 0xf2, 0x4a, 0x81,
+  0x2a, 0xb4, 0x42, 0x69, 0x82, 0x29, 0xd8, 0x86, 0xc4, 0x91, 0x6f, 0x22,
+  0x85, 0xf8, 0x24, 0xda, 0x88, 0x49, 0x24, 0xc8, 0x4a, 0x96, 0xc1, 0x4b,
+  0x9e, 0x24, 0xbc, 0xe4, 0x89, 0xc2, 0x42, 0x1f, 0xcd, 0x42, 0xe2, 0x49,
+  0x32, 0x48, 0x13, 0x39, 0x4a, 0x8e, 0x24, 0xab, 0x14, 0x1b, 0x68, 0xad,
+  0x14, 0x82, 0xaf, 0x44, 0x3b, 0x85, 0xab, 0x34, 0x43, 0xb2, 0x4a, 0xb9,
+  0xa4, 0xb4, 0x42, 0xd9, 0x84, 0x94, 0x93, 0x27, 0x8a, 0x29, 0xe9, 0xa2,
+  0xf5, 0x1a, 0x95, 0x40, 0x08, 0xbd, 0x09, 0x01, 0x01, 0x00, 0x85, 0x88,
+  0x00, 0x00, 0x00, 0x20, 0x42, 0x18, 0x02, 0x11, 0x00, 0xf0, 0xff, 0x38,
   0x50, 0x12, 0x42, 0xbe, 0xc7, 0x10, 0x02, 0x71, 0x10, 0x12, 0x88, 0x81,
   0x01, 0x40, 0x12, 0x11, 0x12, 0x01, 0x80, 0x81, 0x72, 0x32, 0x82, 0x08,
   0x8c, 0x86, 0x44, 0x84, 0x82, 0x04, 0x19, 0x22, 0x41, 0x23, 0x01, 0x4d,
@@ -1644,1138 +1396,785 @@ const unsigned char USB_1608G_rbf[] = {
   0x50, 0x22, 0x00, 0x11, 0x21, 0x00, 0x12, 0x28, 0x00, 0x15, 0x02, 0x15,
   0x28, 0x91, 0x11, 0x52, 0x20, 0x14, 0x02, 0x22, 0x60, 0x32, 0x00, 0x12,
   0x25, 0x03, 0x24, 0x20, 0x82, 0xa4, 0x86, 0x19, 0x44, 0x01, 0x80, 0xc4,
-  0x24, 0x48, 0x80, 0x24, 0x04, 0x00, 0x7f, 0xd7, 0x01, 0x4b, 0x21, 0x90,
-  0x31, 0x19, 0x31, 0x11, 0x2c, 0xc1, 0x21, 0x15, 0x22, 0x23, 0x41, 0x03,
-  0x14, 0x12, 0x58, 0x23, 0x21, 0xd2, 0x22, 0xe1, 0x24, 0x92, 0x21, 0x47,
-  0x11, 0x14, 0x4a, 0x03, 0x22, 0x60, 0x46, 0x2d, 0x42, 0x47, 0x22, 0x11,
-  0x29, 0x82, 0x83, 0x84, 0x31, 0x62, 0x23, 0x44, 0x42, 0x05, 0x28, 0x19,
-  0x04, 0x19, 0x54, 0x22, 0x82, 0x25, 0x91, 0x82, 0x86, 0x42, 0x31, 0x45,
-  0x31, 0x90, 0x22, 0x87, 0x22, 0x30, 0x2c, 0x81, 0x68, 0x4a, 0xf2, 0xf5,
-  0x32, 0x80, 0x23, 0x62, 0x12, 0x1b, 0x21, 0x20, 0x41, 0xc1, 0x43, 0x32,
-  0x24, 0x19, 0x02, 0x14, 0x18, 0x10, 0x01, 0x21, 0x80, 0x71, 0x31, 0x44,
-  0xa1, 0x21, 0x24, 0x28, 0x85, 0x71, 0x74, 0x42, 0x41, 0x04, 0x21, 0x21,
-  0x20, 0xc1, 0x42, 0x11, 0x40, 0x44, 0xc2, 0x22, 0x11, 0x00, 0x22, 0x23,
-  0xb4, 0x42, 0x82, 0x28, 0x08, 0x6c, 0x04, 0x41, 0x23, 0x24, 0x82, 0x34,
-  0x44, 0x00, 0xf0, 0xbb, 0xd2, 0x10, 0x04, 0x18, 0x70, 0x11, 0x42, 0x82,
-  0x22, 0x71, 0x41, 0x22, 0x41, 0x02, 0x21, 0x21, 0x4a, 0x91, 0x12, 0x29,
-  0x82, 0xd1, 0x22, 0xc6, 0x21, 0x00, 0x48, 0x11, 0x00, 0xe0, 0x21, 0xe4,
-  0x21, 0x46, 0x81, 0x86, 0x23, 0x64, 0x22, 0x28, 0x2e, 0x42, 0x50, 0x12,
-  0x12, 0x14, 0x42, 0x24, 0x46, 0x03, 0x88, 0x3c, 0x68, 0x14, 0x14, 0x25,
-  0x41, 0xc1, 0x41, 0x22, 0x22, 0x84, 0x21, 0x8c, 0x42, 0x88, 0xa6, 0x42,
-  0x8f, 0x25, 0x04, 0x80, 0x01, 0x11, 0x00, 0x40, 0x02, 0x49, 0x31, 0x14,
-  0x10, 0x72, 0x24, 0x01, 0x25, 0x02, 0x24, 0x45, 0x02, 0x00, 0x30, 0x14,
-  0x00, 0x43, 0x82, 0x21, 0x01, 0x49, 0x31, 0x41, 0x10, 0x82, 0x81, 0x12,
-  0x04, 0x43, 0x41, 0x42, 0x02, 0x32, 0x46, 0x14, 0x14, 0x84, 0x04, 0x80,
-  0xe4, 0x42, 0x04, 0x40, 0xd1, 0x28, 0x48, 0x04, 0x40, 0xf2, 0x43, 0xfa,
-  0x00, 0x66, 0x02, 0x26, 0x82, 0x82, 0x24, 0x21, 0x02, 0x10, 0x34, 0x21,
-  0x81, 0x22, 0xa0, 0x12, 0x40, 0x01, 0x60, 0xb2, 0x49, 0xb2, 0x21, 0x61,
-  0x31, 0x40, 0x54, 0x81, 0x22, 0x00, 0x10, 0x81, 0x04, 0x26, 0x11, 0xc1,
-  0x41, 0x24, 0x19, 0x82, 0x44, 0x44, 0x44, 0x41, 0x01, 0x49, 0x62, 0x12,
-  0x22, 0x51, 0x00, 0x29, 0x04, 0x28, 0x28, 0x94, 0x44, 0x20, 0xf8, 0x72,
-  0x89, 0x80, 0x03, 0x10, 0x04, 0xc0, 0x24, 0x18, 0x26, 0x01, 0x00, 0x12,
-  0x90, 0x11, 0x14, 0x00, 0x18, 0x24, 0x00, 0x41, 0x48, 0x22, 0x60, 0x24,
-  0x40, 0x24, 0x35, 0x21, 0x22, 0x40, 0x04, 0x4d, 0x12, 0x38, 0x11, 0x10,
-  0x44, 0x01, 0x10, 0x82, 0x14, 0x41, 0x02, 0x48, 0x00, 0x16, 0x64, 0x44,
-  0xd1, 0x40, 0x31, 0x48, 0xc4, 0x87, 0x46, 0x2f, 0x5e, 0x07, 0x18, 0x00,
-  0x26, 0x06, 0xa0, 0x21, 0x30, 0x21, 0x00, 0x3c, 0x32, 0x18, 0x51, 0x1c,
-  0x21, 0x12, 0x02, 0x49, 0x51, 0x22, 0x90, 0x24, 0x53, 0x31, 0x44, 0x29,
-  0x02, 0x13, 0x16, 0x62, 0x41, 0x48, 0x45, 0x21, 0x24, 0x14, 0x96, 0x11,
-  0x1d, 0x14, 0x3f, 0x41, 0x42, 0x92, 0x25, 0x46, 0x42, 0x11, 0x62, 0x33,
-  0x15, 0x84, 0x84, 0x22, 0x04, 0x47, 0x14, 0x42, 0x6c, 0x96, 0x44, 0x46,
-  0x84, 0x12, 0x48, 0x64, 0x44, 0x41, 0x87, 0x4a, 0x6f, 0xa8, 0x0d, 0x22,
-  0x1a, 0x12, 0x12, 0x21, 0x82, 0x14, 0xa4, 0x21, 0x21, 0x16, 0x84, 0x01,
-  0x00, 0x24, 0x13, 0x01, 0x11, 0x21, 0xd0, 0x18, 0x02, 0x28, 0x11, 0x10,
-  0x54, 0x48, 0x2a, 0x01, 0x18, 0x1a, 0x22, 0x02, 0x80, 0x22, 0x02, 0x14,
-  0x12, 0x41, 0x44, 0x41, 0x20, 0x44, 0x44, 0x91, 0x21, 0x21, 0x00, 0x80,
-  0x01, 0x85, 0x24, 0x1a, 0x4a, 0x18, 0xc8, 0x42, 0x9f, 0x64, 0x06, 0x80,
-  0x93, 0x34, 0x18, 0x41, 0x44, 0x14, 0x10, 0x01, 0x14, 0x40, 0x42, 0x02,
-  0x00, 0x12, 0x29, 0x32, 0x21, 0x58, 0x40, 0x03, 0x4a, 0x02, 0x24, 0x00,
-  0x80, 0x04, 0x20, 0x42, 0x05, 0x20, 0x32, 0x11, 0x21, 0x27, 0x14, 0x24,
-  0x11, 0x00, 0x22, 0x40, 0x41, 0x41, 0x01, 0x20, 0x02, 0x48, 0x48, 0x20,
-  0x14, 0xf8, 0x5e, 0x4b, 0x30, 0x21, 0x21, 0x00, 0x28, 0x21, 0x28, 0x90,
-  0x34, 0x61, 0x16, 0x02, 0x00, 0x18, 0x00, 0x21, 0x14, 0x00, 0x20, 0x01,
-  0x11, 0x13, 0x41, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x22,
+  0x24, 0x48, 0x3e, 0x0c, 0xf0, 0xff, 0x7b, 0x7f, 0xd7, 0x01, 0x4b, 0x21,
+  0x90, 0x31, 0x19, 0x31, 0x11, 0x2c, 0xc1, 0x21, 0x15, 0x22, 0x23, 0x41,
+  0x03, 0x14, 0x12, 0x58, 0x23, 0x21, 0xd2, 0x22, 0xe1, 0x24, 0x92, 0x21,
+  0x47, 0x11, 0x14, 0x4a, 0x03, 0x22, 0x60, 0x46, 0x2d, 0x42, 0x47, 0x22,
+  0x11, 0x29, 0x82, 0x83, 0x84, 0x31, 0x62, 0x23, 0x44, 0x42, 0x05, 0x28,
+  0x19, 0x04, 0x19, 0x54, 0x22, 0x82, 0x25, 0x91, 0x82, 0x86, 0x42, 0x31,
+  0x45, 0x31, 0x90, 0x22, 0x87, 0x22, 0x30, 0x2c, 0x81, 0x68, 0x4a, 0xf2,
+  0xf5, 0x32, 0x80, 0x23, 0x62, 0x12, 0x1b, 0x21, 0x20, 0x41, 0xc1, 0x43,
+  0x32, 0x24, 0x19, 0x02, 0x14, 0x18, 0x10, 0x01, 0x21, 0x80, 0x71, 0x31,
+  0x44, 0xa1, 0x21, 0x24, 0x28, 0x85, 0x71, 0x74, 0x42, 0x41, 0x04, 0x21,
+  0x21, 0x20, 0xc1, 0x42, 0x11, 0x40, 0x44, 0xc2, 0x22, 0x11, 0x00, 0x22,
+  0x23, 0xb4, 0x42, 0x82, 0x28, 0x08, 0x6c, 0x04, 0x41, 0x23, 0x24, 0x82,
+  0x34, 0x44, 0x00, 0xf0, 0xbb, 0xd2, 0x10, 0x04, 0x18, 0x70, 0x11, 0x42,
+  0x82, 0x22, 0x71, 0x41, 0x22, 0x41, 0x02, 0x21, 0x21, 0x4a, 0x91, 0x12,
+  0x29, 0x82, 0xd1, 0x22, 0xc6, 0x21, 0x00, 0x48, 0x11, 0x00, 0xe0, 0x21,
+  0xe4, 0x21, 0x46, 0x81, 0x86, 0x23, 0x64, 0x22, 0x28, 0x2e, 0x42, 0x50,
+  0x12, 0x12, 0x14, 0x42, 0x24, 0x46, 0x03, 0x88, 0x3c, 0x68, 0x14, 0x14,
+  0x25, 0x41, 0xc1, 0x41, 0x22, 0x22, 0x84, 0x21, 0x8c, 0x42, 0x88, 0xa6,
+  0x42, 0x8f, 0x25, 0x04, 0x80, 0x01, 0x11, 0x00, 0x40, 0x02, 0x49, 0x31,
+  0x14, 0x10, 0x72, 0x24, 0x01, 0x25, 0x02, 0x24, 0x45, 0x02, 0x00, 0x30,
+  0x14, 0x00, 0x43, 0x82, 0x21, 0x01, 0x49, 0x31, 0x41, 0x10, 0x82, 0x81,
+  0x12, 0x04, 0x43, 0x41, 0x42, 0x02, 0x32, 0x46, 0x14, 0x14, 0x84, 0x04,
+  0x80, 0xe4, 0x42, 0x04, 0x40, 0xd1, 0x28, 0x48, 0x04, 0x40, 0xf2, 0x43,
+  0xfa, 0x00, 0x66, 0x02, 0x26, 0x82, 0x82, 0x24, 0x21, 0x02, 0x10, 0x34,
+  0x21, 0x81, 0x22, 0xa0, 0x12, 0x40, 0x01, 0x60, 0xb2, 0x49, 0xb2, 0x21,
+  0x61, 0x31, 0x40, 0x54, 0x81, 0x22, 0x00, 0x10, 0x81, 0x04, 0x26, 0x11,
+  0xc1, 0x41, 0x24, 0x19, 0x82, 0x44, 0x44, 0x44, 0x41, 0x01, 0x49, 0x62,
+  0x12, 0x22, 0x51, 0x00, 0x29, 0x04, 0x28, 0x28, 0x94, 0x44, 0x20, 0xf8,
+  0x72, 0x89, 0x80, 0x03, 0x10, 0x04, 0xc0, 0x24, 0x18, 0x26, 0x01, 0x00,
+  0x12, 0x90, 0x11, 0x14, 0x00, 0x18, 0x24, 0x00, 0x41, 0x48, 0x22, 0x60,
+  0x24, 0x40, 0x24, 0x35, 0x21, 0x22, 0x40, 0x04, 0x4d, 0x12, 0x38, 0x11,
+  0x10, 0x44, 0x01, 0x10, 0x82, 0x14, 0x41, 0x02, 0x48, 0x00, 0x16, 0x64,
+  0x44, 0xd1, 0x40, 0x31, 0x48, 0xc4, 0x87, 0x46, 0x2f, 0x5e, 0x07, 0x18,
+  0x00, 0x26, 0x06, 0xa0, 0xf5, 0x03, 0xf0, 0xad, 0x3c, 0x32, 0x18, 0x51,
+  0x1c, 0x21, 0x12, 0x02, 0x49, 0x51, 0x22, 0x90, 0x24, 0x53, 0x31, 0x44,
+  0x29, 0x02, 0x13, 0x16, 0x62, 0x41, 0x48, 0x45, 0x21, 0x24, 0x14, 0x96,
+  0x11, 0x1d, 0x14, 0x3f, 0x41, 0x42, 0x92, 0x25, 0x46, 0x42, 0x11, 0x62,
+  0x33, 0x15, 0x84, 0x84, 0x22, 0x04, 0x47, 0x14, 0x42, 0x6c, 0x96, 0x44,
+  0x46, 0x84, 0x12, 0x48, 0x64, 0x44, 0x41, 0x87, 0x4a, 0x6f, 0xa8, 0x0d,
+  0x22, 0x1a, 0x12, 0x12, 0x21, 0x82, 0x14, 0xa4, 0x21, 0x21, 0x16, 0x84,
+  0x01, 0x00, 0x24, 0x13, 0x01, 0x11, 0x21, 0xd0, 0x18, 0x02, 0x28, 0x11,
+  0x10, 0x54, 0x48, 0x2a, 0x01, 0x18, 0x1a, 0x22, 0x02, 0x80, 0x22, 0x02,
+  0x14, 0x12, 0x41, 0x44, 0x41, 0x20, 0x44, 0x44, 0x91, 0x21, 0x21, 0x00,
+  0x80, 0x01, 0x85, 0x24, 0x1a, 0x4a, 0x18, 0xc8, 0x42, 0x9f, 0x64, 0x06,
+  0x80, 0x93, 0x34, 0x18, 0x41, 0x44, 0x14, 0x10, 0x01, 0x14, 0x40, 0x42,
+  0x02, 0x00, 0x12, 0x29, 0x32, 0x21, 0x58, 0x40, 0x03, 0x4a, 0x02, 0x24,
+  0x00, 0x80, 0x04, 0x20, 0x42, 0x05, 0x20, 0x32, 0x11, 0x21, 0x27, 0x14,
+  0x24, 0x11, 0x00, 0x22, 0x40, 0x41, 0x41, 0x01, 0x20, 0x02, 0x48, 0x48,
+  0x20, 0x14, 0xf8, 0x5e, 0x4b, 0x30, 0x21, 0x21, 0x00, 0x28, 0x21, 0x28,
+  0x90, 0x34, 0x61, 0x16, 0xf6, 0x04, 0x80, 0x21, 0x14, 0x00, 0x20, 0x01,
+  0x11, 0x13, 0x41, 0x4c, 0x0c, 0xf0, 0x07, 0x10, 0x01, 0x00, 0x00, 0x22,
   0x28, 0x20, 0x04, 0x13, 0x12, 0x14, 0x02, 0x21, 0x00, 0x00, 0x26, 0x18,
-  0x14, 0x24, 0xf2, 0xb4, 0xa8, 0x00, 0x30, 0x14, 0x00, 0x18, 0x24, 0x40,
-  0x01, 0x00, 0x00, 0x48, 0x80, 0x03, 0x28, 0x14, 0x48, 0x80, 0x82, 0x21,
-  0x62, 0x11, 0x10, 0x02, 0x30, 0x21, 0x24, 0x32, 0xf0, 0x22, 0x12, 0x14,
-  0x12, 0x28, 0x26, 0x02, 0x2a, 0x24, 0x82, 0x04, 0x62, 0x28, 0x10, 0x01,
-  0x26, 0x03, 0x80, 0x04, 0x43, 0x04, 0x22, 0x80, 0xf4, 0xb6, 0x78, 0x00,
-  0x00, 0x49, 0x32, 0x14, 0x21, 0x00, 0x41, 0x12, 0x00, 0x24, 0x28, 0x00,
-  0x00, 0x12, 0x12, 0x14, 0x00, 0x41, 0x18, 0x00, 0x20, 0x83, 0x81, 0x04,
-  0x24, 0x11, 0xa0, 0x42, 0x22, 0x12, 0x00, 0x23, 0x01, 0x00, 0x11, 0x70,
-  0x42, 0x14, 0x04, 0x60, 0x42, 0x00, 0x90, 0x22, 0x81, 0x84, 0x41, 0xe0,
-  0x43, 0x08, 0x8a, 0xc2, 0x44, 0x00, 0x19, 0x02, 0x16, 0x01, 0x32, 0x20,
-  0x02, 0x54, 0x12, 0x19, 0x42, 0x64, 0x14, 0x20, 0x41, 0x66, 0x21, 0x18,
-  0x1a, 0x04, 0x48, 0x21, 0x00, 0x3c, 0x05, 0x40, 0x21, 0x04, 0x28, 0x42,
-  0x1d, 0x12, 0x00, 0x00, 0x80, 0x42, 0x02, 0x14, 0x00, 0x21, 0x00, 0x00,
-  0xc0, 0x28, 0x40, 0x84, 0x04, 0xbe, 0xa7, 0x10, 0x01, 0x19, 0x04, 0x20,
-  0xa1, 0x24, 0x12, 0x10, 0x42, 0x43, 0x04, 0x28, 0x2c, 0x81, 0x01, 0x17,
-  0x41, 0x00, 0x28, 0x14, 0x21, 0x10, 0x01, 0x68, 0x00, 0x40, 0x02, 0x1c,
-  0x82, 0x02, 0x60, 0x44, 0x48, 0x4a, 0x82, 0x82, 0x72, 0x11, 0x02, 0x28,
-  0x14, 0x40, 0x04, 0x68, 0x80, 0x84, 0x12, 0x02, 0x80, 0x04, 0x26, 0x08,
-  0x3b, 0x79, 0x00, 0x18, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x11, 0x18, 0x00, 0x00, 0x11, 0x41, 0x22, 0x00,
-  0x42, 0x80, 0x82, 0x44, 0x94, 0x11, 0x00, 0x00, 0x41, 0x40, 0x04, 0x28,
-  0x00, 0x00, 0x00, 0x22, 0x28, 0x40, 0xd8, 0x62, 0x09, 0x00, 0x11, 0x4c,
-  0xc1, 0x11, 0x41, 0x80, 0x01, 0x44, 0x22, 0xd0, 0x41, 0x81, 0x61, 0x12,
-  0x29, 0x81, 0x12, 0x11, 0x81, 0x11, 0x81, 0x61, 0x12, 0x11, 0x00, 0x2a,
-  0x05, 0x42, 0x39, 0xc1, 0x32, 0x28, 0x46, 0x14, 0x42, 0x23, 0x02, 0x23,
-  0x61, 0x11, 0x40, 0x25, 0x01, 0x24, 0x10, 0x41, 0x81, 0xc8, 0x45, 0x20,
-  0x04, 0x63, 0x04, 0x00, 0x20, 0x02, 0x9f, 0x9d, 0x0e, 0x84, 0xc0, 0x42,
-  0x00, 0xc0, 0x12, 0x00, 0x12, 0x43, 0x41, 0x24, 0x82, 0x02, 0x20, 0x01,
-  0x10, 0x22, 0x12, 0x91, 0x42, 0xc0, 0x12, 0x90, 0x81, 0x20, 0x02, 0x14,
-  0x40, 0x11, 0x01, 0x84, 0x80, 0x04, 0x1e, 0x21, 0x18, 0x11, 0x46, 0x24,
-  0x22, 0x42, 0xf4, 0x42, 0x24, 0x22, 0x28, 0x80, 0x82, 0x02, 0x10, 0x02,
-  0x81, 0xa9, 0x18, 0xb4, 0x93, 0x07, 0x15, 0xe1, 0x49, 0x61, 0x61, 0x43,
-  0x41, 0xe4, 0x41, 0xe1, 0x37, 0x92, 0x12, 0x5f, 0x61, 0x43, 0xb4, 0x21,
-  0x11, 0xf2, 0x21, 0x12, 0x21, 0x1d, 0x23, 0x49, 0xa1, 0x14, 0xf0, 0x31,
-  0x31, 0x11, 0x6e, 0x13, 0x11, 0x4a, 0xd5, 0x43, 0x11, 0x11, 0x53, 0x11,
-  0x20, 0x17, 0xe2, 0x52, 0x24, 0xc2, 0x76, 0x28, 0x17, 0x12, 0xb0, 0x11,
-  0x83, 0xf2, 0x61, 0x32, 0x15, 0xf2, 0x23, 0x31, 0x28, 0x66, 0x21, 0x52,
-  0x11, 0x49, 0xb2, 0x21, 0x52, 0x11, 0x11, 0x15, 0x21, 0xe4, 0x22, 0x82,
-  0x44, 0xa2, 0x24, 0x46, 0x08, 0xcc, 0x0c, 0x4f, 0xd7, 0x09, 0x2a, 0x12,
-  0x22, 0xa2, 0x12, 0x17, 0x33, 0x21, 0x11, 0x12, 0x14, 0x2b, 0x11, 0x1e,
-  0x21, 0x40, 0x65, 0x21, 0x48, 0x23, 0x61, 0x13, 0x6d, 0x13, 0x70, 0x14,
-  0xb1, 0x13, 0x86, 0x61, 0x11, 0x14, 0x2a, 0x86, 0xa1, 0x62, 0x40, 0xe2,
-  0x11, 0xb1, 0x41, 0x82, 0x32, 0x22, 0x21, 0x69, 0xf3, 0x22, 0x61, 0x44,
-  0x1a, 0x61, 0x51, 0x3a, 0x23, 0xf5, 0x11, 0x11, 0x2d, 0x44, 0x28, 0x4c,
-  0x14, 0x31, 0x42, 0x44, 0x4f, 0x14, 0x44, 0xc2, 0x44, 0x90, 0x26, 0xc0,
-  0x44, 0x28, 0xcb, 0x22, 0xcb, 0x22, 0x84, 0x6f, 0x28, 0x0d, 0x20, 0xd6,
-  0x15, 0x43, 0x94, 0x34, 0x41, 0x18, 0x20, 0x12, 0x54, 0x24, 0x10, 0x84,
-  0xa1, 0x13, 0xc0, 0x22, 0x13, 0x41, 0x82, 0x03, 0x16, 0xb1, 0x21, 0x02,
-  0x46, 0x63, 0x11, 0x56, 0x12, 0xc2, 0x71, 0x11, 0x16, 0x12, 0x23, 0x74,
-  0x21, 0xc1, 0x42, 0x13, 0x64, 0x26, 0x23, 0x02, 0x25, 0xc1, 0x44, 0x26,
-  0x82, 0x42, 0xb2, 0x62, 0x62, 0x32, 0x1c, 0xf4, 0x24, 0x82, 0x21, 0x22,
-  0x2b, 0x22, 0x20, 0x04, 0x27, 0x82, 0x8b, 0x42, 0xc4, 0x42, 0xcb, 0x24,
-  0x8e, 0x41, 0x90, 0x21, 0x90, 0x21, 0x90, 0x21, 0x21, 0x19, 0x12, 0xb2,
-  0x11, 0x12, 0x92, 0x21, 0x21, 0x11, 0x21, 0x10, 0x22, 0x12, 0x22, 0x12,
-  0xa2, 0x42, 0xa0, 0x42, 0xe0, 0x22, 0x04, 0x2e, 0x42, 0xe0, 0x22, 0x04,
-  0x2c, 0x04, 0x2c, 0x04, 0x2c, 0x04, 0x2c, 0x01, 0x24, 0x30, 0x42, 0x30,
-  0x42, 0x30, 0x62, 0x70, 0x42, 0x01, 0x27, 0x14, 0x30, 0x42, 0x11, 0x23,
-  0x04, 0x23, 0x84, 0x14, 0x88, 0x04, 0x1f, 0x86, 0x4d, 0xf1, 0x21, 0x21,
-  0x4f, 0x52, 0xf3, 0x21, 0x37, 0x2f, 0x52, 0xf2, 0x21, 0x37, 0x3f, 0x73,
-  0xf3, 0x63, 0x63, 0x3f, 0x32, 0xf3, 0x21, 0x23, 0x6f, 0x73, 0xf3, 0x33,
-  0x33, 0x37, 0x32, 0x1f, 0x31, 0x51, 0x32, 0x17, 0x31, 0x6d, 0x26, 0x3f,
-  0x37, 0xf6, 0x26, 0x37, 0x2a, 0xf2, 0x24, 0x27, 0x6a, 0xa7, 0x24, 0x1f,
-  0x16, 0xa6, 0x24, 0x2f, 0x36, 0xf6, 0x43, 0x63, 0x3f, 0x37, 0xb7, 0x42,
-  0xf2, 0x73, 0x63, 0x2f, 0x16, 0xf6, 0x77, 0x77, 0x6f, 0x44, 0xf6, 0x42,
-  0x42, 0x2f, 0x24, 0xf4, 0x22, 0x22, 0x25, 0x72, 0x17, 0x77, 0x32, 0x72,
-  0x36, 0xd6, 0x22, 0xf4, 0x67, 0x77, 0x6f, 0x64, 0xf4, 0x42, 0x62, 0x2d,
-  0x42, 0x7f, 0x44, 0xf4, 0x22, 0x42, 0x3f, 0x36, 0xf4, 0xc1, 0xc2, 0x7f,
-  0x74, 0xd4, 0x23, 0xf4, 0x42, 0x42, 0x2f, 0x24, 0xf6, 0x42, 0x42, 0x4f,
-  0x74, 0xf4, 0x6a, 0x69, 0x2f, 0x14, 0x64, 0x46, 0x1f, 0xcc, 0x7e, 0x44,
-  0xf7, 0x32, 0xc3, 0xf0, 0x21, 0x21, 0x5f, 0xd5, 0xf6, 0x21, 0x27, 0x3d,
-  0x35, 0x5f, 0x32, 0xb2, 0x13, 0xf3, 0x63, 0x63, 0x3d, 0x32, 0x3f, 0x32,
-  0xf3, 0x13, 0x31, 0x7f, 0x73, 0xf3, 0x23, 0x22, 0x3f, 0x31, 0xd3, 0x33,
-  0xd1, 0x33, 0xf1, 0x26, 0x24, 0x3f, 0x37, 0xf6, 0x26, 0x16, 0x3f, 0x12,
-  0x72, 0x24, 0xf7, 0x71, 0x72, 0x2f, 0x16, 0xe7, 0x17, 0xf7, 0x61, 0x72,
-  0x2f, 0x36, 0xf6, 0xa3, 0xe3, 0x1f, 0x37, 0xf7, 0x62, 0xe2, 0x3f, 0x37,
-  0xf6, 0x23, 0x53, 0x6f, 0x77, 0xd7, 0x77, 0xf6, 0x42, 0x42, 0x2d, 0x42,
-  0x9f, 0xb6, 0x56, 0x22, 0x5f, 0xf4, 0xf4, 0x32, 0x22, 0x5f, 0x73, 0xf3,
-  0x53, 0x52, 0x6f, 0x67, 0xf6, 0x54, 0x26, 0x2b, 0x64, 0x2f, 0x24, 0xf4,
-  0x47, 0x46, 0x2f, 0x74, 0xf4, 0x62, 0x43, 0x3f, 0x2e, 0xfa, 0x46, 0x45,
-  0x3f, 0x24, 0xb4, 0x42, 0x76, 0x42, 0xf2, 0x42, 0x42, 0x67, 0x64, 0xaf,
-  0xb4, 0xf4, 0x4a, 0x4a, 0xaf, 0x84, 0xe4, 0xcc, 0xfc, 0x5e, 0x5f, 0x5f,
-  0x7f, 0x05, 0x1f, 0x12, 0xd2, 0x44, 0xf7, 0x21, 0x33, 0x2d, 0x24, 0x1f,
-  0x73, 0xd2, 0x43, 0xf2, 0x73, 0x63, 0x39, 0xf3, 0x31, 0x27, 0x2f, 0x41,
-  0xf3, 0x33, 0x37, 0x31, 0x1f, 0x31, 0x53, 0x12, 0x17, 0x31, 0x6d, 0x14,
-  0x3f, 0x36, 0x77, 0x26, 0xe5, 0x23, 0x73, 0x34, 0xf7, 0x62, 0x71, 0x2b,
-  0x11, 0x6a, 0x86, 0xf1, 0x61, 0x63, 0x3d, 0xc3, 0x1f, 0x37, 0x17, 0xf2,
-  0x71, 0x63, 0x3b, 0x63, 0x5f, 0x77, 0xd7, 0x56, 0xe4, 0x26, 0xd6, 0x22,
-  0xe4, 0xb4, 0x56, 0x33, 0x5f, 0x71, 0x75, 0x32, 0x72, 0x14, 0x56, 0x33,
-  0x6f, 0x76, 0x75, 0x65, 0xb7, 0x62, 0x56, 0x22, 0x7f, 0x54, 0x64, 0x62,
-  0x3b, 0x46, 0x1f, 0x2c, 0xfa, 0x47, 0x44, 0x35, 0xb2, 0x42, 0x74, 0x62,
-  0xb3, 0x42, 0x74, 0x44, 0xf6, 0x6a, 0x48, 0x1b, 0x46, 0xa5, 0xa8, 0xcc,
-  0xcd, 0x1e, 0x7f, 0x14, 0x0f, 0x1f, 0x12, 0xf2, 0x1c, 0x55, 0x5f, 0x32,
-  0x73, 0x16, 0xf5, 0x25, 0x27, 0x2f, 0x41, 0xf1, 0x71, 0x63, 0x2d, 0x12,
-  0x5f, 0x73, 0xf3, 0x16, 0x15, 0x1f, 0x33, 0x72, 0x22, 0xf2, 0x11, 0x13,
-  0x3f, 0x31, 0xf1, 0x11, 0x13, 0x6f, 0x41, 0xf3, 0x71, 0x73, 0x7f, 0x71,
-  0xf1, 0x31, 0x33, 0x47, 0x71, 0x3f, 0x17, 0xf7, 0x43, 0x31, 0x1f, 0x17,
-  0xb7, 0x41, 0xf2, 0x63, 0x63, 0x3d, 0xa1, 0x1f, 0x27, 0xb7, 0xc2, 0xf2,
-  0x73, 0x63, 0x3f, 0x13, 0xf1, 0x77, 0x76, 0x6f, 0x42, 0xf2, 0x62, 0x62,
-  0x21, 0x6e, 0x6b, 0x3f, 0x14, 0xd4, 0x7d, 0xb7, 0x32, 0xf2, 0x25, 0x27,
-  0x3f, 0x23, 0xf7, 0x76, 0x55, 0x5f, 0x71, 0xb3, 0x42, 0xc6, 0x42, 0x7f,
-  0x54, 0xd6, 0x32, 0xf6, 0x62, 0x62, 0x1f, 0x28, 0xfa, 0x46, 0x44, 0x1d,
-  0x42, 0x2b, 0x46, 0x24, 0x2f, 0x24, 0x54, 0x74, 0xaf, 0x86, 0xf6, 0x62,
-  0x68, 0x27, 0x86, 0xce, 0xe6, 0xcf, 0xd4, 0xf1, 0x54, 0x89, 0x00, 0x90,
-  0x14, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0xa0, 0x12, 0x20, 0x02, 0x22,
-  0x00, 0x00, 0x40, 0x01, 0x14, 0x80, 0x02, 0x00, 0x81, 0xc0, 0x24, 0xb0,
-  0x85, 0x09, 0x82, 0x00, 0x00, 0x16, 0x04, 0x12, 0x41, 0x80, 0x01, 0x20,
-  0x01, 0x80, 0x31, 0x11, 0x10, 0x11, 0x12, 0x81, 0x11, 0x01, 0x40, 0x01,
-  0x12, 0x11, 0x00, 0x00, 0x4a, 0x42, 0x81, 0x22, 0x32, 0x11, 0x00, 0x1c,
-  0x01, 0x22, 0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x80, 0x12, 0x44, 0x44,
-  0xf8, 0x6e, 0xea, 0xe0, 0x22, 0xf5, 0x11, 0x24, 0xa7, 0x22, 0x1f, 0x41,
-  0x32, 0x48, 0x1f, 0x41, 0x32, 0x4a, 0x1f, 0x41, 0xb2, 0x4a, 0xd1, 0x41,
-  0xb2, 0x4a, 0x99, 0x21, 0xaf, 0x24, 0x19, 0xb5, 0x4a, 0xb9, 0x24, 0xf4,
-  0x4a, 0x93, 0x43, 0xf2, 0x42, 0x91, 0x47, 0x82, 0x2d, 0xb1, 0x4f, 0x82,
-  0xc4, 0x91, 0x4f, 0xa2, 0xc4, 0x85, 0x4f, 0xa2, 0x64, 0x11, 0x4f, 0xa2,
-  0x64, 0x19, 0x2e, 0x4a, 0x96, 0xc5, 0x4a, 0x9e, 0x24, 0x6d, 0x5a, 0x1f,
-  0x4d, 0xd2, 0x22, 0xf5, 0x91, 0x24, 0x8d, 0x12, 0x1f, 0x49, 0x32, 0x48,
-  0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xf2, 0x6a, 0x11, 0x1d, 0x24, 0xab,
-  0x94, 0x19, 0xf2, 0x4a, 0x91, 0x51, 0xaf, 0x14, 0x39, 0x24, 0xaf, 0x44,
-  0x39, 0x24, 0x2b, 0xb4, 0x47, 0x82, 0xad, 0x94, 0x4f, 0x82, 0xa4, 0x94,
-  0x4f, 0xa2, 0xf4, 0x19, 0x52, 0xc0, 0x48, 0x1f, 0x41, 0x96, 0x48, 0x1f,
-  0x41, 0x32, 0x48, 0x1f, 0x41, 0x12, 0xda, 0x41, 0x36, 0x4a, 0x1d, 0x24,
-  0xaf, 0x44, 0x99, 0x21, 0xaf, 0x44, 0x1b, 0x95, 0xb8, 0x4b, 0x42, 0xad,
-  0x91, 0x4b, 0x42, 0x4e, 0x91, 0x45, 0xd8, 0x12, 0xf9, 0x26, 0x48, 0x1c,
-  0xf9, 0x22, 0x5a, 0x1c, 0xf8, 0x24, 0xda, 0x1c, 0xf8, 0x24, 0x4a, 0x96,
-  0xe1, 0xa2, 0x64, 0x19, 0x9c, 0xe4, 0x49, 0xc2, 0x49, 0x1f, 0xc9, 0x42,
-  0xba, 0x81, 0x56, 0x28, 0x1b, 0x69, 0x83, 0xf4, 0x91, 0x24, 0xa3, 0xf4,
-  0x81, 0x24, 0xab, 0x14, 0x11, 0xaf, 0x44, 0xa9, 0x28, 0xaf, 0x44, 0x03,
-  0xab, 0xb4, 0x22, 0xab, 0x94, 0x41, 0x2b, 0x94, 0x47, 0x82, 0x29, 0xb9,
-  0xa6, 0x94, 0x12, 0xac, 0xf5, 0x69, 0x2f, 0x40, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x08, 0x00,
-  0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x25, 0x01, 0xef, 0xb8, 0x0b, 0x24, 0x18, 0x21, 0x12, 0x48,
-  0x2c, 0x01, 0x22, 0x10, 0x41, 0x32, 0x11, 0x21, 0x24, 0x14, 0x16, 0x54,
-  0x14, 0x31, 0x44, 0x26, 0x02, 0x13, 0x12, 0x01, 0x11, 0x44, 0x16, 0x96,
-  0x21, 0x21, 0x88, 0x18, 0x44, 0x16, 0x22, 0x98, 0x23, 0x22, 0x37, 0x21,
-  0x16, 0x64, 0x11, 0xe0, 0x42, 0x01, 0x28, 0x26, 0x11, 0x04, 0x80, 0x0c,
-  0x20, 0x02, 0x10, 0x08, 0xa1, 0x00, 0xf0, 0x24, 0x11, 0x10, 0x62, 0x1a,
-  0x10, 0x14, 0x22, 0x42, 0x52, 0x34, 0x2c, 0x71, 0x24, 0x18, 0x23, 0x82,
-  0x05, 0xc0, 0x63, 0x80, 0x72, 0x11, 0x82, 0x64, 0x11, 0x46, 0x24, 0x22,
-  0x56, 0x22, 0x4e, 0x22, 0x11, 0xc0, 0x18, 0x5a, 0x12, 0x23, 0x14, 0x22,
-  0x25, 0x31, 0xc2, 0x22, 0x26, 0x02, 0x69, 0x44, 0xd1, 0x12, 0x55, 0x21,
-  0x48, 0x86, 0x23, 0x84, 0x01, 0x35, 0xc2, 0x45, 0x21, 0x29, 0x64, 0x22,
-  0x2c, 0x64, 0x42, 0xb0, 0x4d, 0x42, 0x31, 0xc4, 0xfe, 0xad, 0x00, 0x3b,
-  0x16, 0x70, 0x14, 0x22, 0x24, 0x02, 0x59, 0x92, 0x12, 0xc3, 0x12, 0x76,
-  0x21, 0x22, 0x46, 0x12, 0xd1, 0x61, 0x52, 0x25, 0x28, 0x18, 0xd0, 0x23,
-  0xf1, 0x44, 0x21, 0x14, 0x5a, 0x12, 0xf2, 0xc6, 0x22, 0x13, 0x31, 0x23,
-  0x2d, 0x18, 0x4a, 0x3a, 0x13, 0x17, 0x24, 0xa0, 0x1c, 0x83, 0xa1, 0x84,
-  0x13, 0x77, 0x12, 0x84, 0x81, 0xf4, 0x21, 0x14, 0x3b, 0x41, 0x1d, 0x22,
-  0x48, 0x54, 0x63, 0x24, 0xa1, 0x42, 0x11, 0x29, 0xd4, 0x22, 0x82, 0xc4,
-  0x22, 0x48, 0x41, 0x25, 0x3a, 0x48, 0x14, 0x56, 0xf4, 0x38, 0xc7, 0x10,
-  0x02, 0x21, 0x00, 0x12, 0x25, 0x02, 0x24, 0x11, 0x34, 0x12, 0x18, 0x00,
-  0x1a, 0x04, 0x11, 0x74, 0x2a, 0x04, 0x80, 0x02, 0x14, 0x40, 0x04, 0x80,
-  0x01, 0x41, 0x12, 0x25, 0x92, 0x21, 0x27, 0x22, 0x60, 0x22, 0x11, 0x61,
-  0x00, 0x60, 0x12, 0x82, 0x00, 0x2c, 0x08, 0x54, 0x00, 0x50, 0x28, 0x22,
-  0x30, 0x25, 0x20, 0xf8, 0x43, 0xd2, 0xc0, 0x42, 0x40, 0x81, 0x02, 0x90,
-  0x18, 0x40, 0x81, 0x44, 0x83, 0x44, 0x01, 0x00, 0x18, 0x20, 0x04, 0x20,
-  0x02, 0x00, 0x00, 0x11, 0x00, 0x44, 0x00, 0x29, 0x05, 0x24, 0x00, 0x20,
-  0x02, 0x23, 0x12, 0x21, 0x12, 0x41, 0x01, 0x00, 0x20, 0x18, 0x02, 0x00,
-  0x20, 0x08, 0xf0, 0xb7, 0x61, 0x10, 0x21, 0x02, 0x50, 0x21, 0x41, 0x25,
-  0x11, 0x32, 0x12, 0x00, 0x10, 0x02, 0x11, 0x24, 0x88, 0x27, 0x24, 0xd0,
-  0x14, 0x06, 0x11, 0x40, 0x35, 0x24, 0x14, 0x49, 0xa2, 0x25, 0x2d, 0x14,
-  0x14, 0x84, 0x49, 0x34, 0x12, 0x26, 0x12, 0x94, 0x31, 0x16, 0xc1, 0x21,
-  0x00, 0x40, 0x07, 0x11, 0x8c, 0x48, 0x12, 0x11, 0xb1, 0x81, 0x54, 0x25,
-  0x60, 0x22, 0x26, 0x34, 0x28, 0x81, 0x84, 0x84, 0x8c, 0x22, 0xd2, 0x29,
-  0x02, 0x14, 0x28, 0x80, 0x42, 0x13, 0x74, 0x12, 0x08, 0x21, 0x00, 0x25,
-  0x42, 0x01, 0x14, 0x80, 0x28, 0x04, 0x2a, 0x04, 0x11, 0x10, 0x44, 0x04,
-  0x80, 0x14, 0x04, 0x41, 0x24, 0xe0, 0x23, 0x04, 0x50, 0x12, 0x14, 0x00,
-  0x00, 0x80, 0x72, 0x88, 0x41, 0x01, 0x80, 0x48, 0x82, 0x88, 0x82, 0x92,
-  0x28, 0x00, 0x86, 0x28, 0x22, 0xf2, 0x76, 0xf8, 0x60, 0x24, 0x40, 0x01,
-  0x00, 0x11, 0x21, 0x19, 0x21, 0x44, 0x81, 0x04, 0x00, 0x24, 0x2c, 0x01,
-  0x23, 0x14, 0x05, 0x22, 0x40, 0x81, 0x42, 0x61, 0x42, 0x13, 0x33, 0x12,
-  0x11, 0x81, 0x4c, 0x64, 0x21, 0x40, 0x34, 0x31, 0x12, 0x22, 0x20, 0x02,
-  0x3d, 0x24, 0x25, 0x41, 0x01, 0x10, 0x13, 0x61, 0x14, 0x45, 0x01, 0x25,
-  0x12, 0x04, 0x81, 0x84, 0x10, 0x08, 0xbf, 0x87, 0x0f, 0x58, 0x42, 0x19,
-  0x08, 0x12, 0x44, 0x40, 0x21, 0x02, 0x41, 0x1c, 0x04, 0x49, 0x54, 0x12,
-  0x40, 0x04, 0x10, 0x42, 0x03, 0x41, 0x26, 0x04, 0x83, 0xc2, 0x32, 0x30,
-  0x44, 0x20, 0x04, 0x42, 0x00, 0x43, 0x31, 0x14, 0x26, 0x61, 0x41, 0x00,
-  0x44, 0x20, 0x01, 0x49, 0x92, 0x21, 0xa2, 0x00, 0x87, 0x48, 0x23, 0x08,
-  0x80, 0x42, 0x22, 0x28, 0x42, 0xf2, 0x71, 0x4d, 0x00, 0x47, 0x24, 0x2c,
-  0x02, 0x21, 0x28, 0x44, 0x29, 0x51, 0x12, 0x10, 0x04, 0x28, 0x00, 0x81,
-  0x80, 0x41, 0x01, 0x24, 0x00, 0x14, 0x41, 0x10, 0x44, 0x04, 0x21, 0x14,
-  0x13, 0x84, 0x41, 0x94, 0x19, 0x00, 0x42, 0x00, 0x14, 0x24, 0x50, 0x12,
-  0x10, 0x05, 0x22, 0x14, 0x41, 0x10, 0x04, 0x00, 0x2c, 0x08, 0x41, 0x44,
-  0x8f, 0x29, 0x0a, 0x00, 0x88, 0x41, 0x11, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x40, 0x81, 0x44, 0x85, 0x44, 0x34, 0x24, 0xa0, 0x21, 0x00, 0x00, 0x18,
-  0x00, 0x81, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x41, 0x4c, 0x02, 0x00,
-  0x21, 0x40, 0x88, 0x42, 0x12, 0x14, 0x34, 0x18, 0x26, 0x08, 0x00, 0xbf,
-  0x75, 0x09, 0x18, 0x41, 0x2c, 0x42, 0x14, 0xc2, 0x24, 0xd0, 0x32, 0xd1,
-  0x21, 0x02, 0x90, 0x41, 0x40, 0x42, 0x41, 0x19, 0xd4, 0x14, 0xd1, 0x21,
-  0x44, 0x64, 0x52, 0x90, 0x34, 0x26, 0x14, 0x84, 0x62, 0x22, 0x18, 0x2c,
-  0x04, 0x46, 0x89, 0x84, 0x05, 0x19, 0x93, 0x14, 0x12, 0x28, 0x18, 0x00,
-  0x64, 0x41, 0x4d, 0x11, 0x30, 0x21, 0x26, 0x23, 0x48, 0x51, 0x84, 0x89,
-  0x9a, 0x82, 0x61, 0xb0, 0x28, 0x61, 0x82, 0x80, 0x02, 0x2f, 0xca, 0x02,
-  0x48, 0x50, 0x12, 0xc0, 0x11, 0x10, 0x04, 0x00, 0x00, 0x90, 0x44, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x11, 0x40, 0x68, 0x41, 0x41, 0x44, 0x00, 0x00,
-  0x41, 0x00, 0x44, 0x14, 0x44, 0x10, 0x01, 0x30, 0x22, 0x00, 0x00, 0x00,
-  0x41, 0x44, 0x40, 0x04, 0x88, 0x82, 0x44, 0x45, 0xf2, 0xb9, 0x31, 0x20,
-  0x94, 0x11, 0x80, 0x81, 0x84, 0x01, 0x00, 0x14, 0x00, 0x41, 0x80, 0x04,
-  0x18, 0x10, 0x41, 0x06, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x84, 0x40,
-  0x21, 0x12, 0x02, 0x1c, 0x02, 0x11, 0x00, 0x80, 0x82, 0x18, 0x81, 0x48,
-  0x01, 0x00, 0x00, 0x28, 0x00, 0x24, 0xf0, 0x24, 0x11, 0xb0, 0x21, 0x21,
-  0x94, 0x11, 0x14, 0x2e, 0x14, 0x80, 0xc1, 0x44, 0x00, 0x42, 0x00, 0x42,
-  0x00, 0x00, 0x42, 0x19, 0x24, 0x04, 0x00, 0x42, 0x41, 0x00, 0x42, 0x00,
-  0x22, 0x44, 0x22, 0x16, 0x04, 0x81, 0x28, 0x46, 0x24, 0x42, 0x24, 0x12,
-  0x61, 0x12, 0x88, 0x00, 0x44, 0x40, 0x62, 0x28, 0x28, 0x00, 0x24, 0x4a,
-  0x02, 0xc0, 0x82, 0x5f, 0x1e, 0x05, 0x00, 0x20, 0x04, 0x00, 0x14, 0x48,
-  0x10, 0x02, 0x00, 0x28, 0x10, 0x62, 0x41, 0x18, 0x00, 0x44, 0x24, 0x00,
-  0x24, 0x11, 0x15, 0x84, 0x01, 0x14, 0x15, 0x02, 0x11, 0x40, 0x01, 0x28,
-  0x40, 0x61, 0x22, 0x00, 0x90, 0x84, 0x00, 0x41, 0x90, 0x22, 0x00, 0x00,
-  0x81, 0x00, 0x86, 0x82, 0xf2, 0xda, 0x67, 0x60, 0x11, 0xc0, 0x41, 0x21,
-  0x44, 0x45, 0x81, 0x04, 0x00, 0x40, 0x34, 0x44, 0x11, 0x80, 0x91, 0x21,
-  0x00, 0x18, 0x1c, 0x01, 0x29, 0x02, 0x10, 0x81, 0x02, 0x14, 0x11, 0xc0,
-  0x24, 0x40, 0x04, 0x12, 0x14, 0x44, 0x40, 0x84, 0x04, 0x00, 0x10, 0xc6,
-  0x44, 0x80, 0x02, 0x2a, 0x84, 0x18, 0x88, 0x08, 0x82, 0x10, 0x22, 0xf8,
-  0x9b, 0xe6, 0x80, 0x04, 0x00, 0x50, 0x24, 0x00, 0x00, 0x41, 0x48, 0x42,
-  0x44, 0x00, 0x48, 0x24, 0x14, 0x42, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x04, 0x25, 0x24, 0x02, 0x14, 0x25, 0x04, 0x44, 0x40, 0x02, 0x80,
-  0x08, 0x00, 0x30, 0x82, 0x00, 0x21, 0x10, 0x02, 0x50, 0x18, 0x7b, 0x32,
-  0x00, 0x12, 0x40, 0x01, 0x10, 0x41, 0x12, 0x11, 0x91, 0x41, 0x64, 0xc0,
-  0x42, 0x11, 0x11, 0x10, 0x01, 0x00, 0x50, 0x12, 0x45, 0x02, 0x00, 0x24,
-  0x00, 0x29, 0x02, 0x28, 0x89, 0x42, 0x01, 0x49, 0x02, 0x13, 0x02, 0x20,
-  0x02, 0x10, 0x02, 0x00, 0x21, 0x82, 0x00, 0x20, 0x92, 0x44, 0x50, 0x82,
-  0x21, 0x50, 0xbe, 0x00, 0x80, 0x06, 0x11, 0xa0, 0x42, 0x46, 0x21, 0x02,
-  0x22, 0x44, 0x90, 0x21, 0x00, 0x14, 0x00, 0x11, 0x00, 0x29, 0x44, 0x01,
-  0x80, 0x04, 0x22, 0x60, 0x14, 0x60, 0x14, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x40, 0x01, 0x40, 0x04, 0x4c, 0x02, 0x60, 0x88, 0x43, 0x04, 0x29, 0x08,
-  0x90, 0x42, 0x44, 0x3b, 0xdc, 0x00, 0x86, 0x01, 0x42, 0x14, 0x00, 0x40,
-  0x41, 0x44, 0x81, 0x04, 0x40, 0x31, 0x11, 0x18, 0x11, 0x1a, 0xc4, 0x14,
-  0x16, 0x02, 0x24, 0x11, 0x11, 0x14, 0x00, 0x80, 0x01, 0x00, 0x80, 0x41,
-  0x01, 0x14, 0x00, 0x00, 0x15, 0x44, 0x52, 0x21, 0x00, 0x25, 0x02, 0x40,
-  0x02, 0x26, 0x08, 0x29, 0x22, 0x08, 0x40, 0xf2, 0x9e, 0xaa, 0x40, 0x08,
-  0x48, 0x16, 0x84, 0x38, 0x11, 0x11, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00,
-  0x80, 0x02, 0x28, 0x10, 0x02, 0x38, 0xc0, 0x81, 0x11, 0x16, 0x01, 0x40,
-  0x44, 0x41, 0x84, 0x62, 0x81, 0x11, 0x4c, 0x04, 0x54, 0x28, 0x80, 0x06,
-  0x68, 0x40, 0x04, 0x68, 0x29, 0x22, 0x02, 0x20, 0x22, 0x08, 0x10, 0x82,
-  0xf2, 0xef, 0xef, 0x60, 0x14, 0x8a, 0x01, 0x1b, 0x11, 0x14, 0x5c, 0xd1,
-  0x13, 0x12, 0x54, 0x11, 0x44, 0x1d, 0x41, 0x48, 0x48, 0x14, 0x3d, 0x41,
-  0x24, 0x42, 0x5c, 0xc1, 0x41, 0x4d, 0x44, 0x17, 0x15, 0x00, 0x45, 0xc3,
-  0x21, 0x54, 0x26, 0x41, 0xa2, 0x12, 0x24, 0x48, 0x14, 0x65, 0xc4, 0x28,
-  0x45, 0x94, 0x21, 0xc4, 0x2c, 0xd2, 0x54, 0x02, 0x45, 0x07, 0x50, 0x21,
-  0x73, 0x02, 0x40, 0xd2, 0x22, 0xa4, 0xa2, 0x27, 0x24, 0x23, 0x38, 0x48,
-  0x26, 0xd2, 0x2c, 0x22, 0x44, 0x48, 0x91, 0xa2, 0xbf, 0xbb, 0x4f, 0xb1,
-  0x21, 0xa1, 0x49, 0x1c, 0x51, 0x12, 0x4f, 0x48, 0x11, 0xa5, 0x14, 0x13,
-  0x94, 0x62, 0x30, 0x44, 0x42, 0x21, 0x13, 0x04, 0x1b, 0x11, 0x1a, 0x11,
-  0xa1, 0x14, 0x18, 0x2c, 0x03, 0x2e, 0x42, 0x11, 0x42, 0x11, 0x50, 0x11,
-  0x15, 0xc1, 0x11, 0x11, 0x43, 0x92, 0x48, 0x43, 0xb2, 0x11, 0xe2, 0x11,
-  0x41, 0x51, 0x15, 0x19, 0x34, 0x25, 0x2a, 0xa2, 0x22, 0x28, 0x27, 0x12,
-  0x2c, 0x7e, 0x82, 0x64, 0x14, 0x25, 0x44, 0x01, 0xaa, 0x82, 0x42, 0xa8,
-  0x28, 0x22, 0x2f, 0x28, 0x02, 0x8a, 0x54, 0x84, 0x17, 0x4f, 0xa0, 0x41,
-  0x15, 0x91, 0x21, 0x4e, 0x44, 0x1b, 0x42, 0x12, 0x48, 0x1c, 0x04, 0x15,
-  0x83, 0x02, 0x47, 0x44, 0x49, 0x24, 0x42, 0x71, 0x21, 0x01, 0x3b, 0x21,
-  0x17, 0x35, 0x40, 0x44, 0x11, 0x12, 0x01, 0x39, 0x44, 0x24, 0x05, 0x26,
-  0xc1, 0x24, 0x28, 0x15, 0xc6, 0x11, 0x2a, 0x94, 0x23, 0x26, 0x24, 0x42,
-  0x25, 0x04, 0x1d, 0x45, 0x20, 0x88, 0x08, 0x43, 0x18, 0x54, 0x22, 0x88,
-  0x89, 0x38, 0x24, 0x21, 0x2b, 0x8c, 0x88, 0x40, 0x62, 0x2a, 0xdb, 0x4f,
-  0xa0, 0x24, 0x80, 0x02, 0x8a, 0x02, 0x28, 0x80, 0x42, 0x81, 0x02, 0x00,
-  0x00, 0x22, 0x20, 0x02, 0x2a, 0x04, 0x2a, 0x04, 0x1b, 0x42, 0xb0, 0x21,
-  0x04, 0x2a, 0x04, 0x48, 0xa0, 0x42, 0x80, 0x04, 0x22, 0x00, 0x20, 0x04,
-  0x42, 0x20, 0x24, 0x28, 0x04, 0x42, 0x20, 0x44, 0x28, 0x04, 0x42, 0x48,
-  0x80, 0x04, 0x3d, 0x12, 0x14, 0x4a, 0xe2, 0x13, 0xa3, 0x23, 0x4f, 0x53,
-  0xe3, 0x41, 0xf2, 0x31, 0x37, 0x2b, 0x67, 0x1f, 0x26, 0x16, 0xf3, 0x25,
-  0x24, 0x1b, 0x66, 0x6e, 0x62, 0x29, 0x54, 0x65, 0x39, 0xa2, 0x22, 0x7a,
-  0xe6, 0x32, 0xb2, 0x32, 0xd5, 0x54, 0xd3, 0x55, 0xa7, 0x66, 0x1f, 0x14,
-  0xf4, 0x44, 0x66, 0x2d, 0x61, 0x6e, 0x61, 0x1f, 0x14, 0xe4, 0x26, 0xf6,
-  0x32, 0x71, 0x1f, 0x35, 0xf4, 0x63, 0x61, 0x4f, 0x44, 0x54, 0xcc, 0x4f,
-  0xe6, 0xf6, 0x76, 0x44, 0x1b, 0x21, 0x5d, 0x24, 0x45, 0xd6, 0x46, 0xf4,
-  0x44, 0x64, 0x4f, 0x44, 0xa4, 0x64, 0x57, 0x74, 0x39, 0xd6, 0x11, 0xac,
-  0x44, 0x24, 0x29, 0xd4, 0x44, 0xa4, 0xcc, 0x8a, 0xb8, 0xe2, 0xfc, 0x4c,
-  0x46, 0x2f, 0x24, 0xf6, 0x26, 0xa6, 0x2b, 0xca, 0x8f, 0x84, 0xa4, 0x44,
-  0xcf, 0xe6, 0xf4, 0x23, 0xfa, 0x14, 0x5a, 0xf2, 0x31, 0x78, 0x13, 0xf1,
-  0x14, 0x15, 0x1a, 0xe2, 0x23, 0xb3, 0x52, 0xe4, 0x34, 0xf4, 0x23, 0x21,
-  0x5f, 0x42, 0xe2, 0x44, 0xe4, 0x24, 0xb4, 0x22, 0x76, 0x44, 0xd7, 0x13,
-  0x12, 0xb1, 0x51, 0xe4, 0x33, 0xb3, 0x72, 0xf1, 0x45, 0x25, 0x4d, 0x65,
-  0x2b, 0x66, 0x1f, 0x12, 0xf2, 0x14, 0x36, 0x3d, 0x61, 0x1f, 0x1e, 0xef,
-  0x12, 0xc2, 0x83, 0x2f, 0x11, 0xf5, 0x71, 0x63, 0x21, 0x57, 0x52, 0xcf,
-  0xc6, 0xf4, 0x64, 0x6f, 0xef, 0xc6, 0xb6, 0x21, 0xf2, 0x65, 0x6c, 0x45,
-  0xd7, 0x47, 0xd4, 0x45, 0x52, 0x44, 0x6a, 0xf6, 0x65, 0x27, 0x3d, 0x63,
-  0x1d, 0xc3, 0x2f, 0x4c, 0xe4, 0x24, 0xd4, 0x22, 0xd6, 0x64, 0xf4, 0xc2,
-  0xe2, 0xca, 0xbc, 0xa2, 0xf8, 0x24, 0x26, 0x2f, 0x24, 0xf6, 0xe6, 0xe6,
-  0x2f, 0x2a, 0xfc, 0x4a, 0x48, 0xf0, 0x3c, 0x9e, 0x8f, 0x7d, 0x04, 0x7a,
-  0xe5, 0x11, 0x07, 0x5f, 0x41, 0x71, 0xa5, 0xf4, 0x11, 0x36, 0x3b, 0x44,
-  0x4e, 0x42, 0x2b, 0x22, 0x55, 0xf4, 0x41, 0x44, 0x4e, 0x42, 0x2b, 0x64,
-  0x45, 0x16, 0xe2, 0x11, 0xf1, 0x51, 0x51, 0x1f, 0x23, 0xb1, 0x53, 0xf7,
-  0x55, 0x14, 0x1f, 0x16, 0x91, 0x42, 0x1f, 0x12, 0xd2, 0x65, 0x71, 0x62,
-  0x91, 0xc1, 0x1f, 0x12, 0x52, 0x21, 0x3f, 0x15, 0xf1, 0x11, 0x53, 0x3f,
-  0x12, 0x72, 0x24, 0xf5, 0x6c, 0x6c, 0x4f, 0xa2, 0x72, 0x37, 0xfd, 0x51,
-  0x71, 0x5f, 0x52, 0x46, 0x56, 0x57, 0x5f, 0x52, 0xf2, 0x24, 0x24, 0x4a,
-  0xd2, 0x75, 0xf4, 0x23, 0x21, 0x3f, 0x16, 0xda, 0x42, 0xe8, 0x24, 0x94,
-  0x22, 0x67, 0x44, 0x2b, 0x88, 0x2b, 0xee, 0xaf, 0x8a, 0x5a, 0x6c, 0x2d,
-  0x22, 0x6f, 0x6e, 0xbe, 0xc2, 0xd8, 0x8a, 0x04, 0xcf, 0xe2, 0xf3, 0x98,
-  0x81, 0xf0, 0x71, 0x51, 0x9f, 0x11, 0xf3, 0x21, 0x21, 0x5f, 0x51, 0x71,
-  0x25, 0xf5, 0x11, 0x33, 0x3f, 0x12, 0xe6, 0x34, 0x54, 0x13, 0x5f, 0x52,
-  0xe2, 0x12, 0xe6, 0x24, 0xb4, 0x42, 0x76, 0x44, 0x77, 0x23, 0x41, 0xf1,
-  0x71, 0x61, 0x1f, 0x33, 0xf1, 0x53, 0x31, 0x5f, 0x55, 0x31, 0x61, 0x2a,
-  0xf6, 0x41, 0x41, 0x5d, 0x16, 0x37, 0x16, 0x1f, 0x13, 0xbe, 0x41, 0x64,
-  0x38, 0x2f, 0x17, 0xf3, 0x31, 0x73, 0x2b, 0x44, 0x4f, 0x12, 0xf2, 0x2c,
-  0x2c, 0x4f, 0xe6, 0xf6, 0x26, 0x2d, 0x7e, 0x71, 0xdf, 0x52, 0x56, 0x74,
-  0x7f, 0x54, 0xe2, 0x42, 0xf2, 0x64, 0x64, 0x6a, 0xf2, 0x25, 0x67, 0x3f,
-  0x32, 0xf2, 0x61, 0xa3, 0x2b, 0xcc, 0x24, 0x25, 0x72, 0x44, 0xf6, 0xe2,
-  0xc2, 0x2b, 0xaa, 0xaf, 0x8a, 0xf2, 0x6c, 0x6e, 0x2f, 0x24, 0xf6, 0xa6,
-  0xa6, 0xca, 0xd8, 0x88, 0xa4, 0x44, 0xcf, 0xe2, 0xfb, 0xc4, 0x93, 0xc0,
-  0x11, 0x00, 0x00, 0x40, 0x81, 0x04, 0x40, 0x81, 0x04, 0x00, 0x00, 0x00,
-  0x11, 0x44, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x81, 0x41, 0x40, 0x01,
-  0x14, 0x40, 0x01, 0x00, 0x24, 0x82, 0x00, 0x24, 0x00, 0x82, 0x00, 0x28,
-  0x00, 0x00, 0xf0, 0x96, 0x1f, 0x00, 0x19, 0x22, 0x12, 0x11, 0x84, 0x22,
-  0x02, 0x14, 0x28, 0x80, 0x02, 0x48, 0x14, 0x32, 0x14, 0x13, 0xa2, 0x14,
-  0x32, 0x80, 0x84, 0xa2, 0x42, 0x14, 0x2a, 0x24, 0x34, 0x21, 0x12, 0x1b,
-  0x42, 0x90, 0x44, 0xa0, 0x42, 0x44, 0x58, 0x10, 0x84, 0x22, 0x44, 0x24,
-  0x14, 0x21, 0x04, 0x80, 0x04, 0x48, 0x46, 0x02, 0x42, 0x20, 0x24, 0x18,
-  0x82, 0x04, 0x8e, 0x41, 0x5b, 0x5b, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28,
-  0x1f, 0x41, 0x32, 0x4a, 0x1f, 0x41, 0x36, 0x4e, 0x1d, 0x24, 0xaf, 0x24,
-  0xd1, 0x41, 0xf6, 0x4a, 0x91, 0x19, 0xb2, 0x4a, 0x19, 0xf5, 0x4a, 0x92,
-  0x4b, 0x42, 0xaf, 0x14, 0x39, 0x24, 0x2f, 0x74, 0x79, 0x24, 0xd8, 0x12,
-  0xf9, 0x24, 0x48, 0x5c, 0xf9, 0x25, 0x4a, 0x1c, 0xf8, 0x25, 0x4a, 0x16,
-  0xf5, 0x26, 0x4a, 0x96, 0xf5, 0x21, 0x4a, 0x96, 0xc5, 0x4a, 0x9e, 0x24,
-  0x2d, 0x4a, 0x1f, 0x49, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x2a, 0x1f, 0x49,
-  0x72, 0x48, 0xf2, 0x91, 0x24, 0xa7, 0x14, 0x1f, 0x48, 0xb2, 0x4e, 0xf1,
-  0x81, 0x24, 0xab, 0x94, 0x1b, 0x28, 0xaf, 0x14, 0x19, 0xf5, 0x4a, 0x91,
-  0x43, 0xb2, 0x4a, 0x39, 0xa4, 0xab, 0x94, 0x47, 0x82, 0x29, 0xf9, 0xa4,
-  0x48, 0x98, 0x4f, 0xaa, 0xf4, 0x34, 0x23, 0xc0, 0x4a, 0x1f, 0x41, 0x94,
-  0x18, 0x1f, 0x41, 0xb4, 0x48, 0x71, 0x11, 0xb4, 0x48, 0x51, 0x41, 0x89,
-  0x11, 0xf1, 0x48, 0x94, 0x11, 0xaf, 0x44, 0x1b, 0x95, 0x9a, 0x41, 0x8f,
-  0x14, 0x09, 0x4e, 0x91, 0x45, 0xd8, 0x12, 0x59, 0x86, 0x98, 0x2d, 0x18,
-  0x98, 0xac, 0xa8, 0x81, 0xa4, 0x96, 0x41, 0x68, 0x49, 0xb4, 0x96, 0x44,
-  0xfb, 0x91, 0x2c, 0xf0, 0x91, 0x4c, 0x85, 0xf2, 0x91, 0x24, 0x83, 0xe2,
-  0x49, 0x32, 0x2a, 0x1f, 0x48, 0xb2, 0x28, 0xc1, 0x24, 0xad, 0x94, 0x28,
-  0xad, 0xb4, 0x90, 0xba, 0x43, 0x92, 0xb2, 0x22, 0x19, 0x79, 0x24, 0x98,
-  0xb2, 0x67, 0x82, 0x98, 0x2f, 0x22, 0xf1, 0x12, 0xd1, 0x40, 0x28, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x80, 0x08, 0x00, 0x00, 0x00, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x10, 0x08, 0xf0, 0xe3, 0xbb, 0x24, 0x48,
-  0x11, 0x11, 0x14, 0x4d, 0x42, 0x48, 0x00, 0x17, 0x24, 0x85, 0x85, 0xd4,
-  0x18, 0xc4, 0x43, 0x1c, 0x04, 0x61, 0x11, 0x11, 0x4d, 0x11, 0x13, 0x01,
-  0x00, 0x80, 0x14, 0x01, 0x35, 0x82, 0x11, 0xe2, 0x11, 0x02, 0x23, 0x62,
-  0x22, 0x12, 0x21, 0x53, 0x71, 0x12, 0x02, 0x24, 0x34, 0x30, 0x11, 0x44,
-  0x17, 0x22, 0x24, 0xc6, 0x01, 0x86, 0x11, 0x02, 0x88, 0x4b, 0x28, 0x43,
-  0x28, 0x98, 0x82, 0x20, 0x28, 0xd2, 0xda, 0x02, 0x28, 0x82, 0x00, 0x22,
-  0x18, 0x88, 0x37, 0x41, 0x00, 0x10, 0x02, 0x00, 0x91, 0x80, 0x18, 0x02,
-  0x40, 0x01, 0x14, 0x28, 0x44, 0x14, 0x42, 0x13, 0x14, 0x5c, 0x82, 0x82,
-  0x45, 0x02, 0x1c, 0x44, 0x01, 0x40, 0x33, 0x81, 0x00, 0x24, 0x30, 0x42,
-  0x00, 0x21, 0x58, 0x18, 0x43, 0x12, 0x24, 0x04, 0x00, 0x4c, 0x48, 0x45,
-  0xf8, 0x4e, 0x8e, 0xb0, 0x22, 0x24, 0x0c, 0x14, 0x46, 0x34, 0x42, 0x88,
-  0x2d, 0x11, 0x10, 0x34, 0x44, 0x25, 0x21, 0x36, 0x43, 0x50, 0x92, 0x40,
-  0x63, 0x51, 0x18, 0x24, 0x14, 0x30, 0x11, 0x30, 0x84, 0x15, 0x82, 0x74,
-  0x12, 0x13, 0x64, 0x13, 0x11, 0x2d, 0x22, 0x26, 0x92, 0x48, 0x11, 0x47,
-  0x35, 0x12, 0x31, 0x13, 0x58, 0x32, 0x30, 0x11, 0x41, 0x3f, 0x24, 0x12,
-  0x94, 0x82, 0x23, 0xe2, 0x31, 0x28, 0x21, 0x22, 0xe8, 0x44, 0x3a, 0x84,
-  0x24, 0x2c, 0x18, 0x04, 0x83, 0xf1, 0xce, 0x58, 0x00, 0x11, 0x14, 0x20,
-  0x22, 0x01, 0x44, 0x46, 0x53, 0x81, 0xc0, 0x48, 0x14, 0x00, 0x41, 0x14,
-  0x82, 0x10, 0x01, 0x00, 0xa0, 0x24, 0x11, 0x10, 0x21, 0x44, 0x1a, 0x88,
-  0x48, 0x04, 0x13, 0x11, 0x02, 0x00, 0x21, 0x00, 0x10, 0x02, 0x90, 0x41,
-  0x80, 0x04, 0x41, 0x44, 0x00, 0x82, 0x20, 0xc8, 0x84, 0x22, 0x8f, 0x5e,
-  0x05, 0x00, 0x80, 0x02, 0x28, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x11, 0x00, 0x88, 0x48, 0x10, 0x21, 0x04, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x11, 0x12, 0x01, 0x11, 0x00, 0x20, 0x08, 0x00, 0x00,
-  0x00, 0x80, 0x08, 0xaf, 0x45, 0x05, 0x00, 0x00, 0x20, 0x51, 0x42, 0x43,
-  0x02, 0x22, 0x84, 0x10, 0x01, 0x00, 0x40, 0x34, 0x88, 0x41, 0x1a, 0x88,
-  0x92, 0x25, 0x22, 0x70, 0x24, 0x02, 0x10, 0x01, 0x12, 0x46, 0x14, 0x44,
-  0xb2, 0x21, 0x11, 0x04, 0x11, 0x22, 0x46, 0x02, 0xb0, 0x86, 0x02, 0x80,
-  0x14, 0x09, 0x42, 0x21, 0x83, 0x04, 0x41, 0x20, 0x02, 0x40, 0x14, 0xe8,
-  0xee, 0x0d, 0x00, 0x80, 0x02, 0x1a, 0x42, 0x14, 0x04, 0x24, 0x00, 0x14,
-  0x00, 0x00, 0x60, 0x88, 0x41, 0x12, 0x22, 0x14, 0x80, 0xc8, 0x64, 0x21,
-  0x80, 0x04, 0x14, 0x44, 0x44, 0x80, 0x12, 0x04, 0x11, 0x28, 0x50, 0x22,
-  0x24, 0x59, 0x0a, 0x20, 0x04, 0xc0, 0xc2, 0xc0, 0x48, 0x10, 0x04, 0x00,
-  0x00, 0x84, 0xeb, 0x35, 0x00, 0x42, 0x00, 0x40, 0x02, 0x22, 0x20, 0x52,
-  0x2c, 0x00, 0x22, 0x00, 0x40, 0x14, 0x04, 0x2c, 0x18, 0x61, 0x42, 0x32,
-  0x80, 0x08, 0x11, 0x11, 0x80, 0x31, 0x41, 0x00, 0xa7, 0x11, 0x80, 0x04,
-  0x20, 0x44, 0x01, 0x00, 0x11, 0x41, 0x94, 0x00, 0x00, 0x00, 0x20, 0x42,
-  0x02, 0x43, 0x28, 0xf1, 0x6b, 0x4b, 0x14, 0x48, 0x00, 0x00, 0x10, 0x09,
-  0x85, 0x12, 0x04, 0x12, 0x20, 0xc8, 0x48, 0x00, 0x60, 0x18, 0x81, 0x23,
-  0x81, 0x81, 0x12, 0x28, 0x12, 0x61, 0x22, 0x00, 0xb0, 0x54, 0x88, 0x31,
-  0x4a, 0x18, 0xc0, 0x92, 0x80, 0x98, 0x82, 0x18, 0x10, 0x44, 0x35, 0x24,
-  0x18, 0x31, 0x00, 0x40, 0x34, 0x14, 0x10, 0x22, 0x08, 0x86, 0x44, 0xcc,
-  0x14, 0x68, 0x9f, 0x46, 0x0e, 0x80, 0x02, 0x26, 0x42, 0x02, 0x43, 0x52,
-  0x21, 0x41, 0x14, 0x83, 0x11, 0x22, 0x88, 0x01, 0x44, 0x41, 0x81, 0x44,
-  0x23, 0x02, 0x10, 0xc1, 0x24, 0x00, 0x80, 0x81, 0x09, 0x11, 0x48, 0x00,
-  0x40, 0x94, 0x14, 0x28, 0x18, 0x60, 0x12, 0x00, 0x10, 0x04, 0x81, 0x00,
-  0x00, 0xc0, 0x28, 0x85, 0x34, 0x88, 0x20, 0x08, 0x88, 0x2f, 0x9c, 0x02,
-  0x44, 0x10, 0x42, 0xb1, 0x14, 0x02, 0x18, 0x00, 0x00, 0x00, 0x84, 0x00,
-  0x88, 0x10, 0x08, 0x41, 0x22, 0x44, 0x50, 0x84, 0x84, 0x53, 0x44, 0x32,
-  0x44, 0x84, 0x00, 0x86, 0x44, 0x04, 0x00, 0x00, 0x50, 0x22, 0x00, 0x88,
-  0x00, 0x00, 0x3c, 0x01, 0x10, 0x82, 0x88, 0x02, 0x22, 0x00, 0xf0, 0xda,
-  0x8c, 0x00, 0x28, 0x60, 0x32, 0x32, 0x21, 0x57, 0x82, 0x14, 0xe1, 0x21,
-  0x2c, 0x81, 0x81, 0x98, 0x88, 0x81, 0x44, 0x44, 0x84, 0x86, 0x6d, 0x82,
-  0x18, 0x1a, 0x62, 0x12, 0x26, 0x98, 0x24, 0x85, 0xf1, 0x45, 0x22, 0x18,
-  0x6b, 0x48, 0x81, 0xd6, 0x84, 0xd5, 0x48, 0x6c, 0x41, 0xa0, 0x18, 0x41,
-  0x2c, 0x28, 0x41, 0x42, 0x51, 0x42, 0x54, 0x49, 0x7a, 0x14, 0x12, 0x11,
-  0x08, 0x34, 0x44, 0x49, 0x51, 0x22, 0x28, 0x47, 0x8a, 0x81, 0x4b, 0x82,
-  0xcc, 0x48, 0x84, 0xfe, 0x4c, 0xe2, 0x90, 0x44, 0x10, 0x02, 0x41, 0x80,
-  0x01, 0x50, 0x41, 0x81, 0x00, 0x12, 0x42, 0x80, 0x08, 0x24, 0x50, 0x42,
-  0x40, 0x14, 0x14, 0x08, 0x00, 0x12, 0x40, 0x41, 0x02, 0x00, 0x45, 0x22,
-  0x21, 0x22, 0x88, 0x81, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x60, 0x88,
-  0x20, 0x08, 0x80, 0x41, 0xe2, 0x7d, 0x02, 0x40, 0x14, 0x04, 0x43, 0x44,
-  0x04, 0x00, 0x00, 0x80, 0x09, 0x20, 0x89, 0x21, 0x13, 0x02, 0x18, 0x00,
-  0x00, 0x84, 0x20, 0x02, 0x48, 0x00, 0x81, 0x21, 0x00, 0x50, 0x18, 0x10,
-  0x24, 0x38, 0x42, 0x40, 0x21, 0xc8, 0x82, 0x00, 0x41, 0x98, 0x48, 0x00,
-  0x44, 0x00, 0x00, 0xf0, 0xbc, 0xa1, 0x40, 0x01, 0x94, 0x45, 0x88, 0x22,
-  0x02, 0x4a, 0x41, 0x12, 0xd8, 0x28, 0x61, 0x94, 0x42, 0x86, 0x18, 0x01,
-  0x90, 0x41, 0xa4, 0x90, 0x44, 0x81, 0x68, 0x2a, 0x04, 0xc0, 0x19, 0x4c,
-  0x04, 0x83, 0x62, 0x29, 0x8e, 0x42, 0x80, 0x88, 0x11, 0x04, 0x21, 0x21,
-  0x10, 0x54, 0x41, 0x86, 0x48, 0x82, 0x04, 0x12, 0x13, 0x0c, 0x15, 0x48,
-  0x22, 0x11, 0x44, 0x88, 0xb9, 0x18, 0x14, 0x04, 0xf0, 0x73, 0xbe, 0x00,
-  0x46, 0x54, 0x14, 0x20, 0x82, 0x02, 0x48, 0x40, 0x58, 0x24, 0x48, 0x42,
-  0x22, 0x14, 0x98, 0x18, 0x18, 0xa1, 0x40, 0x02, 0x4a, 0x22, 0x05, 0x88,
-  0x16, 0x81, 0x02, 0x8c, 0x84, 0x18, 0x13, 0x18, 0x12, 0x08, 0x48, 0x85,
-  0x01, 0x44, 0x86, 0x34, 0x42, 0x88, 0x14, 0x82, 0x41, 0x80, 0x18, 0x84,
-  0x21, 0x14, 0x02, 0x20, 0xc1, 0x12, 0x00, 0x12, 0x1f, 0xca, 0x0d, 0x85,
-  0xb9, 0x48, 0xb4, 0x48, 0x34, 0x4c, 0x46, 0x14, 0x04, 0x18, 0x10, 0x72,
-  0x14, 0x5c, 0xc5, 0x4b, 0x2b, 0x8b, 0xa2, 0x22, 0x00, 0x19, 0x46, 0x02,
-  0x56, 0x56, 0x2a, 0x25, 0xa2, 0x31, 0x1a, 0xe1, 0x89, 0xb8, 0x88, 0x38,
-  0xc4, 0x80, 0x82, 0x71, 0xc1, 0x53, 0x11, 0x13, 0x78, 0x18, 0x58, 0xc8,
-  0x8b, 0x44, 0x2b, 0x44, 0x23, 0x04, 0x40, 0x45, 0x08, 0x29, 0x74, 0x84,
-  0xd6, 0x44, 0x71, 0x64, 0x01, 0x87, 0x18, 0x20, 0x11, 0x54, 0x84, 0x82,
-  0x46, 0x5a, 0x26, 0x25, 0xa2, 0x11, 0x3f, 0xdf, 0x04, 0x40, 0x04, 0x00,
-  0x00, 0x40, 0x02, 0x20, 0x01, 0x40, 0x01, 0x23, 0x08, 0x84, 0x48, 0x00,
-  0x00, 0x10, 0x08, 0x10, 0x64, 0x82, 0x12, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x04, 0x88, 0x24, 0x82, 0x42, 0x00, 0x10, 0x01, 0x40, 0x84, 0x81,
-  0x04, 0x00, 0x70, 0xf1, 0x0b, 0x81, 0x84, 0x42, 0x48, 0x00, 0x00, 0x8c,
-  0x24, 0x04, 0x45, 0x42, 0x24, 0x82, 0x03, 0x00, 0x00, 0x40, 0x02, 0x21,
-  0x12, 0x18, 0x13, 0xa8, 0x84, 0x10, 0x82, 0x02, 0x19, 0x61, 0x18, 0x10,
-  0x48, 0x2c, 0x84, 0x14, 0x01, 0x20, 0x01, 0x00, 0x41, 0x2d, 0x24, 0x22,
-  0x38, 0x80, 0x18, 0x88, 0x44, 0x24, 0x48, 0x02, 0x21, 0x5f, 0x6a, 0x03,
-  0x84, 0x42, 0x48, 0x1d, 0x62, 0x15, 0x12, 0x14, 0x88, 0x02, 0x00, 0x44,
-  0x44, 0x28, 0x28, 0x00, 0x20, 0x41, 0x81, 0x08, 0x35, 0x38, 0x12, 0x18,
-  0x18, 0x88, 0x88, 0x00, 0x30, 0x11, 0x14, 0x14, 0x40, 0x08, 0x48, 0x15,
-  0x02, 0x00, 0x20, 0x08, 0x41, 0x16, 0x04, 0x28, 0x00, 0x00, 0x00, 0x24,
-  0x10, 0x32, 0x12, 0x5f, 0x68, 0x05, 0x80, 0x04, 0x00, 0x00, 0x00, 0x40,
-  0x04, 0x28, 0x00, 0x00, 0x60, 0x44, 0x20, 0x14, 0x02, 0x18, 0x80, 0x08,
-  0x00, 0x00, 0x14, 0x40, 0x44, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44,
-  0x80, 0x02, 0x00, 0x21, 0x00, 0x00, 0x21, 0x80, 0xf1, 0x55, 0xe8, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x20, 0x18, 0x08, 0x00, 0x10, 0x11, 0x42, 0x08,
-  0x20, 0x02, 0x20, 0x02, 0x00, 0x10, 0x12, 0x04, 0x00, 0x30, 0x12, 0x00,
-  0x60, 0x18, 0x00, 0x83, 0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0x10, 0x08,
-  0x42, 0x40, 0x08, 0xeb, 0x31, 0x10, 0x78, 0x48, 0xa8, 0x44, 0x4a, 0x04,
-  0x40, 0x01, 0x42, 0x84, 0x41, 0xc5, 0x74, 0x24, 0xa4, 0x62, 0x2a, 0x02,
-  0x00, 0x10, 0x44, 0x42, 0x56, 0x26, 0x23, 0x21, 0xa1, 0x19, 0x8a, 0xa8,
-  0x88, 0x8c, 0x04, 0x10, 0x73, 0x11, 0x51, 0x11, 0x81, 0x8d, 0x98, 0x87,
-  0x84, 0x42, 0x4a, 0x04, 0x00, 0x00, 0x14, 0x41, 0x41, 0x47, 0x42, 0x22,
-  0x2a, 0x04, 0x80, 0x01, 0x41, 0x24, 0x45, 0x52, 0x22, 0x23, 0xf1, 0xd9,
-  0x43, 0x00, 0x81, 0x41, 0x42, 0x28, 0x00, 0x11, 0x00, 0x00, 0xcd, 0x42,
-  0x20, 0x02, 0x00, 0x80, 0x12, 0x04, 0x24, 0x11, 0x20, 0x01, 0x82, 0x00,
-  0x20, 0x84, 0x38, 0x11, 0x00, 0x83, 0x01, 0x42, 0x41, 0x00, 0x00, 0x81,
-  0x20, 0x54, 0x84, 0x28, 0x28, 0x12, 0x80, 0x08, 0x00, 0x40, 0x12, 0xf4,
-  0x1e, 0x3f, 0x00, 0x00, 0x14, 0x40, 0x04, 0x10, 0x48, 0x01, 0x48, 0x00,
-  0x42, 0x12, 0x90, 0x84, 0x00, 0x82, 0x20, 0x42, 0x24, 0x82, 0x42, 0x08,
-  0x50, 0x28, 0x42, 0x24, 0x00, 0x00, 0x88, 0x43, 0x08, 0x40, 0x01, 0x11,
-  0x00, 0x84, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x41, 0xf0, 0x1e, 0xbc,
-  0x00, 0x00, 0x00, 0x14, 0x20, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x50, 0x81, 0x00, 0x81, 0x20, 0x04, 0x00, 0x00, 0x10, 0x04, 0x00, 0x6f,
-  0xf3, 0x0f, 0x00, 0x40, 0xc1, 0x22, 0x00, 0x40, 0x1a, 0x11, 0x28, 0x04,
-  0x42, 0x12, 0x24, 0x23, 0xc8, 0x88, 0x1e, 0x44, 0x10, 0x04, 0x22, 0x00,
-  0x40, 0x28, 0x04, 0xa5, 0x88, 0x86, 0xe4, 0x28, 0x61, 0x21, 0x12, 0x12,
-  0x41, 0x50, 0x11, 0x44, 0x11, 0x11, 0x50, 0x21, 0x81, 0x20, 0x15, 0x18,
-  0x22, 0x01, 0x82, 0xcc, 0x09, 0x44, 0x43, 0x18, 0x04, 0x70, 0x24, 0x0f,
-  0x10, 0x44, 0x34, 0x21, 0x21, 0x45, 0x14, 0xb1, 0x11, 0x22, 0xb4, 0x88,
-  0x04, 0x12, 0x83, 0x14, 0x02, 0x11, 0x00, 0x81, 0x53, 0xa2, 0x24, 0x10,
-  0x49, 0x21, 0x12, 0x08, 0x24, 0x10, 0x44, 0x62, 0x24, 0x12, 0x49, 0x08,
-  0x82, 0x82, 0x82, 0x40, 0x13, 0x94, 0x18, 0x1a, 0x88, 0x28, 0x08, 0x24,
-  0x20, 0x44, 0xc1, 0x12, 0x00, 0x89, 0x94, 0x44, 0x42, 0x10, 0x08, 0x4f,
-  0x3e, 0x05, 0x00, 0x00, 0x14, 0x11, 0x84, 0x22, 0x99, 0x04, 0x50, 0x28,
-  0x00, 0x46, 0x81, 0x01, 0x41, 0x80, 0xa4, 0x88, 0x41, 0x41, 0x43, 0x02,
-  0x22, 0x11, 0xc0, 0x4c, 0x2c, 0x82, 0x81, 0x01, 0x00, 0x20, 0x41, 0x24,
-  0x18, 0x02, 0x10, 0x11, 0x18, 0x91, 0x48, 0x81, 0x42, 0x20, 0x04, 0x00,
-  0x12, 0x00, 0x10, 0x14, 0xf4, 0x6d, 0xa8, 0xf0, 0x26, 0x26, 0x2d, 0x22,
-  0x2a, 0xb1, 0x12, 0x01, 0x29, 0x01, 0x2c, 0x51, 0x22, 0x29, 0xf8, 0x12,
-  0x13, 0x3f, 0x11, 0xb1, 0x81, 0xe9, 0x99, 0xd9, 0x88, 0xf8, 0x88, 0x41,
-  0x4e, 0x48, 0x42, 0x1d, 0x49, 0x15, 0xc1, 0x41, 0x95, 0x59, 0x88, 0x4e,
-  0x48, 0x8f, 0xc4, 0xd4, 0x44, 0xb4, 0x44, 0xe2, 0x42, 0x22, 0xc2, 0x24,
-  0x80, 0x52, 0x44, 0x45, 0xe4, 0x42, 0x72, 0x26, 0x56, 0x22, 0x2a, 0xb1,
-  0x12, 0xa1, 0x81, 0x2b, 0x98, 0x82, 0x2c, 0x59, 0x22, 0x29, 0xf8, 0x12,
-  0x13, 0x3f, 0x11, 0xb1, 0x81, 0xe9, 0x99, 0xd9, 0x88, 0xb8, 0x88, 0xe4,
-  0x84, 0x24, 0xc4, 0x48, 0x80, 0x54, 0x88, 0x85, 0xe8, 0x84, 0xf4, 0x1e,
-  0x89, 0xf0, 0x26, 0x22, 0x25, 0xa2, 0x12, 0x1a, 0x32, 0x12, 0x00, 0x50,
-  0x22, 0x31, 0x3c, 0xf1, 0x11, 0x11, 0x99, 0xe8, 0x89, 0x5c, 0x98, 0x8b,
-  0x48, 0x4a, 0x6c, 0x84, 0x14, 0x1d, 0x41, 0x50, 0x81, 0x85, 0x98, 0x44,
-  0x8f, 0x44, 0x56, 0x44, 0x4b, 0x24, 0x2a, 0x66, 0x42, 0x80, 0x82, 0x42,
-  0x54, 0x64, 0x28, 0x6f, 0x22, 0x72, 0x12, 0x82, 0xa9, 0x11, 0x2b, 0x81,
-  0x8a, 0xa8, 0x18, 0xd0, 0x22, 0x18, 0xc3, 0x13, 0x1f, 0x11, 0x91, 0x89,
-  0x9e, 0xc8, 0x85, 0xb9, 0x88, 0xa4, 0xc4, 0x46, 0x08, 0x48, 0x40, 0x58,
-  0x88, 0x49, 0xf4, 0x48, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x20, 0x64, 0x14, 0x14, 0x48, 0x84, 0x45, 0x98, 0x44, 0x16, 0x18,
-  0x22, 0x12, 0x24, 0x08, 0x40, 0x94, 0x21, 0x4c, 0xa2, 0x21, 0x1e, 0x26,
-  0x82, 0x8b, 0x21, 0x30, 0x18, 0x27, 0x88, 0x30, 0x22, 0x44, 0x88, 0x29,
-  0x19, 0x02, 0x1b, 0x84, 0x42, 0x1c, 0x18, 0x28, 0x24, 0x44, 0x41, 0x48,
-  0x58, 0x84, 0x48, 0x84, 0xb0, 0x85, 0x84, 0x21, 0x01, 0x44, 0x40, 0x44,
-  0x02, 0x16, 0x22, 0x21, 0x09, 0x83, 0x01, 0x4f, 0x61, 0x49, 0x12, 0x41,
-  0x18, 0x5a, 0x29, 0x46, 0x87, 0x94, 0x28, 0x43, 0xd6, 0x24, 0xf6, 0x14,
-  0xc3, 0x22, 0x22, 0x43, 0x42, 0x74, 0xa1, 0x12, 0x14, 0x52, 0x63, 0x84,
-  0x13, 0xf3, 0x82, 0x41, 0xab, 0x81, 0x88, 0x12, 0x2f, 0x44, 0x78, 0x91,
-  0xc2, 0x13, 0x13, 0xc1, 0x2d, 0x1f, 0x81, 0xe8, 0x9c, 0x61, 0x81, 0x83,
-  0x98, 0x48, 0x17, 0x44, 0x25, 0x91, 0x19, 0x84, 0x1b, 0x48, 0x2f, 0x54,
-  0x29, 0xd4, 0x84, 0xe1, 0x44, 0x71, 0x46, 0x42, 0x42, 0x25, 0x98, 0x94,
-  0x70, 0x41, 0x76, 0x48, 0x12, 0xe4, 0x61, 0x44, 0xcc, 0xc2, 0x42, 0x2b,
-  0x81, 0xc2, 0x6f, 0x28, 0xf1, 0x2a, 0x1d, 0x10, 0x02, 0x20, 0x94, 0x4a,
-  0x41, 0x22, 0x56, 0x02, 0x44, 0x44, 0x2a, 0x88, 0x42, 0x04, 0x54, 0x10,
-  0x31, 0x28, 0x86, 0x61, 0x84, 0x25, 0x08, 0x18, 0x41, 0x2a, 0x99, 0x14,
-  0x82, 0x16, 0x14, 0x82, 0x44, 0x08, 0x42, 0xa4, 0x11, 0x10, 0x48, 0x23,
-  0x08, 0x48, 0x42, 0x90, 0x82, 0x17, 0x41, 0x20, 0x08, 0x34, 0x49, 0x04,
-  0x40, 0x02, 0x21, 0x21, 0x5a, 0x88, 0xf1, 0x19, 0x82, 0x00, 0x9d, 0x42,
-  0x84, 0x11, 0x24, 0x8c, 0x04, 0x10, 0xf4, 0x52, 0xa1, 0x21, 0x00, 0x30,
-  0xa1, 0x00, 0xc0, 0x14, 0x29, 0xe2, 0x18, 0x22, 0xc1, 0x88, 0xa3, 0x88,
-  0x44, 0x02, 0x21, 0x28, 0x91, 0x30, 0xd1, 0x88, 0x81, 0x44, 0x90, 0x51,
-  0x90, 0x88, 0x12, 0x43, 0x24, 0x91, 0x14, 0x61, 0x15, 0x06, 0x1a, 0x88,
-  0x01, 0x49, 0x44, 0x48, 0x82, 0xc4, 0x18, 0xc8, 0xc2, 0x12, 0x84, 0x41,
-  0xac, 0x47, 0x21, 0x04, 0x40, 0x48, 0x05, 0x44, 0x45, 0x08, 0x20, 0x02,
-  0x44, 0x40, 0x62, 0x22, 0x28, 0x49, 0x11, 0x02, 0x21, 0x20, 0x01, 0x88,
-  0x14, 0x80, 0x91, 0x88, 0x30, 0x11, 0x00, 0x90, 0x41, 0x48, 0x00, 0xc0,
-  0x41, 0x40, 0x18, 0x28, 0x04, 0x00, 0x44, 0x41, 0x00, 0x41, 0x41, 0x25,
-  0x04, 0x00, 0x20, 0xf8, 0xac, 0xf1, 0x10, 0x01, 0x11, 0x00, 0x90, 0x48,
-  0x22, 0x62, 0x00, 0x00, 0x40, 0x04, 0x41, 0x29, 0x02, 0x12, 0x12, 0x82,
-  0x40, 0x42, 0x02, 0x14, 0x11, 0x31, 0x98, 0x86, 0x08, 0x46, 0xc8, 0x81,
-  0x00, 0x84, 0x11, 0x48, 0xc4, 0x81, 0x41, 0x00, 0x42, 0x00, 0x00, 0x40,
-  0x02, 0x18, 0x80, 0x21, 0x21, 0x48, 0x02, 0x5f, 0xfb, 0x02, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x21, 0x59, 0x00, 0x11, 0x00, 0x1e, 0x21,
-  0x10, 0x48, 0x35, 0x42, 0x20, 0x44, 0x02, 0x85, 0x75, 0x42, 0x08, 0x21,
-  0x44, 0x1a, 0x18, 0x04, 0x00, 0x86, 0x84, 0x28, 0x92, 0x11, 0x84, 0x90,
-  0x63, 0x49, 0x04, 0x21, 0x28, 0x13, 0x08, 0x23, 0x11, 0x08, 0x84, 0x80,
-  0x91, 0x51, 0x87, 0x11, 0x11, 0x56, 0x08, 0x42, 0x24, 0x42, 0x20, 0x14,
-  0x24, 0x02, 0x86, 0x08, 0x16, 0x88, 0xf4, 0x72, 0xfe, 0x80, 0x04, 0x81,
-  0x90, 0x48, 0x19, 0x92, 0x42, 0x28, 0xa0, 0x28, 0x8b, 0x82, 0x19, 0x8a,
-  0x88, 0x08, 0x27, 0x18, 0x1b, 0x81, 0x88, 0x25, 0xa2, 0x24, 0xa8, 0x17,
-  0xc6, 0x18, 0x11, 0x2c, 0x12, 0x34, 0x42, 0x41, 0x1c, 0x38, 0x14, 0x1a,
-  0xc2, 0x48, 0x8e, 0x14, 0x44, 0x6c, 0x41, 0x01, 0x4c, 0x48, 0x04, 0x96,
-  0x71, 0x42, 0x5c, 0x48, 0x44, 0x21, 0x88, 0x21, 0x12, 0x43, 0x88, 0x58,
-  0x24, 0x12, 0x90, 0x82, 0x96, 0x88, 0x32, 0x44, 0x82, 0x88, 0x8f, 0xf2,
-  0x03, 0x00, 0x81, 0xf0, 0x58, 0x21, 0x14, 0x83, 0x14, 0x01, 0x40, 0xa8,
-  0x28, 0x23, 0xd8, 0xa5, 0x78, 0x48, 0x82, 0x88, 0x68, 0x48, 0x2b, 0x81,
-  0x43, 0x26, 0x98, 0x25, 0x30, 0x84, 0xa2, 0x23, 0x62, 0x11, 0x81, 0x86,
-  0xb1, 0x23, 0x34, 0x44, 0xac, 0xb4, 0x14, 0x28, 0x32, 0x91, 0x35, 0x82,
-  0x41, 0x4c, 0x44, 0xc8, 0x12, 0xcb, 0x14, 0x1f, 0xc1, 0xc4, 0x11, 0x25,
-  0x31, 0x18, 0xa0, 0x14, 0x41, 0x23, 0x04, 0x58, 0x41, 0x88, 0x81, 0x8c,
-  0x48, 0xc4, 0x18, 0xe0, 0x91, 0x0d, 0x48, 0x11, 0x00, 0x80, 0x12, 0xc2,
-  0x24, 0x23, 0xa4, 0x28, 0x6a, 0x18, 0x01, 0x00, 0x11, 0x2d, 0x11, 0x40,
-  0x02, 0x28, 0x8c, 0x84, 0x11, 0x01, 0x45, 0x22, 0x14, 0x04, 0x49, 0xa1,
-  0x21, 0x00, 0x41, 0x44, 0x00, 0x88, 0x00, 0x13, 0x08, 0x10, 0x0c, 0x4e,
-  0x82, 0x00, 0x82, 0x88, 0x41, 0x21, 0x90, 0x22, 0x92, 0x28, 0x48, 0x88,
-  0x8a, 0xf4, 0x67, 0x96, 0x10, 0x02, 0x21, 0x4c, 0x02, 0x28, 0x80, 0x42,
-  0x22, 0x01, 0x80, 0x28, 0x11, 0x0a, 0x81, 0x40, 0x01, 0x00, 0x44, 0x41,
-  0x00, 0x14, 0x48, 0x80, 0x45, 0x84, 0x05, 0x00, 0x21, 0x28, 0x18, 0x00,
-  0x12, 0x42, 0x10, 0x04, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x14,
-  0x08, 0x5f, 0xaa, 0x02, 0x42, 0x40, 0x04, 0x36, 0x22, 0x61, 0x22, 0x84,
-  0x16, 0x04, 0x46, 0x22, 0x22, 0x94, 0x42, 0x10, 0x42, 0x41, 0xb4, 0x22,
-  0x34, 0x12, 0x47, 0x11, 0x4b, 0x21, 0x20, 0xa2, 0x24, 0x29, 0xc2, 0x22,
-  0x4c, 0x51, 0x12, 0x21, 0x21, 0x61, 0x80, 0xe1, 0x18, 0x11, 0x54, 0x34,
-  0x3c, 0x28, 0xb8, 0x12, 0x42, 0x83, 0x61, 0x11, 0x11, 0x1c, 0x81, 0x04,
-  0x81, 0x48, 0x21, 0x82, 0x4c, 0x0c, 0x82, 0x80, 0x02, 0x22, 0x24, 0xaf,
-  0xb5, 0x0c, 0x00, 0x00, 0x22, 0x18, 0x22, 0x21, 0x20, 0x61, 0x24, 0xa0,
-  0x84, 0x00, 0x10, 0x09, 0x26, 0x01, 0x00, 0xc0, 0x24, 0x28, 0x00, 0x16,
-  0x54, 0x22, 0x10, 0x82, 0x01, 0x18, 0x82, 0x61, 0x26, 0x44, 0xc1, 0x82,
-  0x22, 0x80, 0x04, 0x80, 0x81, 0x04, 0x84, 0x46, 0x02, 0x88, 0x44, 0x20,
-  0x08, 0x00, 0x84, 0x24, 0xff, 0x51, 0x0c, 0x23, 0x04, 0x61, 0x4c, 0xc2,
-  0x12, 0x28, 0xc0, 0x28, 0x43, 0x11, 0x02, 0x28, 0xb0, 0x42, 0x11, 0x1a,
-  0x02, 0x41, 0x23, 0x34, 0x12, 0x17, 0x41, 0x4b, 0x12, 0x41, 0x60, 0x24,
-  0x22, 0x17, 0x22, 0x48, 0x14, 0x58, 0x45, 0xc2, 0x44, 0x00, 0x13, 0x01,
-  0x15, 0xe2, 0x28, 0x01, 0x12, 0x17, 0x21, 0x18, 0x13, 0x51, 0x41, 0x11,
-  0x00, 0x80, 0x01, 0x20, 0x0c, 0x00, 0x28, 0x2a, 0x84, 0x02, 0xcf, 0xf5,
-  0x0b, 0x50, 0x22, 0x10, 0x14, 0x54, 0x41, 0x54, 0x10, 0x26, 0x36, 0x44,
-  0x6e, 0x12, 0x42, 0x2a, 0x28, 0x21, 0x08, 0x11, 0x4b, 0x81, 0x2a, 0x44,
-  0x22, 0x8a, 0xe1, 0x71, 0x88, 0x82, 0x42, 0x42, 0x44, 0x05, 0x92, 0x10,
-  0x02, 0x18, 0x11, 0x21, 0xb0, 0x92, 0x42, 0x82, 0x81, 0x28, 0x84, 0xc2,
-  0x84, 0x45, 0xa8, 0x82, 0x50, 0x16, 0x48, 0x29, 0x15, 0x44, 0x84, 0x94,
-  0x48, 0xc1, 0x41, 0x00, 0xaf, 0xf8, 0x0b, 0xc0, 0x14, 0x48, 0x00, 0x00,
-  0x14, 0x10, 0x91, 0x14, 0x81, 0x20, 0x02, 0x10, 0x02, 0x00, 0x24, 0x00,
-  0x12, 0xa0, 0x48, 0x28, 0x00, 0x00, 0x13, 0x01, 0x00, 0x30, 0x14, 0x11,
-  0x90, 0x5a, 0x11, 0x18, 0x20, 0x01, 0x45, 0x82, 0x24, 0x02, 0x41, 0x44,
-  0x12, 0x81, 0x20, 0x48, 0x12, 0x08, 0x12, 0xef, 0x47, 0x0c, 0x12, 0x22,
-  0x00, 0x10, 0x08, 0x22, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x81, 0x00, 0x00, 0x10, 0x12, 0x44, 0x04, 0x4c, 0x24, 0x42, 0x32, 0x54,
-  0x40, 0x04, 0x40, 0x04, 0x14, 0x4a, 0x08, 0x14, 0x20, 0x01, 0x00, 0xe0,
-  0x28, 0x81, 0x08, 0x42, 0x10, 0x38, 0x44, 0x6f, 0xe3, 0x01, 0x2c, 0xe1,
-  0x42, 0x11, 0x12, 0x14, 0x44, 0x05, 0x19, 0x02, 0x2e, 0x41, 0x88, 0x89,
-  0x34, 0x42, 0x88, 0x00, 0x40, 0x21, 0x21, 0x02, 0x1a, 0xca, 0x18, 0x13,
-  0x08, 0x48, 0x28, 0x41, 0x25, 0x05, 0x43, 0x81, 0x01, 0x20, 0xf1, 0x14,
-  0x41, 0x29, 0x51, 0x14, 0x2d, 0x92, 0x8d, 0x52, 0x1d, 0x14, 0x40, 0xa1,
-  0xb4, 0x88, 0x15, 0x2a, 0x28, 0x11, 0x85, 0xb4, 0x44, 0xc1, 0x14, 0xe4,
-  0xc2, 0x8a, 0x64, 0xc4, 0xc1, 0x84, 0x49, 0xf4, 0x4b, 0xe2, 0x00, 0x00,
-  0x00, 0x84, 0x45, 0x01, 0x61, 0xa0, 0x14, 0x1a, 0x02, 0x80, 0x21, 0x18,
-  0x02, 0x4c, 0x88, 0x04, 0x00, 0x45, 0x82, 0x22, 0x02, 0x21, 0x10, 0x24,
-  0x48, 0x62, 0x44, 0x22, 0x10, 0x42, 0x04, 0x28, 0x00, 0x98, 0x48, 0x40,
-  0x04, 0x68, 0x24, 0x40, 0x06, 0x20, 0x09, 0x84, 0x00, 0x00, 0xef, 0x9a,
-  0x05, 0x00, 0x64, 0x00, 0x41, 0x10, 0x04, 0x00, 0x12, 0x21, 0x20, 0x62,
-  0x62, 0x00, 0x45, 0x02, 0x28, 0x4e, 0x14, 0x40, 0x06, 0x00, 0x2b, 0x14,
-  0x80, 0x22, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x41, 0x00,
-  0x00, 0x00, 0x00, 0x4c, 0x04, 0x18, 0x00, 0xd0, 0x52, 0x43, 0x42, 0xc4,
-  0x22, 0x00, 0x40, 0xc2, 0x22, 0x1a, 0x82, 0x22, 0x29, 0x12, 0x02, 0x92,
-  0x10, 0x21, 0x22, 0x8a, 0x91, 0x11, 0x00, 0x30, 0x21, 0x68, 0x00, 0x24,
-  0x22, 0x18, 0x80, 0x01, 0x12, 0x18, 0x23, 0x03, 0x80, 0x42, 0xa2, 0x24,
-  0x00, 0x45, 0x22, 0x8c, 0x22, 0x56, 0x24, 0xc2, 0x00, 0x48, 0x82, 0x84,
-  0x48, 0x28, 0x22, 0x80, 0xf4, 0xf3, 0xd7, 0x40, 0x16, 0x44, 0x14, 0x04,
-  0x12, 0x00, 0x27, 0x41, 0x49, 0x93, 0x14, 0x21, 0x00, 0x18, 0x00, 0x25,
-  0x16, 0xf4, 0x22, 0x12, 0x18, 0x28, 0x22, 0x80, 0x84, 0x31, 0x22, 0x96,
-  0x54, 0x24, 0x16, 0x22, 0x32, 0x11, 0x12, 0x40, 0x02, 0x49, 0x01, 0x00,
-  0x42, 0x00, 0x20, 0x04, 0x42, 0x41, 0x42, 0x22, 0x00, 0x44, 0x84, 0x84,
-  0x24, 0x00, 0xb0, 0x8b, 0x02, 0x14, 0x10, 0x82, 0x01, 0x48, 0x8d, 0x13,
-  0x00, 0x40, 0x81, 0x24, 0x01, 0x80, 0xa4, 0x12, 0x00, 0xa0, 0x24, 0x30,
-  0x12, 0x80, 0x81, 0x26, 0x25, 0x22, 0xa1, 0x84, 0xc0, 0x42, 0x40, 0x02,
-  0x4e, 0x81, 0x21, 0xc0, 0x14, 0x4a, 0x08, 0x14, 0x22, 0x42, 0xf0, 0x44,
-  0x21, 0x20, 0x04, 0x00, 0x80, 0x02, 0x28, 0x48, 0xa0, 0x42, 0x44, 0xcf,
-  0x9a, 0x49, 0x42, 0x02, 0x70, 0x26, 0x42, 0x2a, 0x01, 0x2a, 0x01, 0x49,
-  0x02, 0x10, 0x2a, 0x01, 0x00, 0x44, 0x00, 0x20, 0x04, 0x28, 0x21, 0x48,
-  0xe0, 0x44, 0x22, 0x25, 0x14, 0x92, 0x41, 0x4a, 0x21, 0x24, 0x24, 0x04,
-  0x44, 0x21, 0x42, 0x00, 0x68, 0x46, 0x44, 0x24, 0x04, 0x42, 0x80, 0xa5,
-  0x42, 0x48, 0x48, 0x49, 0xa1, 0x42, 0x24, 0x00, 0x18, 0x6e, 0x94, 0x40,
-  0xc8, 0x14, 0x28, 0x48, 0x00, 0x00, 0x00, 0x12, 0x20, 0x01, 0x14, 0x2a,
-  0x01, 0x18, 0x21, 0x2a, 0x04, 0x70, 0x12, 0x02, 0x10, 0x42, 0x02, 0x20,
-  0x02, 0x00, 0x80, 0x01, 0x00, 0x49, 0x01, 0x00, 0x44, 0x1a, 0x08, 0x80,
-  0x02, 0x40, 0x01, 0x18, 0x00, 0x00, 0x2a, 0x04, 0xf0, 0xca, 0x46, 0x00,
-  0x28, 0x48, 0x80, 0x83, 0x82, 0x02, 0x29, 0x03, 0x28, 0x3a, 0x58, 0x41,
-  0x20, 0x82, 0x08, 0x66, 0x01, 0x82, 0x60, 0x19, 0x21, 0xa0, 0x1a, 0x11,
-  0x88, 0x11, 0x22, 0x11, 0x44, 0x21, 0x20, 0x01, 0x18, 0x90, 0x12, 0x80,
-  0x81, 0x22, 0x18, 0x02, 0x00, 0x29, 0x18, 0x81, 0x42, 0x82, 0x48, 0x02,
-  0x60, 0xa8, 0x28, 0x86, 0x04, 0xc2, 0x6f, 0x5b, 0x0d, 0x00, 0x80, 0x01,
-  0x00, 0x40, 0x44, 0x02, 0x40, 0x44, 0x22, 0x01, 0x12, 0x12, 0x00, 0x18,
-  0x22, 0x10, 0x46, 0x22, 0x03, 0x10, 0x04, 0x2a, 0x01, 0x00, 0x44, 0x24,
-  0x22, 0x18, 0x00, 0x41, 0x00, 0x20, 0x22, 0x01, 0x00, 0x10, 0x04, 0x00,
-  0x00, 0xc0, 0x22, 0xf0, 0x16, 0xf1, 0x40, 0x08, 0x1c, 0x06, 0x2f, 0x12,
-  0x51, 0x22, 0x80, 0x44, 0x81, 0x04, 0x44, 0x80, 0x06, 0x00, 0x21, 0x00,
-  0x2d, 0x42, 0x10, 0x02, 0x18, 0x90, 0xd2, 0x24, 0x24, 0x40, 0x82, 0x28,
-  0xd4, 0x21, 0x08, 0x84, 0x2c, 0xc1, 0xc5, 0x60, 0x11, 0x12, 0x42, 0x48,
-  0x26, 0x01, 0x40, 0x04, 0x28, 0x80, 0x04, 0x41, 0x42, 0x41, 0x00, 0x40,
-  0xf4, 0xd6, 0x24, 0x24, 0x41, 0x61, 0x27, 0x22, 0x45, 0x16, 0x92, 0x12,
-  0x16, 0x82, 0x51, 0x14, 0x4f, 0x4a, 0xd1, 0x21, 0x81, 0x13, 0x89, 0xb5,
-  0x32, 0xf2, 0x41, 0x14, 0x18, 0x4f, 0x65, 0x41, 0x82, 0x6a, 0x21, 0x4e,
-  0x14, 0x36, 0x02, 0x68, 0x1e, 0x13, 0x2a, 0x71, 0xd4, 0x44, 0xa4, 0x41,
-  0x2b, 0x22, 0x13, 0x91, 0x16, 0x1c, 0x84, 0xa1, 0x51, 0x2d, 0x22, 0x4c,
-  0x39, 0x24, 0x9e, 0x12, 0x66, 0xa4, 0x48, 0x2e, 0x44, 0x14, 0xc6, 0x14,
-  0x21, 0x14, 0x21, 0x24, 0xb4, 0x22, 0xa4, 0x14, 0x90, 0x44, 0xc9, 0x68,
-  0x23, 0x41, 0x28, 0xf0, 0x72, 0xb7, 0x50, 0x42, 0x64, 0x45, 0xb4, 0x52,
-  0x72, 0x18, 0xf3, 0x14, 0x22, 0x37, 0x82, 0x69, 0x62, 0x43, 0x48, 0x23,
-  0xe2, 0x25, 0xc8, 0x14, 0x82, 0x18, 0x28, 0x36, 0x52, 0x12, 0x45, 0xf4,
-  0x23, 0x12, 0x29, 0xa4, 0xc2, 0x18, 0x47, 0x22, 0x24, 0x23, 0x42, 0xf2,
-  0x22, 0x41, 0x6f, 0x21, 0x76, 0x22, 0xc2, 0x14, 0x21, 0x5a, 0xe4, 0x21,
-  0xe9, 0x21, 0x64, 0x2c, 0x43, 0x31, 0x12, 0x1e, 0x14, 0x14, 0x12, 0x11,
-  0x2b, 0x24, 0x2c, 0x01, 0x28, 0x2a, 0x0a, 0x82, 0x18, 0x43, 0x84, 0x34,
-  0x42, 0x85, 0xac, 0x66, 0x48, 0x2a, 0xa8, 0x42, 0x6d, 0x44, 0x5f, 0x3a,
-  0x0a, 0x15, 0xa2, 0x23, 0x1c, 0x82, 0xa1, 0x32, 0x42, 0x28, 0x3e, 0x42,
-  0x29, 0xa3, 0x21, 0x1e, 0x24, 0x21, 0x63, 0x21, 0x11, 0xe1, 0x22, 0x88,
-  0xa2, 0x2a, 0x23, 0x21, 0xa5, 0x36, 0x1e, 0x21, 0xd0, 0x43, 0xb2, 0x62,
-  0xa8, 0x64, 0x2b, 0x45, 0x2c, 0xa3, 0x12, 0xce, 0x31, 0x16, 0xe2, 0x14,
-  0x0d, 0x50, 0x42, 0x33, 0x82, 0x51, 0x34, 0xa0, 0x44, 0x68, 0x42, 0xf0,
-  0xe4, 0x44, 0x49, 0xe6, 0x46, 0x95, 0x42, 0x4f, 0x64, 0x84, 0x34, 0x21,
-  0x88, 0xf0, 0x84, 0x24, 0x4a, 0x41, 0x98, 0x22, 0x29, 0x06, 0x5a, 0xf8,
-  0x8d, 0x5e, 0x10, 0x01, 0x11, 0x22, 0x11, 0x62, 0x11, 0x42, 0x13, 0xa1,
-  0x84, 0x13, 0xa1, 0x86, 0x11, 0x4a, 0x18, 0xe1, 0x14, 0x08, 0x4e, 0x81,
-  0xc0, 0x83, 0xc0, 0x81, 0xc0, 0x81, 0x40, 0x91, 0x12, 0x14, 0x60, 0x18,
-  0x18, 0x82, 0x20, 0x08, 0x13, 0x08, 0x13, 0x08, 0x13, 0x18, 0x32, 0x81,
-  0x21, 0x13, 0xb8, 0x22, 0x18, 0x91, 0x82, 0x11, 0x29, 0x08, 0x29, 0x08,
-  0x29, 0x08, 0x29, 0x08, 0x88, 0x80, 0xf8, 0x8d, 0xa6, 0x14, 0x1f, 0x16,
-  0x56, 0x33, 0x1f, 0x61, 0xf1, 0x34, 0x77, 0x8f, 0x95, 0xf5, 0x41, 0x61,
-  0x6f, 0x47, 0xf7, 0x64, 0x25, 0x6f, 0x52, 0xf7, 0x25, 0xe7, 0x2b, 0xdc,
-  0x1f, 0x38, 0xfa, 0x8b, 0xc9, 0x1d, 0xd3, 0x2b, 0xdc, 0xae, 0xa1, 0x1f,
-  0x1f, 0xff, 0x77, 0xf5, 0x7f, 0x5b, 0xeb, 0x1e, 0xfe, 0xa1, 0xc1, 0x5f,
-  0x56, 0xf6, 0x85, 0x85, 0x4f, 0x7a, 0xfa, 0x63, 0x63, 0x1f, 0x36, 0xd6,
-  0x33, 0xf5, 0x46, 0xc6, 0x5f, 0x1b, 0xfa, 0xf1, 0xe1, 0x7f, 0x5b, 0xa8,
-  0x4c, 0xc8, 0x4e, 0xc2, 0x5f, 0x58, 0xf8, 0x41, 0x41, 0x3f, 0x13, 0xd9,
-  0x61, 0xf8, 0x82, 0x85, 0x6e, 0x61, 0x7f, 0x7d, 0xfd, 0xe2, 0xe2, 0x6f,
-  0x7e, 0xfa, 0x52, 0x51, 0x3f, 0x74, 0xfe, 0x92, 0xd2, 0x3f, 0x3c, 0xfc,
-  0xc3, 0xc1, 0x2f, 0x24, 0xfc, 0xd3, 0xd3, 0x6f, 0x6e, 0xba, 0xd2, 0xdd,
-  0x64, 0xf8, 0xd2, 0xda, 0x6f, 0x4e, 0xaa, 0xcc, 0x4f, 0x44, 0xa4, 0xcc,
-  0x4f, 0x2c, 0xfc, 0x29, 0xe1, 0xe0, 0x62, 0xf2, 0x43, 0x47, 0x7f, 0x41,
-  0xf1, 0x34, 0x75, 0x8f, 0x91, 0x51, 0x31, 0x7f, 0x77, 0xf7, 0x66, 0x25,
-  0x2f, 0x53, 0xf5, 0x35, 0xe7, 0x3f, 0x5d, 0xac, 0x54, 0xaf, 0x81, 0xd7,
-  0x31, 0xfc, 0xc3, 0xe1, 0x6e, 0x61, 0x1f, 0x13, 0xf3, 0x24, 0xa6, 0x4f,
-  0x2e, 0xfe, 0x22, 0x21, 0x3f, 0x36, 0xf6, 0xe6, 0xf4, 0x4f, 0x4b, 0xfb,
-  0xa4, 0xb7, 0x1f, 0x36, 0xf4, 0xe2, 0xf2, 0x2f, 0x27, 0xf7, 0x67, 0xe5,
-  0x7f, 0x56, 0xf7, 0x62, 0x62, 0x4f, 0x6a, 0xba, 0xc1, 0xa4, 0xd5, 0x5a,
-  0xfd, 0xdc, 0xde, 0x2b, 0xcd, 0x3f, 0x96, 0xdd, 0x21, 0xf9, 0x96, 0xd1,
-  0xfe, 0xe1, 0x7f, 0x75, 0xf1, 0x63, 0x61, 0x4f, 0x5e, 0xfe, 0x94, 0xd1,
-  0x3f, 0x74, 0xfe, 0xd3, 0xd5, 0x4a, 0xe4, 0x46, 0xf6, 0x43, 0xc3, 0x2b,
-  0xfd, 0x4f, 0x46, 0xe6, 0x25, 0xf5, 0x42, 0xc2, 0x6f, 0x2d, 0xfd, 0x6e,
-  0x6c, 0x2e, 0x22, 0x4f, 0x4c, 0xac, 0x88, 0x4f, 0x45, 0xf5, 0x4d, 0xd5,
-  0x24, 0x6f, 0x62, 0xf2, 0x27, 0x66, 0x6f, 0x73, 0xf3, 0x36, 0x34, 0x9f,
-  0xa1, 0xa1, 0x22, 0x3f, 0x16, 0xe2, 0x23, 0xf6, 0x27, 0x34, 0x4f, 0x6f,
-  0xf2, 0x13, 0x95, 0x6e, 0x72, 0xaf, 0x81, 0x63, 0x2d, 0x3f, 0x11, 0xb9,
-  0x71, 0xe7, 0x13, 0xf3, 0x86, 0x14, 0x6f, 0x42, 0xfb, 0x61, 0x62, 0x2f,
-  0x16, 0xb7, 0xe2, 0xaf, 0x33, 0x5f, 0x62, 0xf3, 0xe6, 0xe5, 0x2f, 0x26,
-  0xfe, 0x62, 0x72, 0x7f, 0x75, 0xf5, 0x74, 0x64, 0x7a, 0xf6, 0xf6, 0x74,
-  0x4e, 0xd1, 0x1a, 0xe4, 0x2d, 0xf4, 0x54, 0x5c, 0xde, 0xc2, 0x1f, 0x23,
-  0x65, 0x79, 0x2f, 0x41, 0xf1, 0xf1, 0xe2, 0x4f, 0x47, 0xf7, 0x43, 0x41,
-  0x4f, 0x46, 0xf6, 0xd1, 0xf6, 0xce, 0x64, 0x3f, 0x55, 0xad, 0x44, 0x4e,
-  0x22, 0xca, 0xf4, 0x53, 0xd1, 0x4f, 0x46, 0xe2, 0x25, 0xf5, 0xc6, 0x44,
-  0x5e, 0xd8, 0xcf, 0xe6, 0xb6, 0x62, 0xf4, 0xc6, 0xc4, 0x4a, 0xb4, 0x44,
-  0x35, 0x3a, 0xf0, 0x21, 0x21, 0x7f, 0x62, 0xf6, 0x34, 0x17, 0x6f, 0x67,
-  0xd3, 0xab, 0xf1, 0x61, 0x63, 0x2b, 0x17, 0x3e, 0x62, 0x7f, 0x43, 0xf3,
-  0xf5, 0x27, 0x2f, 0x25, 0xbc, 0xa2, 0xfb, 0x1b, 0x19, 0x17, 0x3d, 0x2b,
-  0xd7, 0x1b, 0xaa, 0x3e, 0x11, 0x7f, 0x7c, 0xf4, 0x66, 0xe6, 0x3b, 0xab,
-  0x2f, 0x17, 0xf7, 0x61, 0x71, 0xba, 0xfb, 0x25, 0x24, 0x6f, 0x7e, 0xfa,
-  0x73, 0xe1, 0x2f, 0x27, 0xf7, 0xe6, 0x66, 0x7f, 0x75, 0xf7, 0xf3, 0xe3,
-  0x6f, 0x6e, 0xf6, 0x42, 0xc1, 0x5a, 0xe5, 0x2c, 0xf4, 0xd6, 0xde, 0x3f,
-  0x35, 0xf4, 0x3b, 0x52, 0x2f, 0x79, 0xf1, 0xd6, 0x94, 0x1f, 0x27, 0xf6,
-  0x75, 0x75, 0x2f, 0x2c, 0xfc, 0xe6, 0xe4, 0x5f, 0x65, 0xf7, 0xc1, 0x65,
-  0x2f, 0x25, 0xbd, 0xc2, 0xfe, 0x41, 0x63, 0x1f, 0x1c, 0xf4, 0x72, 0xd2,
-  0x6f, 0x4e, 0xae, 0x55, 0x4f, 0x6c, 0xb4, 0x56, 0xfd, 0xec, 0xee, 0x23,
-  0xf2, 0x66, 0x44, 0xca, 0xfc, 0xc4, 0xd4, 0x5f, 0xfd, 0x04, 0x41, 0x00,
-  0x40, 0x02, 0x2a, 0x21, 0x31, 0x24, 0x12, 0x24, 0x00, 0x12, 0x20, 0x81,
-  0x22, 0x41, 0x22, 0x01, 0x00, 0x20, 0x04, 0x80, 0x81, 0x92, 0x12, 0x90,
-  0x12, 0x80, 0x01, 0x23, 0x02, 0x49, 0x01, 0x80, 0x04, 0x00, 0x48, 0x80,
-  0x04, 0x48, 0x00, 0x00, 0x44, 0x20, 0x04, 0x4a, 0x02, 0x1f, 0xac, 0x03,
-  0x21, 0x10, 0x42, 0x94, 0x12, 0x1a, 0x44, 0x82, 0x16, 0x84, 0x86, 0xa8,
-  0x48, 0x18, 0x8a, 0x04, 0x8a, 0x44, 0xb2, 0x84, 0x04, 0xaa, 0x24, 0x24,
-  0x0b, 0xa2, 0x44, 0x23, 0x02, 0x29, 0x44, 0xa4, 0xc2, 0x80, 0x0c, 0xc8,
-  0x52, 0x2c, 0x28, 0x08, 0x12, 0x88, 0xa0, 0x84, 0x90, 0x84, 0x8a, 0x24,
-  0x22, 0x08, 0xa0, 0x84, 0x82, 0x42, 0x82, 0x81, 0x2a, 0xa4, 0x84, 0x82,
-  0x28, 0x8e, 0x41, 0xff, 0x25, 0x05, 0x3c, 0xf4, 0x11, 0x24, 0x85, 0xf3,
-  0x11, 0x24, 0xc7, 0x14, 0x1f, 0x41, 0x72, 0x4a, 0xf1, 0x11, 0x2c, 0xaf,
-  0x14, 0xf1, 0x11, 0x24, 0xaf, 0x14, 0x99, 0x21, 0xaf, 0x14, 0x19, 0xf5,
-  0x4a, 0x93, 0x53, 0xf2, 0x4a, 0x95, 0x53, 0xf2, 0x42, 0x93, 0x57, 0x82,
-  0x2d, 0x91, 0x5f, 0x82, 0xc4, 0x91, 0x5f, 0xa2, 0xc4, 0x81, 0x5f, 0xa2,
-  0x64, 0x11, 0x7f, 0xa2, 0x65, 0x19, 0x1f, 0xa2, 0x64, 0x59, 0x4d, 0x5a,
-  0x9e, 0x24, 0x2d, 0x4a, 0x1f, 0x49, 0xd2, 0x34, 0xf4, 0x91, 0x24, 0x87,
-  0x32, 0x1f, 0x49, 0x72, 0x48, 0xf3, 0x91, 0x24, 0xa7, 0x34, 0x1f, 0x48,
-  0xf2, 0x4a, 0x13, 0x1d, 0x24, 0xaf, 0x34, 0x99, 0x21, 0xaf, 0x34, 0x19,
-  0xf5, 0x4a, 0x93, 0x43, 0xf2, 0x4a, 0x92, 0x43, 0xf2, 0x42, 0xb2, 0x47,
-  0x83, 0x29, 0xf9, 0x24, 0x48, 0x98, 0x4f, 0xa2, 0xf4, 0xca, 0xa9, 0x40,
-  0xca, 0x64, 0x85, 0xe2, 0x41, 0x04, 0x16, 0x1c, 0xc2, 0x28, 0xa9, 0xc1,
-  0x24, 0xad, 0x14, 0xd0, 0x42, 0x53, 0x84, 0xa9, 0x33, 0x24, 0x89, 0x31,
-  0x24, 0x29, 0x71, 0x24, 0x98, 0x12, 0x2f, 0x82, 0x84, 0xf1, 0x26, 0x5a,
-  0xf0, 0x24, 0xda, 0x12, 0x4f, 0xa2, 0x2c, 0xe1, 0xa2, 0x24, 0xc1, 0x4b,
-  0x1e, 0x24, 0xbc, 0xe4, 0xc1, 0xc2, 0x4a, 0x1e, 0x64, 0x89, 0x64, 0x41,
-  0x83, 0x44, 0x34, 0x48, 0x16, 0x34, 0x48, 0x16, 0x74, 0x48, 0x84, 0xf2,
-  0x48, 0x34, 0x43, 0xb1, 0x48, 0x32, 0x14, 0x83, 0x34, 0x14, 0x42, 0x36,
-  0x08, 0x2f, 0x82, 0x84, 0xf1, 0x26, 0x58, 0xcf, 0x26, 0x0d, 0x00, 0x48,
-  0x00, 0x41, 0x00, 0x00, 0x00, 0x80, 0x02, 0x24, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x88, 0x00, 0x80, 0x02, 0x14, 0x00, 0x84, 0x80, 0x04, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x6f, 0x2f, 0x0c,
-  0x10, 0x44, 0x42, 0x02, 0x80, 0x01, 0x90, 0x49, 0x24, 0x82, 0x14, 0x24,
-  0x10, 0x15, 0x84, 0x98, 0x12, 0x1d, 0x44, 0x00, 0x00, 0x21, 0x1d, 0x24,
-  0x43, 0x31, 0x24, 0x60, 0x25, 0x00, 0x42, 0x4a, 0x08, 0x00, 0x15, 0x22,
-  0x31, 0x13, 0x00, 0x1e, 0x84, 0x20, 0x08, 0x80, 0x31, 0x14, 0x00, 0x10,
-  0x04, 0x00, 0xc2, 0x28, 0x41, 0x2b, 0x1a, 0x20, 0x01, 0x40, 0x11, 0xe4,
+  0x14, 0x24, 0xf2, 0xb4, 0xa8, 0x88, 0x01, 0x20, 0x18, 0x24, 0x52, 0x0c,
+  0xf1, 0xbf, 0x48, 0x80, 0x03, 0x28, 0x14, 0x48, 0x80, 0x82, 0x21, 0x62,
+  0x11, 0x10, 0x02, 0x30, 0x21, 0x24, 0x32, 0xf0, 0x22, 0x12, 0x14, 0x12,
+  0x28, 0x26, 0x02, 0x2a, 0x24, 0x82, 0x04, 0x62, 0x28, 0x10, 0x01, 0x26,
+  0x03, 0x80, 0x04, 0x43, 0x04, 0x22, 0x80, 0xf4, 0xb6, 0x78, 0x00, 0x00,
+  0x49, 0x32, 0x14, 0x21, 0x00, 0x41, 0x12, 0x00, 0x24, 0x28, 0x00, 0x00,
+  0x12, 0x12, 0x14, 0x00, 0x41, 0x18, 0x00, 0x20, 0x83, 0x81, 0x04, 0x24,
+  0x11, 0xa0, 0x42, 0x22, 0x12, 0x00, 0x23, 0x01, 0x00, 0x11, 0x70, 0x42,
+  0x14, 0x04, 0x60, 0x42, 0x00, 0x90, 0x22, 0x81, 0x84, 0x41, 0xe0, 0x43,
+  0x08, 0x8a, 0xc2, 0x44, 0x00, 0x19, 0x02, 0x16, 0x01, 0x32, 0x20, 0x02,
+  0x54, 0x12, 0x19, 0x42, 0x64, 0x14, 0x20, 0x41, 0x66, 0x21, 0x18, 0x1a,
+  0x04, 0x48, 0x21, 0x00, 0x3c, 0x05, 0x40, 0x21, 0x04, 0x28, 0x42, 0x1d,
+  0x12, 0x00, 0x00, 0x80, 0x42, 0x02, 0x14, 0x00, 0x21, 0x00, 0x00, 0xc0,
+  0x28, 0x40, 0x84, 0x04, 0xbe, 0xa7, 0x10, 0x01, 0x19, 0x04, 0x20, 0xa1,
+  0x24, 0x12, 0x10, 0x42, 0x43, 0x04, 0x28, 0x2c, 0x81, 0x01, 0x17, 0x41,
+  0x00, 0x28, 0x14, 0x21, 0x10, 0x01, 0x68, 0x00, 0x40, 0x02, 0x1c, 0x82,
+  0x02, 0x60, 0x44, 0x48, 0x4a, 0x82, 0x82, 0x72, 0x11, 0x02, 0x28, 0x14,
+  0x40, 0x04, 0x68, 0x80, 0x84, 0x12, 0x02, 0x80, 0x04, 0x26, 0x08, 0x3b,
+  0x79, 0x00, 0x18, 0x28, 0x96, 0x04, 0xf2, 0x06, 0x28, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x11, 0x18, 0x00, 0x00, 0x11, 0x41, 0x22, 0x00, 0x42, 0x80,
+  0x82, 0x44, 0x94, 0x11, 0x00, 0x64, 0x09, 0x00, 0x0c, 0x01, 0xf0, 0xff,
+  0x65, 0x40, 0xd8, 0x62, 0x09, 0x00, 0x11, 0x4c, 0xc1, 0x11, 0x41, 0x80,
+  0x01, 0x44, 0x22, 0xd0, 0x41, 0x81, 0x61, 0x12, 0x29, 0x81, 0x12, 0x11,
+  0x81, 0x11, 0x81, 0x61, 0x12, 0x11, 0x00, 0x2a, 0x05, 0x42, 0x39, 0xc1,
+  0x32, 0x28, 0x46, 0x14, 0x42, 0x23, 0x02, 0x23, 0x61, 0x11, 0x40, 0x25,
+  0x01, 0x24, 0x10, 0x41, 0x81, 0xc8, 0x45, 0x20, 0x04, 0x63, 0x04, 0x00,
+  0x20, 0x02, 0x9f, 0x9d, 0x0e, 0x84, 0xc0, 0x42, 0x00, 0xc0, 0x12, 0x00,
+  0x12, 0x43, 0x41, 0x24, 0x82, 0x02, 0x20, 0x01, 0x10, 0x22, 0x12, 0x91,
+  0x42, 0xc0, 0x12, 0x90, 0x81, 0x20, 0x02, 0x14, 0x40, 0x11, 0x01, 0x84,
+  0x80, 0x04, 0x1e, 0x21, 0x18, 0x11, 0x46, 0x24, 0x22, 0x42, 0xf4, 0x42,
+  0x24, 0x22, 0x28, 0x80, 0x82, 0x02, 0x10, 0x02, 0x81, 0xa9, 0x18, 0xb4,
+  0x93, 0x07, 0x15, 0xe1, 0x49, 0x61, 0x61, 0x43, 0x41, 0xe4, 0x41, 0xe1,
+  0x37, 0x92, 0x12, 0x5f, 0x61, 0x43, 0xb4, 0x21, 0x11, 0xf2, 0x21, 0x12,
+  0x21, 0x1d, 0x23, 0x49, 0xa1, 0x14, 0xf0, 0x31, 0x31, 0x11, 0x6e, 0x13,
+  0x11, 0x4a, 0xd5, 0x43, 0x11, 0x11, 0x53, 0x11, 0x20, 0x17, 0xe2, 0x52,
+  0x24, 0xc2, 0x76, 0x28, 0x17, 0x12, 0xb0, 0x11, 0x83, 0xf2, 0x61, 0x32,
+  0x15, 0xf2, 0x23, 0x31, 0x28, 0x66, 0x21, 0x52, 0x11, 0x49, 0xb2, 0x21,
+  0x52, 0x11, 0x11, 0x15, 0x21, 0xe4, 0x22, 0x82, 0x44, 0xa2, 0x24, 0x46,
+  0x08, 0xcc, 0x0c, 0x4f, 0xd7, 0x09, 0x2a, 0x12, 0x22, 0xa2, 0x12, 0x17,
+  0x33, 0x21, 0x11, 0x12, 0x14, 0x2b, 0x11, 0x1e, 0x21, 0x40, 0x65, 0x21,
+  0x48, 0x23, 0x61, 0x13, 0x6d, 0x13, 0x70, 0x14, 0xb1, 0x13, 0x86, 0x61,
+  0x11, 0x14, 0x2a, 0x86, 0xa1, 0x62, 0x40, 0xe2, 0x11, 0xb1, 0x41, 0x82,
+  0x32, 0x22, 0x21, 0x69, 0xf3, 0x22, 0x61, 0x44, 0x1a, 0x61, 0x51, 0x3a,
+  0x23, 0xf5, 0x11, 0x11, 0x2d, 0x44, 0x28, 0x4c, 0x14, 0x31, 0x42, 0x44,
+  0x4f, 0x14, 0x44, 0xc2, 0x44, 0x90, 0x26, 0xc0, 0x44, 0x28, 0xcb, 0x22,
+  0xcb, 0x22, 0x84, 0x6f, 0x28, 0x0d, 0x20, 0xd6, 0x15, 0x43, 0x94, 0x34,
+  0x41, 0x18, 0x20, 0x12, 0x54, 0x24, 0x10, 0x84, 0xa1, 0x13, 0xc0, 0x22,
+  0x13, 0x41, 0x82, 0x03, 0x16, 0xb1, 0x21, 0x02, 0x46, 0x63, 0x11, 0x56,
+  0x12, 0xc2, 0x71, 0x11, 0x16, 0x12, 0x23, 0x74, 0x21, 0xc1, 0x42, 0x13,
+  0x64, 0x26, 0x23, 0x02, 0x25, 0xc1, 0x44, 0x26, 0x82, 0x42, 0xb2, 0x62,
+  0x62, 0x32, 0x1c, 0xf4, 0x24, 0x82, 0x21, 0x22, 0x2b, 0x22, 0x20, 0x04,
+  0x27, 0x82, 0x8b, 0x42, 0xc4, 0x42, 0xcb, 0x24, 0x8e, 0x41, 0x90, 0x21,
+  0x02, 0x00, 0xf0, 0x09, 0x21, 0x19, 0x12, 0xb2, 0x11, 0x12, 0x92, 0x21,
+  0x21, 0x11, 0x21, 0x10, 0x22, 0x12, 0x22, 0x12, 0xa2, 0x42, 0xa0, 0x42,
+  0xe0, 0x22, 0x04, 0x2e, 0x05, 0x00, 0x12, 0x2c, 0x02, 0x00, 0xf0, 0x1e,
+  0x01, 0x24, 0x30, 0x42, 0x30, 0x42, 0x30, 0x62, 0x70, 0x42, 0x01, 0x27,
+  0x14, 0x30, 0x42, 0x11, 0x23, 0x04, 0x23, 0x84, 0x14, 0x88, 0x04, 0x1f,
+  0x86, 0x4d, 0xf1, 0x21, 0x21, 0x4f, 0x52, 0xf3, 0x21, 0x37, 0x2f, 0x52,
+  0xf2, 0x21, 0x37, 0x3f, 0x73, 0xf3, 0x63, 0x63, 0x3f, 0x51, 0x08, 0xf0,
+  0x4d, 0x6f, 0x73, 0xf3, 0x33, 0x33, 0x37, 0x32, 0x1f, 0x31, 0x51, 0x32,
+  0x17, 0x31, 0x6d, 0x26, 0x3f, 0x37, 0xf6, 0x26, 0x37, 0x2a, 0xf2, 0x24,
+  0x27, 0x6a, 0xa7, 0x24, 0x1f, 0x16, 0xa6, 0x24, 0x2f, 0x36, 0xf6, 0x43,
+  0x63, 0x3f, 0x37, 0xb7, 0x42, 0xf2, 0x73, 0x63, 0x2f, 0x16, 0xf6, 0x77,
+  0x77, 0x6f, 0x44, 0xf6, 0x42, 0x42, 0x2f, 0x24, 0xf4, 0x22, 0x22, 0x25,
+  0x72, 0x17, 0x77, 0x32, 0x72, 0x36, 0xd6, 0x22, 0xf4, 0x67, 0x77, 0x6f,
+  0x64, 0xf4, 0x42, 0x62, 0x2d, 0x42, 0x7f, 0x44, 0xf4, 0x22, 0x42, 0x3f,
+  0x36, 0xf4, 0xc1, 0xc2, 0x7f, 0x74, 0xd4, 0x23, 0xf4, 0x29, 0x00, 0xf0,
+  0x2a, 0xf6, 0x42, 0x42, 0x4f, 0x74, 0xf4, 0x6a, 0x69, 0x2f, 0x14, 0x64,
+  0x46, 0x1f, 0xcc, 0x7e, 0x44, 0xf7, 0x32, 0xc3, 0xf0, 0x21, 0x21, 0x5f,
+  0xd5, 0xf6, 0x21, 0x27, 0x3d, 0x35, 0x5f, 0x32, 0xb2, 0x13, 0xf3, 0x63,
+  0x63, 0x3d, 0x32, 0x3f, 0x32, 0xf3, 0x13, 0x31, 0x7f, 0x73, 0xf3, 0x23,
+  0x22, 0x3f, 0x31, 0xd3, 0x33, 0xd1, 0x33, 0xf1, 0x26, 0x24, 0x8a, 0x00,
+  0xf0, 0x72, 0x16, 0x3f, 0x12, 0x72, 0x24, 0xf7, 0x71, 0x72, 0x2f, 0x16,
+  0xe7, 0x17, 0xf7, 0x61, 0x72, 0x2f, 0x36, 0xf6, 0xa3, 0xe3, 0x1f, 0x37,
+  0xf7, 0x62, 0xe2, 0x3f, 0x37, 0xf6, 0x23, 0x53, 0x6f, 0x77, 0xd7, 0x77,
+  0xf6, 0x42, 0x42, 0x2d, 0x42, 0x9f, 0xb6, 0x56, 0x22, 0x5f, 0xf4, 0xf4,
+  0x32, 0x22, 0x5f, 0x73, 0xf3, 0x53, 0x52, 0x6f, 0x67, 0xf6, 0x54, 0x26,
+  0x2b, 0x64, 0x2f, 0x24, 0xf4, 0x47, 0x46, 0x2f, 0x74, 0xf4, 0x62, 0x43,
+  0x3f, 0x2e, 0xfa, 0x46, 0x45, 0x3f, 0x24, 0xb4, 0x42, 0x76, 0x42, 0xf2,
+  0x42, 0x42, 0x67, 0x64, 0xaf, 0xb4, 0xf4, 0x4a, 0x4a, 0xaf, 0x84, 0xe4,
+  0xcc, 0xfc, 0x5e, 0x5f, 0x5f, 0x7f, 0x05, 0x1f, 0x12, 0xd2, 0x44, 0xf7,
+  0x21, 0x33, 0x2d, 0x24, 0x1f, 0x73, 0xd2, 0x43, 0xf2, 0x73, 0x63, 0x39,
+  0xf3, 0x31, 0x27, 0x2f, 0x41, 0xf3, 0x33, 0x37, 0x31, 0x1f, 0x31, 0xef,
+  0x0a, 0xf0, 0xd9, 0x6d, 0x14, 0x3f, 0x36, 0x77, 0x26, 0xe5, 0x23, 0x73,
+  0x34, 0xf7, 0x62, 0x71, 0x2b, 0x11, 0x6a, 0x86, 0xf1, 0x61, 0x63, 0x3d,
+  0xc3, 0x1f, 0x37, 0x17, 0xf2, 0x71, 0x63, 0x3b, 0x63, 0x5f, 0x77, 0xd7,
+  0x56, 0xe4, 0x26, 0xd6, 0x22, 0xe4, 0xb4, 0x56, 0x33, 0x5f, 0x71, 0x75,
+  0x32, 0x72, 0x14, 0x56, 0x33, 0x6f, 0x76, 0x75, 0x65, 0xb7, 0x62, 0x56,
+  0x22, 0x7f, 0x54, 0x64, 0x62, 0x3b, 0x46, 0x1f, 0x2c, 0xfa, 0x47, 0x44,
+  0x35, 0xb2, 0x42, 0x74, 0x62, 0xb3, 0x42, 0x74, 0x44, 0xf6, 0x6a, 0x48,
+  0x1b, 0x46, 0xa5, 0xa8, 0xcc, 0xcd, 0x1e, 0x7f, 0x14, 0x0f, 0x1f, 0x12,
+  0xf2, 0x1c, 0x55, 0x5f, 0x32, 0x73, 0x16, 0xf5, 0x25, 0x27, 0x2f, 0x41,
+  0xf1, 0x71, 0x63, 0x2d, 0x12, 0x5f, 0x73, 0xf3, 0x16, 0x15, 0x1f, 0x33,
+  0x72, 0x22, 0xf2, 0x11, 0x13, 0x3f, 0x31, 0xf1, 0x11, 0x13, 0x6f, 0x41,
+  0xf3, 0x71, 0x73, 0x7f, 0x71, 0xf1, 0x31, 0x33, 0x47, 0x71, 0x3f, 0x17,
+  0xf7, 0x43, 0x31, 0x1f, 0x17, 0xb7, 0x41, 0xf2, 0x63, 0x63, 0x3d, 0xa1,
+  0x1f, 0x27, 0xb7, 0xc2, 0xf2, 0x73, 0x63, 0x3f, 0x13, 0xf1, 0x77, 0x76,
+  0x6f, 0x42, 0xf2, 0x62, 0x62, 0x21, 0x6e, 0x6b, 0x3f, 0x14, 0xd4, 0x7d,
+  0xb7, 0x32, 0xf2, 0x25, 0x27, 0x3f, 0x23, 0xf7, 0x76, 0x55, 0x5f, 0x71,
+  0xb3, 0x42, 0xc6, 0x42, 0x7f, 0x54, 0xd6, 0x32, 0xf6, 0x62, 0x62, 0x1f,
+  0x28, 0xfa, 0x46, 0x44, 0x1d, 0x42, 0x2b, 0x46, 0x24, 0x2f, 0x24, 0x54,
+  0x74, 0xaf, 0x86, 0xf6, 0x62, 0x68, 0x27, 0x86, 0xce, 0xe6, 0xcf, 0xd4,
+  0xf1, 0x54, 0x89, 0x00, 0x90, 0x14, 0x80, 0xeb, 0x04, 0x00, 0x9e, 0x08,
+  0x02, 0x08, 0x00, 0x33, 0x22, 0x00, 0x00, 0xe9, 0x09, 0xf0, 0x23, 0x40,
+  0x01, 0x14, 0x80, 0x02, 0x00, 0x81, 0xc0, 0x24, 0xb0, 0x85, 0x09, 0x82,
+  0x00, 0x00, 0x16, 0x04, 0x12, 0x41, 0x80, 0x01, 0x20, 0x01, 0x80, 0x31,
+  0x11, 0x10, 0x11, 0x12, 0x81, 0x11, 0x01, 0x40, 0x01, 0x12, 0x11, 0x00,
+  0x00, 0x4a, 0x42, 0x81, 0x22, 0x32, 0x11, 0x00, 0x1c, 0x01, 0x22, 0x60,
+  0x12, 0x40, 0x00, 0xf0, 0x0f, 0x80, 0x12, 0x44, 0x44, 0xf8, 0x6e, 0xea,
+  0xe0, 0x22, 0xf5, 0x11, 0x24, 0xa7, 0x22, 0x1f, 0x41, 0x32, 0x48, 0x1f,
+  0x41, 0x32, 0x4a, 0x1f, 0x41, 0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x4a, 0xe4,
+  0x09, 0xf2, 0x27, 0x19, 0xb5, 0x4a, 0xb9, 0x24, 0xf4, 0x4a, 0x93, 0x43,
+  0xf2, 0x42, 0x91, 0x47, 0x82, 0x2d, 0xb1, 0x4f, 0x82, 0xc4, 0x91, 0x4f,
+  0xa2, 0xc4, 0x85, 0x4f, 0xa2, 0x64, 0x11, 0x4f, 0xa2, 0x64, 0x19, 0x2e,
+  0x4a, 0x96, 0xc5, 0x4a, 0x9e, 0x24, 0x6d, 0x5a, 0x1f, 0x4d, 0xd2, 0x22,
+  0xf5, 0x91, 0x24, 0x8d, 0x12, 0x1f, 0x49, 0x32, 0x48, 0xe2, 0x09, 0xe1,
+  0xf2, 0x6a, 0x11, 0x1d, 0x24, 0xab, 0x94, 0x19, 0xf2, 0x4a, 0x91, 0x51,
+  0xaf, 0x14, 0xe1, 0x09, 0xf0, 0x06, 0x24, 0x2b, 0xb4, 0x47, 0x82, 0xad,
+  0x94, 0x4f, 0x82, 0xa4, 0x94, 0x4f, 0xa2, 0xf4, 0x19, 0x52, 0xc0, 0x48,
+  0x1f, 0x41, 0x96, 0x75, 0x00, 0xf8, 0x56, 0x48, 0x1f, 0x41, 0x12, 0xda,
+  0x41, 0x36, 0x4a, 0x1d, 0x24, 0xaf, 0x44, 0x99, 0x21, 0xaf, 0x44, 0x1b,
+  0x95, 0xb8, 0x4b, 0x42, 0xad, 0x91, 0x4b, 0x42, 0x4e, 0x91, 0x45, 0xd8,
+  0x12, 0xf9, 0x26, 0x48, 0x1c, 0xf9, 0x22, 0x5a, 0x1c, 0xf8, 0x24, 0xda,
+  0x1c, 0xf8, 0x24, 0x4a, 0x96, 0xe1, 0xa2, 0x64, 0x19, 0x9c, 0xe4, 0x49,
+  0xc2, 0x49, 0x1f, 0xc9, 0x42, 0xba, 0x81, 0x56, 0x28, 0x1b, 0x69, 0x83,
+  0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x81, 0x24, 0xab, 0x14, 0x11, 0xaf, 0x44,
+  0xa9, 0x28, 0xaf, 0x44, 0x03, 0xab, 0xb4, 0x22, 0xab, 0x94, 0x41, 0x2b,
+  0x94, 0x47, 0x82, 0x29, 0xb9, 0xa6, 0x94, 0x12, 0xac, 0xf5, 0x69, 0x2f,
+  0xe6, 0x09, 0x30, 0x80, 0x02, 0x80, 0x0e, 0x00, 0x08, 0x13, 0x00, 0xf0,
+  0x4b, 0x25, 0x01, 0xef, 0xb8, 0x0b, 0x24, 0x18, 0x21, 0x12, 0x48, 0x2c,
+  0x01, 0x22, 0x10, 0x41, 0x32, 0x11, 0x21, 0x24, 0x14, 0x16, 0x54, 0x14,
+  0x31, 0x44, 0x26, 0x02, 0x13, 0x12, 0x01, 0x11, 0x44, 0x16, 0x96, 0x21,
+  0x21, 0x88, 0x18, 0x44, 0x16, 0x22, 0x98, 0x23, 0x22, 0x37, 0x21, 0x16,
+  0x64, 0x11, 0xe0, 0x42, 0x01, 0x28, 0x26, 0x11, 0x04, 0x80, 0x0c, 0x20,
+  0x02, 0x10, 0x08, 0xa1, 0x00, 0xf0, 0x24, 0x11, 0x10, 0x62, 0x1a, 0x10,
+  0x14, 0x22, 0x42, 0x52, 0x34, 0x2c, 0x71, 0x24, 0x18, 0x23, 0x82, 0x05,
+  0xc0, 0x63, 0x80, 0x72, 0x11, 0x82, 0x64, 0x27, 0x05, 0xf0, 0xbc, 0x56,
+  0x22, 0x4e, 0x22, 0x11, 0xc0, 0x18, 0x5a, 0x12, 0x23, 0x14, 0x22, 0x25,
+  0x31, 0xc2, 0x22, 0x26, 0x02, 0x69, 0x44, 0xd1, 0x12, 0x55, 0x21, 0x48,
+  0x86, 0x23, 0x84, 0x01, 0x35, 0xc2, 0x45, 0x21, 0x29, 0x64, 0x22, 0x2c,
+  0x64, 0x42, 0xb0, 0x4d, 0x42, 0x31, 0xc4, 0xfe, 0xad, 0x00, 0x3b, 0x16,
+  0x70, 0x14, 0x22, 0x24, 0x02, 0x59, 0x92, 0x12, 0xc3, 0x12, 0x76, 0x21,
+  0x22, 0x46, 0x12, 0xd1, 0x61, 0x52, 0x25, 0x28, 0x18, 0xd0, 0x23, 0xf1,
+  0x44, 0x21, 0x14, 0x5a, 0x12, 0xf2, 0xc6, 0x22, 0x13, 0x31, 0x23, 0x2d,
+  0x18, 0x4a, 0x3a, 0x13, 0x17, 0x24, 0xa0, 0x1c, 0x83, 0xa1, 0x84, 0x13,
+  0x77, 0x12, 0x84, 0x81, 0xf4, 0x21, 0x14, 0x3b, 0x41, 0x1d, 0x22, 0x48,
+  0x54, 0x63, 0x24, 0xa1, 0x42, 0x11, 0x29, 0xd4, 0x22, 0x82, 0xc4, 0x22,
+  0x48, 0x41, 0x25, 0x3a, 0x48, 0x14, 0x56, 0xf4, 0x38, 0xc7, 0x10, 0x02,
+  0x21, 0x00, 0x12, 0x25, 0x02, 0x24, 0x11, 0x34, 0x12, 0x18, 0x00, 0x1a,
+  0x04, 0x11, 0x74, 0x2a, 0x04, 0x80, 0x02, 0x14, 0x40, 0x04, 0x80, 0x01,
+  0x41, 0x12, 0x25, 0x92, 0x21, 0x27, 0x22, 0x60, 0x22, 0x11, 0x61, 0x00,
+  0x60, 0x12, 0x82, 0x00, 0x2c, 0x08, 0x54, 0x00, 0x50, 0x28, 0x22, 0x30,
+  0x25, 0x20, 0xf8, 0x43, 0xd2, 0xc0, 0x42, 0x40, 0x81, 0x02, 0x90, 0x18,
+  0x40, 0x81, 0x44, 0x83, 0x44, 0x01, 0x00, 0x18, 0x20, 0x04, 0x56, 0x0c,
+  0xf0, 0x87, 0x11, 0x00, 0x44, 0x00, 0x29, 0x05, 0x24, 0x00, 0x20, 0x02,
+  0x23, 0x12, 0x21, 0x12, 0x41, 0x01, 0x00, 0x20, 0x18, 0x02, 0x00, 0x20,
+  0x08, 0xf0, 0xb7, 0x61, 0x10, 0x21, 0x02, 0x50, 0x21, 0x41, 0x25, 0x11,
+  0x32, 0x12, 0x00, 0x10, 0x02, 0x11, 0x24, 0x88, 0x27, 0x24, 0xd0, 0x14,
+  0x06, 0x11, 0x40, 0x35, 0x24, 0x14, 0x49, 0xa2, 0x25, 0x2d, 0x14, 0x14,
+  0x84, 0x49, 0x34, 0x12, 0x26, 0x12, 0x94, 0x31, 0x16, 0xc1, 0x21, 0x00,
+  0x40, 0x07, 0x11, 0x8c, 0x48, 0x12, 0x11, 0xb1, 0x81, 0x54, 0x25, 0x60,
+  0x22, 0x26, 0x34, 0x28, 0x81, 0x84, 0x84, 0x8c, 0x22, 0xd2, 0x29, 0x02,
+  0x14, 0x28, 0x80, 0x42, 0x13, 0x74, 0x12, 0x08, 0x21, 0x00, 0x25, 0x42,
+  0x01, 0x14, 0x80, 0x28, 0x04, 0x2a, 0x04, 0x11, 0x10, 0x44, 0x04, 0x80,
+  0x14, 0x04, 0x41, 0x24, 0xe0, 0x23, 0x04, 0x50, 0x12, 0x14, 0x00, 0x00,
+  0x80, 0x72, 0x88, 0x41, 0x01, 0x80, 0x48, 0x82, 0x88, 0x82, 0x92, 0x28,
+  0x00, 0x86, 0x28, 0x22, 0xf2, 0x76, 0xf8, 0x60, 0xeb, 0x07, 0xf0, 0x9e,
+  0x11, 0x21, 0x19, 0x21, 0x44, 0x81, 0x04, 0x00, 0x24, 0x2c, 0x01, 0x23,
+  0x14, 0x05, 0x22, 0x40, 0x81, 0x42, 0x61, 0x42, 0x13, 0x33, 0x12, 0x11,
+  0x81, 0x4c, 0x64, 0x21, 0x40, 0x34, 0x31, 0x12, 0x22, 0x20, 0x02, 0x3d,
+  0x24, 0x25, 0x41, 0x01, 0x10, 0x13, 0x61, 0x14, 0x45, 0x01, 0x25, 0x12,
+  0x04, 0x81, 0x84, 0x10, 0x08, 0xbf, 0x87, 0x0f, 0x58, 0x42, 0x19, 0x08,
+  0x12, 0x44, 0x40, 0x21, 0x02, 0x41, 0x1c, 0x04, 0x49, 0x54, 0x12, 0x40,
+  0x04, 0x10, 0x42, 0x03, 0x41, 0x26, 0x04, 0x83, 0xc2, 0x32, 0x30, 0x44,
+  0x20, 0x04, 0x42, 0x00, 0x43, 0x31, 0x14, 0x26, 0x61, 0x41, 0x00, 0x44,
+  0x20, 0x01, 0x49, 0x92, 0x21, 0xa2, 0x00, 0x87, 0x48, 0x23, 0x08, 0x80,
+  0x42, 0x22, 0x28, 0x42, 0xf2, 0x71, 0x4d, 0x00, 0x47, 0x24, 0x2c, 0x02,
+  0x21, 0x28, 0x44, 0x29, 0x51, 0x12, 0x10, 0x04, 0x28, 0x00, 0x81, 0x80,
+  0x41, 0x01, 0x24, 0x00, 0x14, 0x41, 0x10, 0x44, 0x04, 0x21, 0x14, 0x13,
+  0x84, 0x41, 0x94, 0x19, 0x00, 0x42, 0x00, 0x14, 0x24, 0x50, 0x12, 0x10,
+  0x05, 0x22, 0x14, 0x41, 0x10, 0x04, 0x00, 0x2c, 0x08, 0x41, 0x44, 0x8f,
+  0x29, 0x0a, 0x00, 0x88, 0x41, 0x39, 0x0a, 0xf1, 0x01, 0x00, 0x00, 0x40,
+  0x81, 0x44, 0x85, 0x44, 0x34, 0x24, 0xa0, 0x21, 0x00, 0x00, 0x18, 0x00,
+  0x81, 0xb6, 0x0d, 0xf0, 0x57, 0x00, 0x41, 0x4c, 0x02, 0x00, 0x21, 0x40,
+  0x88, 0x42, 0x12, 0x14, 0x34, 0x18, 0x26, 0x08, 0x00, 0xbf, 0x75, 0x09,
+  0x18, 0x41, 0x2c, 0x42, 0x14, 0xc2, 0x24, 0xd0, 0x32, 0xd1, 0x21, 0x02,
+  0x90, 0x41, 0x40, 0x42, 0x41, 0x19, 0xd4, 0x14, 0xd1, 0x21, 0x44, 0x64,
+  0x52, 0x90, 0x34, 0x26, 0x14, 0x84, 0x62, 0x22, 0x18, 0x2c, 0x04, 0x46,
+  0x89, 0x84, 0x05, 0x19, 0x93, 0x14, 0x12, 0x28, 0x18, 0x00, 0x64, 0x41,
+  0x4d, 0x11, 0x30, 0x21, 0x26, 0x23, 0x48, 0x51, 0x84, 0x89, 0x9a, 0x82,
+  0x61, 0xb0, 0x28, 0x61, 0x82, 0x80, 0x02, 0x2f, 0xca, 0x02, 0x48, 0x50,
+  0x12, 0xc0, 0x11, 0x10, 0x04, 0x00, 0x00, 0x90, 0x44, 0x00, 0x42, 0x40,
+  0x08, 0xf0, 0x01, 0x40, 0x68, 0x41, 0x41, 0x44, 0x00, 0x00, 0x41, 0x00,
+  0x44, 0x14, 0x44, 0x10, 0x01, 0x30, 0x22, 0x7c, 0x00, 0xf0, 0x0d, 0x44,
+  0x40, 0x04, 0x88, 0x82, 0x44, 0x45, 0xf2, 0xb9, 0x31, 0x20, 0x94, 0x11,
+  0x80, 0x81, 0x84, 0x01, 0x00, 0x14, 0x00, 0x41, 0x80, 0x04, 0x18, 0x10,
+  0x41, 0x06, 0x00, 0x4e, 0x09, 0xf1, 0x01, 0x00, 0x84, 0x40, 0x21, 0x12,
+  0x02, 0x1c, 0x02, 0x11, 0x00, 0x80, 0x82, 0x18, 0x81, 0x48, 0x01, 0x8d,
+  0x08, 0xd0, 0xf0, 0x24, 0x11, 0xb0, 0x21, 0x21, 0x94, 0x11, 0x14, 0x2e,
+  0x14, 0x80, 0xc1, 0x5d, 0x00, 0xf1, 0x95, 0x42, 0x00, 0x00, 0x42, 0x19,
+  0x24, 0x04, 0x00, 0x42, 0x41, 0x00, 0x42, 0x00, 0x22, 0x44, 0x22, 0x16,
+  0x04, 0x81, 0x28, 0x46, 0x24, 0x42, 0x24, 0x12, 0x61, 0x12, 0x88, 0x00,
+  0x44, 0x40, 0x62, 0x28, 0x28, 0x00, 0x24, 0x4a, 0x02, 0xc0, 0x82, 0x5f,
+  0x1e, 0x05, 0x00, 0x20, 0x04, 0x00, 0x14, 0x48, 0x10, 0x02, 0x00, 0x28,
+  0x10, 0x62, 0x41, 0x18, 0x00, 0x44, 0x24, 0x00, 0x24, 0x11, 0x15, 0x84,
+  0x01, 0x14, 0x15, 0x02, 0x11, 0x40, 0x01, 0x28, 0x40, 0x61, 0x22, 0x00,
+  0x90, 0x84, 0x00, 0x41, 0x90, 0x22, 0x00, 0x00, 0x81, 0x00, 0x86, 0x82,
+  0xf2, 0xda, 0x67, 0x60, 0x11, 0xc0, 0x41, 0x21, 0x44, 0x45, 0x81, 0x04,
+  0x00, 0x40, 0x34, 0x44, 0x11, 0x80, 0x91, 0x21, 0x00, 0x18, 0x1c, 0x01,
+  0x29, 0x02, 0x10, 0x81, 0x02, 0x14, 0x11, 0xc0, 0x24, 0x40, 0x04, 0x12,
+  0x14, 0x44, 0x40, 0x84, 0x04, 0x00, 0x10, 0xc6, 0x44, 0x80, 0x02, 0x2a,
+  0x84, 0x18, 0x88, 0x08, 0x82, 0x10, 0x22, 0xf8, 0x9b, 0xe6, 0x80, 0x04,
+  0x00, 0x50, 0x24, 0x00, 0x00, 0x41, 0x48, 0x42, 0x44, 0x00, 0x48, 0x24,
+  0x14, 0x42, 0x11, 0xfa, 0x03, 0xa0, 0x40, 0x04, 0x25, 0x24, 0x02, 0x14,
+  0x25, 0x04, 0x44, 0x40, 0x16, 0x04, 0xf1, 0x4a, 0x30, 0x82, 0x00, 0x21,
+  0x10, 0x02, 0x50, 0x18, 0x7b, 0x32, 0x00, 0x12, 0x40, 0x01, 0x10, 0x41,
+  0x12, 0x11, 0x91, 0x41, 0x64, 0xc0, 0x42, 0x11, 0x11, 0x10, 0x01, 0x00,
+  0x50, 0x12, 0x45, 0x02, 0x00, 0x24, 0x00, 0x29, 0x02, 0x28, 0x89, 0x42,
+  0x01, 0x49, 0x02, 0x13, 0x02, 0x20, 0x02, 0x10, 0x02, 0x00, 0x21, 0x82,
+  0x00, 0x20, 0x92, 0x44, 0x50, 0x82, 0x21, 0x50, 0xbe, 0x00, 0x80, 0x06,
+  0x11, 0xa0, 0x42, 0x46, 0x21, 0x02, 0x22, 0x44, 0x90, 0x21, 0x00, 0x14,
+  0x00, 0x11, 0x00, 0x29, 0x44, 0x01, 0x80, 0x04, 0x22, 0x60, 0x14, 0x60,
+  0x14, 0x70, 0x01, 0xf0, 0xff, 0xff, 0x9a, 0x40, 0x01, 0x40, 0x04, 0x4c,
+  0x02, 0x60, 0x88, 0x43, 0x04, 0x29, 0x08, 0x90, 0x42, 0x44, 0x3b, 0xdc,
+  0x00, 0x86, 0x01, 0x42, 0x14, 0x00, 0x40, 0x41, 0x44, 0x81, 0x04, 0x40,
+  0x31, 0x11, 0x18, 0x11, 0x1a, 0xc4, 0x14, 0x16, 0x02, 0x24, 0x11, 0x11,
+  0x14, 0x00, 0x80, 0x01, 0x00, 0x80, 0x41, 0x01, 0x14, 0x00, 0x00, 0x15,
+  0x44, 0x52, 0x21, 0x00, 0x25, 0x02, 0x40, 0x02, 0x26, 0x08, 0x29, 0x22,
+  0x08, 0x40, 0xf2, 0x9e, 0xaa, 0x40, 0x08, 0x48, 0x16, 0x84, 0x38, 0x11,
+  0x11, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x80, 0x02, 0x28, 0x10, 0x02,
+  0x38, 0xc0, 0x81, 0x11, 0x16, 0x01, 0x40, 0x44, 0x41, 0x84, 0x62, 0x81,
+  0x11, 0x4c, 0x04, 0x54, 0x28, 0x80, 0x06, 0x68, 0x40, 0x04, 0x68, 0x29,
+  0x22, 0x02, 0x20, 0x22, 0x08, 0x10, 0x82, 0xf2, 0xef, 0xef, 0x60, 0x14,
+  0x8a, 0x01, 0x1b, 0x11, 0x14, 0x5c, 0xd1, 0x13, 0x12, 0x54, 0x11, 0x44,
+  0x1d, 0x41, 0x48, 0x48, 0x14, 0x3d, 0x41, 0x24, 0x42, 0x5c, 0xc1, 0x41,
+  0x4d, 0x44, 0x17, 0x15, 0x00, 0x45, 0xc3, 0x21, 0x54, 0x26, 0x41, 0xa2,
+  0x12, 0x24, 0x48, 0x14, 0x65, 0xc4, 0x28, 0x45, 0x94, 0x21, 0xc4, 0x2c,
+  0xd2, 0x54, 0x02, 0x45, 0x07, 0x50, 0x21, 0x73, 0x02, 0x40, 0xd2, 0x22,
+  0xa4, 0xa2, 0x27, 0x24, 0x23, 0x38, 0x48, 0x26, 0xd2, 0x2c, 0x22, 0x44,
+  0x48, 0x91, 0xa2, 0xbf, 0xbb, 0x4f, 0xb1, 0x21, 0xa1, 0x49, 0x1c, 0x51,
+  0x12, 0x4f, 0x48, 0x11, 0xa5, 0x14, 0x13, 0x94, 0x62, 0x30, 0x44, 0x42,
+  0x21, 0x13, 0x04, 0x1b, 0x11, 0x1a, 0x11, 0xa1, 0x14, 0x18, 0x2c, 0x03,
+  0x2e, 0x42, 0x11, 0x42, 0x11, 0x50, 0x11, 0x15, 0xc1, 0x11, 0x11, 0x43,
+  0x92, 0x48, 0x43, 0xb2, 0x11, 0xe2, 0x11, 0x41, 0x51, 0x15, 0x19, 0x34,
+  0x25, 0x2a, 0xa2, 0x22, 0x28, 0x27, 0x12, 0x2c, 0x7e, 0x82, 0x64, 0x14,
+  0x25, 0x44, 0x01, 0xaa, 0x82, 0x42, 0xa8, 0x28, 0x22, 0x2f, 0x28, 0x02,
+  0x8a, 0x54, 0x84, 0x17, 0x4f, 0xa0, 0x41, 0x15, 0x91, 0x21, 0x4e, 0x44,
+  0x1b, 0x42, 0x12, 0x48, 0x1c, 0x04, 0x15, 0x83, 0x02, 0x47, 0x44, 0x49,
+  0x24, 0x42, 0x71, 0x21, 0x01, 0x3b, 0x21, 0x17, 0x35, 0x40, 0x44, 0x11,
+  0x12, 0x01, 0x39, 0x44, 0x24, 0x05, 0x26, 0xc1, 0x24, 0x28, 0x15, 0xc6,
+  0x11, 0x2a, 0x94, 0x23, 0x26, 0x24, 0x42, 0x25, 0x04, 0x1d, 0x45, 0x20,
+  0x88, 0x08, 0x43, 0x18, 0x54, 0x22, 0x88, 0x89, 0x38, 0x24, 0x21, 0x2b,
+  0x8c, 0x88, 0x40, 0x62, 0x2a, 0xdb, 0x4f, 0xa0, 0x24, 0x80, 0x02, 0x8a,
+  0x02, 0x28, 0x80, 0x42, 0x81, 0x02, 0x00, 0x00, 0x22, 0x20, 0x02, 0x2a,
+  0x04, 0x2a, 0x04, 0x1b, 0x42, 0xb0, 0x21, 0x04, 0x2a, 0x04, 0x48, 0xa0,
+  0x42, 0x80, 0x04, 0x22, 0x00, 0x20, 0x04, 0x42, 0x20, 0x24, 0x28, 0x04,
+  0x42, 0x20, 0x44, 0x28, 0x04, 0x42, 0x48, 0x80, 0x04, 0x3d, 0x12, 0x14,
+  0x4a, 0xe2, 0x13, 0xa3, 0x23, 0x4f, 0x53, 0xe3, 0x41, 0xf2, 0x31, 0x37,
+  0x2b, 0x67, 0x1f, 0x26, 0x16, 0xf3, 0x25, 0x24, 0x1b, 0x66, 0x6e, 0x62,
+  0x29, 0x54, 0x65, 0x39, 0xa2, 0x22, 0x7a, 0xe6, 0x32, 0xb2, 0x32, 0xd5,
+  0x54, 0xd3, 0x55, 0xa7, 0x66, 0x1f, 0x14, 0xf4, 0x44, 0x66, 0x2d, 0x61,
+  0x6e, 0x61, 0x1f, 0x14, 0xe4, 0x26, 0xf6, 0x32, 0x71, 0x1f, 0x35, 0xf4,
+  0x63, 0x61, 0x4f, 0x44, 0x54, 0xcc, 0x4f, 0xe6, 0xf6, 0x76, 0x44, 0x1b,
+  0x21, 0x5d, 0x24, 0x45, 0xd6, 0x46, 0xf4, 0x44, 0x64, 0x4f, 0x44, 0xa4,
+  0x64, 0x57, 0x74, 0x39, 0xd6, 0x11, 0xac, 0x44, 0x24, 0x29, 0xd4, 0x44,
+  0xa4, 0xcc, 0x8a, 0xb8, 0xe2, 0xfc, 0x4c, 0x46, 0x2f, 0x24, 0xf6, 0x26,
+  0xa6, 0x2b, 0xca, 0x8f, 0x84, 0xa4, 0x44, 0xcf, 0xe6, 0xf4, 0x23, 0xfa,
+  0x14, 0x5a, 0xf2, 0x31, 0x78, 0x13, 0xf1, 0x14, 0x15, 0x1a, 0xe2, 0x23,
+  0xb3, 0x52, 0xe4, 0x34, 0xf4, 0x23, 0x21, 0x5f, 0x42, 0xe2, 0x44, 0xe4,
+  0x24, 0xb4, 0x22, 0x76, 0x44, 0xd7, 0x13, 0x12, 0xb1, 0x51, 0xe4, 0x33,
+  0xb3, 0x72, 0xf1, 0x45, 0x25, 0x4d, 0x65, 0x2b, 0x66, 0x1f, 0x12, 0xf2,
+  0x14, 0x36, 0x3d, 0x61, 0x1f, 0x1e, 0xef, 0x12, 0xc2, 0x83, 0x2f, 0x11,
+  0xf5, 0x71, 0x63, 0x21, 0x57, 0x52, 0xcf, 0xc6, 0xf4, 0x64, 0x6f, 0xef,
+  0xc6, 0xb6, 0x21, 0xf2, 0x65, 0x6c, 0x45, 0xd7, 0x47, 0xd4, 0x45, 0x52,
+  0x44, 0x6a, 0xf6, 0x65, 0x27, 0x3d, 0x63, 0x1d, 0xc3, 0x2f, 0x4c, 0xe4,
+  0x24, 0xd4, 0x22, 0xd6, 0x64, 0xf4, 0xc2, 0xe2, 0xca, 0xbc, 0xa2, 0xf8,
+  0x24, 0x26, 0x2f, 0x24, 0xf6, 0xe6, 0xe6, 0x2f, 0x2a, 0xfc, 0x4a, 0x48,
+  0xf0, 0x3c, 0x9e, 0x8f, 0x7d, 0x04, 0x7a, 0xe5, 0x11, 0x07, 0x5f, 0x41,
+  0x71, 0xa5, 0xf4, 0x11, 0x36, 0x3b, 0x44, 0x4e, 0x42, 0x2b, 0x22, 0x55,
+  0xf4, 0x41, 0x08, 0x00, 0xf0, 0x15, 0x64, 0x45, 0x16, 0xe2, 0x11, 0xf1,
+  0x51, 0x51, 0x1f, 0x23, 0xb1, 0x53, 0xf7, 0x55, 0x14, 0x1f, 0x16, 0x91,
+  0x42, 0x1f, 0x12, 0xd2, 0x65, 0x71, 0x62, 0x91, 0xc1, 0x1f, 0x12, 0x52,
+  0x21, 0x3f, 0x15, 0xf1, 0x11, 0x53, 0xfd, 0x09, 0xf0, 0x45, 0xf5, 0x6c,
+  0x6c, 0x4f, 0xa2, 0x72, 0x37, 0xfd, 0x51, 0x71, 0x5f, 0x52, 0x46, 0x56,
+  0x57, 0x5f, 0x52, 0xf2, 0x24, 0x24, 0x4a, 0xd2, 0x75, 0xf4, 0x23, 0x21,
+  0x3f, 0x16, 0xda, 0x42, 0xe8, 0x24, 0x94, 0x22, 0x67, 0x44, 0x2b, 0x88,
+  0x2b, 0xee, 0xaf, 0x8a, 0x5a, 0x6c, 0x2d, 0x22, 0x6f, 0x6e, 0xbe, 0xc2,
+  0xd8, 0x8a, 0x04, 0xcf, 0xe2, 0xf3, 0x98, 0x81, 0xf0, 0x71, 0x51, 0x9f,
+  0x11, 0xf3, 0x21, 0x21, 0x5f, 0x51, 0x71, 0x25, 0xf5, 0x11, 0x33, 0x3f,
+  0x12, 0xe6, 0x34, 0x54, 0x13, 0x5f, 0x52, 0xe2, 0x12, 0xe6, 0x0a, 0x0a,
+  0xf0, 0x57, 0x44, 0x77, 0x23, 0x41, 0xf1, 0x71, 0x61, 0x1f, 0x33, 0xf1,
+  0x53, 0x31, 0x5f, 0x55, 0x31, 0x61, 0x2a, 0xf6, 0x41, 0x41, 0x5d, 0x16,
+  0x37, 0x16, 0x1f, 0x13, 0xbe, 0x41, 0x64, 0x38, 0x2f, 0x17, 0xf3, 0x31,
+  0x73, 0x2b, 0x44, 0x4f, 0x12, 0xf2, 0x2c, 0x2c, 0x4f, 0xe6, 0xf6, 0x26,
+  0x2d, 0x7e, 0x71, 0xdf, 0x52, 0x56, 0x74, 0x7f, 0x54, 0xe2, 0x42, 0xf2,
+  0x64, 0x64, 0x6a, 0xf2, 0x25, 0x67, 0x3f, 0x32, 0xf2, 0x61, 0xa3, 0x2b,
+  0xcc, 0x24, 0x25, 0x72, 0x44, 0xf6, 0xe2, 0xc2, 0x2b, 0xaa, 0xaf, 0x8a,
+  0xf2, 0x6c, 0x6e, 0x2f, 0x24, 0xf6, 0xa6, 0xa6, 0xca, 0xd8, 0x88, 0xa4,
+  0x44, 0xcf, 0xe2, 0xfb, 0xc4, 0x93, 0xc0, 0x11, 0x7f, 0x05, 0x40, 0x04,
+  0x40, 0x81, 0x04, 0x0c, 0x05, 0x10, 0x44, 0xd9, 0x06, 0xf0, 0x0f, 0x00,
+  0x00, 0x81, 0x41, 0x40, 0x01, 0x14, 0x40, 0x01, 0x00, 0x24, 0x82, 0x00,
+  0x24, 0x00, 0x82, 0x00, 0x28, 0x00, 0x00, 0xf0, 0x96, 0x1f, 0x00, 0x19,
+  0x22, 0x12, 0x11, 0x84, 0x22, 0x9c, 0x06, 0xf2, 0x29, 0x02, 0x48, 0x14,
+  0x32, 0x14, 0x13, 0xa2, 0x14, 0x32, 0x80, 0x84, 0xa2, 0x42, 0x14, 0x2a,
+  0x24, 0x34, 0x21, 0x12, 0x1b, 0x42, 0x90, 0x44, 0xa0, 0x42, 0x44, 0x58,
+  0x10, 0x84, 0x22, 0x44, 0x24, 0x14, 0x21, 0x04, 0x80, 0x04, 0x48, 0x46,
+  0x02, 0x42, 0x20, 0x24, 0x18, 0x82, 0x04, 0x8e, 0x41, 0x5b, 0x5b, 0xc0,
+  0x42, 0x1f, 0x41, 0x52, 0x28, 0x5e, 0x09, 0xf0, 0x05, 0x36, 0x4e, 0x1d,
+  0x24, 0xaf, 0x24, 0xd1, 0x41, 0xf6, 0x4a, 0x91, 0x19, 0xb2, 0x4a, 0x19,
+  0xf5, 0x4a, 0x92, 0x4b, 0x42, 0x20, 0x09, 0xf2, 0x09, 0x2f, 0x74, 0x79,
+  0x24, 0xd8, 0x12, 0xf9, 0x24, 0x48, 0x5c, 0xf9, 0x25, 0x4a, 0x1c, 0xf8,
+  0x25, 0x4a, 0x16, 0xf5, 0x26, 0x4a, 0x96, 0xf5, 0x21, 0x63, 0x09, 0xf0,
+  0x1b, 0x2d, 0x4a, 0x1f, 0x49, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x2a, 0x1f,
+  0x49, 0x72, 0x48, 0xf2, 0x91, 0x24, 0xa7, 0x14, 0x1f, 0x48, 0xb2, 0x4e,
+  0xf1, 0x81, 0x24, 0xab, 0x94, 0x1b, 0x28, 0xaf, 0x14, 0x19, 0xf5, 0x4a,
+  0x91, 0x43, 0xb2, 0x4a, 0x39, 0xa4, 0xab, 0xf3, 0x08, 0xf0, 0x10, 0xf9,
+  0xa4, 0x48, 0x98, 0x4f, 0xaa, 0xf4, 0x34, 0x23, 0xc0, 0x4a, 0x1f, 0x41,
+  0x94, 0x18, 0x1f, 0x41, 0xb4, 0x48, 0x71, 0x11, 0xb4, 0x48, 0x51, 0x41,
+  0x89, 0x11, 0xf1, 0x48, 0x94, 0x11, 0x61, 0x09, 0x51, 0x9a, 0x41, 0x8f,
+  0x14, 0x09, 0x5f, 0x09, 0xf2, 0x31, 0x59, 0x86, 0x98, 0x2d, 0x18, 0x98,
+  0xac, 0xa8, 0x81, 0xa4, 0x96, 0x41, 0x68, 0x49, 0xb4, 0x96, 0x44, 0xfb,
+  0x91, 0x2c, 0xf0, 0x91, 0x4c, 0x85, 0xf2, 0x91, 0x24, 0x83, 0xe2, 0x49,
+  0x32, 0x2a, 0x1f, 0x48, 0xb2, 0x28, 0xc1, 0x24, 0xad, 0x94, 0x28, 0xad,
+  0xb4, 0x90, 0xba, 0x43, 0x92, 0xb2, 0x22, 0x19, 0x79, 0x24, 0x98, 0xb2,
+  0x67, 0x82, 0x98, 0x2f, 0x22, 0xf1, 0x12, 0xd1, 0x40, 0x28, 0x44, 0x09,
+  0x02, 0x95, 0x0e, 0x13, 0x18, 0x57, 0x09, 0x15, 0x48, 0x14, 0x00, 0xf0,
+  0xf5, 0x10, 0x08, 0xf0, 0xe3, 0xbb, 0x24, 0x48, 0x11, 0x11, 0x14, 0x4d,
+  0x42, 0x48, 0x00, 0x17, 0x24, 0x85, 0x85, 0xd4, 0x18, 0xc4, 0x43, 0x1c,
+  0x04, 0x61, 0x11, 0x11, 0x4d, 0x11, 0x13, 0x01, 0x00, 0x80, 0x14, 0x01,
+  0x35, 0x82, 0x11, 0xe2, 0x11, 0x02, 0x23, 0x62, 0x22, 0x12, 0x21, 0x53,
+  0x71, 0x12, 0x02, 0x24, 0x34, 0x30, 0x11, 0x44, 0x17, 0x22, 0x24, 0xc6,
+  0x01, 0x86, 0x11, 0x02, 0x88, 0x4b, 0x28, 0x43, 0x28, 0x98, 0x82, 0x20,
+  0x28, 0xd2, 0xda, 0x02, 0x28, 0x82, 0x00, 0x22, 0x18, 0x88, 0x37, 0x41,
+  0x00, 0x10, 0x02, 0x00, 0x91, 0x80, 0x18, 0x02, 0x40, 0x01, 0x14, 0x28,
+  0x44, 0x14, 0x42, 0x13, 0x14, 0x5c, 0x82, 0x82, 0x45, 0x02, 0x1c, 0x44,
+  0x01, 0x40, 0x33, 0x81, 0x00, 0x24, 0x30, 0x42, 0x00, 0x21, 0x58, 0x18,
+  0x43, 0x12, 0x24, 0x04, 0x00, 0x4c, 0x48, 0x45, 0xf8, 0x4e, 0x8e, 0xb0,
+  0x22, 0x24, 0x0c, 0x14, 0x46, 0x34, 0x42, 0x88, 0x2d, 0x11, 0x10, 0x34,
+  0x44, 0x25, 0x21, 0x36, 0x43, 0x50, 0x92, 0x40, 0x63, 0x51, 0x18, 0x24,
+  0x14, 0x30, 0x11, 0x30, 0x84, 0x15, 0x82, 0x74, 0x12, 0x13, 0x64, 0x13,
+  0x11, 0x2d, 0x22, 0x26, 0x92, 0x48, 0x11, 0x47, 0x35, 0x12, 0x31, 0x13,
+  0x58, 0x32, 0x30, 0x11, 0x41, 0x3f, 0x24, 0x12, 0x94, 0x82, 0x23, 0xe2,
+  0x31, 0x28, 0x21, 0x22, 0xe8, 0x44, 0x3a, 0x84, 0x24, 0x2c, 0x18, 0x04,
+  0x83, 0xf1, 0xce, 0x58, 0x00, 0x11, 0x14, 0x20, 0x22, 0x01, 0x44, 0x46,
+  0x53, 0x81, 0xc0, 0x48, 0x14, 0x00, 0x41, 0x14, 0x82, 0x10, 0x01, 0x00,
+  0xa0, 0x24, 0x11, 0x10, 0x21, 0x44, 0x1a, 0x88, 0x48, 0x04, 0x13, 0x11,
+  0x02, 0x00, 0x21, 0x00, 0x10, 0x02, 0x90, 0x41, 0x80, 0x04, 0x41, 0x44,
+  0x00, 0x82, 0x20, 0xc8, 0x84, 0x22, 0x8f, 0x5e, 0x05, 0xa2, 0x05, 0x30,
+  0x00, 0x00, 0x25, 0xd8, 0x07, 0xa0, 0x44, 0x00, 0x11, 0x00, 0x88, 0x48,
+  0x10, 0x21, 0x04, 0x14, 0x21, 0x01, 0x70, 0x10, 0x11, 0x12, 0x01, 0x11,
+  0x00, 0x20, 0x34, 0x01, 0xf0, 0x59, 0x80, 0x08, 0xaf, 0x45, 0x05, 0x00,
+  0x00, 0x20, 0x51, 0x42, 0x43, 0x02, 0x22, 0x84, 0x10, 0x01, 0x00, 0x40,
+  0x34, 0x88, 0x41, 0x1a, 0x88, 0x92, 0x25, 0x22, 0x70, 0x24, 0x02, 0x10,
+  0x01, 0x12, 0x46, 0x14, 0x44, 0xb2, 0x21, 0x11, 0x04, 0x11, 0x22, 0x46,
+  0x02, 0xb0, 0x86, 0x02, 0x80, 0x14, 0x09, 0x42, 0x21, 0x83, 0x04, 0x41,
+  0x20, 0x02, 0x40, 0x14, 0xe8, 0xee, 0x0d, 0x00, 0x80, 0x02, 0x1a, 0x42,
+  0x14, 0x04, 0x24, 0x00, 0x14, 0x00, 0x00, 0x60, 0x88, 0x41, 0x12, 0x22,
+  0x14, 0x80, 0xc8, 0x64, 0x21, 0x80, 0x04, 0x14, 0x44, 0x44, 0x80, 0x12,
+  0x04, 0x11, 0x28, 0x50, 0x22, 0x24, 0x59, 0x0a, 0x20, 0x04, 0xc0, 0xc2,
+  0xc0, 0x48, 0xfc, 0x07, 0xf0, 0x1b, 0x84, 0xeb, 0x35, 0x00, 0x42, 0x00,
+  0x40, 0x02, 0x22, 0x20, 0x52, 0x2c, 0x00, 0x22, 0x00, 0x40, 0x14, 0x04,
+  0x2c, 0x18, 0x61, 0x42, 0x32, 0x80, 0x08, 0x11, 0x11, 0x80, 0x31, 0x41,
+  0x00, 0xa7, 0x11, 0x80, 0x04, 0x20, 0x44, 0x01, 0x00, 0x11, 0x41, 0x94,
+  0x6d, 0x0c, 0xf0, 0x71, 0x42, 0x02, 0x43, 0x28, 0xf1, 0x6b, 0x4b, 0x14,
+  0x48, 0x00, 0x00, 0x10, 0x09, 0x85, 0x12, 0x04, 0x12, 0x20, 0xc8, 0x48,
+  0x00, 0x60, 0x18, 0x81, 0x23, 0x81, 0x81, 0x12, 0x28, 0x12, 0x61, 0x22,
+  0x00, 0xb0, 0x54, 0x88, 0x31, 0x4a, 0x18, 0xc0, 0x92, 0x80, 0x98, 0x82,
+  0x18, 0x10, 0x44, 0x35, 0x24, 0x18, 0x31, 0x00, 0x40, 0x34, 0x14, 0x10,
+  0x22, 0x08, 0x86, 0x44, 0xcc, 0x14, 0x68, 0x9f, 0x46, 0x0e, 0x80, 0x02,
+  0x26, 0x42, 0x02, 0x43, 0x52, 0x21, 0x41, 0x14, 0x83, 0x11, 0x22, 0x88,
+  0x01, 0x44, 0x41, 0x81, 0x44, 0x23, 0x02, 0x10, 0xc1, 0x24, 0x00, 0x80,
+  0x81, 0x09, 0x11, 0x48, 0x00, 0x40, 0x94, 0x14, 0x28, 0x18, 0x60, 0x12,
+  0x00, 0x10, 0x04, 0x81, 0x00, 0x00, 0xc0, 0x28, 0x85, 0x34, 0x88, 0x20,
+  0x08, 0x88, 0x2f, 0x9c, 0x02, 0x44, 0x10, 0x42, 0xb1, 0x14, 0x02, 0x18,
+  0x70, 0x08, 0xf0, 0x85, 0x00, 0x88, 0x10, 0x08, 0x41, 0x22, 0x44, 0x50,
+  0x84, 0x84, 0x53, 0x44, 0x32, 0x44, 0x84, 0x00, 0x86, 0x44, 0x04, 0x00,
+  0x00, 0x50, 0x22, 0x00, 0x88, 0x00, 0x00, 0x3c, 0x01, 0x10, 0x82, 0x88,
+  0x02, 0x22, 0x00, 0xf0, 0xda, 0x8c, 0x00, 0x28, 0x60, 0x32, 0x32, 0x21,
+  0x57, 0x82, 0x14, 0xe1, 0x21, 0x2c, 0x81, 0x81, 0x98, 0x88, 0x81, 0x44,
+  0x44, 0x84, 0x86, 0x6d, 0x82, 0x18, 0x1a, 0x62, 0x12, 0x26, 0x98, 0x24,
+  0x85, 0xf1, 0x45, 0x22, 0x18, 0x6b, 0x48, 0x81, 0xd6, 0x84, 0xd5, 0x48,
+  0x6c, 0x41, 0xa0, 0x18, 0x41, 0x2c, 0x28, 0x41, 0x42, 0x51, 0x42, 0x54,
+  0x49, 0x7a, 0x14, 0x12, 0x11, 0x08, 0x34, 0x44, 0x49, 0x51, 0x22, 0x28,
+  0x47, 0x8a, 0x81, 0x4b, 0x82, 0xcc, 0x48, 0x84, 0xfe, 0x4c, 0xe2, 0x90,
+  0x44, 0x10, 0x02, 0x41, 0x80, 0x01, 0x50, 0x41, 0x81, 0x00, 0x12, 0x42,
+  0x80, 0x08, 0x24, 0x50, 0x42, 0x40, 0x14, 0x14, 0x08, 0x00, 0x12, 0x40,
+  0x41, 0x02, 0x00, 0x45, 0x22, 0x21, 0x22, 0x88, 0x5a, 0x06, 0xf0, 0x01,
+  0x00, 0x12, 0x00, 0x60, 0x88, 0x20, 0x08, 0x80, 0x41, 0xe2, 0x7d, 0x02,
+  0x40, 0x14, 0x04, 0x43, 0x97, 0x00, 0x60, 0x80, 0x09, 0x20, 0x89, 0x21,
+  0x13, 0xb8, 0x00, 0xf0, 0xea, 0x84, 0x20, 0x02, 0x48, 0x00, 0x81, 0x21,
+  0x00, 0x50, 0x18, 0x10, 0x24, 0x38, 0x42, 0x40, 0x21, 0xc8, 0x82, 0x00,
+  0x41, 0x98, 0x48, 0x00, 0x44, 0x00, 0x00, 0xf0, 0xbc, 0xa1, 0x40, 0x01,
+  0x94, 0x45, 0x88, 0x22, 0x02, 0x4a, 0x41, 0x12, 0xd8, 0x28, 0x61, 0x94,
+  0x42, 0x86, 0x18, 0x01, 0x90, 0x41, 0xa4, 0x90, 0x44, 0x81, 0x68, 0x2a,
+  0x04, 0xc0, 0x19, 0x4c, 0x04, 0x83, 0x62, 0x29, 0x8e, 0x42, 0x80, 0x88,
+  0x11, 0x04, 0x21, 0x21, 0x10, 0x54, 0x41, 0x86, 0x48, 0x82, 0x04, 0x12,
+  0x13, 0x0c, 0x15, 0x48, 0x22, 0x11, 0x44, 0x88, 0xb9, 0x18, 0x14, 0x04,
+  0xf0, 0x73, 0xbe, 0x00, 0x46, 0x54, 0x14, 0x20, 0x82, 0x02, 0x48, 0x40,
+  0x58, 0x24, 0x48, 0x42, 0x22, 0x14, 0x98, 0x18, 0x18, 0xa1, 0x40, 0x02,
+  0x4a, 0x22, 0x05, 0x88, 0x16, 0x81, 0x02, 0x8c, 0x84, 0x18, 0x13, 0x18,
+  0x12, 0x08, 0x48, 0x85, 0x01, 0x44, 0x86, 0x34, 0x42, 0x88, 0x14, 0x82,
+  0x41, 0x80, 0x18, 0x84, 0x21, 0x14, 0x02, 0x20, 0xc1, 0x12, 0x00, 0x12,
+  0x1f, 0xca, 0x0d, 0x85, 0xb9, 0x48, 0xb4, 0x48, 0x34, 0x4c, 0x46, 0x14,
+  0x04, 0x18, 0x10, 0x72, 0x14, 0x5c, 0xc5, 0x4b, 0x2b, 0x8b, 0xa2, 0x22,
+  0x00, 0x19, 0x46, 0x02, 0x56, 0x56, 0x2a, 0x25, 0xa2, 0x31, 0x1a, 0xe1,
+  0x89, 0xb8, 0x88, 0x38, 0xc4, 0x80, 0x82, 0x71, 0xc1, 0x53, 0x11, 0x13,
+  0x78, 0x18, 0x58, 0xc8, 0x8b, 0x44, 0x2b, 0x44, 0x23, 0x04, 0x40, 0x45,
+  0x08, 0x29, 0x74, 0x84, 0xd6, 0x44, 0x71, 0x64, 0x01, 0x87, 0x18, 0x20,
+  0x11, 0x54, 0x84, 0x82, 0x46, 0x5a, 0x26, 0x25, 0xa2, 0x11, 0x3f, 0xdf,
+  0x04, 0x40, 0x04, 0x00, 0x00, 0x40, 0x02, 0x20, 0x01, 0x40, 0x01, 0x23,
+  0x08, 0x84, 0x2b, 0x02, 0x51, 0x08, 0x10, 0x64, 0x82, 0x12, 0x08, 0x04,
+  0xf0, 0x10, 0x25, 0x04, 0x88, 0x24, 0x82, 0x42, 0x00, 0x10, 0x01, 0x40,
+  0x84, 0x81, 0x04, 0x00, 0x70, 0xf1, 0x0b, 0x81, 0x84, 0x42, 0x48, 0x00,
+  0x00, 0x8c, 0x24, 0x04, 0x45, 0x42, 0x24, 0x82, 0x03, 0x38, 0x00, 0xf0,
+  0x3a, 0x21, 0x12, 0x18, 0x13, 0xa8, 0x84, 0x10, 0x82, 0x02, 0x19, 0x61,
+  0x18, 0x10, 0x48, 0x2c, 0x84, 0x14, 0x01, 0x20, 0x01, 0x00, 0x41, 0x2d,
+  0x24, 0x22, 0x38, 0x80, 0x18, 0x88, 0x44, 0x24, 0x48, 0x02, 0x21, 0x5f,
+  0x6a, 0x03, 0x84, 0x42, 0x48, 0x1d, 0x62, 0x15, 0x12, 0x14, 0x88, 0x02,
+  0x00, 0x44, 0x44, 0x28, 0x28, 0x00, 0x20, 0x41, 0x81, 0x08, 0x35, 0x38,
+  0x12, 0x18, 0x18, 0x88, 0x88, 0x00, 0x30, 0x11, 0x14, 0x14, 0x40, 0x08,
+  0x48, 0x15, 0x86, 0x0c, 0x30, 0x41, 0x16, 0x04, 0x7a, 0x04, 0x80, 0x24,
+  0x10, 0x32, 0x12, 0x5f, 0x68, 0x05, 0x80, 0xdb, 0x05, 0x10, 0x40, 0x12,
+  0x00, 0x51, 0x60, 0x44, 0x20, 0x14, 0x02, 0xa2, 0x04, 0x32, 0x14, 0x40,
+  0x44, 0xa3, 0x04, 0x00, 0x3f, 0x09, 0x80, 0x21, 0x00, 0x00, 0x21, 0x80,
+  0xf1, 0x55, 0xe8, 0x10, 0x00, 0xf0, 0x0c, 0x12, 0x20, 0x18, 0x08, 0x00,
+  0x10, 0x11, 0x42, 0x08, 0x20, 0x02, 0x20, 0x02, 0x00, 0x10, 0x12, 0x04,
+  0x00, 0x30, 0x12, 0x00, 0x60, 0x18, 0x00, 0x83, 0x01, 0x00, 0xbf, 0x09,
+  0xf0, 0x30, 0x10, 0x08, 0x42, 0x40, 0x08, 0xeb, 0x31, 0x10, 0x78, 0x48,
+  0xa8, 0x44, 0x4a, 0x04, 0x40, 0x01, 0x42, 0x84, 0x41, 0xc5, 0x74, 0x24,
+  0xa4, 0x62, 0x2a, 0x02, 0x00, 0x10, 0x44, 0x42, 0x56, 0x26, 0x23, 0x21,
+  0xa1, 0x19, 0x8a, 0xa8, 0x88, 0x8c, 0x04, 0x10, 0x73, 0x11, 0x51, 0x11,
+  0x81, 0x8d, 0x98, 0x87, 0x84, 0x42, 0x4a, 0x04, 0x00, 0x00, 0x14, 0x41,
+  0x41, 0x47, 0x42, 0x22, 0x2a, 0x6b, 0x0d, 0xd0, 0x24, 0x45, 0x52, 0x22,
+  0x23, 0xf1, 0xd9, 0x43, 0x00, 0x81, 0x41, 0x42, 0x28, 0x6f, 0x06, 0xf0,
+  0x19, 0xcd, 0x42, 0x20, 0x02, 0x00, 0x80, 0x12, 0x04, 0x24, 0x11, 0x20,
+  0x01, 0x82, 0x00, 0x20, 0x84, 0x38, 0x11, 0x00, 0x83, 0x01, 0x42, 0x41,
+  0x00, 0x00, 0x81, 0x20, 0x54, 0x84, 0x28, 0x28, 0x12, 0x80, 0x08, 0x00,
+  0x40, 0x12, 0xf4, 0x1e, 0x3f, 0xb6, 0x00, 0xf0, 0x11, 0x04, 0x10, 0x48,
+  0x01, 0x48, 0x00, 0x42, 0x12, 0x90, 0x84, 0x00, 0x82, 0x20, 0x42, 0x24,
+  0x82, 0x42, 0x08, 0x50, 0x28, 0x42, 0x24, 0x00, 0x00, 0x88, 0x43, 0x08,
+  0x40, 0x01, 0x11, 0x00, 0x84, 0xcc, 0x00, 0xc0, 0x00, 0x00, 0x41, 0xf0,
+  0x1e, 0xbc, 0x00, 0x00, 0x00, 0x14, 0x20, 0x12, 0xac, 0x0b, 0x04, 0x01,
+  0x00, 0x10, 0x24, 0x05, 0x00, 0xf0, 0xeb, 0x14, 0x50, 0x81, 0x00, 0x81,
+  0x20, 0x04, 0x00, 0x00, 0x10, 0x04, 0x00, 0x6f, 0xf3, 0x0f, 0x00, 0x40,
+  0xc1, 0x22, 0x00, 0x40, 0x1a, 0x11, 0x28, 0x04, 0x42, 0x12, 0x24, 0x23,
+  0xc8, 0x88, 0x1e, 0x44, 0x10, 0x04, 0x22, 0x00, 0x40, 0x28, 0x04, 0xa5,
+  0x88, 0x86, 0xe4, 0x28, 0x61, 0x21, 0x12, 0x12, 0x41, 0x50, 0x11, 0x44,
+  0x11, 0x11, 0x50, 0x21, 0x81, 0x20, 0x15, 0x18, 0x22, 0x01, 0x82, 0xcc,
+  0x09, 0x44, 0x43, 0x18, 0x04, 0x70, 0x24, 0x0f, 0x10, 0x44, 0x34, 0x21,
+  0x21, 0x45, 0x14, 0xb1, 0x11, 0x22, 0xb4, 0x88, 0x04, 0x12, 0x83, 0x14,
+  0x02, 0x11, 0x00, 0x81, 0x53, 0xa2, 0x24, 0x10, 0x49, 0x21, 0x12, 0x08,
+  0x24, 0x10, 0x44, 0x62, 0x24, 0x12, 0x49, 0x08, 0x82, 0x82, 0x82, 0x40,
+  0x13, 0x94, 0x18, 0x1a, 0x88, 0x28, 0x08, 0x24, 0x20, 0x44, 0xc1, 0x12,
+  0x00, 0x89, 0x94, 0x44, 0x42, 0x10, 0x08, 0x4f, 0x3e, 0x05, 0x00, 0x00,
+  0x14, 0x11, 0x84, 0x22, 0x99, 0x04, 0x50, 0x28, 0x00, 0x46, 0x81, 0x01,
+  0x41, 0x80, 0xa4, 0x88, 0x41, 0x41, 0x43, 0x02, 0x22, 0x11, 0xc0, 0x4c,
+  0x2c, 0x82, 0x81, 0x01, 0x00, 0x20, 0x41, 0x24, 0x18, 0x02, 0x10, 0x11,
+  0x18, 0x91, 0x48, 0x81, 0x42, 0x20, 0x04, 0x00, 0x12, 0x00, 0x10, 0x14,
+  0xf4, 0x6d, 0xa8, 0xf0, 0x26, 0x26, 0x2d, 0x22, 0x2a, 0xb1, 0x12, 0x01,
+  0x29, 0x01, 0x2c, 0x51, 0x22, 0x29, 0xf8, 0x12, 0x13, 0x3f, 0x11, 0xb1,
+  0x81, 0xe9, 0x99, 0xd9, 0x88, 0xf8, 0x88, 0x41, 0x4e, 0x48, 0x42, 0x1d,
+  0x49, 0x15, 0xc1, 0x41, 0x95, 0x59, 0x88, 0x4e, 0x48, 0x8f, 0xc4, 0xd4,
+  0x44, 0xb4, 0x44, 0xe2, 0x42, 0x22, 0xc2, 0x24, 0x80, 0x52, 0x44, 0x45,
+  0xe4, 0x42, 0x72, 0x26, 0x56, 0x3a, 0x00, 0x79, 0xa1, 0x81, 0x2b, 0x98,
+  0x82, 0x2c, 0x59, 0x3c, 0x00, 0xf7, 0x59, 0xb8, 0x88, 0xe4, 0x84, 0x24,
+  0xc4, 0x48, 0x80, 0x54, 0x88, 0x85, 0xe8, 0x84, 0xf4, 0x1e, 0x89, 0xf0,
+  0x26, 0x22, 0x25, 0xa2, 0x12, 0x1a, 0x32, 0x12, 0x00, 0x50, 0x22, 0x31,
+  0x3c, 0xf1, 0x11, 0x11, 0x99, 0xe8, 0x89, 0x5c, 0x98, 0x8b, 0x48, 0x4a,
+  0x6c, 0x84, 0x14, 0x1d, 0x41, 0x50, 0x81, 0x85, 0x98, 0x44, 0x8f, 0x44,
+  0x56, 0x44, 0x4b, 0x24, 0x2a, 0x66, 0x42, 0x80, 0x82, 0x42, 0x54, 0x64,
+  0x28, 0x6f, 0x22, 0x72, 0x12, 0x82, 0xa9, 0x11, 0x2b, 0x81, 0x8a, 0xa8,
+  0x18, 0xd0, 0x22, 0x18, 0xc3, 0x13, 0x1f, 0x11, 0x91, 0x89, 0x9e, 0xc8,
+  0x85, 0xb9, 0x88, 0xa4, 0xc4, 0x46, 0x08, 0x48, 0x40, 0x58, 0x88, 0x49,
+  0xf4, 0x48, 0x2a, 0x8a, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x3f, 0xff, 0xe4,
+  0x0f, 0x16, 0x00, 0x00, 0x06, 0x01, 0x00, 0x3f, 0xf0, 0x4f, 0xfe, 0x16,
+  0x00, 0x00, 0x07, 0x01, 0x00, 0x0f, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+  0xfe, 0xff, 0x7e, 0x20, 0x64, 0x14, 0x14, 0x48, 0x84, 0x45, 0x98, 0x44,
+  0x16, 0x18, 0x22, 0x12, 0x24, 0x08, 0x40, 0x94, 0x21, 0x4c, 0xa2, 0x21,
+  0x1e, 0x26, 0x82, 0x8b, 0x21, 0x30, 0x18, 0x27, 0x88, 0x30, 0x22, 0x44,
+  0x88, 0x29, 0x19, 0x02, 0x1b, 0x84, 0x42, 0x1c, 0x18, 0x28, 0x24, 0x44,
+  0x41, 0x48, 0x58, 0x84, 0x48, 0x84, 0xb0, 0x85, 0x84, 0x21, 0x01, 0x44,
+  0x40, 0x44, 0x02, 0x16, 0x22, 0x21, 0x09, 0x83, 0x01, 0x4f, 0x61, 0x49,
+  0x12, 0x41, 0x18, 0x5a, 0x29, 0x46, 0x87, 0x94, 0x28, 0x43, 0xd6, 0x24,
+  0xf6, 0x14, 0xc3, 0x22, 0x22, 0x43, 0x42, 0x74, 0xa1, 0x12, 0x14, 0x52,
+  0x63, 0x84, 0x13, 0xf3, 0x82, 0x41, 0xab, 0x81, 0x88, 0x12, 0x2f, 0x44,
+  0x78, 0x91, 0xc2, 0x13, 0x13, 0xc1, 0x2d, 0x1f, 0x81, 0xe8, 0x9c, 0x61,
+  0x81, 0x83, 0x98, 0x48, 0x17, 0x44, 0x25, 0x91, 0x19, 0x84, 0x1b, 0x48,
+  0x2f, 0x54, 0x29, 0xd4, 0x84, 0xe1, 0x44, 0x71, 0x46, 0x42, 0x42, 0x25,
+  0x98, 0x94, 0x70, 0x41, 0x76, 0x48, 0x12, 0xe4, 0x61, 0x44, 0xcc, 0xc2,
+  0x42, 0x2b, 0x81, 0xc2, 0x6f, 0x28, 0xf1, 0x2a, 0x1d, 0x10, 0x02, 0x20,
+  0x94, 0x4a, 0x41, 0x22, 0x56, 0x02, 0x44, 0x44, 0x2a, 0x88, 0x42, 0x04,
+  0x54, 0x10, 0x31, 0x28, 0x86, 0x61, 0x84, 0x25, 0x08, 0x18, 0x41, 0x2a,
+  0x99, 0x14, 0x82, 0x16, 0x14, 0x82, 0x44, 0x08, 0x42, 0xa4, 0x11, 0x10,
+  0x48, 0x23, 0x08, 0x48, 0x42, 0x90, 0x82, 0x17, 0x41, 0x20, 0x08, 0x34,
+  0x49, 0x04, 0x40, 0x02, 0x21, 0x21, 0x5a, 0x88, 0xf1, 0x19, 0x82, 0x00,
+  0x9d, 0x42, 0x84, 0x11, 0x24, 0x8c, 0x04, 0x10, 0xf4, 0x52, 0xa1, 0x21,
+  0x00, 0x30, 0xa1, 0x00, 0xc0, 0x14, 0x29, 0xe2, 0x18, 0x22, 0xc1, 0x88,
+  0xa3, 0x88, 0x44, 0x02, 0x21, 0x28, 0x91, 0x30, 0xd1, 0x88, 0x81, 0x44,
+  0x90, 0x51, 0x90, 0x88, 0x12, 0x43, 0x24, 0x91, 0x14, 0x61, 0x15, 0x06,
+  0x1a, 0x88, 0x01, 0x49, 0x44, 0x48, 0x82, 0xc4, 0x18, 0xc8, 0xc2, 0x12,
+  0x84, 0x41, 0xac, 0x47, 0x21, 0x04, 0x40, 0x48, 0x05, 0x44, 0x45, 0x08,
+  0x20, 0x02, 0x44, 0x40, 0x62, 0x22, 0x28, 0x49, 0x11, 0x02, 0x21, 0x20,
+  0x01, 0x88, 0x14, 0x80, 0x91, 0x88, 0x30, 0x11, 0x00, 0x90, 0x41, 0x48,
+  0x00, 0xc0, 0x41, 0x40, 0x18, 0x28, 0x04, 0x00, 0x44, 0x41, 0x00, 0x41,
+  0x41, 0x25, 0x04, 0x00, 0x20, 0xf8, 0xac, 0xf1, 0x10, 0x01, 0x11, 0x00,
+  0x90, 0x48, 0x22, 0x62, 0x00, 0x00, 0x40, 0x04, 0x41, 0x29, 0x02, 0x12,
+  0x12, 0x82, 0x40, 0x42, 0x02, 0x14, 0x11, 0x31, 0x98, 0x86, 0x08, 0x46,
+  0xc8, 0x81, 0x00, 0x84, 0x11, 0x48, 0xc4, 0x81, 0x41, 0x00, 0x42, 0x00,
+  0x00, 0x40, 0x02, 0x18, 0x80, 0x21, 0x21, 0x48, 0x02, 0x5f, 0xfb, 0x02,
+  0x00, 0x80, 0x01, 0xa1, 0x01, 0x23, 0x20, 0x04, 0x09, 0x00, 0xf0, 0xff,
+  0x17, 0xf0, 0x21, 0x59, 0x00, 0x11, 0x00, 0x1e, 0x21, 0x10, 0x48, 0x35,
+  0x42, 0x20, 0x44, 0x02, 0x85, 0x75, 0x42, 0x08, 0x21, 0x44, 0x1a, 0x18,
+  0x04, 0x00, 0x86, 0x84, 0x28, 0x92, 0x11, 0x84, 0x90, 0x63, 0x49, 0x04,
+  0x21, 0x28, 0x13, 0x08, 0x23, 0x11, 0x08, 0x84, 0x80, 0x91, 0x51, 0x87,
+  0x11, 0x11, 0x56, 0x08, 0x42, 0x24, 0x42, 0x20, 0x14, 0x24, 0x02, 0x86,
+  0x08, 0x16, 0x88, 0xf4, 0x72, 0xfe, 0x80, 0x04, 0x81, 0x90, 0x48, 0x19,
+  0x92, 0x42, 0x28, 0xa0, 0x28, 0x8b, 0x82, 0x19, 0x8a, 0x88, 0x08, 0x27,
+  0x18, 0x1b, 0x81, 0x88, 0x25, 0xa2, 0x24, 0xa8, 0x17, 0xc6, 0x18, 0x11,
+  0x2c, 0x12, 0x34, 0x42, 0x41, 0x1c, 0x38, 0x14, 0x1a, 0xc2, 0x48, 0x8e,
+  0x14, 0x44, 0x6c, 0x41, 0x01, 0x4c, 0x48, 0x04, 0x96, 0x71, 0x42, 0x5c,
+  0x48, 0x44, 0x21, 0x88, 0x21, 0x12, 0x43, 0x88, 0x58, 0x24, 0x12, 0x90,
+  0x82, 0x96, 0x88, 0x32, 0x44, 0x82, 0x88, 0x8f, 0xf2, 0x03, 0x00, 0x81,
+  0xf0, 0x58, 0x21, 0x14, 0x83, 0x14, 0x01, 0x40, 0xa8, 0x28, 0x23, 0xd8,
+  0xa5, 0x78, 0x48, 0x82, 0x88, 0x68, 0x48, 0x2b, 0x81, 0x43, 0x26, 0x98,
+  0x25, 0x30, 0x84, 0xa2, 0x23, 0x62, 0x11, 0x81, 0x86, 0xb1, 0x23, 0x34,
+  0x44, 0xac, 0xb4, 0x14, 0x28, 0x32, 0x91, 0x35, 0x82, 0x41, 0x4c, 0x44,
+  0xc8, 0x12, 0xcb, 0x14, 0x1f, 0xc1, 0xc4, 0x11, 0x25, 0x31, 0x18, 0xa0,
+  0x14, 0x41, 0x23, 0x04, 0x58, 0x41, 0x88, 0x81, 0x8c, 0x48, 0xc4, 0x18,
+  0xe0, 0x91, 0x0d, 0x48, 0x11, 0x00, 0x80, 0x12, 0xc2, 0x24, 0x23, 0xa4,
+  0x28, 0x6a, 0x18, 0x01, 0x00, 0x11, 0x2d, 0x11, 0x40, 0x02, 0x28, 0x8c,
+  0x84, 0x11, 0x01, 0x45, 0x22, 0x14, 0x04, 0x49, 0xa1, 0x21, 0x00, 0x41,
+  0x44, 0x00, 0x88, 0x00, 0x13, 0x08, 0x10, 0x0c, 0x4e, 0x82, 0x00, 0x82,
+  0x88, 0x41, 0x21, 0x90, 0x22, 0x92, 0x28, 0x48, 0x88, 0x8a, 0xf4, 0x67,
+  0x96, 0x10, 0x02, 0x21, 0x4c, 0x02, 0x28, 0x80, 0x42, 0x22, 0x01, 0x80,
+  0x28, 0x11, 0x0a, 0x81, 0x40, 0x01, 0x84, 0x01, 0xf0, 0x02, 0x14, 0x48,
+  0x80, 0x45, 0x84, 0x05, 0x00, 0x21, 0x28, 0x18, 0x00, 0x12, 0x42, 0x10,
+  0x04, 0x00, 0x20, 0x56, 0x01, 0xf1, 0xff, 0x32, 0x2a, 0x14, 0x08, 0x5f,
+  0xaa, 0x02, 0x42, 0x40, 0x04, 0x36, 0x22, 0x61, 0x22, 0x84, 0x16, 0x04,
+  0x46, 0x22, 0x22, 0x94, 0x42, 0x10, 0x42, 0x41, 0xb4, 0x22, 0x34, 0x12,
+  0x47, 0x11, 0x4b, 0x21, 0x20, 0xa2, 0x24, 0x29, 0xc2, 0x22, 0x4c, 0x51,
+  0x12, 0x21, 0x21, 0x61, 0x80, 0xe1, 0x18, 0x11, 0x54, 0x34, 0x3c, 0x28,
+  0xb8, 0x12, 0x42, 0x83, 0x61, 0x11, 0x11, 0x1c, 0x81, 0x04, 0x81, 0x48,
+  0x21, 0x82, 0x4c, 0x0c, 0x82, 0x80, 0x02, 0x22, 0x24, 0xaf, 0xb5, 0x0c,
+  0x00, 0x00, 0x22, 0x18, 0x22, 0x21, 0x20, 0x61, 0x24, 0xa0, 0x84, 0x00,
+  0x10, 0x09, 0x26, 0x01, 0x00, 0xc0, 0x24, 0x28, 0x00, 0x16, 0x54, 0x22,
+  0x10, 0x82, 0x01, 0x18, 0x82, 0x61, 0x26, 0x44, 0xc1, 0x82, 0x22, 0x80,
+  0x04, 0x80, 0x81, 0x04, 0x84, 0x46, 0x02, 0x88, 0x44, 0x20, 0x08, 0x00,
+  0x84, 0x24, 0xff, 0x51, 0x0c, 0x23, 0x04, 0x61, 0x4c, 0xc2, 0x12, 0x28,
+  0xc0, 0x28, 0x43, 0x11, 0x02, 0x28, 0xb0, 0x42, 0x11, 0x1a, 0x02, 0x41,
+  0x23, 0x34, 0x12, 0x17, 0x41, 0x4b, 0x12, 0x41, 0x60, 0x24, 0x22, 0x17,
+  0x22, 0x48, 0x14, 0x58, 0x45, 0xc2, 0x44, 0x00, 0x13, 0x01, 0x15, 0xe2,
+  0x28, 0x01, 0x12, 0x17, 0x21, 0x18, 0x13, 0x51, 0x41, 0x11, 0x00, 0x80,
+  0x01, 0x20, 0x0c, 0x00, 0x28, 0x2a, 0x84, 0x02, 0xcf, 0xf5, 0x0b, 0x50,
+  0x22, 0x10, 0x14, 0x54, 0x41, 0x54, 0x10, 0x26, 0x36, 0x44, 0x6e, 0x12,
+  0x42, 0x2a, 0x28, 0x21, 0x08, 0x11, 0x4b, 0x81, 0x2a, 0x44, 0x22, 0x8a,
+  0xe1, 0x71, 0x88, 0x82, 0x42, 0x42, 0x44, 0x05, 0x92, 0x10, 0x02, 0x18,
+  0x11, 0x21, 0xb0, 0x92, 0x42, 0x82, 0x81, 0x28, 0x84, 0xc2, 0x84, 0x45,
+  0xa8, 0x82, 0x50, 0x16, 0x48, 0x29, 0x15, 0x44, 0x84, 0x94, 0x48, 0xc1,
+  0x41, 0x00, 0xaf, 0xf8, 0x0b, 0xc0, 0x14, 0x48, 0x00, 0x00, 0x14, 0x10,
+  0x91, 0x14, 0x81, 0x20, 0x02, 0x10, 0x02, 0x00, 0x24, 0x00, 0x12, 0xa0,
+  0x48, 0x28, 0x00, 0x00, 0x13, 0x01, 0x00, 0x30, 0x14, 0x11, 0x90, 0x5a,
+  0x11, 0x18, 0x20, 0x01, 0x45, 0x82, 0x24, 0x02, 0x41, 0x44, 0x12, 0x81,
+  0x20, 0x48, 0x12, 0x08, 0x12, 0xef, 0x47, 0x0c, 0x12, 0x22, 0x00, 0x10,
+  0x08, 0x22, 0x00, 0x88, 0x83, 0x02, 0xf0, 0xaa, 0x12, 0x81, 0x00, 0x00,
+  0x10, 0x12, 0x44, 0x04, 0x4c, 0x24, 0x42, 0x32, 0x54, 0x40, 0x04, 0x40,
+  0x04, 0x14, 0x4a, 0x08, 0x14, 0x20, 0x01, 0x00, 0xe0, 0x28, 0x81, 0x08,
+  0x42, 0x10, 0x38, 0x44, 0x6f, 0xe3, 0x01, 0x2c, 0xe1, 0x42, 0x11, 0x12,
+  0x14, 0x44, 0x05, 0x19, 0x02, 0x2e, 0x41, 0x88, 0x89, 0x34, 0x42, 0x88,
+  0x00, 0x40, 0x21, 0x21, 0x02, 0x1a, 0xca, 0x18, 0x13, 0x08, 0x48, 0x28,
+  0x41, 0x25, 0x05, 0x43, 0x81, 0x01, 0x20, 0xf1, 0x14, 0x41, 0x29, 0x51,
+  0x14, 0x2d, 0x92, 0x8d, 0x52, 0x1d, 0x14, 0x40, 0xa1, 0xb4, 0x88, 0x15,
+  0x2a, 0x28, 0x11, 0x85, 0xb4, 0x44, 0xc1, 0x14, 0xe4, 0xc2, 0x8a, 0x64,
+  0xc4, 0xc1, 0x84, 0x49, 0xf4, 0x4b, 0xe2, 0x00, 0x00, 0x00, 0x84, 0x45,
+  0x01, 0x61, 0xa0, 0x14, 0x1a, 0x02, 0x80, 0x21, 0x18, 0x02, 0x4c, 0x88,
+  0x04, 0x00, 0x45, 0x82, 0x22, 0x02, 0x21, 0x10, 0x24, 0x48, 0x62, 0x44,
+  0x22, 0x10, 0x42, 0x04, 0x28, 0x00, 0x98, 0x48, 0x40, 0x04, 0x68, 0x24,
+  0x40, 0x06, 0x20, 0x09, 0x84, 0x00, 0x00, 0xef, 0x9a, 0x05, 0x00, 0x64,
+  0x00, 0x41, 0x10, 0x04, 0x00, 0x12, 0x21, 0x20, 0x62, 0x62, 0x00, 0x45,
+  0x02, 0x28, 0x4e, 0x14, 0x40, 0x06, 0x00, 0x2b, 0x14, 0x80, 0x22, 0x01,
+  0x44, 0xbd, 0x00, 0x30, 0x48, 0x00, 0x41, 0x07, 0x00, 0xf0, 0x8e, 0x4c,
+  0x04, 0x18, 0x00, 0xd0, 0x52, 0x43, 0x42, 0xc4, 0x22, 0x00, 0x40, 0xc2,
+  0x22, 0x1a, 0x82, 0x22, 0x29, 0x12, 0x02, 0x92, 0x10, 0x21, 0x22, 0x8a,
+  0x91, 0x11, 0x00, 0x30, 0x21, 0x68, 0x00, 0x24, 0x22, 0x18, 0x80, 0x01,
+  0x12, 0x18, 0x23, 0x03, 0x80, 0x42, 0xa2, 0x24, 0x00, 0x45, 0x22, 0x8c,
+  0x22, 0x56, 0x24, 0xc2, 0x00, 0x48, 0x82, 0x84, 0x48, 0x28, 0x22, 0x80,
+  0xf4, 0xf3, 0xd7, 0x40, 0x16, 0x44, 0x14, 0x04, 0x12, 0x00, 0x27, 0x41,
+  0x49, 0x93, 0x14, 0x21, 0x00, 0x18, 0x00, 0x25, 0x16, 0xf4, 0x22, 0x12,
+  0x18, 0x28, 0x22, 0x80, 0x84, 0x31, 0x22, 0x96, 0x54, 0x24, 0x16, 0x22,
+  0x32, 0x11, 0x12, 0x40, 0x02, 0x49, 0x01, 0x00, 0x42, 0x00, 0x20, 0x04,
+  0x42, 0x41, 0x42, 0x22, 0x00, 0x44, 0x84, 0x84, 0x24, 0x00, 0xb0, 0x8b,
+  0x02, 0x14, 0x10, 0x82, 0x01, 0x48, 0x8d, 0x13, 0x00, 0x40, 0x81, 0x24,
+  0x01, 0x80, 0xa4, 0x12, 0x00, 0xa0, 0x24, 0x30, 0x12, 0x80, 0x81, 0x26,
+  0x25, 0x22, 0xa1, 0x84, 0xc0, 0x42, 0x40, 0x02, 0x4e, 0x81, 0x21, 0xc0,
+  0x50, 0x01, 0xf0, 0x41, 0x22, 0x42, 0xf0, 0x44, 0x21, 0x20, 0x04, 0x00,
+  0x80, 0x02, 0x28, 0x48, 0xa0, 0x42, 0x44, 0xcf, 0x9a, 0x49, 0x42, 0x02,
+  0x70, 0x26, 0x42, 0x2a, 0x01, 0x2a, 0x01, 0x49, 0x02, 0x10, 0x2a, 0x01,
+  0x00, 0x44, 0x00, 0x20, 0x04, 0x28, 0x21, 0x48, 0xe0, 0x44, 0x22, 0x25,
+  0x14, 0x92, 0x41, 0x4a, 0x21, 0x24, 0x24, 0x04, 0x44, 0x21, 0x42, 0x00,
+  0x68, 0x46, 0x44, 0x24, 0x04, 0x42, 0x80, 0xa5, 0x42, 0x48, 0x48, 0x49,
+  0xa1, 0x42, 0x24, 0x00, 0x18, 0x6e, 0x94, 0x40, 0xc8, 0x14, 0x28, 0x48,
+  0xb8, 0x01, 0xf1, 0x01, 0x20, 0x01, 0x14, 0x2a, 0x01, 0x18, 0x21, 0x2a,
+  0x04, 0x70, 0x12, 0x02, 0x10, 0x42, 0x02, 0x20, 0x6b, 0x04, 0xf0, 0x3d,
+  0x49, 0x01, 0x00, 0x44, 0x1a, 0x08, 0x80, 0x02, 0x40, 0x01, 0x18, 0x00,
+  0x00, 0x2a, 0x04, 0xf0, 0xca, 0x46, 0x00, 0x28, 0x48, 0x80, 0x83, 0x82,
+  0x02, 0x29, 0x03, 0x28, 0x3a, 0x58, 0x41, 0x20, 0x82, 0x08, 0x66, 0x01,
+  0x82, 0x60, 0x19, 0x21, 0xa0, 0x1a, 0x11, 0x88, 0x11, 0x22, 0x11, 0x44,
+  0x21, 0x20, 0x01, 0x18, 0x90, 0x12, 0x80, 0x81, 0x22, 0x18, 0x02, 0x00,
+  0x29, 0x18, 0x81, 0x42, 0x82, 0x48, 0x02, 0x60, 0xa8, 0x28, 0x86, 0x04,
+  0xc2, 0x6f, 0x5b, 0x0d, 0x50, 0x00, 0xf0, 0x03, 0x40, 0x44, 0x02, 0x40,
+  0x44, 0x22, 0x01, 0x12, 0x12, 0x00, 0x18, 0x22, 0x10, 0x46, 0x22, 0x03,
+  0x10, 0x04, 0xad, 0x00, 0xf0, 0xff, 0x6c, 0x24, 0x22, 0x18, 0x00, 0x41,
+  0x00, 0x20, 0x22, 0x01, 0x00, 0x10, 0x04, 0x00, 0x00, 0xc0, 0x22, 0xf0,
+  0x16, 0xf1, 0x40, 0x08, 0x1c, 0x06, 0x2f, 0x12, 0x51, 0x22, 0x80, 0x44,
+  0x81, 0x04, 0x44, 0x80, 0x06, 0x00, 0x21, 0x00, 0x2d, 0x42, 0x10, 0x02,
+  0x18, 0x90, 0xd2, 0x24, 0x24, 0x40, 0x82, 0x28, 0xd4, 0x21, 0x08, 0x84,
+  0x2c, 0xc1, 0xc5, 0x60, 0x11, 0x12, 0x42, 0x48, 0x26, 0x01, 0x40, 0x04,
+  0x28, 0x80, 0x04, 0x41, 0x42, 0x41, 0x00, 0x40, 0xf4, 0xd6, 0x24, 0x24,
+  0x41, 0x61, 0x27, 0x22, 0x45, 0x16, 0x92, 0x12, 0x16, 0x82, 0x51, 0x14,
+  0x4f, 0x4a, 0xd1, 0x21, 0x81, 0x13, 0x89, 0xb5, 0x32, 0xf2, 0x41, 0x14,
+  0x18, 0x4f, 0x65, 0x41, 0x82, 0x6a, 0x21, 0x4e, 0x14, 0x36, 0x02, 0x68,
+  0x1e, 0x13, 0x2a, 0x71, 0xd4, 0x44, 0xa4, 0x41, 0x2b, 0x22, 0x13, 0x91,
+  0x16, 0x1c, 0x84, 0xa1, 0x51, 0x2d, 0x22, 0x4c, 0x39, 0x24, 0x9e, 0x12,
+  0x66, 0xa4, 0x48, 0x2e, 0x44, 0x14, 0xc6, 0x14, 0x21, 0x14, 0x21, 0x24,
+  0xb4, 0x22, 0xa4, 0x14, 0x90, 0x44, 0xc9, 0x68, 0x23, 0x41, 0x28, 0xf0,
+  0x72, 0xb7, 0x50, 0x42, 0x64, 0x45, 0xb4, 0x52, 0x72, 0x18, 0xf3, 0x14,
+  0x22, 0x37, 0x82, 0x69, 0x62, 0x43, 0x48, 0x23, 0xe2, 0x25, 0xc8, 0x14,
+  0x82, 0x18, 0x28, 0x36, 0x52, 0x12, 0x45, 0xf4, 0x23, 0x12, 0x29, 0xa4,
+  0xc2, 0x18, 0x47, 0x22, 0x24, 0x23, 0x42, 0xf2, 0x22, 0x41, 0x6f, 0x21,
+  0x76, 0x22, 0xc2, 0x14, 0x21, 0x5a, 0xe4, 0x21, 0xe9, 0x21, 0x64, 0x2c,
+  0x43, 0x31, 0x12, 0x1e, 0x14, 0x14, 0x12, 0x11, 0x2b, 0x24, 0x2c, 0x01,
+  0x28, 0x2a, 0x0a, 0x82, 0x18, 0x43, 0x84, 0x34, 0x42, 0x85, 0xac, 0x66,
+  0x48, 0x2a, 0xa8, 0x42, 0x6d, 0x44, 0x5f, 0x3a, 0x0a, 0x15, 0xa2, 0x23,
+  0x1c, 0x82, 0xa1, 0x32, 0x42, 0x28, 0x3e, 0x42, 0x29, 0xa3, 0x21, 0x1e,
+  0x24, 0x21, 0x63, 0x21, 0x11, 0xe1, 0x22, 0x88, 0xa2, 0x2a, 0x23, 0x21,
+  0xa5, 0x36, 0x1e, 0x21, 0xd0, 0x43, 0xb2, 0x62, 0xa8, 0x64, 0x2b, 0x45,
+  0x2c, 0xa3, 0x12, 0xce, 0x31, 0x16, 0xe2, 0x14, 0x0d, 0x50, 0x42, 0x33,
+  0x82, 0x51, 0x34, 0xa0, 0x44, 0x68, 0x42, 0xf0, 0xe4, 0x44, 0x49, 0xe6,
+  0x46, 0x95, 0x42, 0x4f, 0x64, 0x84, 0x34, 0x21, 0x88, 0xf0, 0x84, 0x24,
+  0x4a, 0x41, 0x98, 0x22, 0x29, 0x06, 0x5a, 0xf8, 0x8d, 0x5e, 0x10, 0x01,
+  0x11, 0x22, 0x11, 0x62, 0x11, 0x42, 0x13, 0xa1, 0x84, 0x13, 0xa1, 0x86,
+  0x11, 0x4a, 0x18, 0xe1, 0x14, 0x08, 0x4e, 0x81, 0xc0, 0x83, 0xc0, 0x81,
+  0xc0, 0x81, 0x40, 0x91, 0x12, 0x14, 0x60, 0x18, 0x18, 0x82, 0x20, 0x08,
+  0x13, 0x02, 0x00, 0xd2, 0x18, 0x32, 0x81, 0x21, 0x13, 0xb8, 0x22, 0x18,
+  0x91, 0x82, 0x11, 0x29, 0x08, 0x02, 0x00, 0xf0, 0xff, 0xff, 0xfa, 0x88,
+  0x80, 0xf8, 0x8d, 0xa6, 0x14, 0x1f, 0x16, 0x56, 0x33, 0x1f, 0x61, 0xf1,
+  0x34, 0x77, 0x8f, 0x95, 0xf5, 0x41, 0x61, 0x6f, 0x47, 0xf7, 0x64, 0x25,
+  0x6f, 0x52, 0xf7, 0x25, 0xe7, 0x2b, 0xdc, 0x1f, 0x38, 0xfa, 0x8b, 0xc9,
+  0x1d, 0xd3, 0x2b, 0xdc, 0xae, 0xa1, 0x1f, 0x1f, 0xff, 0x77, 0xf5, 0x7f,
+  0x5b, 0xeb, 0x1e, 0xfe, 0xa1, 0xc1, 0x5f, 0x56, 0xf6, 0x85, 0x85, 0x4f,
+  0x7a, 0xfa, 0x63, 0x63, 0x1f, 0x36, 0xd6, 0x33, 0xf5, 0x46, 0xc6, 0x5f,
+  0x1b, 0xfa, 0xf1, 0xe1, 0x7f, 0x5b, 0xa8, 0x4c, 0xc8, 0x4e, 0xc2, 0x5f,
+  0x58, 0xf8, 0x41, 0x41, 0x3f, 0x13, 0xd9, 0x61, 0xf8, 0x82, 0x85, 0x6e,
+  0x61, 0x7f, 0x7d, 0xfd, 0xe2, 0xe2, 0x6f, 0x7e, 0xfa, 0x52, 0x51, 0x3f,
+  0x74, 0xfe, 0x92, 0xd2, 0x3f, 0x3c, 0xfc, 0xc3, 0xc1, 0x2f, 0x24, 0xfc,
+  0xd3, 0xd3, 0x6f, 0x6e, 0xba, 0xd2, 0xdd, 0x64, 0xf8, 0xd2, 0xda, 0x6f,
+  0x4e, 0xaa, 0xcc, 0x4f, 0x44, 0xa4, 0xcc, 0x4f, 0x2c, 0xfc, 0x29, 0xe1,
+  0xe0, 0x62, 0xf2, 0x43, 0x47, 0x7f, 0x41, 0xf1, 0x34, 0x75, 0x8f, 0x91,
+  0x51, 0x31, 0x7f, 0x77, 0xf7, 0x66, 0x25, 0x2f, 0x53, 0xf5, 0x35, 0xe7,
+  0x3f, 0x5d, 0xac, 0x54, 0xaf, 0x81, 0xd7, 0x31, 0xfc, 0xc3, 0xe1, 0x6e,
+  0x61, 0x1f, 0x13, 0xf3, 0x24, 0xa6, 0x4f, 0x2e, 0xfe, 0x22, 0x21, 0x3f,
+  0x36, 0xf6, 0xe6, 0xf4, 0x4f, 0x4b, 0xfb, 0xa4, 0xb7, 0x1f, 0x36, 0xf4,
+  0xe2, 0xf2, 0x2f, 0x27, 0xf7, 0x67, 0xe5, 0x7f, 0x56, 0xf7, 0x62, 0x62,
+  0x4f, 0x6a, 0xba, 0xc1, 0xa4, 0xd5, 0x5a, 0xfd, 0xdc, 0xde, 0x2b, 0xcd,
+  0x3f, 0x96, 0xdd, 0x21, 0xf9, 0x96, 0xd1, 0xfe, 0xe1, 0x7f, 0x75, 0xf1,
+  0x63, 0x61, 0x4f, 0x5e, 0xfe, 0x94, 0xd1, 0x3f, 0x74, 0xfe, 0xd3, 0xd5,
+  0x4a, 0xe4, 0x46, 0xf6, 0x43, 0xc3, 0x2b, 0xfd, 0x4f, 0x46, 0xe6, 0x25,
+  0xf5, 0x42, 0xc2, 0x6f, 0x2d, 0xfd, 0x6e, 0x6c, 0x2e, 0x22, 0x4f, 0x4c,
+  0xac, 0x88, 0x4f, 0x45, 0xf5, 0x4d, 0xd5, 0x24, 0x6f, 0x62, 0xf2, 0x27,
+  0x66, 0x6f, 0x73, 0xf3, 0x36, 0x34, 0x9f, 0xa1, 0xa1, 0x22, 0x3f, 0x16,
+  0xe2, 0x23, 0xf6, 0x27, 0x34, 0x4f, 0x6f, 0xf2, 0x13, 0x95, 0x6e, 0x72,
+  0xaf, 0x81, 0x63, 0x2d, 0x3f, 0x11, 0xb9, 0x71, 0xe7, 0x13, 0xf3, 0x86,
+  0x14, 0x6f, 0x42, 0xfb, 0x61, 0x62, 0x2f, 0x16, 0xb7, 0xe2, 0xaf, 0x33,
+  0x5f, 0x62, 0xf3, 0xe6, 0xe5, 0x2f, 0x26, 0xfe, 0x62, 0x72, 0x7f, 0x75,
+  0xf5, 0x74, 0x64, 0x7a, 0xf6, 0xf6, 0x74, 0x4e, 0xd1, 0x1a, 0xe4, 0x2d,
+  0xf4, 0x54, 0x5c, 0xde, 0xc2, 0x1f, 0x23, 0x65, 0x79, 0x2f, 0x41, 0xf1,
+  0xf1, 0xe2, 0x4f, 0x47, 0xf7, 0x43, 0x41, 0x4f, 0x46, 0xf6, 0xd1, 0xf6,
+  0xce, 0x64, 0x3f, 0x55, 0xad, 0x44, 0x4e, 0x22, 0xca, 0xf4, 0x53, 0xd1,
+  0x4f, 0x46, 0xe2, 0x25, 0xf5, 0xc6, 0x44, 0x5e, 0xd8, 0xcf, 0xe6, 0xb6,
+  0x62, 0xf4, 0xc6, 0xc4, 0x4a, 0xb4, 0x44, 0x35, 0x3a, 0xf0, 0x21, 0x21,
+  0x7f, 0x62, 0xf6, 0x34, 0x17, 0x6f, 0x67, 0xd3, 0xab, 0xf1, 0x61, 0x63,
+  0x2b, 0x17, 0x3e, 0x62, 0x7f, 0x43, 0xf3, 0xf5, 0x27, 0x2f, 0x25, 0xbc,
+  0xa2, 0xfb, 0x1b, 0x19, 0x17, 0x3d, 0x2b, 0xd7, 0x1b, 0xaa, 0x3e, 0x11,
+  0x7f, 0x7c, 0xf4, 0x66, 0xe6, 0x3b, 0xab, 0x2f, 0x17, 0xf7, 0x61, 0x71,
+  0xba, 0xfb, 0x25, 0x24, 0x6f, 0x7e, 0xfa, 0x73, 0xe1, 0x2f, 0x27, 0xf7,
+  0xe6, 0x66, 0x7f, 0x75, 0xf7, 0xf3, 0xe3, 0x6f, 0x6e, 0xf6, 0x42, 0xc1,
+  0x5a, 0xe5, 0x2c, 0xf4, 0xd6, 0xde, 0x3f, 0x35, 0xf4, 0x3b, 0x52, 0x2f,
+  0x79, 0xf1, 0xd6, 0x94, 0x1f, 0x27, 0xf6, 0x75, 0x75, 0x2f, 0x2c, 0xfc,
+  0xe6, 0xe4, 0x5f, 0x65, 0xf7, 0xc1, 0x65, 0x2f, 0x25, 0xbd, 0xc2, 0xfe,
+  0x41, 0x63, 0x1f, 0x1c, 0xf4, 0x72, 0xd2, 0x6f, 0x4e, 0xae, 0x55, 0x4f,
+  0x6c, 0xb4, 0x56, 0xfd, 0xec, 0xee, 0x23, 0xf2, 0x66, 0x44, 0xca, 0xfc,
+  0xc4, 0xd4, 0x5f, 0xfd, 0x04, 0x41, 0x00, 0x40, 0x02, 0x2a, 0x21, 0x31,
+  0x24, 0x12, 0x24, 0x00, 0x12, 0x20, 0x81, 0x22, 0x41, 0x22, 0x01, 0x00,
+  0x20, 0x04, 0x80, 0x81, 0x92, 0x12, 0x90, 0x12, 0x80, 0x01, 0x23, 0x02,
+  0x49, 0x01, 0x80, 0x04, 0x00, 0x48, 0x80, 0x04, 0x48, 0x00, 0x00, 0x44,
+  0x20, 0x04, 0x4a, 0x02, 0x1f, 0xac, 0x03, 0x21, 0x10, 0x42, 0x94, 0x12,
+  0x1a, 0x44, 0x82, 0x16, 0x84, 0x86, 0xa8, 0x48, 0x18, 0x8a, 0x04, 0x8a,
+  0x44, 0xb2, 0x84, 0x04, 0xaa, 0x24, 0x24, 0x0b, 0xa2, 0x44, 0x23, 0x02,
+  0x29, 0x44, 0xa4, 0xc2, 0x80, 0x0c, 0xc8, 0x52, 0x2c, 0x28, 0x08, 0x12,
+  0x88, 0xa0, 0x84, 0x90, 0x84, 0x8a, 0x24, 0x22, 0x08, 0xa0, 0x84, 0x82,
+  0x42, 0x82, 0x81, 0x2a, 0xa4, 0x84, 0x82, 0x28, 0x8e, 0x41, 0xff, 0x25,
+  0x05, 0x3c, 0xf4, 0x11, 0x24, 0x85, 0xf3, 0x11, 0x24, 0xc7, 0x14, 0x1f,
+  0x41, 0x72, 0x4a, 0xf1, 0x11, 0x2c, 0xaf, 0x14, 0xf1, 0x11, 0x24, 0xaf,
+  0x14, 0x99, 0x21, 0xaf, 0x14, 0x19, 0xf5, 0x4a, 0x93, 0x53, 0xf2, 0x4a,
+  0x95, 0x53, 0xf2, 0x42, 0x93, 0x57, 0x82, 0x2d, 0x91, 0x5f, 0x82, 0xc4,
+  0x91, 0x5f, 0xa2, 0xc4, 0x81, 0x5f, 0xa2, 0x64, 0x11, 0x7f, 0xa2, 0x65,
+  0x19, 0x1f, 0xa2, 0x64, 0x59, 0x4d, 0x5a, 0x9e, 0x24, 0x2d, 0x4a, 0x1f,
+  0x49, 0xd2, 0x34, 0xf4, 0x91, 0x24, 0x87, 0x32, 0x1f, 0x49, 0x72, 0x48,
+  0xf3, 0x91, 0x24, 0xa7, 0x34, 0x1f, 0x48, 0xf2, 0x4a, 0x13, 0x1d, 0x24,
+  0xaf, 0x34, 0x99, 0x21, 0xaf, 0x34, 0x49, 0x00, 0xf1, 0x5b, 0x43, 0xf2,
+  0x4a, 0x92, 0x43, 0xf2, 0x42, 0xb2, 0x47, 0x83, 0x29, 0xf9, 0x24, 0x48,
+  0x98, 0x4f, 0xa2, 0xf4, 0xca, 0xa9, 0x40, 0xca, 0x64, 0x85, 0xe2, 0x41,
+  0x04, 0x16, 0x1c, 0xc2, 0x28, 0xa9, 0xc1, 0x24, 0xad, 0x14, 0xd0, 0x42,
+  0x53, 0x84, 0xa9, 0x33, 0x24, 0x89, 0x31, 0x24, 0x29, 0x71, 0x24, 0x98,
+  0x12, 0x2f, 0x82, 0x84, 0xf1, 0x26, 0x5a, 0xf0, 0x24, 0xda, 0x12, 0x4f,
+  0xa2, 0x2c, 0xe1, 0xa2, 0x24, 0xc1, 0x4b, 0x1e, 0x24, 0xbc, 0xe4, 0xc1,
+  0xc2, 0x4a, 0x1e, 0x64, 0x89, 0x64, 0x41, 0x83, 0x44, 0x34, 0x48, 0x16,
+  0x34, 0x48, 0x16, 0x74, 0x48, 0x84, 0xf2, 0x48, 0x34, 0x43, 0xb1, 0x48,
+  0x32, 0x14, 0x83, 0x34, 0x14, 0x42, 0x36, 0x08, 0x37, 0x00, 0x43, 0x58,
+  0xcf, 0x26, 0x0d, 0x87, 0x06, 0x31, 0x80, 0x02, 0x24, 0x52, 0x07, 0x90,
+  0x88, 0x00, 0x80, 0x02, 0x14, 0x00, 0x84, 0x80, 0x04, 0xa0, 0x06, 0x01,
+  0x01, 0x00, 0xf0, 0x24, 0x10, 0x02, 0x6f, 0x2f, 0x0c, 0x10, 0x44, 0x42,
+  0x02, 0x80, 0x01, 0x90, 0x49, 0x24, 0x82, 0x14, 0x24, 0x10, 0x15, 0x84,
+  0x98, 0x12, 0x1d, 0x44, 0x00, 0x00, 0x21, 0x1d, 0x24, 0x43, 0x31, 0x24,
+  0x60, 0x25, 0x00, 0x42, 0x4a, 0x08, 0x00, 0x15, 0x22, 0x31, 0x13, 0x00,
+  0x1e, 0x84, 0x20, 0x08, 0x80, 0x31, 0x14, 0x5a, 0x05, 0xf0, 0xff, 0xff,
+  0xff, 0x01, 0xc2, 0x28, 0x41, 0x2b, 0x1a, 0x20, 0x01, 0x40, 0x11, 0xe4,
   0x42, 0x61, 0x22, 0x4d, 0x28, 0x11, 0x18, 0x12, 0x22, 0x12, 0x10, 0x01,
   0x21, 0x46, 0x75, 0x24, 0x41, 0x82, 0x01, 0x32, 0x41, 0x46, 0x02, 0x21,
   0xd0, 0x22, 0x31, 0x24, 0x56, 0x84, 0xc3, 0x14, 0x30, 0x72, 0x4a, 0x21,
@@ -2840,545 +2239,541 @@ const unsigned char USB_1608G_rbf[] = {
   0x18, 0x89, 0x22, 0x39, 0x48, 0x36, 0x48, 0xf2, 0xee, 0x28, 0x00, 0x00,
   0xe0, 0x32, 0x81, 0x92, 0x16, 0x84, 0xa5, 0x01, 0x89, 0x01, 0x18, 0x8c,
   0x44, 0x04, 0x24, 0x10, 0x68, 0x81, 0x2d, 0x84, 0x40, 0x11, 0x04, 0x40,
-  0x51, 0x84, 0x82, 0x23, 0x02, 0x49, 0x01, 0x10, 0x81, 0x08, 0x14, 0x4c,
-  0x42, 0xa2, 0x29, 0x24, 0x84, 0x25, 0x42, 0x74, 0x42, 0x81, 0x84, 0x08,
-  0x18, 0x32, 0x2c, 0x21, 0x41, 0x04, 0x29, 0x02, 0x10, 0xf4, 0xaa, 0x3f,
-  0x24, 0x40, 0x02, 0x85, 0x01, 0x45, 0x02, 0x49, 0x11, 0x88, 0x11, 0x68,
-  0x18, 0x11, 0x8a, 0x04, 0x19, 0x0c, 0x16, 0x04, 0xc6, 0x04, 0x4c, 0x08,
-  0x00, 0x24, 0x44, 0x35, 0x84, 0x31, 0x14, 0x00, 0x21, 0x18, 0x00, 0x19,
-  0x01, 0x24, 0x4d, 0x11, 0x21, 0x00, 0x82, 0x88, 0x00, 0x21, 0x12, 0x2d,
-  0x14, 0x00, 0x41, 0x70, 0xa8, 0x04, 0x89, 0x88, 0x11, 0xf8, 0x67, 0xf6,
-  0x20, 0x02, 0x00, 0x22, 0x40, 0x04, 0x21, 0x88, 0x24, 0x81, 0x44, 0xe0,
-  0x12, 0x01, 0x84, 0x80, 0x41, 0x28, 0x04, 0x18, 0x88, 0x42, 0x45, 0x01,
-  0x24, 0x46, 0x01, 0x12, 0x00, 0x00, 0x12, 0xe1, 0x86, 0x22, 0x42, 0x08,
-  0x00, 0x4c, 0x61, 0x11, 0x34, 0x28, 0x41, 0x69, 0x38, 0x21, 0x80, 0x01,
-  0x21, 0xe0, 0x54, 0x0b, 0x28, 0x2d, 0x82, 0x6f, 0xf2, 0x05, 0x11, 0x40,
-  0x38, 0x42, 0x20, 0x51, 0x28, 0x83, 0x84, 0x41, 0x63, 0x11, 0x2d, 0x42,
-  0xcd, 0x12, 0x50, 0x82, 0x48, 0x1c, 0x01, 0xc0, 0x41, 0x11, 0x84, 0x11,
-  0x10, 0x02, 0x11, 0x29, 0x08, 0x83, 0x11, 0x22, 0x38, 0x14, 0x90, 0x12,
-  0x00, 0x40, 0xc1, 0x81, 0x15, 0x84, 0x08, 0x00, 0x18, 0x90, 0x14, 0x11,
-  0x9c, 0x42, 0x02, 0x20, 0x01, 0x90, 0x24, 0x2c, 0x08, 0x8e, 0x45, 0xc0,
-  0x4a, 0x80, 0x04, 0x10, 0x42, 0x04, 0x90, 0x18, 0x44, 0x8f, 0x41, 0x08,
-  0x4e, 0x91, 0x10, 0x88, 0x62, 0x85, 0x80, 0x81, 0x01, 0x49, 0x02, 0x11,
-  0xb0, 0x14, 0x02, 0x10, 0x52, 0x24, 0x51, 0x20, 0x13, 0x48, 0x48, 0x42,
-  0x21, 0x05, 0x1a, 0x06, 0xa2, 0xc0, 0x14, 0x88, 0x4c, 0x04, 0x1a, 0x02,
-  0x29, 0x04, 0x18, 0x00, 0x61, 0x10, 0x32, 0x14, 0xef, 0x89, 0x04, 0x60,
-  0x44, 0xc0, 0x14, 0x8c, 0x81, 0x04, 0x4c, 0x01, 0x46, 0x01, 0x00, 0x00,
-  0x10, 0x0a, 0x40, 0x22, 0x01, 0x17, 0x21, 0x20, 0x48, 0x14, 0x11, 0x18,
-  0x21, 0x28, 0x41, 0x28, 0x81, 0x38, 0x11, 0x92, 0x81, 0x82, 0x4c, 0x12,
-  0x02, 0x21, 0x11, 0x29, 0x21, 0x18, 0x24, 0x32, 0x12, 0x86, 0x01, 0x2c,
-  0x42, 0x28, 0x02, 0x1a, 0x02, 0x20, 0x42, 0xf5, 0x77, 0xc7, 0x24, 0x24,
-  0xb4, 0x89, 0x04, 0x00, 0x00, 0xa1, 0x88, 0x81, 0x14, 0x16, 0x41, 0x14,
-  0x68, 0x48, 0x14, 0x88, 0x80, 0x08, 0x8b, 0x18, 0x21, 0x11, 0x2d, 0x11,
-  0x33, 0x81, 0x88, 0x01, 0x41, 0x28, 0x18, 0x44, 0x00, 0x00, 0x00, 0x18,
-  0x20, 0x02, 0x2a, 0x08, 0x18, 0x4c, 0x08, 0x80, 0x21, 0x08, 0x29, 0x88,
-  0x81, 0xe4, 0x22, 0x81, 0x08, 0x22, 0xbd, 0x67, 0x40, 0x08, 0x68, 0x15,
-  0x38, 0x85, 0x30, 0x28, 0x20, 0x52, 0x22, 0x2a, 0x41, 0x04, 0x14, 0x14,
-  0x13, 0x01, 0xd0, 0x48, 0x01, 0x85, 0x45, 0x85, 0x04, 0x00, 0xd8, 0x14,
-  0x36, 0x04, 0x23, 0x24, 0x22, 0x04, 0x28, 0x4e, 0x28, 0x22, 0x2a, 0x14,
-  0x41, 0x14, 0x08, 0x38, 0x44, 0x65, 0x71, 0x22, 0xc1, 0x14, 0x90, 0x22,
-  0x44, 0x00, 0x42, 0x81, 0x43, 0x18, 0x08, 0xa9, 0x24, 0xf8, 0x4f, 0x63,
-  0x20, 0x38, 0x88, 0x00, 0x41, 0x50, 0x22, 0x83, 0x24, 0x81, 0x04, 0x1a,
-  0x54, 0x22, 0x30, 0x12, 0x00, 0x8e, 0x42, 0x54, 0xd3, 0x51, 0x48, 0x12,
-  0x24, 0x14, 0x30, 0x82, 0x20, 0x41, 0x14, 0x12, 0x31, 0x16, 0x28, 0x28,
-  0x44, 0x88, 0x40, 0x81, 0x61, 0x88, 0xc1, 0x89, 0x0a, 0x80, 0x02, 0x19,
-  0x01, 0x64, 0x80, 0x48, 0xc2, 0x92, 0x81, 0x84, 0x81, 0x84, 0x81, 0x84,
-  0x9f, 0xbe, 0x0a, 0x15, 0x28, 0x81, 0x24, 0x44, 0x62, 0x44, 0x00, 0x24,
-  0x81, 0x11, 0x44, 0xa0, 0x21, 0x30, 0x18, 0x12, 0x45, 0x98, 0x28, 0xc0,
-  0x22, 0x14, 0x61, 0x12, 0x38, 0x16, 0x82, 0x58, 0x24, 0x20, 0x18, 0x24,
-  0x4a, 0x31, 0x81, 0x60, 0x82, 0x25, 0xa3, 0x42, 0x21, 0x00, 0xb0, 0x14,
-  0x04, 0x48, 0x22, 0x4c, 0x08, 0x68, 0x24, 0x41, 0x28, 0x00, 0x00, 0x28,
-  0x40, 0xf2, 0xe4, 0x86, 0x14, 0x42, 0x93, 0x0c, 0x3d, 0x41, 0x8f, 0x21,
-  0xc8, 0x14, 0x69, 0x12, 0x54, 0x22, 0x9a, 0xf8, 0x11, 0x18, 0x4a, 0x38,
-  0x12, 0x17, 0x28, 0x28, 0x1b, 0x59, 0x85, 0x99, 0x44, 0x50, 0x1c, 0x37,
-  0xa5, 0x88, 0x74, 0x15, 0x92, 0x22, 0x1e, 0x15, 0x26, 0x77, 0x86, 0x31,
-  0x23, 0xc7, 0x68, 0x2c, 0xe4, 0x5a, 0x89, 0x43, 0xc1, 0x18, 0x3a, 0x13,
-  0x43, 0xf1, 0x41, 0x21, 0x4f, 0x21, 0xd1, 0xcc, 0x91, 0x82, 0x1f, 0x43,
-  0x01, 0x6b, 0x88, 0x1f, 0x39, 0xe2, 0x21, 0x38, 0x12, 0x4f, 0x58, 0xf4,
-  0x22, 0x24, 0x43, 0xb4, 0x1a, 0x62, 0x4d, 0x12, 0x4d, 0x88, 0x46, 0x46,
-  0x68, 0x1b, 0x2e, 0x1a, 0x9f, 0x1b, 0x05, 0x26, 0x62, 0xc8, 0xa1, 0x16,
-  0x4c, 0x54, 0x22, 0x85, 0x2a, 0x84, 0x73, 0x42, 0x59, 0x52, 0x3b, 0x51,
-  0xfc, 0xb1, 0x54, 0x99, 0x13, 0x49, 0x38, 0x13, 0x8c, 0xf9, 0x1c, 0x18,
-  0x13, 0xdd, 0x14, 0x73, 0x9c, 0xb1, 0x34, 0x64, 0x11, 0x46, 0x51, 0x22,
-  0x13, 0xd1, 0xa1, 0xd1, 0x34, 0x91, 0x92, 0x50, 0x82, 0x1a, 0x24, 0x7a,
-  0x13, 0xa4, 0x88, 0x4d, 0x18, 0x1d, 0xa2, 0x23, 0x91, 0x82, 0x20, 0x8a,
-  0xb2, 0x14, 0xf1, 0x11, 0x64, 0x41, 0x1b, 0x2c, 0x2c, 0xb1, 0x13, 0x59,
-  0x94, 0x2b, 0x8a, 0x24, 0x88, 0x84, 0x86, 0x64, 0x89, 0x8e, 0x24, 0xac,
-  0x14, 0xf2, 0xa2, 0x8b, 0x24, 0x35, 0x71, 0x12, 0xc2, 0x28, 0x83, 0x34,
-  0x25, 0x4b, 0x44, 0x44, 0xaf, 0xe1, 0x75, 0x18, 0xd8, 0x29, 0xd5, 0x28,
-  0x72, 0x88, 0x1b, 0xd5, 0x12, 0x74, 0x18, 0x79, 0x48, 0xa9, 0x12, 0x87,
-  0x4d, 0x2d, 0x25, 0xcc, 0x5d, 0x48, 0x1d, 0x1c, 0x19, 0x31, 0x82, 0x1d,
-  0x82, 0x53, 0x98, 0x56, 0x16, 0x64, 0x45, 0x12, 0x6f, 0x53, 0xb1, 0x14,
-  0x52, 0x46, 0x1a, 0x8b, 0xc2, 0x42, 0x8d, 0x23, 0x23, 0xea, 0x62, 0x71,
-  0x89, 0x6d, 0x16, 0x89, 0x82, 0xfc, 0x82, 0xa4, 0x1c, 0xb1, 0x22, 0xa1,
-  0x12, 0x45, 0x44, 0xf2, 0x11, 0x12, 0x24, 0xf0, 0x22, 0x12, 0xa9, 0xf1,
-  0x68, 0x32, 0xcb, 0x32, 0x8b, 0x82, 0x89, 0xf2, 0x8c, 0x84, 0xdd, 0xeb,
-  0x80, 0x02, 0x8c, 0x02, 0x28, 0x42, 0x8c, 0x62, 0x24, 0x8c, 0xa2, 0x84,
-  0x1e, 0x28, 0x4a, 0x28, 0xe1, 0x24, 0x68, 0x81, 0x4a, 0x28, 0xa2, 0x84,
-  0x32, 0x88, 0x3a, 0x84, 0xa8, 0x43, 0x88, 0x2a, 0x04, 0x2a, 0x04, 0x2b,
-  0x52, 0x82, 0x58, 0x82, 0x2a, 0x24, 0xa8, 0x52, 0x82, 0x22, 0x82, 0x21,
-  0x82, 0x46, 0x22, 0x28, 0x24, 0xe9, 0x24, 0x28, 0xa1, 0x84, 0x12, 0x4a,
-  0x28, 0xa1, 0x84, 0xa0, 0x84, 0xa0, 0x84, 0x1a, 0x84, 0x88, 0x84, 0xf8,
-  0xca, 0x65, 0x14, 0x1b, 0x64, 0x5f, 0x52, 0xf2, 0x3c, 0x3c, 0x8f, 0x82,
-  0xf2, 0xd9, 0x7d, 0x6f, 0x67, 0xf7, 0x7e, 0x7c, 0xef, 0xc6, 0xb6, 0x4a,
-  0xf5, 0xe3, 0xe1, 0xbf, 0x8a, 0xff, 0xe1, 0xe3, 0x1b, 0xd8, 0x3f, 0x1c,
-  0xfd, 0xcf, 0x6c, 0x4f, 0x7e, 0xff, 0xfb, 0x79, 0xcf, 0x6f, 0xff, 0xb7,
-  0xd5, 0x5f, 0x7c, 0xff, 0x87, 0x75, 0xcf, 0x4e, 0xfe, 0xc5, 0xd4, 0x4e,
-  0x63, 0x1f, 0x18, 0xf6, 0x64, 0x67, 0x3f, 0x75, 0xf4, 0x6c, 0x6d, 0x7f,
-  0x4b, 0xef, 0x2d, 0xfd, 0x75, 0xf1, 0x8f, 0x8d, 0xad, 0x89, 0xda, 0xfe,
-  0x55, 0xd5, 0x9e, 0xb2, 0x2f, 0x38, 0xfa, 0x81, 0xa2, 0x6f, 0x7b, 0xbf,
-  0xca, 0xbc, 0xc4, 0xfc, 0xe8, 0xc8, 0x5f, 0x77, 0xf9, 0x96, 0xd4, 0x5f,
-  0x7a, 0xbe, 0xf3, 0xf7, 0x91, 0x93, 0x9a, 0xf5, 0x82, 0xd7, 0xca, 0xf4,
-  0xa6, 0xa6, 0xaf, 0x9e, 0xf4, 0xe2, 0xe2, 0xaf, 0x1d, 0xfd, 0x8c, 0x89,
-  0x8f, 0x98, 0xfc, 0xe8, 0xe8, 0x1f, 0x8e, 0xfe, 0xe8, 0xeb, 0x5e, 0x26,
-  0x24, 0x1d, 0x63, 0x7f, 0x72, 0xf6, 0x1e, 0x1c, 0x95, 0xf9, 0x4d, 0x2f,
-  0x6f, 0x47, 0xf7, 0x5e, 0x1c, 0xcf, 0xc5, 0xb4, 0x62, 0xf3, 0xe9, 0xeb,
-  0xbf, 0x55, 0xfd, 0xd3, 0xc3, 0x3f, 0x16, 0xff, 0xc1, 0xc1, 0xff, 0x5d,
-  0xfb, 0xd5, 0xd7, 0xaf, 0x9d, 0xf9, 0xfc, 0xfe, 0xff, 0xd7, 0xfd, 0xc5,
-  0xe7, 0x7f, 0x78, 0xff, 0xfe, 0xe5, 0x5f, 0x12, 0xdb, 0x21, 0xf3, 0x83,
-  0x61, 0x1f, 0x3e, 0xfe, 0x32, 0x21, 0xff, 0xf1, 0xf1, 0x95, 0x57, 0xfe,
-  0xf2, 0x5f, 0x19, 0xf9, 0x99, 0x9d, 0x4f, 0x4f, 0xe5, 0x1c, 0xfe, 0xd5,
-  0xfd, 0x9e, 0xb2, 0x3f, 0x3e, 0xf6, 0xa3, 0xa3, 0x7f, 0x6b, 0xf7, 0x8b,
-  0x84, 0xc3, 0xf8, 0xc8, 0xe8, 0x5f, 0x7d, 0xfb, 0xb6, 0xf4, 0x5f, 0x78,
-  0xfd, 0xe3, 0xe5, 0x1f, 0x3f, 0xed, 0x69, 0xff, 0x83, 0xc6, 0x7f, 0x2d,
-  0xff, 0xe4, 0xe6, 0xbf, 0xaa, 0xe8, 0x2a, 0xfb, 0x4a, 0xc8, 0xcf, 0xdf,
-  0xff, 0x28, 0xca, 0x8f, 0x8e, 0xfe, 0x28, 0xa8, 0xef, 0xba, 0xeb, 0x24,
-  0x4b, 0xf3, 0x22, 0x43, 0x7d, 0x65, 0xcf, 0xc1, 0x51, 0x88, 0xcf, 0xe7,
-  0xf1, 0x44, 0x66, 0xa7, 0xc4, 0xef, 0xc4, 0xb5, 0x6a, 0xf3, 0xd1, 0xd1,
-  0x9d, 0x9d, 0x3f, 0x1c, 0xfc, 0x13, 0xb1, 0x3f, 0x1c, 0x7d, 0x4f, 0xfd,
-  0xd5, 0xd6, 0xbf, 0x95, 0xf1, 0xfc, 0xde, 0x3f, 0xd1, 0xff, 0xcd, 0xdf,
-  0x3f, 0xd6, 0xf1, 0x86, 0xcd, 0x4f, 0x53, 0xfb, 0x81, 0x13, 0xee, 0x81,
-  0x3d, 0xc2, 0x1f, 0x33, 0x53, 0xdf, 0x7f, 0x1d, 0xe1, 0x49, 0xfd, 0x33,
-  0x35, 0xef, 0xd9, 0xa9, 0x4d, 0x9a, 0xfa, 0x35, 0x3d, 0xde, 0xf2, 0x3f,
-  0x3a, 0xf6, 0xa3, 0xa3, 0x7f, 0x7b, 0xf2, 0x8b, 0x82, 0x67, 0xe8, 0x8f,
-  0x8e, 0xf8, 0x35, 0x77, 0x6f, 0x49, 0xf9, 0xe5, 0xa7, 0x3f, 0x53, 0xf3,
-  0xd1, 0xf3, 0x2f, 0x21, 0xf3, 0xc7, 0x97, 0x35, 0xf2, 0xe6, 0xe4, 0xa7,
-  0xa2, 0x2b, 0xaa, 0xaf, 0xa1, 0xf9, 0xce, 0xca, 0x7f, 0xc7, 0xfb, 0x8a,
-  0xc8, 0x8d, 0xa8, 0xcf, 0xea, 0xfb, 0x92, 0xbf, 0x14, 0x17, 0x32, 0x5d,
-  0x27, 0x4f, 0xc3, 0x53, 0x88, 0xc7, 0xea, 0x6f, 0x64, 0xf6, 0x24, 0x2e,
-  0xcf, 0xe5, 0xd5, 0xaa, 0xf1, 0xeb, 0xeb, 0xbf, 0x13, 0xf7, 0xdb, 0xc9,
-  0x3f, 0x31, 0xf7, 0xd1, 0xd3, 0xff, 0x5b, 0xf1, 0xdd, 0xdf, 0xbf, 0x8b,
-  0xf3, 0xfc, 0xde, 0x7f, 0xd5, 0xf6, 0xdd, 0xcf, 0xff, 0xcf, 0xf1, 0xbc,
-  0xed, 0x4f, 0x55, 0x75, 0x81, 0xb3, 0xe3, 0xf8, 0x23, 0xe1, 0x3f, 0x25,
-  0x55, 0xfe, 0x7f, 0x66, 0xf3, 0xb6, 0xf6, 0x7f, 0x74, 0xfd, 0xba, 0x9d,
-  0x4f, 0x43, 0xa1, 0xec, 0x5d, 0xb5, 0xde, 0xf2, 0x2f, 0x32, 0xb6, 0xa3,
-  0xfa, 0x77, 0x26, 0xbf, 0x69, 0xf9, 0x4e, 0x4e, 0x8f, 0x8e, 0xfa, 0x15,
-  0xf7, 0x6f, 0x6b, 0xfa, 0xc7, 0x93, 0x3f, 0x1f, 0xf7, 0xb1, 0xb3, 0x23,
-  0xf9, 0xd7, 0x96, 0x5f, 0x2f, 0xf5, 0xa6, 0xa6, 0x87, 0xaa, 0x2f, 0x2e,
-  0xff, 0x58, 0x5b, 0xef, 0xeb, 0xfb, 0x7a, 0x18, 0x8f, 0x88, 0xfc, 0x48,
-  0x4a, 0xcf, 0xda, 0xfa, 0x7c, 0xa6, 0x50, 0x12, 0x10, 0x42, 0xc8, 0x12,
-  0x50, 0x24, 0x84, 0x40, 0x08, 0x40, 0x03, 0x14, 0x11, 0x20, 0x01, 0x12,
-  0x44, 0x00, 0x11, 0x10, 0x01, 0x31, 0x90, 0x14, 0x10, 0x02, 0x00, 0x18,
-  0x20, 0x02, 0x18, 0x20, 0x22, 0x21, 0x02, 0x22, 0x40, 0x02, 0x64, 0xc0,
-  0x22, 0x00, 0x00, 0x10, 0x08, 0xfd, 0xbc, 0x20, 0x02, 0x22, 0x11, 0x22,
-  0x44, 0xc0, 0x24, 0x2a, 0x01, 0xaf, 0x12, 0x01, 0x29, 0x01, 0x89, 0x21,
-  0x81, 0x52, 0x84, 0x28, 0x51, 0x4a, 0x12, 0xe4, 0x14, 0x23, 0x88, 0x92,
-  0x42, 0x4e, 0x24, 0x18, 0x4e, 0x24, 0x21, 0x1a, 0x92, 0x44, 0x52, 0x00,
-  0x2c, 0x14, 0x61, 0x22, 0x11, 0xc0, 0x44, 0x80, 0x34, 0x44, 0x11, 0x2a,
-  0xa1, 0x41, 0x90, 0x41, 0x18, 0x48, 0x80, 0x84, 0xd1, 0x84, 0xb4, 0x48,
-  0x03, 0x4a, 0x42, 0xf8, 0x39, 0x72, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28,
-  0x1f, 0xc1, 0x32, 0x4a, 0x1f, 0x41, 0x72, 0x4a, 0xd2, 0xc1, 0xb2, 0x4a,
-  0xf1, 0x11, 0x2c, 0xab, 0x94, 0x1f, 0x81, 0xf2, 0x4a, 0x92, 0x57, 0x81,
-  0xab, 0x94, 0x47, 0x82, 0xaf, 0x14, 0x39, 0x34, 0x2f, 0x14, 0x79, 0x34,
-  0xd8, 0x12, 0xf9, 0x34, 0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x1c, 0xf8, 0x24,
-  0x4a, 0x16, 0xf1, 0x24, 0x4a, 0x87, 0x19, 0x2f, 0xa2, 0x65, 0x59, 0xac,
-  0xe5, 0x49, 0xd2, 0xa2, 0xf5, 0x91, 0x24, 0x6d, 0x52, 0x1f, 0x49, 0xd2,
-  0x28, 0xf1, 0x91, 0x24, 0xa7, 0x26, 0x1f, 0x49, 0xf2, 0x4a, 0x11, 0x1f,
-  0x49, 0xf2, 0x4a, 0x92, 0x1f, 0x49, 0xf2, 0x4a, 0x92, 0x1b, 0x21, 0xab,
-  0x94, 0x53, 0xb1, 0x4a, 0x79, 0x34, 0xb8, 0x4a, 0x39, 0x24, 0x2f, 0x44,
-  0x79, 0xb4, 0x98, 0x92, 0x4f, 0x8b, 0xc4, 0x94, 0x4f, 0xaa, 0xe4, 0x4e,
-  0x02, 0x2c, 0xf4, 0x11, 0x4c, 0x81, 0x1b, 0x41, 0x83, 0x74, 0x11, 0x34,
-  0x4a, 0x15, 0xb4, 0x4a, 0x51, 0x41, 0x2f, 0x44, 0x18, 0xf1, 0x42, 0xb4,
-  0x11, 0x2b, 0x94, 0x41, 0x8f, 0x14, 0x19, 0xb4, 0x48, 0x18, 0xd4, 0x1a,
-  0x19, 0xc6, 0x91, 0x6d, 0x1a, 0x1c, 0xd8, 0xa4, 0x69, 0x11, 0x4d, 0x8a,
-  0x96, 0x41, 0x6a, 0x48, 0xb4, 0x86, 0x44, 0x6b, 0xc9, 0x24, 0x1f, 0x88,
-  0x54, 0x28, 0x1b, 0x29, 0xe0, 0xc8, 0x12, 0x88, 0x12, 0xda, 0x41, 0xd2,
-  0x48, 0x81, 0xd2, 0x48, 0x1a, 0x95, 0xaa, 0x22, 0xa9, 0x29, 0x92, 0x92,
-  0x47, 0x82, 0x29, 0x79, 0x26, 0x88, 0xf9, 0x26, 0x1a, 0x5d, 0x63, 0x00,
-  0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x48, 0x00, 0x88,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x09, 0xdf, 0xe3,
-  0x01, 0x18, 0x14, 0x10, 0x04, 0x12, 0x2e, 0x48, 0x42, 0x27, 0x85, 0x12,
-  0x27, 0xa1, 0x84, 0x89, 0x04, 0x8c, 0x88, 0xc4, 0x48, 0x44, 0x23, 0x11,
-  0x92, 0x28, 0x80, 0x01, 0x2a, 0x48, 0x81, 0x92, 0x41, 0x1e, 0x24, 0x5d,
-  0x12, 0x40, 0x02, 0x24, 0x00, 0x19, 0x01, 0x1c, 0x29, 0x31, 0x22, 0xd0,
-  0x81, 0x78, 0x12, 0x31, 0x11, 0x1e, 0x82, 0x46, 0x81, 0x48, 0x81, 0x88,
-  0x04, 0x30, 0x12, 0x21, 0x8b, 0x38, 0xa0, 0x84, 0xa4, 0x9f, 0x11, 0x08,
-  0x43, 0x64, 0x49, 0xd0, 0x12, 0x31, 0x68, 0x14, 0x41, 0x80, 0x02, 0xc8,
-  0x12, 0x1a, 0x18, 0xe8, 0x21, 0x04, 0x63, 0x81, 0x64, 0x1c, 0x46, 0xc1,
-  0x81, 0x20, 0x54, 0x28, 0x42, 0x41, 0x25, 0x14, 0x98, 0xc1, 0x90, 0x95,
-  0x81, 0x58, 0x81, 0x2e, 0x45, 0x90, 0x82, 0x16, 0x18, 0x46, 0x68, 0x51,
-  0x21, 0x18, 0x81, 0xa2, 0x84, 0x2a, 0x31, 0x11, 0x10, 0xea, 0x42, 0x18,
-  0xc2, 0x24, 0x81, 0x15, 0x04, 0x11, 0x16, 0x19, 0xf4, 0x58, 0xb2, 0x14,
-  0x52, 0xce, 0x15, 0x90, 0x11, 0x8b, 0x24, 0x80, 0x24, 0xe4, 0x86, 0x61,
-  0x21, 0x43, 0x14, 0xb8, 0x38, 0x0c, 0x4e, 0x18, 0x2d, 0x42, 0x83, 0x31,
-  0x44, 0x2d, 0x82, 0x42, 0x17, 0xa2, 0x20, 0x21, 0xa1, 0x48, 0x86, 0x11,
-  0x62, 0x84, 0x13, 0x5c, 0x21, 0x59, 0x11, 0xa9, 0x41, 0x81, 0x87, 0x12,
-  0x30, 0x42, 0x16, 0xd8, 0x14, 0x61, 0xa1, 0x36, 0x05, 0x2c, 0x79, 0x11,
-  0xb8, 0x21, 0x59, 0x84, 0x2b, 0x12, 0x26, 0x11, 0x61, 0x88, 0x4c, 0x18,
-  0x52, 0x24, 0x10, 0xe3, 0xa2, 0x11, 0xe1, 0x11, 0x78, 0x14, 0xf8, 0xed,
-  0x44, 0x10, 0x04, 0x24, 0x44, 0x30, 0x11, 0xc3, 0x02, 0x21, 0xd0, 0x28,
-  0x29, 0x01, 0x84, 0x88, 0x60, 0x44, 0xe0, 0x14, 0x11, 0x81, 0x08, 0x42,
-  0xa4, 0x28, 0x41, 0x4c, 0x12, 0xe1, 0x41, 0x92, 0x14, 0x82, 0x24, 0x40,
-  0x62, 0x44, 0x30, 0x91, 0x24, 0x82, 0x00, 0x21, 0x15, 0x08, 0x80, 0x99,
-  0x41, 0x98, 0x10, 0xa2, 0x42, 0x20, 0x92, 0x18, 0x41, 0x88, 0x30, 0x48,
-  0x70, 0xec, 0x0f, 0x00, 0x82, 0x80, 0x08, 0x00, 0x88, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x11, 0x40, 0x01, 0x70,
-  0xe7, 0x05, 0x28, 0x62, 0x31, 0x80, 0x51, 0x48, 0x6e, 0x63, 0x80, 0x72,
-  0x12, 0x18, 0xa4, 0x52, 0x14, 0x88, 0x82, 0x84, 0x61, 0x1b, 0x48, 0x2a,
-  0xc1, 0x81, 0x85, 0x06, 0x8c, 0x22, 0x81, 0x24, 0x4c, 0x07, 0x4a, 0x62,
-  0x81, 0x48, 0x73, 0x08, 0x2e, 0x14, 0x89, 0xa4, 0xa4, 0x10, 0x03, 0x18,
-  0x85, 0xc4, 0x83, 0x4a, 0x02, 0x27, 0x81, 0x41, 0x8a, 0x65, 0x12, 0x88,
-  0x40, 0x18, 0x86, 0xa4, 0x12, 0xd0, 0x68, 0x08, 0x8c, 0x22, 0xf1, 0x54,
-  0xf5, 0x50, 0x13, 0x46, 0x02, 0x1e, 0x18, 0x83, 0x42, 0xc4, 0x21, 0x46,
-  0x14, 0x44, 0x18, 0xa2, 0x51, 0x87, 0x12, 0x88, 0x27, 0xa8, 0x12, 0x41,
-  0x4b, 0x58, 0x22, 0x4c, 0x49, 0x23, 0x81, 0x42, 0x88, 0x24, 0x4c, 0x57,
-  0x88, 0x4a, 0x22, 0x81, 0x34, 0x87, 0xc0, 0x16, 0x83, 0x82, 0x3a, 0x42,
-  0x11, 0x80, 0x51, 0x48, 0x3c, 0xa8, 0x24, 0x50, 0x83, 0x41, 0x8e, 0x41,
-  0x8b, 0x12, 0x88, 0x8c, 0x02, 0x61, 0x2e, 0x41, 0x18, 0xc0, 0x86, 0x84,
-  0x4a, 0xb2, 0x18, 0xf4, 0x97, 0x45, 0x00, 0x20, 0x08, 0x88, 0x00, 0x80,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x14,
-  0x00, 0x14, 0x00, 0x2f, 0xcb, 0x03, 0x00, 0x1c, 0x41, 0x08, 0x84, 0x70,
-  0x11, 0x18, 0x32, 0x11, 0x00, 0x88, 0x11, 0xe0, 0x81, 0xc4, 0x12, 0x12,
-  0x4a, 0x22, 0x81, 0x21, 0x21, 0x04, 0x42, 0x80, 0xd2, 0x82, 0x85, 0x82,
-  0x21, 0xa1, 0x12, 0x10, 0x84, 0x12, 0x02, 0x21, 0x60, 0x24, 0x12, 0x80,
-  0x84, 0x88, 0x44, 0x21, 0x49, 0x21, 0x08, 0x40, 0xa2, 0x48, 0x20, 0x01,
-  0x43, 0x28, 0x04, 0x9e, 0xa1, 0xb0, 0x11, 0x82, 0x92, 0x22, 0x49, 0xd3,
-  0x21, 0xe2, 0x24, 0xc2, 0x71, 0x21, 0x2c, 0x11, 0x78, 0x32, 0x83, 0x53,
-  0x12, 0xab, 0x14, 0x25, 0x11, 0x21, 0x52, 0x94, 0x86, 0xc2, 0x61, 0x68,
-  0x14, 0x13, 0x12, 0x41, 0x11, 0xc2, 0x41, 0x26, 0xc1, 0x42, 0x2a, 0x64,
-  0x22, 0x86, 0x22, 0xb5, 0x72, 0x38, 0x55, 0x49, 0x61, 0x11, 0x1e, 0x21,
-  0x86, 0xa2, 0x21, 0xc2, 0x13, 0xf1, 0x82, 0x11, 0x26, 0xa2, 0x81, 0x24,
-  0x42, 0x16, 0xc2, 0x11, 0xb0, 0x42, 0x19, 0x18, 0xa4, 0x82, 0x2f, 0x64,
-  0xe8, 0x48, 0x84, 0x21, 0x2a, 0xf2, 0x28, 0xdd, 0x80, 0x21, 0x82, 0x12,
-  0x88, 0xb2, 0x48, 0x32, 0x31, 0x12, 0x21, 0xbd, 0x12, 0x1d, 0x22, 0x2c,
-  0xc1, 0x81, 0xa9, 0x51, 0x12, 0x83, 0xc5, 0x32, 0x18, 0xaa, 0x74, 0x52,
-  0xa1, 0x52, 0x18, 0x2e, 0x41, 0x40, 0x03, 0x48, 0x99, 0x21, 0x32, 0x12,
-  0x22, 0x16, 0x82, 0xb1, 0x16, 0xc6, 0x62, 0x18, 0x1c, 0xb1, 0x11, 0x62,
-  0x28, 0x5a, 0x92, 0x12, 0x13, 0xb1, 0x42, 0xa9, 0x82, 0x23, 0x48, 0x22,
-  0x2c, 0x91, 0x12, 0x24, 0x4a, 0x41, 0x28, 0x04, 0x2b, 0x14, 0x69, 0x04,
-  0x2a, 0x2c, 0xf2, 0x52, 0x5e, 0x60, 0x12, 0xd0, 0x12, 0xe1, 0x42, 0x41,
-  0x43, 0x62, 0x24, 0x85, 0x21, 0x01, 0x18, 0x22, 0xc0, 0x41, 0x10, 0x01,
-  0x45, 0x09, 0x28, 0x40, 0x01, 0x14, 0x48, 0xc0, 0x23, 0x4a, 0x22, 0xa4,
-  0x24, 0x18, 0x2b, 0x28, 0x48, 0x82, 0x16, 0x45, 0x44, 0x02, 0x00, 0x4a,
-  0x08, 0x11, 0xa0, 0x14, 0x11, 0x18, 0x11, 0x1c, 0x08, 0x88, 0x24, 0x43,
-  0xa8, 0x82, 0x43, 0x88, 0xe8, 0x48, 0x01, 0xf0, 0x2d, 0x2f, 0x00, 0x42,
-  0x00, 0x42, 0x00, 0x22, 0x23, 0x04, 0x10, 0x91, 0x42, 0x48, 0x40, 0x43,
-  0x04, 0x1c, 0x1c, 0x32, 0x11, 0x81, 0x18, 0x1b, 0x1a, 0x28, 0x88, 0x40,
-  0x0c, 0x80, 0x02, 0x20, 0x21, 0x41, 0x81, 0x81, 0x81, 0x01, 0x28, 0x44,
-  0x25, 0x21, 0x99, 0x88, 0xd1, 0x82, 0x16, 0x42, 0x81, 0x32, 0x24, 0x46,
-  0x84, 0x08, 0x24, 0x43, 0x01, 0x12, 0x44, 0xef, 0x8e, 0x05, 0x12, 0x46,
-  0x18, 0xf8, 0x14, 0x22, 0x12, 0x81, 0x81, 0x10, 0x01, 0x90, 0x24, 0x19,
-  0x02, 0x84, 0x2a, 0x41, 0x08, 0x45, 0xa8, 0x12, 0x29, 0x04, 0xd0, 0x22,
-  0x81, 0x28, 0x18, 0x03, 0x41, 0x60, 0x11, 0x28, 0x24, 0x1c, 0x42, 0x48,
-  0x84, 0x04, 0x41, 0x46, 0x82, 0x08, 0x60, 0x44, 0x12, 0x43, 0xc9, 0x22,
-  0x80, 0x06, 0x48, 0xa3, 0x08, 0x43, 0x01, 0x24, 0x50, 0x84, 0x4a, 0xf2,
-  0xc3, 0xaf, 0x00, 0x24, 0x28, 0x10, 0x81, 0x11, 0x01, 0x00, 0x12, 0x00,
-  0x80, 0x91, 0x44, 0x40, 0x81, 0x01, 0x00, 0x20, 0x04, 0x48, 0x42, 0x2a,
-  0x94, 0x42, 0x28, 0x24, 0x42, 0x00, 0x1c, 0xc2, 0x42, 0x10, 0x91, 0x81,
-  0x21, 0x20, 0x48, 0x42, 0x01, 0x40, 0x81, 0x08, 0x8a, 0x01, 0x00, 0x28,
-  0x00, 0x00, 0xf0, 0x6c, 0x52, 0x00, 0x60, 0x82, 0x36, 0xa6, 0x14, 0x81,
-  0x14, 0x2c, 0x62, 0x14, 0x00, 0x2c, 0x02, 0x30, 0x18, 0x2e, 0x44, 0x65,
-  0x48, 0xf1, 0x11, 0xc8, 0x2d, 0x12, 0x46, 0x11, 0x08, 0x6e, 0x81, 0x2b,
-  0x82, 0x10, 0xd2, 0x84, 0x96, 0x46, 0x90, 0x21, 0x62, 0xb0, 0x22, 0x61,
-  0x13, 0x15, 0x24, 0x81, 0x81, 0x69, 0x24, 0x2a, 0x48, 0x02, 0x5c, 0xc1,
-  0x18, 0x8b, 0x18, 0x1c, 0x32, 0x82, 0x25, 0x21, 0xe8, 0x42, 0xd4, 0x86,
-  0x04, 0x22, 0x10, 0x04, 0x43, 0xe1, 0x42, 0xf4, 0xec, 0xb7, 0x80, 0x01,
-  0x21, 0x40, 0x21, 0x11, 0x08, 0x00, 0x18, 0x11, 0x46, 0x81, 0x04, 0x13,
-  0x01, 0x40, 0x24, 0x82, 0x01, 0x18, 0x00, 0x48, 0x46, 0x01, 0x20, 0x22,
-  0x11, 0x02, 0x00, 0x2c, 0x04, 0x14, 0x15, 0x14, 0x02, 0x49, 0x18, 0xb1,
-  0x42, 0x28, 0x48, 0x21, 0x88, 0x81, 0x84, 0x01, 0x88, 0x82, 0x4c, 0x01,
-  0x29, 0x01, 0x81, 0xf0, 0x4c, 0x2d, 0xc0, 0x21, 0x20, 0x02, 0x10, 0x22,
-  0xb4, 0x42, 0x61, 0x22, 0x16, 0x08, 0x00, 0x10, 0x91, 0x22, 0x80, 0x05,
-  0x80, 0x94, 0x12, 0x42, 0x42, 0x20, 0x02, 0x82, 0x48, 0x20, 0x02, 0x42,
-  0x00, 0x40, 0x88, 0x01, 0x21, 0x21, 0x2c, 0x01, 0x30, 0x11, 0x4d, 0x81,
-  0x86, 0x41, 0x84, 0x49, 0x22, 0x0a, 0x18, 0x20, 0x04, 0xa0, 0x21, 0x12,
-  0x9f, 0x2b, 0x0e, 0x00, 0x49, 0x01, 0x42, 0x80, 0x03, 0x42, 0xa0, 0x34,
-  0x29, 0x84, 0x91, 0x12, 0x42, 0x12, 0x46, 0x11, 0x52, 0x18, 0x00, 0x10,
-  0x08, 0x20, 0x91, 0x48, 0x00, 0x80, 0x04, 0x28, 0x22, 0x00, 0x46, 0x01,
-  0x00, 0x80, 0x22, 0x08, 0x20, 0x92, 0x12, 0x14, 0x80, 0x88, 0x81, 0x18,
-  0x92, 0x28, 0x21, 0x80, 0x91, 0xc8, 0xf0, 0xd8, 0x31, 0xc0, 0x41, 0x21,
-  0x14, 0x15, 0x08, 0x84, 0x11, 0x81, 0x10, 0x88, 0x02, 0x43, 0x02, 0x00,
-  0x12, 0x8b, 0x41, 0x4a, 0x02, 0x28, 0x14, 0x22, 0x11, 0x28, 0x11, 0x90,
-  0x52, 0x24, 0xc0, 0x12, 0x12, 0x20, 0x11, 0x04, 0x10, 0x42, 0x02, 0x42,
-  0x12, 0x15, 0x02, 0x48, 0x11, 0x42, 0x49, 0x48, 0x01, 0x29, 0x04, 0x48,
-  0x20, 0x21, 0xa8, 0x28, 0x00, 0x5f, 0xa7, 0x09, 0x00, 0x1a, 0xa4, 0x14,
-  0x00, 0x18, 0x48, 0x11, 0x00, 0x11, 0x10, 0x48, 0x14, 0x81, 0x22, 0x02,
-  0x22, 0x44, 0x40, 0x21, 0x41, 0x47, 0x92, 0x21, 0x22, 0x00, 0x00, 0x90,
-  0x61, 0x19, 0x44, 0x02, 0x1a, 0x42, 0x88, 0x02, 0xc0, 0x24, 0x82, 0x26,
-  0x88, 0x42, 0x04, 0x47, 0x84, 0x18, 0x20, 0x02, 0x2a, 0x88, 0x02, 0x00,
-  0x28, 0x7f, 0xf7, 0x06, 0x82, 0x00, 0x80, 0x01, 0x28, 0x21, 0x62, 0x29,
-  0x01, 0x52, 0x10, 0x42, 0x81, 0x45, 0x02, 0x60, 0x21, 0x42, 0x20, 0x01,
-  0x20, 0x01, 0x82, 0x42, 0x90, 0x61, 0x10, 0x14, 0x02, 0x2e, 0x41, 0x10,
-  0x41, 0x01, 0x11, 0x90, 0x52, 0x30, 0x12, 0x80, 0x21, 0x18, 0x02, 0x49,
-  0x41, 0x12, 0x84, 0x28, 0x24, 0x34, 0x12, 0x22, 0x54, 0x3f, 0x1d, 0x04,
-  0x1a, 0x12, 0xa8, 0x42, 0xd0, 0x21, 0x86, 0x05, 0x18, 0x00, 0x1c, 0x14,
-  0x3a, 0x41, 0x18, 0x42, 0x25, 0x08, 0x14, 0x00, 0x00, 0x48, 0x80, 0x04,
-  0x46, 0x01, 0x44, 0x18, 0x60, 0x12, 0x14, 0x00, 0x29, 0x01, 0x80, 0x64,
-  0x21, 0x41, 0x22, 0x80, 0x42, 0x01, 0x23, 0xca, 0x21, 0x00, 0x2a, 0x08,
-  0x1e, 0x88, 0x40, 0x24, 0x02, 0x29, 0x04, 0x7f, 0xc5, 0x0a, 0xc4, 0x80,
-  0x84, 0x11, 0x04, 0x41, 0x10, 0x84, 0x04, 0x44, 0x00, 0x00, 0x1c, 0x04,
-  0x00, 0x84, 0x10, 0x01, 0x94, 0x10, 0x04, 0x83, 0x02, 0x81, 0x60, 0x16,
-  0x81, 0x00, 0x80, 0x24, 0x02, 0x22, 0x20, 0x02, 0x00, 0x44, 0x80, 0x09,
-  0x81, 0x80, 0x02, 0x23, 0x48, 0x28, 0x02, 0xd0, 0xd9, 0x0d, 0x20, 0x44,
-  0x11, 0x02, 0x42, 0x42, 0x84, 0x11, 0x42, 0x11, 0x83, 0x11, 0x11, 0x28,
-  0x32, 0x49, 0x00, 0x24, 0x12, 0x14, 0x80, 0x12, 0xa2, 0x42, 0x80, 0x9a,
-  0x12, 0x1c, 0x02, 0x44, 0x40, 0x02, 0x15, 0x22, 0x51, 0x24, 0x26, 0x11,
-  0x24, 0x83, 0x08, 0x92, 0x24, 0x44, 0x80, 0x04, 0x68, 0x20, 0x84, 0x88,
-  0x04, 0x12, 0x48, 0x44, 0x88, 0x21, 0x57, 0xd1, 0x60, 0x81, 0x18, 0x48,
-  0x83, 0x94, 0x21, 0x81, 0x11, 0x00, 0x00, 0x44, 0x80, 0x02, 0x60, 0x42,
-  0x85, 0x71, 0x21, 0x04, 0x28, 0x11, 0x25, 0x44, 0xc1, 0x12, 0x86, 0x81,
-  0x08, 0x24, 0x12, 0x24, 0x12, 0x14, 0x18, 0x22, 0x15, 0x38, 0x21, 0x48,
-  0x00, 0x46, 0x08, 0x46, 0x88, 0x22, 0x06, 0xd4, 0x24, 0x28, 0xa2, 0x00,
-  0x82, 0x80, 0x2a, 0x88, 0x18, 0x82, 0xf2, 0xf5, 0x11, 0x60, 0x16, 0x83,
-  0xd8, 0x31, 0xc1, 0x19, 0x1d, 0x46, 0xab, 0x41, 0x76, 0x31, 0x52, 0x48,
-  0x8c, 0xb5, 0x51, 0x44, 0xf1, 0x14, 0x21, 0x18, 0x48, 0xbd, 0x69, 0x1e,
-  0x43, 0xaf, 0x14, 0xd6, 0x28, 0x82, 0x21, 0x12, 0xe2, 0x54, 0x14, 0x11,
-  0x34, 0x82, 0x67, 0x22, 0x8a, 0xe1, 0x86, 0x02, 0x2e, 0x54, 0x19, 0x01,
-  0x22, 0x1d, 0x21, 0x12, 0x4c, 0xb4, 0x12, 0x71, 0x41, 0xc2, 0x12, 0x20,
-  0xf1, 0x52, 0x51, 0x82, 0x46, 0x64, 0x52, 0xc6, 0x68, 0x48, 0x87, 0x1d,
-  0x9a, 0xb2, 0x38, 0xa8, 0x8a, 0x2b, 0xca, 0x8d, 0xa2, 0x21, 0x42, 0xe0,
-  0x18, 0x0c, 0x1f, 0x6e, 0x05, 0x13, 0x31, 0x12, 0x1a, 0x12, 0xe8, 0x12,
-  0x22, 0xd4, 0x41, 0xc3, 0x48, 0x1b, 0x26, 0xa1, 0x3c, 0x32, 0x1a, 0x11,
-  0x16, 0x78, 0x41, 0x02, 0x42, 0x16, 0xd8, 0x51, 0x84, 0xf2, 0x46, 0x28,
-  0x14, 0x99, 0x53, 0x12, 0x1f, 0x22, 0xa6, 0x21, 0x1f, 0x14, 0x24, 0xc5,
-  0x41, 0x1a, 0x41, 0x9b, 0x22, 0x4e, 0x64, 0x5a, 0x53, 0x24, 0x21, 0x14,
-  0x1f, 0x12, 0x42, 0xb4, 0x32, 0x52, 0x42, 0x38, 0x4f, 0x8a, 0x82, 0xd2,
-  0x1b, 0xc4, 0x22, 0x1b, 0x71, 0x34, 0x4c, 0xc8, 0x82, 0x49, 0x04, 0x4b,
-  0x15, 0xa2, 0x43, 0x6c, 0x82, 0x4b, 0x98, 0x83, 0x17, 0xf6, 0x2d, 0xb5,
-  0xc0, 0x34, 0x42, 0x43, 0xa2, 0x45, 0x52, 0x84, 0x2c, 0x94, 0x18, 0x74,
-  0x52, 0x22, 0x4e, 0x58, 0x46, 0x12, 0xda, 0x14, 0xa2, 0x15, 0x1f, 0x42,
-  0x92, 0x11, 0x22, 0x12, 0x1c, 0x34, 0x11, 0x22, 0x4a, 0x61, 0x94, 0x1d,
-  0x11, 0x89, 0x92, 0xa2, 0x45, 0x12, 0xa2, 0x24, 0x12, 0x26, 0x52, 0x83,
-  0x48, 0x1d, 0x71, 0x3d, 0x2a, 0x90, 0x28, 0xf0, 0xc1, 0x68, 0x26, 0xc2,
-  0x82, 0x26, 0xa2, 0x33, 0x13, 0xd8, 0x12, 0xb8, 0x25, 0x98, 0x52, 0xb0,
-  0xc2, 0x43, 0x12, 0x08, 0x3a, 0xef, 0x28, 0xac, 0x23, 0x28, 0x2a, 0xf3,
-  0xe6, 0x26, 0xd0, 0x41, 0x82, 0xd1, 0x41, 0x12, 0xd8, 0x41, 0x92, 0x1a,
-  0x1d, 0x64, 0xa9, 0xd1, 0x41, 0x92, 0x1a, 0x19, 0x92, 0x1a, 0x11, 0xa9,
-  0x11, 0x94, 0x1a, 0x43, 0x92, 0x12, 0x47, 0x82, 0x29, 0xf1, 0x24, 0x48,
-  0x18, 0x4f, 0x82, 0x04, 0x4f, 0xa2, 0x04, 0x4f, 0xa2, 0x24, 0xe1, 0xa2,
-  0x24, 0xc1, 0x4a, 0x12, 0xac, 0x24, 0xe1, 0x32, 0x24, 0x41, 0x22, 0x71,
-  0x28, 0x22, 0x31, 0x6a, 0x12, 0xab, 0x14, 0xf0, 0x4a, 0x11, 0xb0, 0x6a,
-  0x21, 0xb8, 0x4a, 0x01, 0xab, 0x14, 0xb0, 0x4a, 0x63, 0x88, 0x2b, 0x14,
-  0x8c, 0x84, 0xc1, 0x48, 0xf0, 0x6d, 0x19, 0x14, 0x5f, 0x53, 0xf3, 0x25,
-  0x15, 0x1f, 0xf2, 0x72, 0x2f, 0xfd, 0x6d, 0x2f, 0xff, 0xf3, 0xf3, 0x31,
-  0x3b, 0xff, 0xf7, 0xf3, 0x7d, 0x2f, 0xef, 0xf7, 0xf1, 0x7b, 0x2b, 0xbf,
-  0xb3, 0xf3, 0x53, 0x5b, 0xef, 0xf1, 0xf1, 0x1f, 0x1f, 0xef, 0xf3, 0xf3,
-  0x7f, 0x3b, 0xaf, 0xe1, 0xf3, 0x32, 0x3c, 0xef, 0xc1, 0xf3, 0x79, 0x79,
-  0x8f, 0xc4, 0xe7, 0xc6, 0xf6, 0x6c, 0x2f, 0xaf, 0xa6, 0xf6, 0x4e, 0x6e,
-  0x6f, 0xf6, 0xf7, 0x7a, 0xb8, 0xff, 0xf6, 0xf7, 0x5a, 0x7a, 0x7f, 0x76,
-  0xf7, 0x5a, 0x5a, 0xef, 0xe5, 0xb5, 0x52, 0xf1, 0x32, 0x12, 0x2f, 0x25,
-  0xf5, 0x16, 0x16, 0xbf, 0xa3, 0xf1, 0x1f, 0x1f, 0xaf, 0xa5, 0xf5, 0xdf,
-  0xd7, 0x3e, 0x7a, 0x2f, 0xaf, 0xff, 0xd8, 0xda, 0x7f, 0x77, 0xf7, 0x33,
-  0x5b, 0x3f, 0xbd, 0xfd, 0xb9, 0xdb, 0x2f, 0x25, 0xfd, 0x5a, 0x5a, 0xef,
-  0xe7, 0xf7, 0x78, 0x7a, 0x6f, 0x6d, 0xff, 0x92, 0xda, 0xef, 0xef, 0xff,
-  0xda, 0xc8, 0xcf, 0xc7, 0xe5, 0x8d, 0xfc, 0x6c, 0x2c, 0x8f, 0x5c, 0x47,
-  0xf1, 0x31, 0x21, 0x1b, 0x73, 0x9f, 0xf3, 0xf3, 0x2f, 0x2c, 0x9f, 0x36,
-  0xf2, 0x1b, 0x3a, 0xff, 0xf6, 0xf6, 0x1f, 0x3e, 0xbf, 0x37, 0xf3, 0x7b,
-  0x39, 0xff, 0x77, 0xf3, 0x5b, 0x78, 0xbf, 0xf6, 0xf7, 0x1b, 0x19, 0xbf,
-  0x34, 0xf1, 0x7f, 0x1d, 0xff, 0x36, 0xf3, 0x7a, 0x7d, 0x3f, 0xd2, 0xf3,
-  0x3e, 0x3c, 0x5f, 0x76, 0xf7, 0x23, 0x75, 0x1f, 0xd6, 0xf6, 0x6e, 0x5f,
-  0x5f, 0x76, 0xf6, 0x22, 0xe2, 0x1f, 0xb7, 0xf7, 0x7e, 0xde, 0x3f, 0x37,
-  0xf7, 0x32, 0x72, 0xdf, 0xf7, 0xf7, 0x1b, 0x5b, 0xcf, 0xe5, 0xf4, 0x72,
-  0x73, 0xbf, 0xb3, 0xf2, 0x13, 0x12, 0x5f, 0xf7, 0xf6, 0x32, 0x32, 0x5f,
-  0x73, 0xf2, 0x7a, 0x3a, 0xff, 0x7f, 0xfe, 0x72, 0x7a, 0x2f, 0xad, 0xff,
-  0xca, 0xba, 0xff, 0xd7, 0xf7, 0x63, 0x7f, 0x3f, 0xbf, 0xff, 0xeb, 0xfb,
-  0xaf, 0x85, 0xfd, 0xc2, 0xb2, 0x6f, 0x67, 0xf7, 0xea, 0xba, 0xef, 0xcf,
-  0xff, 0xc2, 0xda, 0xef, 0xcf, 0xff, 0xf2, 0xf2, 0x6f, 0x43, 0xe5, 0x8f,
-  0xfd, 0x7e, 0x7e, 0x1f, 0xae, 0x0b, 0x1f, 0x13, 0xb2, 0x11, 0xf5, 0x35,
-  0x23, 0xb5, 0xfc, 0x29, 0x63, 0xbf, 0x81, 0xf7, 0x35, 0x37, 0xbf, 0x85,
-  0xf3, 0x69, 0x23, 0xaf, 0x81, 0xf1, 0x6b, 0x67, 0xbf, 0x81, 0xf3, 0x43,
-  0x73, 0xaf, 0x91, 0xf1, 0x4b, 0x53, 0xff, 0x93, 0xf5, 0x6b, 0x7f, 0xbf,
-  0x81, 0xf1, 0x2f, 0x32, 0x2f, 0x81, 0xf1, 0x67, 0x75, 0x2b, 0x51, 0xdf,
-  0x16, 0xe7, 0xa2, 0xf1, 0x65, 0x67, 0x3d, 0xc2, 0x8f, 0x36, 0xf6, 0x32,
-  0x18, 0x5f, 0x76, 0xf6, 0x12, 0x72, 0xdf, 0xf6, 0xf6, 0x12, 0x53, 0x4f,
-  0x65, 0xf4, 0x1a, 0x38, 0x7e, 0x6b, 0x2f, 0x35, 0xf5, 0x14, 0x46, 0x3f,
-  0x23, 0x73, 0x15, 0xf7, 0x5a, 0x32, 0x7f, 0xdf, 0xee, 0x23, 0xb3, 0x7a,
-  0xe7, 0x2c, 0xfb, 0x7f, 0x7d, 0x3f, 0x72, 0xf3, 0xdb, 0xf1, 0x1f, 0x38,
-  0xfb, 0x5a, 0x58, 0x2f, 0x2c, 0xf9, 0xd6, 0xd4, 0x6e, 0xb2, 0xef, 0xcf,
-  0xff, 0x8a, 0x92, 0x6f, 0xcf, 0xbf, 0xe2, 0xfe, 0x36, 0xf4, 0x8b, 0x64,
-  0x4f, 0xc2, 0xf3, 0x2f, 0xbd, 0x14, 0x5f, 0x53, 0xa2, 0x13, 0x5f, 0xb3,
-  0x73, 0x2a, 0xfc, 0x75, 0x77, 0xaf, 0xa5, 0xf5, 0x61, 0x7b, 0xef, 0xe5,
-  0xf5, 0x75, 0x67, 0xaf, 0x93, 0xf5, 0x71, 0x67, 0xaf, 0x81, 0xf1, 0x45,
-  0x6b, 0xbf, 0x91, 0xf1, 0x45, 0x47, 0xff, 0x91, 0xf5, 0x69, 0x67, 0xaf,
-  0x91, 0xf3, 0x2d, 0x23, 0x6f, 0xc1, 0xf3, 0x6b, 0x69, 0x2f, 0x11, 0xf3,
-  0x6c, 0x71, 0x47, 0xc4, 0x9f, 0xb6, 0x96, 0x23, 0xdf, 0x76, 0xf7, 0xd6,
-  0x1c, 0xbf, 0xb6, 0xb7, 0x32, 0xf3, 0x65, 0x77, 0xaf, 0x91, 0xf1, 0x64,
-  0x66, 0xaf, 0x87, 0xf3, 0x23, 0x2b, 0x3b, 0x55, 0xdf, 0x72, 0xf6, 0x33,
-  0x31, 0xdf, 0xf2, 0xf2, 0x3a, 0x32, 0x7f, 0xfe, 0xee, 0x23, 0xf7, 0x7a,
-  0x72, 0x8d, 0x2a, 0x7f, 0x57, 0xf7, 0x21, 0x62, 0xaf, 0x3f, 0xff, 0x89,
-  0x6b, 0x2b, 0x55, 0xae, 0x82, 0xef, 0xed, 0xdd, 0xa8, 0xf8, 0xf6, 0xf4,
-  0x8f, 0x28, 0xf4, 0xf6, 0xfc, 0x8f, 0x8f, 0xf6, 0x36, 0x94, 0x8b, 0xcf,
-  0x4f, 0xc6, 0xf3, 0xfa, 0x48, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x00, 0x00, 0x48, 0x00, 0x00, 0x10, 0x01, 0x00, 0x11, 0x00, 0x00, 0x20,
-  0x02, 0x00, 0x22, 0x40, 0x01, 0x00, 0x22, 0x20, 0x02, 0x14, 0x40, 0x01,
-  0x00, 0x00, 0x00, 0x28, 0x82, 0x00, 0x5f, 0x2b, 0x09, 0x82, 0x00, 0x12,
-  0x80, 0x04, 0x48, 0x00, 0x80, 0x04, 0x00, 0x40, 0x91, 0x41, 0x00, 0x21,
-  0x80, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x44, 0x01, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x80, 0x08, 0x28,
-  0x14, 0x9f, 0x1c, 0x0c, 0x2c, 0xf4, 0x11, 0x24, 0xa5, 0xf2, 0x11, 0x24,
-  0x87, 0x14, 0x1f, 0x41, 0x32, 0x4a, 0x1d, 0x64, 0xab, 0x14, 0x1f, 0x41,
-  0xb2, 0x4a, 0xb9, 0x11, 0xf2, 0x4a, 0x91, 0x51, 0xab, 0x94, 0x43, 0xf3,
-  0x4a, 0xb1, 0x43, 0xf2, 0x42, 0xb1, 0x4f, 0x82, 0xd4, 0x12, 0xfb, 0x24,
-  0x48, 0x4e, 0x91, 0x4f, 0xa2, 0xc4, 0x81, 0x4f, 0xa2, 0xe4, 0x15, 0xf2,
-  0x26, 0x4a, 0x9e, 0x21, 0x2e, 0x4a, 0x96, 0xc5, 0x5a, 0xde, 0x24, 0x4d,
-  0x4a, 0x1f, 0x49, 0xc2, 0x43, 0x1f, 0x49, 0x52, 0x2a, 0x1f, 0x49, 0x32,
-  0x48, 0x1f, 0x49, 0x72, 0x4e, 0xf2, 0x81, 0x24, 0xaf, 0x14, 0xf1, 0x81,
-  0x24, 0xaf, 0x14, 0xb9, 0x81, 0xb2, 0x4a, 0x39, 0x15, 0xaf, 0x54, 0x39,
-  0x24, 0xab, 0x94, 0x43, 0xba, 0x42, 0x79, 0x24, 0x98, 0x92, 0x4f, 0x83,
-  0x84, 0xf9, 0xa4, 0x4a, 0x4f, 0x72, 0x06, 0x48, 0x1d, 0x68, 0x81, 0x1a,
-  0x36, 0x48, 0x19, 0x32, 0x4a, 0x19, 0xb2, 0x4a, 0x91, 0x21, 0xaf, 0x44,
-  0x88, 0xd2, 0x4a, 0x1b, 0xb1, 0x4a, 0x0b, 0xaf, 0x14, 0x08, 0x2d, 0x91,
-  0x90, 0x92, 0x2b, 0x42, 0x1c, 0xf9, 0x22, 0x12, 0x1c, 0xa8, 0x58, 0x16,
-  0xc1, 0x82, 0x92, 0x2e, 0x42, 0x92, 0x3c, 0xe4, 0x49, 0x42, 0x63, 0xc9,
-  0x48, 0x1f, 0xc9, 0x46, 0xa2, 0x49, 0x42, 0x92, 0x2b, 0x84, 0x4c, 0xa2,
-  0x14, 0x4c, 0xf2, 0x42, 0x14, 0x11, 0x2f, 0x46, 0x01, 0x2b, 0xa4, 0x43,
-  0xb2, 0x42, 0x0b, 0x2b, 0x14, 0x43, 0x92, 0x92, 0x6b, 0x42, 0x88, 0x2f,
-  0x22, 0xf5, 0x2f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
-  0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x40,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0xd5, 0x66, 0x00, 0x21, 0x00, 0x49, 0x04, 0x90, 0x48, 0x44, 0x00,
-  0xa0, 0x81, 0x14, 0x41, 0x11, 0x4c, 0xa4, 0x12, 0x44, 0x68, 0x4c, 0x12,
-  0xc1, 0x28, 0xa8, 0x44, 0x1c, 0x02, 0x00, 0xc0, 0x64, 0x00, 0x60, 0x54,
-  0x58, 0x22, 0x86, 0x11, 0x31, 0x24, 0x42, 0x00, 0x60, 0x44, 0x52, 0x21,
-  0x82, 0x82, 0x41, 0x00, 0x10, 0x04, 0x81, 0x20, 0x02, 0x4f, 0xa7, 0x4c,
-  0x01, 0xa6, 0x41, 0x78, 0x21, 0xc2, 0x28, 0x34, 0x8c, 0x64, 0x33, 0x16,
-  0x78, 0x28, 0x63, 0x85, 0x26, 0xc1, 0x48, 0x85, 0x42, 0xe8, 0x24, 0x62,
-  0x81, 0x2c, 0x24, 0x45, 0x32, 0x19, 0x5a, 0xa2, 0x41, 0x42, 0x11, 0x42,
-  0x2d, 0x11, 0x4b, 0x24, 0x39, 0xa1, 0x24, 0x39, 0x81, 0xb4, 0x42, 0x21,
-  0x94, 0x12, 0x28, 0x25, 0x21, 0x92, 0x92, 0x48, 0x1d, 0x12, 0x46, 0x64,
-  0x34, 0x1a, 0x4c, 0x23, 0x68, 0x14, 0x1a, 0x64, 0x74, 0x8a, 0x24, 0xb4,
-  0x14, 0x48, 0xee, 0x89, 0x04, 0x6b, 0x48, 0x42, 0x16, 0x01, 0x9f, 0x5a,
-  0x43, 0x41, 0x62, 0x16, 0x84, 0x14, 0xcc, 0x44, 0xc3, 0x48, 0x8f, 0x34,
-  0x63, 0xc1, 0x26, 0x73, 0x54, 0x68, 0x12, 0x7e, 0x88, 0x24, 0x45, 0xc8,
-  0x22, 0x56, 0xec, 0x22, 0x31, 0x14, 0x24, 0x16, 0xa7, 0x25, 0x16, 0xa8,
-  0x2d, 0x51, 0xce, 0x21, 0x29, 0x81, 0x36, 0x13, 0x42, 0x39, 0x35, 0x41,
-  0x29, 0x25, 0xd4, 0x1a, 0xa5, 0x12, 0x27, 0x16, 0x86, 0x91, 0x12, 0x4c,
-  0xe6, 0x24, 0x01, 0x34, 0x48, 0x46, 0xb3, 0x84, 0x11, 0xa1, 0x4b, 0x4f,
-  0x34, 0x88, 0x0c, 0x92, 0xc5, 0xb2, 0x9c, 0x04, 0x27, 0xa8, 0x48, 0x32,
-  0x12, 0x9f, 0xb4, 0x0e, 0x00, 0x80, 0x32, 0x22, 0x00, 0x00, 0x84, 0x00,
-  0x50, 0x81, 0x90, 0x41, 0x80, 0x24, 0xa4, 0x42, 0x89, 0x12, 0xa1, 0x24,
-  0x00, 0x40, 0x11, 0x04, 0x22, 0x4c, 0x02, 0x00, 0x44, 0x48, 0x20, 0x32,
-  0x81, 0x10, 0x31, 0x44, 0x48, 0x98, 0x44, 0x46, 0x82, 0x04, 0x40, 0x84,
-  0x44, 0x04, 0x00, 0x46, 0x04, 0x00, 0x4f, 0x87, 0x0b, 0x22, 0x00, 0x44,
-  0x80, 0x02, 0x00, 0x20, 0x04, 0x00, 0x14, 0x40, 0x24, 0xc8, 0x85, 0xb0,
-  0x48, 0x02, 0x4a, 0x12, 0xc1, 0x24, 0x2a, 0x04, 0xb0, 0x48, 0x02, 0x28,
-  0xa4, 0x42, 0xc8, 0x4e, 0x24, 0x18, 0x00, 0x44, 0x90, 0x21, 0xe0, 0x88,
-  0x82, 0x08, 0x20, 0x88, 0x11, 0x85, 0x58, 0x84, 0x00, 0x89, 0x09, 0x25,
-  0x04, 0x88, 0x8c, 0xf4, 0x37, 0xed, 0x00, 0x49, 0x02, 0x12, 0x18, 0x80,
-  0x03, 0x25, 0xb5, 0x85, 0x14, 0xc8, 0x21, 0x23, 0x61, 0x2c, 0x4c, 0x08,
-  0x2a, 0x91, 0x44, 0x2e, 0x18, 0x1f, 0x88, 0x34, 0x14, 0x40, 0xdc, 0x84,
-  0x14, 0x48, 0xf2, 0x24, 0x49, 0xd0, 0x25, 0xa8, 0x24, 0x52, 0x4a, 0x02,
-  0x25, 0x62, 0x19, 0xf0, 0x84, 0x11, 0x9c, 0x38, 0x82, 0x49, 0x24, 0x01,
-  0x15, 0x24, 0xb1, 0x29, 0xbc, 0x82, 0x01, 0x23, 0x34, 0x88, 0x49, 0x94,
-  0xc1, 0x82, 0x49, 0x0e, 0x56, 0xa4, 0x12, 0x45, 0x49, 0xa8, 0x28, 0xbe,
-  0x2d, 0x00, 0x44, 0x10, 0x04, 0x22, 0x12, 0x10, 0x71, 0x84, 0x11, 0x18,
-  0x11, 0x42, 0x92, 0x84, 0x90, 0x14, 0xc2, 0x26, 0x3c, 0x88, 0x47, 0x87,
-  0xc0, 0x24, 0x8d, 0x45, 0x80, 0xf6, 0x26, 0x48, 0x70, 0x64, 0xb8, 0x42,
-  0xa2, 0x42, 0x83, 0x92, 0x42, 0x23, 0x74, 0x82, 0x04, 0x86, 0xc1, 0x81,
-  0x49, 0x08, 0x00, 0x91, 0x12, 0x87, 0x18, 0x23, 0xc8, 0x82, 0x1a, 0x94,
-  0x8c, 0x8e, 0x44, 0xc9, 0x0c, 0x2a, 0x0c, 0x48, 0x27, 0x42, 0x14, 0x84,
-  0x88, 0x2f, 0x2d, 0x0a, 0x22, 0x28, 0x80, 0x81, 0x01, 0x22, 0x50, 0x42,
-  0x42, 0x42, 0x28, 0x18, 0x8a, 0x14, 0x01, 0x28, 0x41, 0x8e, 0x11, 0x1c,
-  0x04, 0x60, 0x84, 0xd0, 0x48, 0x02, 0x14, 0x90, 0x81, 0x80, 0x81, 0x04,
-  0x82, 0x1b, 0x61, 0x18, 0x49, 0x41, 0x0a, 0x4c, 0xc4, 0x31, 0xb0, 0x84,
-  0x22, 0x88, 0x86, 0x01, 0x10, 0x01, 0x14, 0x88, 0x44, 0x89, 0x69, 0x41,
-  0x12, 0xc1, 0x82, 0x83, 0xb6, 0x29, 0x4c, 0x02, 0x42, 0x00, 0x84, 0x41,
-  0x20, 0x02, 0x11, 0x00, 0x4d, 0x28, 0x00, 0xc0, 0x14, 0x41, 0x2a, 0x08,
-  0x82, 0x10, 0x88, 0x28, 0x82, 0x88, 0x24, 0x94, 0x81, 0x44, 0x60, 0x24,
-  0x40, 0x01, 0x43, 0xc2, 0x48, 0x80, 0x88, 0x04, 0x28, 0x11, 0x48, 0x10,
-  0x68, 0x81, 0x00, 0x45, 0x28, 0x82, 0x41, 0x25, 0x02, 0x48, 0x85, 0x04,
-  0xf0, 0xd8, 0x2f, 0xc0, 0x18, 0x46, 0x04, 0x20, 0xa4, 0x68, 0x1a, 0x02,
-  0x40, 0x04, 0x42, 0x49, 0x92, 0x84, 0x20, 0xa2, 0x42, 0x14, 0x44, 0x89,
-  0x22, 0x95, 0x62, 0x41, 0x8b, 0x41, 0x80, 0x08, 0x18, 0x42, 0x28, 0x20,
-  0x82, 0x64, 0x12, 0x14, 0x14, 0x8c, 0x14, 0x01, 0x00, 0x8e, 0x14, 0x80,
-  0x08, 0x45, 0x01, 0x82, 0x28, 0x00, 0x48, 0x00, 0x14, 0x00, 0x23, 0x82,
-  0xf4, 0xa3, 0x78, 0x40, 0x22, 0x02, 0x00, 0x88, 0x20, 0x01, 0x42, 0x81,
-  0x28, 0x13, 0x24, 0x01, 0xc0, 0x82, 0x12, 0x00, 0x28, 0x41, 0x00, 0x00,
-  0x30, 0x28, 0x00, 0x41, 0x20, 0x11, 0x28, 0x05, 0x22, 0xc0, 0x21, 0x54,
-  0x86, 0x42, 0x68, 0x42, 0x30, 0x82, 0x40, 0x01, 0x24, 0x82, 0x20, 0x18,
-  0x11, 0x64, 0x1a, 0x82, 0x40, 0x88, 0xf2, 0x69, 0x28, 0x10, 0x62, 0x42,
-  0x00, 0x83, 0x34, 0x24, 0x32, 0x2a, 0x01, 0x4c, 0x14, 0x28, 0x32, 0x49,
-  0x43, 0x09, 0x22, 0x4b, 0x69, 0x44, 0xa6, 0x04, 0x4a, 0x3a, 0x44, 0x84,
-  0x83, 0x28, 0x02, 0x48, 0x42, 0xc6, 0x01, 0x41, 0x42, 0x58, 0x8c, 0x62,
-  0x11, 0x1c, 0x82, 0x02, 0xa6, 0x01, 0x24, 0x8c, 0x6a, 0x42, 0x46, 0x82,
-  0x18, 0x61, 0x11, 0x00, 0x47, 0x88, 0x28, 0x42, 0x10, 0x84, 0x22, 0x44,
-  0x18, 0xa8, 0x24, 0x25, 0x06, 0x2c, 0x01, 0x00, 0x80, 0x04, 0x00, 0x11,
-  0x80, 0x04, 0x00, 0x40, 0x32, 0x11, 0x60, 0x82, 0x18, 0x22, 0x44, 0x48,
-  0x00, 0xe0, 0x82, 0x01, 0x43, 0x02, 0x26, 0x02, 0x20, 0x14, 0x04, 0x14,
-  0x70, 0x44, 0x21, 0x98, 0x14, 0x11, 0x88, 0x10, 0x48, 0x88, 0x08, 0x21,
-  0x80, 0x19, 0x84, 0x22, 0x88, 0x18, 0x94, 0x21, 0x14, 0x3f, 0xaa, 0x0c,
-  0x42, 0x22, 0x00, 0x12, 0x20, 0x05, 0x48, 0x00, 0x10, 0x01, 0x62, 0x00,
-  0x4c, 0xa8, 0x42, 0x41, 0x40, 0x14, 0x24, 0x08, 0x00, 0x81, 0xa0, 0x28,
-  0x48, 0x80, 0x44, 0x81, 0x82, 0x02, 0x80, 0x04, 0x28, 0x80, 0x04, 0x28,
-  0x00, 0x42, 0x20, 0x04, 0x84, 0x22, 0x20, 0x82, 0x18, 0xe8, 0x22, 0x68,
-  0x12, 0x2f, 0xdf, 0x07, 0x12, 0x44, 0x20, 0xe1, 0x22, 0x64, 0x41, 0x20,
-  0xc1, 0x22, 0x20, 0xa4, 0x29, 0x24, 0x88, 0x20, 0x81, 0x08, 0x80, 0xb8,
-  0x48, 0x88, 0xa8, 0x48, 0x44, 0x28, 0x22, 0x84, 0x41, 0x00, 0x80, 0x04,
-  0x28, 0x00, 0x8c, 0x02, 0xc0, 0x22, 0x00, 0x12, 0x2c, 0x02, 0x20, 0x49,
-  0x02, 0x88, 0x12, 0x80, 0x64, 0x12, 0x20, 0x22, 0x22, 0x84, 0xd8, 0x9c,
-  0x09, 0x41, 0x20, 0x11, 0x04, 0x00, 0x00, 0x28, 0x20, 0x94, 0x24, 0x00,
-  0x40, 0x84, 0x42, 0x04, 0x44, 0x62, 0x44, 0x42, 0x45, 0x91, 0x48, 0x20,
-  0x46, 0x04, 0x80, 0x02, 0x48, 0x00, 0x00, 0x00, 0x80, 0x12, 0x01, 0xa0,
-  0x24, 0x00, 0x00, 0x20, 0x82, 0x84, 0x04, 0x81, 0x41, 0xc0, 0x41, 0xef,
-  0x4f, 0x0d, 0x14, 0x52, 0x40, 0xc8, 0x14, 0x28, 0x14, 0x00, 0x84, 0x14,
-  0x20, 0xc8, 0x28, 0x10, 0x04, 0xb0, 0x88, 0xc2, 0x28, 0x40, 0x08, 0x28,
-  0x82, 0x21, 0x22, 0x18, 0xa0, 0x48, 0x81, 0x25, 0xc8, 0x21, 0x19, 0x81,
-  0x78, 0x62, 0x18, 0x98, 0x58, 0x00, 0x80, 0x84, 0x92, 0x28, 0x10, 0x94,
-  0x21, 0x4b, 0x28, 0x19, 0x04, 0x22, 0x42, 0x00, 0x20, 0x84, 0xa4, 0x24,
-  0xb0, 0x28, 0x02, 0x1a, 0x22, 0x01, 0x42, 0x00, 0x20, 0x82, 0x02, 0x44,
-  0x00, 0xa0, 0x82, 0x00, 0x90, 0x81, 0x84, 0x2a, 0x18, 0x28, 0x04, 0x82,
-  0x12, 0x81, 0xe0, 0x12, 0x24, 0x02, 0x94, 0x28, 0x90, 0x64, 0x00, 0x81,
-  0x19, 0xa4, 0x42, 0x8e, 0x25, 0x80, 0x02, 0x60, 0x84, 0x28, 0x20, 0x08,
-  0x22, 0x40, 0x28, 0x0a, 0xa0, 0x42, 0x00, 0x6f, 0x35, 0x0b, 0x40, 0x08,
-  0x80, 0x04, 0x00, 0x00, 0x40, 0x44, 0x81, 0x08, 0x22, 0x82, 0x84, 0x80,
-  0x68, 0x14, 0x00, 0x8a, 0x04, 0x82, 0x88, 0x83, 0x04, 0x8c, 0xc4, 0x45,
-  0x42, 0x1c, 0x04, 0x84, 0x84, 0x42, 0x48, 0x10, 0x0a, 0x89, 0x01, 0x00,
-  0x80, 0x8c, 0x08, 0x20, 0x44, 0x08, 0x42, 0x42, 0x00, 0x20, 0xf8, 0x3c,
-  0xf8, 0xc0, 0x48, 0x00, 0x80, 0xa2, 0x24, 0x18, 0x21, 0x80, 0x01, 0x23,
-  0x08, 0x38, 0x24, 0x83, 0x48, 0xa2, 0x81, 0x60, 0x21, 0x81, 0xc8, 0x12,
-  0x28, 0x38, 0x20, 0x84, 0x02, 0x80, 0x02, 0x14, 0x22, 0x82, 0x46, 0x48,
-  0x82, 0x44, 0x28, 0x01, 0xc8, 0x23, 0x0c, 0x18, 0x50, 0x42, 0x80, 0x41,
-  0x02, 0x24, 0x1a, 0x42, 0x23, 0x11, 0x21, 0x01, 0xf0, 0x2f, 0xed, 0x20,
-  0x62, 0x48, 0xa0, 0x24, 0x88, 0x44, 0x00, 0x00, 0x00, 0x8e, 0x44, 0x00,
-  0x49, 0xc8, 0x45, 0x49, 0x42, 0x14, 0x14, 0x14, 0x24, 0x18, 0x0e, 0xc0,
-  0x21, 0x43, 0x28, 0x02, 0x00, 0x10, 0x88, 0x04, 0x00, 0x22, 0x00, 0x00,
-  0x48, 0x44, 0x82, 0x60, 0x84, 0x41, 0x2a, 0x04, 0x1c, 0x18, 0x08, 0x1d,
-  0x24, 0x40, 0x48, 0x81, 0xf2, 0x4d, 0x27, 0x40, 0x8c, 0xe2, 0x11, 0x04,
-  0x54, 0x8c, 0x04, 0x84, 0x14, 0x28, 0x42, 0xcc, 0x04, 0x28, 0x00, 0x00,
-  0x81, 0x22, 0x22, 0x50, 0x12, 0xc0, 0x14, 0x22, 0x4a, 0x18, 0x32, 0x44,
-  0x29, 0x31, 0x28, 0x38, 0x14, 0x29, 0x14, 0xc1, 0x18, 0x11, 0x48, 0x84,
-  0x00, 0x8a, 0x42, 0x04, 0x11, 0x28, 0x4c, 0x04, 0xca, 0x22, 0x28, 0x24,
-  0x06, 0x20, 0xc4, 0x48, 0x10, 0x22, 0xf4, 0xe4, 0x67, 0xc0, 0x14, 0x8b,
-  0x4b, 0x20, 0xe4, 0x23, 0x12, 0x04, 0x12, 0x14, 0x22, 0x19, 0xe4, 0x84,
-  0x8c, 0x12, 0x08, 0xa3, 0x18, 0xe4, 0x42, 0xd1, 0x5c, 0x64, 0x48, 0x4d,
-  0x48, 0xc2, 0x47, 0x14, 0xaa, 0x14, 0x25, 0x65, 0x82, 0x89, 0xd2, 0x44,
-  0xa2, 0x48, 0x8c, 0x06, 0x68, 0x27, 0x92, 0xee, 0x42, 0x58, 0x24, 0x83,
-  0x21, 0x74, 0x38, 0x32, 0x21, 0xe0, 0x11, 0x42, 0x18, 0xc1, 0xc4, 0x1c,
-  0x8e, 0x74, 0xc4, 0xa1, 0x44, 0x23, 0xd6, 0x81, 0xbc, 0x28, 0xe7, 0x14,
-  0x36, 0x21, 0x14, 0x4c, 0xc2, 0x61, 0x2b, 0x6a, 0x8e, 0x51, 0x20, 0xe4,
-  0x48, 0x22, 0x81, 0x73, 0x84, 0xc5, 0x54, 0x19, 0xd4, 0x82, 0x42, 0x92,
-  0x38, 0x20, 0x33, 0x84, 0x82, 0x22, 0x49, 0x68, 0x58, 0x69, 0xc8, 0x28,
-  0x4f, 0x82, 0x73, 0x88, 0xd1, 0x84, 0xae, 0x48, 0x49, 0xc2, 0x24, 0x8a,
-  0xe2, 0x14, 0x76, 0x24, 0x6c, 0x14, 0x21, 0x85, 0xb3, 0x41, 0x27, 0x24,
-  0x41, 0x04, 0x83, 0x06, 0x19, 0x04, 0x44, 0x89, 0x56, 0x42, 0x2e, 0x22,
-  0x4c, 0xa1, 0x24, 0xd2, 0x8b, 0xa4, 0x20, 0x08, 0x83, 0x32, 0x42, 0x88,
-  0x49, 0xf1, 0x48, 0x28, 0x87, 0x84, 0x86, 0x81, 0xf8, 0x64, 0xe1, 0xb0,
-  0x35, 0x96, 0x14, 0x1c, 0x91, 0x4c, 0x4a, 0xe5, 0x86, 0xa2, 0x11, 0xa0,
-  0x62, 0x30, 0x44, 0x23, 0xf8, 0x41, 0x87, 0x98, 0xe8, 0x36, 0xa4, 0x84,
-  0x8b, 0x28, 0xaa, 0x98, 0x88, 0x2f, 0x46, 0x5a, 0x48, 0x4c, 0xf9, 0x42,
-  0x8c, 0xae, 0x82, 0x83, 0x12, 0xb8, 0x52, 0xac, 0x42, 0x6e, 0xb8, 0x66,
-  0x74, 0x28, 0x28, 0xb2, 0x41, 0x96, 0xa9, 0x6a, 0x52, 0x81, 0x84, 0x8d,
-  0x2a, 0x4a, 0xa2, 0x28, 0xfa, 0xa8, 0x4e, 0x42, 0x22, 0x83, 0x32, 0x22,
-  0x47, 0x28, 0xd8, 0xa8, 0x1a, 0xa6, 0x24, 0x84, 0x22, 0x2b, 0x64, 0x8a,
-  0xa4, 0x52, 0x62, 0x42, 0xbf, 0x65, 0x0d, 0x11, 0x43, 0x12, 0x11, 0x18,
-  0x31, 0x2e, 0x11, 0xa9, 0x11, 0xb1, 0x2a, 0x11, 0x91, 0x1a, 0xd0, 0x1a,
-  0x01, 0xad, 0x14, 0xd0, 0x42, 0x01, 0x2d, 0x14, 0xe0, 0x44, 0x01, 0x42,
-  0x24, 0x28, 0x24, 0x5e, 0x24, 0x2c, 0x28, 0x45, 0x22, 0x45, 0x22, 0x45,
-  0x22, 0x41, 0x22, 0x41, 0x22, 0x91, 0x82, 0x12, 0x29, 0x01, 0x29, 0x81,
-  0x94, 0x12, 0x48, 0x29, 0x81, 0x94, 0x12, 0x90, 0x12, 0x48, 0x2d, 0x11,
+  0x51, 0x84, 0x82, 0x98, 0x04, 0xf0, 0xff, 0x5a, 0x10, 0x81, 0x08, 0x14,
+  0x4c, 0x42, 0xa2, 0x29, 0x24, 0x84, 0x25, 0x42, 0x74, 0x42, 0x81, 0x84,
+  0x08, 0x18, 0x32, 0x2c, 0x21, 0x41, 0x04, 0x29, 0x02, 0x10, 0xf4, 0xaa,
+  0x3f, 0x24, 0x40, 0x02, 0x85, 0x01, 0x45, 0x02, 0x49, 0x11, 0x88, 0x11,
+  0x68, 0x18, 0x11, 0x8a, 0x04, 0x19, 0x0c, 0x16, 0x04, 0xc6, 0x04, 0x4c,
+  0x08, 0x00, 0x24, 0x44, 0x35, 0x84, 0x31, 0x14, 0x00, 0x21, 0x18, 0x00,
+  0x19, 0x01, 0x24, 0x4d, 0x11, 0x21, 0x00, 0x82, 0x88, 0x00, 0x21, 0x12,
+  0x2d, 0x14, 0x00, 0x41, 0x70, 0xa8, 0x04, 0x89, 0x88, 0x11, 0xf8, 0x67,
+  0xf6, 0x20, 0x02, 0x00, 0x22, 0x40, 0x04, 0x21, 0x88, 0x24, 0x81, 0x44,
+  0xe0, 0x12, 0x01, 0x84, 0x80, 0x41, 0x28, 0x04, 0x18, 0x88, 0x42, 0x45,
+  0x01, 0x24, 0x46, 0x01, 0x12, 0x00, 0x00, 0x12, 0xe1, 0x86, 0x22, 0x42,
+  0x08, 0x00, 0x4c, 0x61, 0x11, 0x34, 0x28, 0x41, 0x69, 0x38, 0x21, 0x80,
+  0x01, 0x21, 0xe0, 0x54, 0x0b, 0x28, 0x2d, 0x82, 0x6f, 0xf2, 0x05, 0x11,
+  0x40, 0x38, 0x42, 0x20, 0x51, 0x28, 0x83, 0x84, 0x41, 0x63, 0x11, 0x2d,
+  0x42, 0xcd, 0x12, 0x50, 0x82, 0x48, 0x1c, 0x01, 0xc0, 0x41, 0x11, 0x84,
+  0x11, 0x10, 0x02, 0x11, 0x29, 0x08, 0x83, 0x11, 0x22, 0x38, 0x14, 0x90,
+  0x12, 0x00, 0x40, 0xc1, 0x81, 0x15, 0x84, 0x08, 0x00, 0x18, 0x90, 0x14,
+  0x11, 0x9c, 0x42, 0x02, 0x20, 0x01, 0x90, 0x24, 0x2c, 0x08, 0x8e, 0x45,
+  0xc0, 0x4a, 0x80, 0x04, 0x10, 0x42, 0x04, 0x90, 0x18, 0x44, 0x8f, 0x41,
+  0x08, 0x4e, 0x91, 0x10, 0x88, 0x62, 0x85, 0x80, 0x81, 0x01, 0x49, 0x02,
+  0x11, 0xb0, 0x14, 0x02, 0x10, 0x52, 0x24, 0x51, 0x20, 0x13, 0x48, 0x48,
+  0x42, 0x21, 0x05, 0x1a, 0x06, 0xa2, 0xc0, 0x14, 0x88, 0x4c, 0x04, 0x1a,
+  0x02, 0x29, 0x04, 0x18, 0x00, 0x61, 0x10, 0x32, 0x14, 0xef, 0x89, 0x04,
+  0x60, 0x44, 0xc0, 0x14, 0x8c, 0x81, 0x04, 0x4c, 0x01, 0x46, 0x01, 0x00,
+  0x00, 0x10, 0x0a, 0x40, 0x22, 0x01, 0x17, 0x21, 0x20, 0x48, 0x14, 0x11,
+  0x18, 0x21, 0x28, 0x41, 0x28, 0x81, 0x38, 0x11, 0x92, 0x81, 0x82, 0x4c,
+  0x12, 0x02, 0x21, 0x11, 0x29, 0x21, 0x18, 0x24, 0x32, 0x12, 0x86, 0x01,
+  0x2c, 0x42, 0x28, 0x02, 0x1a, 0x02, 0x20, 0x42, 0xf5, 0x77, 0xc7, 0x24,
+  0x24, 0xb4, 0x89, 0x04, 0x00, 0x00, 0xa1, 0x88, 0x81, 0x14, 0x16, 0x41,
+  0x14, 0x68, 0x48, 0x14, 0x88, 0x80, 0x08, 0x8b, 0x18, 0x21, 0x11, 0x2d,
+  0x11, 0x33, 0x81, 0x88, 0x01, 0x41, 0x28, 0x18, 0x5c, 0x0b, 0xf0, 0x7e,
+  0x18, 0x20, 0x02, 0x2a, 0x08, 0x18, 0x4c, 0x08, 0x80, 0x21, 0x08, 0x29,
+  0x88, 0x81, 0xe4, 0x22, 0x81, 0x08, 0x22, 0xbd, 0x67, 0x40, 0x08, 0x68,
+  0x15, 0x38, 0x85, 0x30, 0x28, 0x20, 0x52, 0x22, 0x2a, 0x41, 0x04, 0x14,
+  0x14, 0x13, 0x01, 0xd0, 0x48, 0x01, 0x85, 0x45, 0x85, 0x04, 0x00, 0xd8,
+  0x14, 0x36, 0x04, 0x23, 0x24, 0x22, 0x04, 0x28, 0x4e, 0x28, 0x22, 0x2a,
+  0x14, 0x41, 0x14, 0x08, 0x38, 0x44, 0x65, 0x71, 0x22, 0xc1, 0x14, 0x90,
+  0x22, 0x44, 0x00, 0x42, 0x81, 0x43, 0x18, 0x08, 0xa9, 0x24, 0xf8, 0x4f,
+  0x63, 0x20, 0x38, 0x88, 0x00, 0x41, 0x50, 0x22, 0x83, 0x24, 0x81, 0x04,
+  0x1a, 0x54, 0x22, 0x30, 0x12, 0x00, 0x8e, 0x42, 0x54, 0xd3, 0x51, 0x48,
+  0x12, 0x24, 0x14, 0x30, 0x82, 0x20, 0x41, 0x14, 0x12, 0x31, 0x16, 0x28,
+  0x28, 0x44, 0x88, 0x40, 0x81, 0x61, 0x88, 0xc1, 0x89, 0x0a, 0x80, 0x02,
+  0x19, 0x01, 0x64, 0x80, 0x48, 0xc2, 0x92, 0x81, 0x84, 0x02, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0x19, 0x9f, 0xbe, 0x0a, 0x15, 0x28, 0x81, 0x24, 0x44,
+  0x62, 0x44, 0x00, 0x24, 0x81, 0x11, 0x44, 0xa0, 0x21, 0x30, 0x18, 0x12,
+  0x45, 0x98, 0x28, 0xc0, 0x22, 0x14, 0x61, 0x12, 0x38, 0x16, 0x82, 0x58,
+  0x24, 0x20, 0x18, 0x24, 0x4a, 0x31, 0x81, 0x60, 0x82, 0x25, 0xa3, 0x42,
+  0x21, 0x00, 0xb0, 0x14, 0x04, 0x48, 0x22, 0x4c, 0x08, 0x68, 0x24, 0x41,
+  0x28, 0x00, 0x00, 0x28, 0x40, 0xf2, 0xe4, 0x86, 0x14, 0x42, 0x93, 0x0c,
+  0x3d, 0x41, 0x8f, 0x21, 0xc8, 0x14, 0x69, 0x12, 0x54, 0x22, 0x9a, 0xf8,
+  0x11, 0x18, 0x4a, 0x38, 0x12, 0x17, 0x28, 0x28, 0x1b, 0x59, 0x85, 0x99,
+  0x44, 0x50, 0x1c, 0x37, 0xa5, 0x88, 0x74, 0x15, 0x92, 0x22, 0x1e, 0x15,
+  0x26, 0x77, 0x86, 0x31, 0x23, 0xc7, 0x68, 0x2c, 0xe4, 0x5a, 0x89, 0x43,
+  0xc1, 0x18, 0x3a, 0x13, 0x43, 0xf1, 0x41, 0x21, 0x4f, 0x21, 0xd1, 0xcc,
+  0x91, 0x82, 0x1f, 0x43, 0x01, 0x6b, 0x88, 0x1f, 0x39, 0xe2, 0x21, 0x38,
+  0x12, 0x4f, 0x58, 0xf4, 0x22, 0x24, 0x43, 0xb4, 0x1a, 0x62, 0x4d, 0x12,
+  0x4d, 0x88, 0x46, 0x46, 0x68, 0x1b, 0x2e, 0x1a, 0x9f, 0x1b, 0x05, 0x26,
+  0x62, 0xc8, 0xa1, 0x16, 0x4c, 0x54, 0x22, 0x85, 0x2a, 0x84, 0x73, 0x42,
+  0x59, 0x52, 0x3b, 0x51, 0xfc, 0xb1, 0x54, 0x99, 0x13, 0x49, 0x38, 0x13,
+  0x8c, 0xf9, 0x1c, 0x18, 0x13, 0xdd, 0x14, 0x73, 0x9c, 0xb1, 0x34, 0x64,
+  0x11, 0x46, 0x51, 0x22, 0x13, 0xd1, 0xa1, 0xd1, 0x34, 0x91, 0x92, 0x50,
+  0x82, 0x1a, 0x24, 0x7a, 0x13, 0xa4, 0x88, 0x4d, 0x18, 0x1d, 0xa2, 0x23,
+  0x91, 0x82, 0x20, 0x8a, 0xb2, 0x14, 0xf1, 0x11, 0x64, 0x41, 0x1b, 0x2c,
+  0x2c, 0xb1, 0x13, 0x59, 0x94, 0x2b, 0x8a, 0x24, 0x88, 0x84, 0x86, 0x64,
+  0x89, 0x8e, 0x24, 0xac, 0x14, 0xf2, 0xa2, 0x8b, 0x24, 0x35, 0x71, 0x12,
+  0xc2, 0x28, 0x83, 0x34, 0x25, 0x4b, 0x44, 0x44, 0xaf, 0xe1, 0x75, 0x18,
+  0xd8, 0x29, 0xd5, 0x28, 0x72, 0x88, 0x1b, 0xd5, 0x12, 0x74, 0x18, 0x79,
+  0x48, 0xa9, 0x12, 0x87, 0x4d, 0x2d, 0x25, 0xcc, 0x5d, 0x48, 0x1d, 0x1c,
+  0x19, 0x31, 0x82, 0x1d, 0x82, 0x53, 0x98, 0x56, 0x16, 0x64, 0x45, 0x12,
+  0x6f, 0x53, 0xb1, 0x14, 0x52, 0x46, 0x1a, 0x8b, 0xc2, 0x42, 0x8d, 0x23,
+  0x23, 0xea, 0x62, 0x71, 0x89, 0x6d, 0x16, 0x89, 0x82, 0xfc, 0x82, 0xa4,
+  0x1c, 0xb1, 0x22, 0xa1, 0x12, 0x45, 0x44, 0xf2, 0x11, 0x12, 0x24, 0xf0,
+  0x22, 0x12, 0xa9, 0xf1, 0x68, 0x32, 0xcb, 0x32, 0x8b, 0x82, 0x89, 0xf2,
+  0x8c, 0x84, 0xdd, 0xeb, 0x80, 0x02, 0x8c, 0x02, 0x28, 0x42, 0x8c, 0x62,
+  0x24, 0x8c, 0xa2, 0x84, 0x1e, 0x28, 0x4a, 0x28, 0xe1, 0x24, 0x68, 0x81,
+  0x4a, 0x28, 0xa2, 0x84, 0x32, 0x88, 0x3a, 0x84, 0xa8, 0x43, 0x88, 0x2a,
+  0x04, 0x2a, 0x04, 0x2b, 0x52, 0x82, 0x58, 0x82, 0x2a, 0x24, 0xa8, 0x52,
+  0x82, 0x22, 0x82, 0x21, 0x82, 0x46, 0x22, 0x28, 0x24, 0xe9, 0x24, 0x28,
+  0xa1, 0x84, 0x12, 0x4a, 0x28, 0xa1, 0x84, 0xa0, 0x84, 0xa0, 0x84, 0x1a,
+  0x84, 0x88, 0x84, 0xf8, 0xca, 0x65, 0x14, 0x1b, 0x64, 0x5f, 0x52, 0xf2,
+  0x3c, 0x3c, 0x8f, 0x82, 0xf2, 0xd9, 0x7d, 0x6f, 0x67, 0xf7, 0x7e, 0x7c,
+  0xef, 0xc6, 0xb6, 0x4a, 0xf5, 0xe3, 0xe1, 0xbf, 0x8a, 0xff, 0xe1, 0xe3,
+  0x1b, 0xd8, 0x3f, 0x1c, 0xfd, 0xcf, 0x6c, 0x4f, 0x7e, 0xff, 0xfb, 0x79,
+  0xcf, 0x6f, 0xff, 0xb7, 0xd5, 0x5f, 0x7c, 0xff, 0x87, 0x75, 0xcf, 0x4e,
+  0xfe, 0xc5, 0xd4, 0x4e, 0x63, 0x1f, 0x18, 0xf6, 0x64, 0x67, 0x3f, 0x75,
+  0xf4, 0x6c, 0x6d, 0x7f, 0x4b, 0xef, 0x2d, 0xfd, 0x75, 0xf1, 0x8f, 0x8d,
+  0xad, 0x89, 0xda, 0xfe, 0x55, 0xd5, 0x9e, 0xb2, 0x2f, 0x38, 0xfa, 0x81,
+  0xa2, 0x6f, 0x7b, 0xbf, 0xca, 0xbc, 0xc4, 0xfc, 0xe8, 0xc8, 0x5f, 0x77,
+  0xf9, 0x96, 0xd4, 0x5f, 0x7a, 0xbe, 0xf3, 0xf7, 0x91, 0x93, 0x9a, 0xf5,
+  0x82, 0xd7, 0xca, 0xf4, 0xa6, 0xa6, 0xaf, 0x9e, 0xf4, 0xe2, 0xe2, 0xaf,
+  0x1d, 0xfd, 0x8c, 0x89, 0x8f, 0x98, 0xfc, 0xe8, 0xe8, 0x1f, 0x8e, 0xfe,
+  0xe8, 0xeb, 0x5e, 0x26, 0x24, 0x1d, 0x63, 0x7f, 0x72, 0xf6, 0x1e, 0x1c,
+  0x95, 0xf9, 0x4d, 0x2f, 0x6f, 0x47, 0xf7, 0x5e, 0x1c, 0xcf, 0xc5, 0xb4,
+  0x62, 0xf3, 0xe9, 0xeb, 0xbf, 0x55, 0xfd, 0xd3, 0xc3, 0x3f, 0x16, 0xff,
+  0xc1, 0xc1, 0xff, 0x5d, 0xfb, 0xd5, 0xd7, 0xaf, 0x9d, 0xf9, 0xfc, 0xfe,
+  0xff, 0xd7, 0xfd, 0xc5, 0xe7, 0x7f, 0x78, 0xff, 0xfe, 0xe5, 0x5f, 0x12,
+  0xdb, 0x21, 0xf3, 0x83, 0x61, 0x1f, 0x3e, 0xfe, 0x32, 0x21, 0xff, 0xf1,
+  0xf1, 0x95, 0x57, 0xfe, 0xf2, 0x5f, 0x19, 0xf9, 0x99, 0x9d, 0x4f, 0x4f,
+  0xe5, 0x1c, 0xfe, 0xd5, 0xfd, 0x9e, 0xb2, 0x3f, 0x3e, 0xf6, 0xa3, 0xa3,
+  0x7f, 0x6b, 0xf7, 0x8b, 0x84, 0xc3, 0xf8, 0xc8, 0xe8, 0x5f, 0x7d, 0xfb,
+  0xb6, 0xf4, 0x5f, 0x78, 0xfd, 0xe3, 0xe5, 0x1f, 0x3f, 0xed, 0x69, 0xff,
+  0x83, 0xc6, 0x7f, 0x2d, 0xff, 0xe4, 0xe6, 0xbf, 0xaa, 0xe8, 0x2a, 0xfb,
+  0x4a, 0xc8, 0xcf, 0xdf, 0xff, 0x28, 0xca, 0x8f, 0x8e, 0xfe, 0x28, 0xa8,
+  0xef, 0xba, 0xeb, 0x24, 0x4b, 0xf3, 0x22, 0x43, 0x7d, 0x65, 0xcf, 0xc1,
+  0x51, 0x88, 0xcf, 0xe7, 0xf1, 0x44, 0x66, 0xa7, 0xc4, 0xef, 0xc4, 0xb5,
+  0x6a, 0xf3, 0xd1, 0xd1, 0x9d, 0x9d, 0x3f, 0x1c, 0xfc, 0x13, 0xb1, 0x3f,
+  0x1c, 0x7d, 0x4f, 0xfd, 0xd5, 0xd6, 0xbf, 0x95, 0xf1, 0xfc, 0xde, 0x3f,
+  0xd1, 0xff, 0xcd, 0xdf, 0x3f, 0xd6, 0xf1, 0x86, 0xcd, 0x4f, 0x53, 0xfb,
+  0x81, 0x13, 0xee, 0x81, 0x3d, 0xc2, 0x1f, 0x33, 0x53, 0xdf, 0x7f, 0x1d,
+  0xe1, 0x49, 0xfd, 0x33, 0x35, 0xef, 0xd9, 0xa9, 0x4d, 0x9a, 0xfa, 0x35,
+  0x3d, 0xde, 0xf2, 0x3f, 0x3a, 0x8c, 0x00, 0xf0, 0xce, 0x7b, 0xf2, 0x8b,
+  0x82, 0x67, 0xe8, 0x8f, 0x8e, 0xf8, 0x35, 0x77, 0x6f, 0x49, 0xf9, 0xe5,
+  0xa7, 0x3f, 0x53, 0xf3, 0xd1, 0xf3, 0x2f, 0x21, 0xf3, 0xc7, 0x97, 0x35,
+  0xf2, 0xe6, 0xe4, 0xa7, 0xa2, 0x2b, 0xaa, 0xaf, 0xa1, 0xf9, 0xce, 0xca,
+  0x7f, 0xc7, 0xfb, 0x8a, 0xc8, 0x8d, 0xa8, 0xcf, 0xea, 0xfb, 0x92, 0xbf,
+  0x14, 0x17, 0x32, 0x5d, 0x27, 0x4f, 0xc3, 0x53, 0x88, 0xc7, 0xea, 0x6f,
+  0x64, 0xf6, 0x24, 0x2e, 0xcf, 0xe5, 0xd5, 0xaa, 0xf1, 0xeb, 0xeb, 0xbf,
+  0x13, 0xf7, 0xdb, 0xc9, 0x3f, 0x31, 0xf7, 0xd1, 0xd3, 0xff, 0x5b, 0xf1,
+  0xdd, 0xdf, 0xbf, 0x8b, 0xf3, 0xfc, 0xde, 0x7f, 0xd5, 0xf6, 0xdd, 0xcf,
+  0xff, 0xcf, 0xf1, 0xbc, 0xed, 0x4f, 0x55, 0x75, 0x81, 0xb3, 0xe3, 0xf8,
+  0x23, 0xe1, 0x3f, 0x25, 0x55, 0xfe, 0x7f, 0x66, 0xf3, 0xb6, 0xf6, 0x7f,
+  0x74, 0xfd, 0xba, 0x9d, 0x4f, 0x43, 0xa1, 0xec, 0x5d, 0xb5, 0xde, 0xf2,
+  0x2f, 0x32, 0xb6, 0xa3, 0xfa, 0x77, 0x26, 0xbf, 0x69, 0xf9, 0x4e, 0x4e,
+  0x8f, 0x8e, 0xfa, 0x15, 0xf7, 0x6f, 0x6b, 0xfa, 0xc7, 0x93, 0x3f, 0x1f,
+  0xf7, 0xb1, 0xb3, 0x23, 0xf9, 0xd7, 0x96, 0x5f, 0x2f, 0xf5, 0xa6, 0xa6,
+  0x87, 0xaa, 0x2f, 0x2e, 0xff, 0x58, 0x5b, 0xef, 0xeb, 0xfb, 0x7a, 0x18,
+  0x8f, 0x88, 0xfc, 0x48, 0x4a, 0xcf, 0xda, 0xfa, 0x7c, 0xa6, 0x50, 0x12,
+  0x10, 0x42, 0xc8, 0x12, 0x50, 0x24, 0x84, 0x40, 0x08, 0x40, 0x03, 0x14,
+  0x11, 0x20, 0x01, 0x12, 0x44, 0x00, 0x11, 0x10, 0x01, 0x31, 0x90, 0x14,
+  0x10, 0x02, 0x98, 0x04, 0xf0, 0x53, 0x18, 0x20, 0x22, 0x21, 0x02, 0x22,
+  0x40, 0x02, 0x64, 0xc0, 0x22, 0x00, 0x00, 0x10, 0x08, 0xfd, 0xbc, 0x20,
+  0x02, 0x22, 0x11, 0x22, 0x44, 0xc0, 0x24, 0x2a, 0x01, 0xaf, 0x12, 0x01,
+  0x29, 0x01, 0x89, 0x21, 0x81, 0x52, 0x84, 0x28, 0x51, 0x4a, 0x12, 0xe4,
+  0x14, 0x23, 0x88, 0x92, 0x42, 0x4e, 0x24, 0x18, 0x4e, 0x24, 0x21, 0x1a,
+  0x92, 0x44, 0x52, 0x00, 0x2c, 0x14, 0x61, 0x22, 0x11, 0xc0, 0x44, 0x80,
+  0x34, 0x44, 0x11, 0x2a, 0xa1, 0x41, 0x90, 0x41, 0x18, 0x48, 0x80, 0x84,
+  0xd1, 0x84, 0xb4, 0x48, 0x03, 0x4a, 0x42, 0xf8, 0x39, 0x72, 0xc0, 0x42,
+  0x1f, 0x41, 0x52, 0x28, 0x1f, 0xc1, 0x32, 0x4a, 0xa4, 0x0a, 0x30, 0xd2,
+  0xc1, 0xb2, 0xa8, 0x0a, 0xf0, 0x35, 0xab, 0x94, 0x1f, 0x81, 0xf2, 0x4a,
+  0x92, 0x57, 0x81, 0xab, 0x94, 0x47, 0x82, 0xaf, 0x14, 0x39, 0x34, 0x2f,
+  0x14, 0x79, 0x34, 0xd8, 0x12, 0xf9, 0x34, 0x48, 0x1c, 0xf9, 0x24, 0x4a,
+  0x1c, 0xf8, 0x24, 0x4a, 0x16, 0xf1, 0x24, 0x4a, 0x87, 0x19, 0x2f, 0xa2,
+  0x65, 0x59, 0xac, 0xe5, 0x49, 0xd2, 0xa2, 0xf5, 0x91, 0x24, 0x6d, 0x52,
+  0x1f, 0x49, 0xd2, 0x28, 0xf1, 0x91, 0x24, 0xa7, 0x26, 0x1f, 0x49, 0xf2,
+  0x4a, 0x11, 0x05, 0x00, 0x11, 0x92, 0x05, 0x00, 0xf0, 0x6d, 0x1b, 0x21,
+  0xab, 0x94, 0x53, 0xb1, 0x4a, 0x79, 0x34, 0xb8, 0x4a, 0x39, 0x24, 0x2f,
+  0x44, 0x79, 0xb4, 0x98, 0x92, 0x4f, 0x8b, 0xc4, 0x94, 0x4f, 0xaa, 0xe4,
+  0x4e, 0x02, 0x2c, 0xf4, 0x11, 0x4c, 0x81, 0x1b, 0x41, 0x83, 0x74, 0x11,
+  0x34, 0x4a, 0x15, 0xb4, 0x4a, 0x51, 0x41, 0x2f, 0x44, 0x18, 0xf1, 0x42,
+  0xb4, 0x11, 0x2b, 0x94, 0x41, 0x8f, 0x14, 0x19, 0xb4, 0x48, 0x18, 0xd4,
+  0x1a, 0x19, 0xc6, 0x91, 0x6d, 0x1a, 0x1c, 0xd8, 0xa4, 0x69, 0x11, 0x4d,
+  0x8a, 0x96, 0x41, 0x6a, 0x48, 0xb4, 0x86, 0x44, 0x6b, 0xc9, 0x24, 0x1f,
+  0x88, 0x54, 0x28, 0x1b, 0x29, 0xe0, 0xc8, 0x12, 0x88, 0x12, 0xda, 0x41,
+  0xd2, 0x48, 0x81, 0xd2, 0x48, 0x1a, 0x95, 0xaa, 0x22, 0xa9, 0x29, 0x92,
+  0x92, 0x47, 0x82, 0x29, 0x79, 0x26, 0x88, 0xf9, 0x26, 0x1a, 0x5d, 0x63,
+  0x00, 0x82, 0x9f, 0x09, 0x41, 0x00, 0x44, 0x80, 0x02, 0x93, 0x0a, 0x10,
+  0x20, 0x07, 0x00, 0x52, 0x12, 0x00, 0x48, 0x00, 0x88, 0xa3, 0x0a, 0xf6,
+  0xff, 0x1f, 0x00, 0x00, 0x25, 0x09, 0xdf, 0xe3, 0x01, 0x18, 0x14, 0x10,
+  0x04, 0x12, 0x2e, 0x48, 0x42, 0x27, 0x85, 0x12, 0x27, 0xa1, 0x84, 0x89,
+  0x04, 0x8c, 0x88, 0xc4, 0x48, 0x44, 0x23, 0x11, 0x92, 0x28, 0x80, 0x01,
+  0x2a, 0x48, 0x81, 0x92, 0x41, 0x1e, 0x24, 0x5d, 0x12, 0x40, 0x02, 0x24,
+  0x00, 0x19, 0x01, 0x1c, 0x29, 0x31, 0x22, 0xd0, 0x81, 0x78, 0x12, 0x31,
+  0x11, 0x1e, 0x82, 0x46, 0x81, 0x48, 0x81, 0x88, 0x04, 0x30, 0x12, 0x21,
+  0x8b, 0x38, 0xa0, 0x84, 0xa4, 0x9f, 0x11, 0x08, 0x43, 0x64, 0x49, 0xd0,
+  0x12, 0x31, 0x68, 0x14, 0x41, 0x80, 0x02, 0xc8, 0x12, 0x1a, 0x18, 0xe8,
+  0x21, 0x04, 0x63, 0x81, 0x64, 0x1c, 0x46, 0xc1, 0x81, 0x20, 0x54, 0x28,
+  0x42, 0x41, 0x25, 0x14, 0x98, 0xc1, 0x90, 0x95, 0x81, 0x58, 0x81, 0x2e,
+  0x45, 0x90, 0x82, 0x16, 0x18, 0x46, 0x68, 0x51, 0x21, 0x18, 0x81, 0xa2,
+  0x84, 0x2a, 0x31, 0x11, 0x10, 0xea, 0x42, 0x18, 0xc2, 0x24, 0x81, 0x15,
+  0x04, 0x11, 0x16, 0x19, 0xf4, 0x58, 0xb2, 0x14, 0x52, 0xce, 0x15, 0x90,
+  0x11, 0x8b, 0x24, 0x80, 0x24, 0xe4, 0x86, 0x61, 0x21, 0x43, 0x14, 0xb8,
+  0x38, 0x0c, 0x4e, 0x18, 0x2d, 0x42, 0x83, 0x31, 0x44, 0x2d, 0x82, 0x42,
+  0x17, 0xa2, 0x20, 0x21, 0xa1, 0x48, 0x86, 0x11, 0x62, 0x84, 0x13, 0x5c,
+  0x21, 0x59, 0x11, 0xa9, 0x41, 0x81, 0x87, 0x12, 0x30, 0x42, 0x16, 0xd8,
+  0x14, 0x61, 0xa1, 0x36, 0x05, 0x2c, 0x79, 0x11, 0xb8, 0x21, 0x59, 0x84,
+  0x2b, 0x12, 0x26, 0x11, 0x61, 0x88, 0x4c, 0x18, 0x52, 0x24, 0x10, 0xe3,
+  0xa2, 0x11, 0xe1, 0x11, 0x78, 0x14, 0xf8, 0xed, 0x44, 0x10, 0x04, 0x24,
+  0x44, 0x30, 0x11, 0xc3, 0x02, 0x21, 0xd0, 0x28, 0x29, 0x01, 0x84, 0x88,
+  0x60, 0x44, 0xe0, 0x14, 0x11, 0x81, 0x08, 0x42, 0xa4, 0x28, 0x41, 0x4c,
+  0x12, 0xe1, 0x41, 0x92, 0x14, 0x82, 0x24, 0x40, 0x62, 0x44, 0x30, 0x91,
+  0x24, 0x82, 0x00, 0x21, 0x15, 0x08, 0x80, 0x99, 0x41, 0x98, 0x10, 0xa2,
+  0x42, 0x20, 0x92, 0x18, 0x41, 0x88, 0x30, 0x48, 0x70, 0xec, 0x0f, 0x00,
+  0x82, 0x80, 0x08, 0x35, 0x01, 0x08, 0x01, 0x00, 0xff, 0x95, 0x10, 0x01,
+  0x00, 0x11, 0x40, 0x01, 0x70, 0xe7, 0x05, 0x28, 0x62, 0x31, 0x80, 0x51,
+  0x48, 0x6e, 0x63, 0x80, 0x72, 0x12, 0x18, 0xa4, 0x52, 0x14, 0x88, 0x82,
+  0x84, 0x61, 0x1b, 0x48, 0x2a, 0xc1, 0x81, 0x85, 0x06, 0x8c, 0x22, 0x81,
+  0x24, 0x4c, 0x07, 0x4a, 0x62, 0x81, 0x48, 0x73, 0x08, 0x2e, 0x14, 0x89,
+  0xa4, 0xa4, 0x10, 0x03, 0x18, 0x85, 0xc4, 0x83, 0x4a, 0x02, 0x27, 0x81,
+  0x41, 0x8a, 0x65, 0x12, 0x88, 0x40, 0x18, 0x86, 0xa4, 0x12, 0xd0, 0x68,
+  0x08, 0x8c, 0x22, 0xf1, 0x54, 0xf5, 0x50, 0x13, 0x46, 0x02, 0x1e, 0x18,
+  0x83, 0x42, 0xc4, 0x21, 0x46, 0x14, 0x44, 0x18, 0xa2, 0x51, 0x87, 0x12,
+  0x88, 0x27, 0xa8, 0x12, 0x41, 0x4b, 0x58, 0x22, 0x4c, 0x49, 0x23, 0x81,
+  0x42, 0x88, 0x24, 0x4c, 0x57, 0x88, 0x4a, 0x22, 0x81, 0x34, 0x87, 0xc0,
+  0x16, 0x83, 0x82, 0x3a, 0x42, 0x11, 0x80, 0x51, 0x48, 0x3c, 0xa8, 0x24,
+  0x50, 0x83, 0x41, 0x8e, 0x41, 0x8b, 0x12, 0x88, 0x8c, 0x02, 0x61, 0x2e,
+  0x41, 0x18, 0xc0, 0x86, 0x84, 0x4a, 0xb2, 0x18, 0xf4, 0x97, 0x45, 0x00,
+  0x20, 0x08, 0x88, 0x00, 0x80, 0x08, 0xb7, 0x00, 0x00, 0xf0, 0xfd, 0x00,
+  0x11, 0x00, 0x14, 0x00, 0x14, 0x00, 0x2f, 0xcb, 0x03, 0x00, 0x1c, 0x41,
+  0x08, 0x84, 0x70, 0x11, 0x18, 0x32, 0x11, 0x00, 0x88, 0x11, 0xe0, 0x81,
+  0xc4, 0x12, 0x12, 0x4a, 0x22, 0x81, 0x21, 0x21, 0x04, 0x42, 0x80, 0xd2,
+  0x82, 0x85, 0x82, 0x21, 0xa1, 0x12, 0x10, 0x84, 0x12, 0x02, 0x21, 0x60,
+  0x24, 0x12, 0x80, 0x84, 0x88, 0x44, 0x21, 0x49, 0x21, 0x08, 0x40, 0xa2,
+  0x48, 0x20, 0x01, 0x43, 0x28, 0x04, 0x9e, 0xa1, 0xb0, 0x11, 0x82, 0x92,
+  0x22, 0x49, 0xd3, 0x21, 0xe2, 0x24, 0xc2, 0x71, 0x21, 0x2c, 0x11, 0x78,
+  0x32, 0x83, 0x53, 0x12, 0xab, 0x14, 0x25, 0x11, 0x21, 0x52, 0x94, 0x86,
+  0xc2, 0x61, 0x68, 0x14, 0x13, 0x12, 0x41, 0x11, 0xc2, 0x41, 0x26, 0xc1,
+  0x42, 0x2a, 0x64, 0x22, 0x86, 0x22, 0xb5, 0x72, 0x38, 0x55, 0x49, 0x61,
+  0x11, 0x1e, 0x21, 0x86, 0xa2, 0x21, 0xc2, 0x13, 0xf1, 0x82, 0x11, 0x26,
+  0xa2, 0x81, 0x24, 0x42, 0x16, 0xc2, 0x11, 0xb0, 0x42, 0x19, 0x18, 0xa4,
+  0x82, 0x2f, 0x64, 0xe8, 0x48, 0x84, 0x21, 0x2a, 0xf2, 0x28, 0xdd, 0x80,
+  0x21, 0x82, 0x12, 0x88, 0xb2, 0x48, 0x32, 0x31, 0x12, 0x21, 0xbd, 0x12,
+  0x1d, 0x22, 0x2c, 0xc1, 0x81, 0xa9, 0x51, 0x12, 0x83, 0xc5, 0x32, 0x18,
+  0xaa, 0x74, 0x52, 0xa1, 0x52, 0x18, 0x2e, 0x41, 0x40, 0x03, 0x48, 0x99,
+  0x21, 0x32, 0x12, 0x22, 0x16, 0x82, 0xb1, 0x16, 0xc6, 0x62, 0x18, 0x1c,
+  0xb1, 0x11, 0x62, 0x28, 0x5a, 0x92, 0x12, 0x13, 0xb1, 0x42, 0xa9, 0x82,
+  0x23, 0x48, 0x22, 0x2c, 0x91, 0x12, 0x24, 0x4a, 0x41, 0x28, 0x04, 0x2b,
+  0x14, 0x69, 0x04, 0x2a, 0x2c, 0xf2, 0x52, 0x5e, 0x60, 0x12, 0xd0, 0x12,
+  0xe1, 0x42, 0x41, 0x43, 0x62, 0x24, 0x85, 0x21, 0x01, 0x18, 0x22, 0xc0,
+  0x41, 0x10, 0x01, 0x45, 0x09, 0x28, 0x40, 0x01, 0x14, 0x48, 0xc0, 0x23,
+  0x4a, 0x22, 0xa4, 0xf2, 0x0b, 0xf0, 0x9a, 0x48, 0x82, 0x16, 0x45, 0x44,
+  0x02, 0x00, 0x4a, 0x08, 0x11, 0xa0, 0x14, 0x11, 0x18, 0x11, 0x1c, 0x08,
+  0x88, 0x24, 0x43, 0xa8, 0x82, 0x43, 0x88, 0xe8, 0x48, 0x01, 0xf0, 0x2d,
+  0x2f, 0x00, 0x42, 0x00, 0x42, 0x00, 0x22, 0x23, 0x04, 0x10, 0x91, 0x42,
+  0x48, 0x40, 0x43, 0x04, 0x1c, 0x1c, 0x32, 0x11, 0x81, 0x18, 0x1b, 0x1a,
+  0x28, 0x88, 0x40, 0x0c, 0x80, 0x02, 0x20, 0x21, 0x41, 0x81, 0x81, 0x81,
+  0x01, 0x28, 0x44, 0x25, 0x21, 0x99, 0x88, 0xd1, 0x82, 0x16, 0x42, 0x81,
+  0x32, 0x24, 0x46, 0x84, 0x08, 0x24, 0x43, 0x01, 0x12, 0x44, 0xef, 0x8e,
+  0x05, 0x12, 0x46, 0x18, 0xf8, 0x14, 0x22, 0x12, 0x81, 0x81, 0x10, 0x01,
+  0x90, 0x24, 0x19, 0x02, 0x84, 0x2a, 0x41, 0x08, 0x45, 0xa8, 0x12, 0x29,
+  0x04, 0xd0, 0x22, 0x81, 0x28, 0x18, 0x03, 0x41, 0x60, 0x11, 0x28, 0x24,
+  0x1c, 0x42, 0x48, 0x84, 0x04, 0x41, 0x46, 0x82, 0x08, 0x60, 0x44, 0x12,
+  0x43, 0xc9, 0x22, 0x80, 0x06, 0x48, 0xa3, 0x08, 0x43, 0x01, 0x24, 0x50,
+  0x84, 0x4a, 0xf2, 0xc3, 0xaf, 0x00, 0x24, 0x28, 0x10, 0x81, 0x11, 0x01,
+  0x00, 0x12, 0x00, 0x80, 0x91, 0x44, 0x40, 0x81, 0xb6, 0x0f, 0xf0, 0xff,
+  0x6e, 0x48, 0x42, 0x2a, 0x94, 0x42, 0x28, 0x24, 0x42, 0x00, 0x1c, 0xc2,
+  0x42, 0x10, 0x91, 0x81, 0x21, 0x20, 0x48, 0x42, 0x01, 0x40, 0x81, 0x08,
+  0x8a, 0x01, 0x00, 0x28, 0x00, 0x00, 0xf0, 0x6c, 0x52, 0x00, 0x60, 0x82,
+  0x36, 0xa6, 0x14, 0x81, 0x14, 0x2c, 0x62, 0x14, 0x00, 0x2c, 0x02, 0x30,
+  0x18, 0x2e, 0x44, 0x65, 0x48, 0xf1, 0x11, 0xc8, 0x2d, 0x12, 0x46, 0x11,
+  0x08, 0x6e, 0x81, 0x2b, 0x82, 0x10, 0xd2, 0x84, 0x96, 0x46, 0x90, 0x21,
+  0x62, 0xb0, 0x22, 0x61, 0x13, 0x15, 0x24, 0x81, 0x81, 0x69, 0x24, 0x2a,
+  0x48, 0x02, 0x5c, 0xc1, 0x18, 0x8b, 0x18, 0x1c, 0x32, 0x82, 0x25, 0x21,
+  0xe8, 0x42, 0xd4, 0x86, 0x04, 0x22, 0x10, 0x04, 0x43, 0xe1, 0x42, 0xf4,
+  0xec, 0xb7, 0x80, 0x01, 0x21, 0x40, 0x21, 0x11, 0x08, 0x00, 0x18, 0x11,
+  0x46, 0x81, 0x04, 0x13, 0x01, 0x40, 0x24, 0x82, 0x01, 0x18, 0x00, 0x48,
+  0x46, 0x01, 0x20, 0x22, 0x11, 0x02, 0x00, 0x2c, 0x04, 0x14, 0x15, 0x14,
+  0x02, 0x49, 0x18, 0xb1, 0x42, 0x28, 0x48, 0x21, 0x88, 0x81, 0x84, 0x01,
+  0x88, 0x82, 0x4c, 0x01, 0x29, 0x01, 0x81, 0xf0, 0x4c, 0x2d, 0xc0, 0x21,
+  0x20, 0x02, 0x10, 0x22, 0xb4, 0x42, 0x61, 0x22, 0x16, 0x08, 0x00, 0x10,
+  0x91, 0x22, 0x80, 0x05, 0x80, 0x94, 0x12, 0x42, 0x42, 0x20, 0x02, 0x82,
+  0x48, 0x20, 0x02, 0x42, 0x00, 0x40, 0x88, 0x01, 0x21, 0x21, 0x2c, 0x01,
+  0x30, 0x11, 0x4d, 0x81, 0x86, 0x41, 0x84, 0x49, 0x22, 0x0a, 0x18, 0x20,
+  0x04, 0xa0, 0x21, 0x12, 0x9f, 0x2b, 0x0e, 0x00, 0x49, 0x01, 0x42, 0x80,
+  0x03, 0x42, 0xa0, 0x34, 0x29, 0x84, 0x91, 0x12, 0x42, 0x12, 0x46, 0x11,
+  0x52, 0x18, 0x00, 0x10, 0x08, 0x20, 0x91, 0x48, 0x00, 0x80, 0x04, 0x28,
+  0x22, 0x00, 0x46, 0x01, 0x00, 0x80, 0x22, 0x08, 0x20, 0x92, 0x12, 0x14,
+  0x80, 0x88, 0x81, 0x18, 0x92, 0x28, 0x21, 0x80, 0x91, 0xc8, 0xf0, 0xd8,
+  0x31, 0xc0, 0x41, 0x21, 0x14, 0x15, 0x08, 0x84, 0x11, 0x81, 0x10, 0x88,
+  0x02, 0x43, 0x02, 0x00, 0x12, 0x8b, 0x41, 0x4a, 0x02, 0x28, 0x14, 0x22,
+  0x11, 0x28, 0x11, 0x90, 0x52, 0x24, 0xc0, 0x12, 0x12, 0x20, 0x11, 0x04,
+  0x10, 0x42, 0x02, 0x42, 0x12, 0x15, 0x02, 0x48, 0x11, 0x42, 0x49, 0x48,
+  0x01, 0x29, 0x04, 0x48, 0x20, 0x21, 0xa8, 0x28, 0x00, 0x5f, 0xa7, 0x09,
+  0x00, 0x1a, 0xa4, 0x14, 0x00, 0x18, 0x48, 0x11, 0x00, 0x11, 0x10, 0x48,
+  0x14, 0x81, 0x22, 0x02, 0x22, 0x44, 0x40, 0x21, 0x41, 0x47, 0x92, 0x21,
+  0x22, 0x00, 0x00, 0x90, 0x61, 0x19, 0x44, 0x02, 0x1a, 0x42, 0x88, 0x02,
+  0xc0, 0x24, 0x82, 0x26, 0x88, 0x42, 0x04, 0x47, 0x84, 0x22, 0x0b, 0xf1,
+  0xdd, 0x88, 0x02, 0x00, 0x28, 0x7f, 0xf7, 0x06, 0x82, 0x00, 0x80, 0x01,
+  0x28, 0x21, 0x62, 0x29, 0x01, 0x52, 0x10, 0x42, 0x81, 0x45, 0x02, 0x60,
+  0x21, 0x42, 0x20, 0x01, 0x20, 0x01, 0x82, 0x42, 0x90, 0x61, 0x10, 0x14,
+  0x02, 0x2e, 0x41, 0x10, 0x41, 0x01, 0x11, 0x90, 0x52, 0x30, 0x12, 0x80,
+  0x21, 0x18, 0x02, 0x49, 0x41, 0x12, 0x84, 0x28, 0x24, 0x34, 0x12, 0x22,
+  0x54, 0x3f, 0x1d, 0x04, 0x1a, 0x12, 0xa8, 0x42, 0xd0, 0x21, 0x86, 0x05,
+  0x18, 0x00, 0x1c, 0x14, 0x3a, 0x41, 0x18, 0x42, 0x25, 0x08, 0x14, 0x00,
+  0x00, 0x48, 0x80, 0x04, 0x46, 0x01, 0x44, 0x18, 0x60, 0x12, 0x14, 0x00,
+  0x29, 0x01, 0x80, 0x64, 0x21, 0x41, 0x22, 0x80, 0x42, 0x01, 0x23, 0xca,
+  0x21, 0x00, 0x2a, 0x08, 0x1e, 0x88, 0x40, 0x24, 0x02, 0x29, 0x04, 0x7f,
+  0xc5, 0x0a, 0xc4, 0x80, 0x84, 0x11, 0x04, 0x41, 0x10, 0x84, 0x04, 0x44,
+  0x00, 0x00, 0x1c, 0x04, 0x00, 0x84, 0x10, 0x01, 0x94, 0x10, 0x04, 0x83,
+  0x02, 0x81, 0x60, 0x16, 0x81, 0x00, 0x80, 0x24, 0x02, 0x22, 0x20, 0x02,
+  0x00, 0x44, 0x80, 0x09, 0x81, 0x80, 0x02, 0x23, 0x48, 0x28, 0x02, 0xd0,
+  0xd9, 0x0d, 0x20, 0x44, 0x11, 0x02, 0x42, 0x42, 0x84, 0x11, 0x42, 0x11,
+  0x83, 0x11, 0x11, 0x28, 0x32, 0x49, 0x00, 0x24, 0x12, 0x14, 0x80, 0x12,
+  0xa2, 0x42, 0x80, 0x9a, 0x12, 0x1c, 0x02, 0x44, 0x40, 0x02, 0x15, 0x22,
+  0x51, 0x24, 0x26, 0x11, 0x24, 0x83, 0x08, 0x92, 0x24, 0x44, 0x80, 0x04,
+  0x68, 0x20, 0x84, 0x88, 0x04, 0x12, 0x48, 0x44, 0x88, 0x21, 0x57, 0xd1,
+  0x60, 0x81, 0x18, 0x48, 0x83, 0x94, 0x21, 0x81, 0x11, 0x3d, 0x06, 0xf2,
+  0xff, 0xff, 0xff, 0xdd, 0x60, 0x42, 0x85, 0x71, 0x21, 0x04, 0x28, 0x11,
+  0x25, 0x44, 0xc1, 0x12, 0x86, 0x81, 0x08, 0x24, 0x12, 0x24, 0x12, 0x14,
+  0x18, 0x22, 0x15, 0x38, 0x21, 0x48, 0x00, 0x46, 0x08, 0x46, 0x88, 0x22,
+  0x06, 0xd4, 0x24, 0x28, 0xa2, 0x00, 0x82, 0x80, 0x2a, 0x88, 0x18, 0x82,
+  0xf2, 0xf5, 0x11, 0x60, 0x16, 0x83, 0xd8, 0x31, 0xc1, 0x19, 0x1d, 0x46,
+  0xab, 0x41, 0x76, 0x31, 0x52, 0x48, 0x8c, 0xb5, 0x51, 0x44, 0xf1, 0x14,
+  0x21, 0x18, 0x48, 0xbd, 0x69, 0x1e, 0x43, 0xaf, 0x14, 0xd6, 0x28, 0x82,
+  0x21, 0x12, 0xe2, 0x54, 0x14, 0x11, 0x34, 0x82, 0x67, 0x22, 0x8a, 0xe1,
+  0x86, 0x02, 0x2e, 0x54, 0x19, 0x01, 0x22, 0x1d, 0x21, 0x12, 0x4c, 0xb4,
+  0x12, 0x71, 0x41, 0xc2, 0x12, 0x20, 0xf1, 0x52, 0x51, 0x82, 0x46, 0x64,
+  0x52, 0xc6, 0x68, 0x48, 0x87, 0x1d, 0x9a, 0xb2, 0x38, 0xa8, 0x8a, 0x2b,
+  0xca, 0x8d, 0xa2, 0x21, 0x42, 0xe0, 0x18, 0x0c, 0x1f, 0x6e, 0x05, 0x13,
+  0x31, 0x12, 0x1a, 0x12, 0xe8, 0x12, 0x22, 0xd4, 0x41, 0xc3, 0x48, 0x1b,
+  0x26, 0xa1, 0x3c, 0x32, 0x1a, 0x11, 0x16, 0x78, 0x41, 0x02, 0x42, 0x16,
+  0xd8, 0x51, 0x84, 0xf2, 0x46, 0x28, 0x14, 0x99, 0x53, 0x12, 0x1f, 0x22,
+  0xa6, 0x21, 0x1f, 0x14, 0x24, 0xc5, 0x41, 0x1a, 0x41, 0x9b, 0x22, 0x4e,
+  0x64, 0x5a, 0x53, 0x24, 0x21, 0x14, 0x1f, 0x12, 0x42, 0xb4, 0x32, 0x52,
+  0x42, 0x38, 0x4f, 0x8a, 0x82, 0xd2, 0x1b, 0xc4, 0x22, 0x1b, 0x71, 0x34,
+  0x4c, 0xc8, 0x82, 0x49, 0x04, 0x4b, 0x15, 0xa2, 0x43, 0x6c, 0x82, 0x4b,
+  0x98, 0x83, 0x17, 0xf6, 0x2d, 0xb5, 0xc0, 0x34, 0x42, 0x43, 0xa2, 0x45,
+  0x52, 0x84, 0x2c, 0x94, 0x18, 0x74, 0x52, 0x22, 0x4e, 0x58, 0x46, 0x12,
+  0xda, 0x14, 0xa2, 0x15, 0x1f, 0x42, 0x92, 0x11, 0x22, 0x12, 0x1c, 0x34,
+  0x11, 0x22, 0x4a, 0x61, 0x94, 0x1d, 0x11, 0x89, 0x92, 0xa2, 0x45, 0x12,
+  0xa2, 0x24, 0x12, 0x26, 0x52, 0x83, 0x48, 0x1d, 0x71, 0x3d, 0x2a, 0x90,
+  0x28, 0xf0, 0xc1, 0x68, 0x26, 0xc2, 0x82, 0x26, 0xa2, 0x33, 0x13, 0xd8,
+  0x12, 0xb8, 0x25, 0x98, 0x52, 0xb0, 0xc2, 0x43, 0x12, 0x08, 0x3a, 0xef,
+  0x28, 0xac, 0x23, 0x28, 0x2a, 0xf3, 0xe6, 0x26, 0xd0, 0x41, 0x82, 0xd1,
+  0x41, 0x12, 0xd8, 0x41, 0x92, 0x1a, 0x1d, 0x64, 0xa9, 0xd1, 0x41, 0x92,
+  0x1a, 0x19, 0x92, 0x1a, 0x11, 0xa9, 0x11, 0x94, 0x1a, 0x43, 0x92, 0x12,
+  0x47, 0x82, 0x29, 0xf1, 0x24, 0x48, 0x18, 0x4f, 0x82, 0x04, 0x4f, 0xa2,
+  0x04, 0x4f, 0xa2, 0x24, 0xe1, 0xa2, 0x24, 0xc1, 0x4a, 0x12, 0xac, 0x24,
+  0xe1, 0x32, 0x24, 0x41, 0x22, 0x71, 0x28, 0x22, 0x31, 0x6a, 0x12, 0xab,
+  0x14, 0xf0, 0x4a, 0x11, 0xb0, 0x6a, 0x21, 0xb8, 0x4a, 0x01, 0xab, 0x14,
+  0xb0, 0x4a, 0x63, 0x88, 0x2b, 0x14, 0x8c, 0x84, 0xc1, 0x48, 0xf0, 0x6d,
+  0x19, 0x14, 0x5f, 0x53, 0xf3, 0x25, 0x15, 0x1f, 0xf2, 0x72, 0x2f, 0xfd,
+  0x6d, 0x2f, 0xff, 0xf3, 0xf3, 0x31, 0x3b, 0xff, 0xf7, 0xf3, 0x7d, 0x2f,
+  0xef, 0xf7, 0xf1, 0x7b, 0x2b, 0xbf, 0xb3, 0xf3, 0x53, 0x5b, 0xef, 0xf1,
+  0xf1, 0x1f, 0x1f, 0xef, 0xf3, 0xf3, 0x7f, 0x3b, 0xaf, 0xe1, 0xf3, 0x32,
+  0x3c, 0xef, 0xc1, 0xf3, 0x79, 0x79, 0x8f, 0xc4, 0xe7, 0xc6, 0xf6, 0x6c,
+  0x2f, 0xaf, 0xa6, 0xf6, 0x4e, 0x6e, 0x6f, 0xf6, 0xf7, 0x7a, 0xb8, 0xff,
+  0xf6, 0xf7, 0x5a, 0x7a, 0x7f, 0x76, 0xf7, 0x5a, 0x5a, 0xef, 0xe5, 0xb5,
+  0x52, 0xf1, 0x32, 0x12, 0x2f, 0x25, 0xf5, 0x16, 0x16, 0xbf, 0xa3, 0xf1,
+  0x1f, 0x1f, 0xaf, 0xa5, 0xf5, 0xdf, 0xd7, 0x3e, 0x7a, 0x2f, 0xaf, 0xff,
+  0xd8, 0xda, 0x7f, 0x77, 0xf7, 0x33, 0x5b, 0x3f, 0xbd, 0xfd, 0xb9, 0xdb,
+  0x2f, 0x25, 0xfd, 0x5a, 0x5a, 0xef, 0xe7, 0xf7, 0x78, 0x7a, 0x6f, 0x6d,
+  0xff, 0x92, 0xda, 0xef, 0xef, 0xff, 0xda, 0xc8, 0xcf, 0xc7, 0xe5, 0x8d,
+  0xfc, 0x6c, 0x2c, 0x8f, 0x5c, 0x47, 0xf1, 0x31, 0x21, 0x1b, 0x73, 0x9f,
+  0xf3, 0xf3, 0x2f, 0x2c, 0x9f, 0x36, 0xf2, 0x1b, 0x3a, 0xff, 0xf6, 0xf6,
+  0x1f, 0x3e, 0xbf, 0x37, 0xf3, 0x7b, 0x39, 0xff, 0x77, 0xf3, 0x5b, 0x78,
+  0xbf, 0xf6, 0xf7, 0x1b, 0x19, 0xbf, 0x34, 0xf1, 0x7f, 0x1d, 0xff, 0x36,
+  0xf3, 0x7a, 0x7d, 0x3f, 0xd2, 0xf3, 0x3e, 0x3c, 0x5f, 0x76, 0xf7, 0x23,
+  0x75, 0x1f, 0xd6, 0xf6, 0x6e, 0x5f, 0x5f, 0x76, 0xf6, 0x22, 0xe2, 0x1f,
+  0xb7, 0xf7, 0x7e, 0xde, 0x3f, 0x37, 0xf7, 0x32, 0x72, 0xdf, 0xf7, 0xf7,
+  0x1b, 0x5b, 0xcf, 0xe5, 0xf4, 0x72, 0x73, 0xbf, 0xb3, 0xf2, 0x13, 0x12,
+  0x5f, 0xf7, 0xf6, 0x32, 0x32, 0x5f, 0x73, 0xf2, 0x7a, 0x3a, 0xff, 0x7f,
+  0xfe, 0x72, 0x7a, 0x2f, 0xad, 0xff, 0xca, 0xba, 0xff, 0xd7, 0xf7, 0x63,
+  0x7f, 0x3f, 0xbf, 0xff, 0xeb, 0xfb, 0xaf, 0x85, 0xfd, 0xc2, 0xb2, 0x6f,
+  0x67, 0xf7, 0xea, 0xba, 0xef, 0xcf, 0xff, 0xc2, 0xda, 0xef, 0xcf, 0xff,
+  0xf2, 0xf2, 0x6f, 0x43, 0xe5, 0x8f, 0xfd, 0x7e, 0x7e, 0x1f, 0xae, 0x0b,
+  0x1f, 0x13, 0xb2, 0x11, 0xf5, 0x35, 0x23, 0xb5, 0xfc, 0x29, 0x63, 0xbf,
+  0x81, 0xf7, 0x35, 0x37, 0xbf, 0x85, 0xf3, 0x69, 0x23, 0xaf, 0x81, 0xf1,
+  0x6b, 0x67, 0xbf, 0x81, 0xf3, 0x43, 0x73, 0xaf, 0x91, 0xf1, 0x4b, 0x53,
+  0xff, 0x93, 0xf5, 0x6b, 0x7f, 0xbf, 0x81, 0xf1, 0x2f, 0x32, 0x2f, 0x81,
+  0xf1, 0x67, 0x75, 0x2b, 0x51, 0xdf, 0x16, 0xe7, 0xa2, 0xf1, 0x65, 0x67,
+  0x3d, 0xc2, 0x8f, 0x36, 0xf6, 0x32, 0x18, 0x5f, 0x76, 0xf6, 0x12, 0x72,
+  0xdf, 0xf6, 0xf6, 0x12, 0x53, 0x4f, 0x65, 0xf4, 0x1a, 0x38, 0x7e, 0x6b,
+  0x2f, 0x35, 0xf5, 0x14, 0x46, 0x3f, 0x23, 0x73, 0x15, 0xf7, 0x5a, 0x32,
+  0x7f, 0xdf, 0xee, 0x23, 0xb3, 0x7a, 0xe7, 0x2c, 0xfb, 0x7f, 0x7d, 0x3f,
+  0x72, 0xf3, 0xdb, 0xf1, 0x1f, 0x38, 0xfb, 0x5a, 0x58, 0x2f, 0x2c, 0xf9,
+  0xd6, 0xd4, 0x6e, 0xb2, 0xef, 0xcf, 0xff, 0x8a, 0x92, 0x6f, 0xcf, 0xbf,
+  0xe2, 0xfe, 0x36, 0xf4, 0x8b, 0x64, 0x4f, 0xc2, 0xf3, 0x2f, 0xbd, 0x14,
+  0x5f, 0x53, 0xa2, 0x13, 0x5f, 0xb3, 0x73, 0x2a, 0xfc, 0x75, 0x77, 0xaf,
+  0xa5, 0xf5, 0x61, 0x7b, 0xef, 0xe5, 0xf5, 0x75, 0x67, 0xaf, 0x93, 0xf5,
+  0x71, 0x67, 0xaf, 0x81, 0xf1, 0x45, 0x6b, 0xbf, 0x91, 0xf1, 0x45, 0x47,
+  0xff, 0x91, 0xf5, 0x69, 0x67, 0xaf, 0x91, 0xf3, 0x2d, 0x23, 0x6f, 0xc1,
+  0xf3, 0x6b, 0x69, 0x2f, 0x11, 0xf3, 0x6c, 0x71, 0x47, 0xc4, 0x9f, 0xb6,
+  0x96, 0x23, 0xdf, 0x76, 0xf7, 0xd6, 0x1c, 0xbf, 0xb6, 0xb7, 0x32, 0xf3,
+  0x65, 0x77, 0xaf, 0x91, 0xf1, 0x64, 0x66, 0xaf, 0x87, 0xf3, 0x23, 0x2b,
+  0x3b, 0x55, 0xdf, 0x72, 0xf6, 0x33, 0x31, 0xdf, 0xf2, 0xf2, 0x3a, 0x32,
+  0x7f, 0xfe, 0xee, 0x23, 0xf7, 0x7a, 0x72, 0x8d, 0x2a, 0x7f, 0x57, 0xf7,
+  0x21, 0x62, 0xaf, 0x3f, 0xff, 0x89, 0x6b, 0x2b, 0x55, 0xae, 0x82, 0xef,
+  0xed, 0xdd, 0xa8, 0xf8, 0xf6, 0xf4, 0x8f, 0x28, 0xf4, 0xf6, 0xfc, 0x8f,
+  0x8f, 0xf6, 0x36, 0x94, 0x8b, 0xcf, 0x4f, 0xc6, 0xf3, 0xfa, 0x48, 0x80,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x48, 0xd0, 0x08, 0x01,
+  0x29, 0x0a, 0x90, 0x22, 0x40, 0x01, 0x00, 0x22, 0x20, 0x02, 0x14, 0x40,
+  0x1d, 0x00, 0xb0, 0x28, 0x82, 0x00, 0x5f, 0x2b, 0x09, 0x82, 0x00, 0x12,
+  0x80, 0x04, 0x87, 0x05, 0x80, 0x00, 0x40, 0x91, 0x41, 0x00, 0x21, 0x80,
+  0x11, 0x1b, 0x00, 0x31, 0x00, 0x20, 0x44, 0x3f, 0x00, 0xf0, 0x5a, 0x02,
+  0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x80, 0x08, 0x28, 0x14, 0x9f, 0x1c,
+  0x0c, 0x2c, 0xf4, 0x11, 0x24, 0xa5, 0xf2, 0x11, 0x24, 0x87, 0x14, 0x1f,
+  0x41, 0x32, 0x4a, 0x1d, 0x64, 0xab, 0x14, 0x1f, 0x41, 0xb2, 0x4a, 0xb9,
+  0x11, 0xf2, 0x4a, 0x91, 0x51, 0xab, 0x94, 0x43, 0xf3, 0x4a, 0xb1, 0x43,
+  0xf2, 0x42, 0xb1, 0x4f, 0x82, 0xd4, 0x12, 0xfb, 0x24, 0x48, 0x4e, 0x91,
+  0x4f, 0xa2, 0xc4, 0x81, 0x4f, 0xa2, 0xe4, 0x15, 0xf2, 0x26, 0x4a, 0x9e,
+  0x21, 0x2e, 0x4a, 0x96, 0xc5, 0x5a, 0xde, 0x24, 0x4d, 0x4a, 0x1f, 0x49,
+  0xc2, 0x43, 0x1f, 0x49, 0x52, 0x2a, 0x1f, 0x49, 0x32, 0x48, 0x1f, 0x49,
+  0x72, 0x4e, 0xf2, 0x81, 0x24, 0xaf, 0x14, 0xf1, 0x05, 0x00, 0xf2, 0x6a,
+  0xb9, 0x81, 0xb2, 0x4a, 0x39, 0x15, 0xaf, 0x54, 0x39, 0x24, 0xab, 0x94,
+  0x43, 0xba, 0x42, 0x79, 0x24, 0x98, 0x92, 0x4f, 0x83, 0x84, 0xf9, 0xa4,
+  0x4a, 0x4f, 0x72, 0x06, 0x48, 0x1d, 0x68, 0x81, 0x1a, 0x36, 0x48, 0x19,
+  0x32, 0x4a, 0x19, 0xb2, 0x4a, 0x91, 0x21, 0xaf, 0x44, 0x88, 0xd2, 0x4a,
+  0x1b, 0xb1, 0x4a, 0x0b, 0xaf, 0x14, 0x08, 0x2d, 0x91, 0x90, 0x92, 0x2b,
+  0x42, 0x1c, 0xf9, 0x22, 0x12, 0x1c, 0xa8, 0x58, 0x16, 0xc1, 0x82, 0x92,
+  0x2e, 0x42, 0x92, 0x3c, 0xe4, 0x49, 0x42, 0x63, 0xc9, 0x48, 0x1f, 0xc9,
+  0x46, 0xa2, 0x49, 0x42, 0x92, 0x2b, 0x84, 0x4c, 0xa2, 0x14, 0x4c, 0xf2,
+  0x42, 0x14, 0x11, 0x2f, 0x46, 0x01, 0x2b, 0xa4, 0x43, 0xb2, 0x42, 0x0b,
+  0x2b, 0x14, 0x43, 0x92, 0x92, 0x6b, 0x42, 0x88, 0x2f, 0x22, 0xf5, 0x2f,
+  0x36, 0x3d, 0x09, 0x40, 0x44, 0x00, 0x00, 0x24, 0x08, 0x00, 0x01, 0x5b,
+  0x09, 0x12, 0x40, 0x60, 0x09, 0x02, 0x63, 0x0b, 0xf1, 0xff, 0x10, 0xf0,
+  0xd5, 0x66, 0x00, 0x21, 0x00, 0x49, 0x04, 0x90, 0x48, 0x44, 0x00, 0xa0,
+  0x81, 0x14, 0x41, 0x11, 0x4c, 0xa4, 0x12, 0x44, 0x68, 0x4c, 0x12, 0xc1,
+  0x28, 0xa8, 0x44, 0x1c, 0x02, 0x00, 0xc0, 0x64, 0x00, 0x60, 0x54, 0x58,
+  0x22, 0x86, 0x11, 0x31, 0x24, 0x42, 0x00, 0x60, 0x44, 0x52, 0x21, 0x82,
+  0x82, 0x41, 0x00, 0x10, 0x04, 0x81, 0x20, 0x02, 0x4f, 0xa7, 0x4c, 0x01,
+  0xa6, 0x41, 0x78, 0x21, 0xc2, 0x28, 0x34, 0x8c, 0x64, 0x33, 0x16, 0x78,
+  0x28, 0x63, 0x85, 0x26, 0xc1, 0x48, 0x85, 0x42, 0xe8, 0x24, 0x62, 0x81,
+  0x2c, 0x24, 0x45, 0x32, 0x19, 0x5a, 0xa2, 0x41, 0x42, 0x11, 0x42, 0x2d,
+  0x11, 0x4b, 0x24, 0x39, 0xa1, 0x24, 0x39, 0x81, 0xb4, 0x42, 0x21, 0x94,
+  0x12, 0x28, 0x25, 0x21, 0x92, 0x92, 0x48, 0x1d, 0x12, 0x46, 0x64, 0x34,
+  0x1a, 0x4c, 0x23, 0x68, 0x14, 0x1a, 0x64, 0x74, 0x8a, 0x24, 0xb4, 0x14,
+  0x48, 0xee, 0x89, 0x04, 0x6b, 0x48, 0x42, 0x16, 0x01, 0x9f, 0x5a, 0x43,
+  0x41, 0x62, 0x16, 0x84, 0x14, 0xcc, 0x44, 0xc3, 0x48, 0x8f, 0x34, 0x63,
+  0xc1, 0x26, 0x73, 0x54, 0x68, 0x12, 0x7e, 0x88, 0x24, 0x45, 0xc8, 0x22,
+  0x56, 0xec, 0x22, 0x31, 0x14, 0x24, 0x16, 0xa7, 0x25, 0x16, 0xa8, 0x2d,
+  0x51, 0xce, 0x21, 0x29, 0x81, 0x36, 0x13, 0x42, 0x39, 0x35, 0x41, 0x29,
+  0x25, 0xd4, 0x1a, 0xa5, 0x12, 0x27, 0x16, 0x86, 0x91, 0x12, 0x4c, 0xe6,
+  0x24, 0x01, 0x34, 0x48, 0x46, 0xb3, 0x84, 0x11, 0xa1, 0x4b, 0x4f, 0x34,
+  0x88, 0x0c, 0x92, 0xc5, 0xb2, 0x9c, 0x04, 0x27, 0xa8, 0x48, 0x32, 0x12,
+  0x9f, 0xb4, 0x0e, 0x00, 0x80, 0x32, 0x22, 0x00, 0x00, 0x84, 0x00, 0x50,
+  0x81, 0x90, 0x41, 0x80, 0x24, 0xa4, 0x42, 0x89, 0x12, 0xa1, 0x24, 0x00,
+  0x40, 0x11, 0x04, 0x22, 0x4c, 0x02, 0x00, 0x44, 0x48, 0x20, 0x32, 0x81,
+  0x10, 0x31, 0x44, 0x48, 0x98, 0x44, 0x46, 0x82, 0x04, 0x40, 0x84, 0x44,
+  0x04, 0x00, 0x46, 0x04, 0x00, 0x4f, 0x87, 0x0b, 0x22, 0x89, 0x0c, 0xf0,
+  0xff, 0xee, 0x20, 0x04, 0x00, 0x14, 0x40, 0x24, 0xc8, 0x85, 0xb0, 0x48,
+  0x02, 0x4a, 0x12, 0xc1, 0x24, 0x2a, 0x04, 0xb0, 0x48, 0x02, 0x28, 0xa4,
+  0x42, 0xc8, 0x4e, 0x24, 0x18, 0x00, 0x44, 0x90, 0x21, 0xe0, 0x88, 0x82,
+  0x08, 0x20, 0x88, 0x11, 0x85, 0x58, 0x84, 0x00, 0x89, 0x09, 0x25, 0x04,
+  0x88, 0x8c, 0xf4, 0x37, 0xed, 0x00, 0x49, 0x02, 0x12, 0x18, 0x80, 0x03,
+  0x25, 0xb5, 0x85, 0x14, 0xc8, 0x21, 0x23, 0x61, 0x2c, 0x4c, 0x08, 0x2a,
+  0x91, 0x44, 0x2e, 0x18, 0x1f, 0x88, 0x34, 0x14, 0x40, 0xdc, 0x84, 0x14,
+  0x48, 0xf2, 0x24, 0x49, 0xd0, 0x25, 0xa8, 0x24, 0x52, 0x4a, 0x02, 0x25,
+  0x62, 0x19, 0xf0, 0x84, 0x11, 0x9c, 0x38, 0x82, 0x49, 0x24, 0x01, 0x15,
+  0x24, 0xb1, 0x29, 0xbc, 0x82, 0x01, 0x23, 0x34, 0x88, 0x49, 0x94, 0xc1,
+  0x82, 0x49, 0x0e, 0x56, 0xa4, 0x12, 0x45, 0x49, 0xa8, 0x28, 0xbe, 0x2d,
+  0x00, 0x44, 0x10, 0x04, 0x22, 0x12, 0x10, 0x71, 0x84, 0x11, 0x18, 0x11,
+  0x42, 0x92, 0x84, 0x90, 0x14, 0xc2, 0x26, 0x3c, 0x88, 0x47, 0x87, 0xc0,
+  0x24, 0x8d, 0x45, 0x80, 0xf6, 0x26, 0x48, 0x70, 0x64, 0xb8, 0x42, 0xa2,
+  0x42, 0x83, 0x92, 0x42, 0x23, 0x74, 0x82, 0x04, 0x86, 0xc1, 0x81, 0x49,
+  0x08, 0x00, 0x91, 0x12, 0x87, 0x18, 0x23, 0xc8, 0x82, 0x1a, 0x94, 0x8c,
+  0x8e, 0x44, 0xc9, 0x0c, 0x2a, 0x0c, 0x48, 0x27, 0x42, 0x14, 0x84, 0x88,
+  0x2f, 0x2d, 0x0a, 0x22, 0x28, 0x80, 0x81, 0x01, 0x22, 0x50, 0x42, 0x42,
+  0x42, 0x28, 0x18, 0x8a, 0x14, 0x01, 0x28, 0x41, 0x8e, 0x11, 0x1c, 0x04,
+  0x60, 0x84, 0xd0, 0x48, 0x02, 0x14, 0x90, 0x81, 0x80, 0x81, 0x04, 0x82,
+  0x1b, 0x61, 0x18, 0x49, 0x41, 0x0a, 0x4c, 0xc4, 0x31, 0xb0, 0x84, 0x22,
+  0x88, 0x86, 0x01, 0x10, 0x01, 0x14, 0x88, 0x44, 0x89, 0x69, 0x41, 0x12,
+  0xc1, 0x82, 0x83, 0xb6, 0x29, 0x4c, 0x02, 0x42, 0x00, 0x84, 0x41, 0x20,
+  0x02, 0x11, 0x00, 0x4d, 0x28, 0x00, 0xc0, 0x14, 0x41, 0x2a, 0x08, 0x82,
+  0x10, 0x88, 0x28, 0x82, 0x88, 0x24, 0x94, 0x81, 0x44, 0x60, 0x24, 0x40,
+  0x01, 0x43, 0xc2, 0x48, 0x80, 0x88, 0x04, 0x28, 0x11, 0x48, 0x10, 0x68,
+  0x81, 0x00, 0x45, 0x28, 0x82, 0x41, 0x25, 0x02, 0x48, 0x85, 0x04, 0xf0,
+  0xd8, 0x2f, 0xc0, 0x18, 0x46, 0x04, 0x20, 0xa4, 0x68, 0x1a, 0x02, 0x40,
+  0x04, 0x42, 0x49, 0x92, 0x84, 0x20, 0xa2, 0x42, 0x14, 0x44, 0x89, 0x22,
+  0x95, 0x62, 0x41, 0x8b, 0x41, 0x80, 0x08, 0x18, 0x42, 0x28, 0x20, 0x82,
+  0x64, 0x12, 0x14, 0x14, 0x8c, 0x14, 0x01, 0x00, 0x8e, 0x14, 0x80, 0x08,
+  0x45, 0x01, 0x82, 0x28, 0x00, 0x48, 0x00, 0x14, 0x00, 0x23, 0x82, 0xf4,
+  0xa3, 0x78, 0x40, 0x22, 0x02, 0x00, 0x88, 0x20, 0x01, 0x42, 0x81, 0x28,
+  0x13, 0x24, 0x01, 0xc0, 0x82, 0x12, 0x00, 0x28, 0x41, 0x00, 0x00, 0x30,
+  0x28, 0x00, 0x41, 0x20, 0x11, 0x28, 0x05, 0x22, 0xc0, 0x21, 0x54, 0x86,
+  0x42, 0x68, 0x42, 0x30, 0x82, 0x40, 0x01, 0x24, 0x82, 0x20, 0x18, 0x11,
+  0x64, 0x1a, 0x82, 0x40, 0x88, 0xf2, 0x69, 0x28, 0x10, 0x62, 0x42, 0x00,
+  0x83, 0x34, 0x24, 0x32, 0x2a, 0x01, 0x4c, 0x14, 0x28, 0x32, 0x49, 0x43,
+  0x09, 0x22, 0x4b, 0x69, 0x44, 0xa6, 0x04, 0x4a, 0x3a, 0x44, 0x84, 0x83,
+  0x28, 0x02, 0x48, 0x42, 0xc6, 0x01, 0x41, 0x42, 0x58, 0x8c, 0x62, 0x11,
+  0x1c, 0x82, 0x02, 0xa6, 0x01, 0x24, 0x8c, 0x6a, 0x42, 0x46, 0x82, 0x18,
+  0x61, 0x11, 0x00, 0x47, 0x88, 0x28, 0x42, 0x10, 0x84, 0x22, 0x44, 0x18,
+  0xa8, 0x24, 0x25, 0x06, 0x2c, 0x01, 0x3c, 0x04, 0x10, 0x11, 0x40, 0x04,
+  0xf0, 0x6e, 0x32, 0x11, 0x60, 0x82, 0x18, 0x22, 0x44, 0x48, 0x00, 0xe0,
+  0x82, 0x01, 0x43, 0x02, 0x26, 0x02, 0x20, 0x14, 0x04, 0x14, 0x70, 0x44,
+  0x21, 0x98, 0x14, 0x11, 0x88, 0x10, 0x48, 0x88, 0x08, 0x21, 0x80, 0x19,
+  0x84, 0x22, 0x88, 0x18, 0x94, 0x21, 0x14, 0x3f, 0xaa, 0x0c, 0x42, 0x22,
+  0x00, 0x12, 0x20, 0x05, 0x48, 0x00, 0x10, 0x01, 0x62, 0x00, 0x4c, 0xa8,
+  0x42, 0x41, 0x40, 0x14, 0x24, 0x08, 0x00, 0x81, 0xa0, 0x28, 0x48, 0x80,
+  0x44, 0x81, 0x82, 0x02, 0x80, 0x04, 0x28, 0x80, 0x04, 0x28, 0x00, 0x42,
+  0x20, 0x04, 0x84, 0x22, 0x20, 0x82, 0x18, 0xe8, 0x22, 0x68, 0x12, 0x2f,
+  0xdf, 0x07, 0x12, 0x44, 0x20, 0xe1, 0x22, 0x64, 0x41, 0x20, 0xc1, 0x22,
+  0x20, 0xa4, 0x29, 0x24, 0x88, 0x20, 0x81, 0x08, 0x80, 0xb8, 0x48, 0x88,
+  0xa8, 0x48, 0x44, 0x28, 0x22, 0x84, 0x41, 0x49, 0x0a, 0xf0, 0x25, 0x00,
+  0x8c, 0x02, 0xc0, 0x22, 0x00, 0x12, 0x2c, 0x02, 0x20, 0x49, 0x02, 0x88,
+  0x12, 0x80, 0x64, 0x12, 0x20, 0x22, 0x22, 0x84, 0xd8, 0x9c, 0x09, 0x41,
+  0x20, 0x11, 0x04, 0x00, 0x00, 0x28, 0x20, 0x94, 0x24, 0x00, 0x40, 0x84,
+  0x42, 0x04, 0x44, 0x62, 0x44, 0x42, 0x45, 0x91, 0x48, 0x20, 0x46, 0x04,
+  0x80, 0x02, 0x48, 0xe6, 0x03, 0xf0, 0x78, 0x12, 0x01, 0xa0, 0x24, 0x00,
+  0x00, 0x20, 0x82, 0x84, 0x04, 0x81, 0x41, 0xc0, 0x41, 0xef, 0x4f, 0x0d,
+  0x14, 0x52, 0x40, 0xc8, 0x14, 0x28, 0x14, 0x00, 0x84, 0x14, 0x20, 0xc8,
+  0x28, 0x10, 0x04, 0xb0, 0x88, 0xc2, 0x28, 0x40, 0x08, 0x28, 0x82, 0x21,
+  0x22, 0x18, 0xa0, 0x48, 0x81, 0x25, 0xc8, 0x21, 0x19, 0x81, 0x78, 0x62,
+  0x18, 0x98, 0x58, 0x00, 0x80, 0x84, 0x92, 0x28, 0x10, 0x94, 0x21, 0x4b,
+  0x28, 0x19, 0x04, 0x22, 0x42, 0x00, 0x20, 0x84, 0xa4, 0x24, 0xb0, 0x28,
+  0x02, 0x1a, 0x22, 0x01, 0x42, 0x00, 0x20, 0x82, 0x02, 0x44, 0x00, 0xa0,
+  0x82, 0x00, 0x90, 0x81, 0x84, 0x2a, 0x18, 0x28, 0x04, 0x82, 0x12, 0x81,
+  0xe0, 0x12, 0x24, 0x02, 0x94, 0x28, 0x90, 0x64, 0x00, 0x81, 0x19, 0xa4,
+  0x42, 0x8e, 0x25, 0x80, 0x02, 0x60, 0x84, 0x28, 0x20, 0x08, 0x22, 0x40,
+  0x28, 0x0a, 0xa0, 0x42, 0x00, 0x6f, 0x35, 0x0b, 0x40, 0x08, 0xae, 0x05,
+  0xf0, 0xff, 0xfb, 0x40, 0x44, 0x81, 0x08, 0x22, 0x82, 0x84, 0x80, 0x68,
+  0x14, 0x00, 0x8a, 0x04, 0x82, 0x88, 0x83, 0x04, 0x8c, 0xc4, 0x45, 0x42,
+  0x1c, 0x04, 0x84, 0x84, 0x42, 0x48, 0x10, 0x0a, 0x89, 0x01, 0x00, 0x80,
+  0x8c, 0x08, 0x20, 0x44, 0x08, 0x42, 0x42, 0x00, 0x20, 0xf8, 0x3c, 0xf8,
+  0xc0, 0x48, 0x00, 0x80, 0xa2, 0x24, 0x18, 0x21, 0x80, 0x01, 0x23, 0x08,
+  0x38, 0x24, 0x83, 0x48, 0xa2, 0x81, 0x60, 0x21, 0x81, 0xc8, 0x12, 0x28,
+  0x38, 0x20, 0x84, 0x02, 0x80, 0x02, 0x14, 0x22, 0x82, 0x46, 0x48, 0x82,
+  0x44, 0x28, 0x01, 0xc8, 0x23, 0x0c, 0x18, 0x50, 0x42, 0x80, 0x41, 0x02,
+  0x24, 0x1a, 0x42, 0x23, 0x11, 0x21, 0x01, 0xf0, 0x2f, 0xed, 0x20, 0x62,
+  0x48, 0xa0, 0x24, 0x88, 0x44, 0x00, 0x00, 0x00, 0x8e, 0x44, 0x00, 0x49,
+  0xc8, 0x45, 0x49, 0x42, 0x14, 0x14, 0x14, 0x24, 0x18, 0x0e, 0xc0, 0x21,
+  0x43, 0x28, 0x02, 0x00, 0x10, 0x88, 0x04, 0x00, 0x22, 0x00, 0x00, 0x48,
+  0x44, 0x82, 0x60, 0x84, 0x41, 0x2a, 0x04, 0x1c, 0x18, 0x08, 0x1d, 0x24,
+  0x40, 0x48, 0x81, 0xf2, 0x4d, 0x27, 0x40, 0x8c, 0xe2, 0x11, 0x04, 0x54,
+  0x8c, 0x04, 0x84, 0x14, 0x28, 0x42, 0xcc, 0x04, 0x28, 0x00, 0x00, 0x81,
+  0x22, 0x22, 0x50, 0x12, 0xc0, 0x14, 0x22, 0x4a, 0x18, 0x32, 0x44, 0x29,
+  0x31, 0x28, 0x38, 0x14, 0x29, 0x14, 0xc1, 0x18, 0x11, 0x48, 0x84, 0x00,
+  0x8a, 0x42, 0x04, 0x11, 0x28, 0x4c, 0x04, 0xca, 0x22, 0x28, 0x24, 0x06,
+  0x20, 0xc4, 0x48, 0x10, 0x22, 0xf4, 0xe4, 0x67, 0xc0, 0x14, 0x8b, 0x4b,
+  0x20, 0xe4, 0x23, 0x12, 0x04, 0x12, 0x14, 0x22, 0x19, 0xe4, 0x84, 0x8c,
+  0x12, 0x08, 0xa3, 0x18, 0xe4, 0x42, 0xd1, 0x5c, 0x64, 0x48, 0x4d, 0x48,
+  0xc2, 0x47, 0x14, 0xaa, 0x14, 0x25, 0x65, 0x82, 0x89, 0xd2, 0x44, 0xa2,
+  0x48, 0x8c, 0x06, 0x68, 0x27, 0x92, 0xee, 0x42, 0x58, 0x24, 0x83, 0x21,
+  0x74, 0x38, 0x32, 0x21, 0xe0, 0x11, 0x42, 0x18, 0xc1, 0xc4, 0x1c, 0x8e,
+  0x74, 0xc4, 0xa1, 0x44, 0x23, 0xd6, 0x81, 0xbc, 0x28, 0xe7, 0x14, 0x36,
+  0x21, 0x14, 0x4c, 0xc2, 0x61, 0x2b, 0x6a, 0x8e, 0x51, 0x20, 0xe4, 0x48,
+  0x22, 0x81, 0x73, 0x84, 0xc5, 0x54, 0x19, 0xd4, 0x82, 0x42, 0x92, 0x38,
+  0x20, 0x33, 0x84, 0x82, 0x22, 0x49, 0x68, 0x58, 0x69, 0xc8, 0x28, 0x4f,
+  0x82, 0x73, 0x88, 0xd1, 0x84, 0xae, 0x48, 0x49, 0xc2, 0x24, 0x8a, 0xe2,
+  0x14, 0x76, 0x24, 0x6c, 0x14, 0x21, 0x85, 0xb3, 0x41, 0x27, 0x24, 0x41,
+  0x04, 0x83, 0x06, 0x19, 0x04, 0x44, 0x89, 0x56, 0x42, 0x2e, 0x22, 0x4c,
+  0xa1, 0x24, 0xd2, 0x8b, 0xa4, 0x20, 0x08, 0x83, 0x32, 0x42, 0x88, 0x49,
+  0xf1, 0x48, 0x28, 0x87, 0x84, 0x86, 0x81, 0xf8, 0x64, 0xe1, 0xb0, 0x35,
+  0x96, 0x14, 0x1c, 0x91, 0x4c, 0x4a, 0xe5, 0x86, 0xa2, 0x11, 0xa0, 0x62,
+  0x30, 0x44, 0x23, 0xf8, 0x41, 0x87, 0x98, 0xe8, 0x36, 0xa4, 0x84, 0x8b,
+  0x28, 0xaa, 0x98, 0x88, 0x2f, 0x46, 0x5a, 0x48, 0x4c, 0xf9, 0x42, 0x8c,
+  0xae, 0x82, 0x83, 0x12, 0xb8, 0x52, 0xac, 0x42, 0x6e, 0xb8, 0x66, 0x74,
+  0x28, 0x28, 0xb2, 0x41, 0x96, 0xa9, 0x6a, 0x52, 0x81, 0x84, 0x8d, 0x2a,
+  0x4a, 0xa2, 0x28, 0xfa, 0xa8, 0x4e, 0x42, 0x22, 0x83, 0x32, 0x22, 0x47,
+  0x28, 0xd8, 0xa8, 0x1a, 0xa6, 0x24, 0x84, 0x22, 0x2b, 0x64, 0x8a, 0xa4,
+  0x52, 0x62, 0x42, 0xbf, 0x65, 0x0d, 0x11, 0x43, 0x12, 0x11, 0x18, 0x31,
+  0x2e, 0x11, 0xa9, 0x11, 0xb1, 0x2a, 0x11, 0x91, 0x1a, 0xd0, 0x1a, 0x01,
+  0xad, 0x14, 0xd0, 0x42, 0x01, 0x2d, 0x14, 0xe0, 0x44, 0x01, 0x42, 0x24,
+  0x28, 0x24, 0x5e, 0x24, 0x2c, 0x28, 0x45, 0x22, 0x02, 0x00, 0xe0, 0x41,
+  0x22, 0x41, 0x22, 0x91, 0x82, 0x12, 0x29, 0x01, 0x29, 0x81, 0x94, 0x12,
+  0x48, 0x05, 0x00, 0xf0, 0xff, 0xff, 0x2f, 0x90, 0x12, 0x48, 0x2d, 0x11,
   0xb0, 0x48, 0x01, 0xf0, 0xe2, 0x52, 0x14, 0x52, 0x1e, 0x19, 0x8d, 0x19,
   0x9f, 0x93, 0xf2, 0x79, 0xee, 0x9f, 0x37, 0x76, 0x11, 0xf9, 0x21, 0x3b,
   0xbf, 0xa1, 0xf1, 0x31, 0x33, 0x1f, 0x91, 0xf1, 0xc1, 0x1a, 0xaf, 0xbd,
@@ -3426,2074 +2821,1686 @@ const unsigned char USB_1608G_rbf[] = {
   0x8f, 0xca, 0xee, 0x2f, 0xfe, 0xca, 0xf8, 0x6f, 0x4d, 0xa9, 0x4c, 0x3e,
   0x62, 0xaf, 0xae, 0xff, 0x7a, 0x78, 0xee, 0xe1, 0x4f, 0x66, 0xf2, 0x33,
   0x78, 0xaf, 0x87, 0xe7, 0x26, 0xe6, 0x3e, 0xff, 0x2d, 0x7b, 0x00, 0x80,
-  0x01, 0x22, 0x48, 0x00, 0x22, 0x00, 0x00, 0x82, 0x20, 0x08, 0x82, 0x44,
-  0x82, 0x00, 0x20, 0x88, 0x02, 0x8b, 0x24, 0x00, 0x00, 0x00, 0x20, 0x84,
-  0x08, 0x00, 0x00, 0x22, 0x00, 0x20, 0x82, 0x04, 0x82, 0x80, 0x84, 0x42,
-  0x08, 0x00, 0x80, 0x02, 0x3f, 0xa5, 0x0c, 0x43, 0x02, 0x81, 0x90, 0x1c,
-  0x90, 0x18, 0x90, 0x18, 0x90, 0x18, 0x48, 0x89, 0x21, 0x11, 0x28, 0xd8,
-  0x48, 0x01, 0x38, 0xe0, 0x44, 0x03, 0x4e, 0x14, 0x00, 0x30, 0x18, 0xe0,
-  0x44, 0x82, 0xa1, 0x25, 0xa0, 0x25, 0x22, 0x12, 0x88, 0x28, 0x18, 0x12,
-  0xa0, 0x21, 0x80, 0x86, 0xa1, 0x21, 0x00, 0x98, 0x1a, 0x04, 0x90, 0x18,
-  0x2e, 0x48, 0x18, 0x48, 0x89, 0x83, 0x84, 0xa3, 0x4a, 0xdf, 0x21, 0x06,
-  0x4f, 0x22, 0xf4, 0x11, 0x24, 0xc5, 0xf2, 0x11, 0x24, 0xc3, 0xf6, 0x11,
-  0x24, 0xa3, 0xd4, 0x41, 0xb6, 0x6a, 0xd1, 0x41, 0xb6, 0x6a, 0x99, 0x21,
-  0xab, 0x94, 0x51, 0xab, 0x94, 0x4b, 0x42, 0xaf, 0x54, 0x39, 0x24, 0x2f,
-  0x54, 0xf9, 0x24, 0x48, 0x2f, 0x54, 0xf9, 0x24, 0x48, 0x4e, 0xb5, 0x5f,
-  0xa2, 0xf4, 0x48, 0x81, 0x4f, 0xa2, 0xe4, 0x15, 0xf2, 0x24, 0x4a, 0xde,
-  0x25, 0x2e, 0x4a, 0xd6, 0xc5, 0x4a, 0xde, 0x24, 0xac, 0xf4, 0x91, 0x24,
-  0x2c, 0xf4, 0x91, 0x24, 0x85, 0xf2, 0x91, 0x24, 0x83, 0xf4, 0x91, 0x24,
-  0xa3, 0xf4, 0x81, 0x24, 0xaf, 0x14, 0xd1, 0xc1, 0xb2, 0x4a, 0x99, 0x61,
-  0xaf, 0x14, 0x99, 0x45, 0xaf, 0x14, 0xb9, 0x24, 0xb4, 0x4a, 0x39, 0x24,
-  0x2b, 0x94, 0x4f, 0x8a, 0xb4, 0x4a, 0xf9, 0xa4, 0x48, 0x4c, 0xf9, 0x24,
-  0x4a, 0x9f, 0x93, 0x01, 0x2c, 0xe4, 0xc1, 0x44, 0xe2, 0x41, 0x24, 0x64,
-  0x41, 0x42, 0x44, 0x42, 0x4c, 0xe2, 0x44, 0x08, 0x4e, 0xa4, 0x41, 0xa8,
-  0x43, 0x82, 0x38, 0x24, 0x8f, 0x14, 0x38, 0x24, 0x8d, 0x81, 0x61, 0x1c,
-  0xf8, 0x22, 0x18, 0x4c, 0xf8, 0x24, 0xd8, 0x14, 0x4d, 0xc8, 0x86, 0x61,
-  0x82, 0x81, 0x1c, 0xe4, 0x48, 0xc2, 0x49, 0x8e, 0x28, 0x48, 0x1f, 0xc8,
-  0x06, 0x8e, 0x4c, 0x83, 0xa4, 0x28, 0x83, 0xb4, 0x81, 0x32, 0x48, 0x28,
-  0x8d, 0x84, 0x28, 0x8d, 0xa4, 0x11, 0x8b, 0xa4, 0x43, 0xb2, 0x48, 0x38,
-  0x24, 0x4a, 0x68, 0x82, 0x19, 0x78, 0x22, 0x08, 0x6f, 0x82, 0xf5, 0xf2,
-  0xf9, 0x60, 0x88, 0x82, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x20, 0x01, 0x00, 0x25,
-  0x01, 0x5f, 0xda, 0x07, 0x24, 0x28, 0x24, 0x28, 0x00, 0x28, 0x22, 0x00,
-  0x80, 0x86, 0x04, 0x90, 0x44, 0xe0, 0x82, 0x24, 0xe8, 0x49, 0x42, 0xe1,
-  0xcc, 0x42, 0x38, 0x44, 0x44, 0x62, 0x48, 0x2e, 0x44, 0x2e, 0x41, 0x42,
-  0x46, 0xc1, 0x48, 0x22, 0x48, 0x28, 0x88, 0x00, 0x84, 0x48, 0xc8, 0x48,
-  0x20, 0xc2, 0x44, 0x00, 0x80, 0x04, 0x80, 0x84, 0x04, 0x86, 0x08, 0x20,
-  0x04, 0x3f, 0x79, 0x06, 0x42, 0x82, 0x10, 0x88, 0x88, 0x02, 0x00, 0x12,
-  0x18, 0x00, 0x49, 0x08, 0x20, 0x04, 0x48, 0x42, 0x42, 0x00, 0x84, 0x00,
-  0x10, 0x48, 0x2a, 0x02, 0x22, 0x48, 0x81, 0x44, 0x4a, 0x82, 0x18, 0x02,
-  0xc0, 0x22, 0x12, 0x42, 0xc2, 0x1c, 0x11, 0x88, 0x28, 0x48, 0x21, 0x84,
-  0x84, 0x18, 0x28, 0x24, 0x94, 0x81, 0x22, 0x26, 0x91, 0x24, 0xfe, 0x1c,
-  0x80, 0xb4, 0xc2, 0x42, 0x22, 0x82, 0x28, 0x82, 0x02, 0x80, 0x91, 0x14,
-  0x4a, 0xa2, 0x42, 0x49, 0x08, 0x43, 0x24, 0x94, 0x48, 0x4a, 0x28, 0xd1,
-  0x21, 0xc4, 0xe4, 0x84, 0x12, 0x41, 0xca, 0x82, 0xa4, 0x24, 0x1d, 0x28,
-  0x22, 0x19, 0xb4, 0x49, 0xa2, 0x42, 0x84, 0x89, 0xa2, 0x4a, 0x42, 0x21,
-  0x81, 0x42, 0xe2, 0x29, 0x04, 0xaa, 0x94, 0x11, 0xc1, 0xa0, 0x82, 0x42,
-  0x42, 0x42, 0x48, 0x46, 0x08, 0x89, 0x54, 0x21, 0x60, 0x14, 0x16, 0xf4,
-  0x98, 0x53, 0x00, 0x00, 0x84, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x22, 0xb0, 0xa4, 0x04, 0x84, 0xd0, 0x84, 0x04, 0x00, 0x45, 0x28, 0x94,
-  0x42, 0x00, 0x80, 0x44, 0x04, 0x82, 0x00, 0x00, 0x18, 0x48, 0xc0, 0x44,
-  0x20, 0x08, 0x11, 0x00, 0x88, 0x20, 0x24, 0x88, 0x28, 0x82, 0x22, 0xf2,
-  0x15, 0xd3, 0x00, 0x28, 0x00, 0x10, 0x01, 0x00, 0x00, 0x90, 0x92, 0x00,
-  0x00, 0x80, 0x01, 0x14, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x82, 0x21,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x84, 0x89, 0x81, 0x84, 0x08,
-  0x00, 0x21, 0x00, 0x00, 0x48, 0x8f, 0xb6, 0x0d, 0x60, 0x41, 0x80, 0x01,
-  0x2a, 0x11, 0x08, 0x83, 0x04, 0x00, 0xc0, 0x41, 0x80, 0x32, 0x81, 0x90,
-  0x81, 0x20, 0x28, 0x04, 0x43, 0xa2, 0x28, 0x28, 0x11, 0x89, 0x92, 0x11,
-  0x42, 0x40, 0x0a, 0x42, 0x12, 0x18, 0x8e, 0x11, 0x88, 0x14, 0x40, 0x01,
-  0x49, 0x82, 0x14, 0x31, 0x18, 0x10, 0x12, 0x91, 0x48, 0x24, 0x84, 0x41,
-  0x48, 0x22, 0xa0, 0x24, 0x00, 0x4f, 0xd7, 0x02, 0x80, 0x03, 0x12, 0xb0,
-  0x11, 0x02, 0x00, 0x00, 0x90, 0x92, 0x19, 0x04, 0xc0, 0x81, 0xe0, 0x18,
-  0x01, 0x14, 0x48, 0x00, 0x28, 0x26, 0x42, 0x41, 0x38, 0x11, 0x00, 0xa4,
-  0x88, 0x48, 0x38, 0x12, 0x12, 0x88, 0x11, 0x10, 0x01, 0x41, 0x48, 0x90,
-  0x1a, 0x90, 0x18, 0xa0, 0x48, 0x10, 0x0a, 0x23, 0x04, 0xa0, 0x42, 0x80,
-  0xf4, 0x84, 0x9f, 0x00, 0x44, 0x00, 0x00, 0x84, 0x60, 0x84, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x82, 0x00, 0x4c, 0x22, 0x08, 0x80, 0x02, 0x42,
-  0x00, 0x24, 0x00, 0x60, 0x18, 0x00, 0x00, 0x80, 0x02, 0x14, 0x50, 0x28,
-  0x60, 0x14, 0x84, 0x00, 0x44, 0x80, 0x02, 0x00, 0xf0, 0x42, 0x1a, 0x00,
-  0x24, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x20, 0x04, 0x80, 0x04, 0x41,
-  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x80, 0x41,
-  0x08, 0x80, 0x08, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x82,
-  0x37, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x88, 0x00, 0x41,
+  0x01, 0x22, 0x48, 0xd3, 0x03, 0x00, 0xd0, 0x09, 0x70, 0x44, 0x82, 0x00,
+  0x20, 0x88, 0x02, 0x8b, 0xed, 0x08, 0xf0, 0x0d, 0x20, 0x84, 0x08, 0x00,
+  0x00, 0x22, 0x00, 0x20, 0x82, 0x04, 0x82, 0x80, 0x84, 0x42, 0x08, 0x00,
+  0x80, 0x02, 0x3f, 0xa5, 0x0c, 0x43, 0x02, 0x81, 0x90, 0x1c, 0x90, 0x18,
+  0x02, 0x00, 0xf0, 0x46, 0x48, 0x89, 0x21, 0x11, 0x28, 0xd8, 0x48, 0x01,
+  0x38, 0xe0, 0x44, 0x03, 0x4e, 0x14, 0x00, 0x30, 0x18, 0xe0, 0x44, 0x82,
+  0xa1, 0x25, 0xa0, 0x25, 0x22, 0x12, 0x88, 0x28, 0x18, 0x12, 0xa0, 0x21,
+  0x80, 0x86, 0xa1, 0x21, 0x00, 0x98, 0x1a, 0x04, 0x90, 0x18, 0x2e, 0x48,
+  0x18, 0x48, 0x89, 0x83, 0x84, 0xa3, 0x4a, 0xdf, 0x21, 0x06, 0x4f, 0x22,
+  0xf4, 0x11, 0x24, 0xc5, 0xf2, 0x11, 0x24, 0xc3, 0xf6, 0x11, 0x24, 0xa3,
+  0xd4, 0x41, 0xb6, 0x6a, 0xd1, 0x41, 0xb6, 0x6a, 0x99, 0x21, 0xab, 0x94,
+  0x51, 0xab, 0x94, 0x4b, 0x42, 0xe2, 0x09, 0x51, 0x2f, 0x54, 0xf9, 0x24,
+  0x48, 0x05, 0x00, 0x62, 0x4e, 0xb5, 0x5f, 0xa2, 0xf4, 0x48, 0x29, 0x0a,
+  0xf0, 0x0e, 0x24, 0x4a, 0xde, 0x25, 0x2e, 0x4a, 0xd6, 0xc5, 0x4a, 0xde,
+  0x24, 0xac, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24, 0x85, 0xf2, 0x91,
+  0x24, 0x83, 0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x23, 0x0a, 0xf0, 0x73, 0xd1,
+  0xc1, 0xb2, 0x4a, 0x99, 0x61, 0xaf, 0x14, 0x99, 0x45, 0xaf, 0x14, 0xb9,
+  0x24, 0xb4, 0x4a, 0x39, 0x24, 0x2b, 0x94, 0x4f, 0x8a, 0xb4, 0x4a, 0xf9,
+  0xa4, 0x48, 0x4c, 0xf9, 0x24, 0x4a, 0x9f, 0x93, 0x01, 0x2c, 0xe4, 0xc1,
+  0x44, 0xe2, 0x41, 0x24, 0x64, 0x41, 0x42, 0x44, 0x42, 0x4c, 0xe2, 0x44,
+  0x08, 0x4e, 0xa4, 0x41, 0xa8, 0x43, 0x82, 0x38, 0x24, 0x8f, 0x14, 0x38,
+  0x24, 0x8d, 0x81, 0x61, 0x1c, 0xf8, 0x22, 0x18, 0x4c, 0xf8, 0x24, 0xd8,
+  0x14, 0x4d, 0xc8, 0x86, 0x61, 0x82, 0x81, 0x1c, 0xe4, 0x48, 0xc2, 0x49,
+  0x8e, 0x28, 0x48, 0x1f, 0xc8, 0x06, 0x8e, 0x4c, 0x83, 0xa4, 0x28, 0x83,
+  0xb4, 0x81, 0x32, 0x48, 0x28, 0x8d, 0x84, 0x28, 0x8d, 0xa4, 0x11, 0x8b,
+  0xa4, 0x43, 0xb2, 0x48, 0x38, 0x24, 0x4a, 0x68, 0x82, 0x19, 0x78, 0x22,
+  0x08, 0x6f, 0x82, 0xf5, 0xf2, 0xf9, 0x60, 0x88, 0x82, 0x10, 0x0a, 0x11,
+  0x12, 0x1c, 0x0a, 0x62, 0x10, 0x02, 0x18, 0x80, 0x08, 0x42, 0x3c, 0x0a,
+  0x02, 0x2b, 0x0a, 0xf0, 0xb7, 0x20, 0x01, 0x00, 0x25, 0x01, 0x5f, 0xda,
+  0x07, 0x24, 0x28, 0x24, 0x28, 0x00, 0x28, 0x22, 0x00, 0x80, 0x86, 0x04,
+  0x90, 0x44, 0xe0, 0x82, 0x24, 0xe8, 0x49, 0x42, 0xe1, 0xcc, 0x42, 0x38,
+  0x44, 0x44, 0x62, 0x48, 0x2e, 0x44, 0x2e, 0x41, 0x42, 0x46, 0xc1, 0x48,
+  0x22, 0x48, 0x28, 0x88, 0x00, 0x84, 0x48, 0xc8, 0x48, 0x20, 0xc2, 0x44,
+  0x00, 0x80, 0x04, 0x80, 0x84, 0x04, 0x86, 0x08, 0x20, 0x04, 0x3f, 0x79,
+  0x06, 0x42, 0x82, 0x10, 0x88, 0x88, 0x02, 0x00, 0x12, 0x18, 0x00, 0x49,
+  0x08, 0x20, 0x04, 0x48, 0x42, 0x42, 0x00, 0x84, 0x00, 0x10, 0x48, 0x2a,
+  0x02, 0x22, 0x48, 0x81, 0x44, 0x4a, 0x82, 0x18, 0x02, 0xc0, 0x22, 0x12,
+  0x42, 0xc2, 0x1c, 0x11, 0x88, 0x28, 0x48, 0x21, 0x84, 0x84, 0x18, 0x28,
+  0x24, 0x94, 0x81, 0x22, 0x26, 0x91, 0x24, 0xfe, 0x1c, 0x80, 0xb4, 0xc2,
+  0x42, 0x22, 0x82, 0x28, 0x82, 0x02, 0x80, 0x91, 0x14, 0x4a, 0xa2, 0x42,
+  0x49, 0x08, 0x43, 0x24, 0x94, 0x48, 0x4a, 0x28, 0xd1, 0x21, 0xc4, 0xe4,
+  0x84, 0x12, 0x41, 0xca, 0x82, 0xa4, 0x24, 0x1d, 0x28, 0x22, 0x19, 0xb4,
+  0x49, 0xa2, 0x42, 0x84, 0x89, 0xa2, 0x4a, 0x42, 0x21, 0x81, 0x42, 0xe2,
+  0x29, 0x04, 0xaa, 0x94, 0x11, 0xc1, 0xa0, 0x82, 0x42, 0x42, 0x42, 0x48,
+  0x46, 0x08, 0x89, 0x54, 0x21, 0x60, 0x14, 0x16, 0xf4, 0x98, 0x53, 0x02,
+  0x0a, 0x02, 0xf8, 0x0a, 0xf0, 0x19, 0x22, 0xb0, 0xa4, 0x04, 0x84, 0xd0,
+  0x84, 0x04, 0x00, 0x45, 0x28, 0x94, 0x42, 0x00, 0x80, 0x44, 0x04, 0x82,
+  0x00, 0x00, 0x18, 0x48, 0xc0, 0x44, 0x20, 0x08, 0x11, 0x00, 0x88, 0x20,
+  0x24, 0x88, 0x28, 0x82, 0x22, 0xf2, 0x15, 0xd3, 0x00, 0x28, 0x60, 0x0c,
+  0x82, 0x00, 0x90, 0x92, 0x00, 0x00, 0x80, 0x01, 0x14, 0x45, 0x0b, 0x31,
+  0x82, 0x21, 0x28, 0x15, 0x01, 0xf0, 0x41, 0x21, 0x84, 0x89, 0x81, 0x84,
+  0x08, 0x00, 0x21, 0x00, 0x00, 0x48, 0x8f, 0xb6, 0x0d, 0x60, 0x41, 0x80,
+  0x01, 0x2a, 0x11, 0x08, 0x83, 0x04, 0x00, 0xc0, 0x41, 0x80, 0x32, 0x81,
+  0x90, 0x81, 0x20, 0x28, 0x04, 0x43, 0xa2, 0x28, 0x28, 0x11, 0x89, 0x92,
+  0x11, 0x42, 0x40, 0x0a, 0x42, 0x12, 0x18, 0x8e, 0x11, 0x88, 0x14, 0x40,
+  0x01, 0x49, 0x82, 0x14, 0x31, 0x18, 0x10, 0x12, 0x91, 0x48, 0x24, 0x84,
+  0x41, 0x48, 0x22, 0xa0, 0x24, 0x00, 0x4f, 0xd7, 0x02, 0x80, 0x03, 0x12,
+  0xb0, 0x11, 0x02, 0x67, 0x00, 0xf0, 0x1e, 0x19, 0x04, 0xc0, 0x81, 0xe0,
+  0x18, 0x01, 0x14, 0x48, 0x00, 0x28, 0x26, 0x42, 0x41, 0x38, 0x11, 0x00,
+  0xa4, 0x88, 0x48, 0x38, 0x12, 0x12, 0x88, 0x11, 0x10, 0x01, 0x41, 0x48,
+  0x90, 0x1a, 0x90, 0x18, 0xa0, 0x48, 0x10, 0x0a, 0x23, 0x04, 0xa0, 0x42,
+  0x80, 0xf4, 0x84, 0x9f, 0xd6, 0x0b, 0x30, 0x84, 0x60, 0x84, 0xee, 0x0c,
+  0xf0, 0x00, 0x00, 0x00, 0x82, 0x00, 0x4c, 0x22, 0x08, 0x80, 0x02, 0x42,
+  0x00, 0x24, 0x00, 0x60, 0x18, 0xb2, 0x01, 0x61, 0x14, 0x50, 0x28, 0x60,
+  0x14, 0x84, 0xc1, 0x0a, 0x52, 0xf0, 0x42, 0x1a, 0x00, 0x24, 0xf8, 0x00,
+  0x50, 0x20, 0x04, 0x80, 0x04, 0x41, 0x1b, 0x07, 0x00, 0xe4, 0x01, 0x50,
+  0x00, 0x00, 0x80, 0x41, 0x08, 0x13, 0x0c, 0x01, 0xea, 0x01, 0x30, 0xf0,
+  0x82, 0x37, 0x46, 0x03, 0x00, 0x55, 0x0d, 0xf1, 0x2b, 0x88, 0x00, 0x41,
   0x00, 0x00, 0x4c, 0x68, 0x84, 0x90, 0x44, 0x20, 0x52, 0x48, 0x84, 0x18,
   0x40, 0x04, 0x80, 0xb8, 0x84, 0x02, 0x11, 0x40, 0x04, 0x10, 0x04, 0x10,
   0x28, 0x04, 0x00, 0x88, 0x22, 0x00, 0x00, 0x4c, 0x8a, 0x14, 0xf8, 0xf1,
   0x98, 0x00, 0x40, 0x04, 0x00, 0x28, 0x40, 0x04, 0x00, 0x83, 0x04, 0x00,
-  0x81, 0x12, 0x00, 0x18, 0x4a, 0x02, 0x22, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x2c, 0x22, 0x01, 0x00, 0x80, 0x02, 0x20, 0x04, 0x00, 0x00, 0x00, 0x40,
-  0x0c, 0x48, 0x82, 0x84, 0xa0, 0x82, 0x70, 0x94, 0x0d, 0x00, 0x21, 0x00,
-  0x80, 0x02, 0x44, 0x00, 0x30, 0x48, 0x00, 0x10, 0x2c, 0x04, 0x41, 0x18,
-  0x4a, 0x8a, 0x24, 0x82, 0x04, 0x22, 0x85, 0x04, 0x38, 0x00, 0x21, 0x2c,
-  0x22, 0x61, 0x42, 0x40, 0x01, 0x2a, 0x11, 0x08, 0x43, 0x84, 0x08, 0x81,
-  0x00, 0x80, 0x04, 0xc9, 0x02, 0x00, 0x84, 0x28, 0x88, 0xd0, 0xa8, 0x0e,
-  0x80, 0x12, 0x04, 0x80, 0x02, 0x00, 0x20, 0x04, 0x20, 0x28, 0x04, 0x20,
-  0x01, 0x40, 0x14, 0x14, 0x08, 0x44, 0x00, 0x10, 0x08, 0x10, 0x04, 0x20,
-  0x88, 0x08, 0x00, 0x41, 0x00, 0x00, 0x00, 0x48, 0x00, 0x20, 0x08, 0x20,
-  0x24, 0x08, 0x43, 0xa8, 0x24, 0x84, 0x8b, 0x78, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x84, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00, 0x21,
-  0x80, 0xf1, 0xf3, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0xe1, 0x07, 0x00, 0x12, 0x00, 0x00, 0x10, 0x01, 0x00, 0x20, 0x14,
+  0x81, 0x12, 0x00, 0x18, 0x4a, 0x02, 0x22, 0x2c, 0x02, 0x80, 0x2c, 0x22,
+  0x01, 0x00, 0x80, 0x02, 0x20, 0x04, 0x6c, 0x0c, 0xf0, 0x19, 0x0c, 0x48,
+  0x82, 0x84, 0xa0, 0x82, 0x70, 0x94, 0x0d, 0x00, 0x21, 0x00, 0x80, 0x02,
+  0x44, 0x00, 0x30, 0x48, 0x00, 0x10, 0x2c, 0x04, 0x41, 0x18, 0x4a, 0x8a,
+  0x24, 0x82, 0x04, 0x22, 0x85, 0x04, 0x38, 0x00, 0x21, 0x2c, 0x22, 0x61,
+  0x42, 0x40, 0x3d, 0x01, 0xf1, 0x04, 0x43, 0x84, 0x08, 0x81, 0x00, 0x80,
+  0x04, 0xc9, 0x02, 0x00, 0x84, 0x28, 0x88, 0xd0, 0xa8, 0x0e, 0x80, 0x12,
+  0x04, 0x7f, 0x0b, 0xf0, 0x03, 0x20, 0x28, 0x04, 0x20, 0x01, 0x40, 0x14,
+  0x14, 0x08, 0x44, 0x00, 0x10, 0x08, 0x10, 0x04, 0x20, 0x88, 0x08, 0xa0,
+  0x00, 0xe5, 0x00, 0x48, 0x00, 0x20, 0x08, 0x20, 0x24, 0x08, 0x43, 0xa8,
+  0x24, 0x84, 0x8b, 0x78, 0xac, 0x02, 0x0f, 0x01, 0x00, 0x02, 0x3f, 0xff,
+  0xe4, 0x0f, 0x16, 0x00, 0x00, 0x06, 0x01, 0x00, 0x30, 0xf0, 0x4f, 0xfe,
+  0x4c, 0x0e, 0x11, 0x00, 0x2f, 0x01, 0x03, 0xff, 0x02, 0x50, 0x00, 0x00,
+  0x14, 0x00, 0x84, 0xb7, 0x08, 0x20, 0x00, 0x40, 0x0d, 0x08, 0x7d, 0x00,
+  0x00, 0x21, 0x80, 0xf1, 0xf3, 0xb5, 0x3b, 0x00, 0x09, 0x01, 0x00, 0x0f,
+  0x68, 0x00, 0x11, 0x0f, 0x01, 0x00, 0x0a, 0x0f, 0x41, 0x00, 0xd9, 0x01,
+  0x5c, 0x01, 0x04, 0x01, 0x00, 0x01, 0xd3, 0x0f, 0x03, 0x01, 0x00, 0x30,
+  0x1f, 0xe1, 0x07, 0x88, 0x04, 0xf0, 0x11, 0x10, 0x01, 0x00, 0x20, 0x14,
   0x14, 0x08, 0x10, 0x84, 0x08, 0x88, 0x84, 0x00, 0xe0, 0x42, 0x04, 0x28,
   0x12, 0x42, 0x18, 0x40, 0x04, 0x12, 0x00, 0x00, 0x81, 0x00, 0x80, 0x05,
-  0x00, 0x00, 0x18, 0x80, 0x01, 0x00, 0x00, 0xf0, 0xa4, 0x69, 0x24, 0x44,
-  0x00, 0x10, 0x04, 0x32, 0x40, 0x12, 0x28, 0x02, 0x40, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4a, 0x01, 0x88, 0x89, 0x82, 0x08, 0x88, 0x00,
-  0x00, 0x90, 0x12, 0xc0, 0x81, 0x18, 0x88, 0x00, 0x89, 0x01, 0x21, 0x41,
-  0x40, 0x84, 0x04, 0x52, 0x80, 0x21, 0x02, 0x7f, 0xd3, 0x0f, 0x44, 0x00,
-  0x00, 0x00, 0x10, 0x11, 0x82, 0x02, 0x30, 0x48, 0x41, 0x84, 0x00, 0x41,
-  0x88, 0x20, 0x08, 0x00, 0x40, 0x04, 0x28, 0x60, 0x84, 0x18, 0x00, 0x20,
-  0x01, 0x00, 0x23, 0x01, 0x14, 0x12, 0x80, 0x05, 0x81, 0x10, 0x02, 0x10,
-  0x24, 0x05, 0x4a, 0x01, 0x18, 0x00, 0xff, 0x2c, 0x09, 0x21, 0x80, 0x01,
-  0x41, 0xa0, 0x12, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81,
-  0x00, 0xa0, 0x24, 0x58, 0x80, 0x89, 0x82, 0x08, 0x49, 0x08, 0x00, 0x00,
-  0x40, 0x88, 0x08, 0x88, 0x00, 0x12, 0x00, 0x44, 0x12, 0x00, 0x00, 0x00,
-  0x28, 0xf0, 0x87, 0x84, 0x00, 0x40, 0x02, 0x41, 0x80, 0x01, 0x41, 0x16,
-  0x28, 0x02, 0x00, 0x90, 0x41, 0x81, 0x10, 0xb8, 0xa1, 0x24, 0x04, 0x89,
-  0x18, 0xa1, 0x24, 0x11, 0x00, 0x40, 0x02, 0x40, 0x84, 0x04, 0x00, 0x20,
-  0x41, 0x01, 0x18, 0x84, 0x88, 0x12, 0x14, 0x80, 0x08, 0x00, 0x4c, 0x02,
-  0x85, 0x04, 0x88, 0x00, 0xf0, 0xca, 0x17, 0x24, 0x18, 0x24, 0x26, 0xc4,
-  0x18, 0x2b, 0x12, 0x4d, 0x28, 0x28, 0x43, 0x83, 0xc2, 0x62, 0x4a, 0x89,
-  0x81, 0x41, 0x28, 0x01, 0x90, 0x28, 0x68, 0x16, 0x68, 0x11, 0x11, 0x59,
-  0x04, 0x82, 0x22, 0x28, 0x84, 0x5f, 0x81, 0xa2, 0x52, 0x91, 0x49, 0x13,
-  0x28, 0x01, 0x15, 0x64, 0x12, 0x30, 0x89, 0x52, 0x2a, 0x44, 0xe1, 0x45,
-  0x08, 0x46, 0x48, 0x88, 0x44, 0x61, 0x11, 0x46, 0x85, 0x05, 0x83, 0x01,
-  0x52, 0x83, 0x24, 0x11, 0x88, 0xf8, 0xf1, 0x49, 0x10, 0x02, 0x23, 0x92,
-  0x1a, 0x43, 0x03, 0x28, 0x00, 0x87, 0x25, 0x42, 0x20, 0x01, 0xc0, 0x41,
-  0x84, 0x10, 0x98, 0x18, 0x00, 0x42, 0x14, 0x68, 0x11, 0x10, 0x98, 0x39,
-  0x42, 0x81, 0x26, 0x04, 0x42, 0x40, 0x01, 0x90, 0x88, 0x4a, 0x21, 0x04,
-  0x98, 0x82, 0x83, 0x45, 0x81, 0x24, 0x28, 0x71, 0x44, 0x01, 0x40, 0x08,
-  0x58, 0x82, 0x18, 0x00, 0x7d, 0x21, 0x80, 0x01, 0x44, 0x24, 0x70, 0x28,
-  0x24, 0xc1, 0x34, 0x26, 0x24, 0xa2, 0x29, 0x12, 0x10, 0x88, 0x01, 0x30,
-  0x28, 0x4a, 0xe2, 0x16, 0xb8, 0x41, 0x41, 0xd1, 0x94, 0x08, 0x88, 0x28,
-  0x22, 0x10, 0x24, 0x53, 0x12, 0x12, 0x85, 0x24, 0x01, 0x44, 0x19, 0x02,
-  0x13, 0x41, 0x81, 0x62, 0x11, 0x47, 0x84, 0x00, 0x81, 0x40, 0x41, 0x01,
-  0x1a, 0x34, 0x24, 0x12, 0xc4, 0x30, 0x48, 0x40, 0x88, 0xf8, 0x6d, 0x39,
-  0x24, 0xa0, 0x14, 0x16, 0x22, 0x82, 0x02, 0x84, 0x4d, 0x18, 0x44, 0x24,
-  0x18, 0x8c, 0x92, 0x24, 0x1a, 0x14, 0x08, 0xe0, 0x11, 0x32, 0x21, 0x4c,
-  0x21, 0x4a, 0x48, 0x88, 0x03, 0x81, 0x94, 0x44, 0x19, 0x01, 0x84, 0x52,
-  0x12, 0x26, 0x81, 0x84, 0xa2, 0x14, 0x11, 0x22, 0x40, 0x82, 0x04, 0x86,
-  0x01, 0x43, 0x01, 0x40, 0x05, 0x28, 0x84, 0x80, 0x01, 0x22, 0x84, 0x00,
-  0x2f, 0xdb, 0x03, 0x60, 0x84, 0x00, 0x18, 0x00, 0x20, 0x04, 0x00, 0x49,
-  0x12, 0x84, 0x91, 0x24, 0x4c, 0x44, 0x04, 0x40, 0x21, 0x12, 0x84, 0x81,
-  0x82, 0x08, 0x2a, 0x04, 0x60, 0x11, 0x00, 0x14, 0x00, 0x8c, 0x04, 0x11,
-  0x40, 0x04, 0x44, 0x48, 0x10, 0x04, 0x82, 0x8a, 0x02, 0x20, 0x04, 0x00,
-  0x89, 0x01, 0x4c, 0x83, 0xf4, 0x63, 0x64, 0x20, 0x44, 0x04, 0x10, 0x14,
-  0x04, 0x28, 0x18, 0x22, 0x00, 0x14, 0x00, 0x18, 0x20, 0x44, 0x84, 0x82,
-  0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x41, 0x21, 0x00, 0x12, 0x40, 0x08,
-  0x56, 0x84, 0x01, 0x22, 0x00, 0x40, 0x48, 0x98, 0x48, 0x00, 0x41, 0x49,
-  0x42, 0x88, 0x02, 0x00, 0x81, 0x9f, 0xb2, 0x4e, 0x22, 0x94, 0x14, 0x24,
-  0x22, 0x1e, 0x24, 0x00, 0x89, 0xc1, 0x54, 0x22, 0x23, 0x61, 0x82, 0x11,
-  0x4e, 0x14, 0x81, 0x43, 0x93, 0x44, 0x28, 0x14, 0x4c, 0xb2, 0x81, 0x11,
-  0x18, 0x0c, 0x28, 0x50, 0xc1, 0x46, 0x04, 0x90, 0x11, 0x47, 0x25, 0x12,
-  0x28, 0x48, 0x18, 0x18, 0x84, 0x13, 0x02, 0x80, 0x04, 0x13, 0x04, 0x10,
-  0x68, 0x88, 0x8e, 0x41, 0x80, 0x62, 0x84, 0x28, 0x8c, 0x01, 0x10, 0x48,
-  0x94, 0x48, 0x9f, 0x29, 0x0b, 0x00, 0x18, 0x00, 0x44, 0x81, 0x4c, 0x02,
-  0x00, 0x00, 0x80, 0x01, 0xb0, 0x15, 0xc4, 0x24, 0x12, 0x28, 0x22, 0x20,
-  0x02, 0x84, 0x20, 0x62, 0x11, 0x10, 0x08, 0x00, 0x20, 0x02, 0x14, 0xb0,
-  0x44, 0x61, 0x41, 0x21, 0x4c, 0x82, 0x08, 0x18, 0x00, 0x45, 0x08, 0x40,
-  0x14, 0x04, 0x22, 0x89, 0x03, 0x38, 0x70, 0xf1, 0x06, 0x44, 0x84, 0x81,
-  0x41, 0x4c, 0x24, 0x44, 0x14, 0x8c, 0xe4, 0x45, 0x02, 0x81, 0x10, 0xb4,
-  0x14, 0x82, 0x98, 0x44, 0x4d, 0xa1, 0x84, 0x4d, 0x81, 0x17, 0xc4, 0x8c,
-  0x44, 0x18, 0x11, 0x6c, 0xc2, 0x81, 0x41, 0x41, 0x00, 0x48, 0x8c, 0x23,
-  0x01, 0x28, 0x12, 0x50, 0x48, 0x81, 0x10, 0x41, 0x08, 0x91, 0xc0, 0x88,
-  0x41, 0x89, 0x01, 0x88, 0x81, 0xc0, 0x18, 0x40, 0xc8, 0x88, 0x82, 0x18,
-  0x1d, 0x4d, 0x00, 0x44, 0x00, 0x00, 0x20, 0x04, 0x00, 0x28, 0x10, 0x08,
-  0x20, 0x02, 0x86, 0x01, 0x88, 0x20, 0x81, 0x08, 0x10, 0x04, 0x12, 0x81,
-  0x26, 0x04, 0x00, 0x42, 0x18, 0x81, 0x22, 0x60, 0x14, 0x00, 0x20, 0x8c,
-  0x28, 0x02, 0x11, 0x00, 0x20, 0x82, 0x09, 0x00, 0x60, 0x86, 0x42, 0xff,
-  0x51, 0x09, 0x00, 0xc0, 0x48, 0x84, 0xc4, 0x8c, 0x84, 0x82, 0x81, 0x19,
-  0x08, 0x41, 0x84, 0x80, 0x82, 0x02, 0x40, 0x08, 0x20, 0x32, 0x21, 0x14,
-  0x00, 0x8b, 0x82, 0x84, 0x44, 0x28, 0xd1, 0x10, 0x31, 0x14, 0x49, 0x18,
-  0x04, 0x14, 0x15, 0x84, 0xc2, 0x18, 0x12, 0x12, 0x4c, 0x04, 0x00, 0x80,
-  0x23, 0x82, 0xa4, 0x48, 0x41, 0x86, 0x44, 0x84, 0x04, 0xf0, 0x1f, 0x8d,
-  0x00, 0x38, 0x48, 0x18, 0x22, 0x38, 0x12, 0x00, 0x30, 0x34, 0x10, 0x08,
-  0x00, 0x81, 0x60, 0x84, 0x82, 0xc0, 0x24, 0x84, 0x00, 0x20, 0x01, 0x28,
-  0x3a, 0x04, 0x22, 0x14, 0x83, 0x02, 0x48, 0x00, 0x42, 0x10, 0x45, 0x24,
-  0xc2, 0x88, 0xa2, 0x4c, 0x14, 0x81, 0x48, 0xc4, 0x88, 0x82, 0x88, 0xc9,
-  0x01, 0x81, 0x12, 0x20, 0xc4, 0x28, 0x1f, 0x46, 0x4d, 0xa2, 0x28, 0x80,
-  0x81, 0x31, 0x48, 0x58, 0x44, 0x12, 0x52, 0xc0, 0x18, 0x16, 0x48, 0x08,
-  0x49, 0x26, 0x04, 0x28, 0x14, 0x81, 0x5c, 0x44, 0x08, 0x60, 0x42, 0x50,
-  0x18, 0x90, 0x14, 0x83, 0x92, 0x48, 0x82, 0xc0, 0x8c, 0x48, 0x20, 0x22,
-  0x08, 0x18, 0x1a, 0xb6, 0x21, 0x48, 0x28, 0x12, 0x28, 0xc4, 0xc8, 0x86,
-  0x09, 0x81, 0x28, 0x82, 0x80, 0x22, 0x01, 0x82, 0x88, 0x46, 0xf1, 0x96,
-  0x96, 0x00, 0x40, 0x28, 0x02, 0x10, 0x48, 0x08, 0x00, 0x48, 0x28, 0x28,
-  0x80, 0x03, 0x80, 0xb9, 0x24, 0x11, 0x08, 0x11, 0x10, 0x89, 0x11, 0x64,
-  0x81, 0x48, 0x88, 0x43, 0x41, 0x18, 0x04, 0x11, 0x10, 0x31, 0x18, 0x22,
-  0x00, 0x81, 0x90, 0x18, 0x10, 0x28, 0x02, 0x18, 0x82, 0x44, 0x00, 0x80,
-  0x02, 0x68, 0x45, 0x08, 0x5f, 0xc2, 0x0b, 0x44, 0x49, 0xc3, 0x44, 0x80,
-  0x21, 0x22, 0x04, 0x41, 0x41, 0x60, 0x4a, 0x48, 0x16, 0x04, 0x50, 0x48,
-  0x5d, 0x88, 0x4c, 0x42, 0x01, 0x49, 0x23, 0x88, 0x0a, 0x44, 0x88, 0x4c,
-  0x02, 0x00, 0x50, 0x18, 0x18, 0x22, 0x6a, 0x01, 0x2e, 0x44, 0x11, 0xa8,
-  0x44, 0x48, 0x22, 0x44, 0x28, 0x28, 0x10, 0xe4, 0x48, 0x12, 0x44, 0x88,
-  0xc2, 0x24, 0x89, 0x08, 0x8b, 0x24, 0x80, 0x92, 0x28, 0x3f, 0xcc, 0x03,
-  0x29, 0x06, 0x24, 0x4c, 0x04, 0x00, 0x16, 0x04, 0x00, 0x20, 0xa1, 0x81,
-  0x12, 0x18, 0x16, 0x81, 0x21, 0x82, 0xa1, 0x81, 0x18, 0x41, 0xc1, 0x88,
-  0x81, 0x18, 0x12, 0x66, 0x88, 0x45, 0x31, 0x14, 0x18, 0x5c, 0x04, 0xc0,
-  0x14, 0x18, 0x18, 0x66, 0x84, 0x94, 0x14, 0x4f, 0x18, 0x61, 0x44, 0x48,
-  0x88, 0x42, 0x40, 0x21, 0x01, 0x84, 0x8c, 0x94, 0x14, 0x49, 0x21, 0x54,
-  0x84, 0x44, 0xf0, 0xaf, 0x8d, 0x40, 0x0a, 0x4c, 0x14, 0x88, 0x12, 0x28,
-  0x01, 0x00, 0x2a, 0x44, 0x04, 0x28, 0x40, 0x04, 0x84, 0x00, 0x80, 0x34,
-  0x32, 0x80, 0x23, 0x81, 0x08, 0x11, 0x41, 0x8c, 0x84, 0x44, 0x81, 0xc2,
-  0x14, 0xc4, 0x90, 0x44, 0x41, 0x81, 0x14, 0x00, 0x10, 0x04, 0x15, 0x04,
-  0x8a, 0x42, 0x44, 0x08, 0x00, 0x83, 0xb8, 0x94, 0x02, 0x21, 0x41, 0x9f,
-  0xee, 0x02, 0x22, 0x43, 0x58, 0x28, 0x1a, 0xa2, 0x22, 0x56, 0x58, 0x84,
-  0x44, 0x44, 0x88, 0x5e, 0x38, 0x84, 0xf0, 0x84, 0x14, 0x1a, 0xa1, 0x11,
-  0x5c, 0x31, 0x99, 0x4b, 0x12, 0x1f, 0x41, 0xe9, 0xc4, 0xf1, 0x28, 0x28,
-  0x8f, 0x41, 0x59, 0x15, 0x26, 0xfc, 0x18, 0x34, 0x87, 0x91, 0xcf, 0x4b,
-  0xc3, 0x59, 0xc9, 0xe6, 0x85, 0xf2, 0x48, 0x11, 0x1e, 0x18, 0x12, 0x58,
-  0x49, 0xf4, 0x14, 0x18, 0x32, 0x17, 0xc4, 0x6a, 0xd4, 0x44, 0x62, 0x98,
-  0x85, 0x24, 0xc4, 0x88, 0x6a, 0x08, 0x83, 0xf8, 0x81, 0x9c, 0x43, 0x92,
-  0x28, 0x8e, 0x68, 0x18, 0x81, 0x8d, 0x14, 0x5e, 0xec, 0x4d, 0x88, 0x45,
-  0x89, 0xf4, 0x56, 0xb4, 0x24, 0x4d, 0x66, 0x26, 0x44, 0xdc, 0x88, 0x71,
-  0x4c, 0x98, 0x14, 0x8d, 0x44, 0xcb, 0x12, 0x42, 0x4f, 0x42, 0x61, 0x42,
-  0x89, 0x22, 0x02, 0x47, 0x44, 0x43, 0xf4, 0x24, 0x68, 0x4f, 0x52, 0x7a,
-  0x88, 0x38, 0x88, 0x8b, 0x88, 0x49, 0x41, 0xe8, 0x88, 0xd8, 0x1d, 0x58,
-  0x84, 0x45, 0x04, 0xcf, 0x42, 0x62, 0xc7, 0x47, 0x12, 0x4c, 0x64, 0x42,
-  0x8b, 0x4a, 0xa0, 0x19, 0x11, 0x86, 0x04, 0x9f, 0x48, 0x32, 0x41, 0x5e,
-  0x14, 0x13, 0xe8, 0x41, 0x3c, 0x4c, 0x44, 0x1d, 0x89, 0x5c, 0x18, 0xe4,
-  0xc9, 0x91, 0x84, 0x88, 0xcf, 0x81, 0xbc, 0x14, 0x29, 0xb1, 0x28, 0x81,
-  0xb4, 0x28, 0xfa, 0x44, 0x18, 0x8f, 0xc9, 0x08, 0x21, 0x1e, 0x38, 0x43,
-  0xf1, 0x44, 0x44, 0x1a, 0xb4, 0x28, 0xa6, 0x15, 0x1e, 0x48, 0x1a, 0xa5,
-  0x41, 0x81, 0x6a, 0xf9, 0x4c, 0x18, 0x87, 0x81, 0x2a, 0xa2, 0x2a, 0x81,
-  0x84, 0x1d, 0xe1, 0x47, 0x92, 0x5d, 0x41, 0x5e, 0x44, 0x2e, 0x21, 0x2a,
-  0x82, 0x02, 0x18, 0x84, 0x52, 0x8a, 0xd1, 0x48, 0xf4, 0x84, 0x28, 0x81,
-  0x5d, 0x3d, 0x5f, 0x45, 0xe2, 0x46, 0xc2, 0x24, 0xc9, 0xf3, 0x14, 0x21,
-  0x47, 0x91, 0x3e, 0x41, 0xd9, 0xe2, 0x83, 0xf3, 0x8c, 0x38, 0xae, 0x65,
-  0x89, 0xb6, 0xc8, 0x16, 0x25, 0x91, 0x88, 0xa6, 0x38, 0x28, 0xe6, 0x64,
-  0xc2, 0x4f, 0x8a, 0x18, 0x34, 0xe8, 0xce, 0x44, 0x8b, 0x22, 0x3f, 0xb1,
-  0x01, 0x00, 0x00, 0x10, 0x04, 0x00, 0x88, 0xa0, 0x82, 0x80, 0x08, 0x4c,
-  0x08, 0x28, 0x10, 0x08, 0x00, 0x85, 0x24, 0x08, 0x00, 0xa0, 0x28, 0x20,
-  0x38, 0x24, 0x82, 0x22, 0x82, 0x2a, 0x61, 0x88, 0x22, 0x82, 0x18, 0x90,
-  0x84, 0x84, 0x60, 0x88, 0x22, 0x84, 0x00, 0x28, 0x40, 0x24, 0x98, 0x28,
-  0x82, 0x8d, 0x24, 0x40, 0xf4, 0xfe, 0x97, 0x24, 0x4f, 0x67, 0xd5, 0x46,
-  0xf2, 0x1c, 0x1e, 0xef, 0xc3, 0xf3, 0x6c, 0x4c, 0xcf, 0x41, 0xf6, 0x14,
-  0x5c, 0x16, 0xf8, 0x44, 0x44, 0x4f, 0x4c, 0xb9, 0xc8, 0xbd, 0x18, 0xb1,
-  0xc8, 0x3c, 0x9c, 0x4f, 0x49, 0xf1, 0x24, 0x94, 0xdf, 0xd1, 0xbb, 0x18,
-  0xb9, 0xc1, 0xad, 0x77, 0x5f, 0xc1, 0xdd, 0x84, 0xf4, 0x9d, 0x9d, 0xc7,
-  0xc2, 0x45, 0x5c, 0x44, 0xdf, 0x91, 0xf1, 0x18, 0x1c, 0x5f, 0xdc, 0xf8,
-  0x1c, 0x1c, 0xdf, 0xd9, 0xf8, 0xa8, 0xec, 0xae, 0xa8, 0xcf, 0xc6, 0xf5,
-  0x95, 0x85, 0x4f, 0x4e, 0xf8, 0xf1, 0x95, 0xcf, 0xc1, 0xf1, 0xbd, 0x98,
-  0xcf, 0x8b, 0xbb, 0x24, 0xf6, 0xe8, 0xfc, 0x9f, 0x92, 0xb3, 0x34, 0xb3,
-  0xa4, 0xde, 0x88, 0xa8, 0x8e, 0x9f, 0x88, 0x78, 0x8d, 0xfd, 0x1c, 0x9c,
-  0xcd, 0x84, 0xca, 0xfc, 0x54, 0xdc, 0x8f, 0xc3, 0xeb, 0x42, 0xf2, 0x9c,
-  0x1c, 0x8f, 0x82, 0xb2, 0x8c, 0x08, 0xf7, 0x9d, 0x24, 0x4f, 0x25, 0xd5,
-  0x46, 0xf4, 0x1c, 0x1e, 0xef, 0xc3, 0xf7, 0x5c, 0x54, 0xcf, 0x45, 0xf4,
-  0x1c, 0x5c, 0x87, 0xc1, 0x5a, 0xf5, 0x54, 0x14, 0xcd, 0x1c, 0x8f, 0x8d,
-  0xad, 0xfd, 0x4b, 0x19, 0x4f, 0x4d, 0xf5, 0x14, 0x94, 0xdf, 0xd1, 0xf9,
-  0xb9, 0x38, 0x1b, 0xfe, 0x5f, 0x4f, 0xfe, 0x1d, 0x9e, 0xef, 0x81, 0xf3,
-  0xbd, 0xbd, 0xff, 0xda, 0xd3, 0x55, 0xf2, 0x84, 0x94, 0x5f, 0xd1, 0xe1,
-  0x43, 0xfb, 0xed, 0x9d, 0xcf, 0xc9, 0x7d, 0x15, 0xed, 0x56, 0xf6, 0xa8,
-  0xa8, 0x8f, 0xce, 0xdc, 0xdd, 0x84, 0xf4, 0xd1, 0xd9, 0xcf, 0xc8, 0xf9,
-  0x39, 0x78, 0xdf, 0x86, 0xf2, 0xa5, 0xe5, 0x6e, 0x65, 0x9f, 0x12, 0xf2,
-  0x7c, 0xbc, 0xcf, 0xca, 0xde, 0xc8, 0x78, 0xc9, 0xf9, 0x28, 0x28, 0x97,
-  0x99, 0x8f, 0xc1, 0xfb, 0xac, 0xac, 0xea, 0xee, 0x47, 0xff, 0x38, 0xbc,
-  0x47, 0x43, 0x4f, 0xe5, 0xf5, 0x6a, 0xc8, 0x4b, 0x88, 0x2b, 0x11, 0xe7,
-  0xea, 0x24, 0x4f, 0x65, 0xd5, 0x46, 0xf4, 0x1c, 0x1a, 0xef, 0xc3, 0xf3,
-  0x58, 0x5c, 0x16, 0xf4, 0x14, 0x1c, 0x1a, 0xf1, 0x44, 0x44, 0x4f, 0x44,
-  0xf4, 0x48, 0x44, 0x8f, 0x89, 0xb9, 0x48, 0xf6, 0x1c, 0x98, 0x4f, 0x41,
-  0xb1, 0x84, 0xf1, 0x9d, 0x1d, 0xcf, 0xcb, 0xdb, 0x19, 0xb9, 0x34, 0xfb,
-  0x15, 0x9d, 0xef, 0xc7, 0xf6, 0x95, 0x9d, 0xcf, 0x82, 0xf9, 0xa5, 0x85,
-  0x4d, 0x84, 0xdf, 0xd1, 0xd1, 0xc8, 0xf1, 0x7d, 0x6d, 0x8f, 0xc9, 0xf9,
-  0x59, 0x4d, 0x8f, 0xd2, 0xf6, 0x28, 0x2c, 0xcf, 0xce, 0xfe, 0x15, 0x5d,
-  0x6a, 0xf6, 0x31, 0x71, 0xcf, 0x8b, 0xfb, 0x1d, 0x11, 0xcf, 0xd1, 0xf3,
-  0x7d, 0x6d, 0x8f, 0xdf, 0xff, 0x89, 0x9d, 0x4b, 0x3a, 0x4f, 0xce, 0xfe,
-  0xe8, 0xec, 0x8b, 0xce, 0x9f, 0x88, 0xfa, 0x99, 0x11, 0x8f, 0xc9, 0xf9,
-  0x8c, 0xac, 0x8a, 0xdc, 0x44, 0xfd, 0xa8, 0xbc, 0xcf, 0x43, 0xfb, 0xbc,
-  0xbc, 0xef, 0x86, 0xb6, 0xac, 0xba, 0x24, 0xd3, 0x69, 0x44, 0xf2, 0x76,
-  0x56, 0x6f, 0x41, 0xf3, 0x14, 0x16, 0xef, 0x47, 0xe3, 0x47, 0xe5, 0x45,
-  0x76, 0x1c, 0xfc, 0x18, 0x1c, 0x4f, 0x45, 0xf5, 0xd4, 0xd4, 0x85, 0xfc,
-  0x58, 0x78, 0xda, 0xfd, 0x1c, 0x9c, 0x4f, 0x45, 0xf5, 0xb4, 0x14, 0xdf,
-  0xd9, 0xf3, 0xb9, 0x99, 0x1f, 0x1a, 0xf1, 0x35, 0xa5, 0xdf, 0xd5, 0xfd,
-  0x5e, 0x7c, 0xdf, 0xfb, 0xfb, 0xac, 0x8d, 0x4f, 0x5a, 0xf8, 0x14, 0x84,
-  0xdf, 0xd1, 0xf1, 0xbc, 0x3c, 0xdf, 0xdf, 0xfd, 0x38, 0x58, 0xd7, 0xd1,
-  0xcf, 0xcc, 0xfc, 0x8c, 0x8c, 0xcf, 0xc6, 0xf6, 0x25, 0x6d, 0x8a, 0xfc,
-  0x99, 0xf1, 0x8f, 0x83, 0xb3, 0x59, 0xf3, 0xed, 0xa8, 0xdf, 0xdf, 0xfe,
-  0x7c, 0x6d, 0xdf, 0xda, 0xfa, 0xcc, 0x88, 0xcf, 0xce, 0xfe, 0x68, 0xe8,
-  0x95, 0xd9, 0x99, 0xf2, 0x99, 0x91, 0x8f, 0xc3, 0xf9, 0x8c, 0xac, 0xaa,
-  0xfa, 0xb4, 0xb4, 0xcf, 0xca, 0xfb, 0xb4, 0x94, 0xcf, 0xcb, 0xff, 0xae,
-  0xcc, 0xcf, 0x6a, 0xfa, 0x24, 0x74, 0x1f, 0x99, 0x0d, 0x2a, 0x01, 0x00,
-  0x22, 0x84, 0x49, 0xe1, 0x81, 0x14, 0x24, 0x01, 0x9a, 0x04, 0x86, 0x48,
-  0x84, 0xc4, 0x24, 0x12, 0x8d, 0x24, 0x92, 0x00, 0x28, 0x11, 0x44, 0x00,
-  0x30, 0x48, 0x98, 0x42, 0x22, 0x00, 0x90, 0x14, 0x80, 0x41, 0xc8, 0x81,
-  0x8c, 0x04, 0x20, 0x42, 0x08, 0x82, 0x14, 0x12, 0x20, 0x08, 0x12, 0x00,
-  0x44, 0x00, 0xf0, 0x89, 0x4d, 0x30, 0x84, 0x12, 0x41, 0x16, 0x0c, 0x4c,
-  0x04, 0x44, 0x41, 0x8e, 0x44, 0x22, 0x16, 0x08, 0x82, 0x4c, 0x21, 0x49,
-  0x34, 0x91, 0x30, 0x94, 0x8f, 0x54, 0x21, 0x51, 0x48, 0x22, 0x88, 0x84,
-  0x87, 0x41, 0x41, 0x8a, 0x12, 0xa4, 0x28, 0x8c, 0x39, 0x98, 0x88, 0x44,
-  0xc8, 0x12, 0x49, 0x28, 0x81, 0xe8, 0x48, 0xc2, 0x81, 0x9e, 0x28, 0x41,
-  0x48, 0xa0, 0x48, 0x60, 0x88, 0x85, 0x24, 0x1a, 0x38, 0x24, 0x60, 0x81,
-  0xe0, 0x88, 0x34, 0x48, 0x14, 0x6f, 0x55, 0x05, 0x2c, 0xf4, 0x11, 0x24,
-  0x85, 0xf2, 0x11, 0x24, 0xc3, 0xf4, 0x11, 0x24, 0xe3, 0xd6, 0x41, 0xb2,
-  0x6a, 0xd1, 0x41, 0xb2, 0x6a, 0x99, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94,
-  0x43, 0xf2, 0x4a, 0x91, 0x4b, 0x42, 0xaf, 0x14, 0x7b, 0x24, 0xd8, 0x12,
-  0xf9, 0x24, 0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x1c, 0xf8, 0x24, 0x4a, 0x1e,
-  0x21, 0x4f, 0xa2, 0x64, 0x19, 0x2e, 0x4a, 0x9e, 0x25, 0x2e, 0x4a, 0x9e,
-  0x24, 0xac, 0xf4, 0x91, 0x24, 0x2c, 0xf4, 0x91, 0x24, 0x8d, 0x12, 0x1f,
-  0x49, 0x32, 0x48, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a, 0xd1,
-  0xc1, 0xf2, 0x4a, 0x91, 0x19, 0xb2, 0x4a, 0x19, 0xb5, 0x4a, 0x39, 0x24,
-  0xab, 0xb4, 0x43, 0xf2, 0x4a, 0x94, 0x47, 0x82, 0xa9, 0xf9, 0x24, 0x48,
-  0x98, 0x4f, 0xa2, 0xb4, 0xc3, 0x06, 0xf0, 0x11, 0x6c, 0x81, 0x1f, 0x41,
-  0x36, 0x48, 0x1b, 0x21, 0xa3, 0x14, 0xb1, 0x4a, 0xd1, 0x41, 0xf2, 0x4a,
-  0x94, 0x19, 0xd2, 0x4a, 0x9b, 0x45, 0xab, 0xb4, 0x43, 0xf2, 0x42, 0x91,
-  0x41, 0x2f, 0x14, 0x39, 0x24, 0x2d, 0x91, 0x6f, 0x82, 0x94, 0x12, 0x4f,
-  0x22, 0x45, 0xf1, 0x24, 0xda, 0x16, 0xf1, 0x24, 0xca, 0x92, 0x2e, 0x4a,
-  0x96, 0xc5, 0x4b, 0xd6, 0x44, 0x7b, 0x91, 0xcc, 0x42, 0x1f, 0xc9, 0x44,
-  0x72, 0x91, 0x34, 0x48, 0x1f, 0x48, 0x12, 0xda, 0x41, 0xb6, 0x42, 0xd1,
-  0x41, 0xf2, 0x42, 0x14, 0x11, 0x2f, 0x44, 0x1b, 0xb5, 0x4a, 0x0b, 0xab,
-  0x94, 0x22, 0x2b, 0x14, 0x47, 0x88, 0x29, 0x91, 0x46, 0x29, 0xf9, 0xa4,
-  0x5a, 0xaf, 0xf9, 0x0e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-  0xe0, 0xa4, 0x44, 0x42, 0x02, 0x89, 0x02, 0x26, 0x98, 0x1c, 0x22, 0x81,
-  0x32, 0x82, 0x89, 0x38, 0x22, 0x84, 0x20, 0x34, 0x31, 0x47, 0x11, 0x43,
-  0xd1, 0x41, 0xe2, 0x88, 0xa2, 0x28, 0x4f, 0x88, 0x42, 0x0c, 0x11, 0xc0,
-  0x1a, 0x11, 0x20, 0x24, 0xa3, 0x21, 0x18, 0x22, 0x38, 0x88, 0x41, 0x88,
-  0x3c, 0x01, 0x12, 0x4a, 0x38, 0x28, 0x14, 0x1c, 0x03, 0x34, 0x42, 0x4d,
-  0x41, 0x42, 0x85, 0x24, 0x04, 0x70, 0x84, 0x98, 0x14, 0x30, 0x88, 0x81,
-  0x5f, 0xbe, 0x04, 0x76, 0xa1, 0x28, 0x20, 0x82, 0x05, 0x14, 0x28, 0xa4,
-  0x26, 0x84, 0x61, 0x28, 0x40, 0xe8, 0x28, 0x01, 0x8c, 0x04, 0x83, 0x18,
-  0x04, 0x48, 0x92, 0x8b, 0x24, 0x82, 0x17, 0x42, 0x30, 0x28, 0x8d, 0x82,
-  0x8c, 0x22, 0x38, 0x88, 0x46, 0x52, 0x48, 0x44, 0x56, 0x11, 0x21, 0x92,
-  0x8c, 0x1d, 0xc8, 0x1d, 0x84, 0x18, 0x88, 0x16, 0x1a, 0x48, 0x03, 0x8c,
-  0x01, 0x82, 0x50, 0x84, 0x32, 0x12, 0x22, 0x90, 0x44, 0x16, 0x21, 0x54,
-  0x3e, 0x24, 0x13, 0xa4, 0x24, 0x8c, 0x22, 0xc2, 0x48, 0x81, 0x28, 0xc0,
-  0x38, 0x2f, 0x42, 0x38, 0x84, 0x29, 0x22, 0x02, 0xd2, 0x1c, 0xd3, 0x14,
-  0x95, 0x14, 0xa6, 0x99, 0x84, 0x2c, 0xc2, 0xcc, 0x47, 0x89, 0x8b, 0x61,
-  0x82, 0x43, 0x3a, 0x18, 0xad, 0x21, 0x8c, 0xe8, 0x84, 0x82, 0xb9, 0x19,
-  0x4a, 0x12, 0x98, 0x1c, 0xca, 0x31, 0x41, 0x82, 0x8e, 0x15, 0x8c, 0xa4,
-  0x81, 0x1a, 0xc4, 0xa8, 0x16, 0xb8, 0x19, 0x12, 0x54, 0x21, 0x66, 0xd8,
-  0x41, 0x24, 0x44, 0x4c, 0x8c, 0x82, 0x41, 0xc8, 0x12, 0x43, 0x64, 0x89,
-  0x83, 0xf5, 0xa9, 0xfb, 0xe0, 0x22, 0x01, 0x00, 0x2a, 0x61, 0x41, 0x14,
-  0x8c, 0x02, 0x90, 0x18, 0x82, 0xa1, 0x84, 0x24, 0x10, 0x08, 0x44, 0x26,
-  0x88, 0x28, 0x02, 0x40, 0x11, 0x01, 0x00, 0x21, 0x28, 0x20, 0x35, 0x24,
-  0x28, 0x14, 0x44, 0x22, 0x84, 0x2d, 0x81, 0x15, 0x84, 0x08, 0x34, 0x40,
-  0x03, 0x18, 0x80, 0x08, 0x42, 0x12, 0x30, 0xa4, 0x44, 0x00, 0xb0, 0x85,
-  0x02, 0x21, 0x00, 0xc4, 0x18, 0x20, 0x02, 0x22, 0x48, 0x22, 0x12, 0x34,
-  0x40, 0x86, 0x84, 0x28, 0xc1, 0x22, 0x12, 0x28, 0x00, 0x00, 0x40, 0x04,
-  0x40, 0x22, 0x95, 0x94, 0x80, 0x08, 0x14, 0x11, 0x00, 0x25, 0xc2, 0x28,
-  0x8d, 0x91, 0x84, 0x47, 0x24, 0x40, 0x32, 0x91, 0x00, 0x00, 0x81, 0x22,
-  0x20, 0x51, 0x48, 0x82, 0x85, 0x04, 0x1f, 0xea, 0x09, 0x17, 0x42, 0x90,
-  0x31, 0x18, 0x7c, 0xc2, 0x12, 0x45, 0x42, 0x18, 0xc6, 0x98, 0x86, 0x02,
-  0x92, 0x1e, 0x88, 0x13, 0x91, 0x18, 0x5d, 0x22, 0x47, 0x84, 0x86, 0x34,
-  0xe8, 0xcb, 0x48, 0x28, 0x9c, 0x44, 0x74, 0x41, 0xc2, 0x41, 0x11, 0x38,
-  0x47, 0x24, 0x43, 0x2a, 0x32, 0x22, 0x46, 0x88, 0x23, 0xe7, 0x28, 0x82,
-  0xc2, 0x1d, 0x98, 0x66, 0x34, 0x14, 0x45, 0xb2, 0x41, 0x31, 0x81, 0xd6,
-  0x09, 0x60, 0x21, 0x8b, 0x81, 0x45, 0xb1, 0x42, 0x68, 0x62, 0x43, 0xc5,
-  0x2c, 0x4e, 0x84, 0x2a, 0xb4, 0x18, 0xa2, 0x24, 0x4b, 0x48, 0xef, 0x2a,
-  0x01, 0x2d, 0x24, 0x30, 0x11, 0x85, 0x44, 0x42, 0x92, 0x24, 0x25, 0x08,
-  0x5e, 0x88, 0x8a, 0x22, 0x81, 0xf1, 0x12, 0x88, 0x80, 0xe1, 0x12, 0xc8,
-  0x18, 0x2e, 0x86, 0x58, 0x4b, 0xc2, 0x28, 0x8c, 0x04, 0x13, 0x14, 0x43,
-  0x21, 0x41, 0x94, 0xa4, 0x22, 0x9a, 0x42, 0x28, 0xa8, 0x61, 0x8a, 0x92,
-  0x21, 0x19, 0x01, 0x40, 0x68, 0x19, 0x9c, 0x61, 0x78, 0x13, 0x05, 0x98,
-  0x90, 0x98, 0x34, 0x88, 0x24, 0x18, 0x4c, 0xc2, 0x54, 0x4c, 0xc2, 0x98,
-  0x28, 0x48, 0x3f, 0x55, 0x0d, 0x11, 0x80, 0x22, 0x61, 0x53, 0x12, 0x00,
-  0x69, 0x02, 0x10, 0x92, 0x81, 0x70, 0x14, 0xd1, 0x82, 0x14, 0x74, 0x42,
-  0x04, 0x89, 0x4a, 0x08, 0x14, 0x44, 0x20, 0x44, 0x84, 0x62, 0x24, 0x24,
-  0x58, 0x61, 0x48, 0x1a, 0x02, 0x34, 0x50, 0x84, 0x8a, 0xf1, 0x42, 0x26,
-  0x4b, 0x12, 0xc4, 0x23, 0x84, 0x94, 0x88, 0x24, 0x11, 0x2c, 0x01, 0x44,
-  0x42, 0xc3, 0xb2, 0x44, 0x12, 0x28, 0x38, 0x48, 0x22, 0x46, 0x9c, 0x84,
-  0x3f, 0x16, 0x02, 0x50, 0x92, 0x15, 0x02, 0x12, 0xc1, 0x89, 0x44, 0x39,
-  0x15, 0x24, 0x18, 0x2a, 0x94, 0x22, 0x24, 0x1a, 0x04, 0x2c, 0x14, 0x04,
-  0x24, 0x00, 0x44, 0x2d, 0x12, 0x89, 0x04, 0x11, 0x44, 0x2d, 0x8a, 0x12,
-  0x84, 0x2b, 0x12, 0x90, 0x28, 0x49, 0x22, 0x94, 0x54, 0x83, 0x61, 0x13,
-  0x48, 0x8d, 0x24, 0x2c, 0x12, 0x15, 0x41, 0x92, 0x84, 0x2c, 0x01, 0x80,
-  0x04, 0xcb, 0x18, 0x60, 0x8a, 0x40, 0x32, 0x48, 0x00, 0xcf, 0x96, 0x48,
-  0x01, 0x46, 0x2a, 0x32, 0x24, 0x83, 0x04, 0x18, 0x29, 0x02, 0xc4, 0x22,
-  0x89, 0x91, 0xa4, 0x44, 0x45, 0x08, 0x12, 0x90, 0x19, 0x18, 0x2a, 0x68,
-  0x41, 0x16, 0x91, 0x12, 0x88, 0x49, 0xc8, 0x18, 0x32, 0x40, 0x44, 0x71,
-  0x48, 0x22, 0x58, 0x12, 0x21, 0x28, 0x8c, 0x74, 0x81, 0x04, 0x12, 0x10,
-  0x08, 0x42, 0x42, 0x53, 0x21, 0x86, 0xf1, 0x44, 0x21, 0x41, 0x2a, 0x08,
-  0xc4, 0x44, 0x43, 0x42, 0x02, 0x84, 0x89, 0xf6, 0xfc, 0x68, 0x20, 0x84,
-  0x11, 0x68, 0x11, 0x14, 0x13, 0x82, 0x02, 0x42, 0x50, 0x81, 0x11, 0x00,
-  0xd0, 0x14, 0x61, 0x48, 0x18, 0x10, 0x48, 0x18, 0x48, 0xd8, 0x1c, 0x64,
-  0x42, 0xa4, 0x10, 0x38, 0x34, 0x84, 0x2a, 0x09, 0x22, 0x40, 0xc1, 0x12,
-  0x22, 0x24, 0x00, 0x8a, 0x01, 0xac, 0x12, 0x18, 0x88, 0x14, 0x01, 0x85,
-  0x92, 0x18, 0x30, 0x42, 0x80, 0x14, 0x48, 0x08, 0x4c, 0x04, 0xce, 0xce,
-  0x14, 0x46, 0x62, 0x11, 0x27, 0x22, 0x47, 0x13, 0x56, 0x68, 0xc2, 0x8d,
-  0x52, 0x28, 0x16, 0x41, 0xec, 0x81, 0xa2, 0x52, 0x50, 0x24, 0x45, 0x48,
-  0xa4, 0x84, 0x69, 0xc1, 0x11, 0x81, 0x84, 0x4c, 0xc1, 0x14, 0x85, 0x94,
-  0xaa, 0x85, 0x06, 0x49, 0xa2, 0x81, 0x4c, 0x31, 0x81, 0x8d, 0x12, 0x26,
-  0x02, 0x73, 0x82, 0x23, 0x82, 0x31, 0x13, 0xc0, 0x24, 0x81, 0x1d, 0x24,
-  0x14, 0x42, 0x8a, 0x64, 0x22, 0x18, 0x4c, 0x34, 0x1c, 0x24, 0x1e, 0x8c,
-  0x44, 0xcc, 0x7c, 0x28, 0x44, 0x18, 0x88, 0x24, 0xf2, 0x6f, 0x1c, 0x00,
-  0x50, 0x18, 0x40, 0x11, 0x21, 0x52, 0x81, 0x43, 0x04, 0x25, 0x51, 0x81,
-  0x29, 0x08, 0x4a, 0x31, 0x11, 0x4c, 0x01, 0x81, 0x12, 0x29, 0x4a, 0x58,
-  0x18, 0x19, 0x64, 0x44, 0x70, 0x18, 0xc1, 0x1a, 0x8d, 0x24, 0x25, 0xb8,
-  0x18, 0xb2, 0x22, 0x24, 0x68, 0x82, 0xc0, 0x42, 0x16, 0xd4, 0x1c, 0x88,
-  0xa2, 0x14, 0x96, 0x68, 0x22, 0x84, 0xa3, 0x44, 0xd8, 0x12, 0xb1, 0x11,
-  0x04, 0x15, 0x38, 0x42, 0xa2, 0x42, 0x84, 0x28, 0x00, 0x48, 0x85, 0xc4,
-  0x48, 0x7f, 0xae, 0x0a, 0x41, 0x00, 0x22, 0xc0, 0x11, 0x37, 0x84, 0x13,
-  0x02, 0x83, 0x48, 0x44, 0x13, 0x08, 0x48, 0x00, 0x00, 0x88, 0x2d, 0x82,
-  0x22, 0x28, 0x48, 0x11, 0x2a, 0x11, 0x12, 0x38, 0x14, 0x48, 0x30, 0x28,
-  0x60, 0x24, 0x00, 0x19, 0x21, 0xa2, 0x41, 0x84, 0x15, 0x82, 0x9c, 0x21,
-  0x11, 0x28, 0x61, 0xa0, 0x48, 0x11, 0x16, 0x08, 0x00, 0x42, 0x98, 0xc8,
-  0x85, 0x24, 0xd8, 0xa4, 0xf1, 0x49, 0x69, 0x00, 0x00, 0x42, 0xa0, 0x24,
-  0x00, 0x18, 0x43, 0xa1, 0x82, 0x42, 0x14, 0x4a, 0x21, 0xf1, 0xa4, 0x11,
-  0x28, 0x42, 0x25, 0xf1, 0x22, 0x11, 0x8c, 0xd2, 0x81, 0xc4, 0x41, 0x24,
-  0x41, 0x84, 0x22, 0x32, 0x84, 0xc4, 0x17, 0x84, 0x43, 0x61, 0x48, 0x40,
-  0x82, 0x08, 0x50, 0x41, 0x1a, 0x88, 0x76, 0x38, 0x42, 0x22, 0x88, 0x08,
-  0x89, 0x1a, 0xc2, 0x82, 0x90, 0xa8, 0x25, 0x88, 0x09, 0x22, 0x10, 0x42,
-  0x88, 0xf8, 0x95, 0xfe, 0x00, 0x6c, 0x02, 0x00, 0x10, 0x41, 0x22, 0x22,
-  0x83, 0x81, 0x02, 0x11, 0xa5, 0x21, 0x18, 0x18, 0x04, 0x21, 0x42, 0x12,
-  0x60, 0x42, 0x00, 0x00, 0x41, 0x40, 0x54, 0x24, 0x32, 0xa0, 0x18, 0x8e,
-  0x44, 0x28, 0x20, 0x02, 0x00, 0x41, 0x12, 0xa0, 0x24, 0x40, 0x08, 0x48,
-  0x61, 0x80, 0x86, 0x32, 0x84, 0x12, 0x12, 0x12, 0x48, 0xdf, 0xd8, 0x48,
-  0xd2, 0x61, 0x22, 0x21, 0x61, 0x41, 0x12, 0x4c, 0x04, 0x43, 0x54, 0x49,
-  0x24, 0x89, 0x04, 0x4a, 0x88, 0x22, 0x08, 0x2d, 0x81, 0x1c, 0x8c, 0x45,
-  0x61, 0x13, 0x20, 0x94, 0x8a, 0x18, 0x19, 0x04, 0x4d, 0x42, 0x50, 0x21,
-  0x88, 0x2a, 0x04, 0xc4, 0x44, 0x34, 0x83, 0xe8, 0x21, 0x2c, 0x68, 0x1c,
-  0x16, 0x24, 0x19, 0x22, 0x68, 0x48, 0x14, 0x00, 0x21, 0x14, 0x82, 0x48,
-  0x47, 0x28, 0x18, 0x20, 0x24, 0x2e, 0x22, 0xfa, 0x23, 0xec, 0x20, 0x18,
-  0xc8, 0x24, 0x45, 0x41, 0x04, 0x1a, 0x46, 0x0a, 0x88, 0x00, 0x22, 0x48,
-  0x21, 0x8d, 0x21, 0x2c, 0x92, 0x38, 0x00, 0x88, 0x91, 0x84, 0x48, 0x44,
-  0x12, 0x85, 0x01, 0x42, 0x89, 0x46, 0x08, 0x4b, 0x1c, 0x84, 0x4e, 0x24,
-  0x24, 0x00, 0x00, 0x26, 0x54, 0x84, 0xa8, 0x13, 0x51, 0x41, 0x8c, 0x84,
-  0x05, 0x89, 0x04, 0x87, 0x24, 0x89, 0x84, 0x43, 0xa4, 0x41, 0x82, 0xa0,
-  0x18, 0x14, 0xdf, 0x5c, 0x0a, 0x12, 0x28, 0x80, 0x82, 0x14, 0x16, 0x58,
-  0x12, 0x89, 0x31, 0x2a, 0x13, 0x12, 0xe3, 0x14, 0xd8, 0x82, 0x92, 0x38,
-  0x4c, 0x94, 0x1a, 0x44, 0x4d, 0xc8, 0x8a, 0x41, 0x08, 0x12, 0x22, 0x88,
-  0x29, 0x02, 0x1e, 0x22, 0x26, 0x0a, 0x58, 0x42, 0x84, 0x48, 0x12, 0x23,
-  0x61, 0x28, 0x48, 0x87, 0x4c, 0x46, 0x24, 0x0c, 0x9d, 0x16, 0x44, 0x21,
-  0x70, 0x88, 0x61, 0x44, 0x8e, 0x32, 0x58, 0x10, 0x04, 0x88, 0x44, 0x16,
-  0x48, 0x18, 0x28, 0xf2, 0x97, 0x34, 0x40, 0x4a, 0x01, 0x00, 0x10, 0xc4,
-  0x14, 0x00, 0x1e, 0xc8, 0x8b, 0x2c, 0xe0, 0x11, 0xc2, 0x42, 0x20, 0x08,
-  0x21, 0x84, 0x14, 0x42, 0x19, 0x5a, 0x14, 0x2a, 0x01, 0x22, 0x84, 0x00,
-  0x88, 0x82, 0x80, 0x08, 0x46, 0x68, 0x11, 0x59, 0x46, 0x31, 0x28, 0xc0,
-  0x21, 0x40, 0x08, 0x82, 0x44, 0xa2, 0x11, 0x83, 0x28, 0x82, 0x1a, 0x28,
-  0x04, 0x41, 0x48, 0x40, 0xb4, 0x4b, 0x0e, 0x16, 0x91, 0x14, 0x69, 0x82,
-  0x01, 0x90, 0x12, 0x29, 0x65, 0x12, 0x45, 0x11, 0x62, 0x88, 0x18, 0x40,
-  0x41, 0xc8, 0x41, 0x27, 0x81, 0x41, 0x28, 0x20, 0x02, 0xa3, 0x18, 0x18,
-  0x48, 0x18, 0x04, 0x00, 0x90, 0x48, 0x47, 0x18, 0x29, 0x34, 0x15, 0x4d,
-  0x42, 0x19, 0x08, 0x41, 0x18, 0x20, 0xd1, 0x24, 0x04, 0x21, 0x2c, 0x22,
-  0x81, 0x01, 0x00, 0x41, 0x4c, 0x23, 0x04, 0x9a, 0x12, 0x52, 0x28, 0x3f,
-  0x9d, 0x0f, 0x2d, 0x68, 0xa0, 0x41, 0x30, 0x14, 0x19, 0x61, 0x42, 0x83,
-  0x12, 0x04, 0x40, 0x54, 0x86, 0x89, 0x22, 0x02, 0xc0, 0x81, 0x13, 0x01,
-  0x29, 0x85, 0x11, 0x0a, 0x1c, 0x43, 0xa1, 0x81, 0x82, 0x6e, 0x81, 0x11,
-  0x14, 0x8c, 0xc8, 0x21, 0x30, 0x81, 0x84, 0xf0, 0x18, 0x44, 0x1a, 0x32,
-  0x21, 0x40, 0x05, 0x00, 0x13, 0xc2, 0x44, 0x84, 0x89, 0x36, 0x21, 0x63,
-  0xc4, 0x24, 0x46, 0x08, 0x40, 0x4a, 0x34, 0x26, 0x21, 0x9f, 0xb9, 0x4d,
-  0xb2, 0x22, 0xb2, 0x8c, 0x61, 0x42, 0x4c, 0x07, 0x47, 0x55, 0x37, 0x52,
-  0x4b, 0x42, 0x15, 0xb9, 0x28, 0x81, 0x79, 0xc1, 0xf8, 0xa1, 0x54, 0x97,
-  0x21, 0x97, 0x9a, 0x12, 0x26, 0xe9, 0x1c, 0x69, 0xe5, 0x16, 0xf8, 0xc1,
-  0x88, 0xad, 0x41, 0x9d, 0x42, 0x5c, 0x7a, 0x22, 0xa2, 0x14, 0x8c, 0xb2,
-  0x48, 0xe1, 0xb8, 0x33, 0x4d, 0xf3, 0xe9, 0x42, 0xf1, 0x52, 0x18, 0x81,
-  0x28, 0x27, 0x25, 0x2b, 0x87, 0x8b, 0x23, 0xc1, 0x87, 0x4c, 0x28, 0x8e,
-  0xde, 0x89, 0xf1, 0x99, 0x95, 0x17, 0x42, 0x46, 0x94, 0x68, 0x49, 0x54,
-  0x31, 0x5e, 0x72, 0x2f, 0xa4, 0x58, 0x84, 0x1e, 0x62, 0xf8, 0x4b, 0x29,
-  0x4a, 0xf4, 0x88, 0x28, 0x86, 0xed, 0x86, 0x78, 0x1c, 0x0f, 0x53, 0x41,
-  0x96, 0x34, 0x11, 0x4a, 0x71, 0x21, 0xa2, 0x51, 0xaf, 0x71, 0xf1, 0x14,
-  0x34, 0x4f, 0x81, 0x1a, 0xcb, 0xa2, 0xa1, 0x9c, 0xa1, 0x74, 0xff, 0x56,
-  0x88, 0x71, 0x1a, 0x14, 0x42, 0xb1, 0x28, 0xe2, 0x85, 0xc1, 0xb9, 0x26,
-  0x08, 0x1d, 0x29, 0x27, 0x12, 0x2e, 0xa8, 0xaf, 0x44, 0xc4, 0x49, 0x4e,
-  0xc9, 0x8b, 0xa4, 0xcd, 0xc4, 0xce, 0xcb, 0x5f, 0x25, 0xdc, 0x55, 0x4c,
-  0x93, 0x91, 0x3f, 0x51, 0xf8, 0x21, 0xa1, 0x46, 0xb5, 0x38, 0x22, 0x13,
-  0x82, 0xf8, 0x2b, 0xe1, 0x6e, 0x92, 0x8b, 0x8c, 0x83, 0xd5, 0x93, 0xb8,
-  0x2c, 0xf2, 0x28, 0xe4, 0x84, 0x32, 0x46, 0x94, 0x18, 0x25, 0xa4, 0xb1,
-  0x4d, 0x16, 0x8f, 0x32, 0x48, 0xc1, 0x57, 0x3b, 0x23, 0x23, 0x31, 0x34,
-  0x47, 0x41, 0x29, 0xf5, 0x4c, 0x2a, 0x1f, 0x84, 0x32, 0x2a, 0x37, 0x68,
-  0xfe, 0x6c, 0xaf, 0x12, 0xe4, 0x94, 0xb8, 0x42, 0x34, 0x12, 0x8e, 0x2a,
-  0xbf, 0x2c, 0xfa, 0x25, 0x4a, 0x5d, 0xd1, 0x3f, 0x2a, 0xfb, 0x12, 0x51,
-  0x1b, 0x22, 0x62, 0xeb, 0x4c, 0xdd, 0xa5, 0x83, 0x33, 0x18, 0x47, 0x61,
-  0x43, 0x22, 0x02, 0x4f, 0x88, 0xa4, 0x2a, 0x45, 0xf4, 0x82, 0x14, 0x8a,
-  0xf1, 0x89, 0x14, 0x67, 0x58, 0xea, 0xd7, 0x84, 0xf5, 0xb4, 0x52, 0x55,
-  0xf1, 0x87, 0x27, 0x47, 0x24, 0x67, 0x28, 0x70, 0x81, 0xf8, 0x22, 0x18,
-  0x2f, 0x88, 0x1d, 0xe8, 0x48, 0x34, 0x42, 0xcf, 0x4e, 0x79, 0x44, 0x84,
-  0xfd, 0x94, 0x8a, 0x4b, 0xd7, 0x83, 0xb2, 0x8a, 0xf2, 0xa3, 0xcb, 0x20,
-  0x24, 0x02, 0x80, 0x44, 0x03, 0x00, 0x24, 0x60, 0x32, 0x40, 0x22, 0x41,
-  0xa2, 0x41, 0x20, 0x18, 0x28, 0x01, 0x90, 0x28, 0x82, 0x90, 0x11, 0x89,
-  0x12, 0x02, 0x18, 0x00, 0x42, 0x14, 0x10, 0x46, 0x08, 0x80, 0x09, 0x88,
-  0x84, 0x14, 0x82, 0xc0, 0x48, 0x20, 0x48, 0x62, 0x88, 0x20, 0x08, 0x00,
-  0x00, 0x4f, 0x8e, 0x41, 0xf2, 0x51, 0x56, 0x3f, 0x73, 0xb1, 0x32, 0xf1,
-  0x15, 0x35, 0x4f, 0x45, 0xf1, 0x44, 0x47, 0x37, 0x51, 0xdf, 0x42, 0x71,
-  0x28, 0xd4, 0x6c, 0xf8, 0x8b, 0x99, 0x8d, 0x82, 0xaf, 0x85, 0x51, 0x28,
-  0x21, 0x3e, 0x91, 0x1f, 0x1d, 0xff, 0x55, 0x95, 0xef, 0x83, 0xf3, 0x6b,
-  0xc8, 0xbf, 0x8c, 0x78, 0x48, 0xf9, 0x91, 0x81, 0x4d, 0x86, 0xb5, 0x1b,
-  0xfa, 0x51, 0x78, 0x4f, 0xc7, 0xf5, 0xad, 0x89, 0x4f, 0x92, 0xf2, 0x9d,
-  0x91, 0x8f, 0xc9, 0xf7, 0xb4, 0xb4, 0x4f, 0x2d, 0xf5, 0xb4, 0xb6, 0x1b,
-  0x59, 0x1d, 0x11, 0xdf, 0x98, 0xf3, 0xbd, 0x28, 0xc7, 0xc6, 0xd5, 0xfd,
-  0xe1, 0x41, 0x5f, 0x74, 0xff, 0x1f, 0x1c, 0xef, 0xd4, 0xd4, 0xa2, 0xf4,
-  0x93, 0xb1, 0xde, 0xd2, 0x3d, 0x92, 0xad, 0x88, 0x45, 0xbc, 0xc6, 0xec,
-  0x48, 0xed, 0x41, 0xdb, 0x44, 0xf9, 0x14, 0x1c, 0x4f, 0x4b, 0xab, 0xab,
-  0xcf, 0xe2, 0x7a, 0x73, 0x42, 0xd2, 0x23, 0xf6, 0x73, 0x53, 0x6b, 0x11,
-  0x5f, 0x51, 0xf5, 0x54, 0x14, 0x5f, 0x45, 0x71, 0x1d, 0xfe, 0x5d, 0x7f,
-  0x6f, 0x61, 0xf1, 0xa7, 0x87, 0xfd, 0xcf, 0xad, 0x8b, 0xaf, 0x8d, 0xff,
-  0x19, 0x18, 0x1f, 0x21, 0xf1, 0x9b, 0x11, 0xde, 0x93, 0xdf, 0x55, 0xf1,
-  0x3e, 0x38, 0xbf, 0x8e, 0xfc, 0x2b, 0x88, 0xbd, 0x59, 0x1f, 0x19, 0xd9,
-  0x75, 0x51, 0xfb, 0xab, 0x98, 0x8f, 0x87, 0xf5, 0x5c, 0xfc, 0x9f, 0xbc,
-  0xfc, 0x6f, 0x69, 0xdf, 0x99, 0xf9, 0xfd, 0xfd, 0x4f, 0x4b, 0xff, 0x14,
-  0x93, 0xcf, 0xab, 0xf3, 0xd4, 0xd6, 0x6f, 0xc9, 0xfd, 0xaf, 0x2c, 0xdf,
-  0xdb, 0x72, 0xc8, 0x78, 0x69, 0xf8, 0x45, 0x42, 0x7f, 0x64, 0xd5, 0x9b,
-  0xf1, 0x4a, 0xc8, 0x6f, 0x6e, 0xfa, 0xd3, 0xb1, 0xae, 0xe2, 0x3d, 0x93,
-  0xaf, 0x88, 0x58, 0xce, 0x29, 0xf8, 0x14, 0x94, 0x4f, 0x47, 0xfd, 0x54,
-  0xd4, 0x1e, 0x1a, 0x6f, 0x42, 0xaa, 0x22, 0x4f, 0x61, 0xf9, 0xd3, 0x86,
-  0x24, 0x6f, 0x44, 0xf4, 0x23, 0x77, 0x2b, 0x11, 0x1f, 0x11, 0xe1, 0x45,
-  0xe1, 0x65, 0xf5, 0x67, 0x44, 0xff, 0x45, 0xf1, 0x1e, 0x35, 0xc7, 0xe8,
-  0xbf, 0xd9, 0x59, 0xa8, 0xaf, 0x85, 0xf3, 0x59, 0x4b, 0x25, 0xf1, 0x81,
-  0x92, 0x7f, 0x55, 0xfd, 0x55, 0x87, 0x6f, 0x4b, 0xfb, 0xb9, 0x28, 0x3f,
-  0x9c, 0xfe, 0x4b, 0x49, 0x9e, 0x81, 0x5d, 0x9f, 0xff, 0xf8, 0xd8, 0x9a,
-  0xfa, 0x19, 0x19, 0x47, 0xa3, 0xff, 0x9a, 0xf8, 0x6d, 0x6d, 0xdf, 0xdd,
-  0xfd, 0xbc, 0xed, 0xcf, 0x4a, 0xf2, 0xd4, 0xd2, 0x5f, 0xdf, 0xff, 0x15,
-  0xd6, 0x5f, 0x31, 0xf5, 0x39, 0x39, 0x5f, 0x1b, 0xf2, 0xd4, 0xf1, 0xdf,
-  0xc8, 0x7d, 0x85, 0xf6, 0x8d, 0x8f, 0xef, 0x99, 0xf1, 0x45, 0xc5, 0x3f,
-  0xec, 0xfc, 0xf3, 0xb3, 0x2f, 0x8d, 0xff, 0x11, 0x93, 0xaf, 0xb9, 0x59,
-  0xac, 0x6b, 0xcc, 0xcf, 0x49, 0xef, 0x4d, 0xf9, 0xc4, 0x94, 0xcf, 0xc8,
-  0xf9, 0xbe, 0xbc, 0x8f, 0x4b, 0xfb, 0x2c, 0xbe, 0x6f, 0xdf, 0x4a, 0xf2,
-  0x57, 0x66, 0x3f, 0x33, 0xb7, 0x36, 0xf1, 0x55, 0x31, 0x4f, 0x64, 0xf5,
-  0x53, 0x56, 0x7f, 0x64, 0xf6, 0x5d, 0x17, 0x6f, 0x51, 0xf1, 0x8d, 0xad,
-  0x97, 0xd8, 0x9f, 0x98, 0xfa, 0xd8, 0xda, 0xbf, 0xb1, 0xf1, 0x52, 0x53,
-  0x3f, 0x3a, 0xf9, 0xd7, 0x76, 0x5f, 0x7d, 0xfd, 0xbf, 0xb8, 0xbf, 0x9a,
-  0x78, 0xab, 0xf9, 0x29, 0x59, 0x1f, 0x19, 0xf9, 0x84, 0xe4, 0xdf, 0xd8,
-  0xf8, 0x39, 0x89, 0x9f, 0x91, 0xf1, 0xb8, 0x3a, 0xbf, 0xbe, 0xf8, 0x6f,
-  0x2d, 0xdf, 0xd9, 0xf9, 0xfc, 0xed, 0x4f, 0x42, 0xfe, 0xd5, 0xd6, 0x5f,
-  0xf2, 0xfa, 0xd5, 0xc7, 0xef, 0x49, 0xf9, 0xae, 0xac, 0xdf, 0xdb, 0xa2,
-  0x1d, 0x9f, 0x8c, 0xfa, 0xa5, 0x86, 0x6f, 0x78, 0xfa, 0x8b, 0x89, 0x3f,
-  0x14, 0xfc, 0xc3, 0x87, 0x3f, 0x37, 0xfb, 0x82, 0xe2, 0x3f, 0x34, 0xfd,
-  0xca, 0x88, 0xa7, 0x82, 0x2b, 0x8c, 0x4f, 0x47, 0xe9, 0x41, 0xf9, 0x54,
-  0x54, 0x4f, 0xc9, 0xf9, 0xa6, 0xe4, 0x87, 0x4a, 0xcf, 0x6a, 0xc9, 0xa8,
-  0xb0, 0x24, 0x01, 0x22, 0x90, 0x14, 0x40, 0x42, 0x08, 0x12, 0x26, 0xa1,
-  0x48, 0x00, 0x14, 0x1b, 0x49, 0x6c, 0x32, 0x11, 0x85, 0xa4, 0x49, 0x81,
-  0x11, 0x10, 0x51, 0x48, 0x21, 0x28, 0x18, 0x87, 0x44, 0x11, 0x42, 0x20,
-  0x84, 0x08, 0x29, 0x08, 0x4b, 0x82, 0x84, 0x98, 0x10, 0x44, 0x58, 0x34,
-  0x00, 0x8e, 0x48, 0xa0, 0x41, 0x34, 0x8c, 0x44, 0x04, 0x44, 0x1a, 0x14,
-  0x28, 0xd8, 0x48, 0x02, 0x2f, 0x8b, 0x0e, 0x86, 0x01, 0x69, 0x21, 0x01,
-  0x13, 0x31, 0x42, 0x19, 0xd2, 0x28, 0x81, 0xc2, 0x81, 0x11, 0x2b, 0x84,
-  0x12, 0x21, 0x10, 0x22, 0x48, 0x12, 0x81, 0xc2, 0x48, 0x4a, 0x63, 0x88,
-  0x28, 0x31, 0x40, 0x9a, 0x28, 0x60, 0x41, 0x2e, 0x88, 0x40, 0x78, 0x11,
-  0x84, 0x04, 0x29, 0xa9, 0x28, 0xc7, 0x16, 0xa0, 0x92, 0x90, 0x9a, 0x11,
-  0x23, 0x22, 0x91, 0x1a, 0x50, 0x18, 0x90, 0x28, 0x2a, 0x04, 0x82, 0x44,
-  0x2a, 0x84, 0x41, 0xf1, 0x1a, 0x39, 0xe0, 0x22, 0xf4, 0x11, 0x24, 0x85,
-  0xf2, 0x11, 0x24, 0x87, 0x26, 0x1f, 0x41, 0x72, 0x4a, 0xd1, 0x41, 0xf2,
-  0x4a, 0x12, 0x1d, 0x24, 0xaf, 0x26, 0x99, 0x21, 0xaf, 0x34, 0x39, 0x95,
-  0xaf, 0x24, 0x39, 0x24, 0xaf, 0x14, 0x39, 0x24, 0x2f, 0x14, 0x79, 0x34,
-  0xd8, 0x12, 0xf9, 0x24, 0x48, 0x8d, 0x91, 0x4f, 0xa2, 0xe4, 0x14, 0xfa,
-  0x24, 0x4a, 0x87, 0x11, 0x6f, 0xa2, 0xe4, 0x19, 0xf2, 0x22, 0x5a, 0x96,
-  0xd5, 0xa2, 0xe4, 0x4d, 0xd2, 0xa2, 0xf4, 0x91, 0x24, 0x2e, 0x42, 0x1f,
-  0x49, 0x52, 0x2a, 0x1f, 0x49, 0x72, 0x4a, 0xf2, 0x91, 0x24, 0xab, 0x14,
-  0x1f, 0x48, 0xb2, 0x6a, 0xd1, 0x41, 0xb2, 0x4a, 0x99, 0x21, 0xab, 0x94,
-  0x5d, 0x48, 0xaf, 0x24, 0x39, 0x24, 0xaf, 0x24, 0x79, 0x24, 0xb8, 0x42,
+  0x00, 0x00, 0x18, 0x33, 0x00, 0xd3, 0xf0, 0xa4, 0x69, 0x24, 0x44, 0x00,
+  0x10, 0x04, 0x32, 0x40, 0x12, 0x28, 0x02, 0xd9, 0x0e, 0xf0, 0x10, 0x00,
+  0x4a, 0x01, 0x88, 0x89, 0x82, 0x08, 0x88, 0x00, 0x00, 0x90, 0x12, 0xc0,
+  0x81, 0x18, 0x88, 0x00, 0x89, 0x01, 0x21, 0x41, 0x40, 0x84, 0x04, 0x52,
+  0x80, 0x21, 0x02, 0x7f, 0xd3, 0x0f, 0xfe, 0x02, 0xd0, 0x10, 0x11, 0x82,
+  0x02, 0x30, 0x48, 0x41, 0x84, 0x00, 0x41, 0x88, 0x20, 0x08, 0xe0, 0x01,
+  0x30, 0x60, 0x84, 0x18, 0xe3, 0x04, 0xf0, 0x0b, 0x23, 0x01, 0x14, 0x12,
+  0x80, 0x05, 0x81, 0x10, 0x02, 0x10, 0x24, 0x05, 0x4a, 0x01, 0x18, 0x00,
+  0xff, 0x2c, 0x09, 0x21, 0x80, 0x01, 0x41, 0xa0, 0x12, 0x00, 0x67, 0x03,
+  0x10, 0x00, 0x7b, 0x00, 0xf0, 0x04, 0xa0, 0x24, 0x58, 0x80, 0x89, 0x82,
+  0x08, 0x49, 0x08, 0x00, 0x00, 0x40, 0x88, 0x08, 0x88, 0x00, 0x12, 0x00,
+  0x44, 0x34, 0x05, 0xf0, 0xff, 0x31, 0x28, 0xf0, 0x87, 0x84, 0x00, 0x40,
+  0x02, 0x41, 0x80, 0x01, 0x41, 0x16, 0x28, 0x02, 0x00, 0x90, 0x41, 0x81,
+  0x10, 0xb8, 0xa1, 0x24, 0x04, 0x89, 0x18, 0xa1, 0x24, 0x11, 0x00, 0x40,
+  0x02, 0x40, 0x84, 0x04, 0x00, 0x20, 0x41, 0x01, 0x18, 0x84, 0x88, 0x12,
+  0x14, 0x80, 0x08, 0x00, 0x4c, 0x02, 0x85, 0x04, 0x88, 0x00, 0xf0, 0xca,
+  0x17, 0x24, 0x18, 0x24, 0x26, 0xc4, 0x18, 0x2b, 0x12, 0x4d, 0x28, 0x28,
+  0x43, 0x83, 0xc2, 0x62, 0x4a, 0x89, 0x81, 0x41, 0x28, 0x01, 0x90, 0x28,
+  0x68, 0x16, 0x68, 0x11, 0x11, 0x59, 0x04, 0x82, 0x22, 0x28, 0x84, 0x5f,
+  0x81, 0xa2, 0x52, 0x91, 0x49, 0x13, 0x28, 0x01, 0x15, 0x64, 0x12, 0x30,
+  0x89, 0x52, 0x2a, 0x44, 0xe1, 0x45, 0x08, 0x46, 0x48, 0x88, 0x44, 0x61,
+  0x11, 0x46, 0x85, 0x05, 0x83, 0x01, 0x52, 0x83, 0x24, 0x11, 0x88, 0xf8,
+  0xf1, 0x49, 0x10, 0x02, 0x23, 0x92, 0x1a, 0x43, 0x03, 0x28, 0x00, 0x87,
+  0x25, 0x42, 0x20, 0x01, 0xc0, 0x41, 0x84, 0x10, 0x98, 0x18, 0x00, 0x42,
+  0x14, 0x68, 0x11, 0x10, 0x98, 0x39, 0x42, 0x81, 0x26, 0x04, 0x42, 0x40,
+  0x01, 0x90, 0x88, 0x4a, 0x21, 0x04, 0x98, 0x82, 0x83, 0x45, 0x81, 0x24,
+  0x28, 0x71, 0x44, 0x01, 0x40, 0x08, 0x58, 0x82, 0x18, 0x00, 0x7d, 0x21,
+  0x80, 0x01, 0x44, 0x24, 0x70, 0x28, 0x24, 0xc1, 0x34, 0x26, 0x24, 0xa2,
+  0x29, 0x12, 0x10, 0x88, 0x01, 0x30, 0x28, 0x4a, 0xe2, 0x16, 0xb8, 0x41,
+  0x41, 0xd1, 0x94, 0x08, 0x88, 0x28, 0x22, 0x10, 0x24, 0x53, 0x12, 0x12,
+  0x85, 0x24, 0x01, 0x44, 0x19, 0x02, 0x13, 0x41, 0x81, 0x62, 0x11, 0x47,
+  0x84, 0x00, 0x81, 0x40, 0x41, 0x01, 0x1a, 0x34, 0x24, 0x12, 0xc4, 0x30,
+  0x48, 0x40, 0x88, 0xf8, 0x6d, 0x39, 0x24, 0xa0, 0x14, 0x16, 0x22, 0x82,
+  0x02, 0x84, 0x4d, 0x18, 0x44, 0x24, 0x18, 0x8c, 0x92, 0x24, 0x1a, 0x14,
+  0x08, 0xe0, 0x11, 0x32, 0x21, 0x4c, 0x21, 0x4a, 0x48, 0x88, 0x03, 0x81,
+  0x94, 0x44, 0x19, 0x01, 0x84, 0x52, 0x12, 0x26, 0x81, 0x84, 0xa2, 0x14,
+  0x11, 0x22, 0x40, 0x82, 0x04, 0x86, 0x01, 0x43, 0x01, 0x40, 0x05, 0x28,
+  0x84, 0x80, 0x01, 0x22, 0x84, 0x00, 0x2f, 0xdb, 0x03, 0x60, 0x84, 0x00,
+  0x18, 0x65, 0x0f, 0xf0, 0x12, 0x49, 0x12, 0x84, 0x91, 0x24, 0x4c, 0x44,
+  0x04, 0x40, 0x21, 0x12, 0x84, 0x81, 0x82, 0x08, 0x2a, 0x04, 0x60, 0x11,
+  0x00, 0x14, 0x00, 0x8c, 0x04, 0x11, 0x40, 0x04, 0x44, 0x48, 0x10, 0x04,
+  0x82, 0x8a, 0x53, 0x04, 0xf0, 0x0b, 0x89, 0x01, 0x4c, 0x83, 0xf4, 0x63,
+  0x64, 0x20, 0x44, 0x04, 0x10, 0x14, 0x04, 0x28, 0x18, 0x22, 0x00, 0x14,
+  0x00, 0x18, 0x20, 0x44, 0x84, 0x82, 0x01, 0x00, 0x14, 0x04, 0xf0, 0x56,
+  0x41, 0x21, 0x00, 0x12, 0x40, 0x08, 0x56, 0x84, 0x01, 0x22, 0x00, 0x40,
+  0x48, 0x98, 0x48, 0x00, 0x41, 0x49, 0x42, 0x88, 0x02, 0x00, 0x81, 0x9f,
+  0xb2, 0x4e, 0x22, 0x94, 0x14, 0x24, 0x22, 0x1e, 0x24, 0x00, 0x89, 0xc1,
+  0x54, 0x22, 0x23, 0x61, 0x82, 0x11, 0x4e, 0x14, 0x81, 0x43, 0x93, 0x44,
+  0x28, 0x14, 0x4c, 0xb2, 0x81, 0x11, 0x18, 0x0c, 0x28, 0x50, 0xc1, 0x46,
+  0x04, 0x90, 0x11, 0x47, 0x25, 0x12, 0x28, 0x48, 0x18, 0x18, 0x84, 0x13,
+  0x02, 0x80, 0x04, 0x13, 0x04, 0x10, 0x68, 0x88, 0x8e, 0x41, 0x80, 0x62,
+  0x84, 0x28, 0x8c, 0x01, 0x10, 0x48, 0x94, 0x48, 0x9f, 0x29, 0x0b, 0x00,
+  0x18, 0x00, 0x44, 0x81, 0x4c, 0x38, 0x05, 0xf0, 0x5c, 0x01, 0xb0, 0x15,
+  0xc4, 0x24, 0x12, 0x28, 0x22, 0x20, 0x02, 0x84, 0x20, 0x62, 0x11, 0x10,
+  0x08, 0x00, 0x20, 0x02, 0x14, 0xb0, 0x44, 0x61, 0x41, 0x21, 0x4c, 0x82,
+  0x08, 0x18, 0x00, 0x45, 0x08, 0x40, 0x14, 0x04, 0x22, 0x89, 0x03, 0x38,
+  0x70, 0xf1, 0x06, 0x44, 0x84, 0x81, 0x41, 0x4c, 0x24, 0x44, 0x14, 0x8c,
+  0xe4, 0x45, 0x02, 0x81, 0x10, 0xb4, 0x14, 0x82, 0x98, 0x44, 0x4d, 0xa1,
+  0x84, 0x4d, 0x81, 0x17, 0xc4, 0x8c, 0x44, 0x18, 0x11, 0x6c, 0xc2, 0x81,
+  0x41, 0x41, 0x00, 0x48, 0x8c, 0x23, 0x01, 0x28, 0x12, 0x50, 0x48, 0x81,
+  0x10, 0x41, 0x08, 0x91, 0xc0, 0x88, 0x41, 0x89, 0x01, 0x88, 0x81, 0xc0,
+  0x18, 0x40, 0xc8, 0x88, 0x82, 0x18, 0x1d, 0x4d, 0xe7, 0x05, 0xa0, 0x20,
+  0x04, 0x00, 0x28, 0x10, 0x08, 0x20, 0x02, 0x86, 0x01, 0x1a, 0x0e, 0xf0,
+  0xff, 0xff, 0xff, 0xa2, 0x10, 0x04, 0x12, 0x81, 0x26, 0x04, 0x00, 0x42,
+  0x18, 0x81, 0x22, 0x60, 0x14, 0x00, 0x20, 0x8c, 0x28, 0x02, 0x11, 0x00,
+  0x20, 0x82, 0x09, 0x00, 0x60, 0x86, 0x42, 0xff, 0x51, 0x09, 0x00, 0xc0,
+  0x48, 0x84, 0xc4, 0x8c, 0x84, 0x82, 0x81, 0x19, 0x08, 0x41, 0x84, 0x80,
+  0x82, 0x02, 0x40, 0x08, 0x20, 0x32, 0x21, 0x14, 0x00, 0x8b, 0x82, 0x84,
+  0x44, 0x28, 0xd1, 0x10, 0x31, 0x14, 0x49, 0x18, 0x04, 0x14, 0x15, 0x84,
+  0xc2, 0x18, 0x12, 0x12, 0x4c, 0x04, 0x00, 0x80, 0x23, 0x82, 0xa4, 0x48,
+  0x41, 0x86, 0x44, 0x84, 0x04, 0xf0, 0x1f, 0x8d, 0x00, 0x38, 0x48, 0x18,
+  0x22, 0x38, 0x12, 0x00, 0x30, 0x34, 0x10, 0x08, 0x00, 0x81, 0x60, 0x84,
+  0x82, 0xc0, 0x24, 0x84, 0x00, 0x20, 0x01, 0x28, 0x3a, 0x04, 0x22, 0x14,
+  0x83, 0x02, 0x48, 0x00, 0x42, 0x10, 0x45, 0x24, 0xc2, 0x88, 0xa2, 0x4c,
+  0x14, 0x81, 0x48, 0xc4, 0x88, 0x82, 0x88, 0xc9, 0x01, 0x81, 0x12, 0x20,
+  0xc4, 0x28, 0x1f, 0x46, 0x4d, 0xa2, 0x28, 0x80, 0x81, 0x31, 0x48, 0x58,
+  0x44, 0x12, 0x52, 0xc0, 0x18, 0x16, 0x48, 0x08, 0x49, 0x26, 0x04, 0x28,
+  0x14, 0x81, 0x5c, 0x44, 0x08, 0x60, 0x42, 0x50, 0x18, 0x90, 0x14, 0x83,
+  0x92, 0x48, 0x82, 0xc0, 0x8c, 0x48, 0x20, 0x22, 0x08, 0x18, 0x1a, 0xb6,
+  0x21, 0x48, 0x28, 0x12, 0x28, 0xc4, 0xc8, 0x86, 0x09, 0x81, 0x28, 0x82,
+  0x80, 0x22, 0x01, 0x82, 0x88, 0x46, 0xf1, 0x96, 0x96, 0x00, 0x40, 0x28,
+  0x02, 0x10, 0x48, 0x08, 0x00, 0x48, 0x28, 0x28, 0x80, 0x03, 0x80, 0xb9,
+  0x24, 0x11, 0x08, 0x11, 0x10, 0x89, 0x11, 0x64, 0x81, 0x48, 0x88, 0x43,
+  0x41, 0x18, 0x04, 0x11, 0x10, 0x31, 0x18, 0x22, 0x00, 0x81, 0x90, 0x18,
+  0x10, 0x28, 0x02, 0x18, 0x82, 0x44, 0x00, 0x80, 0x02, 0x68, 0x45, 0x08,
+  0x5f, 0xc2, 0x0b, 0x44, 0x49, 0xc3, 0x44, 0x80, 0x21, 0x22, 0x04, 0x41,
+  0x41, 0x60, 0x4a, 0x48, 0x16, 0x04, 0x50, 0x48, 0x5d, 0x88, 0x4c, 0x42,
+  0x01, 0x49, 0x23, 0x88, 0x0a, 0x44, 0x88, 0x4c, 0x02, 0x00, 0x50, 0x18,
+  0x18, 0x22, 0x6a, 0x01, 0x2e, 0x44, 0x11, 0xa8, 0x44, 0x48, 0x22, 0x44,
+  0x28, 0x28, 0x10, 0xe4, 0x48, 0x12, 0x44, 0x88, 0xc2, 0x24, 0x89, 0x08,
+  0x8b, 0x24, 0x80, 0x92, 0x28, 0x3f, 0xcc, 0x03, 0x29, 0x06, 0x24, 0x4c,
+  0x04, 0x00, 0x16, 0x04, 0x00, 0x20, 0xa1, 0x81, 0x12, 0x18, 0x16, 0x81,
+  0x21, 0x82, 0xa1, 0x81, 0x18, 0x41, 0xc1, 0x88, 0x81, 0x18, 0x12, 0x66,
+  0x88, 0x45, 0x31, 0x14, 0x18, 0x5c, 0x04, 0xc0, 0x14, 0x18, 0x18, 0x66,
+  0x84, 0x94, 0x14, 0x4f, 0x18, 0x61, 0x44, 0x48, 0x88, 0x42, 0x40, 0x21,
+  0x01, 0x84, 0x8c, 0x94, 0x14, 0x49, 0x21, 0x54, 0x84, 0x44, 0xf0, 0xaf,
+  0x8d, 0x40, 0x0a, 0x4c, 0x14, 0x88, 0x12, 0x28, 0x01, 0x00, 0x2a, 0x44,
+  0x04, 0x28, 0x40, 0x04, 0x84, 0x00, 0x80, 0x34, 0x32, 0x80, 0x23, 0x81,
+  0x08, 0x11, 0x41, 0x8c, 0x84, 0x44, 0x81, 0xc2, 0x14, 0xc4, 0x90, 0x44,
+  0x41, 0x81, 0x14, 0x00, 0x10, 0x04, 0x15, 0x04, 0x8a, 0x42, 0x44, 0x08,
+  0x00, 0x83, 0xb8, 0x94, 0x02, 0x21, 0x41, 0x9f, 0xee, 0x02, 0x22, 0x43,
+  0x58, 0x28, 0x1a, 0xa2, 0x22, 0x56, 0x58, 0x84, 0x44, 0x44, 0x88, 0x5e,
+  0x38, 0x84, 0xf0, 0x84, 0x14, 0x1a, 0xa1, 0x11, 0x5c, 0x31, 0x99, 0x4b,
+  0x12, 0x1f, 0x41, 0xe9, 0xc4, 0xf1, 0x28, 0x28, 0x8f, 0x41, 0x59, 0x15,
+  0x26, 0xfc, 0x18, 0x34, 0x87, 0x91, 0xcf, 0x4b, 0xc3, 0x59, 0xc9, 0xe6,
+  0x85, 0xf2, 0x48, 0x11, 0x1e, 0x18, 0x12, 0x58, 0x49, 0xf4, 0x14, 0x18,
+  0x32, 0x17, 0xc4, 0x6a, 0xd4, 0x44, 0x62, 0x98, 0x85, 0x24, 0xc4, 0x88,
+  0x6a, 0x08, 0x83, 0xf8, 0x81, 0x9c, 0x43, 0x92, 0x28, 0x8e, 0x68, 0x18,
+  0x81, 0x8d, 0x14, 0x5e, 0xec, 0x4d, 0x88, 0x45, 0x89, 0xf4, 0x56, 0xb4,
+  0x24, 0x4d, 0x66, 0x26, 0x44, 0xdc, 0x88, 0x71, 0x4c, 0x98, 0x14, 0x8d,
+  0x44, 0xcb, 0x12, 0x42, 0x4f, 0x42, 0x61, 0x42, 0x89, 0x22, 0x02, 0x47,
+  0x44, 0x43, 0xf4, 0x24, 0x68, 0x4f, 0x52, 0x7a, 0x88, 0x38, 0x88, 0x8b,
+  0x88, 0x49, 0x41, 0xe8, 0x88, 0xd8, 0x1d, 0x58, 0x84, 0x45, 0x04, 0xcf,
+  0x42, 0x62, 0xc7, 0x47, 0x12, 0x4c, 0x64, 0x42, 0x8b, 0x4a, 0xa0, 0x19,
+  0x11, 0x86, 0x04, 0x9f, 0x48, 0x32, 0x41, 0x5e, 0x14, 0x13, 0xe8, 0x41,
+  0x3c, 0x4c, 0x44, 0x1d, 0x89, 0x5c, 0x18, 0xe4, 0xc9, 0x91, 0x84, 0x88,
+  0xcf, 0x81, 0xbc, 0x14, 0x29, 0xb1, 0x28, 0x81, 0xb4, 0x28, 0xfa, 0x44,
+  0x18, 0x8f, 0xc9, 0x08, 0x21, 0x1e, 0x38, 0x43, 0xf1, 0x44, 0x44, 0x1a,
+  0xb4, 0x28, 0xa6, 0x15, 0x1e, 0x48, 0x1a, 0xa5, 0x41, 0x81, 0x6a, 0xf9,
+  0x4c, 0x18, 0x87, 0x81, 0x2a, 0xa2, 0x2a, 0x81, 0x84, 0x1d, 0xe1, 0x47,
+  0x92, 0x5d, 0x41, 0x5e, 0x44, 0x2e, 0x21, 0x2a, 0x82, 0x02, 0x18, 0x84,
+  0x52, 0x8a, 0xd1, 0x48, 0xf4, 0x84, 0x28, 0x81, 0x5d, 0x3d, 0x5f, 0x45,
+  0xe2, 0x46, 0xc2, 0x24, 0xc9, 0xf3, 0x14, 0x21, 0x47, 0x91, 0x3e, 0x41,
+  0xd9, 0xe2, 0x83, 0xf3, 0x8c, 0x38, 0xae, 0x65, 0x89, 0xb6, 0xc8, 0x16,
+  0x25, 0x91, 0x88, 0xa6, 0x38, 0x28, 0xe6, 0x64, 0xc2, 0x4f, 0x8a, 0x18,
+  0x34, 0xe8, 0xce, 0x44, 0x8b, 0x22, 0x3f, 0xb1, 0x01, 0x00, 0x00, 0x10,
+  0x04, 0x00, 0x88, 0xa0, 0x82, 0x80, 0x08, 0x4c, 0x08, 0x28, 0x10, 0x08,
+  0x00, 0x85, 0x24, 0x08, 0x00, 0xa0, 0x28, 0x20, 0x38, 0x24, 0x82, 0x22,
+  0x82, 0x2a, 0x61, 0x88, 0x22, 0x82, 0x18, 0x90, 0x84, 0x84, 0x60, 0x88,
+  0x22, 0x84, 0x00, 0x28, 0x40, 0x24, 0x98, 0x28, 0x82, 0x8d, 0x24, 0x40,
+  0xf4, 0xfe, 0x97, 0x24, 0x4f, 0x67, 0xd5, 0x46, 0xf2, 0x1c, 0x1e, 0xef,
+  0xc3, 0xf3, 0x6c, 0x4c, 0xcf, 0x41, 0xf6, 0x14, 0x5c, 0x16, 0xf8, 0x44,
+  0x44, 0x4f, 0x4c, 0xb9, 0xc8, 0xbd, 0x18, 0xb1, 0xc8, 0x3c, 0x9c, 0x4f,
+  0x49, 0xf1, 0x24, 0x94, 0xdf, 0xd1, 0xbb, 0x18, 0xb9, 0xc1, 0xad, 0x77,
+  0x5f, 0xc1, 0xdd, 0x84, 0xf4, 0x9d, 0x9d, 0xc7, 0xc2, 0x45, 0x5c, 0x44,
+  0xdf, 0x91, 0xf1, 0x18, 0x1c, 0x5f, 0xdc, 0xf8, 0x1c, 0x1c, 0xdf, 0xd9,
+  0xf8, 0xa8, 0xec, 0xae, 0xa8, 0xcf, 0xc6, 0xf5, 0x95, 0x85, 0x4f, 0x4e,
+  0xf8, 0xf1, 0x95, 0xcf, 0xc1, 0xf1, 0xbd, 0x98, 0xcf, 0x8b, 0xbb, 0x24,
+  0xf6, 0xe8, 0xfc, 0x9f, 0x92, 0xb3, 0x34, 0xb3, 0xa4, 0xde, 0x88, 0xa8,
+  0x8e, 0x9f, 0x88, 0x78, 0x8d, 0xfd, 0x1c, 0x9c, 0xcd, 0x84, 0xca, 0xfc,
+  0x54, 0xdc, 0x8f, 0xc3, 0xeb, 0x42, 0xf2, 0x9c, 0x1c, 0x8f, 0x82, 0xb2,
+  0x8c, 0x08, 0xf7, 0x9d, 0x24, 0x4f, 0x25, 0xd5, 0x46, 0xf4, 0x85, 0x00,
+  0xf0, 0x73, 0xf7, 0x5c, 0x54, 0xcf, 0x45, 0xf4, 0x1c, 0x5c, 0x87, 0xc1,
+  0x5a, 0xf5, 0x54, 0x14, 0xcd, 0x1c, 0x8f, 0x8d, 0xad, 0xfd, 0x4b, 0x19,
+  0x4f, 0x4d, 0xf5, 0x14, 0x94, 0xdf, 0xd1, 0xf9, 0xb9, 0x38, 0x1b, 0xfe,
+  0x5f, 0x4f, 0xfe, 0x1d, 0x9e, 0xef, 0x81, 0xf3, 0xbd, 0xbd, 0xff, 0xda,
+  0xd3, 0x55, 0xf2, 0x84, 0x94, 0x5f, 0xd1, 0xe1, 0x43, 0xfb, 0xed, 0x9d,
+  0xcf, 0xc9, 0x7d, 0x15, 0xed, 0x56, 0xf6, 0xa8, 0xa8, 0x8f, 0xce, 0xdc,
+  0xdd, 0x84, 0xf4, 0xd1, 0xd9, 0xcf, 0xc8, 0xf9, 0x39, 0x78, 0xdf, 0x86,
+  0xf2, 0xa5, 0xe5, 0x6e, 0x65, 0x9f, 0x12, 0xf2, 0x7c, 0xbc, 0xcf, 0xca,
+  0xde, 0xc8, 0x78, 0xc9, 0xf9, 0x28, 0x28, 0x97, 0x99, 0x8f, 0xc1, 0xfb,
+  0xac, 0xac, 0xea, 0xee, 0x47, 0xff, 0x38, 0xbc, 0x47, 0x43, 0x4f, 0xe5,
+  0xf5, 0x6a, 0xc8, 0x4b, 0x88, 0x2b, 0x11, 0xe7, 0xea, 0x24, 0x4f, 0x65,
+  0x89, 0x00, 0xf0, 0xff, 0x20, 0x1a, 0xef, 0xc3, 0xf3, 0x58, 0x5c, 0x16,
+  0xf4, 0x14, 0x1c, 0x1a, 0xf1, 0x44, 0x44, 0x4f, 0x44, 0xf4, 0x48, 0x44,
+  0x8f, 0x89, 0xb9, 0x48, 0xf6, 0x1c, 0x98, 0x4f, 0x41, 0xb1, 0x84, 0xf1,
+  0x9d, 0x1d, 0xcf, 0xcb, 0xdb, 0x19, 0xb9, 0x34, 0xfb, 0x15, 0x9d, 0xef,
+  0xc7, 0xf6, 0x95, 0x9d, 0xcf, 0x82, 0xf9, 0xa5, 0x85, 0x4d, 0x84, 0xdf,
+  0xd1, 0xd1, 0xc8, 0xf1, 0x7d, 0x6d, 0x8f, 0xc9, 0xf9, 0x59, 0x4d, 0x8f,
+  0xd2, 0xf6, 0x28, 0x2c, 0xcf, 0xce, 0xfe, 0x15, 0x5d, 0x6a, 0xf6, 0x31,
+  0x71, 0xcf, 0x8b, 0xfb, 0x1d, 0x11, 0xcf, 0xd1, 0xf3, 0x7d, 0x6d, 0x8f,
+  0xdf, 0xff, 0x89, 0x9d, 0x4b, 0x3a, 0x4f, 0xce, 0xfe, 0xe8, 0xec, 0x8b,
+  0xce, 0x9f, 0x88, 0xfa, 0x99, 0x11, 0x8f, 0xc9, 0xf9, 0x8c, 0xac, 0x8a,
+  0xdc, 0x44, 0xfd, 0xa8, 0xbc, 0xcf, 0x43, 0xfb, 0xbc, 0xbc, 0xef, 0x86,
+  0xb6, 0xac, 0xba, 0x24, 0xd3, 0x69, 0x44, 0xf2, 0x76, 0x56, 0x6f, 0x41,
+  0xf3, 0x14, 0x16, 0xef, 0x47, 0xe3, 0x47, 0xe5, 0x45, 0x76, 0x1c, 0xfc,
+  0x18, 0x1c, 0x4f, 0x45, 0xf5, 0xd4, 0xd4, 0x85, 0xfc, 0x58, 0x78, 0xda,
+  0xfd, 0x1c, 0x9c, 0x4f, 0x45, 0xf5, 0xb4, 0x14, 0xdf, 0xd9, 0xf3, 0xb9,
+  0x99, 0x1f, 0x1a, 0xf1, 0x35, 0xa5, 0xdf, 0xd5, 0xfd, 0x5e, 0x7c, 0xdf,
+  0xfb, 0xfb, 0xac, 0x8d, 0x4f, 0x5a, 0xf8, 0x14, 0x84, 0xdf, 0xd1, 0xf1,
+  0xbc, 0x3c, 0xdf, 0xdf, 0xfd, 0x38, 0x58, 0xd7, 0xd1, 0xcf, 0xcc, 0xfc,
+  0x8c, 0x8c, 0xcf, 0xc6, 0xf6, 0x25, 0x6d, 0x8a, 0xfc, 0x99, 0xf1, 0x8f,
+  0x83, 0xb3, 0x59, 0xf3, 0xed, 0xa8, 0xdf, 0xdf, 0xfe, 0x7c, 0x6d, 0xdf,
+  0xda, 0xfa, 0xcc, 0x88, 0xcf, 0xce, 0xfe, 0x68, 0xe8, 0x95, 0xd9, 0x99,
+  0xf2, 0x99, 0x91, 0x8f, 0xc3, 0xf9, 0x8c, 0xac, 0xaa, 0xfa, 0xb4, 0xb4,
+  0xcf, 0xca, 0xfb, 0xb4, 0x94, 0xcf, 0xcb, 0xff, 0xae, 0xcc, 0xcf, 0x6a,
+  0xfa, 0x24, 0x74, 0x1f, 0x99, 0x0d, 0x2a, 0x01, 0x00, 0x22, 0x84, 0x49,
+  0xe1, 0x81, 0x14, 0x24, 0x01, 0x9a, 0x04, 0x86, 0x48, 0x84, 0xc4, 0x24,
+  0x12, 0x8d, 0x24, 0x92, 0x00, 0x28, 0x11, 0xac, 0x0a, 0xf0, 0x5c, 0x98,
+  0x42, 0x22, 0x00, 0x90, 0x14, 0x80, 0x41, 0xc8, 0x81, 0x8c, 0x04, 0x20,
+  0x42, 0x08, 0x82, 0x14, 0x12, 0x20, 0x08, 0x12, 0x00, 0x44, 0x00, 0xf0,
+  0x89, 0x4d, 0x30, 0x84, 0x12, 0x41, 0x16, 0x0c, 0x4c, 0x04, 0x44, 0x41,
+  0x8e, 0x44, 0x22, 0x16, 0x08, 0x82, 0x4c, 0x21, 0x49, 0x34, 0x91, 0x30,
+  0x94, 0x8f, 0x54, 0x21, 0x51, 0x48, 0x22, 0x88, 0x84, 0x87, 0x41, 0x41,
+  0x8a, 0x12, 0xa4, 0x28, 0x8c, 0x39, 0x98, 0x88, 0x44, 0xc8, 0x12, 0x49,
+  0x28, 0x81, 0xe8, 0x48, 0xc2, 0x81, 0x9e, 0x28, 0x41, 0x48, 0xa0, 0x48,
+  0x60, 0x88, 0x85, 0x24, 0x1a, 0x38, 0x24, 0x60, 0x81, 0xe0, 0x88, 0x34,
+  0x48, 0x14, 0x6f, 0x55, 0x05, 0x2c, 0xf4, 0x11, 0x24, 0x85, 0x53, 0x0e,
+  0xb4, 0xf4, 0x11, 0x24, 0xe3, 0xd6, 0x41, 0xb2, 0x6a, 0xd1, 0x41, 0xb2,
+  0x53, 0x0e, 0xf5, 0x15, 0x43, 0xf2, 0x4a, 0x91, 0x4b, 0x42, 0xaf, 0x14,
+  0x7b, 0x24, 0xd8, 0x12, 0xf9, 0x24, 0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x1c,
+  0xf8, 0x24, 0x4a, 0x1e, 0x21, 0x4f, 0xa2, 0x64, 0x19, 0x2e, 0x4a, 0x9e,
+  0x25, 0x2e, 0x4a, 0x9e, 0x51, 0x0e, 0xf0, 0x36, 0x8d, 0x12, 0x1f, 0x49,
+  0x32, 0x48, 0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a, 0xd1, 0xc1,
+  0xf2, 0x4a, 0x91, 0x19, 0xb2, 0x4a, 0x19, 0xb5, 0x4a, 0x39, 0x24, 0xab,
+  0xb4, 0x43, 0xf2, 0x4a, 0x94, 0x47, 0x82, 0xa9, 0xf9, 0x24, 0x48, 0x98,
+  0x4f, 0xa2, 0xb4, 0xc3, 0x06, 0xf0, 0x11, 0x6c, 0x81, 0x1f, 0x41, 0x36,
+  0x48, 0x1b, 0x21, 0xa3, 0x14, 0xb1, 0x4a, 0xd1, 0x41, 0xf2, 0x4a, 0x94,
+  0x19, 0xd2, 0x4a, 0x9b, 0x45, 0x2a, 0x00, 0xf3, 0x3f, 0x42, 0x91, 0x41,
+  0x2f, 0x14, 0x39, 0x24, 0x2d, 0x91, 0x6f, 0x82, 0x94, 0x12, 0x4f, 0x22,
+  0x45, 0xf1, 0x24, 0xda, 0x16, 0xf1, 0x24, 0xca, 0x92, 0x2e, 0x4a, 0x96,
+  0xc5, 0x4b, 0xd6, 0x44, 0x7b, 0x91, 0xcc, 0x42, 0x1f, 0xc9, 0x44, 0x72,
+  0x91, 0x34, 0x48, 0x1f, 0x48, 0x12, 0xda, 0x41, 0xb6, 0x42, 0xd1, 0x41,
+  0xf2, 0x42, 0x14, 0x11, 0x2f, 0x44, 0x1b, 0xb5, 0x4a, 0x0b, 0xab, 0x94,
+  0x22, 0x2b, 0x14, 0x47, 0x88, 0x29, 0x91, 0x46, 0x29, 0xf9, 0xa4, 0x5a,
+  0xaf, 0xf9, 0x0e, 0x3c, 0x09, 0x00, 0x01, 0x00, 0x41, 0x10, 0x02, 0x00,
+  0x88, 0x09, 0x00, 0x10, 0x48, 0x5f, 0x0b, 0x02, 0x01, 0x00, 0xf0, 0xff,
+  0x08, 0x21, 0xe0, 0xa4, 0x44, 0x42, 0x02, 0x89, 0x02, 0x26, 0x98, 0x1c,
+  0x22, 0x81, 0x32, 0x82, 0x89, 0x38, 0x22, 0x84, 0x20, 0x34, 0x31, 0x47,
+  0x11, 0x43, 0xd1, 0x41, 0xe2, 0x88, 0xa2, 0x28, 0x4f, 0x88, 0x42, 0x0c,
+  0x11, 0xc0, 0x1a, 0x11, 0x20, 0x24, 0xa3, 0x21, 0x18, 0x22, 0x38, 0x88,
+  0x41, 0x88, 0x3c, 0x01, 0x12, 0x4a, 0x38, 0x28, 0x14, 0x1c, 0x03, 0x34,
+  0x42, 0x4d, 0x41, 0x42, 0x85, 0x24, 0x04, 0x70, 0x84, 0x98, 0x14, 0x30,
+  0x88, 0x81, 0x5f, 0xbe, 0x04, 0x76, 0xa1, 0x28, 0x20, 0x82, 0x05, 0x14,
+  0x28, 0xa4, 0x26, 0x84, 0x61, 0x28, 0x40, 0xe8, 0x28, 0x01, 0x8c, 0x04,
+  0x83, 0x18, 0x04, 0x48, 0x92, 0x8b, 0x24, 0x82, 0x17, 0x42, 0x30, 0x28,
+  0x8d, 0x82, 0x8c, 0x22, 0x38, 0x88, 0x46, 0x52, 0x48, 0x44, 0x56, 0x11,
+  0x21, 0x92, 0x8c, 0x1d, 0xc8, 0x1d, 0x84, 0x18, 0x88, 0x16, 0x1a, 0x48,
+  0x03, 0x8c, 0x01, 0x82, 0x50, 0x84, 0x32, 0x12, 0x22, 0x90, 0x44, 0x16,
+  0x21, 0x54, 0x3e, 0x24, 0x13, 0xa4, 0x24, 0x8c, 0x22, 0xc2, 0x48, 0x81,
+  0x28, 0xc0, 0x38, 0x2f, 0x42, 0x38, 0x84, 0x29, 0x22, 0x02, 0xd2, 0x1c,
+  0xd3, 0x14, 0x95, 0x14, 0xa6, 0x99, 0x84, 0x2c, 0xc2, 0xcc, 0x47, 0x89,
+  0x8b, 0x61, 0x82, 0x43, 0x3a, 0x18, 0xad, 0x21, 0x8c, 0xe8, 0x84, 0x82,
+  0xb9, 0x19, 0x4a, 0x12, 0x98, 0x1c, 0xca, 0x31, 0x41, 0x82, 0x8e, 0x15,
+  0x8c, 0xa4, 0x81, 0x1a, 0xc4, 0xa8, 0x16, 0xb8, 0x19, 0x12, 0x54, 0x21,
+  0x66, 0xd8, 0x41, 0x24, 0x44, 0x4c, 0x8c, 0x82, 0x41, 0xc8, 0x12, 0x43,
+  0x64, 0x89, 0x83, 0xf5, 0xa9, 0xfb, 0xe0, 0x22, 0x01, 0x00, 0x2a, 0x61,
+  0x41, 0x14, 0x8c, 0x02, 0x90, 0x18, 0x82, 0xa1, 0x84, 0x24, 0x10, 0x08,
+  0x44, 0x26, 0x88, 0x28, 0x02, 0x40, 0x11, 0x01, 0x00, 0x21, 0x28, 0x20,
+  0x35, 0x24, 0x28, 0x14, 0x44, 0x22, 0x84, 0x2d, 0x81, 0x15, 0x84, 0x08,
+  0x34, 0x40, 0x03, 0x81, 0x0f, 0xf0, 0x0c, 0x12, 0x30, 0xa4, 0x44, 0x00,
+  0xb0, 0x85, 0x02, 0x21, 0x00, 0xc4, 0x18, 0x20, 0x02, 0x22, 0x48, 0x22,
+  0x12, 0x34, 0x40, 0x86, 0x84, 0x28, 0xc1, 0x22, 0x12, 0x28, 0x96, 0x0c,
+  0xf0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x40, 0x22, 0x95, 0x94, 0x80, 0x08,
+  0x14, 0x11, 0x00, 0x25, 0xc2, 0x28, 0x8d, 0x91, 0x84, 0x47, 0x24, 0x40,
+  0x32, 0x91, 0x00, 0x00, 0x81, 0x22, 0x20, 0x51, 0x48, 0x82, 0x85, 0x04,
+  0x1f, 0xea, 0x09, 0x17, 0x42, 0x90, 0x31, 0x18, 0x7c, 0xc2, 0x12, 0x45,
+  0x42, 0x18, 0xc6, 0x98, 0x86, 0x02, 0x92, 0x1e, 0x88, 0x13, 0x91, 0x18,
+  0x5d, 0x22, 0x47, 0x84, 0x86, 0x34, 0xe8, 0xcb, 0x48, 0x28, 0x9c, 0x44,
+  0x74, 0x41, 0xc2, 0x41, 0x11, 0x38, 0x47, 0x24, 0x43, 0x2a, 0x32, 0x22,
+  0x46, 0x88, 0x23, 0xe7, 0x28, 0x82, 0xc2, 0x1d, 0x98, 0x66, 0x34, 0x14,
+  0x45, 0xb2, 0x41, 0x31, 0x81, 0xd6, 0x09, 0x60, 0x21, 0x8b, 0x81, 0x45,
+  0xb1, 0x42, 0x68, 0x62, 0x43, 0xc5, 0x2c, 0x4e, 0x84, 0x2a, 0xb4, 0x18,
+  0xa2, 0x24, 0x4b, 0x48, 0xef, 0x2a, 0x01, 0x2d, 0x24, 0x30, 0x11, 0x85,
+  0x44, 0x42, 0x92, 0x24, 0x25, 0x08, 0x5e, 0x88, 0x8a, 0x22, 0x81, 0xf1,
+  0x12, 0x88, 0x80, 0xe1, 0x12, 0xc8, 0x18, 0x2e, 0x86, 0x58, 0x4b, 0xc2,
+  0x28, 0x8c, 0x04, 0x13, 0x14, 0x43, 0x21, 0x41, 0x94, 0xa4, 0x22, 0x9a,
+  0x42, 0x28, 0xa8, 0x61, 0x8a, 0x92, 0x21, 0x19, 0x01, 0x40, 0x68, 0x19,
+  0x9c, 0x61, 0x78, 0x13, 0x05, 0x98, 0x90, 0x98, 0x34, 0x88, 0x24, 0x18,
+  0x4c, 0xc2, 0x54, 0x4c, 0xc2, 0x98, 0x28, 0x48, 0x3f, 0x55, 0x0d, 0x11,
+  0x80, 0x22, 0x61, 0x53, 0x12, 0x00, 0x69, 0x02, 0x10, 0x92, 0x81, 0x70,
+  0x14, 0xd1, 0x82, 0x14, 0x74, 0x42, 0x04, 0x89, 0x4a, 0x08, 0x14, 0x44,
+  0x20, 0x44, 0x84, 0x62, 0x24, 0x24, 0x58, 0x61, 0x48, 0x1a, 0x02, 0x34,
+  0x50, 0x84, 0x8a, 0xf1, 0x42, 0x26, 0x4b, 0x12, 0xc4, 0x23, 0x84, 0x94,
+  0x88, 0x24, 0x11, 0x2c, 0x01, 0x44, 0x42, 0xc3, 0xb2, 0x44, 0x12, 0x28,
+  0x38, 0x48, 0x22, 0x46, 0x9c, 0x84, 0x3f, 0x16, 0x02, 0x50, 0x92, 0x15,
+  0x02, 0x12, 0xc1, 0x89, 0x44, 0x39, 0x15, 0x24, 0x18, 0x2a, 0x94, 0x22,
+  0x24, 0x1a, 0x04, 0x2c, 0x14, 0x04, 0x24, 0x00, 0x44, 0x2d, 0x12, 0x89,
+  0x04, 0x11, 0x44, 0x2d, 0x8a, 0x12, 0x84, 0x2b, 0x12, 0x90, 0x28, 0x49,
+  0x22, 0x94, 0x54, 0x83, 0x61, 0x13, 0x48, 0x8d, 0x24, 0x2c, 0x12, 0x15,
+  0x41, 0x92, 0x84, 0x2c, 0x01, 0x80, 0x04, 0xcb, 0x18, 0x60, 0x8a, 0x40,
+  0x32, 0x48, 0x00, 0xcf, 0x96, 0x48, 0x01, 0x46, 0x2a, 0x32, 0x24, 0x83,
+  0x04, 0x18, 0x29, 0x02, 0xc4, 0x22, 0x89, 0x91, 0xa4, 0x44, 0x45, 0x08,
+  0x12, 0x90, 0x19, 0x18, 0x2a, 0x68, 0x41, 0x16, 0x91, 0x12, 0x88, 0x49,
+  0xc8, 0x18, 0x32, 0x40, 0x44, 0x71, 0x48, 0x22, 0x58, 0x12, 0x21, 0x28,
+  0x8c, 0x74, 0x81, 0x04, 0x12, 0x10, 0x08, 0x42, 0x42, 0x53, 0x21, 0x86,
+  0xf1, 0x44, 0x21, 0x41, 0x2a, 0x08, 0xc4, 0x44, 0x43, 0x42, 0x02, 0x84,
+  0x89, 0xf6, 0xfc, 0x68, 0x20, 0x84, 0x11, 0x68, 0x11, 0x14, 0x13, 0x82,
+  0x02, 0x42, 0x50, 0x81, 0x11, 0x00, 0xd0, 0x14, 0x61, 0x48, 0x18, 0x10,
+  0x48, 0x18, 0x48, 0xd8, 0x1c, 0x64, 0x42, 0xa4, 0x10, 0x38, 0x34, 0x84,
+  0x2a, 0x09, 0x22, 0x40, 0xc1, 0x12, 0x22, 0x24, 0x00, 0x8a, 0x01, 0xac,
+  0x12, 0x18, 0x88, 0x14, 0x01, 0x85, 0x92, 0x18, 0x30, 0x42, 0x80, 0x14,
+  0x48, 0x08, 0x4c, 0x04, 0xce, 0xce, 0x14, 0x46, 0x62, 0x11, 0x27, 0x22,
+  0x47, 0x13, 0x56, 0x68, 0xc2, 0x8d, 0x52, 0x28, 0x16, 0x41, 0xec, 0x81,
+  0xa2, 0x52, 0x50, 0x24, 0x45, 0x48, 0xa4, 0x84, 0x69, 0xc1, 0x11, 0x81,
+  0x84, 0x4c, 0xc1, 0x14, 0x85, 0x94, 0xaa, 0x85, 0x06, 0x49, 0xa2, 0x81,
+  0x4c, 0x31, 0x81, 0x8d, 0x12, 0x26, 0x02, 0x73, 0x82, 0x23, 0x82, 0x31,
+  0x13, 0xc0, 0x24, 0x81, 0x1d, 0x24, 0x14, 0x42, 0x8a, 0x64, 0x22, 0x18,
+  0x4c, 0x34, 0x1c, 0x24, 0x1e, 0x8c, 0x44, 0xcc, 0x7c, 0x28, 0x44, 0x18,
+  0x88, 0x24, 0xf2, 0x6f, 0x1c, 0x00, 0x50, 0x18, 0x40, 0x11, 0x21, 0x52,
+  0x81, 0x43, 0x04, 0x25, 0x51, 0x81, 0x29, 0x08, 0x4a, 0x31, 0x11, 0x4c,
+  0x01, 0x81, 0x12, 0x29, 0x4a, 0x58, 0x18, 0x19, 0x64, 0x44, 0x70, 0x18,
+  0xc1, 0x1a, 0x8d, 0x24, 0x25, 0xb8, 0x18, 0xb2, 0x22, 0x24, 0x68, 0x82,
+  0xc0, 0x42, 0x16, 0xd4, 0x1c, 0x88, 0xa2, 0x14, 0x96, 0x68, 0x22, 0x84,
+  0xa3, 0x44, 0xd8, 0x12, 0xb1, 0x11, 0x04, 0x15, 0x38, 0x42, 0xa2, 0x42,
+  0x84, 0x28, 0x00, 0x48, 0x85, 0xc4, 0x48, 0x7f, 0xae, 0x0a, 0x41, 0x00,
+  0x22, 0xc0, 0x11, 0x37, 0x84, 0x13, 0x02, 0x83, 0x48, 0x44, 0x13, 0x08,
+  0x48, 0x00, 0x00, 0x88, 0x2d, 0x82, 0x22, 0x28, 0x48, 0x11, 0x2a, 0x11,
+  0x12, 0x38, 0x14, 0x48, 0x30, 0x28, 0x60, 0x24, 0x00, 0x19, 0x21, 0xa2,
+  0x41, 0x84, 0x15, 0x82, 0x9c, 0x21, 0x11, 0x28, 0x61, 0xa0, 0x48, 0x11,
+  0x16, 0x08, 0x00, 0x42, 0x98, 0xc8, 0x85, 0x24, 0xd8, 0xa4, 0xf1, 0x49,
+  0x69, 0x00, 0x00, 0x42, 0xa0, 0x24, 0x00, 0x18, 0x43, 0xa1, 0x82, 0x42,
+  0x14, 0x4a, 0x21, 0xf1, 0xa4, 0x11, 0x28, 0x42, 0x25, 0xf1, 0x22, 0x11,
+  0x8c, 0xd2, 0x81, 0xc4, 0x41, 0x24, 0x41, 0x84, 0x22, 0x32, 0x84, 0xc4,
+  0x17, 0x84, 0x43, 0x61, 0x48, 0x40, 0x82, 0x08, 0x50, 0x41, 0x1a, 0x88,
+  0x76, 0x38, 0x42, 0x22, 0x88, 0x08, 0x89, 0x1a, 0xc2, 0x82, 0x90, 0xa8,
+  0x25, 0x88, 0x09, 0x22, 0x10, 0x42, 0x88, 0xf8, 0x95, 0xfe, 0x00, 0x6c,
+  0x02, 0x00, 0x10, 0x41, 0x22, 0x22, 0x83, 0x81, 0x02, 0x11, 0xa5, 0x21,
+  0x18, 0x18, 0x04, 0x21, 0x42, 0x12, 0x60, 0x42, 0x00, 0x00, 0x41, 0x40,
+  0x54, 0x24, 0x32, 0xa0, 0x18, 0x8e, 0x44, 0x28, 0x20, 0x02, 0x00, 0x41,
+  0x12, 0xa0, 0x24, 0x40, 0x08, 0x48, 0x61, 0x80, 0x86, 0x32, 0x84, 0x12,
+  0x12, 0x12, 0x48, 0xdf, 0xd8, 0x48, 0xd2, 0x61, 0x22, 0x21, 0x61, 0x41,
+  0x12, 0x4c, 0x04, 0x43, 0x54, 0x49, 0x24, 0x89, 0x04, 0x4a, 0x88, 0x22,
+  0x08, 0x2d, 0x81, 0x1c, 0x8c, 0x45, 0x61, 0x13, 0x20, 0x94, 0x8a, 0x18,
+  0x19, 0x04, 0x4d, 0x42, 0x50, 0x21, 0x88, 0x2a, 0x04, 0xc4, 0x44, 0x34,
+  0x83, 0xe8, 0x21, 0x2c, 0x68, 0x1c, 0x16, 0x24, 0x19, 0x22, 0x68, 0x48,
+  0x14, 0x00, 0x21, 0x14, 0x82, 0x48, 0x47, 0x28, 0x18, 0x20, 0x24, 0x2e,
+  0x22, 0xfa, 0x23, 0xec, 0x20, 0x18, 0xc8, 0x24, 0x45, 0x41, 0x04, 0x1a,
+  0x46, 0x0a, 0x88, 0x00, 0x22, 0x48, 0x21, 0x8d, 0x21, 0x2c, 0x92, 0x38,
+  0x00, 0x88, 0x91, 0x84, 0x48, 0x44, 0x12, 0x85, 0x01, 0x42, 0x89, 0x46,
+  0x08, 0x4b, 0x1c, 0x84, 0x4e, 0x24, 0x24, 0x00, 0x00, 0x26, 0x54, 0x84,
+  0xa8, 0x13, 0x51, 0x41, 0x8c, 0x84, 0x05, 0x89, 0x04, 0x87, 0x24, 0x89,
+  0x84, 0x43, 0xa4, 0x41, 0x82, 0xa0, 0x18, 0x14, 0xdf, 0x5c, 0x0a, 0x12,
+  0x28, 0x80, 0x82, 0x14, 0x16, 0x58, 0x12, 0x89, 0x31, 0x2a, 0x13, 0x12,
+  0xe3, 0x14, 0xd8, 0x82, 0x92, 0x38, 0x4c, 0x94, 0x1a, 0x44, 0x4d, 0xc8,
+  0x8a, 0x41, 0x08, 0x12, 0x22, 0x88, 0x29, 0x02, 0x1e, 0x22, 0x26, 0x0a,
+  0x58, 0x42, 0x84, 0x48, 0x12, 0x23, 0x61, 0x28, 0x48, 0x87, 0x4c, 0x46,
+  0x24, 0x0c, 0x9d, 0x16, 0x44, 0x21, 0x70, 0x88, 0x61, 0x44, 0x8e, 0x32,
+  0x58, 0x10, 0x04, 0x88, 0x44, 0x16, 0x48, 0x18, 0x28, 0xf2, 0x97, 0x34,
+  0x40, 0x4a, 0x01, 0x00, 0x10, 0xc4, 0x14, 0x00, 0x1e, 0xc8, 0x8b, 0x2c,
+  0xe0, 0x11, 0xc2, 0x42, 0x20, 0x08, 0x21, 0x84, 0x14, 0x42, 0x19, 0x5a,
+  0x14, 0x2a, 0x5c, 0x0d, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x88, 0x82,
+  0x80, 0x08, 0x46, 0x68, 0x11, 0x59, 0x46, 0x31, 0x28, 0xc0, 0x21, 0x40,
+  0x08, 0x82, 0x44, 0xa2, 0x11, 0x83, 0x28, 0x82, 0x1a, 0x28, 0x04, 0x41,
+  0x48, 0x40, 0xb4, 0x4b, 0x0e, 0x16, 0x91, 0x14, 0x69, 0x82, 0x01, 0x90,
+  0x12, 0x29, 0x65, 0x12, 0x45, 0x11, 0x62, 0x88, 0x18, 0x40, 0x41, 0xc8,
+  0x41, 0x27, 0x81, 0x41, 0x28, 0x20, 0x02, 0xa3, 0x18, 0x18, 0x48, 0x18,
+  0x04, 0x00, 0x90, 0x48, 0x47, 0x18, 0x29, 0x34, 0x15, 0x4d, 0x42, 0x19,
+  0x08, 0x41, 0x18, 0x20, 0xd1, 0x24, 0x04, 0x21, 0x2c, 0x22, 0x81, 0x01,
+  0x00, 0x41, 0x4c, 0x23, 0x04, 0x9a, 0x12, 0x52, 0x28, 0x3f, 0x9d, 0x0f,
+  0x2d, 0x68, 0xa0, 0x41, 0x30, 0x14, 0x19, 0x61, 0x42, 0x83, 0x12, 0x04,
+  0x40, 0x54, 0x86, 0x89, 0x22, 0x02, 0xc0, 0x81, 0x13, 0x01, 0x29, 0x85,
+  0x11, 0x0a, 0x1c, 0x43, 0xa1, 0x81, 0x82, 0x6e, 0x81, 0x11, 0x14, 0x8c,
+  0xc8, 0x21, 0x30, 0x81, 0x84, 0xf0, 0x18, 0x44, 0x1a, 0x32, 0x21, 0x40,
+  0x05, 0x00, 0x13, 0xc2, 0x44, 0x84, 0x89, 0x36, 0x21, 0x63, 0xc4, 0x24,
+  0x46, 0x08, 0x40, 0x4a, 0x34, 0x26, 0x21, 0x9f, 0xb9, 0x4d, 0xb2, 0x22,
+  0xb2, 0x8c, 0x61, 0x42, 0x4c, 0x07, 0x47, 0x55, 0x37, 0x52, 0x4b, 0x42,
+  0x15, 0xb9, 0x28, 0x81, 0x79, 0xc1, 0xf8, 0xa1, 0x54, 0x97, 0x21, 0x97,
+  0x9a, 0x12, 0x26, 0xe9, 0x1c, 0x69, 0xe5, 0x16, 0xf8, 0xc1, 0x88, 0xad,
+  0x41, 0x9d, 0x42, 0x5c, 0x7a, 0x22, 0xa2, 0x14, 0x8c, 0xb2, 0x48, 0xe1,
+  0xb8, 0x33, 0x4d, 0xf3, 0xe9, 0x42, 0xf1, 0x52, 0x18, 0x81, 0x28, 0x27,
+  0x25, 0x2b, 0x87, 0x8b, 0x23, 0xc1, 0x87, 0x4c, 0x28, 0x8e, 0xde, 0x89,
+  0xf1, 0x99, 0x95, 0x17, 0x42, 0x46, 0x94, 0x68, 0x49, 0x54, 0x31, 0x5e,
+  0x72, 0x2f, 0xa4, 0x58, 0x84, 0x1e, 0x62, 0xf8, 0x4b, 0x29, 0x4a, 0xf4,
+  0x88, 0x28, 0x86, 0xed, 0x86, 0x78, 0x1c, 0x0f, 0x53, 0x41, 0x96, 0x34,
+  0x11, 0x4a, 0x71, 0x21, 0xa2, 0x51, 0xaf, 0x71, 0xf1, 0x14, 0x34, 0x4f,
+  0x81, 0x1a, 0xcb, 0xa2, 0xa1, 0x9c, 0xa1, 0x74, 0xff, 0x56, 0x88, 0x71,
+  0x1a, 0x14, 0x42, 0xb1, 0x28, 0xe2, 0x85, 0xc1, 0xb9, 0x26, 0x08, 0x1d,
+  0x29, 0x27, 0x12, 0x2e, 0xa8, 0xaf, 0x44, 0xc4, 0x49, 0x4e, 0xc9, 0x8b,
+  0xa4, 0xcd, 0xc4, 0xce, 0xcb, 0x5f, 0x25, 0xdc, 0x55, 0x4c, 0x93, 0x91,
+  0x3f, 0x51, 0xf8, 0x21, 0xa1, 0x46, 0xb5, 0x38, 0x22, 0x13, 0x82, 0xf8,
+  0x2b, 0xe1, 0x6e, 0x92, 0x8b, 0x8c, 0x83, 0xd5, 0x93, 0xb8, 0x2c, 0xf2,
+  0x28, 0xe4, 0x84, 0x32, 0x46, 0x94, 0x18, 0x25, 0xa4, 0xb1, 0x4d, 0x16,
+  0x8f, 0x32, 0x48, 0xc1, 0x57, 0x3b, 0x23, 0x23, 0x31, 0x34, 0x47, 0x41,
+  0x29, 0xf5, 0x4c, 0x2a, 0x1f, 0x84, 0x32, 0x2a, 0x37, 0x68, 0xfe, 0x6c,
+  0xaf, 0x12, 0xe4, 0x94, 0xb8, 0x42, 0x34, 0x12, 0x8e, 0x2a, 0xbf, 0x2c,
+  0xfa, 0x25, 0x4a, 0x5d, 0xd1, 0x3f, 0x2a, 0xfb, 0x12, 0x51, 0x1b, 0x22,
+  0x62, 0xeb, 0x4c, 0xdd, 0xa5, 0x83, 0x33, 0x18, 0x47, 0x61, 0x43, 0x22,
+  0x02, 0x4f, 0x88, 0xa4, 0x2a, 0x45, 0xf4, 0x82, 0x14, 0x8a, 0xf1, 0x89,
+  0x14, 0x67, 0x58, 0xea, 0xd7, 0x84, 0xf5, 0xb4, 0x52, 0x55, 0xf1, 0x87,
+  0x27, 0x47, 0x24, 0x67, 0x28, 0x70, 0x81, 0xf8, 0x22, 0x18, 0x2f, 0x88,
+  0x1d, 0xe8, 0x48, 0x34, 0x42, 0xcf, 0x4e, 0x79, 0x44, 0x84, 0xfd, 0x94,
+  0x8a, 0x4b, 0xd7, 0x83, 0xb2, 0x8a, 0xf2, 0xa3, 0xcb, 0x20, 0x24, 0x02,
+  0x80, 0x44, 0x03, 0x00, 0x24, 0x60, 0x32, 0x40, 0x22, 0x41, 0xa2, 0x41,
+  0x20, 0x18, 0x28, 0x01, 0x90, 0x28, 0x82, 0x90, 0x11, 0x89, 0x12, 0x02,
+  0x18, 0x00, 0x42, 0x14, 0x10, 0x46, 0x08, 0x80, 0x09, 0x88, 0x84, 0x14,
+  0x82, 0xc0, 0x48, 0x20, 0x48, 0x62, 0x88, 0x20, 0x08, 0x00, 0x00, 0x4f,
+  0x8e, 0x41, 0xf2, 0x51, 0x56, 0x3f, 0x73, 0xb1, 0x32, 0xf1, 0x15, 0x35,
+  0x4f, 0x45, 0xf1, 0x44, 0x47, 0x37, 0x51, 0xdf, 0x42, 0x71, 0x28, 0xd4,
+  0x6c, 0xf8, 0x8b, 0x99, 0x8d, 0x82, 0xaf, 0x85, 0x51, 0x28, 0x21, 0x3e,
+  0x91, 0x1f, 0x1d, 0xff, 0x55, 0x95, 0xef, 0x83, 0xf3, 0x6b, 0xc8, 0xbf,
+  0x8c, 0x78, 0x48, 0xf9, 0x91, 0x81, 0x4d, 0x86, 0xb5, 0x1b, 0xfa, 0x51,
+  0x78, 0x4f, 0xc7, 0xf5, 0xad, 0x89, 0x4f, 0x92, 0xf2, 0x9d, 0x91, 0x8f,
+  0xc9, 0xf7, 0xb4, 0xb4, 0x4f, 0x2d, 0xf5, 0xb4, 0xb6, 0x1b, 0x59, 0x1d,
+  0x11, 0xdf, 0x98, 0xf3, 0xbd, 0x28, 0xc7, 0xc6, 0xd5, 0xfd, 0xe1, 0x41,
+  0x5f, 0x74, 0xff, 0x1f, 0x1c, 0xef, 0xd4, 0xd4, 0xa2, 0xf4, 0x93, 0xb1,
+  0xde, 0xd2, 0x3d, 0x92, 0xad, 0x88, 0x45, 0xbc, 0xc6, 0xec, 0x48, 0xed,
+  0x41, 0xdb, 0x44, 0xf9, 0x14, 0x1c, 0x4f, 0x4b, 0xab, 0xab, 0xcf, 0xe2,
+  0x7a, 0x73, 0x42, 0xd2, 0x23, 0xf6, 0x73, 0x53, 0x6b, 0x11, 0x5f, 0x51,
+  0xf5, 0x54, 0x14, 0x5f, 0x45, 0x71, 0x1d, 0xfe, 0x5d, 0x7f, 0x6f, 0x61,
+  0xf1, 0xa7, 0x87, 0xfd, 0xcf, 0xad, 0x8b, 0xaf, 0x8d, 0xff, 0x19, 0x18,
+  0x1f, 0x21, 0xf1, 0x9b, 0x11, 0xde, 0x93, 0xdf, 0x55, 0xf1, 0x3e, 0x38,
+  0xbf, 0x8e, 0xfc, 0x2b, 0x88, 0xbd, 0x59, 0x1f, 0x19, 0xd9, 0x75, 0x51,
+  0xfb, 0xab, 0x98, 0x8f, 0x87, 0xf5, 0x5c, 0xfc, 0x9f, 0xbc, 0xfc, 0x6f,
+  0x69, 0xdf, 0x99, 0xf9, 0xfd, 0xfd, 0x4f, 0x4b, 0xff, 0x14, 0x93, 0xcf,
+  0xab, 0xf3, 0xd4, 0xd6, 0x6f, 0xc9, 0xfd, 0xaf, 0x2c, 0xdf, 0xdb, 0x72,
+  0xc8, 0x78, 0x69, 0xf8, 0x45, 0x42, 0x7f, 0x64, 0xd5, 0x9b, 0xf1, 0x4a,
+  0xc8, 0x6f, 0x6e, 0xfa, 0xd3, 0xb1, 0xae, 0xe2, 0x3d, 0x93, 0xaf, 0x88,
+  0x58, 0xce, 0x29, 0xf8, 0x14, 0x94, 0x4f, 0x47, 0xfd, 0x54, 0xd4, 0x1e,
+  0x1a, 0x6f, 0x42, 0xaa, 0x22, 0x4f, 0x61, 0xf9, 0xd3, 0x86, 0x24, 0x6f,
+  0x44, 0xf4, 0x23, 0x77, 0x2b, 0x11, 0x1f, 0x11, 0xe1, 0x45, 0xe1, 0x65,
+  0xf5, 0x67, 0x44, 0xff, 0x45, 0xf1, 0x1e, 0x35, 0xc7, 0xe8, 0xbf, 0xd9,
+  0x59, 0xa8, 0xaf, 0x85, 0xf3, 0x59, 0x4b, 0x25, 0xf1, 0x81, 0x92, 0x7f,
+  0x55, 0xfd, 0x55, 0x87, 0x6f, 0x4b, 0xfb, 0xb9, 0x28, 0x3f, 0x9c, 0xfe,
+  0x4b, 0x49, 0x9e, 0x81, 0x5d, 0x9f, 0xff, 0xf8, 0xd8, 0x9a, 0xfa, 0x19,
+  0x19, 0x47, 0xa3, 0xff, 0x9a, 0xf8, 0x6d, 0x6d, 0xdf, 0xdd, 0xfd, 0xbc,
+  0xed, 0xcf, 0x4a, 0xf2, 0xd4, 0xd2, 0x5f, 0xdf, 0xff, 0x15, 0xd6, 0x5f,
+  0x31, 0xf5, 0x39, 0x39, 0x5f, 0x1b, 0xf2, 0xd4, 0xf1, 0xdf, 0xc8, 0x7d,
+  0x85, 0xf6, 0x8d, 0x8f, 0xef, 0x99, 0xf1, 0x45, 0xc5, 0x3f, 0xec, 0xfc,
+  0xf3, 0xb3, 0x2f, 0x8d, 0xff, 0x11, 0x93, 0xaf, 0xb9, 0x59, 0xac, 0x6b,
+  0xcc, 0xcf, 0x49, 0xef, 0x4d, 0xf9, 0xc4, 0x94, 0xcf, 0xc8, 0xf9, 0xbe,
+  0xbc, 0x8f, 0x4b, 0xfb, 0x2c, 0xbe, 0x6f, 0xdf, 0x4a, 0xf2, 0x57, 0x66,
+  0x3f, 0x33, 0xb7, 0x36, 0xf1, 0x55, 0x31, 0x4f, 0x64, 0xf5, 0x53, 0x56,
+  0x7f, 0x64, 0xf6, 0x5d, 0x17, 0x6f, 0x51, 0xf1, 0x8d, 0xad, 0x97, 0xd8,
+  0x9f, 0x98, 0xfa, 0xd8, 0xda, 0xbf, 0xb1, 0xf1, 0x52, 0x53, 0x3f, 0x3a,
+  0xf9, 0xd7, 0x76, 0x5f, 0x7d, 0xfd, 0xbf, 0xb8, 0xbf, 0x9a, 0x78, 0xab,
+  0xf9, 0x29, 0x59, 0x1f, 0x19, 0xf9, 0x84, 0xe4, 0xdf, 0xd8, 0xf8, 0x39,
+  0x89, 0x9f, 0x91, 0xf1, 0xb8, 0x3a, 0xbf, 0xbe, 0xf8, 0x6f, 0x2d, 0xdf,
+  0xd9, 0xf9, 0xfc, 0xed, 0x4f, 0x42, 0xfe, 0xd5, 0xd6, 0x5f, 0xf2, 0xfa,
+  0xd5, 0xc7, 0xef, 0x49, 0xf9, 0xae, 0xac, 0xdf, 0xdb, 0xa2, 0x1d, 0x9f,
+  0x8c, 0xfa, 0xa5, 0x86, 0x6f, 0x78, 0xfa, 0x8b, 0x89, 0x3f, 0x14, 0xfc,
+  0xc3, 0x87, 0x3f, 0x37, 0xfb, 0x82, 0xe2, 0x3f, 0x34, 0xfd, 0xca, 0x88,
+  0xa7, 0x82, 0x2b, 0x8c, 0x4f, 0x47, 0xe9, 0x41, 0xf9, 0x54, 0x54, 0x4f,
+  0xc9, 0xf9, 0xa6, 0xe4, 0x87, 0x4a, 0xcf, 0x6a, 0xc9, 0xa8, 0xb0, 0x24,
+  0x01, 0x22, 0x90, 0x14, 0x40, 0x42, 0x08, 0x12, 0x26, 0xa1, 0x48, 0x00,
+  0x14, 0x1b, 0x49, 0x6c, 0x32, 0x11, 0x85, 0xa4, 0x49, 0x81, 0x11, 0x10,
+  0x51, 0x48, 0x21, 0x28, 0x18, 0x87, 0x44, 0x11, 0x42, 0x20, 0x84, 0x08,
+  0x29, 0x08, 0x4b, 0x82, 0x84, 0x98, 0x10, 0x44, 0x58, 0x34, 0x00, 0x8e,
+  0x48, 0xa0, 0x41, 0x34, 0x8c, 0x44, 0x04, 0x44, 0x1a, 0x14, 0x28, 0xd8,
+  0x48, 0x02, 0x2f, 0x8b, 0x0e, 0x86, 0x01, 0x69, 0x21, 0x01, 0x13, 0x31,
+  0x42, 0x19, 0xd2, 0x28, 0x81, 0xc2, 0x81, 0x11, 0x2b, 0x84, 0x12, 0x21,
+  0x10, 0x22, 0x48, 0x12, 0x81, 0xc2, 0x48, 0x4a, 0x63, 0x88, 0x28, 0x31,
+  0x40, 0x9a, 0x28, 0x60, 0x41, 0x2e, 0x88, 0x40, 0x78, 0x11, 0x84, 0x04,
+  0x29, 0xa9, 0x28, 0xc7, 0x16, 0xa0, 0x92, 0x90, 0x9a, 0x11, 0x23, 0x22,
+  0x91, 0x1a, 0x50, 0x18, 0x90, 0x28, 0x2a, 0x04, 0x82, 0x44, 0x2a, 0x84,
+  0x41, 0xf1, 0x1a, 0x39, 0xe0, 0x22, 0x33, 0x0b, 0x51, 0x87, 0x26, 0x1f,
+  0x41, 0x72, 0xbd, 0x0a, 0xf1, 0x08, 0x12, 0x1d, 0x24, 0xaf, 0x26, 0x99,
+  0x21, 0xaf, 0x34, 0x39, 0x95, 0xaf, 0x24, 0x39, 0x24, 0xaf, 0x14, 0x39,
+  0x24, 0x2f, 0x14, 0x79, 0x34, 0x36, 0x0b, 0xf1, 0x1e, 0x8d, 0x91, 0x4f,
+  0xa2, 0xe4, 0x14, 0xfa, 0x24, 0x4a, 0x87, 0x11, 0x6f, 0xa2, 0xe4, 0x19,
+  0xf2, 0x22, 0x5a, 0x96, 0xd5, 0xa2, 0xe4, 0x4d, 0xd2, 0xa2, 0xf4, 0x91,
+  0x24, 0x2e, 0x42, 0x1f, 0x49, 0x52, 0x2a, 0x1f, 0x49, 0x72, 0x4a, 0xf2,
+  0x91, 0x24, 0xab, 0x14, 0x1f, 0x48, 0x7f, 0x0b, 0x10, 0x4a, 0x7f, 0x0b,
+  0x21, 0x5d, 0x48, 0x4a, 0x00, 0xf0, 0x2c, 0x24, 0x79, 0x24, 0xb8, 0x42,
   0x79, 0x24, 0x98, 0xb2, 0x4f, 0x82, 0xa4, 0x94, 0x4f, 0xa2, 0xd4, 0x85,
   0x05, 0x24, 0x1f, 0xc1, 0x56, 0x38, 0x1e, 0x64, 0x81, 0x16, 0x34, 0x4a,
   0x19, 0xb2, 0x4a, 0x91, 0x21, 0x2f, 0x44, 0x19, 0xf1, 0x42, 0xb4, 0x51,
   0xab, 0x24, 0x43, 0xd2, 0x1a, 0x38, 0x24, 0x2f, 0x14, 0x31, 0x24, 0x2d,
-  0x81, 0x6f, 0x82, 0xc4, 0x11, 0x6f, 0x22, 0x45, 0xf1, 0x24, 0x98, 0xf0,
+  0x81, 0x6f, 0x82, 0xc4, 0x11, 0x6f, 0x3a, 0x0b, 0xf0, 0x20, 0x98, 0xf0,
   0x24, 0xc2, 0x12, 0xac, 0x64, 0x58, 0x9c, 0xa4, 0x28, 0xbc, 0x64, 0xc9,
   0x48, 0x9e, 0x4c, 0xf0, 0x91, 0x64, 0x83, 0xc4, 0x24, 0xa3, 0xd4, 0x41,
   0xb2, 0x42, 0x41, 0xf4, 0x4a, 0x14, 0x28, 0x2d, 0xb4, 0x51, 0xab, 0x34,
-  0x43, 0xa2, 0x14, 0x43, 0x62, 0x24, 0x45, 0xd8, 0x22, 0xf9, 0x24, 0x48,
-  0x98, 0x2f, 0xa2, 0x11, 0x0a, 0x84, 0x21, 0x48, 0x28, 0x00, 0x00, 0x00,
-  0x40, 0x04, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x11, 0x10, 0x02, 0x00, 0x00, 0x40, 0x84, 0x04, 0x00,
-  0x00, 0x12, 0x00, 0x00, 0x70, 0xb4, 0x05, 0x23, 0x01, 0x99, 0x01, 0x81,
-  0x4c, 0x52, 0x14, 0x24, 0x00, 0x16, 0x61, 0x81, 0x50, 0x18, 0x81, 0x63,
-  0x98, 0x12, 0x67, 0x88, 0x60, 0x22, 0x60, 0x48, 0x22, 0xa6, 0x01, 0x61,
-  0x12, 0x25, 0x34, 0x12, 0x41, 0x4b, 0x41, 0xc4, 0x28, 0x81, 0x2a, 0x54,
-  0x12, 0x4b, 0x21, 0x50, 0x42, 0x54, 0x4c, 0xe1, 0x12, 0x48, 0x84, 0x01,
-  0x89, 0x21, 0x81, 0x81, 0x11, 0x14, 0xa4, 0x14, 0x43, 0x04, 0x44, 0x29,
-  0x81, 0x08, 0x22, 0x6f, 0x8f, 0x07, 0x42, 0xa6, 0x11, 0x72, 0x12, 0x94,
-  0x31, 0x17, 0xa1, 0x24, 0xc3, 0x62, 0x11, 0x76, 0x61, 0x28, 0x22, 0x83,
-  0x48, 0x22, 0x88, 0x12, 0x89, 0x92, 0x81, 0x4c, 0x91, 0x11, 0x42, 0x60,
-  0x84, 0x29, 0x22, 0x34, 0x41, 0x22, 0x1d, 0xc4, 0x2b, 0x24, 0xc0, 0x12,
-  0x49, 0x2c, 0xf4, 0x12, 0x84, 0x2c, 0x04, 0x18, 0x98, 0x20, 0x92, 0x42,
-  0x13, 0xc2, 0x82, 0x47, 0x9a, 0x8a, 0x74, 0x42, 0x91, 0x41, 0x80, 0xc4,
-  0x22, 0x90, 0x28, 0x58, 0x21, 0x88, 0x2e, 0x4c, 0x1c, 0x81, 0xf4, 0x24,
-  0xee, 0x24, 0x4a, 0x61, 0x34, 0x16, 0x23, 0x41, 0xe8, 0x51, 0x02, 0x43,
-  0x32, 0x12, 0x22, 0x5b, 0x18, 0x8b, 0x12, 0xa2, 0x85, 0x51, 0x22, 0x2c,
-  0x72, 0x19, 0x92, 0xa4, 0x19, 0x18, 0xd4, 0x23, 0xc1, 0x44, 0x22, 0x1f,
-  0x85, 0x78, 0x22, 0x22, 0x98, 0x11, 0x47, 0x22, 0x1f, 0x41, 0x28, 0x66,
-  0x41, 0x11, 0x29, 0x3a, 0x48, 0xeb, 0xd2, 0x11, 0x2b, 0x25, 0x90, 0x94,
-  0x11, 0x47, 0x22, 0x1b, 0x4a, 0x17, 0x42, 0x8a, 0xe1, 0x52, 0xd8, 0x84,
-  0x9d, 0x12, 0x2e, 0x51, 0x80, 0xc4, 0x24, 0x48, 0x4f, 0x84, 0x82, 0x15,
-  0xd2, 0x22, 0x51, 0x84, 0x18, 0x1a, 0xd4, 0x65, 0x0a, 0x80, 0x12, 0x48,
-  0xe4, 0x12, 0x41, 0x58, 0x36, 0x84, 0x14, 0x1b, 0x41, 0x24, 0x10, 0x08,
-  0x89, 0x38, 0x84, 0x40, 0x08, 0x32, 0x20, 0x08, 0x22, 0x90, 0x44, 0x42,
-  0x21, 0x42, 0x61, 0x42, 0x4d, 0x18, 0x46, 0x04, 0x90, 0x42, 0x44, 0x2c,
-  0x01, 0x41, 0x12, 0x00, 0x24, 0x84, 0x90, 0x41, 0x20, 0x41, 0x04, 0x29,
-  0x01, 0x10, 0x84, 0xa8, 0x4a, 0x20, 0xb2, 0x2b, 0x0d, 0x45, 0x01, 0x25,
-  0x01, 0x14, 0x50, 0x14, 0x40, 0x01, 0x81, 0xc0, 0x83, 0x10, 0x18, 0xc1,
-  0x83, 0x40, 0x02, 0x44, 0x82, 0x40, 0x08, 0x48, 0x10, 0x01, 0x49, 0x01,
-  0x25, 0x32, 0x88, 0x00, 0x21, 0x00, 0x00, 0x11, 0x80, 0x04, 0x48, 0x18,
-  0xc0, 0x11, 0x00, 0x48, 0x24, 0x16, 0x08, 0x00, 0x00, 0x48, 0xff, 0xb4,
-  0x08, 0x90, 0x12, 0x00, 0x21, 0x26, 0x44, 0x58, 0x86, 0x81, 0x25, 0x52,
-  0x21, 0x00, 0x85, 0x64, 0x21, 0x81, 0x12, 0x9b, 0x24, 0x83, 0xb8, 0x48,
-  0x32, 0x8a, 0x44, 0x4c, 0x84, 0xe2, 0x18, 0x54, 0x41, 0x1d, 0x48, 0x28,
-  0xcd, 0x42, 0x28, 0x4e, 0x81, 0x88, 0x48, 0x88, 0x4a, 0x41, 0x82, 0x38,
-  0x94, 0x34, 0xc8, 0x4a, 0x0a, 0xc1, 0x41, 0x30, 0x81, 0x33, 0x0c, 0x59,
-  0x09, 0xa5, 0x11, 0x88, 0x94, 0x2e, 0x13, 0x15, 0x24, 0x54, 0x48, 0xf0,
-  0x38, 0x44, 0x00, 0x27, 0x21, 0x00, 0x14, 0x50, 0x24, 0x81, 0x81, 0x10,
-  0x03, 0x10, 0x82, 0x11, 0x49, 0xe1, 0x82, 0x84, 0x98, 0x42, 0x21, 0x82,
-  0x44, 0xe0, 0x14, 0x18, 0x81, 0x44, 0x61, 0xe4, 0x12, 0x82, 0x82, 0x20,
-  0x08, 0x20, 0x38, 0x14, 0x10, 0xb2, 0xa1, 0x04, 0xc3, 0x04, 0x42, 0x19,
-  0x08, 0x11, 0x88, 0x24, 0x85, 0x41, 0x38, 0x12, 0xe3, 0x82, 0x14, 0x04,
-  0xc1, 0xf0, 0x7c, 0x25, 0x40, 0x05, 0x11, 0x24, 0xc0, 0x24, 0x85, 0x11,
-  0x54, 0x21, 0x40, 0x0a, 0x19, 0x18, 0x5c, 0x28, 0xc0, 0x92, 0x11, 0x84,
-  0x83, 0xd2, 0x84, 0x48, 0x24, 0x64, 0x82, 0x60, 0x44, 0x15, 0x28, 0x02,
-  0x49, 0x92, 0x41, 0x21, 0x2f, 0x88, 0x04, 0x58, 0x25, 0x02, 0x88, 0x14,
-  0xc8, 0x00, 0x10, 0x04, 0x18, 0x2f, 0x14, 0x88, 0x71, 0x14, 0x01, 0x42,
-  0x60, 0x84, 0x60, 0x11, 0x20, 0x04, 0x48, 0x5f, 0xe8, 0x46, 0x82, 0x44,
-  0x2c, 0x03, 0x80, 0x81, 0x01, 0x14, 0xc5, 0x22, 0x82, 0x11, 0x56, 0x12,
-  0x84, 0x00, 0x00, 0x84, 0x88, 0x40, 0xd4, 0x42, 0x31, 0x82, 0x11, 0x00,
-  0x20, 0x42, 0x2a, 0x14, 0xb4, 0x82, 0x82, 0xa4, 0x48, 0x3e, 0x48, 0x00,
-  0x56, 0x04, 0x00, 0x41, 0x24, 0x41, 0x10, 0x02, 0x41, 0xa5, 0x51, 0x24,
-  0x20, 0x01, 0x24, 0x28, 0x10, 0xf8, 0x42, 0x14, 0x40, 0x64, 0x84, 0x50,
-  0x14, 0x24, 0x47, 0x82, 0x43, 0xc2, 0x23, 0x00, 0x11, 0x90, 0x24, 0x4c,
-  0x81, 0x41, 0x02, 0x47, 0x11, 0x44, 0x41, 0x80, 0x03, 0x2b, 0x24, 0x12,
-  0x4c, 0x68, 0x82, 0x42, 0x1c, 0x11, 0x82, 0x88, 0x92, 0x12, 0x24, 0x11,
-  0xd0, 0x82, 0x04, 0x88, 0x28, 0x54, 0x92, 0x20, 0x02, 0x49, 0xc2, 0x48,
-  0x81, 0x1c, 0x02, 0x88, 0x29, 0x4c, 0x34, 0x28, 0x24, 0x86, 0x52, 0x48,
-  0x12, 0x24, 0xdf, 0xbe, 0x0a, 0x14, 0x10, 0x11, 0x42, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x50, 0x21, 0x90, 0x42, 0x30, 0x21, 0x14, 0x40,
-  0x18, 0x16, 0x38, 0x22, 0x10, 0x01, 0x40, 0x08, 0x11, 0xc0, 0x84, 0x24,
-  0x20, 0x98, 0x28, 0x63, 0x21, 0x14, 0x04, 0x00, 0x4c, 0x04, 0x16, 0x01,
-  0x42, 0x8a, 0x14, 0x04, 0x10, 0x04, 0xaf, 0xfd, 0x4c, 0x42, 0x41, 0x84,
-  0x12, 0x43, 0xe2, 0x42, 0x81, 0x12, 0x51, 0x12, 0x85, 0x92, 0x21, 0x40,
-  0xd2, 0x41, 0x61, 0x81, 0x10, 0x22, 0x41, 0x51, 0x2e, 0xa0, 0x21, 0x54,
-  0x4a, 0x22, 0x48, 0x51, 0x82, 0x89, 0x74, 0x31, 0x02, 0x86, 0x89, 0xc6,
-  0x14, 0x2d, 0x22, 0x19, 0x64, 0x18, 0x22, 0x88, 0x20, 0x45, 0xa1, 0xa1,
-  0x41, 0x4a, 0x12, 0x84, 0x62, 0xa4, 0x81, 0x46, 0x15, 0x94, 0x12, 0x82,
-  0x41, 0x8b, 0x58, 0x45, 0x22, 0xc8, 0x28, 0x43, 0x51, 0x28, 0xbf, 0xe6,
-  0x0d, 0x49, 0x04, 0x1c, 0x41, 0x14, 0x44, 0x98, 0x14, 0x28, 0x40, 0x04,
-  0x12, 0x21, 0x00, 0x80, 0x11, 0x45, 0x04, 0x4a, 0x08, 0x28, 0x55, 0x02,
-  0x45, 0xc8, 0x24, 0x24, 0x20, 0x02, 0x25, 0x02, 0x8c, 0x08, 0x2c, 0x24,
-  0x11, 0x24, 0x38, 0x26, 0x86, 0x54, 0x28, 0x12, 0x41, 0x10, 0x02, 0x00,
-  0x60, 0x88, 0x27, 0x64, 0x48, 0x28, 0x00, 0x41, 0x00, 0x5b, 0x9b, 0x10,
-  0x14, 0x01, 0x00, 0x40, 0x14, 0x01, 0x48, 0x00, 0x40, 0x02, 0x00, 0x80,
-  0x44, 0x88, 0x98, 0x8e, 0x10, 0x02, 0x00, 0x44, 0x11, 0x00, 0x10, 0x42,
-  0xd2, 0x48, 0x04, 0x4d, 0x42, 0x81, 0x00, 0x81, 0x48, 0x18, 0x42, 0x00,
-  0x00, 0x80, 0x14, 0x04, 0x4c, 0x81, 0x0c, 0x84, 0x20, 0x98, 0x84, 0x8f,
-  0xa6, 0x0c, 0x1b, 0x42, 0xa4, 0x60, 0x84, 0x87, 0x42, 0x71, 0x21, 0x41,
-  0x48, 0x82, 0xc1, 0x10, 0x24, 0x28, 0x06, 0x20, 0x58, 0x82, 0x2d, 0x81,
-  0x12, 0xa0, 0x48, 0x48, 0x81, 0x12, 0x11, 0x14, 0x48, 0x42, 0x14, 0x22,
-  0x00, 0x24, 0x26, 0x06, 0x40, 0x62, 0x42, 0x20, 0x18, 0x44, 0x14, 0x08,
-  0x10, 0x0a, 0x40, 0x08, 0x88, 0x41, 0x20, 0x25, 0x41, 0x02, 0x2d, 0x84,
-  0x00, 0x44, 0x31, 0x84, 0x00, 0x84, 0x40, 0x42, 0x14, 0x41, 0x31, 0x38,
-  0x54, 0x00, 0x10, 0x41, 0x02, 0x00, 0x60, 0xa8, 0x48, 0x16, 0x02, 0x11,
-  0x00, 0x83, 0x04, 0x10, 0x02, 0x15, 0x04, 0x20, 0x54, 0x18, 0xa5, 0x92,
-  0x81, 0x24, 0x41, 0x00, 0x10, 0x04, 0x14, 0x84, 0x40, 0x12, 0x44, 0x02,
-  0x40, 0x02, 0xdf, 0x5d, 0x08, 0xa4, 0x80, 0x41, 0x41, 0x11, 0x08, 0x40,
-  0x18, 0x11, 0x42, 0x14, 0x04, 0x00, 0x28, 0x41, 0x00, 0x21, 0x42, 0xab,
-  0x21, 0x30, 0x81, 0x8e, 0x48, 0x28, 0x00, 0x19, 0x08, 0x48, 0x10, 0x88,
-  0xa1, 0x84, 0x40, 0x42, 0x82, 0x98, 0x84, 0x80, 0x38, 0x88, 0x44, 0x23,
-  0x41, 0x24, 0x04, 0x00, 0x2b, 0x24, 0x00, 0x12, 0x14, 0x16, 0x9c, 0x22,
-  0x87, 0x28, 0xbe, 0xb9, 0xa0, 0x48, 0x00, 0x31, 0x84, 0x00, 0x00, 0x15,
-  0x04, 0x16, 0x01, 0x10, 0x18, 0x04, 0x44, 0x40, 0x0c, 0x40, 0x42, 0x04,
-  0x81, 0x1c, 0x01, 0x31, 0x40, 0x45, 0x42, 0x84, 0x04, 0x23, 0x44, 0x42,
-  0x01, 0x00, 0x45, 0x28, 0x14, 0x42, 0x22, 0x04, 0x9b, 0x12, 0x41, 0x00,
-  0x18, 0x80, 0x48, 0x0c, 0x20, 0x01, 0xaf, 0x68, 0x0b, 0x45, 0x41, 0x48,
-  0x18, 0x04, 0x61, 0x49, 0x41, 0x12, 0xc4, 0x42, 0x00, 0x25, 0x01, 0x54,
-  0x10, 0x08, 0xc4, 0xb0, 0x82, 0x24, 0x3c, 0x41, 0x1c, 0x44, 0x91, 0x42,
-  0xc0, 0x48, 0x18, 0x90, 0x22, 0x00, 0x00, 0x00, 0x40, 0x34, 0x48, 0x00,
-  0x00, 0x48, 0x40, 0x04, 0x00, 0x80, 0x84, 0x18, 0x01, 0x83, 0x01, 0xa1,
-  0x24, 0xff, 0x56, 0x05, 0x84, 0x80, 0x02, 0x43, 0x01, 0x2a, 0x44, 0xa4,
-  0x42, 0x80, 0xe1, 0x42, 0x08, 0x41, 0x48, 0x88, 0x00, 0x80, 0x08, 0x90,
-  0x82, 0x84, 0x10, 0x01, 0x20, 0x06, 0x12, 0x80, 0x81, 0x22, 0x04, 0x18,
-  0x28, 0x40, 0x04, 0x26, 0x22, 0x61, 0x23, 0x30, 0x28, 0x44, 0x00, 0x00,
-  0x45, 0x98, 0x58, 0x12, 0x88, 0x00, 0x2d, 0x44, 0xf0, 0x4a, 0x39, 0x00,
-  0x21, 0x14, 0x40, 0x41, 0x08, 0x40, 0x08, 0x11, 0x18, 0x1c, 0x41, 0xc1,
-  0x11, 0x11, 0x21, 0x00, 0x20, 0x04, 0x00, 0x4e, 0x82, 0x54, 0x00, 0x30,
-  0x42, 0x89, 0x44, 0x08, 0x21, 0x00, 0x65, 0x48, 0x02, 0x50, 0x26, 0x24,
-  0x49, 0xd4, 0xa1, 0x98, 0x44, 0x16, 0x04, 0x44, 0x80, 0x41, 0x94, 0x84,
-  0x44, 0x20, 0x81, 0x48, 0x24, 0x48, 0xf8, 0xa4, 0xc5, 0xc0, 0x18, 0x15,
-  0x84, 0x04, 0x00, 0x21, 0x60, 0x61, 0x00, 0x44, 0x80, 0x42, 0x04, 0x18,
-  0x90, 0x64, 0x80, 0x02, 0xa1, 0x13, 0x98, 0x32, 0x80, 0x28, 0x08, 0x11,
-  0xa0, 0x84, 0x14, 0x88, 0x21, 0x84, 0x80, 0xac, 0x14, 0x80, 0x39, 0x44,
-  0x88, 0x42, 0x10, 0x41, 0x04, 0xf0, 0x22, 0x48, 0x00, 0x46, 0x88, 0x02,
-  0x2c, 0x62, 0x88, 0xe1, 0xf0, 0x2b, 0x94, 0xc0, 0x15, 0x47, 0xb8, 0x97,
-  0x31, 0x9c, 0x64, 0x21, 0x85, 0xc4, 0x2c, 0x45, 0x71, 0x4a, 0xb4, 0x81,
-  0x94, 0x11, 0x18, 0x25, 0x44, 0xb2, 0x4d, 0x11, 0x81, 0x01, 0x4d, 0x42,
-  0x5d, 0x82, 0x1a, 0xa4, 0xcc, 0xd6, 0x01, 0x1c, 0xf2, 0x11, 0xd8, 0x22,
-  0x1d, 0x86, 0x2a, 0xd4, 0x31, 0x54, 0xc8, 0x2e, 0x42, 0x25, 0x42, 0x12,
-  0x14, 0x02, 0x1d, 0x8a, 0x23, 0x34, 0x8a, 0x43, 0xb1, 0x41, 0xe6, 0x28,
-  0x39, 0x48, 0x25, 0x98, 0x1a, 0xd0, 0x41, 0x04, 0x3b, 0x24, 0xd0, 0x44,
-  0xdc, 0xa8, 0x18, 0x64, 0x81, 0x8f, 0x85, 0x39, 0x18, 0x8e, 0x98, 0x8d,
-  0x88, 0xdf, 0x91, 0x42, 0x31, 0x61, 0x91, 0x21, 0x44, 0xc5, 0x09, 0x42,
-  0x44, 0x2c, 0x52, 0x16, 0x21, 0x1b, 0x81, 0x8c, 0x72, 0x81, 0x84, 0x12,
-  0x04, 0x45, 0x46, 0x48, 0xb8, 0xc2, 0x52, 0x4a, 0x8b, 0xc2, 0x1f, 0x84,
-  0x78, 0x41, 0x12, 0x2e, 0x81, 0x04, 0x42, 0x46, 0x61, 0x84, 0x44, 0x29,
-  0xce, 0x4a, 0x4f, 0x2a, 0x74, 0x16, 0x12, 0xe2, 0x61, 0x74, 0x41, 0xfa,
-  0x88, 0x82, 0x4d, 0x82, 0x61, 0x6f, 0x68, 0x37, 0x44, 0x43, 0x04, 0xc1,
-  0x80, 0x54, 0x88, 0x89, 0xa1, 0x1c, 0x4c, 0x55, 0x24, 0x28, 0x4c, 0xf1,
-  0x28, 0x42, 0x25, 0xf4, 0x26, 0xad, 0xd0, 0x24, 0x54, 0x42, 0x28, 0x91,
-  0x17, 0x42, 0x65, 0x3b, 0x16, 0xd0, 0x84, 0x65, 0x64, 0xd4, 0x1c, 0xf2,
-  0x15, 0x11, 0x45, 0xc1, 0x45, 0x88, 0xa3, 0x62, 0x18, 0x8f, 0x44, 0x32,
-  0x8a, 0x88, 0x40, 0xfa, 0x8e, 0x43, 0xab, 0xc8, 0x46, 0x51, 0x13, 0x94,
-  0x17, 0x15, 0x23, 0xb8, 0x31, 0x84, 0x28, 0x11, 0xb8, 0x42, 0x71, 0x41,
-  0xc4, 0x4c, 0x28, 0x70, 0x24, 0x54, 0xc2, 0xa7, 0x48, 0x5e, 0x44, 0x9c,
-  0xc8, 0x46, 0x1e, 0x21, 0x24, 0x2e, 0x18, 0x41, 0x89, 0x51, 0x64, 0x62,
-  0x4f, 0x41, 0xa4, 0xa8, 0x98, 0x24, 0x47, 0x88, 0x45, 0x64, 0x28, 0x4f,
-  0xe6, 0x4d, 0xa1, 0x21, 0x65, 0xe1, 0x81, 0x02, 0x1a, 0x42, 0x82, 0x02,
-  0x28, 0x4d, 0x83, 0x28, 0x1c, 0x08, 0x1c, 0x08, 0x1c, 0x28, 0xc2, 0x85,
-  0x22, 0x34, 0x22, 0x14, 0x22, 0x81, 0x23, 0x02, 0x22, 0x20, 0x22, 0x28,
-  0xb2, 0x88, 0x12, 0xa2, 0x28, 0xb0, 0x81, 0x12, 0xb6, 0x81, 0x12, 0xd2,
-  0x81, 0x42, 0x92, 0x21, 0x24, 0x1b, 0x21, 0x45, 0x92, 0x21, 0x10, 0x01,
-  0x8c, 0x04, 0x2e, 0x48, 0x44, 0x13, 0x03, 0x2a, 0x14, 0xa8, 0x43, 0xa0,
-  0x4f, 0xa0, 0x74, 0x5f, 0x63, 0xe3, 0x22, 0xf2, 0x37, 0x34, 0x8f, 0xa1,
-  0xf3, 0x28, 0x28, 0x3a, 0xe3, 0x66, 0xf6, 0x5a, 0x1c, 0x3f, 0x46, 0xaa,
-  0xbb, 0x8e, 0x92, 0x2b, 0x99, 0x1c, 0xf8, 0xdc, 0xd8, 0x4f, 0x7e, 0xfe,
-  0xbb, 0xb9, 0x5f, 0x12, 0xfa, 0x2d, 0x81, 0x4f, 0x54, 0xfe, 0x83, 0xa1,
-  0x1f, 0x12, 0xfa, 0x88, 0x48, 0xcd, 0xaf, 0x1f, 0x1c, 0xfa, 0x2c, 0x25,
-  0x1f, 0x11, 0xf1, 0x68, 0x6b, 0x1f, 0x2b, 0xfb, 0xa2, 0xa3, 0xff, 0xcd,
-  0xf9, 0x88, 0x28, 0x6f, 0x43, 0xbb, 0x62, 0xfe, 0xe1, 0xa1, 0x1d, 0x25,
-  0x1f, 0x13, 0xeb, 0x22, 0xfa, 0x35, 0x37, 0x9f, 0xfc, 0xfe, 0xbb, 0xb9,
-  0x8f, 0x8e, 0xe2, 0x5b, 0x7b, 0x8a, 0xfd, 0x39, 0x31, 0xbf, 0x86, 0xf6,
-  0x21, 0x21, 0x9f, 0x91, 0x51, 0x64, 0x3f, 0x91, 0xe1, 0x82, 0xb2, 0xb5,
-  0xeb, 0x83, 0x33, 0x24, 0xdf, 0xc9, 0xea, 0x18, 0xfe, 0xe8, 0xe8, 0x5b,
-  0xc4, 0xce, 0xeb, 0xff, 0x84, 0x45, 0xe1, 0x24, 0xf7, 0x71, 0x7f, 0x8f,
-  0x21, 0xd1, 0xdf, 0xd4, 0xe8, 0xf2, 0x3e, 0x3e, 0x21, 0x4f, 0x64, 0xf4,
-  0x7a, 0x78, 0x1f, 0x66, 0xfe, 0xb3, 0xb4, 0x1d, 0x13, 0x3b, 0x13, 0x5d,
-  0x85, 0x8f, 0x8f, 0xff, 0x44, 0x47, 0xbf, 0x91, 0xb1, 0x24, 0xfa, 0x28,
-  0x8a, 0xcf, 0xdc, 0xfe, 0x83, 0xa1, 0x3f, 0x1a, 0xfa, 0xe8, 0xa8, 0xdf,
-  0xe8, 0xf3, 0x81, 0xe3, 0xdf, 0x5a, 0xfb, 0x31, 0x31, 0x9f, 0xb4, 0xf4,
-  0x11, 0x13, 0x3f, 0x32, 0xf2, 0xbf, 0xfd, 0x9f, 0xb8, 0xf2, 0x34, 0xb6,
-  0x2f, 0x34, 0xfc, 0x8a, 0x8a, 0xce, 0xa6, 0x3f, 0x73, 0xdf, 0x31, 0xf8,
-  0x94, 0x94, 0x8f, 0xa4, 0xf6, 0xbd, 0x3f, 0xff, 0x98, 0xe8, 0x7d, 0xf1,
-  0xaa, 0xbf, 0x9f, 0x53, 0xf3, 0x4b, 0x4c, 0xf0, 0x38, 0x18, 0x55, 0xb7,
-  0x32, 0x53, 0x44, 0x9a, 0xf9, 0x2c, 0x28, 0x43, 0xf2, 0x1d, 0x3c, 0x8a,
-  0xfe, 0xe6, 0xfc, 0x2e, 0xb8, 0x8e, 0xbb, 0xef, 0x5d, 0x05, 0x17, 0x17,
-  0x7d, 0x66, 0x9f, 0x31, 0x51, 0xcf, 0xc7, 0xf2, 0x89, 0xf2, 0x14, 0x14,
-  0x4e, 0x46, 0xaf, 0xc7, 0x77, 0xcb, 0xed, 0x51, 0xe9, 0x33, 0xf3, 0x12,
-  0x31, 0x47, 0x58, 0xdf, 0x85, 0x5d, 0x65, 0xaf, 0x91, 0x31, 0xa4, 0xcf,
-  0x8c, 0xf6, 0xcd, 0xce, 0x2f, 0x1a, 0xb8, 0x82, 0xf8, 0xa9, 0xa9, 0xdf,
-  0xf8, 0xfd, 0x22, 0x89, 0xff, 0xd4, 0xf8, 0x31, 0x31, 0x9f, 0xb4, 0xf4,
-  0x11, 0x13, 0x35, 0xf3, 0xbf, 0x3d, 0x6e, 0x89, 0x4f, 0x41, 0xa3, 0x4c,
-  0x2d, 0x48, 0x2f, 0x4a, 0xf8, 0x14, 0x72, 0x37, 0x38, 0x4f, 0x61, 0xf1,
-  0xe8, 0xc4, 0x9a, 0xdb, 0xf9, 0xec, 0x49, 0xf9, 0x3b, 0xbc, 0xdf, 0xa1,
-  0xf5, 0x5a, 0x5d, 0xf0, 0x18, 0x38, 0xc5, 0xfe, 0x5b, 0x59, 0x84, 0x4f,
-  0x89, 0xe9, 0xc3, 0x91, 0x34, 0xcf, 0xc9, 0xa8, 0x8f, 0xaf, 0x81, 0xb5,
-  0x2c, 0xf3, 0x88, 0x9a, 0x37, 0x19, 0x14, 0x4f, 0x67, 0xf4, 0x1b, 0x77,
-  0x8f, 0x22, 0x72, 0x4f, 0xfd, 0x38, 0x1d, 0xef, 0xc1, 0xb3, 0x22, 0xf2,
-  0x44, 0x46, 0xef, 0xa5, 0xf5, 0xef, 0x2e, 0x3b, 0x91, 0x1f, 0x3a, 0xbb,
-  0x13, 0x73, 0x85, 0xf5, 0x79, 0xd8, 0x5f, 0x68, 0xf8, 0x3a, 0x39, 0x57,
-  0x5a, 0x8f, 0xec, 0xf6, 0xcd, 0xce, 0x2f, 0x1a, 0xa8, 0xe2, 0x97, 0x98,
-  0xdf, 0x7c, 0x78, 0xa1, 0xfa, 0x3d, 0xed, 0x1f, 0x11, 0xf1, 0x48, 0x4b,
-  0x1f, 0x23, 0xf3, 0xa2, 0xe3, 0xff, 0xc9, 0xf1, 0x28, 0xcb, 0x4f, 0x61,
-  0xf3, 0xe3, 0x62, 0x2f, 0xa8, 0xf8, 0x21, 0x47, 0x7f, 0x71, 0xe3, 0x2a,
-  0xf2, 0x96, 0x94, 0xff, 0xf6, 0xf4, 0x1d, 0xbf, 0xef, 0xea, 0xea, 0x61,
-  0xfd, 0x8b, 0x9e, 0xdf, 0xe3, 0xf3, 0x7a, 0x79, 0xf0, 0x19, 0x39, 0xd5,
-  0xff, 0x7a, 0x58, 0x45, 0xf4, 0xfc, 0xbd, 0xc7, 0xc2, 0x59, 0xfb, 0x1c,
-  0x1c, 0x8f, 0x9f, 0xf9, 0x34, 0x7c, 0x4f, 0xc4, 0xe5, 0xb8, 0xf8, 0xab,
-  0x94, 0x50, 0x14, 0x10, 0x02, 0x00, 0x00, 0x41, 0x84, 0x14, 0x00, 0x40,
-  0x81, 0x04, 0x40, 0x04, 0x00, 0x81, 0x11, 0x42, 0x00, 0x00, 0x11, 0x42,
-  0x00, 0x21, 0x10, 0x04, 0x00, 0x14, 0x84, 0x1c, 0x08, 0x4d, 0x81, 0x12,
-  0x14, 0x00, 0x00, 0x48, 0x20, 0x48, 0x24, 0x11, 0x28, 0x08, 0x70, 0x6a,
-  0x0d, 0x8a, 0x14, 0x01, 0x11, 0x85, 0x02, 0x00, 0x80, 0x94, 0x82, 0xc0,
-  0x91, 0x80, 0x08, 0x1c, 0x08, 0x3c, 0x48, 0xc8, 0x81, 0x1b, 0x48, 0xc0,
-  0x42, 0x88, 0x84, 0x14, 0x24, 0x86, 0x81, 0x04, 0x88, 0x82, 0x24, 0x82,
-  0x1c, 0x04, 0x2d, 0x81, 0x82, 0x25, 0x01, 0x27, 0x14, 0x50, 0x1a, 0x19,
-  0x14, 0x02, 0x85, 0x01, 0x14, 0x20, 0x04, 0x00, 0x20, 0x08, 0xf0, 0x69,
-  0xdc, 0xf0, 0x26, 0x53, 0x1f, 0x41, 0xf2, 0x2a, 0x13, 0x1f, 0x41, 0xf2,
-  0x68, 0x12, 0x1f, 0x41, 0xf2, 0x6a, 0x11, 0x1d, 0x2c, 0xef, 0x36, 0xd1,
-  0x41, 0xf2, 0x6a, 0x91, 0x1d, 0x28, 0xaf, 0x34, 0x59, 0x85, 0xaf, 0x14,
-  0x39, 0x24, 0xaf, 0x34, 0x3b, 0x24, 0x2f, 0x74, 0x7b, 0x34, 0xd8, 0x1a,
-  0xfb, 0x34, 0x48, 0x8d, 0xb5, 0x4f, 0xa2, 0xc4, 0xa1, 0x6f, 0xa2, 0xe4,
-  0x11, 0xf2, 0x26, 0x4a, 0x9e, 0x25, 0x2e, 0x4a, 0x9e, 0x25, 0x2e, 0x4a,
-  0x8f, 0x49, 0xf2, 0x26, 0x4a, 0x1f, 0x49, 0xf2, 0x24, 0x52, 0x1f, 0x49,
-  0x72, 0x2a, 0xf2, 0x91, 0x2c, 0xa7, 0x26, 0x1f, 0xc9, 0x72, 0x6a, 0xf2,
-  0x81, 0x24, 0xef, 0x26, 0xd1, 0x41, 0xf2, 0x6a, 0x92, 0x19, 0xb2, 0x4a,
-  0x99, 0x45, 0xaf, 0x24, 0xb9, 0x24, 0xf4, 0x4a, 0xb2, 0x4b, 0x42, 0x2f,
-  0x64, 0xfb, 0x24, 0x48, 0xab, 0xb4, 0x4f, 0x82, 0xa4, 0xb4, 0x4f, 0xa2,
-  0xf4, 0x7a, 0xa3, 0xc0, 0x42, 0xcc, 0x44, 0xd2, 0x41, 0x34, 0x4c, 0x10,
-  0x3c, 0x11, 0xa3, 0x74, 0x11, 0x74, 0x48, 0x14, 0xf1, 0x48, 0x34, 0x12,
-  0x8f, 0x44, 0x12, 0xf4, 0x4a, 0x11, 0x41, 0x1c, 0x71, 0x14, 0xd8, 0x12,
-  0xb8, 0x16, 0xc4, 0x81, 0x6d, 0x52, 0x1c, 0xd8, 0x84, 0x4d, 0xd1, 0x24,
-  0x4d, 0xc1, 0x58, 0x54, 0xbc, 0x45, 0xc5, 0x1a, 0x15, 0xcc, 0x52, 0x1d,
-  0x4c, 0x18, 0x1d, 0x44, 0xc9, 0x31, 0x81, 0x6b, 0x14, 0x13, 0x38, 0x4a,
-  0x15, 0xf4, 0x48, 0x94, 0x11, 0xaf, 0x44, 0x1b, 0xb5, 0x48, 0x4b, 0xd8,
-  0x4a, 0x11, 0x84, 0x58, 0x84, 0x18, 0x25, 0xd8, 0x48, 0x98, 0x16, 0xaf,
-  0xe7, 0x08, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x02, 0x28, 0x84, 0x00, 0x00, 0x00, 0x40, 0x01,
-  0x1f, 0x36, 0x4a, 0x02, 0x14, 0x11, 0x64, 0x00, 0xa0, 0x14, 0x14, 0x41,
-  0xa8, 0x82, 0x70, 0x86, 0x42, 0x42, 0x18, 0x34, 0x52, 0x20, 0x21, 0x08,
-  0x22, 0x40, 0x44, 0x08, 0x4c, 0x31, 0x28, 0x46, 0x44, 0x38, 0x48, 0x80,
-  0x48, 0xa2, 0x85, 0x88, 0x81, 0x40, 0x0c, 0x27, 0x88, 0x24, 0x46, 0x04,
-  0x30, 0x42, 0x00, 0x48, 0x50, 0x24, 0x90, 0xc8, 0xc4, 0x18, 0x00, 0xf0,
-  0x88, 0xfa, 0x14, 0x24, 0x82, 0x1a, 0x72, 0x2a, 0x41, 0x78, 0x44, 0x21,
-  0x51, 0x25, 0x84, 0x5e, 0x83, 0x15, 0x08, 0x21, 0x4e, 0x11, 0x11, 0x24,
-  0x42, 0x24, 0x91, 0x87, 0x64, 0x4e, 0x11, 0x32, 0x12, 0x81, 0x33, 0x94,
-  0x44, 0x27, 0x24, 0x13, 0x34, 0x83, 0x81, 0x41, 0x10, 0x36, 0x12, 0x67,
-  0x11, 0x34, 0x1c, 0x61, 0x18, 0x4d, 0x11, 0x27, 0x29, 0x4b, 0x21, 0x1c,
-  0xf1, 0x44, 0x11, 0x86, 0xf9, 0x44, 0x92, 0x12, 0x1c, 0x71, 0x12, 0x48,
-  0x47, 0xc1, 0xc4, 0x16, 0x61, 0x64, 0x41, 0x46, 0x22, 0x94, 0x18, 0x56,
-  0x11, 0x78, 0xcc, 0x4b, 0x42, 0x22, 0x44, 0x71, 0x22, 0x43, 0x38, 0x44,
-  0x18, 0x4d, 0x52, 0x84, 0x4d, 0x11, 0x5d, 0xa8, 0x88, 0x26, 0xe2, 0x41,
-  0x18, 0x11, 0x4a, 0x94, 0x42, 0x91, 0x64, 0x4e, 0x12, 0x20, 0x23, 0x51,
-  0x43, 0x83, 0x5c, 0x22, 0x1e, 0x44, 0x33, 0x48, 0x1c, 0x3c, 0x41, 0x61,
-  0x8a, 0xd1, 0x1e, 0x31, 0xc2, 0x2f, 0x14, 0x69, 0x98, 0x45, 0x31, 0x1a,
-  0x61, 0x27, 0x88, 0x47, 0x31, 0x4e, 0x88, 0x4f, 0x21, 0x34, 0x14, 0x1c,
-  0x71, 0x22, 0x48, 0x07, 0x4e, 0x84, 0x57, 0x21, 0x6c, 0x14, 0x48, 0xc2,
-  0x12, 0x89, 0xe1, 0x11, 0x34, 0x18, 0xef, 0x91, 0x01, 0x10, 0xa1, 0x12,
-  0xc4, 0x10, 0x01, 0x11, 0x14, 0x8a, 0x14, 0x02, 0x21, 0x19, 0x14, 0x02,
-  0x23, 0x24, 0x11, 0xe2, 0x81, 0xc4, 0x81, 0x32, 0x40, 0x28, 0x14, 0x24,
-  0x14, 0x91, 0x28, 0x48, 0x40, 0x08, 0x21, 0xc0, 0x11, 0x00, 0x12, 0x49,
-  0xa8, 0x21, 0x1c, 0x81, 0x54, 0x14, 0x82, 0x24, 0x48, 0x18, 0x60, 0x14,
-  0x00, 0xe0, 0x44, 0xd8, 0x84, 0x24, 0x04, 0x40, 0xd2, 0x79, 0x0b, 0x00,
-  0x00, 0x14, 0x40, 0x21, 0x41, 0x02, 0x00, 0x27, 0x14, 0x12, 0x10, 0xc1,
-  0x82, 0x41, 0x00, 0x00, 0x46, 0x01, 0x00, 0x20, 0x02, 0x84, 0x10, 0x02,
-  0x60, 0x49, 0x25, 0x03, 0x14, 0x50, 0x32, 0x8c, 0x32, 0x48, 0x15, 0x08,
-  0x28, 0x00, 0x14, 0x00, 0x10, 0x02, 0x21, 0x00, 0x4b, 0x42, 0x18, 0x84,
-  0x1f, 0x2e, 0x04, 0x16, 0xc1, 0x21, 0x10, 0x8c, 0x11, 0x42, 0x12, 0x88,
-  0x75, 0x14, 0x78, 0x42, 0x22, 0x21, 0x58, 0x82, 0xc6, 0x31, 0x12, 0x37,
-  0x82, 0x89, 0x71, 0x82, 0x02, 0x80, 0x02, 0x26, 0x14, 0x88, 0x52, 0x81,
-  0x19, 0x54, 0x2a, 0x14, 0x6d, 0x88, 0xd0, 0xa4, 0x94, 0x18, 0x28, 0x22,
-  0x1e, 0x82, 0xd0, 0x82, 0x0a, 0x50, 0x23, 0xc0, 0x21, 0x46, 0x0c, 0x11,
-  0x30, 0x1f, 0x19, 0x11, 0xe3, 0x22, 0x04, 0x2c, 0x32, 0x48, 0xc2, 0x18,
-  0x41, 0x41, 0xdf, 0xaa, 0x02, 0x14, 0x14, 0x00, 0x18, 0x21, 0x14, 0xa9,
-  0x61, 0x24, 0xac, 0xc1, 0x42, 0x18, 0x1b, 0x84, 0xa9, 0xc1, 0xc3, 0x90,
-  0x81, 0x25, 0x82, 0x18, 0x02, 0x22, 0x46, 0x01, 0x81, 0x22, 0x84, 0x1b,
-  0x42, 0x84, 0x11, 0x83, 0x08, 0x42, 0x20, 0x98, 0x23, 0x23, 0x18, 0xb1,
-  0x82, 0x12, 0x41, 0x32, 0x41, 0x25, 0x28, 0xc2, 0x6c, 0x00, 0x15, 0x72,
-  0x14, 0x99, 0x11, 0x21, 0x42, 0x30, 0x22, 0x89, 0xa4, 0x48, 0x43, 0xc6,
-  0x14, 0xf0, 0x1c, 0xc4, 0x20, 0x21, 0x02, 0xc4, 0x14, 0x00, 0x80, 0x41,
-  0x04, 0x10, 0x02, 0x60, 0x31, 0x89, 0xd2, 0x84, 0x01, 0x00, 0x00, 0x49,
-  0x02, 0x10, 0x41, 0x02, 0x25, 0x58, 0x26, 0x50, 0x84, 0x2d, 0x18, 0x36,
-  0x04, 0x2c, 0x01, 0x85, 0x42, 0xc2, 0x28, 0x81, 0x11, 0x11, 0x00, 0x14,
-  0x00, 0x50, 0x21, 0x2c, 0x02, 0x24, 0x00, 0x18, 0x50, 0x84, 0x1f, 0xd1,
-  0x48, 0x01, 0x84, 0x84, 0x81, 0x81, 0x14, 0x40, 0x84, 0x11, 0xc2, 0x12,
-  0xc0, 0x28, 0x82, 0x40, 0x05, 0x84, 0x83, 0xa1, 0x12, 0x21, 0x42, 0x10,
-  0x22, 0x01, 0x58, 0x42, 0x10, 0x08, 0x42, 0x2c, 0x04, 0x26, 0xc1, 0x15,
-  0x8c, 0x04, 0x12, 0x28, 0x14, 0x81, 0x81, 0x12, 0x46, 0x28, 0xc1, 0x18,
-  0xb0, 0x12, 0x06, 0x10, 0x94, 0x12, 0x60, 0x42, 0x15, 0x62, 0x44, 0x80,
-  0xf2, 0x2c, 0x6e, 0x80, 0x41, 0x28, 0x21, 0x02, 0x00, 0x00, 0x30, 0x84,
-  0x1c, 0x91, 0x22, 0x20, 0x81, 0x18, 0x82, 0x21, 0x18, 0x12, 0x04, 0x90,
-  0x12, 0x00, 0x84, 0x40, 0x08, 0x8c, 0x28, 0x01, 0x16, 0x09, 0x82, 0x2f,
-  0x82, 0x55, 0x48, 0xa2, 0x58, 0x20, 0xc8, 0x12, 0x11, 0x40, 0x01, 0x44,
-  0x28, 0x92, 0x18, 0x16, 0x09, 0x82, 0x24, 0x24, 0x2a, 0xa1, 0x21, 0x48,
-  0x47, 0xab, 0x24, 0x80, 0x02, 0x11, 0x00, 0x16, 0xc8, 0x21, 0x91, 0x19,
-  0x41, 0x48, 0x08, 0x40, 0x08, 0x00, 0x41, 0x20, 0x02, 0x48, 0x40, 0x44,
-  0x09, 0x50, 0x23, 0x44, 0x14, 0x00, 0x8a, 0x02, 0x00, 0x14, 0x15, 0x02,
-  0x00, 0x20, 0x08, 0x48, 0x28, 0x00, 0x10, 0x48, 0x41, 0x92, 0x18, 0x42,
-  0x13, 0x01, 0x48, 0xf0, 0x52, 0x8f, 0x20, 0x01, 0x70, 0x28, 0x41, 0x18,
-  0x61, 0x81, 0x47, 0x12, 0x1c, 0x01, 0x87, 0x28, 0x11, 0x25, 0x08, 0x12,
-  0x88, 0x80, 0x61, 0x89, 0x2f, 0x22, 0x01, 0x42, 0x00, 0x00, 0x1a, 0x24,
-  0x14, 0x11, 0xd8, 0x81, 0x88, 0x04, 0x8e, 0x28, 0x14, 0x17, 0x21, 0x50,
-  0x18, 0x36, 0xa1, 0x52, 0x11, 0x84, 0x2c, 0x21, 0x49, 0xa8, 0x41, 0x84,
-  0xb0, 0x42, 0x81, 0x99, 0x18, 0x16, 0x5c, 0x22, 0x8c, 0x61, 0x66, 0x12,
-  0x4a, 0x81, 0xc5, 0x42, 0x1f, 0x4f, 0x0e, 0x21, 0x28, 0x89, 0x01, 0x00,
-  0x00, 0x85, 0x32, 0x11, 0x18, 0x16, 0x08, 0x82, 0x81, 0x51, 0x21, 0x84,
-  0x44, 0xc0, 0x24, 0x20, 0x04, 0x44, 0x15, 0x18, 0x48, 0x12, 0x18, 0x06,
-  0x18, 0x42, 0x29, 0x81, 0x92, 0x84, 0x1a, 0x12, 0x24, 0x18, 0x02, 0x88,
-  0x84, 0x14, 0x48, 0x14, 0x1a, 0x02, 0x00, 0x00, 0x12, 0x88, 0x00, 0x43,
-  0x92, 0x21, 0x22, 0x7f, 0xea, 0x0d, 0x12, 0x10, 0x01, 0x11, 0x21, 0x11,
-  0x85, 0x01, 0x00, 0x25, 0x22, 0x01, 0x28, 0x14, 0x21, 0x81, 0x12, 0x20,
-  0x01, 0x00, 0x34, 0x48, 0x1e, 0x42, 0x80, 0x85, 0x14, 0x02, 0x81, 0x40,
-  0x23, 0x23, 0x42, 0x02, 0x80, 0x21, 0x24, 0x24, 0x11, 0x22, 0x63, 0x22,
-  0x10, 0x22, 0x84, 0x82, 0x12, 0x82, 0xa1, 0x14, 0x21, 0x48, 0x1c, 0x01,
-  0x4f, 0x2f, 0x0a, 0x22, 0x83, 0x11, 0x04, 0x00, 0x83, 0x82, 0x32, 0x21,
-  0x89, 0x82, 0x82, 0x02, 0x12, 0x18, 0x90, 0x28, 0x25, 0x21, 0x42, 0x48,
-  0x42, 0x09, 0x00, 0x12, 0x40, 0x02, 0x45, 0x88, 0x04, 0x10, 0x04, 0x60,
-  0x14, 0x49, 0x01, 0x40, 0x08, 0x28, 0x20, 0x04, 0x10, 0xa8, 0x21, 0x89,
-  0x82, 0x01, 0x10, 0x08, 0x18, 0x50, 0x18, 0x18, 0xbf, 0x9c, 0x0d, 0x11,
-  0x00, 0x14, 0x10, 0x93, 0x21, 0x24, 0x11, 0x14, 0x81, 0x18, 0x84, 0x11,
-  0x93, 0x12, 0x01, 0x24, 0x90, 0x12, 0x14, 0x00, 0x8d, 0x11, 0x21, 0x11,
-  0x21, 0x48, 0x24, 0x13, 0x02, 0x42, 0x84, 0x15, 0x08, 0x2d, 0x42, 0x18,
-  0x00, 0x00, 0x25, 0x21, 0xc1, 0x48, 0x60, 0x14, 0x14, 0x49, 0x01, 0x12,
-  0x24, 0x12, 0x20, 0x04, 0x00, 0x14, 0x24, 0x8f, 0x43, 0x02, 0x25, 0x18,
-  0x31, 0x18, 0x00, 0x18, 0x21, 0x10, 0x08, 0x10, 0x01, 0x38, 0x44, 0xc0,
-  0x11, 0x1c, 0x23, 0x02, 0x2d, 0x44, 0x14, 0x14, 0x40, 0x04, 0x14, 0x83,
-  0x11, 0x01, 0x16, 0x41, 0xaa, 0x21, 0x24, 0x12, 0x12, 0xc0, 0x48, 0x48,
-  0x85, 0x12, 0x31, 0x28, 0x84, 0x21, 0x11, 0x25, 0x88, 0x81, 0xc4, 0x63,
-  0x44, 0x60, 0x86, 0x32, 0x21, 0x40, 0x04, 0x20, 0xf2, 0x67, 0x74, 0x20,
-  0x79, 0x18, 0x41, 0x41, 0x01, 0x18, 0xc0, 0x21, 0x00, 0x00, 0x44, 0x24,
-  0x24, 0x00, 0x22, 0x21, 0x15, 0x02, 0x48, 0x24, 0x10, 0x01, 0x60, 0x24,
-  0x80, 0x91, 0x18, 0x2c, 0x02, 0x12, 0x40, 0x02, 0x10, 0x88, 0x04, 0x42,
-  0x22, 0x40, 0x02, 0x40, 0x41, 0x62, 0x22, 0x20, 0xc4, 0x22, 0x48, 0x14,
-  0x42, 0x4a, 0x01, 0x22, 0xcf, 0x74, 0x07, 0x00, 0x00, 0x31, 0x00, 0x20,
-  0x42, 0xd8, 0x22, 0x01, 0x12, 0x28, 0x18, 0x84, 0x21, 0x40, 0x08, 0x00,
-  0x17, 0x81, 0x00, 0xf0, 0x18, 0x42, 0x40, 0x04, 0x42, 0x42, 0x90, 0x48,
-  0x12, 0x20, 0x03, 0x10, 0x42, 0x02, 0x10, 0xe8, 0x11, 0x64, 0x81, 0x84,
-  0x16, 0x02, 0x20, 0x11, 0x42, 0x08, 0x42, 0x00, 0x25, 0x02, 0x5f, 0x44,
-  0x07, 0x26, 0x6c, 0x22, 0x84, 0x81, 0x41, 0x10, 0x04, 0x10, 0x64, 0x82,
-  0x85, 0x04, 0x8c, 0x02, 0x80, 0x02, 0x18, 0x00, 0x00, 0x81, 0x48, 0x21,
-  0x41, 0x84, 0x48, 0x00, 0x2d, 0x14, 0x14, 0x00, 0x44, 0x84, 0x58, 0x14,
-  0x41, 0x94, 0x45, 0x98, 0x41, 0x41, 0x25, 0x08, 0x44, 0x48, 0x12, 0x00,
-  0x81, 0x21, 0x12, 0x40, 0x09, 0x00, 0xbf, 0xa9, 0x45, 0x41, 0x01, 0x40,
-  0x08, 0x11, 0x25, 0x08, 0x00, 0xe0, 0xa1, 0x62, 0x82, 0x91, 0x24, 0x60,
-  0x81, 0x12, 0x11, 0x23, 0xc1, 0x11, 0x00, 0x33, 0x14, 0x82, 0x14, 0x02,
-  0xe0, 0x22, 0x55, 0x81, 0x2d, 0x18, 0x1a, 0x92, 0x12, 0x00, 0x84, 0xa4,
-  0x24, 0x85, 0x02, 0x30, 0x18, 0x42, 0x40, 0x21, 0x02, 0x28, 0x12, 0x00,
-  0x12, 0x13, 0x42, 0x21, 0x21, 0x41, 0x03, 0x1f, 0x4d, 0x0a, 0x84, 0xa0,
-  0x41, 0x10, 0x08, 0x00, 0x84, 0x28, 0x40, 0x04, 0x28, 0x15, 0xc8, 0x28,
-  0x15, 0x04, 0x44, 0x17, 0x82, 0x48, 0x84, 0xa5, 0x04, 0x4a, 0x11, 0xc9,
-  0x89, 0x18, 0x12, 0x94, 0x28, 0x40, 0x01, 0x21, 0x84, 0x80, 0xc4, 0x48,
-  0x00, 0x11, 0x20, 0x21, 0x01, 0x9d, 0x14, 0x93, 0x82, 0x52, 0x28, 0x60,
-  0x51, 0x81, 0x44, 0x40, 0x02, 0x2d, 0x14, 0xf0, 0x11, 0xc2, 0x24, 0x22,
-  0x8e, 0x33, 0x00, 0x64, 0x1e, 0x11, 0x25, 0x19, 0x21, 0x22, 0x12, 0xb2,
-  0x2a, 0x73, 0x14, 0xd8, 0x81, 0xd1, 0x83, 0x01, 0x1e, 0x2a, 0x18, 0x16,
-  0x53, 0xa8, 0x1f, 0x11, 0x01, 0x54, 0x15, 0xb8, 0x44, 0x84, 0xb1, 0x44,
-  0xf5, 0x18, 0x48, 0x58, 0x4b, 0x22, 0x2f, 0x25, 0x81, 0x86, 0xf1, 0x12,
-  0x42, 0x24, 0x32, 0x2d, 0x31, 0x16, 0x12, 0x79, 0x48, 0x46, 0xd2, 0x12,
-  0xc2, 0x38, 0x90, 0x4a, 0x8f, 0x82, 0xc4, 0x31, 0xdf, 0x92, 0x44, 0xa1,
-  0x62, 0x2c, 0x52, 0x82, 0x22, 0x9b, 0x25, 0x1b, 0x44, 0x16, 0x81, 0x44,
-  0xa5, 0x12, 0xdf, 0xf7, 0x41, 0xa1, 0x11, 0x11, 0x8d, 0x11, 0x95, 0x51,
-  0x18, 0x35, 0x72, 0x28, 0x24, 0x52, 0x88, 0x9c, 0xf2, 0x28, 0x3a, 0x16,
-  0xb3, 0x22, 0x71, 0x18, 0x71, 0x38, 0x43, 0x93, 0x18, 0x16, 0xc2, 0x34,
-  0x23, 0x93, 0x46, 0x85, 0x58, 0xa1, 0x2c, 0x51, 0x32, 0x3d, 0x43, 0xb4,
-  0x23, 0x34, 0x43, 0x1c, 0xd5, 0x88, 0xf2, 0x5a, 0x14, 0x8f, 0x81, 0x92,
-  0x15, 0x1c, 0xb1, 0x42, 0xc1, 0x48, 0x84, 0x4e, 0x42, 0x21, 0xb5, 0x58,
-  0x49, 0x4a, 0xf4, 0x48, 0x52, 0x16, 0xf2, 0x13, 0x11, 0x95, 0xe2, 0x24,
-  0x81, 0x51, 0x8a, 0x21, 0x9f, 0x23, 0x95, 0x1a, 0x2d, 0x54, 0xd0, 0x84,
-  0x21, 0x55, 0x38, 0x24, 0x9f, 0x8c, 0x04, 0x1d, 0x25, 0x87, 0x81, 0x57,
-  0x81, 0xa4, 0x11, 0x90, 0x21, 0xbc, 0xd2, 0x11, 0x52, 0x48, 0x40, 0x18,
-  0x08, 0x49, 0x72, 0x2b, 0x78, 0x23, 0xf5, 0x21, 0x29, 0x27, 0x82, 0x1d,
-  0x11, 0x42, 0x3d, 0x41, 0x89, 0xd1, 0x1a, 0x14, 0x61, 0x84, 0xb3, 0xc1,
-  0x12, 0x47, 0x21, 0x97, 0xa5, 0x1d, 0x41, 0xa4, 0x23, 0x52, 0x88, 0x23,
-  0x41, 0x36, 0x38, 0xc9, 0x51, 0x82, 0x84, 0x1c, 0xe1, 0x84, 0x74, 0x39,
-  0x62, 0xc1, 0x1f, 0x14, 0x01, 0x36, 0x28, 0x71, 0x52, 0xf2, 0x14, 0x12,
-  0x1a, 0xe1, 0x44, 0xe2, 0xa1, 0x02, 0x16, 0xc2, 0x42, 0x18, 0x1a, 0x91,
-  0x22, 0xff, 0x8c, 0x4e, 0x43, 0xe4, 0x22, 0x41, 0x4c, 0x41, 0x44, 0x42,
-  0x44, 0x41, 0x0c, 0x84, 0x24, 0x40, 0x51, 0x84, 0x28, 0x41, 0x10, 0x05,
-  0x41, 0x42, 0x41, 0x10, 0x06, 0x61, 0x10, 0x44, 0x04, 0x44, 0x40, 0x14,
-  0x42, 0x04, 0x44, 0x21, 0x44, 0x40, 0x04, 0x44, 0x24, 0x12, 0x20, 0x01,
-  0x43, 0x01, 0x43, 0x41, 0x72, 0x14, 0x08, 0x45, 0x08, 0x45, 0x08, 0xef,
-  0xd9, 0x07, 0x4f, 0x61, 0xf3, 0x16, 0x26, 0x35, 0x54, 0x75, 0xf5, 0x5c,
-  0x64, 0xa5, 0xf8, 0x2d, 0x2c, 0x4f, 0x42, 0x42, 0xb2, 0x12, 0x11, 0x82,
-  0xf1, 0x15, 0x16, 0xef, 0x41, 0x71, 0x24, 0x75, 0x2c, 0xfb, 0x3a, 0x3c,
-  0x3f, 0x41, 0xf1, 0x2c, 0x3d, 0x9d, 0x19, 0x85, 0xfc, 0x18, 0x1d, 0xcf,
-  0xd4, 0xf4, 0x4b, 0x49, 0x47, 0x64, 0x7f, 0xf4, 0xf4, 0x54, 0x1c, 0x8f,
-  0xa5, 0x74, 0x6a, 0xfc, 0x3d, 0x15, 0x4f, 0x47, 0xf7, 0x3e, 0x36, 0xaf,
-  0xe5, 0x55, 0x44, 0x4f, 0x41, 0xf3, 0x24, 0x26, 0x25, 0x5e, 0xd5, 0x4f,
-  0xc4, 0x54, 0xc7, 0x3b, 0x66, 0x5f, 0x53, 0xf3, 0x54, 0x54, 0x7f, 0x44,
-  0xb4, 0x49, 0xf6, 0x79, 0x71, 0x1b, 0x55, 0xef, 0xc4, 0x54, 0xcc, 0x47,
-  0x62, 0xcb, 0x46, 0xaf, 0x42, 0xe2, 0xd4, 0xf6, 0x5c, 0x5d, 0x8f, 0x81,
-  0xf1, 0x18, 0x1c, 0xcc, 0xf1, 0x2c, 0x2f, 0x1e, 0x77, 0x24, 0x3b, 0x31,
-  0x7e, 0x71, 0x1f, 0xe1, 0xd1, 0x57, 0x54, 0xa8, 0x35, 0xd3, 0xdd, 0xf2,
-  0x2d, 0x2c, 0xdf, 0xc2, 0x52, 0x28, 0x6f, 0xc3, 0x71, 0x12, 0xe2, 0x41,
-  0xd3, 0x31, 0xf1, 0x1a, 0x38, 0x6f, 0x42, 0x72, 0x2f, 0xfb, 0x2a, 0x3c,
-  0xaf, 0xe1, 0xf1, 0x2d, 0x3f, 0xef, 0xd1, 0x51, 0xca, 0x9f, 0xd1, 0xf1,
-  0x5d, 0x56, 0xff, 0xd4, 0xe4, 0x3c, 0xec, 0xb4, 0xf4, 0x54, 0xce, 0xef,
-  0xe5, 0xf5, 0x6a, 0x5f, 0x6f, 0x73, 0xf5, 0x71, 0x71, 0xaf, 0xa1, 0xf1,
-  0x5a, 0x5d, 0x65, 0xbc, 0x12, 0xe2, 0xa2, 0xd6, 0xe2, 0xd1, 0x55, 0xf4,
-  0x42, 0x48, 0x95, 0xfb, 0x46, 0x4c, 0xdf, 0xd2, 0xf7, 0x18, 0x58, 0x3f,
-  0x34, 0xf5, 0x5c, 0x74, 0x9b, 0x77, 0x1f, 0x55, 0xf7, 0x4a, 0x5a, 0x8d,
-  0x28, 0x6f, 0x42, 0xb3, 0x7e, 0xf7, 0x2a, 0x24, 0x2f, 0xd1, 0xf6, 0x5c,
-  0x5c, 0x4f, 0x41, 0xf1, 0x52, 0x54, 0x1e, 0x1c, 0xcd, 0x3e, 0xdf, 0x7d,
-  0x4f, 0xf3, 0x12, 0x31, 0x1b, 0x73, 0x51, 0x74, 0xb5, 0x58, 0x31, 0xef,
-  0xc1, 0xf3, 0x21, 0x29, 0x8f, 0x92, 0x52, 0x6c, 0x2f, 0x41, 0x31, 0x12,
-  0xaf, 0x81, 0x53, 0x29, 0xbf, 0x31, 0xf1, 0x2c, 0x22, 0xbf, 0x73, 0xf1,
-  0x3a, 0x39, 0xff, 0x93, 0xf1, 0x3b, 0x38, 0x7f, 0x55, 0xd5, 0x8b, 0xf4,
-  0x1d, 0x11, 0x9f, 0x14, 0xf5, 0x4e, 0x4f, 0x1c, 0xf8, 0x52, 0x53, 0x8f,
-  0x85, 0xf5, 0x54, 0x56, 0xed, 0x19, 0xaf, 0xd6, 0xf4, 0x6a, 0x69, 0xaf,
-  0x22, 0xf2, 0x4e, 0x4a, 0x1e, 0x1c, 0x3e, 0x32, 0x2f, 0x22, 0x56, 0xae,
-  0x95, 0xef, 0x84, 0x54, 0x91, 0x4f, 0x44, 0xf4, 0x51, 0x51, 0x1a, 0xf1,
-  0x4b, 0x59, 0xaf, 0xc3, 0xf3, 0x31, 0x31, 0x5e, 0x71, 0x2b, 0x54, 0xa5,
-  0xf8, 0x2e, 0x3a, 0xaf, 0xc7, 0xf7, 0x62, 0x62, 0xcb, 0x62, 0x5e, 0x58,
-  0x4f, 0x45, 0xb4, 0x52, 0xb5, 0x1c, 0xc1, 0x1a, 0xbe, 0x86, 0xf0, 0x15,
-  0x34, 0x1f, 0x33, 0xf7, 0x17, 0x1a, 0x27, 0xd4, 0xc5, 0x5c, 0x21, 0x9f,
-  0x81, 0xf3, 0x25, 0x2c, 0x9f, 0x82, 0x72, 0x2c, 0xf6, 0x32, 0x3c, 0x27,
-  0xa1, 0xef, 0x81, 0x51, 0xb9, 0xef, 0xe1, 0xf1, 0x2c, 0x2a, 0xbf, 0x73,
-  0xf1, 0x3b, 0x39, 0xff, 0xb3, 0xf3, 0x3d, 0x3f, 0x3b, 0x55, 0x8f, 0x84,
-  0xf4, 0x1d, 0x19, 0xdf, 0x74, 0xf5, 0x4b, 0x4a, 0x1c, 0xf8, 0x5c, 0x5f,
-  0xcf, 0xed, 0xf5, 0x52, 0x52, 0xed, 0x1b, 0xaf, 0xf7, 0xf5, 0x4c, 0x5d,
-  0xaf, 0xa1, 0xf1, 0x4f, 0x5a, 0x2f, 0x61, 0xf1, 0x36, 0x36, 0xaf, 0x22,
-  0xf2, 0x1e, 0x1a, 0x17, 0x74, 0x6f, 0xe4, 0x54, 0xb3, 0xaf, 0x84, 0xf4,
-  0x5d, 0x5d, 0xcf, 0xc1, 0xf1, 0x4b, 0x5b, 0xaf, 0xc3, 0xf3, 0x38, 0x39,
-  0x57, 0x11, 0x2f, 0x24, 0x75, 0x2e, 0xfc, 0x2e, 0x38, 0xaf, 0xc7, 0xf7,
-  0x7a, 0x6a, 0xeb, 0x67, 0x4f, 0xd5, 0xf5, 0x58, 0x48, 0x5a, 0xb5, 0x1c,
-  0x51, 0xf4, 0xde, 0xdf, 0x40, 0x01, 0x14, 0x00, 0x60, 0x12, 0x84, 0x40,
-  0x28, 0x22, 0x01, 0x40, 0x73, 0x11, 0x08, 0x16, 0x88, 0x22, 0x11, 0x18,
-  0x11, 0x08, 0x10, 0x01, 0x00, 0x18, 0x89, 0x22, 0x12, 0x08, 0x00, 0x00,
-  0x84, 0x00, 0x14, 0x12, 0xe0, 0x81, 0x44, 0x01, 0xc0, 0x48, 0x60, 0x81,
-  0xc0, 0x48, 0x20, 0x21, 0x04, 0x00, 0xdf, 0xc9, 0x09, 0x00, 0x81, 0x11,
-  0x24, 0x80, 0x41, 0x48, 0x01, 0x40, 0x18, 0x2a, 0x01, 0x12, 0x34, 0x11,
-  0x81, 0x11, 0x21, 0x11, 0x40, 0x42, 0xd1, 0x21, 0x54, 0x18, 0x2c, 0x21,
-  0x14, 0x21, 0xf4, 0x22, 0x1a, 0x83, 0x51, 0x22, 0xc0, 0x12, 0x12, 0x25,
-  0x02, 0x10, 0x71, 0x42, 0x81, 0x92, 0x18, 0x70, 0x22, 0x51, 0x81, 0x89,
-  0x61, 0x81, 0x21, 0x10, 0x02, 0x29, 0x21, 0x81, 0x81, 0x84, 0x21, 0xe2,
-  0xec, 0x0f, 0x3c, 0xf4, 0x11, 0x24, 0x8d, 0x12, 0x1f, 0xc1, 0x72, 0x48,
-  0xf3, 0x11, 0x24, 0xa7, 0x24, 0x1d, 0x24, 0xaf, 0x14, 0xd1, 0xc1, 0xf2,
-  0x4a, 0x93, 0x1d, 0x28, 0xaf, 0x14, 0x19, 0xf5, 0x4a, 0x91, 0x47, 0x82,
-  0xaf, 0x34, 0x39, 0x24, 0x2f, 0x14, 0x79, 0x24, 0xd8, 0x12, 0xf9, 0x24,
-  0x48, 0x1c, 0xf9, 0x24, 0x4a, 0x1c, 0xf8, 0x26, 0x4a, 0x16, 0xf1, 0x27,
-  0x4a, 0x96, 0xf1, 0x22, 0x4a, 0x96, 0xc5, 0x4a, 0x8f, 0x49, 0xd2, 0xa2,
-  0xf4, 0xd1, 0x24, 0x2d, 0x43, 0x1f, 0x49, 0x52, 0x38, 0x1f, 0x49, 0x32,
-  0x4a, 0x1f, 0x49, 0xf2, 0x4a, 0x12, 0x1f, 0x48, 0xf2, 0x4a, 0x12, 0x1f,
-  0x41, 0xf2, 0x4a, 0x92, 0x1b, 0x21, 0xab, 0x94, 0x53, 0xf1, 0x4a, 0x91,
-  0x4b, 0x43, 0xaf, 0x24, 0x39, 0x34, 0x2f, 0x24, 0x79, 0x24, 0x98, 0x92,
-  0x4f, 0x82, 0x84, 0xf9, 0x24, 0x4a, 0xee, 0x8b, 0x80, 0xd4, 0x81, 0x94,
-  0x58, 0x1b, 0x21, 0x83, 0xb4, 0x11, 0x32, 0x48, 0x28, 0x8b, 0x14, 0x28,
-  0x8f, 0x44, 0x88, 0xf2, 0x4a, 0xb4, 0xa0, 0xb4, 0xf0, 0x4a, 0x91, 0x22,
-  0x2b, 0x94, 0x26, 0xd8, 0x12, 0x79, 0x32, 0xe8, 0x14, 0xf9, 0x22, 0x18,
-  0x8d, 0x81, 0x2e, 0xd2, 0x5e, 0x81, 0x2e, 0x48, 0x92, 0x2e, 0x42, 0x96,
-  0xc1, 0x49, 0x8b, 0x2d, 0xbc, 0xe4, 0x8d, 0xe2, 0x22, 0x64, 0x8d, 0x81,
-  0x9a, 0x26, 0xb4, 0x91, 0xb6, 0x42, 0xa1, 0x28, 0xab, 0x14, 0x19, 0xd2,
-  0x4a, 0x99, 0x61, 0x8f, 0x46, 0x88, 0xb2, 0x4a, 0x89, 0xb4, 0x4a, 0x2b,
-  0xa2, 0xb4, 0x2a, 0x84, 0xb9, 0x22, 0x84, 0xf9, 0x22, 0x52, 0x9d, 0x76,
-  0x20, 0x28, 0x88, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x40, 0x01, 0x77,
-  0x9e, 0x24, 0x40, 0x41, 0x3c, 0x12, 0x85, 0x42, 0x31, 0x28, 0x8d, 0x11,
-  0x44, 0x24, 0x90, 0x11, 0x50, 0x12, 0x85, 0xd2, 0x21, 0x19, 0x64, 0x21,
-  0x30, 0x21, 0x00, 0x22, 0x88, 0x25, 0x34, 0x21, 0x42, 0x16, 0xf2, 0x41,
-  0x18, 0x35, 0x94, 0x22, 0x30, 0x42, 0x1e, 0x42, 0x46, 0x42, 0xd1, 0x14,
-  0x11, 0x82, 0x01, 0x50, 0x18, 0x48, 0x85, 0x03, 0x42, 0x21, 0x40, 0xc8,
-  0x48, 0x48, 0x29, 0x81, 0x38, 0x48, 0x2d, 0x82, 0x22, 0x40, 0x08, 0xcb,
-  0x63, 0x00, 0x8a, 0x01, 0x14, 0x44, 0x26, 0x82, 0xd1, 0x42, 0xf2, 0x21,
-  0x18, 0x8d, 0x21, 0x12, 0x84, 0x21, 0x88, 0x21, 0x42, 0x81, 0x29, 0x24,
-  0xd1, 0x22, 0xe8, 0x86, 0x61, 0x87, 0x00, 0x42, 0x90, 0x12, 0x1b, 0x24,
-  0x22, 0x3a, 0xb4, 0x11, 0xb4, 0x42, 0x48, 0x12, 0x38, 0x21, 0x45, 0x22,
-  0x12, 0x51, 0x32, 0x4c, 0xe5, 0x16, 0x11, 0x72, 0x22, 0xb8, 0x84, 0xa1,
-  0x42, 0x81, 0x1c, 0x4c, 0x68, 0x15, 0x19, 0x61, 0x11, 0x14, 0x8d, 0x53,
-  0x80, 0x24, 0x84, 0x68, 0x14, 0x24, 0x8f, 0xc8, 0x44, 0x02, 0xce, 0x11,
-  0xa4, 0x19, 0x41, 0x74, 0x22, 0xf2, 0x28, 0x12, 0x9d, 0x14, 0x4b, 0x21,
-  0x11, 0x63, 0x61, 0x31, 0x26, 0x62, 0x18, 0xa1, 0x4e, 0x82, 0x85, 0x66,
-  0x25, 0x16, 0x62, 0x38, 0x56, 0xa2, 0x52, 0x28, 0x1a, 0xd8, 0x42, 0x64,
-  0x38, 0x12, 0x1e, 0x22, 0x1e, 0x2b, 0x54, 0x3f, 0x23, 0x34, 0xc1, 0x21,
-  0xa9, 0xb5, 0x28, 0x44, 0x67, 0x37, 0x11, 0x60, 0x45, 0x1f, 0x22, 0x05,
-  0x83, 0x62, 0x69, 0x22, 0xc1, 0x1c, 0x48, 0xf8, 0x48, 0x11, 0x8f, 0x11,
-  0x22, 0x14, 0xf3, 0x48, 0x12, 0x89, 0x64, 0x2c, 0x2c, 0x06, 0x8d, 0x41,
-  0x12, 0xdf, 0xe2, 0x07, 0x00, 0x41, 0x10, 0x18, 0x01, 0x28, 0x85, 0xc1,
-  0x28, 0x40, 0x08, 0x40, 0x32, 0x11, 0x00, 0x20, 0x92, 0x28, 0x84, 0x00,
-  0x20, 0x22, 0x94, 0x41, 0x42, 0x2a, 0x05, 0x20, 0x44, 0x12, 0x11, 0x42,
-  0x44, 0x32, 0x11, 0x21, 0x50, 0x38, 0x48, 0x85, 0x81, 0x64, 0x24, 0x48,
-  0x00, 0x42, 0x13, 0x81, 0x31, 0x81, 0x24, 0x00, 0x82, 0x40, 0xd2, 0xe7,
-  0x09, 0x48, 0x00, 0x44, 0x22, 0x80, 0x01, 0x22, 0x13, 0x11, 0x42, 0x58,
-  0x12, 0x50, 0x12, 0x41, 0x44, 0x00, 0x40, 0x01, 0x80, 0x44, 0x04, 0x14,
-  0x60, 0x51, 0x20, 0x44, 0x22, 0x21, 0x72, 0x81, 0x04, 0x90, 0x12, 0x44,
-  0x24, 0x84, 0x00, 0x42, 0x12, 0x10, 0xc1, 0x11, 0x00, 0x12, 0x38, 0x41,
-  0x29, 0x42, 0x08, 0x22, 0x00, 0xb7, 0x48, 0x10, 0x01, 0x17, 0x82, 0x25,
-  0x58, 0x21, 0x1d, 0x28, 0x27, 0x72, 0x15, 0x98, 0x13, 0xa1, 0x4a, 0x92,
-  0x12, 0x24, 0x81, 0xc0, 0x18, 0x33, 0x91, 0x12, 0x26, 0x08, 0x22, 0x44,
-  0x89, 0x92, 0x28, 0x94, 0x44, 0x84, 0x23, 0xd1, 0x28, 0x92, 0x44, 0x71,
-  0x23, 0x12, 0x9c, 0x12, 0x18, 0x70, 0x13, 0x24, 0x42, 0x38, 0x3e, 0x88,
-  0x8c, 0xd1, 0x28, 0x11, 0x28, 0x22, 0x32, 0x12, 0x46, 0x18, 0x03, 0x23,
-  0xc4, 0x48, 0x23, 0x21, 0x38, 0x42, 0x63, 0x16, 0x84, 0x06, 0x57, 0x4a,
-  0x60, 0x14, 0x30, 0x29, 0xc1, 0x26, 0x61, 0x92, 0x28, 0x24, 0x1c, 0x62,
-  0x11, 0x28, 0x40, 0x51, 0xa2, 0x11, 0x4c, 0x51, 0x63, 0x40, 0x08, 0x10,
-  0x14, 0x38, 0x48, 0x15, 0x14, 0x44, 0x88, 0x31, 0x18, 0x47, 0x24, 0x4d,
-  0x43, 0x22, 0x27, 0x21, 0x18, 0x1a, 0x48, 0x12, 0x24, 0x01, 0x2d, 0x38,
-  0x90, 0x18, 0x81, 0x84, 0x12, 0x28, 0x1c, 0xd1, 0x38, 0x11, 0x01, 0x52,
-  0xac, 0x33, 0x14, 0x22, 0x25, 0x68, 0x42, 0x28, 0x00, 0x8f, 0x45, 0x05,
-  0x00, 0x10, 0x42, 0x42, 0x72, 0x11, 0x56, 0x81, 0x2c, 0x41, 0xca, 0x42,
-  0x83, 0x11, 0x02, 0x10, 0x28, 0x81, 0x81, 0x02, 0x26, 0x01, 0x22, 0x28,
-  0x81, 0x40, 0x11, 0x72, 0x24, 0x11, 0x02, 0x40, 0x2c, 0x42, 0x05, 0x16,
-  0x23, 0x42, 0x4c, 0x96, 0x88, 0x20, 0x31, 0x42, 0x28, 0x24, 0x80, 0x04,
-  0x24, 0x80, 0x44, 0x22, 0x28, 0x94, 0x42, 0x44, 0x62, 0xf0, 0x1e, 0x12,
-  0x20, 0x61, 0x82, 0x10, 0x42, 0x18, 0x48, 0x84, 0x43, 0x14, 0x14, 0xb2,
-  0x2a, 0xd4, 0x84, 0x12, 0x01, 0x88, 0x81, 0x9c, 0x34, 0x24, 0x00, 0x20,
-  0xd1, 0x1a, 0x01, 0x41, 0x12, 0x10, 0x41, 0x42, 0x02, 0x18, 0x18, 0x64,
-  0xc0, 0x48, 0x45, 0xc8, 0x24, 0xc0, 0x54, 0x28, 0x70, 0x52, 0x48, 0x02,
-  0x14, 0x80, 0x42, 0x08, 0x21, 0x00, 0xc0, 0x22, 0x44, 0x40, 0xf2, 0x13,
-  0x1c, 0x24, 0x50, 0x82, 0x21, 0x18, 0x90, 0x14, 0x00, 0x28, 0x84, 0x88,
-  0x24, 0x49, 0xd2, 0x28, 0x01, 0x22, 0x23, 0x01, 0x16, 0xa8, 0x21, 0x35,
-  0x14, 0xcc, 0x41, 0x29, 0x01, 0x11, 0x90, 0x28, 0x00, 0x12, 0xc0, 0x42,
-  0x8e, 0x29, 0x28, 0x48, 0x8c, 0x04, 0x12, 0x42, 0x11, 0x8c, 0x04, 0x28,
-  0x22, 0x59, 0x82, 0x82, 0x91, 0x28, 0x30, 0x34, 0x12, 0x43, 0x04, 0x47,
-  0x26, 0x24, 0x4a, 0x82, 0x08, 0x36, 0x0a, 0x14, 0x10, 0x49, 0x24, 0x11,
-  0xc2, 0x28, 0x85, 0x44, 0x21, 0x01, 0x14, 0x00, 0x18, 0x14, 0x10, 0x46,
-  0x02, 0x80, 0x32, 0x28, 0x44, 0x41, 0x10, 0x44, 0x66, 0x22, 0x81, 0x10,
-  0x04, 0x40, 0x71, 0x24, 0x62, 0x22, 0x40, 0x02, 0x00, 0x8b, 0x21, 0x00,
-  0x12, 0x18, 0x40, 0x01, 0x00, 0x30, 0x18, 0x18, 0x81, 0x10, 0x04, 0xff,
-  0xfc, 0x4a, 0xc3, 0x12, 0x10, 0x62, 0x41, 0x90, 0x1e, 0x22, 0x87, 0x42,
-  0x5c, 0x32, 0x14, 0x23, 0xd8, 0x1a, 0x54, 0x82, 0x1c, 0x01, 0xa2, 0x83,
-  0x91, 0x41, 0x16, 0x78, 0x22, 0x02, 0xd0, 0x81, 0x44, 0x14, 0x44, 0x84,
-  0xc1, 0x28, 0x50, 0x28, 0x12, 0x41, 0x18, 0x8e, 0x18, 0x14, 0x4c, 0x26,
-  0x02, 0x49, 0x21, 0x94, 0x15, 0x89, 0x94, 0x18, 0x52, 0x26, 0x92, 0x31,
-  0x1c, 0x82, 0x11, 0x01, 0x2e, 0x16, 0x40, 0x44, 0x38, 0x64, 0x28, 0x41,
-  0x86, 0x04, 0x6e, 0x26, 0x40, 0x81, 0x52, 0x38, 0x90, 0x18, 0x10, 0x2c,
-  0x01, 0x84, 0x80, 0x02, 0x84, 0x29, 0x11, 0x51, 0x22, 0x45, 0xc8, 0x24,
-  0x12, 0x54, 0x47, 0x82, 0x38, 0x15, 0x08, 0x11, 0x44, 0x45, 0xc2, 0x21,
-  0x21, 0x10, 0x22, 0x34, 0x22, 0x4c, 0x52, 0x22, 0x10, 0x8e, 0x12, 0x82,
-  0x24, 0x82, 0x32, 0x2a, 0x00, 0x12, 0x40, 0x18, 0x08, 0x18, 0x48, 0x18,
-  0x12, 0xa1, 0x2a, 0x04, 0xd0, 0x81, 0x02, 0x10, 0x81, 0x01, 0x20, 0x81,
-  0x62, 0x12, 0x00, 0x81, 0x15, 0x08, 0x21, 0x00, 0x84, 0x1c, 0x51, 0x84,
-  0x24, 0x85, 0x22, 0x81, 0x41, 0x08, 0x81, 0x12, 0xc9, 0x23, 0x02, 0x00,
-  0x12, 0x00, 0x22, 0x42, 0xc4, 0x12, 0x26, 0x02, 0x10, 0x02, 0x26, 0x12,
-  0x08, 0x00, 0x41, 0x22, 0x21, 0x10, 0x02, 0x20, 0x82, 0x01, 0x27, 0x13,
-  0x00, 0x10, 0x02, 0x21, 0x28, 0x10, 0x94, 0x18, 0x41, 0x21, 0x25, 0x14,
-  0x17, 0x11, 0x04, 0x00, 0x10, 0x82, 0x01, 0x44, 0x00, 0x16, 0x12, 0x01,
-  0x81, 0x20, 0x81, 0x04, 0x91, 0x81, 0x24, 0x00, 0x00, 0x00, 0x00, 0x81,
-  0x18, 0x70, 0x26, 0x09, 0x20, 0x21, 0x42, 0x21, 0x02, 0x84, 0x48, 0x84,
-  0x21, 0xaf, 0x57, 0x0f, 0x44, 0x44, 0x84, 0x28, 0x40, 0x19, 0x48, 0x42,
-  0x42, 0x28, 0x11, 0x42, 0x54, 0x84, 0x84, 0x00, 0xc1, 0x40, 0x08, 0xc1,
-  0x85, 0x42, 0x02, 0x14, 0x00, 0x8c, 0x41, 0x2a, 0x04, 0x00, 0x21, 0x11,
-  0x40, 0x81, 0x02, 0x21, 0x21, 0x28, 0x00, 0x00, 0x00, 0x27, 0x81, 0x81,
-  0x44, 0x1a, 0x72, 0x38, 0xb4, 0x22, 0x11, 0x46, 0x18, 0x44, 0xf2, 0xa5,
-  0x1d, 0x24, 0x24, 0x83, 0x51, 0x22, 0x4c, 0x91, 0x32, 0x86, 0x14, 0x02,
-  0x41, 0x11, 0x40, 0x24, 0x11, 0x32, 0x22, 0x44, 0x00, 0x89, 0x51, 0x14,
-  0x00, 0x21, 0x43, 0x01, 0x4c, 0x01, 0x24, 0x00, 0xc0, 0x22, 0x00, 0x00,
-  0x1a, 0x82, 0x04, 0x80, 0x72, 0x48, 0x02, 0xa3, 0x41, 0x14, 0x04, 0x12,
-  0x84, 0x00, 0x83, 0x01, 0x14, 0x60, 0x23, 0x10, 0x62, 0x81, 0x3f, 0xfa,
-  0x04, 0x82, 0x00, 0x00, 0x18, 0x41, 0x8c, 0x01, 0x49, 0x11, 0x18, 0x38,
-  0x13, 0x00, 0x40, 0xa4, 0x12, 0x24, 0xa4, 0x84, 0x44, 0x80, 0x02, 0x22,
-  0x44, 0x41, 0x40, 0x04, 0xc1, 0x60, 0x41, 0x40, 0x04, 0x21, 0x48, 0x55,
-  0x08, 0x11, 0x24, 0x87, 0x14, 0x24, 0xb4, 0x84, 0x20, 0xa1, 0x24, 0x22,
-  0x22, 0x00, 0x00, 0x22, 0x28, 0xf0, 0xf7, 0x16, 0x00, 0x41, 0x00, 0x81,
-  0x41, 0x99, 0x82, 0x12, 0x01, 0x80, 0x01, 0x4c, 0x02, 0x81, 0x18, 0x24,
-  0x44, 0x22, 0x80, 0xc1, 0x14, 0x81, 0x24, 0x84, 0x12, 0x1a, 0x22, 0x12,
-  0x43, 0x02, 0x28, 0x20, 0x02, 0x28, 0x28, 0x00, 0x2c, 0x02, 0x84, 0x10,
-  0x3a, 0x44, 0x24, 0x00, 0x50, 0x22, 0x12, 0x00, 0x24, 0x81, 0x48, 0x24,
-  0x42, 0x3f, 0xdc, 0x0c, 0x20, 0x81, 0x11, 0x44, 0x04, 0x18, 0x44, 0x81,
-  0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x31, 0x45, 0x01, 0x00, 0x14,
-  0x44, 0x00, 0x10, 0x48, 0x48, 0x22, 0x12, 0x88, 0x24, 0x22, 0x02, 0x00,
-  0x41, 0x00, 0x12, 0x81, 0x40, 0x29, 0x01, 0x00, 0x80, 0x11, 0x18, 0x22,
-  0xf2, 0x42, 0x14, 0x24, 0x18, 0x21, 0x84, 0x25, 0x21, 0x12, 0x01, 0x12,
-  0x34, 0x36, 0x0a, 0x19, 0x21, 0x42, 0xa8, 0x21, 0x34, 0x81, 0x41, 0x12,
-  0x00, 0x00, 0x10, 0x1b, 0x03, 0x10, 0x13, 0x12, 0x13, 0x22, 0xc1, 0x12,
-  0x16, 0x02, 0x21, 0x23, 0x32, 0x42, 0x20, 0x31, 0x28, 0x85, 0x54, 0x24,
-  0x00, 0x29, 0x81, 0x01, 0x2c, 0x12, 0x08, 0x00, 0x22, 0x22, 0x00, 0xf0,
-  0x34, 0xf7, 0x50, 0x84, 0x80, 0x94, 0x18, 0x49, 0x11, 0x98, 0x11, 0x91,
-  0x18, 0x80, 0x41, 0x14, 0xc8, 0x22, 0x81, 0x00, 0x84, 0x40, 0x04, 0x83,
-  0x52, 0xa2, 0x14, 0x18, 0x44, 0x1c, 0x48, 0x41, 0x44, 0x09, 0x68, 0x85,
-  0x01, 0x40, 0x08, 0x48, 0x00, 0x00, 0x28, 0x10, 0x04, 0x81, 0xc0, 0x28,
-  0x18, 0x00, 0x2a, 0x41, 0x98, 0x1a, 0x48, 0x10, 0x02, 0xde, 0xde, 0x00,
-  0x4b, 0x18, 0x81, 0x26, 0x52, 0x48, 0x45, 0xa5, 0x12, 0x19, 0x43, 0x93,
-  0x32, 0x85, 0x3a, 0x11, 0x10, 0xb2, 0x22, 0x01, 0x8d, 0x18, 0x8b, 0x12,
-  0x27, 0x21, 0x34, 0xa7, 0x81, 0x83, 0x63, 0x41, 0xe5, 0x51, 0x12, 0x35,
-  0x95, 0x11, 0x2e, 0x14, 0x4d, 0x21, 0x25, 0x5c, 0x32, 0x21, 0x84, 0x16,
-  0x0b, 0xa0, 0x32, 0x29, 0x02, 0x44, 0x2e, 0x22, 0x15, 0x98, 0x22, 0x35,
-  0x0a, 0x85, 0x1c, 0x42, 0x48, 0x68, 0xc4, 0x8f, 0xa2, 0x92, 0x22, 0x2c,
-  0x11, 0xec, 0xa3, 0xa2, 0x11, 0x21, 0x22, 0x21, 0x2f, 0x35, 0x46, 0x42,
-  0x46, 0x62, 0x21, 0x16, 0x34, 0x32, 0x36, 0x72, 0x11, 0x75, 0x38, 0x5f,
-  0x81, 0xc7, 0x71, 0x2b, 0x11, 0x81, 0x3e, 0x16, 0xd4, 0x50, 0x49, 0x41,
-  0x55, 0x9c, 0x18, 0xa3, 0x02, 0x4d, 0x14, 0x85, 0x4b, 0x4a, 0xf2, 0x2c,
-  0x18, 0x41, 0x4f, 0x21, 0x52, 0x22, 0x85, 0x02, 0x90, 0x38, 0x8d, 0x14,
-  0x2f, 0x21, 0xd2, 0x21, 0x12, 0x32, 0x25, 0x6a, 0x97, 0x21, 0x23, 0x71,
-  0x2a, 0x62, 0x62, 0xc7, 0x44, 0x27, 0xa2, 0x17, 0x21, 0x85, 0xd2, 0x48,
-  0x11, 0x58, 0x28, 0x2b, 0x11, 0x43, 0xa3, 0x22, 0x28, 0x29, 0xb1, 0x22,
-  0xd2, 0x88, 0x32, 0x14, 0x2a, 0xf5, 0x7f, 0xe6, 0x14, 0x69, 0x71, 0x1a,
-  0xd5, 0x82, 0xd1, 0x87, 0x91, 0x34, 0x9d, 0x18, 0x8d, 0x28, 0x41, 0x8f,
-  0x41, 0x41, 0x08, 0x2d, 0x1b, 0xf5, 0x51, 0x2c, 0x8d, 0x2c, 0x41, 0x21,
-  0x12, 0x45, 0x5c, 0xc4, 0x50, 0x82, 0x49, 0xf1, 0x21, 0x14, 0x81, 0x12,
-  0x27, 0x11, 0x95, 0xf1, 0x28, 0x1c, 0x15, 0x81, 0xe5, 0xc6, 0x36, 0x12,
-  0x40, 0x78, 0x22, 0xd4, 0x28, 0x44, 0x0a, 0x87, 0x22, 0x80, 0x54, 0x88,
-  0x12, 0xc5, 0x34, 0x46, 0x1e, 0x18, 0x2f, 0x11, 0xc2, 0x12, 0x1b, 0x33,
-  0xc0, 0x18, 0x12, 0x36, 0x0a, 0xc7, 0x84, 0x6a, 0x54, 0x28, 0x81, 0xc7,
-  0x1c, 0x00, 0x00, 0x00, 0x14, 0x50, 0x14, 0x16, 0x58, 0x24, 0x40, 0x03,
-  0x24, 0x40, 0x45, 0x48, 0x21, 0x51, 0x38, 0x50, 0x18, 0x10, 0x18, 0x43,
-  0x04, 0x10, 0x53, 0x48, 0x31, 0x44, 0x18, 0x44, 0x21, 0x15, 0x14, 0x52,
-  0x41, 0x50, 0x41, 0x50, 0xc1, 0x24, 0x15, 0x48, 0x52, 0x81, 0x24, 0x13,
-  0x01, 0x45, 0x48, 0x12, 0x04, 0x41, 0x81, 0x43, 0x01, 0x41, 0xf0, 0x9b,
-  0x38, 0x70, 0x16, 0xf6, 0x14, 0x12, 0xa5, 0xfa, 0x1d, 0x17, 0xaf, 0x83,
-  0xb2, 0x39, 0x72, 0x19, 0xf9, 0x24, 0x2c, 0xcd, 0x1c, 0xab, 0x32, 0x8d,
-  0x18, 0x97, 0x81, 0x8f, 0x81, 0x51, 0x2c, 0x8f, 0x81, 0x51, 0x74, 0x3f,
-  0x91, 0xf1, 0x2d, 0x26, 0x7d, 0x1e, 0xcf, 0xe2, 0x52, 0x91, 0xdf, 0x53,
-  0xe3, 0xc1, 0xf1, 0x2c, 0x24, 0xa5, 0xf8, 0x2c, 0x2c, 0x1a, 0xe1, 0x21,
-  0xf1, 0x22, 0x2a, 0x81, 0x6f, 0x44, 0xf4, 0x4c, 0x4c, 0x4f, 0xc1, 0x52,
-  0xa8, 0x5f, 0x53, 0xf3, 0x25, 0x25, 0x5f, 0x72, 0xe2, 0x62, 0x52, 0x57,
-  0xd5, 0xfd, 0x35, 0x37, 0xaf, 0x84, 0xf6, 0x4d, 0x65, 0xff, 0x94, 0x54,
-  0x1d, 0x4e, 0x48, 0x8d, 0x13, 0x8f, 0x91, 0x51, 0x48, 0x9f, 0xd5, 0xf5,
-  0x2c, 0x36, 0x3a, 0xf1, 0x24, 0x34, 0xcf, 0xc2, 0xf1, 0x24, 0x36, 0xaf,
-  0x83, 0xf4, 0x2c, 0x2c, 0x45, 0xfc, 0x64, 0x68, 0xaf, 0xb5, 0x4f, 0x72,
-  0x14, 0xf6, 0x54, 0x56, 0xa5, 0xfa, 0x1d, 0x57, 0xef, 0x83, 0xf1, 0x3d,
-  0x1c, 0x9f, 0x83, 0xf3, 0x39, 0x29, 0x8f, 0x11, 0xf1, 0x3a, 0x3a, 0x8f,
-  0xc1, 0x51, 0xbb, 0xaf, 0xc1, 0x53, 0x8e, 0xaf, 0x81, 0x51, 0xb8, 0xbf,
-  0x91, 0xf1, 0x3d, 0x3a, 0xbd, 0x1e, 0x7f, 0xd2, 0x52, 0x9b, 0xff, 0xd2,
-  0xf3, 0x1c, 0x18, 0xcf, 0xc2, 0x53, 0xab, 0x9f, 0x8a, 0xfa, 0x11, 0x11,
-  0x4f, 0x61, 0x59, 0xad, 0xc5, 0xfc, 0x47, 0x46, 0x9f, 0x96, 0xf6, 0x18,
-  0x38, 0xcd, 0x1f, 0x4f, 0xc3, 0x13, 0xf2, 0x23, 0x63, 0x1d, 0x27, 0x6d,
-  0x24, 0x8f, 0x82, 0xf2, 0x31, 0x33, 0xbf, 0x14, 0xf6, 0x4e, 0x6c, 0xef,
-  0x64, 0x54, 0xfd, 0xff, 0x94, 0x74, 0x1a, 0xf9, 0x1e, 0x39, 0x9f, 0xd1,
-  0xf1, 0x58, 0x54, 0xef, 0xc3, 0xf3, 0x36, 0x34, 0x3a, 0xe3, 0x83, 0xf3,
-  0x34, 0x3e, 0xef, 0x43, 0xf7, 0x22, 0x28, 0x2e, 0x28, 0x4f, 0xc6, 0xf7,
-  0xf1, 0x38, 0x70, 0x16, 0xe4, 0x61, 0x74, 0x1e, 0xfc, 0x1d, 0x1f, 0xaf,
-  0xc3, 0xf3, 0x38, 0x24, 0x8f, 0x91, 0xf2, 0x35, 0x2c, 0xdf, 0xc1, 0xf1,
-  0x36, 0x3c, 0xad, 0x1e, 0x9f, 0xa1, 0xf1, 0x18, 0x39, 0xa5, 0xf2, 0x1a,
-  0x18, 0xd5, 0xfe, 0x1a, 0x19, 0xcf, 0xf3, 0xd3, 0x4e, 0xf1, 0x2d, 0x2d,
-  0xc5, 0xfc, 0x3e, 0x3c, 0x9f, 0xd1, 0xf1, 0x2d, 0x3f, 0x65, 0xfd, 0x2c,
-  0xad, 0x1a, 0xf1, 0x11, 0x15, 0xad, 0x2f, 0xd5, 0xff, 0x42, 0x41, 0x8f,
-  0x94, 0xf4, 0x18, 0x38, 0xcd, 0x1e, 0x2f, 0x83, 0xc3, 0x22, 0x2c, 0xf6,
-  0x25, 0x23, 0x25, 0x54, 0x88, 0x1a, 0x53, 0xff, 0x2e, 0x28, 0xef, 0x84,
-  0x54, 0xc6, 0xbf, 0xd4, 0xf4, 0x1a, 0x1a, 0xbd, 0x38, 0x8f, 0x81, 0xf1,
-  0x5d, 0x59, 0x2f, 0xa3, 0xf3, 0x36, 0x34, 0x3a, 0xa3, 0x33, 0x8f, 0x83,
-  0xf3, 0x3e, 0x7c, 0xaf, 0x86, 0xf6, 0x28, 0x28, 0xcf, 0x86, 0xf7, 0xde,
-  0xdf, 0x24, 0x47, 0x61, 0x6f, 0x61, 0xf5, 0x1e, 0x1e, 0xff, 0xf5, 0xf1,
-  0x3e, 0x38, 0xdf, 0xc3, 0xf2, 0x3d, 0x3c, 0xdf, 0xd3, 0xe2, 0x91, 0xf1,
-  0x3e, 0x3e, 0x2f, 0x81, 0x51, 0xbb, 0xef, 0x91, 0x51, 0x8a, 0xaf, 0x81,
-  0x51, 0xed, 0x6f, 0xd1, 0xf1, 0x3c, 0x37, 0xed, 0x1e, 0xef, 0x42, 0x52,
-  0xd7, 0xcf, 0x43, 0xf3, 0x11, 0x1d, 0xdf, 0x72, 0x52, 0xf7, 0xdf, 0xd2,
-  0xfa, 0x15, 0x15, 0x57, 0x59, 0x55, 0x5b, 0x39, 0x7f, 0x74, 0xf4, 0x2c,
-  0x2d, 0x8f, 0x81, 0xd3, 0xa9, 0xf1, 0x36, 0x34, 0x7d, 0x27, 0x3f, 0x32,
-  0x72, 0x24, 0x72, 0x22, 0xf4, 0x2d, 0x2d, 0x1f, 0x33, 0x53, 0xe6, 0xaf,
-  0x82, 0xf2, 0x47, 0x4b, 0xd5, 0xff, 0x42, 0x4c, 0xab, 0x11, 0xb7, 0x81,
-  0x9f, 0x91, 0xf1, 0x54, 0x58, 0xef, 0xc3, 0xb3, 0x32, 0xa3, 0x33, 0xcf,
-  0xc3, 0xf3, 0x2c, 0x3e, 0xaf, 0x83, 0xf6, 0x68, 0x68, 0xcf, 0xc2, 0xf2,
-  0x6c, 0x6c, 0x3f, 0x3f, 0x0e, 0x49, 0x01, 0x41, 0x84, 0x41, 0x00, 0x00,
-  0x84, 0x00, 0x40, 0x48, 0x14, 0x01, 0x84, 0x85, 0x04, 0x85, 0x14, 0x51,
-  0x48, 0x50, 0x48, 0x00, 0x18, 0x85, 0x04, 0x00, 0x80, 0x01, 0x00, 0x22,
-  0x40, 0x02, 0x40, 0x08, 0x84, 0x60, 0x81, 0x14, 0x40, 0x41, 0x88, 0x02,
-  0x28, 0x12, 0x89, 0x02, 0x89, 0x02, 0x7f, 0x8a, 0x02, 0x82, 0x12, 0xa5,
-  0x22, 0x01, 0x8c, 0xf2, 0x28, 0x11, 0x12, 0x34, 0x90, 0x18, 0x12, 0xa5,
-  0x01, 0x21, 0x84, 0x14, 0x11, 0x18, 0x11, 0x21, 0x12, 0x14, 0x40, 0x51,
-  0x83, 0x50, 0x21, 0x50, 0x21, 0xa0, 0x42, 0x40, 0x0a, 0x34, 0x28, 0x14,
-  0x40, 0x83, 0x42, 0x81, 0x52, 0x16, 0x50, 0x32, 0x11, 0x81, 0x13, 0x41,
-  0x02, 0x18, 0xc0, 0x12, 0x20, 0x04, 0x40, 0xc1, 0xf1, 0xd0, 0x32, 0xf4,
-  0x11, 0x24, 0x87, 0x32, 0x1f, 0x41, 0x72, 0x48, 0xf2, 0x11, 0x24, 0xe7,
-  0x34, 0x1f, 0xc1, 0xf2, 0x4e, 0x13, 0x1d, 0x2c, 0xaf, 0x34, 0x99, 0x21,
-  0xaf, 0x34, 0x19, 0xf5, 0x4a, 0x91, 0x43, 0xf2, 0x4a, 0x95, 0x47, 0x83,
-  0xaf, 0x34, 0x79, 0x34, 0xd8, 0x1a, 0xf9, 0x24, 0x48, 0x8d, 0x91, 0x4f,
-  0xa2, 0xc4, 0x81, 0x6f, 0xa2, 0x74, 0x18, 0xf5, 0x26, 0x4a, 0x87, 0x19,
-  0x6f, 0xa2, 0x65, 0x59, 0x6d, 0x5a, 0x9e, 0x24, 0x6d, 0x5a, 0x1f, 0x49,
-  0xd2, 0x26, 0xf4, 0x91, 0x24, 0xed, 0x12, 0x1f, 0xc9, 0xb2, 0x4c, 0xf1,
-  0x91, 0x24, 0xe7, 0x24, 0x1f, 0xc9, 0xf2, 0x6a, 0x12, 0x1f, 0xc1, 0xf2,
-  0x4a, 0x92, 0x1f, 0x81, 0xf2, 0x4a, 0x92, 0x51, 0xaf, 0x64, 0x79, 0x24,
-  0xf8, 0x4a, 0x96, 0x47, 0x82, 0x2f, 0x44, 0x79, 0x34, 0xd8, 0x42, 0xf9,
-  0x34, 0x48, 0x4c, 0xf9, 0x24, 0x4a, 0xae, 0x5a, 0xc0, 0x4a, 0x1f, 0x41,
-  0xd6, 0x28, 0x64, 0x41, 0x83, 0xe4, 0x41, 0x32, 0x48, 0x8c, 0x32, 0x4a,
-  0x15, 0xf8, 0x48, 0x94, 0x28, 0xaf, 0x44, 0x1b, 0xb4, 0x48, 0x6b, 0x82,
-  0xaf, 0x14, 0x59, 0x84, 0x8f, 0x14, 0x58, 0x84, 0xad, 0x91, 0x6d, 0x48,
-  0x8d, 0x91, 0x6d, 0x52, 0x88, 0x8c, 0xfd, 0x18, 0x81, 0x4f, 0x22, 0x34,
-  0x98, 0x2a, 0x34, 0x98, 0x3c, 0xa4, 0x28, 0x9c, 0x74, 0x91, 0xc8, 0x4a,
-  0x1b, 0x69, 0x81, 0x1f, 0x89, 0x36, 0x48, 0x1f, 0x88, 0x12, 0xf2, 0x91,
-  0x28, 0x83, 0xf4, 0x11, 0x2c, 0xaf, 0x44, 0xf8, 0x11, 0x28, 0xaf, 0x44,
-  0x3b, 0x11, 0x4a, 0x6b, 0x82, 0x4a, 0x69, 0x82, 0xab, 0x94, 0x36, 0x98,
-  0x92, 0x2f, 0x83, 0x84, 0xf9, 0x22, 0x1a, 0x4f, 0xcc, 0x0c, 0x00, 0x48,
-  0x18, 0x00, 0x00, 0x28, 0x00, 0x44, 0x00, 0x80, 0x02, 0x40, 0x01, 0x00,
-  0x00, 0x00, 0x88, 0x00, 0x00, 0x40, 0x01, 0x00, 0x80, 0x04, 0x24, 0x00,
-  0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x76, 0x0e,
-  0x22, 0x1c, 0x02, 0x60, 0x82, 0x14, 0x84, 0x14, 0x13, 0x03, 0x18, 0x82,
-  0x10, 0x12, 0x81, 0x08, 0xa0, 0x12, 0x96, 0x94, 0x24, 0xc0, 0x21, 0x48,
-  0x28, 0x1c, 0x84, 0x22, 0x84, 0x62, 0x22, 0xe0, 0x22, 0x01, 0x80, 0x25,
-  0x04, 0x18, 0x12, 0xa5, 0x04, 0x10, 0x42, 0x18, 0x08, 0x83, 0x08, 0x14,
-  0x48, 0x42, 0xc0, 0x42, 0x44, 0x84, 0x42, 0x28, 0x12, 0x48, 0x1d, 0x53,
-  0x20, 0xa1, 0x18, 0x37, 0x83, 0x1d, 0x12, 0x80, 0x01, 0x12, 0xa4, 0x45,
-  0x51, 0x81, 0x46, 0x51, 0x82, 0x3c, 0x41, 0x48, 0x52, 0xa4, 0x24, 0x91,
-  0x85, 0x12, 0x11, 0xa8, 0x41, 0x85, 0x26, 0xc4, 0x22, 0x19, 0x51, 0x48,
-  0x33, 0x14, 0x38, 0x25, 0x83, 0x38, 0x24, 0x89, 0x72, 0x24, 0x41, 0xb1,
-  0x22, 0x41, 0x3a, 0x24, 0x70, 0x64, 0xf3, 0x11, 0x28, 0x43, 0x22, 0xb9,
-  0x21, 0x64, 0x81, 0x32, 0x16, 0xc8, 0x46, 0x94, 0x1e, 0x26, 0x8c, 0x68,
-  0x41, 0x12, 0x1e, 0x64, 0x60, 0x45, 0x45, 0x41, 0xbc, 0xcd, 0x06, 0x12,
-  0x1b, 0x34, 0x16, 0x89, 0x51, 0x82, 0x18, 0x60, 0x11, 0x8c, 0x53, 0x16,
-  0x55, 0xe8, 0x18, 0x64, 0xc2, 0x17, 0x21, 0x15, 0xc8, 0x82, 0x84, 0x25,
-  0x92, 0x38, 0x8e, 0x1a, 0x64, 0x81, 0x1b, 0x41, 0x87, 0x65, 0x60, 0x38,
-  0x13, 0x51, 0x48, 0x31, 0x85, 0x12, 0x95, 0xa9, 0x63, 0x92, 0x28, 0x8f,
-  0x16, 0x21, 0x34, 0x42, 0x84, 0x67, 0x21, 0x70, 0x24, 0xd1, 0x83, 0x32,
-  0x26, 0x16, 0x28, 0x76, 0x14, 0xa8, 0x1a, 0x26, 0x48, 0x47, 0xe8, 0x64,
-  0x62, 0x88, 0x64, 0x4c, 0xd1, 0x48, 0x42, 0xc2, 0x44, 0x16, 0x64, 0xc5,
-  0xff, 0x97, 0x02, 0x22, 0x30, 0x22, 0x11, 0x22, 0x11, 0x81, 0x40, 0x01,
-  0x18, 0x50, 0x22, 0x00, 0x40, 0x04, 0x14, 0x41, 0x1c, 0x02, 0x28, 0xa0,
-  0x24, 0x2a, 0x84, 0x82, 0xa4, 0x24, 0x22, 0x28, 0x18, 0x00, 0x44, 0x14,
-  0x1a, 0x82, 0x81, 0x12, 0x8c, 0x84, 0x01, 0x88, 0x15, 0x08, 0x84, 0x18,
-  0x48, 0x46, 0x21, 0x01, 0x1a, 0x04, 0x1a, 0x24, 0x24, 0x03, 0xb0, 0xa3,
-  0x0f, 0x00, 0x14, 0x50, 0x12, 0x10, 0x0e, 0x10, 0x41, 0x23, 0x01, 0x40,
-  0x02, 0x6c, 0x11, 0x81, 0x01, 0x00, 0x50, 0x84, 0x00, 0x10, 0xc2, 0x21,
-  0x22, 0x12, 0x41, 0x10, 0x14, 0x51, 0x16, 0x11, 0x14, 0x40, 0x53, 0x41,
-  0x10, 0x21, 0x12, 0x91, 0x12, 0x00, 0x10, 0xc2, 0x48, 0x00, 0x00, 0x00,
-  0x20, 0xf2, 0x51, 0xe9, 0x14, 0x50, 0x61, 0x89, 0x48, 0x01, 0x14, 0x12,
-  0x3d, 0x12, 0x1a, 0x62, 0x82, 0x40, 0x13, 0x88, 0x51, 0x82, 0x24, 0x00,
-  0x11, 0x25, 0x11, 0x41, 0x14, 0x41, 0x01, 0x54, 0x31, 0x12, 0x30, 0x14,
-  0x42, 0x29, 0x21, 0x02, 0x00, 0x12, 0x4c, 0x11, 0xd3, 0x82, 0x04, 0x5d,
-  0x12, 0x40, 0x78, 0x44, 0x18, 0x41, 0x03, 0x25, 0x11, 0x04, 0x61, 0x25,
-  0x56, 0x24, 0x20, 0x44, 0x84, 0x04, 0x6f, 0x11, 0x03, 0x10, 0x11, 0x41,
-  0x03, 0x70, 0x12, 0x94, 0x11, 0x80, 0x12, 0x11, 0x11, 0x28, 0x01, 0x24,
-  0x49, 0x51, 0x12, 0x14, 0x25, 0x41, 0x01, 0x00, 0x00, 0x24, 0x12, 0x22,
-  0x38, 0x10, 0x04, 0x44, 0x14, 0x11, 0x18, 0x51, 0x31, 0x31, 0x50, 0x41,
-  0x80, 0x62, 0x74, 0x11, 0x00, 0x21, 0x61, 0x48, 0x10, 0x04, 0x80, 0x14,
-  0x04, 0xf0, 0xb7, 0xa3, 0x14, 0x50, 0x24, 0x89, 0x08, 0x14, 0x11, 0x81,
-  0x21, 0x29, 0x53, 0x81, 0x90, 0x12, 0x21, 0x24, 0x84, 0x21, 0x00, 0x18,
-  0x00, 0x44, 0x14, 0x55, 0x08, 0x45, 0x51, 0x12, 0x40, 0x41, 0x84, 0x35,
-  0x12, 0x22, 0x00, 0x25, 0x14, 0x81, 0x01, 0x8d, 0x42, 0x51, 0x18, 0x31,
-  0x81, 0x84, 0x18, 0x11, 0x21, 0x14, 0x50, 0x28, 0x44, 0x21, 0x25, 0x14,
-  0x02, 0x20, 0x24, 0xf2, 0x42, 0xf5, 0x40, 0x24, 0x02, 0x80, 0x21, 0x03,
-  0x00, 0x00, 0x13, 0x82, 0x12, 0x81, 0x41, 0xa1, 0x12, 0x25, 0x11, 0x08,
-  0xa0, 0x21, 0x11, 0x29, 0x01, 0x20, 0x14, 0x18, 0x02, 0x41, 0x4a, 0x12,
-  0x44, 0x12, 0x21, 0x81, 0x04, 0x16, 0x88, 0x44, 0x01, 0x14, 0x42, 0x80,
-  0x42, 0x01, 0x00, 0x43, 0x51, 0x84, 0x15, 0x14, 0x01, 0x24, 0x82, 0x00,
-  0x47, 0xb7, 0x00, 0x84, 0x22, 0x28, 0x40, 0x64, 0x42, 0x8d, 0x21, 0x44,
-  0x25, 0x5c, 0x21, 0x18, 0x6b, 0x21, 0x10, 0x82, 0x01, 0x00, 0x20, 0x61,
-  0x18, 0xd0, 0x82, 0x03, 0x14, 0x23, 0x21, 0x12, 0x01, 0x00, 0x40, 0x01,
-  0xd0, 0x82, 0x64, 0x31, 0x00, 0x80, 0x02, 0x11, 0x24, 0x41, 0x10, 0xd2,
-  0x41, 0x13, 0x04, 0x40, 0x18, 0x02, 0x2d, 0x42, 0x40, 0x44, 0xf2, 0x8a,
-  0x92, 0x00, 0x00, 0x31, 0x28, 0x00, 0x50, 0x12, 0x80, 0x01, 0x00, 0x10,
-  0x58, 0x82, 0x00, 0x23, 0x11, 0x02, 0x44, 0x1c, 0x44, 0x04, 0x45, 0xc1,
-  0x44, 0x41, 0x00, 0x80, 0x81, 0x02, 0x19, 0x44, 0x04, 0x00, 0x29, 0x01,
-  0x88, 0x20, 0x04, 0x00, 0x84, 0x00, 0x40, 0x11, 0x01, 0x00, 0x58, 0x44,
-  0x7e, 0xc4, 0x10, 0x04, 0x28, 0x31, 0x12, 0x49, 0xc2, 0x24, 0x22, 0x15,
-  0x54, 0xc2, 0x12, 0x2d, 0x13, 0x40, 0x21, 0x11, 0xa8, 0x12, 0x21, 0xa4,
-  0x18, 0x12, 0x1b, 0xa1, 0x15, 0x04, 0x00, 0x2f, 0x44, 0xc1, 0x68, 0x31,
-  0x00, 0x4a, 0x82, 0xc1, 0x22, 0x14, 0x11, 0x21, 0x12, 0x23, 0x01, 0x2d,
-  0x11, 0x00, 0x00, 0x28, 0x11, 0x21, 0xcd, 0x11, 0x41, 0x4c, 0x41, 0x44,
-  0x0e, 0x90, 0x42, 0x88, 0x48, 0x64, 0x8e, 0xd8, 0x20, 0x88, 0x02, 0x28,
-  0x22, 0x12, 0x50, 0x81, 0x21, 0x40, 0x81, 0x82, 0x01, 0x21, 0x13, 0x11,
-  0x1a, 0x01, 0x10, 0x02, 0xf0, 0x21, 0x48, 0x44, 0x11, 0x14, 0x41, 0x44,
-  0x40, 0x04, 0x44, 0x00, 0x58, 0x44, 0x14, 0x84, 0x42, 0x20, 0x32, 0x81,
-  0x46, 0x81, 0x14, 0x02, 0x00, 0x00, 0x81, 0x00, 0x00, 0xc0, 0x14, 0x14,
-  0x1b, 0xb5, 0x00, 0x00, 0x21, 0x24, 0x00, 0xc0, 0x22, 0x40, 0x23, 0x41,
-  0x41, 0x22, 0x01, 0x22, 0x00, 0x00, 0x40, 0x02, 0x30, 0x42, 0x22, 0x30,
-  0x22, 0x22, 0x12, 0x00, 0x00, 0x00, 0x80, 0x41, 0x02, 0x2c, 0x01, 0x00,
-  0x25, 0x04, 0x22, 0x50, 0x34, 0x00, 0x00, 0x10, 0x04, 0x44, 0x64, 0xaf,
-  0x4d, 0x07, 0x10, 0x18, 0x85, 0x82, 0x82, 0x12, 0x03, 0x11, 0x49, 0x32,
-  0x22, 0x90, 0x16, 0x00, 0x26, 0x04, 0x26, 0x14, 0x0a, 0x21, 0x2a, 0xb4,
-  0x18, 0x54, 0x34, 0x68, 0x44, 0x81, 0x43, 0x12, 0x81, 0x04, 0x62, 0x00,
-  0xa0, 0x12, 0x19, 0x01, 0x42, 0x26, 0x01, 0x20, 0x25, 0x04, 0x30, 0x52,
-  0x42, 0x42, 0x42, 0x12, 0x49, 0x04, 0x83, 0x04, 0x24, 0x10, 0x08, 0xcf,
-  0x49, 0x08, 0x82, 0x11, 0x10, 0x01, 0x14, 0x40, 0x41, 0x11, 0x01, 0x11,
-  0x00, 0x24, 0x34, 0x10, 0x01, 0x14, 0x48, 0xc0, 0x42, 0x48, 0x19, 0x44,
-  0x11, 0x02, 0x48, 0x25, 0x14, 0x12, 0x04, 0x80, 0x91, 0x11, 0x29, 0x14,
-  0x01, 0x44, 0x12, 0x11, 0x46, 0x11, 0x31, 0x41, 0x42, 0x13, 0x14, 0x26,
-  0x14, 0x23, 0x04, 0x00, 0x42, 0x00, 0x40, 0xf1, 0x63, 0xba, 0x20, 0x02,
-  0x19, 0x41, 0x08, 0x00, 0x10, 0x42, 0x18, 0xa4, 0x12, 0x50, 0x81, 0x4c,
-  0x02, 0x00, 0x26, 0x95, 0x24, 0x1c, 0x01, 0x21, 0x26, 0xc1, 0x32, 0x00,
-  0x00, 0x00, 0x20, 0x41, 0x02, 0x42, 0x10, 0x42, 0xa9, 0x41, 0x30, 0x52,
-  0x10, 0x42, 0x08, 0x21, 0x40, 0x08, 0x90, 0x22, 0x10, 0x04, 0x41, 0x90,
-  0x22, 0xf0, 0x87, 0x3b, 0x00, 0x14, 0x28, 0x00, 0x22, 0x11, 0x14, 0x26,
-  0x02, 0x2a, 0x11, 0x02, 0x00, 0x80, 0x23, 0x02, 0x12, 0x00, 0x22, 0x10,
-  0x21, 0x01, 0x22, 0x38, 0x42, 0x00, 0x21, 0x51, 0x00, 0x40, 0x14, 0x02,
-  0x00, 0x41, 0x42, 0x00, 0x10, 0x02, 0x46, 0x04, 0x00, 0x00, 0x00, 0x24,
-  0xf0, 0x9d, 0x26, 0x40, 0x02, 0x00, 0x28, 0x21, 0x38, 0x00, 0x40, 0x01,
-  0x14, 0x28, 0x80, 0x12, 0x42, 0x08, 0x25, 0x22, 0x11, 0x12, 0x02, 0x4c,
-  0x01, 0x14, 0x24, 0x44, 0x00, 0x18, 0x00, 0x40, 0x06, 0x20, 0x14, 0x11,
-  0x52, 0x24, 0x00, 0x10, 0x01, 0x28, 0x40, 0x42, 0x12, 0x44, 0x18, 0x02,
-  0x21, 0x40, 0x04, 0x57, 0x74, 0x40, 0x24, 0x02, 0x22, 0x43, 0x01, 0x30,
-  0x24, 0x41, 0x44, 0x20, 0x02, 0x00, 0x85, 0x14, 0x04, 0x10, 0x54, 0x81,
-  0x38, 0x21, 0xc0, 0x18, 0x49, 0xc2, 0x24, 0x10, 0x88, 0x92, 0x28, 0x50,
-  0x18, 0x68, 0x00, 0x80, 0x12, 0x01, 0x30, 0x22, 0x14, 0x22, 0x18, 0x60,
-  0x42, 0x80, 0x01, 0x81, 0x20, 0x01, 0x12, 0x84, 0x42, 0x23, 0x81, 0xf4,
-  0x66, 0xa2, 0x00, 0x82, 0x00, 0x50, 0x21, 0x00, 0x18, 0x2c, 0x02, 0x24,
-  0x00, 0x22, 0x10, 0x11, 0x91, 0x21, 0x21, 0x90, 0x54, 0x80, 0x12, 0x82,
-  0x01, 0x00, 0x20, 0x11, 0x04, 0x44, 0x84, 0x44, 0xa4, 0x14, 0x10, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0x14, 0x29, 0xd1,
-  0xc1, 0x09, 0x8a, 0x01, 0x2a, 0x04, 0x40, 0x08, 0x84, 0x41, 0x14, 0x50,
-  0xc1, 0x38, 0x28, 0x24, 0x14, 0x44, 0x20, 0x61, 0x11, 0x48, 0x90, 0x33,
-  0x4b, 0x41, 0x18, 0x1c, 0xc4, 0x94, 0x42, 0x2c, 0x44, 0x14, 0x21, 0x41,
-  0x01, 0x13, 0x11, 0x11, 0xc1, 0x44, 0x18, 0x12, 0x17, 0x81, 0x13, 0x44,
-  0x18, 0x33, 0x41, 0x13, 0x54, 0xc1, 0x42, 0x11, 0x20, 0x04, 0xf0, 0x44,
-  0x21, 0x80, 0x02, 0x21, 0x30, 0x76, 0x14, 0x38, 0x8a, 0xf2, 0x31, 0x21,
-  0x29, 0xe2, 0x41, 0x72, 0x22, 0xd1, 0x11, 0x52, 0x11, 0x2e, 0x15, 0x24,
-  0x19, 0xf1, 0x31, 0x3b, 0x1b, 0x11, 0x81, 0x70, 0x28, 0x83, 0x62, 0x52,
-  0x9b, 0x22, 0x47, 0x11, 0x2b, 0x41, 0x6a, 0xa1, 0x66, 0x4b, 0x22, 0x4f,
-  0x36, 0x44, 0xf1, 0x26, 0x21, 0xd0, 0x84, 0xb6, 0x46, 0x66, 0x12, 0x47,
-  0x26, 0x00, 0x99, 0x31, 0x41, 0x14, 0x15, 0xc2, 0x11, 0x1e, 0x14, 0x1a,
-  0xb1, 0x11, 0xf3, 0x52, 0x44, 0x19, 0x74, 0x41, 0x42, 0xf6, 0x42, 0x49,
-  0x22, 0x8f, 0x24, 0xd4, 0x11, 0x34, 0x4a, 0x45, 0x84, 0x91, 0x4a, 0x13,
-  0x54, 0x42, 0x50, 0x14, 0x4c, 0xf4, 0x3d, 0x31, 0x40, 0x22, 0x08, 0x14,
-  0x26, 0x12, 0x11, 0x42, 0x4c, 0x72, 0x2f, 0x71, 0x22, 0x07, 0x25, 0x45,
-  0xa1, 0x22, 0x49, 0xd2, 0x54, 0x41, 0xc2, 0x13, 0x64, 0x1d, 0x1b, 0x43,
-  0x51, 0x28, 0x17, 0x31, 0x28, 0x25, 0x04, 0x28, 0x13, 0x01, 0x27, 0x81,
-  0x44, 0x18, 0x4c, 0x06, 0x4f, 0x42, 0x51, 0xa2, 0x61, 0x11, 0x1d, 0x42,
-  0x31, 0x25, 0x46, 0xa8, 0x24, 0x8d, 0x11, 0x1c, 0x24, 0x91, 0x46, 0x40,
-  0x42, 0x02, 0x10, 0x85, 0xc1, 0x28, 0x48, 0x87, 0x12, 0x12, 0x2f, 0xd5,
-  0x0a, 0x44, 0x15, 0x19, 0x34, 0x28, 0xc0, 0x2a, 0x12, 0x2c, 0x92, 0x25,
-  0x4c, 0x82, 0x12, 0x22, 0x42, 0x72, 0x14, 0x52, 0x43, 0x23, 0x92, 0x29,
-  0x41, 0x39, 0x23, 0x84, 0xe6, 0x11, 0xf1, 0x42, 0x44, 0x35, 0xb8, 0x75,
-  0x75, 0x18, 0xe4, 0x62, 0x74, 0x62, 0x62, 0x42, 0x18, 0x1a, 0x41, 0x18,
-  0x35, 0x12, 0x16, 0x93, 0x51, 0x5c, 0xb2, 0x58, 0x74, 0x24, 0x41, 0xea,
-  0x14, 0x54, 0x31, 0x25, 0x81, 0x34, 0x41, 0x1d, 0x22, 0x4a, 0x92, 0x11,
-  0x47, 0x44, 0x1a, 0xb4, 0x22, 0x14, 0xe8, 0x44, 0x82, 0x14, 0x14, 0xc2,
-  0x16, 0x21, 0x2e, 0x2c, 0x60, 0x41, 0x26, 0x61, 0x41, 0x81, 0x16, 0x54,
-  0x38, 0x44, 0x87, 0x12, 0x50, 0x38, 0x50, 0x38, 0x12, 0x81, 0x50, 0x28,
-  0x11, 0x81, 0x84, 0x24, 0x84, 0x40, 0x08, 0x25, 0x88, 0x52, 0x81, 0x50,
-  0x82, 0x44, 0x8c, 0xc1, 0x24, 0x84, 0x4c, 0xc2, 0x11, 0x4c, 0x12, 0xc2,
-  0x24, 0x81, 0x4c, 0xd2, 0x38, 0xc1, 0x24, 0x8d, 0x12, 0x28, 0x89, 0x81,
-  0xd2, 0x28, 0x01, 0x8d, 0x11, 0x41, 0x8d, 0x12, 0x43, 0x82, 0x71, 0x25,
-  0xc8, 0x11, 0x47, 0x82, 0x18, 0x26, 0x08, 0xdf, 0x5d, 0x08, 0x2e, 0x32,
-  0x7f, 0x41, 0xf1, 0x2d, 0x28, 0xcf, 0x83, 0xf3, 0x18, 0xb8, 0xed, 0x25,
-  0x4f, 0xc3, 0xf3, 0x21, 0x28, 0xcf, 0xc1, 0xf1, 0x25, 0x26, 0x1f, 0x81,
-  0xf1, 0x11, 0x3a, 0x8f, 0x81, 0x01, 0xc5, 0xfc, 0x2c, 0x2e, 0xef, 0xc1,
-  0xf1, 0x24, 0x25, 0x5f, 0xd3, 0xf3, 0x1e, 0x1c, 0xbd, 0x59, 0xcf, 0xc6,
-  0xf6, 0x21, 0x29, 0xcf, 0xd6, 0xf6, 0x29, 0x2b, 0xcf, 0xc6, 0xf6, 0x34,
-  0x38, 0x8f, 0xa6, 0xf6, 0x18, 0x58, 0xcf, 0x84, 0x54, 0x55, 0x8d, 0x2e,
-  0xef, 0x82, 0xf2, 0x6c, 0x68, 0x4b, 0x22, 0x4c, 0xb2, 0x26, 0xf2, 0x2c,
-  0x2a, 0xff, 0xd3, 0xf3, 0x19, 0x3e, 0xcf, 0x23, 0xf3, 0x76, 0x7c, 0x3f,
-  0x92, 0xf3, 0x58, 0x58, 0x1f, 0x17, 0xf3, 0x71, 0x78, 0x3d, 0x19, 0xbf,
-  0x95, 0xe5, 0x41, 0xf1, 0x5c, 0x58, 0xef, 0xc6, 0xf3, 0x32, 0x34, 0x8f,
-  0xe3, 0xb3, 0x7e, 0xf5, 0x4c, 0x26, 0x2f, 0x41, 0xf3, 0x78, 0x78, 0x85,
-  0xb4, 0x48, 0xf6, 0x5c, 0x8c, 0xd0, 0x64, 0xf1, 0x56, 0x5d, 0x5f, 0x13,
-  0xb3, 0x24, 0xd6, 0xcc, 0xf2, 0x3f, 0x36, 0x5f, 0xc2, 0xf2, 0x21, 0x28,
-  0xcf, 0xd1, 0xf3, 0x2f, 0x2e, 0x4f, 0x83, 0xf1, 0x12, 0x1b, 0x8d, 0x3d,
-  0xc5, 0x0c, 0x6f, 0x42, 0xf2, 0x3d, 0x1c, 0xdf, 0xc2, 0xf2, 0x35, 0x3f,
-  0xef, 0xc1, 0xd1, 0x12, 0xf5, 0x66, 0x74, 0x1f, 0x92, 0xf6, 0x4d, 0x7d,
-  0x6f, 0x72, 0xf6, 0xc4, 0xe4, 0x5f, 0xc1, 0xf1, 0x6c, 0xec, 0x4f, 0x63,
-  0xf5, 0x62, 0x64, 0x9d, 0x1d, 0xdd, 0x2b, 0x6f, 0x42, 0xe2, 0x54, 0x54,
-  0x5c, 0x4b, 0x21, 0x6f, 0xe2, 0x56, 0x61, 0x3f, 0x51, 0xd1, 0x9d, 0xf3,
-  0x3c, 0x27, 0x2f, 0xa5, 0xf5, 0x47, 0x1e, 0xaf, 0x87, 0xf7, 0x69, 0x28,
-  0x5f, 0xb6, 0xf6, 0x43, 0x1b, 0xdf, 0xd7, 0x75, 0x4c, 0xfc, 0x61, 0x44,
-  0x4f, 0x24, 0xf1, 0x1c, 0x18, 0x4f, 0x62, 0xf2, 0x6a, 0x45, 0xcf, 0x25,
-  0xf3, 0x1e, 0x38, 0xaf, 0xc7, 0xf7, 0x2c, 0x21, 0x8b, 0x65, 0xdf, 0xfa,
-  0x4b, 0x72, 0x16, 0xb6, 0x23, 0xf6, 0x11, 0x36, 0x2f, 0x22, 0xf2, 0x2e,
-  0x24, 0x2f, 0x92, 0xb2, 0x12, 0xf1, 0x2d, 0x25, 0x4f, 0x43, 0xf3, 0x2d,
-  0x2e, 0x3f, 0x41, 0xf3, 0x19, 0x12, 0x2b, 0x31, 0x85, 0x58, 0x44, 0x5f,
-  0x72, 0xf2, 0x37, 0x35, 0x9f, 0x92, 0xf2, 0x18, 0x31, 0x6d, 0x1c, 0x7d,
-  0x55, 0x6f, 0x46, 0xf4, 0x69, 0x61, 0x5f, 0xe6, 0xf7, 0x65, 0x67, 0x5f,
-  0x56, 0xfc, 0x1d, 0x15, 0x4f, 0xe6, 0xf6, 0x34, 0x74, 0x6e, 0x64, 0x95,
-  0x7d, 0x24, 0x93, 0x22, 0x4e, 0x44, 0x15, 0x79, 0x35, 0xd3, 0x13, 0x56,
-  0x71, 0x3f, 0x51, 0xf1, 0x3d, 0x13, 0x1f, 0x91, 0xf3, 0x53, 0x51, 0xff,
-  0x55, 0xa4, 0x76, 0x97, 0x94, 0x4e, 0x45, 0xbf, 0x17, 0xb6, 0x42, 0xf7,
-  0x49, 0x49, 0x1f, 0x54, 0x34, 0x56, 0x69, 0x71, 0x28, 0xfa, 0x42, 0x6c,
-  0x5f, 0x25, 0x71, 0x2e, 0xb8, 0x42, 0xe4, 0xc3, 0xf3, 0x44, 0x54, 0x2f,
-  0xdf, 0x4c, 0xf2, 0x32, 0x22, 0xef, 0x43, 0x57, 0x61, 0xa7, 0xa4, 0xab,
-  0x3b, 0x7f, 0xf3, 0x53, 0x13, 0xd5, 0xf5, 0x3c, 0x3d, 0x3f, 0x72, 0xf2,
-  0x12, 0x15, 0xbf, 0x31, 0xf3, 0x1f, 0x19, 0x45, 0x04, 0xef, 0xb2, 0xf2,
-  0x3f, 0x3d, 0x5f, 0x52, 0xf2, 0x3d, 0x36, 0x5f, 0xc1, 0xf1, 0x4d, 0x5d,
-  0x4f, 0x45, 0xf5, 0x49, 0x41, 0x5f, 0xf6, 0xf6, 0x6f, 0x6e, 0x4f, 0x56,
-  0xfe, 0x3d, 0x35, 0x4f, 0xee, 0xf6, 0x7e, 0x7e, 0x6b, 0x44, 0x1d, 0x11,
-  0x8f, 0xf2, 0xd1, 0x8e, 0xb2, 0x65, 0x56, 0x95, 0x17, 0x63, 0xfd, 0x23,
-  0x5f, 0x22, 0xf2, 0x1b, 0x19, 0x9f, 0x53, 0xf1, 0x15, 0x39, 0x7f, 0x67,
-  0xf7, 0x59, 0x43, 0x8f, 0x94, 0xe5, 0x17, 0xf7, 0x41, 0x45, 0xbf, 0x17,
-  0xf6, 0x4c, 0x78, 0x1f, 0x55, 0xb5, 0x45, 0xf4, 0x5a, 0x4a, 0xaf, 0xc2,
-  0xe3, 0x63, 0xf1, 0x46, 0x68, 0x4e, 0x42, 0x2f, 0x43, 0xf1, 0x68, 0x6c,
-  0x4f, 0x91, 0xf1, 0x44, 0x54, 0x1f, 0x29, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x22, 0x20, 0x22, 0x01, 0x00, 0xc0, 0x24, 0x11, 0x4c, 0x12, 0x21, 0x04,
-  0x4a, 0x12, 0x81, 0x02, 0x44, 0xa0, 0x24, 0x00, 0x00, 0x00, 0x18, 0x40,
-  0x01, 0x18, 0xc0, 0x12, 0x48, 0x14, 0x40, 0x81, 0x04, 0x00, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x47, 0xe1, 0x00, 0x40, 0x81, 0x62, 0x22, 0x11, 0x10,
+  0x43, 0xa2, 0x14, 0x43, 0x62, 0x24, 0x45, 0xd8, 0x22, 0xa0, 0x0b, 0x90,
+  0x2f, 0xa2, 0x11, 0x0a, 0x84, 0x21, 0x48, 0x28, 0x00, 0xe6, 0x09, 0x33,
+  0x00, 0x80, 0x04, 0x29, 0x0b, 0xf2, 0xff, 0xff, 0xb4, 0x14, 0x00, 0x00,
+  0x11, 0x10, 0x02, 0x00, 0x00, 0x40, 0x84, 0x04, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x70, 0xb4, 0x05, 0x23, 0x01, 0x99, 0x01, 0x81, 0x4c, 0x52, 0x14,
+  0x24, 0x00, 0x16, 0x61, 0x81, 0x50, 0x18, 0x81, 0x63, 0x98, 0x12, 0x67,
+  0x88, 0x60, 0x22, 0x60, 0x48, 0x22, 0xa6, 0x01, 0x61, 0x12, 0x25, 0x34,
+  0x12, 0x41, 0x4b, 0x41, 0xc4, 0x28, 0x81, 0x2a, 0x54, 0x12, 0x4b, 0x21,
+  0x50, 0x42, 0x54, 0x4c, 0xe1, 0x12, 0x48, 0x84, 0x01, 0x89, 0x21, 0x81,
+  0x81, 0x11, 0x14, 0xa4, 0x14, 0x43, 0x04, 0x44, 0x29, 0x81, 0x08, 0x22,
+  0x6f, 0x8f, 0x07, 0x42, 0xa6, 0x11, 0x72, 0x12, 0x94, 0x31, 0x17, 0xa1,
+  0x24, 0xc3, 0x62, 0x11, 0x76, 0x61, 0x28, 0x22, 0x83, 0x48, 0x22, 0x88,
+  0x12, 0x89, 0x92, 0x81, 0x4c, 0x91, 0x11, 0x42, 0x60, 0x84, 0x29, 0x22,
+  0x34, 0x41, 0x22, 0x1d, 0xc4, 0x2b, 0x24, 0xc0, 0x12, 0x49, 0x2c, 0xf4,
+  0x12, 0x84, 0x2c, 0x04, 0x18, 0x98, 0x20, 0x92, 0x42, 0x13, 0xc2, 0x82,
+  0x47, 0x9a, 0x8a, 0x74, 0x42, 0x91, 0x41, 0x80, 0xc4, 0x22, 0x90, 0x28,
+  0x58, 0x21, 0x88, 0x2e, 0x4c, 0x1c, 0x81, 0xf4, 0x24, 0xee, 0x24, 0x4a,
+  0x61, 0x34, 0x16, 0x23, 0x41, 0xe8, 0x51, 0x02, 0x43, 0x32, 0x12, 0x22,
+  0x5b, 0x18, 0x8b, 0x12, 0xa2, 0x85, 0x51, 0x22, 0x2c, 0x72, 0x19, 0x92,
+  0xa4, 0x19, 0x18, 0xd4, 0x23, 0xc1, 0x44, 0x22, 0x1f, 0x85, 0x78, 0x22,
+  0x22, 0x98, 0x11, 0x47, 0x22, 0x1f, 0x41, 0x28, 0x66, 0x41, 0x11, 0x29,
+  0x3a, 0x48, 0xeb, 0xd2, 0x11, 0x2b, 0x25, 0x90, 0x94, 0x11, 0x47, 0x22,
+  0x1b, 0x4a, 0x17, 0x42, 0x8a, 0xe1, 0x52, 0xd8, 0x84, 0x9d, 0x12, 0x2e,
+  0x51, 0x80, 0xc4, 0x24, 0x48, 0x4f, 0x84, 0x82, 0x15, 0xd2, 0x22, 0x51,
+  0x84, 0x18, 0x1a, 0xd4, 0x65, 0x0a, 0x80, 0x12, 0x48, 0xe4, 0x12, 0x41,
+  0x58, 0x36, 0x84, 0x14, 0x1b, 0x41, 0x24, 0x10, 0x08, 0x89, 0x38, 0x84,
+  0x40, 0x08, 0x32, 0x20, 0x08, 0x22, 0x90, 0x44, 0x42, 0x21, 0x42, 0x61,
+  0x42, 0x4d, 0x18, 0x46, 0x04, 0x90, 0x42, 0x44, 0x2c, 0x01, 0x41, 0x12,
+  0x00, 0x24, 0x84, 0x90, 0x41, 0x20, 0x41, 0x04, 0x29, 0x01, 0x10, 0x84,
+  0xa8, 0x4a, 0x20, 0xb2, 0x2b, 0x0d, 0x45, 0x01, 0x25, 0x01, 0x14, 0x50,
+  0x14, 0x40, 0x01, 0x81, 0xc0, 0x83, 0x10, 0x18, 0xc1, 0x83, 0x40, 0x02,
+  0x44, 0x82, 0x40, 0x08, 0x48, 0x10, 0x01, 0x49, 0x01, 0x25, 0x32, 0x88,
+  0x00, 0x21, 0x00, 0x00, 0x11, 0x80, 0x04, 0x48, 0x18, 0xc0, 0x11, 0x00,
+  0x48, 0x24, 0x16, 0x08, 0x00, 0x00, 0x48, 0xff, 0xb4, 0x08, 0x90, 0x12,
+  0x00, 0x21, 0x26, 0x44, 0x58, 0x86, 0x81, 0x25, 0x52, 0x21, 0x00, 0x85,
+  0x64, 0x21, 0x81, 0x12, 0x9b, 0x24, 0x83, 0xb8, 0x48, 0x32, 0x8a, 0x44,
+  0x4c, 0x84, 0xe2, 0x18, 0x54, 0x41, 0x1d, 0x48, 0x28, 0xcd, 0x42, 0x28,
+  0x4e, 0x81, 0x88, 0x48, 0x88, 0x4a, 0x41, 0x82, 0x38, 0x94, 0x34, 0xc8,
+  0x4a, 0x0a, 0xc1, 0x41, 0x30, 0x81, 0x33, 0x0c, 0x59, 0x09, 0xa5, 0x11,
+  0x88, 0x94, 0x2e, 0x13, 0x15, 0x24, 0x54, 0x48, 0xf0, 0x38, 0x44, 0x00,
+  0x27, 0x21, 0x00, 0x14, 0x50, 0x24, 0x81, 0x81, 0x10, 0x03, 0x10, 0x82,
+  0x11, 0x49, 0xe1, 0x82, 0x84, 0x98, 0x42, 0x21, 0x82, 0x44, 0xe0, 0x14,
+  0x18, 0x81, 0x44, 0x61, 0xe4, 0x12, 0x82, 0x82, 0x20, 0x08, 0x20, 0x38,
+  0x14, 0x10, 0xb2, 0xa1, 0x04, 0xc3, 0x04, 0x42, 0x19, 0x08, 0x11, 0x88,
+  0x24, 0x85, 0x41, 0x38, 0x12, 0xe3, 0x82, 0x14, 0x04, 0xc1, 0xf0, 0x7c,
+  0x25, 0x40, 0x05, 0x11, 0x24, 0xc0, 0x24, 0x85, 0x11, 0x54, 0x21, 0x40,
+  0x0a, 0x19, 0x18, 0x5c, 0x28, 0xc0, 0x92, 0x11, 0x84, 0x83, 0xd2, 0x84,
+  0x48, 0x24, 0x64, 0x82, 0x60, 0x44, 0x15, 0x28, 0x02, 0x49, 0x92, 0x41,
+  0x21, 0x2f, 0x88, 0x04, 0x58, 0x25, 0x02, 0x88, 0x14, 0xc8, 0x00, 0x10,
+  0x04, 0x18, 0x2f, 0x14, 0x88, 0x71, 0x14, 0x01, 0x42, 0x60, 0x84, 0x60,
+  0x11, 0x20, 0x04, 0x48, 0x5f, 0xe8, 0x46, 0x82, 0x44, 0x2c, 0x03, 0x80,
+  0x81, 0x01, 0x14, 0xc5, 0x22, 0x82, 0x11, 0x56, 0x12, 0x84, 0x00, 0x00,
+  0x84, 0x88, 0x40, 0xd4, 0x42, 0x31, 0x82, 0x11, 0x00, 0x20, 0x42, 0x2a,
+  0x14, 0xb4, 0x82, 0x82, 0xa4, 0x48, 0x3e, 0x48, 0x00, 0x56, 0x04, 0x00,
+  0x41, 0x24, 0x41, 0x10, 0x02, 0x41, 0xa5, 0x51, 0x24, 0x20, 0x01, 0x24,
+  0x28, 0x10, 0xf8, 0x42, 0x14, 0x40, 0x64, 0x84, 0x50, 0x14, 0x24, 0x47,
+  0x82, 0x43, 0xc2, 0x23, 0x00, 0x11, 0x90, 0x24, 0x4c, 0x81, 0x41, 0x02,
+  0x47, 0x11, 0x44, 0x41, 0x80, 0x03, 0x2b, 0x24, 0x12, 0x4c, 0x68, 0x82,
+  0x42, 0x1c, 0x11, 0x82, 0x88, 0x92, 0x12, 0x24, 0x11, 0xd0, 0x82, 0x04,
+  0x88, 0x28, 0x54, 0x92, 0x20, 0x02, 0x49, 0xc2, 0x48, 0x81, 0x1c, 0x02,
+  0x88, 0x29, 0x4c, 0x34, 0x28, 0x24, 0x86, 0x52, 0x48, 0x12, 0x24, 0xdf,
+  0xbe, 0x0a, 0x14, 0x10, 0x11, 0x42, 0xc9, 0x02, 0xf0, 0xff, 0xd4, 0x12,
+  0x50, 0x21, 0x90, 0x42, 0x30, 0x21, 0x14, 0x40, 0x18, 0x16, 0x38, 0x22,
+  0x10, 0x01, 0x40, 0x08, 0x11, 0xc0, 0x84, 0x24, 0x20, 0x98, 0x28, 0x63,
+  0x21, 0x14, 0x04, 0x00, 0x4c, 0x04, 0x16, 0x01, 0x42, 0x8a, 0x14, 0x04,
+  0x10, 0x04, 0xaf, 0xfd, 0x4c, 0x42, 0x41, 0x84, 0x12, 0x43, 0xe2, 0x42,
+  0x81, 0x12, 0x51, 0x12, 0x85, 0x92, 0x21, 0x40, 0xd2, 0x41, 0x61, 0x81,
+  0x10, 0x22, 0x41, 0x51, 0x2e, 0xa0, 0x21, 0x54, 0x4a, 0x22, 0x48, 0x51,
+  0x82, 0x89, 0x74, 0x31, 0x02, 0x86, 0x89, 0xc6, 0x14, 0x2d, 0x22, 0x19,
+  0x64, 0x18, 0x22, 0x88, 0x20, 0x45, 0xa1, 0xa1, 0x41, 0x4a, 0x12, 0x84,
+  0x62, 0xa4, 0x81, 0x46, 0x15, 0x94, 0x12, 0x82, 0x41, 0x8b, 0x58, 0x45,
+  0x22, 0xc8, 0x28, 0x43, 0x51, 0x28, 0xbf, 0xe6, 0x0d, 0x49, 0x04, 0x1c,
+  0x41, 0x14, 0x44, 0x98, 0x14, 0x28, 0x40, 0x04, 0x12, 0x21, 0x00, 0x80,
+  0x11, 0x45, 0x04, 0x4a, 0x08, 0x28, 0x55, 0x02, 0x45, 0xc8, 0x24, 0x24,
+  0x20, 0x02, 0x25, 0x02, 0x8c, 0x08, 0x2c, 0x24, 0x11, 0x24, 0x38, 0x26,
+  0x86, 0x54, 0x28, 0x12, 0x41, 0x10, 0x02, 0x00, 0x60, 0x88, 0x27, 0x64,
+  0x48, 0x28, 0x00, 0x41, 0x00, 0x5b, 0x9b, 0x10, 0x14, 0x01, 0x00, 0x40,
+  0x14, 0x01, 0x48, 0x00, 0x40, 0x02, 0x00, 0x80, 0x44, 0x88, 0x98, 0x8e,
+  0x10, 0x02, 0x00, 0x44, 0x11, 0x00, 0x10, 0x42, 0xd2, 0x48, 0x04, 0x4d,
+  0x42, 0x81, 0x00, 0x81, 0x48, 0x18, 0x42, 0x00, 0x00, 0x80, 0x14, 0x04,
+  0x4c, 0x81, 0x0c, 0x84, 0x20, 0x98, 0x84, 0x8f, 0xa6, 0x0c, 0x1b, 0x42,
+  0xa4, 0x60, 0x84, 0x87, 0x42, 0x71, 0x21, 0x41, 0x48, 0x82, 0xc1, 0x10,
+  0x24, 0x28, 0x06, 0x20, 0x58, 0x82, 0x2d, 0x81, 0x12, 0xa0, 0x48, 0x48,
+  0x81, 0x12, 0x11, 0x14, 0x48, 0x42, 0x14, 0x22, 0x00, 0x24, 0x26, 0x06,
+  0x40, 0x62, 0x42, 0x20, 0x18, 0x44, 0x14, 0x08, 0x10, 0x0a, 0x40, 0x08,
+  0x88, 0x41, 0x20, 0x25, 0x41, 0x02, 0x2d, 0x84, 0x00, 0x44, 0x31, 0x84,
+  0x00, 0x84, 0x40, 0x42, 0x14, 0x41, 0x31, 0x38, 0x54, 0x00, 0x10, 0x41,
+  0x02, 0x00, 0x60, 0xa8, 0x48, 0x16, 0x02, 0x11, 0x00, 0x83, 0x04, 0x10,
+  0x02, 0x15, 0x04, 0x20, 0x54, 0x18, 0xa5, 0x92, 0x81, 0x24, 0x41, 0x00,
+  0x10, 0x04, 0x14, 0x84, 0x40, 0x12, 0x44, 0x02, 0x40, 0x02, 0xdf, 0x5d,
+  0x08, 0xa4, 0x80, 0x41, 0x41, 0x11, 0x08, 0x40, 0x18, 0x11, 0x42, 0x14,
+  0x04, 0x00, 0x28, 0x41, 0x00, 0x21, 0x42, 0xab, 0x21, 0x30, 0x81, 0x8e,
+  0x48, 0x28, 0x00, 0x19, 0x08, 0x48, 0x10, 0x88, 0xa1, 0x84, 0x40, 0x42,
+  0x82, 0x98, 0x84, 0x80, 0x38, 0x88, 0x44, 0x23, 0x41, 0x24, 0x04, 0x00,
+  0x2b, 0x24, 0x00, 0x12, 0x14, 0x16, 0x9c, 0x22, 0x87, 0x28, 0xbe, 0xb9,
+  0xa0, 0x48, 0x00, 0x31, 0x84, 0x00, 0x00, 0x15, 0x04, 0x16, 0x01, 0x10,
+  0x18, 0x04, 0x44, 0x40, 0x0c, 0x40, 0x42, 0x04, 0x81, 0x1c, 0x01, 0x31,
+  0x40, 0x45, 0x42, 0x84, 0x04, 0x23, 0x44, 0x42, 0x01, 0x00, 0x45, 0x28,
+  0x14, 0x42, 0x22, 0x04, 0x9b, 0x12, 0x41, 0x00, 0x18, 0x80, 0x48, 0x0c,
+  0x20, 0x01, 0xaf, 0x68, 0x0b, 0x45, 0x41, 0x48, 0x18, 0x04, 0x61, 0x49,
+  0x41, 0x12, 0xc4, 0x42, 0x00, 0x25, 0x01, 0x54, 0x10, 0x08, 0xc4, 0xb0,
+  0x82, 0x24, 0x3c, 0x41, 0x1c, 0x44, 0x91, 0x42, 0xc0, 0x48, 0x18, 0x90,
+  0x22, 0xb8, 0x04, 0x50, 0x34, 0x48, 0x00, 0x00, 0x48, 0xbe, 0x04, 0xf3,
+  0xff, 0xff, 0xff, 0x49, 0x84, 0x18, 0x01, 0x83, 0x01, 0xa1, 0x24, 0xff,
+  0x56, 0x05, 0x84, 0x80, 0x02, 0x43, 0x01, 0x2a, 0x44, 0xa4, 0x42, 0x80,
+  0xe1, 0x42, 0x08, 0x41, 0x48, 0x88, 0x00, 0x80, 0x08, 0x90, 0x82, 0x84,
+  0x10, 0x01, 0x20, 0x06, 0x12, 0x80, 0x81, 0x22, 0x04, 0x18, 0x28, 0x40,
+  0x04, 0x26, 0x22, 0x61, 0x23, 0x30, 0x28, 0x44, 0x00, 0x00, 0x45, 0x98,
+  0x58, 0x12, 0x88, 0x00, 0x2d, 0x44, 0xf0, 0x4a, 0x39, 0x00, 0x21, 0x14,
+  0x40, 0x41, 0x08, 0x40, 0x08, 0x11, 0x18, 0x1c, 0x41, 0xc1, 0x11, 0x11,
+  0x21, 0x00, 0x20, 0x04, 0x00, 0x4e, 0x82, 0x54, 0x00, 0x30, 0x42, 0x89,
+  0x44, 0x08, 0x21, 0x00, 0x65, 0x48, 0x02, 0x50, 0x26, 0x24, 0x49, 0xd4,
+  0xa1, 0x98, 0x44, 0x16, 0x04, 0x44, 0x80, 0x41, 0x94, 0x84, 0x44, 0x20,
+  0x81, 0x48, 0x24, 0x48, 0xf8, 0xa4, 0xc5, 0xc0, 0x18, 0x15, 0x84, 0x04,
+  0x00, 0x21, 0x60, 0x61, 0x00, 0x44, 0x80, 0x42, 0x04, 0x18, 0x90, 0x64,
+  0x80, 0x02, 0xa1, 0x13, 0x98, 0x32, 0x80, 0x28, 0x08, 0x11, 0xa0, 0x84,
+  0x14, 0x88, 0x21, 0x84, 0x80, 0xac, 0x14, 0x80, 0x39, 0x44, 0x88, 0x42,
+  0x10, 0x41, 0x04, 0xf0, 0x22, 0x48, 0x00, 0x46, 0x88, 0x02, 0x2c, 0x62,
+  0x88, 0xe1, 0xf0, 0x2b, 0x94, 0xc0, 0x15, 0x47, 0xb8, 0x97, 0x31, 0x9c,
+  0x64, 0x21, 0x85, 0xc4, 0x2c, 0x45, 0x71, 0x4a, 0xb4, 0x81, 0x94, 0x11,
+  0x18, 0x25, 0x44, 0xb2, 0x4d, 0x11, 0x81, 0x01, 0x4d, 0x42, 0x5d, 0x82,
+  0x1a, 0xa4, 0xcc, 0xd6, 0x01, 0x1c, 0xf2, 0x11, 0xd8, 0x22, 0x1d, 0x86,
+  0x2a, 0xd4, 0x31, 0x54, 0xc8, 0x2e, 0x42, 0x25, 0x42, 0x12, 0x14, 0x02,
+  0x1d, 0x8a, 0x23, 0x34, 0x8a, 0x43, 0xb1, 0x41, 0xe6, 0x28, 0x39, 0x48,
+  0x25, 0x98, 0x1a, 0xd0, 0x41, 0x04, 0x3b, 0x24, 0xd0, 0x44, 0xdc, 0xa8,
+  0x18, 0x64, 0x81, 0x8f, 0x85, 0x39, 0x18, 0x8e, 0x98, 0x8d, 0x88, 0xdf,
+  0x91, 0x42, 0x31, 0x61, 0x91, 0x21, 0x44, 0xc5, 0x09, 0x42, 0x44, 0x2c,
+  0x52, 0x16, 0x21, 0x1b, 0x81, 0x8c, 0x72, 0x81, 0x84, 0x12, 0x04, 0x45,
+  0x46, 0x48, 0xb8, 0xc2, 0x52, 0x4a, 0x8b, 0xc2, 0x1f, 0x84, 0x78, 0x41,
+  0x12, 0x2e, 0x81, 0x04, 0x42, 0x46, 0x61, 0x84, 0x44, 0x29, 0xce, 0x4a,
+  0x4f, 0x2a, 0x74, 0x16, 0x12, 0xe2, 0x61, 0x74, 0x41, 0xfa, 0x88, 0x82,
+  0x4d, 0x82, 0x61, 0x6f, 0x68, 0x37, 0x44, 0x43, 0x04, 0xc1, 0x80, 0x54,
+  0x88, 0x89, 0xa1, 0x1c, 0x4c, 0x55, 0x24, 0x28, 0x4c, 0xf1, 0x28, 0x42,
+  0x25, 0xf4, 0x26, 0xad, 0xd0, 0x24, 0x54, 0x42, 0x28, 0x91, 0x17, 0x42,
+  0x65, 0x3b, 0x16, 0xd0, 0x84, 0x65, 0x64, 0xd4, 0x1c, 0xf2, 0x15, 0x11,
+  0x45, 0xc1, 0x45, 0x88, 0xa3, 0x62, 0x18, 0x8f, 0x44, 0x32, 0x8a, 0x88,
+  0x40, 0xfa, 0x8e, 0x43, 0xab, 0xc8, 0x46, 0x51, 0x13, 0x94, 0x17, 0x15,
+  0x23, 0xb8, 0x31, 0x84, 0x28, 0x11, 0xb8, 0x42, 0x71, 0x41, 0xc4, 0x4c,
+  0x28, 0x70, 0x24, 0x54, 0xc2, 0xa7, 0x48, 0x5e, 0x44, 0x9c, 0xc8, 0x46,
+  0x1e, 0x21, 0x24, 0x2e, 0x18, 0x41, 0x89, 0x51, 0x64, 0x62, 0x4f, 0x41,
+  0xa4, 0xa8, 0x98, 0x24, 0x47, 0x88, 0x45, 0x64, 0x28, 0x4f, 0xe6, 0x4d,
+  0xa1, 0x21, 0x65, 0xe1, 0x81, 0x02, 0x1a, 0x42, 0x82, 0x02, 0x28, 0x4d,
+  0x83, 0x28, 0x1c, 0x08, 0x1c, 0x08, 0x1c, 0x28, 0xc2, 0x85, 0x22, 0x34,
+  0x22, 0x14, 0x22, 0x81, 0x23, 0x02, 0x22, 0x20, 0x22, 0x28, 0xb2, 0x88,
+  0x12, 0xa2, 0x28, 0xb0, 0x81, 0x12, 0xb6, 0x81, 0x12, 0xd2, 0x81, 0x42,
+  0x92, 0x21, 0x24, 0x1b, 0x21, 0x45, 0x92, 0x21, 0x10, 0x01, 0x8c, 0x04,
+  0x2e, 0x48, 0x44, 0x13, 0x03, 0x2a, 0x14, 0xa8, 0x43, 0xa0, 0x4f, 0xa0,
+  0x74, 0x5f, 0x63, 0xe3, 0x22, 0xf2, 0x37, 0x34, 0x8f, 0xa1, 0xf3, 0x28,
+  0x28, 0x3a, 0xe3, 0x66, 0xf6, 0x5a, 0x1c, 0x3f, 0x46, 0xaa, 0xbb, 0x8e,
+  0x92, 0x2b, 0x99, 0x1c, 0xf8, 0xdc, 0xd8, 0x4f, 0x7e, 0xfe, 0xbb, 0xb9,
+  0x5f, 0x12, 0xfa, 0x2d, 0x81, 0x4f, 0x54, 0xfe, 0x83, 0xa1, 0x1f, 0x12,
+  0xfa, 0x88, 0x48, 0xcd, 0xaf, 0x1f, 0x1c, 0xfa, 0x2c, 0x25, 0x1f, 0x11,
+  0xf1, 0x68, 0x6b, 0x1f, 0x2b, 0xfb, 0xa2, 0xa3, 0xff, 0xcd, 0xf9, 0x88,
+  0x28, 0x6f, 0x43, 0xbb, 0x62, 0xfe, 0xe1, 0xa1, 0x1d, 0x25, 0x1f, 0x13,
+  0xeb, 0x22, 0xfa, 0x35, 0x37, 0x9f, 0xfc, 0xfe, 0xbb, 0xb9, 0x8f, 0x8e,
+  0xe2, 0x5b, 0x7b, 0x8a, 0xfd, 0x39, 0x31, 0xbf, 0x86, 0xf6, 0x21, 0x21,
+  0x9f, 0x91, 0x51, 0x64, 0x3f, 0x91, 0xe1, 0x82, 0xb2, 0xb5, 0xeb, 0x83,
+  0x33, 0x24, 0xdf, 0xc9, 0xea, 0x18, 0xfe, 0xe8, 0xe8, 0x5b, 0xc4, 0xce,
+  0xeb, 0xff, 0x84, 0x45, 0xe1, 0x24, 0xf7, 0x71, 0x7f, 0x8f, 0x21, 0xd1,
+  0xdf, 0xd4, 0xe8, 0xf2, 0x3e, 0x3e, 0x21, 0x4f, 0x64, 0xf4, 0x7a, 0x78,
+  0x1f, 0x66, 0xfe, 0xb3, 0xb4, 0x1d, 0x13, 0x3b, 0x13, 0x5d, 0x85, 0x8f,
+  0x8f, 0xff, 0x44, 0x47, 0xbf, 0x91, 0xb1, 0x24, 0xfa, 0x28, 0x8a, 0xcf,
+  0xdc, 0xfe, 0x83, 0xa1, 0x3f, 0x1a, 0xfa, 0xe8, 0xa8, 0xdf, 0xe8, 0xf3,
+  0x81, 0xe3, 0xdf, 0x5a, 0xfb, 0x31, 0x31, 0x9f, 0xb4, 0xf4, 0x11, 0x13,
+  0x3f, 0x32, 0xf2, 0xbf, 0xfd, 0x9f, 0xb8, 0xf2, 0x34, 0xb6, 0x2f, 0x34,
+  0xfc, 0x8a, 0x8a, 0xce, 0xa6, 0x3f, 0x73, 0xdf, 0x31, 0xf8, 0x94, 0x94,
+  0x8f, 0xa4, 0xf6, 0xbd, 0x3f, 0xff, 0x98, 0xe8, 0x7d, 0xf1, 0xaa, 0xbf,
+  0x9f, 0x53, 0xf3, 0x4b, 0x4c, 0xf0, 0x38, 0x18, 0x55, 0xb7, 0x32, 0x53,
+  0x44, 0x9a, 0xf9, 0x2c, 0x28, 0x43, 0xf2, 0x1d, 0x3c, 0x8a, 0xfe, 0xe6,
+  0xfc, 0x2e, 0xb8, 0x8e, 0xbb, 0xef, 0x5d, 0x05, 0x17, 0x17, 0x7d, 0x66,
+  0x9f, 0x31, 0x51, 0xcf, 0xc7, 0xf2, 0x89, 0xf2, 0x14, 0x14, 0x4e, 0x46,
+  0xaf, 0xc7, 0x77, 0xcb, 0xed, 0x51, 0xe9, 0x33, 0xf3, 0x12, 0x31, 0x47,
+  0x58, 0xdf, 0x85, 0x5d, 0x65, 0xaf, 0x91, 0x31, 0xa4, 0xcf, 0x8c, 0xf6,
+  0xcd, 0xce, 0x2f, 0x1a, 0xb8, 0x82, 0xf8, 0xa9, 0xa9, 0xdf, 0xf8, 0xfd,
+  0x22, 0x89, 0xff, 0xd4, 0xf8, 0x84, 0x00, 0xf1, 0x5e, 0x35, 0xf3, 0xbf,
+  0x3d, 0x6e, 0x89, 0x4f, 0x41, 0xa3, 0x4c, 0x2d, 0x48, 0x2f, 0x4a, 0xf8,
+  0x14, 0x72, 0x37, 0x38, 0x4f, 0x61, 0xf1, 0xe8, 0xc4, 0x9a, 0xdb, 0xf9,
+  0xec, 0x49, 0xf9, 0x3b, 0xbc, 0xdf, 0xa1, 0xf5, 0x5a, 0x5d, 0xf0, 0x18,
+  0x38, 0xc5, 0xfe, 0x5b, 0x59, 0x84, 0x4f, 0x89, 0xe9, 0xc3, 0x91, 0x34,
+  0xcf, 0xc9, 0xa8, 0x8f, 0xaf, 0x81, 0xb5, 0x2c, 0xf3, 0x88, 0x9a, 0x37,
+  0x19, 0x14, 0x4f, 0x67, 0xf4, 0x1b, 0x77, 0x8f, 0x22, 0x72, 0x4f, 0xfd,
+  0x38, 0x1d, 0xef, 0xc1, 0xb3, 0x22, 0xf2, 0x44, 0x46, 0xef, 0xa5, 0xf5,
+  0xef, 0x2e, 0x3b, 0x91, 0x1f, 0x3a, 0xbb, 0x13, 0x73, 0x85, 0xf5, 0x79,
+  0xd8, 0x5f, 0x68, 0xf8, 0x3a, 0x39, 0x57, 0x5a, 0x8f, 0xec, 0x86, 0x00,
+  0xf0, 0x4c, 0xa8, 0xe2, 0x97, 0x98, 0xdf, 0x7c, 0x78, 0xa1, 0xfa, 0x3d,
+  0xed, 0x1f, 0x11, 0xf1, 0x48, 0x4b, 0x1f, 0x23, 0xf3, 0xa2, 0xe3, 0xff,
+  0xc9, 0xf1, 0x28, 0xcb, 0x4f, 0x61, 0xf3, 0xe3, 0x62, 0x2f, 0xa8, 0xf8,
+  0x21, 0x47, 0x7f, 0x71, 0xe3, 0x2a, 0xf2, 0x96, 0x94, 0xff, 0xf6, 0xf4,
+  0x1d, 0xbf, 0xef, 0xea, 0xea, 0x61, 0xfd, 0x8b, 0x9e, 0xdf, 0xe3, 0xf3,
+  0x7a, 0x79, 0xf0, 0x19, 0x39, 0xd5, 0xff, 0x7a, 0x58, 0x45, 0xf4, 0xfc,
+  0xbd, 0xc7, 0xc2, 0x59, 0xfb, 0x1c, 0x1c, 0x8f, 0x9f, 0xf9, 0x34, 0x7c,
+  0x4f, 0xc4, 0xe5, 0xb8, 0xf8, 0xab, 0x94, 0x50, 0x14, 0xdb, 0x08, 0xf0,
+  0x78, 0x41, 0x84, 0x14, 0x00, 0x40, 0x81, 0x04, 0x40, 0x04, 0x00, 0x81,
+  0x11, 0x42, 0x00, 0x00, 0x11, 0x42, 0x00, 0x21, 0x10, 0x04, 0x00, 0x14,
+  0x84, 0x1c, 0x08, 0x4d, 0x81, 0x12, 0x14, 0x00, 0x00, 0x48, 0x20, 0x48,
+  0x24, 0x11, 0x28, 0x08, 0x70, 0x6a, 0x0d, 0x8a, 0x14, 0x01, 0x11, 0x85,
+  0x02, 0x00, 0x80, 0x94, 0x82, 0xc0, 0x91, 0x80, 0x08, 0x1c, 0x08, 0x3c,
+  0x48, 0xc8, 0x81, 0x1b, 0x48, 0xc0, 0x42, 0x88, 0x84, 0x14, 0x24, 0x86,
+  0x81, 0x04, 0x88, 0x82, 0x24, 0x82, 0x1c, 0x04, 0x2d, 0x81, 0x82, 0x25,
+  0x01, 0x27, 0x14, 0x50, 0x1a, 0x19, 0x14, 0x02, 0x85, 0x01, 0x14, 0x20,
+  0x04, 0x00, 0x20, 0x08, 0xf0, 0x69, 0xdc, 0xf0, 0x26, 0x53, 0x1f, 0x41,
+  0xf2, 0x2a, 0x13, 0x1f, 0x41, 0xf2, 0x68, 0x12, 0x1f, 0x41, 0xf2, 0x6a,
+  0x11, 0x1d, 0x2c, 0xef, 0x36, 0xd1, 0x41, 0xf2, 0x6a, 0x91, 0x1d, 0x28,
+  0xaf, 0x34, 0x59, 0x85, 0x3e, 0x0a, 0xf1, 0x0e, 0xaf, 0x34, 0x3b, 0x24,
+  0x2f, 0x74, 0x7b, 0x34, 0xd8, 0x1a, 0xfb, 0x34, 0x48, 0x8d, 0xb5, 0x4f,
+  0xa2, 0xc4, 0xa1, 0x6f, 0xa2, 0xe4, 0x11, 0xf2, 0x26, 0x4a, 0x9e, 0x25,
+  0x2e, 0x04, 0x00, 0xf0, 0x0d, 0x8f, 0x49, 0xf2, 0x26, 0x4a, 0x1f, 0x49,
+  0xf2, 0x24, 0x52, 0x1f, 0x49, 0x72, 0x2a, 0xf2, 0x91, 0x2c, 0xa7, 0x26,
+  0x1f, 0xc9, 0x72, 0x6a, 0xf2, 0x81, 0x24, 0xef, 0x26, 0x4d, 0x00, 0xf1,
+  0x71, 0x92, 0x19, 0xb2, 0x4a, 0x99, 0x45, 0xaf, 0x24, 0xb9, 0x24, 0xf4,
+  0x4a, 0xb2, 0x4b, 0x42, 0x2f, 0x64, 0xfb, 0x24, 0x48, 0xab, 0xb4, 0x4f,
+  0x82, 0xa4, 0xb4, 0x4f, 0xa2, 0xf4, 0x7a, 0xa3, 0xc0, 0x42, 0xcc, 0x44,
+  0xd2, 0x41, 0x34, 0x4c, 0x10, 0x3c, 0x11, 0xa3, 0x74, 0x11, 0x74, 0x48,
+  0x14, 0xf1, 0x48, 0x34, 0x12, 0x8f, 0x44, 0x12, 0xf4, 0x4a, 0x11, 0x41,
+  0x1c, 0x71, 0x14, 0xd8, 0x12, 0xb8, 0x16, 0xc4, 0x81, 0x6d, 0x52, 0x1c,
+  0xd8, 0x84, 0x4d, 0xd1, 0x24, 0x4d, 0xc1, 0x58, 0x54, 0xbc, 0x45, 0xc5,
+  0x1a, 0x15, 0xcc, 0x52, 0x1d, 0x4c, 0x18, 0x1d, 0x44, 0xc9, 0x31, 0x81,
+  0x6b, 0x14, 0x13, 0x38, 0x4a, 0x15, 0xf4, 0x48, 0x94, 0x11, 0xaf, 0x44,
+  0x1b, 0xb5, 0x48, 0x4b, 0xd8, 0x4a, 0x11, 0x84, 0x58, 0x84, 0x18, 0x25,
+  0xd8, 0x48, 0x98, 0x16, 0xaf, 0xe7, 0x08, 0x00, 0x48, 0x6e, 0x07, 0x30,
+  0x28, 0x00, 0x44, 0x07, 0x00, 0x21, 0x80, 0x08, 0x40, 0x0a, 0x00, 0x01,
+  0x00, 0x40, 0x20, 0x02, 0x28, 0x84, 0xa2, 0x05, 0xf0, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0x01, 0x1f, 0x36, 0x4a, 0x02, 0x14, 0x11, 0x64, 0x00, 0xa0,
+  0x14, 0x14, 0x41, 0xa8, 0x82, 0x70, 0x86, 0x42, 0x42, 0x18, 0x34, 0x52,
+  0x20, 0x21, 0x08, 0x22, 0x40, 0x44, 0x08, 0x4c, 0x31, 0x28, 0x46, 0x44,
+  0x38, 0x48, 0x80, 0x48, 0xa2, 0x85, 0x88, 0x81, 0x40, 0x0c, 0x27, 0x88,
+  0x24, 0x46, 0x04, 0x30, 0x42, 0x00, 0x48, 0x50, 0x24, 0x90, 0xc8, 0xc4,
+  0x18, 0x00, 0xf0, 0x88, 0xfa, 0x14, 0x24, 0x82, 0x1a, 0x72, 0x2a, 0x41,
+  0x78, 0x44, 0x21, 0x51, 0x25, 0x84, 0x5e, 0x83, 0x15, 0x08, 0x21, 0x4e,
+  0x11, 0x11, 0x24, 0x42, 0x24, 0x91, 0x87, 0x64, 0x4e, 0x11, 0x32, 0x12,
+  0x81, 0x33, 0x94, 0x44, 0x27, 0x24, 0x13, 0x34, 0x83, 0x81, 0x41, 0x10,
+  0x36, 0x12, 0x67, 0x11, 0x34, 0x1c, 0x61, 0x18, 0x4d, 0x11, 0x27, 0x29,
+  0x4b, 0x21, 0x1c, 0xf1, 0x44, 0x11, 0x86, 0xf9, 0x44, 0x92, 0x12, 0x1c,
+  0x71, 0x12, 0x48, 0x47, 0xc1, 0xc4, 0x16, 0x61, 0x64, 0x41, 0x46, 0x22,
+  0x94, 0x18, 0x56, 0x11, 0x78, 0xcc, 0x4b, 0x42, 0x22, 0x44, 0x71, 0x22,
+  0x43, 0x38, 0x44, 0x18, 0x4d, 0x52, 0x84, 0x4d, 0x11, 0x5d, 0xa8, 0x88,
+  0x26, 0xe2, 0x41, 0x18, 0x11, 0x4a, 0x94, 0x42, 0x91, 0x64, 0x4e, 0x12,
+  0x20, 0x23, 0x51, 0x43, 0x83, 0x5c, 0x22, 0x1e, 0x44, 0x33, 0x48, 0x1c,
+  0x3c, 0x41, 0x61, 0x8a, 0xd1, 0x1e, 0x31, 0xc2, 0x2f, 0x14, 0x69, 0x98,
+  0x45, 0x31, 0x1a, 0x61, 0x27, 0x88, 0x47, 0x31, 0x4e, 0x88, 0x4f, 0x21,
+  0x34, 0x14, 0x1c, 0x71, 0x22, 0x48, 0x07, 0x4e, 0x84, 0x57, 0x21, 0x6c,
+  0x14, 0x48, 0xc2, 0x12, 0x89, 0xe1, 0x11, 0x34, 0x18, 0xef, 0x91, 0x01,
+  0x10, 0xa1, 0x12, 0xc4, 0x10, 0x01, 0x11, 0x14, 0x8a, 0x14, 0x02, 0x21,
+  0x19, 0x14, 0x02, 0x23, 0x24, 0x11, 0xe2, 0x81, 0xc4, 0x81, 0x32, 0x40,
+  0x28, 0x14, 0x24, 0x14, 0x91, 0x28, 0x48, 0x40, 0x08, 0x21, 0xc0, 0x11,
+  0x00, 0x12, 0x49, 0xa8, 0x21, 0x1c, 0x81, 0x54, 0x14, 0x82, 0x24, 0x48,
+  0x18, 0x60, 0x14, 0x00, 0xe0, 0x44, 0xd8, 0x84, 0x24, 0x04, 0x40, 0xd2,
+  0x79, 0x0b, 0x00, 0x00, 0x14, 0x40, 0x21, 0x41, 0x02, 0x00, 0x27, 0x14,
+  0x12, 0x10, 0xc1, 0x82, 0x41, 0x00, 0x00, 0x46, 0x01, 0x00, 0x20, 0x02,
+  0x84, 0x10, 0x02, 0x60, 0x49, 0x25, 0x03, 0x14, 0x50, 0x32, 0x8c, 0x32,
+  0x48, 0x15, 0x08, 0x28, 0x00, 0x14, 0x00, 0x10, 0x02, 0x21, 0x00, 0x4b,
+  0x42, 0x18, 0x84, 0x1f, 0x2e, 0x04, 0x16, 0xc1, 0x21, 0x10, 0x8c, 0x11,
+  0x42, 0x12, 0x88, 0x75, 0x14, 0x78, 0x42, 0x22, 0x21, 0x58, 0x82, 0xc6,
+  0x31, 0x12, 0x37, 0x82, 0x89, 0x71, 0x82, 0x02, 0x80, 0x02, 0x26, 0x14,
+  0x88, 0x52, 0x81, 0x19, 0x54, 0x2a, 0x14, 0x6d, 0x88, 0xd0, 0xa4, 0x94,
+  0x18, 0x28, 0x22, 0x1e, 0x82, 0xd0, 0x82, 0x0a, 0x50, 0x23, 0xc0, 0x21,
+  0x46, 0x0c, 0x11, 0x30, 0x1f, 0x19, 0x11, 0xe3, 0x22, 0x04, 0x2c, 0x32,
+  0x48, 0xc2, 0x18, 0x41, 0x41, 0xdf, 0xaa, 0x02, 0x14, 0x14, 0x00, 0x18,
+  0x21, 0x14, 0xa9, 0x61, 0x24, 0xac, 0xc1, 0x42, 0x18, 0x1b, 0x84, 0xa9,
+  0xc1, 0xc3, 0x90, 0x81, 0x25, 0x82, 0x18, 0x02, 0x22, 0x46, 0x01, 0x81,
+  0x22, 0x84, 0x1b, 0x42, 0x84, 0x11, 0x83, 0x08, 0x42, 0x20, 0x98, 0x23,
+  0x23, 0x18, 0xb1, 0x82, 0x12, 0x41, 0x32, 0x41, 0x25, 0x28, 0xc2, 0x6c,
+  0x00, 0x15, 0x72, 0x14, 0x99, 0x11, 0x21, 0x42, 0x30, 0x22, 0x89, 0xa4,
+  0x48, 0x43, 0xc6, 0x14, 0xf0, 0x1c, 0xc4, 0x20, 0x21, 0x02, 0xc4, 0x14,
+  0x00, 0x80, 0x41, 0x04, 0x10, 0x02, 0x60, 0x31, 0x89, 0xd2, 0x84, 0x01,
+  0x00, 0x00, 0x49, 0x02, 0x10, 0x41, 0x02, 0x25, 0x58, 0x26, 0x50, 0x84,
+  0x2d, 0x18, 0x36, 0x04, 0x2c, 0x01, 0x85, 0x42, 0xc2, 0x28, 0x81, 0x11,
+  0x11, 0x00, 0x14, 0x00, 0x50, 0x21, 0x2c, 0x02, 0x24, 0x00, 0x18, 0x50,
+  0x84, 0x1f, 0xd1, 0x48, 0x01, 0x84, 0x84, 0x81, 0x81, 0x14, 0x40, 0x84,
+  0x11, 0xc2, 0x12, 0xc0, 0x28, 0x82, 0x40, 0x05, 0x84, 0x83, 0xa1, 0x12,
+  0x21, 0x42, 0x10, 0x22, 0x01, 0x58, 0x42, 0x10, 0x08, 0x42, 0x2c, 0x04,
+  0x26, 0xc1, 0x15, 0x8c, 0x04, 0x12, 0x28, 0x14, 0x81, 0x81, 0x12, 0x46,
+  0x28, 0xc1, 0x18, 0xb0, 0x12, 0x06, 0x10, 0x94, 0x12, 0x60, 0x42, 0x15,
+  0x62, 0x44, 0x80, 0xf2, 0x2c, 0x6e, 0x80, 0x41, 0x28, 0x21, 0x02, 0x00,
+  0x00, 0x30, 0x84, 0x1c, 0x91, 0x22, 0x20, 0x81, 0x18, 0x82, 0x21, 0x18,
+  0x12, 0x04, 0x90, 0x12, 0x00, 0x84, 0x40, 0x08, 0x8c, 0x28, 0x01, 0x16,
+  0x09, 0x82, 0x2f, 0x82, 0x55, 0x48, 0xa2, 0x58, 0x20, 0xc8, 0x12, 0x11,
+  0x40, 0x01, 0x44, 0x28, 0x92, 0x18, 0x16, 0x09, 0x82, 0x24, 0x24, 0x2a,
+  0xa1, 0x21, 0x48, 0x47, 0xab, 0x24, 0x80, 0x02, 0x11, 0x00, 0x16, 0xc8,
+  0x21, 0x91, 0x19, 0x41, 0x48, 0x08, 0x40, 0x08, 0x00, 0x41, 0x20, 0x02,
+  0x48, 0x40, 0x44, 0x09, 0x50, 0x23, 0x44, 0x14, 0x00, 0x8a, 0x02, 0x00,
+  0x14, 0x15, 0x02, 0x00, 0x20, 0x08, 0x48, 0x28, 0x00, 0x10, 0x48, 0x41,
+  0x92, 0x18, 0x42, 0x13, 0x01, 0x48, 0xf0, 0x52, 0x8f, 0x20, 0x01, 0x70,
+  0x28, 0x41, 0x18, 0x61, 0x81, 0x47, 0x12, 0x1c, 0x01, 0x87, 0x28, 0x11,
+  0x25, 0x08, 0x12, 0x88, 0x80, 0x61, 0x89, 0x2f, 0x22, 0x01, 0x42, 0x00,
+  0x00, 0x1a, 0x24, 0x14, 0x11, 0xd8, 0x81, 0x88, 0x04, 0x8e, 0x28, 0x14,
+  0x17, 0x21, 0x50, 0x18, 0x36, 0xa1, 0x52, 0x11, 0x84, 0x2c, 0x21, 0x49,
+  0xa8, 0x41, 0x84, 0xb0, 0x42, 0x81, 0x99, 0x18, 0x16, 0x5c, 0x22, 0x8c,
+  0x61, 0x66, 0x12, 0x4a, 0x81, 0xc5, 0x42, 0x1f, 0x4f, 0x0e, 0x21, 0x28,
+  0x89, 0x01, 0x00, 0x00, 0x85, 0x32, 0x11, 0x18, 0x16, 0x08, 0x82, 0x81,
+  0x51, 0x21, 0x84, 0x44, 0xc0, 0x24, 0x20, 0x04, 0x44, 0x15, 0x18, 0x48,
+  0x12, 0x18, 0x06, 0x18, 0x42, 0x29, 0x81, 0x92, 0x84, 0x1a, 0x12, 0x24,
+  0x18, 0x02, 0x88, 0x84, 0x14, 0x48, 0x14, 0x1a, 0x02, 0x00, 0x00, 0x12,
+  0x88, 0x00, 0x43, 0x92, 0x21, 0x22, 0x7f, 0xea, 0x0d, 0x12, 0x10, 0x01,
+  0x11, 0x21, 0x11, 0x85, 0x01, 0x00, 0x25, 0x22, 0x01, 0x28, 0x14, 0x21,
+  0x81, 0x12, 0x20, 0x01, 0x00, 0x34, 0x48, 0x1e, 0x42, 0x80, 0x85, 0x14,
+  0x02, 0x81, 0x40, 0x23, 0x23, 0x42, 0x02, 0x80, 0x21, 0x24, 0x24, 0x11,
+  0x22, 0x63, 0x22, 0x10, 0x22, 0x84, 0x82, 0x12, 0x82, 0xa1, 0x14, 0x21,
+  0x48, 0x1c, 0x01, 0x4f, 0x2f, 0x0a, 0x22, 0x83, 0x11, 0x04, 0x00, 0x83,
+  0x82, 0x32, 0x21, 0x89, 0x82, 0x82, 0x02, 0x12, 0x18, 0x90, 0x28, 0x25,
+  0x21, 0x42, 0x48, 0x42, 0x09, 0x00, 0x12, 0x40, 0x02, 0x45, 0x88, 0x04,
+  0x10, 0x04, 0x60, 0x14, 0x49, 0x01, 0x40, 0x08, 0x28, 0x20, 0x04, 0x10,
+  0xa8, 0x21, 0x89, 0x82, 0x01, 0x10, 0x08, 0x18, 0x50, 0x18, 0x18, 0xbf,
+  0x9c, 0x0d, 0x11, 0x00, 0x14, 0x10, 0x93, 0x21, 0x24, 0x11, 0x14, 0x81,
+  0x18, 0x84, 0x11, 0x93, 0x12, 0x01, 0x24, 0x90, 0x12, 0x14, 0x00, 0x8d,
+  0x11, 0x21, 0x11, 0x21, 0x48, 0x24, 0x13, 0x02, 0x42, 0x84, 0x15, 0x08,
+  0x2d, 0x42, 0x18, 0x00, 0x00, 0x25, 0x21, 0xc1, 0x48, 0x60, 0x14, 0x14,
+  0x49, 0x01, 0x12, 0x24, 0x12, 0x20, 0x04, 0x00, 0x14, 0x24, 0x8f, 0x43,
+  0x02, 0x25, 0x18, 0x31, 0x18, 0x00, 0x18, 0x21, 0x10, 0x08, 0x10, 0x01,
+  0x38, 0x44, 0xc0, 0x11, 0x1c, 0x23, 0x02, 0x2d, 0x44, 0x14, 0x14, 0x40,
+  0x04, 0x14, 0x83, 0x11, 0x01, 0x16, 0x41, 0xaa, 0x21, 0x24, 0x12, 0x12,
+  0xc0, 0x48, 0x48, 0x85, 0x12, 0x31, 0x28, 0x84, 0x21, 0x11, 0x25, 0x88,
+  0x81, 0xc4, 0x63, 0x44, 0x60, 0x86, 0x32, 0x21, 0x40, 0x04, 0x20, 0xf2,
+  0x67, 0x74, 0x20, 0x79, 0x18, 0x41, 0x41, 0x01, 0x18, 0xc0, 0x21, 0x00,
+  0x00, 0x44, 0x24, 0x24, 0x00, 0x22, 0x21, 0x15, 0x02, 0x48, 0x24, 0x10,
+  0x01, 0x60, 0x24, 0x80, 0x91, 0x18, 0x2c, 0x02, 0x12, 0x40, 0x02, 0x10,
+  0x88, 0x04, 0x42, 0x22, 0x40, 0x02, 0x40, 0x41, 0x62, 0x22, 0x20, 0xc4,
+  0x22, 0x48, 0x14, 0x42, 0x4a, 0x01, 0x22, 0xcf, 0x74, 0x07, 0x00, 0x00,
+  0x31, 0x00, 0x20, 0x42, 0xd8, 0x22, 0x01, 0x12, 0x28, 0x18, 0x84, 0x21,
+  0x40, 0x08, 0x00, 0x17, 0x81, 0x00, 0xf0, 0x18, 0x42, 0x40, 0x04, 0x42,
+  0x42, 0x90, 0x48, 0x12, 0x20, 0x03, 0x10, 0x42, 0x02, 0x10, 0xe8, 0x11,
+  0x64, 0x81, 0x84, 0x16, 0x02, 0x20, 0x11, 0x42, 0x08, 0x42, 0x00, 0x25,
+  0x02, 0x5f, 0x44, 0x07, 0x26, 0x6c, 0x22, 0x84, 0x81, 0x41, 0x10, 0x04,
+  0x10, 0x64, 0x82, 0x85, 0x04, 0x8c, 0x02, 0x80, 0x02, 0x18, 0x00, 0x00,
+  0x81, 0x48, 0x21, 0x41, 0x84, 0x48, 0x00, 0x2d, 0x14, 0x14, 0x00, 0x44,
+  0x84, 0x58, 0x14, 0x41, 0x94, 0x45, 0x98, 0x41, 0x41, 0x25, 0x08, 0x44,
+  0x48, 0x12, 0x00, 0x81, 0x21, 0x12, 0x40, 0x09, 0x00, 0xbf, 0xa9, 0x45,
+  0x41, 0x65, 0x0c, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x97, 0x25, 0x08, 0x00,
+  0xe0, 0xa1, 0x62, 0x82, 0x91, 0x24, 0x60, 0x81, 0x12, 0x11, 0x23, 0xc1,
+  0x11, 0x00, 0x33, 0x14, 0x82, 0x14, 0x02, 0xe0, 0x22, 0x55, 0x81, 0x2d,
+  0x18, 0x1a, 0x92, 0x12, 0x00, 0x84, 0xa4, 0x24, 0x85, 0x02, 0x30, 0x18,
+  0x42, 0x40, 0x21, 0x02, 0x28, 0x12, 0x00, 0x12, 0x13, 0x42, 0x21, 0x21,
+  0x41, 0x03, 0x1f, 0x4d, 0x0a, 0x84, 0xa0, 0x41, 0x10, 0x08, 0x00, 0x84,
+  0x28, 0x40, 0x04, 0x28, 0x15, 0xc8, 0x28, 0x15, 0x04, 0x44, 0x17, 0x82,
+  0x48, 0x84, 0xa5, 0x04, 0x4a, 0x11, 0xc9, 0x89, 0x18, 0x12, 0x94, 0x28,
+  0x40, 0x01, 0x21, 0x84, 0x80, 0xc4, 0x48, 0x00, 0x11, 0x20, 0x21, 0x01,
+  0x9d, 0x14, 0x93, 0x82, 0x52, 0x28, 0x60, 0x51, 0x81, 0x44, 0x40, 0x02,
+  0x2d, 0x14, 0xf0, 0x11, 0xc2, 0x24, 0x22, 0x8e, 0x33, 0x00, 0x64, 0x1e,
+  0x11, 0x25, 0x19, 0x21, 0x22, 0x12, 0xb2, 0x2a, 0x73, 0x14, 0xd8, 0x81,
+  0xd1, 0x83, 0x01, 0x1e, 0x2a, 0x18, 0x16, 0x53, 0xa8, 0x1f, 0x11, 0x01,
+  0x54, 0x15, 0xb8, 0x44, 0x84, 0xb1, 0x44, 0xf5, 0x18, 0x48, 0x58, 0x4b,
+  0x22, 0x2f, 0x25, 0x81, 0x86, 0xf1, 0x12, 0x42, 0x24, 0x32, 0x2d, 0x31,
+  0x16, 0x12, 0x79, 0x48, 0x46, 0xd2, 0x12, 0xc2, 0x38, 0x90, 0x4a, 0x8f,
+  0x82, 0xc4, 0x31, 0xdf, 0x92, 0x44, 0xa1, 0x62, 0x2c, 0x52, 0x82, 0x22,
+  0x9b, 0x25, 0x1b, 0x44, 0x16, 0x81, 0x44, 0xa5, 0x12, 0xdf, 0xf7, 0x41,
+  0xa1, 0x11, 0x11, 0x8d, 0x11, 0x95, 0x51, 0x18, 0x35, 0x72, 0x28, 0x24,
+  0x52, 0x88, 0x9c, 0xf2, 0x28, 0x3a, 0x16, 0xb3, 0x22, 0x71, 0x18, 0x71,
+  0x38, 0x43, 0x93, 0x18, 0x16, 0xc2, 0x34, 0x23, 0x93, 0x46, 0x85, 0x58,
+  0xa1, 0x2c, 0x51, 0x32, 0x3d, 0x43, 0xb4, 0x23, 0x34, 0x43, 0x1c, 0xd5,
+  0x88, 0xf2, 0x5a, 0x14, 0x8f, 0x81, 0x92, 0x15, 0x1c, 0xb1, 0x42, 0xc1,
+  0x48, 0x84, 0x4e, 0x42, 0x21, 0xb5, 0x58, 0x49, 0x4a, 0xf4, 0x48, 0x52,
+  0x16, 0xf2, 0x13, 0x11, 0x95, 0xe2, 0x24, 0x81, 0x51, 0x8a, 0x21, 0x9f,
+  0x23, 0x95, 0x1a, 0x2d, 0x54, 0xd0, 0x84, 0x21, 0x55, 0x38, 0x24, 0x9f,
+  0x8c, 0x04, 0x1d, 0x25, 0x87, 0x81, 0x57, 0x81, 0xa4, 0x11, 0x90, 0x21,
+  0xbc, 0xd2, 0x11, 0x52, 0x48, 0x40, 0x18, 0x08, 0x49, 0x72, 0x2b, 0x78,
+  0x23, 0xf5, 0x21, 0x29, 0x27, 0x82, 0x1d, 0x11, 0x42, 0x3d, 0x41, 0x89,
+  0xd1, 0x1a, 0x14, 0x61, 0x84, 0xb3, 0xc1, 0x12, 0x47, 0x21, 0x97, 0xa5,
+  0x1d, 0x41, 0xa4, 0x23, 0x52, 0x88, 0x23, 0x41, 0x36, 0x38, 0xc9, 0x51,
+  0x82, 0x84, 0x1c, 0xe1, 0x84, 0x74, 0x39, 0x62, 0xc1, 0x1f, 0x14, 0x01,
+  0x36, 0x28, 0x71, 0x52, 0xf2, 0x14, 0x12, 0x1a, 0xe1, 0x44, 0xe2, 0xa1,
+  0x02, 0x16, 0xc2, 0x42, 0x18, 0x1a, 0x91, 0x22, 0xff, 0x8c, 0x4e, 0x43,
+  0xe4, 0x22, 0x41, 0x4c, 0x41, 0x44, 0x42, 0x44, 0x41, 0x0c, 0x84, 0x24,
+  0x40, 0x51, 0x84, 0x28, 0x41, 0x10, 0x05, 0x41, 0x42, 0x41, 0x10, 0x06,
+  0x61, 0x10, 0x44, 0x04, 0x44, 0x40, 0x14, 0x42, 0x04, 0x44, 0x21, 0x44,
+  0x40, 0x04, 0x44, 0x24, 0x12, 0x20, 0x01, 0x43, 0x01, 0x43, 0x41, 0x72,
+  0x14, 0x08, 0x45, 0x08, 0x45, 0x08, 0xef, 0xd9, 0x07, 0x4f, 0x61, 0xf3,
+  0x16, 0x26, 0x35, 0x54, 0x75, 0xf5, 0x5c, 0x64, 0xa5, 0xf8, 0x2d, 0x2c,
+  0x4f, 0x42, 0x42, 0xb2, 0x12, 0x11, 0x82, 0xf1, 0x15, 0x16, 0xef, 0x41,
+  0x71, 0x24, 0x75, 0x2c, 0xfb, 0x3a, 0x3c, 0x3f, 0x41, 0xf1, 0x2c, 0x3d,
+  0x9d, 0x19, 0x85, 0xfc, 0x18, 0x1d, 0xcf, 0xd4, 0xf4, 0x4b, 0x49, 0x47,
+  0x64, 0x7f, 0xf4, 0xf4, 0x54, 0x1c, 0x8f, 0xa5, 0x74, 0x6a, 0xfc, 0x3d,
+  0x15, 0x4f, 0x47, 0xf7, 0x3e, 0x36, 0xaf, 0xe5, 0x55, 0x44, 0x4f, 0x41,
+  0xf3, 0x24, 0x26, 0x25, 0x5e, 0xd5, 0x4f, 0xc4, 0x54, 0xc7, 0x3b, 0x66,
+  0x5f, 0x53, 0xf3, 0x54, 0x54, 0x7f, 0x44, 0xb4, 0x49, 0xf6, 0x79, 0x71,
+  0x1b, 0x55, 0xef, 0xc4, 0x54, 0xcc, 0x47, 0x62, 0xcb, 0x46, 0xaf, 0x42,
+  0xe2, 0xd4, 0xf6, 0x5c, 0x5d, 0x8f, 0x81, 0xf1, 0x18, 0x1c, 0xcc, 0xf1,
+  0x2c, 0x2f, 0x1e, 0x77, 0x24, 0x3b, 0x31, 0x7e, 0x71, 0x1f, 0xe1, 0xd1,
+  0x57, 0x54, 0xa8, 0x35, 0xd3, 0xdd, 0xf2, 0x2d, 0x2c, 0xdf, 0xc2, 0x52,
+  0x28, 0x6f, 0xc3, 0x71, 0x12, 0xe2, 0x41, 0xd3, 0x31, 0xf1, 0x1a, 0x38,
+  0x6f, 0x42, 0x72, 0x2f, 0xfb, 0x2a, 0x3c, 0xaf, 0xe1, 0xf1, 0x2d, 0x3f,
+  0xef, 0xd1, 0x51, 0xca, 0x9f, 0xd1, 0xf1, 0x5d, 0x56, 0xff, 0xd4, 0xe4,
+  0x3c, 0xec, 0xb4, 0xf4, 0x54, 0xce, 0xef, 0xe5, 0xf5, 0x6a, 0x5f, 0x6f,
+  0x73, 0xf5, 0x71, 0x71, 0xaf, 0xa1, 0xf1, 0x5a, 0x5d, 0x65, 0xbc, 0x12,
+  0xe2, 0xa2, 0xd6, 0xe2, 0xd1, 0x55, 0xf4, 0x42, 0x48, 0x95, 0xfb, 0x46,
+  0x4c, 0xdf, 0xd2, 0xf7, 0x18, 0x58, 0x3f, 0x34, 0xf5, 0x5c, 0x74, 0x9b,
+  0x77, 0x1f, 0x55, 0xf7, 0x4a, 0x5a, 0x8d, 0x28, 0x6f, 0x42, 0xb3, 0x7e,
+  0xf7, 0x2a, 0x24, 0x2f, 0xd1, 0xf6, 0x5c, 0x5c, 0x4f, 0x41, 0xf1, 0x52,
+  0x54, 0x1e, 0x1c, 0xcd, 0x3e, 0xdf, 0x7d, 0x4f, 0xf3, 0x12, 0x31, 0x1b,
+  0x73, 0x51, 0x74, 0xb5, 0x58, 0x31, 0xef, 0xc1, 0xf3, 0x21, 0x29, 0x8f,
+  0x92, 0x52, 0x6c, 0x2f, 0x41, 0x31, 0x12, 0xaf, 0x81, 0x53, 0x29, 0xbf,
+  0x31, 0xf1, 0x2c, 0x22, 0xbf, 0x73, 0xf1, 0x3a, 0x39, 0xff, 0x93, 0xf1,
+  0x3b, 0x38, 0x7f, 0x55, 0xd5, 0x8b, 0xf4, 0x1d, 0x11, 0x9f, 0x14, 0xf5,
+  0x4e, 0x4f, 0x1c, 0xf8, 0x52, 0x53, 0x8f, 0x85, 0xf5, 0x54, 0x56, 0xed,
+  0x19, 0xaf, 0xd6, 0xf4, 0x6a, 0x69, 0xaf, 0x22, 0xf2, 0x4e, 0x4a, 0x1e,
+  0x1c, 0x3e, 0x32, 0x2f, 0x22, 0x56, 0xae, 0x95, 0xef, 0x84, 0x54, 0x91,
+  0x4f, 0x44, 0xf4, 0x51, 0x51, 0x1a, 0xf1, 0x4b, 0x59, 0xaf, 0xc3, 0xf3,
+  0x31, 0x31, 0x5e, 0x71, 0x2b, 0x54, 0xa5, 0xf8, 0x2e, 0x3a, 0xaf, 0xc7,
+  0xf7, 0x62, 0x62, 0xcb, 0x62, 0x5e, 0x58, 0x4f, 0x45, 0xb4, 0x52, 0xb5,
+  0x1c, 0xc1, 0x1a, 0xbe, 0x86, 0xf0, 0x15, 0x34, 0x1f, 0x33, 0xf7, 0x17,
+  0x1a, 0x27, 0xd4, 0xc5, 0x5c, 0x21, 0x9f, 0x81, 0xf3, 0x25, 0x2c, 0x9f,
+  0x82, 0x72, 0x2c, 0xf6, 0x32, 0x3c, 0x27, 0xa1, 0xef, 0x81, 0x51, 0xb9,
+  0xef, 0xe1, 0xf1, 0x2c, 0x2a, 0xbf, 0x73, 0xf1, 0x3b, 0x39, 0xff, 0xb3,
+  0xf3, 0x3d, 0x3f, 0x3b, 0x55, 0x8f, 0x84, 0xf4, 0x1d, 0x19, 0xdf, 0x74,
+  0xf5, 0x4b, 0x4a, 0x1c, 0xf8, 0x5c, 0x5f, 0xcf, 0xed, 0xf5, 0x52, 0x52,
+  0xed, 0x1b, 0xaf, 0xf7, 0xf5, 0x4c, 0x5d, 0xaf, 0xa1, 0xf1, 0x4f, 0x5a,
+  0x2f, 0x61, 0xf1, 0x36, 0x36, 0xaf, 0x22, 0xf2, 0x1e, 0x1a, 0x17, 0x74,
+  0x6f, 0xe4, 0x54, 0xb3, 0xaf, 0x84, 0xf4, 0x5d, 0x5d, 0xcf, 0xc1, 0xf1,
+  0x4b, 0x5b, 0xaf, 0xc3, 0xf3, 0x38, 0x39, 0x57, 0x11, 0x2f, 0x24, 0x75,
+  0x2e, 0xfc, 0x2e, 0x38, 0xaf, 0xc7, 0xf7, 0x7a, 0x6a, 0xeb, 0x67, 0x4f,
+  0xd5, 0xf5, 0x58, 0x48, 0x5a, 0xb5, 0x1c, 0x51, 0xf4, 0xde, 0xdf, 0x40,
+  0x01, 0x14, 0x00, 0x60, 0x12, 0x84, 0x40, 0x28, 0x22, 0x01, 0x40, 0x73,
+  0x11, 0x08, 0x16, 0x88, 0x22, 0x11, 0x18, 0x11, 0x08, 0x10, 0x01, 0x00,
+  0x18, 0x89, 0x22, 0x12, 0x08, 0x00, 0x00, 0x84, 0x00, 0x14, 0x12, 0xe0,
+  0x81, 0x44, 0x01, 0xc0, 0x48, 0x60, 0x81, 0xc0, 0x48, 0x20, 0x21, 0x04,
+  0x00, 0xdf, 0xc9, 0x09, 0x00, 0x81, 0x11, 0x24, 0x80, 0x41, 0x48, 0x01,
+  0x40, 0x18, 0x2a, 0x01, 0x12, 0x34, 0x11, 0x81, 0x11, 0x21, 0x11, 0x40,
+  0x42, 0xd1, 0x21, 0x54, 0x18, 0x2c, 0x21, 0x14, 0x21, 0xf4, 0x22, 0x1a,
+  0x83, 0x51, 0x22, 0xc0, 0x12, 0x12, 0x25, 0x02, 0x10, 0x71, 0x42, 0x81,
+  0x92, 0x18, 0x70, 0x22, 0x51, 0x81, 0x89, 0x61, 0x81, 0x21, 0x10, 0x02,
+  0x29, 0x21, 0x81, 0x81, 0x84, 0x21, 0xe2, 0xec, 0x0f, 0x3c, 0xf4, 0x11,
+  0x24, 0x8d, 0x12, 0x1f, 0xc1, 0x72, 0x48, 0xf3, 0x11, 0x24, 0xa7, 0x24,
+  0x1d, 0x24, 0xaf, 0x14, 0xd1, 0xc1, 0xf2, 0x4a, 0x93, 0x1d, 0x28, 0xaf,
+  0x14, 0x19, 0xf5, 0x4a, 0x91, 0x47, 0x82, 0xaf, 0x34, 0x39, 0x24, 0x2f,
+  0x14, 0x79, 0x24, 0xd8, 0x12, 0xf9, 0x24, 0x48, 0x1c, 0xf9, 0x24, 0x4a,
+  0x1c, 0xf8, 0x26, 0x4a, 0x16, 0xf1, 0x27, 0x4a, 0x96, 0xf1, 0x22, 0x4a,
+  0x96, 0xc5, 0x4a, 0x8f, 0x49, 0xd2, 0xa2, 0xf4, 0xd1, 0x24, 0x2d, 0x43,
+  0x1f, 0x49, 0x52, 0x38, 0x1f, 0x49, 0x32, 0x4c, 0x0a, 0x40, 0x4a, 0x12,
+  0x1f, 0x48, 0x05, 0x00, 0xf0, 0x79, 0x41, 0xf2, 0x4a, 0x92, 0x1b, 0x21,
+  0xab, 0x94, 0x53, 0xf1, 0x4a, 0x91, 0x4b, 0x43, 0xaf, 0x24, 0x39, 0x34,
+  0x2f, 0x24, 0x79, 0x24, 0x98, 0x92, 0x4f, 0x82, 0x84, 0xf9, 0x24, 0x4a,
+  0xee, 0x8b, 0x80, 0xd4, 0x81, 0x94, 0x58, 0x1b, 0x21, 0x83, 0xb4, 0x11,
+  0x32, 0x48, 0x28, 0x8b, 0x14, 0x28, 0x8f, 0x44, 0x88, 0xf2, 0x4a, 0xb4,
+  0xa0, 0xb4, 0xf0, 0x4a, 0x91, 0x22, 0x2b, 0x94, 0x26, 0xd8, 0x12, 0x79,
+  0x32, 0xe8, 0x14, 0xf9, 0x22, 0x18, 0x8d, 0x81, 0x2e, 0xd2, 0x5e, 0x81,
+  0x2e, 0x48, 0x92, 0x2e, 0x42, 0x96, 0xc1, 0x49, 0x8b, 0x2d, 0xbc, 0xe4,
+  0x8d, 0xe2, 0x22, 0x64, 0x8d, 0x81, 0x9a, 0x26, 0xb4, 0x91, 0xb6, 0x42,
+  0xa1, 0x28, 0xab, 0x14, 0x19, 0xd2, 0x4a, 0x99, 0x61, 0x8f, 0x46, 0x88,
+  0xb2, 0x4a, 0x89, 0xb4, 0x4a, 0x2b, 0xa2, 0xb4, 0x2a, 0x84, 0xb9, 0x22,
+  0x84, 0xf9, 0x22, 0x52, 0x9d, 0x76, 0x20, 0x28, 0x88, 0x04, 0x29, 0x0a,
+  0x22, 0x04, 0x28, 0x39, 0x0a, 0x10, 0x88, 0x05, 0x00, 0x11, 0x21, 0x0b,
+  0x00, 0x31, 0x44, 0x80, 0x02, 0x43, 0x0a, 0xf0, 0xff, 0xff, 0xff, 0x9d,
+  0x77, 0x9e, 0x24, 0x40, 0x41, 0x3c, 0x12, 0x85, 0x42, 0x31, 0x28, 0x8d,
+  0x11, 0x44, 0x24, 0x90, 0x11, 0x50, 0x12, 0x85, 0xd2, 0x21, 0x19, 0x64,
+  0x21, 0x30, 0x21, 0x00, 0x22, 0x88, 0x25, 0x34, 0x21, 0x42, 0x16, 0xf2,
+  0x41, 0x18, 0x35, 0x94, 0x22, 0x30, 0x42, 0x1e, 0x42, 0x46, 0x42, 0xd1,
+  0x14, 0x11, 0x82, 0x01, 0x50, 0x18, 0x48, 0x85, 0x03, 0x42, 0x21, 0x40,
+  0xc8, 0x48, 0x48, 0x29, 0x81, 0x38, 0x48, 0x2d, 0x82, 0x22, 0x40, 0x08,
+  0xcb, 0x63, 0x00, 0x8a, 0x01, 0x14, 0x44, 0x26, 0x82, 0xd1, 0x42, 0xf2,
+  0x21, 0x18, 0x8d, 0x21, 0x12, 0x84, 0x21, 0x88, 0x21, 0x42, 0x81, 0x29,
+  0x24, 0xd1, 0x22, 0xe8, 0x86, 0x61, 0x87, 0x00, 0x42, 0x90, 0x12, 0x1b,
+  0x24, 0x22, 0x3a, 0xb4, 0x11, 0xb4, 0x42, 0x48, 0x12, 0x38, 0x21, 0x45,
+  0x22, 0x12, 0x51, 0x32, 0x4c, 0xe5, 0x16, 0x11, 0x72, 0x22, 0xb8, 0x84,
+  0xa1, 0x42, 0x81, 0x1c, 0x4c, 0x68, 0x15, 0x19, 0x61, 0x11, 0x14, 0x8d,
+  0x53, 0x80, 0x24, 0x84, 0x68, 0x14, 0x24, 0x8f, 0xc8, 0x44, 0x02, 0xce,
+  0x11, 0xa4, 0x19, 0x41, 0x74, 0x22, 0xf2, 0x28, 0x12, 0x9d, 0x14, 0x4b,
+  0x21, 0x11, 0x63, 0x61, 0x31, 0x26, 0x62, 0x18, 0xa1, 0x4e, 0x82, 0x85,
+  0x66, 0x25, 0x16, 0x62, 0x38, 0x56, 0xa2, 0x52, 0x28, 0x1a, 0xd8, 0x42,
+  0x64, 0x38, 0x12, 0x1e, 0x22, 0x1e, 0x2b, 0x54, 0x3f, 0x23, 0x34, 0xc1,
+  0x21, 0xa9, 0xb5, 0x28, 0x44, 0x67, 0x37, 0x11, 0x60, 0x45, 0x1f, 0x22,
+  0x05, 0x83, 0x62, 0x69, 0x22, 0xc1, 0x1c, 0x48, 0xf8, 0x48, 0x11, 0x8f,
+  0x11, 0x22, 0x14, 0xf3, 0x48, 0x12, 0x89, 0x64, 0x2c, 0x2c, 0x06, 0x8d,
+  0x41, 0x12, 0xdf, 0xe2, 0x07, 0x00, 0x41, 0x10, 0x18, 0x01, 0x28, 0x85,
+  0xc1, 0x28, 0x40, 0x08, 0x40, 0x32, 0x11, 0x00, 0x20, 0x92, 0x28, 0x84,
+  0x00, 0x20, 0x22, 0x94, 0x41, 0x42, 0x2a, 0x05, 0x20, 0x44, 0x12, 0x11,
+  0x42, 0x44, 0x32, 0x11, 0x21, 0x50, 0x38, 0x48, 0x85, 0x81, 0x64, 0x24,
+  0x48, 0x00, 0x42, 0x13, 0x81, 0x31, 0x81, 0x24, 0x00, 0x82, 0x40, 0xd2,
+  0xe7, 0x09, 0x48, 0x00, 0x44, 0x22, 0x80, 0x01, 0x22, 0x13, 0x11, 0x42,
+  0x58, 0x12, 0x50, 0x12, 0x41, 0x44, 0x00, 0x40, 0x01, 0x80, 0x44, 0x04,
+  0x14, 0x60, 0x51, 0x20, 0x44, 0x22, 0x21, 0x72, 0x81, 0x04, 0x90, 0x12,
+  0x44, 0x24, 0x84, 0x00, 0x42, 0x12, 0x10, 0xc1, 0x11, 0x00, 0x12, 0x38,
+  0x41, 0x29, 0x42, 0x08, 0x22, 0x00, 0xb7, 0x48, 0x10, 0x01, 0x17, 0x82,
+  0x25, 0x58, 0x21, 0x1d, 0x28, 0x27, 0x72, 0x15, 0x98, 0x13, 0xa1, 0x4a,
+  0x92, 0x12, 0x24, 0x81, 0xc0, 0x18, 0x33, 0x91, 0x12, 0x26, 0x08, 0x22,
+  0x44, 0x89, 0x92, 0x28, 0x94, 0x44, 0x84, 0x23, 0xd1, 0x28, 0x92, 0x44,
+  0x71, 0x23, 0x12, 0x9c, 0x12, 0x18, 0x70, 0x13, 0x24, 0x42, 0x38, 0x3e,
+  0x88, 0x8c, 0xd1, 0x28, 0x11, 0x28, 0x22, 0x32, 0x12, 0x46, 0x18, 0x03,
+  0x23, 0xc4, 0x48, 0x23, 0x21, 0x38, 0x42, 0x63, 0x16, 0x84, 0x06, 0x57,
+  0x4a, 0x60, 0x14, 0x30, 0x29, 0xc1, 0x26, 0x61, 0x92, 0x28, 0x24, 0x1c,
+  0x62, 0x11, 0x28, 0x40, 0x51, 0xa2, 0x11, 0x4c, 0x51, 0x63, 0x40, 0x08,
+  0x10, 0x14, 0x38, 0x48, 0x15, 0x14, 0x44, 0x88, 0x31, 0x18, 0x47, 0x24,
+  0x4d, 0x43, 0x22, 0x27, 0x21, 0x18, 0x1a, 0x48, 0x12, 0x24, 0x01, 0x2d,
+  0x38, 0x90, 0x18, 0x81, 0x84, 0x12, 0x28, 0x1c, 0xd1, 0x38, 0x11, 0x01,
+  0x52, 0xac, 0x33, 0x14, 0x22, 0x25, 0x68, 0x42, 0x28, 0x00, 0x8f, 0x45,
+  0x05, 0x00, 0x10, 0x42, 0x42, 0x72, 0x11, 0x56, 0x81, 0x2c, 0x41, 0xca,
+  0x42, 0x83, 0x11, 0x02, 0x10, 0x28, 0x81, 0x81, 0x02, 0x26, 0x01, 0x22,
+  0x28, 0x81, 0x40, 0x11, 0x72, 0x24, 0x11, 0x02, 0x40, 0x2c, 0x42, 0x05,
+  0x16, 0x23, 0x42, 0x4c, 0x96, 0x88, 0x20, 0x31, 0x42, 0x28, 0x24, 0x80,
+  0x04, 0x24, 0x80, 0x44, 0x22, 0x28, 0x94, 0x42, 0x44, 0x62, 0xf0, 0x1e,
+  0x12, 0x20, 0x61, 0x82, 0x10, 0x42, 0x18, 0x48, 0x84, 0x43, 0x14, 0x14,
+  0xb2, 0x2a, 0xd4, 0x84, 0x12, 0x01, 0x88, 0x81, 0x9c, 0x34, 0x24, 0x00,
+  0x20, 0xd1, 0x1a, 0x01, 0x41, 0x12, 0x10, 0x41, 0x42, 0x02, 0x18, 0x18,
+  0x64, 0xc0, 0x48, 0x45, 0xc8, 0x24, 0xc0, 0x54, 0x28, 0x70, 0x52, 0x48,
+  0x02, 0x14, 0x80, 0x42, 0x08, 0x21, 0x00, 0xc0, 0x22, 0x44, 0x40, 0xf2,
+  0x13, 0x1c, 0x24, 0x50, 0x82, 0x21, 0x18, 0x90, 0x14, 0x00, 0x28, 0x84,
+  0x88, 0x24, 0x49, 0xd2, 0x28, 0x01, 0x22, 0x23, 0x01, 0x16, 0xa8, 0x21,
+  0x35, 0x14, 0xcc, 0x41, 0x29, 0x01, 0x11, 0x90, 0x28, 0x00, 0x12, 0xc0,
+  0x42, 0x8e, 0x29, 0x28, 0x48, 0x8c, 0x04, 0x12, 0x42, 0x11, 0x8c, 0x04,
+  0x28, 0x22, 0x59, 0x82, 0x82, 0x91, 0x28, 0x30, 0x34, 0x12, 0x43, 0x04,
+  0x47, 0x26, 0x24, 0x4a, 0x82, 0x08, 0x36, 0x0a, 0x14, 0x10, 0x49, 0x24,
+  0x11, 0xc2, 0x28, 0x85, 0x44, 0x21, 0x01, 0x14, 0x00, 0x18, 0x14, 0x10,
+  0x46, 0x02, 0x80, 0x32, 0x28, 0x44, 0x41, 0x10, 0x44, 0x66, 0x22, 0x81,
+  0x10, 0x04, 0x40, 0x71, 0x24, 0x62, 0x22, 0x40, 0x02, 0x00, 0x8b, 0x21,
+  0x00, 0x12, 0x18, 0x40, 0x01, 0x00, 0x30, 0x18, 0x18, 0x81, 0x10, 0x04,
+  0xff, 0xfc, 0x4a, 0xc3, 0x12, 0x10, 0x62, 0x41, 0x90, 0x1e, 0x22, 0x87,
+  0x42, 0x5c, 0x32, 0x14, 0x23, 0xd8, 0x1a, 0x54, 0x82, 0x1c, 0x01, 0xa2,
+  0x83, 0x91, 0x41, 0x16, 0x78, 0x22, 0x02, 0xd0, 0x81, 0x44, 0x14, 0x44,
+  0x84, 0xc1, 0x28, 0x50, 0x28, 0x12, 0x41, 0x18, 0x8e, 0x18, 0x14, 0x4c,
+  0x26, 0x02, 0x49, 0x21, 0x94, 0x15, 0x89, 0x94, 0x18, 0x52, 0x26, 0x92,
+  0x31, 0x1c, 0x82, 0x11, 0x01, 0x2e, 0x16, 0x40, 0x44, 0x38, 0x64, 0x28,
+  0x41, 0x86, 0x04, 0x6e, 0x26, 0x40, 0x81, 0x52, 0x38, 0x90, 0x18, 0x10,
+  0x2c, 0x01, 0x84, 0x80, 0x02, 0x84, 0x29, 0x11, 0x51, 0x22, 0x45, 0xc8,
+  0x24, 0x12, 0x54, 0x47, 0x82, 0x38, 0x15, 0x08, 0x11, 0x44, 0x45, 0xc2,
+  0x21, 0x21, 0x10, 0x22, 0x34, 0x22, 0x4c, 0x52, 0x22, 0x10, 0x8e, 0x12,
+  0x82, 0x24, 0x82, 0x32, 0x2a, 0x00, 0x12, 0x40, 0x18, 0x08, 0x18, 0x48,
+  0x18, 0x12, 0xa1, 0x2a, 0x04, 0xd0, 0x81, 0x02, 0x10, 0x81, 0x01, 0x20,
+  0x81, 0x62, 0x12, 0x00, 0x81, 0x15, 0x08, 0x21, 0x00, 0x84, 0x1c, 0x51,
+  0x84, 0x24, 0x85, 0x22, 0x81, 0x41, 0x08, 0x81, 0x12, 0xc9, 0x23, 0x02,
+  0x00, 0x12, 0x00, 0x22, 0x42, 0xc4, 0x12, 0x26, 0x02, 0x10, 0x02, 0x26,
+  0x12, 0x08, 0x00, 0x41, 0x22, 0x21, 0x10, 0x02, 0x20, 0x82, 0x01, 0x27,
+  0x13, 0x99, 0x0c, 0xf0, 0x0c, 0x28, 0x10, 0x94, 0x18, 0x41, 0x21, 0x25,
+  0x14, 0x17, 0x11, 0x04, 0x00, 0x10, 0x82, 0x01, 0x44, 0x00, 0x16, 0x12,
+  0x01, 0x81, 0x20, 0x81, 0x04, 0x91, 0x81, 0x24, 0xd4, 0x03, 0xf0, 0x27,
+  0x81, 0x18, 0x70, 0x26, 0x09, 0x20, 0x21, 0x42, 0x21, 0x02, 0x84, 0x48,
+  0x84, 0x21, 0xaf, 0x57, 0x0f, 0x44, 0x44, 0x84, 0x28, 0x40, 0x19, 0x48,
+  0x42, 0x42, 0x28, 0x11, 0x42, 0x54, 0x84, 0x84, 0x00, 0xc1, 0x40, 0x08,
+  0xc1, 0x85, 0x42, 0x02, 0x14, 0x00, 0x8c, 0x41, 0x2a, 0x04, 0x00, 0x21,
+  0x11, 0x40, 0x81, 0x02, 0x21, 0x21, 0x1c, 0x04, 0xf0, 0xff, 0xff, 0xff,
+  0xaa, 0x27, 0x81, 0x81, 0x44, 0x1a, 0x72, 0x38, 0xb4, 0x22, 0x11, 0x46,
+  0x18, 0x44, 0xf2, 0xa5, 0x1d, 0x24, 0x24, 0x83, 0x51, 0x22, 0x4c, 0x91,
+  0x32, 0x86, 0x14, 0x02, 0x41, 0x11, 0x40, 0x24, 0x11, 0x32, 0x22, 0x44,
+  0x00, 0x89, 0x51, 0x14, 0x00, 0x21, 0x43, 0x01, 0x4c, 0x01, 0x24, 0x00,
+  0xc0, 0x22, 0x00, 0x00, 0x1a, 0x82, 0x04, 0x80, 0x72, 0x48, 0x02, 0xa3,
+  0x41, 0x14, 0x04, 0x12, 0x84, 0x00, 0x83, 0x01, 0x14, 0x60, 0x23, 0x10,
+  0x62, 0x81, 0x3f, 0xfa, 0x04, 0x82, 0x00, 0x00, 0x18, 0x41, 0x8c, 0x01,
+  0x49, 0x11, 0x18, 0x38, 0x13, 0x00, 0x40, 0xa4, 0x12, 0x24, 0xa4, 0x84,
+  0x44, 0x80, 0x02, 0x22, 0x44, 0x41, 0x40, 0x04, 0xc1, 0x60, 0x41, 0x40,
+  0x04, 0x21, 0x48, 0x55, 0x08, 0x11, 0x24, 0x87, 0x14, 0x24, 0xb4, 0x84,
+  0x20, 0xa1, 0x24, 0x22, 0x22, 0x00, 0x00, 0x22, 0x28, 0xf0, 0xf7, 0x16,
+  0x00, 0x41, 0x00, 0x81, 0x41, 0x99, 0x82, 0x12, 0x01, 0x80, 0x01, 0x4c,
+  0x02, 0x81, 0x18, 0x24, 0x44, 0x22, 0x80, 0xc1, 0x14, 0x81, 0x24, 0x84,
+  0x12, 0x1a, 0x22, 0x12, 0x43, 0x02, 0x28, 0x20, 0x02, 0x28, 0x28, 0x00,
+  0x2c, 0x02, 0x84, 0x10, 0x3a, 0x44, 0x24, 0x00, 0x50, 0x22, 0x12, 0x00,
+  0x24, 0x81, 0x48, 0x24, 0x42, 0x3f, 0xdc, 0x0c, 0x20, 0x81, 0x11, 0x44,
+  0x04, 0x18, 0x44, 0x81, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x31,
+  0x45, 0x01, 0x00, 0x14, 0x44, 0x00, 0x10, 0x48, 0x48, 0x22, 0x12, 0x88,
+  0x24, 0x22, 0x02, 0x00, 0x41, 0x00, 0x12, 0x81, 0x40, 0x29, 0x01, 0x00,
+  0x80, 0x11, 0x18, 0x22, 0xf2, 0x42, 0x14, 0x24, 0x18, 0x21, 0x84, 0x25,
+  0x21, 0x12, 0x01, 0x12, 0x34, 0x36, 0x0a, 0x19, 0x21, 0x42, 0xa8, 0x21,
+  0x34, 0x81, 0x41, 0x12, 0x00, 0x00, 0x10, 0x1b, 0x03, 0x10, 0x13, 0x12,
+  0x13, 0x22, 0xc1, 0x12, 0x16, 0x02, 0x21, 0x23, 0x32, 0x42, 0x20, 0x31,
+  0x28, 0x85, 0x54, 0x24, 0x00, 0x29, 0x81, 0x01, 0x2c, 0x12, 0x08, 0x00,
+  0x22, 0x22, 0x00, 0xf0, 0x34, 0xf7, 0x50, 0x84, 0x80, 0x94, 0x18, 0x49,
+  0x11, 0x98, 0x11, 0x91, 0x18, 0x80, 0x41, 0x14, 0xc8, 0x22, 0x81, 0x00,
+  0x84, 0x40, 0x04, 0x83, 0x52, 0xa2, 0x14, 0x18, 0x44, 0x1c, 0x48, 0x41,
+  0x44, 0x09, 0x68, 0x85, 0x01, 0x40, 0x08, 0x48, 0x00, 0x00, 0x28, 0x10,
+  0x04, 0x81, 0xc0, 0x28, 0x18, 0x00, 0x2a, 0x41, 0x98, 0x1a, 0x48, 0x10,
+  0x02, 0xde, 0xde, 0x00, 0x4b, 0x18, 0x81, 0x26, 0x52, 0x48, 0x45, 0xa5,
+  0x12, 0x19, 0x43, 0x93, 0x32, 0x85, 0x3a, 0x11, 0x10, 0xb2, 0x22, 0x01,
+  0x8d, 0x18, 0x8b, 0x12, 0x27, 0x21, 0x34, 0xa7, 0x81, 0x83, 0x63, 0x41,
+  0xe5, 0x51, 0x12, 0x35, 0x95, 0x11, 0x2e, 0x14, 0x4d, 0x21, 0x25, 0x5c,
+  0x32, 0x21, 0x84, 0x16, 0x0b, 0xa0, 0x32, 0x29, 0x02, 0x44, 0x2e, 0x22,
+  0x15, 0x98, 0x22, 0x35, 0x0a, 0x85, 0x1c, 0x42, 0x48, 0x68, 0xc4, 0x8f,
+  0xa2, 0x92, 0x22, 0x2c, 0x11, 0xec, 0xa3, 0xa2, 0x11, 0x21, 0x22, 0x21,
+  0x2f, 0x35, 0x46, 0x42, 0x46, 0x62, 0x21, 0x16, 0x34, 0x32, 0x36, 0x72,
+  0x11, 0x75, 0x38, 0x5f, 0x81, 0xc7, 0x71, 0x2b, 0x11, 0x81, 0x3e, 0x16,
+  0xd4, 0x50, 0x49, 0x41, 0x55, 0x9c, 0x18, 0xa3, 0x02, 0x4d, 0x14, 0x85,
+  0x4b, 0x4a, 0xf2, 0x2c, 0x18, 0x41, 0x4f, 0x21, 0x52, 0x22, 0x85, 0x02,
+  0x90, 0x38, 0x8d, 0x14, 0x2f, 0x21, 0xd2, 0x21, 0x12, 0x32, 0x25, 0x6a,
+  0x97, 0x21, 0x23, 0x71, 0x2a, 0x62, 0x62, 0xc7, 0x44, 0x27, 0xa2, 0x17,
+  0x21, 0x85, 0xd2, 0x48, 0x11, 0x58, 0x28, 0x2b, 0x11, 0x43, 0xa3, 0x22,
+  0x28, 0x29, 0xb1, 0x22, 0xd2, 0x88, 0x32, 0x14, 0x2a, 0xf5, 0x7f, 0xe6,
+  0x14, 0x69, 0x71, 0x1a, 0xd5, 0x82, 0xd1, 0x87, 0x91, 0x34, 0x9d, 0x18,
+  0x8d, 0x28, 0x41, 0x8f, 0x41, 0x41, 0x08, 0x2d, 0x1b, 0xf5, 0x51, 0x2c,
+  0x8d, 0x2c, 0x41, 0x21, 0x12, 0x45, 0x5c, 0xc4, 0x50, 0x82, 0x49, 0xf1,
+  0x21, 0x14, 0x81, 0x12, 0x27, 0x11, 0x95, 0xf1, 0x28, 0x1c, 0x15, 0x81,
+  0xe5, 0xc6, 0x36, 0x12, 0x40, 0x78, 0x22, 0xd4, 0x28, 0x44, 0x0a, 0x87,
+  0x22, 0x80, 0x54, 0x88, 0x12, 0xc5, 0x34, 0x46, 0x1e, 0x18, 0x2f, 0x11,
+  0xc2, 0x12, 0x1b, 0x33, 0xc0, 0x18, 0x12, 0x36, 0x0a, 0xc7, 0x84, 0x6a,
+  0x54, 0x28, 0x81, 0xc7, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x50, 0x14, 0x16,
+  0x58, 0x24, 0x40, 0x03, 0x24, 0x40, 0x45, 0x48, 0x21, 0x51, 0x38, 0x50,
+  0x18, 0x10, 0x18, 0x43, 0x04, 0x10, 0x53, 0x48, 0x31, 0x44, 0x18, 0x44,
+  0x21, 0x15, 0x14, 0x52, 0x41, 0x50, 0x41, 0x50, 0xc1, 0x24, 0x15, 0x48,
+  0x52, 0x81, 0x24, 0x13, 0x01, 0x45, 0x48, 0x12, 0x04, 0x41, 0x81, 0x43,
+  0x01, 0x41, 0xf0, 0x9b, 0x38, 0x70, 0x16, 0xf6, 0x14, 0x12, 0xa5, 0xfa,
+  0x1d, 0x17, 0xaf, 0x83, 0xb2, 0x39, 0x72, 0x19, 0xf9, 0x24, 0x2c, 0xcd,
+  0x1c, 0xab, 0x32, 0x8d, 0x18, 0x97, 0x81, 0x8f, 0x81, 0x51, 0x2c, 0x8f,
+  0x81, 0x51, 0x74, 0x3f, 0x91, 0xf1, 0x2d, 0x26, 0x7d, 0x1e, 0xcf, 0xe2,
+  0x52, 0x91, 0xdf, 0x53, 0xe3, 0xc1, 0xf1, 0x2c, 0x24, 0xa5, 0xf8, 0x2c,
+  0x2c, 0x1a, 0xe1, 0x21, 0xf1, 0x22, 0x2a, 0x81, 0x6f, 0x44, 0xf4, 0x4c,
+  0x4c, 0x4f, 0xc1, 0x52, 0xa8, 0x5f, 0x53, 0xf3, 0x25, 0x25, 0x5f, 0x72,
+  0xe2, 0x62, 0x52, 0x57, 0xd5, 0xfd, 0x35, 0x37, 0xaf, 0x84, 0xf6, 0x4d,
+  0x65, 0xff, 0x94, 0x54, 0x1d, 0x4e, 0x48, 0x8d, 0x13, 0x8f, 0x91, 0x51,
+  0x48, 0x9f, 0xd5, 0xf5, 0x2c, 0x36, 0x3a, 0xf1, 0x24, 0x34, 0xcf, 0xc2,
+  0xf1, 0x24, 0x36, 0xaf, 0x83, 0xf4, 0x2c, 0x2c, 0x45, 0xfc, 0x64, 0x68,
+  0xaf, 0xb5, 0x4f, 0x72, 0x14, 0xf6, 0x54, 0x56, 0xa5, 0xfa, 0x1d, 0x57,
+  0xef, 0x83, 0xf1, 0x3d, 0x1c, 0x9f, 0x83, 0xf3, 0x39, 0x29, 0x8f, 0x11,
+  0xf1, 0x3a, 0x3a, 0x8f, 0xc1, 0x51, 0xbb, 0xaf, 0xc1, 0x53, 0x8e, 0xaf,
+  0x81, 0x51, 0xb8, 0xbf, 0x91, 0xf1, 0x3d, 0x3a, 0xbd, 0x1e, 0x7f, 0xd2,
+  0x52, 0x9b, 0xff, 0xd2, 0xf3, 0x1c, 0x18, 0xcf, 0xc2, 0x53, 0xab, 0x9f,
+  0x8a, 0xfa, 0x11, 0x11, 0x4f, 0x61, 0x59, 0xad, 0xc5, 0xfc, 0x47, 0x46,
+  0x9f, 0x96, 0xf6, 0x18, 0x38, 0xcd, 0x1f, 0x4f, 0xc3, 0x13, 0xf2, 0x23,
+  0x63, 0x1d, 0x27, 0x6d, 0x24, 0x8f, 0x82, 0xf2, 0x31, 0x33, 0xbf, 0x14,
+  0xf6, 0x4e, 0x6c, 0xef, 0x64, 0x54, 0xfd, 0xff, 0x94, 0x74, 0x1a, 0xf9,
+  0x1e, 0x39, 0x9f, 0xd1, 0xf1, 0x58, 0x54, 0xef, 0xc3, 0xf3, 0x36, 0x34,
+  0x3a, 0xe3, 0x83, 0xf3, 0x34, 0x3e, 0xef, 0x43, 0xf7, 0x22, 0x28, 0x2e,
+  0x28, 0x4f, 0xc6, 0xf7, 0xf1, 0x38, 0x70, 0x16, 0xe4, 0x61, 0x74, 0x1e,
+  0xfc, 0x1d, 0x1f, 0x58, 0x09, 0xf0, 0x52, 0x24, 0x8f, 0x91, 0xf2, 0x35,
+  0x2c, 0xdf, 0xc1, 0xf1, 0x36, 0x3c, 0xad, 0x1e, 0x9f, 0xa1, 0xf1, 0x18,
+  0x39, 0xa5, 0xf2, 0x1a, 0x18, 0xd5, 0xfe, 0x1a, 0x19, 0xcf, 0xf3, 0xd3,
+  0x4e, 0xf1, 0x2d, 0x2d, 0xc5, 0xfc, 0x3e, 0x3c, 0x9f, 0xd1, 0xf1, 0x2d,
+  0x3f, 0x65, 0xfd, 0x2c, 0xad, 0x1a, 0xf1, 0x11, 0x15, 0xad, 0x2f, 0xd5,
+  0xff, 0x42, 0x41, 0x8f, 0x94, 0xf4, 0x18, 0x38, 0xcd, 0x1e, 0x2f, 0x83,
+  0xc3, 0x22, 0x2c, 0xf6, 0x25, 0x23, 0x25, 0x54, 0x88, 0x1a, 0x53, 0xff,
+  0x2e, 0x28, 0xef, 0x84, 0x54, 0xc6, 0xbf, 0xd4, 0xf4, 0x1a, 0x1a, 0xbd,
+  0x38, 0x8f, 0x81, 0xf1, 0x5d, 0x59, 0x2f, 0xa3, 0x83, 0x00, 0xf0, 0x8f,
+  0xa3, 0x33, 0x8f, 0x83, 0xf3, 0x3e, 0x7c, 0xaf, 0x86, 0xf6, 0x28, 0x28,
+  0xcf, 0x86, 0xf7, 0xde, 0xdf, 0x24, 0x47, 0x61, 0x6f, 0x61, 0xf5, 0x1e,
+  0x1e, 0xff, 0xf5, 0xf1, 0x3e, 0x38, 0xdf, 0xc3, 0xf2, 0x3d, 0x3c, 0xdf,
+  0xd3, 0xe2, 0x91, 0xf1, 0x3e, 0x3e, 0x2f, 0x81, 0x51, 0xbb, 0xef, 0x91,
+  0x51, 0x8a, 0xaf, 0x81, 0x51, 0xed, 0x6f, 0xd1, 0xf1, 0x3c, 0x37, 0xed,
+  0x1e, 0xef, 0x42, 0x52, 0xd7, 0xcf, 0x43, 0xf3, 0x11, 0x1d, 0xdf, 0x72,
+  0x52, 0xf7, 0xdf, 0xd2, 0xfa, 0x15, 0x15, 0x57, 0x59, 0x55, 0x5b, 0x39,
+  0x7f, 0x74, 0xf4, 0x2c, 0x2d, 0x8f, 0x81, 0xd3, 0xa9, 0xf1, 0x36, 0x34,
+  0x7d, 0x27, 0x3f, 0x32, 0x72, 0x24, 0x72, 0x22, 0xf4, 0x2d, 0x2d, 0x1f,
+  0x33, 0x53, 0xe6, 0xaf, 0x82, 0xf2, 0x47, 0x4b, 0xd5, 0xff, 0x42, 0x4c,
+  0xab, 0x11, 0xb7, 0x81, 0x9f, 0x91, 0xf1, 0x54, 0x58, 0xef, 0xc3, 0xb3,
+  0x32, 0xa3, 0x33, 0xcf, 0xc3, 0xf3, 0x2c, 0x3e, 0xaf, 0x83, 0xf6, 0x68,
+  0x68, 0xcf, 0xc2, 0xf2, 0x6c, 0x6c, 0x3f, 0x3f, 0x0e, 0x49, 0x01, 0x41,
+  0x84, 0x41, 0x20, 0x0a, 0xf0, 0x06, 0x40, 0x48, 0x14, 0x01, 0x84, 0x85,
+  0x04, 0x85, 0x14, 0x51, 0x48, 0x50, 0x48, 0x00, 0x18, 0x85, 0x04, 0x00,
+  0x80, 0x01, 0x00, 0xb7, 0x0e, 0xf0, 0x5c, 0x08, 0x84, 0x60, 0x81, 0x14,
+  0x40, 0x41, 0x88, 0x02, 0x28, 0x12, 0x89, 0x02, 0x89, 0x02, 0x7f, 0x8a,
+  0x02, 0x82, 0x12, 0xa5, 0x22, 0x01, 0x8c, 0xf2, 0x28, 0x11, 0x12, 0x34,
+  0x90, 0x18, 0x12, 0xa5, 0x01, 0x21, 0x84, 0x14, 0x11, 0x18, 0x11, 0x21,
+  0x12, 0x14, 0x40, 0x51, 0x83, 0x50, 0x21, 0x50, 0x21, 0xa0, 0x42, 0x40,
+  0x0a, 0x34, 0x28, 0x14, 0x40, 0x83, 0x42, 0x81, 0x52, 0x16, 0x50, 0x32,
+  0x11, 0x81, 0x13, 0x41, 0x02, 0x18, 0xc0, 0x12, 0x20, 0x04, 0x40, 0xc1,
+  0xf1, 0xd0, 0x32, 0xf4, 0x11, 0x24, 0x87, 0x32, 0x1f, 0x41, 0x72, 0x48,
+  0xf2, 0x11, 0x24, 0xe7, 0x34, 0x1f, 0xc1, 0xf2, 0x4e, 0x13, 0x1d, 0x2c,
+  0xaf, 0x34, 0x99, 0x21, 0xaf, 0x34, 0x34, 0x0a, 0xf2, 0xce, 0x43, 0xf2,
+  0x4a, 0x95, 0x47, 0x83, 0xaf, 0x34, 0x79, 0x34, 0xd8, 0x1a, 0xf9, 0x24,
+  0x48, 0x8d, 0x91, 0x4f, 0xa2, 0xc4, 0x81, 0x6f, 0xa2, 0x74, 0x18, 0xf5,
+  0x26, 0x4a, 0x87, 0x19, 0x6f, 0xa2, 0x65, 0x59, 0x6d, 0x5a, 0x9e, 0x24,
+  0x6d, 0x5a, 0x1f, 0x49, 0xd2, 0x26, 0xf4, 0x91, 0x24, 0xed, 0x12, 0x1f,
+  0xc9, 0xb2, 0x4c, 0xf1, 0x91, 0x24, 0xe7, 0x24, 0x1f, 0xc9, 0xf2, 0x6a,
+  0x12, 0x1f, 0xc1, 0xf2, 0x4a, 0x92, 0x1f, 0x81, 0xf2, 0x4a, 0x92, 0x51,
+  0xaf, 0x64, 0x79, 0x24, 0xf8, 0x4a, 0x96, 0x47, 0x82, 0x2f, 0x44, 0x79,
+  0x34, 0xd8, 0x42, 0xf9, 0x34, 0x48, 0x4c, 0xf9, 0x24, 0x4a, 0xae, 0x5a,
+  0xc0, 0x4a, 0x1f, 0x41, 0xd6, 0x28, 0x64, 0x41, 0x83, 0xe4, 0x41, 0x32,
+  0x48, 0x8c, 0x32, 0x4a, 0x15, 0xf8, 0x48, 0x94, 0x28, 0xaf, 0x44, 0x1b,
+  0xb4, 0x48, 0x6b, 0x82, 0xaf, 0x14, 0x59, 0x84, 0x8f, 0x14, 0x58, 0x84,
+  0xad, 0x91, 0x6d, 0x48, 0x8d, 0x91, 0x6d, 0x52, 0x88, 0x8c, 0xfd, 0x18,
+  0x81, 0x4f, 0x22, 0x34, 0x98, 0x2a, 0x34, 0x98, 0x3c, 0xa4, 0x28, 0x9c,
+  0x74, 0x91, 0xc8, 0x4a, 0x1b, 0x69, 0x81, 0x1f, 0x89, 0x36, 0x48, 0x1f,
+  0x88, 0x12, 0xf2, 0x91, 0x28, 0x83, 0xf4, 0x11, 0x2c, 0xaf, 0x44, 0xf8,
+  0x11, 0x28, 0xaf, 0x44, 0x3b, 0x11, 0x4a, 0x6b, 0x82, 0x4a, 0x69, 0x82,
+  0xab, 0x94, 0x36, 0x98, 0x92, 0x2f, 0x83, 0x84, 0xf9, 0x22, 0x1a, 0x4f,
+  0xcc, 0x0c, 0x00, 0x48, 0x18, 0x00, 0x00, 0x28, 0x00, 0x44, 0x00, 0x80,
+  0x02, 0x40, 0x01, 0x42, 0x0a, 0x50, 0x40, 0x01, 0x00, 0x80, 0x04, 0x70,
+  0x06, 0x12, 0x44, 0x55, 0x0a, 0xf0, 0xff, 0xd4, 0x2f, 0x76, 0x0e, 0x22,
+  0x1c, 0x02, 0x60, 0x82, 0x14, 0x84, 0x14, 0x13, 0x03, 0x18, 0x82, 0x10,
+  0x12, 0x81, 0x08, 0xa0, 0x12, 0x96, 0x94, 0x24, 0xc0, 0x21, 0x48, 0x28,
+  0x1c, 0x84, 0x22, 0x84, 0x62, 0x22, 0xe0, 0x22, 0x01, 0x80, 0x25, 0x04,
+  0x18, 0x12, 0xa5, 0x04, 0x10, 0x42, 0x18, 0x08, 0x83, 0x08, 0x14, 0x48,
+  0x42, 0xc0, 0x42, 0x44, 0x84, 0x42, 0x28, 0x12, 0x48, 0x1d, 0x53, 0x20,
+  0xa1, 0x18, 0x37, 0x83, 0x1d, 0x12, 0x80, 0x01, 0x12, 0xa4, 0x45, 0x51,
+  0x81, 0x46, 0x51, 0x82, 0x3c, 0x41, 0x48, 0x52, 0xa4, 0x24, 0x91, 0x85,
+  0x12, 0x11, 0xa8, 0x41, 0x85, 0x26, 0xc4, 0x22, 0x19, 0x51, 0x48, 0x33,
+  0x14, 0x38, 0x25, 0x83, 0x38, 0x24, 0x89, 0x72, 0x24, 0x41, 0xb1, 0x22,
+  0x41, 0x3a, 0x24, 0x70, 0x64, 0xf3, 0x11, 0x28, 0x43, 0x22, 0xb9, 0x21,
+  0x64, 0x81, 0x32, 0x16, 0xc8, 0x46, 0x94, 0x1e, 0x26, 0x8c, 0x68, 0x41,
+  0x12, 0x1e, 0x64, 0x60, 0x45, 0x45, 0x41, 0xbc, 0xcd, 0x06, 0x12, 0x1b,
+  0x34, 0x16, 0x89, 0x51, 0x82, 0x18, 0x60, 0x11, 0x8c, 0x53, 0x16, 0x55,
+  0xe8, 0x18, 0x64, 0xc2, 0x17, 0x21, 0x15, 0xc8, 0x82, 0x84, 0x25, 0x92,
+  0x38, 0x8e, 0x1a, 0x64, 0x81, 0x1b, 0x41, 0x87, 0x65, 0x60, 0x38, 0x13,
+  0x51, 0x48, 0x31, 0x85, 0x12, 0x95, 0xa9, 0x63, 0x92, 0x28, 0x8f, 0x16,
+  0x21, 0x34, 0x42, 0x84, 0x67, 0x21, 0x70, 0x24, 0xd1, 0x83, 0x32, 0x26,
+  0x16, 0x28, 0x76, 0x14, 0xa8, 0x1a, 0x26, 0x48, 0x47, 0xe8, 0x64, 0x62,
+  0x88, 0x64, 0x4c, 0xd1, 0x48, 0x42, 0xc2, 0x44, 0x16, 0x64, 0xc5, 0xff,
+  0x97, 0x02, 0x22, 0x30, 0x22, 0x11, 0x22, 0x11, 0x81, 0x40, 0x01, 0x18,
+  0x50, 0x22, 0x00, 0x40, 0x04, 0x14, 0x41, 0x1c, 0x02, 0x28, 0xa0, 0x24,
+  0x2a, 0x84, 0x82, 0xa4, 0x24, 0x22, 0x28, 0x18, 0x00, 0x44, 0x14, 0x1a,
+  0x82, 0x81, 0x12, 0x8c, 0x84, 0x01, 0x88, 0x15, 0x08, 0x84, 0x18, 0x48,
+  0x46, 0x21, 0x01, 0x1a, 0x04, 0x1a, 0x24, 0x24, 0x03, 0xb0, 0xa3, 0x0f,
+  0x00, 0x14, 0x50, 0x12, 0x10, 0x0e, 0x10, 0x41, 0x23, 0x01, 0x40, 0x02,
+  0x6c, 0x11, 0x81, 0x01, 0x00, 0x50, 0x84, 0x00, 0x10, 0xc2, 0x21, 0x22,
+  0x12, 0x41, 0x10, 0x14, 0x51, 0x16, 0x11, 0x14, 0x40, 0x53, 0x41, 0x10,
+  0x21, 0x12, 0x91, 0x12, 0x00, 0x10, 0xc2, 0x48, 0x00, 0x00, 0x00, 0x20,
+  0xf2, 0x51, 0xe9, 0x14, 0x50, 0x61, 0x89, 0x48, 0x01, 0x14, 0x12, 0x3d,
+  0x12, 0x1a, 0x62, 0x82, 0x40, 0x13, 0x88, 0x51, 0x82, 0x24, 0x00, 0x11,
+  0x25, 0x11, 0x41, 0x14, 0x41, 0x01, 0x54, 0x31, 0x12, 0x30, 0x14, 0x42,
+  0x29, 0x21, 0x02, 0x00, 0x12, 0x4c, 0x11, 0xd3, 0x82, 0x04, 0x5d, 0x12,
+  0x40, 0x78, 0x44, 0x18, 0x41, 0x03, 0x25, 0x11, 0x04, 0x61, 0x25, 0x56,
+  0x24, 0x20, 0x44, 0x84, 0x04, 0x6f, 0x11, 0x03, 0x10, 0x11, 0x41, 0x03,
+  0x70, 0x12, 0x94, 0x11, 0x80, 0x12, 0x11, 0x11, 0x28, 0x01, 0x24, 0x49,
+  0x51, 0x12, 0x14, 0x25, 0x41, 0x01, 0x00, 0x00, 0x24, 0x12, 0x22, 0x38,
+  0x10, 0x04, 0x44, 0x14, 0x11, 0x18, 0x51, 0x31, 0x31, 0x50, 0x41, 0x80,
+  0x62, 0x74, 0x11, 0x00, 0x21, 0x61, 0x48, 0x10, 0x04, 0x80, 0x14, 0x04,
+  0xf0, 0xb7, 0xa3, 0x14, 0x50, 0x24, 0x89, 0x08, 0x14, 0x11, 0x81, 0x21,
+  0x29, 0x53, 0x81, 0x90, 0x12, 0x21, 0x24, 0x84, 0x21, 0x00, 0xdb, 0x00,
+  0xf0, 0xb1, 0x55, 0x08, 0x45, 0x51, 0x12, 0x40, 0x41, 0x84, 0x35, 0x12,
+  0x22, 0x00, 0x25, 0x14, 0x81, 0x01, 0x8d, 0x42, 0x51, 0x18, 0x31, 0x81,
+  0x84, 0x18, 0x11, 0x21, 0x14, 0x50, 0x28, 0x44, 0x21, 0x25, 0x14, 0x02,
+  0x20, 0x24, 0xf2, 0x42, 0xf5, 0x40, 0x24, 0x02, 0x80, 0x21, 0x03, 0x00,
+  0x00, 0x13, 0x82, 0x12, 0x81, 0x41, 0xa1, 0x12, 0x25, 0x11, 0x08, 0xa0,
+  0x21, 0x11, 0x29, 0x01, 0x20, 0x14, 0x18, 0x02, 0x41, 0x4a, 0x12, 0x44,
+  0x12, 0x21, 0x81, 0x04, 0x16, 0x88, 0x44, 0x01, 0x14, 0x42, 0x80, 0x42,
+  0x01, 0x00, 0x43, 0x51, 0x84, 0x15, 0x14, 0x01, 0x24, 0x82, 0x00, 0x47,
+  0xb7, 0x00, 0x84, 0x22, 0x28, 0x40, 0x64, 0x42, 0x8d, 0x21, 0x44, 0x25,
+  0x5c, 0x21, 0x18, 0x6b, 0x21, 0x10, 0x82, 0x01, 0x00, 0x20, 0x61, 0x18,
+  0xd0, 0x82, 0x03, 0x14, 0x23, 0x21, 0x12, 0x01, 0x00, 0x40, 0x01, 0xd0,
+  0x82, 0x64, 0x31, 0x00, 0x80, 0x02, 0x11, 0x24, 0x41, 0x10, 0xd2, 0x41,
+  0x13, 0x04, 0x40, 0x18, 0x02, 0x2d, 0x42, 0x40, 0x44, 0xf2, 0x8a, 0x92,
+  0x00, 0x00, 0x31, 0x28, 0x00, 0x50, 0x12, 0x80, 0x01, 0x00, 0x10, 0x58,
+  0x82, 0x00, 0x23, 0x11, 0x02, 0x44, 0x1c, 0x44, 0x04, 0x45, 0xc1, 0x44,
+  0x41, 0x00, 0x80, 0x81, 0x02, 0x19, 0x44, 0x04, 0x00, 0x29, 0x01, 0x88,
+  0x20, 0x04, 0x24, 0x04, 0xf0, 0x73, 0x11, 0x01, 0x00, 0x58, 0x44, 0x7e,
+  0xc4, 0x10, 0x04, 0x28, 0x31, 0x12, 0x49, 0xc2, 0x24, 0x22, 0x15, 0x54,
+  0xc2, 0x12, 0x2d, 0x13, 0x40, 0x21, 0x11, 0xa8, 0x12, 0x21, 0xa4, 0x18,
+  0x12, 0x1b, 0xa1, 0x15, 0x04, 0x00, 0x2f, 0x44, 0xc1, 0x68, 0x31, 0x00,
+  0x4a, 0x82, 0xc1, 0x22, 0x14, 0x11, 0x21, 0x12, 0x23, 0x01, 0x2d, 0x11,
+  0x00, 0x00, 0x28, 0x11, 0x21, 0xcd, 0x11, 0x41, 0x4c, 0x41, 0x44, 0x0e,
+  0x90, 0x42, 0x88, 0x48, 0x64, 0x8e, 0xd8, 0x20, 0x88, 0x02, 0x28, 0x22,
+  0x12, 0x50, 0x81, 0x21, 0x40, 0x81, 0x82, 0x01, 0x21, 0x13, 0x11, 0x1a,
+  0x01, 0x10, 0x02, 0xf0, 0x21, 0x48, 0x44, 0x11, 0x14, 0x41, 0x44, 0x40,
+  0x04, 0x44, 0x00, 0x58, 0x44, 0x14, 0x84, 0x42, 0x20, 0x32, 0x81, 0x46,
+  0x81, 0x14, 0x02, 0x00, 0x00, 0x81, 0x00, 0x00, 0xc0, 0x14, 0x14, 0x1b,
+  0xb5, 0x00, 0x00, 0x21, 0x3b, 0x09, 0xf0, 0xa7, 0x40, 0x23, 0x41, 0x41,
+  0x22, 0x01, 0x22, 0x00, 0x00, 0x40, 0x02, 0x30, 0x42, 0x22, 0x30, 0x22,
+  0x22, 0x12, 0x00, 0x00, 0x00, 0x80, 0x41, 0x02, 0x2c, 0x01, 0x00, 0x25,
+  0x04, 0x22, 0x50, 0x34, 0x00, 0x00, 0x10, 0x04, 0x44, 0x64, 0xaf, 0x4d,
+  0x07, 0x10, 0x18, 0x85, 0x82, 0x82, 0x12, 0x03, 0x11, 0x49, 0x32, 0x22,
+  0x90, 0x16, 0x00, 0x26, 0x04, 0x26, 0x14, 0x0a, 0x21, 0x2a, 0xb4, 0x18,
+  0x54, 0x34, 0x68, 0x44, 0x81, 0x43, 0x12, 0x81, 0x04, 0x62, 0x00, 0xa0,
+  0x12, 0x19, 0x01, 0x42, 0x26, 0x01, 0x20, 0x25, 0x04, 0x30, 0x52, 0x42,
+  0x42, 0x42, 0x12, 0x49, 0x04, 0x83, 0x04, 0x24, 0x10, 0x08, 0xcf, 0x49,
+  0x08, 0x82, 0x11, 0x10, 0x01, 0x14, 0x40, 0x41, 0x11, 0x01, 0x11, 0x00,
+  0x24, 0x34, 0x10, 0x01, 0x14, 0x48, 0xc0, 0x42, 0x48, 0x19, 0x44, 0x11,
+  0x02, 0x48, 0x25, 0x14, 0x12, 0x04, 0x80, 0x91, 0x11, 0x29, 0x14, 0x01,
+  0x44, 0x12, 0x11, 0x46, 0x11, 0x31, 0x41, 0x42, 0x13, 0x14, 0x26, 0x14,
+  0x23, 0x04, 0x00, 0x42, 0x00, 0x40, 0xf1, 0x63, 0xba, 0x20, 0x02, 0x19,
+  0x41, 0x08, 0x00, 0x10, 0x42, 0x18, 0xa4, 0x12, 0x50, 0x81, 0x4c, 0x02,
+  0x00, 0x26, 0x95, 0x24, 0x1c, 0x01, 0x21, 0x26, 0xc1, 0x32, 0x96, 0x02,
+  0xf0, 0x31, 0x41, 0x02, 0x42, 0x10, 0x42, 0xa9, 0x41, 0x30, 0x52, 0x10,
+  0x42, 0x08, 0x21, 0x40, 0x08, 0x90, 0x22, 0x10, 0x04, 0x41, 0x90, 0x22,
+  0xf0, 0x87, 0x3b, 0x00, 0x14, 0x28, 0x00, 0x22, 0x11, 0x14, 0x26, 0x02,
+  0x2a, 0x11, 0x02, 0x00, 0x80, 0x23, 0x02, 0x12, 0x00, 0x22, 0x10, 0x21,
+  0x01, 0x22, 0x38, 0x42, 0x00, 0x21, 0x51, 0x00, 0x40, 0x14, 0x02, 0x00,
+  0x41, 0x42, 0x00, 0x10, 0x02, 0x46, 0x8c, 0x0e, 0xf0, 0x75, 0x24, 0xf0,
+  0x9d, 0x26, 0x40, 0x02, 0x00, 0x28, 0x21, 0x38, 0x00, 0x40, 0x01, 0x14,
+  0x28, 0x80, 0x12, 0x42, 0x08, 0x25, 0x22, 0x11, 0x12, 0x02, 0x4c, 0x01,
+  0x14, 0x24, 0x44, 0x00, 0x18, 0x00, 0x40, 0x06, 0x20, 0x14, 0x11, 0x52,
+  0x24, 0x00, 0x10, 0x01, 0x28, 0x40, 0x42, 0x12, 0x44, 0x18, 0x02, 0x21,
+  0x40, 0x04, 0x57, 0x74, 0x40, 0x24, 0x02, 0x22, 0x43, 0x01, 0x30, 0x24,
+  0x41, 0x44, 0x20, 0x02, 0x00, 0x85, 0x14, 0x04, 0x10, 0x54, 0x81, 0x38,
+  0x21, 0xc0, 0x18, 0x49, 0xc2, 0x24, 0x10, 0x88, 0x92, 0x28, 0x50, 0x18,
+  0x68, 0x00, 0x80, 0x12, 0x01, 0x30, 0x22, 0x14, 0x22, 0x18, 0x60, 0x42,
+  0x80, 0x01, 0x81, 0x20, 0x01, 0x12, 0x84, 0x42, 0x23, 0x81, 0xf4, 0x66,
+  0xa2, 0x00, 0x82, 0x00, 0x50, 0x21, 0x00, 0x18, 0x2c, 0x02, 0x24, 0x00,
+  0x22, 0x10, 0x11, 0x91, 0x21, 0x21, 0x90, 0x54, 0x80, 0x12, 0x5c, 0x02,
+  0x80, 0x11, 0x04, 0x44, 0x84, 0x44, 0xa4, 0x14, 0x10, 0x94, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xb9, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0x14, 0x29,
+  0xd1, 0xc1, 0x09, 0x8a, 0x01, 0x2a, 0x04, 0x40, 0x08, 0x84, 0x41, 0x14,
+  0x50, 0xc1, 0x38, 0x28, 0x24, 0x14, 0x44, 0x20, 0x61, 0x11, 0x48, 0x90,
+  0x33, 0x4b, 0x41, 0x18, 0x1c, 0xc4, 0x94, 0x42, 0x2c, 0x44, 0x14, 0x21,
+  0x41, 0x01, 0x13, 0x11, 0x11, 0xc1, 0x44, 0x18, 0x12, 0x17, 0x81, 0x13,
+  0x44, 0x18, 0x33, 0x41, 0x13, 0x54, 0xc1, 0x42, 0x11, 0x20, 0x04, 0xf0,
+  0x44, 0x21, 0x80, 0x02, 0x21, 0x30, 0x76, 0x14, 0x38, 0x8a, 0xf2, 0x31,
+  0x21, 0x29, 0xe2, 0x41, 0x72, 0x22, 0xd1, 0x11, 0x52, 0x11, 0x2e, 0x15,
+  0x24, 0x19, 0xf1, 0x31, 0x3b, 0x1b, 0x11, 0x81, 0x70, 0x28, 0x83, 0x62,
+  0x52, 0x9b, 0x22, 0x47, 0x11, 0x2b, 0x41, 0x6a, 0xa1, 0x66, 0x4b, 0x22,
+  0x4f, 0x36, 0x44, 0xf1, 0x26, 0x21, 0xd0, 0x84, 0xb6, 0x46, 0x66, 0x12,
+  0x47, 0x26, 0x00, 0x99, 0x31, 0x41, 0x14, 0x15, 0xc2, 0x11, 0x1e, 0x14,
+  0x1a, 0xb1, 0x11, 0xf3, 0x52, 0x44, 0x19, 0x74, 0x41, 0x42, 0xf6, 0x42,
+  0x49, 0x22, 0x8f, 0x24, 0xd4, 0x11, 0x34, 0x4a, 0x45, 0x84, 0x91, 0x4a,
+  0x13, 0x54, 0x42, 0x50, 0x14, 0x4c, 0xf4, 0x3d, 0x31, 0x40, 0x22, 0x08,
+  0x14, 0x26, 0x12, 0x11, 0x42, 0x4c, 0x72, 0x2f, 0x71, 0x22, 0x07, 0x25,
+  0x45, 0xa1, 0x22, 0x49, 0xd2, 0x54, 0x41, 0xc2, 0x13, 0x64, 0x1d, 0x1b,
+  0x43, 0x51, 0x28, 0x17, 0x31, 0x28, 0x25, 0x04, 0x28, 0x13, 0x01, 0x27,
+  0x81, 0x44, 0x18, 0x4c, 0x06, 0x4f, 0x42, 0x51, 0xa2, 0x61, 0x11, 0x1d,
+  0x42, 0x31, 0x25, 0x46, 0xa8, 0x24, 0x8d, 0x11, 0x1c, 0x24, 0x91, 0x46,
+  0x40, 0x42, 0x02, 0x10, 0x85, 0xc1, 0x28, 0x48, 0x87, 0x12, 0x12, 0x2f,
+  0xd5, 0x0a, 0x44, 0x15, 0x19, 0x34, 0x28, 0xc0, 0x2a, 0x12, 0x2c, 0x92,
+  0x25, 0x4c, 0x82, 0x12, 0x22, 0x42, 0x72, 0x14, 0x52, 0x43, 0x23, 0x92,
+  0x29, 0x41, 0x39, 0x23, 0x84, 0xe6, 0x11, 0xf1, 0x42, 0x44, 0x35, 0xb8,
+  0x75, 0x75, 0x18, 0xe4, 0x62, 0x74, 0x62, 0x62, 0x42, 0x18, 0x1a, 0x41,
+  0x18, 0x35, 0x12, 0x16, 0x93, 0x51, 0x5c, 0xb2, 0x58, 0x74, 0x24, 0x41,
+  0xea, 0x14, 0x54, 0x31, 0x25, 0x81, 0x34, 0x41, 0x1d, 0x22, 0x4a, 0x92,
+  0x11, 0x47, 0x44, 0x1a, 0xb4, 0x22, 0x14, 0xe8, 0x44, 0x82, 0x14, 0x14,
+  0xc2, 0x16, 0x21, 0x2e, 0x2c, 0x60, 0x41, 0x26, 0x61, 0x41, 0x81, 0x16,
+  0x54, 0x38, 0x44, 0x87, 0x12, 0x50, 0x38, 0x50, 0x38, 0x12, 0x81, 0x50,
+  0x28, 0x11, 0x81, 0x84, 0x24, 0x84, 0x40, 0x08, 0x25, 0x88, 0x52, 0x81,
+  0x50, 0x82, 0x44, 0x8c, 0xc1, 0x24, 0x84, 0x4c, 0xc2, 0x11, 0x4c, 0x12,
+  0xc2, 0x24, 0x81, 0x4c, 0xd2, 0x38, 0xc1, 0x24, 0x8d, 0x12, 0x28, 0x89,
+  0x81, 0xd2, 0x28, 0x01, 0x8d, 0x11, 0x41, 0x8d, 0x12, 0x43, 0x82, 0x71,
+  0x25, 0xc8, 0x11, 0x47, 0x82, 0x18, 0x26, 0x08, 0xdf, 0x5d, 0x08, 0x2e,
+  0x32, 0x7f, 0x41, 0xf1, 0x2d, 0x28, 0xcf, 0x83, 0xf3, 0x18, 0xb8, 0xed,
+  0x25, 0x4f, 0xc3, 0xf3, 0x21, 0x28, 0xcf, 0xc1, 0xf1, 0x25, 0x26, 0x1f,
+  0x81, 0xf1, 0x11, 0x3a, 0x8f, 0x81, 0x01, 0xc5, 0xfc, 0x2c, 0x2e, 0xef,
+  0xc1, 0xf1, 0x24, 0x25, 0x5f, 0xd3, 0xf3, 0x1e, 0x1c, 0xbd, 0x59, 0xcf,
+  0xc6, 0xf6, 0x21, 0x29, 0xcf, 0xd6, 0xf6, 0x29, 0x2b, 0xcf, 0xc6, 0xf6,
+  0x34, 0x38, 0x8f, 0xa6, 0xf6, 0x18, 0x58, 0xcf, 0x84, 0x54, 0x55, 0x8d,
+  0x2e, 0xef, 0x82, 0xf2, 0x6c, 0x68, 0x4b, 0x22, 0x4c, 0xb2, 0x26, 0xf2,
+  0x2c, 0x2a, 0xff, 0xd3, 0xf3, 0x19, 0x3e, 0xcf, 0x23, 0xf3, 0x76, 0x7c,
+  0x3f, 0x92, 0xf3, 0x58, 0x58, 0x1f, 0x17, 0xf3, 0x71, 0x78, 0x3d, 0x19,
+  0xbf, 0x95, 0xe5, 0x41, 0xf1, 0x5c, 0x58, 0xef, 0xc6, 0xf3, 0x32, 0x34,
+  0x8f, 0xe3, 0xb3, 0x7e, 0xf5, 0x4c, 0x26, 0x2f, 0x41, 0xf3, 0x78, 0x78,
+  0x85, 0xb4, 0x48, 0xf6, 0x5c, 0x8c, 0xd0, 0x64, 0xf1, 0x56, 0x5d, 0x5f,
+  0x13, 0xb3, 0x24, 0xd6, 0xcc, 0xf2, 0x3f, 0x36, 0x5f, 0xc2, 0xf2, 0x21,
+  0x28, 0xcf, 0xd1, 0xf3, 0x2f, 0x2e, 0x4f, 0x83, 0xf1, 0x12, 0x1b, 0x8d,
+  0x3d, 0xc5, 0x0c, 0x6f, 0x42, 0xf2, 0x3d, 0x1c, 0xdf, 0xc2, 0xf2, 0x35,
+  0x3f, 0xef, 0xc1, 0xd1, 0x12, 0xf5, 0x66, 0x74, 0x1f, 0x92, 0xf6, 0x4d,
+  0x7d, 0x6f, 0x72, 0xf6, 0xc4, 0xe4, 0x5f, 0xc1, 0xf1, 0x6c, 0xec, 0x4f,
+  0x63, 0xf5, 0x62, 0x64, 0x9d, 0x1d, 0xdd, 0x2b, 0x6f, 0x42, 0xe2, 0x54,
+  0x54, 0x5c, 0x4b, 0x21, 0x6f, 0xe2, 0x56, 0x61, 0x3f, 0x51, 0xd1, 0x9d,
+  0xf3, 0x3c, 0x27, 0x2f, 0xa5, 0xf5, 0x47, 0x1e, 0xaf, 0x87, 0xf7, 0x69,
+  0x28, 0x5f, 0xb6, 0xf6, 0x43, 0x1b, 0xdf, 0xd7, 0x75, 0x4c, 0xfc, 0x61,
+  0x44, 0x4f, 0x24, 0xf1, 0x1c, 0x18, 0x4f, 0x62, 0xf2, 0x6a, 0x45, 0xcf,
+  0x25, 0xf3, 0x1e, 0x38, 0xaf, 0xc7, 0xf7, 0x2c, 0x21, 0x8b, 0x65, 0xdf,
+  0xfa, 0x4b, 0x72, 0x16, 0xb6, 0x23, 0xf6, 0x11, 0x36, 0x2f, 0x22, 0xf2,
+  0x2e, 0x24, 0x2f, 0x92, 0xb2, 0x12, 0xf1, 0x2d, 0x25, 0x4f, 0x43, 0xf3,
+  0x2d, 0x2e, 0x3f, 0x41, 0xf3, 0x19, 0x12, 0x2b, 0x31, 0x85, 0x58, 0x44,
+  0x5f, 0x72, 0xf2, 0x37, 0x35, 0x9f, 0x92, 0xf2, 0x18, 0x31, 0x6d, 0x1c,
+  0x7d, 0x55, 0x6f, 0x46, 0xf4, 0x69, 0x61, 0x5f, 0xe6, 0xf7, 0x65, 0x67,
+  0x5f, 0x56, 0xfc, 0x1d, 0x15, 0x4f, 0xe6, 0xf6, 0x34, 0x74, 0x6e, 0x64,
+  0x95, 0x7d, 0x24, 0x93, 0x22, 0x4e, 0x44, 0x15, 0x79, 0x35, 0xd3, 0x13,
+  0x56, 0x71, 0x3f, 0x51, 0xf1, 0x3d, 0x13, 0x1f, 0x91, 0xf3, 0x53, 0x51,
+  0xff, 0x55, 0xa4, 0x76, 0x97, 0x94, 0x4e, 0x45, 0xbf, 0x17, 0xb6, 0x42,
+  0xf7, 0x49, 0x49, 0x1f, 0x54, 0x34, 0x56, 0x69, 0x71, 0x28, 0xfa, 0x42,
+  0x6c, 0x5f, 0x25, 0x71, 0x2e, 0xb8, 0x42, 0xe4, 0xc3, 0xf3, 0x44, 0x54,
+  0x2f, 0xdf, 0x4c, 0xf2, 0x32, 0x22, 0xef, 0x43, 0x57, 0x61, 0xa7, 0xa4,
+  0xab, 0x3b, 0x7f, 0xf3, 0x53, 0x13, 0xd5, 0xf5, 0x3c, 0x3d, 0x3f, 0x72,
+  0xf2, 0x12, 0x15, 0xbf, 0x31, 0xf3, 0x1f, 0x19, 0x45, 0x04, 0xef, 0xb2,
+  0xf2, 0x3f, 0x3d, 0x5f, 0x52, 0xf2, 0x3d, 0x36, 0x5f, 0xc1, 0xf1, 0x4d,
+  0x5d, 0x4f, 0x45, 0xf5, 0x49, 0x41, 0x5f, 0xf6, 0xf6, 0x6f, 0x6e, 0x4f,
+  0x56, 0xfe, 0x3d, 0x35, 0x4f, 0xee, 0xf6, 0x7e, 0x7e, 0x6b, 0x44, 0x1d,
+  0x11, 0x8f, 0xf2, 0xd1, 0x8e, 0xb2, 0x65, 0x56, 0x95, 0x17, 0x63, 0xfd,
+  0x23, 0x5f, 0x22, 0xf2, 0x1b, 0x19, 0x9f, 0x53, 0xf1, 0x15, 0x39, 0x7f,
+  0x67, 0xf7, 0x59, 0x43, 0x8f, 0x94, 0xe5, 0x17, 0xf7, 0x41, 0x45, 0xbf,
+  0x17, 0xf6, 0x4c, 0x78, 0x1f, 0x55, 0xb5, 0x45, 0xf4, 0x5a, 0x4a, 0xaf,
+  0xc2, 0xe3, 0x63, 0xf1, 0x46, 0x68, 0x4e, 0x42, 0x2f, 0x43, 0xf1, 0x68,
+  0x6c, 0x4f, 0x91, 0xf1, 0x44, 0x54, 0x1f, 0x29, 0x07, 0xc6, 0x03, 0xf0,
+  0x03, 0x22, 0x20, 0x22, 0x01, 0x00, 0xc0, 0x24, 0x11, 0x4c, 0x12, 0x21,
+  0x04, 0x4a, 0x12, 0x81, 0x02, 0x44, 0xa0, 0xa8, 0x08, 0xc0, 0x18, 0x40,
+  0x01, 0x18, 0xc0, 0x12, 0x48, 0x14, 0x40, 0x81, 0x04, 0x00, 0x5e, 0x07,
+  0xf0, 0x23, 0x00, 0x47, 0xe1, 0x00, 0x40, 0x81, 0x62, 0x22, 0x11, 0x10,
   0x61, 0x22, 0x15, 0x04, 0x11, 0x21, 0x00, 0x22, 0x25, 0x01, 0x00, 0x2d,
   0x11, 0x22, 0x38, 0x41, 0x42, 0x71, 0x50, 0x24, 0x28, 0x22, 0x80, 0x01,
   0x00, 0x34, 0x40, 0x11, 0x01, 0x50, 0x12, 0x11, 0x42, 0x00, 0x11, 0x25,
-  0x81, 0x44, 0x01, 0x21, 0x00, 0x48, 0x00, 0x00, 0x7b, 0xfd, 0xd0, 0x34,
-  0xf5, 0x11, 0x24, 0xcd, 0x13, 0x1f, 0xc1, 0xf2, 0x4c, 0x13, 0x1f, 0xc1,
-  0xf2, 0x4e, 0x13, 0x1d, 0x2c, 0xaf, 0x34, 0xd1, 0xc1, 0xf2, 0x4a, 0x93,
-  0x1f, 0x81, 0xf2, 0x4a, 0x93, 0x57, 0x81, 0xaf, 0x74, 0x79, 0x24, 0xf8,
-  0x4a, 0x93, 0x47, 0x82, 0xaf, 0x34, 0x79, 0x24, 0xd8, 0x1a, 0xfb, 0x24,
-  0x48, 0x8d, 0x91, 0x4f, 0xa2, 0xd4, 0x18, 0xf8, 0x26, 0x4a, 0x87, 0x11,
-  0x7f, 0xa2, 0x74, 0x98, 0xf1, 0x26, 0x4a, 0x87, 0x5d, 0x6f, 0xa2, 0xf5,
-  0x98, 0x24, 0x4f, 0xa2, 0xf5, 0xd1, 0x24, 0x6f, 0x22, 0xf5, 0x91, 0x24,
-  0xef, 0x22, 0xf1, 0x91, 0x2c, 0xc7, 0x26, 0x1f, 0xc9, 0xf6, 0x6e, 0x12,
-  0x1f, 0xc9, 0xf2, 0x6a, 0x12, 0x1f, 0xc1, 0xf2, 0x6a, 0x92, 0x1f, 0x81,
-  0xf2, 0x4a, 0x92, 0x57, 0x81, 0xaf, 0x64, 0x79, 0x34, 0xf8, 0x4a, 0xb4,
-  0x4f, 0x83, 0xf4, 0x4a, 0xb4, 0x47, 0x83, 0xad, 0xb4, 0x4f, 0x83, 0xd4,
-  0x48, 0xfb, 0x24, 0x4a, 0xb7, 0x3f, 0x80, 0xc5, 0x48, 0x58, 0x19, 0xa2,
-  0x14, 0x28, 0x4a, 0x11, 0xb1, 0x42, 0xc1, 0x24, 0x4e, 0x94, 0x19, 0xf2,
-  0x42, 0xa4, 0xa0, 0xb4, 0x43, 0xb2, 0x42, 0x38, 0x24, 0x4e, 0x91, 0x22,
-  0x2d, 0x91, 0x23, 0x82, 0xf9, 0x26, 0x52, 0x1c, 0x98, 0x94, 0x1a, 0xf8,
-  0x24, 0x42, 0x82, 0x22, 0x82, 0x2e, 0x43, 0x92, 0x26, 0x61, 0x88, 0x2e,
-  0x42, 0x1f, 0x89, 0x24, 0xb2, 0x91, 0x24, 0x26, 0x28, 0x32, 0x81, 0x23,
-  0x52, 0x41, 0x2e, 0x84, 0x11, 0x2d, 0xa4, 0x28, 0x88, 0xb0, 0x42, 0x0a,
-  0xa8, 0x90, 0xa2, 0x29, 0x84, 0xda, 0x22, 0xf5, 0x75, 0xa2, 0x40, 0x28,
-  0x88, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x24, 0x88, 0x02, 0x00, 0x00, 0x00, 0x40, 0x01, 0x2f, 0x66, 0x0d,
-  0x28, 0x50, 0x12, 0x19, 0x12, 0x02, 0x22, 0x00, 0x20, 0x01, 0x40, 0x42,
-  0x82, 0x08, 0x00, 0x20, 0x04, 0x5e, 0x28, 0xf0, 0x42, 0x21, 0x26, 0x03,
-  0x20, 0x05, 0x2f, 0x64, 0x02, 0x42, 0x24, 0x48, 0x11, 0x00, 0x00, 0x19,
-  0x04, 0x44, 0x21, 0x4d, 0x42, 0x80, 0x04, 0x19, 0x34, 0x14, 0x58, 0x80,
-  0x14, 0x86, 0x0c, 0x48, 0x43, 0x94, 0x44, 0x8f, 0x5f, 0x08, 0x30, 0x81,
-  0x1e, 0x22, 0x00, 0x26, 0x01, 0x80, 0x42, 0x01, 0x42, 0x12, 0x93, 0x14,
-  0x21, 0x24, 0x43, 0x02, 0x10, 0x02, 0xc0, 0x24, 0x80, 0x24, 0x02, 0x11,
-  0x42, 0x00, 0x80, 0x04, 0x90, 0x11, 0x30, 0x14, 0x60, 0x21, 0x00, 0x43,
-  0x0c, 0x46, 0x02, 0x48, 0x44, 0x21, 0x00, 0x45, 0x81, 0x14, 0x24, 0x64,
-  0x41, 0x14, 0xf0, 0xa6, 0x97, 0x80, 0x22, 0xdc, 0x32, 0x22, 0x02, 0x13,
-  0x02, 0x00, 0x11, 0x41, 0xa0, 0x12, 0x3c, 0x54, 0x21, 0xc8, 0x18, 0x10,
-  0x02, 0x2d, 0x42, 0xa0, 0x41, 0x1a, 0x52, 0x12, 0x8e, 0x61, 0x21, 0xc0,
-  0x11, 0x42, 0x10, 0x01, 0x48, 0xa3, 0x14, 0x31, 0x51, 0x80, 0x01, 0x4e,
-  0x11, 0x21, 0x70, 0x42, 0x14, 0x54, 0x24, 0xa0, 0x42, 0x45, 0x11, 0x24,
-  0x04, 0x42, 0x63, 0xa4, 0x84, 0x2c, 0x94, 0x14, 0x4d, 0x41, 0x4b, 0x41,
-  0xef, 0x5c, 0x04, 0x10, 0x81, 0x11, 0x11, 0x02, 0x22, 0x20, 0x02, 0x18,
-  0x48, 0x40, 0x08, 0x80, 0x02, 0x00, 0x00, 0x89, 0x12, 0xa4, 0x24, 0x80,
-  0x02, 0x42, 0x24, 0x4e, 0x24, 0x21, 0x42, 0x00, 0x00, 0x40, 0x04, 0x00,
+  0x81, 0x44, 0x01, 0x21, 0x37, 0x00, 0xd0, 0x7b, 0xfd, 0xd0, 0x34, 0xf5,
+  0x11, 0x24, 0xcd, 0x13, 0x1f, 0xc1, 0xf2, 0x4c, 0x05, 0x00, 0x02, 0xf9,
+  0x09, 0x50, 0xd1, 0xc1, 0xf2, 0x4a, 0x93, 0xb2, 0x09, 0x50, 0x93, 0x57,
+  0x81, 0xaf, 0x74, 0xb3, 0x09, 0xa2, 0x93, 0x47, 0x82, 0xaf, 0x34, 0x79,
+  0x24, 0xd8, 0x1a, 0xfb, 0x00, 0x0a, 0xf4, 0x1c, 0xd4, 0x18, 0xf8, 0x26,
+  0x4a, 0x87, 0x11, 0x7f, 0xa2, 0x74, 0x98, 0xf1, 0x26, 0x4a, 0x87, 0x5d,
+  0x6f, 0xa2, 0xf5, 0x98, 0x24, 0x4f, 0xa2, 0xf5, 0xd1, 0x24, 0x6f, 0x22,
+  0xf5, 0x91, 0x24, 0xef, 0x22, 0xf1, 0x91, 0x2c, 0xc7, 0x26, 0x1f, 0xc9,
+  0xf6, 0x6e, 0x12, 0x04, 0x0a, 0x12, 0x6a, 0x04, 0x0a, 0xf0, 0x67, 0x57,
+  0x81, 0xaf, 0x64, 0x79, 0x34, 0xf8, 0x4a, 0xb4, 0x4f, 0x83, 0xf4, 0x4a,
+  0xb4, 0x47, 0x83, 0xad, 0xb4, 0x4f, 0x83, 0xd4, 0x48, 0xfb, 0x24, 0x4a,
+  0xb7, 0x3f, 0x80, 0xc5, 0x48, 0x58, 0x19, 0xa2, 0x14, 0x28, 0x4a, 0x11,
+  0xb1, 0x42, 0xc1, 0x24, 0x4e, 0x94, 0x19, 0xf2, 0x42, 0xa4, 0xa0, 0xb4,
+  0x43, 0xb2, 0x42, 0x38, 0x24, 0x4e, 0x91, 0x22, 0x2d, 0x91, 0x23, 0x82,
+  0xf9, 0x26, 0x52, 0x1c, 0x98, 0x94, 0x1a, 0xf8, 0x24, 0x42, 0x82, 0x22,
+  0x82, 0x2e, 0x43, 0x92, 0x26, 0x61, 0x88, 0x2e, 0x42, 0x1f, 0x89, 0x24,
+  0xb2, 0x91, 0x24, 0x26, 0x28, 0x32, 0x81, 0x23, 0x52, 0x41, 0x2e, 0x84,
+  0x11, 0x2d, 0xa4, 0x28, 0x88, 0xb0, 0x42, 0x0a, 0xa8, 0x90, 0xa2, 0x29,
+  0x84, 0xda, 0x22, 0xf5, 0x75, 0xa2, 0x40, 0x28, 0x88, 0x12, 0x05, 0x13,
+  0x40, 0x17, 0x05, 0x20, 0x80, 0x08, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x50,
+  0x00, 0x40, 0x24, 0x88, 0x02, 0x07, 0x00, 0xf1, 0xc8, 0x01, 0x2f, 0x66,
+  0x0d, 0x28, 0x50, 0x12, 0x19, 0x12, 0x02, 0x22, 0x00, 0x20, 0x01, 0x40,
+  0x42, 0x82, 0x08, 0x00, 0x20, 0x04, 0x5e, 0x28, 0xf0, 0x42, 0x21, 0x26,
+  0x03, 0x20, 0x05, 0x2f, 0x64, 0x02, 0x42, 0x24, 0x48, 0x11, 0x00, 0x00,
+  0x19, 0x04, 0x44, 0x21, 0x4d, 0x42, 0x80, 0x04, 0x19, 0x34, 0x14, 0x58,
+  0x80, 0x14, 0x86, 0x0c, 0x48, 0x43, 0x94, 0x44, 0x8f, 0x5f, 0x08, 0x30,
+  0x81, 0x1e, 0x22, 0x00, 0x26, 0x01, 0x80, 0x42, 0x01, 0x42, 0x12, 0x93,
+  0x14, 0x21, 0x24, 0x43, 0x02, 0x10, 0x02, 0xc0, 0x24, 0x80, 0x24, 0x02,
+  0x11, 0x42, 0x00, 0x80, 0x04, 0x90, 0x11, 0x30, 0x14, 0x60, 0x21, 0x00,
+  0x43, 0x0c, 0x46, 0x02, 0x48, 0x44, 0x21, 0x00, 0x45, 0x81, 0x14, 0x24,
+  0x64, 0x41, 0x14, 0xf0, 0xa6, 0x97, 0x80, 0x22, 0xdc, 0x32, 0x22, 0x02,
+  0x13, 0x02, 0x00, 0x11, 0x41, 0xa0, 0x12, 0x3c, 0x54, 0x21, 0xc8, 0x18,
+  0x10, 0x02, 0x2d, 0x42, 0xa0, 0x41, 0x1a, 0x52, 0x12, 0x8e, 0x61, 0x21,
+  0xc0, 0x11, 0x42, 0x10, 0x01, 0x48, 0xa3, 0x14, 0x31, 0x51, 0x80, 0x01,
+  0x4e, 0x11, 0x21, 0x70, 0x42, 0x14, 0x54, 0x24, 0xa0, 0x42, 0x45, 0x11,
+  0x24, 0x04, 0x42, 0x63, 0xa4, 0x84, 0x2c, 0x94, 0x14, 0x4d, 0x41, 0x4b,
+  0x41, 0xef, 0x5c, 0x04, 0x10, 0x81, 0x11, 0x11, 0x02, 0x22, 0x20, 0x02,
+  0x18, 0x48, 0x40, 0x08, 0x80, 0x02, 0x00, 0x00, 0x89, 0x12, 0xa4, 0x24,
+  0x80, 0x02, 0x42, 0x24, 0x4e, 0x24, 0x21, 0x42, 0xf4, 0x00, 0xf1, 0x03,
   0x44, 0x88, 0x48, 0x23, 0x84, 0x04, 0x48, 0x29, 0x21, 0x01, 0x45, 0x01,
-  0x41, 0x80, 0x04, 0xf0, 0x74, 0x55, 0x00, 0x00, 0x44, 0x00, 0x00, 0x81,
-  0x13, 0x01, 0x12, 0x00, 0x00, 0x18, 0x00, 0x11, 0x00, 0x81, 0x20, 0x04,
-  0x10, 0x01, 0x11, 0x00, 0x12, 0x00, 0x24, 0x00, 0x28, 0x00, 0x00, 0x24,
-  0x11, 0x00, 0x85, 0x01, 0x20, 0x01, 0x00, 0x00, 0x48, 0x81, 0xf0, 0xe8,
-  0x23, 0x00, 0x11, 0x10, 0x03, 0x80, 0x02, 0x24, 0x00, 0x81, 0x14, 0x10,
-  0x42, 0x18, 0x11, 0x21, 0x18, 0x08, 0x4c, 0x81, 0x02, 0x11, 0x00, 0x50,
-  0x21, 0x40, 0x08, 0x2c, 0x02, 0x61, 0x12, 0x22, 0x21, 0x00, 0x58, 0x86,
-  0x12, 0x41, 0x04, 0x00, 0x00, 0x44, 0x81, 0x21, 0x28, 0x40, 0x02, 0x44,
-  0xc0, 0x22, 0x4f, 0xf1, 0x02, 0x10, 0x41, 0x12, 0x01, 0x00, 0x10, 0x88,
-  0x01, 0x18, 0x40, 0x02, 0xc0, 0x11, 0x14, 0x40, 0x08, 0x18, 0x22, 0x00,
-  0x00, 0x11, 0x14, 0x25, 0x01, 0x20, 0x43, 0x42, 0x44, 0x82, 0x02, 0x22,
-  0xa0, 0x41, 0x88, 0x21, 0x44, 0x00, 0x10, 0x01, 0x41, 0x12, 0x21, 0x22,
-  0x00, 0x21, 0x42, 0x60, 0x22, 0xaf, 0x78, 0x06, 0x60, 0x84, 0x10, 0x04,
-  0x80, 0x02, 0x10, 0x03, 0x84, 0x59, 0x02, 0x10, 0x08, 0x80, 0x18, 0x01,
-  0x41, 0x81, 0x29, 0x31, 0x41, 0x88, 0x00, 0x00, 0x84, 0x00, 0x25, 0x01,
-  0x18, 0xac, 0x04, 0x00, 0x00, 0x11, 0x24, 0x11, 0x41, 0x10, 0x08, 0x10,
-  0x08, 0x00, 0x40, 0x12, 0x14, 0x08, 0xcf, 0x26, 0x0b, 0x45, 0x02, 0x24,
-  0x00, 0x41, 0x00, 0x00, 0x82, 0x24, 0x48, 0xa0, 0x41, 0x82, 0x10, 0x02,
-  0x10, 0x22, 0x03, 0x20, 0x08, 0x4e, 0x24, 0x2c, 0x04, 0x00, 0x41, 0x50,
-  0x84, 0x51, 0x30, 0x14, 0x25, 0xa4, 0x81, 0x41, 0x82, 0x20, 0x34, 0x44,
-  0x18, 0x00, 0x21, 0x20, 0x21, 0x28, 0x08, 0x92, 0x85, 0x04, 0x81, 0x40,
-  0xf2, 0x83, 0xa9, 0x00, 0x10, 0x41, 0x06, 0x34, 0x00, 0x12, 0x61, 0x14,
-  0x11, 0x80, 0x05, 0x14, 0x00, 0x40, 0x04, 0x00, 0x80, 0x44, 0x11, 0x02,
-  0x1d, 0x12, 0x10, 0x01, 0x20, 0x11, 0x92, 0x81, 0x10, 0x01, 0x12, 0x11,
-  0x82, 0x25, 0x05, 0x20, 0x01, 0xc0, 0x41, 0x4c, 0x04, 0x80, 0x01, 0x00,
-  0x00, 0xf0, 0x65, 0x96, 0x00, 0x00, 0xc0, 0x48, 0x80, 0x02, 0x21, 0x00,
-  0x00, 0x82, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x18, 0x14, 0x41, 0x41, 0x00,
-  0x80, 0x12, 0x84, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x20, 0x48, 0x14,
-  0x21, 0x01, 0x10, 0x08, 0x42, 0x10, 0x08, 0x41, 0xa0, 0x41, 0x70, 0x5d,
-  0x0f, 0x45, 0x02, 0x50, 0x62, 0x89, 0x54, 0x24, 0x22, 0x24, 0x12, 0x21,
-  0x11, 0x14, 0x42, 0x4a, 0x09, 0x86, 0x81, 0x1c, 0x02, 0x44, 0xa0, 0x12,
-  0x12, 0x90, 0x44, 0x41, 0x63, 0x84, 0xd4, 0x23, 0x21, 0x02, 0x4c, 0x04,
-  0x41, 0x15, 0x34, 0x41, 0x6c, 0x11, 0x25, 0x01, 0x82, 0x82, 0x42, 0x8e,
-  0x44, 0x12, 0x14, 0x18, 0x21, 0x46, 0x11, 0x8c, 0x88, 0x2c, 0xe1, 0x88,
-  0x01, 0x44, 0x81, 0x1a, 0x04, 0xef, 0x8b, 0x07, 0x00, 0x14, 0x00, 0x11,
-  0x00, 0x40, 0x84, 0x08, 0x21, 0xa0, 0x14, 0x00, 0x00, 0x10, 0x02, 0x10,
-  0x81, 0x18, 0x81, 0x02, 0x00, 0x54, 0x00, 0xac, 0x01, 0x88, 0x00, 0x82,
-  0x49, 0x11, 0x41, 0x52, 0x41, 0x40, 0x84, 0x01, 0x00, 0x4a, 0x01, 0x00,
-  0x50, 0x84, 0x00, 0x40, 0xf2, 0xdc, 0x19, 0x10, 0x44, 0x34, 0x22, 0x10,
-  0x02, 0x40, 0x04, 0x48, 0x00, 0x00, 0x18, 0x40, 0x01, 0x28, 0x80, 0x0b,
-  0x00, 0x81, 0x61, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x44, 0x00, 0x85,
-  0x01, 0x00, 0x88, 0x84, 0x24, 0x40, 0x01, 0x21, 0x00, 0x82, 0x00, 0x00,
-  0x00, 0x1f, 0xb4, 0x03, 0x00, 0x84, 0x50, 0x84, 0x69, 0x54, 0x21, 0x8c,
-  0x81, 0x01, 0x50, 0x81, 0x27, 0x18, 0x13, 0x14, 0x52, 0x32, 0x20, 0x19,
-  0x04, 0x81, 0x81, 0x8c, 0x22, 0x02, 0x14, 0x4c, 0xc1, 0x21, 0x84, 0x4c,
-  0x62, 0x42, 0x4b, 0xc1, 0x44, 0x88, 0x80, 0x08, 0x81, 0x1c, 0x88, 0x01,
-  0x45, 0x22, 0x88, 0x24, 0x81, 0x81, 0x14, 0x08, 0x2c, 0x29, 0x88, 0x04,
-  0x8d, 0x84, 0x12, 0x8a, 0x04, 0x82, 0x48, 0x6e, 0x55, 0x10, 0x64, 0xc4,
-  0x83, 0x02, 0x24, 0x44, 0x14, 0x80, 0x81, 0x04, 0x81, 0x49, 0xc2, 0x42,
-  0x16, 0x42, 0x11, 0x02, 0x44, 0x90, 0x28, 0x10, 0xb8, 0x22, 0x01, 0x88,
-  0x41, 0x14, 0x81, 0xc0, 0x24, 0x18, 0xc0, 0x41, 0x00, 0xcc, 0x04, 0x13,
-  0x18, 0x08, 0x24, 0x82, 0x42, 0x81, 0x43, 0x01, 0x81, 0x80, 0x08, 0x80,
-  0x88, 0x08, 0x2c, 0x08, 0x88, 0x42, 0x4f, 0x18, 0x0b, 0x85, 0xf8, 0x48,
-  0x42, 0x4a, 0x24, 0x14, 0x2e, 0x44, 0x92, 0x1c, 0x00, 0x45, 0x54, 0x54,
-  0x6f, 0x12, 0xba, 0x21, 0x22, 0x02, 0x11, 0x1a, 0x88, 0x02, 0x96, 0x52,
-  0xa2, 0x2d, 0x22, 0x1a, 0xb1, 0x18, 0xf1, 0x93, 0x84, 0xba, 0xa8, 0x28,
-  0x60, 0x42, 0xd0, 0x51, 0x5c, 0x51, 0x13, 0x58, 0x88, 0x8d, 0x88, 0x8b,
-  0x44, 0x4e, 0x48, 0x42, 0x16, 0x01, 0x44, 0x20, 0x28, 0x51, 0x64, 0x4d,
-  0x44, 0x53, 0x42, 0x82, 0x91, 0x82, 0x42, 0x50, 0x84, 0x18, 0x46, 0x52,
-  0x22, 0x25, 0xa2, 0x11, 0x7f, 0x95, 0x0e, 0x40, 0x04, 0x10, 0x41, 0x01,
-  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x11, 0x88, 0x00, 0x00, 0x81,
-  0x40, 0x42, 0x14, 0x84, 0x02, 0x10, 0x04, 0x00, 0x40, 0x02, 0x00, 0x12,
-  0x8c, 0x88, 0x08, 0x00, 0x00, 0x00, 0x20, 0x04, 0xc2, 0x00, 0x60, 0x5d,
-  0x10, 0x48, 0x28, 0xa4, 0x42, 0x21, 0x41, 0x00, 0x00, 0x10, 0x44, 0x24,
-  0xc2, 0x31, 0x00, 0x20, 0x01, 0x28, 0x24, 0x84, 0x21, 0x12, 0x18, 0x13,
-  0x88, 0x08, 0x22, 0x00, 0x11, 0x14, 0x10, 0x48, 0x28, 0x84, 0x04, 0x00,
-  0x82, 0x00, 0x10, 0xc4, 0x24, 0x22, 0x38, 0x00, 0x00, 0x00, 0x24, 0x10,
-  0xf2, 0x9c, 0xd9, 0x40, 0x08, 0x48, 0x48, 0x00, 0x20, 0x02, 0x00, 0x44,
-  0x21, 0x28, 0x28, 0x90, 0x82, 0x00, 0x4c, 0x64, 0x24, 0x22, 0x31, 0x21,
-  0x18, 0x18, 0x88, 0x88, 0x10, 0x08, 0x12, 0x1c, 0x81, 0x38, 0x88, 0x84,
-  0x42, 0x48, 0x00, 0x44, 0x84, 0x20, 0x04, 0x40, 0x46, 0x84, 0x02, 0x90,
-  0x82, 0x90, 0x14, 0x46, 0x04, 0x10, 0x12, 0xf2, 0x16, 0xc3, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x10, 0x42, 0x84, 0x81, 0x02, 0x40, 0x01, 0x40, 0x08,
-  0x10, 0x02, 0x18, 0x80, 0x08, 0x48, 0x10, 0x02, 0x1c, 0x04, 0x40, 0x08,
-  0x4c, 0x04, 0x00, 0x21, 0x12, 0x00, 0x21, 0x44, 0x80, 0x02, 0x11, 0x00,
-  0x40, 0x08, 0x10, 0x02, 0x18, 0x7f, 0x7b, 0x04, 0x00, 0x00, 0x24, 0x00,
-  0x00, 0x4a, 0x18, 0x08, 0x42, 0x00, 0x00, 0x84, 0x00, 0x10, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x01, 0x12, 0x00, 0x00, 0x00, 0x40, 0x21, 0x04,
-  0x20, 0x01, 0x00, 0x00, 0x81, 0x40, 0x24, 0x08, 0x81, 0xf0, 0x5b, 0x68,
-  0x50, 0x88, 0x87, 0x84, 0x4e, 0x44, 0x4a, 0x04, 0x10, 0x09, 0x1c, 0x04,
-  0x41, 0x45, 0x78, 0x2c, 0x24, 0xa2, 0x22, 0x18, 0x00, 0x00, 0x24, 0x24,
-  0x25, 0x32, 0x16, 0x12, 0x9e, 0x11, 0x83, 0xe8, 0x28, 0x08, 0x40, 0x12,
-  0x51, 0x11, 0x35, 0x11, 0x18, 0x78, 0x58, 0xe8, 0x44, 0xa4, 0x44, 0x10,
-  0x04, 0x00, 0x91, 0x41, 0x45, 0x78, 0x24, 0x24, 0x22, 0x02, 0x00, 0x00,
-  0x24, 0x24, 0x24, 0x63, 0xf1, 0xc2, 0x2e, 0x00, 0x81, 0x20, 0x04, 0x00,
-  0x28, 0x40, 0x08, 0x10, 0x14, 0xa2, 0x42, 0x00, 0x00, 0x40, 0x04, 0x4d,
-  0x22, 0x14, 0xa0, 0x21, 0x20, 0x18, 0x08, 0x40, 0x02, 0x19, 0x01, 0x1a,
-  0x18, 0x88, 0xa8, 0x84, 0x00, 0x14, 0x10, 0x01, 0x84, 0x50, 0x24, 0x4a,
-  0x82, 0x06, 0x80, 0x08, 0x40, 0x04, 0x45, 0x02, 0x7f, 0x2f, 0x01, 0x00,
-  0x00, 0x49, 0x42, 0x05, 0x11, 0x00, 0x80, 0x04, 0x48, 0x00, 0x80, 0x88,
-  0x11, 0x84, 0x08, 0x20, 0x02, 0x10, 0x01, 0x48, 0x80, 0x04, 0x40, 0x02,
-  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x48, 0x89, 0x04, 0x00, 0x21, 0x18,
-  0x12, 0x00, 0x41, 0x00, 0x5d, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x21,
-  0x00, 0x00, 0x80, 0x08, 0x14, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0xab, 0x04, 0x00, 0x20, 0xc2, 0x24, 0x54,
-  0x80, 0x62, 0x24, 0x81, 0x20, 0x31, 0x48, 0x21, 0x52, 0x11, 0x40, 0x18,
-  0xc8, 0x44, 0x43, 0x94, 0x24, 0xc3, 0x02, 0x00, 0x20, 0xc4, 0x44, 0x21,
-  0x00, 0x18, 0x1a, 0xa8, 0x81, 0x92, 0x00, 0x40, 0x12, 0x54, 0x81, 0x70,
-  0x41, 0x18, 0x01, 0x24, 0x42, 0x20, 0x01, 0x21, 0x90, 0x18, 0x44, 0x4b,
-  0x8c, 0x10, 0x14, 0xf4, 0x65, 0xe6, 0x00, 0x41, 0x00, 0x24, 0x11, 0x11,
-  0x11, 0xa0, 0x48, 0x00, 0x20, 0x04, 0x24, 0x82, 0x88, 0x00, 0x8a, 0x02,
-  0x11, 0x43, 0x22, 0x72, 0x28, 0x41, 0x09, 0x25, 0x98, 0x28, 0x2c, 0xc2,
-  0x12, 0x10, 0x04, 0x20, 0x21, 0x08, 0x00, 0x18, 0x1a, 0xc8, 0xc2, 0x83,
-  0x08, 0x12, 0x10, 0x62, 0x14, 0x2c, 0x21, 0x88, 0xe8, 0x41, 0x04, 0x00,
-  0x81, 0xf0, 0x4e, 0x51, 0x00, 0x40, 0x04, 0x25, 0x11, 0x14, 0x28, 0x13,
-  0x19, 0x11, 0x78, 0x48, 0x02, 0x40, 0x81, 0x01, 0xa0, 0x51, 0x51, 0x88,
-  0x00, 0x14, 0x00, 0x11, 0x24, 0x50, 0x24, 0x48, 0x42, 0x16, 0x42, 0x02,
-  0x30, 0x84, 0x44, 0x13, 0x18, 0x52, 0x41, 0x10, 0x11, 0x08, 0x81, 0x83,
-  0x14, 0x28, 0x04, 0x00, 0x8c, 0x01, 0x49, 0x04, 0x41, 0x00, 0xff, 0x58,
-  0x07, 0x6f, 0x62, 0xd2, 0x22, 0xa2, 0x12, 0x2b, 0x11, 0x90, 0x12, 0xc0,
-  0x12, 0x25, 0x92, 0x82, 0x2f, 0x31, 0xf1, 0x13, 0x11, 0x1b, 0x98, 0x9e,
-  0x99, 0x8d, 0x88, 0x8f, 0x18, 0xe4, 0x84, 0x24, 0xd4, 0x91, 0x54, 0x11,
-  0x1c, 0x54, 0x99, 0x85, 0xe8, 0x84, 0xf4, 0x48, 0x4c, 0x4d, 0x44, 0x4b,
-  0x24, 0x2e, 0x24, 0x22, 0x4c, 0x02, 0x28, 0x45, 0x54, 0x44, 0x2e, 0x24,
-  0x67, 0x62, 0x25, 0xa2, 0x12, 0x2b, 0x11, 0x1a, 0xb8, 0x82, 0x29, 0xc8,
-  0x92, 0x25, 0x92, 0x82, 0x2f, 0x31, 0xf1, 0x13, 0x11, 0x1b, 0x98, 0x9e,
-  0x99, 0x8d, 0x88, 0x8b, 0x48, 0x4e, 0x48, 0x42, 0x8c, 0x04, 0x48, 0x85,
-  0x58, 0x88, 0x4e, 0x48, 0xef, 0x91, 0x08, 0x6f, 0x22, 0x52, 0x22, 0x2a,
-  0xa1, 0x21, 0x23, 0x01, 0x00, 0x25, 0x12, 0xc3, 0x13, 0x1f, 0x11, 0x91,
-  0x89, 0x9e, 0xc8, 0x85, 0xb9, 0x88, 0xa4, 0xc4, 0x46, 0x48, 0xd1, 0x11,
-  0x04, 0x15, 0x58, 0x88, 0x49, 0xf4, 0x48, 0x64, 0x45, 0xb4, 0x44, 0xa2,
-  0x62, 0x26, 0x04, 0x28, 0x28, 0x44, 0x45, 0x86, 0xf2, 0x26, 0x22, 0x27,
-  0x21, 0x98, 0x1a, 0xb1, 0x12, 0xa8, 0x88, 0x8a, 0x01, 0x2d, 0x82, 0x31,
-  0x3c, 0xf1, 0x11, 0x11, 0x99, 0xe8, 0x89, 0x5c, 0x98, 0x8b, 0x48, 0x4a,
-  0x6c, 0x84, 0x80, 0x04, 0x84, 0x85, 0x98, 0x44, 0x8f, 0xa4, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f, 0x80, 0x02, 0x94, 0x40, 0xf8,
-  0x24, 0x48, 0x12, 0x43, 0x32, 0x15, 0x45, 0x01, 0x20, 0x48, 0x43, 0x42,
-  0x46, 0x24, 0x81, 0xe2, 0x28, 0x02, 0x42, 0x41, 0x25, 0xb4, 0x22, 0x54,
-  0x41, 0x18, 0x1d, 0x14, 0x89, 0xa9, 0xa4, 0x8b, 0x94, 0x4c, 0x38, 0x48,
-  0x83, 0x24, 0x04, 0x84, 0x14, 0x00, 0x30, 0x14, 0x49, 0x14, 0x41, 0x21,
-  0x08, 0x86, 0x48, 0x44, 0x04, 0x64, 0x20, 0x69, 0x24, 0x92, 0xd2, 0x45,
-  0xf8, 0xfa, 0xed, 0xe0, 0x14, 0xd2, 0xa1, 0x54, 0x81, 0x48, 0x9d, 0x44,
-  0x27, 0x44, 0x24, 0x4f, 0x82, 0xc4, 0x42, 0x2a, 0x34, 0x22, 0x8a, 0x92,
-  0x3c, 0x44, 0x4e, 0xa4, 0x47, 0x82, 0x22, 0x36, 0xd2, 0x68, 0xa2, 0x58,
-  0x2b, 0x14, 0x98, 0x83, 0xf9, 0x82, 0x18, 0x4a, 0xe8, 0x31, 0x88, 0xd3,
-  0x23, 0xf8, 0x88, 0x22, 0x11, 0x9c, 0x41, 0x35, 0x48, 0x17, 0x28, 0x54,
-  0x14, 0x9b, 0x41, 0x25, 0xd1, 0x28, 0x74, 0x4c, 0x31, 0x4c, 0x8f, 0x68,
-  0x34, 0x48, 0x88, 0x43, 0x55, 0x42, 0x12, 0xc1, 0x44, 0x19, 0x54, 0x22,
-  0x45, 0x22, 0xc1, 0x16, 0x90, 0x92, 0x81, 0x24, 0x2c, 0xf9, 0xd6, 0xa4,
-  0x00, 0x22, 0x84, 0x91, 0x4c, 0x84, 0x54, 0x84, 0x00, 0x14, 0x27, 0x52,
-  0x82, 0x89, 0x42, 0x24, 0x44, 0x82, 0x02, 0x8c, 0x21, 0x85, 0x84, 0x21,
-  0x44, 0xc4, 0x44, 0x80, 0xc1, 0x82, 0x19, 0x48, 0xa1, 0x43, 0x1c, 0x51,
-  0x84, 0x34, 0x46, 0x01, 0x8c, 0x15, 0x1a, 0x09, 0x00, 0x49, 0x21, 0xa8,
-  0x41, 0x25, 0xa5, 0x18, 0x81, 0x86, 0x04, 0x40, 0x04, 0x2c, 0x01, 0x23,
-  0x04, 0x4a, 0x58, 0x42, 0x6f, 0x3d, 0x0f, 0x4e, 0x21, 0x11, 0x21, 0x00,
-  0x25, 0x48, 0x32, 0x18, 0x42, 0x2b, 0x21, 0x00, 0x18, 0x88, 0x1c, 0x48,
-  0x48, 0x16, 0x14, 0x82, 0x02, 0x21, 0x89, 0x18, 0x88, 0xe8, 0x1a, 0x64,
-  0x42, 0x60, 0x42, 0x98, 0x60, 0xcc, 0x42, 0x81, 0x44, 0x48, 0x40, 0x41,
-  0x12, 0x48, 0x68, 0x28, 0x40, 0x54, 0x14, 0x00, 0x10, 0xc8, 0x41, 0x44,
-  0x40, 0x02, 0x82, 0x90, 0x8a, 0xb0, 0x88, 0xf1, 0x54, 0xc1, 0x14, 0x20,
-  0x04, 0x48, 0x10, 0x84, 0x62, 0x44, 0x44, 0x41, 0x80, 0x02, 0x20, 0x12,
-  0x04, 0x12, 0x28, 0x2d, 0x82, 0x1a, 0x08, 0x20, 0x48, 0x02, 0x11, 0x2d,
-  0x11, 0x00, 0x1d, 0x88, 0x00, 0x00, 0x14, 0x11, 0x00, 0x41, 0x48, 0x8c,
-  0x04, 0x00, 0x00, 0x00, 0x44, 0x21, 0x21, 0x43, 0x01, 0x20, 0x81, 0x01,
-  0xb0, 0xbf, 0x0a, 0x40, 0x18, 0x01, 0x94, 0x20, 0x24, 0x82, 0x82, 0x04,
-  0x10, 0x04, 0x45, 0x82, 0x02, 0x22, 0x44, 0x80, 0x22, 0x28, 0x71, 0x12,
-  0x02, 0x12, 0x21, 0xd0, 0x28, 0x11, 0x08, 0x20, 0x28, 0x4c, 0x08, 0x00,
-  0x48, 0x1c, 0x14, 0x14, 0x34, 0x48, 0x42, 0x00, 0x10, 0x04, 0x00, 0x24,
-  0x10, 0x24, 0x21, 0x08, 0x18, 0xf0, 0x44, 0x87, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf0, 0x1d, 0xab, 0x00, 0x19, 0x02, 0x25, 0x84, 0x04, 0x22,
-  0x14, 0x10, 0x74, 0x82, 0x08, 0xc2, 0x11, 0x42, 0x21, 0x84, 0x10, 0x02,
-  0x40, 0x2c, 0x01, 0x82, 0x00, 0x81, 0x20, 0x14, 0x41, 0x22, 0x81, 0x04,
-  0x00, 0x40, 0x25, 0x44, 0x21, 0x1c, 0xe1, 0x44, 0x11, 0x14, 0x18, 0xa1,
-  0x94, 0x19, 0x84, 0x08, 0x80, 0x04, 0x81, 0x18, 0x10, 0x54, 0x24, 0xbf,
-  0x54, 0x07, 0x2c, 0x02, 0x40, 0x43, 0x48, 0x32, 0x18, 0x80, 0x95, 0x21,
-  0x00, 0x10, 0xd8, 0x82, 0x48, 0x04, 0x4b, 0x12, 0xc2, 0x84, 0xf8, 0x42,
-  0x82, 0x40, 0x78, 0x24, 0x42, 0x11, 0x64, 0x11, 0x1e, 0x28, 0x16, 0x04,
-  0x00, 0x19, 0x41, 0x62, 0x11, 0x60, 0x29, 0x84, 0x12, 0x25, 0x38, 0x84,
-  0x81, 0x11, 0x82, 0x10, 0x58, 0x24, 0x42, 0x44, 0x23, 0x04, 0x92, 0x80,
-  0x84, 0x24, 0x08, 0x6d, 0x23, 0x14, 0x24, 0x19, 0x02, 0x15, 0x84, 0x04,
-  0x23, 0x42, 0x81, 0x91, 0x25, 0x81, 0x20, 0x58, 0x28, 0xc8, 0x61, 0x20,
-  0x83, 0x1c, 0x88, 0x48, 0x8c, 0x09, 0x82, 0x00, 0x84, 0x14, 0x8c, 0x15,
-  0x01, 0x12, 0x42, 0x13, 0x41, 0x12, 0x01, 0x54, 0x48, 0x14, 0x23, 0x9c,
-  0x81, 0x87, 0x41, 0x44, 0x88, 0x11, 0x89, 0x98, 0x44, 0x23, 0x04, 0x23,
-  0x84, 0x84, 0x09, 0x18, 0x42, 0x49, 0x08, 0x5f, 0xee, 0x08, 0x22, 0x40,
-  0x02, 0xa1, 0x90, 0x18, 0x20, 0x04, 0x29, 0x08, 0x42, 0x11, 0x81, 0x10,
-  0x18, 0x14, 0x02, 0x4a, 0x83, 0x04, 0x10, 0x78, 0x24, 0x42, 0x11, 0x24,
-  0x21, 0x62, 0x41, 0x24, 0x00, 0x00, 0x12, 0x20, 0x19, 0x2a, 0x11, 0x48,
-  0x24, 0x14, 0x11, 0x08, 0x4a, 0x11, 0x81, 0x18, 0x04, 0x00, 0x84, 0x42,
-  0x00, 0x41, 0x2c, 0x0f, 0x22, 0x00, 0x11, 0x10, 0x11, 0x02, 0x21, 0x10,
-  0x02, 0x10, 0x01, 0x10, 0x02, 0x20, 0x01, 0x00, 0x20, 0xa4, 0x42, 0x00,
-  0x12, 0x8c, 0x81, 0x02, 0x00, 0x00, 0xa0, 0x12, 0x10, 0x02, 0x18, 0x48,
-  0x00, 0x00, 0x00, 0x18, 0x12, 0x25, 0x02, 0x00, 0x18, 0x48, 0x00, 0xdf,
-  0xa8, 0x08, 0x10, 0x41, 0x01, 0x19, 0x02, 0x22, 0x18, 0x10, 0x01, 0x21,
-  0x40, 0x1a, 0x31, 0x12, 0x4a, 0x02, 0x30, 0x42, 0x72, 0x81, 0x1a, 0x02,
-  0x00, 0x2b, 0x41, 0x20, 0x04, 0x27, 0x24, 0x90, 0x52, 0x12, 0x2d, 0x44,
-  0x00, 0x21, 0x18, 0x24, 0x40, 0x48, 0x04, 0x19, 0x04, 0x2c, 0x04, 0x21,
-  0x80, 0x04, 0x18, 0x80, 0x24, 0x28, 0x81, 0x04, 0x3f, 0xc1, 0x09, 0x28,
-  0x11, 0x14, 0x20, 0x02, 0x22, 0x00, 0x11, 0x00, 0x00, 0x60, 0x21, 0x22,
-  0x00, 0x48, 0x10, 0x28, 0x02, 0x20, 0x22, 0x04, 0x42, 0x89, 0x21, 0x14,
-  0x82, 0x04, 0x00, 0x90, 0x22, 0x00, 0x21, 0x84, 0x48, 0x30, 0x41, 0x00,
-  0x24, 0x20, 0x01, 0x24, 0x00, 0x42, 0x92, 0x42, 0x48, 0xf0, 0x7e, 0x8a,
-  0x00, 0x00, 0x11, 0x11, 0x14, 0x21, 0x18, 0x21, 0x50, 0x22, 0x00, 0x15,
-  0x58, 0x32, 0x80, 0x04, 0x90, 0x12, 0x6a, 0x01, 0x18, 0x80, 0x64, 0x24,
-  0x12, 0x20, 0x41, 0x22, 0x42, 0x22, 0xc1, 0x12, 0x49, 0x04, 0x80, 0x21,
-  0x11, 0x02, 0x18, 0x41, 0x00, 0x80, 0x14, 0x02, 0xa0, 0x41, 0x21, 0x12,
-  0x00, 0x80, 0x01, 0xf0, 0xad, 0x69, 0x20, 0x04, 0x2c, 0x02, 0x00, 0x40,
-  0x02, 0x41, 0x86, 0xd1, 0x22, 0xc4, 0x22, 0x10, 0x22, 0x08, 0x00, 0x40,
-  0xa1, 0x24, 0xb0, 0x46, 0x41, 0x04, 0x24, 0x4a, 0x02, 0x2a, 0x24, 0x88,
-  0x04, 0x00, 0x46, 0x84, 0x14, 0x21, 0x01, 0x00, 0x84, 0x16, 0x24, 0x84,
-  0x28, 0x04, 0x11, 0x48, 0x41, 0x20, 0x24, 0x02, 0x26, 0x02, 0x00, 0xdf,
-  0x61, 0x08, 0x23, 0x22, 0x46, 0x01, 0x12, 0x42, 0x18, 0x22, 0x00, 0x32,
-  0x80, 0x02, 0x44, 0x25, 0x08, 0xb0, 0x48, 0xe1, 0x82, 0x04, 0x00, 0x29,
-  0x01, 0x00, 0x40, 0x43, 0x82, 0x01, 0x42, 0x00, 0x18, 0x48, 0x60, 0x28,
-  0x00, 0x41, 0x44, 0x00, 0x00, 0x22, 0x00, 0x20, 0x08, 0x41, 0x43, 0x64,
-  0x64, 0x00, 0xc4, 0xef, 0x26, 0x03, 0x00, 0x80, 0x42, 0x48, 0x0a, 0x80,
-  0x24, 0x02, 0x12, 0x00, 0x20, 0x04, 0x21, 0x22, 0x24, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x14, 0x28, 0x00, 0x42, 0x00, 0x20, 0x0c,
-  0x1c, 0x01, 0x80, 0x04, 0xb0, 0x24, 0x14, 0x08, 0x00, 0x44, 0x48, 0xf0,
-  0x57, 0x4a, 0xa0, 0x24, 0x28, 0x26, 0x82, 0x62, 0x81, 0x81, 0x00, 0x60,
-  0x42, 0x2a, 0x91, 0x42, 0x24, 0x10, 0xd2, 0x82, 0x0c, 0x90, 0x58, 0x2c,
-  0x46, 0x21, 0x02, 0x46, 0x04, 0x40, 0x02, 0x15, 0xc2, 0x42, 0x1a, 0x28,
-  0x24, 0x04, 0x30, 0x15, 0x10, 0x01, 0x21, 0x00, 0x41, 0x8a, 0x04, 0x13,
-  0x08, 0x20, 0x84, 0x04, 0x66, 0x94, 0x48, 0x41, 0x41, 0x46, 0x14, 0x04,
-  0x45, 0xf8, 0xa6, 0x9c, 0x10, 0x02, 0x14, 0x00, 0x48, 0x29, 0x81, 0x32,
-  0x42, 0xc0, 0x81, 0x12, 0x21, 0x40, 0x04, 0x24, 0x80, 0x42, 0x08, 0x48,
-  0x00, 0x44, 0x80, 0xa2, 0x42, 0x20, 0x02, 0x00, 0x00, 0x48, 0x28, 0x20,
-  0x29, 0x04, 0x41, 0x84, 0x49, 0x81, 0x84, 0x81, 0x04, 0x11, 0x10, 0x84,
-  0x08, 0x28, 0x48, 0x28, 0x20, 0x04, 0x5d, 0xa7, 0x00, 0x11, 0x11, 0x40,
-  0x48, 0x08, 0x30, 0x42, 0x24, 0x18, 0x11, 0x23, 0x04, 0x21, 0x28, 0x21,
-  0x42, 0x20, 0x04, 0x20, 0x01, 0x42, 0x24, 0x80, 0x04, 0x22, 0x50, 0x22,
-  0x40, 0xe2, 0x21, 0x04, 0x48, 0x24, 0x48, 0x00, 0x00, 0x42, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x1e, 0xc7, 0x80, 0x02, 0x48, 0x42,
-  0x80, 0x82, 0x94, 0x42, 0x00, 0x28, 0x21, 0x10, 0xa2, 0x42, 0x21, 0x22,
-  0x20, 0x22, 0x11, 0x02, 0x22, 0x00, 0x60, 0x22, 0x80, 0x44, 0x22, 0x02,
-  0x24, 0x00, 0x00, 0x48, 0x24, 0x58, 0x12, 0x00, 0x00, 0x82, 0xa0, 0x84,
-  0x82, 0x20, 0x04, 0x82, 0x82, 0xc0, 0x41, 0x00, 0x84, 0xaf, 0x67, 0x03,
-  0x48, 0x28, 0x00, 0x4a, 0x02, 0x84, 0x00, 0x42, 0x4a, 0x22, 0x62, 0x11,
-  0x00, 0x42, 0x62, 0x22, 0x20, 0x85, 0x21, 0x02, 0x00, 0x22, 0x12, 0x00,
-  0x60, 0x22, 0x48, 0x20, 0x04, 0x20, 0x01, 0x80, 0x01, 0x42, 0x48, 0x80,
-  0x28, 0x04, 0x00, 0x80, 0x04, 0x00, 0x00, 0x48, 0x00, 0x1f, 0x49, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x82, 0x01, 0x00, 0x00, 0x20,
-  0x21, 0xa2, 0x42, 0x18, 0x42, 0x00, 0x80, 0x04, 0x20, 0x01, 0x80, 0x04,
-  0x48, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x04, 0x82, 0x00, 0x20,
-  0x08, 0x88, 0xf0, 0xc1, 0x4c, 0x00, 0x00, 0x48, 0x10, 0x08, 0x10, 0x82,
-  0x02, 0x12, 0x29, 0x04, 0x22, 0x80, 0x04, 0x18, 0x20, 0x04, 0xa0, 0x14,
-  0x00, 0x29, 0xa1, 0x14, 0x42, 0x20, 0x04, 0x23, 0x21, 0x24, 0x04, 0x42,
-  0x2c, 0x21, 0x05, 0x00, 0x80, 0x84, 0x04, 0x80, 0x04, 0x00, 0x00, 0x21,
-  0x00, 0x00, 0x25, 0xf9, 0xd5, 0x35, 0x00, 0x10, 0x81, 0x12, 0x08, 0x10,
-  0x0a, 0x00, 0x31, 0x22, 0x29, 0x02, 0x21, 0x00, 0x00, 0x00, 0x23, 0x05,
-  0x18, 0x12, 0x46, 0x22, 0x02, 0x42, 0x18, 0x48, 0x46, 0x02, 0x25, 0x22,
-  0x04, 0x48, 0x24, 0x80, 0x04, 0x00, 0x20, 0x62, 0x24, 0x80, 0x04, 0x00,
-  0x21, 0x00, 0x00, 0x21, 0xf0, 0xbb, 0xf5, 0x20, 0x02, 0x00, 0x20, 0x24,
-  0x24, 0x04, 0x00, 0x48, 0x18, 0x68, 0x00, 0x80, 0xa4, 0x24, 0x00, 0x42,
-  0x10, 0x82, 0x05, 0x22, 0x00, 0x10, 0x02, 0x20, 0x01, 0x00, 0x00, 0x48,
-  0x80, 0x04, 0x00, 0x80, 0x08, 0x00, 0x88, 0x80, 0x02, 0x82, 0x48, 0x20,
-  0x88, 0xf8, 0x8c, 0xf5, 0x00, 0x26, 0x01, 0x20, 0x02, 0x00, 0x12, 0x00,
-  0x22, 0x14, 0x10, 0x82, 0x92, 0x12, 0x28, 0x20, 0x22, 0x94, 0x22, 0x48,
-  0x21, 0xa0, 0x25, 0x48, 0x20, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x48, 0x00, 0x80, 0x04, 0x48, 0x00, 0x24, 0x00, 0x00, 0x42, 0x24,
+  0x41, 0x80, 0x04, 0xf0, 0x74, 0x55, 0xe6, 0x0a, 0xf0, 0x94, 0x81, 0x13,
+  0x01, 0x12, 0x00, 0x00, 0x18, 0x00, 0x11, 0x00, 0x81, 0x20, 0x04, 0x10,
+  0x01, 0x11, 0x00, 0x12, 0x00, 0x24, 0x00, 0x28, 0x00, 0x00, 0x24, 0x11,
+  0x00, 0x85, 0x01, 0x20, 0x01, 0x00, 0x00, 0x48, 0x81, 0xf0, 0xe8, 0x23,
+  0x00, 0x11, 0x10, 0x03, 0x80, 0x02, 0x24, 0x00, 0x81, 0x14, 0x10, 0x42,
+  0x18, 0x11, 0x21, 0x18, 0x08, 0x4c, 0x81, 0x02, 0x11, 0x00, 0x50, 0x21,
+  0x40, 0x08, 0x2c, 0x02, 0x61, 0x12, 0x22, 0x21, 0x00, 0x58, 0x86, 0x12,
+  0x41, 0x04, 0x00, 0x00, 0x44, 0x81, 0x21, 0x28, 0x40, 0x02, 0x44, 0xc0,
+  0x22, 0x4f, 0xf1, 0x02, 0x10, 0x41, 0x12, 0x01, 0x00, 0x10, 0x88, 0x01,
+  0x18, 0x40, 0x02, 0xc0, 0x11, 0x14, 0x40, 0x08, 0x18, 0x22, 0x00, 0x00,
+  0x11, 0x14, 0x25, 0x01, 0x20, 0x43, 0x42, 0x44, 0x82, 0x02, 0x22, 0xa0,
+  0x41, 0x88, 0x21, 0x44, 0x00, 0x10, 0x01, 0x41, 0x12, 0x21, 0x22, 0x00,
+  0x21, 0x42, 0x60, 0x22, 0xaf, 0x78, 0x06, 0x60, 0x84, 0x10, 0x04, 0x80,
+  0x02, 0x10, 0x03, 0x84, 0x59, 0x02, 0x10, 0x08, 0x80, 0x18, 0x01, 0x41,
+  0x81, 0x29, 0x31, 0x41, 0x88, 0x04, 0x0d, 0xf0, 0x4b, 0x25, 0x01, 0x18,
+  0xac, 0x04, 0x00, 0x00, 0x11, 0x24, 0x11, 0x41, 0x10, 0x08, 0x10, 0x08,
+  0x00, 0x40, 0x12, 0x14, 0x08, 0xcf, 0x26, 0x0b, 0x45, 0x02, 0x24, 0x00,
+  0x41, 0x00, 0x00, 0x82, 0x24, 0x48, 0xa0, 0x41, 0x82, 0x10, 0x02, 0x10,
+  0x22, 0x03, 0x20, 0x08, 0x4e, 0x24, 0x2c, 0x04, 0x00, 0x41, 0x50, 0x84,
+  0x51, 0x30, 0x14, 0x25, 0xa4, 0x81, 0x41, 0x82, 0x20, 0x34, 0x44, 0x18,
+  0x00, 0x21, 0x20, 0x21, 0x28, 0x08, 0x92, 0x85, 0x04, 0x81, 0x40, 0xf2,
+  0x83, 0xa9, 0x00, 0x10, 0x41, 0x06, 0x34, 0x00, 0x12, 0x61, 0x14, 0x11,
+  0x80, 0x05, 0x14, 0x1c, 0x01, 0xf0, 0x28, 0x80, 0x44, 0x11, 0x02, 0x1d,
+  0x12, 0x10, 0x01, 0x20, 0x11, 0x92, 0x81, 0x10, 0x01, 0x12, 0x11, 0x82,
+  0x25, 0x05, 0x20, 0x01, 0xc0, 0x41, 0x4c, 0x04, 0x80, 0x01, 0x00, 0x00,
+  0xf0, 0x65, 0x96, 0x00, 0x00, 0xc0, 0x48, 0x80, 0x02, 0x21, 0x00, 0x00,
+  0x82, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x18, 0x14, 0x41, 0x41, 0x00, 0x80,
+  0x12, 0x84, 0x59, 0x08, 0xf1, 0x6c, 0x00, 0x00, 0x20, 0x48, 0x14, 0x21,
+  0x01, 0x10, 0x08, 0x42, 0x10, 0x08, 0x41, 0xa0, 0x41, 0x70, 0x5d, 0x0f,
+  0x45, 0x02, 0x50, 0x62, 0x89, 0x54, 0x24, 0x22, 0x24, 0x12, 0x21, 0x11,
+  0x14, 0x42, 0x4a, 0x09, 0x86, 0x81, 0x1c, 0x02, 0x44, 0xa0, 0x12, 0x12,
+  0x90, 0x44, 0x41, 0x63, 0x84, 0xd4, 0x23, 0x21, 0x02, 0x4c, 0x04, 0x41,
+  0x15, 0x34, 0x41, 0x6c, 0x11, 0x25, 0x01, 0x82, 0x82, 0x42, 0x8e, 0x44,
+  0x12, 0x14, 0x18, 0x21, 0x46, 0x11, 0x8c, 0x88, 0x2c, 0xe1, 0x88, 0x01,
+  0x44, 0x81, 0x1a, 0x04, 0xef, 0x8b, 0x07, 0x00, 0x14, 0x00, 0x11, 0x00,
+  0x40, 0x84, 0x08, 0x21, 0xa0, 0x14, 0x00, 0x00, 0x10, 0x02, 0x10, 0x81,
+  0x18, 0x81, 0x02, 0x00, 0x54, 0x00, 0xac, 0x01, 0x88, 0x00, 0x82, 0x49,
+  0x11, 0x41, 0x52, 0x41, 0x40, 0x84, 0x01, 0x00, 0x4a, 0x6a, 0x0b, 0xd1,
+  0x40, 0xf2, 0xdc, 0x19, 0x10, 0x44, 0x34, 0x22, 0x10, 0x02, 0x40, 0x04,
+  0x48, 0x10, 0x04, 0xf0, 0xe3, 0x28, 0x80, 0x0b, 0x00, 0x81, 0x61, 0x28,
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x44, 0x00, 0x85, 0x01, 0x00, 0x88, 0x84,
+  0x24, 0x40, 0x01, 0x21, 0x00, 0x82, 0x00, 0x00, 0x00, 0x1f, 0xb4, 0x03,
+  0x00, 0x84, 0x50, 0x84, 0x69, 0x54, 0x21, 0x8c, 0x81, 0x01, 0x50, 0x81,
+  0x27, 0x18, 0x13, 0x14, 0x52, 0x32, 0x20, 0x19, 0x04, 0x81, 0x81, 0x8c,
+  0x22, 0x02, 0x14, 0x4c, 0xc1, 0x21, 0x84, 0x4c, 0x62, 0x42, 0x4b, 0xc1,
+  0x44, 0x88, 0x80, 0x08, 0x81, 0x1c, 0x88, 0x01, 0x45, 0x22, 0x88, 0x24,
+  0x81, 0x81, 0x14, 0x08, 0x2c, 0x29, 0x88, 0x04, 0x8d, 0x84, 0x12, 0x8a,
+  0x04, 0x82, 0x48, 0x6e, 0x55, 0x10, 0x64, 0xc4, 0x83, 0x02, 0x24, 0x44,
+  0x14, 0x80, 0x81, 0x04, 0x81, 0x49, 0xc2, 0x42, 0x16, 0x42, 0x11, 0x02,
+  0x44, 0x90, 0x28, 0x10, 0xb8, 0x22, 0x01, 0x88, 0x41, 0x14, 0x81, 0xc0,
+  0x24, 0x18, 0xc0, 0x41, 0x00, 0xcc, 0x04, 0x13, 0x18, 0x08, 0x24, 0x82,
+  0x42, 0x81, 0x43, 0x01, 0x81, 0x80, 0x08, 0x80, 0x88, 0x08, 0x2c, 0x08,
+  0x88, 0x42, 0x4f, 0x18, 0x0b, 0x85, 0xf8, 0x48, 0x42, 0x4a, 0x24, 0x14,
+  0x2e, 0x44, 0x92, 0x1c, 0x00, 0x45, 0x54, 0x54, 0x6f, 0x12, 0xba, 0x21,
+  0x22, 0x02, 0x11, 0x1a, 0x88, 0x02, 0x96, 0x52, 0xa2, 0x2d, 0x22, 0x1a,
+  0xb1, 0x18, 0xf1, 0x93, 0x84, 0xba, 0xa8, 0x28, 0x60, 0x42, 0xd0, 0x51,
+  0x5c, 0x51, 0x13, 0x58, 0x88, 0x8d, 0x88, 0x8b, 0x44, 0x4e, 0x48, 0x42,
+  0x16, 0x01, 0x44, 0x20, 0x28, 0x51, 0x64, 0x4d, 0x44, 0x53, 0x42, 0x82,
+  0x91, 0x82, 0x42, 0x50, 0x84, 0x18, 0x46, 0x52, 0x22, 0x25, 0xa2, 0x11,
+  0x7f, 0x95, 0x0e, 0x40, 0x04, 0x10, 0x41, 0xc2, 0x02, 0xf0, 0x08, 0x00,
+  0x00, 0x00, 0x42, 0x11, 0x88, 0x00, 0x00, 0x81, 0x40, 0x42, 0x14, 0x84,
+  0x02, 0x10, 0x04, 0x00, 0x40, 0x02, 0x00, 0x12, 0x8c, 0x88, 0xdf, 0x03,
+  0xf0, 0x22, 0x20, 0x04, 0xc2, 0x00, 0x60, 0x5d, 0x10, 0x48, 0x28, 0xa4,
+  0x42, 0x21, 0x41, 0x00, 0x00, 0x10, 0x44, 0x24, 0xc2, 0x31, 0x00, 0x20,
+  0x01, 0x28, 0x24, 0x84, 0x21, 0x12, 0x18, 0x13, 0x88, 0x08, 0x22, 0x00,
+  0x11, 0x14, 0x10, 0x48, 0x28, 0x84, 0x04, 0x00, 0x82, 0x00, 0x10, 0xc4,
+  0x24, 0x22, 0x38, 0xcb, 0x09, 0xf1, 0x2c, 0x10, 0xf2, 0x9c, 0xd9, 0x40,
+  0x08, 0x48, 0x48, 0x00, 0x20, 0x02, 0x00, 0x44, 0x21, 0x28, 0x28, 0x90,
+  0x82, 0x00, 0x4c, 0x64, 0x24, 0x22, 0x31, 0x21, 0x18, 0x18, 0x88, 0x88,
+  0x10, 0x08, 0x12, 0x1c, 0x81, 0x38, 0x88, 0x84, 0x42, 0x48, 0x00, 0x44,
+  0x84, 0x20, 0x04, 0x40, 0x46, 0x84, 0x02, 0x90, 0x82, 0x90, 0x14, 0x46,
+  0x04, 0x10, 0x12, 0xf2, 0x16, 0xc3, 0x89, 0x05, 0xf1, 0x12, 0x10, 0x42,
+  0x84, 0x81, 0x02, 0x40, 0x01, 0x40, 0x08, 0x10, 0x02, 0x18, 0x80, 0x08,
+  0x48, 0x10, 0x02, 0x1c, 0x04, 0x40, 0x08, 0x4c, 0x04, 0x00, 0x21, 0x12,
+  0x00, 0x21, 0x44, 0x80, 0x02, 0x11, 0x00, 0x1a, 0x00, 0xc0, 0x7f, 0x7b,
+  0x04, 0x00, 0x00, 0x24, 0x00, 0x00, 0x4a, 0x18, 0x08, 0x42, 0xe7, 0x02,
+  0x02, 0xb3, 0x09, 0x11, 0x80, 0xd1, 0x00, 0x30, 0x40, 0x21, 0x04, 0x80,
+  0x03, 0xf0, 0x33, 0x81, 0x40, 0x24, 0x08, 0x81, 0xf0, 0x5b, 0x68, 0x50,
+  0x88, 0x87, 0x84, 0x4e, 0x44, 0x4a, 0x04, 0x10, 0x09, 0x1c, 0x04, 0x41,
+  0x45, 0x78, 0x2c, 0x24, 0xa2, 0x22, 0x18, 0x00, 0x00, 0x24, 0x24, 0x25,
+  0x32, 0x16, 0x12, 0x9e, 0x11, 0x83, 0xe8, 0x28, 0x08, 0x40, 0x12, 0x51,
+  0x11, 0x35, 0x11, 0x18, 0x78, 0x58, 0xe8, 0x44, 0xa4, 0x44, 0x10, 0x04,
+  0x00, 0x91, 0x41, 0x45, 0x78, 0x24, 0x24, 0x22, 0x02, 0x26, 0x00, 0x50,
+  0x24, 0x63, 0xf1, 0xc2, 0x2e, 0xe3, 0x03, 0x71, 0x00, 0x28, 0x40, 0x08,
+  0x10, 0x14, 0xa2, 0x14, 0x04, 0xf0, 0x31, 0x4d, 0x22, 0x14, 0xa0, 0x21,
+  0x20, 0x18, 0x08, 0x40, 0x02, 0x19, 0x01, 0x1a, 0x18, 0x88, 0xa8, 0x84,
+  0x00, 0x14, 0x10, 0x01, 0x84, 0x50, 0x24, 0x4a, 0x82, 0x06, 0x80, 0x08,
+  0x40, 0x04, 0x45, 0x02, 0x7f, 0x2f, 0x01, 0x00, 0x00, 0x49, 0x42, 0x05,
+  0x11, 0x00, 0x80, 0x04, 0x48, 0x00, 0x80, 0x88, 0x11, 0x84, 0x08, 0x20,
+  0x02, 0x10, 0x01, 0x48, 0x80, 0x04, 0x40, 0x02, 0x00, 0x00, 0x10, 0x1e,
+  0x04, 0xb1, 0x89, 0x04, 0x00, 0x21, 0x18, 0x12, 0x00, 0x41, 0x00, 0x5d,
+  0xf3, 0x4a, 0x05, 0x10, 0x48, 0x4a, 0x0f, 0x00, 0xc4, 0x00, 0x40, 0x02,
+  0x00, 0x00, 0x21, 0x65, 0x05, 0x10, 0x14, 0xd8, 0x00, 0x00, 0x62, 0x04,
+  0xf0, 0x80, 0x00, 0x00, 0x00, 0x5f, 0xab, 0x04, 0x00, 0x20, 0xc2, 0x24,
+  0x54, 0x80, 0x62, 0x24, 0x81, 0x20, 0x31, 0x48, 0x21, 0x52, 0x11, 0x40,
+  0x18, 0xc8, 0x44, 0x43, 0x94, 0x24, 0xc3, 0x02, 0x00, 0x20, 0xc4, 0x44,
+  0x21, 0x00, 0x18, 0x1a, 0xa8, 0x81, 0x92, 0x00, 0x40, 0x12, 0x54, 0x81,
+  0x70, 0x41, 0x18, 0x01, 0x24, 0x42, 0x20, 0x01, 0x21, 0x90, 0x18, 0x44,
+  0x4b, 0x8c, 0x10, 0x14, 0xf4, 0x65, 0xe6, 0x00, 0x41, 0x00, 0x24, 0x11,
+  0x11, 0x11, 0xa0, 0x48, 0x00, 0x20, 0x04, 0x24, 0x82, 0x88, 0x00, 0x8a,
+  0x02, 0x11, 0x43, 0x22, 0x72, 0x28, 0x41, 0x09, 0x25, 0x98, 0x28, 0x2c,
+  0xc2, 0x12, 0x10, 0x04, 0x20, 0x21, 0x08, 0x00, 0x18, 0x1a, 0xc8, 0xc2,
+  0x83, 0x08, 0x12, 0x10, 0x62, 0x14, 0x2c, 0x21, 0x88, 0xe8, 0x41, 0x04,
+  0x00, 0x81, 0xf0, 0x4e, 0x51, 0x00, 0x40, 0x04, 0x25, 0x11, 0x14, 0x28,
+  0x13, 0x19, 0x11, 0x78, 0x48, 0x02, 0x40, 0x81, 0x01, 0xa0, 0x51, 0x51,
+  0x88, 0x64, 0x03, 0xf0, 0x50, 0x24, 0x50, 0x24, 0x48, 0x42, 0x16, 0x42,
+  0x02, 0x30, 0x84, 0x44, 0x13, 0x18, 0x52, 0x41, 0x10, 0x11, 0x08, 0x81,
+  0x83, 0x14, 0x28, 0x04, 0x00, 0x8c, 0x01, 0x49, 0x04, 0x41, 0x00, 0xff,
+  0x58, 0x07, 0x6f, 0x62, 0xd2, 0x22, 0xa2, 0x12, 0x2b, 0x11, 0x90, 0x12,
+  0xc0, 0x12, 0x25, 0x92, 0x82, 0x2f, 0x31, 0xf1, 0x13, 0x11, 0x1b, 0x98,
+  0x9e, 0x99, 0x8d, 0x88, 0x8f, 0x18, 0xe4, 0x84, 0x24, 0xd4, 0x91, 0x54,
+  0x11, 0x1c, 0x54, 0x99, 0x85, 0xe8, 0x84, 0xf4, 0x48, 0x4c, 0x4d, 0x44,
+  0x4b, 0x24, 0x2e, 0x24, 0x22, 0x4c, 0x02, 0x28, 0x45, 0x54, 0x44, 0x2e,
+  0x24, 0x67, 0x62, 0x25, 0x3a, 0x00, 0x6a, 0x1a, 0xb8, 0x82, 0x29, 0xc8,
+  0x92, 0x3c, 0x00, 0xf0, 0x58, 0x8b, 0x48, 0x4e, 0x48, 0x42, 0x8c, 0x04,
+  0x48, 0x85, 0x58, 0x88, 0x4e, 0x48, 0xef, 0x91, 0x08, 0x6f, 0x22, 0x52,
+  0x22, 0x2a, 0xa1, 0x21, 0x23, 0x01, 0x00, 0x25, 0x12, 0xc3, 0x13, 0x1f,
+  0x11, 0x91, 0x89, 0x9e, 0xc8, 0x85, 0xb9, 0x88, 0xa4, 0xc4, 0x46, 0x48,
+  0xd1, 0x11, 0x04, 0x15, 0x58, 0x88, 0x49, 0xf4, 0x48, 0x64, 0x45, 0xb4,
+  0x44, 0xa2, 0x62, 0x26, 0x04, 0x28, 0x28, 0x44, 0x45, 0x86, 0xf2, 0x26,
+  0x22, 0x27, 0x21, 0x98, 0x1a, 0xb1, 0x12, 0xa8, 0x88, 0x8a, 0x01, 0x2d,
+  0x82, 0x31, 0x3c, 0xf1, 0x11, 0x11, 0x99, 0xe8, 0x89, 0x5c, 0x98, 0x8b,
+  0x48, 0x4a, 0x6c, 0x84, 0x80, 0x04, 0x84, 0x85, 0x98, 0x44, 0x8f, 0xa4,
+  0xd3, 0x06, 0x0f, 0x01, 0x00, 0x07, 0x3f, 0xf0, 0x4f, 0xfe, 0x16, 0x00,
+  0x00, 0x07, 0x01, 0x00, 0x3f, 0xff, 0xe4, 0x0f, 0x16, 0x00, 0x00, 0x06,
+  0x01, 0x00, 0x0f, 0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfc, 0xff, 0x7f,
+  0x80, 0x02, 0x94, 0x40, 0xf8, 0x24, 0x48, 0x12, 0x43, 0x32, 0x15, 0x45,
+  0x01, 0x20, 0x48, 0x43, 0x42, 0x46, 0x24, 0x81, 0xe2, 0x28, 0x02, 0x42,
+  0x41, 0x25, 0xb4, 0x22, 0x54, 0x41, 0x18, 0x1d, 0x14, 0x89, 0xa9, 0xa4,
+  0x8b, 0x94, 0x4c, 0x38, 0x48, 0x83, 0x24, 0x04, 0x84, 0x14, 0x00, 0x30,
+  0x14, 0x49, 0x14, 0x41, 0x21, 0x08, 0x86, 0x48, 0x44, 0x04, 0x64, 0x20,
+  0x69, 0x24, 0x92, 0xd2, 0x45, 0xf8, 0xfa, 0xed, 0xe0, 0x14, 0xd2, 0xa1,
+  0x54, 0x81, 0x48, 0x9d, 0x44, 0x27, 0x44, 0x24, 0x4f, 0x82, 0xc4, 0x42,
+  0x2a, 0x34, 0x22, 0x8a, 0x92, 0x3c, 0x44, 0x4e, 0xa4, 0x47, 0x82, 0x22,
+  0x36, 0xd2, 0x68, 0xa2, 0x58, 0x2b, 0x14, 0x98, 0x83, 0xf9, 0x82, 0x18,
+  0x4a, 0xe8, 0x31, 0x88, 0xd3, 0x23, 0xf8, 0x88, 0x22, 0x11, 0x9c, 0x41,
+  0x35, 0x48, 0x17, 0x28, 0x54, 0x14, 0x9b, 0x41, 0x25, 0xd1, 0x28, 0x74,
+  0x4c, 0x31, 0x4c, 0x8f, 0x68, 0x34, 0x48, 0x88, 0x43, 0x55, 0x42, 0x12,
+  0xc1, 0x44, 0x19, 0x54, 0x22, 0x45, 0x22, 0xc1, 0x16, 0x90, 0x92, 0x81,
+  0x24, 0x2c, 0xf9, 0xd6, 0xa4, 0x00, 0x22, 0x84, 0x91, 0x4c, 0x84, 0x54,
+  0x84, 0x00, 0x14, 0x27, 0x52, 0x82, 0x89, 0x42, 0x24, 0x44, 0x82, 0x02,
+  0x8c, 0x21, 0x85, 0x84, 0x21, 0x44, 0xc4, 0x44, 0x80, 0xc1, 0x82, 0x19,
+  0x48, 0xa1, 0x43, 0x1c, 0x51, 0x84, 0x34, 0x46, 0x01, 0x8c, 0x15, 0x1a,
+  0x09, 0x00, 0x49, 0x21, 0xa8, 0x41, 0x25, 0xa5, 0x18, 0x81, 0x86, 0x04,
+  0x40, 0x04, 0x2c, 0x01, 0x23, 0x04, 0x4a, 0x58, 0x42, 0x6f, 0x3d, 0x0f,
+  0x4e, 0x21, 0x11, 0x21, 0x00, 0x25, 0x48, 0x32, 0x18, 0x42, 0x2b, 0x21,
+  0x00, 0x18, 0x88, 0x1c, 0x48, 0x48, 0x16, 0x14, 0x82, 0x02, 0x21, 0x89,
+  0x18, 0x88, 0xe8, 0x1a, 0x64, 0x42, 0x60, 0x42, 0x98, 0x60, 0xcc, 0x42,
+  0x81, 0x44, 0x48, 0x40, 0x41, 0x12, 0x48, 0x68, 0x28, 0x40, 0x54, 0x14,
+  0x00, 0x10, 0xc8, 0x41, 0x44, 0x40, 0x02, 0x82, 0x90, 0x8a, 0xb0, 0x88,
+  0xf1, 0x54, 0xc1, 0x14, 0x20, 0x04, 0x48, 0x10, 0x84, 0x62, 0x44, 0x44,
+  0x41, 0x80, 0x02, 0x20, 0x12, 0x04, 0x12, 0x28, 0x2d, 0x82, 0x1a, 0x08,
+  0x20, 0x48, 0x02, 0x11, 0x2d, 0x11, 0x00, 0x1d, 0x88, 0x00, 0x00, 0x14,
+  0x11, 0x00, 0x41, 0x48, 0x8c, 0x04, 0x00, 0x00, 0x00, 0x44, 0x21, 0x21,
+  0x43, 0x01, 0x20, 0x81, 0x01, 0xb0, 0xbf, 0x0a, 0x40, 0x18, 0x01, 0x94,
+  0x20, 0x24, 0x82, 0x82, 0x04, 0x10, 0x04, 0x45, 0x82, 0x02, 0x22, 0x44,
+  0x80, 0x22, 0x28, 0x71, 0x12, 0x02, 0x12, 0x21, 0xd0, 0x28, 0x11, 0x08,
+  0x20, 0x28, 0x4c, 0x08, 0x00, 0x48, 0x1c, 0x14, 0x14, 0x34, 0x48, 0x42,
+  0x00, 0x10, 0x04, 0x00, 0x24, 0x10, 0x24, 0x21, 0x08, 0x18, 0xf0, 0x44,
+  0x87, 0xa0, 0x01, 0x19, 0x88, 0x0e, 0x00, 0xf0, 0xc2, 0xf0, 0x1d, 0xab,
+  0x00, 0x19, 0x02, 0x25, 0x84, 0x04, 0x22, 0x14, 0x10, 0x74, 0x82, 0x08,
+  0xc2, 0x11, 0x42, 0x21, 0x84, 0x10, 0x02, 0x40, 0x2c, 0x01, 0x82, 0x00,
+  0x81, 0x20, 0x14, 0x41, 0x22, 0x81, 0x04, 0x00, 0x40, 0x25, 0x44, 0x21,
+  0x1c, 0xe1, 0x44, 0x11, 0x14, 0x18, 0xa1, 0x94, 0x19, 0x84, 0x08, 0x80,
+  0x04, 0x81, 0x18, 0x10, 0x54, 0x24, 0xbf, 0x54, 0x07, 0x2c, 0x02, 0x40,
+  0x43, 0x48, 0x32, 0x18, 0x80, 0x95, 0x21, 0x00, 0x10, 0xd8, 0x82, 0x48,
+  0x04, 0x4b, 0x12, 0xc2, 0x84, 0xf8, 0x42, 0x82, 0x40, 0x78, 0x24, 0x42,
+  0x11, 0x64, 0x11, 0x1e, 0x28, 0x16, 0x04, 0x00, 0x19, 0x41, 0x62, 0x11,
+  0x60, 0x29, 0x84, 0x12, 0x25, 0x38, 0x84, 0x81, 0x11, 0x82, 0x10, 0x58,
+  0x24, 0x42, 0x44, 0x23, 0x04, 0x92, 0x80, 0x84, 0x24, 0x08, 0x6d, 0x23,
+  0x14, 0x24, 0x19, 0x02, 0x15, 0x84, 0x04, 0x23, 0x42, 0x81, 0x91, 0x25,
+  0x81, 0x20, 0x58, 0x28, 0xc8, 0x61, 0x20, 0x83, 0x1c, 0x88, 0x48, 0x8c,
+  0x09, 0x82, 0x00, 0x84, 0x14, 0x8c, 0x15, 0x01, 0x12, 0x42, 0x13, 0x41,
+  0x12, 0x01, 0x54, 0x48, 0x14, 0x23, 0x9c, 0x81, 0x87, 0x41, 0x44, 0x88,
+  0x11, 0x89, 0x98, 0x44, 0x23, 0x04, 0x23, 0x84, 0x84, 0x09, 0x18, 0x42,
+  0x49, 0x08, 0x5f, 0xee, 0x08, 0x22, 0x40, 0x02, 0xa1, 0x90, 0x18, 0x20,
+  0x04, 0x29, 0x08, 0x42, 0x11, 0x81, 0x10, 0x18, 0x14, 0x02, 0x4a, 0x83,
+  0x04, 0x10, 0x7d, 0x00, 0xf0, 0xff, 0x59, 0x24, 0x21, 0x62, 0x41, 0x24,
+  0x00, 0x00, 0x12, 0x20, 0x19, 0x2a, 0x11, 0x48, 0x24, 0x14, 0x11, 0x08,
+  0x4a, 0x11, 0x81, 0x18, 0x04, 0x00, 0x84, 0x42, 0x00, 0x41, 0x2c, 0x0f,
+  0x22, 0x00, 0x11, 0x10, 0x11, 0x02, 0x21, 0x10, 0x02, 0x10, 0x01, 0x10,
+  0x02, 0x20, 0x01, 0x00, 0x20, 0xa4, 0x42, 0x00, 0x12, 0x8c, 0x81, 0x02,
+  0x00, 0x00, 0xa0, 0x12, 0x10, 0x02, 0x18, 0x48, 0x00, 0x00, 0x00, 0x18,
+  0x12, 0x25, 0x02, 0x00, 0x18, 0x48, 0x00, 0xdf, 0xa8, 0x08, 0x10, 0x41,
+  0x01, 0x19, 0x02, 0x22, 0x18, 0x10, 0x01, 0x21, 0x40, 0x1a, 0x31, 0x12,
+  0x4a, 0x02, 0x30, 0x42, 0x72, 0x81, 0x1a, 0x02, 0x00, 0x2b, 0x41, 0x20,
+  0x04, 0x27, 0x24, 0x90, 0x52, 0x12, 0x2d, 0x44, 0x00, 0x21, 0x18, 0x24,
+  0x40, 0x48, 0x04, 0x19, 0x04, 0x2c, 0x04, 0x21, 0x80, 0x04, 0x18, 0x80,
+  0x24, 0x28, 0x81, 0x04, 0x3f, 0xc1, 0x09, 0x28, 0x11, 0x14, 0x20, 0x02,
+  0x22, 0x00, 0x11, 0x00, 0x00, 0x60, 0x21, 0x22, 0x00, 0x48, 0x10, 0x28,
+  0x02, 0x20, 0x22, 0x04, 0x42, 0x89, 0x21, 0x14, 0x82, 0x04, 0x00, 0x90,
+  0x22, 0x00, 0x21, 0x84, 0x48, 0x30, 0x41, 0x00, 0x24, 0x20, 0x01, 0x24,
+  0x00, 0x42, 0x92, 0x42, 0x48, 0xf0, 0x7e, 0x8a, 0x00, 0x00, 0x11, 0x11,
+  0x14, 0x21, 0x18, 0x21, 0x50, 0x22, 0x00, 0x15, 0x58, 0x32, 0x80, 0x04,
+  0x90, 0x12, 0x6a, 0x01, 0x18, 0x80, 0x64, 0x24, 0x12, 0x20, 0x41, 0x22,
+  0x42, 0x22, 0xc1, 0x12, 0x49, 0x04, 0x80, 0x21, 0x11, 0x02, 0x18, 0x41,
+  0x00, 0x80, 0x14, 0x02, 0xa0, 0x41, 0x21, 0x12, 0x00, 0x80, 0x01, 0xf0,
+  0xad, 0x69, 0x20, 0x04, 0x2c, 0x02, 0x00, 0x40, 0x02, 0x41, 0x86, 0xd1,
+  0x22, 0xc4, 0x22, 0x10, 0x22, 0x08, 0x00, 0x40, 0xa1, 0x24, 0xb0, 0x46,
+  0x41, 0x04, 0x24, 0x4a, 0x02, 0x2a, 0x24, 0x88, 0x04, 0x00, 0x46, 0x84,
+  0x14, 0x21, 0x01, 0x00, 0x84, 0x16, 0x24, 0x84, 0x28, 0x04, 0x11, 0x48,
+  0x41, 0x20, 0x24, 0x02, 0x26, 0x02, 0x00, 0xdf, 0x61, 0x08, 0x23, 0x22,
+  0x46, 0x01, 0x12, 0x42, 0x18, 0x22, 0x00, 0x32, 0x80, 0x02, 0x44, 0x25,
+  0x08, 0xb0, 0x48, 0xe1, 0x82, 0x04, 0x00, 0x29, 0x01, 0x00, 0x40, 0x43,
+  0x82, 0x01, 0x42, 0x00, 0x18, 0x48, 0x60, 0x28, 0x00, 0x41, 0x44, 0x00,
+  0x00, 0x22, 0x00, 0x20, 0x08, 0x41, 0x43, 0x64, 0x64, 0x00, 0xc4, 0xef,
+  0x26, 0x03, 0x00, 0x80, 0x42, 0x48, 0x0a, 0x80, 0x24, 0x02, 0x12, 0x00,
+  0x20, 0x04, 0x21, 0x22, 0x24, 0x00, 0x1f, 0x00, 0xf0, 0xa1, 0x00, 0x00,
+  0x00, 0x14, 0x28, 0x00, 0x42, 0x00, 0x20, 0x0c, 0x1c, 0x01, 0x80, 0x04,
+  0xb0, 0x24, 0x14, 0x08, 0x00, 0x44, 0x48, 0xf0, 0x57, 0x4a, 0xa0, 0x24,
+  0x28, 0x26, 0x82, 0x62, 0x81, 0x81, 0x00, 0x60, 0x42, 0x2a, 0x91, 0x42,
+  0x24, 0x10, 0xd2, 0x82, 0x0c, 0x90, 0x58, 0x2c, 0x46, 0x21, 0x02, 0x46,
+  0x04, 0x40, 0x02, 0x15, 0xc2, 0x42, 0x1a, 0x28, 0x24, 0x04, 0x30, 0x15,
+  0x10, 0x01, 0x21, 0x00, 0x41, 0x8a, 0x04, 0x13, 0x08, 0x20, 0x84, 0x04,
+  0x66, 0x94, 0x48, 0x41, 0x41, 0x46, 0x14, 0x04, 0x45, 0xf8, 0xa6, 0x9c,
+  0x10, 0x02, 0x14, 0x00, 0x48, 0x29, 0x81, 0x32, 0x42, 0xc0, 0x81, 0x12,
+  0x21, 0x40, 0x04, 0x24, 0x80, 0x42, 0x08, 0x48, 0x00, 0x44, 0x80, 0xa2,
+  0x42, 0x20, 0x02, 0x00, 0x00, 0x48, 0x28, 0x20, 0x29, 0x04, 0x41, 0x84,
+  0x49, 0x81, 0x84, 0x81, 0x04, 0x11, 0x10, 0x84, 0x08, 0x28, 0x48, 0x28,
+  0x20, 0x04, 0x5d, 0xa7, 0x00, 0x11, 0x11, 0x40, 0x48, 0x08, 0x30, 0x42,
+  0x24, 0x18, 0x11, 0x23, 0x04, 0x21, 0x28, 0x21, 0x42, 0x20, 0x04, 0x20,
+  0x01, 0x42, 0x24, 0x80, 0x04, 0x22, 0x50, 0x22, 0x40, 0xe2, 0x21, 0x04,
+  0x48, 0x24, 0x48, 0x00, 0x00, 0x42, 0xb1, 0x00, 0xf0, 0x46, 0x10, 0x02,
+  0x00, 0x00, 0x1e, 0xc7, 0x80, 0x02, 0x48, 0x42, 0x80, 0x82, 0x94, 0x42,
+  0x00, 0x28, 0x21, 0x10, 0xa2, 0x42, 0x21, 0x22, 0x20, 0x22, 0x11, 0x02,
+  0x22, 0x00, 0x60, 0x22, 0x80, 0x44, 0x22, 0x02, 0x24, 0x00, 0x00, 0x48,
+  0x24, 0x58, 0x12, 0x00, 0x00, 0x82, 0xa0, 0x84, 0x82, 0x20, 0x04, 0x82,
+  0x82, 0xc0, 0x41, 0x00, 0x84, 0xaf, 0x67, 0x03, 0x48, 0x28, 0x00, 0x4a,
+  0x02, 0x84, 0x00, 0x42, 0x4a, 0x22, 0x62, 0x11, 0x00, 0x42, 0x62, 0x22,
+  0x20, 0x85, 0x21, 0x02, 0x00, 0x22, 0x12, 0x00, 0x60, 0x22, 0x48, 0x6e,
+  0x00, 0xf2, 0x02, 0x80, 0x01, 0x42, 0x48, 0x80, 0x28, 0x04, 0x00, 0x80,
+  0x04, 0x00, 0x00, 0x48, 0x00, 0x1f, 0x49, 0x08, 0x64, 0x03, 0xd0, 0x80,
+  0x82, 0x01, 0x00, 0x00, 0x20, 0x21, 0xa2, 0x42, 0x18, 0x42, 0x00, 0x80,
+  0x27, 0x00, 0x31, 0x04, 0x48, 0x12, 0x19, 0x00, 0xf0, 0x21, 0x8a, 0x04,
+  0x82, 0x00, 0x20, 0x08, 0x88, 0xf0, 0xc1, 0x4c, 0x00, 0x00, 0x48, 0x10,
+  0x08, 0x10, 0x82, 0x02, 0x12, 0x29, 0x04, 0x22, 0x80, 0x04, 0x18, 0x20,
+  0x04, 0xa0, 0x14, 0x00, 0x29, 0xa1, 0x14, 0x42, 0x20, 0x04, 0x23, 0x21,
+  0x24, 0x04, 0x42, 0x2c, 0x21, 0x05, 0x00, 0x80, 0x84, 0x04, 0x58, 0x00,
+  0xf0, 0x1e, 0x21, 0x00, 0x00, 0x25, 0xf9, 0xd5, 0x35, 0x00, 0x10, 0x81,
+  0x12, 0x08, 0x10, 0x0a, 0x00, 0x31, 0x22, 0x29, 0x02, 0x21, 0x00, 0x00,
+  0x00, 0x23, 0x05, 0x18, 0x12, 0x46, 0x22, 0x02, 0x42, 0x18, 0x48, 0x46,
+  0x02, 0x25, 0x22, 0x04, 0x48, 0x24, 0x80, 0x04, 0x00, 0x20, 0x62, 0x06,
+  0x00, 0xf1, 0x0e, 0x21, 0x00, 0x00, 0x21, 0xf0, 0xbb, 0xf5, 0x20, 0x02,
+  0x00, 0x20, 0x24, 0x24, 0x04, 0x00, 0x48, 0x18, 0x68, 0x00, 0x80, 0xa4,
+  0x24, 0x00, 0x42, 0x10, 0x82, 0x05, 0x22, 0x00, 0x02, 0x03, 0xf0, 0x1c,
+  0x00, 0x48, 0x80, 0x04, 0x00, 0x80, 0x08, 0x00, 0x88, 0x80, 0x02, 0x82,
+  0x48, 0x20, 0x88, 0xf8, 0x8c, 0xf5, 0x00, 0x26, 0x01, 0x20, 0x02, 0x00,
+  0x12, 0x00, 0x22, 0x14, 0x10, 0x82, 0x92, 0x12, 0x28, 0x20, 0x22, 0x94,
+  0x22, 0x48, 0x21, 0xa0, 0x25, 0x48, 0x20, 0x27, 0x03, 0x51, 0x00, 0x00,
+  0x80, 0x04, 0x48, 0x04, 0x00, 0xf0, 0x30, 0x24, 0x00, 0x00, 0x42, 0x24,
   0x42, 0x3f, 0x84, 0x02, 0x84, 0x80, 0x04, 0x30, 0x21, 0x84, 0x28, 0x00,
   0xc0, 0x14, 0x80, 0x06, 0x00, 0x00, 0x20, 0x81, 0x11, 0x02, 0x18, 0x80,
   0x88, 0x01, 0x80, 0x04, 0x1c, 0x24, 0x01, 0x84, 0x12, 0x58, 0x00, 0x00,
   0x00, 0x42, 0x48, 0x44, 0x80, 0x82, 0x04, 0x00, 0x00, 0x10, 0x12, 0x02,
-  0x5f, 0xd2, 0x0b, 0x6a, 0x02, 0x14, 0x48, 0x48, 0x1b, 0x22, 0x00, 0x20,
-  0xa4, 0x42, 0x52, 0x33, 0x21, 0x24, 0xa1, 0x24, 0x29, 0x22, 0xa4, 0x34,
+  0x5f, 0xd2, 0x0b, 0x6a, 0x02, 0x14, 0x48, 0x48, 0x1b, 0x22, 0x7b, 0x03,
+  0xf2, 0xb8, 0x52, 0x33, 0x21, 0x24, 0xa1, 0x24, 0x29, 0x22, 0xa4, 0x34,
   0x46, 0xe2, 0x21, 0xa1, 0x11, 0x6e, 0x22, 0x1a, 0x24, 0xe4, 0x24, 0x81,
   0xa2, 0x42, 0x4a, 0x04, 0x2b, 0x65, 0x42, 0x80, 0xa5, 0x44, 0x23, 0x24,
   0x01, 0x42, 0x42, 0x42, 0x00, 0x42, 0xc8, 0x42, 0x30, 0x42, 0x20, 0x28,
@@ -5509,656 +4516,520 @@ const unsigned char USB_1608G_rbf[] = {
   0x2d, 0x12, 0x2b, 0x11, 0x12, 0x4e, 0x22, 0x90, 0x42, 0x27, 0x24, 0x21,
   0x2d, 0x12, 0x20, 0x64, 0x21, 0x2f, 0x21, 0xb5, 0x12, 0x81, 0x24, 0xa4,
   0x44, 0x48, 0x42, 0x8a, 0x84, 0xa4, 0x48, 0x00, 0x88, 0x86, 0x62, 0x2a,
-  0x00, 0x2c, 0x04, 0x86, 0x92, 0x48, 0x4f, 0x71, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x80, 0x04, 0x12, 0x20, 0x01, 0x00,
-  0x18, 0x00, 0x10, 0x02, 0x18, 0x00, 0x80, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0xf0, 0xd4, 0x21,
-  0xa0, 0x22, 0x2a, 0x02, 0x2a, 0xf2, 0x28, 0x28, 0x9f, 0x92, 0xf2, 0x48,
-  0x48, 0x2b, 0x66, 0x2b, 0x11, 0x2a, 0xa2, 0x22, 0x3f, 0x12, 0xb2, 0x42,
-  0xb5, 0x42, 0x14, 0xb2, 0x22, 0xb2, 0x32, 0xa3, 0x66, 0x7a, 0xa7, 0x22,
-  0x12, 0x6a, 0xa2, 0x66, 0x00, 0x2e, 0x62, 0x7e, 0x62, 0x2a, 0xa2, 0x55,
-  0x6e, 0x62, 0x7e, 0x72, 0x2f, 0x24, 0xe4, 0x25, 0xc4, 0x42, 0x2b, 0x44,
-  0x4a, 0x24, 0x41, 0x62, 0x21, 0x48, 0x80, 0x04, 0xa0, 0x44, 0x48, 0x8e,
-  0x82, 0x23, 0xa4, 0x4c, 0xca, 0x04, 0x8a, 0xa8, 0x2a, 0x82, 0xa0, 0xcc,
-  0xca, 0x5c, 0x88, 0x4a, 0xf4, 0x9f, 0x55, 0xa0, 0x66, 0x1f, 0x96, 0x56,
-  0x11, 0x2a, 0xf6, 0x68, 0x48, 0x9f, 0x96, 0xf6, 0x48, 0x48, 0xaf, 0x86,
-  0xb6, 0x52, 0xa5, 0x66, 0x4f, 0x46, 0xf6, 0x53, 0x61, 0x2f, 0x45, 0xb6,
-  0x42, 0xb4, 0x42, 0xb4, 0x62, 0xb4, 0x32, 0xa3, 0x62, 0x7a, 0xa3, 0x36,
-  0x58, 0x2b, 0x76, 0x7a, 0x87, 0xa5, 0x44, 0xae, 0xe2, 0x7e, 0x72, 0x2a,
-  0xae, 0x11, 0x2e, 0x42, 0x3e, 0x32, 0x1d, 0x43, 0x5e, 0x52, 0x34, 0xa5,
-  0x88, 0xc4, 0x48, 0x1e, 0x12, 0x1e, 0x12, 0x4a, 0x24, 0xa4, 0x44, 0x42,
-  0x48, 0xca, 0xfc, 0xe4, 0xe4, 0x6e, 0x22, 0x2f, 0x4a, 0xaa, 0x4c, 0xca,
-  0xa2, 0x8c, 0x8e, 0x82, 0x2f, 0x2a, 0x32, 0x82, 0x8a, 0xa8, 0xcc, 0x2b,
-  0xcc, 0x85, 0xa8, 0xdd, 0x8f, 0xac, 0x01, 0x6a, 0x86, 0x06, 0x2a, 0xf2,
-  0x68, 0x68, 0x9f, 0x96, 0xf6, 0x48, 0x48, 0x8f, 0x86, 0xb6, 0x52, 0xa5,
-  0x66, 0x6e, 0x64, 0x1b, 0x66, 0x2b, 0x74, 0x4a, 0xb4, 0x42, 0xa4, 0x66,
-  0x2b, 0x33, 0x6a, 0xa4, 0x77, 0x6a, 0xa7, 0x11, 0x23, 0xa7, 0x67, 0x4a,
-  0x05, 0x2e, 0xc2, 0x7a, 0xa6, 0x77, 0x5a, 0xa5, 0x66, 0x7a, 0xf7, 0x42,
-  0x43, 0x5a, 0xc4, 0x52, 0x4e, 0x48, 0x4a, 0xa4, 0x41, 0x24, 0x12, 0x1a,
-  0x05, 0x48, 0x20, 0xa4, 0xcc, 0x8e, 0xc4, 0x8e, 0x82, 0x2b, 0x24, 0x4a,
-  0xac, 0x44, 0x8a, 0x08, 0x2a, 0x0a, 0x8a, 0xa8, 0x44, 0x29, 0xa4, 0x88,
-  0x8f, 0x8c, 0xed, 0x84, 0x08, 0x6a, 0xf6, 0x29, 0x61, 0x11, 0x6a, 0xe2,
-  0x86, 0xf6, 0x69, 0x69, 0x8d, 0x48, 0xaf, 0x86, 0xb6, 0x52, 0xa5, 0x66,
-  0x6e, 0x64, 0x3f, 0x17, 0xb7, 0x56, 0x35, 0x42, 0x2b, 0x44, 0x2b, 0x66,
-  0x2b, 0x33, 0x6a, 0xa6, 0x37, 0x6a, 0x83, 0xa5, 0x76, 0x7a, 0x87, 0xa4,
-  0x44, 0x2e, 0xe2, 0x7e, 0x72, 0xaa, 0xa6, 0x55, 0x2e, 0x62, 0x7e, 0x32,
-  0x4e, 0x43, 0x5e, 0x52, 0x1f, 0x24, 0xf5, 0x42, 0x48, 0x48, 0x8b, 0x11,
-  0x1e, 0x12, 0x1e, 0x12, 0x4a, 0x24, 0xa4, 0x44, 0x42, 0x4a, 0xa4, 0xcc,
-  0xee, 0xe4, 0x6e, 0x22, 0x6b, 0xec, 0x4a, 0x2c, 0x26, 0xa4, 0x88, 0x2f,
-  0x22, 0x1a, 0x02, 0xca, 0xac, 0x44, 0x8a, 0xf8, 0xc8, 0xd8, 0xab, 0x83,
-  0x00, 0x40, 0x01, 0xc0, 0x48, 0x80, 0x04, 0x00, 0x1a, 0x04, 0x40, 0x82,
-  0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0xe2, 0x25, 0xa0, 0x48, 0x11, 0x00, 0x00, 0x81, 0x48, 0x23, 0x04, 0x10,
-  0x11, 0x82, 0x14, 0x02, 0x21, 0x00, 0x80, 0x81, 0x84, 0x01, 0x40, 0x22,
-  0x01, 0x40, 0x02, 0x24, 0x12, 0x24, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x81, 0x14, 0xbf, 0x16, 0x03,
-  0x2c, 0xf4, 0x11, 0x24, 0x85, 0xf2, 0x11, 0x24, 0x83, 0xf4, 0x11, 0x24,
-  0xa3, 0xd4, 0x41, 0xf2, 0x4a, 0x12, 0x1f, 0x41, 0xb2, 0x4a, 0xb9, 0x11,
-  0xb2, 0x4a, 0x39, 0x15, 0xab, 0x94, 0x43, 0xf2, 0x4a, 0x91, 0x43, 0xf2,
-  0x42, 0x93, 0x47, 0x83, 0x2d, 0x91, 0x4f, 0x83, 0xc4, 0x91, 0x4f, 0xa2,
-  0xe4, 0x14, 0xfa, 0x24, 0x4a, 0x16, 0xf1, 0x24, 0x5a, 0x96, 0xe1, 0xa2,
-  0x64, 0x59, 0x2d, 0x4a, 0x9e, 0x24, 0xac, 0xf5, 0x91, 0x24, 0x2c, 0xf5,
-  0x91, 0x24, 0x8d, 0x12, 0x1f, 0x49, 0xb2, 0x48, 0xf1, 0x91, 0x64, 0xab,
-  0x14, 0x1f, 0x48, 0xb6, 0x4a, 0xd1, 0x41, 0xb2, 0x4a, 0xb9, 0x81, 0xb6,
-  0x4a, 0x39, 0x85, 0xab, 0x94, 0x4b, 0x4a, 0xab, 0x94, 0x43, 0xba, 0x42,
-  0x79, 0xa4, 0x98, 0x92, 0x4f, 0x8a, 0x84, 0xf9, 0x24, 0x4a, 0x7f, 0x9e,
-  0x03, 0xac, 0xf4, 0x11, 0x44, 0x85, 0xf2, 0x11, 0x64, 0x83, 0x64, 0x41,
-  0xa3, 0xd4, 0x41, 0x32, 0x4a, 0x1d, 0x24, 0x8f, 0x44, 0x58, 0x41, 0xab,
-  0xb4, 0x51, 0xab, 0xb4, 0x41, 0xaf, 0x14, 0x18, 0xd4, 0x12, 0xf8, 0x24,
-  0x48, 0x2d, 0x81, 0x6d, 0x48, 0x4e, 0x81, 0x6f, 0xa2, 0xc5, 0x81, 0x4d,
-  0x9a, 0x4e, 0x81, 0x4f, 0xa2, 0x64, 0x1d, 0x8c, 0x64, 0x5d, 0xbc, 0xe4,
-  0x5c, 0xc2, 0x4a, 0x1f, 0xcc, 0xc2, 0x4a, 0x1f, 0x4d, 0xd2, 0x28, 0xf4,
-  0x81, 0x24, 0x81, 0x1f, 0x48, 0x12, 0xfa, 0x81, 0x24, 0xab, 0x14, 0x1d,
-  0x64, 0xaf, 0x42, 0x59, 0x41, 0xab, 0x34, 0x59, 0x96, 0x1a, 0x43, 0xb2,
-  0x4a, 0x11, 0xb4, 0x42, 0x73, 0x24, 0x98, 0x12, 0x67, 0x82, 0x18, 0x6f,
-  0xa2, 0xf5, 0xd1, 0x95, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x88, 0x00, 0x00, 0x40,
-  0x01, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x2f, 0xb2, 0x04, 0x60, 0x12, 0x00, 0x80, 0x02,
-  0x80, 0x04, 0x18, 0x00, 0x00, 0x28, 0x00, 0x18, 0x00, 0x62, 0x48, 0x00,
-  0x80, 0x04, 0x18, 0x24, 0x12, 0x48, 0x18, 0xa0, 0x41, 0x48, 0x12, 0x80,
-  0x21, 0x08, 0x42, 0x80, 0x04, 0x00, 0x20, 0x04, 0xa0, 0x14, 0x00, 0x20,
-  0x0c, 0x83, 0x14, 0xf8, 0x95, 0xbb, 0x20, 0x24, 0x08, 0x00, 0x24, 0x12,
-  0x24, 0x22, 0x15, 0x02, 0x81, 0x12, 0x24, 0x80, 0x21, 0x49, 0x82, 0x44,
-  0xa2, 0x14, 0x20, 0x81, 0x04, 0x22, 0x00, 0x48, 0x42, 0x48, 0x00, 0x48,
-  0x21, 0x10, 0x02, 0xa0, 0x24, 0x23, 0x11, 0x02, 0x00, 0x29, 0x84, 0x08,
-  0x80, 0x04, 0x80, 0x28, 0x04, 0x00, 0x14, 0xf0, 0x48, 0xfa, 0x20, 0x24,
-  0x06, 0x48, 0x40, 0x02, 0x24, 0x40, 0x92, 0x14, 0x84, 0x32, 0x24, 0x80,
-  0x22, 0x41, 0x82, 0x44, 0xc2, 0x52, 0x28, 0x1a, 0xa4, 0x41, 0x20, 0x88,
-  0x04, 0x42, 0x42, 0x29, 0x95, 0x41, 0x18, 0x42, 0xa9, 0x24, 0x14, 0x02,
-  0x48, 0xca, 0xc2, 0x12, 0x00, 0x00, 0x69, 0x84, 0x28, 0x22, 0x04, 0x80,
-  0x04, 0x42, 0xc0, 0x42, 0x60, 0x84, 0x12, 0xaf, 0x1a, 0x0c, 0x10, 0x01,
-  0x00, 0x28, 0x18, 0x20, 0x16, 0x01, 0x00, 0x00, 0x12, 0x88, 0x80, 0x01,
-  0x80, 0x04, 0x00, 0x22, 0x00, 0x12, 0x00, 0x00, 0x20, 0x01, 0x12, 0x20,
-  0x41, 0x02, 0x42, 0x20, 0x04, 0x00, 0x00, 0x42, 0x80, 0x21, 0x08, 0x80,
-  0x08, 0x40, 0xf8, 0xd4, 0x4a, 0x00, 0x00, 0x80, 0x01, 0x80, 0x04, 0x12,
-  0x22, 0x12, 0x00, 0x00, 0x20, 0x81, 0x02, 0x42, 0x20, 0x04, 0x42, 0x00,
-  0x20, 0x01, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x20, 0x08, 0x82, 0x00, 0x3f, 0xc1, 0x04, 0x28, 0x11,
-  0x22, 0x80, 0x42, 0x81, 0x81, 0x81, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x80,
-  0x24, 0x81, 0x02, 0x22, 0x00, 0xa0, 0x42, 0x12, 0x48, 0x12, 0x23, 0x26,
-  0xa2, 0x14, 0xa0, 0x41, 0x42, 0x18, 0x10, 0x82, 0x61, 0x24, 0x22, 0x22,
-  0x28, 0x48, 0x28, 0x20, 0x01, 0x00, 0x22, 0x19, 0x24, 0x82, 0x84, 0x42,
-  0x81, 0x24, 0xf4, 0xc6, 0xeb, 0x80, 0x12, 0x01, 0x80, 0x13, 0x01, 0x4a,
-  0x01, 0x80, 0x82, 0x01, 0x00, 0x00, 0x18, 0x22, 0x18, 0x00, 0x2a, 0x04,
-  0x00, 0x22, 0x12, 0x48, 0xa0, 0x42, 0x28, 0x48, 0xa0, 0x14, 0x28, 0x40,
-  0x02, 0x00, 0x22, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x19,
-  0x88, 0x04, 0x4f, 0xec, 0x0b, 0x00, 0x28, 0x00, 0x80, 0x01, 0x2a, 0x28,
-  0x01, 0x00, 0x00, 0x20, 0x02, 0x48, 0x20, 0x06, 0x00, 0x42, 0x80, 0x04,
-  0x12, 0x16, 0x02, 0x20, 0x01, 0x80, 0x24, 0x01, 0x80, 0xc1, 0x42, 0x18,
-  0x28, 0x20, 0x24, 0x82, 0x24, 0x01, 0x00, 0x28, 0x46, 0x81, 0x82, 0x24,
-  0x02, 0x80, 0xe4, 0x79, 0x03, 0x00, 0x28, 0x20, 0x21, 0x02, 0x28, 0x28,
-  0x00, 0x21, 0x2a, 0x01, 0x00, 0x49, 0x02, 0x48, 0x40, 0x21, 0x26, 0x82,
-  0x21, 0x02, 0x68, 0x4a, 0x42, 0x02, 0x18, 0x00, 0x10, 0xa2, 0x24, 0x00,
-  0x80, 0x82, 0x01, 0x28, 0x28, 0x42, 0x00, 0xa0, 0x24, 0x48, 0x00, 0x28,
-  0x20, 0x04, 0x22, 0x22, 0x88, 0xcf, 0x87, 0x0e, 0x20, 0x06, 0x22, 0x00,
-  0x28, 0x00, 0x80, 0x01, 0x28, 0xa0, 0x41, 0x32, 0x00, 0x20, 0x04, 0x00,
-  0x78, 0x48, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x80, 0x04, 0x80, 0x24,
-  0x84, 0x0c, 0x00, 0x20, 0x02, 0x28, 0x80, 0x82, 0x08, 0x00, 0x12, 0x00,
-  0xf0, 0xf6, 0x23, 0x80, 0x81, 0x01, 0x2c, 0x01, 0x00, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x30, 0x42, 0x80, 0x22, 0x02, 0x12, 0x00, 0x00, 0x12, 0x00,
-  0x20, 0x84, 0x84, 0x04, 0x18, 0x00, 0x22, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x04, 0x80, 0x02, 0x00, 0x42, 0x6f, 0xde, 0x06, 0x12, 0x12,
-  0x28, 0x24, 0x20, 0x02, 0x28, 0x00, 0x32, 0x21, 0x18, 0x80, 0x21, 0x12,
-  0x04, 0x48, 0x42, 0x14, 0x62, 0x32, 0x28, 0x48, 0x80, 0xa4, 0x25, 0x00,
-  0x00, 0x90, 0x44, 0x22, 0x4a, 0x01, 0x80, 0x82, 0x22, 0xa4, 0x4a, 0x80,
-  0x22, 0x04, 0x22, 0x00, 0x80, 0x02, 0x00, 0x42, 0x18, 0x22, 0x80, 0xf8,
-  0xba, 0x4e, 0x00, 0x28, 0xa0, 0x21, 0x18, 0x20, 0x02, 0x22, 0x00, 0x00,
-  0x20, 0x24, 0xc1, 0x22, 0x48, 0x20, 0x82, 0x02, 0x80, 0x84, 0x02, 0x28,
-  0x00, 0x21, 0x12, 0x48, 0x42, 0x24, 0x20, 0x02, 0x00, 0x42, 0x12, 0x80,
-  0x02, 0x00, 0x00, 0x48, 0x42, 0xa0, 0x84, 0x22, 0x20, 0x02, 0x80, 0x82,
-  0xf4, 0x89, 0x65, 0x00, 0x00, 0x20, 0x22, 0x02, 0x80, 0x02, 0x20, 0x01,
-  0x00, 0x20, 0x04, 0x28, 0x12, 0x18, 0x00, 0x20, 0x04, 0x48, 0x18, 0x12,
-  0x18, 0x00, 0x00, 0x22, 0x42, 0x20, 0x82, 0x01, 0x22, 0x2a, 0x01, 0x00,
-  0x88, 0x42, 0x20, 0x04, 0x48, 0x22, 0x00, 0x00, 0x00, 0xf0, 0x6a, 0xcd,
-  0x20, 0x01, 0x18, 0x18, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0xa0, 0x24, 0x20, 0x21, 0x02, 0x00, 0x12, 0x00, 0x00, 0x42, 0x00, 0x80,
-  0xa2, 0x41, 0x20, 0x02, 0x20, 0x04, 0x00, 0x48, 0x00, 0x28, 0x42, 0x20,
-  0x04, 0x00, 0x22, 0x00, 0xc8, 0xdf, 0x47, 0x03, 0x00, 0x00, 0x40, 0x22,
-  0x41, 0x02, 0x24, 0x40, 0x22, 0x43, 0x02, 0x26, 0x82, 0x41, 0x22, 0x42,
-  0x22, 0x04, 0x18, 0xb0, 0x42, 0x02, 0x23, 0x84, 0x14, 0x02, 0x23, 0x04,
-  0x29, 0x02, 0x23, 0x24, 0x12, 0x02, 0x21, 0x20, 0x01, 0x48, 0x00, 0x80,
-  0x04, 0x48, 0x80, 0x04, 0x48, 0x00, 0x20, 0x02, 0xf0, 0x62, 0x4b, 0x20,
-  0x04, 0x00, 0x12, 0x00, 0x80, 0x22, 0x02, 0x18, 0x00, 0x80, 0x01, 0x22,
-  0x80, 0x05, 0x2a, 0x05, 0x28, 0x18, 0x42, 0x00, 0x20, 0x01, 0x20, 0x01,
-  0x00, 0x28, 0x12, 0x00, 0x20, 0x01, 0x20, 0x02, 0x20, 0x04, 0x80, 0x02,
-  0x00, 0x28, 0x00, 0x20, 0xf2, 0xa3, 0x85, 0x20, 0x08, 0x18, 0x62, 0x28,
-  0x2f, 0x22, 0x01, 0x25, 0x02, 0x27, 0x22, 0x50, 0x22, 0x50, 0x22, 0x22,
-  0x25, 0x82, 0xd3, 0x22, 0x02, 0x2d, 0x22, 0x00, 0x38, 0x28, 0x25, 0x22,
-  0x53, 0x22, 0x42, 0x25, 0x22, 0xd4, 0x22, 0x01, 0x27, 0x23, 0x18, 0x25,
-  0x82, 0x54, 0x22, 0xd0, 0x22, 0x02, 0x28, 0x42, 0x00, 0x00, 0x00, 0x80,
-  0x04, 0x00, 0x00, 0x80, 0x22, 0x44, 0x71, 0x61, 0x07, 0x4a, 0x01, 0x22,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x80, 0x01, 0x28, 0x2a,
-  0x04, 0x18, 0x18, 0x48, 0x18, 0x12, 0x42, 0x00, 0x42, 0x20, 0x02, 0x20,
-  0x22, 0x02, 0x22, 0x20, 0x02, 0x00, 0x42, 0x00, 0x28, 0x00, 0x28, 0x00,
-  0x80, 0x22, 0x88, 0x28, 0xf2, 0x2b, 0x93, 0x00, 0x18, 0x48, 0x00, 0x80,
-  0x04, 0x48, 0x00, 0x80, 0x01, 0x00, 0x00, 0x48, 0x80, 0x01, 0x00, 0x18,
-  0x00, 0x20, 0x01, 0x80, 0x02, 0x20, 0x02, 0x18, 0x00, 0x80, 0x01, 0x20,
-  0x82, 0x0a, 0x80, 0x02, 0x22, 0x00, 0x28, 0x00, 0x00, 0x22, 0x82, 0x5f,
-  0x64, 0x0f, 0x00, 0x00, 0x10, 0x02, 0x21, 0x18, 0x21, 0x10, 0x02, 0x21,
-  0x18, 0x21, 0x22, 0x21, 0x10, 0x82, 0x02, 0x00, 0x24, 0x18, 0x24, 0x60,
-  0x24, 0xc0, 0x42, 0x40, 0x02, 0x46, 0x02, 0x24, 0xc0, 0x42, 0x22, 0x00,
-  0x48, 0x00, 0x20, 0x02, 0x00, 0x22, 0x42, 0x42, 0x20, 0x02, 0x20, 0x04,
+  0x00, 0x2c, 0x04, 0x86, 0x92, 0x48, 0x4f, 0x71, 0x0c, 0xe9, 0x01, 0x10,
+  0x12, 0x1b, 0x01, 0xd1, 0x12, 0x20, 0x01, 0x00, 0x18, 0x00, 0x10, 0x02,
+  0x18, 0x00, 0x80, 0x01, 0x18, 0x2e, 0x01, 0x21, 0x08, 0x88, 0x03, 0x00,
+  0xf1, 0xc2, 0xf0, 0xd4, 0x21, 0xa0, 0x22, 0x2a, 0x02, 0x2a, 0xf2, 0x28,
+  0x28, 0x9f, 0x92, 0xf2, 0x48, 0x48, 0x2b, 0x66, 0x2b, 0x11, 0x2a, 0xa2,
+  0x22, 0x3f, 0x12, 0xb2, 0x42, 0xb5, 0x42, 0x14, 0xb2, 0x22, 0xb2, 0x32,
+  0xa3, 0x66, 0x7a, 0xa7, 0x22, 0x12, 0x6a, 0xa2, 0x66, 0x00, 0x2e, 0x62,
+  0x7e, 0x62, 0x2a, 0xa2, 0x55, 0x6e, 0x62, 0x7e, 0x72, 0x2f, 0x24, 0xe4,
+  0x25, 0xc4, 0x42, 0x2b, 0x44, 0x4a, 0x24, 0x41, 0x62, 0x21, 0x48, 0x80,
+  0x04, 0xa0, 0x44, 0x48, 0x8e, 0x82, 0x23, 0xa4, 0x4c, 0xca, 0x04, 0x8a,
+  0xa8, 0x2a, 0x82, 0xa0, 0xcc, 0xca, 0x5c, 0x88, 0x4a, 0xf4, 0x9f, 0x55,
+  0xa0, 0x66, 0x1f, 0x96, 0x56, 0x11, 0x2a, 0xf6, 0x68, 0x48, 0x9f, 0x96,
+  0xf6, 0x48, 0x48, 0xaf, 0x86, 0xb6, 0x52, 0xa5, 0x66, 0x4f, 0x46, 0xf6,
+  0x53, 0x61, 0x2f, 0x45, 0xb6, 0x42, 0xb4, 0x42, 0xb4, 0x62, 0xb4, 0x32,
+  0xa3, 0x62, 0x7a, 0xa3, 0x36, 0x58, 0x2b, 0x76, 0x7a, 0x87, 0xa5, 0x44,
+  0xae, 0xe2, 0x7e, 0x72, 0x2a, 0xae, 0x11, 0x2e, 0x42, 0x3e, 0x32, 0x1d,
+  0x43, 0x5e, 0x52, 0x34, 0xa5, 0x88, 0xc4, 0x48, 0x1e, 0x12, 0x1e, 0x12,
+  0x4a, 0x24, 0xa4, 0x44, 0x42, 0x48, 0xca, 0xfc, 0xe4, 0xe4, 0x6e, 0x22,
+  0x2f, 0x4a, 0xaa, 0x4c, 0xca, 0xa2, 0x8c, 0x8e, 0x82, 0x2f, 0x2a, 0x32,
+  0x82, 0x8a, 0xa8, 0xcc, 0x2b, 0xcc, 0x85, 0xa8, 0xdd, 0x8f, 0xac, 0x01,
+  0x6a, 0x86, 0x06, 0x2a, 0xf2, 0x68, 0x68, 0x69, 0x00, 0x11, 0x8f, 0x69,
+  0x00, 0xf3, 0x49, 0x6e, 0x64, 0x1b, 0x66, 0x2b, 0x74, 0x4a, 0xb4, 0x42,
+  0xa4, 0x66, 0x2b, 0x33, 0x6a, 0xa4, 0x77, 0x6a, 0xa7, 0x11, 0x23, 0xa7,
+  0x67, 0x4a, 0x05, 0x2e, 0xc2, 0x7a, 0xa6, 0x77, 0x5a, 0xa5, 0x66, 0x7a,
+  0xf7, 0x42, 0x43, 0x5a, 0xc4, 0x52, 0x4e, 0x48, 0x4a, 0xa4, 0x41, 0x24,
+  0x12, 0x1a, 0x05, 0x48, 0x20, 0xa4, 0xcc, 0x8e, 0xc4, 0x8e, 0x82, 0x2b,
+  0x24, 0x4a, 0xac, 0x44, 0x8a, 0x08, 0x2a, 0x0a, 0x8a, 0xa8, 0x44, 0x29,
+  0xa4, 0x88, 0x8f, 0x8c, 0xed, 0x84, 0x08, 0x6a, 0xf6, 0x29, 0x61, 0x11,
+  0x6a, 0xe2, 0x86, 0xf6, 0x69, 0x69, 0x8d, 0xc8, 0x00, 0xb0, 0x6e, 0x64,
+  0x3f, 0x17, 0xb7, 0x56, 0x35, 0x42, 0x2b, 0x44, 0x2b, 0x60, 0x00, 0xf5,
+  0x12, 0xa6, 0x37, 0x6a, 0x83, 0xa5, 0x76, 0x7a, 0x87, 0xa4, 0x44, 0x2e,
+  0xe2, 0x7e, 0x72, 0xaa, 0xa6, 0x55, 0x2e, 0x62, 0x7e, 0x32, 0x4e, 0x43,
+  0x5e, 0x52, 0x1f, 0x24, 0xf5, 0x42, 0x48, 0x48, 0x8b, 0x11, 0xc9, 0x00,
+  0xf0, 0x10, 0x4a, 0xa4, 0xcc, 0xee, 0xe4, 0x6e, 0x22, 0x6b, 0xec, 0x4a,
+  0x2c, 0x26, 0xa4, 0x88, 0x2f, 0x22, 0x1a, 0x02, 0xca, 0xac, 0x44, 0x8a,
+  0xf8, 0xc8, 0xd8, 0xab, 0x83, 0x00, 0x40, 0x01, 0xc0, 0xf9, 0x02, 0x50,
+  0x1a, 0x04, 0x40, 0x82, 0x04, 0xf6, 0x05, 0x03, 0xad, 0x03, 0x00, 0xac,
+  0x03, 0x03, 0xb9, 0x03, 0xf0, 0x0f, 0xf0, 0xe2, 0x25, 0xa0, 0x48, 0x11,
+  0x00, 0x00, 0x81, 0x48, 0x23, 0x04, 0x10, 0x11, 0x82, 0x14, 0x02, 0x21,
+  0x00, 0x80, 0x81, 0x84, 0x01, 0x40, 0x22, 0x01, 0x40, 0x02, 0x24, 0x12,
+  0x62, 0x06, 0x00, 0x7b, 0x03, 0x02, 0x52, 0x04, 0xf0, 0x50, 0x81, 0x14,
+  0xbf, 0x16, 0x03, 0x2c, 0xf4, 0x11, 0x24, 0x85, 0xf2, 0x11, 0x24, 0x83,
+  0xf4, 0x11, 0x24, 0xa3, 0xd4, 0x41, 0xf2, 0x4a, 0x12, 0x1f, 0x41, 0xb2,
+  0x4a, 0xb9, 0x11, 0xb2, 0x4a, 0x39, 0x15, 0xab, 0x94, 0x43, 0xf2, 0x4a,
+  0x91, 0x43, 0xf2, 0x42, 0x93, 0x47, 0x83, 0x2d, 0x91, 0x4f, 0x83, 0xc4,
+  0x91, 0x4f, 0xa2, 0xe4, 0x14, 0xfa, 0x24, 0x4a, 0x16, 0xf1, 0x24, 0x5a,
+  0x96, 0xe1, 0xa2, 0x64, 0x59, 0x2d, 0x4a, 0x9e, 0x24, 0xac, 0xf5, 0x91,
+  0x24, 0x2c, 0xf5, 0x91, 0x24, 0x8d, 0x12, 0x1f, 0x49, 0xb2, 0x48, 0xf1,
+  0x91, 0x64, 0xab, 0x14, 0x1f, 0x48, 0xb6, 0x4a, 0xd1, 0x47, 0x00, 0xf1,
+  0x7d, 0x81, 0xb6, 0x4a, 0x39, 0x85, 0xab, 0x94, 0x4b, 0x4a, 0xab, 0x94,
+  0x43, 0xba, 0x42, 0x79, 0xa4, 0x98, 0x92, 0x4f, 0x8a, 0x84, 0xf9, 0x24,
+  0x4a, 0x7f, 0x9e, 0x03, 0xac, 0xf4, 0x11, 0x44, 0x85, 0xf2, 0x11, 0x64,
+  0x83, 0x64, 0x41, 0xa3, 0xd4, 0x41, 0x32, 0x4a, 0x1d, 0x24, 0x8f, 0x44,
+  0x58, 0x41, 0xab, 0xb4, 0x51, 0xab, 0xb4, 0x41, 0xaf, 0x14, 0x18, 0xd4,
+  0x12, 0xf8, 0x24, 0x48, 0x2d, 0x81, 0x6d, 0x48, 0x4e, 0x81, 0x6f, 0xa2,
+  0xc5, 0x81, 0x4d, 0x9a, 0x4e, 0x81, 0x4f, 0xa2, 0x64, 0x1d, 0x8c, 0x64,
+  0x5d, 0xbc, 0xe4, 0x5c, 0xc2, 0x4a, 0x1f, 0xcc, 0xc2, 0x4a, 0x1f, 0x4d,
+  0xd2, 0x28, 0xf4, 0x81, 0x24, 0x81, 0x1f, 0x48, 0x12, 0xfa, 0x81, 0x24,
+  0xab, 0x14, 0x1d, 0x64, 0xaf, 0x42, 0x59, 0x41, 0xab, 0x34, 0x59, 0x96,
+  0x1a, 0x43, 0xb2, 0x4a, 0x11, 0xb4, 0x42, 0x73, 0x24, 0x98, 0x12, 0x67,
+  0x82, 0x18, 0x6f, 0xa2, 0xf5, 0xd1, 0x95, 0x40, 0x08, 0x31, 0x01, 0x10,
+  0x44, 0x04, 0x06, 0x00, 0xf4, 0x02, 0x54, 0x88, 0x00, 0x00, 0x40, 0x01,
+  0x15, 0x00, 0x10, 0x80, 0x24, 0x04, 0xf0, 0x05, 0x10, 0x02, 0x2f, 0xb2,
+  0x04, 0x60, 0x12, 0x00, 0x80, 0x02, 0x80, 0x04, 0x18, 0x00, 0x00, 0x28,
+  0x00, 0x18, 0x00, 0x62, 0x35, 0x04, 0xd0, 0x18, 0x24, 0x12, 0x48, 0x18,
+  0xa0, 0x41, 0x48, 0x12, 0x80, 0x21, 0x08, 0x42, 0xa4, 0x04, 0x00, 0xea,
+  0x04, 0xf0, 0x20, 0x20, 0x0c, 0x83, 0x14, 0xf8, 0x95, 0xbb, 0x20, 0x24,
+  0x08, 0x00, 0x24, 0x12, 0x24, 0x22, 0x15, 0x02, 0x81, 0x12, 0x24, 0x80,
+  0x21, 0x49, 0x82, 0x44, 0xa2, 0x14, 0x20, 0x81, 0x04, 0x22, 0x00, 0x48,
+  0x42, 0x48, 0x00, 0x48, 0x21, 0x10, 0x02, 0xa0, 0x24, 0x23, 0x11, 0x02,
+  0x00, 0x29, 0x84, 0x08, 0x00, 0x67, 0x05, 0xf0, 0x43, 0x14, 0xf0, 0x48,
+  0xfa, 0x20, 0x24, 0x06, 0x48, 0x40, 0x02, 0x24, 0x40, 0x92, 0x14, 0x84,
+  0x32, 0x24, 0x80, 0x22, 0x41, 0x82, 0x44, 0xc2, 0x52, 0x28, 0x1a, 0xa4,
+  0x41, 0x20, 0x88, 0x04, 0x42, 0x42, 0x29, 0x95, 0x41, 0x18, 0x42, 0xa9,
+  0x24, 0x14, 0x02, 0x48, 0xca, 0xc2, 0x12, 0x00, 0x00, 0x69, 0x84, 0x28,
+  0x22, 0x04, 0x80, 0x04, 0x42, 0xc0, 0x42, 0x60, 0x84, 0x12, 0xaf, 0x1a,
+  0x0c, 0x10, 0x01, 0x00, 0x28, 0x18, 0x20, 0x16, 0x01, 0x00, 0x00, 0x12,
+  0x88, 0x80, 0x01, 0x80, 0x04, 0x00, 0x22, 0xc2, 0x03, 0xf0, 0x06, 0x20,
+  0x01, 0x12, 0x20, 0x41, 0x02, 0x42, 0x20, 0x04, 0x00, 0x00, 0x42, 0x80,
+  0x21, 0x08, 0x80, 0x08, 0x40, 0xf8, 0xd4, 0x4a, 0x18, 0x02, 0x40, 0x80,
+  0x04, 0x12, 0x22, 0x20, 0x00, 0x10, 0x81, 0x1d, 0x00, 0x20, 0x42, 0x00,
+  0x39, 0x05, 0x00, 0x8f, 0x06, 0x10, 0x18, 0xec, 0x05, 0x00, 0x34, 0x02,
+  0xe0, 0x82, 0x00, 0x3f, 0xc1, 0x04, 0x28, 0x11, 0x22, 0x80, 0x42, 0x81,
+  0x81, 0x81, 0x0a, 0x1e, 0x07, 0xf0, 0x0a, 0x80, 0x24, 0x81, 0x02, 0x22,
+  0x00, 0xa0, 0x42, 0x12, 0x48, 0x12, 0x23, 0x26, 0xa2, 0x14, 0xa0, 0x41,
+  0x42, 0x18, 0x10, 0x82, 0x61, 0x24, 0x22, 0x22, 0xb3, 0x06, 0xf1, 0x06,
+  0x01, 0x00, 0x22, 0x19, 0x24, 0x82, 0x84, 0x42, 0x81, 0x24, 0xf4, 0xc6,
+  0xeb, 0x80, 0x12, 0x01, 0x80, 0x13, 0x01, 0x4a, 0x01, 0x2b, 0x06, 0xf1,
+  0x06, 0x18, 0x22, 0x18, 0x00, 0x2a, 0x04, 0x00, 0x22, 0x12, 0x48, 0xa0,
+  0x42, 0x28, 0x48, 0xa0, 0x14, 0x28, 0x40, 0x02, 0x00, 0x22, 0x56, 0x01,
+  0xf1, 0x01, 0x00, 0x80, 0x08, 0x19, 0x88, 0x04, 0x4f, 0xec, 0x0b, 0x00,
+  0x28, 0x00, 0x80, 0x01, 0x2a, 0x28, 0x83, 0x00, 0xf0, 0x33, 0x48, 0x20,
+  0x06, 0x00, 0x42, 0x80, 0x04, 0x12, 0x16, 0x02, 0x20, 0x01, 0x80, 0x24,
+  0x01, 0x80, 0xc1, 0x42, 0x18, 0x28, 0x20, 0x24, 0x82, 0x24, 0x01, 0x00,
+  0x28, 0x46, 0x81, 0x82, 0x24, 0x02, 0x80, 0xe4, 0x79, 0x03, 0x00, 0x28,
+  0x20, 0x21, 0x02, 0x28, 0x28, 0x00, 0x21, 0x2a, 0x01, 0x00, 0x49, 0x02,
+  0x48, 0x40, 0x21, 0x26, 0x82, 0x21, 0x02, 0x68, 0x4a, 0x42, 0x02, 0x18,
+  0x00, 0x10, 0xa2, 0x24, 0xa2, 0x06, 0xf1, 0x05, 0x28, 0x28, 0x42, 0x00,
+  0xa0, 0x24, 0x48, 0x00, 0x28, 0x20, 0x04, 0x22, 0x22, 0x88, 0xcf, 0x87,
+  0x0e, 0x20, 0x06, 0x22, 0x66, 0x00, 0x91, 0x28, 0xa0, 0x41, 0x32, 0x00,
+  0x20, 0x04, 0x00, 0x78, 0xde, 0x01, 0xf0, 0x0d, 0x41, 0x22, 0x80, 0x04,
+  0x80, 0x24, 0x84, 0x0c, 0x00, 0x20, 0x02, 0x28, 0x80, 0x82, 0x08, 0x00,
+  0x12, 0x00, 0xf0, 0xf6, 0x23, 0x80, 0x81, 0x01, 0x2c, 0x01, 0x00, 0x00,
+  0xa3, 0x00, 0x60, 0x30, 0x42, 0x80, 0x22, 0x02, 0x12, 0x0b, 0x05, 0x60,
+  0x20, 0x84, 0x84, 0x04, 0x18, 0x00, 0x44, 0x00, 0x01, 0x23, 0x02, 0xf0,
+  0x16, 0x80, 0x02, 0x00, 0x42, 0x6f, 0xde, 0x06, 0x12, 0x12, 0x28, 0x24,
+  0x20, 0x02, 0x28, 0x00, 0x32, 0x21, 0x18, 0x80, 0x21, 0x12, 0x04, 0x48,
+  0x42, 0x14, 0x62, 0x32, 0x28, 0x48, 0x80, 0xa4, 0x25, 0x00, 0x00, 0x90,
+  0x44, 0x22, 0x01, 0x01, 0x70, 0x22, 0xa4, 0x4a, 0x80, 0x22, 0x04, 0x22,
+  0x4e, 0x00, 0xc0, 0x42, 0x18, 0x22, 0x80, 0xf8, 0xba, 0x4e, 0x00, 0x28,
+  0xa0, 0x21, 0x18, 0x4d, 0x09, 0xf0, 0x09, 0x00, 0x20, 0x24, 0xc1, 0x22,
+  0x48, 0x20, 0x82, 0x02, 0x80, 0x84, 0x02, 0x28, 0x00, 0x21, 0x12, 0x48,
+  0x42, 0x24, 0x20, 0x02, 0x00, 0x42, 0x12, 0x79, 0x00, 0xf1, 0x03, 0x48,
+  0x42, 0xa0, 0x84, 0x22, 0x20, 0x02, 0x80, 0x82, 0xf4, 0x89, 0x65, 0x00,
+  0x00, 0x20, 0x22, 0x02, 0x80, 0xdd, 0x09, 0xf0, 0x0c, 0x04, 0x28, 0x12,
+  0x18, 0x00, 0x20, 0x04, 0x48, 0x18, 0x12, 0x18, 0x00, 0x00, 0x22, 0x42,
+  0x20, 0x82, 0x01, 0x22, 0x2a, 0x01, 0x00, 0x88, 0x42, 0x20, 0x04, 0x48,
+  0xbd, 0x08, 0x61, 0xf0, 0x6a, 0xcd, 0x20, 0x01, 0x18, 0xf5, 0x09, 0x00,
+  0xa9, 0x00, 0x40, 0xa0, 0x24, 0x20, 0x21, 0xf8, 0x06, 0xe0, 0x00, 0x42,
+  0x00, 0x80, 0xa2, 0x41, 0x20, 0x02, 0x20, 0x04, 0x00, 0x48, 0x00, 0x28,
+  0x0c, 0x02, 0xf0, 0x04, 0x22, 0x00, 0xc8, 0xdf, 0x47, 0x03, 0x00, 0x00,
+  0x40, 0x22, 0x41, 0x02, 0x24, 0x40, 0x22, 0x43, 0x02, 0x26, 0x82, 0x97,
+  0x09, 0xf1, 0x05, 0x04, 0x18, 0xb0, 0x42, 0x02, 0x23, 0x84, 0x14, 0x02,
+  0x23, 0x04, 0x29, 0x02, 0x23, 0x24, 0x12, 0x02, 0x21, 0x20, 0x01, 0x1c,
+  0x07, 0x00, 0x1f, 0x07, 0xc1, 0x20, 0x02, 0xf0, 0x62, 0x4b, 0x20, 0x04,
+  0x00, 0x12, 0x00, 0x80, 0x22, 0x0f, 0x06, 0x70, 0x22, 0x80, 0x05, 0x2a,
+  0x05, 0x28, 0x18, 0x3c, 0x02, 0x50, 0x20, 0x01, 0x00, 0x28, 0x12, 0x08,
+  0x00, 0x20, 0x02, 0x20, 0x1b, 0x01, 0xf0, 0x27, 0x28, 0x00, 0x20, 0xf2,
+  0xa3, 0x85, 0x20, 0x08, 0x18, 0x62, 0x28, 0x2f, 0x22, 0x01, 0x25, 0x02,
+  0x27, 0x22, 0x50, 0x22, 0x50, 0x22, 0x22, 0x25, 0x82, 0xd3, 0x22, 0x02,
+  0x2d, 0x22, 0x00, 0x38, 0x28, 0x25, 0x22, 0x53, 0x22, 0x42, 0x25, 0x22,
+  0xd4, 0x22, 0x01, 0x27, 0x23, 0x18, 0x25, 0x82, 0x54, 0x22, 0xd0, 0x22,
+  0x02, 0x28, 0xce, 0x08, 0x00, 0x14, 0x08, 0x91, 0x80, 0x22, 0x44, 0x71,
+  0x61, 0x07, 0x4a, 0x01, 0x22, 0x70, 0x06, 0xf0, 0x07, 0x00, 0x20, 0x02,
+  0x80, 0x01, 0x28, 0x2a, 0x04, 0x18, 0x18, 0x48, 0x18, 0x12, 0x42, 0x00,
+  0x42, 0x20, 0x02, 0x20, 0x22, 0x02, 0x22, 0x29, 0x01, 0x20, 0x00, 0x28,
+  0xd2, 0x01, 0x60, 0x22, 0x88, 0x28, 0xf2, 0x2b, 0x93, 0xe0, 0x0a, 0x01,
+  0xc8, 0x07, 0x01, 0x00, 0x08, 0x00, 0xb3, 0x06, 0x51, 0x20, 0x01, 0x80,
+  0x02, 0x20, 0xa8, 0x00, 0x51, 0x20, 0x82, 0x0a, 0x80, 0x02, 0xba, 0x01,
+  0x50, 0x22, 0x82, 0x5f, 0x64, 0x0f, 0xce, 0x03, 0x31, 0x21, 0x18, 0x21,
+  0x05, 0x00, 0xf0, 0x07, 0x22, 0x21, 0x10, 0x82, 0x02, 0x00, 0x24, 0x18,
+  0x24, 0x60, 0x24, 0xc0, 0x42, 0x40, 0x02, 0x46, 0x02, 0x24, 0xc0, 0x42,
+  0x22, 0x00, 0xec, 0x00, 0x30, 0x00, 0x22, 0x42, 0x6b, 0x00, 0xe0, 0x04,
   0x8f, 0x1a, 0x0e, 0x84, 0x80, 0x06, 0x12, 0x20, 0x01, 0x80, 0x84, 0x41,
-  0x04, 0x28, 0x20, 0x01, 0x00, 0x80, 0x04, 0x21, 0xa0, 0x12, 0x80, 0x08,
-  0x00, 0x80, 0x42, 0xa1, 0x12, 0x12, 0x84, 0x80, 0x05, 0x00, 0x20, 0x02,
-  0x00, 0x44, 0x42, 0x28, 0x22, 0x00, 0x20, 0x08, 0x80, 0x38, 0x22, 0x48,
-  0x99, 0x04, 0x12, 0x92, 0x2a, 0xa3, 0x21, 0xa0, 0x21, 0x00, 0x38, 0x28,
-  0x18, 0x12, 0x1a, 0x02, 0x22, 0x22, 0x2a, 0x24, 0x82, 0xa3, 0x43, 0x20,
-  0xa1, 0x22, 0x32, 0xa0, 0x14, 0x80, 0xa5, 0x45, 0x18, 0x12, 0x42, 0x28,
-  0x80, 0x22, 0xa6, 0x32, 0x2a, 0x83, 0x84, 0xa2, 0x11, 0x18, 0x80, 0x82,
-  0x28, 0x8c, 0x82, 0x84, 0x84, 0x86, 0x22, 0x06, 0x20, 0x22, 0xa2, 0x8a,
-  0x1c, 0x24, 0xf8, 0x81, 0xa8, 0x00, 0x00, 0xe0, 0x23, 0x43, 0x52, 0x22,
-  0x24, 0x25, 0x42, 0x52, 0x22, 0x2c, 0x51, 0x22, 0x24, 0x25, 0xe2, 0x21,
-  0xf1, 0x12, 0x32, 0x2c, 0x72, 0x62, 0xc2, 0x12, 0x2b, 0x76, 0x6a, 0x81,
-  0xc1, 0x22, 0x2b, 0x64, 0x2d, 0x42, 0x29, 0x54, 0x22, 0x29, 0x71, 0x12,
-  0x92, 0x42, 0x2d, 0x62, 0x23, 0x51, 0x22, 0x2b, 0x41, 0x2d, 0x22, 0x23,
-  0x71, 0x12, 0x32, 0x22, 0x21, 0x2a, 0xa2, 0x45, 0x4a, 0x04, 0x2a, 0x82,
-  0xa4, 0x44, 0x22, 0x42, 0x62, 0x42, 0xa0, 0x44, 0x00, 0x28, 0x20, 0xa2,
-  0x84, 0xdf, 0xc1, 0x0c, 0x4a, 0x05, 0x12, 0x4a, 0x81, 0x34, 0x22, 0x5a,
-  0x11, 0x22, 0xb6, 0x22, 0x04, 0x21, 0x18, 0x21, 0x18, 0x29, 0x02, 0x21,
-  0xb0, 0x42, 0x22, 0x81, 0x26, 0x01, 0x26, 0x22, 0xe3, 0x25, 0x21, 0x45,
-  0x82, 0x64, 0x24, 0x22, 0x2e, 0x12, 0x3a, 0x63, 0x26, 0x48, 0x2c, 0x04,
-  0x2c, 0x23, 0x02, 0x2a, 0x82, 0x02, 0x00, 0x20, 0x04, 0xa0, 0x42, 0x68,
-  0x22, 0x88, 0x28, 0x80, 0xa2, 0xa4, 0x2a, 0xf6, 0xa1, 0x86, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x20, 0x01, 0x48, 0x20, 0x01,
-  0x12, 0x00, 0x80, 0x01, 0x18, 0x00, 0x80, 0x01, 0x00, 0x18, 0x00, 0x80,
-  0x01, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0xf0, 0x17,
-  0xd5, 0xa0, 0x41, 0xa0, 0x21, 0xe0, 0x21, 0xfa, 0x12, 0x12, 0x2f, 0x24,
-  0x55, 0x22, 0x2f, 0x25, 0x53, 0x22, 0x2b, 0x11, 0x2d, 0x12, 0x2d, 0x12,
-  0x25, 0xf2, 0x12, 0x12, 0x2f, 0x22, 0xf2, 0x12, 0x12, 0x25, 0xf2, 0x32,
-  0x12, 0x2f, 0x24, 0xb5, 0x22, 0xa5, 0x62, 0x18, 0x26, 0x52, 0x22, 0x2f,
-  0x26, 0x36, 0x12, 0x2f, 0x24, 0xf4, 0x52, 0x42, 0x2f, 0x24, 0xf4, 0x12,
-  0x52, 0x2f, 0x22, 0xf6, 0x32, 0x22, 0x2f, 0x22, 0xf2, 0x12, 0x12, 0x2f,
-  0x24, 0xc4, 0x22, 0x23, 0xf1, 0x22, 0x22, 0x21, 0x2a, 0xa2, 0x66, 0xa0,
+  0x04, 0xe7, 0x02, 0xf0, 0x01, 0x80, 0x04, 0x21, 0xa0, 0x12, 0x80, 0x08,
+  0x00, 0x80, 0x42, 0xa1, 0x12, 0x12, 0x84, 0x80, 0x05, 0x2c, 0x00, 0x30,
+  0x44, 0x42, 0x28, 0x5b, 0x0a, 0xf0, 0xbb, 0x80, 0x38, 0x22, 0x48, 0x99,
+  0x04, 0x12, 0x92, 0x2a, 0xa3, 0x21, 0xa0, 0x21, 0x00, 0x38, 0x28, 0x18,
+  0x12, 0x1a, 0x02, 0x22, 0x22, 0x2a, 0x24, 0x82, 0xa3, 0x43, 0x20, 0xa1,
+  0x22, 0x32, 0xa0, 0x14, 0x80, 0xa5, 0x45, 0x18, 0x12, 0x42, 0x28, 0x80,
+  0x22, 0xa6, 0x32, 0x2a, 0x83, 0x84, 0xa2, 0x11, 0x18, 0x80, 0x82, 0x28,
+  0x8c, 0x82, 0x84, 0x84, 0x86, 0x22, 0x06, 0x20, 0x22, 0xa2, 0x8a, 0x1c,
+  0x24, 0xf8, 0x81, 0xa8, 0x00, 0x00, 0xe0, 0x23, 0x43, 0x52, 0x22, 0x24,
+  0x25, 0x42, 0x52, 0x22, 0x2c, 0x51, 0x22, 0x24, 0x25, 0xe2, 0x21, 0xf1,
+  0x12, 0x32, 0x2c, 0x72, 0x62, 0xc2, 0x12, 0x2b, 0x76, 0x6a, 0x81, 0xc1,
+  0x22, 0x2b, 0x64, 0x2d, 0x42, 0x29, 0x54, 0x22, 0x29, 0x71, 0x12, 0x92,
+  0x42, 0x2d, 0x62, 0x23, 0x51, 0x22, 0x2b, 0x41, 0x2d, 0x22, 0x23, 0x71,
+  0x12, 0x32, 0x22, 0x21, 0x2a, 0xa2, 0x45, 0x4a, 0x04, 0x2a, 0x82, 0xa4,
+  0x44, 0x22, 0x42, 0x62, 0x42, 0xa0, 0x44, 0x00, 0x28, 0x20, 0xa2, 0x84,
+  0xdf, 0xc1, 0x0c, 0x4a, 0x05, 0x12, 0x4a, 0x81, 0x34, 0x22, 0x5a, 0x11,
+  0x22, 0xb6, 0x22, 0x04, 0x21, 0x18, 0x21, 0x18, 0x29, 0x02, 0x21, 0xb0,
+  0x42, 0x22, 0x81, 0x26, 0x01, 0x26, 0x22, 0xe3, 0x25, 0x21, 0x45, 0x82,
+  0x64, 0x24, 0x22, 0x2e, 0x12, 0x3a, 0x63, 0x26, 0x48, 0x2c, 0x04, 0x2c,
+  0x23, 0x02, 0x2a, 0x82, 0x02, 0xc9, 0x04, 0xc0, 0x42, 0x68, 0x22, 0x88,
+  0x28, 0x80, 0xa2, 0xa4, 0x2a, 0xf6, 0xa1, 0x86, 0x17, 0x04, 0x01, 0x12,
+  0x08, 0x50, 0x20, 0x01, 0x48, 0x20, 0x01, 0xad, 0x0b, 0x00, 0x59, 0x01,
+  0x11, 0x00, 0x06, 0x02, 0x01, 0x1a, 0x00, 0xf1, 0x38, 0x11, 0x00, 0x00,
+  0xf0, 0x17, 0xd5, 0xa0, 0x41, 0xa0, 0x21, 0xe0, 0x21, 0xfa, 0x12, 0x12,
+  0x2f, 0x24, 0x55, 0x22, 0x2f, 0x25, 0x53, 0x22, 0x2b, 0x11, 0x2d, 0x12,
+  0x2d, 0x12, 0x25, 0xf2, 0x12, 0x12, 0x2f, 0x22, 0xf2, 0x12, 0x12, 0x25,
+  0xf2, 0x32, 0x12, 0x2f, 0x24, 0xb5, 0x22, 0xa5, 0x62, 0x18, 0x26, 0x52,
+  0x22, 0x2f, 0x26, 0x36, 0x12, 0x2f, 0x24, 0xf4, 0x52, 0x42, 0x2f, 0x24,
+  0xf4, 0x12, 0x52, 0x2f, 0x22, 0xf6, 0x32, 0x22, 0x26, 0x00, 0x70, 0x2f,
+  0x24, 0xc4, 0x22, 0x23, 0xf1, 0x22, 0xcf, 0x00, 0xf0, 0x25, 0x66, 0xa0,
   0x22, 0x2a, 0xa2, 0x44, 0x2a, 0x22, 0x24, 0x24, 0xa4, 0x26, 0x42, 0x6a,
   0xa2, 0x88, 0x1b, 0x22, 0xa0, 0xaa, 0xaa, 0xea, 0x1e, 0xfc, 0x41, 0x9f,
   0x00, 0x5e, 0x58, 0x1a, 0xa2, 0x73, 0x1e, 0x22, 0x2f, 0x23, 0xf3, 0x52,
   0x52, 0x25, 0xf2, 0x52, 0x32, 0x2f, 0x22, 0xf2, 0x16, 0x16, 0x25, 0xf2,
-  0x32, 0x26, 0x25, 0xf2, 0x12, 0x12, 0x26, 0xf2, 0x22, 0x12, 0x2f, 0x22,
-  0xf2, 0x32, 0x12, 0x2f, 0x22, 0x72, 0x32, 0xb2, 0x72, 0x25, 0xf2, 0x22,
-  0x12, 0x2f, 0x22, 0xe6, 0x2a, 0xfe, 0x12, 0x42, 0x2d, 0xd2, 0x2c, 0xd5,
-  0x22, 0xf1, 0x12, 0x12, 0x3f, 0x14, 0x74, 0x12, 0xd2, 0x32, 0xf3, 0x1a,
-  0x5a, 0x2f, 0x22, 0xf6, 0x52, 0x7a, 0x2d, 0x22, 0x2d, 0x22, 0x29, 0xa2,
-  0x31, 0x4a, 0x21, 0xa4, 0x22, 0x2a, 0x72, 0x44, 0xa4, 0x26, 0x6e, 0x64,
-  0xa0, 0x44, 0x22, 0x6a, 0xa4, 0x22, 0x8a, 0x28, 0x62, 0x22, 0x2b, 0xa2,
-  0xaa, 0xbe, 0x32, 0xf7, 0xbe, 0x6d, 0xa0, 0x41, 0x48, 0x1a, 0x03, 0x1e,
-  0x22, 0x2f, 0x21, 0xb1, 0x42, 0x55, 0x22, 0x2f, 0x25, 0x53, 0x22, 0x2f,
-  0x61, 0xd1, 0x22, 0xd1, 0x22, 0x53, 0x22, 0x1e, 0x12, 0x2f, 0x22, 0xf2,
-  0x12, 0x12, 0x24, 0x2f, 0x27, 0xb1, 0x42, 0xb5, 0x22, 0xb5, 0x22, 0x86,
-  0xe1, 0x22, 0x51, 0x22, 0x2f, 0x26, 0xfe, 0x12, 0x12, 0x2f, 0x24, 0xf4,
-  0x52, 0x42, 0x2f, 0x24, 0xf4, 0x12, 0x52, 0x2f, 0x32, 0xf4, 0x32, 0x22,
-  0x2f, 0x23, 0xf2, 0x32, 0x3a, 0x2f, 0x24, 0xf4, 0x12, 0x72, 0x27, 0x21,
-  0x2f, 0x22, 0x12, 0xa2, 0x23, 0x7a, 0x86, 0x02, 0x2a, 0xe2, 0x44, 0xa4,
-  0x22, 0x4a, 0x22, 0x24, 0xa4, 0x26, 0x42, 0x6a, 0xa2, 0x88, 0x2a, 0x02,
-  0x2b, 0xaa, 0x8a, 0xaa, 0xde, 0xd7, 0xdb, 0x80, 0xb4, 0x18, 0xa5, 0x31,
-  0x7a, 0xe3, 0x21, 0xfa, 0x32, 0x32, 0x5e, 0x52, 0x25, 0xf2, 0x52, 0x32,
-  0x2b, 0x22, 0x2f, 0x61, 0xd1, 0x22, 0xf1, 0x16, 0x32, 0x25, 0xf2, 0x12,
-  0x12, 0x2f, 0x23, 0xf1, 0x22, 0x12, 0x2f, 0x22, 0xf2, 0x72, 0x12, 0x2f,
-  0x26, 0xb3, 0x32, 0xb1, 0x72, 0xe5, 0x23, 0x61, 0x22, 0x2f, 0x22, 0xf6,
-  0x22, 0xe2, 0x2f, 0x21, 0xf5, 0x82, 0x52, 0x2f, 0x21, 0xf5, 0x12, 0x12,
-  0x2f, 0x21, 0xe1, 0x34, 0x74, 0x12, 0xf2, 0x13, 0x32, 0x2f, 0x81, 0xf7,
-  0x22, 0x62, 0xaf, 0x21, 0xd7, 0x22, 0xd2, 0x22, 0x92, 0x22, 0x1a, 0xa3,
-  0x34, 0x4a, 0x02, 0x8a, 0xe8, 0x4c, 0xa8, 0x26, 0x4b, 0x64, 0xa0, 0x44,
-  0x22, 0x6a, 0xa4, 0x22, 0x8e, 0x81, 0x26, 0x21, 0xb2, 0x22, 0xea, 0x2a,
-  0xee, 0x1a, 0xff, 0x44, 0xd5, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x20, 0x84, 0x01, 0x22,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x82, 0x28, 0xf0, 0x1c, 0x81, 0x00, 0x00, 0x28, 0x00, 0x21, 0x10,
-  0x82, 0x14, 0x02, 0x29, 0x01, 0x21, 0x90, 0x12, 0x10, 0x02, 0x21, 0x80,
-  0x01, 0x50, 0x22, 0x12, 0x00, 0x2d, 0x42, 0x40, 0x22, 0x41, 0x02, 0x24,
-  0x12, 0x24, 0x00, 0x00, 0x20, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0xbf, 0x39, 0x0e, 0x2c, 0xf5, 0x11, 0x24, 0x85, 0xf2, 0x11,
-  0x24, 0x8b, 0x16, 0x1f, 0x41, 0x36, 0x4a, 0x1d, 0x24, 0xab, 0x16, 0x1d,
-  0x24, 0xab, 0x94, 0x1b, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x43, 0xf3,
-  0x4a, 0xb1, 0x4b, 0x42, 0x2f, 0x14, 0x7b, 0x34, 0xf8, 0x42, 0xb1, 0x4f,
-  0x83, 0xc4, 0xb1, 0x4f, 0xa2, 0xe4, 0x14, 0xfa, 0x24, 0x4a, 0x56, 0xf1,
-  0x24, 0x5a, 0x96, 0xe1, 0xa2, 0x65, 0x5d, 0xac, 0xe4, 0x49, 0xc2, 0x5a,
-  0x1f, 0x4d, 0xe2, 0x22, 0xf4, 0x91, 0x24, 0x8f, 0x22, 0xf1, 0x91, 0x24,
-  0x8b, 0x16, 0x1f, 0x49, 0xb2, 0x4a, 0xf1, 0x81, 0x64, 0xab, 0x14, 0x1d,
-  0x24, 0xab, 0x94, 0x19, 0xb6, 0x4a, 0x99, 0x45, 0xab, 0x94, 0x4b, 0x42,
-  0xab, 0xb4, 0x4b, 0x42, 0x2b, 0x94, 0x47, 0x82, 0x29, 0xfb, 0x24, 0x48,
-  0x4a, 0xf9, 0x24, 0x4a, 0xaf, 0xd1, 0x01, 0xac, 0xf1, 0x11, 0x64, 0x8d,
-  0x12, 0x1d, 0x64, 0x8b, 0x12, 0x17, 0x41, 0xa1, 0x1d, 0x24, 0xa3, 0x56,
-  0x41, 0xaf, 0x44, 0xd9, 0x41, 0xb2, 0x4a, 0x9b, 0x25, 0xab, 0x94, 0x41,
-  0xad, 0xb1, 0x41, 0x2d, 0xb1, 0x45, 0xf8, 0x42, 0xb1, 0x65, 0xd8, 0x12,
-  0xdb, 0xa4, 0xe5, 0x14, 0xfa, 0x24, 0x9a, 0x5e, 0xa1, 0x47, 0xa2, 0x96,
-  0xe1, 0xa2, 0x64, 0x5d, 0xb4, 0x9e, 0x25, 0xac, 0xf4, 0xc1, 0x2c, 0x26,
-  0xfa, 0x81, 0x44, 0x8f, 0x22, 0x74, 0x81, 0x34, 0x68, 0x17, 0x48, 0xa1,
-  0x1f, 0x48, 0xb6, 0x4a, 0xd1, 0x41, 0xd2, 0x4a, 0xd9, 0x41, 0x96, 0xba,
+  0x32, 0x26, 0x6e, 0x00, 0x30, 0x26, 0xf2, 0x22, 0x72, 0x00, 0x91, 0x32,
+  0x12, 0x2f, 0x22, 0x72, 0x32, 0xb2, 0x72, 0x25, 0x0f, 0x00, 0xf2, 0x3b,
+  0xe6, 0x2a, 0xfe, 0x12, 0x42, 0x2d, 0xd2, 0x2c, 0xd5, 0x22, 0xf1, 0x12,
+  0x12, 0x3f, 0x14, 0x74, 0x12, 0xd2, 0x32, 0xf3, 0x1a, 0x5a, 0x2f, 0x22,
+  0xf6, 0x52, 0x7a, 0x2d, 0x22, 0x2d, 0x22, 0x29, 0xa2, 0x31, 0x4a, 0x21,
+  0xa4, 0x22, 0x2a, 0x72, 0x44, 0xa4, 0x26, 0x6e, 0x64, 0xa0, 0x44, 0x22,
+  0x6a, 0xa4, 0x22, 0x8a, 0x28, 0x62, 0x22, 0x2b, 0xa2, 0xaa, 0xbe, 0x32,
+  0xf7, 0xbe, 0x6d, 0xa0, 0x41, 0x48, 0x1a, 0x03, 0x1e, 0x22, 0x2f, 0x21,
+  0xb1, 0x42, 0xdd, 0x00, 0x92, 0x2f, 0x61, 0xd1, 0x22, 0xd1, 0x22, 0x53,
+  0x22, 0x1e, 0xdd, 0x00, 0xf0, 0x02, 0x24, 0x2f, 0x27, 0xb1, 0x42, 0xb5,
+  0x22, 0xb5, 0x22, 0x86, 0xe1, 0x22, 0x51, 0x22, 0x2f, 0x26, 0xfe, 0xca,
+  0x00, 0x05, 0xde, 0x00, 0x90, 0x32, 0xf4, 0x32, 0x22, 0x2f, 0x23, 0xf2,
+  0x32, 0x3a, 0x0f, 0x00, 0xf3, 0x03, 0x72, 0x27, 0x21, 0x2f, 0x22, 0x12,
+  0xa2, 0x23, 0x7a, 0x86, 0x02, 0x2a, 0xe2, 0x44, 0xa4, 0x22, 0x4a, 0x22,
+  0xe0, 0x00, 0xf1, 0x06, 0x2a, 0x02, 0x2b, 0xaa, 0x8a, 0xaa, 0xde, 0xd7,
+  0xdb, 0x80, 0xb4, 0x18, 0xa5, 0x31, 0x7a, 0xe3, 0x21, 0xfa, 0x32, 0x32,
+  0x5e, 0xdf, 0x00, 0x11, 0x2b, 0x6f, 0x00, 0x31, 0xf1, 0x16, 0x32, 0x4d,
+  0x01, 0x21, 0x23, 0xf1, 0xe0, 0x00, 0xf3, 0x2d, 0x72, 0x12, 0x2f, 0x26,
+  0xb3, 0x32, 0xb1, 0x72, 0xe5, 0x23, 0x61, 0x22, 0x2f, 0x22, 0xf6, 0x22,
+  0xe2, 0x2f, 0x21, 0xf5, 0x82, 0x52, 0x2f, 0x21, 0xf5, 0x12, 0x12, 0x2f,
+  0x21, 0xe1, 0x34, 0x74, 0x12, 0xf2, 0x13, 0x32, 0x2f, 0x81, 0xf7, 0x22,
+  0x62, 0xaf, 0x21, 0xd7, 0x22, 0xd2, 0x22, 0x92, 0x22, 0x1a, 0xa3, 0x34,
+  0x4a, 0x02, 0x8a, 0xe8, 0x4c, 0xa8, 0x26, 0x4b, 0xe2, 0x00, 0xd3, 0x8e,
+  0x81, 0x26, 0x21, 0xb2, 0x22, 0xea, 0x2a, 0xee, 0x1a, 0xff, 0x44, 0xd5,
+  0x31, 0x08, 0x00, 0x75, 0x03, 0x00, 0x07, 0x00, 0x22, 0x20, 0x84, 0xde,
+  0x01, 0x04, 0xe5, 0x01, 0x60, 0x00, 0x82, 0x28, 0xf0, 0x1c, 0x81, 0x5b,
+  0x04, 0xf1, 0x06, 0x21, 0x10, 0x82, 0x14, 0x02, 0x29, 0x01, 0x21, 0x90,
+  0x12, 0x10, 0x02, 0x21, 0x80, 0x01, 0x50, 0x22, 0x12, 0x00, 0x2d, 0x42,
+  0x4d, 0x04, 0x00, 0x48, 0x08, 0x22, 0x20, 0x22, 0x72, 0x08, 0x72, 0x22,
+  0x00, 0xbf, 0x39, 0x0e, 0x2c, 0xf5, 0x45, 0x08, 0xf3, 0x17, 0x8b, 0x16,
+  0x1f, 0x41, 0x36, 0x4a, 0x1d, 0x24, 0xab, 0x16, 0x1d, 0x24, 0xab, 0x94,
+  0x1b, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x43, 0xf3, 0x4a, 0xb1, 0x4b,
+  0x42, 0x2f, 0x14, 0x7b, 0x34, 0xf8, 0x42, 0xb1, 0x4f, 0x83, 0xc4, 0xb1,
+  0x45, 0x08, 0x12, 0x56, 0x45, 0x08, 0xf0, 0x03, 0x65, 0x5d, 0xac, 0xe4,
+  0x49, 0xc2, 0x5a, 0x1f, 0x4d, 0xe2, 0x22, 0xf4, 0x91, 0x24, 0x8f, 0x22,
+  0xf1, 0x91, 0x47, 0x00, 0x80, 0x49, 0xb2, 0x4a, 0xf1, 0x81, 0x64, 0xab,
+  0x14, 0x48, 0x00, 0xf0, 0x41, 0x19, 0xb6, 0x4a, 0x99, 0x45, 0xab, 0x94,
+  0x4b, 0x42, 0xab, 0xb4, 0x4b, 0x42, 0x2b, 0x94, 0x47, 0x82, 0x29, 0xfb,
+  0x24, 0x48, 0x4a, 0xf9, 0x24, 0x4a, 0xaf, 0xd1, 0x01, 0xac, 0xf1, 0x11,
+  0x64, 0x8d, 0x12, 0x1d, 0x64, 0x8b, 0x12, 0x17, 0x41, 0xa1, 0x1d, 0x24,
+  0xa3, 0x56, 0x41, 0xaf, 0x44, 0xd9, 0x41, 0xb2, 0x4a, 0x9b, 0x25, 0xab,
+  0x94, 0x41, 0xad, 0xb1, 0x41, 0x2d, 0xb1, 0x45, 0xf8, 0x42, 0xb1, 0x65,
+  0xd8, 0x12, 0xdb, 0xa4, 0xe5, 0x14, 0xfa, 0x24, 0x9a, 0x5e, 0xa1, 0x47,
+  0xa2, 0xba, 0x08, 0xf2, 0x06, 0x5d, 0xb4, 0x9e, 0x25, 0xac, 0xf4, 0xc1,
+  0x2c, 0x26, 0xfa, 0x81, 0x44, 0x8f, 0x22, 0x74, 0x81, 0x34, 0x68, 0x17,
+  0x48, 0xa1, 0xb7, 0x08, 0xf0, 0x10, 0xd2, 0x4a, 0xd9, 0x41, 0x96, 0xba,
   0x59, 0x94, 0xba, 0x49, 0x94, 0xba, 0x4b, 0x42, 0x2b, 0x14, 0x45, 0x98,
   0xb2, 0x6f, 0x82, 0xb4, 0x42, 0xd9, 0xa4, 0xf1, 0xbc, 0xca, 0x60, 0x88,
-  0x82, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x80, 0x08, 0x00, 0x00, 0x14, 0x00, 0x84, 0x80, 0x44, 0x01,
-  0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x50, 0x12, 0xf0,
-  0x5b, 0x2d, 0x00, 0x28, 0x00, 0x20, 0x02, 0x00, 0x48, 0x00, 0x18, 0x00,
-  0x20, 0x01, 0x80, 0x82, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0x01, 0x12,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x80, 0x8c, 0x22, 0x08, 0x00, 0x00, 0x82,
-  0x20, 0x88, 0x02, 0x00, 0x42, 0x1f, 0xe9, 0x0e, 0x20, 0x08, 0x12, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x24, 0x00, 0x00, 0x12, 0x24, 0xa0, 0x24, 0x00,
-  0x21, 0x42, 0x00, 0x12, 0x62, 0x20, 0x04, 0x42, 0x23, 0x81, 0x84, 0x02,
-  0x18, 0x20, 0x23, 0x01, 0x10, 0x08, 0x80, 0x04, 0x48, 0x28, 0x42, 0x00,
-  0x48, 0x00, 0x14, 0x22, 0x9f, 0xbf, 0x0c, 0x20, 0x0e, 0x12, 0x00, 0x00,
-  0xa0, 0x24, 0x41, 0x20, 0x41, 0x82, 0x02, 0x12, 0x80, 0x41, 0x42, 0x22,
-  0x04, 0x12, 0x21, 0xca, 0x02, 0x20, 0x21, 0x84, 0x91, 0x41, 0x12, 0x42,
-  0xa3, 0x81, 0x04, 0xa0, 0x41, 0x48, 0x18, 0x00, 0x82, 0x90, 0x84, 0x00,
-  0x80, 0x26, 0x02, 0x20, 0x88, 0x42, 0x02, 0x14, 0x72, 0x2f, 0x92, 0x0f,
-  0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x18,
-  0x22, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x28,
-  0x18, 0x20, 0xc4, 0x28, 0x00, 0x42, 0x00, 0xa0, 0x84, 0x00, 0x48, 0x00,
-  0x00, 0x27, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
-  0x81, 0x84, 0x00, 0x42, 0x48, 0x00, 0x00, 0x00, 0x40, 0x02, 0x20, 0x04,
-  0x00, 0x00, 0x00, 0x48, 0x80, 0x04, 0x00, 0x20, 0x04, 0x80, 0x04, 0x22,
-  0x88, 0x00, 0x00, 0xb0, 0x5c, 0x02, 0x28, 0x80, 0x42, 0x01, 0x00, 0x20,
-  0x08, 0x00, 0x00, 0x80, 0x02, 0x00, 0x20, 0x02, 0x48, 0x00, 0x90, 0x51,
-  0x20, 0x06, 0x42, 0x21, 0x00, 0x00, 0x00, 0x18, 0x00, 0x48, 0x00, 0x42,
-  0x30, 0x41, 0x00, 0x48, 0x14, 0x42, 0x20, 0x04, 0x00, 0x80, 0xf2, 0xad,
-  0xcd, 0x00, 0x00, 0x14, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x22, 0x84,
-  0x81, 0x00, 0x48, 0x00, 0x00, 0x10, 0x01, 0x40, 0x82, 0x14, 0x22, 0x04,
-  0x00, 0x00, 0x18, 0x00, 0x80, 0x04, 0x00, 0x14, 0x00, 0x42, 0x42, 0x42,
-  0x28, 0x42, 0x00, 0x00, 0x22, 0xef, 0xfa, 0x0a, 0x22, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x48, 0x48, 0x00, 0xa0,
-  0x14, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x00, 0x48,
-  0x20, 0x24, 0x04, 0x10, 0x01, 0x20, 0x08, 0x00, 0x00, 0xef, 0x1f, 0x03,
-  0x00, 0x10, 0x02, 0x80, 0x02, 0x00, 0x20, 0x82, 0x02, 0x80, 0x02, 0x28,
-  0x00, 0x00, 0x20, 0x24, 0x02, 0x48, 0x00, 0x20, 0x22, 0x04, 0x00, 0x80,
-  0x04, 0x00, 0x80, 0x04, 0x00, 0x20, 0x04, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x80, 0xf8, 0x98, 0x9b, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x00, 0x00, 0x22, 0x42, 0x22, 0x21, 0x00, 0x21, 0x20, 0x02,
-  0x00, 0x00, 0x00, 0x29, 0x84, 0x02, 0x00, 0x28, 0x42, 0x00, 0x00, 0x20,
-  0x04, 0x00, 0x00, 0x42, 0x12, 0x00, 0xc0, 0x8f, 0x00, 0x28, 0x00, 0x12,
-  0x00, 0x28, 0x20, 0x02, 0x00, 0x81, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x82, 0x06, 0x14, 0x80, 0x82, 0x84, 0x04, 0x00, 0x00, 0x68, 0x00,
-  0x20, 0x24, 0x24, 0x02, 0x00, 0x48, 0x00, 0x42, 0x00, 0x22, 0x00, 0x42,
-  0x2f, 0xb4, 0x0d, 0x00, 0x00, 0x12, 0x00, 0x28, 0x20, 0x02, 0x22, 0x40,
-  0x08, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x42, 0x00, 0x29, 0x84, 0x04, 0x14,
-  0x20, 0x04, 0x48, 0x00, 0x21, 0x00, 0x48, 0x00, 0x42, 0x00, 0x28, 0x42,
-  0x20, 0x84, 0x04, 0x42, 0x42, 0x80, 0x24, 0x02, 0x00, 0x3f, 0xfd, 0x06,
-  0x82, 0x1a, 0x42, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
-  0x00, 0x28, 0x48, 0x28, 0x80, 0x02, 0x28, 0x22, 0x28, 0x80, 0x22, 0x22,
-  0x04, 0x00, 0x20, 0x02, 0x22, 0x20, 0x06, 0x42, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0x00, 0x8a, 0xf4, 0x1c, 0xde, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x81, 0x00, 0x28, 0x28, 0x00, 0x00, 0x48, 0x42, 0x20, 0x24,
-  0x84, 0x04, 0x00, 0x42, 0x48, 0x00, 0x42, 0x48, 0x00, 0x00, 0x00, 0x80,
-  0x84, 0x01, 0x00, 0x00, 0x48, 0x00, 0x80, 0x84, 0x01, 0x00, 0xf0, 0x7c,
-  0x17, 0x00, 0x28, 0x80, 0x88, 0x22, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x00, 0x80, 0x02, 0x22, 0x00, 0x30, 0x22, 0x48, 0x22, 0x00, 0x00, 0x00,
-  0x10, 0x02, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
-  0x42, 0x42, 0x48, 0xf0, 0xac, 0x31, 0x20, 0x48, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x08, 0x22, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x14, 0x18, 0x00, 0xf0, 0x75, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x22, 0x00, 0x00, 0x20, 0x02, 0x40, 0x02, 0x68, 0x28, 0x00, 0x80,
-  0x04, 0x28, 0x22, 0x48, 0x00, 0x90, 0x42, 0x00, 0x20, 0x04, 0x80, 0x04,
-  0x42, 0x42, 0x20, 0x04, 0x00, 0x42, 0x00, 0x42, 0x00, 0x00, 0x27, 0xe1,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x40, 0x02,
-  0x21, 0x00, 0x42, 0x80, 0x04, 0x00, 0x80, 0x04, 0x00, 0x48, 0x00, 0x48,
-  0x42, 0x20, 0x04, 0x42, 0x20, 0x04, 0x42, 0x00, 0x00, 0x46, 0x01, 0x18,
-  0x12, 0x00, 0xf0, 0x19, 0x35, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x20, 0x04, 0x48,
-  0x20, 0x04, 0x42, 0x48, 0x00, 0x48, 0x00, 0x00, 0x80, 0x04, 0x48, 0x20,
-  0x04, 0x90, 0x41, 0x00, 0x00, 0x70, 0x38, 0x09, 0x84, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x52, 0x92, 0x00, 0x82, 0x00, 0x00, 0x20, 0x02,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x14, 0x02, 0x42, 0x00,
-  0x42, 0x48, 0x00, 0x42, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x42, 0x00,
-  0x20, 0x84, 0x84, 0x24, 0x04, 0x80, 0x04, 0x00, 0xf0, 0x11, 0x1f, 0x60,
-  0x88, 0x22, 0x48, 0x00, 0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x20, 0x02,
-  0x28, 0x80, 0x02, 0x80, 0x84, 0x83, 0x82, 0x88, 0x02, 0x28, 0x28, 0x40,
-  0x81, 0x04, 0x84, 0x80, 0x24, 0x04, 0x00, 0x00, 0x00, 0x44, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x10, 0x82, 0xf4, 0xde, 0x21, 0x00, 0x83, 0x08, 0x00,
-  0x22, 0x00, 0x80, 0x42, 0x08, 0x00, 0x28, 0x00, 0x28, 0x00, 0x25, 0x12,
-  0x02, 0x28, 0x68, 0x62, 0x42, 0x48, 0x48, 0xa0, 0x44, 0x00, 0x80, 0x04,
-  0x42, 0x80, 0x04, 0x42, 0x00, 0x48, 0x48, 0x20, 0x04, 0x48, 0x00, 0x42,
-  0x00, 0x42, 0x52, 0x00, 0xf0, 0x5f, 0xd8, 0x00, 0xaa, 0x02, 0x28, 0x22,
-  0x00, 0x00, 0x20, 0x62, 0x82, 0x00, 0x22, 0x00, 0x00, 0x28, 0x4a, 0x82,
-  0x24, 0x96, 0x42, 0x80, 0x06, 0x4a, 0x22, 0x84, 0xa6, 0x22, 0x42, 0x4a,
-  0x04, 0x42, 0x42, 0x00, 0x80, 0x04, 0x4a, 0x24, 0x04, 0x42, 0x48, 0x80,
-  0x24, 0x24, 0x04, 0x48, 0x48, 0x42, 0x1a, 0x84, 0x01, 0x42, 0xf0, 0x31,
-  0xe4, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x10, 0x82, 0x82,
-  0x02, 0x28, 0x80, 0xa4, 0x24, 0x48, 0x46, 0x22, 0x14, 0x82, 0x24, 0x02,
-  0x62, 0x80, 0x04, 0x4e, 0x42, 0x24, 0x29, 0x04, 0x20, 0x24, 0x84, 0x04,
-  0x48, 0x52, 0x20, 0x04, 0x42, 0x80, 0xa4, 0x44, 0x20, 0x84, 0x84, 0x01,
-  0x42, 0x80, 0xf4, 0x4d, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x22, 0x20, 0x42, 0x22, 0x02, 0x22, 0x10, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0xf0, 0xf5, 0x29, 0x00, 0x2a, 0x02, 0x2a, 0x82, 0x8a,
+  0x82, 0xf5, 0x00, 0x21, 0x40, 0x04, 0x23, 0x06, 0x10, 0x21, 0x83, 0x0c,
+  0x60, 0x00, 0x14, 0x00, 0x84, 0x80, 0x44, 0x4b, 0x01, 0x02, 0x47, 0x08,
+  0x50, 0x50, 0x12, 0xf0, 0x5b, 0x2d, 0x1e, 0x05, 0x32, 0x02, 0x00, 0x48,
+  0xa3, 0x04, 0x20, 0x82, 0x01, 0x1a, 0x06, 0x20, 0x80, 0x01, 0x42, 0x0d,
+  0x40, 0x48, 0x00, 0x80, 0x8c, 0x3a, 0x01, 0xb0, 0x82, 0x20, 0x88, 0x02,
+  0x00, 0x42, 0x1f, 0xe9, 0x0e, 0x20, 0x08, 0x83, 0x0b, 0x10, 0x02, 0x99,
+  0x0c, 0xf0, 0x18, 0x12, 0x24, 0xa0, 0x24, 0x00, 0x21, 0x42, 0x00, 0x12,
+  0x62, 0x20, 0x04, 0x42, 0x23, 0x81, 0x84, 0x02, 0x18, 0x20, 0x23, 0x01,
+  0x10, 0x08, 0x80, 0x04, 0x48, 0x28, 0x42, 0x00, 0x48, 0x00, 0x14, 0x22,
+  0x9f, 0xbf, 0x0c, 0x20, 0x0e, 0x12, 0xf4, 0x05, 0xf2, 0x1f, 0x41, 0x20,
+  0x41, 0x82, 0x02, 0x12, 0x80, 0x41, 0x42, 0x22, 0x04, 0x12, 0x21, 0xca,
+  0x02, 0x20, 0x21, 0x84, 0x91, 0x41, 0x12, 0x42, 0xa3, 0x81, 0x04, 0xa0,
+  0x41, 0x48, 0x18, 0x00, 0x82, 0x90, 0x84, 0x00, 0x80, 0x26, 0x02, 0x20,
+  0x88, 0x42, 0x02, 0x14, 0x72, 0x2f, 0x92, 0x0f, 0xe8, 0x06, 0x01, 0xae,
+  0x01, 0x10, 0x18, 0xe6, 0x01, 0x00, 0x04, 0x08, 0x00, 0xc2, 0x05, 0x30,
+  0x18, 0x20, 0xc4, 0x09, 0x0f, 0x20, 0xa0, 0x84, 0x0f, 0x08, 0x22, 0x27,
+  0xe1, 0x07, 0x02, 0x70, 0x00, 0x00, 0x00, 0x81, 0x84, 0x00, 0x42, 0x60,
+  0x06, 0x10, 0x40, 0x4e, 0x06, 0x02, 0x6c, 0x0d, 0xf1, 0x00, 0x20, 0x04,
+  0x80, 0x04, 0x22, 0x88, 0x00, 0x00, 0xb0, 0x5c, 0x02, 0x28, 0x80, 0x42,
+  0x01, 0x70, 0x0a, 0x20, 0x80, 0x02, 0xcb, 0x07, 0x60, 0x00, 0x90, 0x51,
+  0x20, 0x06, 0x42, 0x56, 0x0a, 0x90, 0x18, 0x00, 0x48, 0x00, 0x42, 0x30,
+  0x41, 0x00, 0x48, 0x05, 0x0e, 0x50, 0x00, 0x80, 0xf2, 0xad, 0xcd, 0x1d,
+  0x01, 0x20, 0x00, 0x92, 0x78, 0x00, 0x20, 0x84, 0x81, 0x64, 0x00, 0x70,
+  0x10, 0x01, 0x40, 0x82, 0x14, 0x22, 0x04, 0x2b, 0x00, 0x80, 0x80, 0x04,
+  0x00, 0x14, 0x00, 0x42, 0x42, 0x42, 0x12, 0x06, 0x40, 0x22, 0xef, 0xfa,
+  0x0a, 0xee, 0x05, 0x03, 0x01, 0x00, 0x51, 0x28, 0x48, 0x48, 0x00, 0xa0,
+  0x97, 0x0d, 0x00, 0x87, 0x0d, 0x80, 0x42, 0x00, 0x48, 0x20, 0x24, 0x04,
+  0x10, 0x01, 0x72, 0x00, 0x60, 0xef, 0x1f, 0x03, 0x00, 0x10, 0x02, 0x78,
+  0x00, 0x50, 0x82, 0x02, 0x80, 0x02, 0x28, 0x5e, 0x07, 0x51, 0x02, 0x48,
+  0x00, 0x20, 0x22, 0xc0, 0x0e, 0x01, 0xa6, 0x00, 0x02, 0x5d, 0x06, 0x51,
+  0xf8, 0x98, 0x9b, 0x00, 0x8c, 0xe5, 0x02, 0x01, 0xf9, 0x00, 0x61, 0x22,
+  0x42, 0x22, 0x21, 0x00, 0x21, 0x61, 0x00, 0x40, 0x29, 0x84, 0x02, 0x00,
+  0x73, 0x00, 0x01, 0x2c, 0x09, 0xe0, 0x12, 0x00, 0xc0, 0x8f, 0x00, 0x28,
+  0x00, 0x12, 0x00, 0x28, 0x20, 0x02, 0x00, 0x81, 0xcc, 0x01, 0x00, 0xfa,
+  0x0e, 0x90, 0x06, 0x14, 0x80, 0x82, 0x84, 0x04, 0x00, 0x00, 0x68, 0x7e,
+  0x0e, 0x00, 0xc5, 0x01, 0x80, 0x42, 0x00, 0x22, 0x00, 0x42, 0x2f, 0xb4,
+  0x0d, 0x1c, 0x05, 0x70, 0x28, 0x20, 0x02, 0x22, 0x40, 0x08, 0x8a, 0x4b,
+  0x00, 0xb1, 0x42, 0x00, 0x29, 0x84, 0x04, 0x14, 0x20, 0x04, 0x48, 0x00,
+  0x21, 0x25, 0x00, 0xf2, 0x04, 0x28, 0x42, 0x20, 0x84, 0x04, 0x42, 0x42,
+  0x80, 0x24, 0x02, 0x00, 0x3f, 0xfd, 0x06, 0x82, 0x1a, 0x42, 0x02, 0x00,
+  0x53, 0x03, 0xf1, 0x05, 0x22, 0x00, 0x28, 0x48, 0x28, 0x80, 0x02, 0x28,
+  0x22, 0x28, 0x80, 0x22, 0x22, 0x04, 0x00, 0x20, 0x02, 0x22, 0x20, 0x06,
+  0x60, 0x01, 0x00, 0x08, 0x01, 0x42, 0x8a, 0xf4, 0x1c, 0xde, 0xf7, 0x00,
+  0x40, 0x81, 0x00, 0x28, 0x28, 0x15, 0x08, 0x40, 0x20, 0x24, 0x84, 0x04,
+  0x80, 0x01, 0x01, 0x23, 0x00, 0x20, 0x80, 0x84, 0xed, 0x06, 0x01, 0x07,
+  0x00, 0x92, 0xf0, 0x7c, 0x17, 0x00, 0x28, 0x80, 0x88, 0x22, 0x02, 0xd5,
+  0x00, 0x00, 0xef, 0x06, 0x21, 0x30, 0x22, 0x13, 0x08, 0x20, 0x10, 0x02,
+  0x8e, 0x00, 0x01, 0x2e, 0x01, 0x90, 0x00, 0x42, 0x42, 0x48, 0xf0, 0xac,
+  0x31, 0x20, 0x48, 0xcd, 0x00, 0x21, 0x10, 0x08, 0xee, 0x01, 0x01, 0xc4,
+  0x01, 0x02, 0x64, 0x00, 0x03, 0x27, 0x00, 0x62, 0x14, 0x18, 0x00, 0xf0,
+  0x75, 0xaf, 0x12, 0x00, 0x00, 0xa4, 0x08, 0xe1, 0x02, 0x40, 0x02, 0x68,
+  0x28, 0x00, 0x80, 0x04, 0x28, 0x22, 0x48, 0x00, 0x90, 0x42, 0xed, 0x01,
+  0x10, 0x42, 0xc4, 0x01, 0x10, 0x42, 0x30, 0x00, 0x02, 0x19, 0x02, 0x02,
+  0x37, 0x02, 0x30, 0x40, 0x02, 0x21, 0xb9, 0x09, 0x00, 0x66, 0x01, 0x10,
+  0x48, 0xab, 0x00, 0x11, 0x04, 0x58, 0x0a, 0x91, 0x00, 0x46, 0x01, 0x18,
+  0x12, 0x00, 0xf0, 0x19, 0x35, 0x4e, 0x00, 0x05, 0x01, 0x00, 0x70, 0x20,
+  0x04, 0x20, 0x04, 0x48, 0x20, 0x04, 0x0a, 0x0b, 0x01, 0x81, 0x0f, 0xa2,
+  0x20, 0x04, 0x90, 0x41, 0x00, 0x00, 0x70, 0x38, 0x09, 0x84, 0x20, 0x00,
+  0x02, 0x8b, 0x0b, 0x01, 0x90, 0x0c, 0x00, 0xc2, 0x00, 0x05, 0x01, 0x00,
+  0x50, 0xf0, 0x52, 0x92, 0x00, 0x82, 0x6f, 0x00, 0x02, 0x4d, 0x00, 0x51,
+  0x20, 0x24, 0x14, 0x02, 0x42, 0x11, 0x01, 0x02, 0x3c, 0x08, 0x10, 0x42,
+  0xa8, 0x09, 0xb4, 0x24, 0x04, 0x80, 0x04, 0x00, 0xf0, 0x11, 0x1f, 0x60,
+  0x88, 0x22, 0xc3, 0x0b, 0x00, 0xdf, 0x09, 0xf0, 0x00, 0x02, 0x80, 0x84,
+  0x83, 0x82, 0x88, 0x02, 0x28, 0x28, 0x40, 0x81, 0x04, 0x84, 0x80, 0x24,
+  0xfa, 0x00, 0x03, 0xdd, 0x0b, 0xd1, 0x82, 0xf4, 0xde, 0x21, 0x00, 0x83,
+  0x08, 0x00, 0x22, 0x00, 0x80, 0x42, 0x08, 0x56, 0x08, 0xf0, 0x06, 0x25,
+  0x12, 0x02, 0x28, 0x68, 0x62, 0x42, 0x48, 0x48, 0xa0, 0x44, 0x00, 0x80,
+  0x04, 0x42, 0x80, 0x04, 0x42, 0x00, 0x48, 0x48, 0xcf, 0x01, 0xc0, 0x42,
+  0x00, 0x42, 0x52, 0x00, 0xf0, 0x5f, 0xd8, 0x00, 0xaa, 0x02, 0x28, 0x1e,
+  0x01, 0x20, 0x62, 0x82, 0xd7, 0x00, 0xf0, 0x19, 0x28, 0x4a, 0x82, 0x24,
+  0x96, 0x42, 0x80, 0x06, 0x4a, 0x22, 0x84, 0xa6, 0x22, 0x42, 0x4a, 0x04,
+  0x42, 0x42, 0x00, 0x80, 0x04, 0x4a, 0x24, 0x04, 0x42, 0x48, 0x80, 0x24,
+  0x24, 0x04, 0x48, 0x48, 0x42, 0x1a, 0x84, 0x01, 0x42, 0xf0, 0x31, 0xe4,
+  0x8e, 0x00, 0xf0, 0x0c, 0x28, 0x00, 0x00, 0x28, 0x10, 0x82, 0x82, 0x02,
+  0x28, 0x80, 0xa4, 0x24, 0x48, 0x46, 0x22, 0x14, 0x82, 0x24, 0x02, 0x62,
+  0x80, 0x04, 0x4e, 0x42, 0x24, 0x29, 0x04, 0xde, 0x01, 0xf3, 0x02, 0x48,
+  0x52, 0x20, 0x04, 0x42, 0x80, 0xa4, 0x44, 0x20, 0x84, 0x84, 0x01, 0x42,
+  0x80, 0xf4, 0x4d, 0xfb, 0xf9, 0x00, 0x82, 0x24, 0x00, 0x22, 0x20, 0x42,
+  0x22, 0x02, 0x22, 0x0e, 0x01, 0x03, 0xa9, 0x0d, 0x00, 0x01, 0x00, 0xf0,
+  0x20, 0x48, 0x00, 0xf0, 0xf5, 0x29, 0x00, 0x2a, 0x02, 0x2a, 0x82, 0x8a,
   0x02, 0x2a, 0x02, 0x2a, 0xd2, 0x88, 0xd2, 0x88, 0x42, 0x12, 0x02, 0x2a,
   0x22, 0x82, 0xc2, 0x22, 0x2f, 0x22, 0xb2, 0x62, 0xa4, 0x22, 0x6a, 0xa2,
   0x46, 0x4a, 0xb6, 0x22, 0xa2, 0x44, 0x6a, 0x26, 0xa4, 0x66, 0x6a, 0xa6,
-  0x44, 0x42, 0x4a, 0xa4, 0x44, 0x2b, 0x44, 0x00, 0xa0, 0x44, 0x4a, 0xa4,
-  0x44, 0x4a, 0xa4, 0x44, 0x4a, 0x04, 0xa0, 0x44, 0x4a, 0x04, 0x4a, 0xa4,
-  0x44, 0x4a, 0x94, 0x41, 0x1b, 0x51, 0x5a, 0x21, 0x84, 0xe4, 0x14, 0xf4,
-  0x68, 0x34, 0x00, 0x6e, 0x68, 0xa0, 0x62, 0x28, 0x28, 0xa0, 0x22, 0xa0,
-  0x22, 0xcd, 0x2c, 0x8d, 0x28, 0x6c, 0x12, 0x82, 0xa2, 0x22, 0x22, 0x28,
-  0x2c, 0xf2, 0x22, 0x22, 0x2f, 0x26, 0xa4, 0x44, 0x46, 0xa2, 0x57, 0x4a,
-  0xb6, 0xe2, 0xab, 0x44, 0x6a, 0x2e, 0xa4, 0x66, 0x6a, 0xf6, 0x41, 0x41,
-  0x42, 0x4e, 0x41, 0x8f, 0x84, 0xa4, 0x44, 0x8c, 0x04, 0xa0, 0x44, 0x4a,
-  0x84, 0x04, 0x4a, 0x84, 0x54, 0x44, 0xe0, 0x46, 0xa6, 0x44, 0x4a, 0xa6,
-  0x44, 0x4a, 0xa4, 0x44, 0x1b, 0x44, 0x5a, 0xe5, 0x25, 0x31, 0x42, 0x48,
-  0x2b, 0x55, 0x2f, 0x1d, 0x0b, 0x2a, 0xa2, 0x62, 0xa0, 0x22, 0x2a, 0xa2,
-  0x22, 0xa0, 0x22, 0xa0, 0x22, 0x2e, 0x2c, 0x2e, 0x28, 0x28, 0x24, 0x21,
-  0x22, 0x28, 0x60, 0x22, 0x23, 0xa2, 0x64, 0x29, 0x24, 0xe4, 0x26, 0xf1,
-  0x42, 0x62, 0x2a, 0xae, 0x66, 0x2a, 0xa6, 0x26, 0x6a, 0xa2, 0x66, 0x4e,
-  0x41, 0x42, 0x46, 0xf2, 0x42, 0x4a, 0x4a, 0x84, 0x04, 0xa0, 0x44, 0x4a,
-  0xa4, 0x44, 0x4a, 0xa4, 0x44, 0x4a, 0x44, 0x04, 0x4a, 0x86, 0x24, 0xa4,
-  0x44, 0x42, 0x4a, 0xa4, 0x44, 0x1a, 0xa4, 0x51, 0x29, 0x84, 0xa4, 0x54,
-  0xdf, 0x27, 0x05, 0x2a, 0xb2, 0x28, 0x06, 0x6a, 0xa2, 0xa2, 0x2a, 0x02,
-  0x2a, 0x02, 0x2a, 0xe2, 0xc2, 0xe2, 0x82, 0x12, 0x44, 0x32, 0x22, 0x22,
-  0x28, 0x60, 0x22, 0x23, 0xa2, 0x64, 0x29, 0xa4, 0x66, 0x6e, 0x52, 0x2f,
-  0x24, 0xa6, 0xe7, 0x6a, 0xa6, 0x6e, 0x6a, 0xa6, 0x64, 0x2a, 0xe6, 0x14,
-  0xa4, 0x44, 0x1f, 0x24, 0xd4, 0xa2, 0xb4, 0x42, 0x14, 0x08, 0xa0, 0x44,
-  0x42, 0x4a, 0x24, 0xa4, 0x44, 0x4a, 0x44, 0xa4, 0x44, 0x4b, 0x64, 0x4a,
-  0x24, 0xa6, 0x44, 0x4a, 0xa4, 0x44, 0x4a, 0xb4, 0x11, 0xa5, 0x51, 0x29,
-  0xc4, 0x42, 0x4e, 0x51, 0x9c, 0x03, 0x22, 0x00, 0x20, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xf0, 0x6e, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x5f, 0x36, 0x03, 0x2c, 0xf4, 0x11, 0x24, 0x85, 0xf2, 0x11, 0x24,
-  0x83, 0xf4, 0x11, 0x24, 0xa3, 0xd4, 0x41, 0xb2, 0x4a, 0xd1, 0x41, 0xb2,
-  0x4a, 0x99, 0x21, 0xaf, 0x24, 0x19, 0xb5, 0x4a, 0x39, 0x24, 0xaf, 0x14,
-  0x3b, 0x24, 0x2f, 0x14, 0x7b, 0x24, 0xd8, 0x12, 0xfb, 0x24, 0x48, 0x1c,
-  0xfb, 0x24, 0x4a, 0x1c, 0xfa, 0x26, 0x4a, 0x16, 0xf1, 0x24, 0x4a, 0x96,
-  0xe1, 0xa2, 0x64, 0x59, 0xac, 0xe4, 0x49, 0xc2, 0x4a, 0x1f, 0x49, 0xd2,
-  0x22, 0xf4, 0x91, 0x24, 0x85, 0xf2, 0x91, 0x24, 0x83, 0xf4, 0x91, 0x24,
-  0xa3, 0xf4, 0x91, 0x24, 0xab, 0x14, 0x1d, 0x24, 0xab, 0x94, 0x19, 0xb2,
-  0x4a, 0x19, 0xb5, 0x4a, 0x39, 0x24, 0xab, 0x94, 0x43, 0xb2, 0x42, 0x79,
+  0x45, 0x0e, 0x81, 0x44, 0x2b, 0x44, 0x00, 0xa0, 0x44, 0x4a, 0xa4, 0x03,
+  0x00, 0x50, 0x04, 0xa0, 0x44, 0x4a, 0x04, 0x09, 0x00, 0xf0, 0x33, 0x94,
+  0x41, 0x1b, 0x51, 0x5a, 0x21, 0x84, 0xe4, 0x14, 0xf4, 0x68, 0x34, 0x00,
+  0x6e, 0x68, 0xa0, 0x62, 0x28, 0x28, 0xa0, 0x22, 0xa0, 0x22, 0xcd, 0x2c,
+  0x8d, 0x28, 0x6c, 0x12, 0x82, 0xa2, 0x22, 0x22, 0x28, 0x2c, 0xf2, 0x22,
+  0x22, 0x2f, 0x26, 0xa4, 0x44, 0x46, 0xa2, 0x57, 0x4a, 0xb6, 0xe2, 0xab,
+  0x44, 0x6a, 0x2e, 0xa4, 0x66, 0x6a, 0xf6, 0x41, 0x41, 0x42, 0x4e, 0x41,
+  0x8f, 0x84, 0xa4, 0x44, 0x8c, 0x4b, 0x00, 0xc0, 0x84, 0x04, 0x4a, 0x84,
+  0x54, 0x44, 0xe0, 0x46, 0xa6, 0x44, 0x4a, 0xa6, 0x60, 0x00, 0xf0, 0x01,
+  0x1b, 0x44, 0x5a, 0xe5, 0x25, 0x31, 0x42, 0x48, 0x2b, 0x55, 0x2f, 0x1d,
+  0x0b, 0x2a, 0xa2, 0x62, 0xd1, 0x07, 0x10, 0x22, 0x58, 0x00, 0xf0, 0x18,
+  0x2e, 0x2c, 0x2e, 0x28, 0x28, 0x24, 0x21, 0x22, 0x28, 0x60, 0x22, 0x23,
+  0xa2, 0x64, 0x29, 0x24, 0xe4, 0x26, 0xf1, 0x42, 0x62, 0x2a, 0xae, 0x66,
+  0x2a, 0xa6, 0x26, 0x6a, 0xa2, 0x66, 0x4e, 0x41, 0x42, 0x46, 0xf2, 0x42,
+  0x4a, 0x4a, 0x84, 0x54, 0x00, 0x02, 0xa9, 0x00, 0x42, 0x44, 0x04, 0x4a,
+  0x86, 0x05, 0x0f, 0xf0, 0x04, 0x44, 0x1a, 0xa4, 0x51, 0x29, 0x84, 0xa4,
+  0x54, 0xdf, 0x27, 0x05, 0x2a, 0xb2, 0x28, 0x06, 0x6a, 0xa2, 0xa2, 0x2a,
+  0xfb, 0x00, 0x84, 0xe2, 0xc2, 0xe2, 0x82, 0x12, 0x44, 0x32, 0x22, 0x53,
+  0x00, 0xf0, 0x0f, 0xa4, 0x66, 0x6e, 0x52, 0x2f, 0x24, 0xa6, 0xe7, 0x6a,
+  0xa6, 0x6e, 0x6a, 0xa6, 0x64, 0x2a, 0xe6, 0x14, 0xa4, 0x44, 0x1f, 0x24,
+  0xd4, 0xa2, 0xb4, 0x42, 0x14, 0x08, 0xa0, 0x44, 0x42, 0x51, 0x0f, 0x81,
+  0x4a, 0x44, 0xa4, 0x44, 0x4b, 0x64, 0x4a, 0x24, 0xaa, 0x00, 0xd1, 0x4a,
+  0xb4, 0x11, 0xa5, 0x51, 0x29, 0xc4, 0x42, 0x4e, 0x51, 0x9c, 0x03, 0x22,
+  0x08, 0x05, 0x04, 0x01, 0x00, 0x01, 0xd1, 0x05, 0x01, 0x01, 0x00, 0x00,
+  0x42, 0x04, 0x00, 0x86, 0x02, 0x22, 0x6e, 0xa4, 0x10, 0x00, 0x14, 0x8c,
+  0x26, 0x00, 0x06, 0xa3, 0x04, 0x02, 0x46, 0x03, 0x4c, 0x00, 0x48, 0x5f,
+  0x36, 0x40, 0x0f, 0x11, 0xb2, 0xf8, 0x0e, 0xf0, 0x0e, 0x99, 0x21, 0xaf,
+  0x24, 0x19, 0xb5, 0x4a, 0x39, 0x24, 0xaf, 0x14, 0x3b, 0x24, 0x2f, 0x14,
+  0x7b, 0x24, 0xd8, 0x12, 0xfb, 0x24, 0x48, 0x1c, 0xfb, 0x24, 0x4a, 0x1c,
+  0xfa, 0x26, 0x3e, 0x0f, 0x11, 0x4a, 0x3e, 0x0f, 0x00, 0xf9, 0x06, 0x40,
+  0x4a, 0x1f, 0x49, 0xd2, 0xf9, 0x06, 0xb0, 0x85, 0xf2, 0x91, 0x24, 0x83,
+  0xf4, 0x91, 0x24, 0xa3, 0xf4, 0x91, 0xcb, 0x0e, 0x00, 0xf7, 0x06, 0x21,
+  0xb2, 0x4a, 0x44, 0x00, 0xf2, 0x12, 0xab, 0x94, 0x43, 0xb2, 0x42, 0x79,
   0x24, 0xb8, 0x42, 0xf9, 0x24, 0x48, 0x98, 0x4f, 0xa2, 0xf4, 0xfa, 0x88,
   0xc0, 0x42, 0x1f, 0xc1, 0xf6, 0x28, 0x42, 0x1f, 0x41, 0x32, 0x48, 0x1f,
-  0x41, 0x32, 0x6a, 0x1d, 0x24, 0xab, 0x16, 0x1d, 0x24, 0xaf, 0x44, 0xd9,
-  0x41, 0xb2, 0x6a, 0x99, 0x25, 0x8b, 0x94, 0x41, 0xaf, 0x14, 0x1b, 0xf4,
-  0x42, 0xb1, 0x45, 0xc8, 0xb1, 0x65, 0xc8, 0xb1, 0x6d, 0x18, 0x1c, 0xfb,
-  0x24, 0x8a, 0x1e, 0x81, 0x4f, 0xa2, 0x64, 0x19, 0x26, 0x6a, 0x59, 0xbc,
-  0xe4, 0x59, 0x42, 0xf8, 0x91, 0x2c, 0xac, 0xf4, 0x91, 0x64, 0x85, 0xf2,
-  0x91, 0x64, 0x83, 0xf4, 0x91, 0x24, 0xa1, 0x1f, 0x48, 0x32, 0x4a, 0x1d,
-  0x24, 0xaf, 0x44, 0xd9, 0x41, 0xb2, 0x4a, 0x9b, 0x25, 0xa9, 0x39, 0x24,
-  0xab, 0x94, 0x43, 0x92, 0x92, 0x47, 0x82, 0x2b, 0x84, 0x67, 0x82, 0x29,
-  0xf9, 0x24, 0x5a, 0xaf, 0xbc, 0x0f, 0x82, 0x82, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x10, 0x02, 0x18, 0x80, 0x08,
-  0x00, 0x00, 0x14, 0x00, 0x84, 0x80, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x25, 0x01, 0xdf, 0x72, 0x0f, 0x20, 0x02,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x81, 0x00, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x42, 0x18, 0x00, 0x00, 0x00, 0x53, 0x07, 0x20, 0x08,
-  0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x20, 0x04,
-  0x00, 0x42, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x82, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x04, 0x12, 0xa0, 0x41, 0x00, 0x14, 0x16, 0x01, 0x3f,
-  0x1d, 0x08, 0x20, 0x0e, 0x28, 0x00, 0x00, 0x00, 0x41, 0x20, 0x02, 0x19,
-  0x12, 0x48, 0x08, 0x21, 0x28, 0x24, 0x48, 0x20, 0x01, 0x8a, 0x04, 0x00,
-  0x48, 0x90, 0x41, 0x80, 0x14, 0x08, 0x42, 0x82, 0x00, 0x00, 0x00, 0x10,
-  0x04, 0x22, 0x20, 0x04, 0x52, 0x18, 0x12, 0x40, 0x42, 0x41, 0x21, 0xf1,
-  0x64, 0xd8, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x18, 0xd0, 0xeb, 0x0b,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x1d, 0x06, 0x00, 0x10, 0x08,
-  0x18, 0x00, 0x82, 0x81, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0x01, 0x00,
-  0x00, 0x00, 0x38, 0x20, 0x02, 0x00, 0x11, 0x12, 0xf0, 0x77, 0x89, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x28, 0x00, 0x80, 0x01,
-  0x00, 0x00, 0x00, 0x28, 0x20, 0x02, 0x00, 0x11, 0x00, 0xff, 0x91, 0x0d,
-  0x00, 0x10, 0x08, 0x12, 0x00, 0x10, 0x08, 0x00, 0x81, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0xdf, 0x68, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x86, 0x02, 0x60, 0x82,
-  0x80, 0x01, 0x80, 0x02, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x82, 0x08, 0x80, 0x01, 0x40, 0x21, 0x84, 0x01, 0xef, 0x15,
-  0x0d, 0x00, 0x40, 0x02, 0x40, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x22, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x89, 0x01, 0x14, 0x00, 0x00, 0x10, 0x01, 0x00, 0xff,
-  0x68, 0x01, 0x00, 0xc0, 0x12, 0x00, 0x28, 0x00, 0x00, 0x20, 0x01, 0x00,
-  0x00, 0x00, 0x20, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x82, 0x00, 0x48, 0x00, 0x00, 0x10, 0x08, 0x19, 0x08, 0x00, 0x00, 0x20,
-  0x24, 0x01, 0x6e, 0x43, 0x00, 0x28, 0x00, 0x00, 0x81, 0x00, 0x00, 0x84,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x40, 0x04, 0x00, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x12, 0x00,
-  0x00, 0x00, 0xdf, 0x88, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x40, 0x01,
-  0xdf, 0x34, 0x04, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x22, 0x00, 0x00,
-  0x22, 0x20, 0x22, 0x82, 0x01, 0x12, 0x20, 0x81, 0x22, 0x01, 0x20, 0x21,
-  0x01, 0x12, 0x20, 0x21, 0x01, 0xdf, 0xde, 0x0a, 0x00, 0x00, 0x00, 0x81,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
-  0x00, 0x00, 0x28, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x28, 0x80, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xee, 0x7b, 0x00, 0x00, 0x00, 0x18,
-  0x18, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x22,
-  0x80, 0x02, 0x00, 0x00, 0x28, 0xf0, 0xb7, 0x26, 0x00, 0x40, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x12, 0xf0, 0x79, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x02, 0x20, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xcf, 0x75, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x08, 0x84, 0x10,
-  0x08, 0x00, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x32, 0x6a, 0x70, 0x07, 0x01, 0xf8, 0x06, 0xf0, 0x0a, 0x6a, 0x99,
+  0x25, 0x8b, 0x94, 0x41, 0xaf, 0x14, 0x1b, 0xf4, 0x42, 0xb1, 0x45, 0xc8,
+  0xb1, 0x65, 0xc8, 0xb1, 0x6d, 0x18, 0x1c, 0xfb, 0x24, 0x8a, 0x1e, 0x3d,
+  0x0f, 0xf0, 0x04, 0x19, 0x26, 0x6a, 0x59, 0xbc, 0xe4, 0x59, 0x42, 0xf8,
+  0x91, 0x2c, 0xac, 0xf4, 0x91, 0x64, 0x85, 0xf2, 0x91, 0x64, 0x72, 0x00,
+  0x30, 0xa1, 0x1f, 0x48, 0x7e, 0x0f, 0x04, 0x38, 0x07, 0x11, 0xa9, 0x72,
+  0x00, 0xf9, 0x02, 0x92, 0x92, 0x47, 0x82, 0x2b, 0x84, 0x67, 0x82, 0x29,
+  0xf9, 0x24, 0x5a, 0xaf, 0xbc, 0x0f, 0x82, 0x82, 0x29, 0x0f, 0x14, 0x18,
+  0xf8, 0x06, 0x00, 0x2b, 0x01, 0x03, 0x0d, 0x07, 0x54, 0x25, 0x01, 0xdf,
+  0x72, 0x0f, 0xb4, 0x03, 0x23, 0x11, 0x81, 0x5d, 0x01, 0x00, 0x3c, 0x06,
+  0x04, 0x01, 0x00, 0x10, 0x42, 0x61, 0x0a, 0x52, 0x53, 0x07, 0x20, 0x08,
+  0x10, 0x3b, 0x08, 0x20, 0x84, 0x10, 0x60, 0x06, 0x03, 0xd6, 0x03, 0x01,
+  0x58, 0x07, 0xf0, 0x00, 0x00, 0x20, 0x04, 0x12, 0xa0, 0x41, 0x00, 0x14,
+  0x16, 0x01, 0x3f, 0x1d, 0x08, 0x20, 0x0e, 0x58, 0x00, 0xf0, 0x08, 0x41,
+  0x20, 0x02, 0x19, 0x12, 0x48, 0x08, 0x21, 0x28, 0x24, 0x48, 0x20, 0x01,
+  0x8a, 0x04, 0x00, 0x48, 0x90, 0x41, 0x80, 0x14, 0x08, 0x42, 0x2f, 0x00,
+  0xf0, 0x00, 0x10, 0x04, 0x22, 0x20, 0x04, 0x52, 0x18, 0x12, 0x40, 0x42,
+  0x41, 0x21, 0xf1, 0x64, 0xd8, 0xf0, 0x04, 0x05, 0x6c, 0x00, 0x0a, 0x01,
+  0x00, 0x72, 0x20, 0x04, 0x00, 0x18, 0xd0, 0xeb, 0x0b, 0x0d, 0x00, 0x16,
+  0x40, 0x26, 0x00, 0x02, 0x82, 0x04, 0x03, 0x01, 0x00, 0xa0, 0xb0, 0x1d,
+  0x06, 0x00, 0x10, 0x08, 0x18, 0x00, 0x82, 0x81, 0x0e, 0x00, 0x02, 0xe3,
+  0x01, 0x10, 0x10, 0xbe, 0x00, 0x00, 0x53, 0x0e, 0xc0, 0x00, 0x00, 0x00,
+  0x38, 0x20, 0x02, 0x00, 0x11, 0x12, 0xf0, 0x77, 0x89, 0x19, 0x00, 0x02,
+  0x2d, 0x06, 0x03, 0x08, 0x02, 0x00, 0xbf, 0x04, 0x03, 0x25, 0x00, 0x00,
+  0x4a, 0x06, 0x90, 0x11, 0x00, 0xff, 0x91, 0x0d, 0x00, 0x10, 0x08, 0x12,
+  0x91, 0x00, 0x01, 0x4d, 0x00, 0x00, 0x01, 0x00, 0x14, 0x41, 0x09, 0x00,
+  0x01, 0x29, 0x00, 0x55, 0x80, 0x01, 0xdf, 0x68, 0x07, 0x12, 0x00, 0x01,
+  0x01, 0x00, 0x03, 0x21, 0x00, 0x00, 0x54, 0x00, 0x02, 0x8d, 0x02, 0x98,
+  0x1f, 0x86, 0x02, 0x60, 0x82, 0x80, 0x01, 0x80, 0x02, 0xd9, 0x00, 0x00,
+  0x50, 0x01, 0x11, 0x88, 0x09, 0x00, 0xe0, 0x82, 0x08, 0x80, 0x01, 0x40,
+  0x21, 0x84, 0x01, 0xef, 0x15, 0x0d, 0x00, 0x40, 0x02, 0xd6, 0x00, 0x01,
+  0xc1, 0x0b, 0x23, 0x22, 0x00, 0x3a, 0x07, 0x01, 0x01, 0x00, 0x30, 0x89,
+  0x01, 0x14, 0x77, 0x07, 0x70, 0x00, 0xff, 0x68, 0x01, 0x00, 0xc0, 0x12,
+  0x59, 0x00, 0x02, 0xf6, 0x09, 0x04, 0x9c, 0x06, 0x21, 0x00, 0x82, 0x98,
+  0x07, 0x30, 0x08, 0x19, 0x08, 0x69, 0x05, 0x30, 0x01, 0x6e, 0x43, 0x23,
+  0x00, 0x33, 0x81, 0x00, 0x00, 0xa3, 0x05, 0x32, 0x80, 0x04, 0x40, 0xa2,
+  0x01, 0x00, 0x01, 0x00, 0x10, 0x18, 0x01, 0x07, 0x43, 0x00, 0x00, 0xdf,
+  0x88, 0x49, 0x01, 0x08, 0x01, 0x00, 0x03, 0x61, 0x08, 0x00, 0xdb, 0x00,
+  0x55, 0x40, 0x01, 0xdf, 0x34, 0x04, 0x67, 0x01, 0x03, 0x49, 0x00, 0x01,
+  0x19, 0x02, 0xf1, 0x05, 0x22, 0x20, 0x22, 0x82, 0x01, 0x12, 0x20, 0x81,
+  0x22, 0x01, 0x20, 0x21, 0x01, 0x12, 0x20, 0x21, 0x01, 0xdf, 0xde, 0x0a,
+  0xf9, 0x06, 0x05, 0x29, 0x00, 0x20, 0x40, 0x04, 0xfd, 0x00, 0x00, 0x3f,
+  0x05, 0x22, 0x00, 0x28, 0x53, 0x00, 0x40, 0x40, 0x01, 0xee, 0x7b, 0x7c,
+  0x00, 0x1e, 0x18, 0xdf, 0x01, 0x00, 0x6d, 0x00, 0x10, 0x22, 0x26, 0x00,
+  0x48, 0x28, 0xf0, 0xb7, 0x26, 0xd7, 0x01, 0x0c, 0x01, 0x00, 0x53, 0x12,
+  0x00, 0x12, 0xf0, 0x79, 0x66, 0x07, 0x04, 0x91, 0x00, 0x01, 0x01, 0x00,
+  0x11, 0x20, 0x3e, 0x0e, 0x03, 0x01, 0x00, 0x20, 0xcf, 0x75, 0xd8, 0x00,
+  0x75, 0x10, 0x08, 0x84, 0x10, 0x08, 0x00, 0x84, 0x26, 0x00, 0xf2, 0x0a,
   0x20, 0x22, 0x22, 0x02, 0x28, 0x00, 0x80, 0xa2, 0x21, 0x32, 0xa0, 0x21,
   0x22, 0x1a, 0x02, 0x18, 0x18, 0x18, 0x13, 0x01, 0x00, 0x00, 0x19, 0x0b,
-  0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x40, 0x01, 0x3f, 0xd8, 0x08, 0x84,
-  0x81, 0x48, 0x80, 0x88, 0x81, 0x01, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x40, 0x08,
-  0x48, 0x00, 0x00, 0x00, 0x20, 0x41, 0x24, 0x01, 0x12, 0x00, 0x80, 0x42,
-  0x81, 0x02, 0x21, 0xd0, 0x65, 0x0a, 0x20, 0x08, 0x80, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x02, 0x28, 0x00, 0x2a, 0x02, 0x22, 0x20, 0x82, 0x02, 0x20, 0x83, 0x21,
-  0x03, 0x12, 0x22, 0x00, 0x1a, 0x41, 0x31, 0x11, 0x20, 0xe1, 0x11, 0x01,
-  0x7f, 0x8f, 0x0d, 0x60, 0x88, 0x00, 0xc0, 0x18, 0x8c, 0x01, 0x10, 0x08,
-  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x22, 0x28, 0x00, 0x80, 0x23, 0x01, 0x80, 0xa2, 0x22, 0x80,
-  0x21, 0xa1, 0x11, 0x00, 0x18, 0x38, 0x60, 0x12, 0xf0, 0x28, 0x1b, 0x00,
-  0x10, 0x08, 0x20, 0x21, 0x11, 0x08, 0x00, 0x40, 0x18, 0x08, 0x10, 0x18,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x20, 0x82, 0x82, 0x02,
-  0x28, 0x00, 0x28, 0x22, 0x12, 0x38, 0x38, 0x80, 0x81, 0x81, 0x01, 0x18,
-  0x22, 0x80, 0x03, 0x00, 0x00, 0x8f, 0xc6, 0x0a, 0x00, 0x00, 0x10, 0x08,
-  0x81, 0x10, 0x08, 0x81, 0x10, 0x08, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x02, 0x20, 0x02, 0x00, 0x00, 0x00, 0x22, 0x00, 0x12,
-  0x20, 0x01, 0x12, 0x20, 0x02, 0x32, 0x20, 0x03, 0x12, 0xd0, 0x4d, 0x0f,
-  0x00, 0x85, 0x08, 0x8c, 0xe8, 0x81, 0xf1, 0x18, 0x18, 0x50, 0x88, 0x85,
-  0x58, 0x88, 0x50, 0x88, 0x85, 0x08, 0x85, 0x18, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x50, 0x44, 0x45, 0x04, 0x80, 0x82, 0x22, 0x02, 0x2a, 0x02, 0x2a,
-  0x82, 0x02, 0x2a, 0x02, 0x18, 0x18, 0x00, 0x00, 0x00, 0x3a, 0xa3, 0x33,
-  0x2a, 0xe2, 0x12, 0x91, 0x21, 0x28, 0xa0, 0x22, 0xf0, 0xb4, 0x69, 0x00,
-  0x4e, 0x48, 0x85, 0x88, 0x44, 0xe8, 0x81, 0xf1, 0x18, 0x18, 0x85, 0x08,
-  0x50, 0xcc, 0x85, 0xe8, 0x42, 0x02, 0x8d, 0x28, 0x50, 0x88, 0x00, 0x40,
-  0x12, 0x02, 0x2b, 0x11, 0xa0, 0x98, 0xd0, 0x44, 0x58, 0x44, 0x00, 0x1d,
-  0x21, 0x28, 0x26, 0x71, 0x28, 0xa8, 0x22, 0x4e, 0x48, 0x80, 0x06, 0x2a,
-  0x82, 0xa2, 0x22, 0x2a, 0x83, 0xf1, 0x14, 0x14, 0x18, 0x3e, 0x14, 0x18,
-  0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x22, 0x3a, 0x81, 0xe3, 0x21, 0xb3, 0x22,
-  0x42, 0xb1, 0x12, 0xf1, 0x7f, 0xad, 0x00, 0x48, 0x85, 0x08, 0x81, 0x8b,
-  0x11, 0x1a, 0x51, 0x88, 0x00, 0x44, 0x85, 0x88, 0x02, 0x50, 0x88, 0x81,
-  0x81, 0x00, 0x10, 0x02, 0x18, 0x80, 0x08, 0x50, 0x44, 0x00, 0x26, 0x21,
-  0xa2, 0x22, 0x84, 0x2a, 0x82, 0x04, 0x28, 0x2a, 0xa2, 0x22, 0x28, 0x2a,
-  0x82, 0xa1, 0x32, 0x1e, 0x14, 0x2a, 0xa3, 0x31, 0x18, 0x1a, 0xa1, 0x11,
-  0x12, 0x2a, 0x81, 0xc3, 0x11, 0x3a, 0x11, 0xa2, 0x32, 0x18, 0xb7, 0x26,
-  0x00, 0x89, 0x54, 0x88, 0x42, 0x89, 0xb8, 0x18, 0xd1, 0x88, 0x01, 0x50,
-  0x88, 0x85, 0x0c, 0x49, 0x52, 0x88, 0x87, 0x82, 0x50, 0x88, 0x85, 0x08,
-  0x00, 0x21, 0x24, 0x18, 0xa0, 0x81, 0x20, 0x58, 0x44, 0x00, 0x26, 0x21,
-  0xb2, 0x21, 0xe2, 0x82, 0xa2, 0x22, 0x8b, 0x62, 0xa0, 0x24, 0x2a, 0xa2,
-  0x22, 0x28, 0x2a, 0xa2, 0x32, 0x2a, 0xe3, 0x41, 0xa1, 0x32, 0x4b, 0x31,
-  0x18, 0x1a, 0xa1, 0x11, 0x3a, 0xa3, 0x13, 0x1b, 0x31, 0x18, 0x3a, 0xb1,
-  0x22, 0xc2, 0x13, 0x18, 0xcf, 0x4c, 0x0d, 0x00, 0x00, 0x40, 0x88, 0x41,
-  0x08, 0x00, 0x84, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x22, 0x20, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x12, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x08, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01,
-  0x00, 0x00, 0x18, 0xf0, 0xb1, 0xe3, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28,
-  0x1f, 0x41, 0x32, 0x48, 0x1f, 0x41, 0x32, 0x4a, 0x1d, 0x2c, 0xab, 0x14,
-  0x1d, 0x24, 0xab, 0x94, 0x19, 0xb2, 0x4a, 0x59, 0x85, 0xab, 0x94, 0x43,
-  0xf2, 0x4a, 0x91, 0x43, 0xf2, 0x42, 0x91, 0x47, 0x82, 0x2d, 0x91, 0x4f,
-  0x82, 0xc4, 0x91, 0x4f, 0xa2, 0xc4, 0x81, 0x4f, 0xa2, 0x64, 0x11, 0x4f,
-  0xa2, 0x64, 0x19, 0x2e, 0x4a, 0x96, 0xe5, 0xa2, 0xe4, 0x49, 0xc2, 0x4a,
-  0x1f, 0x49, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f, 0x49, 0x32, 0x48,
-  0x1f, 0x49, 0x32, 0x4a, 0x1f, 0x48, 0xb2, 0x4a, 0xd1, 0x41, 0xb2, 0x4a,
-  0x99, 0x21, 0xab, 0x94, 0x51, 0xab, 0x94, 0x43, 0xb2, 0x4a, 0x3b, 0x24,
-  0x2b, 0xb4, 0x47, 0x82, 0x29, 0xfb, 0x34, 0x48, 0xb8, 0x4f, 0xa2, 0xf4,
-  0x64, 0xa2, 0xc0, 0x42, 0x1f, 0xc1, 0xc6, 0x42, 0x1f, 0x41, 0x32, 0x48,
-  0x1f, 0x41, 0x32, 0x42, 0x1d, 0x24, 0xab, 0x14, 0x1d, 0x24, 0xaf, 0x44,
-  0xd9, 0x41, 0xb2, 0x42, 0x9b, 0x25, 0xab, 0x94, 0x43, 0xf2, 0x42, 0x91,
-  0x43, 0xf2, 0x42, 0x91, 0x47, 0x82, 0x2d, 0x91, 0x6f, 0x82, 0xd4, 0x12,
-  0xf9, 0x24, 0x5a, 0x1c, 0xf9, 0x24, 0xca, 0x1e, 0x81, 0x4f, 0xa2, 0x64,
-  0x19, 0x2e, 0x4a, 0x96, 0xc5, 0x4b, 0x96, 0xc5, 0x4a, 0x1f, 0xc9, 0xc2,
-  0x4a, 0x1f, 0x49, 0xd6, 0x28, 0xf4, 0x91, 0x24, 0x83, 0xf4, 0x91, 0x24,
-  0xa3, 0xf4, 0x81, 0x24, 0xa3, 0xd4, 0x41, 0xf2, 0x4a, 0x84, 0x1d, 0x24,
+  0x82, 0xb1, 0x02, 0x03, 0x01, 0x00, 0x01, 0x28, 0x02, 0x06, 0x01, 0x00,
+  0xd5, 0x12, 0x40, 0x01, 0x3f, 0xd8, 0x08, 0x84, 0x81, 0x48, 0x80, 0x88,
+  0x81, 0x01, 0x2e, 0x0a, 0x30, 0x80, 0x01, 0x88, 0xd0, 0x00, 0x20, 0x40,
+  0x08, 0x4c, 0x03, 0x30, 0x20, 0x41, 0x24, 0x64, 0x0d, 0x92, 0x42, 0x81,
+  0x02, 0x21, 0xd0, 0x65, 0x0a, 0x20, 0x08, 0x51, 0x02, 0x25, 0x10, 0x08,
+  0x30, 0x01, 0xf4, 0x14, 0x28, 0x00, 0x2a, 0x02, 0x22, 0x20, 0x82, 0x02,
+  0x20, 0x83, 0x21, 0x03, 0x12, 0x22, 0x00, 0x1a, 0x41, 0x31, 0x11, 0x20,
+  0xe1, 0x11, 0x01, 0x7f, 0x8f, 0x0d, 0x60, 0x88, 0x00, 0xc0, 0x18, 0x8c,
+  0x01, 0x10, 0x08, 0x5c, 0x02, 0x00, 0x36, 0x01, 0xf1, 0x15, 0x00, 0x00,
+  0x22, 0x28, 0x00, 0x80, 0x23, 0x01, 0x80, 0xa2, 0x22, 0x80, 0x21, 0xa1,
+  0x11, 0x00, 0x18, 0x38, 0x60, 0x12, 0xf0, 0x28, 0x1b, 0x00, 0x10, 0x08,
+  0x20, 0x21, 0x11, 0x08, 0x00, 0x40, 0x18, 0x08, 0x10, 0x18, 0x63, 0x00,
+  0x40, 0x41, 0x00, 0x00, 0x20, 0x9b, 0x06, 0xf0, 0x04, 0x00, 0x28, 0x22,
+  0x12, 0x38, 0x38, 0x80, 0x81, 0x81, 0x01, 0x18, 0x22, 0x80, 0x03, 0x00,
+  0x00, 0x8f, 0xc6, 0x0a, 0x80, 0x00, 0x11, 0x81, 0x03, 0x00, 0x04, 0x4d,
+  0x01, 0x00, 0x56, 0x07, 0x01, 0x54, 0x02, 0xf2, 0x11, 0x12, 0x20, 0x01,
+  0x12, 0x20, 0x02, 0x32, 0x20, 0x03, 0x12, 0xd0, 0x4d, 0x0f, 0x00, 0x85,
+  0x08, 0x8c, 0xe8, 0x81, 0xf1, 0x18, 0x18, 0x50, 0x88, 0x85, 0x58, 0x88,
+  0x50, 0x88, 0x85, 0x08, 0x85, 0x5c, 0x00, 0x70, 0x50, 0x44, 0x45, 0x04,
+  0x80, 0x82, 0x22, 0xa9, 0x05, 0x40, 0x82, 0x02, 0x2a, 0x02, 0xb5, 0x01,
+  0xf1, 0x06, 0x00, 0x3a, 0xa3, 0x33, 0x2a, 0xe2, 0x12, 0x91, 0x21, 0x28,
+  0xa0, 0x22, 0xf0, 0xb4, 0x69, 0x00, 0x4e, 0x48, 0x85, 0x88, 0x44, 0x3d,
+  0x00, 0xf2, 0x48, 0x85, 0x08, 0x50, 0xcc, 0x85, 0xe8, 0x42, 0x02, 0x8d,
+  0x28, 0x50, 0x88, 0x00, 0x40, 0x12, 0x02, 0x2b, 0x11, 0xa0, 0x98, 0xd0,
+  0x44, 0x58, 0x44, 0x00, 0x1d, 0x21, 0x28, 0x26, 0x71, 0x28, 0xa8, 0x22,
+  0x4e, 0x48, 0x80, 0x06, 0x2a, 0x82, 0xa2, 0x22, 0x2a, 0x83, 0xf1, 0x14,
+  0x14, 0x18, 0x3e, 0x14, 0x18, 0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x22, 0x3a,
+  0x81, 0xe3, 0x21, 0xb3, 0x22, 0x42, 0xb1, 0x12, 0xf1, 0x7f, 0xad, 0x00,
+  0x48, 0x85, 0x08, 0x81, 0x8b, 0x11, 0x1a, 0x51, 0x88, 0x00, 0x44, 0x85,
+  0x88, 0x02, 0x50, 0x88, 0x81, 0x81, 0x9f, 0x04, 0xf0, 0x0a, 0x50, 0x44,
+  0x00, 0x26, 0x21, 0xa2, 0x22, 0x84, 0x2a, 0x82, 0x04, 0x28, 0x2a, 0xa2,
+  0x22, 0x28, 0x2a, 0x82, 0xa1, 0x32, 0x1e, 0x14, 0x2a, 0xa3, 0x31, 0x45,
+  0x00, 0xf0, 0x11, 0x12, 0x2a, 0x81, 0xc3, 0x11, 0x3a, 0x11, 0xa2, 0x32,
+  0x18, 0xb7, 0x26, 0x00, 0x89, 0x54, 0x88, 0x42, 0x89, 0xb8, 0x18, 0xd1,
+  0x88, 0x01, 0x50, 0x88, 0x85, 0x0c, 0x49, 0x52, 0x88, 0x87, 0x82, 0xd2,
+  0x00, 0x80, 0x00, 0x21, 0x24, 0x18, 0xa0, 0x81, 0x20, 0x58, 0x48, 0x00,
+  0xa1, 0xb2, 0x21, 0xe2, 0x82, 0xa2, 0x22, 0x8b, 0x62, 0xa0, 0x24, 0x4b,
+  0x00, 0x81, 0xa2, 0x32, 0x2a, 0xe3, 0x41, 0xa1, 0x32, 0x4b, 0x4c, 0x00,
+  0xf8, 0x08, 0x3a, 0xa3, 0x13, 0x1b, 0x31, 0x18, 0x3a, 0xb1, 0x22, 0xc2,
+  0x13, 0x18, 0xcf, 0x4c, 0x0d, 0x00, 0x00, 0x40, 0x88, 0x41, 0x08, 0x00,
+  0x84, 0x8f, 0x02, 0x14, 0x22, 0x16, 0x05, 0x00, 0x01, 0x00, 0x30, 0xf0,
+  0x12, 0xb7, 0x07, 0x00, 0x07, 0x1a, 0x04, 0x06, 0x19, 0x04, 0x02, 0xd3,
+  0x02, 0xa3, 0x18, 0xf0, 0xb1, 0xe3, 0xc0, 0x42, 0x1f, 0x41, 0x52, 0x28,
+  0xe1, 0x05, 0x35, 0x4a, 0x1d, 0x2c, 0x12, 0x06, 0xf0, 0x08, 0x59, 0x85,
+  0xab, 0x94, 0x43, 0xf2, 0x4a, 0x91, 0x43, 0xf2, 0x42, 0x91, 0x47, 0x82,
+  0x2d, 0x91, 0x4f, 0x82, 0xc4, 0x91, 0x4f, 0xa2, 0xc4, 0xdf, 0x05, 0x10,
+  0x11, 0xe3, 0x05, 0x52, 0x2e, 0x4a, 0x96, 0xe5, 0xa2, 0x57, 0x06, 0xf4,
+  0x01, 0xc2, 0x42, 0x1f, 0x49, 0x52, 0x28, 0x1f, 0x49, 0x32, 0x48, 0x1f,
+  0x49, 0x32, 0x4a, 0x1f, 0x48, 0x9b, 0x06, 0x02, 0x95, 0x0d, 0x60, 0xb2,
+  0x4a, 0x3b, 0x24, 0x2b, 0xb4, 0x4c, 0x0d, 0x80, 0x34, 0x48, 0xb8, 0x4f,
+  0xa2, 0xf4, 0x64, 0xa2, 0x56, 0x06, 0x14, 0xc6, 0x55, 0x06, 0x21, 0x42,
+  0x1d, 0x86, 0x06, 0x01, 0x15, 0x06, 0x10, 0x42, 0x4d, 0x0d, 0x00, 0x71,
+  0x00, 0x04, 0x75, 0x00, 0xb2, 0x6f, 0x82, 0xd4, 0x12, 0xf9, 0x24, 0x5a,
+  0x1c, 0xf9, 0x24, 0xca, 0x59, 0x06, 0xa0, 0x2e, 0x4a, 0x96, 0xc5, 0x4b,
+  0x96, 0xc5, 0x4a, 0x1f, 0xc9, 0x79, 0x00, 0x34, 0xd6, 0x28, 0xf4, 0xcc,
+  0x06, 0x10, 0x81, 0x14, 0x07, 0xf7, 0x0f, 0xf2, 0x4a, 0x84, 0x1d, 0x24,
   0xab, 0xa4, 0x51, 0xab, 0xa4, 0x41, 0xab, 0x94, 0x41, 0x2b, 0x84, 0x45,
   0x98, 0x82, 0x6d, 0x48, 0x29, 0xf8, 0x24, 0x5a, 0x9f, 0x27, 0x0c, 0x20,
-  0x88, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x80, 0x01, 0x88, 0x00, 0x00, 0x40, 0x01, 0x40, 0x08, 0x48, 0x00,
-  0x00, 0x00, 0x00, 0x44, 0x80, 0x02, 0x00, 0x00, 0x00, 0x50, 0x12, 0xf0,
-  0xcd, 0x76, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-  0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x01, 0x18, 0x00, 0xf0,
-  0xe6, 0xe4, 0x00, 0x82, 0x00, 0x00, 0x80, 0x48, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xc0, 0x11, 0xe0,
-  0xa1, 0x0a, 0x20, 0x0c, 0x00, 0x12, 0x20, 0x48, 0x08, 0x41, 0x20, 0x42,
-  0x04, 0x00, 0x00, 0x40, 0x12, 0x14, 0x28, 0x01, 0x82, 0x00, 0x00, 0x10,
-  0x01, 0x10, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x41, 0x20, 0x02, 0x00,
-  0x00, 0x00, 0x24, 0x40, 0x21, 0xf1, 0xd3, 0xa9, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x40, 0x02,
-  0x18, 0x11, 0x18, 0x80, 0x01, 0x9f, 0x35, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xe0, 0x97, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x12, 0xf0, 0x97, 0x29, 0x00, 0x00, 0x00, 0x80, 0x01, 0x10, 0x04, 0x00,
-  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x01, 0x1f, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f,
-  0xa3, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x18, 0x00, 0xdf, 0x79,
-  0x06, 0x00, 0x81, 0x20, 0x04, 0x40, 0x08, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x22,
-  0x00, 0x00, 0x44, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf0,
-  0x3f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x08, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3f,
-  0xec, 0x07, 0x00, 0x85, 0x04, 0x48, 0x00, 0x81, 0x00, 0x40, 0x01, 0x40,
-  0x08, 0x00, 0x00, 0x82, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x02, 0x84, 0x24, 0x00, 0x21, 0x00, 0x00, 0x00, 0x82, 0x00,
-  0x80, 0x81, 0x01, 0xfb, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x18,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x41, 0x00, 0x80, 0x08, 0x00, 0x00, 0x20,
-  0x01, 0x00, 0xf0, 0x95, 0xce, 0x00, 0x00, 0x51, 0x81, 0x00, 0x00, 0x21,
-  0x00, 0x11, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
-  0x00, 0x00, 0x21, 0x24, 0x00, 0x00, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xde, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x4c, 0xa8, 0x00, 0x00, 0x84, 0x00, 0x20, 0x04, 0x11, 0x14, 0x00, 0x20,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x84, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
-  0x7f, 0xc8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0xef, 0x1c, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x10,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x01, 0x82, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xcd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf0, 0x4f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x0f,
-  0x00, 0x40, 0x08, 0x10, 0x08, 0x00, 0x14, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x02, 0x00, 0x00, 0x88, 0x10,
-  0x08, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xf0, 0x31,
-  0x96, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x81, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x40, 0x01, 0x00,
-  0x80, 0x04, 0x54, 0x00, 0x00, 0x48, 0x40, 0x04, 0x00, 0x21, 0x00, 0x44,
-  0x00, 0x10, 0x02, 0x18, 0x80, 0x88, 0x02, 0x21, 0x80, 0x01, 0x88, 0x40,
-  0x08, 0x00, 0x00, 0x28, 0x84, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x9f,
-  0xd2, 0x01, 0x00, 0x14, 0x00, 0x00, 0x48, 0x40, 0x55, 0x88, 0x28, 0x10,
-  0x82, 0x04, 0x44, 0x80, 0x02, 0x21, 0x00, 0x44, 0x80, 0x02, 0x21, 0x48,
-  0x18, 0x80, 0x88, 0x02, 0x21, 0x48, 0x18, 0x44, 0x88, 0x28, 0x84, 0x21,
+  0x88, 0x43, 0x06, 0x0a, 0x22, 0x03, 0x06, 0x50, 0x0d, 0x21, 0xcd, 0x76,
+  0xc5, 0x03, 0x03, 0xe9, 0x02, 0x08, 0x5a, 0x01, 0x00, 0x05, 0x00, 0x80,
+  0x10, 0x22, 0x01, 0x18, 0x00, 0xf0, 0xe6, 0xe4, 0x43, 0x06, 0x11, 0x80,
+  0xf8, 0x0a, 0x0d, 0x90, 0x03, 0x00, 0x55, 0x00, 0xf0, 0x00, 0xc0, 0x11,
+  0xe0, 0xa1, 0x0a, 0x20, 0x0c, 0x00, 0x12, 0x20, 0x48, 0x08, 0x41, 0x20,
+  0x42, 0xa2, 0x04, 0x50, 0x12, 0x14, 0x28, 0x01, 0x82, 0x1f, 0x05, 0x21,
+  0x10, 0x08, 0xe4, 0x04, 0x11, 0x41, 0xed, 0x02, 0x6b, 0x24, 0x40, 0x21,
+  0xf1, 0xd3, 0xa9, 0x40, 0x00, 0x02, 0x01, 0x00, 0x01, 0x91, 0x00, 0xa0,
+  0x40, 0x02, 0x18, 0x11, 0x18, 0x80, 0x01, 0x9f, 0x35, 0x03, 0x13, 0x00,
+  0x02, 0x7c, 0x03, 0x08, 0x01, 0x00, 0x04, 0xec, 0x01, 0x20, 0xe0, 0x97,
+  0x8c, 0x00, 0x00, 0x03, 0x03, 0x05, 0x04, 0x06, 0x00, 0x01, 0x00, 0x32,
+  0x28, 0x00, 0x8a, 0x7f, 0x0f, 0x61, 0x00, 0x00, 0x12, 0xf0, 0x97, 0x29,
+  0xf5, 0x01, 0x2a, 0x10, 0x04, 0x24, 0x00, 0x33, 0x00, 0x20, 0x08, 0x90,
+  0x08, 0x4f, 0x80, 0x01, 0x1f, 0x12, 0xd9, 0x04, 0x01, 0x12, 0x22, 0xed,
+  0x05, 0x00, 0x01, 0x00, 0x34, 0xf0, 0x3f, 0xa3, 0xf0, 0x00, 0x06, 0x45,
+  0x00, 0x00, 0x2e, 0x01, 0x02, 0xdf, 0x06, 0xf3, 0x01, 0x20, 0x08, 0x00,
+  0x18, 0x00, 0xdf, 0x79, 0x06, 0x00, 0x81, 0x20, 0x04, 0x40, 0x08, 0x00,
+  0x11, 0x21, 0x00, 0x02, 0x68, 0x04, 0x53, 0xc0, 0x22, 0x00, 0x00, 0x44,
+  0xcd, 0x06, 0x40, 0x18, 0xf0, 0x3f, 0x35, 0x08, 0x00, 0x12, 0x44, 0x21,
+  0x00, 0x01, 0x65, 0x06, 0x02, 0x84, 0x0a, 0x22, 0x10, 0x08, 0x09, 0x00,
+  0xc1, 0x18, 0x00, 0x00, 0x3f, 0xec, 0x07, 0x00, 0x85, 0x04, 0x48, 0x00,
+  0x81, 0xa7, 0x01, 0x00, 0x3f, 0x06, 0x04, 0x97, 0x05, 0x41, 0x10, 0x02,
+  0x84, 0x24, 0x27, 0x00, 0x77, 0x82, 0x00, 0x80, 0x81, 0x01, 0xfb, 0xf7,
+  0x4b, 0x00, 0x02, 0x1f, 0x00, 0x00, 0x3f, 0x00, 0x10, 0x28, 0xef, 0x02,
+  0x00, 0x6f, 0x00, 0xa0, 0x20, 0x01, 0x00, 0xf0, 0x95, 0xce, 0x00, 0x00,
+  0x51, 0x81, 0x65, 0x00, 0x13, 0x11, 0x2b, 0x00, 0x01, 0x05, 0x00, 0x10,
+  0x21, 0xb7, 0x00, 0x11, 0x81, 0x4e, 0x07, 0x00, 0x05, 0x07, 0x26, 0xde,
+  0x0f, 0x45, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x3f, 0xf0, 0x4f, 0xfe, 0x16,
+  0x00, 0x00, 0x07, 0x01, 0x00, 0x2f, 0xff, 0xe4, 0x41, 0x00, 0x42, 0x00,
+  0x1f, 0x01, 0x03, 0xa4, 0x00, 0x30, 0xf0, 0x4c, 0xa8, 0x50, 0x01, 0x42,
+  0x20, 0x04, 0x11, 0x14, 0x6d, 0x0d, 0x05, 0x01, 0x00, 0x12, 0x84, 0x6c,
+  0x0f, 0x00, 0x73, 0x07, 0x38, 0x7f, 0xc8, 0x09, 0x1a, 0x00, 0x0a, 0x01,
+  0x00, 0x00, 0x25, 0x00, 0x2d, 0xef, 0x1c, 0x4a, 0x02, 0x09, 0x01, 0x00,
+  0x02, 0xa8, 0x00, 0x08, 0x04, 0x07, 0x38, 0x20, 0x01, 0x82, 0x6f, 0x0d,
+  0x4f, 0x00, 0x00, 0x1f, 0xcd, 0x64, 0x00, 0x08, 0x0f, 0xeb, 0x00, 0x15,
+  0x10, 0x40, 0x9f, 0x09, 0x14, 0x14, 0x06, 0x0b, 0x11, 0x00, 0x80, 0x08,
+  0x20, 0x00, 0x88, 0x78, 0x00, 0x00, 0x6d, 0x00, 0x60, 0x38, 0x00, 0x00,
+  0xf0, 0x31, 0x96, 0x19, 0x00, 0x24, 0x48, 0x40, 0xc7, 0x02, 0x04, 0x2d,
+  0x02, 0x03, 0xee, 0x02, 0x51, 0x00, 0x00, 0x00, 0x9f, 0x81, 0x1c, 0x03,
+  0x0f, 0x01, 0x00, 0x06, 0x00, 0x89, 0x00, 0x60, 0x40, 0x01, 0x00, 0x80,
+  0x04, 0x54, 0x48, 0x00, 0x51, 0x04, 0x00, 0x21, 0x00, 0x44, 0xb7, 0x05,
+  0x20, 0x88, 0x02, 0x03, 0x04, 0x00, 0x58, 0x02, 0x22, 0x28, 0x84, 0x6e,
+  0x03, 0x50, 0x9f, 0xd2, 0x01, 0x00, 0x14, 0x25, 0x00, 0xa0, 0x55, 0x88,
+  0x28, 0x10, 0x82, 0x04, 0x44, 0x80, 0x02, 0x21, 0x18, 0x04, 0x21, 0x21,
+  0x48, 0x2d, 0x00, 0xf0, 0x0b, 0x48, 0x18, 0x44, 0x88, 0x28, 0x84, 0x21,
   0x48, 0x40, 0x84, 0xa1, 0x21, 0x84, 0x21, 0x48, 0xe0, 0x41, 0x01, 0x28,
-  0x10, 0xa2, 0x11, 0x40, 0xf4, 0x94, 0xca, 0x00, 0x00, 0x00, 0x14, 0x00,
-  0x00, 0x10, 0x48, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x21, 0x00, 0x44,
-  0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0x02, 0x18, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x40, 0x08, 0x12, 0x00, 0x00, 0x12, 0xf0, 0xfa, 0xa4, 0x00, 0x40,
-  0x01, 0x00, 0x80, 0x04, 0x54, 0x00, 0x00, 0x48, 0x40, 0x84, 0x04, 0x10,
-  0x02, 0x40, 0x04, 0x00, 0x21, 0x80, 0x01, 0x88, 0x38, 0x90, 0x82, 0x80,
-  0x01, 0x88, 0x40, 0x88, 0x08, 0x00, 0x80, 0x42, 0x08, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0xf0, 0x4c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xe4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x10,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x02, 0x00, 0x80, 0x02,
-  0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x44, 0x80,
-  0x02, 0x21, 0x48, 0x40, 0x04, 0x00, 0x21, 0x48, 0x40, 0x04, 0x00, 0x21,
-  0xef, 0xa2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00,
-  0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x40, 0x04, 0x00, 0x00,
-  0x10, 0x02, 0x40, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x21, 0x80, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x70, 0xad, 0x0d,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4f, 0xfe, 0x00, 0x40, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xf0, 0x3c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x40, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00,
-  0x00, 0x00, 0x00, 0xef, 0x8d, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff
+  0x10, 0xa2, 0x11, 0x40, 0xf4, 0x94, 0xca, 0xe5, 0x0e, 0x40, 0x00, 0x00,
+  0x10, 0x48, 0xe7, 0x03, 0x04, 0x60, 0x00, 0x01, 0xba, 0x0a, 0x01, 0xa5,
+  0x00, 0x30, 0x40, 0x08, 0x12, 0x7e, 0x03, 0x27, 0xfa, 0xa4, 0x86, 0x00,
+  0x40, 0x84, 0x04, 0x10, 0x02, 0x2b, 0x00, 0x60, 0x80, 0x01, 0x88, 0x38,
+  0x90, 0x82, 0x87, 0x00, 0x21, 0x88, 0x08, 0x2c, 0x0e, 0x00, 0xb5, 0x02,
+  0x24, 0xf0, 0x4c, 0xe2, 0x00, 0x0f, 0x01, 0x00, 0x04, 0x0f, 0x66, 0x02,
+  0x11, 0x03, 0xe5, 0x0e, 0x22, 0x28, 0x10, 0xc2, 0x0f, 0x20, 0x80, 0x02,
+  0x64, 0x01, 0x11, 0x80, 0xd4, 0x00, 0x01, 0x05, 0x01, 0x01, 0x05, 0x00,
+  0x20, 0xef, 0xa2, 0x13, 0x09, 0x0f, 0x01, 0x00, 0x07, 0x03, 0x3b, 0x01,
+  0x41, 0x00, 0x00, 0x00, 0x54, 0x7c, 0x04, 0x42, 0x10, 0x02, 0x40, 0x14,
+  0x2f, 0x0e, 0x02, 0x8e, 0x02, 0x01, 0x1e, 0x05, 0x3c, 0x70, 0xad, 0x0d,
+  0x38, 0x00, 0x09, 0x01, 0x00, 0x06, 0x45, 0x00, 0x04, 0xa4, 0x03, 0x07,
+  0x6d, 0x0e, 0x01, 0x01, 0x00, 0x32, 0xf0, 0x3c, 0x9b, 0x09, 0x00, 0x20,
+  0x40, 0x05, 0x06, 0x00, 0x01, 0x1b, 0x01, 0x02, 0xfb, 0x0b, 0x01, 0x16,
+  0x00, 0x01, 0x3e, 0x04, 0x4f, 0xef, 0x8d, 0xf6, 0xff, 0x01, 0x00, 0x1b,
+  0x00
 };
+const unsigned int USB_1608G_rbf_lz_len = 60253;
 const unsigned int USB_1608G_rbf_len = 73829;
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# fpga2c.py
+#
+#     Author: Measurement Computing Corporation
+#
+# Converts an FPGA image to a C source file with the image compressed in the format read by FpgaImage.
+#
+#   python3 fpga2c.py [--reverse] <array name> <image file> > <source file>
+#
+# --reverse  reverses the bits of every byte of the image before it is compressed, for devices that are
+#            sent the image LSB first (USB-2020)
+#
+# The source file defines <array name>_lz[], <array name>_lz_len and <array name>_len, the size of
+# the image after it is decompressed
+
+import os
+import sys
+
+WINDOW_SIZE = 4096
+MIN_MATCH = 4
+MAX_CANDIDATES = 16
+
+
+def reverse_bits(data):
+	return bytes(int('{:08b}'.format(b)[::-1], 2) for b in data)
+
+
+def compress(data):
+	out = bytearray()
+	table = {}
+	size = len(data)
+	pos = 0
+	anchor = 0
+
+	def put_length(value):
+		while value >= 255:
+			out.append(255)
+			value -= 255
+		out.append(value)
+
+	def put_sequence(literals, match_len, offset):
+		lit_count = len(literals)
+		out.append((min(lit_count, 15) << 4) | (min(match_len - MIN_MATCH, 15) if match_len else 0))
+		if lit_count >= 15:
+			put_length(lit_count - 15)
+		out.extend(literals)
+		if match_len:
+			out.append(offset & 0xff)
+			out.append(offset >> 8)
+			if match_len - MIN_MATCH >= 15:
+				put_length(match_len - MIN_MATCH - 15)
+
+	while pos + MIN_MATCH <= size:
+		key = data[pos:pos + MIN_MATCH]
+		candidates = table.setdefault(key, [])
+		best_len = 0
+		best_offset = 0
+
+		for candidate in reversed(candidates[-MAX_CANDIDATES:]):
+			if pos - candidate >= WINDOW_SIZE:
+				break
+			length = MIN_MATCH
+			while pos + length < size and data[candidate + length] == data[pos + length]:
+				length += 1
+			if length > best_len:
+				best_len = length
+				best_offset = pos - candidate
+
+		candidates.append(pos)
+
+		if best_len >= MIN_MATCH:
+			put_sequence(data[anchor:pos], best_len, best_offset)
+			for index in range(pos + 1, min(pos + best_len, size - MIN_MATCH + 1)):
+				table.setdefault(data[index:index + MIN_MATCH], []).append(index)
+			pos += best_len
+			anchor = pos
+		else:
+			pos += 1
+
+	put_sequence(data[anchor:], 0, 0)
+
+	return bytes(out)
+
+
+def main():
+	args = sys.argv[1:]
+	reverse = '--reverse' in args
+	args = [arg for arg in args if arg != '--reverse']
+
+	if len(args) != 2:
+		sys.stderr.write('usage: fpga2c.py [--reverse] <array name> <image file>\n')
+		return 1
+
+	name, path = args
+
+	with open(path, 'rb') as image_file:
+		image = image_file.read()
+
+	if reverse:
+		image = reverse_bits(image)
+
+	data = compress(image)
+
+	lines = []
+	lines.append('///////////////////////////////////////////////////////////////////')
+	lines.append('//')
+	lines.append('// - created using fpga2c.py')
+	lines.append("// - created from '%s'" % os.path.basename(path))
+	lines.append('// - python3 fpga2c.py %s%s %s' % ('--reverse ' if reverse else '', name, os.path.basename(path)))
+	lines.append('//')
+	lines.append('///////////////////////////////////////////////////////////////////')
+	lines.append('')
+	lines.append('const unsigned char %s_lz[] = {' % name)
+
+	for start in range(0, len(data), 12):
+		row = ', '.join('0x%02x' % b for b in data[start:start + 12])
+		lines.append('  ' + row + (',' if start + 12 < len(data) else ''))
+
+	lines.append('};')
+	lines.append('const unsigned int %s_lz_len = %d;' % (name, len(data)))
+	lines.append('const unsigned int %s_len = %d;' % (name, len(image)))
+
+	sys.stdout.write('\n'.join(lines) + '\n')
+
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,99 @@
+/*
+ * ConfigShadow.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <string.h>
+
+#include "ConfigShadow.h"
+#include "SuspendMonitor.h"
+#include "UlLock.h"
+
+namespace ul
+{
+
+ConfigShadow::ConfigShadow()
+{
+	mSuspendCount = SuspendMonitor::instance().getCurrentSystemSuspendCount();
+
+	UlLock::initMutex(mMutex, PTHREAD_MUTEX_RECURSIVE);
+}
+
+ConfigShadow::~ConfigShadow()
+{
+	UlLock::destroyMutex(mMutex);
+}
+
+unsigned long long ConfigShadow::key(unsigned int cmd, unsigned int value, unsigned int index)
+{
+	return ((unsigned long long) (cmd & 0xffff) << 32) | ((unsigned long long) (value & 0xffff) << 16) | (index & 0xffff);
+}
+
+bool ConfigShadow::read(unsigned long long key, void* data, unsigned int size)
+{
+	UlLock lock(mMutex);
+
+	checkSuspend();
+
+	std::map<unsigned long long, std::vector<unsigned char> >::const_iterator itr = mEntries.find(key);
+
+	if(itr == mEntries.end() || itr->second.size() != size)
+		return false;
+
+	memcpy(data, &itr->second[0], size);
+
+	return true;
+}
+
+bool ConfigShadow::matches(unsigned long long key, const void* data, unsigned int size)
+{
+	UlLock lock(mMutex);
+
+	checkSuspend();
+
+	std::map<unsigned long long, std::vector<unsigned char> >::const_iterator itr = mEntries.find(key);
+
+	if(itr == mEntries.end() || itr->second.size() != size)
+		return false;
+
+	return memcmp(data, &itr->second[0], size) == 0;
+}
+
+void ConfigShadow::update(unsigned long long key, const void* data, unsigned int size)
+{
+	UlLock lock(mMutex);
+
+	checkSuspend();
+
+	const unsigned char* bytes = (const unsigned char*) data;
+
+	mEntries[key].assign(bytes, bytes + size);
+}
+
+void ConfigShadow::remove(unsigned long long key)
+{
+	UlLock lock(mMutex);
+
+	mEntries.erase(key);
+}
+
+void ConfigShadow::invalidate()
+{
+	UlLock lock(mMutex);
+
+	mEntries.clear();
+}
+
+void ConfigShadow::checkSuspend()
+{
+	unsigned long long suspendCount = SuspendMonitor::instance().getCurrentSystemSuspendCount();
+
+	if(suspendCount != mSuspendCount)
+	{
+		mEntries.clear();
+		mSuspendCount = suspendCount;
+	}
+}
+
+} /* namespace ul */
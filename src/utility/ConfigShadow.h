@@ -0,0 +1,49 @@
+/*
+ * ConfigShadow.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_CONFIGSHADOW_H_
+#define UTILITY_CONFIGSHADOW_H_
+
+#include <map>
+#include <vector>
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// copy of the configuration last written to or read from a device, so unchanged configurations are not sent again
+// and configurations that were read once are not queried again. Entries are identified by the command that reads
+// the configuration and its arguments. The shadow is cleared when the device connects, when a scan starts and when
+// the system resumes from a suspend, the device may have lost or changed its configuration in all three cases
+class UL_LOCAL ConfigShadow
+{
+public:
+	ConfigShadow();
+	~ConfigShadow();
+
+	static unsigned long long key(unsigned int cmd, unsigned int value = 0, unsigned int index = 0);
+
+	// returns true and copies the shadowed configuration to data if it is known
+	bool read(unsigned long long key, void* data, unsigned int size);
+	// returns true if the shadowed configuration is known and equal to data
+	bool matches(unsigned long long key, const void* data, unsigned int size);
+	void update(unsigned long long key, const void* data, unsigned int size);
+	void remove(unsigned long long key);
+	void invalidate();
+
+private:
+	void checkSuspend();
+
+private:
+	pthread_mutex_t mMutex;
+	std::map<unsigned long long, std::vector<unsigned char> > mEntries;
+	unsigned long long mSuspendCount;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_CONFIGSHADOW_H_ */
@@ -124,6 +124,8 @@ ErrorMap::ErrorMap()
 	mErrMap.insert(std::pair<int, std::string>(ERR_CMR_EXCEEDED, "Common-mode voltage range exceeded")); //107
 	mErrMap.insert(std::pair<int, std::string>(ERR_NET_BUFFER_OVERRUN, "Network buffer overrun, data was not transferred from buffer fast enough")); //108
 	mErrMap.insert(std::pair<int, std::string>(ERR_BAD_NET_BUFFER, "Invalid network buffer")); //109
+	mErrMap.insert(std::pair<int, std::string>(ERR_SCAN_BUFFER_OVERRUN, "Scan buffer overrun, data was overwritten before it was read")); //110
+	mErrMap.insert(std::pair<int, std::string>(ERR_SCAN_RECORDER_IO, "Scan recorder file could not be created or written")); //111
 
 
 }
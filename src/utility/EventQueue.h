@@ -0,0 +1,98 @@
+/*
+ * EventQueue.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_EVENTQUEUE_H_
+#define UTILITY_EVENTQUEUE_H_
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// bounded lock-free queue for any number of producers and a single consumer. Each cell carries a
+// sequence number that tells producers and the consumer whether the cell is free or holds an item.
+// SIZE must be a power of two
+template <typename T, unsigned int SIZE>
+class UL_LOCAL EventQueue
+{
+public:
+	EventQueue() : mHead(0), mTail(0)
+	{
+		for(unsigned int i = 0; i < SIZE; i++)
+			mCells[i].seq = i;
+	}
+
+	// returns false without blocking if the queue is full
+	bool push(const T& item)
+	{
+		Cell* cell;
+		unsigned int pos = __atomic_load_n(&mHead, __ATOMIC_RELAXED);
+
+		for(;;)
+		{
+			cell = &mCells[pos & (SIZE - 1)];
+			unsigned int seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+			int diff = (int) (seq - pos);
+
+			if(diff == 0)
+			{
+				if(__atomic_compare_exchange_n(&mHead, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+					break;
+			}
+			else if(diff < 0)
+				return false;
+			else
+				pos = __atomic_load_n(&mHead, __ATOMIC_RELAXED);
+		}
+
+		cell->item = item;
+		__atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+
+		return true;
+	}
+
+	// must only be called from the consumer thread
+	bool pop(T& item)
+	{
+		Cell* cell = &mCells[mTail & (SIZE - 1)];
+		unsigned int seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+
+		if(seq != mTail + 1)
+			return false;
+
+		item = cell->item;
+		__atomic_store_n(&cell->seq, mTail + SIZE, __ATOMIC_RELEASE);
+		mTail++;
+
+		return true;
+	}
+
+	// must only be called from the consumer thread
+	bool empty() const
+	{
+		return __atomic_load_n(&mCells[mTail & (SIZE - 1)].seq, __ATOMIC_ACQUIRE) != mTail + 1;
+	}
+
+private:
+	struct Cell
+	{
+		unsigned int seq;
+		T item;
+	};
+
+	enum { CACHE_LINE_SIZE = 64 };
+
+	Cell mCells[SIZE];
+
+	// keep the producer and consumer indices on separate cache lines
+	unsigned int mHead;
+	char mPad[CACHE_LINE_SIZE - sizeof(unsigned int)];
+	unsigned int mTail;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_EVENTQUEUE_H_ */
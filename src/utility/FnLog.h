@@ -7,26 +7,37 @@
 #ifndef FNLOG_H_
 #define FNLOG_H_
 
-# include <string>
-
 #include "../ul_internal.h"
-#include <sys/time.h>
-
-//#define FNLOG
+#include "Trace.h"
 
 namespace ul
 {
 
+// tracepoint of a function, log must be a string literal because its address identifies the tracepoint.
+// Nothing is recorded unless tracing is enabled with UL_CFG_TRACE
 class UL_LOCAL FnLog
 {
 public:
-	FnLog(std::string log);
-	virtual ~FnLog();
+	inline FnLog(const char* log)
+	{
+		mStartNs = 0;
+
+		if(Trace::isEnabled())
+		{
+			mLog = log;
+			mStartNs = ul_clock_monotonic_ns();
+		}
+	}
+
+	inline ~FnLog()
+	{
+		if(mStartNs)
+			Trace::record((unsigned long) mLog, mStartNs);
+	}
+
 private:
-	std::string mLog;
-#ifdef FNLOG
-	timeval mEnterTime;
-#endif
+	const char* mLog;
+	unsigned long long mStartNs;
 };
 
 } /* namespace ul */
@@ -0,0 +1,58 @@
+/*
+ * RangeSet.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_RANGESET_H_
+#define UTILITY_RANGESET_H_
+
+#include <bitset>
+
+#include "../ul_internal.h"
+#include "../uldaq.h"
+
+namespace ul
+{
+
+// set of Range values that is tested without a search. The values of the Range enum are grouped below 1000
+// (bipolar ranges), from 1000 (unipolar ranges) and from 2000 (current ranges), one bit is kept for each of
+// the first GROUP_SIZE values of a group
+class UL_LOCAL RangeSet
+{
+public:
+	inline void add(Range range)
+	{
+		int bit = getBit(range);
+
+		if(bit >= 0)
+			mBits.set(bit);
+	}
+
+	inline bool contains(Range range) const
+	{
+		int bit = getBit(range);
+
+		return bit >= 0 && mBits.test(bit);
+	}
+
+private:
+	enum { GROUP_SIZE = 64, GROUP_COUNT = 3 };
+
+	static inline int getBit(Range range)
+	{
+		int value = range;
+
+		if(value < 0 || value / 1000 >= GROUP_COUNT || value % 1000 >= GROUP_SIZE)
+			return -1;
+
+		return (value / 1000) * GROUP_SIZE + value % 1000;
+	}
+
+private:
+	std::bitset<GROUP_SIZE * GROUP_COUNT> mBits;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_RANGESET_H_ */
@@ -0,0 +1,596 @@
+/*
+ * ScanDataConverter.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include "ScanDataConverter.h"
+#include "Endian.h"
+#include "../UlException.h"
+
+#include <limits.h>
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define UL_CONVERTER_X86
+#elif defined(__aarch64__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_neon.h>
+#define UL_CONVERTER_NEON
+#endif
+
+namespace ul
+{
+
+namespace
+{
+
+inline unsigned int toCpu(unsigned short raw) { return Endian::le_ui16_to_cpu(raw); }
+inline unsigned int toCpu(unsigned int raw) { return Endian::le_ui32_to_cpu(raw); }
+
+// calibrated counts are rounded with the current rounding mode (round to nearest even by default) so the scalar
+// path gives the same result as the vector conversion instructions
+inline double clampCount(double value, double maxCount)
+{
+	if(value < 0)
+		return 0;
+	else if(value > maxCount)
+		return maxCount;
+
+	return value;
+}
+
+inline void store(double value, double& dst) { dst = value; }
+inline void store(double value, float& dst) { dst = (float) value; }
+inline void store(double value, unsigned short& dst) { dst = llrint(clampCount(value, USHRT_MAX)); }
+inline void store(double value, unsigned int& dst) { dst = llrint(clampCount(value, UINT_MAX)); }
+
+template <typename S, typename D>
+void convertScalar(const S* src, D* dst, const double* slope, const double* offset, unsigned int count)
+{
+	for(unsigned int i = 0; i < count; i++)
+		store(slope[i] * toCpu(src[i]) + offset[i], dst[i]);
+}
+
+#ifdef UL_CONVERTER_X86
+
+__attribute__((target("sse2")))
+void convert16Sse2(const unsigned short* src, double* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m128i raw = _mm_loadu_si128((const __m128i*) &src[i]);
+		__m128i lo = _mm_unpacklo_epi16(raw, zero);
+		__m128i hi = _mm_unpackhi_epi16(raw, zero);
+
+		__m128d d0 = _mm_cvtepi32_pd(lo);
+		__m128d d1 = _mm_cvtepi32_pd(_mm_srli_si128(lo, 8));
+		__m128d d2 = _mm_cvtepi32_pd(hi);
+		__m128d d3 = _mm_cvtepi32_pd(_mm_srli_si128(hi, 8));
+
+		_mm_storeu_pd(&dst[i], _mm_add_pd(_mm_mul_pd(d0, _mm_loadu_pd(&slope[i])), _mm_loadu_pd(&offset[i])));
+		_mm_storeu_pd(&dst[i + 2], _mm_add_pd(_mm_mul_pd(d1, _mm_loadu_pd(&slope[i + 2])), _mm_loadu_pd(&offset[i + 2])));
+		_mm_storeu_pd(&dst[i + 4], _mm_add_pd(_mm_mul_pd(d2, _mm_loadu_pd(&slope[i + 4])), _mm_loadu_pd(&offset[i + 4])));
+		_mm_storeu_pd(&dst[i + 6], _mm_add_pd(_mm_mul_pd(d3, _mm_loadu_pd(&slope[i + 6])), _mm_loadu_pd(&offset[i + 6])));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("sse2")))
+void convert32Sse2(const unsigned int* src, double* dst, const double* slope, const double* offset, unsigned int count)
+{
+	// there is no unsigned 32-bit to double conversion in SSE2, so flip the sign bit and add 2^31 back after the conversion
+	const __m128i signBit = _mm_set1_epi32(0x80000000);
+	const __m128d bias = _mm_set1_pd(2147483648.0);
+	unsigned int i = 0;
+
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128i raw = _mm_xor_si128(_mm_loadu_si128((const __m128i*) &src[i]), signBit);
+
+		__m128d d0 = _mm_add_pd(_mm_cvtepi32_pd(raw), bias);
+		__m128d d1 = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(raw, 8)), bias);
+
+		_mm_storeu_pd(&dst[i], _mm_add_pd(_mm_mul_pd(d0, _mm_loadu_pd(&slope[i])), _mm_loadu_pd(&offset[i])));
+		_mm_storeu_pd(&dst[i + 2], _mm_add_pd(_mm_mul_pd(d1, _mm_loadu_pd(&slope[i + 2])), _mm_loadu_pd(&offset[i + 2])));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("sse2")))
+void convert16FloatSse2(const unsigned short* src, float* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m128i raw = _mm_loadu_si128((const __m128i*) &src[i]);
+		__m128i lo = _mm_unpacklo_epi16(raw, zero);
+		__m128i hi = _mm_unpackhi_epi16(raw, zero);
+
+		__m128d d0 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(lo), _mm_loadu_pd(&slope[i])), _mm_loadu_pd(&offset[i]));
+		__m128d d1 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(lo, 8)), _mm_loadu_pd(&slope[i + 2])), _mm_loadu_pd(&offset[i + 2]));
+		__m128d d2 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(hi), _mm_loadu_pd(&slope[i + 4])), _mm_loadu_pd(&offset[i + 4]));
+		__m128d d3 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(hi, 8)), _mm_loadu_pd(&slope[i + 6])), _mm_loadu_pd(&offset[i + 6]));
+
+		_mm_storeu_ps(&dst[i], _mm_movelh_ps(_mm_cvtpd_ps(d0), _mm_cvtpd_ps(d1)));
+		_mm_storeu_ps(&dst[i + 4], _mm_movelh_ps(_mm_cvtpd_ps(d2), _mm_cvtpd_ps(d3)));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("sse2")))
+void convert32FloatSse2(const unsigned int* src, float* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m128i signBit = _mm_set1_epi32(0x80000000);
+	const __m128d bias = _mm_set1_pd(2147483648.0);
+	unsigned int i = 0;
+
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128i raw = _mm_xor_si128(_mm_loadu_si128((const __m128i*) &src[i]), signBit);
+
+		__m128d d0 = _mm_add_pd(_mm_cvtepi32_pd(raw), bias);
+		__m128d d1 = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(raw, 8)), bias);
+
+		d0 = _mm_add_pd(_mm_mul_pd(d0, _mm_loadu_pd(&slope[i])), _mm_loadu_pd(&offset[i]));
+		d1 = _mm_add_pd(_mm_mul_pd(d1, _mm_loadu_pd(&slope[i + 2])), _mm_loadu_pd(&offset[i + 2]));
+
+		_mm_storeu_ps(&dst[i], _mm_movelh_ps(_mm_cvtpd_ps(d0), _mm_cvtpd_ps(d1)));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("sse2")))
+void convert16Uint16Sse2(const unsigned short* src, unsigned short* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128d minCount = _mm_setzero_pd();
+	const __m128d maxCount = _mm_set1_pd(65535.0);
+	// SSE2 only has a signed saturating pack, so shift the counts into the signed range and flip the sign bit back after packing
+	const __m128i packBias = _mm_set1_epi32(32768);
+	const __m128i signBit = _mm_set1_epi16((short) 0x8000);
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m128i raw = _mm_loadu_si128((const __m128i*) &src[i]);
+		__m128i lo = _mm_unpacklo_epi16(raw, zero);
+		__m128i hi = _mm_unpackhi_epi16(raw, zero);
+
+		__m128d d0 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(lo), _mm_loadu_pd(&slope[i])), _mm_loadu_pd(&offset[i]));
+		__m128d d1 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(lo, 8)), _mm_loadu_pd(&slope[i + 2])), _mm_loadu_pd(&offset[i + 2]));
+		__m128d d2 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(hi), _mm_loadu_pd(&slope[i + 4])), _mm_loadu_pd(&offset[i + 4]));
+		__m128d d3 = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(hi, 8)), _mm_loadu_pd(&slope[i + 6])), _mm_loadu_pd(&offset[i + 6]));
+
+		__m128i c0 = _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(d0, minCount), maxCount));
+		__m128i c1 = _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(d1, minCount), maxCount));
+		__m128i c2 = _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(d2, minCount), maxCount));
+		__m128i c3 = _mm_cvtpd_epi32(_mm_min_pd(_mm_max_pd(d3, minCount), maxCount));
+
+		__m128i c01 = _mm_sub_epi32(_mm_unpacklo_epi64(c0, c1), packBias);
+		__m128i c23 = _mm_sub_epi32(_mm_unpacklo_epi64(c2, c3), packBias);
+
+		_mm_storeu_si128((__m128i*) &dst[i], _mm_xor_si128(_mm_packs_epi32(c01, c23), signBit));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("avx2")))
+void convert16Avx2(const unsigned short* src, double* dst, const double* slope, const double* offset, unsigned int count)
+{
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i raw = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) &src[i]));
+
+		__m256d d0 = _mm256_cvtepi32_pd(_mm256_castsi256_si128(raw));
+		__m256d d1 = _mm256_cvtepi32_pd(_mm256_extracti128_si256(raw, 1));
+
+		// mul and add are kept separate (no FMA) like the other kernels. The results are not bit for bit those of
+		// calibrating and then scaling each sample, setCoefs() fuses the two steps and rounds differently in the last bit
+		_mm256_storeu_pd(&dst[i], _mm256_add_pd(_mm256_mul_pd(d0, _mm256_loadu_pd(&slope[i])), _mm256_loadu_pd(&offset[i])));
+		_mm256_storeu_pd(&dst[i + 4], _mm256_add_pd(_mm256_mul_pd(d1, _mm256_loadu_pd(&slope[i + 4])), _mm256_loadu_pd(&offset[i + 4])));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("avx2")))
+void convert32Avx2(const unsigned int* src, double* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m256i signBit = _mm256_set1_epi32(0x80000000);
+	const __m256d bias = _mm256_set1_pd(2147483648.0);
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i raw = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &src[i]), signBit);
+
+		__m256d d0 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(raw)), bias);
+		__m256d d1 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(raw, 1)), bias);
+
+		_mm256_storeu_pd(&dst[i], _mm256_add_pd(_mm256_mul_pd(d0, _mm256_loadu_pd(&slope[i])), _mm256_loadu_pd(&offset[i])));
+		_mm256_storeu_pd(&dst[i + 4], _mm256_add_pd(_mm256_mul_pd(d1, _mm256_loadu_pd(&slope[i + 4])), _mm256_loadu_pd(&offset[i + 4])));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("avx2")))
+void convert16FloatAvx2(const unsigned short* src, float* dst, const double* slope, const double* offset, unsigned int count)
+{
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i raw = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) &src[i]));
+
+		__m256d d0 = _mm256_cvtepi32_pd(_mm256_castsi256_si128(raw));
+		__m256d d1 = _mm256_cvtepi32_pd(_mm256_extracti128_si256(raw, 1));
+
+		d0 = _mm256_add_pd(_mm256_mul_pd(d0, _mm256_loadu_pd(&slope[i])), _mm256_loadu_pd(&offset[i]));
+		d1 = _mm256_add_pd(_mm256_mul_pd(d1, _mm256_loadu_pd(&slope[i + 4])), _mm256_loadu_pd(&offset[i + 4]));
+
+		_mm_storeu_ps(&dst[i], _mm256_cvtpd_ps(d0));
+		_mm_storeu_ps(&dst[i + 4], _mm256_cvtpd_ps(d1));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("avx2")))
+void convert32FloatAvx2(const unsigned int* src, float* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m256i signBit = _mm256_set1_epi32(0x80000000);
+	const __m256d bias = _mm256_set1_pd(2147483648.0);
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i raw = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &src[i]), signBit);
+
+		__m256d d0 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(raw)), bias);
+		__m256d d1 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(raw, 1)), bias);
+
+		d0 = _mm256_add_pd(_mm256_mul_pd(d0, _mm256_loadu_pd(&slope[i])), _mm256_loadu_pd(&offset[i]));
+		d1 = _mm256_add_pd(_mm256_mul_pd(d1, _mm256_loadu_pd(&slope[i + 4])), _mm256_loadu_pd(&offset[i + 4]));
+
+		_mm_storeu_ps(&dst[i], _mm256_cvtpd_ps(d0));
+		_mm_storeu_ps(&dst[i + 4], _mm256_cvtpd_ps(d1));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+__attribute__((target("avx2")))
+void convert16Uint16Avx2(const unsigned short* src, unsigned short* dst, const double* slope, const double* offset, unsigned int count)
+{
+	const __m256d minCount = _mm256_setzero_pd();
+	const __m256d maxCount = _mm256_set1_pd(65535.0);
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i raw = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) &src[i]));
+
+		__m256d d0 = _mm256_cvtepi32_pd(_mm256_castsi256_si128(raw));
+		__m256d d1 = _mm256_cvtepi32_pd(_mm256_extracti128_si256(raw, 1));
+
+		d0 = _mm256_add_pd(_mm256_mul_pd(d0, _mm256_loadu_pd(&slope[i])), _mm256_loadu_pd(&offset[i]));
+		d1 = _mm256_add_pd(_mm256_mul_pd(d1, _mm256_loadu_pd(&slope[i + 4])), _mm256_loadu_pd(&offset[i + 4]));
+
+		__m128i c0 = _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(d0, minCount), maxCount));
+		__m128i c1 = _mm256_cvtpd_epi32(_mm256_min_pd(_mm256_max_pd(d1, minCount), maxCount));
+
+		_mm_storeu_si128((__m128i*) &dst[i], _mm_packus_epi32(c0, c1));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+#endif /* UL_CONVERTER_X86 */
+
+#ifdef UL_CONVERTER_NEON
+
+void convert16Neon(const unsigned short* src, double* dst, const double* slope, const double* offset, unsigned int count)
+{
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		uint16x8_t raw = vld1q_u16(&src[i]);
+		uint32x4_t lo = vmovl_u16(vget_low_u16(raw));
+		uint32x4_t hi = vmovl_u16(vget_high_u16(raw));
+
+		float64x2_t d0 = vcvtq_f64_u64(vmovl_u32(vget_low_u32(lo)));
+		float64x2_t d1 = vcvtq_f64_u64(vmovl_u32(vget_high_u32(lo)));
+		float64x2_t d2 = vcvtq_f64_u64(vmovl_u32(vget_low_u32(hi)));
+		float64x2_t d3 = vcvtq_f64_u64(vmovl_u32(vget_high_u32(hi)));
+
+		vst1q_f64(&dst[i], vaddq_f64(vmulq_f64(d0, vld1q_f64(&slope[i])), vld1q_f64(&offset[i])));
+		vst1q_f64(&dst[i + 2], vaddq_f64(vmulq_f64(d1, vld1q_f64(&slope[i + 2])), vld1q_f64(&offset[i + 2])));
+		vst1q_f64(&dst[i + 4], vaddq_f64(vmulq_f64(d2, vld1q_f64(&slope[i + 4])), vld1q_f64(&offset[i + 4])));
+		vst1q_f64(&dst[i + 6], vaddq_f64(vmulq_f64(d3, vld1q_f64(&slope[i + 6])), vld1q_f64(&offset[i + 6])));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+void convert32Neon(const unsigned int* src, double* dst, const double* slope, const double* offset, unsigned int count)
+{
+	unsigned int i = 0;
+
+	for(; i + 4 <= count; i += 4)
+	{
+		uint32x4_t raw = vld1q_u32(&src[i]);
+
+		float64x2_t d0 = vcvtq_f64_u64(vmovl_u32(vget_low_u32(raw)));
+		float64x2_t d1 = vcvtq_f64_u64(vmovl_u32(vget_high_u32(raw)));
+
+		vst1q_f64(&dst[i], vaddq_f64(vmulq_f64(d0, vld1q_f64(&slope[i])), vld1q_f64(&offset[i])));
+		vst1q_f64(&dst[i + 2], vaddq_f64(vmulq_f64(d1, vld1q_f64(&slope[i + 2])), vld1q_f64(&offset[i + 2])));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+void convert16FloatNeon(const unsigned short* src, float* dst, const double* slope, const double* offset, unsigned int count)
+{
+	unsigned int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		uint16x8_t raw = vld1q_u16(&src[i]);
+		uint32x4_t lo = vmovl_u16(vget_low_u16(raw));
+		uint32x4_t hi = vmovl_u16(vget_high_u16(raw));
+
+		float64x2_t d0 = vaddq_f64(vmulq_f64(vcvtq_f64_u64(vmovl_u32(vget_low_u32(lo))), vld1q_f64(&slope[i])), vld1q_f64(&offset[i]));
+		float64x2_t d1 = vaddq_f64(vmulq_f64(vcvtq_f64_u64(vmovl_u32(vget_high_u32(lo))), vld1q_f64(&slope[i + 2])), vld1q_f64(&offset[i + 2]));
+		float64x2_t d2 = vaddq_f64(vmulq_f64(vcvtq_f64_u64(vmovl_u32(vget_low_u32(hi))), vld1q_f64(&slope[i + 4])), vld1q_f64(&offset[i + 4]));
+		float64x2_t d3 = vaddq_f64(vmulq_f64(vcvtq_f64_u64(vmovl_u32(vget_high_u32(hi))), vld1q_f64(&slope[i + 6])), vld1q_f64(&offset[i + 6]));
+
+		vst1q_f32(&dst[i], vcombine_f32(vcvt_f32_f64(d0), vcvt_f32_f64(d1)));
+		vst1q_f32(&dst[i + 4], vcombine_f32(vcvt_f32_f64(d2), vcvt_f32_f64(d3)));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+void convert32FloatNeon(const unsigned int* src, float* dst, const double* slope, const double* offset, unsigned int count)
+{
+	unsigned int i = 0;
+
+	for(; i + 4 <= count; i += 4)
+	{
+		uint32x4_t raw = vld1q_u32(&src[i]);
+
+		float64x2_t d0 = vaddq_f64(vmulq_f64(vcvtq_f64_u64(vmovl_u32(vget_low_u32(raw))), vld1q_f64(&slope[i])), vld1q_f64(&offset[i]));
+		float64x2_t d1 = vaddq_f64(vmulq_f64(vcvtq_f64_u64(vmovl_u32(vget_high_u32(raw))), vld1q_f64(&slope[i + 2])), vld1q_f64(&offset[i + 2]));
+
+		vst1q_f32(&dst[i], vcombine_f32(vcvt_f32_f64(d0), vcvt_f32_f64(d1)));
+	}
+
+	convertScalar(&src[i], &dst[i], &slope[i], &offset[i], count - i);
+}
+
+#endif /* UL_CONVERTER_NEON */
+
+// selects the conversion kernel for a source/destination type pair; an instruction set without a specialized kernel
+// falls back to the next narrower one
+template <typename S, typename D>
+struct Kernel
+{
+	typedef void (*Fn)(const S* src, D* dst, const double* slope, const double* offset, unsigned int count);
+
+	static Fn scalar() { return convertScalar<S, D>; }
+	static Fn sse2() { return scalar(); }
+	static Fn avx2() { return sse2(); }
+	static Fn neon() { return scalar(); }
+
+	static Fn select(ScanDataConverter::Isa isa)
+	{
+		switch(isa)
+		{
+		case ScanDataConverter::ISA_AVX2:
+			return avx2();
+		case ScanDataConverter::ISA_SSE2:
+			return sse2();
+		case ScanDataConverter::ISA_NEON:
+			return neon();
+		default:
+			return scalar();
+		}
+	}
+};
+
+#ifdef UL_CONVERTER_X86
+template <> Kernel<unsigned short, double>::Fn Kernel<unsigned short, double>::sse2() { return convert16Sse2; }
+template <> Kernel<unsigned int, double>::Fn Kernel<unsigned int, double>::sse2() { return convert32Sse2; }
+template <> Kernel<unsigned short, float>::Fn Kernel<unsigned short, float>::sse2() { return convert16FloatSse2; }
+template <> Kernel<unsigned int, float>::Fn Kernel<unsigned int, float>::sse2() { return convert32FloatSse2; }
+template <> Kernel<unsigned short, unsigned short>::Fn Kernel<unsigned short, unsigned short>::sse2() { return convert16Uint16Sse2; }
+
+template <> Kernel<unsigned short, double>::Fn Kernel<unsigned short, double>::avx2() { return convert16Avx2; }
+template <> Kernel<unsigned int, double>::Fn Kernel<unsigned int, double>::avx2() { return convert32Avx2; }
+template <> Kernel<unsigned short, float>::Fn Kernel<unsigned short, float>::avx2() { return convert16FloatAvx2; }
+template <> Kernel<unsigned int, float>::Fn Kernel<unsigned int, float>::avx2() { return convert32FloatAvx2; }
+template <> Kernel<unsigned short, unsigned short>::Fn Kernel<unsigned short, unsigned short>::avx2() { return convert16Uint16Avx2; }
+#endif /* UL_CONVERTER_X86 */
+
+#ifdef UL_CONVERTER_NEON
+template <> Kernel<unsigned short, double>::Fn Kernel<unsigned short, double>::neon() { return convert16Neon; }
+template <> Kernel<unsigned int, double>::Fn Kernel<unsigned int, double>::neon() { return convert32Neon; }
+template <> Kernel<unsigned short, float>::Fn Kernel<unsigned short, float>::neon() { return convert16FloatNeon; }
+template <> Kernel<unsigned int, float>::Fn Kernel<unsigned int, float>::neon() { return convert32FloatNeon; }
+#endif /* UL_CONVERTER_NEON */
+
+}
+
+int ScanDataConverter::mSelectedIsa = ISA_AUTO;
+
+ScanDataConverter::ScanDataConverter() : mIsa(selectedIsa())
+{
+	mChanCount = 1;
+	mTableSize = MIN_BLOCK_SIZE;
+
+	for(unsigned int i = 0; i < MAX_TABLE_SIZE; i++)
+	{
+		mSlope[i] = 1.0;
+		mOffset[i] = 0.0;
+	}
+}
+
+ScanDataConverter::~ScanDataConverter()
+{
+
+}
+
+ScanDataConverter::Isa ScanDataConverter::detectIsa()
+{
+#if defined(UL_CONVERTER_X86)
+	__builtin_cpu_init();
+
+	if(__builtin_cpu_supports("avx2"))
+		return ISA_AVX2;
+	else if(__builtin_cpu_supports("sse2"))
+		return ISA_SSE2;
+#elif defined(UL_CONVERTER_NEON)
+	return ISA_NEON;
+#endif
+
+	return ISA_SCALAR;
+}
+
+bool ScanDataConverter::isIsaSupported(Isa isa)
+{
+	bool supported = (isa == ISA_SCALAR);
+
+#if defined(UL_CONVERTER_X86)
+	__builtin_cpu_init();
+
+	if(isa == ISA_AVX2)
+		supported = __builtin_cpu_supports("avx2");
+	else if(isa == ISA_SSE2)
+		supported = __builtin_cpu_supports("sse2");
+#elif defined(UL_CONVERTER_NEON)
+	if(isa == ISA_NEON)
+		supported = true;
+#endif
+
+	return supported;
+}
+
+ScanDataConverter::Isa ScanDataConverter::selectedIsa()
+{
+	int isa = __atomic_load_n(&mSelectedIsa, __ATOMIC_RELAXED);
+
+	return (isa == ISA_AUTO) ? detectIsa() : (Isa) isa;
+}
+
+void ScanDataConverter::setIsa(int isa)
+{
+	if(isa != ISA_AUTO && (isa < ISA_SCALAR || isa > ISA_NEON || !isIsaSupported((Isa) isa)))
+		throw UlException(ERR_CONFIG_NOT_SUPPORTED);
+
+	__atomic_store_n(&mSelectedIsa, isa, __ATOMIC_RELAXED);
+}
+
+int ScanDataConverter::getIsa()
+{
+	return selectedIsa();
+}
+
+const char* ScanDataConverter::isaName(Isa isa)
+{
+	switch(isa)
+	{
+	case ISA_AVX2:
+		return "avx2";
+	case ISA_SSE2:
+		return "sse2";
+	case ISA_NEON:
+		return "neon";
+	default:
+		return "scalar";
+	}
+}
+
+void ScanDataConverter::setCoefs(unsigned int chanCount, const CalCoef* calCoefs, const CustomScale* customScales, bool calibrate)
+{
+	// the tables only hold MAX_CHAN_COUNT channels, converting more with them would apply the wrong coefficients
+	if(chanCount > MAX_CHAN_COUNT)
+		throw UlException(ERR_BAD_NUM_CHANS);
+
+	if(chanCount == 0)
+		chanCount = 1;
+
+	mIsa = selectedIsa();
+	mChanCount = chanCount;
+
+	// smallest multiple of the channel count that leaves room for at least MIN_BLOCK_SIZE samples after any start channel
+	mTableSize = ((mChanCount + MIN_BLOCK_SIZE + mChanCount - 1) / mChanCount) * mChanCount;
+
+	for(unsigned int ch = 0; ch < mChanCount; ch++)
+	{
+		double slope = customScales[ch].slope;
+		double offset = customScales[ch].offset;
+
+		if(calibrate)
+		{
+			offset = customScales[ch].slope * calCoefs[ch].offset + customScales[ch].offset;
+			slope = customScales[ch].slope * calCoefs[ch].slope;
+		}
+
+		for(unsigned int i = ch; i < mTableSize; i += mChanCount)
+		{
+			mSlope[i] = slope;
+			mOffset[i] = offset;
+		}
+	}
+
+	UL_LOG("scan data converter: " << isaName(mIsa) << ", chanCount = " << mChanCount);
+}
+
+template <typename S, typename D>
+void ScanDataConverter::convert(const S* src, D* dst, unsigned int count, unsigned int chanIdx) const
+{
+	typename Kernel<S, D>::Fn kernel = Kernel<S, D>::select(mIsa);
+
+	while(count)
+	{
+		unsigned int blockSize = mTableSize - chanIdx;
+
+		if(blockSize > count)
+			blockSize = count;
+
+		kernel(src, dst, &mSlope[chanIdx], &mOffset[chanIdx], blockSize);
+
+		src += blockSize;
+		dst += blockSize;
+		count -= blockSize;
+
+		chanIdx = (chanIdx + blockSize) % mChanCount;
+	}
+}
+
+template void ScanDataConverter::convert(const unsigned short* src, double* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned int* src, double* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned short* src, float* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned int* src, float* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned short* src, unsigned short* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned int* src, unsigned short* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned short* src, unsigned int* dst, unsigned int count, unsigned int chanIdx) const;
+template void ScanDataConverter::convert(const unsigned int* src, unsigned int* dst, unsigned int count, unsigned int chanIdx) const;
+
+} /* namespace ul */
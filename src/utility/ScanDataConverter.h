@@ -0,0 +1,66 @@
+/*
+ * ScanDataConverter.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_SCANDATACONVERTER_H_
+#define UTILITY_SCANDATACONVERTER_H_
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+class UL_LOCAL ScanDataConverter
+{
+public:
+	enum Isa { ISA_AUTO = -1, ISA_SCALAR, ISA_SSE2, ISA_AVX2, ISA_NEON };
+
+	ScanDataConverter();
+	virtual ~ScanDataConverter();
+
+	// fuses the calibration and custom scale coefficients of each channel into a single slope/offset pair, which
+	// can round differently in the last bit from applying them one after the other. Throws ERR_BAD_NUM_CHANS if
+	// chanCount is greater than MAX_CHAN_COUNT
+	void setCoefs(unsigned int chanCount, const CalCoef* calCoefs, const CustomScale* customScales, bool calibrate);
+
+	// converts channel-interleaved raw samples starting at channel index chanIdx. S is unsigned short or unsigned int,
+	// D is double, float, or unsigned short/unsigned int for calibrated counts rounded and clamped to the type range
+	template <typename S, typename D>
+	void convert(const S* src, D* dst, unsigned int count, unsigned int chanIdx) const;
+
+	// kernel used by the conversions set up after the call, ISA_AUTO picks the fastest one the CPU supports.
+	// Throws ERR_CONFIG_NOT_SUPPORTED if the CPU or the build does not support the kernel
+	static void setIsa(int isa);
+	static int getIsa();
+
+	inline unsigned int chanCount() const { return mChanCount; }
+	inline double slope(unsigned int chanIdx) const { return mSlope[chanIdx]; }
+	inline double offset(unsigned int chanIdx) const { return mOffset[chanIdx]; }
+
+private:
+	static Isa detectIsa();
+	static bool isIsaSupported(Isa isa);
+	static Isa selectedIsa();
+	static const char* isaName(Isa isa);
+
+private:
+	enum { MAX_CHAN_COUNT = 128, MIN_BLOCK_SIZE = 64, MAX_TABLE_SIZE = 2 * MAX_CHAN_COUNT + MIN_BLOCK_SIZE };
+
+	unsigned int mChanCount;
+	unsigned int mTableSize;
+
+	// per-sample coefficient tables; the channel pattern is repeated so any run starting at channel
+	// index i can be converted with contiguous vector loads from &mSlope[i] and &mOffset[i]
+	double mSlope[MAX_TABLE_SIZE];
+	double mOffset[MAX_TABLE_SIZE];
+
+	Isa mIsa;
+
+	static int mSelectedIsa;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_SCANDATACONVERTER_H_ */
@@ -0,0 +1,59 @@
+/*
+ * SeqCounter.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_SEQCOUNTER_H_
+#define UTILITY_SEQCOUNTER_H_
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// 64-bit counter with a single writer and lock-free readers. 32-bit targets can not store a 64-bit
+// value atomically without libatomic, so the value is guarded by a sequence number (seqlock)
+class UL_LOCAL SeqCounter
+{
+public:
+	SeqCounter() : mSeq(0), mValue(0) {}
+
+	// writers must not run concurrently
+	inline void store(unsigned long long value)
+	{
+		unsigned int seq = mSeq;
+
+		__atomic_store_n(&mSeq, seq + 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+
+		mValue = value;
+
+		__atomic_store_n(&mSeq, seq + 2, __ATOMIC_RELEASE);
+	}
+
+	// retries only while a store is in progress, never blocks the writer
+	inline unsigned long long load() const
+	{
+		unsigned int seq;
+		unsigned long long value;
+
+		do
+		{
+			seq = __atomic_load_n(&mSeq, __ATOMIC_ACQUIRE);
+			value = mValue;
+			__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		}
+		while((seq & 1) || seq != __atomic_load_n(&mSeq, __ATOMIC_RELAXED));
+
+		return value;
+	}
+
+private:
+	unsigned int mSeq;
+	volatile unsigned long long mValue;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_SEQCOUNTER_H_ */
@@ -0,0 +1,324 @@
+/*
+ * Trace.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+#include <new>
+
+#include "Trace.h"
+
+namespace ul
+{
+
+bool Trace::mEnabled = false;
+Trace::Point Trace::mPoints[POINT_COUNT];
+unsigned int Trace::mPointCount = 0;
+
+pthread_mutex_t Trace::mRingsMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_once_t Trace::mRingKeyOnce = PTHREAD_ONCE_INIT;
+pthread_key_t Trace::mRingKey;
+Trace::Ring* Trace::mRings = NULL;
+unsigned int Trace::mRingCount = 0;
+__thread Trace::Ring* Trace::mThreadRing = NULL;
+
+void Trace::setEnabled(bool enabled)
+{
+	__atomic_store_n(&mEnabled, enabled, __ATOMIC_RELAXED);
+}
+
+// the tracepoints stay registered, only their statistics and the events are cleared. Passes through the
+// tracepoints that complete while the reset is in progress may be partially counted
+void Trace::reset()
+{
+	for(int i = 0; i < POINT_COUNT; i++)
+	{
+		Point& point = mPoints[i];
+
+		__atomic_store_n(&point.count, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&point.totalNs, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&point.maxNs, 0, __ATOMIC_RELAXED);
+
+		for(int bucket = 0; bucket < BUCKET_COUNT; bucket++)
+			__atomic_store_n(&point.histogram[bucket], 0, __ATOMIC_RELAXED);
+	}
+
+	pthread_mutex_lock(&mRingsMutex);
+
+	// the head of a ring is only written by its thread, the events before resetHead are not dumped
+	for(Ring* ring = mRings; ring; ring = ring->next)
+		ring->resetHead = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+	pthread_mutex_unlock(&mRingsMutex);
+}
+
+unsigned int Trace::getPointCount()
+{
+	return __atomic_load_n(&mPointCount, __ATOMIC_ACQUIRE);
+}
+
+// the tracepoints are returned in the order of the table, which does not change once a tracepoint is registered
+bool Trace::getStats(unsigned int index, TraceStats* stats)
+{
+	unsigned int found = 0;
+
+	for(int i = 0; i < POINT_COUNT; i++)
+	{
+		Point& point = mPoints[i];
+		unsigned long key = __atomic_load_n(&point.key, __ATOMIC_ACQUIRE);
+
+		if(key == 0)
+			continue;
+
+		if(found++ == index)
+		{
+			memset(stats, 0, sizeof(TraceStats));
+
+			getName(key, stats->name, sizeof(stats->name));
+
+			stats->count = __atomic_load_n(&point.count, __ATOMIC_RELAXED);
+			stats->totalNs = __atomic_load_n(&point.totalNs, __ATOMIC_RELAXED);
+			stats->maxNs = __atomic_load_n(&point.maxNs, __ATOMIC_RELAXED);
+
+			for(int bucket = 0; bucket < BUCKET_COUNT; bucket++)
+				stats->histogram[bucket] = __atomic_load_n(&point.histogram[bucket], __ATOMIC_RELAXED);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Trace::dump(bool events)
+{
+	TraceStats stats;
+
+	std::cerr << "trace: " << getPointCount() << " tracepoints" << std::endl;
+
+	for(unsigned int index = 0; getStats(index, &stats); index++)
+	{
+		if(stats.count == 0)
+			continue;
+
+		std::cerr << "trace: " << stats.name << " count " << stats.count << " avg " << (stats.totalNs / stats.count) / 1000.0
+				  << " us max " << stats.maxNs / 1000.0 << " us histogram";
+
+		for(int bucket = 0; bucket < BUCKET_COUNT; bucket++)
+		{
+			if(stats.histogram[bucket])
+				std::cerr << " [" << (1ULL << bucket) << " ns]=" << stats.histogram[bucket];
+		}
+
+		std::cerr << std::endl;
+	}
+
+	if(!events)
+		return;
+
+	char name[sizeof(stats.name)];
+
+	pthread_mutex_lock(&mRingsMutex);
+
+	for(Ring* ring = mRings; ring; ring = ring->next)
+	{
+		unsigned long long head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+		unsigned long long first = head > RING_SIZE ? head - RING_SIZE : 0;
+
+		if(first < ring->resetHead)
+			first = ring->resetHead;
+
+		Event ringEvents[RING_SIZE];
+
+		for(unsigned long long pos = first; pos < head; pos++)
+		{
+			Event& event = ring->events[pos % RING_SIZE];
+			Event& copy = ringEvents[pos % RING_SIZE];
+
+			copy.key = __atomic_load_n(&event.key, __ATOMIC_RELAXED);
+			copy.startNs = __atomic_load_n(&event.startNs, __ATOMIC_RELAXED);
+			copy.durationNs = __atomic_load_n(&event.durationNs, __ATOMIC_RELAXED);
+		}
+
+		// the events the thread wrote while they were copied replaced the oldest ones, which are skipped. The slot of
+		// newHead may be in the middle of being written, so the event it held is skipped too
+		unsigned long long newHead = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+		if(newHead + 1 > first + RING_SIZE)
+			first = newHead + 1 - RING_SIZE;
+
+		for(unsigned long long pos = first; pos < head; pos++)
+		{
+			Event& event = ringEvents[pos % RING_SIZE];
+
+			getName(event.key, name, sizeof(name));
+
+			std::cerr << "trace: ring " << ring->num << " " << event.startNs << " ns " << name << " "
+					  << event.durationNs / 1000.0 << " us" << std::endl;
+		}
+	}
+
+	pthread_mutex_unlock(&mRingsMutex);
+}
+
+void Trace::record(unsigned long key, unsigned long long startNs)
+{
+	unsigned long long durationNs = ul_clock_monotonic_ns() - startNs;
+
+	Point* point = findPoint(key);
+
+	if(point)
+	{
+		__atomic_fetch_add(&point->count, 1, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&point->totalNs, durationNs, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&point->histogram[bucketOf(durationNs)], 1, __ATOMIC_RELAXED);
+
+		unsigned long long maxNs = __atomic_load_n(&point->maxNs, __ATOMIC_RELAXED);
+
+		while(durationNs > maxNs && !__atomic_compare_exchange_n(&point->maxNs, &maxNs, durationNs, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			;
+	}
+
+	Ring* ring = getRing();
+
+	if(ring)
+	{
+		// only this thread writes the ring, the head is published after the event so dump() never reads an event
+		// that is being written unless it is older than the ring size
+		unsigned long long head = ring->head;
+		Event& event = ring->events[head % RING_SIZE];
+
+		__atomic_store_n(&event.key, key, __ATOMIC_RELAXED);
+		__atomic_store_n(&event.startNs, startNs, __ATOMIC_RELAXED);
+		__atomic_store_n(&event.durationNs, durationNs, __ATOMIC_RELAXED);
+
+		__atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+	}
+}
+
+// open addressing table of the tracepoints, a slot is claimed by setting its key and is never released.
+// Returns NULL if the table is full
+Trace::Point* Trace::findPoint(unsigned long key)
+{
+	unsigned int slot = (unsigned int) ((key * 0x9E3779B97F4A7C15ULL) >> 32) % POINT_COUNT;
+
+	for(int probe = 0; probe < POINT_COUNT; probe++)
+	{
+		Point& point = mPoints[slot];
+		unsigned long slotKey = __atomic_load_n(&point.key, __ATOMIC_ACQUIRE);
+
+		if(slotKey == key)
+			return &point;
+
+		if(slotKey == 0)
+		{
+			if(__atomic_compare_exchange_n(&point.key, &slotKey, key, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			{
+				__atomic_fetch_add(&mPointCount, 1, __ATOMIC_RELEASE);
+				return &point;
+			}
+
+			// another thread claimed the slot
+			if(slotKey == key)
+				return &point;
+		}
+
+		slot = (slot + 1) % POINT_COUNT;
+	}
+
+	return NULL;
+}
+
+// the ring of a thread is returned to the pool when the thread exits, so the rings are reused by the transfer
+// threads that are created for every scan
+Trace::Ring* Trace::getRing()
+{
+	if(mThreadRing)
+		return mThreadRing;
+
+	pthread_once(&mRingKeyOnce, createRingKey);
+
+	pthread_mutex_lock(&mRingsMutex);
+
+	Ring* ring = mRings;
+
+	while(ring && ring->inUse)
+		ring = ring->next;
+
+	if(ring == NULL)
+	{
+		ring = new (std::nothrow) Ring;
+
+		if(ring)
+		{
+			ring->head = 0;
+			ring->resetHead = 0;
+			ring->num = mRingCount++;
+			ring->next = mRings;
+			mRings = ring;
+		}
+	}
+
+	if(ring)
+	{
+		ring->inUse = true;
+		pthread_setspecific(mRingKey, ring);
+	}
+
+	pthread_mutex_unlock(&mRingsMutex);
+
+	mThreadRing = ring;
+
+	return ring;
+}
+
+void Trace::releaseRing(void* ring)
+{
+	pthread_mutex_lock(&mRingsMutex);
+
+	((Ring*) ring)->inUse = false;
+
+	pthread_mutex_unlock(&mRingsMutex);
+
+	// a tracepoint passed by a later thread-specific data destructor of this thread claims another ring
+	mThreadRing = NULL;
+}
+
+void Trace::createRingKey()
+{
+	pthread_key_create(&mRingKey, releaseRing);
+}
+
+int Trace::bucketOf(unsigned long long ns)
+{
+	int bucket = 0;
+
+	while(ns > 1 && bucket < BUCKET_COUNT - 1)
+	{
+		ns >>= 1;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+void Trace::getName(unsigned long key, char* name, unsigned int size)
+{
+	if(key < KEY_CMD_LIMIT)
+	{
+		static const char* transports[] = { "", "usb", "hid", "net" };
+		unsigned int transport = key >> 8;
+
+		snprintf(name, size, "%s cmd 0x%02lx", transport < 4 ? transports[transport] : "", key & 0xff);
+	}
+	else
+	{
+		strncpy(name, (const char*) key, size - 1);
+		name[size - 1] = '\0';
+	}
+}
+
+} /* namespace ul */
@@ -0,0 +1,117 @@
+/*
+ * Trace.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_TRACE_H_
+#define UTILITY_TRACE_H_
+
+#include <pthread.h>
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// runtime switchable tracing. A tracepoint is identified by a key, either the address of the string literal that
+// names it (FnLog) or a command key (TraceCmd). While tracing is disabled a tracepoint costs a single load of the
+// enabled flag. While it is enabled, the latency of every pass through a tracepoint is added to the latency histogram
+// of the tracepoint and written to the event ring of the calling thread. The histograms are updated with atomic
+// operations and every thread writes only its own ring, so no lock is taken on the traced paths
+class UL_LOCAL Trace
+{
+public:
+	// bucket n counts latencies in the range [2^n, 2^(n+1)) ns
+	enum { BUCKET_COUNT = 32 };
+	enum { CMD_USB = 1, CMD_HID = 2, CMD_NET = 3 };
+
+	static inline bool isEnabled() { return __atomic_load_n(&mEnabled, __ATOMIC_RELAXED);}
+	static void setEnabled(bool enabled);
+
+	static void reset();
+	static unsigned int getPointCount();
+	static bool getStats(unsigned int index, TraceStats* stats);
+	static void dump(bool events);
+
+	static inline unsigned long cmdKey(int transport, unsigned int cmd) { return (transport << 8) | (cmd & 0xff);}
+	static void record(unsigned long key, unsigned long long startNs);
+
+private:
+	enum { POINT_COUNT = 1024, RING_SIZE = 1024, KEY_CMD_LIMIT = 0x10000 };
+
+	struct Point
+	{
+		unsigned long key;
+		unsigned long long count;
+		unsigned long long totalNs;
+		unsigned long long maxNs;
+		unsigned long long histogram[BUCKET_COUNT];
+	};
+
+	struct Event
+	{
+		unsigned long key;
+		unsigned long long startNs;
+		unsigned long long durationNs;
+	};
+
+	struct Ring
+	{
+		Ring* next;
+		bool inUse;
+		unsigned int num;
+		unsigned long long head;
+		unsigned long long resetHead;
+		Event events[RING_SIZE];
+	};
+
+	static Point* findPoint(unsigned long key);
+	static Ring* getRing();
+	static void releaseRing(void* ring);
+	static void createRingKey();
+	static int bucketOf(unsigned long long ns);
+	static void getName(unsigned long key, char* name, unsigned int size);
+
+private:
+	static bool mEnabled;
+	static Point mPoints[POINT_COUNT];
+	static unsigned int mPointCount;
+
+	static pthread_mutex_t mRingsMutex;
+	static pthread_once_t mRingKeyOnce;
+	static pthread_key_t mRingKey;
+	static Ring* mRings;
+	static unsigned int mRingCount;
+	static __thread Ring* mThreadRing;
+};
+
+// traces the latency of a command sent to a device, the key of the tracepoint is the transport and the command code
+class UL_LOCAL TraceCmd
+{
+public:
+	inline TraceCmd(int transport, unsigned int cmd)
+	{
+		mStartNs = 0;
+
+		if(Trace::isEnabled())
+		{
+			mKey = Trace::cmdKey(transport, cmd);
+			mStartNs = ul_clock_monotonic_ns();
+		}
+	}
+
+	inline ~TraceCmd()
+	{
+		if(mStartNs)
+			Trace::record(mKey, mStartNs);
+	}
+
+private:
+	unsigned long mKey;
+	unsigned long long mStartNs;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_TRACE_H_ */
@@ -0,0 +1,173 @@
+/*
+ * WorkerPool.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include "WorkerPool.h"
+#include "UlLock.h"
+#include "../UlException.h"
+
+namespace ul
+{
+
+WorkerPool::WorkerPool()
+{
+	mThreadCount = 1;
+	mWorkerCount = 0;
+	memset(mWorkers, 0, sizeof(mWorkers));
+
+	pthread_mutex_init(&mMutex, NULL);
+	pthread_cond_init(&mStartCond, NULL);
+	pthread_cond_init(&mDoneCond, NULL);
+
+	UlLock::initMutex(mRunMutex, PTHREAD_MUTEX_RECURSIVE);
+
+	mTask = NULL;
+	mChunkCount = 0;
+	mNextChunk = 0;
+	mCompletedChunks = 0;
+	mActiveWorkers = 0;
+	mGeneration = 0;
+	mTerminate = false;
+}
+
+WorkerPool::~WorkerPool()
+{
+	terminateThreads();
+
+	UlLock::destroyMutex(mRunMutex);
+
+	pthread_cond_destroy(&mDoneCond);
+	pthread_cond_destroy(&mStartCond);
+	pthread_mutex_destroy(&mMutex);
+}
+
+void WorkerPool::setThreadCount(unsigned int threadCount)
+{
+	if(threadCount == 0)
+		threadCount = 1;
+
+	if(threadCount > MAX_THREAD_COUNT)
+		throw UlException(ERR_BAD_CONFIG_VAL);
+
+	UlLock lock(mRunMutex);
+
+	terminateThreads();
+
+	mTerminate = false;
+
+	for(unsigned int i = 0; i < threadCount - 1; i++)
+	{
+		if(pthread_create(&mWorkers[mWorkerCount], NULL, &workerThread, this))
+		{
+			UL_LOG("#### Unable to start the worker pool thread");
+			break;
+		}
+
+#ifndef __APPLE__
+		pthread_setname_np(mWorkers[mWorkerCount], "conv_td");
+#endif
+		mWorkerCount++;
+	}
+
+	mThreadCount = mWorkerCount + 1;
+}
+
+void WorkerPool::run(Task* task, unsigned int chunkCount)
+{
+	UlLock lock(mRunMutex);
+
+	if(mWorkerCount == 0 || chunkCount < 2)
+	{
+		for(unsigned int i = 0; i < chunkCount; i++)
+			task->runChunk(i);
+
+		return;
+	}
+
+	pthread_mutex_lock(&mMutex);
+	mTask = task;
+	mChunkCount = chunkCount;
+	mNextChunk = 0;
+	mCompletedChunks = 0;
+	mGeneration++;
+	pthread_cond_broadcast(&mStartCond);
+	pthread_mutex_unlock(&mMutex);
+
+	runChunks();
+
+	// also wait for the workers to leave the task, so none of them can claim a chunk of the next task with stale state
+	pthread_mutex_lock(&mMutex);
+	while(mCompletedChunks < mChunkCount || mActiveWorkers)
+		pthread_cond_wait(&mDoneCond, &mMutex);
+	mTask = NULL;
+	pthread_mutex_unlock(&mMutex);
+}
+
+void WorkerPool::runChunks()
+{
+	unsigned int chunkIdx;
+	unsigned int completed = 0;
+
+	while((chunkIdx = __atomic_fetch_add(&mNextChunk, 1, __ATOMIC_RELAXED)) < mChunkCount)
+	{
+		mTask->runChunk(chunkIdx);
+		completed++;
+	}
+
+	if(completed)
+	{
+		pthread_mutex_lock(&mMutex);
+		mCompletedChunks += completed;
+		pthread_cond_signal(&mDoneCond);
+		pthread_mutex_unlock(&mMutex);
+	}
+}
+
+void* WorkerPool::workerThread(void* arg)
+{
+	WorkerPool* This = (WorkerPool*) arg;
+
+	pthread_mutex_lock(&This->mMutex);
+	unsigned int generation = This->mGeneration;
+
+	while(!This->mTerminate)
+	{
+		if(generation == This->mGeneration || This->mTask == NULL)
+		{
+			pthread_cond_wait(&This->mStartCond, &This->mMutex);
+			continue;
+		}
+
+		generation = This->mGeneration;
+		This->mActiveWorkers++;
+		pthread_mutex_unlock(&This->mMutex);
+
+		This->runChunks();
+
+		pthread_mutex_lock(&This->mMutex);
+		This->mActiveWorkers--;
+		pthread_cond_signal(&This->mDoneCond);
+	}
+
+	pthread_mutex_unlock(&This->mMutex);
+
+	return NULL;
+}
+
+void WorkerPool::terminateThreads()
+{
+	pthread_mutex_lock(&mMutex);
+	mTerminate = true;
+	pthread_cond_broadcast(&mStartCond);
+	pthread_mutex_unlock(&mMutex);
+
+	for(unsigned int i = 0; i < mWorkerCount; i++)
+		pthread_join(mWorkers[i], NULL);
+
+	mWorkerCount = 0;
+	mThreadCount = 1;
+}
+
+} /* namespace ul */
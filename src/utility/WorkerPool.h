@@ -0,0 +1,68 @@
+/*
+ * WorkerPool.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_WORKERPOOL_H_
+#define UTILITY_WORKERPOOL_H_
+
+#include <pthread.h>
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// small pool of threads that runs the chunks of one task at a time. The calling thread works on the
+// task as well; idle threads claim the next unclaimed chunk, so faster threads pick up more chunks
+class UL_LOCAL WorkerPool
+{
+public:
+	class Task
+	{
+	public:
+		virtual ~Task() {};
+		virtual void runChunk(unsigned int chunkIdx) = 0;
+	};
+
+	enum { MAX_THREAD_COUNT = 16 };
+
+	WorkerPool();
+	virtual ~WorkerPool();
+
+	// number of threads including the calling thread, 1 runs all chunks on the calling thread
+	void setThreadCount(unsigned int threadCount);
+	unsigned int getThreadCount() const { return mThreadCount; }
+
+	// returns when all chunks have completed
+	void run(Task* task, unsigned int chunkCount);
+
+private:
+	static void* workerThread(void* arg);
+	void runChunks();
+	void terminateThreads();
+
+private:
+	unsigned int mThreadCount;
+	unsigned int mWorkerCount;
+	pthread_t mWorkers[MAX_THREAD_COUNT];
+
+	pthread_mutex_t mMutex;
+	pthread_cond_t mStartCond;
+	pthread_cond_t mDoneCond;
+
+	pthread_mutex_t mRunMutex;
+
+	Task* mTask;
+	unsigned int mChunkCount;
+	unsigned int mNextChunk;
+	unsigned int mCompletedChunks;
+	unsigned int mActiveWorkers;
+	unsigned int mGeneration;
+	bool mTerminate;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_WORKERPOOL_H_ */
@@ -0,0 +1,163 @@
+/*
+ * XferTiming.cpp
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#include <string.h>
+#include <iomanip>
+
+#include "XferTiming.h"
+
+namespace ul
+{
+
+XferTiming::XferTiming()
+{
+	reset();
+}
+
+void XferTiming::reset()
+{
+	mStageCount = 0;
+	mFirstStartNs = 0;
+	mLastStartNs = 0;
+	mBusyNs = 0;
+	mMaxBusyNs = 0;
+	mMaxIntervalNs = 0;
+	mLateStageCount = 0;
+
+	memset(mBusyHistogram, 0, sizeof(mBusyHistogram));
+	memset(mIntervalHistogram, 0, sizeof(mIntervalHistogram));
+
+	mResubmitNs = 0;
+	mMaxResubmitNs = 0;
+	mXferCount = 0;
+	mMinPending = 0;
+	mMaxBacklog = 0;
+	mBacklogCapacity = 0;
+}
+
+void XferTiming::record(unsigned long long startNs, unsigned int bytes, double byteRate)
+{
+	unsigned long long busyNs = ul_clock_monotonic_ns() - startNs;
+
+	if(mStageCount)
+	{
+		unsigned long long intervalNs = startNs - mLastStartNs;
+
+		if(intervalNs > mMaxIntervalNs)
+			mMaxIntervalNs = intervalNs;
+
+		mIntervalHistogram[bucketOf(intervalNs)]++;
+	}
+	else
+		mFirstStartNs = startNs;
+
+	mLastStartNs = startNs;
+	mStageCount++;
+
+	mBusyNs += busyNs;
+
+	if(busyNs > mMaxBusyNs)
+		mMaxBusyNs = busyNs;
+
+	mBusyHistogram[bucketOf(busyNs)]++;
+
+	// a transfer path that keeps taking longer than the device to move the data of a stage uses up its queued
+	// transfers and the device FIFO. Nothing is counted while the scan rate is unknown
+	if(byteRate > 0 && busyNs * byteRate > bytes * 1e9)
+		mLateStageCount++;
+}
+
+void XferTiming::recordResubmit(unsigned long long startNs)
+{
+	unsigned long long resubmitNs = ul_clock_monotonic_ns() - startNs;
+
+	mResubmitNs += resubmitNs;
+
+	if(resubmitNs > mMaxResubmitNs)
+		mMaxResubmitNs = resubmitNs;
+}
+
+void XferTiming::recordPending(unsigned int pending)
+{
+	// the first stage sets the minimum, mXferCount is the most the device can have queued
+	if(mStageCount <= 1 || pending < mMinPending)
+		mMinPending = pending;
+}
+
+void XferTiming::recordBacklog(unsigned long long backlog)
+{
+	if(backlog > mMaxBacklog)
+		mMaxBacklog = backlog;
+}
+
+void XferTiming::getStats(ScanStats* stats) const
+{
+	memset(stats, 0, sizeof(ScanStats));
+
+	stats->stageCount = mStageCount;
+	stats->elapsedNs = elapsedNs();
+	stats->maxIntervalNs = mMaxIntervalNs;
+	stats->resubmitNs = mResubmitNs;
+	stats->maxResubmitNs = mMaxResubmitNs;
+	stats->xferCount = mXferCount;
+	stats->minXferPending = mMinPending;
+	stats->maxBacklog = mMaxBacklog;
+	stats->backlogCapacity = mBacklogCapacity;
+
+	memcpy(stats->intervalHistogram, mIntervalHistogram, sizeof(stats->intervalHistogram));
+
+	getProcessStats(stats);
+}
+
+void XferTiming::getProcessStats(ScanStats* stats) const
+{
+	stats->processNs = mBusyNs;
+	stats->maxProcessNs = mMaxBusyNs;
+	stats->lateStageCount = mLateStageCount;
+
+	memcpy(stats->processHistogram, mBusyHistogram, sizeof(stats->processHistogram));
+}
+
+int XferTiming::bucketOf(unsigned long long ns)
+{
+	int bucket = 0;
+
+	while(ns > 1 && bucket < BUCKET_COUNT - 1)
+	{
+		ns >>= 1;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+void XferTiming::log(const char* name, unsigned long long sampleCount) const
+{
+#ifdef TRACE
+	if(mStageCount < 2)
+		return;
+
+	double elapsedSec = elapsedNs() / 1e9;
+	double samplesPerSec = elapsedSec > 0 ? sampleCount / elapsedSec : 0;
+	double nsPerSample = sampleCount ? (double) mBusyNs / sampleCount : 0;
+	double duty = elapsedNs() ? 100.0 * mBusyNs / elapsedNs() : 0;
+
+	UL_LOG(name << ": " << mStageCount << " stages, " << std::fixed << std::setprecision(0) << samplesPerSec << " samples/s, "
+		   << std::setprecision(2) << nsPerSample << " ns/sample, " << duty << "% busy, max busy " << mMaxBusyNs / 1000 << " us, max interval "
+		   << mMaxIntervalNs / 1000 << " us, " << mLateStageCount << " late stages");
+
+	for(int bucket = 0; bucket < BUCKET_COUNT; bucket++)
+	{
+		if(mBusyHistogram[bucket])
+			UL_LOG(name << ":   " << (1ULL << bucket) << " ns+ : " << mBusyHistogram[bucket]);
+	}
+#else
+	(void) name;
+	(void) sampleCount;
+#endif
+}
+
+} /* namespace ul */
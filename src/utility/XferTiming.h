@@ -0,0 +1,81 @@
+/*
+ * XferTiming.h
+ *
+ *     Author: Measurement Computing Corporation
+ */
+
+#ifndef UTILITY_XFERTIMING_H_
+#define UTILITY_XFERTIMING_H_
+
+#include "../ul_internal.h"
+
+namespace ul
+{
+
+// collects the completion interval and processing time of every stage of a scan so throughput,
+// processing cost per sample and the margin left before the transfer path falls behind can be read
+// back during and after a scan. Only the thread that completes the stages may call the record functions,
+// the counters read by other threads while a scan runs are not updated together
+class UL_LOCAL XferTiming
+{
+public:
+	XferTiming();
+
+	// bucket n counts durations in the range [2^n, 2^(n+1)) ns
+	enum {BUCKET_COUNT = 32};
+
+	void reset();
+
+	inline unsigned long long begin() const { return ul_clock_monotonic_ns(); }
+	// bytes is the amount of scan data handled by the stage and byteRate the rate, in bytes per second, at which the
+	// device produces or consumes it, a stage is late if handling it took longer than the device took to move its data
+	void record(unsigned long long startNs, unsigned int bytes, double byteRate);
+	// time taken to resubmit the transfer of a completed stage
+	void recordResubmit(unsigned long long startNs);
+	// number of transfers still queued at the device when a stage completed
+	void recordPending(unsigned int pending);
+	// amount of data received and waiting to be processed, out of backlogCapacity
+	void recordBacklog(unsigned long long backlog);
+
+	void setXferCount(unsigned int xferCount) { mXferCount = xferCount;}
+	void setBacklogCapacity(unsigned long long capacity) { mBacklogCapacity = capacity;}
+
+	unsigned long long stageCount() const { return mStageCount;}
+	unsigned long long elapsedNs() const { return mLastStartNs - mFirstStartNs;}
+	unsigned long long busyNs() const { return mBusyNs;}
+	unsigned long long maxBusyNs() const { return mMaxBusyNs;}
+	unsigned long long maxIntervalNs() const { return mMaxIntervalNs;}
+	unsigned long long lateStageCount() const { return mLateStageCount;}
+	unsigned long long busyHistogram(int bucket) const { return mBusyHistogram[bucket];}
+
+	void getStats(ScanStats* stats) const;
+	// replaces the processing times of stats, for scans whose stages are processed by another thread
+	void getProcessStats(ScanStats* stats) const;
+
+	void log(const char* name, unsigned long long sampleCount) const;
+
+private:
+	static int bucketOf(unsigned long long ns);
+
+private:
+	unsigned long long mStageCount;
+	unsigned long long mFirstStartNs;
+	unsigned long long mLastStartNs;
+	unsigned long long mBusyNs;
+	unsigned long long mMaxBusyNs;
+	unsigned long long mMaxIntervalNs;
+	unsigned long long mLateStageCount;
+	unsigned long long mBusyHistogram[BUCKET_COUNT];
+	unsigned long long mIntervalHistogram[BUCKET_COUNT];
+
+	unsigned long long mResubmitNs;
+	unsigned long long mMaxResubmitNs;
+	unsigned int mXferCount;
+	unsigned int mMinPending;
+	unsigned long long mMaxBacklog;
+	unsigned long long mBacklogCapacity;
+};
+
+} /* namespace ul */
+
+#endif /* UTILITY_XFERTIMING_H_ */